@@ -3,6 +3,7 @@
 //
 // Build: cmake --build build && ./build/bin/benchmarks/constexpr_serializer_bench
 
+#include <array>
 #include <iostream>
 #include <iomanip>
 #include <vector>
@@ -10,9 +11,12 @@
 #include <numeric>
 #include <chrono>
 #include <cstring>
+#include <string>
 
 #include "nexusfix/serializer/constexpr_serializer.hpp"
 #include "nexusfix/messages/common/header.hpp"
+#include "nexusfix/messages/fix44/new_order_template.hpp"
+#include "nexusfix/messages/fix44/mass_quote.hpp"
 #include "nexusfix/util/cpu_affinity.hpp"
 
 using namespace nfx;
@@ -52,6 +56,22 @@ T percentile(std::vector<T>& data, double p) {
     return data[idx];
 }
 
+// Median latency in ns of BENCHMARK_ITERATIONS calls of fn(i)
+template<typename Fn>
+double median_ns(Fn&& fn, double cpu_freq_ghz) {
+    std::vector<uint64_t> latencies;
+    latencies.reserve(BENCHMARK_ITERATIONS);
+    for (int i = 0; i < BENCHMARK_ITERATIONS; ++i) {
+        uint64_t start = rdtsc();
+        auto msg = fn(static_cast<uint32_t>(i + 1));
+        uint64_t end = rdtsc();
+        asm volatile("" : : "r"(msg.data()) : "memory");
+        latencies.push_back(end - start);
+    }
+    std::sort(latencies.begin(), latencies.end());
+    return static_cast<double>(latencies[BENCHMARK_ITERATIONS / 2]) / cpu_freq_ghz;
+}
+
 // Escape SOH for display
 std::string escape_soh(std::string_view msg) {
     std::string result;
@@ -276,6 +296,113 @@ int main() {
               << (fast_throughput / 1e6) << " M msgs/sec\n";
     std::cout << "  Runtime:   " << (runtime_throughput / 1e6) << " M msgs/sec\n";
 
+    // ========================================================================
+    // Order Entry Templates (session send path)
+    // ========================================================================
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  Order Entry: Layout Template vs MessageAssembler\n";
+    std::cout << "----------------------------------------------------------\n";
+
+    MessageAssembler assembler;
+    const auto order_entry = [&](const char* name, auto builder, auto& tmpl) {
+        tmpl.prepare(BEGIN_STRING, SENDER, TARGET);
+        builder.sender_comp_id(SENDER).target_comp_id(TARGET).sending_time(SENDING_TIME);
+        for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+            auto msg = tmpl.build(builder, static_cast<uint32_t>(i), SENDING_TIME);
+            asm volatile("" : : "r"(msg.data()) : "memory");
+        }
+        const double templated = median_ns([&](uint32_t seq) {
+            return tmpl.build(builder, seq, SENDING_TIME);
+        }, cpu_freq_ghz);
+        const double generic = median_ns([&](uint32_t seq) {
+            return builder.msg_seq_num(seq).build(assembler);
+        }, cpu_freq_ghz);
+        std::cout << "  " << std::left << std::setw(30) << name << std::right
+                  << std::setw(8) << std::setprecision(1) << templated << " ns"
+                  << std::setw(8) << generic << " ns"
+                  << std::setw(8) << std::setprecision(2) << (generic / templated) << "x\n";
+    };
+
+    std::cout << "                                  Template  Assembler  Speedup\n";
+    constexpr std::string_view TRANSACT_TIME = SENDING_TIME;
+    fix44::NewOrderTemplate order_tmpl;
+    order_entry("NewOrderSingle (D)", fix44::NewOrderSingle::Builder{}
+        .cl_ord_id("ORD0000001").symbol("AAPL").side(Side::Buy)
+        .transact_time(TRANSACT_TIME).order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit).price(FixedPrice::from_string("150.25")), order_tmpl);
+    fix44::OrderCancelTemplate cancel_tmpl;
+    order_entry("OrderCancelRequest (F)", fix44::OrderCancelRequest::Builder{}
+        .orig_cl_ord_id("ORD0000001").cl_ord_id("CXL0000001").symbol("AAPL")
+        .side(Side::Buy).transact_time(TRANSACT_TIME), cancel_tmpl);
+    fix44::OrderCancelReplaceTemplate replace_tmpl;
+    order_entry("OrderCancelReplaceRequest (G)", fix44::OrderCancelReplaceRequest::Builder{}
+        .orig_cl_ord_id("ORD0000001").cl_ord_id("RPL0000001").symbol("AAPL")
+        .side(Side::Buy).transact_time(TRANSACT_TIME).order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit).price(FixedPrice::from_string("150.50")), replace_tmpl);
+    fix44::OrderStatusTemplate status_tmpl;
+    order_entry("OrderStatusRequest (H)", fix44::OrderStatusRequest::Builder{}
+        .cl_ord_id("ORD0000001").symbol("AAPL").side(Side::Buy), status_tmpl);
+
+    // ========================================================================
+    // MassQuote (nested QuoteSet / QuoteEntry groups)
+    // ========================================================================
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  MassQuote: Encoder vs MessageAssembler (1 set x 20 quotes)\n";
+    std::cout << "----------------------------------------------------------\n";
+
+    constexpr uint32_t QUOTES = 20;
+    std::array<fix44::QuoteEntry, QUOTES> quotes{};
+    std::array<std::string, QUOTES> quote_ids{};
+    for (uint32_t q = 0; q < QUOTES; ++q) {
+        quote_ids[q] = "E" + std::to_string(q);
+        quotes[q] = {quote_ids[q], "AAPL", FixedPrice::from_string("150.25"),
+                     FixedPrice::from_string("150.30"), Qty::from_int(100), Qty::from_int(200)};
+    }
+
+    fix44::MassQuoteEncoder quote_enc;
+    quote_enc.prepare(BEGIN_STRING, SENDER, TARGET);
+    const auto encode_quotes = [&](uint32_t seq) {
+        (void)quote_enc.begin(seq, SENDING_TIME, "Q1", 1);
+        (void)quote_enc.add_set("S1", "AAPL", QUOTES);
+        for (const auto& quote : quotes) (void)quote_enc.add_entry(quote);
+        return quote_enc.finish();
+    };
+    const auto assemble_quotes = [&](uint32_t seq) {
+        assembler.start()
+            .field(tag::MsgType::value, 'i')
+            .field(tag::SenderCompID::value, SENDER)
+            .field(tag::TargetCompID::value, TARGET)
+            .field(tag::MsgSeqNum::value, static_cast<int64_t>(seq))
+            .field(tag::SendingTime::value, SENDING_TIME)
+            .field(tag::QuoteID::value, std::string_view{"Q1"})
+            .field(tag::NoQuoteSets::value, int64_t{1})
+            .field(tag::QuoteSetID::value, std::string_view{"S1"})
+            .field(tag::UnderlyingSymbol::value, std::string_view{"AAPL"})
+            .field(tag::NoQuoteEntries::value, static_cast<int64_t>(QUOTES));
+        for (const auto& quote : quotes) {
+            assembler.field(tag::QuoteEntryID::value, quote.quote_entry_id)
+                .field(tag::Symbol::value, quote.symbol)
+                .field(tag::BidPx::value, quote.bid_px)
+                .field(tag::OfferPx::value, quote.offer_px)
+                .field(tag::BidSize::value, quote.bid_size.whole())
+                .field(tag::OfferSize::value, quote.offer_size.whole());
+        }
+        return assembler.finish();
+    };
+    for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+        auto msg = encode_quotes(static_cast<uint32_t>(i));
+        asm volatile("" : : "r"(msg.data()) : "memory");
+    }
+    const double quote_encoder = median_ns(encode_quotes, cpu_freq_ghz);
+    const double quote_assembler = median_ns(assemble_quotes, cpu_freq_ghz);
+    std::cout << "  Encoder:   " << std::setprecision(1) << quote_encoder << " ns ("
+              << encode_quotes(1).size() << " bytes, "
+              << (quote_encoder / QUOTES) << " ns/quote)\n";
+    std::cout << "  Assembler: " << quote_assembler << " ns\n";
+    std::cout << "  Speedup:   " << std::setprecision(2) << (quote_assembler / quote_encoder) << "x\n";
+
     // ========================================================================
     // Summary
     // ========================================================================
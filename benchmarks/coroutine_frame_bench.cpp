@@ -0,0 +1,164 @@
+/*
+    Coroutine Frame Benchmark
+
+    Cost of completing one I/O operation, single thread:
+    - Callback: completion slot holding a std::function, invoked on completion
+    - Coroutine, one long-lived Task resumed per completion (SessionChannel::run)
+    - Coroutine, a new Task per operation (frame from FramePool)
+    - Frame allocation alone: FramePool vs global operator new
+
+    Completions are delivered in-process (IoCompletion::resume), so the
+    numbers are the dispatch overhead an event loop adds per CQE.
+
+    Build: cmake --build build && ./build/bin/benchmarks/coroutine_frame_bench
+*/
+
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include "nexusfix/session/coroutine.hpp"
+#include "nexusfix/transport/async_io.hpp"
+#include "include/benchmark_utils.hpp"
+
+using namespace nfx;
+using namespace nfx::bench;
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+constexpr size_t WARMUP_OPS = 100'000;
+constexpr size_t SAMPLES = 20'000;
+constexpr size_t OPS_PER_SAMPLE = 64;
+constexpr size_t FRAME_SIZE = 160;  // SessionChannel frames are 96-160 bytes
+
+// ============================================================================
+// Operation Sources
+// ============================================================================
+
+/// One outstanding operation, completed by the benchmark loop
+struct CoroutineSlot {
+    IoCompletion* pending{nullptr};
+
+    auto wait() noexcept {
+        return IoAwaitable{[this](IoCompletion* c) noexcept {
+            pending = c;
+            return 0;
+        }};
+    }
+};
+
+struct CallbackSlot {
+    std::function<void(int)> on_complete;
+};
+
+Task<void> steady_loop(CoroutineSlot& slot, uint64_t& sink) {
+    for (;;) {
+        const int n = co_await slot.wait();
+        sink += static_cast<uint64_t>(n);
+    }
+}
+
+Task<int> one_operation(CoroutineSlot& slot) {
+    const int n = co_await slot.wait();
+    co_return n;
+}
+
+// ============================================================================
+// Measurement
+// ============================================================================
+
+template <typename Op>
+LatencyStats measure(Op&& op, double freq_ghz) {
+    for (size_t i = 0; i < WARMUP_OPS; ++i) op();
+
+    std::vector<uint64_t> cycles;
+    cycles.reserve(SAMPLES);
+    for (size_t s = 0; s < SAMPLES; ++s) {
+        const uint64_t start = rdtsc();
+        for (size_t i = 0; i < OPS_PER_SAMPLE; ++i) op();
+        cycles.push_back((rdtsc() - start) / OPS_PER_SAMPLE);
+    }
+
+    LatencyStats stats;
+    stats.compute(cycles, freq_ghz);
+    return stats;
+}
+
+void print_row(const char* name, const LatencyStats& stats) {
+    std::cout << std::setw(34) << std::left << name
+              << std::setw(10) << std::fixed << std::setprecision(1) << stats.p50_ns
+              << std::setw(10) << stats.p99_ns
+              << std::setw(10) << stats.mean_ns << "\n";
+}
+
+int main() {
+    std::cout << "==========================================================\n";
+    std::cout << "  Coroutine Frame Benchmark: per-operation completion cost\n";
+    std::cout << "==========================================================\n\n";
+
+    (void)bind_to_core(2);
+    const double freq_ghz = estimate_cpu_freq_ghz();
+    std::cout << "CPU frequency: " << std::fixed << std::setprecision(3) << freq_ghz << " GHz\n";
+    std::cout << "Ops per sample: " << OPS_PER_SAMPLE << ", samples: " << SAMPLES << "\n\n";
+
+    uint64_t sink = 0;
+
+    // Callback: the operation carries its continuation as a std::function
+    CallbackSlot callback;
+    const auto callback_stats = measure([&] {
+        callback.on_complete = [&sink](int n) { sink += static_cast<uint64_t>(n); };
+        callback.on_complete(1);
+    }, freq_ghz);
+
+    // Coroutine resumed once per completion, no frame allocation
+    CoroutineSlot steady;
+    auto loop = steady_loop(steady, sink);
+    loop.resume();
+    const auto steady_stats = measure([&] {
+        IoCompletion::resume(steady.pending, 1);
+    }, freq_ghz);
+
+    // New coroutine per operation: frame allocated and freed every time
+    CoroutineSlot per_op;
+    FramePool::reset_stats();
+    const auto per_op_stats = measure([&] {
+        auto task = one_operation(per_op);
+        task.resume();
+        IoCompletion::resume(per_op.pending, 1);
+        sink += static_cast<uint64_t>(task.get());
+    }, freq_ghz);
+    const auto frame_stats = FramePool::stats();
+
+    // Frame allocation alone
+    const auto pool_alloc_stats = measure([&] {
+        void* frame = FramePool::allocate(FRAME_SIZE);
+        compiler_barrier();
+        FramePool::deallocate(frame, FRAME_SIZE);
+    }, freq_ghz);
+    const auto heap_alloc_stats = measure([&] {
+        void* frame = ::operator new(FRAME_SIZE);
+        compiler_barrier();
+        ::operator delete(frame, FRAME_SIZE);
+    }, freq_ghz);
+
+    std::cout << std::setw(34) << std::left << "Completion path (ns/op)"
+              << std::setw(10) << "P50" << std::setw(10) << "P99" << std::setw(10) << "Mean" << "\n";
+    std::cout << std::string(64, '-') << "\n";
+    print_row("Callback (std::function)", callback_stats);
+    print_row("Coroutine, resumed in place", steady_stats);
+    print_row("Coroutine, Task per op (pooled)", per_op_stats);
+
+    std::cout << "\nFrame allocation (" << FRAME_SIZE << " B alloc + free)\n";
+    print_comparison_header("Heap", "FramePool");
+    print_comparison("alloc + free (mean ns)", heap_alloc_stats, pool_alloc_stats);
+
+    std::cout << "\nTask-per-op frames: " << frame_stats.pooled << " pooled, "
+              << frame_stats.heap << " heap\n";
+    std::cout << "(sink " << sink << ")\n";
+    return 0;
+}
@@ -33,6 +33,9 @@ namespace old_impl {
         case nfx::ParseErrorCode::UnterminatedField:  return "Unterminated field";
         case nfx::ParseErrorCode::InvalidMsgType:     return "Invalid MsgType";
         case nfx::ParseErrorCode::GarbledMessage:     return "Garbled message";
+        case nfx::ParseErrorCode::UndefinedTag:       return "Undefined tag";
+        case nfx::ParseErrorCode::InvalidTagValue:    return "Value is incorrect for this tag";
+        case nfx::ParseErrorCode::IncorrectNumInGroup: return "Incorrect NumInGroup count for repeating group";
     }
     return "Unknown error";
 }
@@ -48,6 +51,8 @@ namespace old_impl {
         case nfx::SessionErrorCode::SequenceGap:     return "Sequence gap detected";
         case nfx::SessionErrorCode::InvalidState:    return "Invalid session state";
         case nfx::SessionErrorCode::Disconnected:    return "Disconnected";
+        case nfx::SessionErrorCode::RiskRejected:    return "Rejected by pre-trade risk check";
+        case nfx::SessionErrorCode::Throttled:       return "Outbound message rate exceeded";
     }
     return "Unknown error";
 }
@@ -74,6 +79,7 @@ namespace old_impl {
         case nfx::TransportErrorCode::WinsockInitFailed: return "Winsock initialization failed";
         case nfx::TransportErrorCode::IocpError:      return "IOCP operation failed";
         case nfx::TransportErrorCode::KqueueError:    return "kqueue operation failed";
+        case nfx::TransportErrorCode::TlsError:       return "TLS failure";
     }
     return "Unknown error";
 }
@@ -114,7 +120,7 @@ inline void do_not_optimize(T&& value) {
 // Test data
 // ============================================================================
 
-constexpr std::array<nfx::ParseErrorCode, 12> ALL_PARSE_ERRORS = {
+constexpr std::array<nfx::ParseErrorCode, 15> ALL_PARSE_ERRORS = {
     nfx::ParseErrorCode::None,
     nfx::ParseErrorCode::BufferTooShort,
     nfx::ParseErrorCode::InvalidBeginString,
@@ -126,10 +132,13 @@ constexpr std::array<nfx::ParseErrorCode, 12> ALL_PARSE_ERRORS = {
     nfx::ParseErrorCode::DuplicateTag,
     nfx::ParseErrorCode::UnterminatedField,
     nfx::ParseErrorCode::InvalidMsgType,
-    nfx::ParseErrorCode::GarbledMessage
+    nfx::ParseErrorCode::GarbledMessage,
+    nfx::ParseErrorCode::UndefinedTag,
+    nfx::ParseErrorCode::InvalidTagValue,
+    nfx::ParseErrorCode::IncorrectNumInGroup
 };
 
-constexpr std::array<nfx::SessionErrorCode, 9> ALL_SESSION_ERRORS = {
+constexpr std::array<nfx::SessionErrorCode, 11> ALL_SESSION_ERRORS = {
     nfx::SessionErrorCode::None,
     nfx::SessionErrorCode::NotConnected,
     nfx::SessionErrorCode::AlreadyConnected,
@@ -138,7 +147,9 @@ constexpr std::array<nfx::SessionErrorCode, 9> ALL_SESSION_ERRORS = {
     nfx::SessionErrorCode::HeartbeatTimeout,
     nfx::SessionErrorCode::SequenceGap,
     nfx::SessionErrorCode::InvalidState,
-    nfx::SessionErrorCode::Disconnected
+    nfx::SessionErrorCode::Disconnected,
+    nfx::SessionErrorCode::RiskRejected,
+    nfx::SessionErrorCode::Throttled
 };
 
 constexpr std::array<nfx::TransportErrorCode, 20> ALL_TRANSPORT_ERRORS = {
@@ -192,7 +203,7 @@ int main() {
     // Benchmark 1: ParseError message()
     // ========================================================================
 
-    std::cout << "--- ParseError (12 codes, " << ITERATIONS << " iterations) ---\n\n";
+    std::cout << "--- ParseError (15 codes, " << ITERATIONS << " iterations) ---\n\n";
 
     // Warmup
     for (int i = 0; i < WARMUP; ++i) {
@@ -233,7 +244,7 @@ int main() {
     // Benchmark 2: SessionError message()
     // ========================================================================
 
-    std::cout << "--- SessionError (9 codes, " << ITERATIONS << " iterations) ---\n\n";
+    std::cout << "--- SessionError (11 codes, " << ITERATIONS << " iterations) ---\n\n";
 
     // OLD: Switch-based
     uint64_t old_session_start = rdtsc();
@@ -389,7 +400,7 @@ int main() {
     std::cout << "|------------------|--------------|--------------|-------------|\n";
     std::cout << "| Average          |              |              | " << avg_improvement << "% |\n";
 
-    std::cout << "\nTotal switch cases eliminated: 50 (12 + 9 + 20 + 9)\n";
+    std::cout << "\nTotal switch cases eliminated: 55 (15 + 11 + 20 + 9)\n";
 
     return 0;
 }
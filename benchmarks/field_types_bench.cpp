@@ -1,6 +1,7 @@
 // ============================================================================
 // TICKET_023: Field Types Benchmark
-// Compare: Switch-based vs Compile-time Lookup Table
+// Compare: Switch-based vs Compile-time Lookup Table,
+//          scalar vs SWAR FixedPrice/Qty/Timestamp text parsing
 // ============================================================================
 
 #include <iostream>
@@ -11,6 +12,7 @@
 
 // Include the new implementation
 #include "nexusfix/types/field_types.hpp"
+#include "nexusfix/util/timestamp_parser.hpp"
 
 // ============================================================================
 // OLD Implementation (switch-based) - for comparison
@@ -111,6 +113,86 @@ namespace old_impl {
     }
 }
 
+// Digit-at-a-time decimal parse (FixedPrice/Qty::from_string before SWAR)
+template <int Places>
+[[nodiscard]] inline int64_t parse_scaled(std::string_view sv) noexcept {
+    if (sv.empty()) return 0;
+
+    bool negative = false;
+    size_t pos = 0;
+    if (sv[0] == '-') {
+        negative = true;
+        pos = 1;
+    }
+
+    int64_t integer_part = 0;
+    int64_t fractional_part = 0;
+    int fractional_digits = 0;
+    bool in_fraction = false;
+
+    for (; pos < sv.size(); ++pos) {
+        char c = sv[pos];
+        if (c == '.') {
+            in_fraction = true;
+            continue;
+        }
+        if (c < '0' || c > '9') break;
+
+        if (in_fraction) {
+            if (fractional_digits < Places) {
+                fractional_part = fractional_part * 10 + (c - '0');
+                ++fractional_digits;
+            }
+        } else {
+            integer_part = integer_part * 10 + (c - '0');
+        }
+    }
+
+    int64_t scale = 1;
+    for (int i = 0; i < Places; ++i) scale *= 10;
+    int64_t frac_scale = 1;
+    for (int i = fractional_digits; i < Places; ++i) frac_scale *= 10;
+
+    int64_t result = integer_part * scale + fractional_part * frac_scale;
+    return negative ? -result : result;
+}
+
+// Digit-at-a-time UTCTimestamp parse (Timestamp::from_utc_string before SWAR)
+[[nodiscard]] inline int64_t parse_timestamp(std::string_view sv) noexcept {
+    if (sv.size() < 17 || sv[8] != '-' || sv[11] != ':' || sv[14] != ':') return -1;
+    int64_t parts[6]{};
+    constexpr size_t POS[6] = {0, 4, 6, 9, 12, 15};
+    constexpr size_t LEN[6] = {4, 2, 2, 2, 2, 2};
+    for (size_t p = 0; p < 6; ++p) {
+        for (size_t i = POS[p]; i < POS[p] + LEN[p]; ++i) {
+            const char c = sv[i];
+            if (c < '0' || c > '9') return -1;
+            parts[p] = parts[p] * 10 + (c - '0');
+        }
+    }
+
+    int64_t frac = 0;
+    int frac_digits = 0;
+    for (size_t i = 18; i < sv.size(); ++i) {
+        const char c = sv[i];
+        if (c < '0' || c > '9') return -1;
+        if (frac_digits < 9) {
+            frac = frac * 10 + (c - '0');
+            ++frac_digits;
+        }
+    }
+    for (; frac_digits < 9; ++frac_digits) frac *= 10;
+
+    int64_t y = parts[0] - (parts[1] <= 2 ? 1 : 0);
+    const int64_t m = parts[1];
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const int64_t yoe = y - era * 400;
+    const int64_t doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + parts[2] - 1;
+    const int64_t days = era * 146097 + yoe * 365 + yoe / 4 - yoe / 100 + doy - 719468;
+    const int64_t secs = days * 86400 + parts[3] * 3600 + parts[4] * 60 + parts[5];
+    return secs * 1000000000LL + frac;
+}
+
 } // namespace old_impl
 
 // ============================================================================
@@ -174,6 +256,26 @@ constexpr std::array<nfx::ExecType, 4> HOT_EXEC_TYPES = {
     nfx::ExecType::New, nfx::ExecType::Fill, nfx::ExecType::PartialFill, nfx::ExecType::Canceled
 };
 
+// Typical price / quantity field values (tags 44, 31, 38, 32); venues that
+// send fixed-width decimals make 8+ byte values common
+constexpr std::array<std::string_view, 8> PRICE_TEXT = {
+    "150.25", "99.99000000", "0.00012345", "43251.50",
+    "1.08345000", "3999.75", "12345678.12345678", "7"
+};
+
+constexpr std::array<std::string_view, 8> QTY_TEXT = {
+    "100", "2500.0000", "0.5", "1000000",
+    "37.2500", "10", "125000.0001", "15000.50"
+};
+
+// SendingTime / TransactTime values from one trading day
+constexpr std::array<std::string_view, 8> TIMESTAMP_TEXT = {
+    "20260122-14:30:45.123", "20260122-14:30:45.123456",
+    "20260122-14:30:45.123456789", "20260122-14:30:46",
+    "20260122-14:30:46.001", "20260122-14:30:46.250000",
+    "20260122-14:30:47.999999999", "20260122-14:30:47.5"
+};
+
 // ============================================================================
 // Benchmark
 // ============================================================================
@@ -386,12 +488,137 @@ int main() {
     std::cout << "  NEW (lookup):     " << new_rand_cpop << " cycles/op\n";
     std::cout << "  Improvement:      " << rand_improvement << "%\n\n";
 
+    // ========================================================================
+    // Benchmark 7: FixedPrice::from_string() - scalar vs SWAR
+    // ========================================================================
+
+    constexpr int PARSE_ITERATIONS = ITERATIONS / 10;
+
+    std::cout << "--- FixedPrice::from_string() (" << PRICE_TEXT.size() << " values, "
+              << PARSE_ITERATIONS << " iterations) ---\n\n";
+
+    for (int i = 0; i < WARMUP; ++i) {
+        for (auto t : PRICE_TEXT) {
+            do_not_optimize(old_impl::parse_scaled<8>(t));
+            do_not_optimize(nfx::FixedPrice::from_string(t));
+        }
+    }
+
+    uint64_t old_px_start = rdtsc();
+    for (int i = 0; i < PARSE_ITERATIONS; ++i) {
+        for (auto t : PRICE_TEXT) {
+            do_not_optimize(t);
+            do_not_optimize(old_impl::parse_scaled<8>(t));
+        }
+    }
+    uint64_t old_px_cycles = rdtsc() - old_px_start;
+
+    uint64_t new_px_start = rdtsc();
+    for (int i = 0; i < PARSE_ITERATIONS; ++i) {
+        for (auto t : PRICE_TEXT) {
+            do_not_optimize(t);
+            do_not_optimize(nfx::FixedPrice::from_string(t));
+        }
+    }
+    uint64_t new_px_cycles = rdtsc() - new_px_start;
+
+    double px_ops = static_cast<double>(PARSE_ITERATIONS) * PRICE_TEXT.size();
+    double old_px_cpop = static_cast<double>(old_px_cycles) / px_ops;
+    double new_px_cpop = static_cast<double>(new_px_cycles) / px_ops;
+    double px_improvement = (old_px_cpop - new_px_cpop) / old_px_cpop * 100;
+
+    std::cout << "  OLD (scalar):     " << old_px_cpop << " cycles/op\n";
+    std::cout << "  NEW (SWAR):       " << new_px_cpop << " cycles/op\n";
+    std::cout << "  Improvement:      " << px_improvement << "%\n\n";
+
+    // ========================================================================
+    // Benchmark 8: Qty::from_string() - scalar vs SWAR
+    // ========================================================================
+
+    std::cout << "--- Qty::from_string() (" << QTY_TEXT.size() << " values, "
+              << PARSE_ITERATIONS << " iterations) ---\n\n";
+
+    uint64_t old_qty_start = rdtsc();
+    for (int i = 0; i < PARSE_ITERATIONS; ++i) {
+        for (auto t : QTY_TEXT) {
+            do_not_optimize(t);
+            do_not_optimize(old_impl::parse_scaled<4>(t));
+        }
+    }
+    uint64_t old_qty_cycles = rdtsc() - old_qty_start;
+
+    uint64_t new_qty_start = rdtsc();
+    for (int i = 0; i < PARSE_ITERATIONS; ++i) {
+        for (auto t : QTY_TEXT) {
+            do_not_optimize(t);
+            do_not_optimize(nfx::Qty::from_string(t));
+        }
+    }
+    uint64_t new_qty_cycles = rdtsc() - new_qty_start;
+
+    double qty_ops = static_cast<double>(PARSE_ITERATIONS) * QTY_TEXT.size();
+    double old_qty_cpop = static_cast<double>(old_qty_cycles) / qty_ops;
+    double new_qty_cpop = static_cast<double>(new_qty_cycles) / qty_ops;
+    double qty_improvement = (old_qty_cpop - new_qty_cpop) / old_qty_cpop * 100;
+
+    std::cout << "  OLD (scalar):     " << old_qty_cpop << " cycles/op\n";
+    std::cout << "  NEW (SWAR):       " << new_qty_cpop << " cycles/op\n";
+    std::cout << "  Improvement:      " << qty_improvement << "%\n\n";
+
+    // ========================================================================
+    // Benchmark 9: UTCTimestamp parse - scalar vs SWAR vs cached date
+    // ========================================================================
+
+    std::cout << "--- Timestamp parse (" << TIMESTAMP_TEXT.size() << " values, "
+              << PARSE_ITERATIONS << " iterations) ---\n\n";
+
+    nfx::util::TimestampParser ts_parser;
+
+    uint64_t old_ts_start = rdtsc();
+    for (int i = 0; i < PARSE_ITERATIONS; ++i) {
+        for (auto t : TIMESTAMP_TEXT) {
+            do_not_optimize(t);
+            do_not_optimize(old_impl::parse_timestamp(t));
+        }
+    }
+    uint64_t old_ts_cycles = rdtsc() - old_ts_start;
+
+    uint64_t new_ts_start = rdtsc();
+    for (int i = 0; i < PARSE_ITERATIONS; ++i) {
+        for (auto t : TIMESTAMP_TEXT) {
+            do_not_optimize(t);
+            do_not_optimize(nfx::Timestamp::from_utc_string(t));
+        }
+    }
+    uint64_t new_ts_cycles = rdtsc() - new_ts_start;
+
+    uint64_t cached_ts_start = rdtsc();
+    for (int i = 0; i < PARSE_ITERATIONS; ++i) {
+        for (auto t : TIMESTAMP_TEXT) {
+            do_not_optimize(t);
+            do_not_optimize(ts_parser.parse(t));
+        }
+    }
+    uint64_t cached_ts_cycles = rdtsc() - cached_ts_start;
+
+    double ts_ops = static_cast<double>(PARSE_ITERATIONS) * TIMESTAMP_TEXT.size();
+    double old_ts_cpop = static_cast<double>(old_ts_cycles) / ts_ops;
+    double new_ts_cpop = static_cast<double>(new_ts_cycles) / ts_ops;
+    double cached_ts_cpop = static_cast<double>(cached_ts_cycles) / ts_ops;
+    double ts_improvement = (old_ts_cpop - cached_ts_cpop) / old_ts_cpop * 100;
+
+    std::cout << "  OLD (scalar):     " << old_ts_cpop << " cycles/op\n";
+    std::cout << "  NEW (SWAR):       " << new_ts_cpop << " cycles/op\n";
+    std::cout << "  NEW (SWAR+cache): " << cached_ts_cpop << " cycles/op\n";
+    std::cout << "  Improvement:      " << ts_improvement << "%\n\n";
+
     // ========================================================================
     // Summary
     // ========================================================================
 
     double avg_improvement = (side_improvement + ot_improvement + os_improvement +
-                              et_improvement + tif_improvement + rand_improvement) / 6.0;
+                              et_improvement + tif_improvement + rand_improvement +
+                              px_improvement + qty_improvement + ts_improvement) / 9.0;
 
     std::cout << "============================================================\n";
     std::cout << "SUMMARY\n";
@@ -405,6 +632,9 @@ int main() {
     std::cout << "| exec_type_name()     | 19    | " << old_et_cpop << "       | " << new_et_cpop << "       | " << et_improvement << "% |\n";
     std::cout << "| time_in_force_name() | 8     | " << old_tif_cpop << "       | " << new_tif_cpop << "       | " << tif_improvement << "% |\n";
     std::cout << "| Random access        | -     | " << old_rand_cpop << "       | " << new_rand_cpop << "       | " << rand_improvement << "% |\n";
+    std::cout << "| FixedPrice parse     | 8     | " << old_px_cpop << "       | " << new_px_cpop << "       | " << px_improvement << "% |\n";
+    std::cout << "| Qty parse            | 8     | " << old_qty_cpop << "       | " << new_qty_cpop << "       | " << qty_improvement << "% |\n";
+    std::cout << "| Timestamp parse      | 8     | " << old_ts_cpop << "       | " << cached_ts_cpop << "       | " << ts_improvement << "% |\n";
     std::cout << "|----------------------|-------|--------------|--------------|-------------|\n";
     std::cout << "| Average              |       |              |              | " << avg_improvement << "% |\n";
 
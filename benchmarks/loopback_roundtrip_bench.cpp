@@ -0,0 +1,623 @@
+// loopback_roundtrip_bench.cpp
+// NexusFIX End-to-End Loopback Round-Trip Benchmark
+//
+// client SessionManager -> transport -> 127.0.0.1 -> acceptor SessionManager
+// -> ExecutionReport -> transport -> client SessionManager, per transport
+// configuration:
+//   tcp                         TcpTransport, non-blocking recv polling
+//   uring                       IoUringTransport, plain send/recv
+//   uring-registered            registered (fixed) buffers
+//   uring-multishot             multishot recv with provided buffers
+//   uring-registered-multishot  both
+//   uring-sqpoll                both, on an IORING_SETUP_SQPOLL ring
+//
+// Load is open-loop: order i is due at start + i / rate whether or not
+// earlier replies have arrived, and latency is measured from that intended
+// send time (coordinated-omission correct). When the client falls behind,
+// the queueing delay shows up in the latency instead of silently lowering
+// the offered rate. Service time (actual send -> reply) is reported beside it.
+//
+// The acceptor runs on its own thread over the accepted socket with blocking
+// recv; each NewOrderSingle is answered with an ExecutionReport echoing the
+// ClOrdID, which the client maps back to the order's index.
+//
+// Usage:
+//   loopback_roundtrip_bench [--rate <msgs/s>] [--count <n> | --duration <s>]
+//                            [--warmup <n>] [--filter <substring>] [--json]
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "nexusfix/nexusfix.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+#include "nexusfix/transport/io_uring_transport.hpp"
+
+using namespace nfx;
+
+namespace {
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+struct BenchConfig {
+    double rate{10000.0};          // Offered load, orders per second
+    size_t count{20000};           // Measured orders per transport
+    size_t warmup{1000};           // Orders sent first at the same rate, not measured
+    std::string filter;            // Run only transports whose name contains this
+    bool json{false};
+};
+
+constexpr std::chrono::seconds DRAIN_TIMEOUT{2};
+constexpr std::chrono::seconds LOGON_TIMEOUT{2};
+constexpr size_t RX_BUFFER_SIZE = 1 << 20;
+
+[[nodiscard]] inline int64_t now_ns() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+SessionConfig make_config(std::string_view sender, std::string_view target) noexcept {
+    SessionConfig config;
+    config.sender_comp_id = sender;
+    config.target_comp_id = target;
+    config.heart_bt_int = 30;
+    return config;
+}
+
+// ============================================================================
+// Framing
+// ============================================================================
+
+/// Receive buffer handed whole to SessionManager::on_bytes(), which frames
+/// in place and keeps only a straddling message
+class FrameReader {
+public:
+    FrameReader() : buffer_(RX_BUFFER_SIZE) {}
+
+    [[nodiscard]] std::span<char> free_space() noexcept {
+        return std::span<char>{buffer_};
+    }
+
+    /// Dispatch the `n` bytes written into free_space()
+    void commit(size_t n, SessionManager& session) {
+        session.on_bytes(std::span<const char>{buffer_.data(), n});
+    }
+
+private:
+    std::vector<char> buffer_;
+};
+
+// ============================================================================
+// Acceptor
+// ============================================================================
+
+/// Counterparty on the accepted socket: answers every application message
+/// with an ExecutionReport carrying the same ClOrdID
+class EchoAcceptor {
+public:
+    explicit EchoAcceptor(SocketHandle fd)
+        : fd_{fd}
+        , session_{make_config("BROKER", "CLIENT")}
+    {
+        int one = 1;
+        (void)::setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+        report_.order_id("ORDER")
+            .exec_type(ExecType::New)
+            .ord_status(OrdStatus::New)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .leaves_qty(Qty::from_int(100))
+            .cum_qty(Qty::from_int(0))
+            .avg_px(FixedPrice::from_string("0"));
+
+        SessionCallbacks callbacks;
+        callbacks.on_send = [this](std::span<const char> data) {
+            while (!data.empty()) {
+                ssize_t n = ::send(fd_, data.data(), data.size(), MSG_NOSIGNAL);
+                if (n <= 0) return false;
+                data = data.subspan(static_cast<size_t>(n));
+            }
+            return true;
+        };
+        callbacks.on_app_message = [this](const IndexedParser& msg, const RxTimestamp&) {
+            auto id = msg.get_string(tag::ClOrdID::value);
+            report_.cl_ord_id(id).exec_id(id);
+            (void)session_.send_app_message(report_);
+        };
+        session_.set_callbacks(std::move(callbacks));
+    }
+
+    ~EchoAcceptor() { ::close(fd_); }
+
+    EchoAcceptor(const EchoAcceptor&) = delete;
+    EchoAcceptor& operator=(const EchoAcceptor&) = delete;
+
+    /// Serve until the client closes the connection
+    void run() {
+        session_.on_connect();
+        for (;;) {
+            auto space = reader_.free_space();
+            ssize_t n = ::recv(fd_, space.data(), space.size(), 0);
+            if (n <= 0) break;
+            reader_.commit(static_cast<size_t>(n), session_);
+        }
+        session_.on_disconnect();
+    }
+
+private:
+    SocketHandle fd_;
+    SessionManager session_;
+    FrameReader reader_;
+    fix44::ExecutionReport::Builder report_;
+};
+
+/// Listens on an ephemeral loopback port; serve_one() accepts and serves
+/// a single connection on a background thread
+class AcceptorServer {
+public:
+    [[nodiscard]] bool listen() noexcept {
+        if (!acceptor_.listen(0)) return false;
+        struct sockaddr_in addr{};
+        socklen_t len = sizeof(addr);
+        if (::getsockname(acceptor_.fd(), reinterpret_cast<struct sockaddr*>(&addr), &len) < 0) {
+            return false;
+        }
+        port_ = ntohs(addr.sin_port);
+        return true;
+    }
+
+    [[nodiscard]] uint16_t port() const noexcept { return port_; }
+
+    void serve_one() {
+        thread_ = std::thread([this] {
+            auto fd = acceptor_.accept();
+            if (!fd) return;
+            EchoAcceptor peer{*fd};
+            peer.run();
+        });
+    }
+
+    void join() {
+        if (thread_.joinable()) thread_.join();
+    }
+
+private:
+    TcpAcceptor acceptor_;
+    uint16_t port_{0};
+    std::thread thread_;
+};
+
+// ============================================================================
+// Results
+// ============================================================================
+
+struct RoundTripResult {
+    std::string name;
+    double offered_rate{0};       // Orders per second requested
+    double achieved_rate{0};      // Orders actually sent per second
+    size_t sent{0};
+    size_t received{0};
+    // Intended send -> reply (coordinated-omission corrected)
+    double p50_ns{0}, p90_ns{0}, p99_ns{0}, p999_ns{0}, max_ns{0}, mean_ns{0};
+    // Actual send -> reply
+    double service_p50_ns{0}, service_p99_ns{0}, service_p999_ns{0};
+};
+
+[[nodiscard]] double percentile(const std::vector<int64_t>& sorted, double p) noexcept {
+    if (sorted.empty()) return 0.0;
+    size_t idx = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));
+    return static_cast<double>(sorted[idx]);
+}
+
+// ============================================================================
+// Open-Loop Client
+// ============================================================================
+
+/// Drives one client connection: logs on, offers orders on the open-loop
+/// schedule and records each reply against its order's intended send time
+class LoadClient {
+public:
+    /// @param pump Non-blocking read: bytes written into the span, or
+    ///        nullopt when the connection failed
+    using Pump = std::function<std::optional<size_t>(std::span<char>)>;
+
+    LoadClient(ITransport& transport, Pump pump, const BenchConfig& config)
+        : transport_{transport}
+        , pump_{std::move(pump)}
+        , config_{config}
+        , session_{make_config("CLIENT", "BROKER")}
+    {
+        const size_t total = config_.warmup + config_.count;
+        intended_.resize(total);
+        sent_at_.resize(total);
+        replied_at_.assign(total, 0);
+
+        order_.symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20260101-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_string("150.25"))
+            .time_in_force(TimeInForce::Day);
+
+        SessionCallbacks callbacks;
+        callbacks.on_send = [this](std::span<const char> data) {
+            return transport_.send(data).has_value();
+        };
+        callbacks.on_app_message = [this](const IndexedParser& msg, const RxTimestamp&) {
+            const int64_t t = now_ns();
+            auto id = msg.get_string(tag::ClOrdID::value);
+            size_t index = 0;
+            auto [ptr, ec] = std::from_chars(id.data(), id.data() + id.size(), index);
+            if (ec == std::errc{} && index < replied_at_.size() && replied_at_[index] == 0) {
+                replied_at_[index] = t;
+                ++received_;
+            }
+        };
+        session_.set_callbacks(std::move(callbacks));
+    }
+
+    [[nodiscard]] bool logon() {
+        session_.on_connect();
+        if (!session_.initiate_logon()) return false;
+        const int64_t deadline = now_ns() +
+            std::chrono::nanoseconds{LOGON_TIMEOUT}.count();
+        while (session_.state() != SessionState::Active && now_ns() < deadline) {
+            if (!pump_once()) return false;
+        }
+        return session_.state() == SessionState::Active;
+    }
+
+    [[nodiscard]] RoundTripResult run(std::string name) {
+        const size_t total = intended_.size();
+        const double period_ns = 1e9 / config_.rate;
+        const int64_t start = now_ns() + 1'000'000;  // First order due in 1ms
+        for (size_t i = 0; i < total; ++i) {
+            intended_[i] = start + static_cast<int64_t>(static_cast<double>(i) * period_ns);
+        }
+
+        size_t next = 0;
+        bool ok = true;
+        while (next < total && ok) {
+            if (now_ns() >= intended_[next]) {
+                ok = send_order(next++);
+            } else {
+                ok = pump_once();
+            }
+        }
+        const int64_t last_sent = now_ns();
+
+        const int64_t deadline = last_sent + std::chrono::nanoseconds{DRAIN_TIMEOUT}.count();
+        while (ok && received_ < next && now_ns() < deadline) {
+            ok = pump_once();
+        }
+
+        return summarize(std::move(name), next, start, last_sent);
+    }
+
+private:
+    [[nodiscard]] bool send_order(size_t index) {
+        char id[24];
+        auto [end, ec] = std::to_chars(id, id + sizeof(id), index);
+        (void)ec;
+        sent_at_[index] = now_ns();
+        order_.cl_ord_id(std::string_view{id, static_cast<size_t>(end - id)});
+        return session_.send_new_order(order_).has_value();
+    }
+
+    [[nodiscard]] bool pump_once() {
+        auto n = pump_(reader_.free_space());
+        if (!n) return false;
+        if (*n > 0) reader_.commit(*n, session_);
+        return true;
+    }
+
+    [[nodiscard]] RoundTripResult summarize(std::string name, size_t sent,
+                                            int64_t start, int64_t last_sent) const {
+        RoundTripResult r;
+        r.name = std::move(name);
+        r.offered_rate = config_.rate;
+        r.sent = sent > config_.warmup ? sent - config_.warmup : 0;
+
+        std::vector<int64_t> latency;
+        std::vector<int64_t> service;
+        latency.reserve(r.sent);
+        service.reserve(r.sent);
+        for (size_t i = config_.warmup; i < sent; ++i) {
+            if (replied_at_[i] == 0) continue;
+            latency.push_back(replied_at_[i] - intended_[i]);
+            service.push_back(replied_at_[i] - sent_at_[i]);
+        }
+        r.received = latency.size();
+
+        const int64_t elapsed = last_sent - start;
+        if (elapsed > 0) {
+            r.achieved_rate = static_cast<double>(sent) * 1e9 / static_cast<double>(elapsed);
+        }
+
+        std::sort(latency.begin(), latency.end());
+        std::sort(service.begin(), service.end());
+        r.p50_ns = percentile(latency, 0.50);
+        r.p90_ns = percentile(latency, 0.90);
+        r.p99_ns = percentile(latency, 0.99);
+        r.p999_ns = percentile(latency, 0.999);
+        r.max_ns = latency.empty() ? 0.0 : static_cast<double>(latency.back());
+        if (!latency.empty()) {
+            double sum = 0;
+            for (auto v : latency) sum += static_cast<double>(v);
+            r.mean_ns = sum / static_cast<double>(latency.size());
+        }
+        r.service_p50_ns = percentile(service, 0.50);
+        r.service_p99_ns = percentile(service, 0.99);
+        r.service_p999_ns = percentile(service, 0.999);
+        return r;
+    }
+
+    ITransport& transport_;
+    Pump pump_;
+    const BenchConfig& config_;
+    SessionManager session_;
+    FrameReader reader_;
+    fix44::NewOrderSingle::Builder order_;
+    std::vector<int64_t> intended_;
+    std::vector<int64_t> sent_at_;
+    std::vector<int64_t> replied_at_;
+    size_t received_{0};
+};
+
+// ============================================================================
+// Transport Variants
+// ============================================================================
+
+/// Connect, log on and run the load through one client transport
+/// @param on_connected Socket setup between connect and logon
+template<typename Transport, typename OnConnected>
+std::optional<RoundTripResult> run_client(const std::string& name, Transport& transport,
+                                          LoadClient::Pump pump, AcceptorServer& server,
+                                          const BenchConfig& config,
+                                          OnConnected&& on_connected) {
+    server.serve_one();
+    std::optional<RoundTripResult> result;
+    if (transport.connect("127.0.0.1", server.port())) {
+        on_connected();
+        (void)transport.set_nodelay(true);
+        LoadClient client{transport, std::move(pump), config};
+        if (client.logon()) {
+            result = client.run(name);
+        } else {
+            std::cerr << "[ERROR] " << name << ": logon failed\n";
+        }
+    } else {
+        std::cerr << "[ERROR] " << name << ": connect failed\n";
+    }
+    transport.disconnect();
+    server.join();
+    return result;
+}
+
+std::optional<RoundTripResult> run_tcp(AcceptorServer& server, const BenchConfig& config) {
+    TcpTransport transport;
+    auto pump = [&transport](std::span<char> space) -> std::optional<size_t> {
+        if (!transport.is_connected()) return std::nullopt;
+        auto n = transport.socket().receive_once(space);
+        if (!n) return std::nullopt;
+        return *n;
+    };
+    // Non-blocking once connected: receive_once() returns 0 when idle
+    return run_client("tcp", transport, pump, server, config,
+                      [&transport] { transport.socket().set_nonblocking(true); });
+}
+
+#if NFX_IO_URING_AVAILABLE
+
+struct UringVariant {
+    const char* name;
+    bool registered;
+    bool multishot;
+    bool sqpoll;
+};
+
+constexpr UringVariant URING_VARIANTS[] = {
+    {"uring",                      false, false, false},
+    {"uring-registered",           true,  false, false},
+    {"uring-multishot",            false, true,  false},
+    {"uring-registered-multishot", true,  true,  false},
+    {"uring-sqpoll",               true,  true,  true},
+};
+
+std::optional<RoundTripResult> run_uring(const UringVariant& variant, AcceptorServer& server,
+                                         const BenchConfig& config) {
+    IoUringContext ctx;
+    auto init = variant.sqpoll ? ctx.init_sqpoll() : ctx.init();
+    if (!init) {
+        std::cerr << "[ERROR] " << variant.name << ": io_uring init failed\n";
+        return std::nullopt;
+    }
+    if (variant.sqpoll && !ctx.is_sqpoll()) {
+        std::cerr << "[WARN] " << variant.name << ": SQPOLL refused, plain ring\n";
+    }
+
+    IoUringTransportConfig transport_config;
+    transport_config.use_registered_buffers = variant.registered;
+    transport_config.use_multishot_recv = variant.multishot;
+    IoUringTransport transport{ctx, transport_config};
+
+    // poll() reaps completions into the transport's buffer without blocking
+    auto pump = [&transport](std::span<char> space) -> std::optional<size_t> {
+        if (!transport.is_connected()) return std::nullopt;
+        (void)transport.poll();
+        if (transport.buffered() == 0) return size_t{0};
+        auto n = transport.receive(space);
+        if (!n) return std::nullopt;
+        return *n;
+    };
+    return run_client(variant.name, transport, pump, server, config, [] {});
+}
+
+#endif  // NFX_IO_URING_AVAILABLE
+
+// ============================================================================
+// Output
+// ============================================================================
+
+void print_header() {
+    std::cout << "  " << std::left << std::setw(28) << "transport (us)" << std::right
+              << std::setw(10) << "rate"
+              << std::setw(9) << "P50"
+              << std::setw(9) << "P90"
+              << std::setw(9) << "P99"
+              << std::setw(9) << "P99.9"
+              << std::setw(9) << "max"
+              << std::setw(10) << "svc P50"
+              << std::setw(10) << "svc P99"
+              << std::setw(8) << "lost" << "\n";
+}
+
+void print_result(const RoundTripResult& r) {
+    auto us = [](double ns) { return ns / 1000.0; };
+    std::cout << std::fixed << std::setprecision(1)
+              << "  " << std::left << std::setw(28) << r.name << std::right
+              << std::setw(10) << std::setprecision(0) << r.achieved_rate << std::setprecision(1)
+              << std::setw(9) << us(r.p50_ns)
+              << std::setw(9) << us(r.p90_ns)
+              << std::setw(9) << us(r.p99_ns)
+              << std::setw(9) << us(r.p999_ns)
+              << std::setw(9) << us(r.max_ns)
+              << std::setw(10) << us(r.service_p50_ns)
+              << std::setw(10) << us(r.service_p99_ns)
+              << std::setw(8) << (r.sent - r.received) << "\n";
+}
+
+void print_json(const std::vector<RoundTripResult>& results) {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        std::cout << "    { \"name\": \"loopback/" << r.name
+                  << "\", \"offered_rate\": " << r.offered_rate
+                  << ", \"achieved_rate\": " << r.achieved_rate
+                  << ", \"p50_ns\": " << r.p50_ns
+                  << ", \"p90_ns\": " << r.p90_ns
+                  << ", \"p99_ns\": " << r.p99_ns
+                  << ", \"p999_ns\": " << r.p999_ns
+                  << ", \"mean_ns\": " << r.mean_ns
+                  << ", \"max_ns\": " << r.max_ns
+                  << ", \"service_p50_ns\": " << r.service_p50_ns
+                  << ", \"service_p99_ns\": " << r.service_p99_ns
+                  << ", \"service_p999_ns\": " << r.service_p999_ns
+                  << ", \"sent\": " << r.sent
+                  << ", \"received\": " << r.received << " }"
+                  << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    std::cout << "  ]\n}\n";
+}
+
+}  // namespace
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    BenchConfig config;
+    std::optional<double> duration_s;
+    for (int i = 1; i < argc; ++i) {
+        auto arg = std::string_view{argv[i]};
+        auto value = [&]() -> const char* { return i + 1 < argc ? argv[++i] : "0"; };
+        if (arg == "--json") {
+            config.json = true;
+        } else if (arg == "--rate") {
+            config.rate = std::atof(value());
+        } else if (arg == "--count") {
+            config.count = static_cast<size_t>(std::atoll(value()));
+        } else if (arg == "--duration") {
+            duration_s = std::atof(value());
+        } else if (arg == "--warmup") {
+            config.warmup = static_cast<size_t>(std::atoll(value()));
+        } else if (arg == "--filter") {
+            config.filter = value();
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--rate <msgs/s>] [--count <n> | --duration <s>]"
+                         " [--warmup <n>] [--filter <substring>] [--json]\n";
+            return 2;
+        }
+    }
+    if (config.rate <= 0) {
+        std::cerr << "[ERROR] --rate must be positive\n";
+        return 2;
+    }
+    if (duration_s) {
+        config.count = static_cast<size_t>(*duration_s * config.rate);
+    }
+    if (config.count == 0) {
+        std::cerr << "[ERROR] nothing to send\n";
+        return 2;
+    }
+
+    AcceptorServer server;
+    if (!server.listen()) {
+        std::cerr << "[ERROR] failed to listen on loopback\n";
+        return 1;
+    }
+
+    auto selected = [&](std::string_view name) {
+        return config.filter.empty() || name.find(config.filter) != std::string_view::npos;
+    };
+
+    if (!config.json) {
+        std::cout << "NexusFIX loopback round trip: " << config.count << " orders at "
+                  << config.rate << "/s (+" << config.warmup << " warmup), latency from"
+                     " intended send time\n\n";
+        print_header();
+    }
+
+    std::vector<RoundTripResult> results;
+    size_t failures = 0;
+    auto record = [&](std::optional<RoundTripResult> r) {
+        if (!r) {
+            ++failures;
+            return;
+        }
+        if (!config.json) print_result(*r);
+        results.push_back(std::move(*r));
+    };
+
+    if (selected("tcp")) {
+        record(run_tcp(server, config));
+    }
+#if NFX_IO_URING_AVAILABLE
+    for (const auto& variant : URING_VARIANTS) {
+        if (selected(variant.name)) {
+            record(run_uring(variant, server, config));
+        }
+    }
+#else
+    if (!config.json) {
+        std::cout << "\n  (io_uring not available: IoUringTransport variants skipped)\n";
+    }
+#endif
+
+    if (config.json) {
+        print_json(results);
+    }
+    return failures == 0 ? 0 : 1;
+}
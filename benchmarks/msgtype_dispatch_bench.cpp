@@ -8,10 +8,13 @@
 #include <random>
 #include <array>
 #include <cstdint>
+#include <string>
 #include <string_view>
+#include <vector>
 
 // Include the new implementation
 #include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/session/msg_dispatch.hpp"
 
 // ============================================================================
 // OLD Implementation (switch-based) - for comparison
@@ -88,6 +91,51 @@ inline void do_not_optimize(T&& value) {
     asm volatile("" : : "r,m"(value) : "memory");
 }
 
+// ============================================================================
+// Handler dispatch: switch in on_app_message vs MsgDispatchTable
+// ============================================================================
+
+struct SwitchHandler {
+    uint64_t exec{0}, cancel_reject{0}, md{0}, trade{0}, other{0};
+
+    void on_app_message(const nfx::IndexedParser& msg) noexcept {
+        const std::string_view type = msg.msg_type_str();
+        if (type.size() == 2) {
+            if (type == "AE") ++trade; else ++other;
+            return;
+        }
+        switch (type[0]) {
+            case '8': ++exec; break;
+            case '9': ++cancel_reject; break;
+            case 'W': case 'X': ++md; break;
+            default: ++other; break;
+        }
+    }
+};
+
+struct RoutedHandler {
+    uint64_t exec{0}, cancel_reject{0}, md{0}, trade{0}, other{0};
+
+    void on_execution_report(const nfx::IndexedParser&) noexcept { ++exec; }
+    void on_cancel_reject(const nfx::IndexedParser&) noexcept { ++cancel_reject; }
+    void on_market_data(const nfx::IndexedParser&) noexcept { ++md; }
+    void on_trade_capture_report(const nfx::IndexedParser&) noexcept { ++trade; }
+    void on_app_message(const nfx::IndexedParser&) noexcept { ++other; }
+
+    using msg_routes = nfx::MsgRoutes<
+        nfx::MsgRoute<'8', &RoutedHandler::on_execution_report>,
+        nfx::MsgRoute<'9', &RoutedHandler::on_cancel_reject>,
+        nfx::MsgRoute<'W', &RoutedHandler::on_market_data>,
+        nfx::MsgRoute<'X', &RoutedHandler::on_market_data>,
+        nfx::MsgRoute<"AE", &RoutedHandler::on_trade_capture_report>>;
+};
+
+/// Minimal parseable message of the given MsgType (CheckSum not verified)
+inline std::string make_app_message(std::string_view type) {
+    std::string body = "35=" + std::string{type} + "\x01" "34=1\x01" "49=A\x01" "56=B\x01";
+    return "8=FIX.4.4\x01" "9=" + std::to_string(body.size()) + "\x01" + body + "10=000\x01";
+}
+
 // ============================================================================
 // Benchmark
 // ============================================================================
@@ -264,6 +312,64 @@ int main() {
     std::cout << "  NEW (lookup):     " << new_rand_cpop << " cycles/op\n";
     std::cout << "  Improvement:      " << rand_improvement << "%\n\n";
 
+    // ========================================================================
+    // Benchmark 5: Handler dispatch on parsed messages (random app types)
+    // ========================================================================
+
+    constexpr int DISPATCH_ITERATIONS = ITERATIONS / 100;
+    std::cout << "--- Handler Dispatch (random app types, " << DISPATCH_ITERATIONS
+              << " x 1024 messages) ---\n\n";
+
+    constexpr std::array<std::string_view, 6> app_types = {"8", "9", "W", "X", "AE", "D"};
+    std::vector<std::string> wire;
+    for (std::string_view type : app_types) wire.push_back(make_app_message(type));
+
+    std::vector<nfx::IndexedParser> parsed(app_types.size());
+    for (size_t i = 0; i < wire.size(); ++i) {
+        if (!parsed[i].assign<nfx::ChecksumPolicy::Deferred>(
+                std::span<const char>{wire[i].data(), wire[i].size()})) {
+            std::cerr << "Failed to parse " << app_types[i] << "\n";
+            return 1;
+        }
+    }
+
+    std::uniform_int_distribution<size_t> app_dist(0, app_types.size() - 1);
+    std::array<const nfx::IndexedParser*, 1024> random_msgs;
+    for (auto& m : random_msgs) {
+        m = &parsed[app_dist(rng)];
+    }
+
+    SwitchHandler switch_handler;
+    uint64_t old_dispatch_start = rdtsc();
+    for (int i = 0; i < DISPATCH_ITERATIONS; ++i) {
+        for (const nfx::IndexedParser* m : random_msgs) {
+            switch_handler.on_app_message(*m);
+        }
+    }
+    uint64_t old_dispatch_cycles = rdtsc() - old_dispatch_start;
+    do_not_optimize(switch_handler.exec + switch_handler.trade + switch_handler.other);
+
+    using Table = nfx::HandlerDispatchTable<RoutedHandler>;
+    RoutedHandler routed_handler;
+    const nfx::RxTimestamp rx{};
+    uint64_t new_dispatch_start = rdtsc();
+    for (int i = 0; i < DISPATCH_ITERATIONS; ++i) {
+        for (const nfx::IndexedParser* m : random_msgs) {
+            if (!Table::dispatch(routed_handler, *m, rx)) routed_handler.on_app_message(*m);
+        }
+    }
+    uint64_t new_dispatch_cycles = rdtsc() - new_dispatch_start;
+    do_not_optimize(routed_handler.exec + routed_handler.trade + routed_handler.other);
+
+    double dispatch_ops = static_cast<double>(DISPATCH_ITERATIONS) * random_msgs.size();
+    double old_dispatch_cpop = static_cast<double>(old_dispatch_cycles) / dispatch_ops;
+    double new_dispatch_cpop = static_cast<double>(new_dispatch_cycles) / dispatch_ops;
+    double dispatch_improvement = (old_dispatch_cpop - new_dispatch_cpop) / old_dispatch_cpop * 100;
+
+    std::cout << "  OLD (switch):     " << old_dispatch_cpop << " cycles/op\n";
+    std::cout << "  NEW (table):      " << new_dispatch_cpop << " cycles/op\n";
+    std::cout << "  Improvement:      " << dispatch_improvement << "%\n\n";
+
     // ========================================================================
     // Summary
     // ========================================================================
@@ -278,6 +384,7 @@ int main() {
     std::cout << "| is_admin() all     | " << old_admin_cpop << "       | " << new_admin_cpop << "       | " << admin_improvement << "% |\n";
     std::cout << "| Hot path (5 types) | " << old_hot_cpop << "       | " << new_hot_cpop << "       | " << hot_improvement << "% |\n";
     std::cout << "| Random access      | " << old_rand_cpop << "       | " << new_rand_cpop << "       | " << rand_improvement << "% |\n";
+    std::cout << "| Handler dispatch   | " << old_dispatch_cpop << "       | " << new_dispatch_cpop << "       | " << dispatch_improvement << "% |\n";
 
     return 0;
 }
@@ -0,0 +1,598 @@
+// multi_session_bench.cpp
+// NexusFIX Multi-Session Throughput Benchmark (vs QuickFIX)
+//
+// N initiator sessions <-> N acceptor sessions over 127.0.0.1, the full
+// session stack on both ends: SessionManager with an owned
+// MemoryMessageStore (every message stored), framing, parsing, sequence
+// checks. Each initiator keeps --window NewOrderSingles outstanding; the
+// acceptor answers each with an ExecutionReport echoing the ClOrdID, and
+// the next order goes out on the reply. Latency is order send -> report
+// receive per order; throughput counts both directions.
+//
+// One event-loop thread per side drives all of that side's sessions, per
+// transport stack:
+//   tcp    non-blocking sockets, epoll, recv() into SessionManager::on_bytes()
+//   uring  SessionReactor (one io_uring ring, multishot receives)
+//
+// CPU is getrusage() user+system over the measured phase for the whole
+// process (both sides), reported per million messages handled.
+//
+// Results are printed as the markdown table used in docs/compare; run
+// vs_quickfix/quickfix_multi_session_benchmark with the same arguments for
+// the QuickFIX rows (see docs/compare/MULTI_SESSION_VS_QUICKFIX.md).
+//
+// Usage:
+//   multi_session_bench [--sessions 1,10,100,1000] [--count <orders>]
+//                       [--warmup <orders>] [--window <n>] [--stack tcp|uring]
+//                       [--store-messages <n>] [--store-bytes <n>]
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "nexusfix/nexusfix.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+#include "nexusfix/session/session_reactor.hpp"
+
+using namespace nfx;
+
+namespace {
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+struct BenchConfig {
+    std::vector<size_t> sessions{1, 10, 100, 1000};
+    size_t count{200000};          // Measured orders per run
+    size_t warmup{20000};          // Orders before the measured phase
+    size_t window{8};              // Outstanding orders per session
+    std::string stack;             // Run only this stack (empty = all)
+    size_t store_messages{1024};   // Per session, oldest evicted
+    size_t store_bytes{256 * 1024};
+};
+
+constexpr std::chrono::seconds STALL_TIMEOUT{5};
+constexpr size_t RX_BUFFER_SIZE = 16 * 1024;
+constexpr int POLL_TIMEOUT_MS = 1;
+
+[[nodiscard]] inline int64_t now_ns() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+[[nodiscard]] double cpu_seconds() noexcept {
+    struct rusage usage{};
+    (void)::getrusage(RUSAGE_SELF, &usage);
+    auto sec = [](const timeval& tv) {
+        return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1e6;
+    };
+    return sec(usage.ru_utime) + sec(usage.ru_stime);
+}
+
+/// 1000 sessions need 2000+ descriptors
+void raise_fd_limit() noexcept {
+    struct rlimit limit{};
+    if (::getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        (void)::setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+std::unique_ptr<SessionManager> make_session(std::string sender, std::string target,
+                                             const BenchConfig& config) {
+    SessionConfig session_config;
+    session_config.sender_comp_id = sender;
+    session_config.target_comp_id = target;
+    session_config.heart_bt_int = 30;
+    auto session = std::make_unique<SessionManager>(session_config);
+    (void)session->own_message_store(store::MemoryMessageStore::Config{
+        .session_id = sender + "-" + target,
+        .max_messages = config.store_messages,
+        .pool_size_bytes = config.store_bytes,
+    });
+    return session;
+}
+
+// ============================================================================
+// Transport Stacks
+// ============================================================================
+
+/// One side's sessions on one stack, driven from the thread that called init()
+class Endpoint {
+public:
+    virtual ~Endpoint() = default;
+
+    [[nodiscard]] virtual bool init() = 0;
+
+    /// Serve `fd` with `session`; on_send is filled in, the rest of
+    /// `callbacks` kept. The session is connected on return.
+    [[nodiscard]] virtual bool add(int fd, SessionManager& session,
+                                   SessionCallbacks callbacks) = 0;
+
+    /// One round of I/O, waiting up to `timeout_ms` for something to arrive
+    /// (blocking rather than spinning, so both sides share small machines)
+    virtual void poll(int timeout_ms) = 0;
+};
+
+/// Non-blocking sockets under epoll
+class EpollEndpoint final : public Endpoint {
+public:
+    ~EpollEndpoint() override {
+        if (epfd_ >= 0) ::close(epfd_);
+    }
+
+    bool init() override {
+        epfd_ = ::epoll_create1(0);
+        events_.resize(256);
+        return epfd_ >= 0;
+    }
+
+    bool add(int fd, SessionManager& session, SessionCallbacks callbacks) override {
+        (void)::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        auto conn = std::make_unique<Conn>(Conn{fd, &session, std::vector<char>(RX_BUFFER_SIZE)});
+        struct epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.ptr = conn.get();
+        if (::epoll_ctl(epfd_, EPOLL_CTL_ADD, fd, &ev) < 0) return false;
+
+        callbacks.on_send = [fd](std::span<const char> data) {
+            while (!data.empty()) {
+                const ssize_t n = ::send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+                if (n > 0) {
+                    data = data.subspan(static_cast<size_t>(n));
+                } else if (n < 0 && errno == EAGAIN) {
+                    std::this_thread::yield();  // Socket buffer full: the peer is draining
+                } else {
+                    return false;
+                }
+            }
+            return true;
+        };
+        session.set_callbacks(std::move(callbacks));
+        session.on_connect();
+        conns_.push_back(std::move(conn));
+        return true;
+    }
+
+    void poll(int timeout_ms) override {
+        const int n = ::epoll_wait(epfd_, events_.data(), static_cast<int>(events_.size()), timeout_ms);
+        for (int i = 0; i < n; ++i) {
+            auto* conn = static_cast<Conn*>(events_[static_cast<size_t>(i)].data.ptr);
+            for (;;) {
+                const ssize_t got = ::recv(conn->fd, conn->rx.data(), conn->rx.size(), 0);
+                if (got <= 0) break;
+                conn->session->on_bytes({conn->rx.data(), static_cast<size_t>(got)});
+                if (static_cast<size_t>(got) < conn->rx.size()) break;
+            }
+        }
+    }
+
+private:
+    struct Conn {
+        int fd;
+        SessionManager* session;
+        std::vector<char> rx;
+    };
+
+    int epfd_{-1};
+    std::vector<struct epoll_event> events_;
+    std::vector<std::unique_ptr<Conn>> conns_;
+};
+
+#if NFX_IO_URING_AVAILABLE
+
+/// All sessions on one SessionReactor ring
+class UringEndpoint final : public Endpoint {
+public:
+    bool init() override { return reactor_.init().has_value(); }
+
+    bool add(int fd, SessionManager& session, SessionCallbacks callbacks) override {
+        int one = 1;
+        (void)::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        auto handle = reactor_.add_session(fd, session);
+        if (!handle) return false;
+        callbacks.on_send = reactor_.sender(*handle);
+        session.set_callbacks(std::move(callbacks));
+        return true;
+    }
+
+    void poll(int timeout_ms) override { (void)reactor_.run_once(timeout_ms); }
+
+private:
+    SessionReactor reactor_;
+};
+
+#endif  // NFX_IO_URING_AVAILABLE
+
+[[nodiscard]] std::unique_ptr<Endpoint> make_endpoint(std::string_view stack) {
+#if NFX_IO_URING_AVAILABLE
+    if (stack == "uring") return std::make_unique<UringEndpoint>();
+#endif
+    if (stack == "tcp") return std::make_unique<EpollEndpoint>();
+    return nullptr;
+}
+
+// ============================================================================
+// Results
+// ============================================================================
+
+struct RunResult {
+    std::string stack;
+    size_t sessions{0};
+    size_t orders{0};
+    double seconds{0};
+    double cpu_seconds{0};
+    double p50_ns{0}, p99_ns{0}, p999_ns{0}, max_ns{0};
+
+    [[nodiscard]] double messages() const noexcept { return 2.0 * static_cast<double>(orders); }
+};
+
+[[nodiscard]] double percentile(const std::vector<int64_t>& sorted, double p) noexcept {
+    if (sorted.empty()) return 0.0;
+    return static_cast<double>(sorted[static_cast<size_t>(p * static_cast<double>(sorted.size() - 1))]);
+}
+
+void print_header() {
+    std::cout << "| Engine | Stack | Sessions | Orders/s | Msgs/s | P50 (us) | P99 (us) "
+                 "| P99.9 (us) | Max (us) | CPU (cores) | CPU s / 1M msgs |\n"
+              << "|--------|-------|----------|----------|--------|----------|----------"
+                 "|------------|----------|-------------|-----------------|\n";
+}
+
+void print_row(const RunResult& r) {
+    auto us = [](double ns) { return ns / 1000.0; };
+    const double secs = r.seconds > 0 ? r.seconds : 1.0;
+    std::cout << std::fixed
+              << "| NexusFIX | " << r.stack << " | " << r.sessions << " | "
+              << std::setprecision(0) << static_cast<double>(r.orders) / secs << " | "
+              << r.messages() / secs << " | "
+              << std::setprecision(1) << us(r.p50_ns) << " | " << us(r.p99_ns) << " | "
+              << us(r.p999_ns) << " | " << us(r.max_ns) << " | "
+              << std::setprecision(2) << r.cpu_seconds / secs << " | "
+              << std::setprecision(3) << r.cpu_seconds / (r.messages() / 1e6) << " |\n";
+}
+
+// ============================================================================
+// Run
+// ============================================================================
+
+/// N session pairs on one stack: connect, log on, warm up, measure
+class MultiSessionRun {
+public:
+    MultiSessionRun(std::string stack, size_t sessions, const BenchConfig& config)
+        : stack_{std::move(stack)}, n_{sessions}, config_{config} {}
+
+    ~MultiSessionRun() {
+        stop_.store(true, std::memory_order_release);
+        if (acceptor_thread_.joinable()) acceptor_thread_.join();
+        clients_.reset();
+        for (int fd : fds_) ::close(fd);
+    }
+
+    MultiSessionRun(const MultiSessionRun&) = delete;
+    MultiSessionRun& operator=(const MultiSessionRun&) = delete;
+
+    [[nodiscard]] std::optional<RunResult> run() {
+        if (!connect_all() || !start_acceptors() || !start_clients() || !logon_all()) {
+            return std::nullopt;
+        }
+        if (!phase(config_.warmup)) {
+            std::cerr << "[ERROR] " << stack_ << "/" << n_ << ": warmup stalled\n";
+            return std::nullopt;
+        }
+
+        const double cpu0 = cpu_seconds();
+        const int64_t t0 = now_ns();
+        if (!phase(config_.count)) {
+            std::cerr << "[ERROR] " << stack_ << "/" << n_ << ": measured phase stalled\n";
+            return std::nullopt;
+        }
+        RunResult r;
+        r.seconds = static_cast<double>(now_ns() - t0) / 1e9;
+        r.cpu_seconds = cpu_seconds() - cpu0;
+        r.stack = stack_;
+        r.sessions = n_;
+        r.orders = config_.count;
+
+        std::sort(rtt_.begin(), rtt_.end());
+        r.p50_ns = percentile(rtt_, 0.50);
+        r.p99_ns = percentile(rtt_, 0.99);
+        r.p999_ns = percentile(rtt_, 0.999);
+        r.max_ns = rtt_.empty() ? 0.0 : static_cast<double>(rtt_.back());
+        return r;
+    }
+
+private:
+    /// Pairs of connected loopback sockets, accepted in connect order so
+    /// acceptor session i serves initiator i
+    [[nodiscard]] bool connect_all() {
+        if (!listener_.listen(0, static_cast<int>(std::max<size_t>(n_, 128)))) return false;
+        const uint16_t port = listener_.local_port();
+        for (size_t i = 0; i < n_; ++i) {
+            const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+            struct sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(port);
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            if (fd < 0 || ::connect(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+                std::cerr << "[ERROR] connect " << i << ": " << std::strerror(errno) << "\n";
+                if (fd >= 0) ::close(fd);
+                return false;
+            }
+            auto accepted = listener_.accept();
+            if (!accepted) return false;
+            int one = 1;
+            (void)::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            (void)::setsockopt(*accepted, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            client_fds_.push_back(fd);
+            server_fds_.push_back(*accepted);
+            fds_.push_back(fd);
+            fds_.push_back(*accepted);
+        }
+        return true;
+    }
+
+    /// Acceptor sessions on their own thread; each answers an order with
+    /// an ExecutionReport echoing its ClOrdID
+    [[nodiscard]] bool start_acceptors() {
+        for (size_t i = 0; i < n_; ++i) {
+            acceptor_sessions_.push_back(make_session("EXCH", "C" + std::to_string(i), config_));
+        }
+        std::atomic<int> ready{0};
+        acceptor_thread_ = std::thread([this, &ready] {
+            auto endpoint = make_endpoint(stack_);
+            if (!endpoint || !endpoint->init()) {
+                ready.store(-1, std::memory_order_release);
+                return;
+            }
+            fix44::ExecutionReport::Builder report;
+            report.order_id("ORDER")
+                .exec_type(ExecType::New)
+                .ord_status(OrdStatus::New)
+                .symbol("AAPL")
+                .side(Side::Buy)
+                .leaves_qty(Qty::from_int(100))
+                .cum_qty(Qty::from_int(0))
+                .avg_px(FixedPrice::from_string("0"));
+            for (size_t i = 0; i < n_; ++i) {
+                SessionManager* session = acceptor_sessions_[i].get();
+                SessionCallbacks callbacks;
+                callbacks.on_app_message = [session, &report](const IndexedParser& msg,
+                                                              const RxTimestamp&) {
+                    const auto id = msg.get_string(tag::ClOrdID::value);
+                    report.cl_ord_id(id).exec_id(id);
+                    (void)session->send_execution_report(report);
+                };
+                if (!endpoint->add(server_fds_[i], *session, std::move(callbacks))) {
+                    ready.store(-1, std::memory_order_release);
+                    return;
+                }
+            }
+            ready.store(1, std::memory_order_release);
+            while (!stop_.load(std::memory_order_acquire)) endpoint->poll(POLL_TIMEOUT_MS);
+        });
+        while (ready.load(std::memory_order_acquire) == 0) std::this_thread::yield();
+        if (ready.load(std::memory_order_acquire) < 0) {
+            std::cerr << "[ERROR] " << stack_ << ": acceptor setup failed\n";
+            return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool start_clients() {
+        clients_ = make_endpoint(stack_);
+        if (!clients_ || !clients_->init()) return false;
+
+        order_.symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20260101-09:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_string("150.25"))
+            .time_in_force(TimeInForce::Day);
+
+        for (size_t i = 0; i < n_; ++i) {
+            client_sessions_.push_back(make_session("C" + std::to_string(i), "EXCH", config_));
+            SessionManager* session = client_sessions_.back().get();
+            SessionCallbacks callbacks;
+            callbacks.on_app_message = [this, session](const IndexedParser& msg, const RxTimestamp&) {
+                on_report(*session, msg.get_string(tag::ClOrdID::value));
+            };
+            if (!clients_->add(client_fds_[i], *session, std::move(callbacks))) return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool logon_all() {
+        for (auto& session : client_sessions_) {
+            if (!session->initiate_logon()) return false;
+        }
+        const int64_t deadline = now_ns() + std::chrono::nanoseconds{STALL_TIMEOUT}.count();
+        for (;;) {
+            clients_->poll(POLL_TIMEOUT_MS);
+            const bool all = std::all_of(client_sessions_.begin(), client_sessions_.end(),
+                [](const auto& s) { return s->state() == SessionState::Active; });
+            if (all) return true;
+            if (now_ns() > deadline) {
+                std::cerr << "[ERROR] " << stack_ << "/" << n_ << ": logon timed out\n";
+                return false;
+            }
+        }
+    }
+
+    /// Send `count` orders, --window per session, until every one is answered
+    [[nodiscard]] bool phase(size_t count) {
+        base_ = next_;
+        end_ = next_ + count;
+        received_ = 0;
+        sent_at_.assign(count, 0);
+        rtt_.clear();
+        rtt_.reserve(count);
+
+        for (size_t w = 0; w < config_.window && next_ < end_; ++w) {
+            for (auto& session : client_sessions_) {
+                if (next_ >= end_) break;
+                send_order(*session);
+            }
+        }
+
+        int64_t last_progress = now_ns();
+        size_t seen = 0;
+        while (received_ < count) {
+            clients_->poll(POLL_TIMEOUT_MS);
+            if (received_ != seen) {
+                seen = received_;
+                last_progress = now_ns();
+            } else if (now_ns() - last_progress > std::chrono::nanoseconds{STALL_TIMEOUT}.count()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void send_order(SessionManager& session) {
+        char id[24];
+        auto [end, ec] = std::to_chars(id, id + sizeof(id), next_);
+        (void)ec;
+        sent_at_[next_ - base_] = now_ns();
+        ++next_;
+        order_.cl_ord_id(std::string_view{id, static_cast<size_t>(end - id)});
+        (void)session.send_new_order(order_);
+    }
+
+    void on_report(SessionManager& session, std::string_view id) {
+        const int64_t t = now_ns();
+        size_t index = 0;
+        auto [ptr, ec] = std::from_chars(id.data(), id.data() + id.size(), index);
+        if (ec != std::errc{} || index < base_ || index >= end_) return;
+        rtt_.push_back(t - sent_at_[index - base_]);
+        ++received_;
+        if (next_ < end_) send_order(session);
+    }
+
+    std::string stack_;
+    size_t n_;
+    const BenchConfig& config_;
+
+    TcpAcceptor listener_;
+    std::vector<int> client_fds_;
+    std::vector<int> server_fds_;
+    std::vector<int> fds_;
+
+    std::vector<std::unique_ptr<SessionManager>> acceptor_sessions_;
+    std::thread acceptor_thread_;
+    std::atomic<bool> stop_{false};
+
+    std::vector<std::unique_ptr<SessionManager>> client_sessions_;
+    std::unique_ptr<Endpoint> clients_;
+    fix44::NewOrderSingle::Builder order_;
+
+    size_t next_{0};      // Next ClOrdID
+    size_t base_{0};      // First ClOrdID of the current phase
+    size_t end_{0};
+    size_t received_{0};
+    std::vector<int64_t> sent_at_;
+    std::vector<int64_t> rtt_;
+};
+
+[[nodiscard]] std::vector<size_t> parse_list(std::string_view text) {
+    std::vector<size_t> out;
+    while (!text.empty()) {
+        const size_t comma = text.find(',');
+        const std::string_view item = text.substr(0, comma);
+        size_t value = 0;
+        auto [ptr, ec] = std::from_chars(item.data(), item.data() + item.size(), value);
+        if (ec == std::errc{} && value > 0) out.push_back(value);
+        if (comma == std::string_view::npos) break;
+        text.remove_prefix(comma + 1);
+    }
+    return out;
+}
+
+}  // namespace
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    BenchConfig config;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        auto value = [&]() -> const char* { return i + 1 < argc ? argv[++i] : "0"; };
+        if (arg == "--sessions") {
+            config.sessions = parse_list(value());
+        } else if (arg == "--count") {
+            config.count = std::strtoull(value(), nullptr, 10);
+        } else if (arg == "--warmup") {
+            config.warmup = std::strtoull(value(), nullptr, 10);
+        } else if (arg == "--window") {
+            config.window = std::strtoull(value(), nullptr, 10);
+        } else if (arg == "--stack") {
+            config.stack = value();
+        } else if (arg == "--store-messages") {
+            config.store_messages = std::strtoull(value(), nullptr, 10);
+        } else if (arg == "--store-bytes") {
+            config.store_bytes = std::strtoull(value(), nullptr, 10);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--sessions 1,10,100,1000] [--count <orders>] [--warmup <orders>]"
+                         " [--window <n>] [--stack tcp|uring] [--store-messages <n>]"
+                         " [--store-bytes <n>]\n";
+            return 2;
+        }
+    }
+    if (config.count == 0 || config.window == 0 || config.sessions.empty()) {
+        std::cerr << "[ERROR] nothing to run\n";
+        return 2;
+    }
+    raise_fd_limit();
+
+    std::vector<std::string> stacks{"tcp"};
+#if NFX_IO_URING_AVAILABLE
+    stacks.emplace_back("uring");
+#endif
+
+    std::cout << "NexusFIX multi-session throughput: " << config.count << " orders (+"
+              << config.warmup << " warmup), window " << config.window
+              << " per session, store " << config.store_messages << " messages / "
+              << config.store_bytes / 1024 << " KiB per session\n\n";
+    print_header();
+
+    size_t failures = 0;
+    for (const std::string& stack : stacks) {
+        if (!config.stack.empty() && config.stack != stack) continue;
+        for (size_t n : config.sessions) {
+            MultiSessionRun run{stack, n, config};
+            if (auto result = run.run()) {
+                print_row(*result);
+            } else {
+                ++failures;
+            }
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
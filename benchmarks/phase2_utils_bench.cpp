@@ -354,6 +354,37 @@ void bench_byteswap() {
     print_comparison(r1, r2);
 }
 
+// ============================================================================
+// Test 8: SendingTime Generation at Higher Precision
+// ============================================================================
+
+void bench_sending_time_precision() {
+    std::cout << "=== 8. SendingTime Generation (ms vs us vs ns) ===\n";
+    std::cout << "   Scenario: Stamp tag 52 on every outbound message\n\n";
+
+    constexpr size_t N = 1000000;
+    RdtscTimestamp ms_clock;
+    RdtscTimestampUs us_clock;
+    RdtscTimestampNs ns_clock;
+
+    auto r1 = run_bench("RdtscTimestamp (ms, 21 chars)", N, [&]() {
+        sink = ms_clock.get()[20];
+    });
+    print_result(r1);
+
+    auto r2 = run_bench("RdtscTimestampUs (us, 24 chars)", N, [&]() {
+        sink = us_clock.get()[23];
+    });
+    print_result(r2);
+    print_comparison(r1, r2);
+
+    auto r3 = run_bench("RdtscTimestampNs (ns, 27 chars)", N, [&]() {
+        sink = ns_clock.get()[26];
+    });
+    print_result(r3);
+    print_comparison(r1, r3);
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -370,6 +401,7 @@ int main() {
     bench_object_pool_high_freq();
     bench_range_check();
     bench_byteswap();
+    bench_sending_time_precision();
 
     std::cout << "============================================================\n";
     std::cout << "                       Summary\n";
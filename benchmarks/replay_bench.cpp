@@ -0,0 +1,728 @@
+// replay_bench.cpp
+// NexusFIX Captured-Log Replay Benchmark
+//
+// Replays a recorded FIX log through the receive path so optimizations are
+// judged on real field mixes (wide ExecutionReports and snapshots, custom
+// tags) instead of benchmark_utils' synthetic messages. Stages:
+//   frame    StreamParser over recv-sized chunks of the concatenated stream
+//   index    IndexedParser::parse() per message
+//   session  SessionManager::on_data_received() per counterparty message
+//            (parse, sequence check, admin / application dispatch)
+//   paced    session stage at the capture's original pacing (SendingTime
+//            gaps, scaled by --speed); latency from each message's scheduled
+//            time, so a stall shows up in every message queued behind it
+//
+// The log is memory-mapped copy-on-write. Messages are located by their
+// "8=FIX" BeginString, so line-oriented logs with timestamps or direction
+// prefixes (QuickFIX "*.messages.current.log" style) load as-is; '|' as
+// field delimiter is rewritten to SOH in the private mapping. Checksums
+// must match the SOH form of the message, as they do in captured traffic.
+//
+// The session stage plays the capture's counterparty (--counterparty, or
+// the SenderCompID with the most messages) against a session configured as
+// its TargetCompID. The session is logged on and its expected inbound
+// sequence moved to the first replayed MsgSeqNum with a SequenceReset
+// before the replay; outbound replies go nowhere.
+//
+// Usage:
+//   replay_bench <capture.log> [--passes <n>] [--chunk <bytes>]
+//                [--counterparty <CompID>] [--paced] [--speed <x>] [--json]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "include/benchmark_utils.hpp"
+#include "nexusfix/nexusfix.hpp"
+
+using namespace nfx;
+
+namespace {
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+struct ReplayConfig {
+    std::string path;
+    size_t passes{5};              // Full-speed passes over the capture
+    size_t chunk{4096};            // Bytes per read fed to StreamParser
+    std::string counterparty;      // SenderCompID to replay (default: busiest sender)
+    bool paced{false};             // Also replay at the original pacing
+    double speed{1.0};             // Pacing multiplier (2.0 = twice as fast)
+    bool json{false};
+};
+
+/// Message types reported individually (the rest are folded into "other")
+constexpr size_t MAX_TYPE_ROWS = 12;
+
+// ============================================================================
+// Capture Loading
+// ============================================================================
+
+/// One message of the capture
+struct CapturedMessage {
+    size_t offset;                 // Into ReplayLog::stream()
+    size_t size;
+    std::string_view msg_type;     // Tag 35, points into the stream
+    std::string_view sender;       // Tag 49
+    uint32_t seq_num;              // Tag 34
+    int64_t sending_time_ns;       // Tag 52 (ns since 1970), -1 if absent
+};
+
+/// Value of `tag` in a framed message, empty if absent
+[[nodiscard]] std::string_view field_value(std::string_view msg, std::string_view tag) noexcept {
+    size_t pos = 0;
+    while (pos < msg.size()) {
+        size_t eq = msg.find('=', pos);
+        if (eq == std::string_view::npos) break;
+        size_t soh = msg.find(fix::SOH, eq);
+        if (soh == std::string_view::npos) soh = msg.size();
+        if (msg.substr(pos, eq - pos) == tag) {
+            return msg.substr(eq + 1, soh - eq - 1);
+        }
+        pos = soh + 1;
+    }
+    return {};
+}
+
+/// Days since 1970-01-01 of a proleptic Gregorian date
+[[nodiscard]] constexpr int64_t days_from_civil(int64_t y, unsigned m, unsigned d) noexcept {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+/// Parse a UTCTimestamp "YYYYMMDD-HH:MM:SS[.s...]" (up to ns)
+[[nodiscard]] int64_t parse_utc_timestamp(std::string_view ts) noexcept {
+    if (ts.size() < 17 || ts[8] != '-' || ts[11] != ':' || ts[14] != ':') return -1;
+    auto num = [&](size_t pos, size_t len) {
+        int64_t v = 0;
+        for (size_t i = pos; i < pos + len; ++i) {
+            if (ts[i] < '0' || ts[i] > '9') return int64_t{-1};
+            v = v * 10 + (ts[i] - '0');
+        }
+        return v;
+    };
+    const int64_t year = num(0, 4), month = num(4, 2), day = num(6, 2);
+    const int64_t hour = num(9, 2), minute = num(12, 2), second = num(15, 2);
+    if (year < 0 || month < 1 || month > 12 || day < 1 || hour < 0 || minute < 0 || second < 0) {
+        return -1;
+    }
+
+    int64_t frac_ns = 0;
+    if (ts.size() > 18 && ts[17] == '.') {
+        int64_t scale = 100'000'000;
+        for (size_t i = 18; i < ts.size() && scale > 0; ++i, scale /= 10) {
+            if (ts[i] < '0' || ts[i] > '9') break;
+            frac_ns += (ts[i] - '0') * scale;
+        }
+    }
+
+    const int64_t days = days_from_civil(year, static_cast<unsigned>(month),
+                                         static_cast<unsigned>(day));
+    return ((days * 24 + hour) * 60 + minute) * 60'000'000'000LL +
+           second * 1'000'000'000LL + frac_ns;
+}
+
+/// Memory-mapped capture, reduced to back-to-back framed messages
+class ReplayLog {
+public:
+    ReplayLog() = default;
+    ~ReplayLog() {
+        if (map_ != nullptr) ::munmap(map_, map_size_);
+    }
+
+    ReplayLog(const ReplayLog&) = delete;
+    ReplayLog& operator=(const ReplayLog&) = delete;
+
+    /// Map and index the capture; false with a message on stderr on failure
+    [[nodiscard]] bool load(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::cerr << "[ERROR] cannot open " << path << ": " << std::strerror(errno) << "\n";
+            return false;
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) < 0 || st.st_size == 0) {
+            std::cerr << "[ERROR] " << path << " is empty or unreadable\n";
+            ::close(fd);
+            return false;
+        }
+        map_size_ = static_cast<size_t>(st.st_size);
+        // Private writable mapping: delimiter rewriting never reaches the file
+        void* map = ::mmap(nullptr, map_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (map == MAP_FAILED) {
+            std::cerr << "[ERROR] mmap " << path << ": " << std::strerror(errno) << "\n";
+            map_size_ = 0;
+            return false;
+        }
+        map_ = static_cast<char*>(map);
+        (void)::madvise(map_, map_size_, MADV_SEQUENTIAL);
+
+        std::string_view text{map_, map_size_};
+        if (text.find(fix::SOH) == std::string_view::npos) {
+            pipe_delimited_ = text.find("|10=") != std::string_view::npos;
+            if (pipe_delimited_) {
+                std::replace(map_, map_ + map_size_, '|', fix::SOH);
+            }
+        }
+
+        frame(text);
+        if (messages_.empty()) {
+            std::cerr << "[ERROR] no FIX messages found in " << path << "\n";
+            return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] std::span<const char> stream() const noexcept {
+        return {stream_.data(), stream_size_};
+    }
+
+    [[nodiscard]] std::span<const char> message(const CapturedMessage& m) const noexcept {
+        return stream().subspan(m.offset, m.size);
+    }
+
+    [[nodiscard]] const std::vector<CapturedMessage>& messages() const noexcept {
+        return messages_;
+    }
+
+    [[nodiscard]] size_t file_bytes() const noexcept { return map_size_; }
+    [[nodiscard]] size_t skipped() const noexcept { return skipped_; }
+    [[nodiscard]] bool pipe_delimited() const noexcept { return pipe_delimited_; }
+
+private:
+    /// Copy every complete message into stream_, dropping line prefixes,
+    /// newlines and truncated messages between them
+    void frame(std::string_view text) {
+        stream_.resize(text.size() + simd::SIMD_PADDING);
+        size_t pos = 0;
+        for (;;) {
+            size_t start = text.find("8=FIX", pos);
+            if (start == std::string_view::npos) break;
+            size_t trailer = text.find("\x01" "10=", start);
+            size_t next = text.find("8=FIX", start + 1);
+            if (trailer == std::string_view::npos ||
+                (next != std::string_view::npos && next < trailer)) {
+                ++skipped_;  // Truncated: no trailer before the next message
+                pos = start + 1;
+                continue;
+            }
+            size_t end = text.find(fix::SOH, trailer + 1);
+            if (end == std::string_view::npos) {
+                ++skipped_;
+                break;
+            }
+            ++end;
+
+            const std::string_view raw = text.substr(start, end - start);
+            std::memcpy(stream_.data() + stream_size_, raw.data(), raw.size());
+            messages_.push_back(CapturedMessage{
+                .offset = stream_size_,
+                .size = raw.size(),
+                .msg_type = {},
+                .sender = {},
+                .seq_num = 0,
+                .sending_time_ns = -1,
+            });
+            stream_size_ += raw.size();
+            pos = end;
+        }
+
+        // Views point into stream_, which no longer grows
+        for (auto& m : messages_) {
+            std::string_view msg{stream_.data() + m.offset, m.size};
+            m.msg_type = field_value(msg, "35");
+            m.sender = field_value(msg, "49");
+            auto seq = field_value(msg, "34");
+            for (char c : seq) {
+                if (c < '0' || c > '9') break;
+                m.seq_num = m.seq_num * 10 + static_cast<uint32_t>(c - '0');
+            }
+            m.sending_time_ns = parse_utc_timestamp(field_value(msg, "52"));
+        }
+    }
+
+    char* map_{nullptr};
+    size_t map_size_{0};
+    bool pipe_delimited_{false};
+    std::vector<char> stream_;
+    size_t stream_size_{0};
+    std::vector<CapturedMessage> messages_;
+    size_t skipped_{0};
+};
+
+// ============================================================================
+// Results
+// ============================================================================
+
+struct StageResult {
+    std::string name;
+    bench::LatencyStats latency;   // Per message (empty for frame)
+    double msgs_per_sec{0};
+    double mb_per_sec{0};
+    size_t messages{0};
+    size_t errors{0};
+};
+
+/// Per-message samples, overall and by MsgType
+class SampleSet {
+public:
+    explicit SampleSet(size_t reserve) { all_.reserve(reserve); }
+
+    void add(std::string_view msg_type, uint64_t cycles) {
+        all_.push_back(cycles);
+        by_type_[msg_type].push_back(cycles);
+    }
+
+    /// Overall row plus one row per frequent MsgType
+    void emit(std::vector<StageResult>& out, const std::string& stage, double freq_ghz,
+              double elapsed_ns, size_t bytes, size_t errors) {
+        StageResult total;
+        total.name = stage;
+        total.messages = all_.size();
+        total.errors = errors;
+        if (elapsed_ns > 0) {
+            total.msgs_per_sec = static_cast<double>(all_.size()) * 1e9 / elapsed_ns;
+            total.mb_per_sec = static_cast<double>(bytes) * 1e3 / elapsed_ns;
+        }
+        total.latency.compute(all_, freq_ghz);
+        out.push_back(std::move(total));
+
+        std::vector<std::pair<std::string_view, std::vector<uint64_t>*>> types;
+        for (auto& [type, samples] : by_type_) types.emplace_back(type, &samples);
+        std::sort(types.begin(), types.end(), [](const auto& a, const auto& b) {
+            return a.second->size() > b.second->size();
+        });
+
+        std::vector<uint64_t> other;
+        for (size_t i = 0; i < types.size(); ++i) {
+            if (i >= MAX_TYPE_ROWS) {
+                other.insert(other.end(), types[i].second->begin(), types[i].second->end());
+                continue;
+            }
+            StageResult row;
+            row.name = stage + "/" + std::string(types[i].first.empty() ? "?" : types[i].first);
+            row.messages = types[i].second->size();
+            row.latency.compute(*types[i].second, freq_ghz);
+            out.push_back(std::move(row));
+        }
+        if (!other.empty()) {
+            StageResult row;
+            row.name = stage + "/other";
+            row.messages = other.size();
+            row.latency.compute(other, freq_ghz);
+            out.push_back(std::move(row));
+        }
+    }
+
+private:
+    std::vector<uint64_t> all_;
+    std::map<std::string_view, std::vector<uint64_t>> by_type_;
+};
+
+/// Keeps framing results observable
+volatile uint64_t g_sink = 0;
+
+[[nodiscard]] inline int64_t now_ns() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ============================================================================
+// Stages
+// ============================================================================
+
+/// StreamParser over the stream as a sequence of chunk-sized reads
+StageResult run_frame(const ReplayLog& log, const ReplayConfig& config) {
+    const auto stream = log.stream();
+    StreamParser parser;
+    size_t framed = 0;
+    uint64_t sink = 0;
+
+    const int64_t start = now_ns();
+    for (size_t pass = 0; pass < config.passes; ++pass) {
+        size_t pos = 0;
+        size_t window_end = 0;
+        while (pos < stream.size()) {
+            window_end = std::max(window_end, std::min(stream.size(), pos + config.chunk));
+            auto window = stream.subspan(pos, window_end - pos);
+            size_t consumed = parser.feed(window);
+            while (parser.has_message()) {
+                auto [begin, end] = parser.next_message();
+                sink += static_cast<uint64_t>(window[begin + 9]) + (end - begin);
+                ++framed;
+            }
+            if (consumed == 0) {
+                if (window_end == stream.size()) break;  // Trailing partial message
+                window_end = std::min(stream.size(), window_end + config.chunk);  // Spans reads
+            }
+            pos += consumed;
+        }
+    }
+    const double elapsed = static_cast<double>(now_ns() - start);
+    g_sink = sink;
+
+    StageResult r;
+    r.name = "frame";
+    r.messages = framed;
+    r.errors = log.messages().size() * config.passes - framed;
+    r.msgs_per_sec = static_cast<double>(framed) * 1e9 / elapsed;
+    r.mb_per_sec = static_cast<double>(stream.size() * config.passes) * 1e3 / elapsed;
+    return r;
+}
+
+/// IndexedParser::parse per message, timed individually
+void run_index(const ReplayLog& log, const ReplayConfig& config, double freq_ghz,
+               std::vector<StageResult>& out) {
+    const auto& messages = log.messages();
+    SampleSet samples{messages.size() * config.passes};
+    size_t errors = 0;
+    int64_t elapsed = 0;
+
+    for (size_t pass = 0; pass < config.passes; ++pass) {
+        const int64_t start = now_ns();
+        for (const auto& m : messages) {
+            const uint64_t t0 = bench::rdtscp();
+            auto parsed = IndexedParser::parse(log.message(m));
+            const uint64_t t1 = bench::rdtscp();
+            if (!parsed) {
+                ++errors;
+                continue;
+            }
+            samples.add(m.msg_type, t1 - t0);
+        }
+        elapsed += now_ns() - start;
+    }
+    samples.emit(out, "index", freq_ghz, static_cast<double>(elapsed),
+                 log.stream().size() * config.passes, errors);
+}
+
+/// Session for the capture's counterparty, logged on and expecting
+/// `first_seq` next
+class ReplaySession {
+public:
+    ReplaySession(std::string_view counterparty, std::string_view our_id, uint32_t first_seq)
+        : counterparty_{counterparty}
+        , our_id_{our_id}
+        , session_{make_config()}
+    {
+        SessionCallbacks callbacks;
+        callbacks.on_send = [](std::span<const char>) { return true; };
+        callbacks.on_app_message = [this](const IndexedParser& msg, const RxTimestamp&) {
+            sink_ += static_cast<uint64_t>(msg.msg_type());
+        };
+        session_.set_callbacks(std::move(callbacks));
+
+        session_.on_connect();
+        (void)session_.initiate_logon();
+        MessageAssembler assembler;
+        auto logon = fix44::Logon::Builder{}
+            .sender_comp_id(counterparty_)
+            .target_comp_id(our_id_)
+            .msg_seq_num(1)
+            .sending_time("20260101-00:00:00.000")
+            .encrypt_method(0)
+            .heart_bt_int(30)
+            .build(assembler);
+        session_.on_data_received(logon);
+        auto reset = fix44::SequenceReset::Builder{}
+            .sender_comp_id(counterparty_)
+            .target_comp_id(our_id_)
+            .msg_seq_num(2)
+            .sending_time("20260101-00:00:00.000")
+            .new_seq_no(first_seq)
+            .gap_fill_flag(false)
+            .build(assembler);
+        session_.on_data_received(reset);
+    }
+
+    [[nodiscard]] bool active() const noexcept {
+        return session_.state() == SessionState::Active;
+    }
+
+    void receive(std::span<const char> msg) noexcept { session_.on_data_received(msg); }
+
+    [[nodiscard]] uint64_t sink() const noexcept { return sink_; }
+
+private:
+    SessionConfig make_config() const {
+        SessionConfig config;
+        config.sender_comp_id = our_id_;
+        config.target_comp_id = counterparty_;
+        config.heart_bt_int = 30;
+        return config;
+    }
+
+    std::string counterparty_;
+    std::string our_id_;
+    SessionManager session_;
+    uint64_t sink_{0};
+};
+
+/// Counterparty messages and the CompID the session plays
+struct SessionPlan {
+    std::vector<const CapturedMessage*> messages;
+    std::string counterparty;
+    std::string our_id;
+    size_t bytes{0};
+};
+
+[[nodiscard]] SessionPlan plan_session(const ReplayLog& log, const ReplayConfig& config) {
+    SessionPlan plan;
+    const auto& messages = log.messages();
+    plan.counterparty = config.counterparty;
+    if (plan.counterparty.empty()) {
+        std::map<std::string_view, size_t> per_sender;
+        for (const auto& m : messages) ++per_sender[m.sender];
+        plan.counterparty = std::string(std::max_element(
+            per_sender.begin(), per_sender.end(),
+            [](const auto& a, const auto& b) { return a.second < b.second; })->first);
+    }
+    for (const auto& m : messages) {
+        if (m.sender != plan.counterparty) continue;
+        if (plan.our_id.empty()) {
+            plan.our_id = std::string(field_value(
+                std::string_view{log.message(m).data(), m.size}, "56"));
+        }
+        plan.messages.push_back(&m);
+        plan.bytes += m.size;
+    }
+    return plan;
+}
+
+/// SessionManager dispatch per counterparty message at full speed
+void run_session(const ReplayLog& log, const SessionPlan& plan, const ReplayConfig& config,
+                 double freq_ghz, std::vector<StageResult>& out) {
+    SampleSet samples{plan.messages.size() * config.passes};
+    int64_t elapsed = 0;
+    size_t errors = 0;
+
+    for (size_t pass = 0; pass < config.passes; ++pass) {
+        ReplaySession session{plan.counterparty, plan.our_id, plan.messages.front()->seq_num};
+        if (!session.active()) ++errors;
+        const int64_t start = now_ns();
+        for (const auto* m : plan.messages) {
+            const uint64_t t0 = bench::rdtscp();
+            session.receive(log.message(*m));
+            const uint64_t t1 = bench::rdtscp();
+            samples.add(m->msg_type, t1 - t0);
+        }
+        elapsed += now_ns() - start;
+    }
+    samples.emit(out, "session", freq_ghz, static_cast<double>(elapsed),
+                 plan.bytes * config.passes, errors);
+}
+
+/// One pass at the capture's pacing: latency from the scheduled time
+void run_paced(const ReplayLog& log, const SessionPlan& plan, const ReplayConfig& config,
+               std::vector<StageResult>& out) {
+    int64_t base = -1;
+    for (const auto* m : plan.messages) {
+        if (m->sending_time_ns >= 0) {
+            base = m->sending_time_ns;
+            break;
+        }
+    }
+    if (base < 0) {
+        std::cerr << "[WARN] paced: no SendingTime (52) in the capture, skipped\n";
+        return;
+    }
+
+    ReplaySession session{plan.counterparty, plan.our_id, plan.messages.front()->seq_num};
+    std::vector<double> latency;
+    std::vector<double> service;
+    latency.reserve(plan.messages.size());
+    service.reserve(plan.messages.size());
+
+    const int64_t start = now_ns() + 1'000'000;
+    int64_t offset = 0;
+    for (const auto* m : plan.messages) {
+        // Timestamps that go backwards (clock steps, multiple senders) keep
+        // the previous schedule point
+        if (m->sending_time_ns >= 0) {
+            offset = std::max(offset, static_cast<int64_t>(
+                static_cast<double>(m->sending_time_ns - base) / config.speed));
+        }
+        // Spin rather than sleep: wakeup jitter would dominate the result
+        const int64_t due = start + offset;
+        int64_t now = now_ns();
+        while (now < due) {
+            now = now_ns();
+        }
+        session.receive(log.message(*m));
+        const int64_t done = now_ns();
+        latency.push_back(static_cast<double>(done - due));
+        service.push_back(static_cast<double>(done - now));
+    }
+    const double elapsed = static_cast<double>(now_ns() - start);
+
+    StageResult r;
+    r.name = "paced";
+    r.messages = latency.size();
+    r.msgs_per_sec = static_cast<double>(latency.size()) * 1e9 / elapsed;
+    r.mb_per_sec = static_cast<double>(plan.bytes) * 1e3 / elapsed;
+    r.latency.compute_from_ns(latency);
+    out.push_back(std::move(r));
+
+    StageResult s;
+    s.name = "paced/service";
+    s.messages = service.size();
+    s.latency.compute_from_ns(service);
+    out.push_back(std::move(s));
+}
+
+// ============================================================================
+// Output
+// ============================================================================
+
+void print_header() {
+    std::cout << "  " << std::left << std::setw(22) << "stage (ns)" << std::right
+              << std::setw(10) << "msgs"
+              << std::setw(9) << "P50"
+              << std::setw(9) << "P90"
+              << std::setw(9) << "P99"
+              << std::setw(10) << "P99.9"
+              << std::setw(10) << "max"
+              << std::setw(12) << "msgs/s"
+              << std::setw(9) << "MB/s" << "\n";
+}
+
+void print_result(const StageResult& r) {
+    const bool per_message = r.latency.count > 0;
+    std::cout << std::fixed << std::setprecision(0)
+              << "  " << std::left << std::setw(22) << r.name << std::right
+              << std::setw(10) << r.messages;
+    if (per_message) {
+        std::cout << std::setw(9) << r.latency.p50_ns
+                  << std::setw(9) << r.latency.p90_ns
+                  << std::setw(9) << r.latency.p99_ns
+                  << std::setw(10) << r.latency.p999_ns
+                  << std::setw(10) << r.latency.max_ns;
+    } else {
+        std::cout << std::setw(47) << "-";
+    }
+    if (r.msgs_per_sec > 0) {
+        std::cout << std::setw(12) << r.msgs_per_sec
+                  << std::setw(9) << std::setprecision(1) << r.mb_per_sec;
+    }
+    if (r.errors > 0) {
+        std::cout << "  (" << r.errors << " errors)";
+    }
+    std::cout << "\n";
+}
+
+void print_json(const std::vector<StageResult>& results) {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        std::cout << "    { \"name\": \"replay/" << r.name
+                  << "\", \"p50_ns\": " << r.latency.p50_ns
+                  << ", \"p90_ns\": " << r.latency.p90_ns
+                  << ", \"p99_ns\": " << r.latency.p99_ns
+                  << ", \"p999_ns\": " << r.latency.p999_ns
+                  << ", \"mean_ns\": " << r.latency.mean_ns
+                  << ", \"max_ns\": " << r.latency.max_ns
+                  << ", \"msgs_per_sec\": " << r.msgs_per_sec
+                  << ", \"mb_per_sec\": " << r.mb_per_sec
+                  << ", \"messages\": " << r.messages
+                  << ", \"errors\": " << r.errors << " }"
+                  << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    std::cout << "  ]\n}\n";
+}
+
+}  // namespace
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    ReplayConfig config;
+    for (int i = 1; i < argc; ++i) {
+        auto arg = std::string_view{argv[i]};
+        auto value = [&]() -> const char* { return i + 1 < argc ? argv[++i] : "0"; };
+        if (arg == "--json") {
+            config.json = true;
+        } else if (arg == "--paced") {
+            config.paced = true;
+        } else if (arg == "--passes") {
+            config.passes = static_cast<size_t>(std::atoll(value()));
+        } else if (arg == "--chunk") {
+            config.chunk = static_cast<size_t>(std::atoll(value()));
+        } else if (arg == "--counterparty") {
+            config.counterparty = value();
+        } else if (arg == "--speed") {
+            config.speed = std::atof(value());
+        } else if (!arg.starts_with("--") && config.path.empty()) {
+            config.path = arg;
+        } else {
+            config.path.clear();
+            break;
+        }
+    }
+    if (config.path.empty() || config.passes == 0 || config.chunk == 0 || config.speed <= 0) {
+        std::cerr << "Usage: " << argv[0] << " <capture.log> [--passes <n>] [--chunk <bytes>]"
+                     " [--counterparty <CompID>] [--paced] [--speed <x>] [--json]\n";
+        return 2;
+    }
+
+    ReplayLog log;
+    if (!log.load(config.path)) {
+        return 1;
+    }
+    const SessionPlan plan = plan_session(log, config);
+    const double freq_ghz = bench::estimate_cpu_freq_ghz_busy();
+
+    if (!config.json) {
+        std::cout << "NexusFIX capture replay: " << config.path << "\n"
+                  << "  " << log.messages().size() << " messages, " << log.stream().size()
+                  << " bytes framed of " << log.file_bytes() << " in file"
+                  << (log.pipe_delimited() ? " ('|' delimited)" : "");
+        if (log.skipped() > 0) std::cout << ", " << log.skipped() << " truncated skipped";
+        std::cout << "\n  session: " << plan.messages.size() << " messages from "
+                  << plan.counterparty << " to " << plan.our_id << ", "
+                  << config.passes << " passes\n\n";
+        print_header();
+    }
+
+    std::vector<StageResult> results;
+    results.push_back(run_frame(log, config));
+    run_index(log, config, freq_ghz, results);
+    if (!plan.messages.empty()) {
+        run_session(log, plan, config, freq_ghz, results);
+        if (config.paced) {
+            run_paced(log, plan, config, results);
+        }
+    } else {
+        std::cerr << "[WARN] no messages from " << plan.counterparty << ", session skipped\n";
+    }
+
+    if (config.json) {
+        print_json(results);
+    } else {
+        for (const auto& r : results) print_result(r);
+    }
+    return 0;
+}
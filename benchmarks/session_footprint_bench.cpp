@@ -0,0 +1,223 @@
+// session_footprint_bench.cpp
+// NexusFIX Per-Session Memory Footprint Benchmark
+//
+// Reports the bytes one SessionManager costs on an acceptor with many
+// mostly idle counterparties: the object itself plus everything it
+// allocates (owned MemoryMessageStore log and index, batch buffer, order
+// templates, reassembly buffer). All sessions allocate through one
+// counting resource over a shared pool (SessionConfig::buffer_resource),
+// so the numbers are exact requested bytes, not RSS estimates.
+//
+// Phases:
+//   created   constructed with an owned store (AcceptorEngineConfig sizes)
+//   active    logged on, a batch of orders sent, a message reassembled
+//   idle      after compact() (what idle_compact_heartbeats triggers)
+//   rehydrate first order after compaction vs steady state
+//
+// Usage:
+//   session_footprint_bench [--sessions <n>] [--store-messages <n>]
+//                           [--store-bytes <n>]
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "include/benchmark_utils.hpp"
+#include "nexusfix/nexusfix.hpp"
+
+using namespace nfx;
+
+namespace {
+
+/// Forwards to upstream, tracking bytes outstanding
+class CountingResource final : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream) noexcept
+        : upstream_{upstream} {}
+
+    [[nodiscard]] size_t in_use() const noexcept { return in_use_; }
+    [[nodiscard]] size_t peak() const noexcept { return peak_; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        void* p = upstream_->allocate(bytes, alignment);
+        in_use_ += bytes;
+        if (in_use_ > peak_) peak_ = in_use_;
+        return p;
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        upstream_->deallocate(p, bytes, alignment);
+        in_use_ -= bytes;
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream_;
+    size_t in_use_{0};
+    size_t peak_{0};
+};
+
+struct Counterparty {
+    std::string target;
+    std::unique_ptr<SessionManager> session;
+};
+
+void print_row(const char* phase, size_t bytes, size_t sessions) {
+    const double per = static_cast<double>(bytes) / static_cast<double>(sessions);
+    std::cout << "  " << std::left << std::setw(12) << phase
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(14) << per / 1024.0 << " KiB/session"
+              << std::setw(14) << static_cast<double>(bytes) / (1024.0 * 1024.0) << " MiB total\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t sessions = 1000;
+    size_t store_messages = 10000;          // AcceptorEngineConfig::store_max_messages
+    size_t store_bytes = 4 * 1024 * 1024;   // AcceptorEngineConfig::store_pool_size
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--sessions" && i + 1 < argc) {
+            sessions = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--store-messages" && i + 1 < argc) {
+            store_messages = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--store-bytes" && i + 1 < argc) {
+            store_bytes = std::strtoull(argv[++i], nullptr, 10);
+        }
+    }
+    if (sessions == 0) sessions = 1;
+
+    std::pmr::unsynchronized_pool_resource pool;
+    CountingResource counting{&pool};
+
+    std::cout << "NexusFIX Session Footprint Benchmark\n";
+    std::cout << "====================================\n";
+    std::cout << "Sessions: " << sessions << ", store: " << store_messages
+              << " messages / " << store_bytes / 1024 << " KiB log\n\n";
+    std::cout << "sizeof(SessionManager): " << sizeof(SessionManager) << " bytes\n";
+    std::cout << "  MessageAssembler " << sizeof(MessageAssembler)
+              << ", IndexedParser " << sizeof(IndexedParser)
+              << ", MemoryMessageStore " << sizeof(store::MemoryMessageStore) << "\n\n";
+
+    // ------------------------------------------------------------------
+    // created
+    // ------------------------------------------------------------------
+    std::vector<Counterparty> parties(sessions);
+    for (size_t i = 0; i < sessions; ++i) {
+        auto& cp = parties[i];
+        cp.target = "CLIENT" + std::to_string(i);
+
+        SessionConfig config;
+        config.sender_comp_id = "EXCH";
+        config.target_comp_id = cp.target;
+        config.buffer_resource = &counting;
+        cp.session = std::make_unique<SessionManager>(config);
+
+        SessionCallbacks callbacks;
+        callbacks.on_send = [](std::span<const char>) { return true; };
+        cp.session->set_callbacks(std::move(callbacks));
+        (void)cp.session->own_message_store(store::MemoryMessageStore::Config{
+            .session_id = "EXCH-" + cp.target,
+            .max_messages = store_messages,
+            .pool_size_bytes = store_bytes,
+        });
+    }
+    const size_t object_bytes = sessions * sizeof(SessionManager);
+
+    std::cout << "Bytes per session (object + allocations):\n";
+    print_row("created", object_bytes + counting.in_use(), sessions);
+
+    // ------------------------------------------------------------------
+    // active
+    // ------------------------------------------------------------------
+    MessageAssembler inbound;
+    for (size_t i = 0; i < sessions; ++i) {
+        auto& cp = parties[i];
+        auto& session = *cp.session;
+        session.on_connect();
+        auto logon = fix44::Logon::Builder{}
+            .sender_comp_id(cp.target).target_comp_id("EXCH").msg_seq_num(1)
+            .sending_time("20260101-00:00:00.000")
+            .encrypt_method(0).heart_bt_int(30)
+            .build(inbound);
+        session.on_data_received(logon);
+
+        session.begin_batch();
+        for (int n = 0; n < 8; ++n) {
+            auto order = fix44::NewOrderSingle::Builder{}
+                .cl_ord_id("ORD1").symbol("AAPL").side(Side::Buy)
+                .transact_time("20260101-00:00:00.000")
+                .order_qty(Qty::from_int(100)).ord_type(OrdType::Limit)
+                .price(FixedPrice::from_string("150.25"));
+            (void)session.send_new_order(order);
+        }
+        (void)session.flush();
+
+        // A heartbeat split across two reads allocates the reassembly buffer
+        auto hb = fix44::Heartbeat::Builder{}
+            .sender_comp_id(cp.target).target_comp_id("EXCH").msg_seq_num(2)
+            .sending_time("20260101-00:00:00.000")
+            .build(inbound);
+        session.on_bytes(hb.first(hb.size() / 2));
+        session.on_bytes(hb.subspan(hb.size() / 2));
+    }
+    print_row("active", object_bytes + counting.in_use(), sessions);
+
+    // ------------------------------------------------------------------
+    // idle
+    // ------------------------------------------------------------------
+    size_t released = 0;
+    for (auto& cp : parties) released += cp.session->compact();
+    print_row("idle", object_bytes + counting.in_use(), sessions);
+    std::cout << "  compact() released " << std::fixed << std::setprecision(1)
+              << static_cast<double>(released) / static_cast<double>(sessions) / 1024.0
+              << " KiB/session\n\n";
+
+    // ------------------------------------------------------------------
+    // rehydrate
+    // ------------------------------------------------------------------
+    const double freq_ghz = bench::estimate_cpu_freq_ghz();
+    auto order = fix44::NewOrderSingle::Builder{}
+        .cl_ord_id("ORD2").symbol("AAPL").side(Side::Buy)
+        .transact_time("20260101-00:00:00.000")
+        .order_qty(Qty::from_int(100)).ord_type(OrdType::Limit)
+        .price(FixedPrice::from_string("150.25"));
+
+    std::vector<uint64_t> first, steady;
+    first.reserve(sessions);
+    steady.reserve(sessions);
+    for (auto& cp : parties) {
+        uint64_t t0 = bench::rdtsc_vm_safe();
+        (void)cp.session->send_new_order(order);
+        uint64_t t1 = bench::rdtsc_vm_safe();
+        (void)cp.session->send_new_order(order);
+        uint64_t t2 = bench::rdtsc_vm_safe();
+        first.push_back(t1 - t0);
+        steady.push_back(t2 - t1);
+    }
+    bench::LatencyStats first_stats, steady_stats;
+    first_stats.compute(first, freq_ghz);
+    steady_stats.compute(steady, freq_ghz);
+
+    std::cout << "send_new_order() latency:\n";
+    std::cout << "  first after compact  P50 " << std::setw(9) << first_stats.p50_ns
+              << " ns   P99 " << std::setw(9) << first_stats.p99_ns << " ns\n";
+    std::cout << "  steady state         P50 " << std::setw(9) << steady_stats.p50_ns
+              << " ns   P99 " << std::setw(9) << steady_stats.p99_ns << " ns\n";
+    print_row("rehydrated", object_bytes + counting.in_use(), sessions);
+
+    parties.clear();
+    return 0;
+}
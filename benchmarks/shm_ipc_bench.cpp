@@ -0,0 +1,223 @@
+/*
+    Shared-memory IPC Benchmark
+
+    Cost of one engine -> strategy hop for a 128-byte FIX message:
+    - Hop cost, single thread: SPSCQueue push + pop vs ShmPublisher publish
+      + ShmSubscriber poll (same copy, same cache, no contention)
+    - Round trip: in-process SPSCQueue ping-pong between two threads vs
+      ShmPublisher/ShmSubscriber ping-pong between two processes (fork)
+
+    Round trips need two free cores and are skipped on fewer (spinning
+    peers sharing a core measure the scheduler, not the ring).
+
+    Build: cmake --build build && ./build/bin/benchmarks/shm_ipc_bench
+*/
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/transport/shm_transport.hpp"
+#include "include/benchmark_utils.hpp"
+
+using namespace nfx;
+using namespace nfx::bench;
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+constexpr size_t WARMUP_OPS = 100'000;
+constexpr size_t SAMPLES = 20'000;
+constexpr size_t OPS_PER_SAMPLE = 64;
+constexpr size_t ROUND_TRIPS = 100'000;
+constexpr size_t MESSAGE_SIZE = 128;
+
+using Message = std::array<char, MESSAGE_SIZE>;
+
+// ============================================================================
+// Measurement
+// ============================================================================
+
+template <typename Op>
+LatencyStats measure(Op&& op, double freq_ghz) {
+    for (size_t i = 0; i < WARMUP_OPS; ++i) op();
+
+    std::vector<uint64_t> cycles;
+    cycles.reserve(SAMPLES);
+    for (size_t s = 0; s < SAMPLES; ++s) {
+        const uint64_t start = rdtsc();
+        for (size_t i = 0; i < OPS_PER_SAMPLE; ++i) op();
+        cycles.push_back((rdtsc() - start) / OPS_PER_SAMPLE);
+    }
+
+    LatencyStats stats;
+    stats.compute(cycles, freq_ghz);
+    return stats;
+}
+
+/// One-way latency (half the round trip) per sample
+LatencyStats to_stats(std::vector<uint64_t>& rtt_cycles, double freq_ghz) {
+    for (auto& c : rtt_cycles) c /= 2;
+    LatencyStats stats;
+    stats.compute(rtt_cycles, freq_ghz);
+    return stats;
+}
+
+// ============================================================================
+// Round Trips
+// ============================================================================
+
+LatencyStats spsc_round_trip(double freq_ghz) {
+    auto ping = std::make_unique<memory::SPSCQueue<Message, 1024>>();
+    auto pong = std::make_unique<memory::SPSCQueue<Message, 1024>>();
+
+    std::thread echo([&] {
+        (void)bind_to_core(3);
+        Message m;
+        for (size_t i = 0; i < ROUND_TRIPS; ++i) {
+            while (!ping->try_pop(m)) memory::BusySpinWait::wait();
+            while (!pong->try_push(m)) memory::BusySpinWait::wait();
+        }
+    });
+
+    Message out{};
+    Message in;
+    std::vector<uint64_t> cycles;
+    cycles.reserve(ROUND_TRIPS);
+    for (size_t i = 0; i < ROUND_TRIPS; ++i) {
+        const uint64_t start = rdtsc();
+        while (!ping->try_push(out)) memory::BusySpinWait::wait();
+        while (!pong->try_pop(in)) memory::BusySpinWait::wait();
+        cycles.push_back(rdtsc() - start);
+    }
+    echo.join();
+    return to_stats(cycles, freq_ghz);
+}
+
+bool shm_round_trip(double freq_ghz, LatencyStats& stats) {
+    const std::string ping_name = "bench.ping." + std::to_string(::getpid());
+    const std::string pong_name = "bench.pong." + std::to_string(::getpid());
+    const ShmRingConfig config{.capacity = 1 << 20, .futex_wakeup = false};
+
+    auto ping = ShmPublisher::create(ping_name, config);
+    auto pong_ring = ShmPublisher::create_ring(pong_name, config);
+    if (!ping || !pong_ring) return false;
+    auto pong = ShmSubscriber::attach(pong_name);
+    if (!pong) return false;
+
+    const pid_t child = ::fork();
+    if (child < 0) return false;
+    if (child == 0) {
+        (void)bind_to_core(3);
+        auto rx = ShmSubscriber::attach(ping_name);
+        auto tx = ShmPublisher::attach(pong_name);
+        if (!rx || !tx) ::_exit(1);
+        for (size_t i = 0; i < ROUND_TRIPS; ++i) {
+            size_t got = 0;
+            while (got == 0) {
+                got = rx->poll([&](const ShmMessage& m) {
+                    while (!tx->publish(m.kind, m.payload, m.meta)) memory::BusySpinWait::wait();
+                });
+            }
+        }
+        ::_exit(0);
+    }
+
+    while (ping->subscribers() == 0) std::this_thread::yield();
+
+    Message out{};
+    std::vector<uint64_t> cycles;
+    cycles.reserve(ROUND_TRIPS);
+    for (size_t i = 0; i < ROUND_TRIPS; ++i) {
+        const uint64_t start = rdtsc();
+        while (!ping->publish(ShmPayload::Fix, out)) memory::BusySpinWait::wait();
+        while (pong->poll([](const ShmMessage&) {}) == 0) memory::BusySpinWait::wait();
+        cycles.push_back(rdtsc() - start);
+    }
+
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    stats = to_stats(cycles, freq_ghz);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+int main() {
+    std::cout << "==========================================================\n";
+    std::cout << "  Shared-memory IPC Benchmark: " << MESSAGE_SIZE << "-byte message hop\n";
+    std::cout << "==========================================================\n\n";
+
+    (void)bind_to_core(2);
+    const double freq_ghz = estimate_cpu_freq_ghz();
+    std::cout << "CPU frequency: " << std::fixed << std::setprecision(3) << freq_ghz << " GHz\n";
+    std::cout << "Cores: " << get_num_cores() << "\n\n";
+
+    // Hop cost, single thread
+    auto queue = std::make_unique<memory::SPSCQueue<Message, 1024>>();
+    Message msg{};
+    Message sink{};
+    const auto spsc_hop = measure([&] {
+        (void)queue->try_push(msg);
+        (void)queue->try_pop(sink);
+    }, freq_ghz);
+
+    const std::string hop_name = "bench.hop." + std::to_string(::getpid());
+    auto publisher = ShmPublisher::create(hop_name, {.capacity = 1 << 20, .futex_wakeup = false});
+    if (!publisher) {
+        std::cout << "shm_open failed: " << publisher.error().message() << "\n";
+        return 1;
+    }
+    auto subscriber = ShmSubscriber::attach(hop_name);
+    if (!subscriber) return 1;
+    uint64_t bytes = 0;
+    const auto shm_hop = measure([&] {
+        (void)publisher->publish(ShmPayload::Fix, msg);
+        (void)subscriber->poll([&](const ShmMessage& m) { bytes += m.payload.size(); });
+    }, freq_ghz);
+
+    auto publisher_wake = ShmPublisher::create(hop_name + ".wake", {.capacity = 1 << 20});
+    auto subscriber_wake = ShmSubscriber::attach(hop_name + ".wake");
+    if (!publisher_wake || !subscriber_wake) return 1;
+    const auto shm_hop_wake = measure([&] {
+        (void)publisher_wake->publish(ShmPayload::Fix, msg);
+        (void)subscriber_wake->poll([&](const ShmMessage& m) { bytes += m.payload.size(); });
+    }, freq_ghz);
+
+    std::cout << "Hop cost, producer + consumer on one thread\n";
+    print_comparison_header("SPSCQueue", "ShmRing");
+    print_comparison("publish + poll (mean ns)", spsc_hop, shm_hop);
+    print_comparison("  futex wakeup enabled", spsc_hop, shm_hop_wake);
+
+    // Round trips
+    if (get_num_cores() < 2) {
+        std::cout << "\nRound trips skipped: need two cores\n";
+        std::cout << "\n(sink " << bytes + static_cast<uint64_t>(sink[0]) << ")\n";
+        return 0;
+    }
+    const auto spsc_rtt = spsc_round_trip(freq_ghz);
+    LatencyStats shm_rtt;
+    if (!shm_round_trip(freq_ghz, shm_rtt)) {
+        std::cout << "\nCross-process round trip failed\n";
+        return 1;
+    }
+
+    std::cout << "\nOne-way latency (RTT / 2)\n";
+    print_comparison_header("Thread SPSC", "Process shm");
+    print_comparison("P50 (ns)", spsc_rtt.p50_ns, shm_rtt.p50_ns);
+    print_comparison("P99 (ns)", spsc_rtt.p99_ns, shm_rtt.p99_ns);
+    print_comparison("Mean (ns)", spsc_rtt.mean_ns, shm_rtt.mean_ns);
+
+    std::cout << "\n(sink " << bytes + static_cast<uint64_t>(sink[0]) << ")\n";
+    return 0;
+}
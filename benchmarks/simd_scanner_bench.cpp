@@ -1,8 +1,10 @@
-// Benchmark: SIMD SOH Scanner (Scalar vs AVX2 vs AVX-512)
+// Benchmark: SIMD SOH Scanner (Scalar vs AVX2 vs AVX-512, or NEON vs SVE2 on ARM)
 // Compares performance of different SIMD implementations
 //
 // Build: g++ -std=c++23 -O3 -march=native -mavx2 simd_scanner_bench.cpp -o simd_scanner_bench
 // With AVX-512: g++ -std=c++23 -O3 -march=native -mavx512f -mavx512bw simd_scanner_bench.cpp -o simd_scanner_bench
+// ARM (NEON): g++ -std=c++23 -O3 -mcpu=native simd_scanner_bench.cpp -o simd_scanner_bench
+// ARM (SVE2): g++ -std=c++23 -O3 -march=armv9-a+sve2 simd_scanner_bench.cpp -o simd_scanner_bench
 
 #include <iostream>
 #include <iomanip>
@@ -28,11 +30,17 @@ constexpr int WARMUP_ITERATIONS = 1000;
 constexpr int BENCHMARK_ITERATIONS = 100000;
 constexpr int NUM_RUNS = 5;
 
-// RDTSC for precise timing
+// RDTSC for precise timing (generic timer count on ARM)
 inline uint64_t rdtsc() {
+#if defined(__aarch64__)
+    uint64_t cnt;
+    asm volatile("isb; mrs %0, cntvct_el0" : "=r"(cnt) :: "memory");
+    return cnt;
+#else
     uint64_t lo, hi;
     asm volatile("rdtscp" : "=a"(lo), "=d"(hi) :: "rcx");
     return (hi << 32) | lo;
+#endif
 }
 
 // Get CPU frequency
@@ -41,7 +49,11 @@ double get_cpu_freq_ghz() {
     uint64_t start_tsc = rdtsc();
 
     while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(100)) {
+#if defined(__aarch64__)
+        asm volatile("yield");
+#else
         asm volatile("pause");
+#endif
     }
 
     auto end = std::chrono::steady_clock::now();
@@ -127,13 +139,15 @@ void print_result(const char* name, const BenchmarkResult& r) {
 
 int main() {
     std::cout << "==========================================================\n";
-    std::cout << "  SIMD SOH Scanner Benchmark: Scalar vs AVX2 vs AVX-512\n";
+    std::cout << "  SIMD SOH Scanner Benchmark: Scalar vs AVX2/AVX-512/NEON/SVE2\n";
     std::cout << "==========================================================\n\n";
 
     // Feature detection
     std::cout << "SIMD Features:\n";
     std::cout << "  NFX_SIMD_AVAILABLE:   " << NFX_SIMD_AVAILABLE << "\n";
     std::cout << "  NFX_AVX512_AVAILABLE: " << NFX_AVX512_AVAILABLE << "\n";
+    std::cout << "  NFX_HAS_NEON:         " << NFX_HAS_NEON << "\n";
+    std::cout << "  NFX_HAS_SVE2:         " << NFX_HAS_SVE2 << "\n";
 
     std::cout << "\nCalibrating CPU frequency...\n";
     double cpu_freq_ghz = get_cpu_freq_ghz();
@@ -169,6 +183,14 @@ int main() {
 #if NFX_AVX512_AVAILABLE
             auto r3 = nfx::simd::scan_soh_avx512(span);
             asm volatile("" :: "r"(r3.count));
+#endif
+#if NFX_HAS_NEON
+            auto r4 = nfx::simd::scan_soh_neon(span);
+            asm volatile("" :: "r"(r4.count));
+#endif
+#if NFX_HAS_SVE2
+            auto r5 = nfx::simd::scan_soh_sve2(span);
+            asm volatile("" :: "r"(r5.count));
 #endif
         }
 
@@ -245,6 +267,58 @@ int main() {
         std::cout << "  AVX-512 speedup (vs scalar): " << std::fixed << std::setprecision(2) << avx512_speedup << "x\n";
         std::cout << "  AVX-512 speedup (vs AVX2):   " << avx512_vs_avx2 << "x\n";
 #endif
+
+#if NFX_HAS_NEON
+        // Benchmark NEON
+        std::vector<BenchmarkResult> neon_results;
+        for (int run = 0; run < NUM_RUNS; ++run) {
+            neon_results.push_back(benchmark_scan(
+                nfx::simd::scan_soh_neon, span, BENCHMARK_ITERATIONS, cpu_freq_ghz));
+        }
+
+        BenchmarkResult neon_avg{};
+        for (const auto& r : neon_results) {
+            neon_avg.mean_ns += r.mean_ns;
+            neon_avg.median_ns += r.median_ns;
+            neon_avg.throughput_gbps += r.throughput_gbps;
+        }
+        neon_avg.mean_ns /= NUM_RUNS;
+        neon_avg.median_ns /= NUM_RUNS;
+        neon_avg.throughput_gbps /= NUM_RUNS;
+        neon_avg.bytes_processed = size;
+
+        print_result("NEON", neon_avg);
+
+        double neon_speedup = scalar_avg.mean_ns / neon_avg.mean_ns;
+        std::cout << "  NEON speedup: " << std::fixed << std::setprecision(2) << neon_speedup << "x\n";
+#endif
+
+#if NFX_HAS_SVE2
+        // Benchmark SVE2
+        std::vector<BenchmarkResult> sve2_results;
+        for (int run = 0; run < NUM_RUNS; ++run) {
+            sve2_results.push_back(benchmark_scan(
+                nfx::simd::scan_soh_sve2, span, BENCHMARK_ITERATIONS, cpu_freq_ghz));
+        }
+
+        BenchmarkResult sve2_avg{};
+        for (const auto& r : sve2_results) {
+            sve2_avg.mean_ns += r.mean_ns;
+            sve2_avg.median_ns += r.median_ns;
+            sve2_avg.throughput_gbps += r.throughput_gbps;
+        }
+        sve2_avg.mean_ns /= NUM_RUNS;
+        sve2_avg.median_ns /= NUM_RUNS;
+        sve2_avg.throughput_gbps /= NUM_RUNS;
+        sve2_avg.bytes_processed = size;
+
+        print_result("SVE2", sve2_avg);
+
+        double sve2_speedup = scalar_avg.mean_ns / sve2_avg.mean_ns;
+        double sve2_vs_neon = neon_avg.mean_ns / sve2_avg.mean_ns;
+        std::cout << "  SVE2 speedup (vs scalar): " << std::fixed << std::setprecision(2) << sve2_speedup << "x\n";
+        std::cout << "  SVE2 speedup (vs NEON):   " << sve2_vs_neon << "x\n";
+#endif
     }
 
     std::cout << "\n==========================================================\n";
@@ -255,6 +329,7 @@ int main() {
     std::cout << "  >= 128 bytes: AVX-512 (if available)\n";
     std::cout << "  >= 64 bytes:  AVX2\n";
     std::cout << "  < 64 bytes:   Scalar\n";
+    std::cout << "  ARM: SVE2 (runtime HWCAP2 check), NEON >= 32 bytes, else Scalar\n";
 
 #if !NFX_AVX512_AVAILABLE
     std::cout << "\nNote: AVX-512 not available on this system.\n";
@@ -0,0 +1,205 @@
+/*
+    SPSC Queue Benchmark
+
+    Compares, producer and consumer on separate threads:
+    - try_push / try_pop (one element per acquire/release pair)
+    - try_push_n / try_pop_n with batch sizes 4, 16, 64
+    - blocking push / pop with each wait strategy
+
+    Metrics:
+    - Throughput (messages/second)
+    - Latency (ns per message)
+*/
+
+#include <nexusfix/memory/spsc_queue.hpp>
+#include <nexusfix/memory/wait_strategy.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nfx::memory;
+using namespace std::chrono;
+
+// ============================================================================
+// Test Configuration
+// ============================================================================
+
+constexpr size_t QUEUE_CAPACITY = 4096;
+constexpr size_t NUM_MESSAGES = 5'000'000;
+constexpr size_t MAX_BATCH = 64;
+
+// Test payload
+struct TestMessage {
+    uint64_t sequence;
+    uint64_t payload[7];
+};
+
+static_assert(sizeof(TestMessage) == 64, "TestMessage should be cache-line sized");
+
+struct Result {
+    double throughput_mps;  // messages per second (millions)
+    double latency_ns;      // nanoseconds per message
+    bool ordered;
+};
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+
+/// Element-at-a-time (Batch == 1) or bulk transfer
+template<size_t Batch, typename Wait = BusySpinWait>
+Result benchmark_batch(size_t num_messages) {
+    using Queue = SPSCQueue<TestMessage, QUEUE_CAPACITY, Wait>;
+    auto queue_ptr = std::make_unique<Queue>();
+    auto& queue = *queue_ptr;
+    std::atomic<bool> ordered{true};
+
+    std::thread consumer([&]() {
+        std::array<TestMessage, MAX_BATCH> out{};
+        uint64_t expected = 0;
+        bool ok = true;
+        while (expected < num_messages) {
+            size_t n;
+            if constexpr (Batch == 1) {
+                n = queue.try_pop(out[0]) ? 1 : 0;
+            } else {
+                n = queue.try_pop_n(std::span{out}.first(Batch));
+            }
+            if (n == 0) {
+                Wait::wait();
+                continue;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                ok = ok && out[i].sequence == expected;
+                ++expected;
+            }
+        }
+        ordered.store(ok, std::memory_order_release);
+    });
+
+    std::array<TestMessage, MAX_BATCH> batch{};
+    auto start_time = steady_clock::now();
+
+    for (size_t sent = 0; sent < num_messages;) {
+        const size_t n = std::min(Batch, num_messages - sent);
+        for (size_t i = 0; i < n; ++i) {
+            batch[i].sequence = sent + i;
+        }
+
+        size_t pushed = 0;
+        while (pushed < n) {
+            size_t k;
+            if constexpr (Batch == 1) {
+                k = queue.try_push(batch[0]) ? 1 : 0;
+            } else {
+                k = queue.try_push_n(std::span<const TestMessage>{batch}.subspan(pushed, n - pushed));
+            }
+            if (k == 0) Wait::wait();
+            pushed += k;
+        }
+        sent += n;
+    }
+
+    consumer.join();
+    auto end_time = steady_clock::now();
+
+    auto elapsed = duration_cast<nanoseconds>(end_time - start_time);
+    double elapsed_sec = static_cast<double>(elapsed.count()) / 1e9;
+
+    return {
+        .throughput_mps = static_cast<double>(num_messages) / elapsed_sec / 1e6,
+        .latency_ns = static_cast<double>(elapsed.count()) / static_cast<double>(num_messages),
+        .ordered = ordered.load(std::memory_order_acquire)
+    };
+}
+
+/// Blocking push()/pop() under a wait strategy
+template<typename Wait>
+Result benchmark_blocking(size_t num_messages) {
+    using Queue = SPSCQueue<TestMessage, QUEUE_CAPACITY, Wait>;
+    auto queue_ptr = std::make_unique<Queue>();
+    auto& queue = *queue_ptr;
+    std::atomic<bool> ordered{true};
+
+    std::thread consumer([&]() {
+        bool ok = true;
+        for (uint64_t expected = 0; expected < num_messages; ++expected) {
+            ok = ok && queue.pop().sequence == expected;
+        }
+        ordered.store(ok, std::memory_order_release);
+    });
+
+    auto start_time = steady_clock::now();
+    TestMessage msg{};
+    for (size_t i = 0; i < num_messages; ++i) {
+        msg.sequence = i;
+        queue.push(msg);
+    }
+    consumer.join();
+    auto end_time = steady_clock::now();
+
+    auto elapsed = duration_cast<nanoseconds>(end_time - start_time);
+    double elapsed_sec = static_cast<double>(elapsed.count()) / 1e9;
+
+    return {
+        .throughput_mps = static_cast<double>(num_messages) / elapsed_sec / 1e6,
+        .latency_ns = static_cast<double>(elapsed.count()) / static_cast<double>(num_messages),
+        .ordered = ordered.load(std::memory_order_acquire)
+    };
+}
+
+// ============================================================================
+// Output
+// ============================================================================
+
+void print_header(const char* title) {
+    std::cout << "\n" << std::string(70, '=') << "\n";
+    std::cout << "  " << title << "\n";
+    std::cout << std::string(70, '=') << "\n";
+}
+
+void print_row(const std::string& name, const Result& r, double baseline_mps) {
+    std::cout << "  " << std::left << std::setw(24) << name << std::right
+              << std::setw(10) << r.throughput_mps << " M msg/s"
+              << std::setw(10) << r.latency_ns << " ns/msg"
+              << std::setw(8) << r.throughput_mps / baseline_mps << "x"
+              << (r.ordered ? "" : "  ORDER VIOLATION") << "\n";
+}
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    print_header("SPSC Queue Benchmark");
+    std::cout << "\nQueue Capacity: " << QUEUE_CAPACITY << " entries\n";
+    std::cout << "Message Size: " << sizeof(TestMessage) << " bytes\n";
+    std::cout << "Messages: " << NUM_MESSAGES / 1'000'000.0 << "M\n";
+
+    // Warm caches and threads
+    (void)benchmark_batch<1>(NUM_MESSAGES / 10);
+
+    print_header("Batch Size (BusySpinWait)");
+    auto single = benchmark_batch<1>(NUM_MESSAGES);
+    print_row("try_push / try_pop", single, single.throughput_mps);
+    print_row("try_push_n / pop_n x4", benchmark_batch<4>(NUM_MESSAGES), single.throughput_mps);
+    print_row("try_push_n / pop_n x16", benchmark_batch<16>(NUM_MESSAGES), single.throughput_mps);
+    print_row("try_push_n / pop_n x64", benchmark_batch<64>(NUM_MESSAGES), single.throughput_mps);
+
+    print_header("Blocking push / pop by Wait Strategy");
+    auto spin = benchmark_blocking<BusySpinWait>(NUM_MESSAGES);
+    print_row(BusySpinWait::name(), spin, spin.throughput_mps);
+    print_row(YieldingWait::name(), benchmark_blocking<YieldingWait>(NUM_MESSAGES), spin.throughput_mps);
+    print_row(BackoffWait<>::name(), benchmark_blocking<BackoffWait<>>(NUM_MESSAGES), spin.throughput_mps);
+    print_row(AdaptiveWait<>::name(), benchmark_blocking<AdaptiveWait<>>(NUM_MESSAGES), spin.throughput_mps);
+
+    std::cout << "\n";
+    return 0;
+}
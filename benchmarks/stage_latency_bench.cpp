@@ -0,0 +1,814 @@
+// stage_latency_bench.cpp
+// NexusFIX Per-Message-Type Stage Latency Benchmark
+//
+// For every message type in messages/ (FIX 4.4, FIX 5.0, FIXT 1.1) and
+// every hot-path stage it goes through:
+//   serialize  Builder::build() into a MessageAssembler
+//   parse      <Type>::from_buffer()
+//   checksum   parser::checksum() over the header and body
+//   store      MemoryMessageStore::store() (evicting, steady state)
+//   queue      slab copy + SPSCQueue descriptor push/pop (AsyncMessageStore
+//              hand-off shape; single thread, so no cross-core transfer)
+//   roundtrip  SessionManager -> SessionManager -> SessionManager: the
+//              initiator sends, the acceptor dispatches and replies (echo
+//              for application messages, Heartbeat for TestRequest), the
+//              initiator dispatches the reply
+//
+// Per case: rdtscp per-op samples (P50/P90/P99/P99.9), nanobench median
+// ns/op (batched, no per-op timer overhead) and perf_counters.hpp hardware
+// counters per op (cycles, instructions, branch misses; null when
+// perf_event_open is unavailable, e.g. most VMs).
+//
+// Types without a Builder (market data snapshots/increments, rejects) are
+// assembled once from raw fields and skip serialize; MarketDataRequest has
+// no typed decoder and parses as a generic ParsedMessage; types that change
+// session state (Logon, Logout, ResendRequest, SequenceReset, Reject) and
+// builder-less types skip roundtrip.
+//
+// Usage:
+//   stage_latency_bench [iterations] [--json] [--filter <substring>]
+// --json output matches parse_benchmark's, so scripts/check_perf_regression.sh
+// gates it against benchmarks/baselines.json.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <x86intrin.h>
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "include/nanobench.h"
+#include "include/perf_counters.hpp"
+
+#include "nexusfix/nexusfix.hpp"
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/messages/fix44/market_data.hpp"
+#include "nexusfix/messages/fix50/fix50.hpp"
+#include "nexusfix/messages/fixt11/fixt11.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+
+namespace nfx::bench {
+
+// ============================================================================
+// Timing
+// ============================================================================
+
+inline uint64_t rdtsc_start() noexcept {
+    uint32_t aux;
+    uint64_t tsc = __rdtscp(&aux);
+    _mm_lfence();
+    return tsc;
+}
+
+inline uint64_t rdtsc_end() noexcept {
+    _mm_lfence();
+    uint32_t aux;
+    return __rdtscp(&aux);
+}
+
+inline double get_cpu_freq_ghz() noexcept {
+    auto start_time = std::chrono::steady_clock::now();
+    uint32_t aux;
+    uint64_t start_cycles = __rdtscp(&aux);
+
+    volatile uint64_t dummy = 0;
+    for (int i = 0; i < 10000000; ++i) {
+        dummy = dummy + static_cast<uint64_t>(i);
+    }
+
+    uint64_t end_cycles = __rdtscp(&aux);
+    auto end_time = std::chrono::steady_clock::now();
+
+    auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        end_time - start_time).count();
+    return static_cast<double>(end_cycles - start_cycles) / static_cast<double>(elapsed_ns);
+}
+
+// ============================================================================
+// Results
+// ============================================================================
+
+struct StageResult {
+    std::string name;       // "<version>.<MsgType>/<stage>"
+    size_t iterations{0};
+    double min_ns{0};
+    double mean_ns{0};
+    double p50_ns{0};
+    double p90_ns{0};
+    double p99_ns{0};
+    double p999_ns{0};
+    double max_ns{0};
+    double op_ns{0};        // nanobench median per op
+    std::optional<double> cycles;
+    std::optional<double> instructions;
+    std::optional<double> branch_misses;
+};
+
+void print_result(const StageResult& r) {
+    std::cout << std::fixed << std::setprecision(1)
+              << "  " << std::left << std::setw(44) << r.name << std::right
+              << std::setw(9) << r.p50_ns
+              << std::setw(9) << r.p99_ns
+              << std::setw(10) << r.p999_ns
+              << std::setw(9) << r.op_ns;
+    auto counter = [](const std::optional<double>& v, int width) {
+        if (v) {
+            std::cout << std::setw(width) << *v;
+        } else {
+            std::cout << std::setw(width) << "-";
+        }
+    };
+    counter(r.cycles, 9);
+    counter(r.instructions, 9);
+    counter(r.branch_misses, 8);
+    std::cout << "\n";
+}
+
+void print_header() {
+    std::cout << "  " << std::left << std::setw(44) << "case (ns)" << std::right
+              << std::setw(9) << "P50"
+              << std::setw(9) << "P99"
+              << std::setw(10) << "P99.9"
+              << std::setw(9) << "op"
+              << std::setw(9) << "cycles"
+              << std::setw(9) << "insns"
+              << std::setw(8) << "brmiss" << "\n";
+}
+
+void print_json(const std::vector<StageResult>& results) {
+    auto counter = [](const std::optional<double>& v) {
+        if (v) {
+            std::cout << *v;
+        } else {
+            std::cout << "null";
+        }
+    };
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        std::cout << "    { \"name\": \"" << r.name
+                  << "\", \"p50_ns\": " << r.p50_ns
+                  << ", \"p90_ns\": " << r.p90_ns
+                  << ", \"p99_ns\": " << r.p99_ns
+                  << ", \"p999_ns\": " << r.p999_ns
+                  << ", \"mean_ns\": " << r.mean_ns
+                  << ", \"min_ns\": " << r.min_ns
+                  << ", \"max_ns\": " << r.max_ns
+                  << ", \"op_ns\": " << r.op_ns
+                  << ", \"cycles\": ";
+        counter(r.cycles);
+        std::cout << ", \"instructions\": ";
+        counter(r.instructions);
+        std::cout << ", \"branch_misses\": ";
+        counter(r.branch_misses);
+        std::cout << ", \"iterations\": " << r.iterations << " }";
+        if (i + 1 < results.size()) std::cout << ",";
+        std::cout << "\n";
+    }
+    std::cout << "  ]\n}\n";
+}
+
+// ============================================================================
+// Measurement
+// ============================================================================
+
+/// Runs one case three ways and records a StageResult
+class StageRunner {
+public:
+    static constexpr size_t WARMUP_ITERATIONS = 1000;
+
+    StageRunner(size_t iterations, double freq_ghz, std::string filter)
+        : iterations_{iterations}
+        , freq_ghz_{freq_ghz}
+        , filter_{std::move(filter)}
+    {
+        samples_.reserve(iterations_);
+        counters_available_ = counters_.add(PerfEvent::CpuCycles) &&
+                              counters_.add(PerfEvent::Instructions) &&
+                              counters_.add(PerfEvent::BranchMisses);
+    }
+
+    [[nodiscard]] bool counters_available() const noexcept { return counters_available_; }
+    [[nodiscard]] const std::vector<StageResult>& results() const noexcept { return results_; }
+
+    /// @param fn Operation under test; its result is kept alive
+    template<typename Fn>
+    void run(const std::string& name, Fn&& fn) {
+        if (!filter_.empty() && name.find(filter_) == std::string::npos) return;
+
+        for (size_t i = 0; i < WARMUP_ITERATIONS; ++i) {
+            ankerl::nanobench::doNotOptimizeAway(fn());
+        }
+
+        StageResult r;
+        r.name = name;
+        r.iterations = iterations_;
+
+        // Tail latency: one rdtscp pair per op
+        samples_.clear();
+        for (size_t i = 0; i < iterations_; ++i) {
+            const uint64_t start = rdtsc_start();
+            ankerl::nanobench::doNotOptimizeAway(fn());
+            const uint64_t end = rdtsc_end();
+            samples_.push_back(static_cast<double>(end - start) / freq_ghz_);
+        }
+        fill_percentiles(r);
+
+        // Hardware counters over an untimed loop
+        if (counters_available_) {
+            {
+                ScopedPerfCounters scope{counters_};
+                for (size_t i = 0; i < iterations_; ++i) {
+                    ankerl::nanobench::doNotOptimizeAway(fn());
+                }
+            }
+            const auto n = static_cast<double>(iterations_);
+            for (const auto& c : counters_.read()) {
+                if (!c.valid) continue;
+                const double per_op = static_cast<double>(c.value) / n;
+                switch (c.event) {
+                    case PerfEvent::CpuCycles:    r.cycles = per_op; break;
+                    case PerfEvent::Instructions: r.instructions = per_op; break;
+                    case PerfEvent::BranchMisses: r.branch_misses = per_op; break;
+                    default: break;
+                }
+            }
+        }
+
+        // Batched throughput-style figure
+        ankerl::nanobench::Bench nb;
+        nb.output(nullptr).warmup(100).minEpochIterations(std::max<size_t>(iterations_ / 10, 10));
+        nb.run(name, [&] { ankerl::nanobench::doNotOptimizeAway(fn()); });
+        if (!nb.results().empty()) {
+            r.op_ns = nb.results().back().median(
+                ankerl::nanobench::Result::Measure::elapsed) * 1e9;
+        }
+
+        results_.push_back(std::move(r));
+        if (on_result) on_result(results_.back());
+    }
+
+    std::function<void(const StageResult&)> on_result;
+
+private:
+    void fill_percentiles(StageResult& r) {
+        std::sort(samples_.begin(), samples_.end());
+        auto percentile = [&](double p) {
+            size_t idx = static_cast<size_t>(p * static_cast<double>(samples_.size()));
+            if (idx >= samples_.size()) idx = samples_.size() - 1;
+            return samples_[idx];
+        };
+        r.min_ns = samples_.front();
+        r.max_ns = samples_.back();
+        r.mean_ns = std::accumulate(samples_.begin(), samples_.end(), 0.0) /
+                    static_cast<double>(samples_.size());
+        r.p50_ns = percentile(0.50);
+        r.p90_ns = percentile(0.90);
+        r.p99_ns = percentile(0.99);
+        r.p999_ns = percentile(0.999);
+    }
+
+    size_t iterations_;
+    double freq_ghz_;
+    std::string filter_;
+    std::vector<double> samples_;
+    PerfCounterGroup counters_;
+    bool counters_available_{false};
+    std::vector<StageResult> results_;
+};
+
+// ============================================================================
+// Stage Fixtures
+// ============================================================================
+
+/// Steady-state store: evicts the oldest message once full
+class StoreStage {
+public:
+    StoreStage()
+        : store_{store::MemoryMessageStore::Config{
+              .session_id = "BENCH",
+              .max_messages = 4096,
+              .pool_size_bytes = 4 * 1024 * 1024}} {}
+
+    [[nodiscard]] bool operator()(std::span<const char> msg) noexcept {
+        return store_.store(seq_++, msg);
+    }
+
+private:
+    store::MemoryMessageStore store_;
+    uint32_t seq_{1};
+};
+
+/// Thread hand-off shape of AsyncMessageStore: copy into a slab slot,
+/// publish a descriptor, consume it and touch the bytes
+class QueueStage {
+public:
+    static constexpr size_t CAPACITY = 1024;
+    static constexpr size_t SLOT_SIZE = 2048;
+
+    QueueStage()
+        : slab_{std::make_unique_for_overwrite<char[]>(CAPACITY * SLOT_SIZE)}
+        , queue_{std::make_unique<Queue>()} {}
+
+    [[nodiscard]] uint32_t operator()(std::span<const char> msg) noexcept {
+        const auto slot = static_cast<uint32_t>(next_++ & (CAPACITY - 1));
+        char* dst = slab_.get() + slot * SLOT_SIZE;
+        std::memcpy(dst, msg.data(), msg.size());
+        if (!queue_->try_push(Entry{slot, static_cast<uint32_t>(msg.size())})) return 0;
+
+        Entry e{};
+        if (!queue_->try_pop(e)) return 0;
+        const char* src = slab_.get() + e.slot * SLOT_SIZE;
+        return e.length + static_cast<uint8_t>(src[e.length - 1]);
+    }
+
+private:
+    struct Entry {
+        uint32_t slot;
+        uint32_t length;
+    };
+
+    using Queue = memory::SPSCQueue<Entry, CAPACITY>;
+
+    std::unique_ptr<char[]> slab_;
+    std::unique_ptr<Queue> queue_;
+    uint64_t next_{0};
+};
+
+/// Initiator and acceptor SessionManagers wired back to back (each one's
+/// on_send is the other's on_data_received), logged on
+class SessionPair {
+public:
+    SessionPair()
+        : initiator_{make_config("CLIENT", "BROKER")}
+        , acceptor_{make_config("BROKER", "CLIENT")}
+    {
+        SessionCallbacks ic;
+        ic.on_send = [this](std::span<const char> data) {
+            acceptor_.on_data_received(data);
+            return true;
+        };
+        ic.on_app_message = [this](const IndexedParser&, const RxTimestamp&) {
+            ++replies_;
+        };
+        initiator_.set_callbacks(std::move(ic));
+
+        SessionCallbacks ac;
+        ac.on_send = [this](std::span<const char> data) {
+            initiator_.on_data_received(data);
+            return true;
+        };
+        ac.on_app_message = [this](const IndexedParser&, const RxTimestamp&) {
+            if (echo_) echo_();
+        };
+        acceptor_.set_callbacks(std::move(ac));
+
+        acceptor_.on_connect();
+        initiator_.on_connect();
+        (void)initiator_.initiate_logon();
+    }
+
+    SessionPair(const SessionPair&) = delete;
+    SessionPair& operator=(const SessionPair&) = delete;
+
+    [[nodiscard]] bool active() const noexcept {
+        return initiator_.state() == SessionState::Active &&
+               acceptor_.state() == SessionState::Active;
+    }
+
+    [[nodiscard]] SessionManager& initiator() noexcept { return initiator_; }
+    [[nodiscard]] SessionManager& acceptor() noexcept { return acceptor_; }
+
+    /// Acceptor's reply to each application message it receives
+    void set_echo(std::function<void()> echo) { echo_ = std::move(echo); }
+
+    /// Messages dispatched back to the initiator's application callback
+    [[nodiscard]] uint64_t replies() const noexcept { return replies_; }
+
+private:
+    static SessionConfig make_config(std::string_view sender, std::string_view target) noexcept {
+        SessionConfig config;
+        config.sender_comp_id = sender;
+        config.target_comp_id = target;
+        config.heart_bt_int = 30;
+        return config;
+    }
+
+    SessionManager initiator_;
+    SessionManager acceptor_;
+    std::function<void()> echo_;
+    uint64_t replies_{0};
+};
+
+// ============================================================================
+// Message Cases
+// ============================================================================
+
+constexpr std::string_view SENDING_TIME = "20260101-09:30:00.000";
+
+/// Context shared by every case
+struct Suite {
+    explicit Suite(StageRunner& r) : runner{r} {}
+
+    StageRunner& runner;
+    StoreStage store;
+    QueueStage queue;
+    size_t failures{0};
+};
+
+/// Typed decode where the message has one, generic ParsedMessage otherwise
+template<typename Msg>
+[[nodiscard]] bool parse_as(std::span<const char> wire) noexcept {
+    if constexpr (requires { Msg::from_buffer(wire); }) {
+        return Msg::from_buffer(wire).has_value();
+    } else {
+        return ParsedMessage::parse(wire).has_value();
+    }
+}
+
+/// Stages that only need the encoded bytes
+template<typename Msg>
+void run_codec_stages(Suite& suite, const std::string& name, std::span<const char> wire) {
+    if (!parse_as<Msg>(wire)) {
+        std::cerr << "[ERROR] " << name << ": sample message does not parse\n";
+        ++suite.failures;
+        return;
+    }
+
+    suite.runner.run(name + "/parse", [&] {
+        return parse_as<Msg>(wire);
+    });
+
+    // Header and body: everything before "10=XXX|"
+    const std::span<const char> covered = wire.first(wire.size() - 7);
+    suite.runner.run(name + "/checksum", [&] {
+        return parser::checksum(covered);
+    });
+
+    suite.runner.run(name + "/store", [&] {
+        return suite.store(wire);
+    });
+
+    suite.runner.run(name + "/queue", [&] {
+        return suite.queue(wire);
+    });
+}
+
+/// Message type with a Builder: serialize plus codec stages
+template<typename Msg, typename Builder>
+void run_built(Suite& suite, const std::string& name, Builder builder) {
+    builder.sender_comp_id("CLIENT")
+        .target_comp_id("BROKER")
+        .msg_seq_num(1)
+        .sending_time(SENDING_TIME);
+
+    MessageAssembler assembler;
+    suite.runner.run(name + "/serialize", [&] {
+        return builder.build(assembler).size();
+    });
+
+    const auto wire = builder.build(assembler);
+    const std::vector<char> bytes(wire.begin(), wire.end());
+    run_codec_stages<Msg>(suite, name, bytes);
+}
+
+/// Message type without a Builder, assembled from raw fields
+template<typename Msg, typename Fields>
+void run_raw(Suite& suite, const std::string& name, bool fixt, Fields&& fields) {
+    MessageAssembler assembler;
+    if (fixt) {
+        assembler.start_fixt11();
+    } else {
+        assembler.start();
+    }
+    assembler.field(tag::MsgType::value, Msg::MSG_TYPE)
+        .field(tag::SenderCompID::value, std::string_view{"BROKER"})
+        .field(tag::TargetCompID::value, std::string_view{"CLIENT"})
+        .field(tag::MsgSeqNum::value, int64_t{1})
+        .field(tag::SendingTime::value, SENDING_TIME);
+    fields(assembler);
+    const auto wire = assembler.finish();
+    const std::vector<char> bytes(wire.begin(), wire.end());
+    run_codec_stages<Msg>(suite, name, bytes);
+}
+
+/// Session round trip: initiator sends `builder`, the acceptor answers
+/// with `reply` (nullopt: the protocol's own reply, e.g. TestRequest ->
+/// Heartbeat), the initiator dispatches the answer
+template<typename Builder>
+void run_roundtrip(Suite& suite, const std::string& name, Builder builder,
+                   std::optional<std::type_identity_t<Builder>> reply) {
+    SessionPair pair;
+    if (!pair.active()) {
+        std::cerr << "[ERROR] " << name << ": session pair failed to log on\n";
+        ++suite.failures;
+        return;
+    }
+    if (reply) {
+        pair.set_echo([&pair, &reply] { (void)pair.acceptor().send_app_message(*reply); });
+    }
+
+    // One-shot check that the answer actually comes back
+    const uint64_t replies_before = pair.replies();
+    const uint64_t received_before = pair.initiator().stats().messages_received;
+    if (!pair.initiator().send_app_message(builder).has_value() ||
+        (reply ? pair.replies() == replies_before
+               : pair.initiator().stats().messages_received == received_before)) {
+        std::cerr << "[ERROR] " << name << ": no reply in round trip\n";
+        ++suite.failures;
+        return;
+    }
+
+    suite.runner.run(name + "/roundtrip", [&] {
+        return pair.initiator().send_app_message(builder).has_value();
+    });
+}
+
+// ----------------------------------------------------------------------------
+// FIX 4.4
+// ----------------------------------------------------------------------------
+
+fix44::NewOrderSingle::Builder fix44_new_order() {
+    fix44::NewOrderSingle::Builder b;
+    b.cl_ord_id("ORD0000001")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time(SENDING_TIME)
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit)
+        .price(FixedPrice::from_string("150.25"))
+        .time_in_force(TimeInForce::Day)
+        .account("ACCT01");
+    return b;
+}
+
+fix44::OrderCancelRequest::Builder fix44_cancel() {
+    fix44::OrderCancelRequest::Builder b;
+    b.orig_cl_ord_id("ORD0000001")
+        .cl_ord_id("CXL0000001")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time(SENDING_TIME)
+        .order_qty(Qty::from_int(100));
+    return b;
+}
+
+fix44::ExecutionReport::Builder fix44_exec_report() {
+    fix44::ExecutionReport::Builder b;
+    b.order_id("EXCH000001")
+        .exec_id("EXEC000001")
+        .exec_type(ExecType::Trade)
+        .ord_status(OrdStatus::PartiallyFilled)
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .leaves_qty(Qty::from_int(60))
+        .cum_qty(Qty::from_int(40))
+        .avg_px(FixedPrice::from_string("150.25"))
+        .cl_ord_id("ORD0000001")
+        .order_qty(Qty::from_int(100))
+        .price(FixedPrice::from_string("150.25"))
+        .last_px(FixedPrice::from_string("150.25"))
+        .last_qty(Qty::from_int(40));
+    return b;
+}
+
+fix44::MarketDataRequest::Builder fix44_md_request() {
+    fix44::MarketDataRequest::Builder b;
+    b.md_req_id("MD0001")
+        .subscription_type(SubscriptionRequestType::SnapshotPlusUpdates)
+        .market_depth(5)
+        .md_update_type(MDUpdateType::IncrementalRefresh)
+        .add_entry_type(MDEntryType::Bid)
+        .add_entry_type(MDEntryType::Offer)
+        .add_symbol("AAPL");
+    return b;
+}
+
+void run_fix44(Suite& suite) {
+    run_built<fix44::Heartbeat>(suite, "fix44.Heartbeat", fix44::Heartbeat::Builder{});
+    run_built<fix44::TestRequest>(suite, "fix44.TestRequest",
+        fix44::TestRequest::Builder{}.test_req_id("TEST0001"));
+    run_built<fix44::ResendRequest>(suite, "fix44.ResendRequest",
+        fix44::ResendRequest::Builder{}.begin_seq_no(100).end_seq_no(0));
+    run_built<fix44::SequenceReset>(suite, "fix44.SequenceReset",
+        fix44::SequenceReset::Builder{}.new_seq_no(200).gap_fill_flag(true));
+    run_built<fix44::Reject>(suite, "fix44.Reject",
+        fix44::Reject::Builder{}.ref_seq_num(10).ref_tag_id(44).session_reject_reason(5)
+            .text("Value is incorrect"));
+    run_built<fix44::Logon>(suite, "fix44.Logon",
+        fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30));
+    run_built<fix44::Logout>(suite, "fix44.Logout", fix44::Logout::Builder{}.text("done"));
+    run_built<fix44::NewOrderSingle>(suite, "fix44.NewOrderSingle", fix44_new_order());
+    run_built<fix44::OrderCancelRequest>(suite, "fix44.OrderCancelRequest", fix44_cancel());
+    run_built<fix44::ExecutionReport>(suite, "fix44.ExecutionReport", fix44_exec_report());
+    run_built<fix44::MarketDataRequest>(suite, "fix44.MarketDataRequest", fix44_md_request());
+
+    run_raw<fix44::OrderCancelReject>(suite, "fix44.OrderCancelReject", false, [](auto& a) {
+        a.field(tag::OrderID::value, std::string_view{"EXCH000001"})
+            .field(tag::ClOrdID::value, std::string_view{"CXL0000001"})
+            .field(tag::OrigClOrdID::value, std::string_view{"ORD0000001"})
+            .field(tag::OrdStatus::value, '2')
+            .field(434, '1');  // CxlRejResponseTo
+    });
+    run_raw<fix44::MarketDataSnapshotFullRefresh>(suite, "fix44.MarketDataSnapshotFullRefresh",
+        false, [](auto& a) {
+        a.field(tag::MDReqID::value, std::string_view{"MD0001"})
+            .field(tag::Symbol::value, std::string_view{"AAPL"})
+            .field(tag::NoMDEntries::value, int64_t{2})
+            .field(tag::MDEntryType::value, '0')
+            .field(tag::MDEntryPx::value, std::string_view{"150.25"})
+            .field(tag::MDEntrySize::value, int64_t{500})
+            .field(tag::MDEntryType::value, '1')
+            .field(tag::MDEntryPx::value, std::string_view{"150.26"})
+            .field(tag::MDEntrySize::value, int64_t{300});
+    });
+    run_raw<fix44::MarketDataIncrementalRefresh>(suite, "fix44.MarketDataIncrementalRefresh",
+        false, [](auto& a) {
+        a.field(tag::MDReqID::value, std::string_view{"MD0001"})
+            .field(tag::NoMDEntries::value, int64_t{1})
+            .field(tag::MDUpdateAction::value, '0')
+            .field(tag::MDEntryType::value, '0')
+            .field(tag::Symbol::value, std::string_view{"AAPL"})
+            .field(tag::MDEntryPx::value, std::string_view{"150.24"})
+            .field(tag::MDEntrySize::value, int64_t{200});
+    });
+    run_raw<fix44::MarketDataRequestReject>(suite, "fix44.MarketDataRequestReject",
+        false, [](auto& a) {
+        a.field(tag::MDReqID::value, std::string_view{"MD0001"})
+            .field(tag::MDReqRejReason::value, '0');
+    });
+
+    run_roundtrip(suite, "fix44.TestRequest",
+        fix44::TestRequest::Builder{}.test_req_id("TEST0001"), std::nullopt);
+    run_roundtrip(suite, "fix44.NewOrderSingle", fix44_new_order(),
+        std::optional{fix44_new_order()});
+    run_roundtrip(suite, "fix44.OrderCancelRequest", fix44_cancel(),
+        std::optional{fix44_cancel()});
+    run_roundtrip(suite, "fix44.ExecutionReport", fix44_exec_report(),
+        std::optional{fix44_exec_report()});
+    run_roundtrip(suite, "fix44.MarketDataRequest", fix44_md_request(),
+        std::optional{fix44_md_request()});
+}
+
+// ----------------------------------------------------------------------------
+// FIX 5.0 (FIXT 1.1 transport)
+// ----------------------------------------------------------------------------
+
+fix50::NewOrderSingle::Builder fix50_new_order() {
+    fix50::NewOrderSingle::Builder b;
+    b.cl_ord_id("ORD0000001")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time(SENDING_TIME)
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit)
+        .price(FixedPrice::from_string("150.25"))
+        .time_in_force(TimeInForce::Day)
+        .account("ACCT01");
+    return b;
+}
+
+fix50::OrderCancelRequest::Builder fix50_cancel() {
+    fix50::OrderCancelRequest::Builder b;
+    b.orig_cl_ord_id("ORD0000001")
+        .cl_ord_id("CXL0000001")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time(SENDING_TIME)
+        .order_qty(Qty::from_int(100));
+    return b;
+}
+
+fix50::ExecutionReport::Builder fix50_exec_report() {
+    fix50::ExecutionReport::Builder b;
+    b.order_id("EXCH000001")
+        .exec_id("EXEC000001")
+        .exec_type(ExecType::Trade)
+        .ord_status(OrdStatus::PartiallyFilled)
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .leaves_qty(Qty::from_int(60))
+        .cum_qty(Qty::from_int(40))
+        .avg_px(FixedPrice::from_string("150.25"))
+        .cl_ord_id("ORD0000001")
+        .order_qty(Qty::from_int(100))
+        .price(FixedPrice::from_string("150.25"))
+        .last_px(FixedPrice::from_string("150.25"))
+        .last_qty(Qty::from_int(40));
+    return b;
+}
+
+void run_fix50(Suite& suite) {
+    run_built<fix50::NewOrderSingle>(suite, "fix50.NewOrderSingle", fix50_new_order());
+    run_built<fix50::OrderCancelRequest>(suite, "fix50.OrderCancelRequest", fix50_cancel());
+    run_built<fix50::ExecutionReport>(suite, "fix50.ExecutionReport", fix50_exec_report());
+
+    run_raw<fix50::OrderCancelReject>(suite, "fix50.OrderCancelReject", true, [](auto& a) {
+        a.field(tag::OrderID::value, std::string_view{"EXCH000001"})
+            .field(tag::ClOrdID::value, std::string_view{"CXL0000001"})
+            .field(tag::OrigClOrdID::value, std::string_view{"ORD0000001"})
+            .field(tag::OrdStatus::value, '2')
+            .field(434, '1');  // CxlRejResponseTo
+    });
+
+    run_roundtrip(suite, "fix50.NewOrderSingle", fix50_new_order(),
+        std::optional{fix50_new_order()});
+    run_roundtrip(suite, "fix50.OrderCancelRequest", fix50_cancel(),
+        std::optional{fix50_cancel()});
+    run_roundtrip(suite, "fix50.ExecutionReport", fix50_exec_report(),
+        std::optional{fix50_exec_report()});
+}
+
+// ----------------------------------------------------------------------------
+// FIXT 1.1 session layer
+// ----------------------------------------------------------------------------
+
+void run_fixt11(Suite& suite) {
+    run_built<fixt11::Heartbeat>(suite, "fixt11.Heartbeat", fixt11::Heartbeat::Builder{});
+    run_built<fixt11::TestRequest>(suite, "fixt11.TestRequest",
+        fixt11::TestRequest::Builder{}.test_req_id("TEST0001"));
+    run_built<fixt11::ResendRequest>(suite, "fixt11.ResendRequest",
+        fixt11::ResendRequest::Builder{}.begin_seq_no(100).end_seq_no(0));
+    run_built<fixt11::SequenceReset>(suite, "fixt11.SequenceReset",
+        fixt11::SequenceReset::Builder{}.new_seq_no(200).gap_fill_flag(true));
+    run_built<fixt11::Reject>(suite, "fixt11.Reject",
+        fixt11::Reject::Builder{}.ref_seq_num(10).ref_tag_id(44).session_reject_reason(5)
+            .text("Value is incorrect"));
+    run_built<fixt11::Logon>(suite, "fixt11.Logon",
+        fixt11::Logon::Builder{}.encrypt_method(0).heart_bt_int(30)
+            .default_appl_ver_id(appl_ver_id::FIX_5_0_SP2));
+    run_built<fixt11::Logout>(suite, "fixt11.Logout", fixt11::Logout::Builder{}.text("done"));
+
+    run_roundtrip(suite, "fixt11.TestRequest",
+        fixt11::TestRequest::Builder{}.test_req_id("TEST0001"), std::nullopt);
+}
+
+} // namespace nfx::bench
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    using namespace nfx::bench;
+
+    size_t iterations = 100000;
+    bool json_mode = false;
+    std::string filter;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0) {
+            json_mode = true;
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else {
+            iterations = std::stoul(argv[i]);
+        }
+    }
+
+    std::cerr << "Calibrating CPU frequency...\n";
+    const double freq_ghz = get_cpu_freq_ghz();
+    std::cerr << "CPU frequency: " << std::fixed << std::setprecision(3)
+              << freq_ghz << " GHz\n";
+
+    StageRunner runner{iterations, freq_ghz, filter};
+    if (!runner.counters_available()) {
+        std::cerr << "Hardware counters unavailable (perf_event_open), reporting null\n";
+    }
+
+    if (!json_mode) {
+        std::cout << "NexusFIX Stage Latency Benchmark\n";
+        std::cout << "================================\n";
+        std::cout << "Iterations: " << iterations << "\n\n";
+        print_header();
+        runner.on_result = print_result;
+    }
+
+    Suite suite{runner};
+    run_fix44(suite);
+    run_fix50(suite);
+    run_fixt11(suite);
+
+    if (json_mode) {
+        print_json(runner.results());
+    } else {
+        std::cout << "\n" << runner.results().size() << " cases"
+                  << (suite.failures ? ", " + std::to_string(suite.failures) + " failed setup" : "")
+                  << "\n";
+    }
+
+    return suite.failures == 0 ? 0 : 1;
+}
@@ -152,6 +152,36 @@ static LatencyStats bench_build_index_scalar(
     return stats;
 }
 
+/// Stage 1: build_index for a specific SIMD tier (bypasses dispatch)
+static LatencyStats bench_build_index_impl(
+    simd::SimdImpl impl, std::span<const char> data, size_t iterations, double freq_ghz)
+{
+    const auto build = simd::detail::select_build_index_fn(impl);
+    std::vector<uint64_t> cycles;
+    cycles.reserve(iterations);
+
+    warmup_icache([&]() {
+        auto idx = build(data);
+        compiler_barrier();
+        (void)idx;
+    });
+
+    for (size_t i = 0; i < iterations; ++i) {
+        uint64_t elapsed;
+        {
+            ScopedTimer timer(elapsed);
+            auto idx = build(data);
+            compiler_barrier();
+            (void)idx;
+        }
+        cycles.push_back(elapsed);
+    }
+
+    LatencyStats stats;
+    stats.compute(cycles, freq_ghz);
+    return stats;
+}
+
 /// Stage 1: Runtime-dispatched build_index
 static LatencyStats bench_build_index_dispatch(
     std::span<const char> data, size_t iterations, double freq_ghz)
@@ -406,6 +436,44 @@ int main(int argc, char* argv[]) {
     dispatch_name += "] (ExecutionReport)";
     print_stats(dispatch_name.c_str(), dispatch_stats);
 
+    // ========================================================================
+    // Stage 1: Per-implementation (every tier this CPU supports)
+    // ========================================================================
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  Stage 1: build_index by SIMD tier\n";
+    std::cout << "----------------------------------------------------------\n";
+
+    // Wide message: many short fields, where per-bit position extraction
+    // dominates and VPCOMPRESSB pays off most
+    std::string wide_body{EXEC_REPORT_BODY};
+    for (int i = 0; i < 48; ++i) {
+        wide_body += "447=D\x01";
+    }
+    std::string wide_msg = build_fix_message(wide_body);
+    std::span<const char> wide_data{wide_msg.data(), wide_msg.size()};
+
+    const simd::SimdImpl best = simd::detail::detect_best_impl();
+    constexpr simd::SimdImpl tiers[] = {
+        simd::SimdImpl::Scalar, simd::SimdImpl::AVX2,
+        simd::SimdImpl::AVX512, simd::SimdImpl::AVX512_VBMI2,
+    };
+
+    std::cout << "\n  " << std::left << std::setw(20) << "Impl"
+              << std::right << std::setw(16) << "ExecRpt P50"
+              << std::setw(16) << "Wide P50" << "\n";
+    std::cout << "  " << std::string(52, '-') << "\n";
+
+    for (simd::SimdImpl tier : tiers) {
+        if (tier > best) break;
+        auto exec_tier = bench_build_index_impl(tier, exec_data, iterations, freq_ghz);
+        auto wide_tier = bench_build_index_impl(tier, wide_data, iterations, freq_ghz);
+        std::cout << "  " << std::left << std::setw(20) << simd::simd_impl_name(tier)
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(13) << exec_tier.p50_ns << " ns"
+                  << std::setw(13) << wide_tier.p50_ns << " ns\n";
+    }
+
     // ========================================================================
     // Stage 2: Field Extraction
     // ========================================================================
@@ -0,0 +1,435 @@
+// quickfix_multi_session_benchmark.cpp
+// QuickFIX Multi-Session Throughput Benchmark (standalone, C++14 compatible)
+//
+// QuickFIX counterpart of benchmarks/multi_session_bench.cpp: N initiator
+// sessions <-> N acceptor sessions over 127.0.0.1 in one process, message
+// persistence on (MemoryStoreFactory), no logging, no data dictionary.
+// Each initiator keeps --window NewOrderSingles outstanding; the acceptor
+// answers each with an ExecutionReport echoing the ClOrdID and the next
+// order goes out on the reply. Same metrics and table format as the
+// NexusFIX benchmark, so the rows can be pasted into one table.
+//
+// Stacks:
+//   socket    SocketAcceptor / SocketInitiator (one poll thread per side)
+//   threaded  ThreadedSocketAcceptor / ThreadedSocketInitiator (thread per session)
+//
+// Usage:
+//   quickfix_multi_session_benchmark [--sessions 1,10,100,1000] [--count <orders>]
+//                                    [--warmup <orders>] [--window <n>]
+//                                    [--stack socket|threaded] [--port <base>]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+
+// QuickFIX headers
+#include <quickfix/Application.h>
+#include <quickfix/MemoryStore.h>
+#include <quickfix/Session.h>
+#include <quickfix/SessionSettings.h>
+#include <quickfix/SocketAcceptor.h>
+#include <quickfix/SocketInitiator.h>
+#include <quickfix/ThreadedSocketAcceptor.h>
+#include <quickfix/ThreadedSocketInitiator.h>
+#include <quickfix/fix44/ExecutionReport.h>
+#include <quickfix/fix44/NewOrderSingle.h>
+
+namespace bench {
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+struct BenchConfig {
+    std::vector<size_t> sessions{1, 10, 100, 1000};
+    size_t count = 200000;
+    size_t warmup = 20000;
+    size_t window = 8;
+    std::string stack;
+    int port = 15100;
+};
+
+const std::chrono::seconds STALL_TIMEOUT(5);
+
+inline int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double cpu_seconds() {
+    struct rusage usage = {};
+    (void)::getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+void raise_fd_limit() {
+    struct rlimit limit = {};
+    if (::getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        (void)::setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+std::string client_id(size_t i) {
+    return "C" + std::to_string(i);
+}
+
+// ============================================================================
+// Load State (shared by both applications)
+// ============================================================================
+
+/// ClOrdID is the order's global index: send time and RTT slots are
+/// written once per order, so the poll threads need no lock
+struct Load {
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> received{0};
+    std::atomic<int> logged_on{0};
+    size_t base = 0;
+    size_t end = 0;
+    std::vector<int64_t> sent_at;
+    std::vector<int64_t> rtt;
+
+    void send_order(const FIX::SessionID& session) {
+        const size_t id = next.fetch_add(1);
+        if (id >= end) return;
+        FIX44::NewOrderSingle order(
+            FIX::ClOrdID(std::to_string(id)), FIX::Side(FIX::Side_BUY),
+            FIX::TransactTime(), FIX::OrdType(FIX::OrdType_LIMIT));
+        order.set(FIX::Symbol("AAPL"));
+        order.set(FIX::OrderQty(100));
+        order.set(FIX::Price(150.25));
+        order.set(FIX::TimeInForce(FIX::TimeInForce_DAY));
+        sent_at[id - base] = now_ns();
+        FIX::Session::sendToTarget(order, session);
+    }
+};
+
+// ============================================================================
+// Applications
+// ============================================================================
+
+/// Answers each NewOrderSingle with an ExecutionReport
+class AcceptorApp : public FIX::Application {
+public:
+    void onCreate(const FIX::SessionID&) {}
+    void onLogon(const FIX::SessionID&) {}
+    void onLogout(const FIX::SessionID&) {}
+    void toAdmin(FIX::Message&, const FIX::SessionID&) {}
+    void toApp(FIX::Message&, const FIX::SessionID&) throw(FIX::DoNotSend) {}
+    void fromAdmin(const FIX::Message&, const FIX::SessionID&)
+        throw(FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue,
+              FIX::RejectLogon) {}
+
+    void fromApp(const FIX::Message& message, const FIX::SessionID& session)
+        throw(FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue,
+              FIX::UnsupportedMessageType) {
+        FIX::ClOrdID id;
+        message.getField(id);
+        FIX44::ExecutionReport report(
+            FIX::OrderID("ORDER"), FIX::ExecID(id.getValue()),
+            FIX::ExecType(FIX::ExecType_NEW), FIX::OrdStatus(FIX::OrdStatus_NEW),
+            FIX::Side(FIX::Side_BUY), FIX::LeavesQty(100), FIX::CumQty(0), FIX::AvgPx(0));
+        report.set(id);
+        report.set(FIX::Symbol("AAPL"));
+        FIX::Session::sendToTarget(report, session);
+    }
+};
+
+/// Records the round trip and sends the session's next order
+class InitiatorApp : public FIX::Application {
+public:
+    explicit InitiatorApp(Load& load) : load_(load) {}
+
+    void onCreate(const FIX::SessionID&) {}
+    void onLogon(const FIX::SessionID&) { load_.logged_on.fetch_add(1); }
+    void onLogout(const FIX::SessionID&) {}
+    void toAdmin(FIX::Message&, const FIX::SessionID&) {}
+    void toApp(FIX::Message&, const FIX::SessionID&) throw(FIX::DoNotSend) {}
+    void fromAdmin(const FIX::Message&, const FIX::SessionID&)
+        throw(FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue,
+              FIX::RejectLogon) {}
+
+    void fromApp(const FIX::Message& message, const FIX::SessionID& session)
+        throw(FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue,
+              FIX::UnsupportedMessageType) {
+        const int64_t t = now_ns();
+        FIX::ClOrdID id;
+        message.getField(id);
+        const size_t index = std::strtoull(id.getValue().c_str(), nullptr, 10);
+        if (index < load_.base || index >= load_.end) return;
+        load_.rtt[index - load_.base] = t - load_.sent_at[index - load_.base];
+        load_.received.fetch_add(1);
+        load_.send_order(session);
+    }
+
+private:
+    Load& load_;
+};
+
+// ============================================================================
+// Results
+// ============================================================================
+
+struct RunResult {
+    std::string stack;
+    size_t sessions = 0;
+    size_t orders = 0;
+    double seconds = 0;
+    double cpu = 0;
+    double p50 = 0, p99 = 0, p999 = 0, max = 0;
+};
+
+double percentile(const std::vector<int64_t>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    return static_cast<double>(sorted[static_cast<size_t>(p * static_cast<double>(sorted.size() - 1))]);
+}
+
+void print_header() {
+    std::cout << "| Engine | Stack | Sessions | Orders/s | Msgs/s | P50 (us) | P99 (us) "
+                 "| P99.9 (us) | Max (us) | CPU (cores) | CPU s / 1M msgs |\n"
+              << "|--------|-------|----------|----------|--------|----------|----------"
+                 "|------------|----------|-------------|-----------------|\n";
+}
+
+void print_row(const RunResult& r) {
+    const double secs = r.seconds > 0 ? r.seconds : 1.0;
+    const double messages = 2.0 * static_cast<double>(r.orders);
+    std::cout << std::fixed
+              << "| QuickFIX | " << r.stack << " | " << r.sessions << " | "
+              << std::setprecision(0) << static_cast<double>(r.orders) / secs << " | "
+              << messages / secs << " | "
+              << std::setprecision(1) << r.p50 / 1000.0 << " | " << r.p99 / 1000.0 << " | "
+              << r.p999 / 1000.0 << " | " << r.max / 1000.0 << " | "
+              << std::setprecision(2) << r.cpu / secs << " | "
+              << std::setprecision(3) << r.cpu / (messages / 1e6) << " |\n";
+}
+
+// ============================================================================
+// Run
+// ============================================================================
+
+FIX::Dictionary common_settings() {
+    FIX::Dictionary d;
+    d.setString("BeginString", "FIX.4.4");
+    d.setString("StartTime", "00:00:00");
+    d.setString("EndTime", "00:00:00");
+    d.setString("HeartBtInt", "30");
+    d.setString("UseDataDictionary", "N");
+    d.setString("PersistMessages", "Y");
+    d.setString("SocketNodelay", "Y");
+    return d;
+}
+
+void build_settings(size_t n, int port, FIX::SessionSettings& acceptor,
+                    FIX::SessionSettings& initiator) {
+    FIX::Dictionary acceptor_defaults = common_settings();
+    acceptor_defaults.setString("ConnectionType", "acceptor");
+    acceptor_defaults.setInt("SocketAcceptPort", port);
+    acceptor.set(acceptor_defaults);
+
+    FIX::Dictionary initiator_defaults = common_settings();
+    initiator_defaults.setString("ConnectionType", "initiator");
+    initiator_defaults.setString("SocketConnectHost", "127.0.0.1");
+    initiator_defaults.setInt("SocketConnectPort", port);
+    initiator_defaults.setString("ReconnectInterval", "1");
+    initiator.set(initiator_defaults);
+
+    for (size_t i = 0; i < n; ++i) {
+        FIX::Dictionary a = acceptor_defaults;
+        a.setString("SenderCompID", "EXCH");
+        a.setString("TargetCompID", client_id(i));
+        acceptor.set(FIX::SessionID("FIX.4.4", "EXCH", client_id(i)), a);
+
+        FIX::Dictionary c = initiator_defaults;
+        c.setString("SenderCompID", client_id(i));
+        c.setString("TargetCompID", "EXCH");
+        initiator.set(FIX::SessionID("FIX.4.4", client_id(i), "EXCH"), c);
+    }
+}
+
+/// Send `count` orders, --window per session, until every one is answered
+bool phase(Load& load, const std::vector<FIX::SessionID>& sessions, size_t count, size_t window) {
+    load.base = load.next.load();
+    load.end = load.base + count;
+    load.received.store(0);
+    load.sent_at.assign(count, 0);
+    load.rtt.assign(count, 0);
+
+    for (size_t w = 0; w < window; ++w) {
+        for (size_t i = 0; i < sessions.size() && load.next.load() < load.end; ++i) {
+            load.send_order(sessions[i]);
+        }
+    }
+
+    int64_t last_progress = now_ns();
+    size_t seen = 0;
+    while (load.received.load() < count) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        const size_t got = load.received.load();
+        if (got != seen) {
+            seen = got;
+            last_progress = now_ns();
+        } else if (now_ns() - last_progress >
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(STALL_TIMEOUT).count()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Acceptor, typename Initiator>
+bool run(const std::string& stack, size_t n, int port, const BenchConfig& config,
+         RunResult& result) {
+    FIX::SessionSettings acceptor_settings;
+    FIX::SessionSettings initiator_settings;
+    build_settings(n, port, acceptor_settings, initiator_settings);
+
+    Load load;
+    AcceptorApp acceptor_app;
+    InitiatorApp initiator_app(load);
+    FIX::MemoryStoreFactory acceptor_store;
+    FIX::MemoryStoreFactory initiator_store;
+    Acceptor acceptor(acceptor_app, acceptor_store, acceptor_settings);
+    Initiator initiator(initiator_app, initiator_store, initiator_settings);
+
+    std::vector<FIX::SessionID> sessions;
+    for (size_t i = 0; i < n; ++i) {
+        sessions.push_back(FIX::SessionID("FIX.4.4", client_id(i), "EXCH"));
+    }
+
+    bool ok = false;
+    try {
+        acceptor.start();
+        initiator.start();
+
+        const int64_t deadline = now_ns() +
+            std::chrono::duration_cast<std::chrono::nanoseconds>(STALL_TIMEOUT).count() *
+            static_cast<int64_t>(1 + n / 100);
+        while (load.logged_on.load() < static_cast<int>(n) && now_ns() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (load.logged_on.load() < static_cast<int>(n)) {
+            std::cerr << "[ERROR] " << stack << "/" << n << ": logon timed out\n";
+        } else if (!phase(load, sessions, config.warmup, config.window)) {
+            std::cerr << "[ERROR] " << stack << "/" << n << ": warmup stalled\n";
+        } else {
+            const double cpu0 = cpu_seconds();
+            const int64_t t0 = now_ns();
+            if (!phase(load, sessions, config.count, config.window)) {
+                std::cerr << "[ERROR] " << stack << "/" << n << ": measured phase stalled\n";
+            } else {
+                result.seconds = static_cast<double>(now_ns() - t0) / 1e9;
+                result.cpu = cpu_seconds() - cpu0;
+                ok = true;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[ERROR] " << stack << "/" << n << ": " << e.what() << "\n";
+    }
+
+    initiator.stop();
+    acceptor.stop();
+    if (!ok) return false;
+
+    std::vector<int64_t> rtt = load.rtt;
+    std::sort(rtt.begin(), rtt.end());
+    result.stack = stack;
+    result.sessions = n;
+    result.orders = config.count;
+    result.p50 = percentile(rtt, 0.50);
+    result.p99 = percentile(rtt, 0.99);
+    result.p999 = percentile(rtt, 0.999);
+    result.max = rtt.empty() ? 0.0 : static_cast<double>(rtt.back());
+    return true;
+}
+
+std::vector<size_t> parse_list(const std::string& text) {
+    std::vector<size_t> out;
+    std::stringstream in(text);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        const size_t value = std::strtoull(item.c_str(), nullptr, 10);
+        if (value > 0) out.push_back(value);
+    }
+    return out;
+}
+
+} // namespace bench
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    using namespace bench;
+
+    BenchConfig config;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : "0";
+        if (arg == "--sessions") {
+            config.sessions = parse_list(value);
+        } else if (arg == "--count") {
+            config.count = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--warmup") {
+            config.warmup = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--window") {
+            config.window = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--stack") {
+            config.stack = value;
+        } else if (arg == "--port") {
+            config.port = std::atoi(value);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--sessions 1,10,100,1000] [--count <orders>] [--warmup <orders>]"
+                         " [--window <n>] [--stack socket|threaded] [--port <base>]\n";
+            return 2;
+        }
+        ++i;
+    }
+    if (config.count == 0 || config.window == 0 || config.sessions.empty()) {
+        std::cerr << "[ERROR] nothing to run\n";
+        return 2;
+    }
+    raise_fd_limit();
+
+    std::cout << "QuickFIX multi-session throughput: " << config.count << " orders (+"
+              << config.warmup << " warmup), window " << config.window
+              << " per session, MemoryStore\n\n";
+    print_header();
+
+    size_t failures = 0;
+    int port = config.port;  // Fresh port per run: no TIME_WAIT collisions
+    for (size_t k = 0; k < config.sessions.size(); ++k) {
+        const size_t n = config.sessions[k];
+        RunResult result;
+        if (config.stack.empty() || config.stack == "socket") {
+            if (run<FIX::SocketAcceptor, FIX::SocketInitiator>("socket", n, port++, config, result)) {
+                print_row(result);
+            } else {
+                ++failures;
+            }
+        }
+        if (config.stack.empty() || config.stack == "threaded") {
+            if (run<FIX::ThreadedSocketAcceptor, FIX::ThreadedSocketInitiator>(
+                    "threaded", n, port++, config, result)) {
+                print_row(result);
+            } else {
+                ++failures;
+            }
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
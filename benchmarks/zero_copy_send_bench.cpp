@@ -0,0 +1,251 @@
+// Benchmark: io_uring Zero-copy Send (SEND_ZC) Performance
+// Compares regular send vs fixed buffer send vs SEND_ZC from registered buffers
+// over a loopback TCP connection
+//
+// Build: cmake --build build && ./build/bin/benchmarks/zero_copy_send_bench
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <atomic>
+
+#include "nexusfix/transport/io_uring_transport.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+
+#if !NFX_IO_URING_AVAILABLE
+
+int main() {
+    std::cout << "io_uring not available on this system.\n";
+    return 0;
+}
+
+#else
+
+// Benchmark configuration
+constexpr int BENCHMARK_ITERATIONS = 10000;
+constexpr int WARMUP_ITERATIONS = 500;
+constexpr size_t BUFFER_SIZE = 65536;
+constexpr size_t NUM_BUFFERS = 64;
+constexpr size_t PAYLOAD_SIZES[] = {512, 4096, 16384, 65536};
+
+// RDTSC for precise timing
+inline uint64_t rdtsc() {
+    uint64_t lo, hi;
+    asm volatile("rdtscp" : "=a"(lo), "=d"(hi) :: "rcx");
+    return (hi << 32) | lo;
+}
+
+// Get CPU frequency
+double get_cpu_freq_ghz() {
+    auto start = std::chrono::steady_clock::now();
+    uint64_t start_tsc = rdtsc();
+
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(100)) {
+        asm volatile("pause");
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    uint64_t end_tsc = rdtsc();
+
+    double elapsed_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    return static_cast<double>(end_tsc - start_tsc) / elapsed_ns;
+}
+
+/// Loopback listener that accepts one connection and discards everything
+class DrainServer {
+public:
+    bool start() {
+        listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (listen_fd_ < 0) return false;
+
+        int one = 1;
+        ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) return false;
+        if (::listen(listen_fd_, 1) < 0) return false;
+
+        socklen_t len = sizeof(addr);
+        ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&addr), &len);
+        port_ = ntohs(addr.sin_port);
+
+        thread_ = std::thread([this] {
+            int fd = ::accept(listen_fd_, nullptr, nullptr);
+            if (fd < 0) return;
+            std::vector<char> buf(1 << 20);
+            while (::recv(fd, buf.data(), buf.size(), 0) > 0) {}
+            ::close(fd);
+        });
+        return true;
+    }
+
+    void stop() {
+        if (thread_.joinable()) thread_.join();
+        if (listen_fd_ >= 0) ::close(listen_fd_);
+        listen_fd_ = -1;
+    }
+
+    [[nodiscard]] uint16_t port() const noexcept { return port_; }
+
+private:
+    int listen_fd_{-1};
+    uint16_t port_{0};
+    std::thread thread_;
+};
+
+struct SendStats {
+    double median_ns{0};
+    double p99_ns{0};
+    double gbps{0};
+    bool zero_copy{false};
+    bool ok{false};
+};
+
+SendStats run_send(const nfx::IoUringTransportConfig& config, size_t payload_size,
+                   double cpu_freq_ghz)
+{
+    using namespace nfx;
+
+    SendStats stats;
+    DrainServer server;
+    if (!server.start()) return stats;
+
+    IoUringContext ctx;
+    if (!ctx.init().has_value()) {
+        server.stop();
+        return stats;
+    }
+
+    {
+        IoUringTransport transport{ctx, config};
+        if (!transport.connect("127.0.0.1", server.port()).has_value()) {
+            server.stop();
+            return stats;
+        }
+
+        std::vector<char> payload(payload_size, 'X');
+        std::vector<uint64_t> latencies;
+        latencies.reserve(BENCHMARK_ITERATIONS);
+
+        for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+            (void)transport.send(payload);
+        }
+
+        auto wall_start = std::chrono::steady_clock::now();
+        for (int i = 0; i < BENCHMARK_ITERATIONS; ++i) {
+            uint64_t start = rdtsc();
+            auto sent = transport.send(payload);
+            uint64_t end = rdtsc();
+            if (!sent.has_value()) break;
+            latencies.push_back(end - start);
+        }
+        auto wall_end = std::chrono::steady_clock::now();
+
+        stats.zero_copy = transport.uses_zero_copy_send();
+        transport.poll();  // Reap outstanding notifications
+        transport.disconnect();
+
+        if (!latencies.empty()) {
+            std::sort(latencies.begin(), latencies.end());
+            stats.median_ns = static_cast<double>(latencies[latencies.size() / 2]) / cpu_freq_ghz;
+            stats.p99_ns = static_cast<double>(latencies[latencies.size() * 99 / 100]) / cpu_freq_ghz;
+            double elapsed_ns = std::chrono::duration<double, std::nano>(wall_end - wall_start).count();
+            stats.gbps = static_cast<double>(payload_size * latencies.size()) / elapsed_ns;
+            stats.ok = true;
+        }
+    }
+
+    server.stop();
+    return stats;
+}
+
+int main() {
+    using namespace nfx;
+
+    std::cout << "==========================================================\n";
+    std::cout << "  io_uring Zero-copy Send Benchmark\n";
+    std::cout << "==========================================================\n\n";
+
+    // Pin to core for consistent results
+    (void)util::CpuAffinity::pin_to_core(2);
+
+    std::cout << "Calibrating CPU frequency...\n";
+    double cpu_freq_ghz = get_cpu_freq_ghz();
+    std::cout << "  CPU frequency: " << std::fixed << std::setprecision(3)
+              << cpu_freq_ghz << " GHz\n";
+
+    std::cout << "\nConfiguration:\n";
+    std::cout << "  Benchmark:    " << BENCHMARK_ITERATIONS << " sends per run\n";
+    std::cout << "  Buffers:      " << NUM_BUFFERS << " x " << BUFFER_SIZE << " bytes\n";
+    std::cout << "  Transport:    loopback TCP, receiver drains on another thread\n";
+
+    IoUringTransportConfig regular;
+    regular.use_registered_buffers = false;
+    regular.use_multishot_recv = false;
+
+    IoUringTransportConfig fixed = regular;
+    fixed.use_registered_buffers = true;
+    fixed.num_registered_buffers = NUM_BUFFERS;
+    fixed.registered_buffer_size = BUFFER_SIZE;
+
+    IoUringTransportConfig zero_copy = fixed;
+    zero_copy.use_zero_copy_send = true;
+    zero_copy.zero_copy_min_bytes = 0;
+
+    struct Variant {
+        const char* name;
+        const IoUringTransportConfig* config;
+    };
+    const Variant variants[] = {
+        {"send", &regular},
+        {"write_fixed", &fixed},
+        {"send_zc_fixed", &zero_copy},
+    };
+
+    std::cout << "\n----------------------------------------------------------\n";
+    std::cout << "  Send Latency / Throughput by Payload Size\n";
+    std::cout << "----------------------------------------------------------\n";
+
+    for (size_t payload_size : PAYLOAD_SIZES) {
+        std::cout << "\nPayload " << payload_size << " bytes:\n";
+        for (const auto& v : variants) {
+            SendStats s = run_send(*v.config, payload_size, cpu_freq_ghz);
+            std::cout << "  " << std::left << std::setw(15) << v.name << std::right;
+            if (!s.ok) {
+                std::cout << "  failed\n";
+                continue;
+            }
+            std::cout << std::setprecision(1)
+                      << "  median " << std::setw(9) << s.median_ns << " ns"
+                      << "  p99 " << std::setw(9) << s.p99_ns << " ns"
+                      << std::setprecision(2)
+                      << "  " << std::setw(6) << s.gbps << " GB/s";
+            if (v.config->use_zero_copy_send && !s.zero_copy) {
+                std::cout << "  (SEND_ZC unsupported, copied)";
+            }
+            std::cout << "\n";
+        }
+    }
+
+    std::cout << "\nNotes:\n";
+    std::cout << "  - SEND_ZC pins the registered pages instead of copying into\n";
+    std::cout << "    socket buffers; each send posts a result CQE and a\n";
+    std::cout << "    notification CQE that returns the buffer to the pool\n";
+    std::cout << "  - Loopback delivery still copies on the receive side, so\n";
+    std::cout << "    NIC-backed sockets show a larger gap for big payloads\n";
+    std::cout << "  - Small payloads favour the copying path (see\n";
+    std::cout << "    IoUringTransportConfig::zero_copy_min_bytes)\n";
+
+    std::cout << "\n==========================================================\n";
+
+    return 0;
+}
+
+#endif // NFX_IO_URING_AVAILABLE
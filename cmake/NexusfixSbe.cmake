@@ -0,0 +1,71 @@
+# NexusfixSbe.cmake - Generate SBE flyweight codecs from an XML schema
+#
+#   nfx_sbe_generate(<target>
+#       SCHEMA <schema.xml>
+#       NAMESPACE <c++::namespace>
+#       [OUTPUT_DIR <dir>]            # default: ${CMAKE_CURRENT_BINARY_DIR}/sbe_generated
+#       [HEADER_PREFIX <path>]        # default: namespace as a path (venue::sbe -> venue/sbe)
+#       [MAX_GROUP_ENTRIES <n>])      # entries per group assumed by TOTAL_SIZE (default 32)
+#
+# Runs scripts/sbe_codegen.py at build time whenever the schema or the
+# generator changes, and adds OUTPUT_DIR to <target>'s include path so
+# sources can `#include "<HEADER_PREFIX>/schema.hpp"`. The generated
+# headers depend only on the nexusfix target.
+
+include_guard(GLOBAL)
+
+find_package(Python3 COMPONENTS Interpreter)
+
+set(NFX_SBE_CODEGEN_SCRIPT "${CMAKE_CURRENT_LIST_DIR}/../scripts/sbe_codegen.py"
+    CACHE FILEPATH "NexusFIX SBE code generator")
+
+function(nfx_sbe_generate target)
+    cmake_parse_arguments(PARSE_ARGV 1 ARG ""
+        "SCHEMA;NAMESPACE;OUTPUT_DIR;HEADER_PREFIX;MAX_GROUP_ENTRIES" "")
+
+    if(NOT Python3_Interpreter_FOUND)
+        message(FATAL_ERROR "nfx_sbe_generate: Python 3 interpreter not found")
+    endif()
+    if(NOT ARG_SCHEMA OR NOT ARG_NAMESPACE)
+        message(FATAL_ERROR "nfx_sbe_generate: SCHEMA and NAMESPACE are required")
+    endif()
+
+    get_filename_component(schema "${ARG_SCHEMA}" ABSOLUTE)
+    if(NOT ARG_OUTPUT_DIR)
+        set(ARG_OUTPUT_DIR "${CMAKE_CURRENT_BINARY_DIR}/sbe_generated")
+    endif()
+    if(NOT ARG_MAX_GROUP_ENTRIES)
+        set(ARG_MAX_GROUP_ENTRIES 32)
+    endif()
+
+    set(args --schema "${schema}" --namespace "${ARG_NAMESPACE}"
+        --output-dir "${ARG_OUTPUT_DIR}" --max-group-entries "${ARG_MAX_GROUP_ENTRIES}")
+    if(ARG_HEADER_PREFIX)
+        list(APPEND args --header-prefix "${ARG_HEADER_PREFIX}")
+    endif()
+
+    # The output list depends on the messages in the schema: ask the
+    # generator, and re-configure when the schema changes
+    execute_process(
+        COMMAND ${Python3_EXECUTABLE} "${NFX_SBE_CODEGEN_SCRIPT}" ${args} --list-outputs
+        OUTPUT_VARIABLE outputs
+        ERROR_VARIABLE error
+        RESULT_VARIABLE result
+        OUTPUT_STRIP_TRAILING_WHITESPACE
+    )
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "nfx_sbe_generate(${target}): ${error}")
+    endif()
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${schema}")
+
+    add_custom_command(
+        OUTPUT ${outputs}
+        COMMAND ${Python3_EXECUTABLE} "${NFX_SBE_CODEGEN_SCRIPT}" ${args}
+        DEPENDS "${schema}" "${NFX_SBE_CODEGEN_SCRIPT}"
+        COMMENT "Generating SBE codecs from ${ARG_SCHEMA}"
+        VERBATIM
+    )
+    add_custom_target(${target}_sbe_codegen DEPENDS ${outputs})
+    add_dependencies(${target} ${target}_sbe_codegen)
+    target_include_directories(${target} PRIVATE "${ARG_OUTPUT_DIR}")
+endfunction()
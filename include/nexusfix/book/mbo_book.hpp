@@ -0,0 +1,468 @@
+#pragma once
+
+/// @file mbo_book.hpp
+/// @brief Market-by-order (L3) book with an incrementally aggregated L2 view
+///
+/// Order-level feeds send add / modify / delete per order ID. MboBook keeps
+/// every resting order in a pooled node, linked into a per-level FIFO (time
+/// priority), and finds it again through an order-id hash map. Each price
+/// level carries its aggregated size and order count, updated on every
+/// change, so the L2 view is never rebuilt:
+///
+/// - add / modify / delete / execute: O(1) in the number of resting orders
+/// - a new or emptied level is placed in a per-side array sorted with the
+///   best level last; the move is proportional to its distance from the
+///   top, which is short for the levels that actually change
+///
+/// Nodes come from memory::ObjectPool, so the hot path does not allocate.
+/// The hash maps are absl::flat_hash_map when built with NFX_ENABLE_ABSEIL
+/// and std::unordered_map otherwise; both are sized for MaxOrders up front.
+/// Like OrderBook, the top is published through a Seqlock for readers on
+/// other threads; everything else belongs to the writer thread.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#if defined(NFX_HAS_ABSEIL) && NFX_HAS_ABSEIL
+    #include <absl/container/flat_hash_map.h>
+#else
+    #include <unordered_map>
+#endif
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+#include "nexusfix/memory/object_pool.hpp"
+#include "nexusfix/memory/seqlock.hpp"
+#include "nexusfix/book/order_book.hpp"
+#include "nexusfix/util/string_hash.hpp"
+
+namespace nfx::book {
+
+namespace detail {
+
+#if defined(NFX_HAS_ABSEIL) && NFX_HAS_ABSEIL
+template<typename K, typename V>
+using BookHashMap = absl::flat_hash_map<K, V>;
+#else
+template<typename K, typename V>
+using BookHashMap = std::unordered_map<K, V>;
+#endif
+
+} // namespace detail
+
+// ============================================================================
+// MBO Nodes
+// ============================================================================
+
+struct MboLevel;
+
+/// One resting order, linked into its level's FIFO
+struct MboOrder {
+    uint64_t order_id{0};
+    int64_t price_raw{0};
+    int64_t qty_raw{0};
+    MboOrder* prev{nullptr};     // Toward the front of the queue
+    MboOrder* next{nullptr};     // Toward the back of the queue
+    MboLevel* level{nullptr};
+};
+
+/// One price level: aggregated L2 values plus its order queue
+struct MboLevel {
+    int64_t price_raw{0};
+    int64_t size_raw{0};         // Sum of qty_raw over the queue
+    int32_t orders{0};
+    bool is_bid{false};
+    MboOrder* head{nullptr};     // First in time priority
+    MboOrder* tail{nullptr};
+
+    [[nodiscard]] PriceLevel aggregate() const noexcept {
+        return PriceLevel{price_raw, size_raw, orders};
+    }
+};
+
+// ============================================================================
+// MBO Book
+// ============================================================================
+
+/// Per-symbol market-by-order book
+/// Writer methods must be called from one thread; top()/try_top()/version()
+/// are safe from any thread. Large (node pools sized for MaxOrders /
+/// MaxLevels are allocated at construction): keep one per symbol, not per
+/// message.
+/// @tparam MaxOrders Resting orders held at once
+/// @tparam MaxLevels Price levels held at once, both sides together
+template<size_t MaxOrders = 1 << 20, size_t MaxLevels = 1 << 14>
+class MboBook {
+public:
+    static constexpr size_t MAX_SYMBOL_LEN = OrderBook<>::MAX_SYMBOL_LEN;
+
+    MboBook()
+        : orders_{std::make_unique<OrderPool>()}
+        , levels_{std::make_unique<LevelPool>()}
+    {
+        ids_.reserve(MaxOrders);
+        for (SideBook* side : {&bids_, &asks_}) {
+            side->by_price.reserve(MaxLevels);
+            side->sorted.reserve(MaxLevels);
+        }
+    }
+
+    explicit MboBook(std::string_view symbol) : MboBook() {
+        set_symbol(symbol);
+    }
+
+    MboBook(const MboBook&) = delete;
+    MboBook& operator=(const MboBook&) = delete;
+
+    // ========================================================================
+    // Writer API
+    // ========================================================================
+
+    void set_symbol(std::string_view symbol) noexcept {
+        symbol_len_ = symbol.size() < MAX_SYMBOL_LEN ? symbol.size() : MAX_SYMBOL_LEN;
+        std::memcpy(symbol_.data(), symbol.data(), symbol_len_);
+    }
+
+    /// Add an order at the back of its price level
+    /// @return false for a known order id, a non-positive qty, a type other
+    ///         than Bid/Offer, or exhausted pools
+    NFX_HOT
+    bool add(uint64_t order_id, MDEntryType type, int64_t price_raw, int64_t qty_raw) noexcept {
+        if (qty_raw <= 0 || (type != MDEntryType::Bid && type != MDEntryType::Offer)) [[unlikely]] {
+            return false;
+        }
+        auto [it, inserted] = ids_.try_emplace(order_id, nullptr);
+        if (!inserted) [[unlikely]] return false;
+
+        MboOrder* order = orders_->allocate();
+        if (!order) [[unlikely]] {
+            ids_.erase(it);
+            return false;
+        }
+        order->order_id = order_id;
+        order->qty_raw = qty_raw;
+        if (!enqueue(*order, type == MDEntryType::Bid, price_raw)) [[unlikely]] {
+            orders_->deallocate(order);
+            ids_.erase(it);
+            return false;
+        }
+        it->second = order;
+        return true;
+    }
+
+    /// Change an order's price and/or quantity. A smaller quantity at the
+    /// same price keeps queue position; a new price or a larger quantity
+    /// goes to the back of the (new) level. qty 0 deletes the order.
+    /// @return false for an unknown order id
+    NFX_HOT
+    bool modify(uint64_t order_id, int64_t price_raw, int64_t qty_raw) noexcept {
+        auto it = ids_.find(order_id);
+        if (it == ids_.end()) [[unlikely]] return false;
+        MboOrder& order = *it->second;
+
+        if (qty_raw <= 0) {
+            erase(it);
+            return true;
+        }
+        if (price_raw == order.price_raw && qty_raw <= order.qty_raw) {
+            order.level->size_raw += qty_raw - order.qty_raw;
+            order.qty_raw = qty_raw;
+            return true;
+        }
+
+        const bool is_bid = order.level->is_bid;
+        dequeue(order);
+        order.qty_raw = qty_raw;
+        if (!enqueue(order, is_bid, price_raw)) [[unlikely]] {
+            orders_->deallocate(&order);
+            ids_.erase(it);
+            return false;
+        }
+        return true;
+    }
+
+    /// Remove an order
+    /// @return false for an unknown order id
+    NFX_HOT
+    bool remove(uint64_t order_id) noexcept {
+        auto it = ids_.find(order_id);
+        if (it == ids_.end()) [[unlikely]] return false;
+        erase(it);
+        return true;
+    }
+
+    /// Fill `qty_raw` of an order at its price (recorded as the last trade);
+    /// the order leaves the book once fully filled
+    /// @return false for an unknown order id
+    NFX_HOT
+    bool execute(uint64_t order_id, int64_t qty_raw) noexcept {
+        auto it = ids_.find(order_id);
+        if (it == ids_.end()) [[unlikely]] return false;
+        MboOrder& order = *it->second;
+
+        last_price_raw_ = order.price_raw;
+        last_size_raw_ = qty_raw;
+        if (qty_raw >= order.qty_raw) {
+            erase(it);
+        } else {
+            order.qty_raw -= qty_raw;
+            order.level->size_raw -= qty_raw;
+        }
+        return true;
+    }
+
+    /// Apply one decoded MarketData entry whose MDEntryID (278) is the order
+    /// id: New adds, Change modifies, Delete removes; Trade entries only set
+    /// the last trade. Numeric ids are used as is, others are hashed.
+    /// @return false if the entry referenced an unknown or duplicate order
+    NFX_HOT
+    bool apply(const BookUpdate& u) noexcept {
+        if (u.type == MDEntryType::Trade) {
+            last_price_raw_ = u.price_raw;
+            last_size_raw_ = u.size_raw;
+            return true;
+        }
+        const uint64_t id = order_id_of(u.entry_id);
+        switch (u.action) {
+            case MDUpdateAction::New:
+                return add(id, u.type, u.price_raw, u.size_raw);
+            case MDUpdateAction::Change:
+                return modify(id, u.price_raw, u.size_raw);
+            case MDUpdateAction::Delete:
+                return remove(id);
+            default:
+                return false;   // DeleteThru/DeleteFrom are price-level actions
+        }
+    }
+
+    /// Apply the entries of a 35=X for this book's symbol (entries without
+    /// Symbol belong to the previous entry's symbol), then publish
+    /// @return number of entries applied
+    size_t apply(const fix44::MarketDataIncrementalRefresh& msg) noexcept {
+        auto iter = msg.entries();
+        bool mine = true;
+        size_t applied = 0;
+        while (iter.has_next()) [[likely]] {
+            const BookUpdate u = decode_book_update(iter.next_entry());
+            if (!u.symbol.empty()) mine = u.symbol == symbol();
+            if (mine && apply(u)) ++applied;
+        }
+        publish(msg.msg_seq_num());
+        return applied;
+    }
+
+    /// Drop every order and level
+    void clear() noexcept {
+        ids_.clear();
+        for (SideBook* side : {&bids_, &asks_}) {
+            side->by_price.clear();
+            side->sorted.clear();
+        }
+        orders_->reset();
+        levels_->reset();
+    }
+
+    /// Publish the current top to readers; skipped when the quote is unchanged
+    /// @return true if a new version was published
+    bool publish(uint32_t msg_seq_num) noexcept {
+        TopOfBook top;
+        if (const MboLevel* bid = best(bids_)) {
+            top.bid_price_raw = bid->price_raw;
+            top.bid_size_raw = bid->size_raw;
+        }
+        if (const MboLevel* ask = best(asks_)) {
+            top.ask_price_raw = ask->price_raw;
+            top.ask_size_raw = ask->size_raw;
+        }
+        top.last_price_raw = last_price_raw_;
+        top.last_size_raw = last_size_raw_;
+        top.msg_seq_num = msg_seq_num;
+
+        if (published_once_ && top.same_quote(published_)) return false;
+        published_ = top;
+        published_once_ = true;
+        top_.write(top);
+        return true;
+    }
+
+    // ========================================================================
+    // Writer-thread Views
+    // ========================================================================
+
+    /// Resting order by id, nullptr if unknown
+    [[nodiscard]] const MboOrder* find(uint64_t order_id) const noexcept {
+        auto it = ids_.find(order_id);
+        return it == ids_.end() ? nullptr : it->second;
+    }
+
+    /// Levels on one side
+    [[nodiscard]] size_t depth(MDEntryType type) const noexcept {
+        return side_of(type).sorted.size();
+    }
+
+    /// The n-th best level on one side (0 = best), nullptr past the depth
+    [[nodiscard]] const MboLevel* level(MDEntryType type, size_t n) const noexcept {
+        const auto& sorted = side_of(type).sorted;
+        return n < sorted.size() ? sorted[sorted.size() - 1 - n] : nullptr;
+    }
+
+    /// Level at an exact price, nullptr if none
+    [[nodiscard]] const MboLevel* level_at(MDEntryType type, int64_t price_raw) const noexcept {
+        const auto& by_price = side_of(type).by_price;
+        auto it = by_price.find(price_raw);
+        return it == by_price.end() ? nullptr : it->second;
+    }
+
+    /// Copy the best out.size() aggregated levels of one side, best first
+    /// @return Levels copied
+    size_t copy_levels(MDEntryType type, std::span<PriceLevel> out) const noexcept {
+        const auto& sorted = side_of(type).sorted;
+        const size_t n = std::min(out.size(), sorted.size());
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = sorted[sorted.size() - 1 - i]->aggregate();
+        }
+        return n;
+    }
+
+    [[nodiscard]] size_t order_count() const noexcept { return ids_.size(); }
+
+    [[nodiscard]] static constexpr size_t order_capacity() noexcept { return MaxOrders; }
+    [[nodiscard]] static constexpr size_t level_capacity() noexcept { return MaxLevels; }
+
+    [[nodiscard]] std::string_view symbol() const noexcept {
+        return {symbol_.data(), symbol_len_};
+    }
+
+    // ========================================================================
+    // Reader API (any thread)
+    // ========================================================================
+
+    /// Latest published top (retries while a publish is in progress)
+    [[nodiscard]] TopOfBook top() const noexcept { return top_.read(); }
+
+    /// Single attempt; false if a publish was in progress
+    [[nodiscard]] bool try_top(TopOfBook& out) const noexcept { return top_.try_read(out); }
+
+    /// Number of publishes so far; compare to detect a new top
+    [[nodiscard]] uint64_t version() const noexcept { return top_.sequence() / 2; }
+
+    /// Order id for an MDEntryID: its value when all digits, else a hash
+    [[nodiscard]] static uint64_t order_id_of(std::string_view entry_id) noexcept {
+        if (entry_id.empty() || entry_id.size() > 19) return util::fnv1a_hash64_runtime(entry_id);
+        uint64_t id = 0;
+        for (char c : entry_id) {
+            if (c < '0' || c > '9') return util::fnv1a_hash64_runtime(entry_id);
+            id = id * 10 + static_cast<uint64_t>(c - '0');
+        }
+        return id;
+    }
+
+private:
+    using OrderPool = memory::ObjectPool<MboOrder, MaxOrders>;
+    using LevelPool = memory::ObjectPool<MboLevel, MaxLevels>;
+    using IdMap = detail::BookHashMap<uint64_t, MboOrder*>;
+
+    struct SideBook {
+        detail::BookHashMap<int64_t, MboLevel*> by_price;
+        std::vector<MboLevel*> sorted;      // Worst first, best last
+    };
+
+    [[nodiscard]] SideBook& book_side(bool is_bid) noexcept { return is_bid ? bids_ : asks_; }
+    [[nodiscard]] const SideBook& side_of(MDEntryType type) const noexcept {
+        return type == MDEntryType::Bid ? bids_ : asks_;
+    }
+
+    [[nodiscard]] static const MboLevel* best(const SideBook& side) noexcept {
+        return side.sorted.empty() ? nullptr : side.sorted.back();
+    }
+
+    /// Sort key: ascending rank = worse to better
+    [[nodiscard]] static constexpr int64_t rank(bool is_bid, int64_t price_raw) noexcept {
+        return is_bid ? price_raw : -price_raw;
+    }
+
+    /// Where the level at price_raw is (or would go) in side.sorted
+    [[nodiscard]] static auto sorted_position(SideBook& side, bool is_bid, int64_t price_raw) noexcept {
+        const int64_t key = rank(is_bid, price_raw);
+        return std::lower_bound(side.sorted.begin(), side.sorted.end(), key,
+            [is_bid](const MboLevel* l, int64_t k) { return rank(is_bid, l->price_raw) < k; });
+    }
+
+    /// Append `order` (qty set) to the level at price_raw, creating the level
+    /// @return false if a new level was needed and the level pool is empty
+    NFX_FORCE_INLINE bool enqueue(MboOrder& order, bool is_bid, int64_t price_raw) noexcept {
+        SideBook& side = book_side(is_bid);
+        auto [it, inserted] = side.by_price.try_emplace(price_raw, nullptr);
+        if (inserted) [[unlikely]] {
+            MboLevel* created = levels_->allocate();
+            if (!created) {
+                side.by_price.erase(it);
+                return false;
+            }
+            created->price_raw = price_raw;
+            created->is_bid = is_bid;
+            side.sorted.insert(sorted_position(side, is_bid, price_raw), created);
+            it->second = created;
+        }
+
+        MboLevel& lvl = *it->second;
+        order.price_raw = price_raw;
+        order.level = &lvl;
+        order.next = nullptr;
+        order.prev = lvl.tail;
+        if (lvl.tail) lvl.tail->next = &order; else lvl.head = &order;
+        lvl.tail = &order;
+        lvl.size_raw += order.qty_raw;
+        ++lvl.orders;
+        return true;
+    }
+
+    /// Unlink `order` from its level, dropping the level once empty
+    NFX_FORCE_INLINE void dequeue(MboOrder& order) noexcept {
+        MboLevel& lvl = *order.level;
+        if (order.prev) order.prev->next = order.next; else lvl.head = order.next;
+        if (order.next) order.next->prev = order.prev; else lvl.tail = order.prev;
+        order.prev = order.next = nullptr;
+        order.level = nullptr;
+        lvl.size_raw -= order.qty_raw;
+        if (--lvl.orders == 0) drop_level(lvl);
+    }
+
+    void drop_level(MboLevel& lvl) noexcept {
+        SideBook& side = book_side(lvl.is_bid);
+        side.by_price.erase(lvl.price_raw);
+        side.sorted.erase(sorted_position(side, lvl.is_bid, lvl.price_raw));
+        levels_->deallocate(&lvl);
+    }
+
+    void erase(typename IdMap::iterator it) noexcept {
+        MboOrder* order = it->second;
+        dequeue(*order);
+        orders_->deallocate(order);
+        ids_.erase(it);
+    }
+
+    std::unique_ptr<OrderPool> orders_;
+    std::unique_ptr<LevelPool> levels_;
+    IdMap ids_;
+    SideBook bids_;
+    SideBook asks_;
+    int64_t last_price_raw_{0};
+    int64_t last_size_raw_{0};
+    TopOfBook published_{};
+    bool published_once_{false};
+    std::array<char, MAX_SYMBOL_LEN + 1> symbol_{};
+    size_t symbol_len_{0};
+
+    memory::Seqlock<TopOfBook> top_;
+};
+
+} // namespace nfx::book
@@ -0,0 +1,438 @@
+#pragma once
+
+/// @file order_book.hpp
+/// @brief Price-level order books fed straight from MarketData messages
+///
+/// One writer thread (the market data session) applies 35=W / 35=X to
+/// per-symbol books held in flat, sorted arrays. After each message the top
+/// of every touched book is published through a Seqlock, so any number of
+/// strategy threads can read best bid/offer wait-free while the writer keeps
+/// going. Entries are decoded in a single pass over their fields; no MDEntry
+/// objects are materialized.
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+#include "nexusfix/parser/field_view.hpp"
+#include "nexusfix/parser/repeating_group.hpp"
+#include "nexusfix/memory/seqlock.hpp"
+#include "nexusfix/messages/fix44/market_data.hpp"
+#include "nexusfix/util/string_hash.hpp"
+
+namespace nfx::book {
+
+// ============================================================================
+// Book Types
+// ============================================================================
+
+/// One aggregated price level (FixedPrice / Qty raw values)
+struct PriceLevel {
+    int64_t price_raw{0};
+    int64_t size_raw{0};
+    int32_t orders{0};    // NumberOfOrders (346), 0 if not sent
+};
+
+/// Best bid/offer and last trade, as published to readers
+struct TopOfBook {
+    int64_t bid_price_raw{0};
+    int64_t bid_size_raw{0};
+    int64_t ask_price_raw{0};
+    int64_t ask_size_raw{0};
+    int64_t last_price_raw{0};
+    int64_t last_size_raw{0};
+    uint32_t msg_seq_num{0};  // MsgSeqNum of the message that produced this top
+
+    [[nodiscard]] constexpr bool has_bid() const noexcept { return bid_size_raw != 0; }
+    [[nodiscard]] constexpr bool has_ask() const noexcept { return ask_size_raw != 0; }
+
+    [[nodiscard]] constexpr FixedPrice bid() const noexcept { return FixedPrice{bid_price_raw}; }
+    [[nodiscard]] constexpr FixedPrice ask() const noexcept { return FixedPrice{ask_price_raw}; }
+
+    /// Same prices and sizes (ignores msg_seq_num)
+    [[nodiscard]] constexpr bool same_quote(const TopOfBook& o) const noexcept {
+        return bid_price_raw == o.bid_price_raw && bid_size_raw == o.bid_size_raw &&
+               ask_price_raw == o.ask_price_raw && ask_size_raw == o.ask_size_raw &&
+               last_price_raw == o.last_price_raw && last_size_raw == o.last_size_raw;
+    }
+};
+
+/// One decoded group entry (stack-only, fields the book needs)
+struct BookUpdate {
+    MDUpdateAction action{MDUpdateAction::New};
+    MDEntryType type{MDEntryType::Bid};
+    int64_t price_raw{0};
+    int64_t size_raw{0};
+    int32_t orders{0};
+    int32_t position_no{0};      // 1-based, 0 if not sent
+    std::string_view symbol{};
+    std::string_view entry_id{}; // MDEntryID (278): the order on order-level feeds
+};
+
+/// Decode a repeating group entry from its field index (no byte rescan)
+[[nodiscard]] NFX_HOT
+inline BookUpdate decode_book_update(const parser::RepeatingGroupIterator::Entry& entry) noexcept {
+    BookUpdate u;
+    entry.for_each_field([&u](const FieldView& f) noexcept {
+        switch (f.tag) {
+            case tag::MDUpdateAction::value:
+                u.action = static_cast<MDUpdateAction>(f.as_char());
+                break;
+            case tag::MDEntryType::value:
+                u.type = static_cast<MDEntryType>(f.as_char());
+                break;
+            case tag::MDEntryPx::value:
+                u.price_raw = f.as_price().raw;
+                break;
+            case tag::MDEntrySize::value:
+                u.size_raw = f.as_qty().raw;
+                break;
+            case tag::NumberOfOrders::value:
+                u.orders = static_cast<int32_t>(f.as_int().value_or(0));
+                break;
+            case tag::MDEntryPositionNo::value:
+                u.position_no = static_cast<int32_t>(f.as_int().value_or(0));
+                break;
+            case tag::Symbol::value:
+                u.symbol = f.as_string();
+                break;
+            case tag::MDEntryID::value:
+                u.entry_id = f.as_string();
+                break;
+            default:
+                break;
+        }
+    });
+    return u;
+}
+
+// ============================================================================
+// Order Book
+// ============================================================================
+
+/// Per-symbol price-level book
+/// Writer methods (apply/clear/publish) must be called from one thread;
+/// top()/try_top()/version() are safe from any thread.
+/// @tparam Depth Levels kept per side; worse levels are dropped
+template<size_t Depth = 16>
+class OrderBook {
+public:
+    static constexpr size_t DEPTH = Depth;
+    static constexpr size_t MAX_SYMBOL_LEN = 31;
+
+    OrderBook() noexcept = default;
+
+    explicit OrderBook(std::string_view symbol) noexcept {
+        set_symbol(symbol);
+    }
+
+    OrderBook(const OrderBook&) = delete;
+    OrderBook& operator=(const OrderBook&) = delete;
+
+    // ========================================================================
+    // Writer API
+    // ========================================================================
+
+    void set_symbol(std::string_view symbol) noexcept {
+        symbol_len_ = symbol.size() < MAX_SYMBOL_LEN ? symbol.size() : MAX_SYMBOL_LEN;
+        std::memcpy(symbol_.data(), symbol.data(), symbol_len_);
+    }
+
+    /// Apply one entry. Levels are keyed by price; MDEntryPositionNo is used
+    /// by DeleteThru/DeleteFrom and by Delete when no price is sent.
+    NFX_HOT
+    void apply(const BookUpdate& u) noexcept {
+        if (u.type == MDEntryType::Trade) {
+            last_price_raw_ = u.price_raw;
+            last_size_raw_ = u.size_raw;
+            return;
+        }
+        if (u.type != MDEntryType::Bid && u.type != MDEntryType::Offer) return;
+
+        Side& side = u.type == MDEntryType::Bid ? bids_ : asks_;
+        const bool is_bid = u.type == MDEntryType::Bid;
+
+        switch (u.action) {
+            case MDUpdateAction::New:
+            case MDUpdateAction::Change:
+                if (u.size_raw == 0) {
+                    side.erase_price(u.price_raw);
+                } else {
+                    side.upsert(is_bid, PriceLevel{u.price_raw, u.size_raw, u.orders});
+                }
+                break;
+            case MDUpdateAction::Delete:
+                if (u.price_raw == 0 && u.position_no > 0) {
+                    side.erase_range(static_cast<size_t>(u.position_no - 1),
+                                     static_cast<size_t>(u.position_no));
+                } else {
+                    side.erase_price(u.price_raw);
+                }
+                break;
+            case MDUpdateAction::DeleteThru:
+                // Top of book through position N (all levels if N is absent)
+                side.erase_range(0, u.position_no > 0 ? static_cast<size_t>(u.position_no) : Depth);
+                break;
+            case MDUpdateAction::DeleteFrom:
+                side.erase_range(u.position_no > 0 ? static_cast<size_t>(u.position_no - 1) : 0, Depth);
+                break;
+        }
+    }
+
+    /// Drop all levels (e.g. before applying a full refresh)
+    void clear() noexcept {
+        bids_.count = 0;
+        asks_.count = 0;
+    }
+
+    /// Publish the current top to readers; skipped when the quote is unchanged
+    /// @return true if a new version was published
+    bool publish(uint32_t msg_seq_num) noexcept {
+        TopOfBook top;
+        if (bids_.count > 0) {
+            top.bid_price_raw = bids_.levels[0].price_raw;
+            top.bid_size_raw = bids_.levels[0].size_raw;
+        }
+        if (asks_.count > 0) {
+            top.ask_price_raw = asks_.levels[0].price_raw;
+            top.ask_size_raw = asks_.levels[0].size_raw;
+        }
+        top.last_price_raw = last_price_raw_;
+        top.last_size_raw = last_size_raw_;
+        top.msg_seq_num = msg_seq_num;
+
+        if (published_once_ && top.same_quote(published_)) return false;
+        published_ = top;
+        published_once_ = true;
+        top_.write(top);
+        return true;
+    }
+
+    /// Full depth, best first (writer thread only)
+    [[nodiscard]] std::span<const PriceLevel> bids() const noexcept {
+        return {bids_.levels.data(), bids_.count};
+    }
+    [[nodiscard]] std::span<const PriceLevel> asks() const noexcept {
+        return {asks_.levels.data(), asks_.count};
+    }
+
+    // ========================================================================
+    // Reader API (any thread)
+    // ========================================================================
+
+    /// Latest published top (retries while a publish is in progress)
+    [[nodiscard]] TopOfBook top() const noexcept { return top_.read(); }
+
+    /// Single attempt; false if a publish was in progress
+    [[nodiscard]] bool try_top(TopOfBook& out) const noexcept { return top_.try_read(out); }
+
+    /// Number of publishes so far; compare to detect a new top
+    [[nodiscard]] uint64_t version() const noexcept { return top_.sequence() / 2; }
+
+    [[nodiscard]] std::string_view symbol() const noexcept {
+        return {symbol_.data(), symbol_len_};
+    }
+
+private:
+    struct Side {
+        std::array<PriceLevel, Depth> levels{};
+        size_t count{0};
+
+        /// Insert or replace the level at price, keeping best-first order
+        NFX_FORCE_INLINE void upsert(bool is_bid, const PriceLevel& level) noexcept {
+            size_t i = 0;
+            while (i < count && (is_bid ? levels[i].price_raw > level.price_raw
+                                        : levels[i].price_raw < level.price_raw)) {
+                ++i;
+            }
+            if (i < count && levels[i].price_raw == level.price_raw) {
+                levels[i] = level;
+                return;
+            }
+            if (i >= Depth) return;  // Worse than every kept level
+
+            size_t last = count < Depth ? count : Depth - 1;
+            for (size_t j = last; j > i; --j) levels[j] = levels[j - 1];
+            levels[i] = level;
+            if (count < Depth) ++count;
+        }
+
+        NFX_FORCE_INLINE void erase_price(int64_t price_raw) noexcept {
+            for (size_t i = 0; i < count; ++i) {
+                if (levels[i].price_raw == price_raw) {
+                    erase_range(i, i + 1);
+                    return;
+                }
+            }
+        }
+
+        /// Remove positions [first, last) (0-based, clamped)
+        void erase_range(size_t first, size_t last) noexcept {
+            if (last > count) last = count;
+            if (first >= last) return;
+            size_t n = last - first;
+            for (size_t j = first; j + n < count; ++j) levels[j] = levels[j + n];
+            count -= n;
+        }
+    };
+
+    Side bids_;
+    Side asks_;
+    int64_t last_price_raw_{0};
+    int64_t last_size_raw_{0};
+    TopOfBook published_{};
+    bool published_once_{false};
+    std::array<char, MAX_SYMBOL_LEN + 1> symbol_{};
+    size_t symbol_len_{0};
+
+    memory::Seqlock<TopOfBook> top_;
+};
+
+// ============================================================================
+// Book Cache
+// ============================================================================
+
+/// Fixed-capacity set of books keyed by Symbol, fed from MarketData messages.
+/// Books are created on first sight from the writer thread and never move,
+/// so a pointer returned by find() stays valid for the cache's lifetime.
+/// Large (MaxSymbols books inline): allocate it once, not on the stack.
+template<size_t MaxSymbols = 256, size_t Depth = 16>
+class BookCache {
+public:
+    using Book = OrderBook<Depth>;
+
+    BookCache() noexcept {
+        for (auto& slot : index_) slot.store(0, std::memory_order_relaxed);
+    }
+
+    BookCache(const BookCache&) = delete;
+    BookCache& operator=(const BookCache&) = delete;
+
+    // ========================================================================
+    // Writer API
+    // ========================================================================
+
+    /// Apply 35=X; every touched book publishes once after the whole message
+    /// @return number of entries applied
+    NFX_HOT
+    size_t apply(const fix44::MarketDataIncrementalRefresh& msg) noexcept {
+        return apply_group(msg.entries(), {}, msg.msg_seq_num(), false);
+    }
+
+    /// Apply 35=W: the symbol's book is replaced by the snapshot
+    /// @return number of entries applied
+    size_t apply(const fix44::MarketDataSnapshotFullRefresh& msg) noexcept {
+        return apply_group(msg.entries(), msg.symbol, msg.msg_seq_num(), true);
+    }
+
+    /// Get or create a book (nullptr when the cache is full)
+    [[nodiscard]] Book* find_or_add(std::string_view symbol) noexcept {
+        uint64_t hash = util::fnv1a_hash64_runtime(symbol);
+        size_t slot = static_cast<size_t>(hash) & (TABLE_SIZE - 1);
+
+        for (size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+            uint32_t idx = index_[slot].load(std::memory_order_relaxed);
+            if (idx == 0) {
+                size_t n = count_.load(std::memory_order_relaxed);
+                if (n >= MaxSymbols) return nullptr;
+                books_[n].set_symbol(symbol);
+                count_.store(n + 1, std::memory_order_relaxed);
+                // Publish after the symbol is written
+                index_[slot].store(static_cast<uint32_t>(n + 1), std::memory_order_release);
+                return &books_[n];
+            }
+            if (books_[idx - 1].symbol() == symbol) return &books_[idx - 1];
+            slot = (slot + 1) & (TABLE_SIZE - 1);
+        }
+        return nullptr;
+    }
+
+    // ========================================================================
+    // Reader API (any thread)
+    // ========================================================================
+
+    /// Look up a book; nullptr if the symbol has not been seen yet
+    [[nodiscard]] const Book* find(std::string_view symbol) const noexcept {
+        uint64_t hash = util::fnv1a_hash64_runtime(symbol);
+        size_t slot = static_cast<size_t>(hash) & (TABLE_SIZE - 1);
+
+        for (size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+            uint32_t idx = index_[slot].load(std::memory_order_acquire);
+            if (idx == 0) return nullptr;
+            if (books_[idx - 1].symbol() == symbol) return &books_[idx - 1];
+            slot = (slot + 1) & (TABLE_SIZE - 1);
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return MaxSymbols; }
+
+private:
+    static constexpr size_t TABLE_SIZE = std::bit_ceil(MaxSymbols * 2);
+
+    size_t apply_group(parser::MDEntryIterator iter, std::string_view message_symbol,
+                       uint32_t msg_seq_num, bool replace) noexcept
+    {
+        std::array<Book*, MAX_TOUCHED> touched{};
+        size_t touched_count = 0;
+
+        Book* book = message_symbol.empty() ? nullptr : find_or_add(message_symbol);
+        if (book) {
+            if (replace) book->clear();
+            mark_touched(touched, touched_count, book, msg_seq_num);
+        }
+
+        size_t applied = 0;
+        while (iter.has_next()) [[likely]] {
+            BookUpdate u = decode_book_update(iter.next_entry());
+
+            // Symbol may repeat per entry; an absent one means "same as before"
+            if (!u.symbol.empty() && (!book || book->symbol() != u.symbol)) {
+                book = find_or_add(u.symbol);
+                if (book) mark_touched(touched, touched_count, book, msg_seq_num);
+            }
+            if (!book) continue;
+
+            book->apply(u);
+            ++applied;
+        }
+
+        for (size_t i = 0; i < touched_count; ++i) {
+            touched[i]->publish(msg_seq_num);
+        }
+        return applied;
+    }
+
+    static constexpr size_t MAX_TOUCHED = 64;
+
+    /// Remember a book for publishing; flushes early if one message touches
+    /// more than MAX_TOUCHED books
+    static void mark_touched(std::array<Book*, MAX_TOUCHED>& touched, size_t& n,
+                             Book* book, uint32_t msg_seq_num) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            if (touched[i] == book) return;
+        }
+        if (n == MAX_TOUCHED) {
+            for (size_t i = 0; i < n; ++i) touched[i]->publish(msg_seq_num);
+            n = 0;
+        }
+        touched[n++] = book;
+    }
+
+    std::array<Book, MaxSymbols> books_;
+    std::array<std::atomic<uint32_t>, TABLE_SIZE> index_;  // Book index + 1, 0 = empty
+    std::atomic<size_t> count_{0};
+};
+
+} // namespace nfx::book
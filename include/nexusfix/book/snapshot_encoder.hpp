@@ -0,0 +1,290 @@
+#pragma once
+
+/// @file snapshot_encoder.hpp
+/// @brief Incremental 35=W encoder for republishing an OrderBook downstream
+///
+/// The snapshot lives in one persistent buffer. Each level's serialized
+/// bytes ("269=0|270=..|271=..|346=..|") stay in place together with their
+/// byte sum and the values they encode; update() re-encodes only levels
+/// whose price, size or order count changed. A level of unchanged length is
+/// overwritten in place; otherwise the bytes behind it move once.
+///
+/// The header ("8=..|9=NNNNNN|35=W|49=..|56=..|34=..|52=..|[262=..|]55=..|
+/// 268=N|") is written right-aligned against the first level, so a
+/// different MsgSeqNum/SendingTime width never moves the levels. Its static
+/// part is rendered once by prepare(), as in fix44::NewOrderTemplate.
+/// BodyLength is header body bytes plus the running level byte count, and
+/// CheckSum is the header's running sum plus the running level sum: neither
+/// rescans the levels.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/book/order_book.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/serializer/constexpr_serializer.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+#include "nexusfix/types/tag.hpp"
+
+namespace nfx::book {
+
+// ============================================================================
+// Snapshot Encoder
+// ============================================================================
+
+/// Per-book MarketDataSnapshotFullRefresh (35=W) encoder
+/// @tparam MaxLevels Levels per side (as OrderBook's Depth)
+template<size_t MaxLevels = 16>
+class SnapshotEncoder {
+public:
+    /// Longest static + per-message header ("8=..|" through "268=N|")
+    static constexpr size_t HEADER_MAX = 256;
+
+    /// Longest level: 269, 270 (FixedPrice), 271 (Qty) and 346 fields
+    static constexpr size_t LEVEL_MAX = 6 + (4 + FixedPrice::MAX_CHARS + 1) +
+                                        (4 + Qty::MAX_CHARS + 1) + (4 + 10 + 1);
+
+    static constexpr size_t TRAILER_SIZE = 7;   // "10=XXX|"
+    static constexpr size_t BUFFER_SIZE = HEADER_MAX + 2 * MaxLevels * LEVEL_MAX + TRAILER_SIZE;
+
+    SnapshotEncoder() noexcept = default;
+
+    SnapshotEncoder(const SnapshotEncoder&) = delete;
+    SnapshotEncoder& operator=(const SnapshotEncoder&) = delete;
+
+    /// Render the static header and forget all cached levels
+    /// (Symbol past 32 and MDReqID past 64 characters are cut)
+    void prepare(std::string_view begin_string,
+                 std::string_view sender_comp_id,
+                 std::string_view target_comp_id,
+                 std::string_view symbol,
+                 std::string_view md_req_id = {}) noexcept
+    {
+        header_.reset();
+        header_.begin_string(begin_string);
+        length_pos_ = header_.body_length_placeholder();
+        header_.mark_body_start();
+        header_.msg_type('W');
+        header_.sender_comp_id(sender_comp_id);
+        header_.target_comp_id(target_comp_id);
+        static_end_ = header_.size();
+        static_sum_ = header_.running_sum() - length_digit_sum();
+
+        symbol_len_ = symbol.size() < symbol_.size() ? symbol.size() : symbol_.size();
+        std::memcpy(symbol_.data(), symbol.data(), symbol_len_);
+        req_id_len_ = md_req_id.size() < req_id_.size() ? md_req_id.size() : req_id_.size();
+        std::memcpy(req_id_.data(), md_req_id.data(), req_id_len_);
+
+        sides_[0].count = 0;
+        sides_[1].count = 0;
+        levels_bytes_ = 0;
+        levels_sum_ = 0;
+        prepared_ = true;
+    }
+
+    [[nodiscard]] bool prepared() const noexcept { return prepared_; }
+
+    /// Bring the cached levels in line with a book's depth, best first.
+    /// Levels past MaxLevels are not published.
+    NFX_HOT void update(std::span<const PriceLevel> bids,
+                        std::span<const PriceLevel> asks) noexcept {
+        update_side(BID, bids);
+        update_side(ASK, asks);
+    }
+
+    /// update() from an OrderBook (writer thread)
+    template<size_t Depth>
+    void update(const OrderBook<Depth>& book) noexcept {
+        update(book.bids(), book.asks());
+    }
+
+    /// Complete snapshot of the cached levels
+    /// @return Message bytes, valid until the next update()/build()/prepare()
+    [[nodiscard]] NFX_HOT
+    std::span<const char> build(uint32_t msg_seq_num, std::string_view sending_time) noexcept {
+        // The slot still holds the previous message's BodyLength digits
+        header_.truncate(static_end_, static_sum_ + length_digit_sum());
+        header_.msg_seq_num(msg_seq_num);
+        header_.sending_time(sending_time);
+        if (req_id_len_ > 0) {
+            header_.template field<tag::MDReqID::value>(std::string_view{req_id_.data(), req_id_len_});
+        }
+        header_.template field<tag::Symbol::value>(std::string_view{symbol_.data(), symbol_len_});
+        header_.template field<tag::NoMDEntries::value>(
+            static_cast<uint32_t>(sides_[BID].count + sides_[ASK].count));
+
+        const size_t header_size = header_.size();
+        header_.update_body_length(length_pos_, header_size - header_.body_start() + levels_bytes_);
+
+        char* start = buffer_.data() + HEADER_MAX - header_size;
+        std::memcpy(start, header_.c_str(), header_size);
+
+        const auto checksum = static_cast<uint8_t>((header_.running_sum() + levels_sum_) % 256);
+        char* trailer = buffer_.data() + HEADER_MAX + levels_bytes_;
+        std::memcpy(trailer, "10=", 3);
+        trailer[3] = static_cast<char>('0' + checksum / 100);
+        trailer[4] = static_cast<char>('0' + (checksum / 10) % 10);
+        trailer[5] = static_cast<char>('0' + checksum % 10);
+        trailer[6] = serializer::SOH;
+
+        return {start, header_size + levels_bytes_ + TRAILER_SIZE};
+    }
+
+    /// Published levels of a side (bids: true)
+    [[nodiscard]] size_t levels(bool bids) const noexcept {
+        return sides_[bids ? BID : ASK].count;
+    }
+
+    /// Levels serialized since prepare() (unchanged levels are not counted)
+    [[nodiscard]] uint64_t encoded_levels() const noexcept { return encoded_; }
+
+private:
+    static constexpr size_t BID = 0;
+    static constexpr size_t ASK = 1;
+    static constexpr size_t LENGTH_DIGITS = 6;
+
+    /// One cached level: the values it encodes and where its bytes are
+    struct Level {
+        PriceLevel value;
+        uint32_t offset{0};   // From the first level's byte
+        uint32_t sum{0};      // Byte sum of its fields
+        uint8_t length{0};
+    };
+
+    struct SideLevels {
+        std::array<Level, MaxLevels> levels{};
+        size_t count{0};
+    };
+
+    void update_side(size_t side, std::span<const PriceLevel> book) noexcept {
+        SideLevels& s = sides_[side];
+        const size_t n = book.size() < MaxLevels ? book.size() : MaxLevels;
+        const char type = side == BID ? static_cast<char>(MDEntryType::Bid)
+                                      : static_cast<char>(MDEntryType::Offer);
+
+        const size_t common = n < s.count ? n : s.count;
+        for (size_t i = 0; i < common; ++i) {
+            const PriceLevel& v = s.levels[i].value;
+            if (v.price_raw != book[i].price_raw || v.size_raw != book[i].size_raw ||
+                v.orders != book[i].orders) {
+                write_level(side, i, type, book[i]);
+            }
+        }
+        for (size_t i = s.count; i < n; ++i) {
+            // Append at the end of this side (before the asks for bids)
+            Level& level = s.levels[i];
+            level.offset = static_cast<uint32_t>(side_end(side));
+            level.length = 0;
+            level.sum = 0;
+            ++s.count;
+            write_level(side, i, type, book[i]);
+        }
+        if (n < s.count) {
+            const size_t from = s.levels[n].offset;
+            const size_t to = side_end(side);
+            for (size_t i = n; i < s.count; ++i) levels_sum_ -= s.levels[i].sum;
+            s.count = n;
+            shift_after(side, n, to, -static_cast<ptrdiff_t>(to - from));
+        }
+    }
+
+    /// Re-encode level i of a side in place, moving what follows it if its
+    /// length changed
+    NFX_HOT void write_level(size_t side, size_t i, char type, const PriceLevel& value) noexcept {
+        scratch_.reset();
+        scratch_.template field<tag::MDEntryType::value>(type);
+        price_field<tag::MDEntryPx::value>(FixedPrice{value.price_raw});
+        qty_field<tag::MDEntrySize::value>(Qty{value.size_raw});
+        if (value.orders > 0) {
+            scratch_.template field<tag::NumberOfOrders::value>(static_cast<uint32_t>(value.orders));
+        }
+
+        Level& level = sides_[side].levels[i];
+        const size_t length = scratch_.size();
+        if (length != level.length) {
+            shift_after(side, i + 1, level.offset + level.length,
+                        static_cast<ptrdiff_t>(length) - static_cast<ptrdiff_t>(level.length));
+        }
+        std::memcpy(buffer_.data() + HEADER_MAX + level.offset, scratch_.c_str(), length);
+        levels_sum_ += scratch_.running_sum() - level.sum;
+        level.sum = scratch_.running_sum();
+        level.length = static_cast<uint8_t>(length);
+        level.value = value;
+        ++encoded_;
+    }
+
+    /// Move the bytes from `from` to the end of all levels by `delta`;
+    /// levels from index `first` of `side` onwards (and every ask level
+    /// when side is BID) follow them
+    void shift_after(size_t side, size_t first, size_t from, ptrdiff_t delta) noexcept {
+        char* base = buffer_.data() + HEADER_MAX;
+        std::memmove(base + static_cast<ptrdiff_t>(from) + delta, base + from, levels_bytes_ - from);
+        levels_bytes_ = static_cast<size_t>(static_cast<ptrdiff_t>(levels_bytes_) + delta);
+
+        for (size_t i = first; i < sides_[side].count; ++i) {
+            sides_[side].levels[i].offset = static_cast<uint32_t>(sides_[side].levels[i].offset + delta);
+        }
+        if (side == BID) {
+            for (size_t i = 0; i < sides_[ASK].count; ++i) {
+                sides_[ASK].levels[i].offset = static_cast<uint32_t>(sides_[ASK].levels[i].offset + delta);
+            }
+        }
+    }
+
+    /// Byte offset just past a side's last level
+    [[nodiscard]] size_t side_end(size_t side) const noexcept {
+        const SideLevels& s = sides_[side];
+        if (s.count > 0) return s.levels[s.count - 1].offset + s.levels[s.count - 1].length;
+        if (side == ASK) return levels_bytes_;
+        // No bids: the asks start at 0
+        return 0;
+    }
+
+    [[nodiscard]] uint32_t length_digit_sum() const noexcept {
+        const char* data = header_.c_str();
+        uint32_t sum = 0;
+        for (size_t i = 0; i < LENGTH_DIGITS; ++i) {
+            sum += static_cast<uint8_t>(data[length_pos_ + i]);
+        }
+        return sum;
+    }
+
+    template<int Tag>
+    NFX_FORCE_INLINE void price_field(FixedPrice price) noexcept {
+        char buf[FixedPrice::MAX_CHARS];
+        const size_t len = price.to_chars(buf);
+        scratch_.template field<Tag>(std::string_view{buf, len});
+    }
+
+    template<int Tag>
+    NFX_FORCE_INLINE void qty_field(Qty qty) noexcept {
+        char buf[Qty::MAX_CHARS];
+        const size_t len = qty.to_chars(buf);
+        scratch_.template field<Tag>(std::string_view{buf, len});
+    }
+
+    std::array<char, BUFFER_SIZE> buffer_{};
+    std::array<SideLevels, 2> sides_{};
+    size_t levels_bytes_{0};
+    uint32_t levels_sum_{0};
+    uint64_t encoded_{0};
+
+    serializer::FastMessageBuilder<HEADER_MAX> header_;
+    serializer::FastMessageBuilder<LEVEL_MAX> scratch_;
+    size_t length_pos_{0};
+    size_t static_end_{0};
+    uint32_t static_sum_{0};
+
+    std::array<char, 32> symbol_{};
+    size_t symbol_len_{0};
+    std::array<char, 64> req_id_{};
+    size_t req_id_len_{0};
+    bool prepared_{false};
+};
+
+} // namespace nfx::book
@@ -0,0 +1,611 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/fast/primitives.hpp"
+
+namespace nfx::fast {
+
+// ============================================================================
+// Template Definitions
+// ============================================================================
+// Templates are plain tables of FieldDefs registered once at startup (from
+// the venue's template XML or written by hand). A sequence is one FieldDef
+// for its length field, followed by the FieldDefs of one element.
+
+enum class FieldType : uint8_t {
+    UInt32,
+    Int32,
+    UInt64,
+    Int64,
+    Decimal,      // Single-operator decimal (exponent and mantissa together)
+    Ascii,
+    ByteVector,   // Operator None only
+    Sequence      // Length field; the next `children` FieldDefs are the element
+};
+
+enum class Operator : uint8_t {
+    None,
+    Constant,
+    Default,
+    Copy,
+    Increment,    // Integers only
+    Delta,        // Integers, decimals and strings
+    Tail          // Strings only
+};
+
+enum class Presence : uint8_t {
+    Mandatory,
+    Optional
+};
+
+/// One field of a template
+struct FieldDef {
+    uint32_t tag{0};                    // FIX tag (id attribute of the template XML)
+    FieldType type{FieldType::UInt32};
+    Operator op{Operator::None};
+    Presence presence{Presence::Mandatory};
+    bool has_initial{false};
+    int64_t initial{0};                 // Integer value or decimal mantissa
+    int32_t initial_exponent{0};
+    std::string_view initial_text{};
+    uint16_t children{0};               // Sequence: FieldDefs forming one element
+
+    // Assigned by TemplateRegistry::add()
+    uint16_t slot{0};                   // Dictionary entry (global scope, keyed by tag and type)
+    bool element_pmap{false};           // Sequence: elements start with a presence map
+};
+
+/// A registered template
+struct Template {
+    uint32_t id{0};
+    std::vector<FieldDef> fields;
+};
+
+/// Template table, built before decoding starts
+class TemplateRegistry {
+public:
+    static constexpr uint32_t MAX_TEMPLATE_ID = 65535;
+
+    /// Register a template, validating operators against field types
+    /// @return UnsupportedOperator / MandatoryAbsent for an invalid table
+    [[nodiscard]] FastResult<void> add(uint32_t id, std::initializer_list<FieldDef> fields) {
+        return add(id, std::span<const FieldDef>{fields.begin(), fields.size()});
+    }
+
+    [[nodiscard]] FastResult<void> add(uint32_t id, std::span<const FieldDef> fields) {
+        if (id > MAX_TEMPLATE_ID) return std::unexpected{FastError::UnknownTemplate};
+
+        Template tmpl{id, {fields.begin(), fields.end()}};
+        if (auto valid = prepare(tmpl.fields); !valid) return valid;
+
+        if (index_.size() <= id) index_.resize(id + 1, NOT_FOUND);
+        if (index_[id] != NOT_FOUND) {
+            templates_[index_[id]] = std::move(tmpl);
+        } else {
+            index_[id] = static_cast<uint32_t>(templates_.size());
+            templates_.push_back(std::move(tmpl));
+        }
+        return {};
+    }
+
+    [[nodiscard]] NFX_HOT const Template* find(uint32_t id) const noexcept {
+        if (id >= index_.size() || index_[id] == NOT_FOUND) [[unlikely]] return nullptr;
+        return &templates_[index_[id]];
+    }
+
+    /// Dictionary entries the templates need
+    [[nodiscard]] size_t slot_count() const noexcept { return keys_.size(); }
+
+private:
+    static constexpr uint32_t NOT_FOUND = UINT32_MAX;
+
+    [[nodiscard]] static bool integer(FieldType type) noexcept {
+        return type <= FieldType::Int64 || type == FieldType::Sequence;
+    }
+
+    /// Whether a field takes a presence map bit of its segment
+    [[nodiscard]] static bool uses_pmap_bit(const FieldDef& def) noexcept {
+        switch (def.op) {
+            case Operator::None:
+            case Operator::Delta:
+                return false;
+            case Operator::Constant:
+                return def.presence == Presence::Optional;
+            default:
+                return true;
+        }
+    }
+
+    [[nodiscard]] FastResult<void> prepare(std::span<FieldDef> fields) {
+        for (size_t i = 0; i < fields.size(); ++i) {
+            FieldDef& def = fields[i];
+            const bool ok =
+                (def.op != Operator::Increment || integer(def.type)) &&
+                (def.op != Operator::Tail || def.type == FieldType::Ascii) &&
+                (def.op != Operator::Delta || def.type != FieldType::ByteVector) &&
+                (def.type != FieldType::ByteVector || def.op == Operator::None) &&
+                (def.type != FieldType::Sequence || i + def.children < fields.size());
+            if (!ok) return std::unexpected{FastError::UnsupportedOperator};
+            if (!def.has_initial && (def.op == Operator::Constant ||
+                (def.op == Operator::Default && def.presence == Presence::Mandatory))) {
+                return std::unexpected{FastError::MandatoryAbsent};
+            }
+
+            if (!def.initial_text.empty()) {
+                def.initial_text = texts_.emplace_back(def.initial_text);
+            }
+            def.slot = slot_for(def);
+
+            if (def.type == FieldType::Sequence) {
+                const auto element = fields.subspan(i + 1, def.children);
+                def.element_pmap = false;
+                for (size_t j = 0; j < element.size(); ++j) {
+                    def.element_pmap = def.element_pmap || uses_pmap_bit(element[j]);
+                    if (element[j].type == FieldType::Sequence) j += element[j].children;
+                }
+            }
+        }
+        return {};
+    }
+
+    [[nodiscard]] uint16_t slot_for(const FieldDef& def) {
+        const Key key{def.tag, def.type};
+        for (size_t i = 0; i < keys_.size(); ++i) {
+            if (keys_[i] == key) return static_cast<uint16_t>(i);
+        }
+        keys_.push_back(key);
+        return static_cast<uint16_t>(keys_.size() - 1);
+    }
+
+    using Key = std::pair<uint32_t, FieldType>;
+
+    std::vector<Template> templates_;
+    std::vector<uint32_t> index_;       // Template id -> templates_ index
+    std::vector<Key> keys_;             // Dictionary slot -> (tag, type)
+    std::deque<std::string> texts_;     // Owned initial values (stable addresses)
+};
+
+// ============================================================================
+// Decoded Values
+// ============================================================================
+
+/// Value of one decoded field; text points into the decoder's message arena
+/// or the registry and stays valid until the next decode()
+struct FieldValue {
+    int64_t integer{0};        // Integer value or decimal mantissa
+    int32_t exponent{0};       // Decimal exponent (0 for integers)
+    std::string_view text{};   // Ascii / ByteVector
+    bool present{false};
+
+    /// Decimal (or integer) as a value with `Decimals` fractional digits
+    template <int Decimals>
+    [[nodiscard]] constexpr int64_t scaled() const noexcept {
+        int shift = Decimals + exponent;
+        int64_t value = integer;
+        for (; shift > 0; --shift) value *= 10;
+        for (; shift < 0; ++shift) value /= 10;
+        return value;
+    }
+
+    [[nodiscard]] constexpr FixedPrice as_price() const noexcept {
+        return FixedPrice{scaled<FixedPrice::DECIMAL_PLACES>()};
+    }
+
+    [[nodiscard]] constexpr Qty as_qty() const noexcept {
+        return Qty{scaled<Qty::DECIMAL_PLACES>()};
+    }
+
+    /// FIX char enum: first character of a string, or the digit of a
+    /// small integer (MDUpdateAction 0..9 sent as uInt32)
+    [[nodiscard]] constexpr char as_char() const noexcept {
+        if (!text.empty()) return text[0];
+        return static_cast<char>('0' + integer);
+    }
+};
+
+// ============================================================================
+// Decoder
+// ============================================================================
+
+/// Template-driven FAST 1.1 decoder with a global operator dictionary.
+/// Fields are reported to a visitor as they are decoded; every callback is
+/// optional:
+///     on_template(const Template&)
+///     on_field(const FieldDef&, const FieldValue&)       // Present fields only
+///     on_sequence(const FieldDef&, uint32_t length)
+///     on_element(const FieldDef&, uint32_t index)
+///     on_element_end(const FieldDef&, uint32_t index)
+/// Decoding never allocates: dictionary entries and the string arena are
+/// sized when the decoder is constructed.
+class Decoder {
+public:
+    static constexpr size_t MAX_TEXT = 64;        // Longest string kept in the dictionary
+    static constexpr size_t TEXT_ARENA = 8192;    // String bytes reported per message
+
+    explicit Decoder(const TemplateRegistry& registry)
+        : registry_{&registry}, dictionary_(registry.slot_count()) {}
+
+    /// Forget all dictionary state (FAST reset message, start of a session)
+    void reset() noexcept {
+        for (auto& entry : dictionary_) entry.state = State::Undefined;
+        template_id_ = NO_TEMPLATE;
+    }
+
+    /// Decode one message from the front of data
+    /// @return Bytes consumed
+    template <typename Visitor>
+    [[nodiscard]] NFX_HOT FastResult<size_t> decode(std::span<const char> data, Visitor&& visitor) noexcept {
+        Reader reader{data};
+        arena_used_ = 0;
+
+        auto pmap = PresenceMap::read(reader);
+        if (!pmap) [[unlikely]] return std::unexpected{pmap.error()};
+
+        if (pmap->next()) {
+            auto id = reader.read_uint();
+            if (!id) [[unlikely]] return std::unexpected{id.error()};
+            template_id_ = *id;
+        }
+        const Template* tmpl = template_id_ <= UINT32_MAX
+            ? registry_->find(static_cast<uint32_t>(template_id_)) : nullptr;
+        if (!tmpl) [[unlikely]] return std::unexpected{FastError::UnknownTemplate};
+
+        if constexpr (requires { visitor.on_template(*tmpl); }) {
+            visitor.on_template(*tmpl);
+        }
+        if (auto fields = decode_fields(reader, *pmap, tmpl->fields, visitor); !fields) [[unlikely]] {
+            return std::unexpected{fields.error()};
+        }
+        return reader.position();
+    }
+
+private:
+    static constexpr uint64_t NO_TEMPLATE = UINT64_MAX;
+
+    enum class State : uint8_t {
+        Undefined,
+        Assigned,
+        Empty
+    };
+
+    struct Entry {
+        State state{State::Undefined};
+        uint8_t length{0};
+        int32_t exponent{0};
+        int64_t value{0};
+        std::array<char, MAX_TEXT> text{};
+
+        [[nodiscard]] std::string_view view() const noexcept { return {text.data(), length}; }
+    };
+
+    template <typename Visitor>
+    [[nodiscard]] NFX_HOT FastResult<void> decode_fields(Reader& reader, PresenceMap& pmap,
+                                                         std::span<const FieldDef> fields,
+                                                         Visitor& visitor) noexcept {
+        for (size_t i = 0; i < fields.size(); ++i) {
+            const FieldDef& def = fields[i];
+            FieldValue value;
+            if (auto ok = decode_field(reader, pmap, def, value); !ok) [[unlikely]] return ok;
+
+            if (def.type != FieldType::Sequence) [[likely]] {
+                if (value.present) {
+                    if constexpr (requires { visitor.on_field(def, value); }) {
+                        visitor.on_field(def, value);
+                    }
+                }
+                continue;
+            }
+
+            const auto element = fields.subspan(i + 1, def.children);
+            i += def.children;
+            if (!value.present) continue;   // Optional sequence absent
+
+            const auto length = static_cast<uint32_t>(value.integer);
+            if constexpr (requires { visitor.on_sequence(def, length); }) {
+                visitor.on_sequence(def, length);
+            }
+            for (uint32_t k = 0; k < length; ++k) {
+                if constexpr (requires { visitor.on_element(def, k); }) {
+                    visitor.on_element(def, k);
+                }
+                PresenceMap element_pmap;
+                if (def.element_pmap) {
+                    auto read = PresenceMap::read(reader);
+                    if (!read) [[unlikely]] return std::unexpected{read.error()};
+                    element_pmap = *read;
+                }
+                if (auto ok = decode_fields(reader, element_pmap, element, visitor); !ok) [[unlikely]] {
+                    return ok;
+                }
+                if constexpr (requires { visitor.on_element_end(def, k); }) {
+                    visitor.on_element_end(def, k);
+                }
+            }
+        }
+        return {};
+    }
+
+    // ------------------------------------------------------------------------
+    // Field operators
+    // ------------------------------------------------------------------------
+
+    [[nodiscard]] NFX_HOT FastResult<void> decode_field(Reader& reader, PresenceMap& pmap,
+                                                        const FieldDef& def, FieldValue& out) noexcept {
+        switch (def.type) {
+            case FieldType::Ascii:
+                return decode_ascii(reader, pmap, def, out);
+            case FieldType::ByteVector: {
+                auto bytes = reader.read_bytes(def.presence == Presence::Optional, out.present);
+                if (!bytes) [[unlikely]] return std::unexpected{bytes.error()};
+                out.text = {bytes->data(), bytes->size()};
+                return {};
+            }
+            default:
+                return decode_number(reader, pmap, def, out);
+        }
+    }
+
+    /// Integers, decimals and sequence lengths
+    [[nodiscard]] NFX_HOT FastResult<void> decode_number(Reader& reader, PresenceMap& pmap,
+                                                         const FieldDef& def, FieldValue& out) noexcept {
+        const bool optional = def.presence == Presence::Optional;
+        Entry& entry = dictionary_[def.slot];
+
+        switch (def.op) {
+            case Operator::None:
+                return read_number(reader, def, optional, out);
+
+            case Operator::Constant:
+                if (!optional || pmap.next()) set_initial(def, out);
+                return {};
+
+            case Operator::Default:
+                if (pmap.next()) return read_number(reader, def, optional, out);
+                if (def.has_initial) set_initial(def, out);
+                return {};
+
+            case Operator::Copy:
+            case Operator::Increment:
+                if (pmap.next()) {
+                    if (auto ok = read_number(reader, def, optional, out); !ok) [[unlikely]] return ok;
+                    store(entry, out);
+                    return {};
+                }
+                if (entry.state == State::Assigned) [[likely]] {
+                    if (def.op == Operator::Increment) ++entry.value;
+                    out.integer = entry.value;
+                    out.exponent = entry.exponent;
+                    out.present = true;
+                    return {};
+                }
+                if (entry.state == State::Undefined && def.has_initial) {
+                    set_initial(def, out);
+                    store(entry, out);
+                    return {};
+                }
+                if (!optional) [[unlikely]] return std::unexpected{FastError::MandatoryAbsent};
+                entry.state = State::Empty;
+                return {};
+
+            case Operator::Delta: {
+                bool present = true;
+                int64_t exponent_delta = 0;
+                if (def.type == FieldType::Decimal) {
+                    auto exp = optional ? reader.read_nullable_int(present) : reader.read_int();
+                    if (!exp) [[unlikely]] return std::unexpected{exp.error()};
+                    if (!present) return {};
+                    exponent_delta = *exp;
+                }
+                auto delta = (optional && def.type != FieldType::Decimal)
+                    ? reader.read_nullable_int(present) : reader.read_int();
+                if (!delta) [[unlikely]] return std::unexpected{delta.error()};
+                if (!present) return {};
+
+                int64_t base = def.initial;
+                int32_t base_exponent = def.initial_exponent;
+                if (entry.state == State::Assigned) {
+                    base = entry.value;
+                    base_exponent = entry.exponent;
+                }
+                out.integer = base + *delta;
+                out.exponent = static_cast<int32_t>(base_exponent + exponent_delta);
+                out.present = true;
+                store(entry, out);
+                return {};
+            }
+
+            case Operator::Tail:
+                break;
+        }
+        return std::unexpected{FastError::UnsupportedOperator};
+    }
+
+    [[nodiscard]] NFX_HOT static FastResult<void> read_number(Reader& reader, const FieldDef& def,
+                                                              bool optional, FieldValue& out) noexcept {
+        out.present = true;
+        switch (def.type) {
+            case FieldType::UInt32:
+            case FieldType::UInt64:
+            case FieldType::Sequence: {
+                auto value = optional ? reader.read_nullable_uint(out.present) : reader.read_uint();
+                if (!value) [[unlikely]] return std::unexpected{value.error()};
+                out.integer = static_cast<int64_t>(*value);
+                return {};
+            }
+            case FieldType::Int32:
+            case FieldType::Int64: {
+                auto value = optional ? reader.read_nullable_int(out.present) : reader.read_int();
+                if (!value) [[unlikely]] return std::unexpected{value.error()};
+                out.integer = *value;
+                return {};
+            }
+            case FieldType::Decimal: {
+                auto exponent = optional ? reader.read_nullable_int(out.present) : reader.read_int();
+                if (!exponent) [[unlikely]] return std::unexpected{exponent.error()};
+                if (!out.present) return {};   // Null decimal has no mantissa
+                auto mantissa = reader.read_int();
+                if (!mantissa) [[unlikely]] return std::unexpected{mantissa.error()};
+                out.exponent = static_cast<int32_t>(*exponent);
+                out.integer = *mantissa;
+                return {};
+            }
+            default:
+                return std::unexpected{FastError::UnsupportedOperator};
+        }
+    }
+
+    static void set_initial(const FieldDef& def, FieldValue& out) noexcept {
+        out.integer = def.initial;
+        out.exponent = def.initial_exponent;
+        out.text = def.initial_text;
+        out.present = true;
+    }
+
+    static void store(Entry& entry, const FieldValue& value) noexcept {
+        if (!value.present) {
+            entry.state = State::Empty;
+            return;
+        }
+        entry.state = State::Assigned;
+        entry.value = value.integer;
+        entry.exponent = value.exponent;
+    }
+
+    /// ASCII strings; reported text is copied into the message arena so
+    /// it outlives later sequence elements that reuse the dictionary entry
+    [[nodiscard]] NFX_HOT FastResult<void> decode_ascii(Reader& reader, PresenceMap& pmap,
+                                                        const FieldDef& def, FieldValue& out) noexcept {
+        const bool optional = def.presence == Presence::Optional;
+        Entry& entry = dictionary_[def.slot];
+
+        switch (def.op) {
+            case Operator::None:
+                return read_text(reader, optional, out);
+
+            case Operator::Constant:
+                if (!optional || pmap.next()) set_initial(def, out);
+                return {};
+
+            case Operator::Default:
+                if (pmap.next()) return read_text(reader, optional, out);
+                if (def.has_initial) set_initial(def, out);
+                return {};
+
+            case Operator::Copy:
+            case Operator::Tail: {
+                if (pmap.next()) {
+                    if (auto ok = read_text(reader, optional, out); !ok) [[unlikely]] return ok;
+                    if (!out.present) {
+                        entry.state = State::Empty;
+                        return {};
+                    }
+                    if (def.op == Operator::Tail) {
+                        // Replace the end of the previous value with the tail
+                        const std::string_view base = entry.state == State::Assigned
+                            ? entry.view() : def.initial_text;
+                        const size_t keep = base.size() > out.text.size() ? base.size() - out.text.size() : 0;
+                        return combine(entry, base.substr(0, keep), out.text, {}, out);
+                    }
+                    return combine(entry, out.text, {}, {}, out);
+                }
+                if (entry.state == State::Assigned) [[likely]] {
+                    return report(entry.view(), out);
+                }
+                if (entry.state == State::Undefined && def.has_initial) {
+                    return combine(entry, def.initial_text, {}, {}, out);
+                }
+                if (!optional) [[unlikely]] return std::unexpected{FastError::MandatoryAbsent};
+                entry.state = State::Empty;
+                return {};
+            }
+
+            case Operator::Delta: {
+                bool present = true;
+                auto subtract = optional ? reader.read_nullable_int(present) : reader.read_int();
+                if (!subtract) [[unlikely]] return std::unexpected{subtract.error()};
+                if (!present) return {};
+                FieldValue diff;
+                if (auto ok = read_text(reader, false, diff); !ok) [[unlikely]] return ok;
+
+                const std::string_view base = entry.state == State::Assigned
+                    ? entry.view() : def.initial_text;
+                if (*subtract >= 0) {
+                    // Remove from the back, append the difference
+                    const size_t cut = std::min<size_t>(static_cast<size_t>(*subtract), base.size());
+                    return combine(entry, base.substr(0, base.size() - cut), diff.text, {}, out);
+                }
+                // Negative: remove (-n - 1) from the front, prepend
+                const size_t cut = std::min<size_t>(static_cast<size_t>(-(*subtract + 1)), base.size());
+                return combine(entry, {}, diff.text, base.substr(cut), out);
+            }
+
+            case Operator::Increment:
+                break;
+        }
+        return std::unexpected{FastError::UnsupportedOperator};
+    }
+
+    /// Read a string into the arena
+    [[nodiscard]] NFX_HOT FastResult<void> read_text(Reader& reader, bool nullable, FieldValue& out) noexcept {
+        const std::span<char> room{arena_.data() + arena_used_, TEXT_ARENA - arena_used_};
+        auto length = reader.read_ascii(room, nullable, out.present);
+        if (!length) [[unlikely]] return std::unexpected{length.error()};
+        out.text = {room.data(), *length};
+        arena_used_ += *length;
+        return {};
+    }
+
+    /// Store a + b + c as the entry's value and report it
+    [[nodiscard]] FastResult<void> combine(Entry& entry, std::string_view a, std::string_view b,
+                                           std::string_view c, FieldValue& out) noexcept {
+        const size_t length = a.size() + b.size() + c.size();
+        if (length > MAX_TEXT) [[unlikely]] return std::unexpected{FastError::TextTooLong};
+        // Parts may alias entry.text: assemble in a scratch copy first
+        std::array<char, MAX_TEXT> scratch;
+        std::memcpy(scratch.data(), a.data(), a.size());
+        std::memcpy(scratch.data() + a.size(), b.data(), b.size());
+        std::memcpy(scratch.data() + a.size() + b.size(), c.data(), c.size());
+        std::memcpy(entry.text.data(), scratch.data(), length);
+        entry.length = static_cast<uint8_t>(length);
+        entry.state = State::Assigned;
+        return report(entry.view(), out);
+    }
+
+    /// Copy a dictionary string into the arena for the visitor
+    [[nodiscard]] FastResult<void> report(std::string_view text, FieldValue& out) noexcept {
+        if (text.size() > TEXT_ARENA - arena_used_) [[unlikely]] {
+            return std::unexpected{FastError::TextTooLong};
+        }
+        char* dst = arena_.data() + arena_used_;
+        std::memcpy(dst, text.data(), text.size());
+        arena_used_ += text.size();
+        out.text = {dst, text.size()};
+        out.present = true;
+        return {};
+    }
+
+    const TemplateRegistry* registry_;
+    std::vector<Entry> dictionary_;
+    uint64_t template_id_{NO_TEMPLATE};
+    size_t arena_used_{0};
+    std::array<char, TEXT_ARENA> arena_{};
+};
+
+} // namespace nfx::fast
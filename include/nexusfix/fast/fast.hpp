@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+// ============================================================================
+// NexusFix FAST (FIX Adapted for STreaming) Module
+// ============================================================================
+//
+// Template-driven FAST 1.1 decoder for exchange market data feeds.
+// Stop-bit integers are decoded from one 8-byte load (SWAR, or PEXT with
+// BMI2) and string ends are found 16 bytes at a time with SSE2.
+//
+// Usage (Templates, once at startup):
+//   fast::TemplateRegistry templates;
+//   (void)templates.add(1, {
+//       {.tag = 34, .type = fast::FieldType::UInt32, .op = fast::Operator::Increment},
+//       {.tag = 268, .type = fast::FieldType::Sequence, .children = 3},
+//       {.tag = 269, .type = fast::FieldType::Ascii, .op = fast::Operator::Copy},
+//       {.tag = 270, .type = fast::FieldType::Decimal, .op = fast::Operator::Delta},
+//       {.tag = 271, .type = fast::FieldType::Int64, .op = fast::Operator::Delta},
+//   });
+//
+// Usage (Decode):
+//   fast::Decoder decoder{templates};   // Owns the operator dictionary
+//   MDEntryColumns<64> columns;
+//   while (!packet.empty()) {
+//       auto used = fast::decode_md_columns(decoder, packet, columns);
+//       if (!used) break;
+//       book.apply(columns);
+//       packet = packet.subspan(*used);
+//   }
+//
+// Any visitor can be passed to Decoder::decode() for other templates; see
+// decoder.hpp for the callbacks. Call Decoder::reset() on a FAST reset
+// message or when the feed restarts.
+
+#include "nexusfix/fast/primitives.hpp"
+#include "nexusfix/fast/decoder.hpp"
+#include "nexusfix/fast/market_data.hpp"
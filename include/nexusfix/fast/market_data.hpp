@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+#include "nexusfix/fast/decoder.hpp"
+
+namespace nfx::fast {
+
+// ============================================================================
+// FAST Market Data
+// ============================================================================
+// FAST market data templates carry the FIX MDEntry group as a sequence whose
+// length field has tag NoMDEntries (268). These decode such messages into
+// the same MDEntry / MDEntryColumns structures as the FIX tag=value path, so
+// book building does not care which wire format fed it.
+
+namespace detail {
+
+/// Builds MDEntryColumns rows from the elements of the NoMDEntries sequence
+template <size_t Capacity>
+struct MDColumnsVisitor {
+    MDEntryColumns<Capacity>& out;
+    MDUpdateAction default_action;
+    int depth{0};
+    bool row{false};   // Current element has a row
+
+    void on_element(const FieldDef& seq, uint32_t) noexcept {
+        if (seq.tag != tag::NoMDEntries::value) return;
+        ++depth;
+        row = out.count < Capacity;
+        if (!row) [[unlikely]] {
+            out.truncated = true;
+            return;
+        }
+        const size_t i = out.count++;
+        out.prices[i] = FixedPrice{};
+        out.sizes[i] = Qty{};
+        out.types[i] = MDEntryType::Bid;
+        out.actions[i] = default_action;
+        out.levels[i] = 0;
+    }
+
+    void on_element_end(const FieldDef& seq, uint32_t) noexcept {
+        if (seq.tag == tag::NoMDEntries::value) --depth;
+    }
+
+    NFX_HOT void on_field(const FieldDef& def, const FieldValue& value) noexcept {
+        if (depth == 0 || !row) return;
+        const size_t i = out.count - 1;
+        switch (def.tag) {
+            case tag::MDEntryType::value:
+                out.types[i] = static_cast<MDEntryType>(value.as_char());
+                break;
+            case tag::MDEntryPx::value:
+                out.prices[i] = value.as_price();
+                break;
+            case tag::MDEntrySize::value:
+                out.sizes[i] = value.as_qty();
+                break;
+            case tag::MDUpdateAction::value:
+                out.actions[i] = static_cast<MDUpdateAction>(value.as_char());
+                break;
+            case tag::MDEntryPositionNo::value:
+                out.levels[i] = static_cast<int32_t>(value.integer);
+                break;
+            default:
+                break;
+        }
+    }
+};
+
+/// Fills MDEntry rows; a message-level Symbol applies to entries without one
+struct MDEntriesVisitor {
+    std::span<MDEntry> out;
+    MDUpdateAction default_action;
+    size_t count{0};
+    size_t rows{0};    // Elements seen, including ones past out.size()
+    int depth{0};
+    std::string_view symbol{};
+
+    void on_element(const FieldDef& seq, uint32_t) noexcept {
+        if (seq.tag != tag::NoMDEntries::value) return;
+        ++depth;
+        if (rows++ < out.size()) {
+            out[count++] = MDEntry{.update_action = default_action};
+        }
+    }
+
+    void on_element_end(const FieldDef& seq, uint32_t) noexcept {
+        if (seq.tag == tag::NoMDEntries::value) --depth;
+    }
+
+    NFX_HOT void on_field(const FieldDef& def, const FieldValue& value) noexcept {
+        if (depth == 0) {
+            if (def.tag == tag::Symbol::value) symbol = value.text;
+            return;
+        }
+        if (rows > out.size()) [[unlikely]] return;
+        MDEntry& e = out[count - 1];
+        switch (def.tag) {
+            case tag::MDEntryType::value:
+                e.entry_type = static_cast<MDEntryType>(value.as_char());
+                break;
+            case tag::MDEntryPx::value:
+                e.price_raw = value.as_price().raw;
+                break;
+            case tag::MDEntrySize::value:
+                e.size_raw = value.as_qty().raw;
+                break;
+            case tag::MDUpdateAction::value:
+                e.update_action = static_cast<MDUpdateAction>(value.as_char());
+                break;
+            case tag::MDEntryID::value:
+                e.entry_id = value.text;
+                break;
+            case tag::Symbol::value:
+                e.symbol = value.text;
+                break;
+            case tag::MDEntryDate::value:
+                e.entry_date = value.text;
+                break;
+            case tag::MDEntryTime::value:
+                e.entry_time = value.text;
+                break;
+            case tag::MDEntryPositionNo::value:
+                e.position_no = static_cast<int>(value.integer);
+                break;
+            case tag::NumberOfOrders::value:
+                e.number_of_orders = static_cast<int>(value.integer);
+                break;
+            default:
+                break;
+        }
+    }
+};
+
+} // namespace detail
+
+/// Decode one FAST market data message into structure-of-arrays columns
+/// @return Bytes consumed; out.truncated is set if the group had more
+///         than Capacity entries
+template <size_t Capacity>
+[[nodiscard]] NFX_HOT inline FastResult<size_t> decode_md_columns(
+        Decoder& decoder, std::span<const char> data, MDEntryColumns<Capacity>& out,
+        MDUpdateAction default_action = MDUpdateAction::New) noexcept {
+    out.clear();
+    detail::MDColumnsVisitor<Capacity> visitor{out, default_action};
+    return decoder.decode(data, visitor);
+}
+
+/// Decode one FAST market data message into MDEntry rows. String fields
+/// point into the decoder and stay valid until its next decode().
+/// @param count Rows written (entries past out.size() are dropped)
+[[nodiscard]] NFX_HOT inline FastResult<size_t> decode_md_entries(
+        Decoder& decoder, std::span<const char> data, std::span<MDEntry> out, size_t& count,
+        MDUpdateAction default_action = MDUpdateAction::New) noexcept {
+    detail::MDEntriesVisitor visitor{out, default_action};
+    auto consumed = decoder.decode(data, visitor);
+    count = visitor.count;
+    if (!visitor.symbol.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            if (out[i].symbol.empty()) out[i].symbol = visitor.symbol;
+        }
+    }
+    return consumed;
+}
+
+} // namespace nfx::fast
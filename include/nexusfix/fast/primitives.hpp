@@ -0,0 +1,265 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace nfx::fast {
+
+// ============================================================================
+// FAST Errors
+// ============================================================================
+
+enum class FastError : uint8_t {
+    None = 0,
+    Truncated,           // Input ends inside an entity
+    Overlong,            // Integer or presence map longer than its type allows
+    UnknownTemplate,     // Template ID not registered
+    MandatoryAbsent,     // Mandatory field with no value and no initial value (D5/D6)
+    TextTooLong,         // String longer than the dictionary or message arena holds
+    UnsupportedOperator  // Operator not defined for the field type
+};
+
+template <typename T>
+using FastResult = std::expected<T, FastError>;
+
+// ============================================================================
+// Stop-Bit Decoding
+// ============================================================================
+// Every FAST entity is a run of bytes whose last byte has bit 7 set; the
+// other 7 bits of each byte carry data, most significant group first.
+
+inline constexpr uint8_t STOP_BIT = 0x80;
+inline constexpr size_t MAX_UINT64_BYTES = 10;   // ceil(64 / 7)
+
+namespace detail {
+
+/// Bytes up to and including the first stop bit within the next 8 bytes
+/// of word (loaded little-endian), 0 if there is none
+[[nodiscard]] NFX_FORCE_INLINE size_t stop_bit_length(uint64_t word) noexcept {
+    const uint64_t stops = word & 0x8080808080808080ULL;
+    return stops == 0 ? 0 : static_cast<size_t>(std::countr_zero(stops)) / 8 + 1;
+}
+
+/// Concatenate the 7-bit groups of the first n (1..8) bytes of word
+[[nodiscard]] NFX_FORCE_INLINE uint64_t compact_groups(uint64_t word, size_t n) noexcept {
+    // First byte becomes the most significant group
+    uint64_t x = std::byteswap(word) >> (8 * (8 - n));
+#if defined(__BMI2__)
+    return _pext_u64(x, 0x7F7F7F7F7F7F7F7FULL);
+#else
+    x &= 0x7F7F7F7F7F7F7F7FULL;
+    x = (x & 0x007F007F007F007FULL) | ((x & 0x7F007F007F007F00ULL) >> 1);
+    x = (x & 0x00003FFF00003FFFULL) | ((x & 0x3FFF00003FFF0000ULL) >> 2);
+    x = (x & 0x000000000FFFFFFFULL) | ((x & 0x0FFFFFFF00000000ULL) >> 4);
+    return x;
+#endif
+}
+
+} // namespace detail
+
+/// Offset of the first byte with the stop bit set at or after pos
+/// (data.size() if none)
+[[nodiscard]] NFX_HOT inline size_t find_stop_bit(std::span<const char> data, size_t pos) noexcept {
+    const char* p = data.data();
+    const size_t size = data.size();
+#if defined(__SSE2__)
+    while (pos + 16 <= size) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + pos));
+        const int mask = _mm_movemask_epi8(v);   // Bit 7 of every byte
+        if (mask != 0) return pos + static_cast<size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+        pos += 16;
+    }
+#endif
+    while (pos + 8 <= size) {
+        uint64_t word;
+        std::memcpy(&word, p + pos, sizeof(word));
+        if (const size_t n = detail::stop_bit_length(word); n != 0) return pos + n - 1;
+        pos += 8;
+    }
+    for (; pos < size; ++pos) {
+        if (static_cast<uint8_t>(p[pos]) & STOP_BIT) return pos;
+    }
+    return size;
+}
+
+// ============================================================================
+// Stream Reader
+// ============================================================================
+
+/// Cursor over one FAST message's bytes. Integers of up to 8 bytes (56
+/// bits, every realistic price, size and sequence number) are decoded from
+/// a single 8-byte load: the stop bit is located and the 7-bit groups are
+/// compacted in a register, without a per-byte loop.
+class Reader {
+public:
+    constexpr Reader() noexcept = default;
+    constexpr explicit Reader(std::span<const char> data) noexcept : data_{data} {}
+
+    [[nodiscard]] constexpr size_t position() const noexcept { return pos_; }
+    [[nodiscard]] constexpr size_t remaining() const noexcept { return data_.size() - pos_; }
+    [[nodiscard]] constexpr bool at_end() const noexcept { return pos_ >= data_.size(); }
+
+    /// Raw unsigned stop-bit value
+    /// @param bytes_out Encoded length (sign extension needs it)
+    [[nodiscard]] NFX_HOT FastResult<uint64_t> read_raw(size_t& bytes_out) noexcept {
+        const char* p = data_.data() + pos_;
+        if (remaining() >= 8) [[likely]] {
+            uint64_t word;
+            std::memcpy(&word, p, sizeof(word));
+            if (const size_t n = detail::stop_bit_length(word); n != 0) [[likely]] {
+                pos_ += n;
+                bytes_out = n;
+                return detail::compact_groups(word, n);
+            }
+        }
+
+        // Tail of the buffer, or 9-10 byte values
+        uint64_t value = 0;
+        for (size_t i = 0; i < MAX_UINT64_BYTES; ++i) {
+            if (pos_ + i >= data_.size()) [[unlikely]] {
+                return std::unexpected{FastError::Truncated};
+            }
+            const auto byte = static_cast<uint8_t>(p[i]);
+            value = (value << 7) | (byte & 0x7F);
+            if (byte & STOP_BIT) {
+                pos_ += i + 1;
+                bytes_out = i + 1;
+                return value;
+            }
+        }
+        return std::unexpected{FastError::Overlong};
+    }
+
+    /// Unsigned integer
+    [[nodiscard]] NFX_HOT FastResult<uint64_t> read_uint() noexcept {
+        size_t n;
+        return read_raw(n);
+    }
+
+    /// Signed integer (two's complement, sign in bit 6 of the first byte)
+    [[nodiscard]] NFX_HOT FastResult<int64_t> read_int() noexcept {
+        size_t n;
+        auto raw = read_raw(n);
+        if (!raw) [[unlikely]] return std::unexpected{raw.error()};
+        const size_t bits = 7 * n;
+        uint64_t value = *raw;
+        if (bits < 64 && (value >> (bits - 1)) & 1) {
+            value |= ~uint64_t{0} << bits;   // Sign-extend
+        }
+        return static_cast<int64_t>(value);
+    }
+
+    /// Nullable unsigned integer: 0 encodes null, others are value + 1
+    /// @return false in present when null
+    [[nodiscard]] NFX_HOT FastResult<uint64_t> read_nullable_uint(bool& present) noexcept {
+        auto value = read_uint();
+        if (!value) [[unlikely]] return value;
+        present = *value != 0;
+        return present ? *value - 1 : 0;
+    }
+
+    /// Nullable signed integer: 0 encodes null, non-negative values are + 1
+    [[nodiscard]] NFX_HOT FastResult<int64_t> read_nullable_int(bool& present) noexcept {
+        auto value = read_int();
+        if (!value) [[unlikely]] return value;
+        present = *value != 0;
+        return *value > 0 ? *value - 1 : *value;
+    }
+
+    /// ASCII string, copied with the stop bit cleared
+    /// @param nullable Optional field: 0x80 is null and 0x00 0x80 empty
+    /// @return Length written to out (present false when null)
+    [[nodiscard]] NFX_HOT FastResult<size_t> read_ascii(std::span<char> out, bool nullable,
+                                                        bool& present) noexcept {
+        const size_t stop = find_stop_bit(data_, pos_);
+        if (stop >= data_.size()) [[unlikely]] return std::unexpected{FastError::Truncated};
+
+        const char* p = data_.data() + pos_;
+        const size_t len = stop - pos_ + 1;
+        pos_ = stop + 1;
+        present = true;
+
+        if (static_cast<uint8_t>(p[0]) == STOP_BIT) {   // Empty (mandatory) or null (optional)
+            present = !nullable;
+            return size_t{0};
+        }
+        if (p[0] == 0 && len == 2 && static_cast<uint8_t>(p[1]) == STOP_BIT) {
+            return size_t{0};                             // Empty string, 0x00 0x80
+        }
+        if (len > out.size()) [[unlikely]] return std::unexpected{FastError::TextTooLong};
+        std::memcpy(out.data(), p, len);
+        out[len - 1] = static_cast<char>(static_cast<uint8_t>(out[len - 1]) & 0x7F);
+        return len;
+    }
+
+    /// Byte vector: stop-bit length, then raw bytes (a view into the input)
+    [[nodiscard]] FastResult<std::span<const char>> read_bytes(bool nullable, bool& present) noexcept {
+        present = true;
+        auto len = nullable ? read_nullable_uint(present) : read_uint();
+        if (!len) [[unlikely]] return std::unexpected{len.error()};
+        if (!present) return std::span<const char>{};
+        if (*len > remaining()) [[unlikely]] return std::unexpected{FastError::Truncated};
+        const std::span<const char> bytes = data_.subspan(pos_, static_cast<size_t>(*len));
+        pos_ += static_cast<size_t>(*len);
+        return bytes;
+    }
+
+private:
+    std::span<const char> data_{};
+    size_t pos_{0};
+};
+
+// ============================================================================
+// Presence Map
+// ============================================================================
+
+/// Presence map bits, most significant first; bits past the encoded ones
+/// read as 0 (trailing zero bytes may be omitted on the wire)
+class PresenceMap {
+public:
+    static constexpr size_t MAX_BYTES = 9;   // 63 bits
+
+    constexpr PresenceMap() noexcept = default;
+
+    [[nodiscard]] NFX_HOT static FastResult<PresenceMap> read(Reader& reader) noexcept {
+        size_t n;
+        auto bits = reader.read_raw(n);
+        if (!bits) [[unlikely]] {
+            return std::unexpected{bits.error()};
+        }
+        if (n > MAX_BYTES) [[unlikely]] {
+            return std::unexpected{FastError::Overlong};
+        }
+        PresenceMap pmap;
+        pmap.bits_ = *bits;
+        pmap.count_ = static_cast<uint8_t>(7 * n);
+        return pmap;
+    }
+
+    /// Next bit (false once the encoded bits are used up)
+    [[nodiscard]] NFX_FORCE_INLINE bool next() noexcept {
+        if (used_ >= count_) return false;
+        return (bits_ >> (count_ - 1 - used_++)) & 1;
+    }
+
+private:
+    uint64_t bits_{0};
+    uint8_t count_{0};
+    uint8_t used_{0};
+};
+
+} // namespace nfx::fast
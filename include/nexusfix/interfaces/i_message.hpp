@@ -40,6 +40,9 @@ inline constexpr char MarketDataRequest = 'V';
 inline constexpr char MarketDataSnapshotFullRefresh = 'W';
 inline constexpr char MarketDataIncrementalRefresh = 'X';
 inline constexpr char MarketDataRequestReject = 'Y';
+// Quoting Messages
+inline constexpr char MassQuoteAcknowledgement = 'b';
+inline constexpr char MassQuote        = 'i';
 
 // ============================================================================
 // Compile-time Message Type Info (TICKET_022)
@@ -160,6 +163,18 @@ template<> struct MsgTypeInfo<'Y'> {  // MarketDataRequestReject
     static constexpr bool is_valid = true;
 };
 
+template<> struct MsgTypeInfo<'b'> {  // MassQuoteAcknowledgement
+    static constexpr std::string_view name = "MassQuoteAcknowledgement";
+    static constexpr bool is_admin = false;
+    static constexpr bool is_valid = true;
+};
+
+template<> struct MsgTypeInfo<'i'> {  // MassQuote
+    static constexpr std::string_view name = "MassQuote";
+    static constexpr bool is_admin = false;
+    static constexpr bool is_valid = true;
+};
+
 // ============================================================================
 // Compile-time lookup table generation
 // ============================================================================
@@ -197,6 +212,8 @@ consteval std::array<MsgTypeEntry, 128> create_lookup_table() {
     table['W'] = {MsgTypeInfo<'W'>::name, MsgTypeInfo<'W'>::is_admin, true};
     table['X'] = {MsgTypeInfo<'X'>::name, MsgTypeInfo<'X'>::is_admin, true};
     table['Y'] = {MsgTypeInfo<'Y'>::name, MsgTypeInfo<'Y'>::is_admin, true};
+    table['b'] = {MsgTypeInfo<'b'>::name, MsgTypeInfo<'b'>::is_admin, true};
+    table['i'] = {MsgTypeInfo<'i'>::name, MsgTypeInfo<'i'>::is_admin, true};
 
     return table;
 }
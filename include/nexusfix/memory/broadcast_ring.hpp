@@ -0,0 +1,314 @@
+/*
+    NexusFIX Broadcast Ring
+
+    Single-producer, multi-consumer ring in the style of the LMAX Disruptor:
+    every consumer sees every entry, in order, read in place from the ring.
+    One write serves all subscribers - no per-consumer queue, no copies.
+
+    Design:
+    - Producer publishes by advancing one cursor (release store)
+    - Each consumer advances its own cursor, each on its own cache line
+      (PaddedSequence), so consumers never contend with each other
+    - The producer may overwrite an entry only once every attached consumer
+      has moved past it; the slowest consumer gates the ring
+    - Slow consumers are visible through lag()/slowest() and can be
+      detached, which stops them from gating the producer
+
+    The producer caches the slowest cursor and rescans only when the ring
+    looks full; a consumer re-reads the published cursor only when its
+    cached view holds fewer entries than it asked for.
+
+    Use case: one MarketData feed thread -> N strategy threads.
+
+    Usage:
+        BroadcastRing<BookUpdate, 4096, 8> ring;
+        auto id = ring.subscribe();                       // before publishing
+        // Producer
+        if (BookUpdate* slot = ring.try_claim()) { *slot = update; ring.publish(); }
+        // Consumer
+        ring.poll(*id, [](const BookUpdate& u, size_t seq) { ... });
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+#include "nexusfix/memory/cache_line.hpp"
+#include "nexusfix/memory/mpsc_queue.hpp"   // PaddedSequence
+#include "nexusfix/memory/wait_strategy.hpp"
+
+namespace nfx::memory {
+
+// ============================================================================
+// Broadcast Ring
+// ============================================================================
+
+/// Lock-free one-writer, N-reader multicast ring
+/// @tparam T Entry type
+/// @tparam Capacity Entries in the ring (power of 2)
+/// @tparam MaxConsumers Subscriber slots
+/// @tparam WaitStrategyT Wait strategy for the blocking publish()
+template<typename T,
+         size_t Capacity,
+         size_t MaxConsumers = 16,
+         typename WaitStrategyT = BusySpinWait>
+class BroadcastRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be power of 2");
+    static_assert(Capacity >= 2, "Capacity must be at least 2");
+    static_assert(MaxConsumers >= 1, "At least one consumer slot");
+    static_assert(WaitStrategy<WaitStrategyT>, "Invalid wait strategy");
+
+public:
+    using value_type = T;
+    using ConsumerId = size_t;
+
+    BroadcastRing() noexcept {
+        for (auto& cursor : cursors_) {
+            cursor.value.store(DETACHED, std::memory_order_relaxed);
+        }
+    }
+
+    // Non-copyable, non-movable
+    BroadcastRing(const BroadcastRing&) = delete;
+    BroadcastRing& operator=(const BroadcastRing&) = delete;
+    BroadcastRing(BroadcastRing&&) = delete;
+    BroadcastRing& operator=(BroadcastRing&&) = delete;
+
+    // ========================================================================
+    // Subscription (any thread)
+    // ========================================================================
+
+    /// Attach a consumer; it receives entries published from now on.
+    /// Subscribe before the producer starts to be sure to see everything.
+    /// @return nullopt when all MaxConsumers slots are taken
+    [[nodiscard]] std::optional<ConsumerId> subscribe() noexcept {
+        for (size_t i = 0; i < MaxConsumers; ++i) {
+            bool expected = false;
+            if (taken_[i].compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                const size_t start = published_.value.load(std::memory_order_acquire);
+                locals_[i].cursor = start;
+                locals_[i].cached_published = start;
+                cursors_[i].value.store(start, std::memory_order_release);
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// Detach a consumer and free its slot (consumer thread, or once it stopped)
+    void unsubscribe(ConsumerId id) noexcept {
+        if (id >= MaxConsumers) return;
+        cursors_[id].value.store(DETACHED, std::memory_order_release);
+        taken_[id].store(false, std::memory_order_release);
+    }
+
+    // ========================================================================
+    // Producer Interface (single thread only)
+    // ========================================================================
+
+    /// Slot for the next entry, written in place before publish()
+    /// @return nullptr while the slowest consumer still needs that slot
+    [[nodiscard]] T* try_claim() noexcept {
+        const size_t seq = next_;
+        if (seq - gate_ >= Capacity) {
+            gate_ = min_cursor(seq);
+            if (seq - gate_ >= Capacity) return nullptr;
+        }
+        return &buffer_[seq & mask_];
+    }
+
+    /// Make the claimed entry visible to all consumers
+    void publish() noexcept {
+        ++next_;
+        published_.value.store(next_, std::memory_order_release);
+        notify_waiters<WaitStrategyT>();
+    }
+
+    /// Copy an entry in and publish it
+    /// @return false if the ring is full (back-pressure from the slowest consumer)
+    [[nodiscard]] bool try_publish(const T& item) noexcept {
+        T* slot = try_claim();
+        if (!slot) return false;
+        *slot = item;
+        publish();
+        return true;
+    }
+
+    /// Publish, waiting while the ring is full
+    void publish(const T& item) noexcept {
+        if (try_publish(item)) [[likely]] return;
+        WaitStrategyT::wait_until([&] { return try_publish(item); });
+    }
+
+    /// Detach every consumer lagging by at least max_lag entries.
+    /// A detached consumer no longer gates the producer; its next poll()
+    /// returns nothing and detached() reports it. Entries it was reading
+    /// at that moment may be overwritten: use for consumers that stalled.
+    /// @return Number of consumers detached
+    size_t detach_slow(size_t max_lag) noexcept {
+        const size_t head = published_.value.load(std::memory_order_relaxed);
+        size_t detached_count = 0;
+        for (size_t i = 0; i < MaxConsumers; ++i) {
+            size_t cursor = cursors_[i].value.load(std::memory_order_acquire);
+            if (cursor == DETACHED || head - cursor < max_lag) continue;
+            // Fails if the consumer advanced in the meantime
+            if (cursors_[i].value.compare_exchange_strong(cursor, DETACHED,
+                                                          std::memory_order_acq_rel)) {
+                ++detached_count;
+            }
+        }
+        gate_ = min_cursor(next_);
+        return detached_count;
+    }
+
+    // ========================================================================
+    // Consumer Interface (one thread per ConsumerId)
+    // ========================================================================
+
+    /// Deliver up to max_count entries in place: handler(const T&, size_t seq).
+    /// The consumer's cursor moves past them once the handler returns.
+    /// @return Entries delivered
+    template<typename Handler>
+    size_t poll(ConsumerId id, Handler&& handler,
+                size_t max_count = std::numeric_limits<size_t>::max()) noexcept {
+        ConsumerLocal& local = locals_[id];
+        const size_t cursor = local.cursor;
+
+        size_t available = local.cached_published - cursor;
+        if (available < max_count) {
+            local.cached_published = published_.value.load(std::memory_order_acquire);
+            available = local.cached_published - cursor;
+            if (available == 0) return 0;
+        }
+
+        size_t expected = cursor;
+        if (cursors_[id].value.load(std::memory_order_relaxed) != expected) {
+            return 0;  // Detached
+        }
+
+        const size_t n = available < max_count ? available : max_count;
+        for (size_t i = 0; i < n; ++i) {
+            handler(static_cast<const T&>(buffer_[(cursor + i) & mask_]), cursor + i);
+        }
+
+        // CAS so a detached consumer cannot re-attach itself by advancing
+        if (!cursors_[id].value.compare_exchange_strong(expected, cursor + n,
+                                                        std::memory_order_acq_rel)) {
+            return 0;
+        }
+        local.cursor = cursor + n;
+        notify_waiters<WaitStrategyT>();   // A blocked publish() may proceed
+        return n;
+    }
+
+    /// Next entry without consuming it, or nullptr
+    [[nodiscard]] const T* peek(ConsumerId id) noexcept {
+        ConsumerLocal& local = locals_[id];
+        if (local.cached_published == local.cursor) {
+            local.cached_published = published_.value.load(std::memory_order_acquire);
+            if (local.cached_published == local.cursor) return nullptr;
+        }
+        if (detached(id)) return nullptr;
+        return &buffer_[local.cursor & mask_];
+    }
+
+    /// Consume the entry returned by peek()
+    /// @return false if the consumer was detached
+    bool advance(ConsumerId id) noexcept {
+        ConsumerLocal& local = locals_[id];
+        size_t expected = local.cursor;
+        if (!cursors_[id].value.compare_exchange_strong(expected, local.cursor + 1,
+                                                        std::memory_order_acq_rel)) {
+            return false;
+        }
+        ++local.cursor;
+        notify_waiters<WaitStrategyT>();
+        return true;
+    }
+
+    // ========================================================================
+    // Status Queries (thread-safe, approximate)
+    // ========================================================================
+
+    [[nodiscard]] bool detached(ConsumerId id) const noexcept {
+        return id >= MaxConsumers ||
+               cursors_[id].value.load(std::memory_order_acquire) == DETACHED;
+    }
+
+    /// Entries published but not yet consumed by a consumer (0 if detached)
+    [[nodiscard]] size_t lag(ConsumerId id) const noexcept {
+        if (id >= MaxConsumers) return 0;
+        const size_t cursor = cursors_[id].value.load(std::memory_order_acquire);
+        if (cursor == DETACHED) return 0;
+        return published_.value.load(std::memory_order_acquire) - cursor;
+    }
+
+    /// Attached consumer with the largest lag
+    [[nodiscard]] std::optional<ConsumerId> slowest() const noexcept {
+        std::optional<ConsumerId> result;
+        size_t worst = 0;
+        for (size_t i = 0; i < MaxConsumers; ++i) {
+            if (detached(i)) continue;
+            const size_t l = lag(i);
+            if (!result || l > worst) {
+                result = i;
+                worst = l;
+            }
+        }
+        return result;
+    }
+
+    /// Entries published so far
+    [[nodiscard]] size_t published() const noexcept {
+        return published_.value.load(std::memory_order_acquire);
+    }
+
+    /// Entries every attached consumer has moved past: anything an entry
+    /// below this points to is no longer read (published() with no consumers)
+    [[nodiscard]] size_t consumed() const noexcept {
+        return min_cursor(published());
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return Capacity; }
+    [[nodiscard]] static constexpr size_t max_consumers() noexcept { return MaxConsumers; }
+
+private:
+    static constexpr size_t mask_ = Capacity - 1;
+    static constexpr size_t DETACHED = std::numeric_limits<size_t>::max();
+
+    /// Lowest cursor of attached consumers (seq itself when there are none)
+    [[nodiscard]] size_t min_cursor(size_t seq) const noexcept {
+        size_t lowest = seq;
+        for (const auto& cursor : cursors_) {
+            const size_t c = cursor.value.load(std::memory_order_acquire);
+            if (c != DETACHED && c < lowest) lowest = c;
+        }
+        return lowest;
+    }
+
+    /// Consumer-private state (written only by that consumer's thread)
+    struct alignas(CACHE_LINE_SIZE) ConsumerLocal {
+        size_t cursor{0};
+        size_t cached_published{0};
+    };
+
+    // Producer side
+    PaddedSequence published_;
+    alignas(CACHE_LINE_SIZE) size_t next_{0};   // Producer's own copy of published_
+    size_t gate_{0};                            // Cached slowest consumer cursor
+
+    // Consumer side
+    std::array<PaddedSequence, MaxConsumers> cursors_{};
+    std::array<ConsumerLocal, MaxConsumers> locals_{};
+    std::array<std::atomic<bool>, MaxConsumers> taken_{};
+
+    // Entries
+    alignas(CACHE_LINE_SIZE) std::array<T, Capacity> buffer_{};
+};
+
+} // namespace nfx::memory
@@ -7,6 +7,11 @@
 #include <array>
 #include <new>
 #include <bit>
+#include <type_traits>
+
+#include "nexusfix/memory/cache_line.hpp"
+#include "nexusfix/memory/huge_page_allocator.hpp"
+#include "nexusfix/memory/remote_free_stack.hpp"
 
 namespace nfx {
 
@@ -14,10 +19,9 @@ namespace nfx {
 // Cache Line Constants
 // ============================================================================
 
-// Use fixed 64-byte cache line size for ABI stability
-// std::hardware_destructive_interference_size is not used due to GCC warning
-// about ABI instability. 64 bytes is the correct value for x86-64.
-inline constexpr size_t CACHE_LINE_SIZE = 64;
+// Fixed 64-byte cache line size for ABI stability, defined once in
+// cache_line.hpp so nfx:: and nfx::memory:: name the same constant
+using memory::CACHE_LINE_SIZE;
 
 // ============================================================================
 // Aligned Buffer for Message Data
@@ -60,21 +64,30 @@ using JumboBuffer = AlignedBuffer<65536>;  // Maximum FIX message size
 #pragma warning(disable: 4324)
 #endif
 
-/// Pool of fixed-size blocks with O(1) allocation (no syscalls on hot path)
-template <size_t BlockSize, size_t NumBlocks>
+/// Pool of fixed-size blocks with O(1) allocation (no syscalls on hot path).
+/// allocate()/deallocate() belong to the owning thread; other threads
+/// return blocks with deallocate_remote(), which the owner reclaims in one
+/// batch when its free list runs dry.
+/// @tparam HugePages Place the blocks in a prefaulted huge-page mapping
+///         (THP fallback) instead of inline; the whole pool then costs a
+///         handful of TLB entries
+template <size_t BlockSize, size_t NumBlocks, bool HugePages = false>
 class alignas(CACHE_LINE_SIZE) FixedPool {
 public:
     static_assert(BlockSize >= sizeof(void*), "Block must hold a pointer");
     static_assert(std::has_single_bit(BlockSize), "Block size should be power of 2");
 
     FixedPool() noexcept {
+        char* base = storage_.data();
+        if (base == nullptr) return;  // Mapping failed: every allocate() fails
+
         // Initialize free list
         for (size_t i = 0; i < NumBlocks - 1; ++i) {
-            *reinterpret_cast<void**>(&storage_[i * BlockSize]) =
-                &storage_[(i + 1) * BlockSize];
+            *reinterpret_cast<void**>(base + i * BlockSize) =
+                base + (i + 1) * BlockSize;
         }
-        *reinterpret_cast<void**>(&storage_[(NumBlocks - 1) * BlockSize]) = nullptr;
-        free_head_ = storage_.data();
+        *reinterpret_cast<void**>(base + (NumBlocks - 1) * BlockSize) = nullptr;
+        free_head_ = base;
     }
 
     // Non-copyable, non-movable (owns fixed storage)
@@ -85,7 +98,7 @@ public:
 
     /// Allocate a block (O(1), no syscall)
     [[nodiscard]] void* allocate() noexcept {
-        if (free_head_ == nullptr) {
+        if (free_head_ == nullptr && reclaim_remote() == 0) {
             return nullptr;  // Pool exhausted
         }
         void* block = free_head_;
@@ -102,21 +115,58 @@ public:
         --allocated_count_;
     }
 
+    /// Return a block from a thread other than the owner (lock-free)
+    void deallocate_remote(void* ptr) noexcept {
+        if (ptr != nullptr) remote_.push(ptr);
+    }
+
+    /// Move remotely returned blocks onto the free list (owner thread)
+    /// @return Blocks reclaimed
+    size_t reclaim_remote() noexcept {
+        size_t count = 0;
+        for (void* block = remote_.take_all(); block != nullptr; ++count) {
+            void* next = memory::RemoteFreeStack::next(block);
+            *reinterpret_cast<void**>(block) = free_head_;
+            free_head_ = block;
+            block = next;
+        }
+        allocated_count_ -= count;
+        return count;
+    }
+
     /// Check if pointer belongs to this pool
     [[nodiscard]] bool owns(const void* ptr) const noexcept {
         const char* p = static_cast<const char*>(ptr);
-        return p >= storage_.data() && p < storage_.data() + storage_.size();
+        const char* base = storage_.data();
+        return base != nullptr && p >= base && p < base + STORAGE_SIZE;
     }
 
     [[nodiscard]] size_t allocated() const noexcept { return allocated_count_; }
-    [[nodiscard]] size_t available() const noexcept { return NumBlocks - allocated_count_; }
+    [[nodiscard]] size_t available() const noexcept {
+        return storage_.data() != nullptr ? NumBlocks - allocated_count_ : 0;
+    }
     [[nodiscard]] static constexpr size_t block_size() noexcept { return BlockSize; }
     [[nodiscard]] static constexpr size_t capacity() noexcept { return NumBlocks; }
 
 private:
-    alignas(CACHE_LINE_SIZE) std::array<char, BlockSize * NumBlocks> storage_{};
+    static constexpr size_t STORAGE_SIZE = BlockSize * NumBlocks;
+
+    struct InlineStorage {
+        alignas(CACHE_LINE_SIZE) std::array<char, STORAGE_SIZE> bytes{};
+        [[nodiscard]] char* data() noexcept { return bytes.data(); }
+        [[nodiscard]] const char* data() const noexcept { return bytes.data(); }
+    };
+
+    struct HugePageStorage {
+        memory::HugePageBuffer buffer{STORAGE_SIZE, memory::HugePageSize::Huge2MB, true};
+        [[nodiscard]] char* data() noexcept { return buffer.as<char>(); }
+        [[nodiscard]] const char* data() const noexcept { return buffer.as<char>(); }
+    };
+
+    std::conditional_t<HugePages, HugePageStorage, InlineStorage> storage_;
     void* free_head_{nullptr};
-    size_t allocated_count_{0};
+    size_t allocated_count_{0};  // Includes remote returns not yet reclaimed
+    memory::RemoteFreeStack remote_;
 };
 
 // ============================================================================
@@ -124,11 +174,16 @@ private:
 // ============================================================================
 
 /// Monotonic buffer resource with pre-allocated backing storage
+/// Past Size bytes allocations go to the upstream resource (by default
+/// none: they throw std::bad_alloc) until reset().
 template <size_t Size>
 class MonotonicPool : public std::pmr::memory_resource {
 public:
     MonotonicPool() noexcept
-        : upstream_{std::pmr::null_memory_resource()}
+        : MonotonicPool{std::pmr::null_memory_resource()} {}
+
+    explicit MonotonicPool(std::pmr::memory_resource* upstream) noexcept
+        : upstream_{upstream}
         , resource_{buffer_.data(), buffer_.size(), upstream_} {}
 
     /// Reset the pool (invalidates all allocations)
@@ -165,7 +220,9 @@ private:
 // ============================================================================
 
 /// Tiered pool for FIX messages of various sizes
-class MessagePool {
+/// @tparam HugePages Back all three tiers with huge pages (see FixedPool)
+template <bool HugePages = false>
+class BasicMessagePool {
 public:
     static constexpr size_t SMALL_SIZE = 256;
     static constexpr size_t MEDIUM_SIZE = 1024;
@@ -175,11 +232,11 @@ public:
     static constexpr size_t MEDIUM_COUNT = 256;
     static constexpr size_t LARGE_COUNT = 64;
 
-    MessagePool() = default;
+    BasicMessagePool() = default;
 
     // Non-copyable, non-movable
-    MessagePool(const MessagePool&) = delete;
-    MessagePool& operator=(const MessagePool&) = delete;
+    BasicMessagePool(const BasicMessagePool&) = delete;
+    BasicMessagePool& operator=(const BasicMessagePool&) = delete;
 
     /// Allocate buffer of at least `size` bytes
     [[nodiscard]] std::span<char> allocate(size_t size) noexcept {
@@ -214,6 +271,18 @@ public:
         }
     }
 
+    /// Return a buffer from a thread other than the pool's owner
+    void deallocate_remote(std::span<char> buffer) noexcept {
+        void* ptr = buffer.data();
+        if (small_pool_.owns(ptr)) {
+            small_pool_.deallocate_remote(ptr);
+        } else if (medium_pool_.owns(ptr)) {
+            medium_pool_.deallocate_remote(ptr);
+        } else if (large_pool_.owns(ptr)) {
+            large_pool_.deallocate_remote(ptr);
+        }
+    }
+
     struct Stats {
         size_t small_allocated;
         size_t small_available;
@@ -235,40 +304,44 @@ public:
     }
 
 private:
-    FixedPool<SMALL_SIZE, SMALL_COUNT> small_pool_;
-    FixedPool<MEDIUM_SIZE, MEDIUM_COUNT> medium_pool_;
-    FixedPool<LARGE_SIZE, LARGE_COUNT> large_pool_;
+    FixedPool<SMALL_SIZE, SMALL_COUNT, HugePages> small_pool_;
+    FixedPool<MEDIUM_SIZE, MEDIUM_COUNT, HugePages> medium_pool_;
+    FixedPool<LARGE_SIZE, LARGE_COUNT, HugePages> large_pool_;
 };
 
+using MessagePool = BasicMessagePool<false>;
+using HugePageMessagePool = BasicMessagePool<true>;
+
 // ============================================================================
 // RAII Buffer Handle
 // ============================================================================
 
 /// RAII wrapper for pooled buffer (returns to pool on destruction)
-class PooledBuffer {
+template <typename Pool>
+class BasicPooledBuffer {
 public:
-    PooledBuffer() noexcept : pool_{nullptr}, buffer_{} {}
+    BasicPooledBuffer() noexcept : pool_{nullptr}, buffer_{} {}
 
-    PooledBuffer(MessagePool& pool, std::span<char> buf) noexcept
+    BasicPooledBuffer(Pool& pool, std::span<char> buf) noexcept
         : pool_{&pool}, buffer_{buf} {}
 
-    ~PooledBuffer() {
+    ~BasicPooledBuffer() {
         if (pool_ && !buffer_.empty()) {
             pool_->deallocate(buffer_);
         }
     }
 
     // Move-only
-    PooledBuffer(const PooledBuffer&) = delete;
-    PooledBuffer& operator=(const PooledBuffer&) = delete;
+    BasicPooledBuffer(const BasicPooledBuffer&) = delete;
+    BasicPooledBuffer& operator=(const BasicPooledBuffer&) = delete;
 
-    PooledBuffer(PooledBuffer&& other) noexcept
+    BasicPooledBuffer(BasicPooledBuffer&& other) noexcept
         : pool_{other.pool_}, buffer_{other.buffer_} {
         other.pool_ = nullptr;
         other.buffer_ = {};
     }
 
-    PooledBuffer& operator=(PooledBuffer&& other) noexcept {
+    BasicPooledBuffer& operator=(BasicPooledBuffer&& other) noexcept {
         if (this != &other) {
             if (pool_ && !buffer_.empty()) {
                 pool_->deallocate(buffer_);
@@ -291,10 +364,13 @@ public:
     [[nodiscard]] explicit operator bool() const noexcept { return !empty(); }
 
 private:
-    MessagePool* pool_;
+    Pool* pool_;
     std::span<char> buffer_;
 };
 
+using PooledBuffer = BasicPooledBuffer<MessagePool>;
+using HugePagePooledBuffer = BasicPooledBuffer<HugePageMessagePool>;
+
 #if defined(_MSC_VER)
 #pragma warning(pop)
 #endif
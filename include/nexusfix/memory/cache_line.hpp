@@ -0,0 +1,15 @@
+#pragma once
+
+/// @file cache_line.hpp
+/// @brief Cache line size shared by the lock-free memory primitives
+
+#include <cstddef>
+
+namespace nfx::memory {
+
+// Fixed 64 bytes: GCC warns (-Winterference-size) that
+// std::hardware_destructive_interference_size is not ABI-stable.
+// nfx::CACHE_LINE_SIZE (buffer_pool.hpp) is an alias of this constant.
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+} // namespace nfx::memory
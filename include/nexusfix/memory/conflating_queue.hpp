@@ -0,0 +1,173 @@
+/*
+    NexusFIX Conflating Queue
+
+    Latest-value-per-key handoff from one producer (the market data thread)
+    to one slow consumer (a strategy). A burst of updates for one symbol
+    leaves one pending entry holding the newest value, never a backlog of
+    stale increments, so memory and drain time stay bounded by the number
+    of keys no matter how far the consumer falls behind.
+
+    Design:
+    - One slot per SymbolId: a dirty flag and a Seqlock holding the value.
+      publish() overwrites the value in place; readers never block it
+    - Keys that turn dirty are pushed once onto an SPSC ring of ids, so
+      drain() visits only dirty keys, oldest first, and never scans
+    - A key is on the ring at most once, so the ring (MaxKeys ids) cannot
+      overflow and publish() never waits
+    - drain() clears the flag before reading the value: an update racing
+      the read either lands in that read or re-queues the key
+
+    absorb() bridges a BroadcastRing consumer: the bridge keeps its ring
+    cursor moving at feed speed and hands the strategy conflated values,
+    so a slow strategy never gates the ring's producer.
+
+    Usage:
+        ConflatingQueue<book::TopOfBook, 1024> queue;    // Allocate once
+        // Market data thread, after applying a message
+        queue.publish(symbol_id, book->top());
+        // Strategy thread
+        queue.drain([](SymbolId id, const book::TopOfBook& top) { ... });
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "nexusfix/memory/cache_line.hpp"
+#include "nexusfix/memory/seqlock.hpp"
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/util/symbol_table.hpp"   // SymbolId
+
+namespace nfx::memory {
+
+// ============================================================================
+// Conflating Queue
+// ============================================================================
+
+/// Single-producer, single-consumer queue keeping the newest value per key
+/// @tparam T Value type (trivially copyable, as Seqlock)
+/// @tparam MaxKeys Keys 0..MaxKeys-1 (dense SymbolIds)
+template<typename T, size_t MaxKeys>
+    requires std::is_trivially_copyable_v<T>
+class ConflatingQueue {
+    static_assert(MaxKeys >= 1, "At least one key");
+    static_assert(MaxKeys < SymbolId::INVALID, "Keys must fit a SymbolId");
+
+public:
+    using value_type = T;
+
+    ConflatingQueue() noexcept = default;
+
+    // Non-copyable, non-movable
+    ConflatingQueue(const ConflatingQueue&) = delete;
+    ConflatingQueue& operator=(const ConflatingQueue&) = delete;
+    ConflatingQueue(ConflatingQueue&&) = delete;
+    ConflatingQueue& operator=(ConflatingQueue&&) = delete;
+
+    // ========================================================================
+    // Producer Interface (single thread only)
+    // ========================================================================
+
+    /// Make value the key's pending update, replacing any not yet drained
+    /// @return false if the key is out of range
+    NFX_HOT bool publish(SymbolId key, const T& value) noexcept {
+        if (key.value >= MaxKeys) [[unlikely]] return false;
+        Slot& slot = slots_[key.value];
+        slot.value.write(value);
+
+        // Pairs with drain()'s exchange: whichever side sees the other's
+        // flag also sees the value written before it
+        if (slot.dirty.exchange(true, std::memory_order_acq_rel)) {
+            conflated_.store(conflated_.load(std::memory_order_relaxed) + 1,
+                             std::memory_order_relaxed);
+        } else {
+            // Cannot fail: a key is queued at most once
+            (void)dirty_.try_push(key.value);
+        }
+        published_.store(published_.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+        return true;
+    }
+
+    /// Drain a BroadcastRing consumer: every entry is published under
+    /// key_of(entry); only the newest per key reaches the drain side
+    /// @return Entries taken from the ring
+    template<typename Ring, typename KeyOf>
+    size_t absorb(Ring& ring, typename Ring::ConsumerId id, KeyOf&& key_of,
+                  size_t max_count = std::numeric_limits<size_t>::max()) noexcept {
+        return ring.poll(id, [&](const T& entry, size_t) {
+            (void)publish(key_of(entry), entry);
+        }, max_count);
+    }
+
+    // ========================================================================
+    // Consumer Interface (single thread only)
+    // ========================================================================
+
+    /// Deliver the newest value of up to max_keys dirty keys:
+    /// handler(SymbolId, const T&), in the order the keys turned dirty
+    /// @return Keys delivered
+    template<typename Handler>
+    size_t drain(Handler&& handler,
+                 size_t max_keys = std::numeric_limits<size_t>::max()) noexcept {
+        size_t delivered = 0;
+        uint32_t key = 0;
+        while (delivered < max_keys && dirty_.try_pop(key)) {
+            Slot& slot = slots_[key];
+            slot.dirty.exchange(false, std::memory_order_acq_rel);
+            const T value = slot.value.read();
+            handler(SymbolId{key}, value);
+            ++delivered;
+        }
+        return delivered;
+    }
+
+    // ========================================================================
+    // Status Queries (any thread)
+    // ========================================================================
+
+    /// Newest value published for a key, pending or not (T{} if never)
+    [[nodiscard]] T latest(SymbolId key) const noexcept {
+        return key.value < MaxKeys ? slots_[key.value].value.read() : T{};
+    }
+
+    /// Keys waiting to be drained (approximate from other threads)
+    [[nodiscard]] size_t pending() const noexcept { return dirty_.size_approx(); }
+
+    /// Updates accepted by publish()
+    [[nodiscard]] uint64_t published() const noexcept {
+        return published_.load(std::memory_order_relaxed);
+    }
+
+    /// Updates that replaced one not yet drained
+    [[nodiscard]] uint64_t conflated() const noexcept {
+        return conflated_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static constexpr size_t max_keys() noexcept { return MaxKeys; }
+
+private:
+    /// Per-key state; the flag and the seqlock each own their lines
+    struct Slot {
+        alignas(CACHE_LINE_SIZE) std::atomic<bool> dirty{false};
+        Seqlock<T> value;
+    };
+
+    // One spare slot: the SPSC ring holds Capacity - 1 entries
+    SPSCQueue<uint32_t, std::bit_ceil(MaxKeys + 1)> dirty_;
+
+    // Producer-written counters
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> published_{0};
+    std::atomic<uint64_t> conflated_{0};
+
+    std::array<Slot, MaxKeys> slots_{};
+};
+
+} // namespace nfx::memory
@@ -0,0 +1,288 @@
+/*
+    NexusFIX Epoch-Based Reclamation (EBR)
+
+    Lets readers on other cores walk shared, read-mostly structures (a
+    message store index, book snapshots, receive buffers held for handoff)
+    without locks, while the owner unlinks and later frees old versions.
+
+    Design:
+    - A global epoch; each registered thread publishes the epoch it is
+      pinned in (or QUIESCENT) in its own cache line, so pinning touches
+      no shared line besides one load of the global epoch
+    - Readers pin for the duration of a read (Guard, nestable)
+    - Writers unlink an object, then retire() it with the current epoch
+      into a thread-private list - no atomics per retire
+    - Every BatchSize retires the thread tries to advance the epoch (all
+      pinned threads have seen it) and frees what was retired two epochs
+      ago: no reader can still hold a pointer to it
+
+    A thread that unregisters hands its unreclaimed objects to the domain;
+    any later collect() or the domain's destructor frees them.
+
+    Usage:
+        EpochDomain<> domain;
+        auto me = domain.register_thread();        // Once per thread
+
+        // Reader
+        {
+            auto guard = me->pin();
+            const Snapshot* s = shared.load(std::memory_order_acquire);
+            use(*s);                                // Safe until guard ends
+        }
+
+        // Writer
+        const Snapshot* old = shared.exchange(fresh, std::memory_order_acq_rel);
+        me->retire(old);                            // Freed once unreachable
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "nexusfix/memory/cache_line.hpp"
+
+namespace nfx::memory {
+
+// ============================================================================
+// Epoch Domain
+// ============================================================================
+
+/// Epoch-based reclamation domain shared by up to MaxThreads threads
+/// @tparam MaxThreads Registered threads at once
+/// @tparam BatchSize Retires between reclamation attempts
+template<size_t MaxThreads = 64, size_t BatchSize = 64>
+class EpochDomain {
+    static_assert(MaxThreads >= 1, "At least one thread slot");
+    static_assert(BatchSize >= 1, "Batch must hold at least one object");
+
+public:
+    using Deleter = void (*)(void*);
+
+private:
+    struct Retired {
+        void* ptr;
+        Deleter deleter;
+        uint64_t epoch;
+    };
+
+public:
+    /// A thread's membership in the domain (one per thread, not shared)
+    class Participant;
+
+    /// Pins the owning thread in the current epoch while alive
+    class Guard {
+    public:
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        Guard(Guard&& other) noexcept : owner_{other.owner_} { other.owner_ = nullptr; }
+        Guard& operator=(Guard&&) = delete;
+
+        ~Guard() {
+            if (owner_) owner_->unpin();
+        }
+
+    private:
+        friend class Participant;
+        explicit Guard(Participant* owner) noexcept : owner_{owner} {}
+
+        Participant* owner_;
+    };
+
+    class Participant {
+    public:
+        Participant(const Participant&) = delete;
+        Participant& operator=(const Participant&) = delete;
+
+        Participant(Participant&& other) noexcept
+            : domain_{other.domain_}
+            , slot_{other.slot_}
+            , depth_{other.depth_}
+            , retired_{std::move(other.retired_)}
+            , since_collect_{other.since_collect_} {
+            other.domain_ = nullptr;
+        }
+        Participant& operator=(Participant&&) = delete;
+
+        ~Participant() {
+            if (domain_) domain_->unregister(slot_, retired_);
+        }
+
+        /// Enter a read-side critical section (nestable); the Participant
+        /// must not move while a Guard is alive
+        [[nodiscard]] Guard pin() noexcept {
+            if (depth_++ == 0) domain_->enter(slot_);
+            return Guard{this};
+        }
+
+        [[nodiscard]] bool pinned() const noexcept { return depth_ > 0; }
+
+        /// Free ptr with deleter once no reader pinned now can reach it.
+        /// The object must already be unreachable for new readers.
+        void retire(void* ptr, Deleter deleter) {
+            retired_.push_back(Retired{ptr, deleter, domain_->epoch()});
+            if (++since_collect_ >= BatchSize) collect();
+        }
+
+        /// retire() with `delete`
+        template<typename T>
+        void retire(T* ptr) {
+            retire(const_cast<void*>(static_cast<const void*>(ptr)),
+                   [](void* p) { delete static_cast<T*>(p); });
+        }
+
+        /// Try to advance the epoch and free what is safe now
+        /// @return Objects freed
+        size_t collect() noexcept {
+            since_collect_ = 0;
+            (void)domain_->try_advance();
+            return domain_->reclaim(retired_) + domain_->reclaim_orphans();
+        }
+
+        /// Retired objects not yet freed
+        [[nodiscard]] size_t pending() const noexcept { return retired_.size(); }
+
+    private:
+        friend class EpochDomain;
+        friend class Guard;
+
+        Participant(EpochDomain* domain, size_t slot) noexcept
+            : domain_{domain}, slot_{slot} {
+            retired_.reserve(BatchSize * 2);
+        }
+
+        void unpin() noexcept {
+            if (--depth_ == 0) domain_->leave(slot_);
+        }
+
+        EpochDomain* domain_;
+        size_t slot_;
+        uint32_t depth_{0};
+        std::vector<Retired> retired_;
+        size_t since_collect_{0};
+    };
+
+    EpochDomain() noexcept = default;
+
+    /// Frees everything still retired; no thread may be registered
+    ~EpochDomain() {
+        for (const auto& r : orphans_) r.deleter(r.ptr);
+    }
+
+    // Non-copyable, non-movable (participants point back here)
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    /// Join the domain (any thread)
+    /// @return nullopt when all MaxThreads slots are taken
+    [[nodiscard]] std::optional<Participant> register_thread() noexcept {
+        for (size_t i = 0; i < MaxThreads; ++i) {
+            bool expected = false;
+            if (slots_[i].taken.compare_exchange_strong(expected, true,
+                                                        std::memory_order_acq_rel)) {
+                return Participant{this, i};
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// Current global epoch
+    [[nodiscard]] uint64_t epoch() const noexcept {
+        return global_.load(std::memory_order_acquire);
+    }
+
+    /// Advance the global epoch if every pinned thread has observed it
+    /// @return true if the epoch moved
+    bool try_advance() noexcept {
+        uint64_t current = global_.load(std::memory_order_acquire);
+        for (const auto& slot : slots_) {
+            const uint64_t seen = slot.epoch.load(std::memory_order_acquire);
+            if (seen != QUIESCENT && seen != current) return false;
+        }
+        return global_.compare_exchange_strong(current, current + 1,
+                                               std::memory_order_acq_rel);
+    }
+
+    /// Objects handed over by threads that unregistered, not yet freed
+    [[nodiscard]] size_t orphaned() const {
+        std::lock_guard lock{orphan_mutex_};
+        return orphans_.size();
+    }
+
+private:
+    static constexpr uint64_t QUIESCENT = std::numeric_limits<uint64_t>::max();
+
+    /// Epochs between retire and free: a reader pinned in the retire
+    /// epoch keeps the global epoch from passing retire + 1
+    static constexpr uint64_t GRACE_EPOCHS = 2;
+
+    /// One thread's pinned epoch, alone in its cache line
+    struct alignas(CACHE_LINE_SIZE) Slot {
+        std::atomic<uint64_t> epoch{QUIESCENT};
+        std::atomic<bool> taken{false};
+    };
+
+    void enter(size_t slot) noexcept {
+        // The store must be visible before the reads it protects: a
+        // seq_cst fence pairs with try_advance()'s scan
+        slots_[slot].epoch.store(global_.load(std::memory_order_relaxed),
+                                 std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    void leave(size_t slot) noexcept {
+        slots_[slot].epoch.store(QUIESCENT, std::memory_order_release);
+    }
+
+    /// Free the prefix of `retired` old enough (epochs are non-decreasing)
+    size_t reclaim(std::vector<Retired>& retired) noexcept {
+        const uint64_t current = epoch();
+        size_t n = 0;
+        while (n < retired.size() && retired[n].epoch + GRACE_EPOCHS <= current) {
+            retired[n].deleter(retired[n].ptr);
+            ++n;
+        }
+        retired.erase(retired.begin(), retired.begin() + static_cast<std::ptrdiff_t>(n));
+        return n;
+    }
+
+    size_t reclaim_orphans() noexcept {
+        if (!has_orphans_.load(std::memory_order_acquire)) [[likely]] return 0;
+        std::lock_guard lock{orphan_mutex_};
+        const size_t freed = reclaim(orphans_);
+        has_orphans_.store(!orphans_.empty(), std::memory_order_release);
+        return freed;
+    }
+
+    void unregister(size_t slot, std::vector<Retired>& retired) noexcept {
+        leave(slot);
+        if (!retired.empty()) {
+            std::lock_guard lock{orphan_mutex_};
+            orphans_.insert(orphans_.end(), retired.begin(), retired.end());
+            // Merged lists must stay ordered for reclaim()'s prefix scan
+            std::stable_sort(orphans_.begin(), orphans_.end(),
+                             [](const Retired& a, const Retired& b) { return a.epoch < b.epoch; });
+            has_orphans_.store(true, std::memory_order_release);
+            retired.clear();
+        }
+        slots_[slot].taken.store(false, std::memory_order_release);
+    }
+
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> global_{0};
+    std::array<Slot, MaxThreads> slots_{};
+
+    // Cold: only touched when a thread leaves with unreclaimed objects
+    alignas(CACHE_LINE_SIZE) mutable std::mutex orphan_mutex_;
+    std::vector<Retired> orphans_;
+    std::atomic<bool> has_orphans_{false};
+};
+
+} // namespace nfx::memory
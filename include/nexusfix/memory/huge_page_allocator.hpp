@@ -7,7 +7,8 @@
     Requirements:
     - Linux with huge pages enabled
     - Sufficient huge pages reserved: echo 512 > /proc/sys/vm/nr_hugepages
-    - Or use Transparent Huge Pages (THP)
+    - Or Transparent Huge Pages (THP): without reserved pages the
+      allocator falls back to a 2MB-aligned MADV_HUGEPAGE mapping
 */
 
 #pragma once
@@ -17,6 +18,9 @@
 #include <memory>
 #include <new>
 
+#include "nexusfix/util/memory_lock.hpp"
+#include "nexusfix/util/numa.hpp"
+
 #ifdef __linux__
 #include <sys/mman.h>
 #include <unistd.h>
@@ -43,7 +47,9 @@ enum class HugePageSize : size_t {
 class HugePageAllocator {
 public:
     /// Allocate memory with huge pages
-    /// Falls back to standard aligned allocation if huge pages unavailable
+    /// Falls back to a THP-advised mapping if no hugetlbfs pages are
+    /// reserved, so the region still ends up on huge pages when the
+    /// kernel can provide them. Either way it is released with deallocate().
     [[nodiscard]] static void* allocate(size_t size,
                                         HugePageSize page_size = HugePageSize::Huge2MB) noexcept {
 #ifdef __linux__
@@ -73,14 +79,36 @@ public:
             return ptr;
         }
 
-        // Fall back to standard allocation with alignment
-        return allocate_fallback(size, static_cast<size_t>(HugePageSize::Standard));
+        // Fall back to transparent huge pages
+        return allocate_transparent(aligned_size);
 #else
         // Non-Linux: use standard aligned allocation
         return allocate_fallback(size, 4096);
 #endif
     }
 
+    /// Allocate with the pages placed on a NUMA node (-1 = local policy).
+    /// The binding is applied before any page is touched.
+    [[nodiscard]] static void* allocate_on_node(size_t size, int numa_node,
+                                                HugePageSize page_size = HugePageSize::Huge2MB) noexcept {
+        void* ptr = allocate(size, page_size);
+        if (ptr && numa_node >= 0) {
+            (void)util::bind_memory_to_node(ptr, size, numa_node);
+        }
+        return ptr;
+    }
+
+    /// Allocate and touch every page so no fault happens on the hot path
+    [[nodiscard]] static void* allocate_prefaulted(size_t size,
+                                                   HugePageSize page_size = HugePageSize::Huge2MB,
+                                                   int numa_node = -1) noexcept {
+        void* ptr = allocate_on_node(size, numa_node, page_size);
+        if (ptr) {
+            util::prefault_memory_write(ptr, size);
+        }
+        return ptr;
+    }
+
     /// Deallocate memory
     static void deallocate(void* ptr, size_t size,
                           HugePageSize page_size = HugePageSize::Huge2MB) noexcept {
@@ -128,6 +156,39 @@ private:
         return (size + page_size - 1) & ~(page_size - 1);
     }
 
+#ifdef __linux__
+    /// Ordinary pages, 2MB aligned and advised MADV_HUGEPAGE so that
+    /// khugepaged / the fault path can back them with THP
+    [[nodiscard]] static void* allocate_transparent(size_t aligned_size) noexcept {
+        constexpr size_t THP_SIZE = static_cast<size_t>(HugePageSize::Huge2MB);
+
+        // Over-map by one huge page, then trim to a 2MB-aligned region of
+        // exactly aligned_size so deallocate() unmaps what was mapped
+        const size_t span = aligned_size + THP_SIZE;
+        void* raw = mmap(nullptr, span, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            return nullptr;
+        }
+
+        const auto base = reinterpret_cast<uintptr_t>(raw);
+        const uintptr_t start = (base + THP_SIZE - 1) & ~(THP_SIZE - 1);
+        if (start > base) {
+            munmap(raw, start - base);
+        }
+        const uintptr_t end = start + aligned_size;
+        if (base + span > end) {
+            munmap(reinterpret_cast<void*>(end), base + span - end);
+        }
+
+        void* ptr = reinterpret_cast<void*>(start);
+#ifdef MADV_HUGEPAGE
+        (void)madvise(ptr, aligned_size, MADV_HUGEPAGE);
+#endif
+        return ptr;
+    }
+#endif
+
     [[nodiscard]] static void* allocate_fallback(size_t size, size_t alignment) noexcept {
         return std::aligned_alloc(alignment, align_to_page(size, alignment));
     }
@@ -187,10 +248,13 @@ public:
 class HugePageBuffer {
 public:
     explicit HugePageBuffer(size_t size,
-                           HugePageSize page_size = HugePageSize::Huge2MB)
+                           HugePageSize page_size = HugePageSize::Huge2MB,
+                           bool prefault = false,
+                           int numa_node = -1)
         : size_(size)
         , page_size_(page_size)
-        , data_(HugePageAllocator::allocate(size, page_size)) {}
+        , data_(prefault ? HugePageAllocator::allocate_prefaulted(size, page_size, numa_node)
+                         : HugePageAllocator::allocate_on_node(size, numa_node, page_size)) {}
 
     ~HugePageBuffer() {
         if (data_) {
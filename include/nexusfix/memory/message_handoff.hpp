@@ -0,0 +1,253 @@
+/*
+    NexusFIX Inbound Message Handoff
+
+    Zero-copy transfer of parsed messages from an I/O thread to a strategy
+    thread. The I/O thread parses each message in place, inside its receive
+    buffer, into an IndexedParser slot and publishes the slot index over an
+    SPSCQueue. The receive buffer stays pinned - not recycled to the kernel
+    or the transport - until the consumer has released every message that
+    points into it; releases travel back over a second SPSCQueue.
+
+    Pin counts and the slot free list are only touched by the producer, so
+    the hot path is two queue operations per message and no atomics besides
+    the queues' own.
+
+    Receive buffers are named by a small integer id: the buffer id of a
+    ProvidedBufferGroup CQE, or any numbering the transport uses for its
+    own buffers (a message reassembled across receives must be published
+    from a buffer with an id of its own).
+
+    Usage (I/O thread, io_uring multishot receive):
+        for (auto msg : framed_messages(buffer)) {
+            (void)handoff.publish(buf_id, msg);
+        }
+        if (handoff.done_with(buf_id)) (void)group.replenish(buf_id);
+        handoff.reclaim([&](uint16_t id) { (void)group.replenish(id); });
+
+    Usage (strategy thread):
+        while (auto msg = handoff.try_consume()) {
+            on_message(msg->parser());   // Views stay valid while msg lives
+        }
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/transport/rx_timestamp.hpp"
+
+namespace nfx::memory {
+
+/// Outcome of MessageHandoff::publish()
+enum class HandoffStatus : uint8_t {
+    Published,
+    Full,          // Every slot is held by the consumer (back-pressure)
+    ParseFailed,   // Not a valid FIX message; nothing was pinned
+    BadBuffer      // Buffer id outside [0, MaxBuffers)
+};
+
+// ============================================================================
+// Message Handoff
+// ============================================================================
+
+/// Single-producer single-consumer handoff of in-place parsed messages
+/// @tparam Slots Messages in flight (power of 2)
+/// @tparam MaxBuffers Distinct receive buffer ids
+template<size_t Slots = 256, size_t MaxBuffers = 1024>
+class MessageHandoff {
+    static_assert((Slots & (Slots - 1)) == 0, "Slots must be power of 2");
+    static_assert(MaxBuffers <= UINT16_MAX, "Buffer ids are 16-bit");
+
+public:
+    using BufferId = uint16_t;
+
+    /// A consumed message; releases its slot (and buffer pin) on destruction
+    class PinnedMessage {
+    public:
+        PinnedMessage(const PinnedMessage&) = delete;
+        PinnedMessage& operator=(const PinnedMessage&) = delete;
+
+        PinnedMessage(PinnedMessage&& other) noexcept
+            : owner_{other.owner_}, slot_{other.slot_} {
+            other.owner_ = nullptr;
+        }
+
+        PinnedMessage& operator=(PinnedMessage&& other) noexcept {
+            if (this != &other) {
+                release();
+                owner_ = other.owner_;
+                slot_ = other.slot_;
+                other.owner_ = nullptr;
+            }
+            return *this;
+        }
+
+        ~PinnedMessage() { release(); }
+
+        [[nodiscard]] const IndexedParser& parser() const noexcept {
+            return *owner_->slots_[slot_].parser;
+        }
+        [[nodiscard]] const IndexedParser* operator->() const noexcept {
+            return &parser();
+        }
+        [[nodiscard]] std::span<const char> raw() const noexcept {
+            return parser().raw();
+        }
+        [[nodiscard]] const RxTimestamp& rx_timestamp() const noexcept {
+            return owner_->slots_[slot_].rx_ts;
+        }
+
+        /// Hand the slot back early (idempotent)
+        void release() noexcept {
+            if (owner_) {
+                owner_->release_slot(slot_);
+                owner_ = nullptr;
+            }
+        }
+
+    private:
+        friend class MessageHandoff;
+        PinnedMessage(MessageHandoff* owner, uint32_t slot) noexcept
+            : owner_{owner}, slot_{slot} {}
+
+        MessageHandoff* owner_;
+        uint32_t slot_;
+    };
+
+    MessageHandoff() noexcept {
+        for (uint32_t i = 0; i < Slots; ++i) {
+            free_slots_[i] = static_cast<uint32_t>(Slots - 1 - i);
+        }
+        free_count_ = Slots;
+    }
+
+    // Non-copyable, non-movable (PinnedMessage points back here)
+    MessageHandoff(const MessageHandoff&) = delete;
+    MessageHandoff& operator=(const MessageHandoff&) = delete;
+
+    // ========================================================================
+    // Producer Interface (I/O thread)
+    // ========================================================================
+
+    /// Parse a message in place and publish it; pins its buffer
+    /// @param buffer Id of the receive buffer that holds msg
+    [[nodiscard]] NFX_HOT
+    HandoffStatus publish(BufferId buffer, std::span<const char> msg,
+                          const RxTimestamp& rx_ts = {}) noexcept {
+        if (buffer >= MaxBuffers) [[unlikely]] return HandoffStatus::BadBuffer;
+        if (free_count_ == 0) [[unlikely]] {
+            drain_releases();
+            if (free_count_ == 0) return HandoffStatus::Full;
+        }
+
+        auto parsed = IndexedParser::parse(msg);
+        if (!parsed) [[unlikely]] return HandoffStatus::ParseFailed;
+
+        const uint32_t slot = free_slots_[--free_count_];
+        Slot& s = slots_[slot];
+        s.parser.emplace(std::move(*parsed));
+        s.rx_ts = rx_ts;
+        s.buffer = buffer;
+
+        ++buffers_[buffer].pins;
+        buffers_[buffer].framing = true;
+        published_.push(slot);  // Never full: at most Slots entries in flight
+        return HandoffStatus::Published;
+    }
+
+    /// The producer has framed all messages of a buffer
+    /// @return true if nothing points into it: recycle it now. Otherwise
+    ///         reclaim() reports it once the consumer lets go.
+    [[nodiscard]] bool done_with(BufferId buffer) noexcept {
+        if (buffer >= MaxBuffers) [[unlikely]] return false;
+        buffers_[buffer].framing = false;
+        return buffers_[buffer].pins == 0;
+    }
+
+    /// Process releases; on_free(BufferId) runs for each buffer that became
+    /// unpinned after done_with(). Call regularly from the producer.
+    /// @return Number of buffers freed
+    template<typename OnFree>
+    size_t reclaim(OnFree&& on_free) noexcept {
+        drain_releases();
+        const size_t freed = pending_free_count_;
+        for (size_t i = 0; i < freed; ++i) {
+            on_free(pending_free_[i]);
+        }
+        pending_free_count_ = 0;
+        return freed;
+    }
+
+    /// Messages published and not yet released
+    [[nodiscard]] size_t in_flight() const noexcept { return Slots - free_count_; }
+
+    /// Outstanding messages pointing into a buffer
+    [[nodiscard]] uint32_t pins(BufferId buffer) const noexcept {
+        return buffer < MaxBuffers ? buffers_[buffer].pins : 0;
+    }
+
+    // ========================================================================
+    // Consumer Interface (strategy thread)
+    // ========================================================================
+
+    /// Next published message, if any
+    [[nodiscard]] NFX_HOT std::optional<PinnedMessage> try_consume() noexcept {
+        uint32_t slot;
+        if (!published_.try_pop(slot)) return std::nullopt;
+        return PinnedMessage{this, slot};
+    }
+
+private:
+    struct Slot {
+        std::optional<IndexedParser> parser;
+        RxTimestamp rx_ts{};
+        BufferId buffer{0};
+    };
+
+    struct BufferState {
+        uint32_t pins{0};
+        bool framing{false};
+    };
+
+    /// Consumer side: hand the slot back to the producer
+    void release_slot(uint32_t slot) noexcept {
+        released_.push(slot);  // Never full: a slot is released at most once
+    }
+
+    /// Producer side: recycle released slots and collect buffers they unpinned
+    void drain_releases() noexcept {
+        uint32_t slot;
+        while (released_.try_pop(slot)) {
+            Slot& s = slots_[slot];
+            s.parser.reset();
+            free_slots_[free_count_++] = slot;
+
+            BufferState& buffer = buffers_[s.buffer];
+            if (--buffer.pins == 0 && !buffer.framing) {
+                pending_free_[pending_free_count_++] = s.buffer;
+            }
+        }
+    }
+
+    // Queues hold Slots entries (an SPSCQueue of N keeps one cell empty)
+    SPSCQueue<uint32_t, Slots * 2> published_;
+    SPSCQueue<uint32_t, Slots * 2> released_;
+
+    std::array<Slot, Slots> slots_{};
+
+    // Producer-only state
+    std::array<uint32_t, Slots> free_slots_{};
+    size_t free_count_{0};
+    std::array<BufferState, MaxBuffers> buffers_{};
+    std::array<BufferId, MaxBuffers> pending_free_{};  // Unpinned, not yet reported
+    size_t pending_free_count_{0};
+};
+
+} // namespace nfx::memory
@@ -16,6 +16,7 @@
 #include <mimalloc.h>
 
 #include "nexusfix/memory/buffer_pool.hpp"  // CACHE_LINE_SIZE
+#include "nexusfix/util/numa.hpp"
 
 namespace nfx::memory {
 
@@ -142,12 +143,21 @@ class SessionHeap : public std::pmr::memory_resource {
 public:
     static constexpr size_t DEFAULT_INITIAL_SIZE = 64 * 1024 * 1024;  // 64MB
 
-    explicit SessionHeap(size_t initial_buffer_size = DEFAULT_INITIAL_SIZE) noexcept
+    /// @param numa_node Bind the initial buffer to this node, normally the
+    ///        node of the session's pinned core (-1 = allocating thread's
+    ///        policy). Overflow chunks follow the allocating thread.
+    explicit SessionHeap(size_t initial_buffer_size = DEFAULT_INITIAL_SIZE,
+                         int numa_node = -1) noexcept
         : heap_{}
         , initial_buffer_(static_cast<char*>(
               heap_.allocate(initial_buffer_size, CACHE_LINE_SIZE)))
         , initial_buffer_size_(initial_buffer_size)
-        , pool_(initial_buffer_, initial_buffer_size_, &heap_) {}
+        , pool_(initial_buffer_, initial_buffer_size_, &heap_)
+    {
+        if (initial_buffer_ && numa_node >= 0) {
+            bind_pages(numa_node);
+        }
+    }
 
     // Non-copyable, non-movable
     SessionHeap(const SessionHeap&) = delete;
@@ -180,6 +190,16 @@ public:
     }
 
 private:
+    /// mbind the whole pages inside the initial buffer
+    void bind_pages(int numa_node) noexcept {
+        constexpr uintptr_t page = 4096;
+        const auto begin = (reinterpret_cast<uintptr_t>(initial_buffer_) + page - 1) & ~(page - 1);
+        const auto end = (reinterpret_cast<uintptr_t>(initial_buffer_) + initial_buffer_size_) & ~(page - 1);
+        if (end > begin) {
+            (void)util::bind_memory_to_node(reinterpret_cast<void*>(begin), end - begin, numa_node);
+        }
+    }
+
     void* do_allocate(size_t bytes, size_t alignment) override {
         return pool_.allocate(bytes, alignment);
     }
@@ -33,11 +33,22 @@
 #include <type_traits>
 #include <new>
 
+#include "nexusfix/memory/cache_line.hpp"
 #include "wait_strategy.hpp"
 #include "nexusfix/util/compiler.hpp"
 
 namespace nfx::memory {
 
+// ============================================================================
+// Padded Sequence
+// ============================================================================
+
+/// Sequence counter alone on its cache line (no false sharing between
+/// slots or cursors)
+struct alignas(CACHE_LINE_SIZE) PaddedSequence {
+    std::atomic<size_t> value{0};
+};
+
 // ============================================================================
 // MPSC Queue
 // ============================================================================
@@ -94,6 +105,7 @@ public:
                     buffer_[slot] = item;
                     // Publish: mark slot as filled
                     sequences_[slot].value.store(head + 1, std::memory_order_release);
+                    notify_waiters<WaitStrategyT>();
                     return true;
                 }
                 // CAS failed, another producer got there first, retry
@@ -121,6 +133,7 @@ public:
                         std::memory_order_relaxed)) {
                     buffer_[slot] = std::move(item);
                     sequences_[slot].value.store(head + 1, std::memory_order_release);
+                    notify_waiters<WaitStrategyT>();
                     return true;
                 }
             } else if (diff < 0) {
@@ -133,9 +146,8 @@ public:
 
     /// Push with spin wait (blocks until successful)
     void push(const T& item) noexcept {
-        while (!try_push(item)) {
-            WaitStrategyT::wait();
-        }
+        if (try_push(item)) [[likely]] return;
+        WaitStrategyT::wait_until([&] { return try_push(item); });
     }
 
     /// Emplace an element in-place (producer, multiple threads)
@@ -153,6 +165,37 @@ public:
                         std::memory_order_relaxed)) {
                     std::construct_at(&buffer_[slot], std::forward<Args>(args)...);
                     sequences_[slot].value.store(head + 1, std::memory_order_release);
+                    notify_waiters<WaitStrategyT>();
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                head = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Claim a slot and fill it in place (producer, multiple threads)
+    /// The slot is published once fill(T&) returns; consumers see slots
+    /// in claim order, so a slow fill holds back later producers' slots
+    /// (not their claims).
+    /// @return true if successful, false if queue is full
+    template<typename Fill>
+    [[nodiscard]] bool try_produce(Fill&& fill) noexcept {
+        size_t head = head_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            const size_t slot = head & mask_;
+            const size_t seq = sequences_[slot].value.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(head);
+
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(head, head + 1,
+                        std::memory_order_relaxed)) {
+                    fill(buffer_[slot]);
+                    sequences_[slot].value.store(head + 1, std::memory_order_release);
+                    notify_waiters<WaitStrategyT>();
                     return true;
                 }
             } else if (diff < 0) {
@@ -186,6 +229,7 @@ public:
         // Mark slot as consumed (ready for next round)
         sequences_[slot].value.store(tail + Capacity, std::memory_order_release);
         tail_.store(tail + 1, std::memory_order_relaxed);
+        notify_waiters<WaitStrategyT>();
 
         return item;
     }
@@ -205,15 +249,37 @@ public:
         item = std::move(buffer_[slot]);
         sequences_[slot].value.store(tail + Capacity, std::memory_order_release);
         tail_.store(tail + 1, std::memory_order_relaxed);
+        notify_waiters<WaitStrategyT>();
+
+        return true;
+    }
+
+    /// Process the oldest slot in place, then release it (consumer only)
+    /// Avoids moving large elements out of the ring.
+    /// @return true if a slot was consumed, false if queue is empty
+    template<typename Consume>
+    [[nodiscard]] bool try_consume(Consume&& consume) noexcept {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t slot = tail & mask_;
+        const size_t seq = sequences_[slot].value.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(tail + 1);
 
+        if (diff < 0) {
+            return false;
+        }
+
+        consume(buffer_[slot]);
+        sequences_[slot].value.store(tail + Capacity, std::memory_order_release);
+        tail_.store(tail + 1, std::memory_order_relaxed);
+        notify_waiters<WaitStrategyT>();
         return true;
     }
 
     /// Pop with spin wait (blocks until successful)
     [[nodiscard]] T pop() noexcept {
         T item;
-        while (!try_pop(item)) {
-            WaitStrategyT::wait();
+        if (!try_pop(item)) [[unlikely]] {
+            WaitStrategyT::wait_until([&] { return try_pop(item); });
         }
         return item;
     }
@@ -272,9 +338,6 @@ private:
     // Sequence == slot_index: slot is empty, ready for write
     // Sequence == slot_index + 1: slot is filled, ready for read
     // Sequence == slot_index + Capacity: slot consumed, ready for next cycle
-    struct alignas(CACHE_LINE_SIZE) PaddedSequence {
-        std::atomic<size_t> value{0};
-    };
     std::array<PaddedSequence, Capacity> sequences_{};
 
     // Producer side (multiple writers contend here)
@@ -334,6 +397,7 @@ public:
 
         // Step 5: Publish
         publish_head_.store(claimed + 1, std::memory_order_release);
+        notify_waiters<WaitStrategyT>();
         return true;
     }
 
@@ -351,6 +415,7 @@ public:
 
         // Advance tail
         tail_.store(tail + 1, std::memory_order_release);
+        notify_waiters<WaitStrategyT>();
         return true;
     }
 
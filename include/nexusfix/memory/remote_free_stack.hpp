@@ -0,0 +1,79 @@
+/*
+    NexusFIX Remote Free Stack
+
+    Return path for pool blocks released on a thread that does not own the
+    pool. Any thread pushes a freed block (Treiber stack, one CAS); the
+    owner takes the whole chain with one exchange and threads it back onto
+    its private free list in a batch. The link pointer lives in the freed
+    block itself, so nothing is allocated.
+
+    Because the owner only ever detaches the entire chain, a node is never
+    popped while another thread holds it as an expected head: no ABA, no
+    tags, no hazard pointers.
+
+    Usage:
+        // Strategy thread, done with an I/O thread's block
+        pool.deallocate_remote(block);
+
+        // I/O thread, when its free list runs dry
+        for (void* b = stack.take_all(); b != nullptr;) {
+            void* next = RemoteFreeStack::next(b);
+            local_free(b);
+            b = next;
+        }
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "nexusfix/memory/cache_line.hpp"
+
+namespace nfx::memory {
+
+// ============================================================================
+// Remote Free Stack
+// ============================================================================
+
+/// Intrusive MPSC stack of freed blocks (each at least pointer-sized)
+class RemoteFreeStack {
+public:
+    RemoteFreeStack() noexcept = default;
+
+    RemoteFreeStack(const RemoteFreeStack&) = delete;
+    RemoteFreeStack& operator=(const RemoteFreeStack&) = delete;
+
+    /// Push a freed block (any thread)
+    void push(void* block) noexcept {
+        void* head = head_.load(std::memory_order_relaxed);
+        do {
+            *static_cast<void**>(block) = head;
+        } while (!head_.compare_exchange_weak(head, block,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+    }
+
+    /// Detach every pushed block (owner thread); walk with next()
+    /// @return Most recently pushed block, nullptr if none
+    [[nodiscard]] void* take_all() noexcept {
+        if (head_.load(std::memory_order_relaxed) == nullptr) return nullptr;
+        return head_.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    /// Block pushed before `block`
+    [[nodiscard]] static void* next(void* block) noexcept {
+        return *static_cast<void**>(block);
+    }
+
+    /// Approximate: blocks may be pushed concurrently
+    [[nodiscard]] bool empty() const noexcept {
+        return head_.load(std::memory_order_relaxed) == nullptr;
+    }
+
+private:
+    // Own cache line: producers CAS here, the owner's free list stays local
+    alignas(CACHE_LINE_SIZE) std::atomic<void*> head_{nullptr};
+};
+
+} // namespace nfx::memory
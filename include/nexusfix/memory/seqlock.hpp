@@ -29,6 +29,8 @@
 #include <new>
 #include <type_traits>
 
+#include "nexusfix/memory/cache_line.hpp"
+
 #if defined(__x86_64__) || defined(_M_X64)
 #include <immintrin.h>
 #define NFX_SEQLOCK_PAUSE() _mm_pause()
@@ -40,18 +42,6 @@
 
 namespace nfx::memory {
 
-// ============================================================================
-// Seqlock Configuration
-// ============================================================================
-
-/// Cache line size for alignment
-inline constexpr std::size_t CACHE_LINE_SIZE =
-#ifdef __cpp_lib_hardware_interference_size
-    std::hardware_destructive_interference_size;
-#else
-    64;
-#endif
-
 // ============================================================================
 // Seqlock Implementation
 // ============================================================================
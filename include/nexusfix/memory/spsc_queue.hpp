@@ -14,25 +14,20 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <array>
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <span>
 #include <type_traits>
 #include <new>
 
-namespace nfx::memory {
-
-// ============================================================================
-// Cache Line Constants
-// ============================================================================
+#include "nexusfix/memory/cache_line.hpp"
+#include "nexusfix/memory/wait_strategy.hpp"
 
-#ifdef __cpp_lib_hardware_interference_size
-    inline constexpr size_t CACHE_LINE_SIZE = std::hardware_destructive_interference_size;
-#else
-    inline constexpr size_t CACHE_LINE_SIZE = 64;
-#endif
+namespace nfx::memory {
 
 // ============================================================================
 // SPSC Queue
@@ -41,12 +36,25 @@ namespace nfx::memory {
 /// Lock-free Single-Producer Single-Consumer queue
 /// @tparam T Element type (must be trivially copyable for best performance)
 /// @tparam Capacity Must be power of 2
-template<typename T, size_t Capacity>
+/// @tparam WaitStrategyT Wait strategy for the blocking push()/pop();
+///         strategies with a wake path (AdaptiveWait) are notified on
+///         every publish and consume
+///
+/// Each side keeps its own index and a cached copy of the other side's in
+/// a cache line it alone writes. The remote index is re-read (the only
+/// cross-core traffic besides the publish store) when the cached copy says
+/// the queue is full/empty. try_push_n()/try_pop_n() move a whole batch
+/// with one acquire and one release.
+template<typename T, size_t Capacity, typename WaitStrategyT = BusySpinWait>
 class SPSCQueue {
     static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be power of 2");
     static_assert(Capacity >= 2, "Capacity must be at least 2");
+    static_assert(WaitStrategy<WaitStrategyT>, "Invalid wait strategy");
 
 public:
+    using value_type = T;
+    using wait_strategy = WaitStrategyT;
+
     SPSCQueue() noexcept = default;
 
     // Non-copyable, non-movable
@@ -62,68 +70,60 @@ public:
     /// Try to push an element (producer only)
     /// @return true if successful, false if queue is full
     [[nodiscard]] bool try_push(const T& item) noexcept {
-        const size_t head = head_.load(std::memory_order_relaxed);
-        const size_t next_head = (head + 1) & mask_;
-
-        // Check if queue is full
-        if (next_head == cached_tail_) {
-            // Refresh cached tail
-            cached_tail_ = tail_.load(std::memory_order_acquire);
-            if (next_head == cached_tail_) {
-                return false;  // Queue is full
-            }
-        }
+        const size_t head = producer_.head;
+        if (!has_space(head, 1)) return false;
 
-        // Store the item
         buffer_[head] = item;
-
-        // Publish the item
-        head_.store(next_head, std::memory_order_release);
+        publish((head + 1) & mask_);
         return true;
     }
 
     /// Try to push an element (move version)
     [[nodiscard]] bool try_push(T&& item) noexcept {
-        const size_t head = head_.load(std::memory_order_relaxed);
-        const size_t next_head = (head + 1) & mask_;
-
-        if (next_head == cached_tail_) {
-            cached_tail_ = tail_.load(std::memory_order_acquire);
-            if (next_head == cached_tail_) {
-                return false;
-            }
-        }
+        const size_t head = producer_.head;
+        if (!has_space(head, 1)) return false;
 
         buffer_[head] = std::move(item);
-        head_.store(next_head, std::memory_order_release);
+        publish((head + 1) & mask_);
         return true;
     }
 
-    /// Push with spin wait (blocks until successful)
-    void push(const T& item) noexcept {
-        while (!try_push(item)) {
-            // Spin - could add pause instruction here
-            #if defined(__x86_64__) || defined(_M_X64)
-            asm volatile("pause" ::: "memory");
-            #endif
+    /// Push as many elements as fit, published with a single release store
+    /// @return Number of leading elements of items pushed
+    [[nodiscard]] size_t try_push_n(std::span<const T> items) noexcept {
+        if (items.empty()) return 0;
+
+        const size_t head = producer_.head;
+        size_t n = free_slots(head);
+        if (n < items.size()) {
+            producer_.cached_tail = tail_.load(std::memory_order_acquire);
+            n = free_slots(head);
         }
+        n = std::min(n, items.size());
+        if (n == 0) return 0;
+
+        const size_t first = std::min(n, Capacity - head);
+        std::copy_n(items.data(), first, buffer_.data() + head);
+        std::copy_n(items.data() + first, n - first, buffer_.data());
+
+        publish((head + n) & mask_);
+        return n;
+    }
+
+    /// Push with wait (blocks until successful)
+    void push(const T& item) noexcept {
+        if (try_push(item)) [[likely]] return;
+        WaitStrategyT::wait_until([&] { return try_push(item); });
     }
 
     /// Emplace an element in-place
     template<typename... Args>
     [[nodiscard]] bool try_emplace(Args&&... args) noexcept {
-        const size_t head = head_.load(std::memory_order_relaxed);
-        const size_t next_head = (head + 1) & mask_;
-
-        if (next_head == cached_tail_) {
-            cached_tail_ = tail_.load(std::memory_order_acquire);
-            if (next_head == cached_tail_) {
-                return false;
-            }
-        }
+        const size_t head = producer_.head;
+        if (!has_space(head, 1)) return false;
 
         std::construct_at(&buffer_[head], std::forward<Args>(args)...);
-        head_.store(next_head, std::memory_order_release);
+        publish((head + 1) & mask_);
         return true;
     }
 
@@ -134,53 +134,52 @@ public:
     /// Try to pop an element (consumer only)
     /// @return The element if available, nullopt if queue is empty
     [[nodiscard]] std::optional<T> try_pop() noexcept {
-        const size_t tail = tail_.load(std::memory_order_relaxed);
-
-        // Check if queue is empty
-        if (tail == cached_head_) {
-            // Refresh cached head
-            cached_head_ = head_.load(std::memory_order_acquire);
-            if (tail == cached_head_) {
-                return std::nullopt;  // Queue is empty
-            }
-        }
+        const size_t tail = consumer_.tail;
+        if (!has_items(tail, 1)) return std::nullopt;
 
-        // Load the item
         T item = std::move(buffer_[tail]);
-
-        // Mark slot as consumed
-        const size_t next_tail = (tail + 1) & mask_;
-        tail_.store(next_tail, std::memory_order_release);
-
+        consume((tail + 1) & mask_);
         return item;
     }
 
     /// Pop with output parameter (avoids optional overhead)
     /// @return true if successful, false if queue is empty
     [[nodiscard]] bool try_pop(T& item) noexcept {
-        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t tail = consumer_.tail;
+        if (!has_items(tail, 1)) return false;
 
-        if (tail == cached_head_) {
-            cached_head_ = head_.load(std::memory_order_acquire);
-            if (tail == cached_head_) {
-                return false;
-            }
+        item = std::move(buffer_[tail]);
+        consume((tail + 1) & mask_);
+        return true;
+    }
+
+    /// Pop up to out.size() elements, released with a single store
+    /// @return Number of elements written to the front of out
+    [[nodiscard]] size_t try_pop_n(std::span<T> out) noexcept {
+        if (out.empty()) return 0;
+
+        const size_t tail = consumer_.tail;
+        size_t n = ready_slots(tail);
+        if (n < out.size()) {
+            consumer_.cached_head = head_.load(std::memory_order_acquire);
+            n = ready_slots(tail);
         }
+        n = std::min(n, out.size());
+        if (n == 0) return 0;
 
-        item = std::move(buffer_[tail]);
-        const size_t next_tail = (tail + 1) & mask_;
-        tail_.store(next_tail, std::memory_order_release);
+        const size_t first = std::min(n, Capacity - tail);
+        std::move(buffer_.data() + tail, buffer_.data() + tail + first, out.data());
+        std::move(buffer_.data(), buffer_.data() + (n - first), out.data() + first);
 
-        return true;
+        consume((tail + n) & mask_);
+        return n;
     }
 
-    /// Pop with spin wait (blocks until successful)
+    /// Pop with wait (blocks until successful)
     [[nodiscard]] T pop() noexcept {
         T item;
-        while (!try_pop(item)) {
-            #if defined(__x86_64__) || defined(_M_X64)
-            asm volatile("pause" ::: "memory");
-            #endif
+        if (!try_pop(item)) [[unlikely]] {
+            WaitStrategyT::wait_until([&] { return try_pop(item); });
         }
         return item;
     }
@@ -229,12 +228,58 @@ public:
 private:
     static constexpr size_t mask_ = Capacity - 1;
 
+    /// Free slots as seen through the producer's cached tail
+    [[nodiscard]] size_t free_slots(size_t head) const noexcept {
+        return (producer_.cached_tail - head - 1) & mask_;
+    }
+
+    /// Filled slots as seen through the consumer's cached head
+    [[nodiscard]] size_t ready_slots(size_t tail) const noexcept {
+        return (consumer_.cached_head - tail) & mask_;
+    }
+
+    [[nodiscard]] bool has_space(size_t head, size_t n) noexcept {
+        if (free_slots(head) >= n) [[likely]] return true;
+        producer_.cached_tail = tail_.load(std::memory_order_acquire);
+        return free_slots(head) >= n;
+    }
+
+    [[nodiscard]] bool has_items(size_t tail, size_t n) noexcept {
+        if (ready_slots(tail) >= n) [[likely]] return true;
+        consumer_.cached_head = head_.load(std::memory_order_acquire);
+        return ready_slots(tail) >= n;
+    }
+
+    void publish(size_t next_head) noexcept {
+        producer_.head = next_head;
+        head_.store(next_head, std::memory_order_release);
+        notify_waiters<WaitStrategyT>();
+    }
+
+    void consume(size_t next_tail) noexcept {
+        consumer_.tail = next_tail;
+        tail_.store(next_tail, std::memory_order_release);
+        notify_waiters<WaitStrategyT>();   // A blocked push() may proceed
+    }
+
+    /// Written only by the producer
+    struct alignas(CACHE_LINE_SIZE) ProducerState {
+        size_t head{0};         // Own index (never re-read from head_)
+        size_t cached_tail{0};  // Last observed tail_
+    };
+
+    /// Written only by the consumer
+    struct alignas(CACHE_LINE_SIZE) ConsumerState {
+        size_t tail{0};
+        size_t cached_head{0};
+    };
+
     // Cache line padded to avoid false sharing
     alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
-    alignas(CACHE_LINE_SIZE) size_t cached_tail_{0};  // Producer's cached view of tail
+    ProducerState producer_;
 
     alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_{0};
-    alignas(CACHE_LINE_SIZE) size_t cached_head_{0};  // Consumer's cached view of head
+    ConsumerState consumer_;
 
     alignas(CACHE_LINE_SIZE) std::array<T, Capacity> buffer_{};
 };
@@ -10,12 +10,15 @@
     | YieldingWait  | Low      | High      | Active trading          |
     | SleepingWait  | Medium   | Low       | Background processing   |
     | BackoffWait   | Adaptive | Variable  | General purpose         |
+    | AdaptiveWait  | Adaptive | Follows   | Sessions with quiet     |
+    |               |          | load      | periods (futex park)    |
 */
 
 #pragma once
 
 #include <atomic>
 #include <chrono>
+#include <climits>
 #include <thread>
 #include <cstdint>
 
@@ -23,6 +26,13 @@
 #include <immintrin.h>
 #endif
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
 namespace nfx::memory {
 
 // ============================================================================
@@ -204,6 +214,183 @@ struct BackoffWait {
     }
 };
 
+// ============================================================================
+// Wake Signal
+// ============================================================================
+
+/// Futex-backed parking spot shared by waiters and the threads that wake them.
+/// notify() costs a fence and one load while nobody is parked.
+class WakeSignal {
+public:
+    /// Park until notify() or timeout, unless ready() holds once registered
+    template<typename Ready>
+    void park(Ready&& ready, std::chrono::microseconds timeout) noexcept {
+        const uint32_t seen = epoch_.load(std::memory_order_acquire);
+        sleepers_.fetch_add(1, std::memory_order_relaxed);
+        // Pairs with the fence in notify(): either the waker sees us
+        // registered, or we see the state it published
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!ready()) {
+            sleep(seen, timeout);
+        }
+        sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /// Wake all parked waiters (call after publishing the state they wait on)
+    void notify() noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers_.load(std::memory_order_relaxed) == 0) [[likely]] return;
+
+        epoch_.fetch_add(1, std::memory_order_release);
+#if defined(__linux__)
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch_),
+                  FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
+
+    [[nodiscard]] uint32_t sleepers() const noexcept {
+        return sleepers_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void sleep(uint32_t seen, std::chrono::microseconds timeout) noexcept {
+#if defined(__linux__)
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+        struct timespec ts;
+        ts.tv_sec = static_cast<time_t>(timeout.count() / 1'000'000);
+        ts.tv_nsec = static_cast<long>((timeout.count() % 1'000'000) * 1000);
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch_),
+                  FUTEX_WAIT_PRIVATE, seen, &ts, nullptr, 0);
+#else
+        (void)seen;
+        std::this_thread::sleep_for(timeout);   // Timeout-bounded, no wake path
+#endif
+    }
+
+    alignas(64) std::atomic<uint32_t> epoch_{0};
+    alignas(64) std::atomic<uint32_t> sleepers_{0};
+};
+
+// ============================================================================
+// Adaptive Wait Strategy
+// ============================================================================
+
+/// Load-following strategy: spins while items arrive close together and
+/// parks on a futex once the flow has gone quiet.
+///
+/// Each waiting thread keeps a moving average of how long its recent waits
+/// lasted. That average sets the spin budget (a few times the typical gap,
+/// capped at SpinLimitMicroseconds), after which the thread light-sleeps
+/// (tpause where WAITPKG is available, else yield) and finally parks on the
+/// shared WakeSignal for up to MaxSleepMicroseconds. Queues call notify()
+/// after every publish/consume, which wakes parked threads immediately.
+/// @tparam Tag Separates the wake signals of unrelated queues
+template<uint32_t SpinLimitMicroseconds = 50,
+         uint32_t MaxSleepMicroseconds = 1000,
+         typename Tag = void>
+struct AdaptiveWait {
+    static constexpr const char* name() noexcept { return "AdaptiveWait"; }
+
+    /// Per-thread history of recent waits
+    struct State {
+        uint64_t avg_wait_ns{0};
+    };
+
+    /// Single spin step (satisfies WaitStrategy, no adaptation)
+    static void wait() noexcept {
+        BusySpinWait::wait();
+    }
+
+    /// Wake threads parked by wait_until() (producers: after publishing)
+    static void notify() noexcept {
+        signal().notify();
+    }
+
+    template<typename Predicate>
+    static void wait_until(Predicate&& pred) noexcept {
+        wait_until(thread_state(), pred);
+    }
+
+    /// Wait with explicit history (a thread waiting on several queues
+    /// can keep one State per queue)
+    template<typename Predicate>
+    static void wait_until(State& state, Predicate&& pred) noexcept {
+        if (pred()) return;
+
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+        const uint64_t spin_ns = spin_budget_ns(state);
+        uint64_t elapsed_ns = 0;
+
+        for (uint32_t polls = 0; !pred(); ++polls) {
+            // Read the clock every 64 polls while spinning
+            if ((polls & 63) == 63 || elapsed_ns >= spin_ns) {
+                elapsed_ns = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        Clock::now() - start).count());
+            }
+
+            if (elapsed_ns < spin_ns) {
+                BusySpinWait::wait();
+            } else if (elapsed_ns < spin_ns + LIGHT_SLEEP_NS) {
+                light_sleep();
+            } else {
+                signal().park(pred, std::chrono::microseconds(MaxSleepMicroseconds));
+            }
+        }
+
+        const auto waited = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        state.avg_wait_ns = (state.avg_wait_ns * 7 + waited) / 8;
+    }
+
+    static void wait_for_sequence(
+        const std::atomic<size_t>& sequence,
+        size_t target) noexcept
+    {
+        wait_until([&] { return sequence.load(std::memory_order_acquire) >= target; });
+    }
+
+    [[nodiscard]] static WakeSignal& signal() noexcept {
+        static WakeSignal instance;
+        return instance;
+    }
+
+    /// Spin budget for the next wait: ~4x the typical recent gap, so a busy
+    /// flow never sleeps and a quiet one parks within a few microseconds
+    [[nodiscard]] static uint64_t spin_budget_ns(const State& state) noexcept {
+        constexpr uint64_t limit = uint64_t{SpinLimitMicroseconds} * 1000;
+        constexpr uint64_t floor = 1000;
+        if (state.avg_wait_ns > limit) return floor;   // Quiet: park soon
+        const uint64_t budget = state.avg_wait_ns * 4;
+        return budget < floor ? floor : (budget > limit ? limit : budget);
+    }
+
+private:
+    static constexpr uint64_t LIGHT_SLEEP_NS = 20'000;
+
+    static State& thread_state() noexcept {
+        thread_local State state{};
+        return state;
+    }
+
+    static void light_sleep() noexcept {
+#if defined(__WAITPKG__)
+        _tpause(0, __rdtsc() + 10'000);   // C0.2 for ~10k TSC ticks
+#else
+        std::this_thread::yield();
+#endif
+    }
+};
+
+/// Wake parked waiters for strategies that have a wake path (no-op otherwise)
+template<typename W>
+inline void notify_waiters() noexcept {
+    if constexpr (requires { W::notify(); }) {
+        W::notify();
+    }
+}
+
 // ============================================================================
 // Wait Strategy Concept
 // ============================================================================
@@ -220,5 +407,6 @@ static_assert(WaitStrategy<BusySpinWait>);
 static_assert(WaitStrategy<YieldingWait>);
 static_assert(WaitStrategy<SleepingWait<>>);
 static_assert(WaitStrategy<BackoffWait<>>);
+static_assert(WaitStrategy<AdaptiveWait<>>);
 
 } // namespace nfx::memory
@@ -0,0 +1,286 @@
+#pragma once
+
+/// @file scatter_message.hpp
+/// @brief Scatter-gather FIX message assembly (static header + body + trailer)
+///
+/// A session's static header bytes ("8=FIX.4.4|9=" and "35=D|49=...|56=...|")
+/// are rendered once into a HeaderTemplate. Per message, ScatterAssembler
+/// writes only the variable part (MsgSeqNum, SendingTime, body fields),
+/// BodyLength and the trailer, and hands out the five pieces as segments for
+/// writev() / ScatterGatherSend. The template bytes are never copied again,
+/// and their checksum contribution is precomputed.
+///
+/// Wire layout (byte-identical to MessageAssembler output):
+///   [prefix "8=..|9="] [length "NNNNNN|"] [static "35=..|49=..|56=..|"]
+///   [body "34=..|52=..|..."] [trailer "10=XXX|"]
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/serializer/constexpr_serializer.hpp"
+
+#if NFX_PLATFORM_POSIX
+    #include <sys/uio.h>
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Header Template
+// ============================================================================
+
+/// Pre-rendered static header bytes for one (session, MsgType) pair
+class HeaderTemplate {
+public:
+    static constexpr size_t MAX_PREFIX_SIZE = 32;   // "8=FIXT.1.1|9="
+    static constexpr size_t MAX_STATIC_SIZE = 192;  // "35=..|49=..|56=..|"
+
+    constexpr HeaderTemplate() noexcept = default;
+
+    HeaderTemplate(std::string_view msg_type,
+                   std::string_view sender_comp_id,
+                   std::string_view target_comp_id,
+                   std::string_view begin_string = fix::FIX_4_4) noexcept
+    {
+        ok_ = append(prefix_, prefix_len_, "8=") &&
+              append(prefix_, prefix_len_, begin_string) &&
+              append(prefix_, prefix_len_, "\x01" "9=") &&
+              append(static_, static_len_, "35=") &&
+              append(static_, static_len_, msg_type) &&
+              append(static_, static_len_, "\x01" "49=") &&
+              append(static_, static_len_, sender_comp_id) &&
+              append(static_, static_len_, "\x01" "56=") &&
+              append(static_, static_len_, target_comp_id) &&
+              append(static_, static_len_, "\x01");
+
+        prefix_sum_ = byte_sum({prefix_.data(), prefix_len_});
+        static_sum_ = byte_sum({static_.data(), static_len_});
+    }
+
+    /// "8=<BeginString>|9="
+    [[nodiscard]] std::span<const char> prefix() const noexcept {
+        return {prefix_.data(), prefix_len_};
+    }
+
+    /// "35=<MsgType>|49=<Sender>|56=<Target>|"
+    [[nodiscard]] std::span<const char> static_fields() const noexcept {
+        return {static_.data(), static_len_};
+    }
+
+    /// Byte sums for the checksum (mod 256 applied by the caller)
+    [[nodiscard]] uint32_t prefix_sum() const noexcept { return prefix_sum_; }
+    [[nodiscard]] uint32_t static_sum() const noexcept { return static_sum_; }
+
+    /// False if any component overflowed the fixed storage
+    [[nodiscard]] bool valid() const noexcept { return ok_; }
+
+private:
+    template<size_t N>
+    static bool append(std::array<char, N>& buf, size_t& len, std::string_view sv) noexcept {
+        if (len + sv.size() > N) return false;
+        std::memcpy(buf.data() + len, sv.data(), sv.size());
+        len += sv.size();
+        return true;
+    }
+
+    static uint32_t byte_sum(std::span<const char> data) noexcept {
+        uint32_t sum = 0;
+        for (char c : data) sum += static_cast<uint8_t>(c);
+        return sum;
+    }
+
+    std::array<char, MAX_PREFIX_SIZE> prefix_{};
+    std::array<char, MAX_STATIC_SIZE> static_{};
+    size_t prefix_len_{0};
+    size_t static_len_{0};
+    uint32_t prefix_sum_{0};
+    uint32_t static_sum_{0};
+    bool ok_{false};
+};
+
+// ============================================================================
+// Scatter Assembler
+// ============================================================================
+
+/// Builds the variable part of a message against a HeaderTemplate.
+/// Field overloads mirror MessageAssembler, so builders can target either.
+class ScatterAssembler {
+public:
+    static constexpr size_t MAX_BODY_SIZE = 4096;
+    static constexpr size_t SEGMENT_COUNT = 5;
+    static constexpr size_t LENGTH_SIZE = 7;   // "NNNNNN|"
+    static constexpr size_t TRAILER_SIZE = 7;  // "10=XXX|"
+
+    using Segments = std::array<std::span<const char>, SEGMENT_COUNT>;
+
+    constexpr ScatterAssembler() noexcept = default;
+
+    /// Begin a message: MsgSeqNum and SendingTime open the variable body
+    ScatterAssembler& start(const HeaderTemplate& header,
+                            uint32_t msg_seq_num,
+                            std::string_view sending_time) noexcept
+    {
+        header_ = &header;
+        pos_ = 0;
+        body_sum_ = 0;
+        field<tag::MsgSeqNum::value>(msg_seq_num);
+        field<tag::SendingTime::value>(sending_time);
+        return *this;
+    }
+
+    /// Append field to message body
+    ScatterAssembler& field(int tag_num, std::string_view value) noexcept {
+        char tag_buf[16];
+        size_t tag_len = serializer::FastIntSerializer<10>::serialize(
+            tag_buf, static_cast<uint32_t>(tag_num));
+        append_raw(tag_buf, tag_len);
+        append_char('=');
+        append_raw(value.data(), value.size());
+        append_char(fix::SOH);
+        return *this;
+    }
+
+    /// Append integer field
+    ScatterAssembler& field(int tag_num, int64_t value) noexcept {
+        char buf[24];
+        size_t len = 0;
+        uint64_t mag = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+        do {
+            buf[sizeof(buf) - 1 - len++] = static_cast<char>('0' + (mag % 10));
+            mag /= 10;
+        } while (mag > 0);
+        if (value < 0) buf[sizeof(buf) - 1 - len++] = '-';
+        return field(tag_num, std::string_view{buf + sizeof(buf) - len, len});
+    }
+
+    /// Append char field
+    ScatterAssembler& field(int tag_num, char value) noexcept {
+        return field(tag_num, std::string_view{&value, 1});
+    }
+
+    /// Append price field (same formatting as MessageAssembler)
+    ScatterAssembler& field(int tag_num, FixedPrice price) noexcept {
+        char buf[32];
+        int len = std::snprintf(buf, sizeof(buf), "%.8g", price.to_double());
+        return field(tag_num, std::string_view{buf, static_cast<size_t>(len)});
+    }
+
+    /// Compile-time tag: "<Tag>=" comes from a constexpr TagString
+    template<int Tag>
+    NFX_FORCE_INLINE ScatterAssembler& field(std::string_view value) noexcept {
+        constexpr serializer::TagString<Tag> tag_str{};
+        append_raw(tag_str.c_str(), tag_str.size());
+        append_raw(value.data(), value.size());
+        append_char(fix::SOH);
+        return *this;
+    }
+
+    template<int Tag>
+    NFX_FORCE_INLINE ScatterAssembler& field(uint32_t value) noexcept {
+        char buf[16];
+        size_t len = serializer::FastIntSerializer<10>::serialize(buf, value);
+        return field<Tag>(std::string_view{buf, len});
+    }
+
+    /// Fill BodyLength and trailer; returns the five wire segments
+    [[nodiscard]] const Segments& finish() noexcept {
+        const auto statics = header_->static_fields();
+        size_t body_length = statics.size() + pos_;
+        serializer::FastIntSerializer<6>::serialize_fixed(length_.data(),
+                                                          static_cast<uint32_t>(body_length));
+        length_[6] = fix::SOH;
+
+        uint32_t sum = header_->prefix_sum() + header_->static_sum() + body_sum_;
+        for (char c : length_) sum += static_cast<uint8_t>(c);
+        auto cs = fix::format_checksum(static_cast<uint8_t>(sum % 256));
+        trailer_ = {'1', '0', '=', cs[0], cs[1], cs[2], fix::SOH};
+
+        segments_ = {
+            header_->prefix(),
+            std::span<const char>{length_.data(), LENGTH_SIZE},
+            statics,
+            std::span<const char>{body_.data(), pos_},
+            std::span<const char>{trailer_.data(), TRAILER_SIZE}
+        };
+        return segments_;
+    }
+
+    /// Segments of the last finished message
+    [[nodiscard]] const Segments& segments() const noexcept { return segments_; }
+
+    /// Total wire size of the last finished message
+    [[nodiscard]] size_t total_size() const noexcept {
+        size_t total = 0;
+        for (const auto& seg : segments_) total += seg.size();
+        return total;
+    }
+
+    /// Flatten into a contiguous buffer (e.g. for the message store)
+    /// @return bytes written, 0 if out is too small
+    [[nodiscard]] size_t copy_to(std::span<char> out) const noexcept {
+        size_t total = total_size();
+        if (out.size() < total) return 0;
+        size_t pos = 0;
+        for (const auto& seg : segments_) {
+            std::memcpy(out.data() + pos, seg.data(), seg.size());
+            pos += seg.size();
+        }
+        return total;
+    }
+
+    /// Append segments to a gather list exposing add(std::span<const char>),
+    /// such as ScatterGatherSend
+    template<typename Sink>
+    [[nodiscard]] bool add_to(Sink& sink) const noexcept {
+        for (const auto& seg : segments_) {
+            if (!sink.add(seg)) return false;
+        }
+        return true;
+    }
+
+#if NFX_PLATFORM_POSIX
+    /// Segments as iovecs for writev()/sendmsg()
+    [[nodiscard]] std::array<struct iovec, SEGMENT_COUNT> iovecs() const noexcept {
+        std::array<struct iovec, SEGMENT_COUNT> iov{};
+        for (size_t i = 0; i < SEGMENT_COUNT; ++i) {
+            iov[i].iov_base = const_cast<char*>(segments_[i].data());
+            iov[i].iov_len = segments_[i].size();
+        }
+        return iov;
+    }
+#endif
+
+private:
+    NFX_FORCE_INLINE void append_raw(const char* data, size_t len) noexcept {
+        if (pos_ >= MAX_BODY_SIZE) [[unlikely]] return;
+        const size_t n = len <= MAX_BODY_SIZE - pos_ ? len : MAX_BODY_SIZE - pos_;
+        std::memcpy(body_.data() + pos_, data, n);
+        for (size_t i = 0; i < n; ++i) body_sum_ += static_cast<uint8_t>(data[i]);
+        pos_ += n;
+    }
+
+    NFX_FORCE_INLINE void append_char(char c) noexcept {
+        if (pos_ < MAX_BODY_SIZE) {
+            body_[pos_++] = c;
+            body_sum_ += static_cast<uint8_t>(c);
+        }
+    }
+
+    const HeaderTemplate* header_{nullptr};
+    std::array<char, MAX_BODY_SIZE> body_{};
+    size_t pos_{0};
+    uint32_t body_sum_{0};  // Running byte sum of body_[0, pos_)
+    std::array<char, LENGTH_SIZE> length_{};
+    std::array<char, TRAILER_SIZE> trailer_{};
+    Segments segments_{};
+};
+
+} // namespace nfx
@@ -167,6 +167,7 @@ public:
     /// Start building a new message
     MessageAssembler& start(std::string_view begin_string = fix::FIX_4_4) noexcept {
         pos_ = 0;
+        sum_ = 0;
         append_field(tag::BeginString::value, begin_string);
         body_length_pos_ = pos_;
         append_raw("9=000000");  // Placeholder
@@ -186,6 +187,18 @@ public:
         return *this;
     }
 
+    /// Append pre-encoded "tag=value<SOH>" fields verbatim
+    MessageAssembler& raw_fields(std::string_view encoded) noexcept {
+        append_raw(encoded);
+        return *this;
+    }
+
+    /// Zero-pad MsgSeqNum (34) to at least `digits` digits (0 = natural width)
+    MessageAssembler& seq_num_width(size_t digits) noexcept {
+        seq_num_width_ = digits < 10 ? static_cast<int>(digits) : 10;
+        return *this;
+    }
+
     /// Append integer field
     MessageAssembler& field(int tag_num, int64_t value) noexcept {
         char buf[32];
@@ -198,6 +211,9 @@ public:
             value /= 10;
         } while (value > 0);
 
+        if (tag_num == tag::MsgSeqNum::value) {
+            while (len < seq_num_width_) buf[len++] = '0';
+        }
         if (negative) buf[len++] = '-';
 
         // Reverse
@@ -229,16 +245,17 @@ public:
         // Calculate body length (from after 9=XXXXXX\x01 to before 10=)
         size_t body_length = pos_ - body_start_;
 
-        // Update body length field
+        // Update body length field, swapping the placeholder digits in the sum
         size_t len_pos = body_length_pos_ + 2;  // After "9="
         for (int i = 5; i >= 0; --i) {
+            sum_ -= static_cast<uint8_t>(buffer_[len_pos + i]);
             buffer_[len_pos + i] = '0' + (body_length % 10);
+            sum_ += static_cast<uint8_t>(buffer_[len_pos + i]);
             body_length /= 10;
         }
 
-        // Calculate checksum (everything before trailer)
-        uint8_t checksum = fix::calculate_checksum(
-            std::span<const char>{buffer_.data(), pos_});
+        // Checksum of everything before the trailer, summed while appending
+        uint8_t checksum = static_cast<uint8_t>(sum_ % 256);
 
         // Append trailer
         append_field(tag::CheckSum::value, checksum::format(checksum));
@@ -254,6 +271,7 @@ public:
     /// Reset for new message
     void reset() noexcept {
         pos_ = 0;
+        sum_ = 0;
         body_length_pos_ = 0;
         body_start_ = 0;
     }
@@ -263,6 +281,7 @@ private:
         for (char c : sv) {
             if (pos_ < MAX_MESSAGE_SIZE) {
                 buffer_[pos_++] = c;
+                sum_ += static_cast<uint8_t>(c);
             }
         }
     }
@@ -270,6 +289,7 @@ private:
     void append_soh() noexcept {
         if (pos_ < MAX_MESSAGE_SIZE) {
             buffer_[pos_++] = fix::SOH;
+            sum_ += static_cast<uint8_t>(fix::SOH);
         }
     }
 
@@ -285,10 +305,14 @@ private:
         for (int i = tag_len - 1; i >= 0; --i) {
             if (pos_ < MAX_MESSAGE_SIZE) {
                 buffer_[pos_++] = tag_buf[i];
+                sum_ += static_cast<uint8_t>(tag_buf[i]);
             }
         }
 
-        if (pos_ < MAX_MESSAGE_SIZE) buffer_[pos_++] = '=';
+        if (pos_ < MAX_MESSAGE_SIZE) {
+            buffer_[pos_++] = '=';
+            sum_ += static_cast<uint8_t>('=');
+        }
         append_raw(value);
         append_soh();
     }
@@ -299,8 +323,10 @@ private:
 
     std::array<char, MAX_MESSAGE_SIZE> buffer_;
     size_t pos_;
+    uint32_t sum_{0};  // Running byte sum of buffer_[0, pos_) for the checksum
     size_t body_length_pos_{0};
     size_t body_start_{0};
+    int seq_num_width_{0};
 };
 
 } // namespace nfx
@@ -9,11 +9,15 @@
 #include "nexusfix/types/error.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
 #include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/parser/schema_decoder.hpp"
 #include "nexusfix/messages/common/header.hpp"
 #include "nexusfix/messages/common/trailer.hpp"
+#include "nexusfix/messages/common/scatter_message.hpp"
 
 namespace nfx::fix44 {
 
+class ExecutionReportTemplate;
+
 // ============================================================================
 // ExecutionReport Message (MsgType = 8)
 // ============================================================================
@@ -56,6 +60,44 @@ struct ExecutionReport {
     // Raw buffer reference
     std::span<const char> raw_data;
 
+    /// Tag -> member bindings for decode<ExecutionReport>()
+    /// Requirements match from_buffer()
+    using FieldSchema = DecodeSchema<
+        RequiredField<tag::BeginString::value,  &ExecutionReport::header, &FixHeader::begin_string>,
+        RequiredField<tag::BodyLength::value,   &ExecutionReport::header, &FixHeader::body_length>,
+        RequiredField<tag::MsgType::value,      &ExecutionReport::header, &FixHeader::msg_type>,
+        RequiredField<tag::SenderCompID::value, &ExecutionReport::header, &FixHeader::sender_comp_id>,
+        RequiredField<tag::TargetCompID::value, &ExecutionReport::header, &FixHeader::target_comp_id>,
+        RequiredField<tag::MsgSeqNum::value,    &ExecutionReport::header, &FixHeader::msg_seq_num>,
+        OptionalField<tag::SendingTime::value,  &ExecutionReport::header, &FixHeader::sending_time>,
+        OptionalField<tag::PossDupFlag::value,  &ExecutionReport::header, &FixHeader::poss_dup_flag>,
+        OptionalField<tag::PossResend::value,   &ExecutionReport::header, &FixHeader::poss_resend>,
+        OptionalField<tag::OrigSendingTime::value, &ExecutionReport::header, &FixHeader::orig_sending_time>,
+        RequiredField<tag::OrderID::value,      &ExecutionReport::order_id>,
+        RequiredField<tag::ExecID::value,       &ExecutionReport::exec_id>,
+        RequiredField<tag::ExecType::value,     &ExecutionReport::exec_type>,
+        RequiredField<tag::OrdStatus::value,    &ExecutionReport::ord_status>,
+        RequiredField<tag::Symbol::value,       &ExecutionReport::symbol>,
+        RequiredField<tag::Side::value,         &ExecutionReport::side>,
+        OptionalField<tag::LeavesQty::value,    &ExecutionReport::leaves_qty>,
+        OptionalField<tag::CumQty::value,       &ExecutionReport::cum_qty>,
+        OptionalField<tag::AvgPx::value,        &ExecutionReport::avg_px>,
+        OptionalField<tag::ClOrdID::value,      &ExecutionReport::cl_ord_id>,
+        OptionalField<tag::OrigClOrdID::value,  &ExecutionReport::orig_cl_ord_id>,
+        OptionalField<19,                       &ExecutionReport::exec_ref_id>,  // ExecRefID
+        OptionalField<tag::OrderQty::value,     &ExecutionReport::order_qty>,
+        OptionalField<tag::OrdType::value,      &ExecutionReport::ord_type>,
+        OptionalField<tag::Price::value,        &ExecutionReport::price>,
+        OptionalField<tag::StopPx::value,       &ExecutionReport::stop_px>,
+        OptionalField<tag::TimeInForce::value,  &ExecutionReport::time_in_force>,
+        OptionalField<tag::LastPx::value,       &ExecutionReport::last_px>,
+        OptionalField<tag::LastQty::value,      &ExecutionReport::last_qty>,
+        OptionalField<tag::Text::value,         &ExecutionReport::text>,
+        OptionalField<tag::OrdRejReason::value, &ExecutionReport::ord_rej_reason>,
+        OptionalField<tag::Account::value,      &ExecutionReport::account>,
+        OptionalField<tag::TransactTime::value, &ExecutionReport::transact_time>
+    >;
+
     constexpr ExecutionReport() noexcept
         : header{}
         , order_id{}
@@ -235,6 +277,14 @@ struct ExecutionReport {
         return msg;
     }
 
+    /// Single-pass typed decode (see decode<T>() in schema_decoder.hpp)
+    template <SchemaCheck Check = SchemaCheck::Required>
+    [[nodiscard]] static ParseResult<ExecutionReport> decode(
+        std::span<const char> buffer) noexcept
+    {
+        return nfx::decode<ExecutionReport, Check>(buffer);
+    }
+
     // ========================================================================
     // Building
     // ========================================================================
@@ -274,8 +324,28 @@ struct ExecutionReport {
                 .field(tag::SenderCompID::value, sender_comp_id_)
                 .field(tag::TargetCompID::value, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
-                .field(tag::SendingTime::value, sending_time_)
-                .field(tag::OrderID::value, order_id_)
+                .field(tag::SendingTime::value, sending_time_);
+            append_body(asm_);
+            return asm_.finish();
+        }
+
+        /// Scatter-gather build: header bytes come from the session's template
+        /// (MsgType/CompIDs set on this builder are ignored)
+        [[nodiscard]] const ScatterAssembler::Segments& build(
+            ScatterAssembler& sg, const HeaderTemplate& header) const noexcept
+        {
+            sg.start(header, msg_seq_num_, sending_time_);
+            append_body(sg);
+            return sg.finish();
+        }
+
+    private:
+        friend class ExecutionReportTemplate;
+
+        /// Body fields after SendingTime, shared by both assemblers
+        template<typename Assembler>
+        void append_body(Assembler& asm_) const noexcept {
+            asm_.field(tag::OrderID::value, order_id_)
                 .field(tag::ExecID::value, exec_id_)
                 .field(tag::ExecType::value, static_cast<char>(exec_type_))
                 .field(tag::OrdStatus::value, static_cast<char>(ord_status_))
@@ -309,11 +379,8 @@ struct ExecutionReport {
             if (!text_.empty()) {
                 asm_.field(tag::Text::value, text_);
             }
-
-            return asm_.finish();
         }
 
-    private:
         std::string_view sender_comp_id_;
         std::string_view target_comp_id_;
         uint32_t msg_seq_num_{1};
@@ -78,6 +78,9 @@ struct MarketDataRequest {
 
     class Builder {
     public:
+        static constexpr size_t MAX_ENTRY_TYPES = 16;
+        static constexpr size_t MAX_SYMBOLS = 64;   // RelatedSym entries per request
+
         Builder& sender_comp_id(std::string_view v) noexcept { sender_comp_id_ = v; return *this; }
         Builder& target_comp_id(std::string_view v) noexcept { target_comp_id_ = v; return *this; }
         Builder& msg_seq_num(uint32_t v) noexcept { msg_seq_num_ = v; return *this; }
@@ -142,9 +145,6 @@ struct MarketDataRequest {
         }
 
     private:
-        static constexpr size_t MAX_ENTRY_TYPES = 16;
-        static constexpr size_t MAX_SYMBOLS = 64;
-
         std::string_view sender_comp_id_;
         std::string_view target_comp_id_;
         uint32_t msg_seq_num_{1};
@@ -201,6 +201,12 @@ struct MarketDataSnapshotFullRefresh {
         return parser::MDEntryIterator{raw_data, no_md_entries};
     }
 
+    /// Decode the MDEntry group into SoA columns (see parser::decode_md_columns)
+    template <size_t Capacity>
+    size_t decode_columns(MDEntryColumns<Capacity>& out) const noexcept {
+        return parser::decode_md_columns(entries(), out, MDUpdateAction::New);
+    }
+
     /// Get number of entries
     [[nodiscard]] constexpr size_t entry_count() const noexcept {
         return no_md_entries;
@@ -290,6 +296,12 @@ struct MarketDataIncrementalRefresh {
         return parser::MDEntryIterator{raw_data, no_md_entries, tag::MDUpdateAction::value};
     }
 
+    /// Decode the MDEntry group into SoA columns (see parser::decode_md_columns)
+    template <size_t Capacity>
+    size_t decode_columns(MDEntryColumns<Capacity>& out) const noexcept {
+        return parser::decode_md_columns(entries(), out);
+    }
+
     /// Get number of entries
     [[nodiscard]] constexpr size_t entry_count() const noexcept {
         return no_md_entries;
@@ -0,0 +1,582 @@
+#pragma once
+
+/// @file mass_quote.hpp
+/// @brief MassQuote (35=i) encoder and MassQuoteAcknowledgement (35=b) decoder
+///
+/// MassQuoteEncoder writes the nested QuoteSet / QuoteEntry groups straight
+/// into one preallocated buffer behind a header rendered once by prepare().
+/// Every group level is a compile-time serializer::MessageLayout, so a
+/// quote entry costs its value bytes plus constant tag segments; the byte
+/// sum is kept while writing and finish() only patches BodyLength and
+/// appends the CheckSum.
+///
+/// Counts precede their groups on the wire, so they are declared up front:
+///
+///     MassQuoteEncoder enc;
+///     enc.prepare("FIX.4.4", "MM01", "VENUE");           // At logon
+///     enc.begin(seq, sending_time, "Q42", 1);            // 1 QuoteSet
+///     enc.add_set("S1", "AAPL", 2);                      // 2 QuoteEntries
+///     enc.add_entry({"E1", "AAPL  260320C00150000", bid, offer, bsz, osz});
+///     enc.add_entry({"E2", "AAPL  260320P00150000", bid, offer, bsz, osz});
+///     auto msg = enc.finish();
+///
+/// Acknowledgements and inbound quotes decode lazily: quote_sets() and
+/// QuoteSet::entries() are parser::RepeatingGroupIterator walks over the
+/// received bytes, nothing is copied.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/parser/repeating_group.hpp"
+#include "nexusfix/serializer/message_layout.hpp"
+#include "nexusfix/messages/common/header.hpp"
+
+namespace nfx::fix44 {
+
+// ============================================================================
+// Quote Types
+// ============================================================================
+
+/// QuoteStatus (297)
+enum class QuoteStatus : uint8_t {
+    Accepted                 = 0,
+    CancelForSymbol          = 1,
+    CancelForSecurityType    = 2,
+    CancelForUnderlying      = 3,
+    CancelAll                = 4,
+    Rejected                 = 5,
+    RemovedFromMarket        = 6,
+    Expired                  = 7,
+    Query                    = 8,
+    QuoteNotFound            = 9,
+    Pending                  = 10,
+    Pass                     = 11,
+    LockedMarketWarning      = 12,
+    CrossMarketWarning       = 13,
+    CanceledDueToLockMarket  = 14,
+    CanceledDueToCrossMarket = 15
+};
+
+/// One two-sided quote. A zero price or size leaves that field out
+/// (one-sided quotes omit the other side's price and size).
+struct QuoteEntry {
+    std::string_view quote_entry_id;  // Tag 299 - Required
+    std::string_view symbol;          // Tag 55  - Optional
+    FixedPrice bid_px{};              // Tag 132
+    FixedPrice offer_px{};            // Tag 133
+    Qty bid_size{};                   // Tag 134
+    Qty offer_size{};                 // Tag 135
+    int entry_reject_reason{0};       // Tag 368 - Acknowledgements only (0 = none)
+
+    [[nodiscard]] constexpr bool rejected() const noexcept { return entry_reject_reason != 0; }
+};
+
+// ============================================================================
+// QuoteEntry / QuoteSet Decoding
+// ============================================================================
+
+/// Parse a single QuoteEntry from a repeating group entry
+[[nodiscard]] NFX_HOT
+inline QuoteEntry parse_quote_entry(const parser::RepeatingGroupIterator::Entry& entry) noexcept {
+    QuoteEntry quote;
+    quote.quote_entry_id = entry.get_string(tag::QuoteEntryID::value);
+    quote.symbol = entry.get_string(tag::Symbol::value);
+    quote.bid_px = entry.get_price(tag::BidPx::value);
+    quote.offer_px = entry.get_price(tag::OfferPx::value);
+    quote.bid_size = entry.get_qty(tag::BidSize::value);
+    quote.offer_size = entry.get_qty(tag::OfferSize::value);
+    if (auto v = entry.get_int(tag::QuoteEntryRejectReason::value)) {
+        quote.entry_reject_reason = static_cast<int>(*v);
+    }
+    return quote;
+}
+
+/// Typed iterator over the QuoteEntry group of one QuoteSet
+class QuoteEntryIterator {
+public:
+    QuoteEntryIterator() noexcept = default;
+
+    QuoteEntryIterator(std::span<const char> set_data, size_t count) noexcept
+        : iter_{set_data, tag::QuoteEntryID::value, count}
+    {}
+
+    [[nodiscard]] bool has_next() const noexcept { return iter_.has_next(); }
+
+    [[nodiscard]] NFX_HOT
+    QuoteEntry next() noexcept { return parse_quote_entry(iter_.next()); }
+
+    /// Indexed entry, for fields beyond those in QuoteEntry
+    [[nodiscard]] parser::RepeatingGroupIterator::Entry next_entry() noexcept {
+        return iter_.next();
+    }
+
+    [[nodiscard]] size_t count() const noexcept { return iter_.count(); }
+
+private:
+    parser::RepeatingGroupIterator iter_;
+};
+
+/// One QuoteSet: its own fields and the bytes of its QuoteEntry group
+struct QuoteSet {
+    std::string_view quote_set_id;       // Tag 302 - Required
+    std::string_view underlying_symbol;  // Tag 311 - Optional
+    uint32_t tot_no_quote_entries{0};    // Tag 304 - Optional
+    size_t no_quote_entries{0};          // Tag 295 - Required
+    std::span<const char> raw_data;      // The set, QuoteSetID onwards
+
+    [[nodiscard]] QuoteEntryIterator entries() const noexcept {
+        return QuoteEntryIterator{raw_data, no_quote_entries};
+    }
+};
+
+/// Typed iterator over the QuoteSet group (296)
+class QuoteSetIterator {
+public:
+    QuoteSetIterator() noexcept = default;
+
+    QuoteSetIterator(std::span<const char> data, size_t count) noexcept
+        : iter_{data, tag::QuoteSetID::value, count}
+    {}
+
+    [[nodiscard]] bool has_next() const noexcept { return iter_.has_next(); }
+
+    /// Next set. Its fields come before NoQuoteEntries (295); the indexed
+    /// fields are read up to there, so nested entries are never looked up.
+    [[nodiscard]] NFX_HOT
+    QuoteSet next() noexcept {
+        const auto entry = iter_.next();
+        QuoteSet set;
+        set.raw_data = entry.data;
+        for (size_t i = 0; i < entry.field_count(); ++i) {
+            const FieldView f = entry.field_at(i);
+            switch (f.tag) {
+                case tag::QuoteSetID::value:
+                    set.quote_set_id = std::string_view{f.value.data(), f.value.size()};
+                    break;
+                case tag::UnderlyingSymbol::value:
+                    set.underlying_symbol = std::string_view{f.value.data(), f.value.size()};
+                    break;
+                case tag::TotNoQuoteEntries::value:
+                    set.tot_no_quote_entries = static_cast<uint32_t>(f.as_int().value_or(0));
+                    break;
+                case tag::NoQuoteEntries::value:
+                    set.no_quote_entries = static_cast<size_t>(f.as_int().value_or(0));
+                    return set;
+                default:
+                    break;
+            }
+        }
+        return set;
+    }
+
+    [[nodiscard]] size_t count() const noexcept { return iter_.count(); }
+
+private:
+    parser::RepeatingGroupIterator iter_;
+};
+
+// ============================================================================
+// MassQuote Message (MsgType = i)
+// ============================================================================
+
+/// FIX 4.4 MassQuote message (35=i)
+/// Multiple two-sided quotes in nested QuoteSet / QuoteEntry groups
+struct MassQuote {
+    static constexpr char MSG_TYPE = msg_type::MassQuote;
+
+    FixHeader header;
+    std::string_view quote_req_id;    // Tag 131 - Optional
+    std::string_view quote_id;        // Tag 117 - Required
+    int quote_response_level;         // Tag 301 - Optional
+    std::string_view account;         // Tag 1   - Optional
+    size_t no_quote_sets;             // Tag 296 - Required
+    std::span<const char> raw_data;
+
+    constexpr MassQuote() noexcept
+        : header{}
+        , quote_req_id{}
+        , quote_id{}
+        , quote_response_level{0}
+        , account{}
+        , no_quote_sets{0}
+        , raw_data{} {}
+
+    [[nodiscard]] constexpr std::span<const char> raw() const noexcept { return raw_data; }
+    [[nodiscard]] constexpr uint32_t msg_seq_num() const noexcept { return header.msg_seq_num; }
+    [[nodiscard]] constexpr std::string_view sender_comp_id() const noexcept { return header.sender_comp_id; }
+    [[nodiscard]] constexpr std::string_view target_comp_id() const noexcept { return header.target_comp_id; }
+    [[nodiscard]] constexpr std::string_view sending_time() const noexcept { return header.sending_time; }
+
+    /// Get iterator over the QuoteSet repeating group
+    [[nodiscard]] QuoteSetIterator quote_sets() const noexcept {
+        return QuoteSetIterator{raw_data, no_quote_sets};
+    }
+
+    // ========================================================================
+    // Parsing
+    // ========================================================================
+
+    [[nodiscard]] static ParseResult<MassQuote> from_buffer(
+        std::span<const char> buffer) noexcept
+    {
+        auto parsed = IndexedParser::parse(buffer);
+        if (!parsed.has_value()) {
+            return std::unexpected{parsed.error()};
+        }
+
+        auto& p = *parsed;
+
+        if (p.msg_type() != MSG_TYPE) {
+            return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType}};
+        }
+
+        MassQuote msg;
+        msg.raw_data = buffer;
+        msg.header.begin_string = p.get_string(tag::BeginString::value);
+        msg.header.msg_type = p.msg_type();
+        msg.header.sender_comp_id = p.sender_comp_id();
+        msg.header.target_comp_id = p.target_comp_id();
+        msg.header.msg_seq_num = p.msg_seq_num();
+        msg.header.sending_time = p.sending_time();
+
+        msg.quote_req_id = p.get_string(tag::QuoteReqID::value);
+        msg.quote_id = p.get_string(tag::QuoteID::value);
+        if (msg.quote_id.empty()) {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::QuoteID::value}};
+        }
+
+        if (auto v = p.get_int(tag::QuoteResponseLevel::value)) {
+            msg.quote_response_level = static_cast<int>(*v);
+        }
+        msg.account = p.get_string(tag::Account::value);
+
+        if (auto v = p.get_int(tag::NoQuoteSets::value)) {
+            msg.no_quote_sets = static_cast<size_t>(*v);
+        } else {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::NoQuoteSets::value}};
+        }
+
+        return msg;
+    }
+};
+
+// ============================================================================
+// MassQuoteAcknowledgement Message (MsgType = b)
+// ============================================================================
+
+/// FIX 4.4 MassQuoteAcknowledgement message (35=b)
+/// Venue response to a MassQuote; the QuoteSet group, when present, carries
+/// per-entry QuoteEntryRejectReason (368)
+struct MassQuoteAck {
+    static constexpr char MSG_TYPE = msg_type::MassQuoteAcknowledgement;
+
+    FixHeader header;
+    std::string_view quote_req_id;    // Tag 131 - Optional
+    std::string_view quote_id;        // Tag 117 - Conditional
+    QuoteStatus quote_status;         // Tag 297 - Required
+    int quote_reject_reason;          // Tag 300 - Optional (0 = none)
+    std::string_view account;         // Tag 1   - Optional
+    std::string_view text;            // Tag 58  - Optional
+    size_t no_quote_sets;             // Tag 296 - Optional
+    std::span<const char> raw_data;
+
+    constexpr MassQuoteAck() noexcept
+        : header{}
+        , quote_req_id{}
+        , quote_id{}
+        , quote_status{QuoteStatus::Accepted}
+        , quote_reject_reason{0}
+        , account{}
+        , text{}
+        , no_quote_sets{0}
+        , raw_data{} {}
+
+    [[nodiscard]] constexpr std::span<const char> raw() const noexcept { return raw_data; }
+    [[nodiscard]] constexpr uint32_t msg_seq_num() const noexcept { return header.msg_seq_num; }
+    [[nodiscard]] constexpr std::string_view sender_comp_id() const noexcept { return header.sender_comp_id; }
+    [[nodiscard]] constexpr std::string_view target_comp_id() const noexcept { return header.target_comp_id; }
+    [[nodiscard]] constexpr std::string_view sending_time() const noexcept { return header.sending_time; }
+
+    [[nodiscard]] constexpr bool is_accepted() const noexcept {
+        return quote_status == QuoteStatus::Accepted;
+    }
+
+    [[nodiscard]] constexpr bool is_rejected() const noexcept {
+        return quote_status == QuoteStatus::Rejected;
+    }
+
+    /// Get iterator over the QuoteSet repeating group
+    [[nodiscard]] QuoteSetIterator quote_sets() const noexcept {
+        return QuoteSetIterator{raw_data, no_quote_sets};
+    }
+
+    // ========================================================================
+    // Parsing
+    // ========================================================================
+
+    [[nodiscard]] static ParseResult<MassQuoteAck> from_buffer(
+        std::span<const char> buffer) noexcept
+    {
+        auto parsed = IndexedParser::parse(buffer);
+        if (!parsed.has_value()) {
+            return std::unexpected{parsed.error()};
+        }
+
+        auto& p = *parsed;
+
+        if (p.msg_type() != MSG_TYPE) {
+            return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType}};
+        }
+
+        MassQuoteAck msg;
+        msg.raw_data = buffer;
+        msg.header.begin_string = p.get_string(tag::BeginString::value);
+        msg.header.msg_type = p.msg_type();
+        msg.header.sender_comp_id = p.sender_comp_id();
+        msg.header.target_comp_id = p.target_comp_id();
+        msg.header.msg_seq_num = p.msg_seq_num();
+        msg.header.sending_time = p.sending_time();
+
+        msg.quote_req_id = p.get_string(tag::QuoteReqID::value);
+        msg.quote_id = p.get_string(tag::QuoteID::value);
+
+        if (auto v = p.get_int(tag::QuoteStatus::value)) {
+            msg.quote_status = static_cast<QuoteStatus>(*v);
+        } else {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::QuoteStatus::value}};
+        }
+
+        if (auto v = p.get_int(tag::QuoteRejectReason::value)) {
+            msg.quote_reject_reason = static_cast<int>(*v);
+        }
+        msg.account = p.get_string(tag::Account::value);
+        msg.text = p.get_string(tag::Text::value);
+
+        if (auto v = p.get_int(tag::NoQuoteSets::value)) {
+            msg.no_quote_sets = static_cast<size_t>(*v);
+        }
+
+        return msg;
+    }
+};
+
+// ============================================================================
+// MassQuote Encoder
+// ============================================================================
+
+/// Streaming MassQuote encoder over a preallocated buffer
+/// @tparam MaxSize Largest message, header and trailer included
+template <size_t MaxSize = 64 * 1024>
+class BasicMassQuoteEncoder {
+public:
+    /// MsgSeqNum through NoQuoteSets
+    using HeadLayout = serializer::MessageLayout<
+        serializer::PaddedUIntSlot<tag::MsgSeqNum::value>,
+        serializer::StringSlot<tag::SendingTime::value, 32>,
+        serializer::Optional<serializer::StringSlot<tag::QuoteReqID::value>>,
+        serializer::StringSlot<tag::QuoteID::value>,
+        serializer::Optional<serializer::UIntSlot<tag::QuoteResponseLevel::value>>,
+        serializer::Optional<serializer::StringSlot<tag::Account::value>>,
+        serializer::UIntSlot<tag::NoQuoteSets::value>>;
+
+    /// QuoteSetID through NoQuoteEntries
+    using SetLayout = serializer::MessageLayout<
+        serializer::StringSlot<tag::QuoteSetID::value, 32>,
+        serializer::Optional<serializer::StringSlot<tag::UnderlyingSymbol::value, 32>>,
+        serializer::Optional<serializer::UIntSlot<tag::TotNoQuoteEntries::value>>,
+        serializer::UIntSlot<tag::NoQuoteEntries::value>>;
+
+    /// One QuoteEntry
+    using EntryLayout = serializer::MessageLayout<
+        serializer::StringSlot<tag::QuoteEntryID::value, 32>,
+        serializer::Optional<serializer::StringSlot<tag::Symbol::value, 32>>,
+        serializer::Optional<serializer::PriceSlot<tag::BidPx::value>>,
+        serializer::Optional<serializer::PriceSlot<tag::OfferPx::value>>,
+        serializer::Optional<serializer::QtySlot<tag::BidSize::value>>,
+        serializer::Optional<serializer::QtySlot<tag::OfferSize::value>>>;
+
+    static constexpr size_t HEADER_MAX = 192;       // "8=..|" through "56=..|"
+    static constexpr size_t TRAILER_SIZE = 7;       // "10=XXX|"
+
+    static_assert(MaxSize >= HEADER_MAX + HeadLayout::max_size + SetLayout::max_size +
+                             EntryLayout::max_size + TRAILER_SIZE,
+                  "MaxSize must hold at least one set with one entry");
+
+    BasicMassQuoteEncoder() noexcept = default;
+
+    // Large buffer; encoders live in place next to their session
+    BasicMassQuoteEncoder(const BasicMassQuoteEncoder&) = delete;
+    BasicMassQuoteEncoder& operator=(const BasicMassQuoteEncoder&) = delete;
+
+    /// Render the session's static header bytes (typically at logon)
+    /// @param seq_num_width MsgSeqNum zero-padding (SessionConfig::seq_num_width)
+    void prepare(std::string_view begin_string,
+                 std::string_view sender_comp_id,
+                 std::string_view target_comp_id,
+                 uint8_t seq_num_width = 0) noexcept
+    {
+        serializer::FastMessageBuilder<HEADER_MAX> header;
+        header.begin_string(begin_string);
+        length_pos_ = header.body_length_placeholder();
+        header.mark_body_start();
+        header.msg_type(MassQuote::MSG_TYPE);
+        header.sender_comp_id(sender_comp_id);
+        header.target_comp_id(target_comp_id);
+
+        header_end_ = header.size();
+        body_start_ = header.body_start();
+        std::memcpy(buffer_.data(), header.c_str(), header_end_);
+        // BodyLength digits change per message: keep them out of the stored sum
+        header_sum_ = header.running_sum() - length_digit_sum();
+        seq_num_width_ = seq_num_width;
+        prepared_ = true;
+        open_ = false;
+    }
+
+    [[nodiscard]] bool prepared() const noexcept { return prepared_; }
+
+    /// QuoteReqID (131) sent with every message until changed (empty = omit)
+    BasicMassQuoteEncoder& quote_req_id(std::string_view v) noexcept { quote_req_id_ = v; return *this; }
+    /// QuoteResponseLevel (301) sent with every message (0 = omit)
+    BasicMassQuoteEncoder& quote_response_level(uint32_t v) noexcept { response_level_ = v; return *this; }
+    /// Account (1) sent with every message (empty = omit)
+    BasicMassQuoteEncoder& account(std::string_view v) noexcept { account_ = v; return *this; }
+
+    /// Start a message announcing `set_count` QuoteSets
+    /// @return false if not prepared or set_count is 0
+    bool begin(uint32_t msg_seq_num, std::string_view sending_time,
+               std::string_view quote_id, uint32_t set_count) noexcept {
+        open_ = prepared_ && set_count != 0 && !quote_id.empty();
+        if (!open_) return false;
+
+        sum_ = header_sum_;
+        pos_ = header_end_ + HeadLayout::encode(
+            buffer_.data() + header_end_, sum_,
+            serializer::PaddedUInt{msg_seq_num, seq_num_width_}, sending_time,
+            quote_req_id_, quote_id, response_level_, account_, set_count);
+        sets_left_ = set_count;
+        entries_left_ = 0;
+        return true;
+    }
+
+    /// Open the next QuoteSet announcing `entry_count` QuoteEntries
+    /// @param tot_entries TotNoQuoteEntries when the set spans messages (0 = omit)
+    /// @return false (and the message is abandoned) if the previous set is
+    ///         not complete, all sets are written or the buffer is full
+    bool add_set(std::string_view quote_set_id, std::string_view underlying_symbol,
+                 uint32_t entry_count, uint32_t tot_entries = 0) noexcept {
+        if (!open_ || entries_left_ != 0 || sets_left_ == 0 || entry_count == 0 ||
+            quote_set_id.empty() || !fits(SetLayout::max_size)) [[unlikely]] {
+            open_ = false;
+            return false;
+        }
+        pos_ += SetLayout::encode(buffer_.data() + pos_, sum_,
+                                  quote_set_id, underlying_symbol, tot_entries, entry_count);
+        --sets_left_;
+        entries_left_ = entry_count;
+        return true;
+    }
+
+    /// Append one QuoteEntry to the open set
+    /// @return false (and the message is abandoned) if the set is already
+    ///         full, the entry has no QuoteEntryID or the buffer is full
+    [[nodiscard]] NFX_HOT
+    bool add_entry(const QuoteEntry& entry) noexcept {
+        if (!open_ || entries_left_ == 0 || entry.quote_entry_id.empty() ||
+            !fits(EntryLayout::max_size)) [[unlikely]] {
+            open_ = false;
+            return false;
+        }
+        pos_ += EntryLayout::encode(buffer_.data() + pos_, sum_,
+                                    entry.quote_entry_id, entry.symbol,
+                                    entry.bid_px, entry.offer_px,
+                                    entry.bid_size, entry.offer_size);
+        --entries_left_;
+        return true;
+    }
+
+    /// Patch BodyLength and append the CheckSum
+    /// @return Message bytes, valid until the next begin()/prepare();
+    ///         empty if the declared sets and entries were not all written
+    [[nodiscard]] std::span<const char> finish() noexcept {
+        if (!open_ || sets_left_ != 0 || entries_left_ != 0) [[unlikely]] {
+            open_ = false;
+            return {};
+        }
+        open_ = false;
+
+        serializer::FastIntSerializer<6>::serialize_fixed(
+            buffer_.data() + length_pos_, static_cast<uint32_t>(pos_ - body_start_));
+        const uint32_t sum = sum_ + length_digit_sum();
+
+        const auto checksum = static_cast<uint8_t>(sum % 256);
+        char* trailer = buffer_.data() + pos_;
+        std::memcpy(trailer, "10=", 3);
+        trailer[3] = static_cast<char>('0' + checksum / 100);
+        trailer[4] = static_cast<char>('0' + (checksum / 10) % 10);
+        trailer[5] = static_cast<char>('0' + checksum % 10);
+        trailer[6] = serializer::SOH;
+
+        return {buffer_.data(), pos_ + TRAILER_SIZE};
+    }
+
+    /// A message is started and not yet finished or abandoned
+    [[nodiscard]] bool in_progress() const noexcept { return open_; }
+
+    /// Bytes written so far, trailer excluded
+    [[nodiscard]] size_t size() const noexcept { return open_ ? pos_ : 0; }
+
+    /// Worst-case QuoteEntries still fitting in the buffer
+    [[nodiscard]] size_t entries_left_in_buffer() const noexcept {
+        const size_t used = open_ ? pos_ : header_end_ + HeadLayout::max_size;
+        const size_t reserve = used + SetLayout::max_size + TRAILER_SIZE;
+        return reserve < MaxSize ? (MaxSize - reserve) / EntryLayout::max_size : 0;
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return MaxSize; }
+
+private:
+    static constexpr size_t LENGTH_DIGITS = 6;
+
+    [[nodiscard]] bool fits(size_t layout_max) const noexcept {
+        return pos_ + layout_max + TRAILER_SIZE <= MaxSize;
+    }
+
+    [[nodiscard]] uint32_t length_digit_sum() const noexcept {
+        uint32_t sum = 0;
+        for (size_t i = 0; i < LENGTH_DIGITS; ++i) {
+            sum += static_cast<uint8_t>(buffer_[length_pos_ + i]);
+        }
+        return sum;
+    }
+
+    std::array<char, MaxSize> buffer_{};
+    size_t length_pos_{0};
+    size_t body_start_{0};
+    size_t header_end_{0};
+    uint32_t header_sum_{0};
+    size_t pos_{0};
+    uint32_t sum_{0};               // Running byte sum of buffer_[0, pos_)
+    uint32_t sets_left_{0};
+    uint32_t entries_left_{0};      // Still owed to the open set
+    std::string_view quote_req_id_;
+    std::string_view account_;
+    uint32_t response_level_{0};
+    uint8_t seq_num_width_{0};
+    bool prepared_{false};
+    bool open_{false};
+};
+
+/// MassQuote encoder with a 64 KiB message buffer
+using MassQuoteEncoder = BasicMassQuoteEncoder<>;
+
+} // namespace nfx::fix44
@@ -10,9 +10,15 @@
 #include "nexusfix/parser/runtime_parser.hpp"
 #include "nexusfix/messages/common/header.hpp"
 #include "nexusfix/messages/common/trailer.hpp"
+#include "nexusfix/messages/common/scatter_message.hpp"
 
 namespace nfx::fix44 {
 
+class NewOrderTemplate;
+class OrderCancelTemplate;
+class OrderCancelReplaceTemplate;
+class OrderStatusTemplate;
+
 // ============================================================================
 // NewOrderSingle Message (MsgType = D)
 // ============================================================================
@@ -239,14 +245,41 @@ struct NewOrderSingle {
         Builder& ex_destination(std::string_view v) noexcept { ex_destination_ = v; return *this; }
         Builder& text(std::string_view v) noexcept { text_ = v; return *this; }
 
+        // Order terms, read by pre-trade checks before building
+        [[nodiscard]] std::string_view symbol() const noexcept { return symbol_; }
+        [[nodiscard]] Side side() const noexcept { return side_; }
+        [[nodiscard]] Qty order_qty() const noexcept { return order_qty_; }
+        [[nodiscard]] OrdType ord_type() const noexcept { return ord_type_; }
+        [[nodiscard]] FixedPrice price() const noexcept { return price_; }
+
         [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
             asm_.start()
                 .field(tag::MsgType::value, MSG_TYPE)
                 .field(tag::SenderCompID::value, sender_comp_id_)
                 .field(tag::TargetCompID::value, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
-                .field(tag::SendingTime::value, sending_time_)
-                .field(tag::ClOrdID::value, cl_ord_id_)
+                .field(tag::SendingTime::value, sending_time_);
+            append_body(asm_);
+            return asm_.finish();
+        }
+
+        /// Scatter-gather build: header bytes come from the session's template
+        /// (MsgType/CompIDs set on this builder are ignored)
+        [[nodiscard]] const ScatterAssembler::Segments& build(
+            ScatterAssembler& sg, const HeaderTemplate& header) const noexcept
+        {
+            sg.start(header, msg_seq_num_, sending_time_);
+            append_body(sg);
+            return sg.finish();
+        }
+
+    private:
+        friend class NewOrderTemplate;
+
+        /// Body fields after SendingTime, shared by both assemblers
+        template<typename Assembler>
+        void append_body(Assembler& asm_) const noexcept {
+            asm_.field(tag::ClOrdID::value, cl_ord_id_)
                 .field(tag::Symbol::value, symbol_)
                 .field(tag::Side::value, static_cast<char>(side_))
                 .field(tag::TransactTime::value, transact_time_)
@@ -278,11 +311,8 @@ struct NewOrderSingle {
             if (!text_.empty()) {
                 asm_.field(tag::Text::value, text_);
             }
-
-            return asm_.finish();
         }
 
-    private:
         std::string_view sender_comp_id_;
         std::string_view target_comp_id_;
         uint32_t msg_seq_num_{1};
@@ -399,8 +429,28 @@ struct OrderCancelRequest {
                 .field(tag::SenderCompID::value, sender_comp_id_)
                 .field(tag::TargetCompID::value, target_comp_id_)
                 .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
-                .field(tag::SendingTime::value, sending_time_)
-                .field(tag::OrigClOrdID::value, orig_cl_ord_id_)
+                .field(tag::SendingTime::value, sending_time_);
+            append_body(asm_);
+            return asm_.finish();
+        }
+
+        /// Scatter-gather build: header bytes come from the session's template
+        /// (MsgType/CompIDs set on this builder are ignored)
+        [[nodiscard]] const ScatterAssembler::Segments& build(
+            ScatterAssembler& sg, const HeaderTemplate& header) const noexcept
+        {
+            sg.start(header, msg_seq_num_, sending_time_);
+            append_body(sg);
+            return sg.finish();
+        }
+
+    private:
+        friend class OrderCancelTemplate;
+
+        /// Body fields after SendingTime, shared by both assemblers
+        template<typename Assembler>
+        void append_body(Assembler& asm_) const noexcept {
+            asm_.field(tag::OrigClOrdID::value, orig_cl_ord_id_)
                 .field(tag::ClOrdID::value, cl_ord_id_)
                 .field(tag::Symbol::value, symbol_)
                 .field(tag::Side::value, static_cast<char>(side_))
@@ -413,11 +463,242 @@ struct OrderCancelRequest {
             if (!order_id_.empty()) {
                 asm_.field(tag::OrderID::value, order_id_);
             }
+        }
+
+        std::string_view sender_comp_id_;
+        std::string_view target_comp_id_;
+        uint32_t msg_seq_num_{1};
+        std::string_view sending_time_;
+        std::string_view orig_cl_ord_id_;
+        std::string_view cl_ord_id_;
+        std::string_view symbol_;
+        Side side_{Side::Buy};
+        std::string_view transact_time_;
+        Qty order_qty_;
+        std::string_view order_id_;
+    };
+};
+
+// ============================================================================
+// OrderCancelReplaceRequest Message (MsgType = G)
+// ============================================================================
+
+/// FIX 4.4 OrderCancelReplaceRequest message (35=G)
+/// Used to change the quantity or price of a live order
+struct OrderCancelReplaceRequest {
+    static constexpr char MSG_TYPE = msg_type::OrderCancelReplaceRequest;
+
+    FixHeader header;
+    std::string_view orig_cl_ord_id;  // Tag 41 - Required
+    std::string_view cl_ord_id;       // Tag 11 - Required
+    std::string_view symbol;          // Tag 55 - Required
+    Side side;                        // Tag 54 - Required
+    std::string_view transact_time;   // Tag 60 - Required
+    Qty order_qty;                    // Tag 38 - Required
+    OrdType ord_type;                 // Tag 40 - Required
+    FixedPrice price;                 // Tag 44 - Conditional (Limit orders)
+    FixedPrice stop_px;               // Tag 99 - Conditional (Stop orders)
+    TimeInForce time_in_force;        // Tag 59 - Optional
+    std::string_view order_id;        // Tag 37 - Optional
+    std::string_view account;         // Tag 1 - Optional
+    std::string_view text;            // Tag 58 - Optional
+    std::span<const char> raw_data;
+
+    constexpr OrderCancelReplaceRequest() noexcept
+        : header{}
+        , orig_cl_ord_id{}
+        , cl_ord_id{}
+        , symbol{}
+        , side{Side::Buy}
+        , transact_time{}
+        , order_qty{}
+        , ord_type{OrdType::Limit}
+        , price{}
+        , stop_px{}
+        , time_in_force{TimeInForce::Day}
+        , order_id{}
+        , account{}
+        , text{}
+        , raw_data{} {}
+
+    [[nodiscard]] constexpr std::span<const char> raw() const noexcept { return raw_data; }
+    [[nodiscard]] constexpr uint32_t msg_seq_num() const noexcept { return header.msg_seq_num; }
+    [[nodiscard]] constexpr std::string_view sender_comp_id() const noexcept { return header.sender_comp_id; }
+    [[nodiscard]] constexpr std::string_view target_comp_id() const noexcept { return header.target_comp_id; }
+    [[nodiscard]] constexpr std::string_view sending_time() const noexcept { return header.sending_time; }
+
+    [[nodiscard]] constexpr bool is_limit() const noexcept {
+        return ord_type == OrdType::Limit || ord_type == OrdType::StopLimit;
+    }
+
+    [[nodiscard]] constexpr bool is_stop() const noexcept {
+        return ord_type == OrdType::Stop || ord_type == OrdType::StopLimit;
+    }
+
+    [[nodiscard]] static ParseResult<OrderCancelReplaceRequest> from_buffer(
+        std::span<const char> buffer) noexcept
+    {
+        auto parsed = IndexedParser::parse(buffer);
+        if (!parsed.has_value()) {
+            return std::unexpected{parsed.error()};
+        }
+
+        auto& p = *parsed;
+
+        if (p.msg_type() != MSG_TYPE) {
+            return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType}};
+        }
+
+        OrderCancelReplaceRequest msg;
+        msg.raw_data = buffer;
+        msg.header.begin_string = p.get_string(tag::BeginString::value);
+        msg.header.msg_type = p.msg_type();
+        msg.header.sender_comp_id = p.sender_comp_id();
+        msg.header.target_comp_id = p.target_comp_id();
+        msg.header.msg_seq_num = p.msg_seq_num();
+        msg.header.sending_time = p.sending_time();
+
+        msg.orig_cl_ord_id = p.get_string(tag::OrigClOrdID::value);
+        if (msg.orig_cl_ord_id.empty()) {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::OrigClOrdID::value}};
+        }
+
+        msg.cl_ord_id = p.get_string(tag::ClOrdID::value);
+        if (msg.cl_ord_id.empty()) {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::ClOrdID::value}};
+        }
+
+        msg.symbol = p.get_string(tag::Symbol::value);
+        if (msg.symbol.empty()) {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::Symbol::value}};
+        }
+
+        char side_char = p.get_char(tag::Side::value);
+        if (side_char == '\0') {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::Side::value}};
+        }
+        msg.side = static_cast<Side>(side_char);
+
+        msg.transact_time = p.get_string(tag::TransactTime::value);
 
+        msg.order_qty = p.get_field(tag::OrderQty::value).as_qty();
+        if (msg.order_qty.raw == 0) {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::OrderQty::value}};
+        }
+
+        char ord_type_char = p.get_char(tag::OrdType::value);
+        if (ord_type_char == '\0') {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::OrdType::value}};
+        }
+        msg.ord_type = static_cast<OrdType>(ord_type_char);
+
+        msg.price = p.get_field(tag::Price::value).as_price();
+        msg.stop_px = p.get_field(tag::StopPx::value).as_price();
+
+        if (char c = p.get_char(tag::TimeInForce::value); c != '\0') {
+            msg.time_in_force = static_cast<TimeInForce>(c);
+        }
+
+        msg.order_id = p.get_string(tag::OrderID::value);
+        msg.account = p.get_string(tag::Account::value);
+        msg.text = p.get_string(tag::Text::value);
+
+        if (msg.is_limit() && msg.price.raw == 0) {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::Price::value}};
+        }
+
+        if (msg.is_stop() && msg.stop_px.raw == 0) {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::StopPx::value}};
+        }
+
+        return msg;
+    }
+
+    class Builder {
+    public:
+        Builder& sender_comp_id(std::string_view v) noexcept { sender_comp_id_ = v; return *this; }
+        Builder& target_comp_id(std::string_view v) noexcept { target_comp_id_ = v; return *this; }
+        Builder& msg_seq_num(uint32_t v) noexcept { msg_seq_num_ = v; return *this; }
+        Builder& sending_time(std::string_view v) noexcept { sending_time_ = v; return *this; }
+        Builder& orig_cl_ord_id(std::string_view v) noexcept { orig_cl_ord_id_ = v; return *this; }
+        Builder& cl_ord_id(std::string_view v) noexcept { cl_ord_id_ = v; return *this; }
+        Builder& symbol(std::string_view v) noexcept { symbol_ = v; return *this; }
+        Builder& side(Side v) noexcept { side_ = v; return *this; }
+        Builder& transact_time(std::string_view v) noexcept { transact_time_ = v; return *this; }
+        Builder& order_qty(Qty v) noexcept { order_qty_ = v; return *this; }
+        Builder& ord_type(OrdType v) noexcept { ord_type_ = v; return *this; }
+        Builder& price(FixedPrice v) noexcept { price_ = v; return *this; }
+        Builder& stop_px(FixedPrice v) noexcept { stop_px_ = v; return *this; }
+        Builder& time_in_force(TimeInForce v) noexcept { time_in_force_ = v; return *this; }
+        Builder& order_id(std::string_view v) noexcept { order_id_ = v; return *this; }
+        Builder& account(std::string_view v) noexcept { account_ = v; return *this; }
+        Builder& text(std::string_view v) noexcept { text_ = v; return *this; }
+
+        // New order terms, read by pre-trade checks before building
+        [[nodiscard]] std::string_view symbol() const noexcept { return symbol_; }
+        [[nodiscard]] Side side() const noexcept { return side_; }
+        [[nodiscard]] Qty order_qty() const noexcept { return order_qty_; }
+        [[nodiscard]] OrdType ord_type() const noexcept { return ord_type_; }
+        [[nodiscard]] FixedPrice price() const noexcept { return price_; }
+
+        [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            asm_.start()
+                .field(tag::MsgType::value, MSG_TYPE)
+                .field(tag::SenderCompID::value, sender_comp_id_)
+                .field(tag::TargetCompID::value, target_comp_id_)
+                .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
+                .field(tag::SendingTime::value, sending_time_);
+            append_body(asm_);
             return asm_.finish();
         }
 
+        /// Scatter-gather build: header bytes come from the session's template
+        /// (MsgType/CompIDs set on this builder are ignored)
+        [[nodiscard]] const ScatterAssembler::Segments& build(
+            ScatterAssembler& sg, const HeaderTemplate& header) const noexcept
+        {
+            sg.start(header, msg_seq_num_, sending_time_);
+            append_body(sg);
+            return sg.finish();
+        }
+
     private:
+        friend class OrderCancelReplaceTemplate;
+
+        /// Body fields after SendingTime, shared by both assemblers
+        template<typename Assembler>
+        void append_body(Assembler& asm_) const noexcept {
+            asm_.field(tag::OrigClOrdID::value, orig_cl_ord_id_)
+                .field(tag::ClOrdID::value, cl_ord_id_)
+                .field(tag::Symbol::value, symbol_)
+                .field(tag::Side::value, static_cast<char>(side_))
+                .field(tag::TransactTime::value, transact_time_)
+                .field(tag::OrderQty::value, static_cast<int64_t>(order_qty_.whole()))
+                .field(tag::OrdType::value, static_cast<char>(ord_type_));
+
+            if (price_.raw != 0) {
+                asm_.field(tag::Price::value, price_);
+            }
+
+            if (stop_px_.raw != 0) {
+                asm_.field(tag::StopPx::value, stop_px_);
+            }
+
+            asm_.field(tag::TimeInForce::value, static_cast<char>(time_in_force_));
+
+            if (!order_id_.empty()) {
+                asm_.field(tag::OrderID::value, order_id_);
+            }
+
+            if (!account_.empty()) {
+                asm_.field(tag::Account::value, account_);
+            }
+
+            if (!text_.empty()) {
+                asm_.field(tag::Text::value, text_);
+            }
+        }
+
         std::string_view sender_comp_id_;
         std::string_view target_comp_id_;
         uint32_t msg_seq_num_{1};
@@ -428,7 +709,149 @@ struct OrderCancelRequest {
         Side side_{Side::Buy};
         std::string_view transact_time_;
         Qty order_qty_;
+        OrdType ord_type_{OrdType::Limit};
+        FixedPrice price_;
+        FixedPrice stop_px_;
+        TimeInForce time_in_force_{TimeInForce::Day};
+        std::string_view order_id_;
+        std::string_view account_;
+        std::string_view text_;
+    };
+};
+
+// ============================================================================
+// OrderStatusRequest Message (MsgType = H)
+// ============================================================================
+
+/// FIX 4.4 OrderStatusRequest message (35=H)
+struct OrderStatusRequest {
+    static constexpr char MSG_TYPE = msg_type::OrderStatusRequest;
+    static constexpr int ORD_STATUS_REQ_ID = 790;
+
+    FixHeader header;
+    std::string_view cl_ord_id;          // Tag 11 - Required
+    std::string_view symbol;             // Tag 55 - Required
+    Side side;                           // Tag 54 - Required
+    std::string_view order_id;           // Tag 37 - Optional
+    std::string_view ord_status_req_id;  // Tag 790 - Optional
+    std::span<const char> raw_data;
+
+    constexpr OrderStatusRequest() noexcept
+        : header{}
+        , cl_ord_id{}
+        , symbol{}
+        , side{Side::Buy}
+        , order_id{}
+        , ord_status_req_id{}
+        , raw_data{} {}
+
+    [[nodiscard]] constexpr std::span<const char> raw() const noexcept { return raw_data; }
+    [[nodiscard]] constexpr uint32_t msg_seq_num() const noexcept { return header.msg_seq_num; }
+    [[nodiscard]] constexpr std::string_view sender_comp_id() const noexcept { return header.sender_comp_id; }
+    [[nodiscard]] constexpr std::string_view target_comp_id() const noexcept { return header.target_comp_id; }
+    [[nodiscard]] constexpr std::string_view sending_time() const noexcept { return header.sending_time; }
+
+    [[nodiscard]] static ParseResult<OrderStatusRequest> from_buffer(
+        std::span<const char> buffer) noexcept
+    {
+        auto parsed = IndexedParser::parse(buffer);
+        if (!parsed.has_value()) {
+            return std::unexpected{parsed.error()};
+        }
+
+        auto& p = *parsed;
+
+        if (p.msg_type() != MSG_TYPE) {
+            return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType}};
+        }
+
+        OrderStatusRequest msg;
+        msg.raw_data = buffer;
+        msg.header.begin_string = p.get_string(tag::BeginString::value);
+        msg.header.msg_type = p.msg_type();
+        msg.header.sender_comp_id = p.sender_comp_id();
+        msg.header.target_comp_id = p.target_comp_id();
+        msg.header.msg_seq_num = p.msg_seq_num();
+        msg.header.sending_time = p.sending_time();
+
+        msg.cl_ord_id = p.get_string(tag::ClOrdID::value);
+        if (msg.cl_ord_id.empty()) {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, tag::ClOrdID::value}};
+        }
+
+        msg.symbol = p.get_string(tag::Symbol::value);
+
+        if (char c = p.get_char(tag::Side::value); c != '\0') {
+            msg.side = static_cast<Side>(c);
+        }
+
+        msg.order_id = p.get_string(tag::OrderID::value);
+        msg.ord_status_req_id = p.get_string(ORD_STATUS_REQ_ID);
+
+        return msg;
+    }
+
+    class Builder {
+    public:
+        Builder& sender_comp_id(std::string_view v) noexcept { sender_comp_id_ = v; return *this; }
+        Builder& target_comp_id(std::string_view v) noexcept { target_comp_id_ = v; return *this; }
+        Builder& msg_seq_num(uint32_t v) noexcept { msg_seq_num_ = v; return *this; }
+        Builder& sending_time(std::string_view v) noexcept { sending_time_ = v; return *this; }
+        Builder& cl_ord_id(std::string_view v) noexcept { cl_ord_id_ = v; return *this; }
+        Builder& symbol(std::string_view v) noexcept { symbol_ = v; return *this; }
+        Builder& side(Side v) noexcept { side_ = v; return *this; }
+        Builder& order_id(std::string_view v) noexcept { order_id_ = v; return *this; }
+        Builder& ord_status_req_id(std::string_view v) noexcept { ord_status_req_id_ = v; return *this; }
+
+        [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+            asm_.start()
+                .field(tag::MsgType::value, MSG_TYPE)
+                .field(tag::SenderCompID::value, sender_comp_id_)
+                .field(tag::TargetCompID::value, target_comp_id_)
+                .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
+                .field(tag::SendingTime::value, sending_time_);
+            append_body(asm_);
+            return asm_.finish();
+        }
+
+        /// Scatter-gather build: header bytes come from the session's template
+        /// (MsgType/CompIDs set on this builder are ignored)
+        [[nodiscard]] const ScatterAssembler::Segments& build(
+            ScatterAssembler& sg, const HeaderTemplate& header) const noexcept
+        {
+            sg.start(header, msg_seq_num_, sending_time_);
+            append_body(sg);
+            return sg.finish();
+        }
+
+    private:
+        friend class OrderStatusTemplate;
+
+        /// Body fields after SendingTime, shared by both assemblers
+        template<typename Assembler>
+        void append_body(Assembler& asm_) const noexcept {
+            asm_.field(tag::ClOrdID::value, cl_ord_id_)
+                .field(tag::Symbol::value, symbol_)
+                .field(tag::Side::value, static_cast<char>(side_));
+
+            if (!order_id_.empty()) {
+                asm_.field(tag::OrderID::value, order_id_);
+            }
+
+            if (!ord_status_req_id_.empty()) {
+                asm_.field(ORD_STATUS_REQ_ID, ord_status_req_id_);
+            }
+        }
+
+        std::string_view sender_comp_id_;
+        std::string_view target_comp_id_;
+        uint32_t msg_seq_num_{1};
+        std::string_view sending_time_;
+        std::string_view cl_ord_id_;
+        std::string_view symbol_;
+        Side side_{Side::Buy};
         std::string_view order_id_;
+        std::string_view ord_status_req_id_;
     };
 };
 
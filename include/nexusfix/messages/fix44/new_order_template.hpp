@@ -0,0 +1,342 @@
+#pragma once
+
+/// @file new_order_template.hpp
+/// @brief Pre-rendered per-session encoders for NewOrderSingle, OrderCancelRequest,
+///        OrderCancelReplaceRequest, OrderStatusRequest and ExecutionReport
+///
+/// The static header ("8=FIX.4.4|9=NNNNNN|35=D|49=..|56=..|") is written
+/// once by prepare(), typically at logon, together with its byte sum. The
+/// fields after it follow a compile-time serializer::MessageLayout: every
+/// tag segment and its byte sum is a constant, so build() stores MsgSeqNum,
+/// SendingTime and the order values behind the header, patches BodyLength
+/// and appends the checksum seeded with the header's sum.
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/serializer/message_layout.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/messages/fix44/execution_report.hpp"
+
+namespace nfx::fix44 {
+
+// ============================================================================
+// NewOrderSingle Template
+// ============================================================================
+
+class NewOrderTemplate {
+public:
+    /// MsgSeqNum onwards, in NewOrderSingle::Builder's field order
+    using Layout = serializer::MessageLayout<
+        serializer::PaddedUIntSlot<tag::MsgSeqNum::value>,
+        serializer::StringSlot<tag::SendingTime::value, 32>,
+        serializer::StringSlot<tag::ClOrdID::value>,
+        serializer::StringSlot<tag::Symbol::value>,
+        serializer::CharSlot<tag::Side::value>,
+        serializer::StringSlot<tag::TransactTime::value, 32>,
+        serializer::IntSlot<tag::OrderQty::value>,
+        serializer::CharSlot<tag::OrdType::value>,
+        serializer::Optional<serializer::PriceSlot<tag::Price::value>>,
+        serializer::Optional<serializer::PriceSlot<tag::StopPx::value>>,
+        serializer::CharSlot<tag::TimeInForce::value>,
+        serializer::Optional<serializer::StringSlot<tag::Account::value>>,
+        serializer::Optional<serializer::CharSlot<tag::HandlInst::value>>,
+        serializer::Optional<serializer::StringSlot<tag::ExDestination::value>>,
+        serializer::Optional<serializer::StringSlot<tag::Text::value, 256>>>;
+
+    static constexpr size_t MAX_SIZE = serializer::LayoutEncoder<Layout>::MAX_SIZE;
+
+    NewOrderTemplate() noexcept = default;
+
+    /// Render the session's static header bytes
+    /// @param seq_num_width MsgSeqNum zero-padding (SessionConfig::seq_num_width)
+    void prepare(std::string_view begin_string,
+                 std::string_view sender_comp_id,
+                 std::string_view target_comp_id,
+                 uint8_t seq_num_width = 0) noexcept
+    {
+        seq_num_width_ = seq_num_width;
+        constexpr char type = NewOrderSingle::MSG_TYPE;
+        encoder_.prepare(begin_string, std::string_view{&type, 1},
+                         sender_comp_id, target_comp_id);
+    }
+
+    [[nodiscard]] bool prepared() const noexcept { return encoder_.prepared(); }
+
+    /// Encode an order against the prepared header.
+    /// Sender/target/seq/time set on the builder are ignored.
+    [[nodiscard]] NFX_HOT
+    std::span<const char> build(const NewOrderSingle::Builder& order,
+                                uint32_t msg_seq_num,
+                                std::string_view sending_time) noexcept
+    {
+        return encoder_.build(
+            serializer::PaddedUInt{msg_seq_num, seq_num_width_}, sending_time,
+            order.cl_ord_id_, order.symbol_, static_cast<char>(order.side_),
+            order.transact_time_, order.order_qty_.whole(),
+            static_cast<char>(order.ord_type_), order.price_, order.stop_px_,
+            static_cast<char>(order.time_in_force_), order.account_,
+            order.handl_inst_, order.ex_destination_, order.text_);
+    }
+
+private:
+    serializer::LayoutEncoder<Layout> encoder_;
+    uint8_t seq_num_width_{0};
+};
+
+// ============================================================================
+// OrderCancelRequest Template
+// ============================================================================
+
+class OrderCancelTemplate {
+public:
+    /// MsgSeqNum onwards, in OrderCancelRequest::Builder's field order
+    using Layout = serializer::MessageLayout<
+        serializer::PaddedUIntSlot<tag::MsgSeqNum::value>,
+        serializer::StringSlot<tag::SendingTime::value, 32>,
+        serializer::StringSlot<tag::OrigClOrdID::value>,
+        serializer::StringSlot<tag::ClOrdID::value>,
+        serializer::StringSlot<tag::Symbol::value>,
+        serializer::CharSlot<tag::Side::value>,
+        serializer::StringSlot<tag::TransactTime::value, 32>,
+        serializer::Optional<serializer::IntSlot<tag::OrderQty::value>>,
+        serializer::Optional<serializer::StringSlot<tag::OrderID::value>>>;
+
+    static constexpr size_t MAX_SIZE = serializer::LayoutEncoder<Layout>::MAX_SIZE;
+
+    OrderCancelTemplate() noexcept = default;
+
+    /// Render the session's static header bytes
+    /// @param seq_num_width MsgSeqNum zero-padding (SessionConfig::seq_num_width)
+    void prepare(std::string_view begin_string,
+                 std::string_view sender_comp_id,
+                 std::string_view target_comp_id,
+                 uint8_t seq_num_width = 0) noexcept
+    {
+        seq_num_width_ = seq_num_width;
+        constexpr char type = OrderCancelRequest::MSG_TYPE;
+        encoder_.prepare(begin_string, std::string_view{&type, 1},
+                         sender_comp_id, target_comp_id);
+    }
+
+    [[nodiscard]] bool prepared() const noexcept { return encoder_.prepared(); }
+
+    /// Encode a cancel against the prepared header.
+    /// Sender/target/seq/time set on the builder are ignored.
+    [[nodiscard]] NFX_HOT
+    std::span<const char> build(const OrderCancelRequest::Builder& cancel,
+                                uint32_t msg_seq_num,
+                                std::string_view sending_time) noexcept
+    {
+        return encoder_.build(
+            serializer::PaddedUInt{msg_seq_num, seq_num_width_}, sending_time,
+            cancel.orig_cl_ord_id_, cancel.cl_ord_id_, cancel.symbol_,
+            static_cast<char>(cancel.side_), cancel.transact_time_,
+            cancel.order_qty_.raw > 0 ? cancel.order_qty_.whole() : int64_t{0},
+            cancel.order_id_);
+    }
+
+private:
+    serializer::LayoutEncoder<Layout> encoder_;
+    uint8_t seq_num_width_{0};
+};
+
+// ============================================================================
+// OrderCancelReplaceRequest Template
+// ============================================================================
+
+class OrderCancelReplaceTemplate {
+public:
+    /// MsgSeqNum onwards, in OrderCancelReplaceRequest::Builder's field order
+    using Layout = serializer::MessageLayout<
+        serializer::PaddedUIntSlot<tag::MsgSeqNum::value>,
+        serializer::StringSlot<tag::SendingTime::value, 32>,
+        serializer::StringSlot<tag::OrigClOrdID::value>,
+        serializer::StringSlot<tag::ClOrdID::value>,
+        serializer::StringSlot<tag::Symbol::value>,
+        serializer::CharSlot<tag::Side::value>,
+        serializer::StringSlot<tag::TransactTime::value, 32>,
+        serializer::IntSlot<tag::OrderQty::value>,
+        serializer::CharSlot<tag::OrdType::value>,
+        serializer::Optional<serializer::PriceSlot<tag::Price::value>>,
+        serializer::Optional<serializer::PriceSlot<tag::StopPx::value>>,
+        serializer::CharSlot<tag::TimeInForce::value>,
+        serializer::Optional<serializer::StringSlot<tag::OrderID::value>>,
+        serializer::Optional<serializer::StringSlot<tag::Account::value>>,
+        serializer::Optional<serializer::StringSlot<tag::Text::value, 256>>>;
+
+    static constexpr size_t MAX_SIZE = serializer::LayoutEncoder<Layout>::MAX_SIZE;
+
+    OrderCancelReplaceTemplate() noexcept = default;
+
+    /// Render the session's static header bytes
+    /// @param seq_num_width MsgSeqNum zero-padding (SessionConfig::seq_num_width)
+    void prepare(std::string_view begin_string,
+                 std::string_view sender_comp_id,
+                 std::string_view target_comp_id,
+                 uint8_t seq_num_width = 0) noexcept
+    {
+        seq_num_width_ = seq_num_width;
+        constexpr char type = OrderCancelReplaceRequest::MSG_TYPE;
+        encoder_.prepare(begin_string, std::string_view{&type, 1},
+                         sender_comp_id, target_comp_id);
+    }
+
+    [[nodiscard]] bool prepared() const noexcept { return encoder_.prepared(); }
+
+    /// Encode a replace against the prepared header.
+    /// Sender/target/seq/time set on the builder are ignored.
+    [[nodiscard]] NFX_HOT
+    std::span<const char> build(const OrderCancelReplaceRequest::Builder& replace,
+                                uint32_t msg_seq_num,
+                                std::string_view sending_time) noexcept
+    {
+        return encoder_.build(
+            serializer::PaddedUInt{msg_seq_num, seq_num_width_}, sending_time,
+            replace.orig_cl_ord_id_, replace.cl_ord_id_, replace.symbol_,
+            static_cast<char>(replace.side_), replace.transact_time_,
+            replace.order_qty_.whole(), static_cast<char>(replace.ord_type_),
+            replace.price_, replace.stop_px_,
+            static_cast<char>(replace.time_in_force_), replace.order_id_,
+            replace.account_, replace.text_);
+    }
+
+private:
+    serializer::LayoutEncoder<Layout> encoder_;
+    uint8_t seq_num_width_{0};
+};
+
+// ============================================================================
+// OrderStatusRequest Template
+// ============================================================================
+
+class OrderStatusTemplate {
+public:
+    /// MsgSeqNum onwards, in OrderStatusRequest::Builder's field order
+    using Layout = serializer::MessageLayout<
+        serializer::PaddedUIntSlot<tag::MsgSeqNum::value>,
+        serializer::StringSlot<tag::SendingTime::value, 32>,
+        serializer::StringSlot<tag::ClOrdID::value>,
+        serializer::StringSlot<tag::Symbol::value>,
+        serializer::CharSlot<tag::Side::value>,
+        serializer::Optional<serializer::StringSlot<tag::OrderID::value>>,
+        serializer::Optional<serializer::StringSlot<OrderStatusRequest::ORD_STATUS_REQ_ID>>>;
+
+    static constexpr size_t MAX_SIZE = serializer::LayoutEncoder<Layout>::MAX_SIZE;
+
+    OrderStatusTemplate() noexcept = default;
+
+    /// Render the session's static header bytes
+    /// @param seq_num_width MsgSeqNum zero-padding (SessionConfig::seq_num_width)
+    void prepare(std::string_view begin_string,
+                 std::string_view sender_comp_id,
+                 std::string_view target_comp_id,
+                 uint8_t seq_num_width = 0) noexcept
+    {
+        seq_num_width_ = seq_num_width;
+        constexpr char type = OrderStatusRequest::MSG_TYPE;
+        encoder_.prepare(begin_string, std::string_view{&type, 1},
+                         sender_comp_id, target_comp_id);
+    }
+
+    [[nodiscard]] bool prepared() const noexcept { return encoder_.prepared(); }
+
+    /// Encode a status request against the prepared header.
+    /// Sender/target/seq/time set on the builder are ignored.
+    [[nodiscard]] NFX_HOT
+    std::span<const char> build(const OrderStatusRequest::Builder& status,
+                                uint32_t msg_seq_num,
+                                std::string_view sending_time) noexcept
+    {
+        return encoder_.build(
+            serializer::PaddedUInt{msg_seq_num, seq_num_width_}, sending_time,
+            status.cl_ord_id_, status.symbol_, static_cast<char>(status.side_),
+            status.order_id_, status.ord_status_req_id_);
+    }
+
+private:
+    serializer::LayoutEncoder<Layout> encoder_;
+    uint8_t seq_num_width_{0};
+};
+
+// ============================================================================
+// ExecutionReport Template
+// ============================================================================
+
+/// Acceptor-side counterpart of NewOrderTemplate: acks and fills sent back
+/// to a counterparty at order-entry rates. LastPx follows LastQty as an
+/// Optional slot, so a fill at a zero price omits it.
+class ExecutionReportTemplate {
+public:
+    /// MsgSeqNum onwards, in ExecutionReport::Builder's field order
+    using Layout = serializer::MessageLayout<
+        serializer::PaddedUIntSlot<tag::MsgSeqNum::value>,
+        serializer::StringSlot<tag::SendingTime::value, 32>,
+        serializer::StringSlot<tag::OrderID::value>,
+        serializer::StringSlot<tag::ExecID::value>,
+        serializer::CharSlot<tag::ExecType::value>,
+        serializer::CharSlot<tag::OrdStatus::value>,
+        serializer::StringSlot<tag::Symbol::value>,
+        serializer::CharSlot<tag::Side::value>,
+        serializer::IntSlot<tag::LeavesQty::value>,
+        serializer::IntSlot<tag::CumQty::value>,
+        serializer::PriceSlot<tag::AvgPx::value>,
+        serializer::Optional<serializer::StringSlot<tag::ClOrdID::value>>,
+        serializer::Optional<serializer::IntSlot<tag::OrderQty::value>>,
+        serializer::Optional<serializer::IntSlot<tag::LastQty::value>>,
+        serializer::Optional<serializer::PriceSlot<tag::LastPx::value>>,
+        serializer::Optional<serializer::StringSlot<tag::TransactTime::value, 32>>,
+        serializer::Optional<serializer::StringSlot<tag::Account::value>>,
+        serializer::Optional<serializer::StringSlot<tag::Text::value, 256>>>;
+
+    static constexpr size_t MAX_SIZE = serializer::LayoutEncoder<Layout>::MAX_SIZE;
+
+    ExecutionReportTemplate() noexcept = default;
+
+    /// Render the session's static header bytes
+    /// @param seq_num_width MsgSeqNum zero-padding (SessionConfig::seq_num_width)
+    void prepare(std::string_view begin_string,
+                 std::string_view sender_comp_id,
+                 std::string_view target_comp_id,
+                 uint8_t seq_num_width = 0) noexcept
+    {
+        seq_num_width_ = seq_num_width;
+        constexpr char type = ExecutionReport::MSG_TYPE;
+        encoder_.prepare(begin_string, std::string_view{&type, 1},
+                         sender_comp_id, target_comp_id);
+    }
+
+    [[nodiscard]] bool prepared() const noexcept { return encoder_.prepared(); }
+
+    /// Encode an execution report against the prepared header.
+    /// Sender/target/seq/time set on the builder are ignored.
+    [[nodiscard]] NFX_HOT
+    std::span<const char> build(const ExecutionReport::Builder& report,
+                                uint32_t msg_seq_num,
+                                std::string_view sending_time) noexcept
+    {
+        const bool filled = report.last_qty_.raw > 0;
+        return encoder_.build(
+            serializer::PaddedUInt{msg_seq_num, seq_num_width_}, sending_time,
+            report.order_id_, report.exec_id_,
+            static_cast<char>(report.exec_type_),
+            static_cast<char>(report.ord_status_), report.symbol_,
+            static_cast<char>(report.side_),
+            static_cast<int64_t>(report.leaves_qty_.whole()),
+            static_cast<int64_t>(report.cum_qty_.whole()), report.avg_px_,
+            report.cl_ord_id_,
+            report.order_qty_.raw > 0 ? static_cast<int64_t>(report.order_qty_.whole()) : int64_t{0},
+            filled ? static_cast<int64_t>(report.last_qty_.whole()) : int64_t{0},
+            filled ? report.last_px_ : FixedPrice{},
+            report.transact_time_, report.account_, report.text_);
+    }
+
+private:
+    serializer::LayoutEncoder<Layout> encoder_;
+    uint8_t seq_num_width_{0};
+};
+
+} // namespace nfx::fix44
@@ -2,6 +2,7 @@
 
 #include <span>
 #include <array>
+#include <bit>
 #include <cstdint>
 #include <type_traits>
 
@@ -72,6 +73,24 @@ struct MessageSchema {
     static consteval std::array<bool, field_count> required_flags() {
         return {Fields::is_required...};
     }
+
+    /// Schema position of a tag at run time, -1 if not in the schema
+    /// (a fold of compares the compiler lowers to a switch)
+    [[nodiscard]] static constexpr int index_of(int tag) noexcept {
+        int index = 0;
+        int result = -1;
+        (void)((Fields::tag == tag ? (result = index, true) : (++index, false)) || ...);
+        return result;
+    }
+
+    /// Bit per required field, in schema order
+    static constexpr uint64_t required_mask = [] {
+        static_assert(field_count <= 64, "Presence is tracked in a 64-bit mask");
+        uint64_t mask = 0;
+        size_t i = 0;
+        ((mask |= Fields::is_required ? (uint64_t{1} << i) : 0, ++i), ...);
+        return mask;
+    }();
 };
 
 // ============================================================================
@@ -135,6 +154,113 @@ private:
     std::array<uint16_t, MaxTag> offsets_;
 };
 
+/// Per-message tag -> field index map (uint8_t indices) with O(1) reset.
+/// Entries carry the generation they were written in, so clear() only bumps
+/// the generation; the tables are wiped once every 255 clears when it wraps.
+/// Tags >= MaxTag (FIXT 1128/1137, user-defined 5000+/9000+ ranges) spill
+/// into a small open-addressed table. Defaults take 1.5 KB: with the field
+/// array, the whole lookup structure stays in L1 next to the message.
+template <size_t MaxTag = 512, size_t SpillSlots = 64>
+class CompactTagMap {
+    static_assert(SpillSlots >= 2 && std::has_single_bit(SpillSlots),
+                  "SpillSlots must be a power of two");
+
+public:
+    static constexpr uint8_t INVALID_INDEX = 0xFF;
+
+    /// Spilled tags accepted per message (keeps probe chains short)
+    static constexpr size_t SPILL_LIMIT = SpillSlots - SpillSlots / 4;
+
+    constexpr CompactTagMap() noexcept = default;
+
+    /// Forget every entry
+    constexpr void clear() noexcept {
+        spilled_ = 0;
+        if (++generation_ == 0) [[unlikely]] {
+            direct_.fill(Entry{});
+            spill_.fill(SpillEntry{});
+            generation_ = 1;
+        }
+    }
+
+    /// Map a tag to a field index; setting a tag again replaces its index
+    /// @return false if the tag is not positive, the index is INVALID_INDEX
+    ///         or the spill table is full
+    constexpr bool set(int tag, uint8_t index) noexcept {
+        if (tag <= 0 || index == INVALID_INDEX) [[unlikely]] return false;
+        if (static_cast<size_t>(tag) < MaxTag) [[likely]] {
+            direct_[static_cast<size_t>(tag)] = Entry{generation_, index};
+            return true;
+        }
+        return spill_set(static_cast<uint32_t>(tag), index);
+    }
+
+    /// Field index of a tag (INVALID_INDEX if not set since clear())
+    [[nodiscard]] constexpr uint8_t get(int tag) const noexcept {
+        if (tag <= 0) [[unlikely]] return INVALID_INDEX;
+        if (static_cast<size_t>(tag) < MaxTag) [[likely]] {
+            const Entry entry = direct_[static_cast<size_t>(tag)];
+            return entry.generation == generation_ ? entry.index : INVALID_INDEX;
+        }
+        return spill_get(static_cast<uint32_t>(tag));
+    }
+
+    [[nodiscard]] constexpr bool has(int tag) const noexcept {
+        return get(tag) != INVALID_INDEX;
+    }
+
+    /// Tags held in the spill table
+    [[nodiscard]] constexpr size_t spilled() const noexcept { return spilled_; }
+
+private:
+    struct Entry {
+        uint8_t generation{0};     // 0 never matches: generation_ starts at 1
+        uint8_t index{INVALID_INDEX};
+    };
+
+    struct SpillEntry {
+        uint32_t tag{0};
+        uint8_t generation{0};
+        uint8_t index{INVALID_INDEX};
+    };
+
+    static constexpr int SPILL_SHIFT = 32 - std::countr_zero(SpillSlots);
+
+    [[nodiscard]] static constexpr size_t spill_slot(uint32_t tag) noexcept {
+        return static_cast<size_t>((tag * 0x9E3779B1u) >> SPILL_SHIFT);  // Fibonacci hash
+    }
+
+    constexpr bool spill_set(uint32_t tag, uint8_t index) noexcept {
+        for (size_t i = spill_slot(tag);; i = (i + 1) & (SpillSlots - 1)) {
+            SpillEntry& entry = spill_[i];
+            if (entry.generation != generation_) {
+                if (spilled_ >= SPILL_LIMIT) [[unlikely]] return false;
+                entry = SpillEntry{tag, generation_, index};
+                ++spilled_;
+                return true;
+            }
+            if (entry.tag == tag) {
+                entry.index = index;
+                return true;
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr uint8_t spill_get(uint32_t tag) const noexcept {
+        // Nothing is removed within a generation: a stale slot ends the chain
+        for (size_t i = spill_slot(tag);; i = (i + 1) & (SpillSlots - 1)) {
+            const SpillEntry& entry = spill_[i];
+            if (entry.generation != generation_) return INVALID_INDEX;
+            if (entry.tag == tag) return entry.index;
+        }
+    }
+
+    std::array<Entry, MaxTag> direct_{};
+    std::array<SpillEntry, SpillSlots> spill_{};
+    size_t spilled_{0};
+    uint8_t generation_{1};
+};
+
 // ============================================================================
 // Compile-time Field Extractor
 // ============================================================================
@@ -188,33 +314,60 @@ template <size_t MaxFields = 64>
 // ============================================================================
 
 /// Validate message against schema at compile time
+///
+/// One pass over the fields builds a presence mask; a schema tag whose bit
+/// is already set is a duplicate, and the required check is a single
+/// AND/compare against Schema::required_mask. Tags outside the schema
+/// (repeating group members, user-defined fields) are not checked.
 template <typename Schema>
 class SchemaValidator {
 public:
+    /// Presence of schema fields, fed one tag at a time by a parse loop
+    class Tracker {
+    public:
+        /// Record a tag; false if it is a schema tag already seen
+        constexpr bool add(int tag) noexcept {
+            const int i = Schema::index_of(tag);
+            if (i < 0) return true;
+            const uint64_t bit = uint64_t{1} << i;
+            if (seen_ & bit) [[unlikely]] {
+                if (duplicate_ == 0) duplicate_ = tag;
+                return false;
+            }
+            seen_ |= bit;
+            return true;
+        }
+
+        [[nodiscard]] constexpr uint64_t seen() const noexcept { return seen_; }
+
+        /// DuplicateTag, then MissingRequiredField (first in schema order)
+        [[nodiscard]] constexpr ParseError result() const noexcept {
+            if (duplicate_ != 0) [[unlikely]] {
+                return ParseError{ParseErrorCode::DuplicateTag, duplicate_};
+            }
+            const uint64_t missing = Schema::required_mask & ~seen_;
+            if (missing == 0) [[likely]] return ParseError{};
+
+            constexpr auto tags = Schema::tags();
+            return ParseError{ParseErrorCode::MissingRequiredField,
+                              tags[static_cast<size_t>(std::countr_zero(missing))]};
+        }
+
+    private:
+        uint64_t seen_{0};
+        int duplicate_{0};
+    };
+
     /// Validate extracted fields against schema
     template <size_t N>
     [[nodiscard]] static constexpr ParseError validate(
         const FieldExtractionResult<N>& fields) noexcept
     {
-        constexpr auto tags = Schema::tags();
-        constexpr auto required = Schema::required_flags();
-
-        for (size_t i = 0; i < Schema::field_count; ++i) {
-            if (required[i]) {
-                bool found = false;
-                for (size_t j = 0; j < fields.count; ++j) {
-                    if (fields.fields[j].tag == tags[i]) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (!found) {
-                    return ParseError{ParseErrorCode::MissingRequiredField, tags[i]};
-                }
-            }
+        Tracker tracker;
+        for (size_t j = 0; j < fields.count; ++j) {
+            (void)tracker.add(fields.fields[j].tag);
         }
-
-        return ParseError{};  // No error
+        return tracker.result();
     }
 
     /// Check if specific tag is present
@@ -250,6 +403,99 @@ struct HeaderParseResult {
     }
 };
 
+namespace detail {
+
+/// Store one session header field
+/// @return false if the tag is not a header field; error is set for a
+///         malformed BodyLength or MsgSeqNum
+[[nodiscard]] constexpr bool store_header_field(
+    MessageHeader& header, const FieldView& field, ParseError& error) noexcept
+{
+    switch (field.tag) {
+        case tag::BeginString::value:
+            header.begin_string = field.as_string();
+            return true;
+
+        case tag::BodyLength::value:
+            if (auto val = field.as_int()) [[likely]] {
+                header.body_length = static_cast<int>(*val);
+            } else {
+                error = ParseError{ParseErrorCode::InvalidBodyLength, 9};
+            }
+            return true;
+
+        case tag::MsgType::value:
+            header.msg_type = field.as_char();
+            return true;
+
+        case tag::SenderCompID::value:
+            header.sender_comp_id = field.as_string();
+            return true;
+
+        case tag::TargetCompID::value:
+            header.target_comp_id = field.as_string();
+            return true;
+
+        case tag::MsgSeqNum::value:
+            if (auto val = field.as_uint()) [[likely]] {
+                header.msg_seq_num = static_cast<uint32_t>(*val);
+            } else {
+                error = ParseError{ParseErrorCode::InvalidFieldFormat, 34};
+            }
+            return true;
+
+        case tag::SendingTime::value:
+            header.sending_time = field.as_string();
+            return true;
+
+        case tag::PossDupFlag::value:
+            header.poss_dup_flag = field.as_bool();
+            return true;
+
+        case tag::PossResend::value:
+            header.poss_resend = field.as_bool();
+            return true;
+
+        case tag::OrigSendingTime::value:
+            header.orig_sending_time = field.as_string();
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/// One of the seven fields parse_header() stops after
+[[nodiscard]] constexpr bool is_required_header_tag(int tag) noexcept {
+    const int i = HeaderSchema::index_of(tag);
+    return i >= 0 && ((HeaderSchema::required_mask >> i) & 1) != 0;
+}
+
+/// Required header fields, first missing one in parse_header() order
+[[nodiscard]] constexpr ParseError check_header(const MessageHeader& header) noexcept {
+    if (header.begin_string.empty()) [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::BeginString::value};
+    }
+    if (header.body_length == 0) [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::BodyLength::value};
+    }
+    if (header.msg_type == '\0') [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::MsgType::value};
+    }
+    if (header.sender_comp_id.empty()) [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::SenderCompID::value};
+    }
+    if (header.target_comp_id.empty()) [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::TargetCompID::value};
+    }
+    if (header.msg_seq_num == 0) [[unlikely]] {
+        return ParseError{ParseErrorCode::MissingRequiredField, tag::MsgSeqNum::value};
+    }
+    return ParseError{};
+}
+
+} // namespace detail
+
 /// Parse FIX message header (constexpr-capable)
 [[nodiscard]] NFX_HOT
 constexpr HeaderParseResult parse_header(
@@ -273,87 +519,19 @@ constexpr HeaderParseResult parse_header(
             return result;
         }
 
-        switch (field.tag) {
-            case tag::BeginString::value:
-                result.header.begin_string = field.as_string();
-                ++fields_parsed;
-                break;
-
-            case tag::BodyLength::value:
-                if (auto val = field.as_int()) [[likely]] {
-                    result.header.body_length = static_cast<int>(*val);
-                } else {
-                    result.error = ParseError{ParseErrorCode::InvalidBodyLength, 9};
-                    return result;
-                }
-                ++fields_parsed;
-                break;
-
-            case tag::MsgType::value:
-                result.header.msg_type = field.as_char();
-                ++fields_parsed;
-                break;
-
-            case tag::SenderCompID::value:
-                result.header.sender_comp_id = field.as_string();
-                ++fields_parsed;
-                break;
-
-            case tag::TargetCompID::value:
-                result.header.target_comp_id = field.as_string();
-                ++fields_parsed;
-                break;
-
-            case tag::MsgSeqNum::value:
-                if (auto val = field.as_uint()) [[likely]] {
-                    result.header.msg_seq_num = static_cast<uint32_t>(*val);
-                } else {
-                    result.error = ParseError{ParseErrorCode::InvalidFieldFormat, 34};
-                    return result;
-                }
-                ++fields_parsed;
-                break;
-
-            case tag::SendingTime::value:
-                result.header.sending_time = field.as_string();
-                ++fields_parsed;
-                break;
-
-            case tag::PossDupFlag::value:
-                result.header.poss_dup_flag = field.as_bool();
-                break;
-
-            case tag::PossResend::value:
-                result.header.poss_resend = field.as_bool();
-                break;
-
-            case tag::OrigSendingTime::value:
-                result.header.orig_sending_time = field.as_string();
-                break;
-
-            default:
-                // Non-header field encountered, body starts here
-                result.body_start = iter.position() - field.value.size() - 2;  // Back up
-                break;
+        if (!detail::store_header_field(result.header, field, result.error)) [[unlikely]] {
+            // Non-header field encountered, body starts here
+            result.body_start = iter.position() - field.value.size() - 2;  // Back up
+            break;
         }
-
-        if (result.body_start > 0) [[unlikely]] break;
+        if (result.error.code != ParseErrorCode::None) [[unlikely]] {
+            return result;
+        }
+        fields_parsed += detail::is_required_header_tag(field.tag) ? 1 : 0;
     }
 
     // Validate required header fields
-    if (result.header.begin_string.empty()) [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::BeginString::value};
-    } else if (result.header.body_length == 0) [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::BodyLength::value};
-    } else if (result.header.msg_type == '\0') [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::MsgType::value};
-    } else if (result.header.sender_comp_id.empty()) [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::SenderCompID::value};
-    } else if (result.header.target_comp_id.empty()) [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::TargetCompID::value};
-    } else if (result.header.msg_seq_num == 0) [[unlikely]] {
-        result.error = ParseError{ParseErrorCode::MissingRequiredField, tag::MsgSeqNum::value};
-    }
+    result.error = detail::check_header(result.header);
 
     if (result.body_start == 0) [[likely]] {
         result.body_start = iter.position();
@@ -362,6 +540,175 @@ constexpr HeaderParseResult parse_header(
     return result;
 }
 
+/// Header field order of one counterparty, for parse_header() without
+/// the tag decoding
+///
+/// A peer's engine writes the header tags in the same order on every
+/// message (8, 9, 35, 34, 49, 52, 56 for most). The layout holds that
+/// order as packed "tag=" prefixes: each field is checked with one masked
+/// 32-bit compare where the previous field's SOH left off, and only the
+/// value is scanned. Values vary in length (MsgSeqNum grows), so the
+/// offsets are predicted field by field rather than from the message
+/// start. The first mismatch falls back to parse_header(), so the result
+/// is always the same as parse_header()'s.
+///
+/// The order is learned from the first message parse() accepts, or
+/// configured up front; a peer that changes layout is relearned after
+/// RELEARN_AFTER consecutive misses.
+class HeaderLayout {
+public:
+    /// parse_header() reads at most the seven required fields plus the
+    /// three optional ones
+    static constexpr size_t MAX_FIELDS = 10;
+
+    static constexpr uint32_t RELEARN_AFTER = 16;
+
+    constexpr HeaderLayout() noexcept = default;
+
+    /// Start with a known order (e.g. 8, 9, 35, 34, 49, 52, 56)
+    constexpr explicit HeaderLayout(std::span<const int> tags) noexcept {
+        (void)configure(tags);
+    }
+
+    /// Use this tag order
+    /// @return false (and nothing learned) unless every tag is a header
+    ///         field of at most three digits and the seven required ones
+    ///         are all present
+    constexpr bool configure(std::span<const int> tags) noexcept {
+        count_ = 0;
+        if (tags.size() > MAX_FIELDS) [[unlikely]] return false;
+
+        int required = 0;
+        for (size_t i = 0; i < tags.size(); ++i) {
+            const int tag = tags[i];
+            if (HeaderSchema::index_of(tag) < 0 || tag > 999) [[unlikely]] return false;
+            slots_[i] = make_slot(tag);
+            // parse_header() stops at the seventh required field
+            if (detail::is_required_header_tag(tag) && ++required == 7) {
+                count_ = i + 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Take the order from a message parse_header() accepts
+    constexpr bool learn(std::span<const char> data) noexcept {
+        std::array<int, MAX_FIELDS> tags{};
+        size_t n = 0;
+        FieldIterator iter{data};
+        while (iter.has_next() && n < MAX_FIELDS) {
+            const FieldView field = iter.next();
+            if (!field.is_valid() || HeaderSchema::index_of(field.tag) < 0) break;
+            tags[n++] = field.tag;
+        }
+        return configure(std::span<const int>{tags.data(), n});
+    }
+
+    constexpr void reset() noexcept {
+        count_ = 0;
+        misses_in_row_ = 0;
+    }
+
+    [[nodiscard]] constexpr bool learned() const noexcept { return count_ != 0; }
+
+    /// Learned tag order
+    [[nodiscard]] constexpr size_t field_count() const noexcept { return count_; }
+    [[nodiscard]] constexpr int tag_at(size_t i) const noexcept { return slots_[i].tag; }
+
+    /// Messages parsed on the layout / handed to parse_header()
+    [[nodiscard]] constexpr uint64_t hits() const noexcept { return hits_; }
+    [[nodiscard]] constexpr uint64_t misses() const noexcept { return misses_; }
+
+    /// Same result as parse_header(data)
+    [[nodiscard]] NFX_HOT
+    constexpr HeaderParseResult parse(std::span<const char> data) noexcept {
+        if (count_ != 0) [[likely]] {
+            HeaderParseResult result;
+            if (match(data, result)) [[likely]] {
+                ++hits_;
+                misses_in_row_ = 0;
+                return result;
+            }
+        }
+
+        ++misses_;
+        HeaderParseResult result = parse_header(data);
+        if (result.ok() && (count_ == 0 || ++misses_in_row_ >= RELEARN_AFTER)) {
+            if (learn(data)) misses_in_row_ = 0;
+        }
+        return result;
+    }
+
+private:
+    struct Slot {
+        uint32_t prefix{0};  // "tag=" bytes, little-endian
+        uint32_t mask{0};
+        uint16_t tag{0};
+        uint8_t length{0};   // Prefix bytes: digits + '='
+    };
+
+    [[nodiscard]] static constexpr Slot make_slot(int tag) noexcept {
+        Slot slot;
+        char digits[3]{};
+        uint8_t n = 0;
+        for (int t = tag; t != 0; t /= 10) digits[n++] = static_cast<char>('0' + t % 10);
+        for (uint8_t i = 0; i < n; ++i) {
+            slot.prefix |= static_cast<uint32_t>(static_cast<uint8_t>(digits[n - 1 - i])) << (8 * i);
+        }
+        slot.prefix |= static_cast<uint32_t>(static_cast<uint8_t>(fix::EQUALS)) << (8 * n);
+        slot.length = static_cast<uint8_t>(n + 1);
+        slot.mask = slot.length == 4 ? ~uint32_t{0} : (uint32_t{1} << (8 * slot.length)) - 1;
+        slot.tag = static_cast<uint16_t>(tag);
+        return slot;
+    }
+
+    /// Four bytes at pos as a little-endian word (one load once inlined)
+    [[nodiscard]] static constexpr uint32_t load_word(const char* p) noexcept {
+        return static_cast<uint32_t>(static_cast<uint8_t>(p[0])) |
+               static_cast<uint32_t>(static_cast<uint8_t>(p[1])) << 8 |
+               static_cast<uint32_t>(static_cast<uint8_t>(p[2])) << 16 |
+               static_cast<uint32_t>(static_cast<uint8_t>(p[3])) << 24;
+    }
+
+    /// Parse along the layout; false on the first deviation
+    [[nodiscard]] NFX_HOT
+    constexpr bool match(std::span<const char> data, HeaderParseResult& result) const noexcept {
+        if (data.size() < fix::MIN_MESSAGE_SIZE) [[unlikely]] return false;
+
+        const char* p = data.data();
+        const size_t size = data.size();
+        size_t pos = 0;
+        for (size_t i = 0; i < count_; ++i) {
+            const Slot& slot = slots_[i];
+            if (pos + 4 > size || (load_word(p + pos) & slot.mask) != slot.prefix) [[unlikely]] {
+                return false;
+            }
+            const size_t value_start = pos + slot.length;
+            size_t end = value_start;
+            while (end < size && p[end] != fix::SOH) ++end;
+            if (end >= size) [[unlikely]] return false;
+
+            const FieldView field{slot.tag, p + value_start, end - value_start};
+            (void)detail::store_header_field(result.header, field, result.error);
+            if (result.error.code != ParseErrorCode::None) [[unlikely]] {
+                return false;
+            }
+            pos = end + 1;
+        }
+
+        result.error = detail::check_header(result.header);
+        result.body_start = pos;
+        return true;
+    }
+
+    std::array<Slot, MAX_FIELDS> slots_{};
+    size_t count_{0};
+    uint32_t misses_in_row_{0};
+    uint64_t hits_{0};
+    uint64_t misses_{0};
+};
+
 // ============================================================================
 // Checksum Validation
 // ============================================================================
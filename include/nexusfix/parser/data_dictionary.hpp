@@ -0,0 +1,880 @@
+#pragma once
+
+/// @file data_dictionary.hpp
+/// @brief QuickFIX-style XML data dictionaries compiled into flat validators
+///
+/// consteval_parser.hpp covers schemas written as C++ types; venues ship
+/// their dictionaries as QuickFIX XML instead. DataDictionary::load() reads
+/// one at startup (header, trailer, messages, components, fields) and
+/// flattens it into tables the hot path indexes directly:
+///   - per tag:      4-byte DictField (value class, required bit, enum set)
+///   - per MsgType:  256-bit required-tag set over a dense bit numbering,
+///                   found through an 8 KB table keyed by the MsgType chars
+///   - per group:    NumInGroup tag, delimiter and sorted member tags,
+///                   nested groups contiguous after their parent's range
+///   - per enum:     256-bit bitmap of valid values for CHAR, BOOLEAN and
+///                   INT fields whose enums are all single characters
+///
+/// A DictionaryValidator pairs a dictionary with one venue's strictness.
+/// IndexedParser::assign(data, validator) feeds every field to it as the
+/// structural index is walked, so validation costs no second pass and no
+/// hash lookups; required tags are checked once the fields are split.
+///
+/// Not checked: required fields inside group entries (a group's own
+/// NumInGroup is, when required) and whether a defined tag belongs to the
+/// message type at all.
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/parser/field_view.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Dictionary Load Errors
+// ============================================================================
+
+enum class DictionaryErrorCode : uint8_t {
+    None = 0,
+    FileNotFound,
+    MalformedXml,
+    InvalidDefinition,      // Missing or bad number/name/msgtype attribute
+    UndefinedField,         // Reference to a field not under <fields>
+    UndefinedComponent,     // Reference to a component not under <components>
+    TooManyRequiredFields,  // Over DataDictionary::MAX_REQUIRED distinct tags
+    TooLarge                // Group or enum tables beyond 16-bit indices
+};
+
+struct DictionaryError {
+    DictionaryErrorCode code{DictionaryErrorCode::None};
+    size_t offset{0};       // Byte offset in the XML of the offending element
+
+    [[nodiscard]] constexpr std::string_view message() const noexcept {
+        switch (code) {
+            case DictionaryErrorCode::None:
+                return "No error";
+            case DictionaryErrorCode::FileNotFound:
+                return "Dictionary file not found";
+            case DictionaryErrorCode::MalformedXml:
+                return "Malformed XML";
+            case DictionaryErrorCode::InvalidDefinition:
+                return "Invalid field or message definition";
+            case DictionaryErrorCode::UndefinedField:
+                return "Reference to undefined field";
+            case DictionaryErrorCode::UndefinedComponent:
+                return "Reference to undefined component";
+            case DictionaryErrorCode::TooManyRequiredFields:
+                return "Too many distinct required fields";
+            case DictionaryErrorCode::TooLarge:
+                return "Dictionary too large";
+        }
+        std::unreachable();
+    }
+};
+
+template<typename T>
+using DictionaryResult = std::expected<T, DictionaryError>;
+
+// ============================================================================
+// Flat Tables
+// ============================================================================
+
+/// Value syntax checked for a field (from its dictionary type)
+enum class DictFieldClass : uint8_t {
+    Undefined = 0,
+    String,         // Any non-empty value
+    Int,            // INT, LENGTH, SEQNUM, DAYOFMONTH, TAGNUM
+    NumInGroup,     // Int that opens a repeating group
+    Float,          // PRICE, QTY, AMT, FLOAT, PRICEOFFSET, PERCENTAGE
+    Char            // CHAR, BOOLEAN
+};
+
+/// Per-tag entry, indexed by tag number
+struct DictField {
+    static constexpr uint8_t NO_BIT = 0xFF;
+    static constexpr uint16_t NO_ENUMS = 0xFFFF;
+
+    DictFieldClass cls{DictFieldClass::Undefined};
+    uint8_t required_bit{NO_BIT};       // Bit in RequiredSet if required anywhere
+    uint16_t enum_set{NO_ENUMS};        // Index into the enum bitmaps
+};
+
+static_assert(sizeof(DictField) == 4, "DictField is one 4-byte table slot");
+
+/// Required tags of a message, one bit per DictField::required_bit
+using RequiredSet = std::array<uint64_t, 4>;
+
+/// Valid single-character values of an enumerated field
+using EnumBitmap = std::array<uint64_t, 4>;
+
+/// One repeating group of a message (or of an enclosing group)
+struct DictGroup {
+    uint16_t count_tag{0};          // NumInGroup field
+    uint16_t delimiter{0};          // First field of every entry
+    uint32_t member_begin{0};       // Sorted member tags in DataDictionary::members_
+    uint16_t member_count{0};
+    uint16_t nested_begin{0};       // Groups inside one entry
+    uint16_t nested_count{0};
+};
+
+/// One message type
+struct DictMessage {
+    RequiredSet required{};         // Header + body + trailer
+    uint16_t group_begin{0};        // Top-level groups (header's included)
+    uint16_t group_count{0};
+};
+
+// ============================================================================
+// XML Reader (load time only)
+// ============================================================================
+
+namespace detail {
+
+/// Element tree of an XML document; names and values view the source
+struct XmlNode {
+    std::string_view name;
+    std::vector<std::pair<std::string_view, std::string_view>> attrs;
+    std::vector<uint32_t> children;
+    size_t offset{0};
+
+    [[nodiscard]] std::string_view attr(std::string_view key) const noexcept {
+        for (const auto& [k, v] : attrs) {
+            if (k == key) return v;
+        }
+        return {};
+    }
+};
+
+/// Minimal reader for dictionary files: elements and attributes only.
+/// Text, comments, processing instructions and DOCTYPE are skipped.
+class XmlReader {
+public:
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
+
+    [[nodiscard]] bool read(std::string_view s) {
+        std::vector<uint32_t> open;
+        size_t p = 0;
+        while ((p = s.find('<', p)) != std::string_view::npos) {
+            error_offset_ = p;
+            const std::string_view rest = s.substr(p);
+            if (rest.starts_with("<?")) {
+                if ((p = s.find("?>", p)) == std::string_view::npos) return false;
+                p += 2;
+            } else if (rest.starts_with("<!--")) {
+                if ((p = s.find("-->", p)) == std::string_view::npos) return false;
+                p += 3;
+            } else if (rest.starts_with("<!")) {
+                if ((p = s.find('>', p)) == std::string_view::npos) return false;
+                p += 1;
+            } else if (rest.starts_with("</")) {
+                const size_t end = s.find('>', p);
+                if (end == std::string_view::npos || open.empty()) return false;
+                if (trim(s.substr(p + 2, end - p - 2)) != nodes_[open.back()].name) return false;
+                open.pop_back();
+                p = end + 1;
+            } else {
+                if (!read_element(s, p, open)) return false;
+            }
+        }
+        return open.empty() && root_ != NO_NODE;
+    }
+
+    [[nodiscard]] const XmlNode& node(uint32_t i) const noexcept { return nodes_[i]; }
+    [[nodiscard]] uint32_t root() const noexcept { return root_; }
+    [[nodiscard]] size_t error_offset() const noexcept { return error_offset_; }
+
+    /// First child element named `name` (NO_NODE if none)
+    [[nodiscard]] uint32_t child(uint32_t parent, std::string_view name) const noexcept {
+        for (uint32_t c : nodes_[parent].children) {
+            if (nodes_[c].name == name) return c;
+        }
+        return NO_NODE;
+    }
+
+private:
+    static constexpr bool is_space(char c) noexcept {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    static std::string_view trim(std::string_view v) noexcept {
+        while (!v.empty() && is_space(v.front())) v.remove_prefix(1);
+        while (!v.empty() && is_space(v.back())) v.remove_suffix(1);
+        return v;
+    }
+
+    bool read_element(std::string_view s, size_t& p, std::vector<uint32_t>& open) {
+        XmlNode node;
+        node.offset = p;
+        size_t i = p + 1;
+        const size_t name_begin = i;
+        while (i < s.size() && !is_space(s[i]) && s[i] != '/' && s[i] != '>') ++i;
+        node.name = s.substr(name_begin, i - name_begin);
+        if (node.name.empty()) return false;
+
+        bool self_closing = false;
+        for (;;) {
+            while (i < s.size() && is_space(s[i])) ++i;
+            if (i >= s.size()) return false;
+            if (s[i] == '>') { ++i; break; }
+            if (s[i] == '/') {
+                if (i + 1 >= s.size() || s[i + 1] != '>') return false;
+                self_closing = true;
+                i += 2;
+                break;
+            }
+            const size_t key_begin = i;
+            while (i < s.size() && !is_space(s[i]) && s[i] != '=' && s[i] != '>' && s[i] != '/') ++i;
+            const std::string_view key = s.substr(key_begin, i - key_begin);
+            while (i < s.size() && is_space(s[i])) ++i;
+            if (key.empty() || i >= s.size() || s[i] != '=') return false;
+            ++i;
+            while (i < s.size() && is_space(s[i])) ++i;
+            if (i >= s.size() || (s[i] != '"' && s[i] != '\'')) return false;
+            const char quote = s[i++];
+            const size_t value_end = s.find(quote, i);
+            if (value_end == std::string_view::npos) return false;
+            node.attrs.emplace_back(key, s.substr(i, value_end - i));
+            i = value_end + 1;
+        }
+
+        const auto index = static_cast<uint32_t>(nodes_.size());
+        nodes_.push_back(std::move(node));
+        if (!open.empty()) {
+            nodes_[open.back()].children.push_back(index);
+        } else if (root_ == NO_NODE) {
+            root_ = index;
+        } else {
+            return false;  // Second root element
+        }
+        if (!self_closing) open.push_back(index);
+        p = i;
+        return true;
+    }
+
+    std::vector<XmlNode> nodes_;
+    uint32_t root_{NO_NODE};
+    size_t error_offset_{0};
+};
+
+/// Decode an attribute value consisting of one character or one of the
+/// five predefined entities; -1 for anything longer
+[[nodiscard]] inline int single_char_value(std::string_view v) noexcept {
+    if (v.size() == 1) return static_cast<unsigned char>(v[0]);
+    if (v == "&amp;") return '&';
+    if (v == "&lt;") return '<';
+    if (v == "&gt;") return '>';
+    if (v == "&quot;") return '"';
+    if (v == "&apos;") return '\'';
+    return -1;
+}
+
+/// Flattened content of a message, component or group entry
+struct Layout {
+    uint16_t count_tag{0};              // Groups only
+    std::vector<uint16_t> tags;         // Direct fields in order (incl. nested NumInGroups)
+    std::vector<uint16_t> required;
+    std::vector<Layout> groups;
+    size_t offset{0};
+};
+
+} // namespace detail
+
+// ============================================================================
+// Data Dictionary
+// ============================================================================
+
+/// A venue's FIX data dictionary as flat lookup tables
+class DataDictionary {
+public:
+    static constexpr size_t MAX_REQUIRED = 255;     // RequiredSet bits (255 = none)
+    static constexpr uint16_t NO_MESSAGE = 0xFFFF;
+
+    DataDictionary() = default;
+
+    /// Compile a QuickFIX-style XML dictionary
+    [[nodiscard]] static DictionaryResult<DataDictionary> load(std::string_view xml) {
+        detail::XmlReader reader;
+        if (!reader.read(xml)) {
+            return std::unexpected{DictionaryError{DictionaryErrorCode::MalformedXml,
+                                                   reader.error_offset()}};
+        }
+        DataDictionary dict;
+        if (DictionaryError err = dict.build(reader); err.code != DictionaryErrorCode::None) {
+            return std::unexpected{err};
+        }
+        return dict;
+    }
+
+    /// Read and compile a dictionary file (e.g. FIX44.xml)
+    [[nodiscard]] static DictionaryResult<DataDictionary> load_file(const std::string& path) {
+        std::ifstream in{path, std::ios::binary};
+        if (!in) {
+            return std::unexpected{DictionaryError{DictionaryErrorCode::FileNotFound}};
+        }
+        const std::string xml{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+        return load(xml);
+    }
+
+    // ========================================================================
+    // Lookups (hot path)
+    // ========================================================================
+
+    /// Table slot of a tag (nullptr beyond the highest defined tag)
+    [[nodiscard]] NFX_HOT const DictField* field(int tag) const noexcept {
+        if (static_cast<unsigned>(tag) >= fields_.size()) [[unlikely]] return nullptr;
+        return &fields_[static_cast<size_t>(tag)];
+    }
+
+    /// Message definition of a MsgType (nullptr if not in the dictionary)
+    [[nodiscard]] NFX_HOT const DictMessage* message(std::string_view msg_type) const noexcept {
+        const int key = msg_type_key(msg_type);
+        if (key < 0) [[unlikely]] return nullptr;
+        const uint16_t index = msg_index_[static_cast<size_t>(key)];
+        return index == NO_MESSAGE ? nullptr : &messages_[index];
+    }
+
+    /// Whether `c` is a valid value of enum set `set`
+    [[nodiscard]] NFX_HOT bool enum_valid(uint16_t set, char c) const noexcept {
+        const auto u = static_cast<unsigned char>(c);
+        return (enums_[set][u >> 6] >> (u & 63)) & 1;
+    }
+
+    [[nodiscard]] const DictGroup& group(size_t index) const noexcept { return groups_[index]; }
+
+    /// Group with NumInGroup `count_tag` among groups [begin, begin + count)
+    [[nodiscard]] NFX_HOT const DictGroup* find_group(uint16_t begin, uint16_t count,
+                                                      int count_tag) const noexcept {
+        for (size_t i = begin; i < size_t{begin} + count; ++i) {
+            if (groups_[i].count_tag == count_tag) return &groups_[i];
+        }
+        return nullptr;
+    }
+
+    /// Whether `tag` belongs to one entry of `group`
+    [[nodiscard]] NFX_HOT bool is_member(const DictGroup& group, int tag) const noexcept {
+        const auto first = members_.begin() + group.member_begin;
+        return std::binary_search(first, first + group.member_count,
+                                  static_cast<uint16_t>(tag));
+    }
+
+    /// Tag carrying required bit `bit`
+    [[nodiscard]] int required_tag(size_t bit) const noexcept { return required_tags_[bit]; }
+
+    /// Required header and trailer fields (messages of undefined type)
+    [[nodiscard]] const RequiredSet& session_required() const noexcept { return session_required_; }
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+
+    [[nodiscard]] size_t field_count() const noexcept { return defined_fields_; }
+    [[nodiscard]] size_t message_count() const noexcept { return messages_.size(); }
+    [[nodiscard]] size_t group_count() const noexcept { return groups_.size(); }
+    [[nodiscard]] size_t enum_count() const noexcept { return enums_.size(); }
+    [[nodiscard]] size_t required_count() const noexcept { return required_count_; }
+
+    /// Bytes of all tables
+    [[nodiscard]] size_t table_bytes() const noexcept {
+        return fields_.size() * sizeof(DictField) + messages_.size() * sizeof(DictMessage) +
+               groups_.size() * sizeof(DictGroup) + members_.size() * sizeof(uint16_t) +
+               enums_.size() * sizeof(EnumBitmap) + msg_index_.size() * sizeof(uint16_t);
+    }
+
+private:
+    static constexpr size_t MSG_INDEX_SIZE = 64 * 64;
+    static constexpr size_t MAX_NESTING = 32;   // Component/group recursion guard
+
+    /// 6-bit code of a MsgType character (0 = not [0-9A-Za-z])
+    static constexpr int type_char_code(char c) noexcept {
+        if (c >= '0' && c <= '9') return 1 + (c - '0');
+        if (c >= 'A' && c <= 'Z') return 11 + (c - 'A');
+        if (c >= 'a' && c <= 'z') return 37 + (c - 'a');
+        return 0;
+    }
+
+    /// Index into msg_index_ of a one- or two-character MsgType (-1 otherwise)
+    static constexpr int msg_type_key(std::string_view t) noexcept {
+        if (t.empty() || t.size() > 2) return -1;
+        const int c0 = type_char_code(t[0]);
+        const int c1 = t.size() == 2 ? type_char_code(t[1]) : 0;
+        if (c0 == 0 || (t.size() == 2 && c1 == 0)) return -1;
+        return c0 * 64 + c1;
+    }
+
+    static DictFieldClass class_of(std::string_view type) noexcept {
+        static constexpr std::string_view INTS[] = {
+            "INT", "LENGTH", "SEQNUM", "DAYOFMONTH", "TAGNUM"};
+        static constexpr std::string_view FLOATS[] = {
+            "PRICE", "QTY", "QUANTITY", "AMT", "FLOAT", "PRICEOFFSET", "PERCENTAGE"};
+        if (type == "NUMINGROUP") return DictFieldClass::NumInGroup;
+        for (auto t : INTS) if (type == t) return DictFieldClass::Int;
+        for (auto t : FLOATS) if (type == t) return DictFieldClass::Float;
+        if (type == "CHAR" || type == "BOOLEAN") return DictFieldClass::Char;
+        return DictFieldClass::String;
+    }
+
+    static DictionaryError fail(DictionaryErrorCode code, size_t offset) noexcept {
+        return DictionaryError{code, offset};
+    }
+
+    DictionaryError build(const detail::XmlReader& xml) {
+        const uint32_t root = xml.root();
+        if (xml.node(root).name != "fix") {
+            return fail(DictionaryErrorCode::InvalidDefinition, xml.node(root).offset);
+        }
+
+        if (DictionaryError err = build_fields(xml, root); err.code != DictionaryErrorCode::None) {
+            return err;
+        }
+
+        if (uint32_t comps = xml.child(root, "components"); comps != detail::XmlReader::NO_NODE) {
+            for (uint32_t c : xml.node(comps).children) {
+                components_.emplace(xml.node(c).attr("name"), c);
+            }
+        }
+
+        detail::Layout header, trailer;
+        for (auto [section, layout] : {std::pair{"header", &header}, std::pair{"trailer", &trailer}}) {
+            if (uint32_t n = xml.child(root, section); n != detail::XmlReader::NO_NODE) {
+                layout->offset = xml.node(n).offset;
+                if (DictionaryError err = collect(xml, n, true, *layout, 0);
+                    err.code != DictionaryErrorCode::None) {
+                    return err;
+                }
+            }
+        }
+        if (DictionaryError err = assign_bits(header.required, header.offset);
+            err.code != DictionaryErrorCode::None) return err;
+        if (DictionaryError err = assign_bits(trailer.required, trailer.offset);
+            err.code != DictionaryErrorCode::None) return err;
+        session_required_ = required_set(header.required, trailer.required, {});
+
+        msg_index_.assign(MSG_INDEX_SIZE, NO_MESSAGE);
+        const uint32_t msgs = xml.child(root, "messages");
+        const std::vector<uint32_t> none;
+        for (uint32_t m : msgs == detail::XmlReader::NO_NODE ? none : xml.node(msgs).children) {
+            const detail::XmlNode& node = xml.node(m);
+            const int key = msg_type_key(node.attr("msgtype"));
+            if (node.name != "message" || key < 0) {
+                return fail(DictionaryErrorCode::InvalidDefinition, node.offset);
+            }
+
+            detail::Layout body;
+            body.offset = node.offset;
+            if (DictionaryError err = collect(xml, m, true, body, 0);
+                err.code != DictionaryErrorCode::None) return err;
+            if (DictionaryError err = assign_bits(body.required, node.offset);
+                err.code != DictionaryErrorCode::None) return err;
+
+            std::vector<detail::Layout> groups = header.groups;
+            groups.insert(groups.end(), body.groups.begin(), body.groups.end());
+            groups.insert(groups.end(), trailer.groups.begin(), trailer.groups.end());
+
+            DictMessage msg;
+            msg.required = required_set(header.required, body.required, trailer.required);
+            auto placed = place_groups(groups, node.offset);
+            if (!placed) return placed.error();
+            std::tie(msg.group_begin, msg.group_count) = *placed;
+
+            msg_index_[static_cast<size_t>(key)] = static_cast<uint16_t>(messages_.size());
+            messages_.push_back(msg);
+        }
+        components_.clear();
+        names_.clear();
+        return {};
+    }
+
+    DictionaryError build_fields(const detail::XmlReader& xml, uint32_t root) {
+        const uint32_t defs = xml.child(root, "fields");
+        if (defs == detail::XmlReader::NO_NODE) return {};
+
+        int max_tag = 0;
+        for (uint32_t f : xml.node(defs).children) {
+            const detail::XmlNode& node = xml.node(f);
+            int tag = 0;
+            for (char c : node.attr("number")) {
+                if (c < '0' || c > '9' || tag > UINT16_MAX) {
+                    return fail(DictionaryErrorCode::InvalidDefinition, node.offset);
+                }
+                tag = tag * 10 + (c - '0');
+            }
+            if (node.name != "field" || tag <= 0 || tag > UINT16_MAX ||
+                node.attr("name").empty()) {
+                return fail(DictionaryErrorCode::InvalidDefinition, node.offset);
+            }
+            max_tag = std::max(max_tag, tag);
+        }
+        fields_.assign(static_cast<size_t>(max_tag) + 1, DictField{});
+
+        for (uint32_t f : xml.node(defs).children) {
+            const detail::XmlNode& node = xml.node(f);
+            int tag = 0;
+            for (char c : node.attr("number")) tag = tag * 10 + (c - '0');
+            names_.emplace(node.attr("name"), static_cast<uint16_t>(tag));
+
+            DictField& def = fields_[static_cast<size_t>(tag)];
+            const std::string_view type = node.attr("type");
+            def.cls = class_of(type);
+            ++defined_fields_;
+
+            // Bitmap only when every enum is one character
+            if (def.cls != DictFieldClass::Char && def.cls != DictFieldClass::Int) continue;
+            if (node.children.empty()) continue;
+            EnumBitmap bits{};
+            bool single = true;
+            for (uint32_t v : node.children) {
+                const int c = detail::single_char_value(xml.node(v).attr("enum"));
+                if (xml.node(v).name != "value" || c < 0) { single = false; break; }
+                bits[static_cast<size_t>(c) >> 6] |= uint64_t{1} << (c & 63);
+            }
+            if (!single) continue;
+            if (enums_.size() >= DictField::NO_ENUMS) {
+                return fail(DictionaryErrorCode::TooLarge, node.offset);
+            }
+            def.enum_set = static_cast<uint16_t>(enums_.size());
+            enums_.push_back(bits);
+        }
+        return {};
+    }
+
+    /// Flatten the children of a message, component or group entry.
+    /// Fields of optional components and of group entries are not required.
+    DictionaryError collect(const detail::XmlReader& xml, uint32_t parent, bool required_ctx,
+                            detail::Layout& out, size_t depth) {
+        if (depth > MAX_NESTING) {
+            return fail(DictionaryErrorCode::InvalidDefinition, xml.node(parent).offset);
+        }
+        for (uint32_t c : xml.node(parent).children) {
+            const detail::XmlNode& node = xml.node(c);
+            const bool required = required_ctx && node.attr("required") == "Y";
+
+            if (node.name == "component") {
+                auto it = components_.find(node.attr("name"));
+                if (it == components_.end()) {
+                    return fail(DictionaryErrorCode::UndefinedComponent, node.offset);
+                }
+                if (DictionaryError err = collect(xml, it->second, required, out, depth + 1);
+                    err.code != DictionaryErrorCode::None) return err;
+                continue;
+            }
+            if (node.name != "field" && node.name != "group") continue;
+
+            auto it = names_.find(node.attr("name"));
+            if (it == names_.end()) {
+                return fail(DictionaryErrorCode::UndefinedField, node.offset);
+            }
+            out.tags.push_back(it->second);
+            if (required) out.required.push_back(it->second);
+
+            if (node.name == "group") {
+                detail::Layout entry;
+                entry.count_tag = it->second;
+                entry.offset = node.offset;
+                if (DictionaryError err = collect(xml, c, false, entry, depth + 1);
+                    err.code != DictionaryErrorCode::None) return err;
+                out.groups.push_back(std::move(entry));
+            }
+        }
+        return {};
+    }
+
+    /// Number each newly required tag
+    DictionaryError assign_bits(const std::vector<uint16_t>& tags, size_t offset) {
+        for (uint16_t tag : tags) {
+            DictField& def = fields_[tag];
+            if (def.required_bit != DictField::NO_BIT) continue;
+            if (required_count_ >= MAX_REQUIRED) {
+                return fail(DictionaryErrorCode::TooManyRequiredFields, offset);
+            }
+            def.required_bit = static_cast<uint8_t>(required_count_);
+            required_tags_[required_count_++] = tag;
+        }
+        return {};
+    }
+
+    RequiredSet required_set(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b,
+                             const std::vector<uint16_t>& c) const noexcept {
+        RequiredSet set{};
+        for (const auto* tags : {&a, &b, &c}) {
+            for (uint16_t tag : *tags) {
+                const uint8_t bit = fields_[tag].required_bit;
+                set[bit >> 6] |= uint64_t{1} << (bit & 63);
+            }
+        }
+        return set;
+    }
+
+    /// Lay groups out contiguously, each followed (recursively) by its nested range
+    DictionaryResult<std::pair<uint16_t, uint16_t>> place_groups(
+        const std::vector<detail::Layout>& layouts, size_t offset) {
+        const size_t begin = groups_.size();
+        if (begin + layouts.size() > UINT16_MAX) {
+            return std::unexpected{fail(DictionaryErrorCode::TooLarge, offset)};
+        }
+        groups_.resize(begin + layouts.size());
+        for (size_t i = 0; i < layouts.size(); ++i) {
+            const detail::Layout& layout = layouts[i];
+            DictGroup group;
+            group.count_tag = layout.count_tag;
+            group.delimiter = layout.tags.empty() ? 0 : layout.tags.front();
+
+            std::vector<uint16_t> sorted = layout.tags;
+            std::sort(sorted.begin(), sorted.end());
+            sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+            group.member_begin = static_cast<uint32_t>(members_.size());
+            group.member_count = static_cast<uint16_t>(sorted.size());
+            members_.insert(members_.end(), sorted.begin(), sorted.end());
+
+            auto nested = place_groups(layout.groups, layout.offset);
+            if (!nested) return nested;
+            std::tie(group.nested_begin, group.nested_count) = *nested;
+            groups_[begin + i] = group;
+        }
+        return std::pair{static_cast<uint16_t>(begin), static_cast<uint16_t>(layouts.size())};
+    }
+
+    std::vector<DictField> fields_;
+    std::vector<DictMessage> messages_;
+    std::vector<uint16_t> msg_index_;
+    std::vector<DictGroup> groups_;
+    std::vector<uint16_t> members_;
+    std::vector<EnumBitmap> enums_;
+    std::array<uint16_t, MAX_REQUIRED> required_tags_{};
+    RequiredSet session_required_{};
+    size_t required_count_{0};
+    size_t defined_fields_{0};
+
+    // Load time only (views into the XML)
+    std::unordered_map<std::string_view, uint32_t> components_;
+    std::unordered_map<std::string_view, uint16_t> names_;
+};
+
+// ============================================================================
+// Validation
+// ============================================================================
+
+/// Per-venue strictness
+struct ValidationConfig {
+    bool required_fields{true};     // Header, body and trailer required tags
+    bool field_formats{true};       // Non-empty; numeric syntax for INT/PRICE/QTY...
+    bool enum_values{true};         // Single-character enums
+    bool group_counts{true};        // NumInGroup against delimiter occurrences
+    bool undefined_tags{false};     // Reject tags the dictionary does not define
+    bool unknown_msg_types{true};   // Reject MsgTypes the dictionary does not define
+
+    /// Everything, including tags the venue did not document
+    [[nodiscard]] static constexpr ValidationConfig strict() noexcept {
+        ValidationConfig c;
+        c.undefined_tags = true;
+        return c;
+    }
+
+    /// Required tags only, for venues whose dictionaries lag their feeds
+    [[nodiscard]] static constexpr ValidationConfig lenient() noexcept {
+        ValidationConfig c;
+        c.field_formats = false;
+        c.enum_values = false;
+        c.group_counts = false;
+        c.unknown_msg_types = false;
+        return c;
+    }
+};
+
+/// A dictionary with one venue's strictness. The dictionary must outlive
+/// the validator; several validators may share one dictionary.
+class DictionaryValidator {
+public:
+    static constexpr size_t MAX_GROUP_DEPTH = 4;  // Deeper nesting is not count-checked
+
+    explicit DictionaryValidator(const DataDictionary& dict, ValidationConfig config = {}) noexcept
+        : dict_{&dict}, config_{config} {}
+
+    /// State of one message's validation, fed field by field
+    class Pass {
+    public:
+        explicit Pass(const DictionaryValidator& v) noexcept
+            : dict_{*v.dict_}, config_{v.config_} {}
+
+        /// Check one field in wire order
+        /// @param offset Byte offset of the field's value (for the error)
+        /// @return false once the message is invalid (see error())
+        [[nodiscard]] NFX_HOT bool on_field(const FieldView& field, size_t offset) noexcept {
+            const DictField* def = dict_.field(field.tag);
+            if (!def || def->cls == DictFieldClass::Undefined) [[unlikely]] {
+                if (config_.undefined_tags) {
+                    return fail(ParseErrorCode::UndefinedTag, field.tag, offset);
+                }
+                return true;
+            }
+
+            if (field.tag == tag::MsgType::value) [[unlikely]] {
+                message_ = dict_.message(field.as_string());
+                if (!message_ && config_.unknown_msg_types) {
+                    return fail(ParseErrorCode::InvalidMsgType, field.tag, offset);
+                }
+            }
+
+            if (depth_ > 0 && !close_groups(field.tag, offset)) [[unlikely]] return false;
+
+            if (depth_ == 0 && def->required_bit != DictField::NO_BIT) {
+                seen_[def->required_bit >> 6] |= uint64_t{1} << (def->required_bit & 63);
+            }
+
+            if (config_.field_formats && !format_valid(def->cls, field.value)) [[unlikely]] {
+                return fail(ParseErrorCode::InvalidFieldFormat, field.tag, offset);
+            }
+            if (config_.enum_values && def->enum_set != DictField::NO_ENUMS &&
+                (field.value.size() != 1 || !dict_.enum_valid(def->enum_set, field.value[0])))
+                [[unlikely]] {
+                return fail(ParseErrorCode::InvalidTagValue, field.tag, offset);
+            }
+
+            if (def->cls == DictFieldClass::NumInGroup && config_.group_counts && message_)
+                [[unlikely]] {
+                return open_group(field, offset);
+            }
+            return true;
+        }
+
+        /// Checks needing the whole message (after the last field)
+        [[nodiscard]] ParseError finish() noexcept {
+            if (error_.code != ParseErrorCode::None) return error_;
+            while (depth_ > 0) {
+                const Frame& top = frames_[depth_ - 1];
+                if (top.entries != top.expected) {
+                    return ParseError{ParseErrorCode::IncorrectNumInGroup,
+                                      top.group->count_tag, top.offset};
+                }
+                --depth_;
+            }
+            if (config_.required_fields) {
+                const RequiredSet& required = message_ ? message_->required
+                                                       : dict_.session_required();
+                for (size_t i = 0; i < required.size(); ++i) {
+                    if (const uint64_t missing = required[i] & ~seen_[i]; missing != 0) {
+                        const size_t bit = i * 64 + static_cast<size_t>(std::countr_zero(missing));
+                        return ParseError{ParseErrorCode::MissingRequiredField,
+                                          dict_.required_tag(bit)};
+                    }
+                }
+            }
+            return {};
+        }
+
+        [[nodiscard]] const ParseError& error() const noexcept { return error_; }
+
+    private:
+        struct Frame {
+            const DictGroup* group;
+            int64_t expected;
+            int64_t entries;
+            size_t offset;
+        };
+
+        static constexpr bool is_digit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+        static bool format_valid(DictFieldClass cls, std::span<const char> v) noexcept {
+            if (v.empty()) return false;
+            switch (cls) {
+                case DictFieldClass::Char:
+                    return v.size() == 1;
+                case DictFieldClass::Int:
+                case DictFieldClass::NumInGroup:
+                case DictFieldClass::Float: {
+                    size_t i = v[0] == '-' ? 1 : 0;
+                    size_t digits = 0;
+                    bool dot = false;
+                    for (; i < v.size(); ++i) {
+                        if (is_digit(v[i])) {
+                            ++digits;
+                        } else if (v[i] == '.' && cls == DictFieldClass::Float && !dot) {
+                            dot = true;
+                        } else {
+                            return false;
+                        }
+                    }
+                    return digits > 0;
+                }
+                default:
+                    return true;
+            }
+        }
+
+        bool fail(ParseErrorCode code, int tag, size_t offset) noexcept {
+            error_ = ParseError{code, tag, offset};
+            return false;
+        }
+
+        /// Count a delimiter or close groups the field falls outside of
+        bool close_groups(int tag, size_t offset) noexcept {
+            while (depth_ > 0) {
+                Frame& top = frames_[depth_ - 1];
+                if (tag == top.group->delimiter) {
+                    if (++top.entries > top.expected) {
+                        return fail(ParseErrorCode::IncorrectNumInGroup, top.group->count_tag, offset);
+                    }
+                    return true;
+                }
+                if (dict_.is_member(*top.group, tag)) {
+                    if (top.entries == 0) {  // Entry not started by the delimiter
+                        return fail(ParseErrorCode::IncorrectNumInGroup, top.group->count_tag, offset);
+                    }
+                    return true;
+                }
+                if (top.entries != top.expected) {
+                    return fail(ParseErrorCode::IncorrectNumInGroup, top.group->count_tag, offset);
+                }
+                --depth_;
+            }
+            return true;
+        }
+
+        bool open_group(const FieldView& field, size_t offset) noexcept {
+            const DictGroup* group = depth_ == 0
+                ? dict_.find_group(message_->group_begin, message_->group_count, field.tag)
+                : dict_.find_group(frames_[depth_ - 1].group->nested_begin,
+                                   frames_[depth_ - 1].group->nested_count, field.tag);
+            if (!group || depth_ == MAX_GROUP_DEPTH) return true;
+            const int64_t count = field.as_int().value_or(0);
+            if (count > 0) {
+                frames_[depth_++] = Frame{group, count, 0, offset};
+            }
+            return true;
+        }
+
+        const DataDictionary& dict_;
+        const ValidationConfig& config_;
+        const DictMessage* message_{nullptr};
+        RequiredSet seen_{};
+        std::array<Frame, MAX_GROUP_DEPTH> frames_{};
+        size_t depth_{0};
+        ParseError error_{};
+    };
+
+    [[nodiscard]] Pass begin() const noexcept { return Pass{*this}; }
+
+    [[nodiscard]] const DataDictionary& dictionary() const noexcept { return *dict_; }
+    [[nodiscard]] const ValidationConfig& config() const noexcept { return config_; }
+
+private:
+    const DataDictionary* dict_;
+    ValidationConfig config_;
+};
+
+} // namespace nfx
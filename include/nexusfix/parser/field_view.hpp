@@ -6,6 +6,7 @@
 #include <charconv>
 #include <optional>
 #include <limits>
+#include <type_traits>
 
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/util/compiler.hpp"
@@ -132,6 +133,66 @@ struct FieldView {
         return static_cast<TimeInForce>(value[0]);
     }
 
+    /// Parse exactly Width digits (zero-padded sequence numbers, fixed-length
+    /// ids) with straight-line SWAR code; other text is parsed as as_uint()
+    template <size_t Width>
+    [[nodiscard]] constexpr std::optional<uint64_t> as_fixed_uint() const noexcept {
+        if !consteval {
+            uint64_t result;
+            if (value.size() == Width &&
+                detail::swar_parse_fixed<Width>(value.data(), result)) [[likely]] {
+                return result;
+            }
+        }
+        return as_uint();
+    }
+
+    /// Value converted to T: std::string_view, FixedPrice, Qty, SeqNum, bool,
+    /// char, char-valued enums or integers; nullopt if the field is absent
+    /// or its value does not convert (an empty char enum, a non-numeric
+    /// integer). A tag::FixedDigits / tag::FixedDecimals Layout selects
+    /// the fixed-width conversion for integers / prices and quantities.
+    template <typename T, typename Layout = tag::AnyWidth>
+    [[nodiscard]] constexpr std::optional<T> as() const noexcept {
+        if (!is_valid()) [[unlikely]] return std::nullopt;
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            return as_string();
+        } else if constexpr (std::is_same_v<T, FixedPrice> || std::is_same_v<T, Qty>) {
+            if constexpr (requires { Layout::decimals; }) {
+                return T::template from_fixed_decimals<Layout::decimals>(as_string());
+            } else {
+                return T::from_string(as_string());
+            }
+        } else if constexpr (std::is_same_v<T, SeqNum>) {
+            if (auto v = as<uint32_t, Layout>()) return SeqNum{*v};
+            return std::nullopt;
+        } else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+                             !std::is_same_v<T, char> && requires { Layout::width; }) {
+            if constexpr (std::is_signed_v<T>) {
+                if (!value.empty() && value[0] == '-') [[unlikely]] return as<T>();
+            }
+            if (auto v = as_fixed_uint<Layout::width>()) return static_cast<T>(*v);
+            return std::nullopt;
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return as_bool();
+        } else if constexpr (std::is_same_v<T, char>) {
+            return as_char();
+        } else if constexpr (std::is_enum_v<T>) {
+            static_assert(std::is_same_v<std::underlying_type_t<T>, char>,
+                          "Enum fields must be char-valued FIX enums");
+            if (value.empty()) return std::nullopt;
+            return static_cast<T>(value[0]);
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            if (auto v = as_int()) return static_cast<T>(*v);
+            return std::nullopt;
+        } else if constexpr (std::is_integral_v<T>) {
+            if (auto v = as_uint()) return static_cast<T>(*v);
+            return std::nullopt;
+        } else {
+            static_assert(sizeof(T) == 0, "No FIX conversion for this type");
+        }
+    }
+
     // ========================================================================
     // Validation
     // ========================================================================
@@ -0,0 +1,260 @@
+/*
+    NexusFIX Parallel Log Scanner
+
+    Bulk parsing of multi-GB FIX logs (backtest replay, end-of-day
+    reconciliation) on every core:
+
+    - MappedFile maps the log read-only; pages stream in on first touch
+      with sequential read-ahead, nothing is copied
+    - split() cuts the bytes into chunks right after a CheckSum field
+      ("\x0110=XXX\x01"), so no message straddles two chunks; cuts are found
+      with the vector trailer search, never by parsing from the start
+    - Workers take chunks from a shared counter (more chunks than threads,
+      so one dense chunk does not hold up the rest), frame each message,
+      run build_index() and hand both to the visitor with a per-chunk
+      accumulator
+    - Accumulators come back in file order; reduce() merges them in order
+
+    Bytes between messages (line breaks, log line prefixes) are skipped:
+    a message starts at "8=FIX".
+
+    Usage:
+        MappedFile log;
+        if (!log.open("fix.log")) { ... }
+        ParallelLogScanner scanner;
+        auto fills = scanner.reduce<size_t>(log.bytes(),
+            [](size_t& n, std::span<const char> msg,
+               const simd::FIXStructuralIndex& idx, size_t offset) {
+                n += idx.msg_type_start && msg[idx.msg_type_start + 3] == '8';
+            },
+            [](size_t& total, size_t&& part) { total += part; });
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/parser/simd_scanner.hpp"
+#include "nexusfix/parser/structural_index.hpp"
+
+#if NFX_PLATFORM_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Mapped File
+// ============================================================================
+
+#if NFX_PLATFORM_POSIX
+
+/// Read-only mapping of a whole file
+class MappedFile {
+public:
+    MappedFile() noexcept = default;
+
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Map a file for sequential reading
+    /// @return false if it cannot be opened or mapped (an empty file maps
+    ///         to an empty span)
+    [[nodiscard]] bool open(const char* path) noexcept {
+        close();
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ == 0) {
+            ::close(fd);
+            return true;
+        }
+
+        void* ptr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);   // The mapping keeps the file referenced
+        if (ptr == MAP_FAILED) {
+            size_ = 0;
+            return false;
+        }
+        data_ = static_cast<const char*>(ptr);
+        // Each worker reads its chunk front to back
+        (void)::madvise(ptr, size_, MADV_SEQUENTIAL);
+        (void)::madvise(ptr, size_, MADV_WILLNEED);
+        return true;
+    }
+
+    void close() noexcept {
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+            data_ = nullptr;
+        }
+        size_ = 0;
+    }
+
+    [[nodiscard]] std::span<const char> bytes() const noexcept { return {data_, size_}; }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+
+private:
+    const char* data_{nullptr};
+    size_t size_{0};
+};
+
+#endif  // NFX_PLATFORM_POSIX
+
+// ============================================================================
+// Parallel Log Scanner
+// ============================================================================
+
+/// Byte range [begin, end) of a log holding whole messages
+struct LogChunk {
+    size_t begin{0};
+    size_t end{0};
+};
+
+/// One chunk's accumulator and counts
+template <typename Acc>
+struct ChunkResult {
+    LogChunk range;
+    size_t messages{0};     // Framed and handed to the visitor
+    size_t skipped{0};      // Framed but not indexable (too many fields)
+    Acc acc{};
+};
+
+/// Splits a log at message boundaries and scans the chunks on a pool of
+/// threads, results in file order
+class ParallelLogScanner {
+public:
+    /// Chunks handed out per thread: a small surplus evens out chunks of
+    /// unequal density
+    static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+    /// @param threads Workers (0 = one per hardware thread)
+    /// @param min_chunk Smallest chunk worth a thread, in bytes
+    explicit ParallelLogScanner(size_t threads = 0, size_t min_chunk = size_t{1} << 20) noexcept
+        : threads_{threads > 0 ? threads : std::max<size_t>(1, std::thread::hardware_concurrency())}
+        , min_chunk_{std::max<size_t>(1, min_chunk)} {}
+
+    [[nodiscard]] size_t threads() const noexcept { return threads_; }
+
+    /// Cut data into about `parts` chunks of whole messages; every cut
+    /// lies just past a CheckSum field's SOH
+    [[nodiscard]] static std::vector<LogChunk> split(std::span<const char> data, size_t parts) {
+        std::vector<LogChunk> chunks;
+        if (data.empty()) return chunks;
+        parts = std::max<size_t>(1, parts);
+        const size_t step = (data.size() + parts - 1) / parts;
+
+        size_t begin = 0;
+        while (begin < data.size()) {
+            size_t end = data.size();
+            if (data.size() - begin > step) {
+                end = cut_after(data, begin + step);
+            }
+            chunks.push_back(LogChunk{begin, end});
+            begin = end;
+        }
+        return chunks;
+    }
+
+    /// Scan every message: visit(Acc&, std::span<const char> msg,
+    /// const simd::FIXStructuralIndex&, size_t offset) runs on worker
+    /// threads with the accumulator of the message's chunk
+    /// @return One result per chunk, in file order
+    template <typename Acc, typename Visit>
+    [[nodiscard]] std::vector<ChunkResult<Acc>> map(std::span<const char> data, Visit&& visit) const {
+        const size_t by_size = std::max<size_t>(1, data.size() / min_chunk_);
+        const std::vector<LogChunk> chunks = split(data, std::min(threads_ * CHUNKS_PER_THREAD, by_size));
+
+        std::vector<ChunkResult<Acc>> results(chunks.size());
+        for (size_t i = 0; i < chunks.size(); ++i) results[i].range = chunks[i];
+
+        std::atomic<size_t> next{0};
+        auto worker = [&]() {
+            for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < results.size();
+                 i = next.fetch_add(1, std::memory_order_relaxed)) {
+                scan_chunk(data, results[i], visit);
+            }
+        };
+
+        const size_t workers = std::min(threads_, results.size());
+        std::vector<std::thread> pool;
+        pool.reserve(workers > 0 ? workers - 1 : 0);
+        for (size_t t = 1; t < workers; ++t) pool.emplace_back(worker);
+        worker();   // The calling thread works too
+        for (auto& thread : pool) thread.join();
+        return results;
+    }
+
+    /// map(), then merge(Acc& into, Acc&& part) over the chunks in file order
+    template <typename Acc, typename Visit, typename Merge>
+    [[nodiscard]] Acc reduce(std::span<const char> data, Visit&& visit, Merge&& merge,
+                             Acc init = Acc{}) const {
+        auto results = map<Acc>(data, std::forward<Visit>(visit));
+        for (auto& result : results) merge(init, std::move(result.acc));
+        return init;
+    }
+
+private:
+    /// First position past a CheckSum field at or after pos (data.size()
+    /// if none)
+    [[nodiscard]] static size_t cut_after(std::span<const char> data, size_t pos) noexcept {
+        const size_t trailer = simd::find_trailer(data, pos);
+        if (trailer >= data.size()) return data.size();
+        const size_t soh = simd::find_soh(data, trailer + 4);
+        return soh < data.size() ? soh + 1 : data.size();
+    }
+
+    /// Frame and visit every message starting in a chunk
+    template <typename Acc, typename Visit>
+    static void scan_chunk(std::span<const char> data, ChunkResult<Acc>& result, Visit& visit) {
+        const auto chunk = data.subspan(0, result.range.end);
+        const std::string_view text{chunk.data(), chunk.size()};
+        size_t pos = result.range.begin;
+
+        while (pos < chunk.size()) {
+            const size_t start = text.find("8=FIX", pos);
+            if (start == std::string_view::npos) break;
+
+            const simd::MessageBoundary boundary = simd::find_message_boundary(chunk, start);
+            if (!boundary.complete) [[unlikely]] {
+                pos = start + 1;    // No trailer: not a message, look further
+                continue;
+            }
+
+            const auto msg = boundary.slice(chunk);
+            const simd::FIXStructuralIndex idx = simd::build_index(msg);
+            if (idx.valid()) [[likely]] {
+                visit(result.acc, msg, idx, boundary.start);
+                ++result.messages;
+            } else {
+                ++result.skipped;
+            }
+            pos = boundary.end;
+        }
+    }
+
+    size_t threads_;
+    size_t min_chunk_;
+};
+
+} // namespace nfx
@@ -11,6 +11,7 @@
 #include "nexusfix/types/field_types.hpp"
 #include "nexusfix/types/market_data_types.hpp"
 #include "nexusfix/parser/field_view.hpp"
+#include "nexusfix/util/symbol_table.hpp"
 
 namespace nfx::parser {
 
@@ -20,27 +21,60 @@ namespace nfx::parser {
 
 /// Zero-copy iterator over repeating group entries in a FIX message.
 /// Each entry starts with the delimiter tag (first tag in the group definition).
+/// Finding an entry's end walks its fields once; that walk also records each
+/// field's tag and value offset, so Entry lookups never rescan the bytes.
 class RepeatingGroupIterator {
 public:
+    /// Fields indexed per entry; lookups past this scan the rest of the entry
+    static constexpr size_t MAX_ENTRY_FIELDS = 16;
+
     struct Entry {
-        std::span<const char> data;  // Raw data for this entry
-        size_t start_pos;
-        size_t end_pos;
+        std::span<const char> data{};  // Raw data for this entry
+        size_t start_pos{0};
+        size_t end_pos{0};
 
-        /// Get a field value by tag number
+        /// Get a field value by tag number (indexed tags, no byte scan)
         [[nodiscard]] NFX_HOT
         FieldView get_field(int target_tag) const noexcept {
-            FieldIterator iter{data};
-            while (iter.has_next()) [[likely]] {
-                FieldView field = iter.next();
-                if (!field.is_valid()) [[unlikely]] break;
-                if (field.tag == target_tag) [[unlikely]] {
-                    return field;
+            for (size_t i = 0; i < field_count_; ++i) {
+                if (tags_[i] == target_tag) [[unlikely]] {
+                    return field_at(i);
                 }
             }
+            if (overflow_) [[unlikely]] {
+                return scan_overflow(target_tag);
+            }
             return FieldView{};
         }
 
+        /// Number of indexed fields (all fields unless overflowed())
+        [[nodiscard]] size_t field_count() const noexcept { return field_count_; }
+
+        /// Indexed field `i`, in wire order
+        [[nodiscard]] FieldView field_at(size_t i) const noexcept {
+            return FieldView{tags_[i],
+                             std::span<const char>{data.data() + offsets_[i], lengths_[i]}};
+        }
+
+        /// More than MAX_ENTRY_FIELDS fields; the rest are found by scanning
+        [[nodiscard]] bool overflowed() const noexcept { return overflow_; }
+
+        /// Visit every field in wire order, indexed ones first
+        template <typename Fn>
+        void for_each_field(Fn&& fn) const noexcept {
+            for (size_t i = 0; i < field_count_; ++i) {
+                fn(field_at(i));
+            }
+            if (overflow_) [[unlikely]] {
+                FieldIterator iter{data.subspan(overflow_pos_)};
+                while (iter.has_next()) {
+                    FieldView field = iter.next();
+                    if (!field.is_valid()) [[unlikely]] break;
+                    fn(field);
+                }
+            }
+        }
+
         [[nodiscard]] std::string_view get_string(int target_tag) const noexcept {
             auto fv = get_field(target_tag);
             return std::string_view{fv.value.data(), fv.value.size()};
@@ -62,6 +96,49 @@ public:
         [[nodiscard]] Qty get_qty(int tag) const noexcept {
             return get_field(tag).as_qty();
         }
+
+        /// Interned id of the entry's symbol (lookup only; invalid if absent)
+        template <size_t MaxSymbols>
+        [[nodiscard]] SymbolId get_symbol_id(
+            const util::BasicSymbolTable<MaxSymbols>& symbols,
+            int tag = tag::Symbol::value) const noexcept {
+            return symbols.find(get_string(tag));
+        }
+
+    private:
+        friend class RepeatingGroupIterator;
+
+        /// Record a field found while walking the entry (offsets relative to `base`)
+        void add(const FieldView& field, const char* base, size_t field_pos) noexcept {
+            if (field_count_ == MAX_ENTRY_FIELDS) [[unlikely]] {
+                if (!overflow_) {
+                    overflow_ = true;
+                    overflow_pos_ = static_cast<uint32_t>(field_pos);
+                }
+                return;
+            }
+            tags_[field_count_] = field.tag;
+            offsets_[field_count_] = static_cast<uint32_t>(field.value.data() - base);
+            lengths_[field_count_] = static_cast<uint32_t>(field.value.size());
+            ++field_count_;
+        }
+
+        [[nodiscard]] FieldView scan_overflow(int target_tag) const noexcept {
+            FieldIterator iter{data.subspan(overflow_pos_)};
+            while (iter.has_next()) {
+                FieldView field = iter.next();
+                if (!field.is_valid()) [[unlikely]] break;
+                if (field.tag == target_tag) return field;
+            }
+            return FieldView{};
+        }
+
+        std::array<int, MAX_ENTRY_FIELDS> tags_{};
+        std::array<uint32_t, MAX_ENTRY_FIELDS> offsets_{};
+        std::array<uint32_t, MAX_ENTRY_FIELDS> lengths_{};
+        uint32_t overflow_pos_{0};  // Entry-relative start of the first unindexed field
+        uint8_t field_count_{0};
+        bool overflow_{false};
     };
 
     constexpr RepeatingGroupIterator() noexcept = default;
@@ -82,16 +159,37 @@ public:
         return current_index_ < total_count_;
     }
 
+    /// Next entry: ends before the next delimiter tag (the last entry before
+    /// CheckSum), indexing its fields on the way
     [[nodiscard]] NFX_HOT
     Entry next() noexcept {
+        Entry entry;
         if (current_index_ >= total_count_) [[unlikely]] {
-            return Entry{{}, 0, 0};
+            return entry;
         }
 
-        size_t start = current_pos_;
-        size_t end = find_next_entry_start();
+        const size_t start = current_pos_;
+        const bool last = current_index_ + 1 >= total_count_;
+        const char* base = data_.data() + start;
+        size_t end = data_.size();
+
+        FieldIterator iter{data_};
+        iter.seek(start);
+        while (iter.has_next()) [[likely]] {
+            const size_t field_pos = iter.position();
+            FieldView field = iter.next();
+            if (!field.is_valid()) [[unlikely]] break;
+            if (field.tag == tag::CheckSum::value ||
+                (field.tag == delimiter_tag_ && field_pos != start && !last)) [[unlikely]] {
+                end = field_pos;
+                break;
+            }
+            entry.add(field, base, field_pos - start);
+        }
 
-        Entry entry{data_.subspan(start, end - start), start, end};
+        entry.data = data_.subspan(start, end - start);
+        entry.start_pos = start;
+        entry.end_pos = end;
         current_pos_ = end;
         ++current_index_;
 
@@ -106,49 +204,21 @@ public:
         return current_index_;
     }
 
+    /// Bytes from the next entry's delimiter tag to the end of the data
+    [[nodiscard]] std::span<const char> remaining() const noexcept {
+        return data_.subspan(current_pos_ < data_.size() ? current_pos_ : data_.size());
+    }
+
+    [[nodiscard]] int delimiter_tag() const noexcept {
+        return delimiter_tag_;
+    }
+
 private:
     void find_first_entry() noexcept {
         // Find the first occurrence of the delimiter tag
         current_pos_ = find_tag_position(0, delimiter_tag_);
     }
 
-    [[nodiscard]] NFX_HOT
-    size_t find_next_entry_start() noexcept {
-        // Find the next occurrence of delimiter tag, or end of data
-        size_t search_start = current_pos_;
-
-        // Skip past current tag=value pair
-        while (search_start < data_.size() && data_[search_start] != fix::SOH) [[likely]] {
-            ++search_start;
-        }
-        if (search_start < data_.size()) [[likely]] {
-            ++search_start; // Skip SOH
-        }
-
-        // Look for next delimiter tag or end
-        if (current_index_ + 1 >= total_count_) [[unlikely]] {
-            // Last entry - find end by looking for CheckSum tag (10=)
-            // or just return remaining data
-            size_t pos = search_start;
-            while (pos < data_.size()) [[likely]] {
-                // Check for tag 10= (checksum)
-                if (pos + 3 < data_.size() &&
-                    data_[pos] == '1' && data_[pos + 1] == '0' && data_[pos + 2] == '=') [[unlikely]] {
-                    return pos;
-                }
-                // Move to next field
-                while (pos < data_.size() && data_[pos] != fix::SOH) [[likely]] {
-                    ++pos;
-                }
-                if (pos < data_.size()) [[likely]] ++pos;
-            }
-            return data_.size();
-        }
-
-        // Find next occurrence of delimiter tag
-        return find_tag_position(search_start, delimiter_tag_);
-    }
-
     [[nodiscard]] NFX_HOT
     size_t find_tag_position(size_t start, int tag) const noexcept {
         // Convert tag to string for comparison
@@ -279,14 +349,96 @@ public:
         return parse_md_entry(entry);
     }
 
+    /// Indexed entry, for callers that decode fields themselves
+    /// (e.g. book::BookCache) instead of materializing an MDEntry
+    [[nodiscard]] NFX_HOT
+    RepeatingGroupIterator::Entry next_entry() noexcept {
+        return iter_.next();
+    }
+
     [[nodiscard]] size_t count() const noexcept {
         return iter_.count();
     }
 
+    /// Entries not yet returned by next()/next_entry()
+    [[nodiscard]] size_t remaining_count() const noexcept {
+        return iter_.count() - iter_.current();
+    }
+
+    [[nodiscard]] const RepeatingGroupIterator& group() const noexcept {
+        return iter_;
+    }
+
 private:
     RepeatingGroupIterator iter_;
 };
 
+// ============================================================================
+// Columnar MDEntry Decode
+// ============================================================================
+
+/// Decode the remaining entries of an MDEntry group into structure-of-arrays
+/// columns in one walk over the group's fields: no Entry or MDEntry is built
+/// and only MDEntryType/Px/Size/UpdateAction/PositionNo are kept. Px and Size
+/// go through the SWAR decimal parse of FixedPrice/Qty.
+/// @param default_action Action for entries without MDUpdateAction (279),
+///        i.e. every snapshot (35=W) entry
+/// @return Rows decoded; out.truncated is set if the group exceeded Capacity
+template <size_t Capacity>
+NFX_HOT
+inline size_t decode_md_columns(const MDEntryIterator& iter, MDEntryColumns<Capacity>& out,
+                                MDUpdateAction default_action = MDUpdateAction::New) noexcept {
+    out.clear();
+    const size_t total = iter.remaining_count();
+    const int delimiter = iter.group().delimiter_tag();
+
+    size_t rows = 0;
+    size_t row = 0;
+    FieldIterator fields{iter.group().remaining()};
+    while (fields.has_next() && total > 0) [[likely]] {
+        const FieldView f = fields.next();
+        if (!f.is_valid() || f.tag == tag::CheckSum::value) [[unlikely]] break;
+
+        if (f.tag == delimiter) {
+            if (rows == total) break;
+            if (rows == Capacity) [[unlikely]] {
+                out.truncated = true;
+                break;
+            }
+            row = rows++;
+            out.prices[row] = FixedPrice{};
+            out.sizes[row] = Qty{};
+            out.types[row] = MDEntryType::Bid;
+            out.actions[row] = default_action;
+            out.levels[row] = 0;
+        } else if (rows == 0) [[unlikely]] {
+            continue;
+        }
+
+        switch (f.tag) {
+            case tag::MDEntryType::value:
+                out.types[row] = static_cast<MDEntryType>(f.as_char());
+                break;
+            case tag::MDEntryPx::value:
+                out.prices[row] = f.as_price();
+                break;
+            case tag::MDEntrySize::value:
+                out.sizes[row] = f.as_qty();
+                break;
+            case tag::MDUpdateAction::value:
+                out.actions[row] = static_cast<MDUpdateAction>(f.as_char());
+                break;
+            case tag::MDEntryPositionNo::value:
+                out.levels[row] = static_cast<int32_t>(f.as_int().value_or(0));
+                break;
+            default:
+                break;
+        }
+    }
+    out.count = rows;
+    return rows;
+}
+
 // ============================================================================
 // Related Symbol Iterator Wrapper
 // ============================================================================
@@ -309,6 +461,11 @@ public:
         return parse_related_symbol(entry);
     }
 
+    /// Indexed entry, for fields beyond those in RelatedSymbol
+    [[nodiscard]] RepeatingGroupIterator::Entry next_entry() noexcept {
+        return iter_.next();
+    }
+
     [[nodiscard]] size_t count() const noexcept {
         return iter_.count();
     }
@@ -7,6 +7,10 @@
 #pragma warning(disable: 4324)
 #endif
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
 #include <span>
 #include <cstdint>
 
@@ -16,86 +20,242 @@
 #include "nexusfix/interfaces/i_message.hpp"
 #include "nexusfix/parser/field_view.hpp"
 #include "nexusfix/parser/simd_scanner.hpp"
+#include "nexusfix/parser/structural_index.hpp"
+#include "nexusfix/parser/simd_checksum.hpp"
 #include "nexusfix/parser/consteval_parser.hpp"
+#include "nexusfix/parser/data_dictionary.hpp"
+#include "nexusfix/util/prefetch.hpp"
+#include "nexusfix/util/symbol_table.hpp"
 
 namespace nfx {
 
 // Use global cache line size
 inline constexpr size_t PARSER_CACHE_LINE_SIZE = CACHE_LINE_SIZE;
 
+// ============================================================================
+// Checksum Policy
+// ============================================================================
+
+/// When parsing verifies CheckSum (10)
+enum class ChecksumPolicy : uint8_t {
+    Validate,   // Verify before the message is returned (default)
+    Deferred    // Skip; caller verifies later (verify_checksums(),
+                // util::DeferredChecksumVerifier) - trusted links only
+};
+
+/// Verify CheckSum (10) of a complete framed message using the SIMD kernel
+/// Fast path expects the trailer "10=NNN" SOH at the very end.
+[[nodiscard]] NFX_HOT
+inline ParseError verify_checksum(std::span<const char> data) noexcept {
+    constexpr size_t TRAILER_SIZE = 7;  // "10=NNN" SOH
+
+    if (data.size() > TRAILER_SIZE) [[likely]] {
+        const char* t = data.data() + data.size() - TRAILER_SIZE;
+        if (t[-1] == fix::SOH && t[0] == '1' && t[1] == '0' && t[2] == '=' &&
+            t[6] == fix::SOH) [[likely]] {
+            const uint8_t actual = parser::checksum(data.data(), data.size() - TRAILER_SIZE);
+            const int expected = (t[3] - '0') * 100 + (t[4] - '0') * 10 + (t[5] - '0');
+            if (static_cast<int>(actual) != expected) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidChecksum, tag::CheckSum::value};
+            }
+            return ParseError{};
+        }
+    }
+
+    return validate_checksum(data);
+}
+
+// ============================================================================
+// Field Splitting (shared by ParsedMessage and IndexedParser)
+// ============================================================================
+
+namespace detail {
+
+/// Extract tag number from [start, end)
+/// Tag 0 is invalid in FIX, so a zero decode takes the checked slow path
+[[nodiscard]] NFX_HOT
+inline ParseResult<int> parse_tag(const char* __restrict ptr,
+                                  size_t start, size_t end) noexcept {
+    // SWAR fast path; the scalar loop below locates the bad byte
+    if (int tag = simd::decode_tag(ptr, start, end); tag != 0) [[likely]] {
+        return tag;
+    }
+
+    int tag = 0;
+    for (size_t j = start; j < end; ++j) [[likely]] {
+        char c = ptr[j];
+        if (c < '0' || c > '9') [[unlikely]] {
+            return std::unexpected{ParseError{
+                ParseErrorCode::InvalidTagNumber, 0, j}};
+        }
+        tag = tag * 10 + (c - '0');
+    }
+    return tag;
+}
+
+/// Stage 2 from the structural index: no further byte scanning
+/// @param emit bool(FieldView) - false stops (capacity reached)
+template <typename Emit>
+[[nodiscard]] NFX_HOT
+ParseResult<void> split_fields_indexed(std::span<const char> data,
+                                       const simd::FIXStructuralIndex& idx,
+                                       Emit&& emit) noexcept {
+    const char* __restrict ptr = data.data();
+    const size_t count = idx.field_count();
+
+    size_t field_start = 0;
+    for (size_t i = 0; i < count; ++i) [[likely]] {
+        const size_t eq_pos = idx.equals_positions[i];
+        const size_t field_end = idx.soh_positions[i];
+        if (eq_pos < field_start || eq_pos >= field_end) [[unlikely]] {
+            return std::unexpected{ParseError{
+                ParseErrorCode::InvalidFieldFormat, 0, field_start}};
+        }
+
+        auto tag = parse_tag(ptr, field_start, eq_pos);
+        if (!tag) [[unlikely]] {
+            return std::unexpected{tag.error()};
+        }
+
+        if (!emit(FieldView{*tag, std::span<const char>{
+                ptr + eq_pos + 1, field_end - eq_pos - 1}})) [[unlikely]] {
+            break;
+        }
+        field_start = field_end + 1;  // Skip SOH
+    }
+    return {};
+}
+
+/// Per-field scan: SOH sweep plus find_equals per field
+template <typename Emit>
+[[nodiscard]] NFX_HOT
+ParseResult<void> split_fields_scan(std::span<const char> data, Emit&& emit) noexcept {
+    auto soh_positions = simd::scan_soh(data);
+    const char* __restrict ptr = data.data();
+
+    size_t field_start = 0;
+    for (size_t i = 0; i < soh_positions.count; ++i) [[likely]] {
+        size_t field_end = soh_positions[i];
+
+        // Find '=' separator
+        size_t eq_pos = simd::find_equals(data, field_start);
+        if (eq_pos >= field_end) [[unlikely]] {
+            return std::unexpected{ParseError{
+                ParseErrorCode::InvalidFieldFormat, 0, field_start}};
+        }
+
+        auto tag = parse_tag(ptr, field_start, eq_pos);
+        if (!tag) [[unlikely]] {
+            return std::unexpected{tag.error()};
+        }
+
+        // Create field view (zero-copy)
+        size_t value_start = eq_pos + 1;
+        if (!emit(FieldView{*tag, std::span<const char>{
+                ptr + value_start, field_end - value_start}})) [[unlikely]] {
+            break;
+        }
+
+        field_start = field_end + 1;  // Skip SOH
+    }
+    return {};
+}
+
+/// Field check of an unvalidated assign() (compiles away)
+struct NoFieldCheck {
+    [[nodiscard]] static constexpr bool on_field(const FieldView&, size_t) noexcept { return true; }
+    [[nodiscard]] static constexpr ParseError finish() noexcept { return {}; }
+};
+
+/// Stage 1: SOH and '=' positions in a single SIMD sweep.
+/// A value containing '=' leaves the index unbalanced; those messages
+/// (and any beyond uint16 offsets) take the per-field scan.
+template <typename Emit>
+[[nodiscard]] NFX_HOT
+ParseResult<void> split_fields(std::span<const char> data, Emit&& emit) noexcept {
+    if (data.size() <= UINT16_MAX) [[likely]] {
+        const simd::FIXStructuralIndex idx = simd::build_index(data);
+        if (idx.valid()) [[likely]] {
+            return split_fields_indexed(data, idx, emit);
+        }
+    }
+    return split_fields_scan(data, emit);
+}
+
+/// Stage 2 from an index built beforehand (simd::extend_index());
+/// one that does not cover exactly `data` is rebuilt
+template <typename Emit>
+[[nodiscard]] NFX_HOT
+ParseResult<void> split_fields(std::span<const char> data,
+                               const simd::FIXStructuralIndex* prebuilt,
+                               Emit&& emit) noexcept {
+    if (prebuilt && prebuilt->valid() && prebuilt->message_size == data.size()) [[likely]] {
+        return split_fields_indexed(data, *prebuilt, emit);
+    }
+    return split_fields(data, emit);
+}
+
+} // namespace detail
+
 // ============================================================================
 // Parsed Message (zero-copy reference to original buffer)
 // ============================================================================
 
 /// Zero-copy parsed FIX message
+/// Fields are kept as 6-byte (offset, tag, length) entries relative to
+/// raw(), so 128 fields take 768 bytes instead of 3 KB and a batch of
+/// parsed messages stays in L1; FieldViews are materialized on access.
+/// Like the SOH scanner, offsets are 16-bit: messages and tag numbers
+/// must fit in uint16_t.
 /// Aligned to cache line boundary for optimal memory access
 class alignas(PARSER_CACHE_LINE_SIZE) ParsedMessage {
 public:
     static constexpr size_t MAX_FIELDS = 128;
 
+    static constexpr size_t MAX_MESSAGE_SIZE = UINT16_MAX;
+    static constexpr int MAX_TAG = UINT16_MAX;
+
     constexpr ParsedMessage() noexcept
-        : raw_{}, header_{}, field_count_{0} {}
+        : raw_{}, header_{}, fields_{}, field_count_{0} {}
 
     /// Parse from buffer (zero-copy)
+    /// @tparam Policy ChecksumPolicy::Deferred skips CheckSum verification
+    template <ChecksumPolicy Policy = ChecksumPolicy::Validate>
     [[nodiscard]] NFX_HOT
     static ParseResult<ParsedMessage> parse(
         std::span<const char> data) noexcept
     {
         ParsedMessage msg;
-        msg.raw_ = data;
-
-        // Parse header
-        auto header_result = parse_header(data);
-        if (!header_result.ok()) [[unlikely]] {
-            return std::unexpected{header_result.error};
+        if (auto result = msg.assign<Policy>(data); !result) [[unlikely]] {
+            return std::unexpected{result.error()};
         }
-        msg.header_ = header_result.header;
-
-        // Parse all fields using SIMD-accelerated scanning
-        auto soh_positions = simd::scan_soh(data);
-        const char* __restrict ptr = data.data();
-
-        size_t field_start = 0;
-        for (size_t i = 0; i < soh_positions.count && msg.field_count_ < MAX_FIELDS; ++i) [[likely]] {
-            size_t field_end = soh_positions[i];
-
-            // Find '=' separator
-            size_t eq_pos = simd::find_equals(data, field_start);
-            if (eq_pos >= field_end) [[unlikely]] {
-                return std::unexpected{ParseError{
-                    ParseErrorCode::InvalidFieldFormat, 0, field_start}};
-            }
-
-            // Parse tag number
-            int tag = 0;
-            for (size_t j = field_start; j < eq_pos; ++j) [[likely]] {
-                char c = ptr[j];
-                if (c < '0' || c > '9') [[unlikely]] {
-                    return std::unexpected{ParseError{
-                        ParseErrorCode::InvalidTagNumber, 0, j}};
-                }
-                tag = tag * 10 + (c - '0');
-            }
-
-            // Create field view (zero-copy)
-            size_t value_start = eq_pos + 1;
-            size_t value_len = field_end - value_start;
-
-            msg.fields_[msg.field_count_++] = FieldView{
-                tag,
-                std::span<const char>{ptr + value_start, value_len}
-            };
+        return msg;
+    }
 
-            field_start = field_end + 1;  // Skip SOH
-        }
+    /// Parse into this message (caller-provided storage, no copy out),
+    /// replacing the previous one
+    /// @return Error of parse(); the message then holds no fields
+    template <ChecksumPolicy Policy = ChecksumPolicy::Validate>
+    [[nodiscard]] NFX_HOT
+    ParseResult<void> assign(std::span<const char> data) noexcept {
+        return assign_with<Policy>(data, [](std::span<const char> d) noexcept {
+            return parse_header(d);
+        });
+    }
 
-        // Validate checksum
-        auto checksum_error = validate_checksum(data);
-        if (checksum_error.code != ParseErrorCode::None) [[unlikely]] {
-            return std::unexpected{checksum_error};
-        }
+    /// assign() taking the header along a peer's learned field order
+    /// (HeaderLayout::parse); same result, fewer tag decodes
+    template <ChecksumPolicy Policy = ChecksumPolicy::Validate>
+    [[nodiscard]] NFX_HOT
+    ParseResult<void> assign(std::span<const char> data, HeaderLayout& layout) noexcept {
+        return assign_with<Policy>(data, [&layout](std::span<const char> d) noexcept {
+            return layout.parse(d);
+        });
+    }
 
-        return msg;
+    /// Verify CheckSum (10) after a ChecksumPolicy::Deferred parse
+    [[nodiscard]] ParseError verify_checksum() const noexcept {
+        return nfx::verify_checksum(raw_);
     }
 
     // ========================================================================
@@ -122,6 +282,11 @@ public:
         return header_.msg_seq_num;
     }
 
+    /// Get BeginString
+    [[nodiscard]] constexpr std::string_view begin_string() const noexcept {
+        return header_.begin_string;
+    }
+
     /// Get sender comp ID
     [[nodiscard]] constexpr std::string_view sender_comp_id() const noexcept {
         return header_.sender_comp_id;
@@ -144,14 +309,14 @@ public:
 
     /// Get field by index
     [[nodiscard]] constexpr FieldView field_at(size_t index) const noexcept {
-        return index < field_count_ ? fields_[index] : FieldView{};
+        return index < field_count_ ? view(fields_[index]) : FieldView{};
     }
 
     /// Get field by tag (O(n) linear search)
     [[nodiscard]] constexpr FieldView get_field(int tag) const noexcept {
         for (size_t i = 0; i < field_count_; ++i) {
             if (fields_[i].tag == tag) {
-                return fields_[i];
+                return view(fields_[i]);
             }
         }
         return FieldView{};
@@ -196,19 +361,124 @@ public:
     // Iteration
     // ========================================================================
 
+    /// Wire-order iterator yielding FieldViews by value
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FieldView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = FieldView;
+
+        constexpr const_iterator() noexcept = default;
+
+        constexpr const_iterator(const ParsedMessage* msg, size_t index) noexcept
+            : msg_{msg}, index_{index} {}
+
+        [[nodiscard]] constexpr FieldView operator*() const noexcept {
+            return msg_->view(msg_->fields_[index_]);
+        }
+
+        constexpr const_iterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        constexpr const_iterator operator++(int) noexcept {
+            const_iterator prev = *this;
+            ++index_;
+            return prev;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const const_iterator& other) const noexcept {
+            return index_ == other.index_;
+        }
+
+    private:
+        const ParsedMessage* msg_{nullptr};
+        size_t index_{0};
+    };
+
     /// Iterator for range-based for loops
-    [[nodiscard]] constexpr const FieldView* begin() const noexcept {
-        return fields_.data();
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return const_iterator{this, 0};
     }
 
-    [[nodiscard]] constexpr const FieldView* end() const noexcept {
-        return fields_.data() + field_count_;
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return const_iterator{this, field_count_};
     }
 
 private:
+    template <ChecksumPolicy Policy, typename HeaderFn>
+    [[nodiscard]] NFX_HOT
+    ParseResult<void> assign_with(std::span<const char> data, HeaderFn&& header_fn) noexcept {
+        raw_ = data;
+        field_count_ = 0;
+
+        if (data.size() > MAX_MESSAGE_SIZE) [[unlikely]] {
+            return fail(ParseError{ParseErrorCode::GarbledMessage});
+        }
+
+        // Parse header
+        auto header_result = header_fn(data);
+        if (!header_result.ok()) [[unlikely]] {
+            return fail(header_result.error);
+        }
+        header_ = header_result.header;
+
+        bool tag_overflow = false;
+        ParseResult<void> fields_result = detail::split_fields(
+            data, [this, &tag_overflow](const FieldView& field) noexcept {
+                if (field_count_ >= MAX_FIELDS) [[unlikely]] return false;
+                if (field.tag > MAX_TAG) [[unlikely]] {
+                    tag_overflow = true;
+                    return false;
+                }
+                fields_[field_count_++] = CompactField{
+                    static_cast<uint16_t>(field.value.data() - raw_.data()),
+                    static_cast<uint16_t>(field.tag),
+                    static_cast<uint16_t>(field.value.size())};
+                return true;
+            });
+        if (!fields_result) [[unlikely]] {
+            return fail(fields_result.error());
+        }
+        if (tag_overflow) [[unlikely]] {
+            return fail(ParseError{ParseErrorCode::InvalidTagNumber});
+        }
+
+        // Validate checksum
+        if constexpr (Policy == ChecksumPolicy::Validate) {
+            auto checksum_error = validate_checksum(data);
+            if (checksum_error.code != ParseErrorCode::None) [[unlikely]] {
+                return fail(checksum_error);
+            }
+        }
+        return {};
+    }
+
+    /// Value location relative to raw_
+    struct CompactField {
+        uint16_t offset;
+        uint16_t tag;
+        uint16_t length;
+    };
+
+    static_assert(sizeof(CompactField) == 6, "CompactField should pack into 6 bytes");
+
+    [[nodiscard]] constexpr FieldView view(const CompactField& field) const noexcept {
+        return FieldView{field.tag, raw_.data() + field.offset, field.length};
+    }
+
+    [[nodiscard]] ParseResult<void> fail(const ParseError& error) noexcept {
+        field_count_ = 0;
+        header_ = MessageHeader{};
+        return std::unexpected{error};
+    }
+
     std::span<const char> raw_;
     MessageHeader header_;
-    std::array<FieldView, MAX_FIELDS> fields_;
+    std::array<CompactField, MAX_FIELDS> fields_;
     size_t field_count_;
 };
 
@@ -224,11 +494,12 @@ public:
     StreamParser() noexcept = default;
 
     /// Feed data into parser
-    /// Returns number of bytes consumed
+    /// Returns number of bytes consumed. Stops once MAX_PENDING boundaries
+    /// are queued: drain with next_message() and feed the rest again.
     size_t feed(std::span<const char> data) noexcept {
         size_t consumed = 0;
 
-        while (consumed < data.size()) {
+        while (consumed < data.size() && pending_count_ < MAX_PENDING) {
             // Try to find complete message
             auto remaining = data.subspan(consumed);
             auto boundary = simd::find_message_boundary(remaining);
@@ -238,14 +509,12 @@ public:
             }
 
             // Store message boundary for retrieval
-            if (pending_count_ < MAX_PENDING) {
-                pending_messages_[pending_count_++] = {
-                    consumed + boundary.start,
-                    consumed + boundary.end
-                };
-            }
+            pending_messages_[pending_count_++] = {
+                consumed + boundary.start,
+                consumed + boundary.end
+            };
 
-            consumed = boundary.end;
+            consumed += boundary.end;  // boundary is relative to remaining
         }
 
         return consumed;
@@ -278,85 +547,313 @@ public:
         pending_count_ = 0;
     }
 
-private:
+    /// Boundaries queued by one feed() at most
     static constexpr size_t MAX_PENDING = 16;
 
+private:
+
     std::array<std::pair<size_t, size_t>, MAX_PENDING> pending_messages_;
     size_t pending_count_{0};
 };
 
+// ============================================================================
+// Batched Parsing
+// ============================================================================
+
+namespace detail {
+
+/// Lines of one framed message to request ahead of parsing it (messages
+/// past this keep streaming through the hardware prefetcher)
+inline constexpr size_t PREFETCH_MESSAGE_LINES = 8;
+
+/// Ask for the bytes of a framed message before the parser walks them
+NFX_FORCE_INLINE void prefetch_message(std::span<const char> data,
+                                       const simd::MessageBoundary& boundary) noexcept {
+    const char* p = data.data() + boundary.start;
+    const size_t lines = std::min(PREFETCH_MESSAGE_LINES,
+                                  (boundary.size() + util::CACHE_LINE_SIZE - 1) / util::CACHE_LINE_SIZE);
+    for (size_t i = 0; i < lines; ++i) {
+        util::prefetch_read(p + i * util::CACHE_LINE_SIZE);
+    }
+}
+
+} // namespace detail
+
+/// Result of parse_batch()
+struct BatchParseResult {
+    size_t count{0};        // Messages written to the output span
+    size_t consumed{0};     // Bytes covered by complete messages processed
+    size_t errors{0};       // Complete messages that failed to parse (skipped)
+};
+
+/// Parse every complete message in a receive buffer
+/// Boundaries are found for a whole chunk first, then messages are parsed
+/// back-to-back, so one recv() of many messages pays dispatch once.
+/// Malformed messages are skipped and counted; partial trailing data is
+/// left unconsumed for the next call.
+template <ChecksumPolicy Policy = ChecksumPolicy::Validate>
+[[nodiscard]] NFX_HOT
+inline BatchParseResult parse_batch(
+    std::span<const char> data,
+    std::span<ParsedMessage> out) noexcept
+{
+    static constexpr size_t BOUNDARY_CHUNK = 32;
+
+    BatchParseResult result;
+    std::array<simd::MessageBoundary, BOUNDARY_CHUNK> boundaries;
+
+    while (result.count < out.size()) {
+        // Stage 1: frame the next chunk of messages
+        const size_t want = std::min(BOUNDARY_CHUNK, out.size() - result.count);
+        const size_t found = simd::find_message_boundaries(
+            data.subspan(result.consumed),
+            std::span<simd::MessageBoundary>{boundaries.data(), want});
+        if (found == 0) {
+            break;
+        }
+
+        // Stage 2: parse framed messages back-to-back, the next one's
+        // bytes in flight while this one is parsed
+        const size_t base = result.consumed;
+        const auto chunk = data.subspan(base);
+        for (size_t i = 0; i < found; ++i) {
+            if (i + 1 < found) detail::prefetch_message(chunk, boundaries[i + 1]);
+            auto msg = data.subspan(base + boundaries[i].start,
+                                    boundaries[i].end - boundaries[i].start);
+            if (out[result.count].template assign<Policy>(msg)) [[likely]] {
+                ++result.count;
+            } else {
+                ++result.errors;
+            }
+        }
+        result.consumed = base + boundaries[found - 1].end;
+    }
+
+    return result;
+}
+
+/// Parse and hand out every complete message in a receive buffer as a
+/// three-stage software pipeline, so the cache misses of one message
+/// overlap the work on the one before:
+///   1. frame message N+2 and request its bytes
+///   2. parse message N+1 and call prefetch_state(const ParsedMessage&),
+///      which should request whatever its handler will touch (e.g.
+///      SessionIndex::prefetch_route(), SymbolTable::prefetch())
+///   3. handler(const ParsedMessage&) for message N
+/// Messages are handled in order; malformed ones are skipped and counted;
+/// partial trailing data is left unconsumed. count is messages handled.
+template <ChecksumPolicy Policy = ChecksumPolicy::Validate,
+          typename PrefetchState, typename Handler>
+NFX_HOT
+inline BatchParseResult dispatch_batch(
+    std::span<const char> data,
+    PrefetchState&& prefetch_state,
+    Handler&& handler) noexcept
+{
+    BatchParseResult result;
+    std::array<ParsedMessage, 2> stage;
+    size_t next = 0;                       // Stage slot the next parse fills
+    const ParsedMessage* pending = nullptr; // Parsed, state requested, not handled
+
+    simd::MessageBoundary ahead = simd::find_message_boundary(data, 0);
+    if (ahead.complete) detail::prefetch_message(data, ahead);
+
+    while (ahead.complete) {
+        const simd::MessageBoundary current = ahead;
+        ahead = simd::find_message_boundary(data, current.end);
+        if (ahead.complete) detail::prefetch_message(data, ahead);
+        result.consumed = current.end;
+
+        if (!stage[next].template assign<Policy>(
+                data.subspan(current.start, current.size()))) [[unlikely]] {
+            ++result.errors;
+            continue;
+        }
+        prefetch_state(static_cast<const ParsedMessage&>(stage[next]));
+
+        if (pending) {
+            handler(*pending);
+            ++result.count;
+        }
+        pending = &stage[next];
+        next ^= 1;
+    }
+
+    if (pending) {
+        handler(*pending);
+        ++result.count;
+    }
+    return result;
+}
+
+/// Batched CheckSum verification for messages parsed with
+/// ChecksumPolicy::Deferred (e.g. after the handlers for a burst have run)
+/// @param on_error Called as on_error(index, error) for each failure
+/// @return Number of messages that failed verification
+template <typename OnError>
+[[nodiscard]] inline size_t verify_checksums(
+    std::span<const ParsedMessage> messages,
+    OnError&& on_error) noexcept
+{
+    size_t failures = 0;
+    for (size_t i = 0; i < messages.size(); ++i) {
+        ParseError err = messages[i].verify_checksum();
+        if (err.code != ParseErrorCode::None) [[unlikely]] {
+            ++failures;
+            on_error(i, err);
+        }
+    }
+    return failures;
+}
+
 // ============================================================================
 // Optimized Tag Lookup Parser
 // ============================================================================
 
-/// Parser with O(1) tag lookup using precomputed offset table
-/// Aligned to cache line boundary for optimal memory access
+/// Parser with O(1) tag lookup.
+/// One structural sweep splits the message into a compact field array;
+/// a CompactTagMap maps each tag to its field (custom tags through its
+/// spill table) and the header (8/9/35/34/43/49/52/56/97/122) is read off
+/// that index, so the bytes are scanned once (plus the CheckSum sum).
+/// assign() re-parses in place and forgets the previous message in O(1);
+/// the session layer keeps one parser and hands it to the application.
 class alignas(PARSER_CACHE_LINE_SIZE) IndexedParser {
 public:
     static constexpr size_t MAX_TAG = 512;
+    static constexpr size_t MAX_FIELDS = 255;  // Field indices fit uint8_t
+
+    IndexedParser() noexcept = default;
 
     /// Parse and index all fields for O(1) lookup
+    /// @tparam Policy ChecksumPolicy::Deferred skips CheckSum verification
+    template <ChecksumPolicy Policy = ChecksumPolicy::Validate>
     [[nodiscard]] NFX_HOT
     static ParseResult<IndexedParser> parse(
         std::span<const char> data) noexcept
     {
         IndexedParser parser;
-        parser.raw_ = data;
-
-        // Parse header
-        auto header_result = parse_header(data);
-        if (!header_result.ok()) [[unlikely]] {
-            return std::unexpected{header_result.error};
+        if (auto result = parser.assign<Policy>(data); !result) [[unlikely]] {
+            return std::unexpected{result.error()};
         }
-        parser.header_ = header_result.header;
+        return parser;
+    }
 
-        // Index all fields
-        FieldIterator iter{data};
-        while (iter.has_next()) [[likely]] {
-            FieldView field = iter.next();
-            if (!field.is_valid()) [[unlikely]] break;
+    /// Parse into this parser, replacing the previous message
+    /// @return Error of parse(); the parser then holds no fields
+    template <ChecksumPolicy Policy = ChecksumPolicy::Validate>
+    [[nodiscard]] NFX_HOT
+    ParseResult<void> assign(std::span<const char> data) noexcept {
+        detail::NoFieldCheck check;
+        return assign_checked<Policy>(data, nullptr, check);
+    }
 
-            // Store in lookup table for O(1) access
-            if (field.tag > 0 && static_cast<size_t>(field.tag) < MAX_TAG) [[likely]] {
-                parser.field_table_.set(field.tag, field.value);
-            }
-        }
+    /// Parse with a structural index already built over `data`, e.g. by
+    /// simd::extend_index() as a message arrived in pieces; stage 1 is
+    /// then skipped. An index not covering exactly `data` is rebuilt.
+    template <ChecksumPolicy Policy = ChecksumPolicy::Validate>
+    [[nodiscard]] NFX_HOT
+    ParseResult<void> assign(std::span<const char> data,
+                             const simd::FIXStructuralIndex& index) noexcept {
+        detail::NoFieldCheck check;
+        return assign_checked<Policy>(data, &index, check);
+    }
 
-        // Validate checksum
-        auto checksum_error = validate_checksum(data);
-        if (checksum_error.code != ParseErrorCode::None) [[unlikely]] {
-            return std::unexpected{checksum_error};
-        }
+    /// Parse and validate against a data dictionary in the same pass:
+    /// each field is checked as the structural index is walked
+    /// @return Parse or validation error; the parser then holds no fields
+    template <ChecksumPolicy Policy = ChecksumPolicy::Validate>
+    [[nodiscard]] NFX_HOT
+    ParseResult<void> assign(std::span<const char> data,
+                             const DictionaryValidator& validator) noexcept {
+        DictionaryValidator::Pass check = validator.begin();
+        return assign_checked<Policy>(data, nullptr, check);
+    }
 
-        return parser;
+    /// Prebuilt index and dictionary validation together
+    template <ChecksumPolicy Policy = ChecksumPolicy::Validate>
+    [[nodiscard]] NFX_HOT
+    ParseResult<void> assign(std::span<const char> data,
+                             const simd::FIXStructuralIndex& index,
+                             const DictionaryValidator& validator) noexcept {
+        DictionaryValidator::Pass check = validator.begin();
+        return assign_checked<Policy>(data, &index, check);
+    }
+
+    /// Verify CheckSum (10) after a ChecksumPolicy::Deferred parse
+    [[nodiscard]] ParseError verify_checksum() const noexcept {
+        return nfx::verify_checksum(raw_);
     }
 
     // ========================================================================
     // O(1) Field Access
     // ========================================================================
 
-    /// Get field by tag (O(1) lookup)
+    /// Get field by tag (O(1) lookup, including tags >= MAX_TAG such as
+    /// FIXT's ApplVerID 1128 or user-defined tags, up to the map's spill
+    /// limit; beyond it lookups fall back to a scan).
+    /// A repeated tag yields its last occurrence.
     [[nodiscard]] NFX_HOT FieldView get_field(int tag) const noexcept {
-        return field_table_.get(tag);
+        if (const uint8_t index = index_.get(tag); index != TagMap::INVALID_INDEX) [[likely]] {
+            return fields_[index];
+        }
+        if (!truncated_ && !unindexed_) [[likely]] return FieldView{};
+        return find_unindexed(tag);
     }
 
     /// Check if field exists (O(1))
     [[nodiscard]] NFX_HOT bool has_field(int tag) const noexcept {
-        return field_table_.has(tag);
+        return get_field(tag).is_valid();
     }
 
     [[nodiscard]] NFX_HOT std::string_view get_string(int tag) const noexcept {
-        return field_table_.get_string(tag);
+        return get_field(tag).as_string();
     }
 
     [[nodiscard]] NFX_HOT std::optional<int64_t> get_int(int tag) const noexcept {
-        return field_table_.get_int(tag);
+        return get_field(tag).as_int();
     }
 
     [[nodiscard]] NFX_HOT char get_char(int tag) const noexcept {
-        return field_table_.get_char(tag);
+        return get_field(tag).as_char();
     }
 
+    /// Interned id of a symbol field (lookup only; invalid if not interned)
+    template <size_t MaxSymbols>
+    [[nodiscard]] NFX_HOT SymbolId get_symbol_id(
+        const util::BasicSymbolTable<MaxSymbols>& symbols,
+        int tag = tag::Symbol::value) const noexcept {
+        return symbols.find(get_string(tag));
+    }
+
+    [[nodiscard]] NFX_HOT FixedPrice get_price(int tag) const noexcept {
+        return get_field(tag).as_price();
+    }
+
+    [[nodiscard]] NFX_HOT Qty get_qty(int tag) const noexcept {
+        return get_field(tag).as_qty();
+    }
+
+    /// Value of a typed tag (tag::CustomTag), converted to its declared type
+    /// through the conversion its declared layout selects
+    /// @return nullopt if absent or not convertible
+    template <tag::TypedTag T>
+    [[nodiscard]] NFX_HOT std::optional<typename T::value_type> get() const noexcept {
+        return get_field(T::value).template as<typename T::value_type, tag::tag_layout_t<T>>();
+    }
+
+    // ========================================================================
+    // Field Iteration (wire order)
+    // ========================================================================
+
+    [[nodiscard]] size_t field_count() const noexcept { return field_count_; }
+
+    [[nodiscard]] FieldView field_at(size_t index) const noexcept {
+        return index < field_count_ ? fields_[index] : FieldView{};
+    }
+
+    [[nodiscard]] const FieldView* begin() const noexcept { return fields_.data(); }
+    [[nodiscard]] const FieldView* end() const noexcept { return fields_.data() + field_count_; }
+
     // ========================================================================
     // Header Access
     // ========================================================================
@@ -373,6 +870,11 @@ public:
         return header_.msg_type;
     }
 
+    /// Full MsgType (35), including multi-character types such as "AE"
+    [[nodiscard]] std::string_view msg_type_str() const noexcept {
+        return get_string(tag::MsgType::value);
+    }
+
     [[nodiscard]] uint32_t msg_seq_num() const noexcept {
         return header_.msg_seq_num;
     }
@@ -424,11 +926,144 @@ public:
     }
 
 private:
-    IndexedParser() noexcept = default;
+    using TagMap = CompactTagMap<MAX_TAG>;
 
-    std::span<const char> raw_;
-    MessageHeader header_;
-    FieldTable<MAX_TAG> field_table_;
+    /// Forget the previous message (a generation bump, not a table wipe)
+    void reset() noexcept {
+        index_.clear();
+        field_count_ = 0;
+        truncated_ = false;
+        unindexed_ = false;
+        header_ = MessageHeader{};
+    }
+
+    [[nodiscard]] ParseResult<void> fail(const ParseError& error) noexcept {
+        reset();
+        return std::unexpected{error};
+    }
+
+    /// assign() body; Check sees every field as it is split
+    template <ChecksumPolicy Policy, typename Check>
+    [[nodiscard]] NFX_HOT
+    ParseResult<void> assign_checked(std::span<const char> data,
+                                     const simd::FIXStructuralIndex* index,
+                                     Check& check) noexcept {
+        reset();
+        raw_ = data;
+
+        if (data.size() < fix::MIN_MESSAGE_SIZE) [[unlikely]] {
+            return fail(ParseError{ParseErrorCode::BufferTooShort});
+        }
+
+        auto fields_result = detail::split_fields(
+            data, index, [this, &check, base = data.data()](const FieldView& field) noexcept {
+                if (!check.on_field(field, static_cast<size_t>(field.value.data() - base)))
+                    [[unlikely]] {
+                    return false;
+                }
+                if (field_count_ >= MAX_FIELDS) [[unlikely]] {
+                    truncated_ = true;
+                    return false;
+                }
+                fields_[field_count_] = field;
+                if (!index_.set(field.tag, static_cast<uint8_t>(field_count_))) [[unlikely]] {
+                    unindexed_ = true;
+                }
+                ++field_count_;
+                return true;
+            });
+        if (!fields_result) [[unlikely]] {
+            return fail(fields_result.error());
+        }
+
+        if (ParseError err = extract_header(); err.code != ParseErrorCode::None) [[unlikely]] {
+            return fail(err);
+        }
+
+        if constexpr (Policy == ChecksumPolicy::Validate) {
+            auto checksum_error = validate_checksum(data);
+            if (checksum_error.code != ParseErrorCode::None) [[unlikely]] {
+                return fail(checksum_error);
+            }
+        }
+
+        if (ParseError err = check.finish(); err.code != ParseErrorCode::None) [[unlikely]] {
+            return fail(err);
+        }
+        return {};
+    }
+
+    /// Session header straight from the slot table (same checks as parse_header)
+    [[nodiscard]] NFX_HOT ParseError extract_header() noexcept {
+        header_.begin_string = get_string(tag::BeginString::value);
+        if (const FieldView body_length = get_field(tag::BodyLength::value);
+            body_length.is_valid()) [[likely]] {
+            const auto val = body_length.as_int();
+            if (!val) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidBodyLength, tag::BodyLength::value};
+            }
+            header_.body_length = static_cast<int>(*val);
+        }
+        header_.msg_type = get_char(tag::MsgType::value);
+        header_.sender_comp_id = get_string(tag::SenderCompID::value);
+        header_.target_comp_id = get_string(tag::TargetCompID::value);
+        if (const FieldView seq = get_field(tag::MsgSeqNum::value); seq.is_valid()) [[likely]] {
+            const auto val = seq.as_uint();
+            if (!val) [[unlikely]] {
+                return ParseError{ParseErrorCode::InvalidFieldFormat, tag::MsgSeqNum::value};
+            }
+            header_.msg_seq_num = static_cast<uint32_t>(*val);
+        }
+        header_.sending_time = get_string(tag::SendingTime::value);
+        header_.poss_dup_flag = get_field(tag::PossDupFlag::value).as_bool();
+        header_.poss_resend = get_field(tag::PossResend::value).as_bool();
+        header_.orig_sending_time = get_string(tag::OrigSendingTime::value);
+
+        if (header_.begin_string.empty()) [[unlikely]] {
+            return ParseError{ParseErrorCode::MissingRequiredField, tag::BeginString::value};
+        }
+        if (header_.body_length == 0) [[unlikely]] {
+            return ParseError{ParseErrorCode::MissingRequiredField, tag::BodyLength::value};
+        }
+        if (header_.msg_type == '\0') [[unlikely]] {
+            return ParseError{ParseErrorCode::MissingRequiredField, tag::MsgType::value};
+        }
+        if (header_.sender_comp_id.empty()) [[unlikely]] {
+            return ParseError{ParseErrorCode::MissingRequiredField, tag::SenderCompID::value};
+        }
+        if (header_.target_comp_id.empty()) [[unlikely]] {
+            return ParseError{ParseErrorCode::MissingRequiredField, tag::TargetCompID::value};
+        }
+        if (header_.msg_seq_num == 0) [[unlikely]] {
+            return ParseError{ParseErrorCode::MissingRequiredField, tag::MsgSeqNum::value};
+        }
+        return ParseError{};
+    }
+
+    /// First occurrence of a tag the index could not hold: the field array,
+    /// then the raw bytes past it when the message exceeded MAX_FIELDS
+    [[nodiscard]] FieldView find_unindexed(int tag) const noexcept {
+        for (size_t i = 0; i < field_count_; ++i) {
+            if (fields_[i].tag == tag) return fields_[i];
+        }
+        if (!truncated_) return FieldView{};
+
+        FieldIterator iter{raw_};
+        while (iter.has_next()) {
+            FieldView field = iter.next();
+            if (!field.is_valid()) break;
+            if (field.tag == tag) return field;
+        }
+        return FieldView{};
+    }
+
+    std::span<const char> raw_{};
+    MessageHeader header_{};
+    size_t field_count_{0};
+    bool truncated_{false};                    // More than MAX_FIELDS fields
+    bool unindexed_{false};                    // Spill table overflowed
+    TagMap index_{};                           // tag -> field index
+    std::array<FieldView, MAX_FIELDS> fields_{};
 };
 
 // ============================================================================
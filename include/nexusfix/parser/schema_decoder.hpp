@@ -0,0 +1,231 @@
+#pragma once
+
+/// @file schema_decoder.hpp
+/// @brief Schema-driven single-pass decoding into typed message structs
+///
+/// A message type declares a FieldSchema: a list of FieldBinding entries
+/// mapping tags to (possibly nested) data members. decode<T>() walks the
+/// message once and writes each field straight into its member, converted
+/// to the member's type (FixedPrice, Qty, char enums, ...). The tag dispatch
+/// is a fold over the bindings, lowered by the compiler to a switch; there
+/// is no intermediate FieldView array and no per-tag lookup afterwards.
+
+#include <array>
+#include <concepts>
+#include <span>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/parser/field_view.hpp"
+#include "nexusfix/parser/consteval_parser.hpp"
+#include "nexusfix/parser/structural_index.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Field Binding
+// ============================================================================
+
+namespace detail {
+
+/// Follow a member pointer chain: resolve<&A::b, &B::c>(a) == a.b.c
+template <auto Member, auto... Rest, typename Obj>
+[[nodiscard]] constexpr auto& resolve_member(Obj& obj) noexcept {
+    if constexpr (sizeof...(Rest) == 0) {
+        return obj.*Member;
+    } else {
+        return resolve_member<Rest...>(obj.*Member);
+    }
+}
+
+/// Convert a field value into the member's type (see FieldView::as());
+/// a value that does not convert leaves the member unchanged
+template <typename M>
+constexpr void store_field(M& out, FieldView field) noexcept {
+    if (auto v = field.as<M>()) {
+        out = *v;
+    }
+}
+
+} // namespace detail
+
+/// Binds a tag to a data member reached through a member pointer chain
+template <int Tag, FieldRequirement Req, auto... Path>
+struct FieldBinding {
+    static_assert(sizeof...(Path) > 0, "FieldBinding needs a member pointer");
+
+    static constexpr int tag = Tag;
+    static constexpr bool is_required = (Req == FieldRequirement::Required);
+    using spec = FieldSpec<Tag, Req>;
+
+    template <typename T>
+    NFX_FORCE_INLINE static constexpr void assign(T& msg, FieldView field) noexcept {
+        detail::store_field(detail::resolve_member<Path...>(msg), field);
+    }
+};
+
+template <int Tag, auto... Path>
+using RequiredField = FieldBinding<Tag, FieldRequirement::Required, Path...>;
+
+template <int Tag, auto... Path>
+using OptionalField = FieldBinding<Tag, FieldRequirement::Optional, Path...>;
+
+// ============================================================================
+// Decode Schema
+// ============================================================================
+
+/// Compile-time set of bindings for one message type
+template <typename... Bindings>
+struct DecodeSchema {
+    static constexpr size_t field_count = sizeof...(Bindings);
+    static_assert(field_count <= 64, "DecodeSchema tracks presence in a 64-bit mask");
+
+    /// Equivalent validation schema (for SchemaValidator and friends)
+    using Schema = MessageSchema<typename Bindings::spec...>;
+
+    /// Bit per required binding
+    static constexpr uint64_t required_mask = [] {
+        uint64_t mask = 0;
+        size_t i = 0;
+        ((mask |= Bindings::is_required ? (uint64_t{1} << i) : 0, ++i), ...);
+        return mask;
+    }();
+
+    /// Store field into its bound member
+    /// @return Presence bit of the binding, or 0 if the tag is not in the schema
+    template <typename T>
+    [[nodiscard]] NFX_HOT
+    static constexpr uint64_t dispatch(T& msg, FieldView field) noexcept {
+        return dispatch_impl(msg, field, std::index_sequence_for<Bindings...>{});
+    }
+
+    /// First required tag absent from the presence mask (0 if complete)
+    [[nodiscard]] static constexpr int first_missing(uint64_t seen) noexcept {
+        const uint64_t missing = required_mask & ~seen;
+        if (missing == 0) [[likely]] return 0;
+
+        constexpr std::array<int, field_count> tags{Bindings::tag...};
+        for (size_t i = 0; i < field_count; ++i) {
+            if (missing & (uint64_t{1} << i)) return tags[i];
+        }
+        return 0;
+    }
+
+private:
+    template <typename T, size_t... I>
+    NFX_FORCE_INLINE static constexpr uint64_t dispatch_impl(
+        T& msg, FieldView field, std::index_sequence<I...>) noexcept
+    {
+        uint64_t bit = 0;
+        (void)((field.tag == Bindings::tag
+                    ? (Bindings::assign(msg, field), bit = uint64_t{1} << I, true)
+                    : false) || ...);
+        return bit;
+    }
+};
+
+// ============================================================================
+// Single-pass Decode
+// ============================================================================
+
+/// How much of the schema decode<T>() enforces
+enum class SchemaCheck : uint8_t {
+    Required,   // Every required binding present (default)
+    Strict      // Also rejects a schema tag that appears twice (DuplicateTag)
+};
+
+/// Message types decodable from a schema
+template <typename T>
+concept SchemaDecodable = requires(T msg) {
+    typename T::FieldSchema;
+    { T::MSG_TYPE } -> std::convertible_to<char>;
+    msg.header.msg_type;
+    msg.raw_data;
+};
+
+/// Decode a message into T in a single pass over its fields
+/// Fields outside T::FieldSchema (including the trailer) are skipped.
+/// Validation rides on the same pass: each binding sets a presence bit, so
+/// Strict duplicate detection costs one AND per field and the required
+/// check one AND/compare at the end.
+template <SchemaDecodable T, SchemaCheck Check = SchemaCheck::Required>
+[[nodiscard]] NFX_HOT
+inline ParseResult<T> decode(std::span<const char> data) noexcept {
+    using Schema = typename T::FieldSchema;
+
+    if (data.size() < fix::MIN_MESSAGE_SIZE) [[unlikely]] {
+        return std::unexpected{ParseError{ParseErrorCode::BufferTooShort}};
+    }
+
+    T msg;
+    msg.raw_data = data;
+    uint64_t seen = 0;
+
+    // Fields from the structural index; a value containing '=' leaves the
+    // index unbalanced (and a full index may be truncated), in which case
+    // fall back to the field iterator
+    const char* ptr = data.data();
+    const simd::FIXStructuralIndex idx = data.size() <= UINT16_MAX
+        ? simd::build_index(data) : simd::FIXStructuralIndex{};
+
+    if (idx.valid() && idx.field_count() < simd::MAX_FIELDS) [[likely]] {
+        size_t field_start = 0;
+        for (size_t i = 0; i < idx.field_count(); ++i) {
+            const size_t eq = idx.equals_positions[i];
+            const size_t end = idx.soh_positions[i];
+            if (eq < field_start || eq >= end) [[unlikely]] {
+                return std::unexpected{ParseError{
+                    ParseErrorCode::InvalidFieldFormat, 0, field_start}};
+            }
+            const int tag = simd::decode_tag(ptr, field_start, eq);
+            const uint64_t bit = Schema::dispatch(msg, FieldView{
+                tag, std::span<const char>{ptr + eq + 1, end - eq - 1}});
+            if constexpr (Check == SchemaCheck::Strict) {
+                if (seen & bit) [[unlikely]] {
+                    return std::unexpected{ParseError{ParseErrorCode::DuplicateTag, tag, field_start}};
+                }
+            }
+            seen |= bit;
+            field_start = end + 1;
+        }
+    } else {
+        FieldIterator iter{data};
+        while (iter.has_next()) {
+            FieldView field = iter.next();
+            if (!field.is_valid()) [[unlikely]] {
+                return std::unexpected{ParseError{
+                    ParseErrorCode::InvalidFieldFormat, 0, iter.position()}};
+            }
+            const uint64_t bit = Schema::dispatch(msg, field);
+            if constexpr (Check == SchemaCheck::Strict) {
+                if (seen & bit) [[unlikely]] {
+                    return std::unexpected{ParseError{ParseErrorCode::DuplicateTag, field.tag}};
+                }
+            }
+            seen |= bit;
+        }
+    }
+
+    if (int missing = Schema::first_missing(seen); missing != 0) [[unlikely]] {
+        return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, missing}};
+    }
+
+    if (msg.header.msg_type != T::MSG_TYPE) [[unlikely]] {
+        return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType}};
+    }
+
+    auto checksum_error = validate_checksum(data);
+    if (checksum_error.code != ParseErrorCode::None) [[unlikely]] {
+        return std::unexpected{checksum_error};
+    }
+
+    return msg;
+}
+
+} // namespace nfx
@@ -8,18 +8,22 @@
     - Scalar: ~0.5 bytes/cycle
     - AVX2:   ~16 bytes/cycle (32x improvement)
     - AVX-512: ~32 bytes/cycle (64x improvement)
+    - ARM64: NEON (4 x 16-byte accumulators), SVE2 (vector-length agnostic)
 
     The checksum is computed over all bytes from tag 8 to the SOH before tag 10.
 */
 
 #pragma once
 
+#include <bit>
 #include <cstdint>
 #include <cstddef>
+#include <mutex>
 #include <string_view>
 #include <span>
 
 #include "nexusfix/platform/platform.hpp"
+#include "nexusfix/parser/simd_dispatch.hpp"
 
 // SIMD headers
 #if defined(NFX_HAS_XSIMD) && NFX_HAS_XSIMD
@@ -43,6 +47,23 @@
     #define NFX_SSE2_CHECKSUM 1
 #endif
 
+// Kernels above the build baseline are compiled per function (raw
+// intrinsics only) and selected at runtime from CPUID
+#if !(defined(NFX_HAS_XSIMD) && NFX_HAS_XSIMD) && NFX_HAS_SIMD_TARGETS && \
+    !defined(NFX_AVX512_CHECKSUM)
+    #include <immintrin.h>
+    #define NFX_CHECKSUM_DISPATCH 1
+#else
+    #define NFX_CHECKSUM_DISPATCH 0
+#endif
+
+// ARM64 kernels: NEON always, SVE2 in armv9 builds; picked at run time
+#if NFX_HAS_NEON
+    #define NFX_CHECKSUM_ARM 1
+#else
+    #define NFX_CHECKSUM_ARM 0
+#endif
+
 namespace nfx::parser {
 
 // ============================================================================
@@ -131,7 +152,8 @@ inline uint8_t checksum_avx512(const char* data, size_t len) noexcept {
 // SSE2 Checksum (128-bit, raw intrinsics)
 // ============================================================================
 
-#if defined(NFX_SSE2_CHECKSUM) || defined(NFX_AVX2_CHECKSUM) || defined(NFX_AVX512_CHECKSUM)
+#if defined(NFX_SSE2_CHECKSUM) || defined(NFX_AVX2_CHECKSUM) || defined(NFX_AVX512_CHECKSUM) || \
+    NFX_CHECKSUM_DISPATCH
 
 /// SSE2 checksum - processes 16 bytes at a time
 [[nodiscard]] NFX_HOT
@@ -171,10 +193,10 @@ inline uint8_t checksum_sse2(const char* data, size_t len) noexcept {
 // AVX2 Checksum (256-bit, raw intrinsics)
 // ============================================================================
 
-#if defined(NFX_AVX2_CHECKSUM) || defined(NFX_AVX512_CHECKSUM)
+#if defined(NFX_AVX2_CHECKSUM) || defined(NFX_AVX512_CHECKSUM) || NFX_CHECKSUM_DISPATCH
 
 /// AVX2 checksum - processes 32 bytes at a time
-[[nodiscard]] NFX_HOT
+[[nodiscard]] NFX_HOT NFX_TARGET_AVX2
 inline uint8_t checksum_avx2(const char* data, size_t len) noexcept {
     const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data);
 
@@ -216,10 +238,10 @@ inline uint8_t checksum_avx2(const char* data, size_t len) noexcept {
 // AVX-512 Checksum (512-bit, raw intrinsics)
 // ============================================================================
 
-#if defined(NFX_AVX512_CHECKSUM)
+#if defined(NFX_AVX512_CHECKSUM) || NFX_CHECKSUM_DISPATCH
 
 /// AVX-512 checksum - processes 64 bytes at a time
-[[nodiscard]] NFX_HOT
+[[nodiscard]] NFX_HOT NFX_TARGET_AVX512
 inline uint8_t checksum_avx512(const char* data, size_t len) noexcept {
     const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data);
 
@@ -236,9 +258,17 @@ inline uint8_t checksum_avx512(const char* data, size_t len) noexcept {
         sum = _mm512_add_epi64(sum, sad);
     }
 
-    // Reduce 512-bit to scalar
-    // Sum all 8 64-bit lanes
-    uint64_t total = _mm512_reduce_add_epi64(sum);
+    // Reduce 512-bit to scalar: sum all 8 64-bit lanes
+    // (zero-masked extracts: _mm512_reduce_add_epi64 trips GCC's
+    // -Wuninitialized when built through a target attribute)
+    __m256i sum256 = _mm256_add_epi64(
+        _mm512_maskz_extracti64x4_epi64(0xFF, sum, 0),
+        _mm512_maskz_extracti64x4_epi64(0xFF, sum, 1));
+    __m128i sum128 = _mm_add_epi64(
+        _mm256_castsi256_si128(sum256),
+        _mm256_extracti128_si256(sum256, 1));
+    sum128 = _mm_add_epi64(sum128, _mm_unpackhi_epi64(sum128, sum128));
+    uint64_t total = static_cast<uint64_t>(_mm_cvtsi128_si64(sum128));
 
     // Process remaining bytes
     for (; i < len; ++i) {
@@ -252,14 +282,133 @@ inline uint8_t checksum_avx512(const char* data, size_t len) noexcept {
 
 #endif  // NFX_HAS_XSIMD
 
+#if NFX_CHECKSUM_ARM
+
+// ============================================================================
+// ARM NEON / SVE2 Checksum
+// ============================================================================
+// Byte lanes wrap mod 256, which is all the checksum keeps, so no widening
+
+/// NEON checksum: four independent accumulators hide the add latency
+[[nodiscard]] NFX_HOT
+inline uint8_t checksum_neon(const char* data, size_t len) noexcept {
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data);
+    uint8x16_t acc0 = vdupq_n_u8(0);
+    uint8x16_t acc1 = vdupq_n_u8(0);
+    uint8x16_t acc2 = vdupq_n_u8(0);
+    uint8x16_t acc3 = vdupq_n_u8(0);
+
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        acc0 = vaddq_u8(acc0, vld1q_u8(ptr + i));
+        acc1 = vaddq_u8(acc1, vld1q_u8(ptr + i + 16));
+        acc2 = vaddq_u8(acc2, vld1q_u8(ptr + i + 32));
+        acc3 = vaddq_u8(acc3, vld1q_u8(ptr + i + 48));
+    }
+    for (; i + 16 <= len; i += 16) {
+        acc0 = vaddq_u8(acc0, vld1q_u8(ptr + i));
+    }
+
+    uint8_t sum = vaddvq_u8(vaddq_u8(vaddq_u8(acc0, acc1), vaddq_u8(acc2, acc3)));
+    for (; i < len; ++i) sum += ptr[i];
+    return sum;
+}
+
+#if NFX_HAS_SVE2
+
+/// SVE2 checksum: predicated loop, no scalar tail
+[[nodiscard]] NFX_HOT
+inline uint8_t checksum_sve2(const char* data, size_t len) noexcept {
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data);
+    svuint8_t acc = svdup_n_u8(0);
+    for (uint64_t i = 0; i < len; i += svcntb()) {
+        const svbool_t pg = svwhilelt_b8_u64(i, len);
+        acc = svadd_u8_m(pg, acc, svld1_u8(pg, ptr + i));
+    }
+    return static_cast<uint8_t>(svaddv_u8(svptrue_b8(), acc));
+}
+
+#endif  // NFX_HAS_SVE2
+
+#endif  // NFX_CHECKSUM_ARM
+
 // ============================================================================
 // Auto-Dispatch Checksum
 // ============================================================================
 
+#if NFX_CHECKSUM_DISPATCH || NFX_CHECKSUM_ARM
+
+namespace detail {
+
+/// Tiers compiled into this binary, ascending (x86: Scalar = SSE2 baseline)
+inline constexpr simd::SimdImpl CHECKSUM_IMPLS[] = {
+    simd::SimdImpl::Scalar,
+#if NFX_CHECKSUM_DISPATCH
+    simd::SimdImpl::AVX2,
+    simd::SimdImpl::AVX512,
+#endif
+#if NFX_CHECKSUM_ARM
+    simd::SimdImpl::NEON,
+#endif
+#if NFX_CHECKSUM_ARM && NFX_HAS_SVE2
+    simd::SimdImpl::SVE2,
+#endif
+};
+
+inline simd::SimdImpl g_checksum_impl = simd::SimdImpl::Scalar;
+inline bool g_checksum_initialized = false;
+
+}  // namespace detail
+
+/// Initialize checksum dispatch from CPUID (called lazily on first use)
+/// NFX_SIMD_IMPL caps the selected tier (for testing).
+inline void init_checksum_dispatch() noexcept {
+    static std::once_flag flag;
+    std::call_once(flag, []() {
+        detail::g_checksum_impl = simd::select_simd_impl(detail::CHECKSUM_IMPLS);
+        detail::g_checksum_initialized = true;
+    });
+}
+
+#endif  // NFX_CHECKSUM_DISPATCH || NFX_CHECKSUM_ARM
+
+/// Get current checksum implementation
+[[nodiscard]] NFX_FORCE_INLINE simd::SimdImpl active_checksum_impl() noexcept {
+#if NFX_CHECKSUM_DISPATCH || NFX_CHECKSUM_ARM
+    if (!detail::g_checksum_initialized) [[unlikely]] {
+        init_checksum_dispatch();
+    }
+    return detail::g_checksum_impl;
+#elif defined(NFX_AVX512_CHECKSUM)
+    return simd::SimdImpl::AVX512;
+#elif defined(NFX_AVX2_CHECKSUM)
+    return simd::SimdImpl::AVX2;
+#else
+    return simd::SimdImpl::Scalar;
+#endif
+}
+
 /// Automatically select best checksum implementation
 [[nodiscard]] NFX_HOT
 inline uint8_t checksum(const char* data, size_t len) noexcept {
-#if defined(NFX_AVX512_CHECKSUM)
+#if NFX_CHECKSUM_DISPATCH
+    switch (active_checksum_impl()) {
+        case simd::SimdImpl::AVX512:
+        case simd::SimdImpl::AVX512_VBMI2:
+            return checksum_avx512(data, len);
+        case simd::SimdImpl::AVX2:
+            return checksum_avx2(data, len);
+        default:
+            break;
+    }
+    return checksum_sse2(data, len);
+#elif NFX_CHECKSUM_ARM
+#if NFX_HAS_SVE2
+    if (active_checksum_impl() == simd::SimdImpl::SVE2) return checksum_sve2(data, len);
+#endif
+    if (active_checksum_impl() == simd::SimdImpl::NEON) [[likely]] return checksum_neon(data, len);
+    return checksum_scalar(data, len);
+#elif defined(NFX_AVX512_CHECKSUM)
     return checksum_avx512(data, len);
 #elif defined(NFX_AVX2_CHECKSUM)
     return checksum_avx2(data, len);
@@ -282,6 +431,255 @@ inline uint8_t checksum(std::span<const char> data) noexcept {
     return checksum(data.data(), data.size());
 }
 
+// ============================================================================
+// Fused Copy + Checksum
+// ============================================================================
+// Store and forward paths copy a message and then sum it; these kernels
+// do both in one pass, so each byte is loaded once. dst and src must not
+// overlap (memcpy rules). Wider than 256 bits buys nothing at message
+// sizes, so AVX-512 machines run the AVX2 kernel.
+
+/// Scalar copy + checksum - baseline for comparison
+[[nodiscard]] NFX_NO_INLINE
+inline uint8_t copy_checksum_scalar(char* dst, const char* src, size_t len) noexcept {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < len; ++i) {
+        dst[i] = src[i];
+        sum += static_cast<uint8_t>(src[i]);
+    }
+    return static_cast<uint8_t>(sum & 0xFF);
+}
+
+#if defined(NFX_HAS_XSIMD) && NFX_HAS_XSIMD
+
+namespace detail {
+
+/// Arch-templated copy + checksum (uint8_t lanes, see checksum_xsimd)
+template <typename Arch>
+[[nodiscard]] NFX_HOT
+inline uint8_t copy_checksum_xsimd(char* dst, const char* src, size_t len) noexcept {
+    using batch_t = xsimd::batch<uint8_t, Arch>;
+    constexpr size_t width = batch_t::size;
+    const auto* in = reinterpret_cast<const uint8_t*>(src);
+    auto* out = reinterpret_cast<uint8_t*>(dst);
+
+    batch_t acc(uint8_t(0));
+    size_t i = 0;
+    for (; i + width <= len; i += width) {
+        const batch_t chunk = xsimd::load_unaligned<Arch>(in + i);
+        chunk.store_unaligned(out + i);
+        acc = acc + chunk;
+    }
+    uint8_t sum = xsimd::reduce_add(acc);
+    for (; i < len; ++i) {
+        out[i] = in[i];
+        sum += in[i];
+    }
+    return sum;
+}
+
+}  // namespace detail
+
+#if defined(NFX_SSE2_CHECKSUM) || defined(NFX_AVX2_CHECKSUM) || defined(NFX_AVX512_CHECKSUM)
+
+/// SSE2 copy + checksum - 16 bytes at a time
+[[nodiscard]] NFX_HOT
+inline uint8_t copy_checksum_sse2(char* dst, const char* src, size_t len) noexcept {
+    return detail::copy_checksum_xsimd<xsimd::sse2>(dst, src, len);
+}
+
+#endif
+
+#if defined(NFX_AVX2_CHECKSUM) || defined(NFX_AVX512_CHECKSUM)
+
+/// AVX2 copy + checksum - 32 bytes at a time
+[[nodiscard]] NFX_HOT
+inline uint8_t copy_checksum_avx2(char* dst, const char* src, size_t len) noexcept {
+    return detail::copy_checksum_xsimd<xsimd::avx2>(dst, src, len);
+}
+
+#endif
+
+#else  // !NFX_HAS_XSIMD - Raw intrinsics fallback
+
+#if defined(NFX_SSE2_CHECKSUM) || defined(NFX_AVX2_CHECKSUM) || defined(NFX_AVX512_CHECKSUM) || \
+    NFX_CHECKSUM_DISPATCH
+
+/// SSE2 copy + checksum - stores each chunk and feeds it to SAD
+[[nodiscard]] NFX_HOT
+inline uint8_t copy_checksum_sse2(char* dst, const char* src, size_t len) noexcept {
+    const auto* in = reinterpret_cast<const uint8_t*>(src);
+    auto* out = reinterpret_cast<uint8_t*>(dst);
+
+    __m128i sum = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), chunk);
+        sum = _mm_add_epi64(sum, _mm_sad_epu8(chunk, _mm_setzero_si128()));
+    }
+
+    __m128i hi = _mm_unpackhi_epi64(sum, sum);
+    sum = _mm_add_epi64(sum, hi);
+    uint64_t total = static_cast<uint64_t>(_mm_cvtsi128_si64(sum));
+
+    for (; i < len; ++i) {
+        out[i] = in[i];
+        total += in[i];
+    }
+
+    return static_cast<uint8_t>(total & 0xFF);
+}
+
+#endif
+
+#if defined(NFX_AVX2_CHECKSUM) || defined(NFX_AVX512_CHECKSUM) || NFX_CHECKSUM_DISPATCH
+
+/// AVX2 copy + checksum - 32 bytes at a time
+[[nodiscard]] NFX_HOT NFX_TARGET_AVX2
+inline uint8_t copy_checksum_avx2(char* dst, const char* src, size_t len) noexcept {
+    const auto* in = reinterpret_cast<const uint8_t*>(src);
+    auto* out = reinterpret_cast<uint8_t*>(dst);
+
+    __m256i sum = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), chunk);
+        sum = _mm256_add_epi64(sum, _mm256_sad_epu8(chunk, _mm256_setzero_si256()));
+    }
+
+    __m128i sum128 = _mm_add_epi64(
+        _mm256_castsi256_si128(sum),
+        _mm256_extracti128_si256(sum, 1)
+    );
+    __m128i hi = _mm_unpackhi_epi64(sum128, sum128);
+    sum128 = _mm_add_epi64(sum128, hi);
+    uint64_t total = static_cast<uint64_t>(_mm_cvtsi128_si64(sum128));
+
+    for (; i < len; ++i) {
+        out[i] = in[i];
+        total += in[i];
+    }
+
+    return static_cast<uint8_t>(total & 0xFF);
+}
+
+#endif
+
+#endif  // NFX_HAS_XSIMD
+
+#if NFX_CHECKSUM_ARM
+
+/// NEON copy + checksum (byte lanes wrap mod 256, as in checksum_neon)
+[[nodiscard]] NFX_HOT
+inline uint8_t copy_checksum_neon(char* dst, const char* src, size_t len) noexcept {
+    const auto* in = reinterpret_cast<const uint8_t*>(src);
+    auto* out = reinterpret_cast<uint8_t*>(dst);
+    uint8x16_t acc0 = vdupq_n_u8(0);
+    uint8x16_t acc1 = vdupq_n_u8(0);
+
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        const uint8x16_t a = vld1q_u8(in + i);
+        const uint8x16_t b = vld1q_u8(in + i + 16);
+        vst1q_u8(out + i, a);
+        vst1q_u8(out + i + 16, b);
+        acc0 = vaddq_u8(acc0, a);
+        acc1 = vaddq_u8(acc1, b);
+    }
+    for (; i + 16 <= len; i += 16) {
+        const uint8x16_t a = vld1q_u8(in + i);
+        vst1q_u8(out + i, a);
+        acc0 = vaddq_u8(acc0, a);
+    }
+
+    uint8_t sum = vaddvq_u8(vaddq_u8(acc0, acc1));
+    for (; i < len; ++i) {
+        out[i] = in[i];
+        sum += in[i];
+    }
+    return sum;
+}
+
+#endif  // NFX_CHECKSUM_ARM
+
+/// Copy len bytes from src to dst and return their checksum
+[[nodiscard]] NFX_HOT
+inline uint8_t copy_checksum(char* dst, const char* src, size_t len) noexcept {
+#if NFX_CHECKSUM_DISPATCH
+    switch (active_checksum_impl()) {
+        case simd::SimdImpl::AVX512:
+        case simd::SimdImpl::AVX512_VBMI2:
+        case simd::SimdImpl::AVX2:
+            return copy_checksum_avx2(dst, src, len);
+        default:
+            break;
+    }
+    return copy_checksum_sse2(dst, src, len);
+#elif NFX_CHECKSUM_ARM
+    if (active_checksum_impl() != simd::SimdImpl::Scalar) [[likely]] {
+        return copy_checksum_neon(dst, src, len);
+    }
+    return copy_checksum_scalar(dst, src, len);
+#elif defined(NFX_AVX512_CHECKSUM) || defined(NFX_AVX2_CHECKSUM)
+    return copy_checksum_avx2(dst, src, len);
+#elif defined(NFX_SSE2_CHECKSUM)
+    return copy_checksum_sse2(dst, src, len);
+#else
+    return copy_checksum_scalar(dst, src, len);
+#endif
+}
+
+/// Result of copy_checksum_soh()
+struct CopyScan {
+    uint8_t checksum{0};        // Sum of all copied bytes mod 256
+    uint32_t soh_count{0};      // SOH offsets written (at most soh.size())
+};
+
+/// Copy + checksum that also records the offsets of the first soh.size()
+/// SOH bytes, i.e. the ends of the leading fields. Once soh is full the
+/// rest of the message goes through copy_checksum().
+[[nodiscard]] NFX_HOT
+inline CopyScan copy_checksum_soh(char* dst, const char* src, size_t len,
+                                  std::span<uint32_t> soh) noexcept {
+    const auto* in = reinterpret_cast<const uint8_t*>(src);
+    auto* out = reinterpret_cast<uint8_t*>(dst);
+    const size_t cap = soh.size();
+    uint64_t total = 0;
+    uint32_t n = 0;
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i soh_byte = _mm_set1_epi8(0x01);
+    __m128i sum = _mm_setzero_si128();
+    for (; n < cap && i + 16 <= len; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), chunk);
+        sum = _mm_add_epi64(sum, _mm_sad_epu8(chunk, _mm_setzero_si128()));
+
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, soh_byte)));
+        while (mask != 0 && n < cap) {
+            soh[n++] = static_cast<uint32_t>(i) + static_cast<uint32_t>(std::countr_zero(mask));
+            mask &= mask - 1;
+        }
+    }
+    sum = _mm_add_epi64(sum, _mm_unpackhi_epi64(sum, sum));
+    total = static_cast<uint64_t>(_mm_cvtsi128_si64(sum));
+#endif
+
+    for (; n < cap && i < len; ++i) {
+        out[i] = in[i];
+        total += in[i];
+        if (in[i] == 0x01) soh[n++] = static_cast<uint32_t>(i);
+    }
+    if (i < len) {
+        total += copy_checksum(dst + i, src + i, len - i);
+    }
+
+    return CopyScan{static_cast<uint8_t>(total & 0xFF), n};
+}
+
 // ============================================================================
 // Checksum Formatting
 // ============================================================================
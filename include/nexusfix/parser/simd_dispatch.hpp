@@ -0,0 +1,200 @@
+#pragma once
+
+/// @file simd_dispatch.hpp
+/// @brief CPU feature detection shared by the runtime-dispatched SIMD kernels
+///
+/// One binary serves hosts with different vector units: kernels for ISAs
+/// above the build baseline are compiled with function-level target
+/// attributes, and each kernel family (structural index, scanner, checksum)
+/// picks the widest tier that is both compiled in and supported by the CPU.
+/// On ARM64 the tiers are NEON (always present) and SVE2 (builds targeting
+/// armv9, e.g. Graviton4, checked against HWCAP2 at run time).
+/// NFX_SIMD_IMPL=scalar|avx2|avx512|avx512vbmi2|neon|sve2 caps the
+/// selection (testing).
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <span>
+
+#include "nexusfix/platform/platform.hpp"
+
+// The NFX_HAS_SIMD kernels are AVX2/AVX-512; other architectures use their
+// own tiers below
+#if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD && !NFX_ARCH_X64
+    #undef NFX_HAS_SIMD
+    #define NFX_HAS_SIMD 0
+#endif
+
+// ARM64: NEON is baseline; SVE2 kernels need an armv9 build
+#if NFX_HAS_NEON
+    #include <arm_neon.h>
+#endif
+#if NFX_ARCH_ARM64 && defined(__ARM_FEATURE_SVE2)
+    #include <arm_sve.h>
+    #define NFX_HAS_SVE2 1
+#else
+    #define NFX_HAS_SVE2 0
+#endif
+#if NFX_HAS_SVE2 && NFX_PLATFORM_LINUX
+    #include <sys/auxv.h>
+    #ifndef HWCAP2_SVE2
+        #define HWCAP2_SVE2 (1UL << 1)
+    #endif
+#endif
+
+// ============================================================================
+// Function-level Targets
+// ============================================================================
+
+// GCC/Clang can compile individual functions for a wider ISA than the rest
+// of the translation unit; such functions must only run after a CPU check
+#if NFX_ARCH_X64 && (NFX_COMPILER_GCC || NFX_COMPILER_CLANG)
+    #define NFX_HAS_SIMD_TARGETS 1
+    #define NFX_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+    #define NFX_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,bmi,bmi2,popcnt")))
+    #define NFX_TARGET_AVX512_VBMI2 \
+        __attribute__((target("avx512f,avx512bw,avx512vbmi2,bmi,bmi2,popcnt")))
+#else
+    #define NFX_HAS_SIMD_TARGETS 0
+    #define NFX_TARGET_AVX2
+    #define NFX_TARGET_AVX512
+    #define NFX_TARGET_AVX512_VBMI2
+#endif
+
+namespace nfx::simd {
+
+// ============================================================================
+// SIMD Implementation Tiers
+// ============================================================================
+
+/// SIMD implementation level
+enum class SimdImpl : uint8_t {
+    Scalar = 0,
+    AVX2 = 1,
+    AVX512 = 2,
+    AVX512_VBMI2 = 3,
+    NEON = 4,           // ARM64 tiers: never compiled alongside the x86 ones
+    SVE2 = 5
+};
+
+/// Get implementation name
+[[nodiscard]] inline constexpr const char* simd_impl_name(SimdImpl impl) noexcept {
+    switch (impl) {
+        case SimdImpl::Scalar: return "Scalar";
+        case SimdImpl::AVX2:   return "AVX2";
+        case SimdImpl::AVX512: return "AVX-512";
+        case SimdImpl::AVX512_VBMI2: return "AVX-512 VBMI2";
+        case SimdImpl::NEON:   return "NEON";
+        case SimdImpl::SVE2:   return "SVE2";
+    }
+    return "Unknown";
+}
+
+// ============================================================================
+// CPU Detection
+// ============================================================================
+
+/// Whether the running CPU can execute kernels of the given tier
+[[nodiscard]] inline bool cpu_supports(SimdImpl impl) noexcept {
+    switch (impl) {
+        case SimdImpl::Scalar:
+            return true;
+#if NFX_HAS_SIMD_TARGETS
+        case SimdImpl::AVX2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+        case SimdImpl::AVX512:
+            return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+                   __builtin_cpu_supports("bmi") && __builtin_cpu_supports("bmi2") &&
+                   __builtin_cpu_supports("popcnt");
+        case SimdImpl::AVX512_VBMI2:
+            return cpu_supports(SimdImpl::AVX512) && __builtin_cpu_supports("avx512vbmi2");
+#else
+        // No CPUID builtin: trust the build flags
+        case SimdImpl::AVX2:
+            return NFX_HAS_AVX2;
+        case SimdImpl::AVX512:
+            return NFX_HAS_AVX512;
+        case SimdImpl::AVX512_VBMI2:
+            return false;
+#endif
+        case SimdImpl::NEON:
+            return NFX_HAS_NEON;
+        case SimdImpl::SVE2:
+#if NFX_HAS_SVE2 && NFX_PLATFORM_LINUX
+            return (::getauxval(AT_HWCAP2) & HWCAP2_SVE2) != 0;
+#else
+            return NFX_HAS_SVE2;
+#endif
+    }
+    return false;
+}
+
+/// Tier requested through the NFX_SIMD_IMPL environment variable
+[[nodiscard]] inline std::optional<SimdImpl> simd_impl_override() noexcept {
+    const char* impl = nullptr;
+#if defined(_MSC_VER)
+    size_t impl_len = 0;
+    _dupenv_s(const_cast<char**>(&impl), &impl_len, "NFX_SIMD_IMPL");
+#else
+    impl = std::getenv("NFX_SIMD_IMPL");
+#endif
+    if (!impl) return std::nullopt;
+
+    std::optional<SimdImpl> result;
+    if (std::strcmp(impl, "scalar") == 0) result = SimdImpl::Scalar;
+    else if (std::strcmp(impl, "avx2") == 0) result = SimdImpl::AVX2;
+    else if (std::strcmp(impl, "avx512") == 0) result = SimdImpl::AVX512;
+    else if (std::strcmp(impl, "avx512vbmi2") == 0) result = SimdImpl::AVX512_VBMI2;
+    else if (std::strcmp(impl, "neon") == 0) result = SimdImpl::NEON;
+    else if (std::strcmp(impl, "sve2") == 0) result = SimdImpl::SVE2;
+
+#if defined(_MSC_VER)
+    std::free(const_cast<char*>(impl));
+#endif
+    return result;
+}
+
+/// Widest compiled-in tier the CPU supports
+/// @param compiled Tiers a kernel family was built with, in ascending order
+/// @param honor_override Cap the result at NFX_SIMD_IMPL when set
+[[nodiscard]] inline SimdImpl select_simd_impl(
+    std::span<const SimdImpl> compiled,
+    bool honor_override = true) noexcept
+{
+    const std::optional<SimdImpl> cap = honor_override
+        ? simd_impl_override() : std::nullopt;
+
+    SimdImpl best = SimdImpl::Scalar;
+    for (SimdImpl impl : compiled) {
+        if (cap && impl > *cap) break;
+        if (cpu_supports(impl)) best = impl;
+    }
+    return best;
+}
+
+#if NFX_HAS_NEON
+
+// ============================================================================
+// NEON Helpers
+// ============================================================================
+
+namespace detail {
+
+/// NEON has no movemask. Narrowing each 16-bit lane right by 4 (vshrn)
+/// keeps one nibble per byte, so a 16-byte compare result becomes a
+/// 64-bit mask with four bits per lane: lane = countr_zero(mask) / 4.
+[[nodiscard]] NFX_FORCE_INLINE uint64_t neon_nibble_mask(uint8x16_t cmp) noexcept {
+    const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+/// One bit per matching lane (bit 4k+3 for lane k), for mask &= mask - 1 loops
+inline constexpr uint64_t NEON_LANE_BITS = 0x8888888888888888ULL;
+
+}  // namespace detail
+
+#endif  // NFX_HAS_NEON
+
+}  // namespace nfx::simd
@@ -10,13 +10,17 @@
 #include <span>
 #include <cstdint>
 #include <cstddef>
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <memory>  // std::assume_aligned
+#include <mutex>
 
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/util/compiler.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
 #include "nexusfix/memory/buffer_pool.hpp"  // For nfx::CACHE_LINE_SIZE
+#include "nexusfix/parser/simd_dispatch.hpp"
 
 // SIMD feature detection
 #if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
@@ -34,9 +38,18 @@
     #else
         #define NFX_AVX512_AVAILABLE 0
     #endif
+
+    // AVX-512 kernels compiled in: natively, or per function (raw intrinsics)
+    // and selected at runtime when the CPU has them
+    #if NFX_AVX512_AVAILABLE || (!(defined(NFX_HAS_XSIMD) && NFX_HAS_XSIMD) && NFX_HAS_SIMD_TARGETS)
+        #define NFX_AVX512_DISPATCH 1
+    #else
+        #define NFX_AVX512_DISPATCH 0
+    #endif
 #else
     #define NFX_SIMD_AVAILABLE 0
     #define NFX_AVX512_AVAILABLE 0
+    #define NFX_AVX512_DISPATCH 0
 #endif
 
 namespace nfx::simd {
@@ -112,6 +125,16 @@ inline size_t find_soh_scalar(
     return data.size();  // Not found
 }
 
+/// Count SOH occurrences (scalar)
+[[nodiscard]] NFX_HOT
+inline size_t count_soh_scalar(std::span<const char> data) noexcept {
+    size_t count = 0;
+    for (char c : data) {
+        if (c == fix::SOH) [[unlikely]] ++count;
+    }
+    return count;
+}
+
 /// Find '=' position starting from offset (scalar)
 [[nodiscard]] NFX_HOT
 inline size_t find_equals_scalar(
@@ -126,6 +149,23 @@ inline size_t find_equals_scalar(
     return data.size();  // Not found
 }
 
+/// Find the next CheckSum field start ("\x0110=") from offset (scalar)
+/// @return Position of the SOH ending the previous field, or data.size()
+[[nodiscard]] NFX_HOT
+inline size_t find_trailer_scalar(
+    std::span<const char> data,
+    size_t start = 0) noexcept
+{
+    const char* __restrict ptr = data.data();
+    for (size_t i = start; i + 3 < data.size(); ++i) {
+        if (ptr[i] == fix::SOH && ptr[i + 1] == '1' &&
+            ptr[i + 2] == '0' && ptr[i + 3] == '=') [[unlikely]] {
+            return i;
+        }
+    }
+    return data.size();  // Not found
+}
+
 // ============================================================================
 // SIMD Scanner Implementations
 // ============================================================================
@@ -291,6 +331,40 @@ inline size_t count_soh_xsimd(std::span<const char> data) noexcept {
     return count;
 }
 
+/// Arch-templated "\x0110=" search: four shifted compares per block, so
+/// each block of bytes is loaded and tested once
+template <typename Arch>
+[[nodiscard]] NFX_HOT
+inline size_t find_trailer_xsimd(
+    std::span<const char> data,
+    size_t start = 0) noexcept
+{
+    using batch_t = xsimd::batch<uint8_t, Arch>;
+    constexpr size_t width = batch_t::size;
+
+    const batch_t soh_vec(static_cast<uint8_t>(fix::SOH));
+    const batch_t one_vec(static_cast<uint8_t>('1'));
+    const batch_t zero_vec(static_cast<uint8_t>('0'));
+    const batch_t eq_vec(static_cast<uint8_t>('='));
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data.data());
+    size_t i = start;
+
+    // The last load reads bytes i+3 .. i+3+width-1
+    while (i + width + 3 <= data.size()) [[likely]] {
+        auto match = (xsimd::load_unaligned<Arch>(ptr + i) == soh_vec) &
+                     (xsimd::load_unaligned<Arch>(ptr + i + 1) == one_vec) &
+                     (xsimd::load_unaligned<Arch>(ptr + i + 2) == zero_vec) &
+                     (xsimd::load_unaligned<Arch>(ptr + i + 3) == eq_vec);
+        const uint64_t mask = match.mask();
+        if (mask != 0) [[unlikely]] {
+            return i + std::countr_zero(mask);
+        }
+        i += width;
+    }
+
+    return find_trailer_scalar(data, i);
+}
+
 }  // namespace detail
 
 // Named wrappers for backward compatibility (call xsimd templates with explicit arch)
@@ -325,6 +399,15 @@ inline size_t count_soh_avx2(std::span<const char> data) noexcept {
     return detail::count_soh_xsimd<xsimd::avx2>(data);
 }
 
+/// AVX2-accelerated find "\x0110=" (CheckSum field start)
+[[nodiscard]] NFX_HOT
+inline size_t find_trailer_avx2(
+    std::span<const char> data,
+    size_t start = 0) noexcept
+{
+    return detail::find_trailer_xsimd<xsimd::avx2>(data, start);
+}
+
 #if NFX_AVX512_AVAILABLE
 
 /// AVX-512 accelerated SOH scanner (processes 64 bytes at a time)
@@ -357,6 +440,15 @@ inline size_t count_soh_avx512(std::span<const char> data) noexcept {
     return detail::count_soh_xsimd<xsimd::avx512bw>(data);
 }
 
+/// AVX-512 accelerated find "\x0110=" (CheckSum field start)
+[[nodiscard]] NFX_HOT
+inline size_t find_trailer_avx512(
+    std::span<const char> data,
+    size_t start = 0) noexcept
+{
+    return detail::find_trailer_xsimd<xsimd::avx512bw>(data, start);
+}
+
 #endif  // NFX_AVX512_AVAILABLE
 
 #else  // !NFX_HAS_XSIMD - Raw intrinsics fallback
@@ -515,15 +607,52 @@ inline size_t count_soh_avx2(std::span<const char> data) noexcept {
     return count;
 }
 
+/// AVX2-accelerated find "\x0110=" (CheckSum field start)
+/// Four shifted unaligned compares per 32-byte block
+[[nodiscard]] NFX_HOT
+inline size_t find_trailer_avx2(
+    std::span<const char> data,
+    size_t start = 0) noexcept
+{
+    const __m256i soh_vec = _mm256_set1_epi8(fix::SOH);
+    const __m256i one_vec = _mm256_set1_epi8('1');
+    const __m256i zero_vec = _mm256_set1_epi8('0');
+    const __m256i eq_vec = _mm256_set1_epi8('=');
+    const char* __restrict ptr = data.data();
+    size_t i = start;
+
+    // The last load reads bytes i+3 .. i+34
+    while (i + AVX2_REGISTER_SIZE + 3 <= data.size()) [[likely]] {
+        const __m256i m0 = _mm256_cmpeq_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + i)), soh_vec);
+        const __m256i m1 = _mm256_cmpeq_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + i + 1)), one_vec);
+        const __m256i m2 = _mm256_cmpeq_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + i + 2)), zero_vec);
+        const __m256i m3 = _mm256_cmpeq_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + i + 3)), eq_vec);
+        const __m256i match = _mm256_and_si256(_mm256_and_si256(m0, m1),
+                                               _mm256_and_si256(m2, m3));
+        const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(match));
+
+        if (mask != 0) [[unlikely]] {
+            return i + __builtin_ctz(mask);
+        }
+        i += AVX2_REGISTER_SIZE;
+    }
+
+    return find_trailer_scalar(data, i);
+}
+
 // ============================================================================
 // AVX-512 SIMD Scanner (raw intrinsics, 2x throughput vs AVX2)
 // ============================================================================
 
-#if NFX_AVX512_AVAILABLE
+#if NFX_AVX512_DISPATCH
 
 /// AVX-512 accelerated SOH scanner (processes 64 bytes at a time)
 /// Provides ~2x throughput improvement over AVX2 for large buffers
-[[nodiscard]] NFX_HOT
+[[nodiscard]] NFX_HOT NFX_TARGET_AVX512
 inline SohPositions scan_soh_avx512(std::span<const char> data) noexcept {
     SohPositions result;
 
@@ -559,7 +688,7 @@ inline SohPositions scan_soh_avx512(std::span<const char> data) noexcept {
 }
 
 /// AVX-512 accelerated find next SOH
-[[nodiscard]] NFX_HOT
+[[nodiscard]] NFX_HOT NFX_TARGET_AVX512
 inline size_t find_soh_avx512(
     std::span<const char> data,
     size_t start = 0) noexcept
@@ -601,7 +730,7 @@ inline size_t find_soh_avx512(
 }
 
 /// AVX-512 accelerated find '='
-[[nodiscard]] NFX_HOT
+[[nodiscard]] NFX_HOT NFX_TARGET_AVX512
 inline size_t find_equals_avx512(
     std::span<const char> data,
     size_t start = 0) noexcept
@@ -643,7 +772,7 @@ inline size_t find_equals_avx512(
 }
 
 /// Count SOH occurrences using AVX-512
-[[nodiscard]] NFX_HOT
+[[nodiscard]] NFX_HOT NFX_TARGET_AVX512
 inline size_t count_soh_avx512(std::span<const char> data) noexcept {
     const __m512i soh_vec = _mm512_set1_epi8(fix::SOH);
     const size_t simd_end = data.size() & ~(AVX512_REGISTER_SIZE - 1);
@@ -666,33 +795,354 @@ inline size_t count_soh_avx512(std::span<const char> data) noexcept {
     return count;
 }
 
-#endif  // NFX_AVX512_AVAILABLE
+/// AVX-512 accelerated find "\x0110=" (CheckSum field start)
+[[nodiscard]] NFX_HOT NFX_TARGET_AVX512
+inline size_t find_trailer_avx512(
+    std::span<const char> data,
+    size_t start = 0) noexcept
+{
+    const __m512i soh_vec = _mm512_set1_epi8(fix::SOH);
+    const __m512i one_vec = _mm512_set1_epi8('1');
+    const __m512i zero_vec = _mm512_set1_epi8('0');
+    const __m512i eq_vec = _mm512_set1_epi8('=');
+    const char* __restrict ptr = data.data();
+    size_t i = start;
+
+    // The last load reads bytes i+3 .. i+66
+    while (i + AVX512_REGISTER_SIZE + 3 <= data.size()) [[likely]] {
+        __mmask64 mask = _mm512_cmpeq_epi8_mask(
+            _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ptr + i)), soh_vec);
+        mask &= _mm512_cmpeq_epi8_mask(
+            _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ptr + i + 1)), one_vec);
+        mask &= _mm512_cmpeq_epi8_mask(
+            _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ptr + i + 2)), zero_vec);
+        mask &= _mm512_cmpeq_epi8_mask(
+            _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ptr + i + 3)), eq_vec);
+
+        if (mask != 0) [[unlikely]] {
+            return i + _tzcnt_u64(mask);
+        }
+        i += AVX512_REGISTER_SIZE;
+    }
+
+    return find_trailer_scalar(data, i);
+}
+
+#endif  // NFX_AVX512_DISPATCH
 
 #endif  // NFX_HAS_XSIMD
 
 #endif  // NFX_SIMD_AVAILABLE
 
+#if NFX_HAS_NEON
+
+// ============================================================================
+// ARM NEON Scanner (hand-written, 16 bytes per register)
+// ============================================================================
+// Masks come from detail::neon_nibble_mask (vshrn): four bits per byte.
+// The find kernels test 64 bytes per iteration with one horizontal max and
+// only build a mask for the block that has a hit.
+
+namespace detail {
+
+/// First byte equal to `needle` at or after start
+[[nodiscard]] NFX_HOT
+inline size_t find_byte_neon(std::span<const char> data, size_t start, char needle) noexcept {
+    const uint8x16_t target = vdupq_n_u8(static_cast<uint8_t>(needle));
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data.data());
+    size_t i = start;
+
+    while (i + 64 <= data.size()) [[likely]] {
+        const uint8x16_t c0 = vceqq_u8(vld1q_u8(ptr + i), target);
+        const uint8x16_t c1 = vceqq_u8(vld1q_u8(ptr + i + 16), target);
+        const uint8x16_t c2 = vceqq_u8(vld1q_u8(ptr + i + 32), target);
+        const uint8x16_t c3 = vceqq_u8(vld1q_u8(ptr + i + 48), target);
+        if (vmaxvq_u8(vorrq_u8(vorrq_u8(c0, c1), vorrq_u8(c2, c3))) != 0) [[unlikely]] {
+            const uint8x16_t block[4] = {c0, c1, c2, c3};
+            for (size_t b = 0; b < 4; ++b) {
+                const uint64_t mask = neon_nibble_mask(block[b]);
+                if (mask != 0) return i + b * 16 + (std::countr_zero(mask) >> 2);
+            }
+        }
+        i += 64;
+    }
+    while (i + 16 <= data.size()) {
+        const uint64_t mask = neon_nibble_mask(vceqq_u8(vld1q_u8(ptr + i), target));
+        if (mask != 0) return i + (std::countr_zero(mask) >> 2);
+        i += 16;
+    }
+    for (; i < data.size(); ++i) {
+        if (data[i] == needle) return i;
+    }
+    return data.size();
+}
+
+}  // namespace detail
+
+/// NEON SOH scanner
+[[nodiscard]] NFX_HOT
+inline SohPositions scan_soh_neon(std::span<const char> data) noexcept {
+    SohPositions result;
+
+    const uint8x16_t soh_vec = vdupq_n_u8(static_cast<uint8_t>(fix::SOH));
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data.data());
+    const size_t simd_end = data.size() & ~size_t{15};
+
+    for (size_t i = 0; i < simd_end && result.count < MAX_SOH_POSITIONS - 16; i += 16) {
+        uint64_t mask = detail::neon_nibble_mask(vceqq_u8(vld1q_u8(ptr + i), soh_vec)) &
+                        detail::NEON_LANE_BITS;
+        while (mask != 0) {
+            result.push(static_cast<uint16_t>(i + (std::countr_zero(mask) >> 2)));
+            mask &= mask - 1;
+        }
+    }
+
+    for (size_t i = simd_end; i < data.size() && result.count < MAX_SOH_POSITIONS; ++i) {
+        if (data[i] == fix::SOH) [[unlikely]] {
+            result.push(static_cast<uint16_t>(i));
+        }
+    }
+    return result;
+}
+
+/// NEON find next SOH
+[[nodiscard]] NFX_HOT
+inline size_t find_soh_neon(std::span<const char> data, size_t start = 0) noexcept {
+    return detail::find_byte_neon(data, start, fix::SOH);
+}
+
+/// NEON find '='
+[[nodiscard]] NFX_HOT
+inline size_t find_equals_neon(std::span<const char> data, size_t start = 0) noexcept {
+    return detail::find_byte_neon(data, start, fix::EQUALS);
+}
+
+/// NEON count SOH: compare results (0xFF) are subtracted into per-lane
+/// byte counters, widened before they can wrap
+[[nodiscard]] NFX_HOT
+inline size_t count_soh_neon(std::span<const char> data) noexcept {
+    const uint8x16_t soh_vec = vdupq_n_u8(static_cast<uint8_t>(fix::SOH));
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data.data());
+    const size_t simd_end = data.size() & ~size_t{15};
+
+    size_t count = 0;
+    size_t i = 0;
+    while (i < simd_end) {
+        uint8x16_t lanes = vdupq_n_u8(0);
+        const size_t block_end = std::min(simd_end, i + 255 * 16);
+        for (; i < block_end; i += 16) {
+            lanes = vsubq_u8(lanes, vceqq_u8(vld1q_u8(ptr + i), soh_vec));
+        }
+        count += vaddlvq_u8(lanes);
+    }
+
+    for (i = simd_end; i < data.size(); ++i) {
+        if (data[i] == fix::SOH) [[unlikely]] ++count;
+    }
+    return count;
+}
+
+/// NEON find "\x0110=" (CheckSum field start)
+[[nodiscard]] NFX_HOT
+inline size_t find_trailer_neon(std::span<const char> data, size_t start = 0) noexcept {
+    const uint8x16_t soh_vec = vdupq_n_u8(static_cast<uint8_t>(fix::SOH));
+    const uint8x16_t one_vec = vdupq_n_u8('1');
+    const uint8x16_t zero_vec = vdupq_n_u8('0');
+    const uint8x16_t eq_vec = vdupq_n_u8('=');
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data.data());
+    size_t i = start;
+
+    // The last load reads bytes i+3 .. i+18
+    while (i + 16 + 3 <= data.size()) [[likely]] {
+        const uint8x16_t match = vandq_u8(
+            vandq_u8(vceqq_u8(vld1q_u8(ptr + i), soh_vec),
+                     vceqq_u8(vld1q_u8(ptr + i + 1), one_vec)),
+            vandq_u8(vceqq_u8(vld1q_u8(ptr + i + 2), zero_vec),
+                     vceqq_u8(vld1q_u8(ptr + i + 3), eq_vec)));
+        const uint64_t mask = detail::neon_nibble_mask(match);
+        if (mask != 0) [[unlikely]] {
+            return i + (std::countr_zero(mask) >> 2);
+        }
+        i += 16;
+    }
+
+    return find_trailer_scalar(data, i);
+}
+
+#endif  // NFX_HAS_NEON
+
+#if NFX_HAS_SVE2
+
+// ============================================================================
+// ARM SVE2 Scanner (vector-length agnostic: 16..256 bytes per register)
+// ============================================================================
+// Every loop is predicated with whilelt, so there is no scalar tail; the
+// index of the first hit is the active lane count before it (brkb + cntp).
+
+namespace detail {
+
+/// First byte equal to `needle` at or after start
+[[nodiscard]] NFX_HOT
+inline size_t find_byte_sve2(std::span<const char> data, size_t start, char needle) noexcept {
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data.data());
+    const uint64_t n = data.size();
+    for (uint64_t i = start; i < n; i += svcntb()) {
+        const svbool_t pg = svwhilelt_b8_u64(i, n);
+        const svbool_t hit = svcmpeq_n_u8(pg, svld1_u8(pg, ptr + i), static_cast<uint8_t>(needle));
+        if (svptest_any(pg, hit)) [[unlikely]] {
+            return i + svcntp_b8(pg, svbrkb_b_z(pg, hit));
+        }
+    }
+    return data.size();
+}
+
+}  // namespace detail
+
+/// SVE2 SOH scanner
+[[nodiscard]] NFX_HOT
+inline SohPositions scan_soh_sve2(std::span<const char> data) noexcept {
+    SohPositions result;
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data.data());
+    const uint64_t n = data.size();
+
+    for (uint64_t i = 0; i < n && result.count < MAX_SOH_POSITIONS; i += svcntb()) {
+        const svbool_t pg = svwhilelt_b8_u64(i, n);
+        svbool_t hit = svcmpeq_n_u8(pg, svld1_u8(pg, ptr + i), static_cast<uint8_t>(fix::SOH));
+        while (svptest_any(pg, hit) && result.count < MAX_SOH_POSITIONS) {
+            result.push(static_cast<uint16_t>(i + svcntp_b8(pg, svbrkb_b_z(pg, hit))));
+            hit = svbic_b_z(pg, hit, svbrka_b_z(pg, hit));   // Drop the first hit
+        }
+    }
+    return result;
+}
+
+/// SVE2 find next SOH
+[[nodiscard]] NFX_HOT
+inline size_t find_soh_sve2(std::span<const char> data, size_t start = 0) noexcept {
+    return detail::find_byte_sve2(data, start, fix::SOH);
+}
+
+/// SVE2 find '='
+[[nodiscard]] NFX_HOT
+inline size_t find_equals_sve2(std::span<const char> data, size_t start = 0) noexcept {
+    return detail::find_byte_sve2(data, start, fix::EQUALS);
+}
+
+/// SVE2 count SOH (cntp per register)
+[[nodiscard]] NFX_HOT
+inline size_t count_soh_sve2(std::span<const char> data) noexcept {
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data.data());
+    const uint64_t n = data.size();
+    size_t count = 0;
+    for (uint64_t i = 0; i < n; i += svcntb()) {
+        const svbool_t pg = svwhilelt_b8_u64(i, n);
+        count += svcntp_b8(pg, svcmpeq_n_u8(pg, svld1_u8(pg, ptr + i),
+                                            static_cast<uint8_t>(fix::SOH)));
+    }
+    return count;
+}
+
+/// SVE2 find "\x0110=" (CheckSum field start)
+[[nodiscard]] NFX_HOT
+inline size_t find_trailer_sve2(std::span<const char> data, size_t start = 0) noexcept {
+    const auto* ptr = reinterpret_cast<const uint8_t*>(data.data());
+    const uint64_t n = data.size();
+    for (uint64_t i = start; i + 3 < n; i += svcntb()) {
+        // Lane k is active while byte i+k+3 exists
+        const svbool_t pg = svwhilelt_b8_u64(i + 3, n);
+        svbool_t hit = svcmpeq_n_u8(pg, svld1_u8(pg, ptr + i), static_cast<uint8_t>(fix::SOH));
+        hit = svand_b_z(pg, hit, svcmpeq_n_u8(pg, svld1_u8(pg, ptr + i + 1), '1'));
+        hit = svand_b_z(pg, hit, svcmpeq_n_u8(pg, svld1_u8(pg, ptr + i + 2), '0'));
+        hit = svand_b_z(pg, hit, svcmpeq_n_u8(pg, svld1_u8(pg, ptr + i + 3), '='));
+        if (svptest_any(pg, hit)) [[unlikely]] {
+            return i + svcntp_b8(pg, svbrkb_b_z(pg, hit));
+        }
+    }
+    return data.size();
+}
+
+#endif  // NFX_HAS_SVE2
+
+// ============================================================================
+// Runtime Dispatch
+// ============================================================================
+
+namespace detail {
+
+/// Tiers compiled into this binary, ascending
+inline constexpr SimdImpl SCANNER_IMPLS[] = {
+    SimdImpl::Scalar,
+#if NFX_SIMD_AVAILABLE
+    SimdImpl::AVX2,
+#endif
+#if NFX_AVX512_DISPATCH
+    SimdImpl::AVX512,
+#endif
+#if NFX_HAS_NEON
+    SimdImpl::NEON,
+#endif
+#if NFX_HAS_SVE2
+    SimdImpl::SVE2,
+#endif
+};
+
+/// Runtime-selected tier (a cached enum rather than function pointers, so
+/// the AVX2 kernels stay inlinable into the unified API)
+inline SimdImpl g_scanner_impl = SimdImpl::Scalar;
+inline bool g_scanner_initialized = false;
+
+}  // namespace detail
+
+/// Initialize scanner dispatch from CPUID (called lazily on first scan)
+/// NFX_SIMD_IMPL caps the selected tier (for testing).
+inline void init_scanner_dispatch() noexcept {
+    static std::once_flag flag;
+    std::call_once(flag, []() {
+        detail::g_scanner_impl = select_simd_impl(detail::SCANNER_IMPLS);
+        detail::g_scanner_initialized = true;
+    });
+}
+
+/// Get current scanner implementation
+[[nodiscard]] NFX_FORCE_INLINE SimdImpl active_scanner_impl() noexcept {
+    if (!detail::g_scanner_initialized) [[unlikely]] {
+        init_scanner_dispatch();
+    }
+    return detail::g_scanner_impl;
+}
+
 // ============================================================================
 // Unified API (auto-selects SIMD or scalar)
 // ============================================================================
 
 /// Scan for all SOH positions (auto-selects best implementation)
-/// Priority: AVX-512 > AVX2 > Scalar
+/// Priority: AVX-512 > AVX2 > Scalar (ARM64: SVE2 > NEON > Scalar)
 [[nodiscard]] NFX_HOT
 inline SohPositions scan_soh(std::span<const char> data) noexcept {
-#if NFX_AVX512_AVAILABLE
+    [[maybe_unused]] const SimdImpl impl = active_scanner_impl();
+#if NFX_AVX512_DISPATCH
     // Use AVX-512 for buffers >= 128 bytes (2x register size)
-    if (data.size() >= 128) [[likely]] {
+    if (data.size() >= 128 && impl >= SimdImpl::AVX512) [[likely]] {
         NFX_ASSUME(data.size() >= AVX512_REGISTER_SIZE);
         return scan_soh_avx512(data);
     }
 #endif
 #if NFX_SIMD_AVAILABLE
     // Use AVX2 for buffers >= 64 bytes
-    if (data.size() >= 64) [[likely]] {
+    if (data.size() >= 64 && impl >= SimdImpl::AVX2) [[likely]] {
         NFX_ASSUME(data.size() >= AVX2_REGISTER_SIZE);
         return scan_soh_avx2(data);
     }
+#endif
+#if NFX_HAS_SVE2
+    if (impl >= SimdImpl::SVE2) [[likely]] {
+        return scan_soh_sve2(data);
+    }
+#endif
+#if NFX_HAS_NEON
+    if (data.size() >= 32 && impl >= SimdImpl::NEON) [[likely]] {
+        return scan_soh_neon(data);
+    }
 #endif
     return scan_soh_scalar(data);
 }
@@ -705,17 +1155,28 @@ inline size_t find_soh(
     size_t start = 0) noexcept
 {
     [[maybe_unused]] const size_t remaining = data.size() - start;
-#if NFX_AVX512_AVAILABLE
-    if (remaining >= 128) [[likely]] {
+    [[maybe_unused]] const SimdImpl impl = active_scanner_impl();
+#if NFX_AVX512_DISPATCH
+    if (remaining >= 128 && impl >= SimdImpl::AVX512) [[likely]] {
         NFX_ASSUME(remaining >= AVX512_REGISTER_SIZE);
         return find_soh_avx512(data, start);
     }
 #endif
 #if NFX_SIMD_AVAILABLE
-    if (remaining >= 64) [[likely]] {
+    if (remaining >= 64 && impl >= SimdImpl::AVX2) [[likely]] {
         NFX_ASSUME(remaining >= AVX2_REGISTER_SIZE);
         return find_soh_avx2(data, start);
     }
+#endif
+#if NFX_HAS_SVE2
+    if (impl >= SimdImpl::SVE2) [[likely]] {
+        return find_soh_sve2(data, start);
+    }
+#endif
+#if NFX_HAS_NEON
+    if (remaining >= 32 && impl >= SimdImpl::NEON) [[likely]] {
+        return find_soh_neon(data, start);
+    }
 #endif
     return find_soh_scalar(data, start);
 }
@@ -728,17 +1189,28 @@ inline size_t find_equals(
     size_t start = 0) noexcept
 {
     [[maybe_unused]] const size_t remaining = data.size() - start;
-#if NFX_AVX512_AVAILABLE
-    if (remaining >= 128) [[likely]] {
+    [[maybe_unused]] const SimdImpl impl = active_scanner_impl();
+#if NFX_AVX512_DISPATCH
+    if (remaining >= 128 && impl >= SimdImpl::AVX512) [[likely]] {
         NFX_ASSUME(remaining >= AVX512_REGISTER_SIZE);
         return find_equals_avx512(data, start);
     }
 #endif
 #if NFX_SIMD_AVAILABLE
-    if (remaining >= 64) [[likely]] {
+    if (remaining >= 64 && impl >= SimdImpl::AVX2) [[likely]] {
         NFX_ASSUME(remaining >= AVX2_REGISTER_SIZE);
         return find_equals_avx2(data, start);
     }
+#endif
+#if NFX_HAS_SVE2
+    if (impl >= SimdImpl::SVE2) [[likely]] {
+        return find_equals_sve2(data, start);
+    }
+#endif
+#if NFX_HAS_NEON
+    if (remaining >= 32 && impl >= SimdImpl::NEON) [[likely]] {
+        return find_equals_neon(data, start);
+    }
 #endif
     return find_equals_scalar(data, start);
 }
@@ -747,21 +1219,61 @@ inline size_t find_equals(
 /// Priority: AVX-512 > AVX2 > Scalar
 [[nodiscard]] NFX_HOT
 inline size_t count_soh(std::span<const char> data) noexcept {
-#if NFX_AVX512_AVAILABLE
-    if (data.size() >= 128) [[likely]] {
+    [[maybe_unused]] const SimdImpl impl = active_scanner_impl();
+#if NFX_AVX512_DISPATCH
+    if (data.size() >= 128 && impl >= SimdImpl::AVX512) [[likely]] {
         return count_soh_avx512(data);
     }
 #endif
 #if NFX_SIMD_AVAILABLE
-    if (data.size() >= 64) [[likely]] {
+    if (data.size() >= 64 && impl >= SimdImpl::AVX2) [[likely]] {
         return count_soh_avx2(data);
     }
 #endif
-    size_t count = 0;
-    for (char c : data) {
-        if (c == fix::SOH) [[unlikely]] ++count;
+#if NFX_HAS_SVE2
+    if (impl >= SimdImpl::SVE2) [[likely]] {
+        return count_soh_sve2(data);
     }
-    return count;
+#endif
+#if NFX_HAS_NEON
+    if (data.size() >= 32 && impl >= SimdImpl::NEON) [[likely]] {
+        return count_soh_neon(data);
+    }
+#endif
+    return count_soh_scalar(data);
+}
+
+/// Find the next CheckSum field start ("\x0110=")
+/// Priority: AVX-512 > AVX2 > Scalar
+/// @return Position of the SOH before "10=", or data.size()
+[[nodiscard]] NFX_HOT
+inline size_t find_trailer(
+    std::span<const char> data,
+    size_t start = 0) noexcept
+{
+    [[maybe_unused]] const size_t remaining = start < data.size() ? data.size() - start : 0;
+    [[maybe_unused]] const SimdImpl impl = active_scanner_impl();
+#if NFX_AVX512_DISPATCH
+    if (remaining >= 128 && impl >= SimdImpl::AVX512) [[likely]] {
+        return find_trailer_avx512(data, start);
+    }
+#endif
+#if NFX_SIMD_AVAILABLE
+    if (remaining >= 64 && impl >= SimdImpl::AVX2) [[likely]] {
+        return find_trailer_avx2(data, start);
+    }
+#endif
+#if NFX_HAS_SVE2
+    if (impl >= SimdImpl::SVE2) [[likely]] {
+        return find_trailer_sve2(data, start);
+    }
+#endif
+#if NFX_HAS_NEON
+    if (remaining >= 32 && impl >= SimdImpl::NEON) [[likely]] {
+        return find_trailer_neon(data, start);
+    }
+#endif
+    return find_trailer_scalar(data, start);
 }
 
 // ============================================================================
@@ -816,27 +1328,98 @@ inline MessageBoundary find_message_boundary(
         return MessageBoundary{};  // No message start found
     }
 
-    // Find "10=" (checksum field) - must be near end
-    // Search backwards from reasonable position
-    size_t search_end = std::min(msg_start + fix::MAX_MESSAGE_SIZE, data.size());
-
-    for (size_t i = msg_start + 20; i + 7 < search_end; ++i) [[likely]] {
-        // Look for SOH followed by "10="
-        if (ptr[i] == fix::SOH &&
-            ptr[i + 1] == '1' &&
-            ptr[i + 2] == '0' &&
-            ptr[i + 3] == '=') [[unlikely]] {
-            // Find the final SOH after checksum value
-            size_t checksum_end = find_soh(data, i + 4);
-            if (checksum_end < search_end) [[likely]] {
-                return MessageBoundary{msg_start, checksum_end + 1, true};
-            }
+    // Find "\x0110=" (checksum field) with the vector trailer search
+    const size_t search_end = std::min(msg_start + fix::MAX_MESSAGE_SIZE, data.size());
+    const size_t i = find_trailer(data.first(search_end), msg_start + 20);
+
+    if (i + 7 < search_end) [[likely]] {
+        // Find the final SOH after checksum value; with none before
+        // search_end no later candidate can end the message either
+        size_t checksum_end = find_soh(data, i + 4);
+        if (checksum_end < search_end) [[likely]] {
+            return MessageBoundary{msg_start, checksum_end + 1, true};
         }
     }
 
     return MessageBoundary{msg_start, 0, false};  // Incomplete message
 }
 
+namespace detail {
+
+/// End of the message starting at msg_start ("8=F") as declared by its
+/// BodyLength (9): past "10=XXX|". May lie beyond data.
+/// @return 0 if the first two fields are not BeginString and BodyLength
+[[nodiscard]] NFX_FORCE_INLINE
+size_t declared_message_end(std::span<const char> data, size_t msg_start) noexcept {
+    constexpr size_t BEGIN_STRING_MAX = 16;     // "8=FIXT.1.1|" and kin
+    constexpr size_t LENGTH_DIGITS_MAX = 7;
+    const char* ptr = data.data();
+    const size_t limit = std::min(data.size(), msg_start + BEGIN_STRING_MAX);
+
+    size_t i = msg_start + 2;
+    while (i < limit && ptr[i] != fix::SOH) ++i;
+    if (i + 3 >= data.size() || ptr[i] != fix::SOH ||
+        ptr[i + 1] != '9' || ptr[i + 2] != '=') [[unlikely]] {
+        return 0;
+    }
+
+    i += 3;
+    const size_t digits_end = std::min(data.size(), i + LENGTH_DIGITS_MAX + 1);
+    size_t body_length = 0;
+    const size_t digits_start = i;
+    while (i < digits_end && ptr[i] >= '0' && ptr[i] <= '9') {
+        body_length = body_length * 10 + static_cast<size_t>(ptr[i] - '0');
+        ++i;
+    }
+    if (i == digits_start || i >= digits_end || ptr[i] != fix::SOH) [[unlikely]] {
+        return 0;
+    }
+    return i + 1 + body_length + 7;     // Body, then "10=XXX|"
+}
+
+}  // namespace detail
+
+/// Find all complete message boundaries in one forward sweep
+/// Each message is framed by its BodyLength, checked only where the
+/// trailer should be ("|10=XXX|" ending exactly there), so a megabyte of
+/// resent messages is framed without reading their bodies. A message whose
+/// BodyLength does not land on a trailer falls back to the vector trailer
+/// search of find_message_boundary(). Stops at the first incomplete
+/// message or when out is full.
+/// @return Number of boundaries written to out
+[[nodiscard]] NFX_HOT
+inline size_t find_message_boundaries(
+    std::span<const char> data,
+    std::span<MessageBoundary> out) noexcept
+{
+    const char* __restrict ptr = data.data();
+    size_t count = 0;
+    size_t pos = 0;
+
+    while (count < out.size() && pos < data.size()) [[likely]] {
+        if (pos + 5 < data.size() && ptr[pos] == '8' && ptr[pos + 1] == '=' &&
+            ptr[pos + 2] == 'F') [[likely]] {
+            const size_t end = detail::declared_message_end(data, pos);
+            if (end != 0 && end <= data.size() && end - pos <= fix::MAX_MESSAGE_SIZE &&
+                ptr[end - 8] == fix::SOH && ptr[end - 7] == '1' && ptr[end - 6] == '0' &&
+                ptr[end - 5] == '=' && ptr[end - 1] == fix::SOH) [[likely]] {
+                out[count++] = MessageBoundary{pos, end, true};
+                pos = end;
+                continue;
+            }
+        }
+
+        MessageBoundary boundary = find_message_boundary(data, pos);
+        if (!boundary.complete) {
+            break;  // Need more data
+        }
+        out[count++] = boundary;
+        pos = boundary.end;
+    }
+
+    return count;
+}
+
 // ============================================================================
 // Static Assertions for Struct Layout
 // ============================================================================
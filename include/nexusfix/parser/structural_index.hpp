@@ -16,7 +16,9 @@
 #include <span>
 #include <cstdint>
 #include <cstddef>
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <string_view>
 #include <cstring>
 #include <cstdlib>
@@ -26,15 +28,38 @@
 #include "nexusfix/util/compiler.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
 #include "nexusfix/memory/buffer_pool.hpp"
+#include "nexusfix/parser/simd_dispatch.hpp"
 
 // SIMD headers
 #if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
     #if defined(NFX_HAS_XSIMD) && NFX_HAS_XSIMD
         #include <xsimd/xsimd.hpp>
         #include <bit>
-    #else
+    #endif
+    #if !(defined(NFX_HAS_XSIMD) && NFX_HAS_XSIMD) || NFX_HAS_SIMD_TARGETS || \
+        defined(__AVX512VBMI2__)
         #include <immintrin.h>
     #endif
+
+    // AVX-512 kernels: built natively, or per function for runtime dispatch
+    // (the xsimd AVX-512 kernel needs the native flags)
+    #if NFX_INDEX_AVX512
+        #define NFX_INDEX_AVX512 1
+    #elif !(defined(NFX_HAS_XSIMD) && NFX_HAS_XSIMD) && NFX_HAS_SIMD_TARGETS
+        #define NFX_INDEX_AVX512 1
+    #else
+        #define NFX_INDEX_AVX512 0
+    #endif
+
+    #if (defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VBMI2__)) || \
+        NFX_HAS_SIMD_TARGETS
+        #define NFX_INDEX_AVX512_VBMI2 1
+    #else
+        #define NFX_INDEX_AVX512_VBMI2 0
+    #endif
+#else
+    #define NFX_INDEX_AVX512 0
+    #define NFX_INDEX_AVX512_VBMI2 0
 #endif
 
 // MSVC warns about intentional cache-line alignment padding (C4324)
@@ -115,6 +140,61 @@ using MediumPaddedBuffer = PaddedMessageBuffer<1024>;
 using LargePaddedBuffer = PaddedMessageBuffer<4096>;
 using JumboPaddedBuffer = PaddedMessageBuffer<65536>;
 
+// ============================================================================
+// SWAR Tag Decoding
+// ============================================================================
+
+/// Scalar tag decode (reference implementation and short-buffer fallback)
+/// @return Tag number, or 0 if empty or a non-digit is present
+[[nodiscard]] NFX_HOT
+inline int decode_tag_scalar(const char* data, size_t tag_start, size_t tag_end) noexcept {
+    if (tag_start >= tag_end) [[unlikely]] return 0;
+
+    int tag = 0;
+    for (size_t i = tag_start; i < tag_end; ++i) {
+        char c = data[i];
+        if (c < '0' || c > '9') [[unlikely]] return 0;
+        tag = tag * 10 + (c - '0');
+    }
+    return tag;
+}
+
+/// Decode a 1-8 digit tag ending just before '=' (SWAR, no branches per digit)
+/// Loads the 8 bytes preceding '=', left-pads the tag with '0' and reduces
+/// all digits with three multiplies. Portable: runs the same on x86 and ARM.
+/// Falls back to scalar for tags within 8 bytes of the buffer start.
+/// @return Tag number, or 0 if empty or a non-digit is present
+[[nodiscard]] NFX_HOT
+inline int decode_tag(const char* data, size_t tag_start, size_t tag_end) noexcept {
+    const size_t len = tag_end - tag_start;
+
+    if constexpr (std::endian::native == std::endian::little) {
+        if (tag_end >= 8 && tag_start < tag_end && len <= 8) [[likely]] {
+            uint64_t v;
+            std::memcpy(&v, data + tag_end - 8, sizeof(v));
+
+            // Replace the bytes before the tag with '0'
+            const uint64_t pad_mask = (uint64_t{1} << ((8 - len) * 8)) - 1;
+            v = (v & ~pad_mask) | (0x3030303030303030ULL & pad_mask);
+
+            // All eight bytes must be ASCII digits
+            if (((v & 0xF0F0F0F0F0F0F0F0ULL) |
+                 (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))
+                != 0x3333333333333333ULL) [[unlikely]] {
+                return 0;
+            }
+
+            v -= 0x3030303030303030ULL;
+            v = (v * 10) + (v >> 8);
+            v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+                 (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+            return static_cast<int>(v);
+        }
+    }
+
+    return decode_tag_scalar(data, tag_start, tag_end);
+}
+
 // ============================================================================
 // FIX Structural Index (simdjson-style)
 // ============================================================================
@@ -142,6 +222,16 @@ struct alignas(CACHE_LINE_SIZE) FIXStructuralIndex {
         , message_size{0}
     {}
 
+    /// Forget all positions (counts only; the arrays are not wiped)
+    constexpr void clear() noexcept {
+        soh_count = 0;
+        equals_count = 0;
+        checksum_start = 0;
+        body_length_start = 0;
+        msg_type_start = 0;
+        message_size = 0;
+    }
+
     /// Get field count (number of tag=value pairs)
     [[nodiscard]] constexpr size_t field_count() const noexcept {
         return soh_count;
@@ -172,14 +262,7 @@ struct alignas(CACHE_LINE_SIZE) FIXStructuralIndex {
     [[nodiscard]] int tag_at(std::span<const char> msg, size_t field_idx) const noexcept {
         auto bounds = field_bounds(field_idx);
         if (bounds[0] >= bounds[1]) [[unlikely]] return 0;
-
-        int tag = 0;
-        for (uint16_t i = bounds[0]; i < bounds[1]; ++i) {
-            char c = msg[i];
-            if (c < '0' || c > '9') [[unlikely]] return 0;
-            tag = tag * 10 + (c - '0');
-        }
-        return tag;
+        return decode_tag(msg.data(), bounds[0], bounds[1]);
     }
 
     /// Extract value at field index as string_view (zero-copy)
@@ -469,9 +552,10 @@ inline FIXStructuralIndex build_index_avx2(std::span<const char> data) noexcept
 // AVX-512 Implementation (raw intrinsics)
 // ============================================================================
 
-#if defined(__AVX512F__) && defined(__AVX512BW__)
+#if NFX_INDEX_AVX512
 
 /// Extract all set bit positions from 64-bit mask
+NFX_TARGET_AVX512
 inline void extract_positions_avx512(
     uint64_t mask,
     size_t offset,
@@ -487,7 +571,7 @@ inline void extract_positions_avx512(
 }
 
 /// Build structural index using AVX-512 (processes 64 bytes at a time)
-[[nodiscard]] NFX_HOT
+[[nodiscard]] NFX_HOT NFX_TARGET_AVX512
 inline FIXStructuralIndex build_index_avx512(std::span<const char> data) noexcept {
     FIXStructuralIndex idx;
     idx.message_size = static_cast<uint16_t>(data.size());
@@ -559,29 +643,262 @@ inline FIXStructuralIndex build_index_avx512(std::span<const char> data) noexcep
 
 #endif  // NFX_HAS_XSIMD
 
+// ============================================================================
+// AVX-512 VBMI2 Implementation (VPCOMPRESSB position extraction)
+// ============================================================================
+
+#if NFX_INDEX_AVX512_VBMI2
+
+/// Byte lane indices 0..63 (compressed by the structural masks)
+alignas(64) inline constexpr std::array<uint8_t, 64> VBMI2_LANE_INDEX = [] {
+    std::array<uint8_t, 64> lanes{};
+    for (size_t i = 0; i < lanes.size(); ++i) lanes[i] = static_cast<uint8_t>(i);
+    return lanes;
+}();
+
+/// Append all set bit positions of a 64-bit mask without a per-bit loop:
+/// VPCOMPRESSB packs the matching lane indices, which are widened to
+/// 16 bits, offset and written with at most two masked stores.
+NFX_FORCE_INLINE NFX_TARGET_AVX512_VBMI2 void compress_positions_vbmi2(
+    __mmask64 mask,
+    size_t offset,
+    uint16_t* positions,
+    uint16_t& count,
+    uint16_t max_count) noexcept
+{
+    const size_t n = std::min<size_t>(
+        static_cast<size_t>(std::popcount(static_cast<uint64_t>(mask))),
+        static_cast<size_t>(max_count - count));
+    if (n == 0) return;
+
+    const __m512i lanes = _mm512_load_si512(VBMI2_LANE_INDEX.data());
+    const __m512i packed = _mm512_maskz_compress_epi8(mask, lanes);
+    const __m512i base = _mm512_set1_epi16(static_cast<short>(offset));
+    uint16_t* out = positions + count;
+
+    const __m512i lo = _mm512_add_epi16(
+        _mm512_cvtepu8_epi16(_mm512_maskz_extracti64x4_epi64(0xFF, packed, 0)), base);
+    _mm512_mask_storeu_epi16(out,
+        n >= 32 ? ~__mmask32{0} : static_cast<__mmask32>((1U << n) - 1), lo);
+
+    if (n > 32) {
+        const __m512i hi = _mm512_add_epi16(
+            _mm512_cvtepu8_epi16(_mm512_maskz_extracti64x4_epi64(0xFF, packed, 1)), base);
+        _mm512_mask_storeu_epi16(out + 32,
+            n == 64 ? ~__mmask32{0} : static_cast<__mmask32>((1U << (n - 32)) - 1), hi);
+    }
+
+    count = static_cast<uint16_t>(count + n);
+}
+
+/// Build structural index using AVX-512 VBMI2 (64 bytes at a time)
+/// The tail is a masked load, so there is no scalar remainder loop. Once
+/// MAX_FIELDS SOHs are reached the chunk is cut after the last one, which
+/// yields exactly the scalar index for messages with too many fields.
+[[nodiscard]] NFX_HOT NFX_TARGET_AVX512_VBMI2
+inline FIXStructuralIndex build_index_avx512_vbmi2(std::span<const char> data) noexcept {
+    FIXStructuralIndex idx;
+    idx.message_size = static_cast<uint16_t>(data.size());
+
+    const __m512i soh_vec = _mm512_set1_epi8(fix::SOH);
+    const __m512i eq_vec = _mm512_set1_epi8(fix::EQUALS);
+    const char* __restrict ptr = data.data();
+    const size_t len = data.size();
+
+    for (size_t i = 0; i < len; i += 64) {
+        const size_t remaining = len - i;
+        const __mmask64 load_mask = remaining >= 64
+            ? ~__mmask64{0} : (__mmask64{1} << remaining) - 1;
+        const __m512i chunk = _mm512_maskz_loadu_epi8(load_mask, ptr + i);
+
+        __mmask64 soh_mask = _mm512_mask_cmpeq_epi8_mask(load_mask, chunk, soh_vec);
+        __mmask64 eq_mask = _mm512_mask_cmpeq_epi8_mask(load_mask, chunk, eq_vec);
+
+        // Field limit reached in this chunk: drop everything after the
+        // SOH that fills the index
+        const size_t room = MAX_FIELDS - idx.soh_count;
+        const bool last = static_cast<size_t>(
+            std::popcount(static_cast<uint64_t>(soh_mask))) >= room;
+        if (last) [[unlikely]] {
+            uint64_t m = soh_mask;
+            for (size_t k = 1; k < room; ++k) m &= m - 1;
+            const uint64_t keep = (std::countr_zero(m) == 63)
+                ? ~uint64_t{0} : (uint64_t{1} << (std::countr_zero(m) + 1)) - 1;
+            soh_mask &= keep;
+            eq_mask &= keep;
+        }
+
+        compress_positions_vbmi2(soh_mask, i, idx.soh_positions.data(),
+                                 idx.soh_count, MAX_FIELDS);
+        compress_positions_vbmi2(eq_mask, i, idx.equals_positions.data(),
+                                 idx.equals_count, MAX_FIELDS);
+        if (last) [[unlikely]] break;
+    }
+
+    // Post-process to find important tags (same as AVX2)
+    for (uint16_t i = 0; i < idx.equals_count && i < 10; ++i) {
+        uint16_t eq_pos = idx.equals_positions[i];
+        if (eq_pos < 2) continue;
+
+        if (ptr[eq_pos - 2] >= '0' && ptr[eq_pos - 2] <= '9' &&
+            ptr[eq_pos - 1] >= '0' && ptr[eq_pos - 1] <= '9') {
+            int tag = (ptr[eq_pos - 2] - '0') * 10 + (ptr[eq_pos - 1] - '0');
+            if (tag == 35) idx.msg_type_start = eq_pos - 2;
+        }
+        else if (ptr[eq_pos - 1] >= '0' && ptr[eq_pos - 1] <= '9') {
+            int tag = ptr[eq_pos - 1] - '0';
+            if (tag == 9) idx.body_length_start = eq_pos - 1;
+        }
+    }
+
+    if (idx.equals_count > 0) {
+        size_t end_idx = (idx.equals_count > 5) ? idx.equals_count - 5 : 0;
+        for (size_t i = idx.equals_count; i > end_idx; --i) {
+            uint16_t eq_pos = idx.equals_positions[i - 1];
+            if (eq_pos >= 2 && ptr[eq_pos - 2] == '1' && ptr[eq_pos - 1] == '0') {
+                idx.checksum_start = eq_pos - 2;
+                break;
+            }
+        }
+    }
+
+    return idx;
+}
+
+#endif  // AVX-512 VBMI2
+
 #endif  // NFX_HAS_SIMD
 
+#if NFX_HAS_NEON
+
 // ============================================================================
-// Runtime SIMD Dispatch (simdjson-style)
+// ARM NEON / SVE2 Implementations
 // ============================================================================
 
-/// SIMD implementation level
-enum class SimdImpl : uint8_t {
-    Scalar = 0,
-    AVX2 = 1,
-    AVX512 = 2
-};
+namespace detail_idx {
 
-/// Get implementation name
-[[nodiscard]] inline constexpr const char* simd_impl_name(SimdImpl impl) noexcept {
-    switch (impl) {
-        case SimdImpl::Scalar: return "Scalar";
-        case SimdImpl::AVX2:   return "AVX2";
-        case SimdImpl::AVX512: return "AVX-512";
+/// Header tag positions (8/9/35 among the first fields, 10 among the
+/// last), from the '=' positions found by a vector kernel
+inline void locate_header_tags(FIXStructuralIndex& idx, const char* ptr) noexcept {
+    for (uint16_t i = 0; i < idx.equals_count && i < 10; ++i) {
+        const uint16_t eq_pos = idx.equals_positions[i];
+        if (eq_pos < 2) continue;
+        if (ptr[eq_pos - 2] >= '0' && ptr[eq_pos - 2] <= '9' &&
+            ptr[eq_pos - 1] >= '0' && ptr[eq_pos - 1] <= '9') {
+            if (ptr[eq_pos - 2] == '3' && ptr[eq_pos - 1] == '5') idx.msg_type_start = eq_pos - 2;
+        } else if (ptr[eq_pos - 1] == '9') {
+            idx.body_length_start = eq_pos - 1;
+        }
+    }
+
+    const size_t end_idx = (idx.equals_count > 5) ? idx.equals_count - 5 : 0;
+    for (size_t i = idx.equals_count; i > end_idx; --i) {
+        const uint16_t eq_pos = idx.equals_positions[i - 1];
+        if (eq_pos >= 2 && ptr[eq_pos - 2] == '1' && ptr[eq_pos - 1] == '0') {
+            idx.checksum_start = eq_pos - 2;
+            break;
+        }
+    }
+}
+
+/// Append the lanes set in a NEON nibble mask
+NFX_FORCE_INLINE void extract_positions_neon(
+    uint64_t mask,
+    size_t offset,
+    uint16_t* positions,
+    uint16_t& count,
+    uint16_t max_count) noexcept
+{
+    mask &= detail::NEON_LANE_BITS;
+    while (mask != 0 && count < max_count) {
+        positions[count++] = static_cast<uint16_t>(offset + (std::countr_zero(mask) >> 2));
+        mask &= mask - 1;
+    }
+}
+
+}  // namespace detail_idx
+
+/// Build structural index using NEON (16 bytes per compare, vshrn masks)
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_neon(std::span<const char> data) noexcept {
+    FIXStructuralIndex idx;
+    idx.message_size = static_cast<uint16_t>(data.size());
+
+    const uint8x16_t soh_vec = vdupq_n_u8(static_cast<uint8_t>(fix::SOH));
+    const uint8x16_t eq_vec = vdupq_n_u8(static_cast<uint8_t>(fix::EQUALS));
+    const auto* uptr = reinterpret_cast<const uint8_t*>(data.data());
+    const char* ptr = data.data();
+    const size_t simd_end = data.size() & ~size_t{15};
+
+    for (size_t i = 0; i < simd_end && idx.soh_count < MAX_FIELDS; i += 16) {
+        const uint8x16_t chunk = vld1q_u8(uptr + i);
+        detail_idx::extract_positions_neon(
+            detail::neon_nibble_mask(vceqq_u8(chunk, soh_vec)), i,
+            idx.soh_positions.data(), idx.soh_count, MAX_FIELDS);
+        detail_idx::extract_positions_neon(
+            detail::neon_nibble_mask(vceqq_u8(chunk, eq_vec)), i,
+            idx.equals_positions.data(), idx.equals_count, MAX_FIELDS);
+    }
+
+    for (size_t i = simd_end; i < data.size() && idx.soh_count < MAX_FIELDS; ++i) {
+        if (ptr[i] == fix::EQUALS && idx.equals_count < MAX_FIELDS) [[unlikely]] {
+            idx.equals_positions[idx.equals_count++] = static_cast<uint16_t>(i);
+        }
+        else if (ptr[i] == fix::SOH) [[unlikely]] {
+            idx.soh_positions[idx.soh_count++] = static_cast<uint16_t>(i);
+        }
+    }
+
+    detail_idx::locate_header_tags(idx, ptr);
+    return idx;
+}
+
+#if NFX_HAS_SVE2
+
+/// Build structural index using SVE2: one MATCH per register tests for
+/// either structural byte; registers without one are skipped outright
+[[nodiscard]] NFX_HOT
+inline FIXStructuralIndex build_index_sve2(std::span<const char> data) noexcept {
+    FIXStructuralIndex idx;
+    idx.message_size = static_cast<uint16_t>(data.size());
+
+    const auto* uptr = reinterpret_cast<const uint8_t*>(data.data());
+    const uint64_t n = data.size();
+    const svuint8_t structural = svdupq_n_u8(
+        fix::SOH, fix::EQUALS, fix::SOH, fix::EQUALS, fix::SOH, fix::EQUALS, fix::SOH, fix::EQUALS,
+        fix::SOH, fix::EQUALS, fix::SOH, fix::EQUALS, fix::SOH, fix::EQUALS, fix::SOH, fix::EQUALS);
+
+    for (uint64_t i = 0; i < n && idx.soh_count < MAX_FIELDS; i += svcntb()) {
+        const svbool_t pg = svwhilelt_b8_u64(i, n);
+        const svuint8_t chunk = svld1_u8(pg, uptr + i);
+        if (!svptest_any(pg, svmatch_u8(pg, chunk, structural))) continue;
+
+        svbool_t soh = svcmpeq_n_u8(pg, chunk, static_cast<uint8_t>(fix::SOH));
+        svbool_t eq = svcmpeq_n_u8(pg, chunk, static_cast<uint8_t>(fix::EQUALS));
+        while (svptest_any(pg, soh) && idx.soh_count < MAX_FIELDS) {
+            idx.soh_positions[idx.soh_count++] =
+                static_cast<uint16_t>(i + svcntp_b8(pg, svbrkb_b_z(pg, soh)));
+            soh = svbic_b_z(pg, soh, svbrka_b_z(pg, soh));
+        }
+        while (svptest_any(pg, eq) && idx.equals_count < MAX_FIELDS) {
+            idx.equals_positions[idx.equals_count++] =
+                static_cast<uint16_t>(i + svcntp_b8(pg, svbrkb_b_z(pg, eq)));
+            eq = svbic_b_z(pg, eq, svbrka_b_z(pg, eq));
+        }
     }
-    return "Unknown";
+
+    detail_idx::locate_header_tags(idx, data.data());
+    return idx;
 }
 
+#endif  // NFX_HAS_SVE2
+
+#endif  // NFX_HAS_NEON
+
+// ============================================================================
+// Runtime SIMD Dispatch (simdjson-style)
+// ============================================================================
+
 namespace detail {
 
 /// Function pointer type for build_index
@@ -592,37 +909,53 @@ inline BuildIndexFn g_build_index_fn = nullptr;
 inline SimdImpl g_active_impl = SimdImpl::Scalar;
 inline bool g_initialized = false;
 
-/// Detect CPU capabilities at runtime using CPUID
-[[nodiscard]] inline SimdImpl detect_best_impl() noexcept {
-#if NFX_ARCH_X64 || NFX_ARCH_X86
-    // Check for AVX-512 support (both F and BW required)
-    #if defined(__AVX512F__) && defined(__AVX512BW__)
-    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
-        return SimdImpl::AVX512;
-    }
-    #endif
-
-    // Check for AVX2 support
-    #if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
-    if (__builtin_cpu_supports("avx2")) {
-        return SimdImpl::AVX2;
-    }
-    #endif
+/// Tiers compiled into this binary, ascending
+inline constexpr SimdImpl BUILD_INDEX_IMPLS[] = {
+    SimdImpl::Scalar,
+#if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
+    SimdImpl::AVX2,
+#endif
+#if NFX_INDEX_AVX512
+    SimdImpl::AVX512,
+#endif
+#if NFX_INDEX_AVX512_VBMI2
+    SimdImpl::AVX512_VBMI2,
 #endif
+#if NFX_HAS_NEON
+    SimdImpl::NEON,
+#endif
+#if NFX_HAS_SVE2
+    SimdImpl::SVE2,
+#endif
+};
 
-    return SimdImpl::Scalar;
+/// Detect the best compiled-in implementation for this CPU (CPUID)
+[[nodiscard]] inline SimdImpl detect_best_impl() noexcept {
+    return select_simd_impl(BUILD_INDEX_IMPLS, false);
 }
 
 /// Select function pointer based on implementation
 [[nodiscard]] inline BuildIndexFn select_build_index_fn(SimdImpl impl) noexcept {
     switch (impl) {
-#if defined(__AVX512F__) && defined(__AVX512BW__)
+#if NFX_INDEX_AVX512_VBMI2
+        case SimdImpl::AVX512_VBMI2:
+            return build_index_avx512_vbmi2;
+#endif
+#if NFX_INDEX_AVX512
         case SimdImpl::AVX512:
             return build_index_avx512;
 #endif
 #if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
         case SimdImpl::AVX2:
             return build_index_avx2;
+#endif
+#if NFX_HAS_SVE2
+        case SimdImpl::SVE2:
+            return build_index_sve2;
+#endif
+#if NFX_HAS_NEON
+        case SimdImpl::NEON:
+            return build_index_neon;
 #endif
         case SimdImpl::Scalar:
         default:
@@ -633,40 +966,11 @@ inline bool g_initialized = false;
 }  // namespace detail
 
 /// Initialize runtime SIMD dispatch (call once at startup)
+/// NFX_SIMD_IMPL caps the selected tier (for testing).
 inline void init_simd_dispatch() noexcept {
     static std::once_flag flag;
     std::call_once(flag, []() {
-        // Auto-detect best implementation
-        detail::g_active_impl = detail::detect_best_impl();
-
-        // Check for environment override (for testing)
-        const char* impl = nullptr;
-#if defined(_MSC_VER)
-        size_t impl_len = 0;
-        _dupenv_s(const_cast<char**>(&impl), &impl_len, "NFX_SIMD_IMPL");
-#else
-        impl = std::getenv("NFX_SIMD_IMPL");
-#endif
-        if (impl) {
-            if (std::strcmp(impl, "scalar") == 0) {
-                detail::g_active_impl = SimdImpl::Scalar;
-            }
-#if defined(NFX_HAS_SIMD) && NFX_HAS_SIMD
-            else if (std::strcmp(impl, "avx2") == 0) {
-                detail::g_active_impl = SimdImpl::AVX2;
-            }
-#endif
-#if defined(__AVX512F__) && defined(__AVX512BW__)
-            else if (std::strcmp(impl, "avx512") == 0) {
-                detail::g_active_impl = SimdImpl::AVX512;
-            }
-#endif
-#if defined(_MSC_VER)
-            std::free(const_cast<char*>(impl));
-#endif
-        }
-
-        // Set function pointer
+        detail::g_active_impl = select_simd_impl(detail::BUILD_INDEX_IMPLS);
         detail::g_build_index_fn = detail::select_build_index_fn(detail::g_active_impl);
         detail::g_initialized = true;
     });
@@ -689,6 +993,110 @@ inline FIXStructuralIndex build_index(std::span<const char> data) noexcept {
     return detail::g_build_index_fn(data);
 }
 
+/// Continue an index over `data`, which must extend the bytes it already
+/// covers (a message growing in a reassembly buffer, one read at a time).
+/// Scanning resumes after the last SOH indexed: only the incomplete last
+/// field is looked at again, so a message spanning several reads is
+/// scanned about once in total instead of once per read. Messages beyond
+/// uint16 offsets leave the index invalid.
+NFX_HOT
+inline void extend_index(FIXStructuralIndex& idx, std::span<const char> data) noexcept {
+    // '=' of an incomplete last field is found again below
+    idx.equals_count = std::min(idx.equals_count, idx.soh_count);
+    const size_t from = idx.soh_count > 0 ? size_t{idx.soh_positions[idx.soh_count - 1]} + 1 : 0;
+    if (data.size() > UINT16_MAX) [[unlikely]] {
+        idx.equals_count = idx.soh_count + 1;  // Never valid(): callers rescan
+        return;
+    }
+    idx.message_size = static_cast<uint16_t>(data.size());
+    if (data.size() <= from || idx.soh_count >= MAX_FIELDS) return;
+
+    const FIXStructuralIndex part = build_index(data.subspan(from));
+    const char* ptr = data.data();
+    for (uint16_t i = 0; i < part.equals_count && idx.equals_count < MAX_FIELDS; ++i) {
+        const uint16_t eq_pos = static_cast<uint16_t>(from + part.equals_positions[i]);
+        idx.equals_positions[idx.equals_count++] = eq_pos;
+
+        // Header tag hints, as build_index_scalar() sets them
+        if (eq_pos >= 2 && ptr[eq_pos - 2] >= '0' && ptr[eq_pos - 2] <= '9' &&
+            ptr[eq_pos - 1] >= '0' && ptr[eq_pos - 1] <= '9') {
+            if (ptr[eq_pos - 2] == '3' && ptr[eq_pos - 1] == '5') {
+                idx.msg_type_start = eq_pos - 2;
+            } else if (ptr[eq_pos - 2] == '1' && ptr[eq_pos - 1] == '0') {
+                idx.checksum_start = eq_pos - 2;
+            }
+        } else if (eq_pos >= 1 && ptr[eq_pos - 1] == '9') {
+            idx.body_length_start = eq_pos - 1;
+        }
+    }
+    for (uint16_t i = 0; i < part.soh_count && idx.soh_count < MAX_FIELDS; ++i) {
+        idx.soh_positions[idx.soh_count++] = static_cast<uint16_t>(from + part.soh_positions[i]);
+    }
+}
+
+// ============================================================================
+// Dense Tag Lookup (optional, O(1) find_tag)
+// ============================================================================
+
+/// Direct tag -> field index table built from a structural index
+/// Opt-in: only callers that do many lookups per message pay the build cost.
+/// Tags >= MAX_DENSE_TAG fall back to the linear find_tag().
+/// Reusable across messages: rebuild() clears only the slots it set.
+class TagLookupTable {
+public:
+    static constexpr size_t MAX_DENSE_TAG = 1024;
+    static constexpr uint16_t NONE = 0xFFFF;
+
+    TagLookupTable() noexcept {
+        slots_.fill(NONE);
+    }
+
+    /// Index all fields of a message (first occurrence of a tag wins)
+    NFX_HOT
+    void rebuild(const FIXStructuralIndex& idx, std::span<const char> msg) noexcept {
+        clear();
+        idx_ = &idx;
+        msg_ = msg;
+
+        for (size_t i = 0; i < idx.field_count(); ++i) {
+            const int tag = idx.tag_at(msg, i);
+            if (tag > 0 && static_cast<size_t>(tag) < MAX_DENSE_TAG) [[likely]] {
+                if (slots_[tag] == NONE) {
+                    slots_[tag] = static_cast<uint16_t>(i);
+                    touched_[touched_count_++] = static_cast<uint16_t>(tag);
+                }
+            }
+        }
+    }
+
+    /// Field index of tag, or field_count() if absent (same as find_tag)
+    [[nodiscard]] NFX_HOT size_t find(int tag) const noexcept {
+        if (!idx_) [[unlikely]] return 0;
+        if (tag > 0 && static_cast<size_t>(tag) < MAX_DENSE_TAG) [[likely]] {
+            const uint16_t slot = slots_[tag];
+            return slot == NONE ? idx_->field_count() : slot;
+        }
+        return idx_->find_tag(msg_, tag);
+    }
+
+    /// Reset all slots set by the last rebuild()
+    void clear() noexcept {
+        for (size_t i = 0; i < touched_count_; ++i) {
+            slots_[touched_[i]] = NONE;
+        }
+        touched_count_ = 0;
+        idx_ = nullptr;
+        msg_ = {};
+    }
+
+private:
+    std::array<uint16_t, MAX_DENSE_TAG> slots_;
+    std::array<uint16_t, MAX_FIELDS> touched_{};
+    size_t touched_count_{0};
+    const FIXStructuralIndex* idx_{nullptr};
+    std::span<const char> msg_{};
+};
+
 // ============================================================================
 // FIX Field Accessor (lazy parsing from index)
 // ============================================================================
@@ -700,6 +1108,13 @@ public:
     IndexedFieldAccessor(const FIXStructuralIndex& idx, std::span<const char> msg) noexcept
         : idx_{idx}, msg_{msg} {}
 
+    /// Accessor with O(1) tag lookup (table must be rebuilt for this message)
+    IndexedFieldAccessor(
+        const FIXStructuralIndex& idx,
+        std::span<const char> msg,
+        const TagLookupTable& lookup) noexcept
+        : idx_{idx}, msg_{msg}, lookup_{&lookup} {}
+
     /// Get number of fields
     [[nodiscard]] size_t field_count() const noexcept {
         return idx_.field_count();
@@ -715,9 +1130,19 @@ public:
         return idx_.value_at(msg_, field_idx);
     }
 
+    /// Decode every tag number back-to-back (SWAR)
+    /// @return Number of tags written to out
+    size_t decode_tags(std::span<int> out) const noexcept {
+        const size_t n = std::min(out.size(), idx_.field_count());
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = idx_.tag_at(msg_, i);
+        }
+        return n;
+    }
+
     /// Find field by tag and return value (zero-copy)
     [[nodiscard]] std::string_view get(int target_tag) const noexcept {
-        size_t idx = idx_.find_tag(msg_, target_tag);
+        size_t idx = lookup_ ? lookup_->find(target_tag) : idx_.find_tag(msg_, target_tag);
         if (idx < idx_.field_count()) {
             return idx_.value_at(msg_, idx);
         }
@@ -771,6 +1196,7 @@ public:
 private:
     const FIXStructuralIndex& idx_;
     std::span<const char> msg_;
+    const TagLookupTable* lookup_{nullptr};
 };
 
 // ============================================================================
@@ -225,6 +225,19 @@ template <typename T>
                         sockopt_ptr(&flag), sizeof(flag)) == 0;
 }
 
+/// Set SO_REUSEPORT option: sockets bound to the same port share its
+/// connections, spread by the kernel over the listeners (4-tuple hash)
+[[nodiscard]] inline bool set_socket_reuseport(SocketHandle socket, bool enable) noexcept {
+#if defined(SO_REUSEPORT)
+    int flag = enable ? 1 : 0;
+    return ::setsockopt(socket, SOL_SOCKET, SO_REUSEPORT,
+                        sockopt_ptr(&flag), sizeof(flag)) == 0;
+#else
+    (void)socket;
+    return !enable;
+#endif
+}
+
 /// Set socket receive buffer size
 [[nodiscard]] inline bool set_socket_recv_buffer(SocketHandle socket, int size) noexcept {
     return ::setsockopt(socket, SOL_SOCKET, SO_RCVBUF,
@@ -267,6 +280,32 @@ template <typename T>
 #endif
 }
 
+/// Set SO_BUSY_POLL (microseconds the kernel busy-polls the NIC queue on recv)
+/// Returns false where the option is unavailable (non-Linux, old headers)
+[[nodiscard]] inline bool set_socket_busy_poll(SocketHandle socket, int microseconds) noexcept {
+#if defined(SO_BUSY_POLL)
+    return ::setsockopt(socket, SOL_SOCKET, SO_BUSY_POLL,
+                        sockopt_ptr(&microseconds), sizeof(microseconds)) == 0;
+#else
+    (void)socket;
+    (void)microseconds;
+    return false;
+#endif
+}
+
+/// Set SO_PREFER_BUSY_POLL (Linux 5.11+: keep softirq processing off while polling)
+[[nodiscard]] inline bool set_socket_prefer_busy_poll(SocketHandle socket, bool enable) noexcept {
+#if defined(SO_PREFER_BUSY_POLL)
+    int flag = enable ? 1 : 0;
+    return ::setsockopt(socket, SOL_SOCKET, SO_PREFER_BUSY_POLL,
+                        sockopt_ptr(&flag), sizeof(flag)) == 0;
+#else
+    (void)socket;
+    (void)enable;
+    return false;
+#endif
+}
+
 // ============================================================================
 // Error Code Checks
 // ============================================================================
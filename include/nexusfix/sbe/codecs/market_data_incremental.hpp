@@ -0,0 +1,334 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/sbe/message_header.hpp"
+#include "nexusfix/sbe/types/composite_types.hpp"
+#include "nexusfix/sbe/types/group_view.hpp"
+#include "nexusfix/sbe/types/sbe_types.hpp"
+
+namespace nfx::sbe {
+
+// ============================================================================
+// MarketDataIncrementalRefreshCodec: SBE Flyweight Codec for
+// MarketDataIncrementalRefresh (35=X) with an MDEntries repeating group
+// ============================================================================
+//
+// Message Layout (24 + 40 * numInGroup bytes):
+//
+// Header (8 bytes):
+//   Offset 0-7: MessageHeader (blockLength=12, templateId=10)
+//
+// Body (12 bytes):
+//   Offset  0-7: transactTime  int64            Timestamp (nanoseconds)
+//   Offset 8-11: padding       (4 bytes)        Aligns group entries to 8 bytes
+//
+// NoMDEntries group (at message offset 20):
+//   Offset  0-3: GroupSizeEncoding (blockLength=40, numInGroup)
+//   Offset    4: entries, each blockLength bytes:
+//     Offset  0-7:  mdEntryPx      int64            Price (8 decimals)
+//     Offset  8-15: mdEntrySize    int64            Quantity (4 decimals)
+//     Offset 16-19: rptSeq         uint32           Per-instrument sequence
+//     Offset 20-23: numberOfOrders uint32           Orders at the level
+//     Offset 24-31: symbol         FixedString<8>   Instrument symbol
+//     Offset    32: mdUpdateAction char             MDUpdateAction enum
+//     Offset    33: mdEntryType    char             MDEntryType enum
+//     Offset    34: mdPriceLevel   uint8            Book level (1 = top)
+//     Offset 35-39: padding        (5 bytes)        Alignment padding
+//
+// Entries are decoded in place: iterating the group hands out flyweights
+// into the receive buffer, stepping by the blockLength found on the wire.
+
+class MarketDataIncrementalRefreshCodec {
+public:
+    // Message constants
+    static constexpr SbeUint16 TEMPLATE_ID =
+        MessageHeader::TemplateId::MarketDataIncrementalRefresh;
+    static constexpr std::size_t BLOCK_LENGTH = 12;
+    static constexpr std::size_t GROUP_OFFSET = MessageHeader::SIZE + BLOCK_LENGTH;
+    static constexpr std::size_t ENTRY_BLOCK_LENGTH = 40;
+    static constexpr std::size_t MIN_SIZE = GROUP_OFFSET + GroupSizeEncoding::SIZE;
+
+    // Buffer size that holds MAX_ENTRIES entries (used for buffer sizing)
+    static constexpr std::size_t MAX_ENTRIES = 32;
+    static constexpr std::size_t TOTAL_SIZE = MIN_SIZE + MAX_ENTRIES * ENTRY_BLOCK_LENGTH;
+
+    // Field offsets within the body (after header)
+    struct Offset {
+        static constexpr std::size_t TransactTime = 0;
+        static constexpr std::size_t Padding = 8;
+    };
+
+    // Field sizes
+    struct Size {
+        static constexpr std::size_t TransactTime = 8;
+        static constexpr std::size_t Padding = 4;
+    };
+
+    // Field offsets within one group entry
+    struct EntryOffset {
+        static constexpr std::size_t MDEntryPx = 0;
+        static constexpr std::size_t MDEntrySize = 8;
+        static constexpr std::size_t RptSeq = 16;
+        static constexpr std::size_t NumberOfOrders = 20;
+        static constexpr std::size_t Symbol = 24;
+        static constexpr std::size_t MDUpdateAction = 32;
+        static constexpr std::size_t MDEntryType = 33;
+        static constexpr std::size_t MDPriceLevel = 34;
+        static constexpr std::size_t Padding = 35;
+    };
+
+    // Wire size for a message with the given number of entries
+    [[nodiscard]] static constexpr std::size_t encodedSize(std::size_t entries) noexcept {
+        return MIN_SIZE + entries * ENTRY_BLOCK_LENGTH;
+    }
+
+    // ========================================================================
+    // Group Entry Flyweights
+    // ========================================================================
+
+    // Read-only view of one MDEntries entry
+    class Entry {
+    public:
+        explicit Entry(const char* entry) noexcept : entry_{entry} {}
+
+        [[nodiscard]] NFX_HOT NFX_FORCE_INLINE FixedPrice mdEntryPx() const noexcept {
+            return DecimalPrice::decode(entry_ + EntryOffset::MDEntryPx);
+        }
+
+        [[nodiscard]] NFX_HOT NFX_FORCE_INLINE Qty mdEntrySize() const noexcept {
+            return DecimalQty::decode(entry_ + EntryOffset::MDEntrySize);
+        }
+
+        [[nodiscard]] NFX_HOT NFX_FORCE_INLINE SbeUint32 rptSeq() const noexcept {
+            return read_uint32(entry_ + EntryOffset::RptSeq);
+        }
+
+        [[nodiscard]] NFX_HOT NFX_FORCE_INLINE SbeUint32 numberOfOrders() const noexcept {
+            return read_uint32(entry_ + EntryOffset::NumberOfOrders);
+        }
+
+        [[nodiscard]] NFX_HOT NFX_FORCE_INLINE std::string_view symbol() const noexcept {
+            return FixedString8::decode(entry_ + EntryOffset::Symbol);
+        }
+
+        [[nodiscard]] NFX_HOT NFX_FORCE_INLINE MDUpdateAction mdUpdateAction() const noexcept {
+            return SbeMDUpdateAction::decode(entry_ + EntryOffset::MDUpdateAction);
+        }
+
+        [[nodiscard]] NFX_HOT NFX_FORCE_INLINE MDEntryType mdEntryType() const noexcept {
+            return SbeMDEntryType::decode(entry_ + EntryOffset::MDEntryType);
+        }
+
+        [[nodiscard]] NFX_HOT NFX_FORCE_INLINE SbeUint8 mdPriceLevel() const noexcept {
+            return read_uint8(entry_ + EntryOffset::MDPriceLevel);
+        }
+
+    private:
+        const char* entry_;
+    };
+
+    // Writable view of one MDEntries entry (fluent interface)
+    class EntryEncoder {
+    public:
+        explicit EntryEncoder(char* entry) noexcept : entry_{entry} {}
+
+        NFX_FORCE_INLINE EntryEncoder& mdEntryPx(FixedPrice value) noexcept {
+            DecimalPrice::encode(entry_ + EntryOffset::MDEntryPx, value);
+            return *this;
+        }
+
+        NFX_FORCE_INLINE EntryEncoder& mdEntrySize(Qty value) noexcept {
+            DecimalQty::encode(entry_ + EntryOffset::MDEntrySize, value);
+            return *this;
+        }
+
+        NFX_FORCE_INLINE EntryEncoder& rptSeq(SbeUint32 value) noexcept {
+            write_uint32(entry_ + EntryOffset::RptSeq, value);
+            return *this;
+        }
+
+        NFX_FORCE_INLINE EntryEncoder& numberOfOrders(SbeUint32 value) noexcept {
+            write_uint32(entry_ + EntryOffset::NumberOfOrders, value);
+            return *this;
+        }
+
+        NFX_FORCE_INLINE EntryEncoder& symbol(std::string_view value) noexcept {
+            FixedString8::encode(entry_ + EntryOffset::Symbol, value);
+            return *this;
+        }
+
+        NFX_FORCE_INLINE EntryEncoder& mdUpdateAction(MDUpdateAction value) noexcept {
+            SbeMDUpdateAction::encode(entry_ + EntryOffset::MDUpdateAction, value);
+            return *this;
+        }
+
+        NFX_FORCE_INLINE EntryEncoder& mdEntryType(MDEntryType value) noexcept {
+            SbeMDEntryType::encode(entry_ + EntryOffset::MDEntryType, value);
+            return *this;
+        }
+
+        NFX_FORCE_INLINE EntryEncoder& mdPriceLevel(SbeUint8 value) noexcept {
+            write_uint8(entry_ + EntryOffset::MDPriceLevel, value);
+            return *this;
+        }
+
+    private:
+        char* entry_;
+    };
+
+    // In-place view of the MDEntries group (forward range of Entry)
+    using Entries = GroupView<Entry>;
+
+    // ========================================================================
+    // Decode API (Zero-Copy Flyweight)
+    // ========================================================================
+
+    // Wrap existing buffer for decoding
+    [[nodiscard]] NFX_FORCE_INLINE static MarketDataIncrementalRefreshCodec wrapForDecode(
+        const char* buffer, std::size_t length) noexcept {
+        return MarketDataIncrementalRefreshCodec{buffer, length, false};
+    }
+
+    // Check if buffer is valid for this message type, including every
+    // group entry it declares
+    [[nodiscard]] NFX_FORCE_INLINE bool isValid() const noexcept {
+        if (buffer_ == nullptr || length_ < MIN_SIZE) {
+            return false;
+        }
+        auto header = MessageHeader::wrapForDecode(buffer_, length_);
+        if (!header.isValid() ||
+            header.templateId() != TEMPLATE_ID ||
+            header.blockLength() != BLOCK_LENGTH) {
+            return false;
+        }
+        const std::size_t stride = entryBlockLength();
+        return stride >= ENTRY_BLOCK_LENGTH &&
+               check_bounds(MIN_SIZE, entryCount() * stride, length_);
+    }
+
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE Timestamp transactTime() const noexcept {
+        return SbeTimestamp::decode(body() + Offset::TransactTime);
+    }
+
+    // Number of entries in the MDEntries group
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE std::size_t entryCount() const noexcept {
+        return GroupSizeEncoding::numInGroup(buffer_ + GROUP_OFFSET);
+    }
+
+    // Entry size on the wire (>= ENTRY_BLOCK_LENGTH)
+    [[nodiscard]] NFX_FORCE_INLINE std::size_t entryBlockLength() const noexcept {
+        return GroupSizeEncoding::blockLength(buffer_ + GROUP_OFFSET);
+    }
+
+    // MDEntries group, iterated in place (call isValid() first)
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE Entries entries() const noexcept {
+        return Entries{buffer_ + MIN_SIZE, entryCount(), entryBlockLength()};
+    }
+
+    // Get pointer to message body
+    [[nodiscard]] NFX_FORCE_INLINE const char* body() const noexcept {
+        return buffer_ + MessageHeader::SIZE;
+    }
+
+    // Get header
+    [[nodiscard]] NFX_FORCE_INLINE MessageHeader header() const noexcept {
+        return MessageHeader::wrapForDecode(buffer_, length_);
+    }
+
+    // ========================================================================
+    // Encode API (Fluent Builder)
+    // ========================================================================
+
+    // Wrap buffer for encoding
+    [[nodiscard]] NFX_FORCE_INLINE static MarketDataIncrementalRefreshCodec wrapForEncode(
+        char* buffer, std::size_t length) noexcept {
+        return MarketDataIncrementalRefreshCodec{buffer, length, true};
+    }
+
+    // Encode header and an empty group (call first)
+    NFX_FORCE_INLINE MarketDataIncrementalRefreshCodec& encodeHeader() noexcept {
+        auto header = MessageHeader::wrapForEncode(mutableBuffer(), length_);
+        header.encodeHeader(BLOCK_LENGTH, TEMPLATE_ID);
+        // Clear body to ensure clean padding
+        std::memset(mutableBody(), 0, BLOCK_LENGTH);
+        GroupSizeEncoding::encode(mutableBuffer() + GROUP_OFFSET,
+                                  ENTRY_BLOCK_LENGTH, 0);
+        return *this;
+    }
+
+    NFX_FORCE_INLINE MarketDataIncrementalRefreshCodec& transactTime(Timestamp value) noexcept {
+        SbeTimestamp::encode(mutableBody() + Offset::TransactTime, value);
+        return *this;
+    }
+
+    // Declare the number of entries; clamped to what the buffer holds.
+    // Entries are zeroed and then filled through entry(i).
+    NFX_FORCE_INLINE MarketDataIncrementalRefreshCodec& entryCount(std::size_t count) noexcept {
+        const std::size_t fits = length_ > MIN_SIZE
+            ? (length_ - MIN_SIZE) / ENTRY_BLOCK_LENGTH : 0;
+        count = std::min({count, fits, static_cast<std::size_t>(null_value::UINT16 - 1)});
+        GroupSizeEncoding::encode(mutableBuffer() + GROUP_OFFSET, ENTRY_BLOCK_LENGTH,
+                                  static_cast<SbeUint16>(count));
+        std::memset(mutableBuffer() + MIN_SIZE, 0, count * ENTRY_BLOCK_LENGTH);
+        return *this;
+    }
+
+    // Writable entry at index (< the count passed to entryCount())
+    [[nodiscard]] NFX_FORCE_INLINE EntryEncoder entry(std::size_t index) noexcept {
+        return EntryEncoder{mutableBuffer() + MIN_SIZE + index * ENTRY_BLOCK_LENGTH};
+    }
+
+    // Get encoded message as span
+    [[nodiscard]] NFX_FORCE_INLINE std::span<const char> encoded() const noexcept {
+        return std::span<const char>{buffer_, encodedSize(entryCount())};
+    }
+
+    // Get mutable body pointer
+    [[nodiscard]] NFX_FORCE_INLINE char* mutableBody() noexcept {
+        return mutableBuffer() + MessageHeader::SIZE;
+    }
+
+    // Get mutable buffer pointer
+    [[nodiscard]] NFX_FORCE_INLINE char* mutableBuffer() noexcept {
+        return const_cast<char*>(buffer_);
+    }
+
+private:
+    explicit MarketDataIncrementalRefreshCodec(const char* buffer, std::size_t length,
+                                               bool /*forEncode*/) noexcept
+        : buffer_{buffer}, length_{length} {}
+
+    const char* buffer_{nullptr};
+    std::size_t length_{0};
+};
+
+// ============================================================================
+// Static Assertions: Verify Layout
+// ============================================================================
+
+static_assert(MarketDataIncrementalRefreshCodec::MIN_SIZE == 24,
+              "MarketDataIncrementalRefresh fixed part must be 24 bytes");
+static_assert(MarketDataIncrementalRefreshCodec::MIN_SIZE % 8 == 0,
+              "Group entries must start 8-byte aligned");
+static_assert(MarketDataIncrementalRefreshCodec::ENTRY_BLOCK_LENGTH % 8 == 0,
+              "Group entries must stay 8-byte aligned");
+
+static_assert(MarketDataIncrementalRefreshCodec::Offset::Padding +
+              MarketDataIncrementalRefreshCodec::Size::Padding ==
+              MarketDataIncrementalRefreshCodec::BLOCK_LENGTH,
+              "Body layout must match BLOCK_LENGTH");
+static_assert(MarketDataIncrementalRefreshCodec::EntryOffset::Padding + 5 ==
+              MarketDataIncrementalRefreshCodec::ENTRY_BLOCK_LENGTH,
+              "Entry layout must match ENTRY_BLOCK_LENGTH");
+static_assert(std::forward_iterator<MarketDataIncrementalRefreshCodec::Entries::Iterator>);
+
+}  // namespace nfx::sbe
@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/sbe/message_header.hpp"
+#include "nexusfix/sbe/types/composite_types.hpp"
+#include "nexusfix/sbe/types/sbe_types.hpp"
+
+namespace nfx::sbe {
+
+// ============================================================================
+// OrderCancelRejectCodec: SBE Flyweight Codec for OrderCancelReject (35=9)
+// ============================================================================
+//
+// Message Layout (80 bytes total: 8 header + 72 body):
+//
+// Header (8 bytes):
+//   Offset 0-7: MessageHeader (blockLength=72, templateId=9)
+//
+// Body (72 bytes):
+//   Offset  0-19: orderId          FixedString<20>  Exchange Order ID
+//   Offset 20-39: clOrdId          FixedString<20>  ClOrdID of the rejected request
+//   Offset 40-59: origClOrdId      FixedString<20>  ClOrdID of the working order
+//   Offset    60: ordStatus        char             Status of the working order
+//   Offset    61: cxlRejResponseTo char             '1'=Cancel, '2'=Cancel/Replace
+//   Offset 62-63: cxlRejReason     uint16           Reject reason (tag 102)
+//   Offset 64-71: transactTime     int64            Timestamp (nanoseconds)
+//
+// All int64 fields are 8-byte aligned for optimal memory access.
+
+class OrderCancelRejectCodec {
+public:
+    // Message constants
+    static constexpr SbeUint16 TEMPLATE_ID = MessageHeader::TemplateId::OrderCancelReject;
+    static constexpr std::size_t BLOCK_LENGTH = 72;
+    static constexpr std::size_t TOTAL_SIZE = MessageHeader::SIZE + BLOCK_LENGTH;
+
+    // CxlRejResponseTo (tag 434) values
+    struct ResponseTo {
+        static constexpr char CancelRequest = '1';
+        static constexpr char CancelReplaceRequest = '2';
+    };
+
+    // Field offsets within the body (after header)
+    struct Offset {
+        static constexpr std::size_t OrderId = 0;
+        static constexpr std::size_t ClOrdId = 20;
+        static constexpr std::size_t OrigClOrdId = 40;
+        static constexpr std::size_t OrdStatus = 60;
+        static constexpr std::size_t CxlRejResponseTo = 61;
+        static constexpr std::size_t CxlRejReason = 62;
+        static constexpr std::size_t TransactTime = 64;
+    };
+
+    // Field sizes
+    struct Size {
+        static constexpr std::size_t OrderId = 20;
+        static constexpr std::size_t ClOrdId = 20;
+        static constexpr std::size_t OrigClOrdId = 20;
+        static constexpr std::size_t OrdStatus = 1;
+        static constexpr std::size_t CxlRejResponseTo = 1;
+        static constexpr std::size_t CxlRejReason = 2;
+        static constexpr std::size_t TransactTime = 8;
+    };
+
+    // ========================================================================
+    // Decode API (Zero-Copy Flyweight)
+    // ========================================================================
+
+    // Wrap existing buffer for decoding
+    [[nodiscard]] NFX_FORCE_INLINE static OrderCancelRejectCodec wrapForDecode(
+        const char* buffer, std::size_t length) noexcept {
+        return OrderCancelRejectCodec{buffer, length, false};
+    }
+
+    // Check if buffer is valid for this message type
+    [[nodiscard]] NFX_FORCE_INLINE bool isValid() const noexcept {
+        if (buffer_ == nullptr || length_ < TOTAL_SIZE) {
+            return false;
+        }
+        auto header = MessageHeader::wrapForDecode(buffer_, length_);
+        return header.isValid() &&
+               header.templateId() == TEMPLATE_ID &&
+               header.blockLength() == BLOCK_LENGTH;
+    }
+
+    // Field accessors (hot path, zero-copy)
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE std::string_view orderId() const noexcept {
+        return FixedString20::decode(body() + Offset::OrderId);
+    }
+
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE std::string_view clOrdId() const noexcept {
+        return FixedString20::decode(body() + Offset::ClOrdId);
+    }
+
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE std::string_view origClOrdId() const noexcept {
+        return FixedString20::decode(body() + Offset::OrigClOrdId);
+    }
+
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE OrdStatus ordStatus() const noexcept {
+        return SbeOrdStatus::decode(body() + Offset::OrdStatus);
+    }
+
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE char cxlRejResponseTo() const noexcept {
+        return read_char(body() + Offset::CxlRejResponseTo);
+    }
+
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE SbeUint16 cxlRejReason() const noexcept {
+        return read_uint16(body() + Offset::CxlRejReason);
+    }
+
+    [[nodiscard]] NFX_HOT NFX_FORCE_INLINE Timestamp transactTime() const noexcept {
+        return SbeTimestamp::decode(body() + Offset::TransactTime);
+    }
+
+    // Get pointer to message body
+    [[nodiscard]] NFX_FORCE_INLINE const char* body() const noexcept {
+        return buffer_ + MessageHeader::SIZE;
+    }
+
+    // Get header
+    [[nodiscard]] NFX_FORCE_INLINE MessageHeader header() const noexcept {
+        return MessageHeader::wrapForDecode(buffer_, length_);
+    }
+
+    // ========================================================================
+    // Encode API (Fluent Builder)
+    // ========================================================================
+
+    // Wrap buffer for encoding
+    [[nodiscard]] NFX_FORCE_INLINE static OrderCancelRejectCodec wrapForEncode(
+        char* buffer, std::size_t length) noexcept {
+        return OrderCancelRejectCodec{buffer, length, true};
+    }
+
+    // Encode header (call first)
+    NFX_FORCE_INLINE OrderCancelRejectCodec& encodeHeader() noexcept {
+        auto header = MessageHeader::wrapForEncode(mutableBuffer(), length_);
+        header.encodeHeader(BLOCK_LENGTH, TEMPLATE_ID);
+        // Clear body to ensure clean padding
+        std::memset(mutableBody(), 0, BLOCK_LENGTH);
+        return *this;
+    }
+
+    // Field encoders (fluent interface, return *this)
+    NFX_FORCE_INLINE OrderCancelRejectCodec& orderId(std::string_view value) noexcept {
+        FixedString20::encode(mutableBody() + Offset::OrderId, value);
+        return *this;
+    }
+
+    NFX_FORCE_INLINE OrderCancelRejectCodec& clOrdId(std::string_view value) noexcept {
+        FixedString20::encode(mutableBody() + Offset::ClOrdId, value);
+        return *this;
+    }
+
+    NFX_FORCE_INLINE OrderCancelRejectCodec& origClOrdId(std::string_view value) noexcept {
+        FixedString20::encode(mutableBody() + Offset::OrigClOrdId, value);
+        return *this;
+    }
+
+    NFX_FORCE_INLINE OrderCancelRejectCodec& ordStatus(OrdStatus value) noexcept {
+        SbeOrdStatus::encode(mutableBody() + Offset::OrdStatus, value);
+        return *this;
+    }
+
+    NFX_FORCE_INLINE OrderCancelRejectCodec& cxlRejResponseTo(char value) noexcept {
+        write_char(mutableBody() + Offset::CxlRejResponseTo, value);
+        return *this;
+    }
+
+    NFX_FORCE_INLINE OrderCancelRejectCodec& cxlRejReason(SbeUint16 value) noexcept {
+        write_uint16(mutableBody() + Offset::CxlRejReason, value);
+        return *this;
+    }
+
+    NFX_FORCE_INLINE OrderCancelRejectCodec& transactTime(Timestamp value) noexcept {
+        SbeTimestamp::encode(mutableBody() + Offset::TransactTime, value);
+        return *this;
+    }
+
+    // Get encoded message as span
+    [[nodiscard]] NFX_FORCE_INLINE std::span<const char> encoded() const noexcept {
+        return std::span<const char>{buffer_, TOTAL_SIZE};
+    }
+
+    // Get total encoded size
+    [[nodiscard]] static constexpr std::size_t encodedSize() noexcept {
+        return TOTAL_SIZE;
+    }
+
+    // Get mutable body pointer
+    [[nodiscard]] NFX_FORCE_INLINE char* mutableBody() noexcept {
+        return mutableBuffer() + MessageHeader::SIZE;
+    }
+
+    // Get mutable buffer pointer
+    [[nodiscard]] NFX_FORCE_INLINE char* mutableBuffer() noexcept {
+        return const_cast<char*>(buffer_);
+    }
+
+private:
+    explicit OrderCancelRejectCodec(const char* buffer, std::size_t length,
+                                    bool /*forEncode*/) noexcept
+        : buffer_{buffer}, length_{length} {}
+
+    const char* buffer_{nullptr};
+    std::size_t length_{0};
+};
+
+// ============================================================================
+// Static Assertions: Verify Layout
+// ============================================================================
+
+static_assert(OrderCancelRejectCodec::TOTAL_SIZE == 80,
+              "OrderCancelReject must be 80 bytes (8 header + 72 body)");
+
+static_assert(OrderCancelRejectCodec::Offset::CxlRejReason % 2 == 0,
+              "CxlRejReason must be 2-byte aligned");
+static_assert(OrderCancelRejectCodec::Offset::TransactTime % 8 == 0,
+              "TransactTime must be 8-byte aligned");
+
+static_assert(OrderCancelRejectCodec::Offset::TransactTime +
+              OrderCancelRejectCodec::Size::TransactTime ==
+              OrderCancelRejectCodec::BLOCK_LENGTH,
+              "Body layout must match BLOCK_LENGTH");
+
+}  // namespace nfx::sbe
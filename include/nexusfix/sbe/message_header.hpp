@@ -33,7 +33,11 @@ public:
     // Template IDs for NexusFix messages
     struct TemplateId {
         static constexpr SbeUint16 NewOrderSingle = 1;
+        static constexpr SbeUint16 OrderCancelRequest = 2;
+        static constexpr SbeUint16 OrderCancelReplaceRequest = 3;
         static constexpr SbeUint16 ExecutionReport = 8;
+        static constexpr SbeUint16 OrderCancelReject = 9;
+        static constexpr SbeUint16 MarketDataIncrementalRefresh = 10;
     };
 
     // Field offsets within the header
@@ -12,7 +12,11 @@
 //
 // Message Types:
 //   - NewOrderSingle (templateId=1, 64 bytes)
+//   - OrderCancelRequest (templateId=2, 80 bytes)
+//   - OrderCancelReplaceRequest (templateId=3, 88 bytes)
 //   - ExecutionReport (templateId=8, 144 bytes)
+//   - OrderCancelReject (templateId=9, 80 bytes)
+//   - MarketDataIncrementalRefresh (templateId=10, 24 + 40 per entry)
 //
 // Usage (Decode):
 //   auto msg = sbe::ExecutionReportCodec::wrapForDecode(buffer, length);
@@ -32,14 +36,35 @@
 //
 // Usage (Dispatch):
 //   sbe::dispatch(buffer, length, [](auto& codec) {
-//       // codec is NewOrderSingleCodec or ExecutionReportCodec
+//       // codec is one of the codecs below, or UnknownMessage
 //   });
+//
+// Usage (Repeating Group):
+//   auto md = sbe::MarketDataIncrementalRefreshCodec::wrapForDecode(buffer, length);
+//   if (md.isValid()) {
+//       for (auto entry : md.entries()) {   // In place, no copies
+//           book.apply(entry.symbol(), entry.mdEntryPx(), entry.mdEntrySize());
+//       }
+//   }
+//
+// FIX Gateways:
+//   nexusfix/sbe/transcoder.hpp converts tag-value FIX (IndexedFieldAccessor)
+//   to SBE codecs and ExecutionReportCodec back to FIX, without doubles.
+//
+// Venue Schemas:
+//   Codecs for other SBE schemas are generated from their XML at build time
+//   (scripts/sbe_codegen.py, via nfx_sbe_generate() in cmake/NexusfixSbe.cmake)
+//   with the same flyweight API, plus a per-schema dispatch() in schema.hpp.
 
 #include "nexusfix/sbe/message_header.hpp"
 #include "nexusfix/sbe/types/sbe_types.hpp"
 #include "nexusfix/sbe/types/composite_types.hpp"
 #include "nexusfix/sbe/codecs/new_order_single.hpp"
 #include "nexusfix/sbe/codecs/execution_report.hpp"
+#include "nexusfix/sbe/codecs/order_cancel_request.hpp"
+#include "nexusfix/sbe/codecs/order_cancel_replace_request.hpp"
+#include "nexusfix/sbe/codecs/order_cancel_reject.hpp"
+#include "nexusfix/sbe/codecs/market_data_incremental.hpp"
 
 namespace nfx::sbe {
 
@@ -57,7 +82,11 @@ struct UnknownMessage {
 // Dispatch to appropriate codec based on template ID
 // Handler signature: void(auto& codec) where codec is one of:
 //   - NewOrderSingleCodec
+//   - OrderCancelRequestCodec
+//   - OrderCancelReplaceRequestCodec
 //   - ExecutionReportCodec
+//   - OrderCancelRejectCodec
+//   - MarketDataIncrementalRefreshCodec
 //   - UnknownMessage
 template <typename Handler>
 NFX_HOT NFX_FORCE_INLINE void dispatch(
@@ -83,11 +112,31 @@ NFX_HOT NFX_FORCE_INLINE void dispatch(
             handler(codec);
             break;
         }
+        case MessageHeader::TemplateId::OrderCancelRequest: {
+            auto codec = OrderCancelRequestCodec::wrapForDecode(buffer, length);
+            handler(codec);
+            break;
+        }
+        case MessageHeader::TemplateId::OrderCancelReplaceRequest: {
+            auto codec = OrderCancelReplaceRequestCodec::wrapForDecode(buffer, length);
+            handler(codec);
+            break;
+        }
         case MessageHeader::TemplateId::ExecutionReport: {
             auto codec = ExecutionReportCodec::wrapForDecode(buffer, length);
             handler(codec);
             break;
         }
+        case MessageHeader::TemplateId::OrderCancelReject: {
+            auto codec = OrderCancelRejectCodec::wrapForDecode(buffer, length);
+            handler(codec);
+            break;
+        }
+        case MessageHeader::TemplateId::MarketDataIncrementalRefresh: {
+            auto codec = MarketDataIncrementalRefreshCodec::wrapForDecode(buffer, length);
+            handler(codec);
+            break;
+        }
         default: {
             UnknownMessage unknown{templateId, buffer, length};
             handler(unknown);
@@ -116,6 +165,18 @@ struct is_sbe_codec<NewOrderSingleCodec> : std::true_type {};
 template <>
 struct is_sbe_codec<ExecutionReportCodec> : std::true_type {};
 
+template <>
+struct is_sbe_codec<OrderCancelRequestCodec> : std::true_type {};
+
+template <>
+struct is_sbe_codec<OrderCancelReplaceRequestCodec> : std::true_type {};
+
+template <>
+struct is_sbe_codec<OrderCancelRejectCodec> : std::true_type {};
+
+template <>
+struct is_sbe_codec<MarketDataIncrementalRefreshCodec> : std::true_type {};
+
 template <typename T>
 inline constexpr bool is_sbe_codec_v = is_sbe_codec<T>::value;
 
@@ -128,6 +189,7 @@ concept SbeCodec = is_sbe_codec_v<T>;
 // ============================================================================
 
 // Get required buffer size for a message type
+// (MarketDataIncrementalRefresh: room for MAX_ENTRIES group entries)
 template <SbeCodec T>
 [[nodiscard]] constexpr std::size_t required_buffer_size() noexcept {
     return T::TOTAL_SIZE;
@@ -135,7 +197,11 @@ template <SbeCodec T>
 
 // Maximum message size across all supported types
 inline constexpr std::size_t MAX_MESSAGE_SIZE =
-    std::max(NewOrderSingleCodec::TOTAL_SIZE,
-             ExecutionReportCodec::TOTAL_SIZE);
+    std::max({NewOrderSingleCodec::TOTAL_SIZE,
+              ExecutionReportCodec::TOTAL_SIZE,
+              OrderCancelRequestCodec::TOTAL_SIZE,
+              OrderCancelReplaceRequestCodec::TOTAL_SIZE,
+              OrderCancelRejectCodec::TOTAL_SIZE,
+              MarketDataIncrementalRefreshCodec::TOTAL_SIZE});
 
 }  // namespace nfx::sbe
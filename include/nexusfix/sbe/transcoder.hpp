@@ -0,0 +1,374 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+// ============================================================================
+// FIX Tag-Value <-> SBE Transcoding
+// ============================================================================
+//
+// Gateway path between tag-value FIX clients and SBE venues without
+// intermediate message structs:
+//
+//   FIX -> SBE: IndexedFieldAccessor values are parsed straight into the
+//               codec buffer (FixedPrice/Qty::from_string into the SBE
+//               decimal composites, UTCTimestamp into nanoseconds).
+//   SBE -> FIX: ExecutionReportCodec fields are formatted straight into a
+//               FastMessageBuilder (FixedPrice/Qty::to_chars, exact text).
+//
+// Prices and quantities never pass through double. Strings longer than the
+// SBE fixed-width field are rejected rather than silently truncated.
+//
+// Usage (FIX -> SBE):
+//   simd::IndexedFieldAccessor fix{index, msg, lookup};
+//   alignas(8) char out[sbe::MAX_MESSAGE_SIZE];
+//   auto len = sbe::fix_to_sbe(fix, out, sizeof(out));   // 35=D/F/G
+//   if (len) venue.send({out, *len});
+//
+// Usage (SBE -> FIX):
+//   sbe::ExecutionReportTranscoder er;
+//   er.prepare("FIX.4.4", "GATEWAY", "CLIENT");          // once, at logon
+//   auto fix = er.build(codec, seq_num, sending_time);
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/parser/structural_index.hpp"
+#include "nexusfix/serializer/constexpr_serializer.hpp"
+#include "nexusfix/sbe/message_header.hpp"
+#include "nexusfix/sbe/codecs/new_order_single.hpp"
+#include "nexusfix/sbe/codecs/order_cancel_request.hpp"
+#include "nexusfix/sbe/codecs/order_cancel_replace_request.hpp"
+#include "nexusfix/sbe/codecs/execution_report.hpp"
+
+namespace nfx::sbe {
+
+namespace detail {
+
+// ============================================================================
+// Field Readers (FIX text -> SBE fields)
+// ============================================================================
+
+/// Required field value, or MissingRequiredField for the tag
+template <int Tag>
+[[nodiscard]] NFX_FORCE_INLINE ParseResult<std::string_view> required(
+    const simd::IndexedFieldAccessor& fix) noexcept {
+    std::string_view v = fix.get(Tag);
+    if (v.empty()) [[unlikely]] {
+        return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField, Tag}};
+    }
+    return v;
+}
+
+/// Required fixed-width string field; longer values are a format error
+template <int Tag, std::size_t N>
+[[nodiscard]] NFX_FORCE_INLINE ParseResult<std::string_view> required_string(
+    const simd::IndexedFieldAccessor& fix) noexcept {
+    auto v = required<Tag>(fix);
+    if (v && v->size() > N) [[unlikely]] {
+        return std::unexpected{ParseError{ParseErrorCode::InvalidFieldFormat, Tag}};
+    }
+    return v;
+}
+
+/// TransactTime (60): absent maps to the SBE null timestamp
+[[nodiscard]] NFX_FORCE_INLINE ParseResult<bool> transact_time(
+    const simd::IndexedFieldAccessor& fix, char* field) noexcept {
+    std::string_view v = fix.get(tag::TransactTime::value);
+    if (v.empty()) {
+        SbeTimestamp::write_null(field);
+        return true;
+    }
+    auto ts = Timestamp::from_utc_string(v);
+    if (!ts) [[unlikely]] {
+        return std::unexpected{
+            ParseError{ParseErrorCode::InvalidFieldFormat, tag::TransactTime::value}};
+    }
+    SbeTimestamp::encode(field, *ts);
+    return true;
+}
+
+/// Price (44): absent (market orders) maps to the SBE null price
+NFX_FORCE_INLINE void optional_price(
+    const simd::IndexedFieldAccessor& fix, char* field) noexcept {
+    std::string_view v = fix.get(tag::Price::value);
+    if (v.empty()) {
+        DecimalPrice::write_null(field);
+    } else {
+        DecimalPrice::encode(field, FixedPrice::from_string(v));
+    }
+}
+
+[[nodiscard]] NFX_FORCE_INLINE ParseResult<std::size_t> check_msg_type(
+    const simd::IndexedFieldAccessor& fix, char expected, std::size_t length,
+    std::size_t needed) noexcept {
+    if (fix.msg_type() != expected) [[unlikely]] {
+        return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType, tag::MsgType::value}};
+    }
+    if (length < needed) [[unlikely]] {
+        return std::unexpected{ParseError{ParseErrorCode::BufferTooShort}};
+    }
+    return needed;
+}
+
+}  // namespace detail
+
+// ============================================================================
+// FIX -> SBE
+// ============================================================================
+
+/// NewOrderSingle (35=D) into a NewOrderSingleCodec buffer
+/// Required: ClOrdID(11), Symbol(55), Side(54), OrdType(40), OrderQty(38)
+/// @return Encoded size
+[[nodiscard]] NFX_HOT inline ParseResult<std::size_t> transcode_new_order_single(
+    const simd::IndexedFieldAccessor& fix, char* buffer, std::size_t length) noexcept {
+    auto size = detail::check_msg_type(fix, 'D', length, NewOrderSingleCodec::TOTAL_SIZE);
+    if (!size) [[unlikely]] return size;
+
+    auto cl_ord_id = detail::required_string<tag::ClOrdID::value, 20>(fix);
+    if (!cl_ord_id) [[unlikely]] return std::unexpected{cl_ord_id.error()};
+    auto symbol = detail::required_string<tag::Symbol::value, 8>(fix);
+    if (!symbol) [[unlikely]] return std::unexpected{symbol.error()};
+    auto side = detail::required<tag::Side::value>(fix);
+    if (!side) [[unlikely]] return std::unexpected{side.error()};
+    auto ord_type = detail::required<tag::OrdType::value>(fix);
+    if (!ord_type) [[unlikely]] return std::unexpected{ord_type.error()};
+    auto qty = detail::required<tag::OrderQty::value>(fix);
+    if (!qty) [[unlikely]] return std::unexpected{qty.error()};
+
+    auto codec = NewOrderSingleCodec::wrapForEncode(buffer, length);
+    codec.encodeHeader()
+        .clOrdId(*cl_ord_id)
+        .symbol(*symbol)
+        .side(static_cast<Side>((*side)[0]))
+        .ordType(static_cast<OrdType>((*ord_type)[0]))
+        .orderQty(Qty::from_string(*qty));
+    char* body = codec.mutableBody();
+    detail::optional_price(fix, body + NewOrderSingleCodec::Offset::Price);
+    auto ts = detail::transact_time(fix, body + NewOrderSingleCodec::Offset::TransactTime);
+    if (!ts) [[unlikely]] return std::unexpected{ts.error()};
+    return size;
+}
+
+/// OrderCancelRequest (35=F) into an OrderCancelRequestCodec buffer
+/// Required: OrigClOrdID(41), ClOrdID(11), Symbol(55), Side(54)
+/// @return Encoded size
+[[nodiscard]] NFX_HOT inline ParseResult<std::size_t> transcode_order_cancel_request(
+    const simd::IndexedFieldAccessor& fix, char* buffer, std::size_t length) noexcept {
+    auto size = detail::check_msg_type(fix, 'F', length, OrderCancelRequestCodec::TOTAL_SIZE);
+    if (!size) [[unlikely]] return size;
+
+    auto orig = detail::required_string<tag::OrigClOrdID::value, 20>(fix);
+    if (!orig) [[unlikely]] return std::unexpected{orig.error()};
+    auto cl_ord_id = detail::required_string<tag::ClOrdID::value, 20>(fix);
+    if (!cl_ord_id) [[unlikely]] return std::unexpected{cl_ord_id.error()};
+    auto symbol = detail::required_string<tag::Symbol::value, 8>(fix);
+    if (!symbol) [[unlikely]] return std::unexpected{symbol.error()};
+    auto side = detail::required<tag::Side::value>(fix);
+    if (!side) [[unlikely]] return std::unexpected{side.error()};
+
+    auto codec = OrderCancelRequestCodec::wrapForEncode(buffer, length);
+    codec.encodeHeader()
+        .origClOrdId(*orig)
+        .clOrdId(*cl_ord_id)
+        .symbol(*symbol)
+        .side(static_cast<Side>((*side)[0]))
+        .orderQty(Qty::from_string(fix.get(tag::OrderQty::value)));
+    auto ts = detail::transact_time(
+        fix, codec.mutableBody() + OrderCancelRequestCodec::Offset::TransactTime);
+    if (!ts) [[unlikely]] return std::unexpected{ts.error()};
+    return size;
+}
+
+/// OrderCancelReplaceRequest (35=G) into an OrderCancelReplaceRequestCodec buffer
+/// Required: OrigClOrdID(41), ClOrdID(11), Symbol(55), Side(54), OrdType(40),
+///           OrderQty(38). TimeInForce(59) defaults to Day.
+/// @return Encoded size
+[[nodiscard]] NFX_HOT inline ParseResult<std::size_t> transcode_order_cancel_replace_request(
+    const simd::IndexedFieldAccessor& fix, char* buffer, std::size_t length) noexcept {
+    auto size = detail::check_msg_type(
+        fix, 'G', length, OrderCancelReplaceRequestCodec::TOTAL_SIZE);
+    if (!size) [[unlikely]] return size;
+
+    auto orig = detail::required_string<tag::OrigClOrdID::value, 20>(fix);
+    if (!orig) [[unlikely]] return std::unexpected{orig.error()};
+    auto cl_ord_id = detail::required_string<tag::ClOrdID::value, 20>(fix);
+    if (!cl_ord_id) [[unlikely]] return std::unexpected{cl_ord_id.error()};
+    auto symbol = detail::required_string<tag::Symbol::value, 8>(fix);
+    if (!symbol) [[unlikely]] return std::unexpected{symbol.error()};
+    auto side = detail::required<tag::Side::value>(fix);
+    if (!side) [[unlikely]] return std::unexpected{side.error()};
+    auto ord_type = detail::required<tag::OrdType::value>(fix);
+    if (!ord_type) [[unlikely]] return std::unexpected{ord_type.error()};
+    auto qty = detail::required<tag::OrderQty::value>(fix);
+    if (!qty) [[unlikely]] return std::unexpected{qty.error()};
+    const char tif = fix.get_char(tag::TimeInForce::value);
+
+    auto codec = OrderCancelReplaceRequestCodec::wrapForEncode(buffer, length);
+    codec.encodeHeader()
+        .origClOrdId(*orig)
+        .clOrdId(*cl_ord_id)
+        .symbol(*symbol)
+        .side(static_cast<Side>((*side)[0]))
+        .ordType(static_cast<OrdType>((*ord_type)[0]))
+        .timeInForce(tif == '\0' ? TimeInForce::Day : static_cast<TimeInForce>(tif))
+        .orderQty(Qty::from_string(*qty));
+    char* body = codec.mutableBody();
+    detail::optional_price(fix, body + OrderCancelReplaceRequestCodec::Offset::Price);
+    auto ts = detail::transact_time(
+        fix, body + OrderCancelReplaceRequestCodec::Offset::TransactTime);
+    if (!ts) [[unlikely]] return std::unexpected{ts.error()};
+    return size;
+}
+
+/// Transcode any supported client message by MsgType (35=D/F/G)
+/// @return Encoded size, or InvalidMsgType for other messages
+[[nodiscard]] NFX_HOT inline ParseResult<std::size_t> fix_to_sbe(
+    const simd::IndexedFieldAccessor& fix, char* buffer, std::size_t length) noexcept {
+    switch (fix.msg_type()) {
+        case 'D': return transcode_new_order_single(fix, buffer, length);
+        case 'F': return transcode_order_cancel_request(fix, buffer, length);
+        case 'G': return transcode_order_cancel_replace_request(fix, buffer, length);
+        default:
+            return std::unexpected{
+                ParseError{ParseErrorCode::InvalidMsgType, tag::MsgType::value}};
+    }
+}
+
+// ============================================================================
+// SBE -> FIX
+// ============================================================================
+
+namespace detail {
+
+template <int Tag, std::size_t MaxSize>
+NFX_FORCE_INLINE void price_field(
+    serializer::FastMessageBuilder<MaxSize>& out, FixedPrice value) noexcept {
+    char buf[FixedPrice::MAX_CHARS];
+    out.template field<Tag>(std::string_view{buf, value.to_chars(buf)});
+}
+
+template <int Tag, std::size_t MaxSize>
+NFX_FORCE_INLINE void qty_field(
+    serializer::FastMessageBuilder<MaxSize>& out, Qty value) noexcept {
+    char buf[Qty::MAX_CHARS];
+    out.template field<Tag>(std::string_view{buf, value.to_chars(buf)});
+}
+
+}  // namespace detail
+
+/// Append ExecutionReport body fields (everything after the header, before
+/// CheckSum). SBE null price/timestamp fields are omitted; LastPx/LastQty
+/// are written only for fills (LastQty non-null and non-zero).
+template <std::size_t MaxSize>
+NFX_HOT void append_execution_report_body(
+    const ExecutionReportCodec& er, serializer::FastMessageBuilder<MaxSize>& out) noexcept {
+    using Codec = ExecutionReportCodec;
+    const char* body = er.body();
+
+    out.template field<tag::OrderID::value>(er.orderId());
+    out.template field<tag::ExecID::value>(er.execId());
+    out.template field<tag::ClOrdID::value>(er.clOrdId());
+    out.template field<tag::ExecType::value>(static_cast<char>(er.execType()));
+    out.template field<tag::OrdStatus::value>(static_cast<char>(er.ordStatus()));
+    out.template field<tag::Symbol::value>(er.symbol());
+    out.template field<tag::Side::value>(static_cast<char>(er.side()));
+    detail::qty_field<tag::OrderQty::value>(out, er.orderQty());
+    if (!DecimalPrice::is_null(body + Codec::Offset::Price)) {
+        detail::price_field<tag::Price::value>(out, er.price());
+    }
+    if (!DecimalQty::is_null(body + Codec::Offset::LastQty) && er.lastQty().raw != 0) {
+        detail::price_field<tag::LastPx::value>(out, er.lastPx());
+        detail::qty_field<tag::LastQty::value>(out, er.lastQty());
+    }
+    detail::qty_field<tag::LeavesQty::value>(out, er.leavesQty());
+    detail::qty_field<tag::CumQty::value>(out, er.cumQty());
+    detail::price_field<tag::AvgPx::value>(out, er.avgPx());
+    if (!SbeTimestamp::is_null(body + Codec::Offset::TransactTime)) {
+        char buf[Timestamp::MAX_CHARS];
+        out.template field<tag::TransactTime::value>(
+            std::string_view{buf, er.transactTime().to_utc_chars(buf)});
+    }
+}
+
+// ============================================================================
+// ExecutionReport Transcoder (SBE -> complete FIX message)
+// ============================================================================
+
+/// Pre-rendered per-session ExecutionReport encoder, the SBE counterpart of
+/// fix44::NewOrderTemplate: prepare() writes the static header once, each
+/// build() writes MsgSeqNum, SendingTime and the transcoded body, then
+/// back-patches BodyLength and appends CheckSum from the running sum.
+class ExecutionReportTranscoder {
+public:
+    static constexpr std::size_t MAX_SIZE = 1024;
+
+    ExecutionReportTranscoder() noexcept = default;
+
+    /// Render the session's static header bytes
+    void prepare(std::string_view begin_string,
+                 std::string_view sender_comp_id,
+                 std::string_view target_comp_id) noexcept {
+        builder_.reset();
+        builder_.begin_string(begin_string);
+        length_pos_ = builder_.body_length_placeholder();
+        builder_.mark_body_start();
+        builder_.msg_type('8');
+        builder_.sender_comp_id(sender_comp_id);
+        builder_.target_comp_id(target_comp_id);
+        header_end_ = builder_.size();
+
+        // BodyLength digits change per message: keep them out of the stored sum
+        header_sum_ = builder_.running_sum() - length_digit_sum();
+        prepared_ = true;
+    }
+
+    [[nodiscard]] bool prepared() const noexcept { return prepared_; }
+
+    /// Transcode an SBE ExecutionReport against the prepared header
+    /// @return Complete FIX message, or InvalidMsgType if the codec is not
+    ///         a valid ExecutionReport (or prepare() was not called)
+    [[nodiscard]] NFX_HOT ParseResult<std::span<const char>> build(
+        const ExecutionReportCodec& er,
+        uint32_t msg_seq_num,
+        std::string_view sending_time) noexcept {
+        if (!prepared_ || !er.isValid()) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::InvalidMsgType}};
+        }
+
+        // The slot still holds the previous message's BodyLength digits
+        builder_.truncate(header_end_, header_sum_ + length_digit_sum());
+        builder_.msg_seq_num(msg_seq_num);
+        builder_.sending_time(sending_time);
+        append_execution_report_body(er, builder_);
+
+        builder_.update_body_length(length_pos_, builder_.size() - builder_.body_start());
+        builder_.finalize_checksum();
+        return builder_.data();
+    }
+
+private:
+    static constexpr std::size_t LENGTH_DIGITS = 6;
+
+    [[nodiscard]] uint32_t length_digit_sum() const noexcept {
+        const char* data = builder_.c_str();
+        uint32_t sum = 0;
+        for (std::size_t i = 0; i < LENGTH_DIGITS; ++i) {
+            sum += static_cast<uint8_t>(data[length_pos_ + i]);
+        }
+        return sum;
+    }
+
+    serializer::FastMessageBuilder<MAX_SIZE> builder_;
+    std::size_t length_pos_{0};
+    std::size_t header_end_{0};
+    uint32_t header_sum_{0};
+    bool prepared_{false};
+};
+
+}  // namespace nfx::sbe
@@ -10,6 +10,7 @@
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/sbe/types/sbe_types.hpp"
 #include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/market_data_types.hpp"
 
 namespace nfx::sbe {
 
@@ -307,4 +308,91 @@ public:
     }
 };
 
+class SbeMDEntryType {
+public:
+    static constexpr std::size_t SIZE = sizeof(SbeChar);
+
+    [[nodiscard]] NFX_FORCE_INLINE static MDEntryType decode(
+        const char* NFX_RESTRICT buffer) noexcept {
+        return static_cast<MDEntryType>(buffer[0]);
+    }
+
+    NFX_FORCE_INLINE static void encode(
+        char* NFX_RESTRICT buffer, MDEntryType value) noexcept {
+        buffer[0] = static_cast<char>(value);
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE static bool is_null(
+        const char* NFX_RESTRICT buffer) noexcept {
+        return buffer[0] == null_value::CHAR;
+    }
+
+    NFX_FORCE_INLINE static void write_null(
+        char* NFX_RESTRICT buffer) noexcept {
+        buffer[0] = null_value::CHAR;
+    }
+};
+
+class SbeMDUpdateAction {
+public:
+    static constexpr std::size_t SIZE = sizeof(SbeChar);
+
+    [[nodiscard]] NFX_FORCE_INLINE static MDUpdateAction decode(
+        const char* NFX_RESTRICT buffer) noexcept {
+        return static_cast<MDUpdateAction>(buffer[0]);
+    }
+
+    NFX_FORCE_INLINE static void encode(
+        char* NFX_RESTRICT buffer, MDUpdateAction value) noexcept {
+        buffer[0] = static_cast<char>(value);
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE static bool is_null(
+        const char* NFX_RESTRICT buffer) noexcept {
+        return buffer[0] == null_value::CHAR;
+    }
+
+    NFX_FORCE_INLINE static void write_null(
+        char* NFX_RESTRICT buffer) noexcept {
+        buffer[0] = null_value::CHAR;
+    }
+};
+
+// ============================================================================
+// GroupSizeEncoding: Repeating Group Dimensions (4 bytes)
+// ============================================================================
+// Precedes every repeating group:
+//   Offset 0: blockLength (uint16) - Size of one group entry in bytes
+//   Offset 2: numInGroup  (uint16) - Number of entries that follow
+//
+// Decoders step through entries by the wire blockLength, so entries grown
+// by a later schema version are still read correctly.
+
+class GroupSizeEncoding {
+public:
+    static constexpr std::size_t SIZE = 4;
+
+    struct Offset {
+        static constexpr std::size_t BlockLength = 0;
+        static constexpr std::size_t NumInGroup = 2;
+    };
+
+    [[nodiscard]] NFX_FORCE_INLINE static SbeUint16 blockLength(
+        const char* NFX_RESTRICT buffer) noexcept {
+        return read_uint16(buffer + Offset::BlockLength);
+    }
+
+    [[nodiscard]] NFX_FORCE_INLINE static SbeUint16 numInGroup(
+        const char* NFX_RESTRICT buffer) noexcept {
+        return read_uint16(buffer + Offset::NumInGroup);
+    }
+
+    NFX_FORCE_INLINE static void encode(
+        char* NFX_RESTRICT buffer, SbeUint16 blockLength,
+        SbeUint16 numInGroup) noexcept {
+        write_uint16(buffer + Offset::BlockLength, blockLength);
+        write_uint16(buffer + Offset::NumInGroup, numInGroup);
+    }
+};
+
 }  // namespace nfx::sbe
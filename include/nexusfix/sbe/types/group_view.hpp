@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+#include "nexusfix/platform/platform.hpp"
+
+namespace nfx::sbe {
+
+// ============================================================================
+// GroupView<Entry>: In-Place Repeating Group Range
+// ============================================================================
+// Forward range over the entries of one SBE repeating group. Each step
+// hands out an Entry flyweight (constructible from a const char* to the
+// entry) pointing into the message buffer; nothing is copied.
+//
+// The stride is the entry blockLength read from the group header, so
+// entries extended by a newer schema version are skipped over correctly.
+
+template <typename Entry>
+class GroupView {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() noexcept = default;
+        Iterator(const char* pos, std::size_t stride) noexcept
+            : pos_{pos}, stride_{stride} {}
+
+        [[nodiscard]] NFX_FORCE_INLINE Entry operator*() const noexcept {
+            return Entry{pos_};
+        }
+
+        NFX_FORCE_INLINE Iterator& operator++() noexcept {
+            pos_ += stride_;
+            return *this;
+        }
+
+        NFX_FORCE_INLINE Iterator operator++(int) noexcept {
+            Iterator tmp = *this;
+            pos_ += stride_;
+            return tmp;
+        }
+
+        [[nodiscard]] bool operator==(const Iterator& other) const noexcept {
+            return pos_ == other.pos_;
+        }
+
+    private:
+        const char* pos_{nullptr};
+        std::size_t stride_{0};
+    };
+
+    GroupView(const char* first, std::size_t count, std::size_t stride) noexcept
+        : first_{first}, count_{count}, stride_{stride} {}
+
+    [[nodiscard]] Iterator begin() const noexcept { return {first_, stride_}; }
+    [[nodiscard]] Iterator end() const noexcept {
+        return {first_ + count_ * stride_, stride_};
+    }
+
+    [[nodiscard]] Entry operator[](std::size_t index) const noexcept {
+        return Entry{first_ + index * stride_};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+
+private:
+    const char* first_;
+    std::size_t count_;
+    std::size_t stride_;
+};
+
+}  // namespace nfx::sbe
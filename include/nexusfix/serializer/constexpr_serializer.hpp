@@ -145,6 +145,65 @@ struct FastIntSerializer {
     }
 };
 
+// ============================================================================
+// Fast Base-62 Serialization (fixed width)
+// ============================================================================
+
+namespace detail {
+
+/// Digits in ASCII order, so fixed-width strings sort like their values
+inline constexpr std::string_view BASE62_DIGITS =
+    "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+inline constexpr uint8_t BASE62_INVALID = 0xFF;
+
+inline constexpr std::array<uint8_t, 256> BASE62_VALUES = [] {
+    std::array<uint8_t, 256> table{};
+    for (auto& v : table) v = BASE62_INVALID;
+    for (size_t i = 0; i < BASE62_DIGITS.size(); ++i) {
+        table[static_cast<unsigned char>(BASE62_DIGITS[i])] = static_cast<uint8_t>(i);
+    }
+    return table;
+}();
+
+} // namespace detail
+
+/// Fixed-width base-62 uint64 codec (leading '0's); short, sortable ids
+template<size_t Width>
+struct FastBase62Serializer {
+    static_assert(Width >= 1 && Width <= 10, "Width must be 1-10 (62^10 < 2^64)");
+
+    /// Largest value representable in Width digits
+    static constexpr uint64_t MAX_VALUE = [] {
+        uint64_t limit = 1;
+        for (size_t i = 0; i < Width; ++i) limit *= 62;
+        return limit - 1;
+    }();
+
+    /// Serialize to exactly Width chars (value taken modulo 62^Width)
+    NFX_HOT
+    static void serialize_fixed(char* buf, uint64_t value) noexcept {
+        for (size_t i = Width; i > 0; --i) {
+            buf[i - 1] = detail::BASE62_DIGITS[value % 62];
+            value /= 62;
+        }
+    }
+
+    /// Parse exactly Width base-62 chars
+    /// @return false on a non-base-62 char
+    [[nodiscard]] NFX_HOT
+    static bool parse_fixed(const char* buf, uint64_t& out) noexcept {
+        uint64_t value = 0;
+        for (size_t i = 0; i < Width; ++i) {
+            const uint8_t digit = detail::BASE62_VALUES[static_cast<unsigned char>(buf[i])];
+            if (digit == detail::BASE62_INVALID) [[unlikely]] return false;
+            value = value * 62 + digit;
+        }
+        out = value;
+        return true;
+    }
+};
+
 // ============================================================================
 // Compile-Time Field Descriptor
 // ============================================================================
@@ -168,7 +227,7 @@ struct FieldDescriptor {
 template<size_t MaxSize = 4096>
 class FastMessageBuilder {
 public:
-    constexpr FastMessageBuilder() noexcept : buffer_{}, pos_{0} {}
+    constexpr FastMessageBuilder() noexcept : buffer_{}, pos_{0}, sum_{0} {}
 
     /// Write a field with string value
     template<int Tag>
@@ -196,13 +255,36 @@ public:
         return *this;
     }
 
+    /// Write a field with signed 64-bit integer value (quantities, large IDs)
+    template<int Tag>
+    NFX_HOT
+    FastMessageBuilder& field(int64_t value) noexcept {
+        constexpr TagString<Tag> tag_str{};
+        write_raw(tag_str.c_str(), tag_str.size());
+
+        char int_buf[20];
+        size_t len = 0;
+        uint64_t mag = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+        do {
+            int_buf[sizeof(int_buf) - 1 - len++] = static_cast<char>('0' + (mag % 10));
+            mag /= 10;
+        } while (mag > 0);
+        if (value < 0) write_raw("-", 1);
+        write_raw(int_buf + sizeof(int_buf) - len, len);
+        write_soh();
+        return *this;
+    }
+
     /// Write a field with char value
     template<int Tag>
     NFX_HOT
     FastMessageBuilder& field(char value) noexcept {
         constexpr TagString<Tag> tag_str{};
         write_raw(tag_str.c_str(), tag_str.size());
-        if (pos_ < MaxSize) buffer_[pos_++] = value;
+        if (pos_ < MaxSize) {
+            buffer_[pos_++] = value;
+            sum_ += static_cast<uint8_t>(value);
+        }
         write_soh();
         return *this;
     }
@@ -229,9 +311,11 @@ public:
         return value_pos;
     }
 
-    /// Update BodyLength at given position
+    /// Update BodyLength at given position (the running sum follows the new digits)
     void update_body_length(size_t pos, size_t length) noexcept {
+        for (size_t i = 0; i < 6; ++i) sum_ -= static_cast<uint8_t>(buffer_[pos + i]);
         FastIntSerializer<6>::serialize_fixed(&buffer_[pos], static_cast<uint32_t>(length));
+        for (size_t i = 0; i < 6; ++i) sum_ += static_cast<uint8_t>(buffer_[pos + i]);
     }
 
     /// Write MsgType (tag 35)
@@ -264,14 +348,9 @@ public:
         return field<52>(value);
     }
 
-    /// Write CheckSum (tag 10) - computed and appended
+    /// Write CheckSum (tag 10) - taken from the running sum, no second pass
     void finalize_checksum() noexcept {
-        // Calculate checksum
-        uint32_t sum = 0;
-        for (size_t i = 0; i < pos_; ++i) {
-            sum += static_cast<uint8_t>(buffer_[i]);
-        }
-        uint8_t checksum = static_cast<uint8_t>(sum % 256);
+        uint8_t checksum = static_cast<uint8_t>(sum_ % 256);
 
         // Write 10=XXX|
         constexpr TagString<10> tag_str{};
@@ -299,7 +378,22 @@ public:
     [[nodiscard]] const char* c_str() const noexcept { return buffer_.data(); }
 
     /// Reset builder
-    void reset() noexcept { pos_ = 0; }
+    void reset() noexcept {
+        pos_ = 0;
+        sum_ = 0;
+    }
+
+    /// Byte sum of everything written so far (checksum before mod 256)
+    [[nodiscard]] uint32_t running_sum() const noexcept { return sum_; }
+
+    /// Drop everything after `pos`, keeping a previously written prefix
+    /// @param sum_at_pos running_sum() of the bytes in [0, pos)
+    void truncate(size_t pos, uint32_t sum_at_pos) noexcept {
+        if (pos < pos_) {
+            pos_ = pos;
+            sum_ = sum_at_pos;
+        }
+    }
 
     /// Get body start position (after tag 9)
     [[nodiscard]] size_t body_start() const noexcept { return body_start_; }
@@ -309,17 +403,28 @@ public:
 
 private:
     void write_raw(const char* data, size_t len) noexcept {
-        size_t to_write = (pos_ + len <= MaxSize) ? len : (MaxSize - pos_);
+        if (pos_ >= MaxSize) [[unlikely]] return;
+        const size_t to_write = len <= MaxSize - pos_ ? len : MaxSize - pos_;
         std::memcpy(&buffer_[pos_], data, to_write);
+        // Summed while the bytes are hot; replaces the pass in finalize_checksum()
+        uint32_t sum = 0;
+        for (size_t i = 0; i < to_write; ++i) {
+            sum += static_cast<uint8_t>(data[i]);
+        }
+        sum_ += sum;
         pos_ += to_write;
     }
 
     void write_soh() noexcept {
-        if (pos_ < MaxSize) buffer_[pos_++] = SOH;
+        if (pos_ < MaxSize) {
+            buffer_[pos_++] = SOH;
+            sum_ += static_cast<uint8_t>(SOH);
+        }
     }
 
     std::array<char, MaxSize> buffer_;
     size_t pos_;
+    uint32_t sum_;  // Running byte sum of buffer_[0, pos_)
     size_t body_start_{0};
 };
 
@@ -0,0 +1,359 @@
+/*
+    NexusFIX Message Layout
+
+    Compile-time layout for messages with a fixed field set (NewOrderSingle,
+    OrderCancelRequest). Every byte that does not depend on a value is
+    computed at compile time:
+
+    - Each slot's static segment ("\x01" "55=": the SOH ending the previous
+      field plus the next tag) is a constant 8-byte word with a known length
+      and byte sum; writing it is one store and a pointer bump
+    - The longest encoding is known, so writes carry no bounds checks
+    - Only value bytes are summed at run time; segment sums are constants
+
+    LayoutEncoder adds the session part: prepare() renders the static header
+    ("8=..|9=NNNNNN|35=..|49=..|56=..|") once with its byte sum, and build()
+    writes the layout straight after it, patches the six BodyLength digits
+    and appends the CheckSum. Variable-width values only move the bytes
+    that follow them; nothing is written twice.
+
+    Usage:
+        using Layout = MessageLayout<UIntSlot<34>, StringSlot<52, 32>,
+                                     StringSlot<11>, CharSlot<54>,
+                                     Optional<PriceSlot<44>>>;
+        LayoutEncoder<Layout> encoder;
+        encoder.prepare("FIX.4.4", "D", "SENDER", "TARGET");   // At logon
+        auto msg = encoder.build(seq, time, cl_ord_id, side, price);
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/serializer/constexpr_serializer.hpp"
+#include "nexusfix/types/field_types.hpp"
+
+namespace nfx::serializer {
+
+// ============================================================================
+// Slots
+// ============================================================================
+// A slot names a tag, the type of its value, the longest value text and how
+// to write it. write() returns the bytes written and adds their byte sum.
+
+/// String value, cut at MaxLen bytes
+template<int Tag, size_t MaxLen = 64>
+struct StringSlot {
+    using value_type = std::string_view;
+    static constexpr int tag = Tag;
+    static constexpr size_t max_value = MaxLen;
+    static constexpr bool optional = false;
+
+    [[nodiscard]] static constexpr bool present(std::string_view v) noexcept { return !v.empty(); }
+
+    NFX_FORCE_INLINE static size_t write(char* out, std::string_view v, uint32_t& sum) noexcept {
+        const size_t n = v.size() < MaxLen ? v.size() : MaxLen;
+        std::memcpy(out, v.data(), n);
+        for (size_t i = 0; i < n; ++i) sum += static_cast<uint8_t>(v[i]);
+        return n;
+    }
+};
+
+/// Single character (char enums: Side, OrdType, TimeInForce, ...)
+template<int Tag>
+struct CharSlot {
+    using value_type = char;
+    static constexpr int tag = Tag;
+    static constexpr size_t max_value = 1;
+    static constexpr bool optional = false;
+
+    [[nodiscard]] static constexpr bool present(char v) noexcept { return v != '\0'; }
+
+    NFX_FORCE_INLINE static size_t write(char* out, char v, uint32_t& sum) noexcept {
+        out[0] = v;
+        sum += static_cast<uint8_t>(v);
+        return 1;
+    }
+};
+
+/// Unsigned integer below 2^32 (MsgSeqNum, counts)
+template<int Tag>
+struct UIntSlot {
+    using value_type = uint32_t;
+    static constexpr int tag = Tag;
+    static constexpr size_t max_value = 10;
+    static constexpr bool optional = false;
+
+    [[nodiscard]] static constexpr bool present(uint32_t v) noexcept { return v != 0; }
+
+    NFX_FORCE_INLINE static size_t write(char* out, uint32_t v, uint32_t& sum) noexcept {
+        const size_t n = FastIntSerializer<10>::serialize(out, v);
+        for (size_t i = 0; i < n; ++i) sum += static_cast<uint8_t>(out[i]);
+        return n;
+    }
+};
+
+/// Unsigned value with a minimum digit count (MsgSeqNum under a
+/// session-configured fixed width)
+struct PaddedUInt {
+    uint32_t value{0};
+    uint8_t width{0};       // Zero-pad to at least this many digits (max 10)
+};
+
+/// PaddedUInt: natural width when width is 0, else zero-padded
+template<int Tag>
+struct PaddedUIntSlot {
+    using value_type = PaddedUInt;
+    static constexpr int tag = Tag;
+    static constexpr size_t max_value = 10;
+    static constexpr bool optional = false;
+
+    [[nodiscard]] static constexpr bool present(PaddedUInt v) noexcept { return v.value != 0; }
+
+    NFX_FORCE_INLINE static size_t write(char* out, PaddedUInt v, uint32_t& sum) noexcept {
+        size_t n = 1;
+        for (uint32_t t = v.value; t >= 10; t /= 10) ++n;
+        const size_t width = v.width < 10 ? v.width : 10;
+        if (n < width) n = width;
+
+        uint32_t value = v.value;
+        for (size_t i = n; i > 0; --i) {
+            out[i - 1] = static_cast<char>('0' + value % 10);
+            value /= 10;
+            sum += static_cast<uint8_t>(out[i - 1]);
+        }
+        return n;
+    }
+};
+
+/// Signed 64-bit integer (whole quantities, large ids)
+template<int Tag>
+struct IntSlot {
+    using value_type = int64_t;
+    static constexpr int tag = Tag;
+    static constexpr size_t max_value = 20;
+    static constexpr bool optional = false;
+
+    [[nodiscard]] static constexpr bool present(int64_t v) noexcept { return v != 0; }
+
+    NFX_FORCE_INLINE static size_t write(char* out, int64_t v, uint32_t& sum) noexcept {
+        char digits[20];
+        size_t len = 0;
+        uint64_t mag = v < 0 ? 0 - static_cast<uint64_t>(v) : static_cast<uint64_t>(v);
+        do {
+            digits[sizeof(digits) - 1 - len++] = static_cast<char>('0' + (mag % 10));
+            mag /= 10;
+        } while (mag > 0);
+
+        size_t n = 0;
+        if (v < 0) out[n++] = '-';
+        std::memcpy(out + n, digits + sizeof(digits) - len, len);
+        n += len;
+        for (size_t i = 0; i < n; ++i) sum += static_cast<uint8_t>(out[i]);
+        return n;
+    }
+};
+
+/// FixedPrice as exact decimal text (FixedPrice::to_chars)
+template<int Tag>
+struct PriceSlot {
+    using value_type = FixedPrice;
+    static constexpr int tag = Tag;
+    static constexpr size_t max_value = FixedPrice::MAX_CHARS;
+    static constexpr bool optional = false;
+
+    [[nodiscard]] static constexpr bool present(FixedPrice v) noexcept { return v.raw != 0; }
+
+    NFX_FORCE_INLINE static size_t write(char* out, FixedPrice v, uint32_t& sum) noexcept {
+        const size_t n = v.to_chars(out);
+        for (size_t i = 0; i < n; ++i) sum += static_cast<uint8_t>(out[i]);
+        return n;
+    }
+};
+
+/// Qty as exact decimal text (Qty::to_chars), fractional sizes kept
+template<int Tag>
+struct QtySlot {
+    using value_type = Qty;
+    static constexpr int tag = Tag;
+    static constexpr size_t max_value = Qty::MAX_CHARS;
+    static constexpr bool optional = false;
+
+    [[nodiscard]] static constexpr bool present(Qty v) noexcept { return v.raw != 0; }
+
+    NFX_FORCE_INLINE static size_t write(char* out, Qty v, uint32_t& sum) noexcept {
+        const size_t n = v.to_chars(out);
+        for (size_t i = 0; i < n; ++i) sum += static_cast<uint8_t>(out[i]);
+        return n;
+    }
+};
+
+/// Slot written only when its value is present (non-empty, non-zero)
+template<typename Slot>
+struct Optional : Slot {
+    static constexpr bool optional = true;
+};
+
+// ============================================================================
+// Message Layout
+// ============================================================================
+
+namespace detail {
+
+/// Constant bytes written before a slot's value: [SOH] tag '='
+struct Segment {
+    std::array<char, 8> bytes{};    // Always stored as one word
+    size_t size{0};
+    uint32_t sum{0};
+};
+
+template<int Tag>
+consteval Segment make_segment(bool leading_soh) {
+    constexpr TagString<Tag> tag_str{};
+    Segment seg;
+    if (leading_soh) seg.bytes[seg.size++] = SOH;
+    for (size_t i = 0; i < tag_str.size(); ++i) seg.bytes[seg.size++] = tag_str.data[i];
+    for (size_t i = 0; i < seg.size; ++i) seg.sum += static_cast<uint8_t>(seg.bytes[i]);
+    return seg;
+}
+
+} // namespace detail
+
+/// Fixed sequence of slots, encoded after a field that ended with SOH
+template<typename... Slots>
+struct MessageLayout {
+    static_assert(sizeof...(Slots) > 0, "A layout needs at least one slot");
+    static_assert(((Slots::tag > 0 && Slots::tag < 1000000) && ...),
+                  "Tags must fit a segment word");
+
+    static constexpr size_t slot_count = sizeof...(Slots);
+
+    /// Longest encoding, plus slack for the last segment's full-word store
+    static constexpr size_t max_size =
+        ((1 + IntToString<Slots::tag>::length + 1 + Slots::max_value) + ...) + 1 + 8;
+
+    /// Write the slots' fields at out, values in slot order; the first
+    /// segment carries no SOH (the field before the layout has its own)
+    /// @param out At least max_size bytes
+    /// @param sum Gains the byte sum of everything written
+    /// @return Bytes written
+    [[nodiscard]] NFX_HOT
+    static size_t encode(char* out, uint32_t& sum,
+                         const typename Slots::value_type&... values) noexcept {
+        char* p = out;
+        bool first = true;
+        (write_slot<Slots>(p, sum, first, values), ...);
+        *p++ = SOH;
+        sum += static_cast<uint8_t>(SOH);
+        return static_cast<size_t>(p - out);
+    }
+
+private:
+    template<typename Slot>
+    NFX_FORCE_INLINE static void write_slot(char*& p, uint32_t& sum, bool& first,
+                                            const typename Slot::value_type& value) noexcept {
+        static constexpr detail::Segment LEADING = detail::make_segment<Slot::tag>(false);
+        static constexpr detail::Segment JOINED = detail::make_segment<Slot::tag>(true);
+
+        if constexpr (Slot::optional) {
+            if (!Slot::present(value)) return;
+        }
+        const detail::Segment& seg = first ? LEADING : JOINED;
+        first = false;
+        std::memcpy(p, seg.bytes.data(), 8);
+        p += seg.size;
+        sum += seg.sum;
+        p += Slot::write(p, value, sum);
+    }
+};
+
+// ============================================================================
+// Layout Encoder
+// ============================================================================
+
+/// Pre-rendered session header followed by a MessageLayout
+/// @tparam Layout MessageLayout of everything after TargetCompID
+/// @tparam HeaderMax Longest static header ("8=..|" through "56=..|")
+template<typename Layout, size_t HeaderMax = 192>
+class LayoutEncoder {
+public:
+    static constexpr size_t TRAILER_SIZE = 7;   // "10=XXX|"
+    static constexpr size_t MAX_SIZE = HeaderMax + Layout::max_size + TRAILER_SIZE;
+
+    LayoutEncoder() noexcept = default;
+
+    /// Render the static header and its byte sum
+    /// (header text past HeaderMax is cut)
+    void prepare(std::string_view begin_string,
+                 std::string_view msg_type,
+                 std::string_view sender_comp_id,
+                 std::string_view target_comp_id) noexcept
+    {
+        FastMessageBuilder<HeaderMax> header;
+        header.begin_string(begin_string);
+        length_pos_ = header.body_length_placeholder();
+        header.mark_body_start();
+        header.msg_type(msg_type);
+        header.sender_comp_id(sender_comp_id);
+        header.target_comp_id(target_comp_id);
+
+        header_end_ = header.size();
+        body_start_ = header.body_start();
+        std::memcpy(buffer_.data(), header.c_str(), header_end_);
+        // BodyLength digits change per message: keep them out of the stored sum
+        header_sum_ = header.running_sum() - length_digit_sum();
+        prepared_ = true;
+    }
+
+    [[nodiscard]] bool prepared() const noexcept { return prepared_; }
+
+    /// Encode one message: the layout's values in slot order
+    /// @return Message bytes, valid until the next build()/prepare()
+    template<typename... Values>
+    [[nodiscard]] NFX_HOT
+    std::span<const char> build(const Values&... values) noexcept {
+        uint32_t sum = header_sum_;
+        const size_t body = Layout::encode(buffer_.data() + header_end_, sum, values...);
+        const size_t end = header_end_ + body;
+
+        FastIntSerializer<6>::serialize_fixed(buffer_.data() + length_pos_,
+                                              static_cast<uint32_t>(end - body_start_));
+        sum += length_digit_sum();
+
+        const auto checksum = static_cast<uint8_t>(sum % 256);
+        char* trailer = buffer_.data() + end;
+        std::memcpy(trailer, "10=", 3);
+        trailer[3] = static_cast<char>('0' + checksum / 100);
+        trailer[4] = static_cast<char>('0' + (checksum / 10) % 10);
+        trailer[5] = static_cast<char>('0' + checksum % 10);
+        trailer[6] = SOH;
+
+        return {buffer_.data(), end + TRAILER_SIZE};
+    }
+
+private:
+    static constexpr size_t LENGTH_DIGITS = 6;
+
+    [[nodiscard]] uint32_t length_digit_sum() const noexcept {
+        uint32_t sum = 0;
+        for (size_t i = 0; i < LENGTH_DIGITS; ++i) {
+            sum += static_cast<uint8_t>(buffer_[length_pos_ + i]);
+        }
+        return sum;
+    }
+
+    std::array<char, MAX_SIZE> buffer_{};
+    size_t length_pos_{0};
+    size_t body_start_{0};
+    size_t header_end_{0};
+    uint32_t header_sum_{0};
+    bool prepared_{false};
+};
+
+} // namespace nfx::serializer
@@ -0,0 +1,618 @@
+/*
+    NexusFIX Acceptor Engine
+
+    Sell-side server for many counterparties. Each worker thread is
+    pinned to its own core and owns:
+    - a SO_REUSEPORT listening socket on the shared port, so the kernel
+      spreads incoming connections over the workers
+    - a SessionReactor whose ring runs a multishot accept on that socket
+      next to the receives and sends of the worker's connections
+
+    Every counterparty is configured up front and gets a pre-allocated
+    slot in one cache-aligned slab: its SessionManager, message store and
+    an ownership word, each slot starting on its own cache line. A new
+    connection is unbound until its Logon arrives; the Logon's CompIDs
+    are looked up in a CompIdRouter (read-only once started, so every
+    worker routes without locks) and the worker claims the slot with one
+    CAS. A logon storm at the open is therefore accepted, routed and
+    answered on all workers in parallel.
+
+    A slot is owned by the worker that accepted its current connection;
+    its callbacks run on that worker's thread. A reconnect may land on a
+    different worker: ownership is released with release semantics when
+    the connection ends and acquired by the next claim, so the session's
+    sequence state moves with it.
+
+    Connections are closed without a reply when the message is not a
+    Logon, the CompIDs are unknown, the counterparty is already logged on
+    (duplicate logon), or no Logon arrives within logon_timeout.
+
+    Usage:
+        AcceptorEngine engine{AcceptorEngineConfig{.port = 9878, .num_workers = 4}};
+        SessionConfig client;
+        client.sender_comp_id = "EXCH";
+        client.target_comp_id = "CLIENT1";
+        (void)engine.add_counterparty(client, callbacks);
+        ...
+        engine.start();
+        ...
+        engine.stop();
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <latch>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/memory/cache_line.hpp"
+#include "nexusfix/parser/consteval_parser.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/session/session_reactor.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+
+#if NFX_IO_URING_AVAILABLE
+    #include "nexusfix/transport/tcp_transport.hpp"
+    #include <unistd.h>
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Logon Routing
+// ============================================================================
+
+/// CompIDs of an inbound Logon, from the counterparty's point of view
+struct LogonIdentity {
+    std::string_view sender_comp_id;  // Theirs: our session's target_comp_id
+    std::string_view target_comp_id;  // Ours: our session's sender_comp_id
+};
+
+/// Identify the counterparty of a connection from its first message
+/// @return CompIDs if the message is a Logon with both set
+[[nodiscard]] inline std::optional<LogonIdentity> identify_logon(
+    std::span<const char> message) noexcept
+{
+    const auto result = parse_header(message);
+    if (!result.ok() || result.header.msg_type != msg_type::Logon ||
+        result.header.sender_comp_id.empty() || result.header.target_comp_id.empty()) {
+        return std::nullopt;
+    }
+    return LogonIdentity{result.header.sender_comp_id, result.header.target_comp_id};
+}
+
+/// Maps a session's CompID pair to its slot index: open addressing on
+/// CpuAffinity::session_hash, built before the workers start, read-only
+/// (and so safe from every worker) afterwards
+class CompIdRouter {
+public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    /// Register a session by its own CompIDs (not thread-safe)
+    /// @return false if the pair is already registered
+    bool insert(std::string_view sender_comp_id, std::string_view target_comp_id,
+                uint32_t index) {
+        if ((entries_.size() + 1) * 2 > table_.size()) {
+            rehash(table_.empty() ? 16 : table_.size() * 2);
+        }
+        const uint64_t hash = util::CpuAffinity::session_hash(sender_comp_id, target_comp_id);
+        for (size_t i = hash & mask();; i = (i + 1) & mask()) {
+            const uint32_t e = table_[i];
+            if (e == NONE) {
+                table_[i] = static_cast<uint32_t>(entries_.size());
+                entries_.push_back(Entry{std::string{sender_comp_id},
+                                         std::string{target_comp_id}, hash, index});
+                return true;
+            }
+            if (matches(entries_[e], hash, sender_comp_id, target_comp_id)) return false;
+        }
+    }
+
+    /// Slot of the session with these CompIDs (our sender, our target)
+    [[nodiscard]] uint32_t find(std::string_view sender_comp_id,
+                                std::string_view target_comp_id) const noexcept {
+        if (table_.empty()) return NONE;
+        const uint64_t hash = util::CpuAffinity::session_hash(sender_comp_id, target_comp_id);
+        for (size_t i = hash & mask();; i = (i + 1) & mask()) {
+            const uint32_t e = table_[i];
+            if (e == NONE) return NONE;
+            if (matches(entries_[e], hash, sender_comp_id, target_comp_id)) {
+                return entries_[e].index;
+            }
+        }
+    }
+
+    /// Slot of the session an inbound Logon is addressed to
+    [[nodiscard]] uint32_t route(const LogonIdentity& logon) const noexcept {
+        return find(logon.target_comp_id, logon.sender_comp_id);
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return entries_.size(); }
+
+private:
+    struct Entry {
+        std::string sender_comp_id;
+        std::string target_comp_id;
+        uint64_t hash;
+        uint32_t index;
+    };
+
+    [[nodiscard]] size_t mask() const noexcept { return table_.size() - 1; }
+
+    [[nodiscard]] static bool matches(const Entry& e, uint64_t hash, std::string_view sender,
+                                      std::string_view target) noexcept {
+        return e.hash == hash && e.sender_comp_id == sender && e.target_comp_id == target;
+    }
+
+    void rehash(size_t capacity) {
+        table_.assign(capacity, NONE);
+        for (uint32_t e = 0; e < entries_.size(); ++e) {
+            size_t i = entries_[e].hash & mask();
+            while (table_[i] != NONE) i = (i + 1) & mask();
+            table_[i] = e;
+        }
+    }
+
+    std::vector<Entry> entries_;
+    std::vector<uint32_t> table_;  // Entry index or NONE
+};
+
+#if NFX_IO_URING_AVAILABLE
+
+// ============================================================================
+// Engine Configuration
+// ============================================================================
+
+/// Configuration for AcceptorEngine
+struct AcceptorEngineConfig {
+    /// Listening port shared by all workers (0 = ephemeral, see port())
+    uint16_t port{0};
+    int backlog{1024};
+
+    /// Number of workers (0 = one per allowed core)
+    size_t num_workers{0};
+
+    /// Cores the workers are pinned to, round-robin
+    util::CpuAffinityConfig affinity{util::CpuAffinityConfig::default_config()};
+
+    /// Per-worker reactor settings (cpu_core is set from affinity)
+    SessionReactorConfig reactor{};
+
+    /// run_once() wait (0 = busy poll)
+    int poll_timeout_ms{1};
+
+    /// Interval between timer sweeps (heartbeats, logon timeouts)
+    std::chrono::milliseconds tick_interval{100};
+
+    /// Connections that send no Logon within this are closed
+    std::chrono::milliseconds logon_timeout{5000};
+
+    /// Per-session message store limits
+    size_t store_max_messages{10000};
+    size_t store_max_bytes{100'000'000};
+    size_t store_pool_size{4 * 1024 * 1024};
+};
+
+/// Counters of one worker (relaxed snapshots, readable from any thread)
+struct AcceptorStats {
+    uint64_t accepted{0};
+    uint64_t logons_routed{0};
+    uint64_t rejected_unknown{0};    // Not a Logon, or CompIDs not configured
+    uint64_t rejected_duplicate{0};  // Counterparty already logged on
+    uint64_t logon_timeouts{0};
+    uint64_t sessions_closed{0};
+};
+
+// ============================================================================
+// Acceptor Engine
+// ============================================================================
+
+/// Multi-worker FIX acceptor with CompID-routed, pre-allocated sessions
+class AcceptorEngine {
+public:
+    explicit AcceptorEngine(AcceptorEngineConfig config = {}) noexcept
+        : config_{std::move(config)}
+    {
+        if (config_.affinity.allowed_cores.empty()) {
+            config_.affinity = util::CpuAffinityConfig::default_config();
+        }
+        if (config_.num_workers == 0) {
+            config_.num_workers = config_.affinity.allowed_cores.size();
+        }
+    }
+
+    // Non-copyable, non-movable (workers and callbacks reference the slab)
+    AcceptorEngine(const AcceptorEngine&) = delete;
+    AcceptorEngine& operator=(const AcceptorEngine&) = delete;
+
+    ~AcceptorEngine() {
+        stop();
+        workers_.clear();
+        if (slab_) {
+            for (size_t i = 0; i < slab_count_; ++i) slab_[i].~SessionSlot();
+            ::operator delete(slab_, std::align_val_t{alignof(SessionSlot)});
+        }
+    }
+
+    // ========================================================================
+    // Counterparties
+    // ========================================================================
+
+    /// Configure a counterparty before start(); config strings are copied,
+    /// callbacks.on_send is replaced
+    /// @return Session index, nullopt if started or the CompIDs are taken
+    [[nodiscard]] std::optional<uint32_t> add_counterparty(const SessionConfig& config,
+                                                           SessionCallbacks callbacks = {}) {
+        if (slab_ != nullptr) return std::nullopt;
+        const auto index = static_cast<uint32_t>(specs_.size());
+        if (!router_.insert(config.sender_comp_id, config.target_comp_id, index)) {
+            return std::nullopt;
+        }
+        Spec spec;
+        spec.sender_comp_id = std::string{config.sender_comp_id};
+        spec.target_comp_id = std::string{config.target_comp_id};
+        spec.begin_string = std::string{config.begin_string};
+        spec.config = config;
+        spec.callbacks = std::move(callbacks);
+        specs_.push_back(std::move(spec));
+        return index;
+    }
+
+    // ========================================================================
+    // Lifecycle
+    // ========================================================================
+
+    /// Allocate the session slab, bind the listeners and launch the workers
+    /// @return Listen or ring setup error (the engine is then stopped)
+    [[nodiscard]] TransportResult<void> start() noexcept {
+        if (running_.load(std::memory_order_relaxed)) return {};
+        build_slab();
+
+        // Bound here, in order: with port 0 the later listeners join the
+        // first one's ephemeral port
+        workers_.clear();
+        uint16_t port = config_.port;
+        const auto& cores = config_.affinity.allowed_cores;
+        for (size_t i = 0; i < config_.num_workers; ++i) {
+            auto worker = std::make_unique<Worker>(config_.reactor, cores[i % cores.size()],
+                                                   static_cast<uint32_t>(i));
+            auto listening = worker->acceptor.listen(port, config_.backlog, true);
+            if (!listening) {
+                workers_.clear();
+                return listening;
+            }
+            port = worker->acceptor.local_port();
+            workers_.push_back(std::move(worker));
+        }
+        port_ = port;
+
+        running_.store(true, std::memory_order_release);
+        std::latch ready{static_cast<std::ptrdiff_t>(workers_.size())};
+        for (auto& worker : workers_) {
+            worker->thread = std::thread([this, w = worker.get(), &ready] {
+                run(*w, ready);
+            });
+        }
+        ready.wait();
+
+        for (auto& worker : workers_) {
+            if (!worker->init_result) {
+                auto error = worker->init_result;
+                stop();
+                return error;
+            }
+        }
+        return {};
+    }
+
+    /// Stop and join the workers; their connections are closed
+    void stop() noexcept {
+        running_.store(false, std::memory_order_release);
+        for (auto& worker : workers_) {
+            if (worker->thread.joinable()) worker->thread.join();
+        }
+        for (auto& worker : workers_) {
+            worker->acceptor.close();
+        }
+    }
+
+    [[nodiscard]] bool running() const noexcept {
+        return running_.load(std::memory_order_acquire);
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    /// Port the workers listen on (after start())
+    [[nodiscard]] uint16_t port() const noexcept { return port_; }
+    [[nodiscard]] size_t worker_count() const noexcept { return workers_.size(); }
+    [[nodiscard]] size_t counterparty_count() const noexcept { return specs_.size(); }
+    [[nodiscard]] const CompIdRouter& router() const noexcept { return router_; }
+
+    /// Counterparty currently connected (and at least logging on)
+    [[nodiscard]] bool is_connected(uint32_t index) const noexcept {
+        return slab_ != nullptr && index < specs_.size() &&
+               slab_[index].owner.load(std::memory_order_acquire) != FREE;
+    }
+
+    /// Session of a counterparty. Only while it is disconnected (e.g. to
+    /// inspect stats after stop()) or from its own callbacks.
+    [[nodiscard]] SessionManager* session(uint32_t index) noexcept {
+        return slab_ != nullptr && index < specs_.size() ? slab_[index].session.get() : nullptr;
+    }
+
+    [[nodiscard]] AcceptorStats stats(size_t worker_index) const noexcept {
+        const auto& c = workers_[worker_index]->counters;
+        return AcceptorStats{
+            c.accepted.load(std::memory_order_relaxed),
+            c.logons_routed.load(std::memory_order_relaxed),
+            c.rejected_unknown.load(std::memory_order_relaxed),
+            c.rejected_duplicate.load(std::memory_order_relaxed),
+            c.logon_timeouts.load(std::memory_order_relaxed),
+            c.sessions_closed.load(std::memory_order_relaxed)
+        };
+    }
+
+private:
+    static constexpr uint32_t FREE = UINT32_MAX;
+
+    /// Counterparty registered before start()
+    struct Spec {
+        std::string sender_comp_id;
+        std::string target_comp_id;
+        std::string begin_string;
+        SessionConfig config;
+        SessionCallbacks callbacks;
+    };
+
+    /// Pre-allocated per-counterparty state
+    struct alignas(memory::CACHE_LINE_SIZE) SessionSlot {
+        std::atomic<uint32_t> owner{FREE};    // Worker id while connected
+        SessionReactor* reactor{nullptr};     // Owner's, for on_send
+        ReactorSessionHandle handle{UINT32_MAX, 0};
+        SessionConfig config;
+        std::unique_ptr<store::MemoryMessageStore> store;
+        std::unique_ptr<SessionManager> session;
+    };
+
+    /// A connection of one worker (indexed by its reactor slot)
+    struct Connection {
+        ReactorSessionHandle handle{UINT32_MAX, 0};
+        int fd{-1};
+        uint32_t session{FREE};               // Slab index once logged on
+        std::chrono::steady_clock::time_point accepted_at{};
+    };
+
+    struct Counters {
+        std::atomic<uint64_t> accepted{0};
+        std::atomic<uint64_t> logons_routed{0};
+        std::atomic<uint64_t> rejected_unknown{0};
+        std::atomic<uint64_t> rejected_duplicate{0};
+        std::atomic<uint64_t> logon_timeouts{0};
+        std::atomic<uint64_t> sessions_closed{0};
+    };
+
+    struct Worker {
+        Worker(const SessionReactorConfig& reactor_template, int core, uint32_t worker_id)
+            : id{worker_id}, reactor_config{reactor_template}
+        {
+            reactor_config.cpu_core = core;
+            reactor = std::make_unique<SessionReactor>(reactor_config);
+        }
+
+        uint32_t id;
+        SessionReactorConfig reactor_config;
+        std::unique_ptr<SessionReactor> reactor;
+        TcpAcceptor acceptor;
+        std::vector<Connection> connections;  // Worker thread only
+
+        std::thread thread;
+        TransportResult<void> init_result{};
+        Counters counters;
+    };
+
+    /// One allocation, slots placement-constructed on cache-line boundaries
+    void build_slab() {
+        if (slab_) return;
+        slab_count_ = specs_.size() > 0 ? specs_.size() : 1;
+        slab_ = static_cast<SessionSlot*>(::operator new(
+            slab_count_ * sizeof(SessionSlot), std::align_val_t{alignof(SessionSlot)}));
+        for (size_t i = 0; i < slab_count_; ++i) ::new (slab_ + i) SessionSlot{};
+
+        for (size_t i = 0; i < specs_.size(); ++i) {
+            Spec& spec = specs_[i];
+            SessionSlot& slot = slab_[i];
+            slot.config = spec.config;
+            slot.config.sender_comp_id = spec.sender_comp_id;
+            slot.config.target_comp_id = spec.target_comp_id;
+            slot.config.begin_string = spec.begin_string;
+
+            slot.store = std::make_unique<store::MemoryMessageStore>(
+                store::MemoryMessageStore::Config{
+                    .session_id = spec.sender_comp_id + "-" + spec.target_comp_id,
+                    .max_messages = config_.store_max_messages,
+                    .max_bytes = config_.store_max_bytes,
+                    .pool_size_bytes = config_.store_pool_size,
+                });
+            slot.session = std::make_unique<SessionManager>(slot.config);
+            slot.session->set_message_store(slot.store.get());
+
+            // Resolved at call time: the owning worker changes per connection
+            SessionSlot* raw_slot = &slot;
+            spec.callbacks.on_send = [raw_slot](std::span<const char> data) {
+                return raw_slot->reactor != nullptr &&
+                       raw_slot->reactor->send(raw_slot->handle, data);
+            };
+            slot.session->set_callbacks(std::move(spec.callbacks));
+        }
+    }
+
+    // ========================================================================
+    // Worker Loop
+    // ========================================================================
+
+    void run(Worker& worker, std::latch& ready) noexcept {
+        // Pins the thread to the worker's core and sets up its ring
+        worker.init_result = worker.reactor->init();
+        if (worker.init_result &&
+            !worker.reactor->add_listener(worker.acceptor.fd(), [this, &worker](int fd) {
+                on_accept(worker, fd);
+            })) {
+            worker.init_result = std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+        }
+        const bool ok = worker.init_result.has_value();
+        ready.count_down();
+        if (!ok) return;
+
+        worker.reactor->set_unbound_handler(
+            [this, &worker](ReactorSessionHandle handle, std::span<const char> msg) {
+                on_first_message(worker, handle, msg);
+            });
+        worker.reactor->set_close_handler([this, &worker](ReactorSessionHandle handle, int) {
+            on_closed(worker, handle);
+        });
+
+        using Clock = std::chrono::steady_clock;
+        auto next_tick = Clock::now() + config_.tick_interval;
+
+        while (running_.load(std::memory_order_acquire)) {
+            (void)worker.reactor->run_once(config_.poll_timeout_ms);
+
+            const auto now = Clock::now();
+            if (now >= next_tick) {
+                worker.reactor->tick();
+                sweep(worker, now);
+                next_tick = now + config_.tick_interval;
+            }
+        }
+
+        worker.reactor->remove_listeners();
+        for (auto& conn : worker.connections) {
+            if (conn.fd < 0) continue;
+            if (conn.session != FREE) slab_[conn.session].session->on_disconnect();
+            drop(worker, conn);
+        }
+        (void)worker.reactor->flush();
+    }
+
+    void on_accept(Worker& worker, int fd) noexcept {
+        worker.counters.accepted.fetch_add(1, std::memory_order_relaxed);
+        (void)set_tcp_nodelay(fd, true);
+
+        auto handle = worker.reactor->add_connection(fd);
+        if (!handle) {
+            ::close(fd);
+            return;
+        }
+        if (worker.connections.size() <= handle->slot) {
+            worker.connections.resize(handle->slot + 1);
+        }
+        worker.connections[handle->slot] =
+            Connection{*handle, fd, FREE, std::chrono::steady_clock::now()};
+    }
+
+    /// Route a connection's Logon to its session slot
+    void on_first_message(Worker& worker, ReactorSessionHandle handle,
+                          std::span<const char> msg) noexcept {
+        if (handle.slot >= worker.connections.size()) return;
+        Connection& conn = worker.connections[handle.slot];
+
+        const auto logon = identify_logon(msg);
+        const uint32_t index = logon ? router_.route(*logon) : CompIdRouter::NONE;
+        if (index == CompIdRouter::NONE) {
+            worker.counters.rejected_unknown.fetch_add(1, std::memory_order_relaxed);
+            drop(worker, conn);
+            return;
+        }
+
+        SessionSlot& slot = slab_[index];
+        uint32_t expected = FREE;
+        if (!slot.owner.compare_exchange_strong(expected, worker.id,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed)) {
+            worker.counters.rejected_duplicate.fetch_add(1, std::memory_order_relaxed);
+            drop(worker, conn);
+            return;
+        }
+
+        slot.reactor = worker.reactor.get();
+        slot.handle = handle;
+        conn.session = index;
+        (void)worker.reactor->bind_session(handle, *slot.session);
+        worker.counters.logons_routed.fetch_add(1, std::memory_order_relaxed);
+        slot.session->on_data_received(msg);  // The Logon itself: answered here
+    }
+
+    /// Peer closed or the connection failed (the session is already disconnected)
+    void on_closed(Worker& worker, ReactorSessionHandle handle) noexcept {
+        if (handle.slot >= worker.connections.size()) return;
+        Connection& conn = worker.connections[handle.slot];
+        if (conn.fd < 0 || conn.handle.generation != handle.generation) return;
+        release(worker, conn);
+    }
+
+    /// Close connections without a Logon in time and sessions that logged out
+    void sweep(Worker& worker, std::chrono::steady_clock::time_point now) noexcept {
+        for (auto& conn : worker.connections) {
+            if (conn.fd < 0) continue;
+            if (conn.session == FREE) {
+                if (now - conn.accepted_at >= config_.logon_timeout) {
+                    worker.counters.logon_timeouts.fetch_add(1, std::memory_order_relaxed);
+                    drop(worker, conn);
+                }
+            } else if (slab_[conn.session].session->state() == SessionState::Disconnected) {
+                worker.reactor->remove_session(conn.handle);
+                release(worker, conn);
+            }
+        }
+    }
+
+    /// Close an unrouted connection
+    void drop(Worker& worker, Connection& conn) noexcept {
+        worker.reactor->remove_session(conn.handle);
+        if (conn.session != FREE) {
+            release(worker, conn);
+            return;
+        }
+        ::close(conn.fd);
+        conn = Connection{};
+    }
+
+    /// End a logged-on connection and hand its slot back
+    void release(Worker& worker, Connection& conn) noexcept {
+        if (conn.session != FREE) {
+            SessionSlot& slot = slab_[conn.session];
+            slot.reactor = nullptr;
+            slot.owner.store(FREE, std::memory_order_release);
+            worker.counters.sessions_closed.fetch_add(1, std::memory_order_relaxed);
+        }
+        ::close(conn.fd);
+        conn = Connection{};
+    }
+
+    AcceptorEngineConfig config_;
+    std::vector<Spec> specs_;
+    CompIdRouter router_;
+    SessionSlot* slab_{nullptr};  // Indexed by session index
+    size_t slab_count_{0};
+    std::vector<std::unique_ptr<Worker>> workers_;
+    uint16_t port_{0};
+    std::atomic<bool> running_{false};
+};
+
+#endif  // NFX_IO_URING_AVAILABLE
+
+} // namespace nfx
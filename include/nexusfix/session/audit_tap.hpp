@@ -0,0 +1,227 @@
+/*
+    NexusFIX Audit Tap
+
+    Drop-copy / compliance capture of every inbound and outbound message
+    without copying it. The session thread publishes a 32-byte record per
+    message to a BroadcastRing; audit consumers (a persister, a drop-copy
+    forwarder) read the records on their own threads.
+
+    A record only says where the message is:
+    - Inbound: pointer and length inside the receive buffer that carried
+      it. The buffer stays pinned - not recycled to the kernel or the
+      transport - until every attached consumer has moved past the last
+      record pointing into it.
+    - Outbound: the MsgSeqNum it was stored under. The session already
+      keeps a copy in its message store; consumers read it from there
+      (IMessageStore::visit_range()), so nothing is copied twice.
+
+    Buffer lifetime is epoch-based: the ring sequence of a buffer's last
+    record is its epoch, and BroadcastRing::consumed() is the epoch every
+    consumer has passed. Only the producer touches pin state, so capture
+    costs one ring claim/publish and one RDTSCP per message.
+
+    Usage (session thread; handler of a BasicSessionManager):
+        void on_audit(AuditDirection dir, uint32_t seq, std::span<const char> msg) noexcept {
+            (void)tap.record(dir, current_buffer_id, seq, msg);
+        }
+        // Once a receive buffer is fully framed
+        if (tap.done_with(buf_id)) (void)group.replenish(buf_id);
+        tap.reclaim([&](uint16_t id) { (void)group.replenish(id); });
+
+    Usage (audit thread):
+        auto id = tap.subscribe();
+        tap.poll(*id, [&](const AuditRecord& r) {
+            if (r.direction == AuditDirection::Inbound) persist(r.bytes());
+            else store.visit_range(r.seq_num, r.seq_num, persist_stored);
+        });
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+
+#include "nexusfix/memory/broadcast_ring.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+namespace nfx {
+
+/// Which way an audited message went
+enum class AuditDirection : uint8_t {
+    Inbound,   // Bytes in a receive buffer
+    Outbound   // Stored under its MsgSeqNum in the session's message store
+};
+
+/// Location of one audited message (no message bytes)
+struct AuditRecord {
+    const char* data{nullptr};   // Inbound: message in its receive buffer
+    uint32_t length{0};
+    uint32_t seq_num{0};         // MsgSeqNum; the store key for Outbound
+    uint64_t tsc{0};             // RDTSCP when the session tapped it
+    uint16_t buffer{0};          // Inbound: receive buffer id
+    AuditDirection direction{AuditDirection::Inbound};
+
+    /// Inbound message bytes (empty for Outbound: read them from the store)
+    [[nodiscard]] std::span<const char> bytes() const noexcept {
+        return {data, data ? length : 0};
+    }
+};
+
+static_assert(sizeof(AuditRecord) == 32, "AuditRecord is half a cache line");
+
+// ============================================================================
+// Audit Tap
+// ============================================================================
+
+/// Pointer-only broadcast of audited messages with receive-buffer pinning
+/// @tparam Capacity Records in flight (power of 2)
+/// @tparam MaxConsumers Audit consumers
+/// @tparam MaxBuffers Distinct receive buffer ids
+template<size_t Capacity = 4096, size_t MaxConsumers = 4, size_t MaxBuffers = 1024>
+class AuditTap {
+    static_assert(MaxBuffers <= UINT16_MAX, "Buffer ids are 16-bit");
+
+public:
+    using BufferId = uint16_t;
+    using ConsumerId = size_t;
+
+    AuditTap() noexcept = default;
+
+    // Non-copyable, non-movable (records point at buffers tracked here)
+    AuditTap(const AuditTap&) = delete;
+    AuditTap& operator=(const AuditTap&) = delete;
+
+    // ========================================================================
+    // Producer Interface (session thread)
+    // ========================================================================
+
+    /// Publish the location of a message; an inbound one pins its buffer
+    /// @return false if the slowest consumer is Capacity records behind
+    ///         (counted in dropped(); nothing is pinned)
+    [[nodiscard]] NFX_HOT bool record(AuditDirection direction, BufferId buffer,
+                                      uint32_t seq_num, std::span<const char> msg) noexcept {
+        const bool inbound = direction == AuditDirection::Inbound;
+        if (inbound && buffer >= MaxBuffers) [[unlikely]] {
+            ++dropped_;
+            return false;
+        }
+        AuditRecord* slot = ring_.try_claim();
+        if (!slot) [[unlikely]] {
+            ++dropped_;
+            return false;
+        }
+
+        slot->data = inbound ? msg.data() : nullptr;
+        slot->length = static_cast<uint32_t>(msg.size());
+        slot->seq_num = seq_num;
+        slot->tsc = util::detail::rdtscp();
+        slot->buffer = inbound ? buffer : 0;
+        slot->direction = direction;
+
+        if (inbound) {
+            BufferState& state = buffers_[buffer];
+            state.epoch = ring_.published() + 1;  // Sequence after this record
+            state.framing = true;
+        }
+        ring_.publish();
+        return true;
+    }
+
+    /// Record an outbound message stored under seq_num
+    [[nodiscard]] bool record_outbound(uint32_t seq_num, std::span<const char> msg) noexcept {
+        return record(AuditDirection::Outbound, 0, seq_num, msg);
+    }
+
+    /// The producer has framed all messages of a buffer
+    /// @return true if no consumer still reads it: recycle it now.
+    ///         Otherwise reclaim() reports it once they have moved on.
+    [[nodiscard]] bool done_with(BufferId buffer) noexcept {
+        if (buffer >= MaxBuffers) [[unlikely]] return false;
+        BufferState& state = buffers_[buffer];
+        if (!state.framing) return true;
+        state.framing = false;
+        if (state.epoch <= ring_.consumed()) return true;
+        if (!state.waiting) {
+            state.waiting = true;
+            waiting_[waiting_count_++] = buffer;
+        }
+        return false;
+    }
+
+    /// Report waiting buffers every consumer has moved past:
+    /// on_free(BufferId) runs for each. Call regularly from the producer.
+    /// @return Number of buffers freed
+    template<typename OnFree>
+    size_t reclaim(OnFree&& on_free) noexcept {
+        if (waiting_count_ == 0) return 0;
+        const size_t consumed = ring_.consumed();
+        size_t freed = 0;
+        size_t kept = 0;
+        for (size_t i = 0; i < waiting_count_; ++i) {
+            const BufferId buffer = waiting_[i];
+            if (buffers_[buffer].epoch <= consumed) {
+                buffers_[buffer].waiting = false;
+                on_free(buffer);
+                ++freed;
+            } else {
+                waiting_[kept++] = buffer;
+            }
+        }
+        waiting_count_ = kept;
+        return freed;
+    }
+
+    /// Buffers framed but still read by a consumer
+    [[nodiscard]] size_t pinned_buffers() const noexcept { return waiting_count_; }
+
+    /// Records not published because the ring was full
+    [[nodiscard]] uint64_t dropped() const noexcept { return dropped_; }
+
+    /// Detach consumers lagging by max_lag records; their buffers unpin
+    size_t detach_slow(size_t max_lag) noexcept { return ring_.detach_slow(max_lag); }
+
+    // ========================================================================
+    // Consumer Interface (one thread per ConsumerId)
+    // ========================================================================
+
+    /// Attach an audit consumer (before the session starts to see everything)
+    [[nodiscard]] std::optional<ConsumerId> subscribe() noexcept { return ring_.subscribe(); }
+
+    void unsubscribe(ConsumerId id) noexcept { ring_.unsubscribe(id); }
+
+    /// Deliver up to max_count records: handler(const AuditRecord&).
+    /// Inbound bytes are valid until the handler returns.
+    /// @return Records delivered
+    template<typename Handler>
+    size_t poll(ConsumerId id, Handler&& handler,
+                size_t max_count = std::numeric_limits<size_t>::max()) noexcept {
+        return ring_.poll(id, [&](const AuditRecord& r, size_t) { handler(r); }, max_count);
+    }
+
+    /// Records published but not yet consumed by a consumer
+    [[nodiscard]] size_t lag(ConsumerId id) const noexcept { return ring_.lag(id); }
+
+    [[nodiscard]] size_t published() const noexcept { return ring_.published(); }
+
+private:
+    struct BufferState {
+        size_t epoch{0};       // Ring sequence after its last record
+        bool framing{false};   // Recorded into since the last done_with()
+        bool waiting{false};   // In waiting_
+    };
+
+    memory::BroadcastRing<AuditRecord, Capacity, MaxConsumers> ring_;
+
+    // Producer-only state
+    std::array<BufferState, MaxBuffers> buffers_{};
+    std::array<BufferId, MaxBuffers> waiting_{};
+    size_t waiting_count_{0};
+    uint64_t dropped_{0};
+};
+
+} // namespace nfx
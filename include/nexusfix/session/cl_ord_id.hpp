@@ -0,0 +1,224 @@
+/*
+    NexusFIX ClOrdID Generation and Lookup
+
+    ClOrdIDs (11) are <prefix><sequence>: a short session prefix followed by a
+    monotonic sequence in fixed-width base 62. Generating one is Width
+    divide-by-constant steps into a stack buffer; mapping an ExecutionReport
+    back to its order is a prefix compare, a Width-digit decode and an array
+    index. No strings are formatted and no hash map is touched.
+
+    Usage:
+        ClOrdIdMap<4096> orders{"NX1"};            // Sequence seeded from the clock
+
+        auto id = orders.assign(order_slot);       // std::optional<ClOrdId>
+        builder.cl_ord_id(id->view());
+
+        // ExecutionReport / OrderCancelReject
+        if (auto slot = orders.find(msg.get_string(tag::ClOrdID::value))) {
+            Order& order = order_pool[*slot];
+            if (is_terminal(order)) orders.erase(msg.get_string(tag::ClOrdID::value));
+        }
+
+    Seeding from microseconds since the epoch keeps ids increasing across
+    restarts as long as fewer than one order per microsecond is sent on
+    average; pass an explicit start (e.g. a persisted counter) otherwise.
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/serializer/constexpr_serializer.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// ClOrdId Value
+// ============================================================================
+
+/// Encoded ClOrdID held inline (no allocation)
+struct ClOrdId {
+    static constexpr size_t MAX_LEN = 24;
+
+    std::array<char, MAX_LEN> data{};
+    uint8_t len{0};
+
+    [[nodiscard]] constexpr std::string_view view() const noexcept {
+        return {data.data(), len};
+    }
+
+    [[nodiscard]] constexpr bool operator==(const ClOrdId& other) const noexcept {
+        return view() == other.view();
+    }
+};
+
+// ============================================================================
+// ClOrdId Generator
+// ============================================================================
+
+/// Monotonic <prefix><base-62 sequence> ClOrdID generator
+/// @tparam Width Base-62 digits (10 covers 62^10 ~ 8.4e17 sequences)
+template <size_t Width = 10>
+class ClOrdIdGenerator {
+public:
+    using Codec = serializer::FastBase62Serializer<Width>;
+
+    static constexpr size_t WIDTH = Width;
+    static constexpr size_t MAX_PREFIX = ClOrdId::MAX_LEN - Width;
+
+    /// @param prefix Session-unique prefix, truncated to MAX_PREFIX chars
+    /// @param start First sequence, modulo 62^Width (default: microseconds
+    ///        since the epoch)
+    explicit ClOrdIdGenerator(std::string_view prefix,
+                              uint64_t start = seed_from_clock()) noexcept
+        : next_{start % (Codec::MAX_VALUE + 1)}
+    {
+        prefix_len_ = static_cast<uint8_t>(prefix.size() < MAX_PREFIX ? prefix.size() : MAX_PREFIX);
+        std::memcpy(prefix_.data(), prefix.data(), prefix_len_);
+    }
+
+    /// Next ClOrdID
+    [[nodiscard]] NFX_HOT ClOrdId next() noexcept {
+        return encode(next_sequence());
+    }
+
+    /// Reserve the next sequence without encoding it (wraps after MAX_VALUE)
+    [[nodiscard]] uint64_t next_sequence() noexcept {
+        const uint64_t sequence = next_;
+        next_ = sequence == Codec::MAX_VALUE ? 0 : sequence + 1;
+        return sequence;
+    }
+
+    /// ClOrdID text for a sequence
+    [[nodiscard]] NFX_HOT ClOrdId encode(uint64_t sequence) const noexcept {
+        ClOrdId id;
+        std::memcpy(id.data.data(), prefix_.data(), prefix_len_);
+        Codec::serialize_fixed(id.data.data() + prefix_len_, sequence);
+        id.len = static_cast<uint8_t>(prefix_len_ + Width);
+        return id;
+    }
+
+    /// Sequence of a ClOrdID produced by this generator's prefix
+    /// @return nullopt for foreign or malformed ids
+    [[nodiscard]] NFX_HOT std::optional<uint64_t> decode(std::string_view cl_ord_id) const noexcept {
+        if (cl_ord_id.size() != static_cast<size_t>(prefix_len_) + Width) [[unlikely]] {
+            return std::nullopt;
+        }
+        if (std::memcmp(cl_ord_id.data(), prefix_.data(), prefix_len_) != 0) [[unlikely]] {
+            return std::nullopt;
+        }
+        uint64_t sequence;
+        if (!Codec::parse_fixed(cl_ord_id.data() + prefix_len_, sequence)) [[unlikely]] {
+            return std::nullopt;
+        }
+        return sequence;
+    }
+
+    [[nodiscard]] std::string_view prefix() const noexcept {
+        return {prefix_.data(), prefix_len_};
+    }
+
+    /// Sequence the next id will use
+    [[nodiscard]] uint64_t peek_sequence() const noexcept { return next_; }
+
+    /// Microseconds since the epoch, within Width digits
+    [[nodiscard]] static uint64_t seed_from_clock() noexcept {
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        return static_cast<uint64_t>(us) % (Codec::MAX_VALUE + 1);
+    }
+
+private:
+    std::array<char, MAX_PREFIX> prefix_{};
+    uint8_t prefix_len_{0};
+    uint64_t next_{0};
+};
+
+// ============================================================================
+// ClOrdId -> Slot Map
+// ============================================================================
+
+/// Fixed-capacity map from our ClOrdIDs to caller slot indices (e.g. order
+/// pool indices). The sequence selects the entry directly (sequence mod
+/// Capacity); a stored sequence confirms the match, so stale or foreign ids
+/// miss instead of aliasing. Capacity bounds the live (not yet erased)
+/// orders; assign() skips sequences whose entry is still live.
+template <size_t Capacity = 4096, size_t Width = 10>
+class ClOrdIdMap {
+public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of 2");
+
+    using Generator = ClOrdIdGenerator<Width>;
+
+    explicit ClOrdIdMap(std::string_view prefix,
+                        uint64_t start = Generator::seed_from_clock()) noexcept
+        : generator_{prefix, start} {}
+
+    ClOrdIdMap(const ClOrdIdMap&) = delete;
+    ClOrdIdMap& operator=(const ClOrdIdMap&) = delete;
+
+    /// Allocate a ClOrdID mapped to `slot`
+    /// @return nullopt if Capacity orders are live
+    [[nodiscard]] NFX_HOT std::optional<ClOrdId> assign(uint32_t slot) noexcept {
+        if (live_ == Capacity) [[unlikely]] return std::nullopt;
+        for (;;) {
+            const uint64_t sequence = generator_.next_sequence();
+            Entry& e = entries_[sequence & (Capacity - 1)];
+            if (e.live) [[unlikely]] continue;  // A long-lived order holds it
+            e = Entry{sequence, slot, true};
+            ++live_;
+            return generator_.encode(sequence);
+        }
+    }
+
+    /// Slot of a live ClOrdID; nullopt for foreign, unknown or erased ids
+    [[nodiscard]] NFX_HOT std::optional<uint32_t> find(std::string_view cl_ord_id) const noexcept {
+        const auto index = lookup(cl_ord_id);
+        if (!index) return std::nullopt;
+        return entries_[*index].slot;
+    }
+
+    /// Forget a ClOrdID (order reached a terminal state or was replaced)
+    bool erase(std::string_view cl_ord_id) noexcept {
+        const auto index = lookup(cl_ord_id);
+        if (!index) return false;
+        entries_[*index].live = false;
+        --live_;
+        return true;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return live_; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return Capacity; }
+    [[nodiscard]] const Generator& generator() const noexcept { return generator_; }
+
+private:
+    struct Entry {
+        uint64_t sequence{0};
+        uint32_t slot{0};
+        bool live{false};
+    };
+
+    /// Entry index of a live ClOrdID
+    [[nodiscard]] std::optional<size_t> lookup(std::string_view cl_ord_id) const noexcept {
+        const auto sequence = generator_.decode(cl_ord_id);
+        if (!sequence) [[unlikely]] return std::nullopt;
+        const size_t index = static_cast<size_t>(*sequence & (Capacity - 1));
+        const Entry& e = entries_[index];
+        if (!e.live || e.sequence != *sequence) [[unlikely]] return std::nullopt;
+        return index;
+    }
+
+    Generator generator_;
+    std::array<Entry, Capacity> entries_{};
+    size_t live_{0};
+};
+
+} // namespace nfx
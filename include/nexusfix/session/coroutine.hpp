@@ -1,15 +1,147 @@
 #pragma once
 
 #include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <new>
 #include <optional>
 #include <variant>
 #include <exception>
 #include <utility>
 
+#include "nexusfix/platform/platform.hpp"
 #include "nexusfix/types/error.hpp"
+#include "nexusfix/util/thread_local_pool.hpp"
+
+/// Pooled frames per size class per thread (128/256/512/1024 bytes)
+#ifndef NFX_COROUTINE_FRAMES_PER_CLASS
+#define NFX_COROUTINE_FRAMES_PER_CLASS 512
+#endif
 
 namespace nfx {
 
+// ============================================================================
+// Coroutine Frame Pool
+// ============================================================================
+
+/// Thread-local size-class allocator for coroutine frames. Task<T> frames
+/// come from ThreadLocalPool blocks of 128, 256, 512 or 1024 bytes; larger
+/// frames, and frames allocated once a class is exhausted, go to the heap.
+/// A 16-byte header records each frame's owning pool, so a frame destroyed
+/// on another thread goes back to its owner through the pool's remote
+/// free stack.
+class FramePool {
+public:
+    static constexpr size_t FRAMES_PER_CLASS = NFX_COROUTINE_FRAMES_PER_CLASS;
+    static constexpr size_t HEADER_SIZE = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    static constexpr size_t MAX_POOLED_FRAME = 1024 - HEADER_SIZE;
+
+    /// Per-thread counters
+    struct Stats {
+        uint64_t pooled{0};        // Frames served from a size class
+        uint64_t heap{0};          // Oversized or class exhausted
+        uint64_t remote_frees{0};  // Pooled frames of another thread freed here
+    };
+
+    /// Frame storage for `size` bytes (throws std::bad_alloc like operator new)
+    [[nodiscard]] NFX_HOT static void* allocate(size_t size) {
+        const size_t total = size + HEADER_SIZE;
+        Header header{nullptr, HEAP};
+        void* block = nullptr;
+        if (total <= 1024) [[likely]] {
+            header.size_class = size_class(total);
+            block = acquire(header.size_class, header.pool);
+        }
+        if (block == nullptr) [[unlikely]] {
+            block = ::operator new(total);
+            header.size_class = HEAP;
+            ++stats_ref().heap;
+        } else {
+            ++stats_ref().pooled;
+        }
+        *static_cast<Header*>(block) = header;
+        return static_cast<std::byte*>(block) + HEADER_SIZE;
+    }
+
+    NFX_HOT static void deallocate(void* frame, size_t size) noexcept {
+        if (frame == nullptr) return;
+        void* block = static_cast<std::byte*>(frame) - HEADER_SIZE;
+        const Header header = *static_cast<const Header*>(block);
+        switch (header.size_class) {
+            case 0: release(static_cast<Pool<128>*>(header.pool), block); break;
+            case 1: release(static_cast<Pool<256>*>(header.pool), block); break;
+            case 2: release(static_cast<Pool<512>*>(header.pool), block); break;
+            case 3: release(static_cast<Pool<1024>*>(header.pool), block); break;
+            default: ::operator delete(block, size + HEADER_SIZE); break;
+        }
+    }
+
+    /// This thread's counters
+    [[nodiscard]] static const Stats& stats() noexcept { return stats_ref(); }
+    static void reset_stats() noexcept { stats_ref() = Stats{}; }
+
+private:
+    static constexpr uint8_t HEAP = 0xFF;
+
+    struct Header {
+        void* pool;          // Owning ThreadLocalPool
+        uint8_t size_class;  // 0-3, or HEAP
+    };
+    static_assert(sizeof(Header) <= HEADER_SIZE);
+
+    template <size_t Size>
+    struct alignas(util::CACHE_LINE_SIZE) Block {
+        std::byte bytes[Size];
+    };
+
+    template <size_t Size>
+    using Pool = util::ThreadLocalPool<Block<Size>, FRAMES_PER_CLASS>;
+
+    /// 0: <=128, 1: <=256, 2: <=512, 3: <=1024
+    [[nodiscard]] static uint8_t size_class(size_t total) noexcept {
+        return static_cast<uint8_t>((total > 128) + (total > 256) + (total > 512));
+    }
+
+    [[nodiscard]] static void* acquire(uint8_t cls, void*& pool) noexcept {
+        switch (cls) {
+            case 0: return acquire_from(Pool<128>::instance(), pool);
+            case 1: return acquire_from(Pool<256>::instance(), pool);
+            case 2: return acquire_from(Pool<512>::instance(), pool);
+            default: return acquire_from(Pool<1024>::instance(), pool);
+        }
+    }
+
+    template <typename P>
+    [[nodiscard]] static void* acquire_from(P& pool, void*& owner) noexcept {
+        owner = &pool;
+        return pool.acquire();
+    }
+
+    template <typename P>
+    static void release(P* pool, void* block) noexcept {
+        auto* typed = static_cast<typename P::value_type*>(block);
+        if (P::local() == pool) [[likely]] {
+            pool->release(typed);
+        } else {
+            pool->release_remote(typed);
+            ++stats_ref().remote_frees;
+        }
+    }
+
+    [[nodiscard]] static Stats& stats_ref() noexcept {
+        thread_local Stats stats;
+        return stats;
+    }
+};
+
+/// Promise base routing frame allocation through FramePool
+struct PooledFrame {
+    static void* operator new(size_t size) { return FramePool::allocate(size); }
+    static void operator delete(void* frame, size_t size) noexcept {
+        FramePool::deallocate(frame, size);
+    }
+};
+
 // ============================================================================
 // Task<T> - Lazy Coroutine for Async Operations
 // ============================================================================
@@ -21,7 +153,7 @@ public:
     struct promise_type;
     using handle_type = std::coroutine_handle<promise_type>;
 
-    struct promise_type {
+    struct promise_type : PooledFrame {
         std::optional<T> result;
         std::exception_ptr exception;
         std::coroutine_handle<> continuation;
@@ -145,7 +277,7 @@ public:
     struct promise_type;
     using handle_type = std::coroutine_handle<promise_type>;
 
-    struct promise_type {
+    struct promise_type : PooledFrame {
         std::exception_ptr exception;
         std::coroutine_handle<> continuation;
 
@@ -0,0 +1,252 @@
+/*
+    NexusFIX Exchange Simulator
+
+    Acceptor-side fill engine for load and latency testing: every
+    NewOrderSingle a counterparty sends is answered with a configurable
+    ExecutionReport pattern (ack only, ack + fill, ack + N partial fills,
+    reject every Nth order), optionally after an injected delay.
+
+    The simulator owns no sessions. It turns orders into
+    ExecutionReport::Builder values and hands them to a sink, typically
+    SessionManager::send_execution_report(), which encodes them through the
+    session's pre-rendered layout template. OrderIDs and ExecIDs come from
+    ClOrdIdGenerator, so no strings are formatted per report.
+
+    Usage:
+        ExchangeSimulator sim{{.fill = FillPattern::PartialFills,
+                               .partial_fills = 4,
+                               .latency_ns = 20'000}};
+
+        // on_app_message, 35=D
+        if (auto order = fix44::NewOrderSingle::from_buffer(raw)) {
+            sim.on_new_order(*order, now_ns, [&](const auto& report) {
+                (void)session.send_execution_report(report);
+            });
+        }
+
+        // Event loop
+        sim.poll(now_ns, sink);
+
+    Delayed orders wait in a fixed-capacity FIFO released by poll(); the
+    delay is the same for every order, so release order is arrival order.
+    When the FIFO is full, or an order's ClOrdID/Symbol exceed the inline
+    copies, the order is answered immediately and counted in stats.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/messages/fix44/execution_report.hpp"
+#include "nexusfix/session/cl_ord_id.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+/// ExecutionReports sent for each accepted order
+enum class FillPattern : uint8_t {
+    AckOnly,        ///< 150=0 New, order rests forever
+    AckAndFill,     ///< 150=0 New, then one 150=2 Fill
+    PartialFills    ///< 150=0 New, then partial_fills reports ending in Fill
+};
+
+struct SimulatorConfig {
+    FillPattern fill{FillPattern::AckAndFill};
+    uint32_t partial_fills{2};       ///< Fills per order for PartialFills
+    uint32_t reject_every{0};        ///< Reject every Nth order (0 = never)
+    uint64_t latency_ns{0};          ///< Delay before an order's reports
+    size_t queue_capacity{65536};    ///< Delayed orders held at once (power of two)
+    FixedPrice market_price{FixedPrice::from_string("100")};  ///< Fill price for market orders
+    std::string_view reject_text{"simulated reject"};
+};
+
+struct SimulatorStats {
+    uint64_t orders{0};
+    uint64_t rejects{0};
+    uint64_t reports{0};
+    uint64_t fills{0};
+    uint64_t undelayed{0};           ///< Answered immediately: queue full or oversize fields
+};
+
+// ============================================================================
+// Exchange Simulator
+// ============================================================================
+
+class ExchangeSimulator {
+public:
+    using IdGenerator = ClOrdIdGenerator<8>;
+
+    static constexpr size_t MAX_CL_ORD_ID = 40;
+    static constexpr size_t MAX_SYMBOL = 24;
+
+    explicit ExchangeSimulator(SimulatorConfig config = {}) noexcept
+        : config_{config}
+        , order_ids_{"O", 0}
+        , exec_ids_{"X", 0}
+    {
+        size_t capacity = 1;
+        while (capacity < config_.queue_capacity) capacity <<= 1;
+        queue_.resize(config_.latency_ns > 0 ? capacity : 0);
+        mask_ = capacity - 1;
+    }
+
+    /// Answer a NewOrderSingle, now or after latency_ns
+    /// @param sink Called with each ExecutionReport::Builder, in order
+    template <typename Sink>
+    NFX_HOT void on_new_order(const fix44::NewOrderSingle& order, uint64_t now_ns,
+                              Sink&& sink) noexcept
+    {
+        ++stats_.orders;
+        const bool reject = config_.reject_every != 0 &&
+                            stats_.orders % config_.reject_every == 0;
+        const FixedPrice px = order.ord_type == OrdType::Market || order.price.raw == 0
+                                  ? config_.market_price : order.price;
+
+        if (config_.latency_ns == 0) {
+            answer(order.cl_ord_id, order.symbol, order.side, order.order_qty, px,
+                   reject, sink);
+            return;
+        }
+
+        if (tail_ - head_ == queue_.size() ||
+            order.cl_ord_id.size() > MAX_CL_ORD_ID ||
+            order.symbol.size() > MAX_SYMBOL) [[unlikely]] {
+            ++stats_.undelayed;
+            answer(order.cl_ord_id, order.symbol, order.side, order.order_qty, px,
+                   reject, sink);
+            return;
+        }
+
+        Pending& p = queue_[tail_++ & mask_];
+        p.due_ns = now_ns + config_.latency_ns;
+        p.qty = order.order_qty;
+        p.px = px;
+        p.side = order.side;
+        p.reject = reject;
+        p.cl_ord_id_len = static_cast<uint8_t>(order.cl_ord_id.size());
+        p.symbol_len = static_cast<uint8_t>(order.symbol.size());
+        std::memcpy(p.cl_ord_id.data(), order.cl_ord_id.data(), p.cl_ord_id_len);
+        std::memcpy(p.symbol.data(), order.symbol.data(), p.symbol_len);
+    }
+
+    /// Release delayed orders due at or before now_ns
+    /// @return Orders released
+    template <typename Sink>
+    size_t poll(uint64_t now_ns, Sink&& sink) noexcept {
+        size_t released = 0;
+        while (head_ != tail_) {
+            const Pending& p = queue_[head_ & mask_];
+            if (p.due_ns > now_ns) break;
+            answer({p.cl_ord_id.data(), p.cl_ord_id_len}, {p.symbol.data(), p.symbol_len},
+                   p.side, p.qty, p.px, p.reject, sink);
+            ++head_;
+            ++released;
+        }
+        return released;
+    }
+
+    /// Orders waiting for their delay to elapse
+    [[nodiscard]] size_t pending() const noexcept { return static_cast<size_t>(tail_ - head_); }
+
+    /// Due time of the oldest delayed order (0 when none is pending)
+    [[nodiscard]] uint64_t next_due() const noexcept {
+        return head_ == tail_ ? 0 : queue_[head_ & mask_].due_ns;
+    }
+
+    [[nodiscard]] const SimulatorConfig& config() const noexcept { return config_; }
+    [[nodiscard]] const SimulatorStats& stats() const noexcept { return stats_; }
+
+private:
+    struct Pending {
+        uint64_t due_ns{0};
+        Qty qty;
+        FixedPrice px;
+        Side side{Side::Buy};
+        bool reject{false};
+        uint8_t cl_ord_id_len{0};
+        uint8_t symbol_len{0};
+        std::array<char, MAX_CL_ORD_ID> cl_ord_id{};
+        std::array<char, MAX_SYMBOL> symbol{};
+    };
+
+    template <typename Sink>
+    NFX_HOT void answer(std::string_view cl_ord_id, std::string_view symbol, Side side,
+                        Qty qty, FixedPrice px, bool reject, Sink& sink) noexcept
+    {
+        const ClOrdId order_id = order_ids_.next();
+        ClOrdId exec_id = exec_ids_.next();
+
+        fix44::ExecutionReport::Builder report;
+        report.order_id(order_id.view())
+            .exec_id(exec_id.view())
+            .cl_ord_id(cl_ord_id)
+            .symbol(symbol)
+            .side(side)
+            .order_qty(qty)
+            .avg_px(FixedPrice{});
+
+        if (reject) {
+            ++stats_.rejects;
+            report.exec_type(ExecType::Rejected).ord_status(OrdStatus::Rejected)
+                .leaves_qty(Qty{}).cum_qty(Qty{}).text(config_.reject_text);
+            emit(report, sink);
+            return;
+        }
+
+        report.exec_type(ExecType::New).ord_status(OrdStatus::New)
+            .leaves_qty(qty).cum_qty(Qty{});
+        emit(report, sink);
+        if (config_.fill == FillPattern::AckOnly) return;
+
+        // Whole-unit fills: the last one takes the remainder
+        const int64_t total = qty.whole();
+        int64_t fills = config_.fill == FillPattern::PartialFills
+                            ? std::max<int64_t>(config_.partial_fills, 1) : 1;
+        fills = std::clamp<int64_t>(fills, 1, std::max<int64_t>(total, 1));
+        const int64_t lot = total / fills;
+
+        int64_t done = 0;
+        report.avg_px(px).last_px(px);
+        for (int64_t i = 1; i <= fills; ++i) {
+            const int64_t last = i == fills ? total - done : lot;
+            done += last;
+            exec_id = exec_ids_.next();
+            report.exec_id(exec_id.view())
+                .exec_type(i == fills ? ExecType::Fill : ExecType::PartialFill)
+                .ord_status(i == fills ? OrdStatus::Filled : OrdStatus::PartiallyFilled)
+                .leaves_qty(Qty::from_int(total - done))
+                .cum_qty(Qty::from_int(done))
+                .last_qty(Qty::from_int(last));
+            ++stats_.fills;
+            emit(report, sink);
+        }
+    }
+
+    template <typename Sink>
+    void emit(const fix44::ExecutionReport::Builder& report, Sink& sink) noexcept {
+        ++stats_.reports;
+        sink(report);
+    }
+
+    SimulatorConfig config_;
+    SimulatorStats stats_;
+    IdGenerator order_ids_;
+    IdGenerator exec_ids_;
+    std::vector<Pending> queue_;
+    size_t mask_{0};
+    uint64_t head_{0};
+    uint64_t tail_{0};
+};
+
+} // namespace nfx
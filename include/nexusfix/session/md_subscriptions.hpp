@@ -0,0 +1,446 @@
+/*
+    NexusFIX Market Data Subscriptions
+
+    Subscribing to thousands of symbols with one MarketDataRequest each
+    floods the session at startup. MarketDataSubscriptions queues symbols
+    and packs them into multi-symbol 35=V requests (RelatedSym group) of up
+    to Config::max_symbols_per_request, the venue's limit. Requests go out
+    through send_app_message(), so the session's outbound throttle paces
+    them: pump() stops at the first request the session does not take
+    (Throttled, NotConnected) and carries on from there on the next call.
+
+    Symbols are interned once (SymbolTable); per-symbol state lives in flat
+    arrays indexed by SymbolId. An MDReqID is <prefix><number>, where the
+    number encodes a request-table slot and its generation, so a 35=Y or a
+    refresh finds its request, and through it the request's symbols
+    (linked through their entries), without a string map.
+
+    Rejects:
+    - A symbol-specific reject (UnknownSymbol, InsufficientPermissions,
+      Other or no reason) of a multi-symbol request queues each of its
+      symbols again to be requested alone, so only the offending ones end
+      up Rejected
+    - Any other reject, or a reject of a single-symbol request, marks the
+      request's symbols Rejected with the MDReqRejReason
+
+    Usage:
+        MarketDataSubscriptions md{{.md_req_id_prefix = "MD", .max_symbols_per_request = 50}};
+        for (std::string_view s : universe) (void)md.subscribe(s);
+
+        // After logon (md.resubscribe_all() after a reconnect) and on
+        // every timer tick until md.queued() == 0
+        md.pump(session);
+
+        // on_app_message
+        (void)md.on_message(msg);   // 35=Y, W, X
+
+    Single-threaded: run on the session thread. Large (the symbol table
+    dominates): allocate it once.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/messages/fix44/market_data.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/types/market_data_types.hpp"
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/util/symbol_table.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Subscription State
+// ============================================================================
+
+/// Where a symbol's subscription stands
+enum class SubscriptionState : uint8_t {
+    None,        // Not subscribed
+    Queued,      // Waiting for pump()
+    Requested,   // In a sent 35=V, no response yet
+    Active,      // Snapshot or update received for its request
+    Rejected     // 35=Y; see reject_reason()
+};
+
+inline constexpr std::array<MDEntryType, 2> DEFAULT_MD_ENTRY_TYPES{
+    MDEntryType::Bid, MDEntryType::Offer};
+
+/// What every batched 35=V asks for
+struct MarketDataSubscriptionConfig {
+    std::string_view md_req_id_prefix{"MD"};     // Copied; at most 8 chars
+    size_t max_symbols_per_request{fix44::MarketDataRequest::Builder::MAX_SYMBOLS};
+    int market_depth{1};
+    MDUpdateType md_update_type{MDUpdateType::IncrementalRefresh};
+    bool aggregated_book{true};
+    std::span<const MDEntryType> entry_types{DEFAULT_MD_ENTRY_TYPES};  // Copied
+};
+
+/// What a 35=Y did to the subscriptions
+struct MdRejectOutcome {
+    bool known{false};        // MDReqID is one of ours and still live
+    MDReqRejReason reason{MDReqRejReason::Other};
+    size_t rejected{0};       // Symbols now Rejected
+    size_t requeued{0};       // Symbols queued again to be requested alone
+};
+
+/// Counters since construction
+struct MarketDataSubscriptionStats {
+    uint64_t requests_sent{0};
+    uint64_t symbols_requested{0};
+    uint64_t rejects{0};
+    uint64_t pump_stalls{0};  // pump() calls stopped by the session
+};
+
+// ============================================================================
+// Market Data Subscriptions
+// ============================================================================
+
+/// Batched MarketDataRequest subscriptions keyed by symbol and MDReqID
+/// @tparam MaxSymbols Symbols tracked, power of 2
+template <size_t MaxSymbols = 4096>
+class BasicMarketDataSubscriptions {
+public:
+    static_assert(MaxSymbols > 0 && (MaxSymbols & (MaxSymbols - 1)) == 0,
+                  "MaxSymbols must be a power of 2");
+
+    using Config = MarketDataSubscriptionConfig;
+
+    static constexpr size_t MAX_PREFIX = 8;
+
+    explicit BasicMarketDataSubscriptions(const Config& config = {}) noexcept
+        : config_{config}
+    {
+        prefix_len_ = std::min(config.md_req_id_prefix.size(), MAX_PREFIX);
+        std::copy_n(config.md_req_id_prefix.data(), prefix_len_, prefix_.data());
+        config_.md_req_id_prefix = {};
+        config_.max_symbols_per_request = std::clamp<size_t>(
+            config.max_symbols_per_request, 1, fix44::MarketDataRequest::Builder::MAX_SYMBOLS);
+        entry_type_count_ = std::min(config.entry_types.size(), entry_types_.size());
+        std::copy_n(config.entry_types.data(), entry_type_count_, entry_types_.data());
+        config_.entry_types = {};
+
+        for (size_t i = 0; i < MaxSymbols; ++i) {
+            free_slots_[i] = static_cast<uint32_t>(MaxSymbols - 1 - i);
+        }
+        free_count_ = MaxSymbols;
+    }
+
+    BasicMarketDataSubscriptions(const BasicMarketDataSubscriptions&) = delete;
+    BasicMarketDataSubscriptions& operator=(const BasicMarketDataSubscriptions&) = delete;
+
+    // ========================================================================
+    // Subscribing
+    // ========================================================================
+
+    /// Queue a symbol for the next pump(); a Rejected symbol is retried
+    /// alone, one already queued, requested or active is left as is
+    /// @return false if the symbol is empty, too long, or the table is full
+    [[nodiscard]] bool subscribe(std::string_view symbol) noexcept {
+        const SymbolId id = symbols_.intern(symbol);
+        if (!id.valid()) [[unlikely]] return false;
+        Entry& entry = entries_[id.value];
+        if (entry.state == SubscriptionState::Rejected) {
+            entry.alone = true;
+            enqueue(id.value);
+        } else if (entry.state == SubscriptionState::None) {
+            enqueue(id.value);
+        }
+        return true;
+    }
+
+    /// Send queued symbols as batched 35=V requests until the queue is
+    /// empty or the session refuses one (throttle, not logged on)
+    /// @return Requests sent by this call
+    template <typename Session>
+    size_t pump(Session& session) noexcept {
+        size_t sent = 0;
+        while (queued_ != 0) {
+            fix44::MarketDataRequest::Builder request;
+            request.subscription_type(SubscriptionRequestType::SnapshotPlusUpdates)
+                .market_depth(config_.market_depth)
+                .md_update_type(config_.md_update_type)
+                .aggregated_book(config_.aggregated_book);
+            for (size_t i = 0; i < entry_type_count_; ++i) {
+                request.add_entry_type(entry_types_[i]);
+            }
+
+            // A symbol retried alone goes in a request of its own
+            const size_t limit = std::min(config_.max_symbols_per_request, queued_);
+            size_t count = 0;
+            while (count < limit) {
+                const uint32_t sym = queue_[(queue_head_ + count) & MASK];
+                if (entries_[sym].alone && count != 0) break;
+                request.add_symbol(symbols_.name(SymbolId{sym}));
+                ++count;
+                if (entries_[sym].alone) break;
+            }
+
+            const uint32_t slot = free_slots_[free_count_ - 1];
+            const uint32_t generation = requests_[slot].generation + 1;
+            std::array<char, MAX_PREFIX + 20> id_buf;
+            request.md_req_id(format_id(id_buf, slot, generation));
+
+            if (auto result = session.send_app_message(request); !result) [[unlikely]] {
+                last_error_ = result.error().code;
+                ++stats_.pump_stalls;
+                break;
+            }
+
+            --free_count_;
+            Request& req = requests_[slot];
+            req = Request{generation, NO_SYMBOL, static_cast<uint32_t>(count), true, false};
+            for (size_t i = count; i-- > 0;) {   // Linked in request order
+                const uint32_t sym = queue_[(queue_head_ + i) & MASK];
+                Entry& entry = entries_[sym];
+                entry.request = slot;
+                entry.next = req.head;
+                req.head = sym;
+                set_state(entry, SubscriptionState::Requested);
+            }
+            queue_head_ = (queue_head_ + count) & MASK;
+            queued_ -= count;
+            ++stats_.requests_sent;
+            stats_.symbols_requested += count;
+            ++sent;
+        }
+        return sent;
+    }
+
+    /// Queue every requested, active or queued symbol again (after a
+    /// reconnect, when the venue has forgotten our MDReqIDs); Rejected
+    /// symbols stay rejected
+    void resubscribe_all() noexcept {
+        queue_head_ = 0;
+        queued_ = 0;
+        for (uint32_t slot = 0; slot < MaxSymbols; ++slot) {
+            if (requests_[slot].live) release(slot);
+        }
+        for (uint32_t sym = 0; sym < symbols_.size(); ++sym) {
+            Entry& entry = entries_[sym];
+            if (entry.state == SubscriptionState::Queued ||
+                entry.state == SubscriptionState::Requested ||
+                entry.state == SubscriptionState::Active) {
+                enqueue(sym);
+            }
+        }
+    }
+
+    // ========================================================================
+    // Inbound
+    // ========================================================================
+
+    /// Route a 35=Y / W / X; false for other messages and foreign MDReqIDs
+    bool on_message(const IndexedParser& msg) noexcept {
+        switch (msg.msg_type()) {
+            case msg_type::MarketDataRequestReject:
+                return on_reject(msg).known;
+            case msg_type::MarketDataSnapshotFullRefresh:
+            case msg_type::MarketDataIncrementalRefresh:
+                return on_refresh(msg);
+            default:
+                return false;
+        }
+    }
+
+    /// Apply a MarketDataRequestReject (35=Y)
+    MdRejectOutcome on_reject(const IndexedParser& msg) noexcept {
+        MdRejectOutcome outcome;
+        const uint32_t slot = lookup(msg.get_string(tag::MDReqID::value));
+        if (slot == NO_SLOT) [[unlikely]] return outcome;
+        outcome.known = true;
+        ++stats_.rejects;
+
+        const char reason = msg.get_char(tag::MDReqRejReason::value);
+        if (reason != '\0') outcome.reason = static_cast<MDReqRejReason>(reason);
+
+        Request& req = requests_[slot];
+        const bool split = req.count > 1 && per_symbol(outcome.reason);
+        for (uint32_t sym = req.head; sym != NO_SYMBOL;) {
+            Entry& entry = entries_[sym];
+            const uint32_t next = entry.next;
+            if (split) {
+                entry.alone = true;
+                enqueue(sym);
+                ++outcome.requeued;
+            } else {
+                entry.reason = outcome.reason;
+                set_state(entry, SubscriptionState::Rejected);
+                ++outcome.rejected;
+            }
+            sym = next;
+        }
+        release(slot);
+        return outcome;
+    }
+
+    /// Mark a request's symbols Active on its first snapshot or update
+    /// @return false if the MDReqID (262) is absent or not ours
+    bool on_refresh(const IndexedParser& msg) noexcept {
+        const uint32_t slot = lookup(msg.get_string(tag::MDReqID::value));
+        if (slot == NO_SLOT) return false;
+        Request& req = requests_[slot];
+        if (!req.active) [[unlikely]] {
+            req.active = true;
+            for (uint32_t sym = req.head; sym != NO_SYMBOL; sym = entries_[sym].next) {
+                set_state(entries_[sym], SubscriptionState::Active);
+            }
+        }
+        return true;
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    [[nodiscard]] SubscriptionState state(std::string_view symbol) const noexcept {
+        const SymbolId id = symbols_.find(symbol);
+        return id.valid() ? entries_[id.value].state : SubscriptionState::None;
+    }
+
+    /// MDReqRejReason of a Rejected symbol
+    [[nodiscard]] MDReqRejReason reject_reason(std::string_view symbol) const noexcept {
+        const SymbolId id = symbols_.find(symbol);
+        return id.valid() ? entries_[id.value].reason : MDReqRejReason::Other;
+    }
+
+    /// Symbols of a live request, fn(std::string_view symbol)
+    /// @return false if the MDReqID is not a live request of ours
+    template <typename Fn>
+    bool for_each_symbol(std::string_view md_req_id, Fn&& fn) const {
+        const uint32_t slot = lookup(md_req_id);
+        if (slot == NO_SLOT) return false;
+        for (uint32_t sym = requests_[slot].head; sym != NO_SYMBOL; sym = entries_[sym].next) {
+            fn(symbols_.name(SymbolId{sym}));
+        }
+        return true;
+    }
+
+    /// Symbols in a state
+    [[nodiscard]] size_t count(SubscriptionState s) const noexcept {
+        return counts_[static_cast<size_t>(s)];
+    }
+
+    /// Symbols waiting for pump()
+    [[nodiscard]] size_t queued() const noexcept { return queued_; }
+
+    /// Requests sent and not yet rejected
+    [[nodiscard]] size_t live_requests() const noexcept { return MaxSymbols - free_count_; }
+
+    /// Why the last pump() stopped early
+    [[nodiscard]] SessionErrorCode last_error() const noexcept { return last_error_; }
+
+    [[nodiscard]] const MarketDataSubscriptionStats& stats() const noexcept { return stats_; }
+
+private:
+    static constexpr uint32_t MASK = static_cast<uint32_t>(MaxSymbols - 1);
+    static constexpr uint32_t NO_SYMBOL = UINT32_MAX;
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+    /// One symbol's subscription
+    struct Entry {
+        uint32_t request{NO_SLOT};   // Request slot while Requested / Active
+        uint32_t next{NO_SYMBOL};    // Next symbol of the same request
+        SubscriptionState state{SubscriptionState::None};
+        MDReqRejReason reason{MDReqRejReason::Other};
+        bool alone{false};           // Request on its own (after a batch reject)
+    };
+
+    /// One sent 35=V; its slot and generation make the MDReqID
+    struct Request {
+        uint32_t generation{0};
+        uint32_t head{NO_SYMBOL};    // First symbol, linked through Entry::next
+        uint32_t count{0};
+        bool live{false};
+        bool active{false};
+    };
+
+    /// Reasons that may concern only some symbols of a batch
+    [[nodiscard]] static constexpr bool per_symbol(MDReqRejReason reason) noexcept {
+        return reason == MDReqRejReason::UnknownSymbol ||
+               reason == MDReqRejReason::InsufficientPermissions ||
+               reason == MDReqRejReason::Other;
+    }
+
+    void enqueue(uint32_t sym) noexcept {
+        queue_[(queue_head_ + queued_) & MASK] = sym;
+        ++queued_;
+        set_state(entries_[sym], SubscriptionState::Queued);
+    }
+
+    void set_state(Entry& entry, SubscriptionState s) noexcept {
+        --counts_[static_cast<size_t>(entry.state)];
+        ++counts_[static_cast<size_t>(s)];
+        entry.state = s;
+    }
+
+    void release(uint32_t slot) noexcept {
+        requests_[slot].live = false;
+        requests_[slot].head = NO_SYMBOL;
+        free_slots_[free_count_++] = slot;
+    }
+
+    /// <prefix><generation * MaxSymbols + slot> into `buf`
+    [[nodiscard]] std::string_view format_id(std::array<char, MAX_PREFIX + 20>& buf,
+                                             uint32_t slot, uint32_t generation) const noexcept {
+        std::copy_n(prefix_.data(), prefix_len_, buf.data());
+        uint64_t number = uint64_t{generation} * MaxSymbols + slot;
+        char digits[20];
+        size_t n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + number % 10);
+            number /= 10;
+        } while (number != 0);
+        for (size_t i = 0; i < n; ++i) buf[prefix_len_ + i] = digits[n - 1 - i];
+        return {buf.data(), prefix_len_ + n};
+    }
+
+    /// Slot of a live request by MDReqID, NO_SLOT if not ours
+    [[nodiscard]] uint32_t lookup(std::string_view md_req_id) const noexcept {
+        if (md_req_id.size() <= prefix_len_ || md_req_id.size() > prefix_len_ + 19 ||
+            md_req_id.substr(0, prefix_len_) != std::string_view{prefix_.data(), prefix_len_}) {
+            return NO_SLOT;
+        }
+        uint64_t number = 0;
+        for (char c : md_req_id.substr(prefix_len_)) {
+            if (c < '0' || c > '9') return NO_SLOT;
+            number = number * 10 + static_cast<uint64_t>(c - '0');
+        }
+        const auto slot = static_cast<uint32_t>(number & MASK);
+        const Request& req = requests_[slot];
+        if (!req.live || uint64_t{req.generation} != number / MaxSymbols) return NO_SLOT;
+        return slot;
+    }
+
+    Config config_;
+    std::array<char, MAX_PREFIX> prefix_{};
+    size_t prefix_len_{0};
+    std::array<MDEntryType, fix44::MarketDataRequest::Builder::MAX_ENTRY_TYPES> entry_types_{};
+    size_t entry_type_count_{0};
+
+    util::BasicSymbolTable<MaxSymbols> symbols_;
+    std::array<Entry, MaxSymbols> entries_{};
+    std::array<size_t, 5> counts_{MaxSymbols, 0, 0, 0, 0};  // By SubscriptionState
+
+    std::array<uint32_t, MaxSymbols> queue_{};   // Ring of Queued symbols
+    uint32_t queue_head_{0};
+    size_t queued_{0};
+
+    std::array<Request, MaxSymbols> requests_{};
+    std::array<uint32_t, MaxSymbols> free_slots_{};
+    size_t free_count_{0};
+
+    SessionErrorCode last_error_{SessionErrorCode::None};
+    MarketDataSubscriptionStats stats_{};
+};
+
+/// Up to 4096 symbols
+using MarketDataSubscriptions = BasicMarketDataSubscriptions<>;
+
+} // namespace nfx
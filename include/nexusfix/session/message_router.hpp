@@ -0,0 +1,398 @@
+/*
+    NexusFIX Message Router
+
+    Forwards messages between sessions of a FIX hub (client orders to a
+    venue, venue executions back to the client) without parsing the
+    message into fields or serializing it again.
+
+    - Matching: rules are conditions on indexed fields (tag = value, or
+      tag present) evaluated in insertion order, first match wins. The
+      tags named by all rules are compiled into a slot table, so one pass
+      over the structural index collects every value the rules compare.
+    - Forwarding: a splice like ResendRewriter's. Only SenderCompID (49),
+      TargetCompID (56), MsgSeqNum (34) and SendingTime (52) are
+      rewritten; OnBehalfOfCompID (115) can be stamped with the inbound
+      sender and DeliverToCompID (128) dropped. Unchanged runs go through
+      the fused copy+checksum kernel, BodyLength is computed up front and
+      the checksum is the running sum of the runs and the new fields.
+
+    Rules and destinations are set up before routing starts (they
+    allocate); route() and forward() do not allocate.
+
+    Usage:
+        MessageRouter router;
+        auto venue = router.add_destination({.sender_comp_id = "HUB",
+            .target_comp_id = "VENUE", .stamp_on_behalf_of = true,
+            .strip_deliver_to = true});
+        router.add_rule({{128, "VENUE"}}, venue);
+        auto fwd = router.route(inbound, sending_time);
+        if (fwd && fwd->routed()) send(fwd->destination, fwd->message);
+*/
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/parser/structural_index.hpp"
+#include "nexusfix/parser/simd_checksum.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Routing Configuration
+// ============================================================================
+
+/// One rule condition: tag equals value (empty value: tag present)
+struct FieldMatch {
+    int tag;
+    std::string_view value{};
+};
+
+/// Outbound session a routed message is forwarded on
+struct RouteDestination {
+    std::string sender_comp_id;         // Hub's CompID on that session (49)
+    std::string target_comp_id;         // Counterparty's CompID (56)
+    bool stamp_on_behalf_of{false};     // Add 115 = inbound 49 unless present
+    bool strip_deliver_to{false};       // Drop 128 (addressed to this hop)
+    uint32_t next_seq_num{1};           // MsgSeqNum for route()
+};
+
+/// Result of routing one message
+struct Forwarded {
+    uint16_t destination;
+    uint32_t seq_num{0};
+    std::span<const char> message{};    // Valid until the next forward
+
+    [[nodiscard]] bool routed() const noexcept { return !message.empty(); }
+};
+
+// ============================================================================
+// Message Router
+// ============================================================================
+
+/// Rule-matched header splice between hub sessions
+class MessageRouter {
+public:
+    using DestinationId = uint16_t;
+
+    static constexpr DestinationId NO_ROUTE = UINT16_MAX;
+    static constexpr size_t MAX_MATCH_TAGS = 32;        // Distinct tags across all rules
+    static constexpr size_t MAX_GROWTH = 512;           // Rewritten header fields may grow
+    static constexpr size_t MAX_MESSAGE_SIZE = fix::MAX_MESSAGE_SIZE;
+    static constexpr size_t HEADER_SCAN_FIELDS = 16;    // Leading fields searched for header tags
+    static constexpr size_t TRAILER_SIZE = 7;           // "10=NNN" SOH
+
+    MessageRouter() noexcept { dense_slots_.fill(NO_SLOT); }
+
+    // ========================================================================
+    // Setup (not thread-safe, allocates)
+    // ========================================================================
+
+    /// Register an outbound session
+    [[nodiscard]] DestinationId add_destination(RouteDestination destination) {
+        destinations_.push_back(std::move(destination));
+        return static_cast<DestinationId>(destinations_.size() - 1);
+    }
+
+    /// Append a rule; all conditions must hold
+    /// @return false if the destination is unknown, a tag is not positive
+    ///         or the rules would name more than MAX_MATCH_TAGS tags
+    bool add_rule(std::span<const FieldMatch> match, DestinationId to) {
+        if (to >= destinations_.size()) return false;
+
+        const size_t tags_before = match_tags_.size();
+        const size_t first = conditions_.size();
+        for (const FieldMatch& m : match) {
+            const uint8_t slot = m.tag > 0 ? intern_tag(m.tag) : NO_SLOT;
+            if (slot == NO_SLOT) {
+                conditions_.resize(first);
+                forget_tags(tags_before);
+                return false;
+            }
+            conditions_.push_back(Condition{slot, std::string{m.value}});
+        }
+        rules_.push_back(Rule{static_cast<uint32_t>(first),
+                              static_cast<uint32_t>(conditions_.size() - first), to});
+        return true;
+    }
+
+    bool add_rule(std::initializer_list<FieldMatch> match, DestinationId to) {
+        return add_rule(std::span<const FieldMatch>{match.begin(), match.size()}, to);
+    }
+
+    /// Destination for messages no rule matches (NO_ROUTE: leave unrouted)
+    void set_default(DestinationId to) noexcept { default_ = to; }
+
+    [[nodiscard]] size_t destination_count() const noexcept { return destinations_.size(); }
+    [[nodiscard]] size_t rule_count() const noexcept { return rules_.size(); }
+
+    [[nodiscard]] const RouteDestination& destination(DestinationId id) const noexcept {
+        return destinations_[id];
+    }
+
+    void set_next_seq_num(DestinationId id, uint32_t seq) noexcept {
+        destinations_[id].next_seq_num = seq;
+    }
+
+    // ========================================================================
+    // Routing
+    // ========================================================================
+
+    /// First rule matching the message, else the default destination
+    [[nodiscard]] NFX_HOT DestinationId match(std::span<const char> msg,
+                                              const simd::FIXStructuralIndex& idx) const noexcept {
+        std::array<std::string_view, MAX_MATCH_TAGS> values;
+        uint32_t present = 0;
+        const uint32_t wanted = match_tags_.size() == 32
+            ? UINT32_MAX : (uint32_t{1} << match_tags_.size()) - 1;
+
+        for (size_t i = 0; i < idx.field_count() && present != wanted; ++i) {
+            const uint8_t slot = slot_of(idx.tag_at(msg, i));
+            if (slot != NO_SLOT && !(present & (uint32_t{1} << slot))) {
+                values[slot] = idx.value_at(msg, i);
+                present |= uint32_t{1} << slot;
+            }
+        }
+
+        for (const Rule& rule : rules_) {
+            bool hit = true;
+            for (uint32_t c = rule.first; c < rule.first + rule.count && hit; ++c) {
+                const Condition& cond = conditions_[c];
+                hit = (present & (uint32_t{1} << cond.slot)) &&
+                      (cond.value.empty() || values[cond.slot] == cond.value);
+            }
+            if (hit) return rule.to;
+        }
+        return default_;
+    }
+
+    /// Match and forward with the destination's next MsgSeqNum
+    /// @return Forwarded with an empty message if nothing matched
+    [[nodiscard]] NFX_HOT ParseResult<Forwarded> route(std::span<const char> msg,
+                                                      std::string_view sending_time) noexcept {
+        if (msg.size() < fix::MIN_MESSAGE_SIZE || msg.size() > MAX_MESSAGE_SIZE) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::BufferTooShort}};
+        }
+        const simd::FIXStructuralIndex idx = simd::build_index(msg);
+        if (!idx.valid()) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::GarbledMessage}};
+        }
+
+        const DestinationId to = match(msg, idx);
+        if (to == NO_ROUTE) return Forwarded{NO_ROUTE};
+
+        const uint32_t seq = destinations_[to].next_seq_num;
+        auto out = forward(msg, idx, to, seq, sending_time);
+        if (!out) [[unlikely]] return std::unexpected{out.error()};
+        ++destinations_[to].next_seq_num;
+        return Forwarded{to, seq, *out};
+    }
+
+    /// Rewrite the header of msg for a destination with an explicit seq num
+    /// @return View into the internal buffer, valid until the next forward
+    [[nodiscard]] NFX_HOT ParseResult<std::span<const char>> forward(
+        std::span<const char> msg, const simd::FIXStructuralIndex& idx,
+        DestinationId to, uint32_t seq_num, std::string_view sending_time) noexcept
+    {
+        const RouteDestination& dest = destinations_[to];
+        const size_t fields = idx.field_count();
+        if (fields < 4 || idx.tag_at(msg, 1) != tag::BodyLength::value) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField,
+                tag::BodyLength::value}};
+        }
+        const auto trailer = idx.field_bounds(fields - 1);
+        if (idx.tag_at(msg, fields - 1) != tag::CheckSum::value ||
+            trailer[3] + 1u != msg.size()) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::InvalidChecksum,
+                tag::CheckSum::value}};
+        }
+
+        // Header fields to rewrite, in message order
+        char seq_digits[10];
+        const auto seq_len = static_cast<size_t>(
+            std::to_chars(seq_digits, seq_digits + sizeof(seq_digits), seq_num).ptr - seq_digits);
+
+        std::array<Edit, 8> edits;
+        size_t edit_count = 0;
+        size_t f49 = 0, f56 = 0, f34 = 0, f52 = 0;
+        bool has_on_behalf = false;
+        const size_t scan = std::min(fields - 1, HEADER_SCAN_FIELDS);
+        for (size_t i = 2; i < scan; ++i) {
+            switch (idx.tag_at(msg, i)) {
+                case tag::SenderCompID::value:
+                    f49 = i;
+                    edits[edit_count++] = Edit{i, "49=", dest.sender_comp_id};
+                    break;
+                case tag::TargetCompID::value:
+                    f56 = i;
+                    edits[edit_count++] = Edit{i, "56=", dest.target_comp_id};
+                    break;
+                case tag::MsgSeqNum::value:
+                    f34 = i;
+                    edits[edit_count++] = Edit{i, "34=", {seq_digits, seq_len}};
+                    break;
+                case tag::SendingTime::value:
+                    f52 = i;
+                    edits[edit_count++] = Edit{i, "52=", sending_time};
+                    break;
+                case tag::OnBehalfOfCompID::value:
+                    has_on_behalf = true;
+                    break;
+                case tag::DeliverToCompID::value:
+                    if (dest.strip_deliver_to) edits[edit_count++] = Edit{i, {}, {}};
+                    break;
+                default:
+                    break;
+            }
+            if (edit_count == edits.size()) break;
+        }
+        if (!f49 || !f56 || !f34 || !f52) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField,
+                !f49 ? tag::SenderCompID::value : !f56 ? tag::TargetCompID::value
+                     : !f34 ? tag::MsgSeqNum::value : tag::SendingTime::value}};
+        }
+        const std::string_view on_behalf_of =
+            dest.stamp_on_behalf_of && !has_on_behalf ? idx.value_at(msg, f49) : std::string_view{};
+
+        // New BodyLength is known before anything is written
+        const auto bl = idx.field_bounds(1);
+        const size_t body_start = static_cast<size_t>(bl[3]) + 1;
+        const size_t body_end = trailer[0];
+        size_t body_len = body_end - body_start;
+        for (size_t e = 0; e < edit_count; ++e) {
+            const auto f = idx.field_bounds(edits[e].field);
+            body_len -= static_cast<size_t>(f[3] - f[0]) + 1;
+            if (!edits[e].key.empty()) body_len += edits[e].key.size() + edits[e].value.size() + 1;
+        }
+        if (!on_behalf_of.empty()) body_len += 4 + on_behalf_of.size() + 1;   // "115=" value SOH
+
+        if (body_start + 10 + body_len + TRAILER_SIZE > buffer_.size()) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::BufferTooShort}};
+        }
+
+        char* out = buffer_.data();
+        uint32_t sum = 0;
+
+        // "8=...|9=" then the new BodyLength
+        sum += parser::copy_checksum(out, msg.data(), bl[2]);
+        size_t pos = bl[2];
+        const size_t bl_out = pos;
+        pos = static_cast<size_t>(std::to_chars(out + pos, out + pos + 10, body_len).ptr - out);
+        out[pos++] = fix::SOH;
+        sum += parser::checksum(out + bl_out, pos - bl_out);
+
+        // Unchanged runs between edits, each edit written fresh
+        size_t run = body_start;
+        for (size_t e = 0; e < edit_count; ++e) {
+            const auto f = idx.field_bounds(edits[e].field);
+            sum += parser::copy_checksum(out + pos, msg.data() + run, f[0] - run);
+            pos += f[0] - run;
+            run = static_cast<size_t>(f[3]) + 1;
+
+            const size_t field_out = pos;
+            if (!edits[e].key.empty()) {
+                pos += append(out + pos, edits[e].key);
+                pos += append(out + pos, edits[e].value);
+                out[pos++] = fix::SOH;
+            }
+            if (edits[e].field == f56 && !on_behalf_of.empty()) {
+                pos += append(out + pos, "115=");
+                pos += append(out + pos, on_behalf_of);
+                out[pos++] = fix::SOH;
+            }
+            sum += parser::checksum(out + field_out, pos - field_out);
+        }
+        sum += parser::copy_checksum(out + pos, msg.data() + run, body_end - run);
+        pos += body_end - run;
+
+        out[pos++] = '1';
+        out[pos++] = '0';
+        out[pos++] = '=';
+        parser::format_checksum(static_cast<uint8_t>(sum & 0xFF), out + pos);
+        pos += 3;
+        out[pos++] = fix::SOH;
+
+        return std::span<const char>{out, pos};
+    }
+
+private:
+    static constexpr uint8_t NO_SLOT = 0xFF;
+    static constexpr size_t DENSE_TAGS = simd::TagLookupTable::MAX_DENSE_TAG;
+
+    struct Condition {
+        uint8_t slot;                   // Index into the per-message value table
+        std::string value;              // Empty: tag present
+    };
+
+    struct Rule {
+        uint32_t first;                 // First condition
+        uint32_t count;
+        DestinationId to;
+    };
+
+    /// A header field to replace (empty key: remove)
+    struct Edit {
+        size_t field{0};
+        std::string_view key{};
+        std::string_view value{};
+    };
+
+    /// Slot for tag, allocating one on first use (NO_SLOT when full)
+    uint8_t intern_tag(int tag) {
+        const uint8_t existing = slot_of(tag);
+        if (existing != NO_SLOT) return existing;
+        if (match_tags_.size() == MAX_MATCH_TAGS) return NO_SLOT;
+
+        const auto slot = static_cast<uint8_t>(match_tags_.size());
+        match_tags_.push_back(tag);
+        if (static_cast<size_t>(tag) < DENSE_TAGS) dense_slots_[static_cast<size_t>(tag)] = slot;
+        return slot;
+    }
+
+    /// Undo intern_tag() calls of a rejected rule
+    void forget_tags(size_t keep) noexcept {
+        for (size_t i = keep; i < match_tags_.size(); ++i) {
+            if (static_cast<size_t>(match_tags_[i]) < DENSE_TAGS) {
+                dense_slots_[static_cast<size_t>(match_tags_[i])] = NO_SLOT;
+            }
+        }
+        match_tags_.resize(keep);
+    }
+
+    [[nodiscard]] uint8_t slot_of(int tag) const noexcept {
+        if (tag > 0 && static_cast<size_t>(tag) < DENSE_TAGS) [[likely]] {
+            return dense_slots_[static_cast<size_t>(tag)];
+        }
+        for (size_t i = 0; i < match_tags_.size(); ++i) {
+            if (match_tags_[i] == tag) return static_cast<uint8_t>(i);
+        }
+        return NO_SLOT;
+    }
+
+    static size_t append(char* out, std::string_view sv) noexcept {
+        std::memcpy(out, sv.data(), sv.size());
+        return sv.size();
+    }
+
+    std::vector<RouteDestination> destinations_;
+    std::vector<Rule> rules_;
+    std::vector<Condition> conditions_;
+    std::vector<int> match_tags_;                       // Slot -> tag
+    std::array<uint8_t, DENSE_TAGS> dense_slots_;       // Tag -> slot (small tags)
+    DestinationId default_{NO_ROUTE};
+
+    std::array<char, MAX_MESSAGE_SIZE + MAX_GROWTH> buffer_;
+};
+
+} // namespace nfx
@@ -0,0 +1,272 @@
+/*
+    NexusFIX Compile-time MsgType Dispatch
+
+    Routes application messages straight to typed handler members through a
+    constexpr jump table, instead of one on_app_message() with a switch.
+
+    Usage:
+        struct MyStrategy {
+            void on_execution_report(const IndexedParser& msg) noexcept { ... }
+            void on_md_incremental(const IndexedParser& msg,
+                                   const RxTimestamp& rx) noexcept { ... }
+            void on_mass_quote(const IndexedParser& msg, const RxTimestamp& rx,
+                               std::pmr::memory_resource& scratch) noexcept { ... }
+            void on_trade_capture_report(const IndexedParser& msg) noexcept { ... }
+
+            void on_app_message(const IndexedParser& msg) noexcept { ... }  // Unrouted
+            // ... remaining SessionHandler members
+
+            // After the routed members, so their addresses can be taken
+            using msg_routes = MsgRoutes<
+                MsgRoute<msg_type::ExecutionReport, &MyStrategy::on_execution_report>,
+                MsgRoute<msg_type::MarketDataIncrementalRefresh, &MyStrategy::on_md_incremental>,
+                MsgRoute<msg_type::MassQuote, &MyStrategy::on_mass_quote>,
+                MsgRoute<"AE", &MyStrategy::on_trade_capture_report>>;
+        };
+
+        BasicSessionManager<MyStrategy> session{config, MyStrategy{...}};
+
+    Single-character MsgTypes index a 256-entry table of function pointers;
+    two-character types ("AE", "BE", ...) go through a secondary 256-entry
+    row selected by their first character. Both are built at compile time
+    from the route list, which is checked for duplicates and admin types.
+
+    A route taking the scratch resource gets the session's per-message
+    monotonic buffer (BasicSessionManager::message_scratch()), reset once
+    the route returns.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
+
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/transport/rx_timestamp.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Route Declaration
+// ============================================================================
+
+/// MsgType as a template argument: a char ('8') or a one/two-character
+/// string literal ("AE")
+struct MsgTypeCode {
+    char first{};
+    char second{};  // '\0' for single-character types
+
+    consteval MsgTypeCode(char c) noexcept : first{c} {}
+
+    template <size_t N>
+        requires (N == 2 || N == 3)
+    consteval MsgTypeCode(const char (&s)[N]) noexcept
+        : first{s[0]}, second{N == 3 ? s[1] : '\0'} {}
+
+    [[nodiscard]] constexpr bool is_single() const noexcept { return second == '\0'; }
+
+    constexpr bool operator==(const MsgTypeCode&) const noexcept = default;
+};
+
+/// One route: messages of `Type` go to `Method`, a member taking
+/// (const IndexedParser&), (const IndexedParser&, const RxTimestamp&) or
+/// (const IndexedParser&, const RxTimestamp&, std::pmr::memory_resource&)
+template <MsgTypeCode Type, auto Method>
+struct MsgRoute {
+    static constexpr MsgTypeCode type = Type;
+    static constexpr auto method = Method;
+};
+
+/// Route list, exposed by a handler as `using msg_routes = MsgRoutes<...>`
+template <typename... Routes>
+struct MsgRoutes {};
+
+/// Handler declaring a typed route list
+template <typename T>
+concept HasMsgRoutes = requires { typename T::msg_routes; };
+
+// ============================================================================
+// Table Construction
+// ============================================================================
+
+namespace detail {
+
+inline constexpr size_t MSG_DISPATCH_TABLE_SIZE = 256;
+
+[[nodiscard]] constexpr size_t msg_index(char c) noexcept {
+    return static_cast<unsigned char>(c);
+}
+
+template <typename Handler, auto Method>
+inline constexpr bool route_takes_scratch =
+    std::is_invocable_v<decltype(Method), Handler&, const IndexedParser&,
+                        const RxTimestamp&, std::pmr::memory_resource&>;
+
+/// @param scratch Per-message resource; nullptr falls back to the default
+template <typename Handler, auto Method>
+void invoke_route(Handler& handler, const IndexedParser& msg,
+                  const RxTimestamp& rx_ts, std::pmr::memory_resource* scratch) noexcept {
+    if constexpr (route_takes_scratch<Handler, Method>) {
+        std::invoke(Method, handler, msg, rx_ts,
+                    scratch ? *scratch : *std::pmr::get_default_resource());
+    } else if constexpr (std::is_invocable_v<decltype(Method), Handler&,
+                                             const IndexedParser&, const RxTimestamp&>) {
+        std::invoke(Method, handler, msg, rx_ts);
+    } else {
+        std::invoke(Method, handler, msg);
+    }
+}
+
+template <typename Handler, auto Method>
+inline constexpr bool is_route_method =
+    std::is_nothrow_invocable_v<decltype(Method), Handler&, const IndexedParser&,
+                                const RxTimestamp&, std::pmr::memory_resource&> ||
+    std::is_nothrow_invocable_v<decltype(Method), Handler&,
+                                const IndexedParser&, const RxTimestamp&> ||
+    std::is_nothrow_invocable_v<decltype(Method), Handler&, const IndexedParser&>;
+
+template <size_t N>
+consteval bool routes_unique(const std::array<MsgTypeCode, N>& types) {
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = i + 1; j < N; ++j) {
+            if (types[i] == types[j]) return false;
+        }
+    }
+    return true;
+}
+
+template <size_t N>
+consteval bool routes_app_only(const std::array<MsgTypeCode, N>& types) {
+    for (const MsgTypeCode& type : types) {
+        if (type.is_single() && msg_type::is_admin(type.first)) return false;
+    }
+    return true;
+}
+
+/// 1-based secondary row per first character; 0 = no two-character routes
+template <size_t N>
+consteval std::array<uint8_t, MSG_DISPATCH_TABLE_SIZE> secondary_rows(
+    const std::array<MsgTypeCode, N>& types) {
+    std::array<uint8_t, MSG_DISPATCH_TABLE_SIZE> rows{};
+    uint8_t next = 0;
+    for (const MsgTypeCode& type : types) {
+        if (!type.is_single() && rows[msg_index(type.first)] == 0) {
+            rows[msg_index(type.first)] = ++next;
+        }
+    }
+    return rows;
+}
+
+template <size_t N>
+consteval size_t secondary_row_count(const std::array<MsgTypeCode, N>& types) {
+    size_t count = 0;
+    for (uint8_t row : secondary_rows(types)) {
+        if (row > count) count = row;
+    }
+    return count;
+}
+
+template <typename Fn, size_t N>
+consteval std::array<Fn, MSG_DISPATCH_TABLE_SIZE> build_primary(
+    const std::array<MsgTypeCode, N>& types, const std::array<Fn, N>& fns) {
+    std::array<Fn, MSG_DISPATCH_TABLE_SIZE> table{};
+    for (size_t i = 0; i < N; ++i) {
+        if (types[i].is_single()) table[msg_index(types[i].first)] = fns[i];
+    }
+    return table;
+}
+
+template <size_t Rows, typename Fn, size_t N>
+consteval std::array<std::array<Fn, MSG_DISPATCH_TABLE_SIZE>, Rows> build_secondary(
+    const std::array<MsgTypeCode, N>& types, const std::array<Fn, N>& fns) {
+    std::array<std::array<Fn, MSG_DISPATCH_TABLE_SIZE>, Rows> table{};
+    const auto rows = secondary_rows(types);
+    for (size_t i = 0; i < N; ++i) {
+        if (!types[i].is_single()) {
+            table[rows[msg_index(types[i].first)] - 1][msg_index(types[i].second)] = fns[i];
+        }
+    }
+    return table;
+}
+
+} // namespace detail
+
+// ============================================================================
+// Dispatch Table
+// ============================================================================
+
+template <typename Handler, typename Routes>
+class MsgDispatchTable;
+
+template <typename Handler, typename... Routes>
+class MsgDispatchTable<Handler, MsgRoutes<Routes...>> {
+public:
+    using Fn = void (*)(Handler&, const IndexedParser&, const RxTimestamp&,
+                        std::pmr::memory_resource*) noexcept;
+
+    static constexpr size_t TABLE_SIZE = detail::MSG_DISPATCH_TABLE_SIZE;
+
+    /// Some route takes the per-message scratch resource
+    static constexpr bool WANTS_SCRATCH =
+        (detail::route_takes_scratch<Handler, Routes::method> || ...);
+
+    static_assert((detail::is_route_method<Handler, Routes::method> && ...),
+                  "MsgRoute method must be a noexcept member taking "
+                  "(const IndexedParser&[, const RxTimestamp&[, std::pmr::memory_resource&]])");
+
+    /// Invoke the route for msg's MsgType; false if none is registered
+    /// @param scratch Handed to routes taking it (nullptr = default resource)
+    [[nodiscard]] static bool dispatch(Handler& handler, const IndexedParser& msg,
+                                       const RxTimestamp& rx_ts,
+                                       std::pmr::memory_resource* scratch = nullptr) noexcept {
+        const Fn fn = find(msg.msg_type_str());
+        if (fn == nullptr) return false;
+        fn(handler, msg, rx_ts, scratch);
+        return true;
+    }
+
+    /// Route registered for `type`, nullptr if none
+    [[nodiscard]] static constexpr Fn find(std::string_view type) noexcept {
+        using detail::msg_index;
+        if (type.size() == 1) [[likely]] {
+            return PRIMARY[msg_index(type[0])];
+        }
+        if (type.size() == 2) {
+            if (const uint8_t row = SECONDARY_ROW[msg_index(type[0])]; row != 0) {
+                return SECONDARY[row - 1][msg_index(type[1])];
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    static constexpr std::array<MsgTypeCode, sizeof...(Routes)> TYPES{Routes::type...};
+    static constexpr std::array<Fn, sizeof...(Routes)> FNS{
+        &detail::invoke_route<Handler, Routes::method>...};
+
+    static_assert(detail::routes_unique(TYPES), "MsgType routed twice");
+    static_assert(detail::routes_app_only(TYPES),
+                  "Admin MsgTypes are handled by the session and never reach app routes");
+
+    // At least one row so the array is never zero-sized
+    static constexpr size_t SECONDARY_ROWS =
+        detail::secondary_row_count(TYPES) > 0 ? detail::secondary_row_count(TYPES) : 1;
+
+    static constexpr std::array<Fn, TABLE_SIZE> PRIMARY = detail::build_primary(TYPES, FNS);
+    static constexpr std::array<uint8_t, TABLE_SIZE> SECONDARY_ROW =
+        detail::secondary_rows(TYPES);
+    static constexpr std::array<std::array<Fn, TABLE_SIZE>, SECONDARY_ROWS> SECONDARY =
+        detail::build_secondary<SECONDARY_ROWS>(TYPES, FNS);
+};
+
+/// Dispatch table for a handler's own msg_routes
+template <HasMsgRoutes Handler>
+using HandlerDispatchTable = MsgDispatchTable<Handler, typename Handler::msg_routes>;
+
+} // namespace nfx
@@ -0,0 +1,340 @@
+/*
+    NexusFIX Order State Tracker
+
+    Library-side order table updated straight from ExecutionReports, so
+    strategies stop re-deriving state from OrdStatus, ExecType, CumQty and
+    LeavesQty. Orders live in a fixed-capacity slab of one-cache-line
+    entries indexed by the decoded ClOrdID (our <prefix><base-62 sequence>
+    ids, see cl_ord_id.hpp): a report costs a prefix compare, a Width-digit
+    decode, O(1) IndexedParser field reads and one or two entry lines. No
+    string is copied and no hash map is probed.
+
+    State machine:
+    - OrdStatus (39) is authoritative; a report whose status the order may
+      not move to (can_transition() in field_types.hpp), or whose CumQty
+      went backwards, is reported Stale and ignored
+    - Trade corrections/cancels and restatements (is_trade_correction())
+      apply unconditionally
+    - Cancel and replace requests get their own ClOrdID entry pointing at
+      the order; reports on the request id update the order, and
+      ExecType Replaced moves the order onto the new id
+    - Terminal orders (is_terminal_status()) leave the table; the update
+      carries the final state
+
+    Usage:
+        OrderTracker<4096> orders{"NX1"};
+
+        auto id = orders.open(Side::Buy, Qty::from_int(100), strategy_slot);
+        builder.cl_ord_id(id->view());
+
+        // on_app_message
+        if (msg.msg_type() == msg_type::ExecutionReport) {
+            auto update = orders.on_execution_report(msg);
+            if (update.applied() && is_fill_exec(update.exec_type)) pnl.fill(update);
+        }
+
+    Single-threaded: run on the session thread that sends and receives.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "nexusfix/memory/cache_line.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/session/cl_ord_id.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/tag.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Tracked Order
+// ============================================================================
+
+/// What a ClOrdID entry stands for
+enum class OrderIdKind : uint8_t {
+    Order,     // The order itself (NewOrderSingle, or promoted by a replace)
+    Cancel,    // OrderCancelRequest against `origin`
+    Replace    // OrderCancelReplaceRequest against `origin`
+};
+
+/// One ClOrdID's state, one cache line
+struct alignas(CACHE_LINE_SIZE) TrackedOrder {
+    uint64_t sequence{0};        // ClOrdID sequence (confirms the slab slot)
+    uint64_t origin{0};          // Order this id acts on (itself for Order)
+    Qty order_qty;
+    Qty cum_qty;
+    Qty leaves_qty;
+    FixedPrice avg_px;
+    FixedPrice last_px;
+    uint32_t user{0};            // Caller's tag (strategy, pool index, ...)
+    OrdStatus status{OrdStatus::PendingNew};
+    Side side{Side::Buy};
+    OrderIdKind kind{OrderIdKind::Order};
+    bool live{false};
+};
+
+static_assert(sizeof(TrackedOrder) == CACHE_LINE_SIZE, "TrackedOrder is one cache line");
+
+/// Outcome of feeding a report to the tracker
+enum class OrderUpdateResult : uint8_t {
+    Applied,     // State updated
+    Unknown,     // Foreign, malformed or already retired ClOrdID
+    Stale,       // Disallowed transition or CumQty went backwards: ignored
+    Malformed    // OrdStatus (39) / ExecType (150) missing or invalid
+};
+
+/// State change caused by one report
+struct OrderUpdate {
+    OrderUpdateResult result{OrderUpdateResult::Unknown};
+    OrdStatus previous{OrdStatus::PendingNew};
+    ExecType exec_type{ExecType::OrderStatus};
+    Qty last_qty;
+    TrackedOrder order;          // State after the report (copy: a terminal
+                                 // order's entry is free for reuse)
+
+    [[nodiscard]] bool applied() const noexcept { return result == OrderUpdateResult::Applied; }
+    [[nodiscard]] bool terminal() const noexcept {
+        return applied() && is_terminal_status(order.status);
+    }
+};
+
+// ============================================================================
+// Order Tracker
+// ============================================================================
+
+/// Fixed-capacity order table keyed by our ClOrdIDs
+/// @tparam Capacity Live ClOrdIDs (orders plus pending cancel/replace
+///         requests), power of 2
+/// @tparam Width Base-62 digits of the ClOrdID sequence
+template <size_t Capacity = 4096, size_t Width = 10>
+class OrderTracker {
+public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of 2");
+
+    using Generator = ClOrdIdGenerator<Width>;
+
+    explicit OrderTracker(std::string_view prefix,
+                          uint64_t start = Generator::seed_from_clock()) noexcept
+        : generator_{prefix, start} {}
+
+    OrderTracker(const OrderTracker&) = delete;
+    OrderTracker& operator=(const OrderTracker&) = delete;
+
+    // ========================================================================
+    // Outbound (before sending the request)
+    // ========================================================================
+
+    /// Track a new order; status PendingNew until the venue reports
+    /// @return ClOrdID for the NewOrderSingle, nullopt if the table is full
+    [[nodiscard]] NFX_HOT std::optional<ClOrdId> open(Side side, Qty order_qty,
+                                                       uint32_t user = 0) noexcept {
+        TrackedOrder* entry = allocate();
+        if (!entry) [[unlikely]] return std::nullopt;
+        entry->origin = entry->sequence;
+        entry->order_qty = order_qty;
+        entry->leaves_qty = order_qty;
+        entry->user = user;
+        entry->side = side;
+        return generator_.encode(entry->sequence);
+    }
+
+    /// ClOrdID for an OrderCancelRequest on a live order
+    [[nodiscard]] std::optional<ClOrdId> cancel(std::string_view orig_cl_ord_id) noexcept {
+        return request(orig_cl_ord_id, OrderIdKind::Cancel, Qty{});
+    }
+
+    /// ClOrdID for an OrderCancelReplaceRequest on a live order
+    [[nodiscard]] std::optional<ClOrdId> replace(std::string_view orig_cl_ord_id,
+                                                 Qty new_order_qty) noexcept {
+        return request(orig_cl_ord_id, OrderIdKind::Replace, new_order_qty);
+    }
+
+    // ========================================================================
+    // Inbound
+    // ========================================================================
+
+    /// Apply an ExecutionReport (35=8)
+    [[nodiscard]] NFX_HOT OrderUpdate on_execution_report(const IndexedParser& msg) noexcept {
+        OrderUpdate update;
+        const char status_char = msg.get_char(tag::OrdStatus::value);
+        const char exec_char = msg.get_char(tag::ExecType::value);
+        if (!is_valid_ord_status(status_char) || !is_valid_exec_type(exec_char)) [[unlikely]] {
+            update.result = OrderUpdateResult::Malformed;
+            return update;
+        }
+        const auto status = static_cast<OrdStatus>(status_char);
+        const auto exec = static_cast<ExecType>(exec_char);
+        update.exec_type = exec;
+
+        TrackedOrder* entry = lookup(msg.get_string(tag::ClOrdID::value));
+        if (!entry) [[unlikely]] entry = lookup(msg.get_string(tag::OrigClOrdID::value));
+        if (!entry) [[unlikely]] return update;
+
+        TrackedOrder* order = entry->kind == OrderIdKind::Order ? entry : origin_of(*entry);
+        if (!order) [[unlikely]] {
+            retire(*entry);   // Its order left the table already
+            return update;
+        }
+        update.previous = order->status;
+
+        const Qty cum = msg.get_qty(tag::CumQty::value);
+        if (!is_trade_correction(exec) &&
+            (!can_transition(order->status, status) || cum.raw < order->cum_qty.raw)) {
+            update.result = OrderUpdateResult::Stale;
+            update.order = *order;
+            return update;
+        }
+
+        // A confirmed replace moves the order onto the request's ClOrdID
+        if (exec == ExecType::Replaced && entry->kind == OrderIdKind::Replace) {
+            const Qty requested = entry->order_qty;
+            const uint64_t sequence = entry->sequence;
+            *entry = *order;
+            entry->sequence = sequence;
+            entry->origin = sequence;
+            entry->order_qty = requested;
+            retire(*order);
+            order = entry;
+        }
+
+        order->status = status;
+        order->cum_qty = cum;
+        order->leaves_qty = msg.get_qty(tag::LeavesQty::value);
+        if (msg.has_field(tag::OrderQty::value)) {
+            order->order_qty = msg.get_qty(tag::OrderQty::value);
+        }
+        if (msg.has_field(tag::AvgPx::value)) {
+            order->avg_px = msg.get_price(tag::AvgPx::value);
+        }
+        if (is_fill_exec(exec)) {
+            update.last_qty = msg.get_qty(tag::LastQty::value);
+            order->last_px = msg.get_price(tag::LastPx::value);
+        }
+
+        update.result = OrderUpdateResult::Applied;
+        update.order = *order;
+
+        // The request is answered once the venue reports its outcome
+        if (entry != order && (exec == ExecType::Canceled || exec == ExecType::Replaced ||
+                               exec == ExecType::Rejected)) {
+            retire(*entry);
+        }
+        if (is_terminal_status(status)) retire(*order);
+        return update;
+    }
+
+    /// Apply an OrderCancelReject (35=9): the request is answered and the
+    /// order keeps the OrdStatus the venue reports
+    NFX_HOT OrderUpdate on_cancel_reject(const IndexedParser& msg) noexcept {
+        OrderUpdate update;
+        TrackedOrder* entry = lookup(msg.get_string(tag::ClOrdID::value));
+        if (!entry || entry->kind == OrderIdKind::Order) [[unlikely]] return update;
+
+        TrackedOrder* order = origin_of(*entry);
+        retire(*entry);
+        if (!order) [[unlikely]] return update;
+
+        update.previous = order->status;
+        const char status_char = msg.get_char(tag::OrdStatus::value);
+        if (is_valid_ord_status(status_char) &&
+            can_transition(order->status, static_cast<OrdStatus>(status_char))) {
+            order->status = static_cast<OrdStatus>(status_char);
+        }
+        update.result = OrderUpdateResult::Applied;
+        update.order = *order;
+        if (is_terminal_status(order->status)) retire(*order);
+        return update;
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    /// Live entry of a ClOrdID, nullptr if unknown or retired
+    [[nodiscard]] const TrackedOrder* find(std::string_view cl_ord_id) const noexcept {
+        return const_cast<OrderTracker*>(this)->lookup(cl_ord_id);
+    }
+
+    /// Stop tracking a ClOrdID (e.g. a request the venue never answered)
+    bool erase(std::string_view cl_ord_id) noexcept {
+        TrackedOrder* entry = lookup(cl_ord_id);
+        if (!entry) return false;
+        retire(*entry);
+        return true;
+    }
+
+    /// Live ClOrdIDs (orders and pending requests)
+    [[nodiscard]] size_t size() const noexcept { return live_; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return Capacity; }
+    [[nodiscard]] const Generator& generator() const noexcept { return generator_; }
+
+private:
+    /// Fresh live entry for the next free sequence
+    [[nodiscard]] TrackedOrder* allocate() noexcept {
+        if (live_ == Capacity) [[unlikely]] return nullptr;
+        for (;;) {
+            const uint64_t sequence = generator_.next_sequence();
+            TrackedOrder& e = slab_[sequence & (Capacity - 1)];
+            if (e.live) [[unlikely]] continue;  // A long-lived order holds it
+            e = TrackedOrder{};
+            e.sequence = sequence;
+            e.live = true;
+            ++live_;
+            return &e;
+        }
+    }
+
+    [[nodiscard]] std::optional<ClOrdId> request(std::string_view orig_cl_ord_id,
+                                                 OrderIdKind kind, Qty order_qty) noexcept {
+        const TrackedOrder* target = lookup(orig_cl_ord_id);
+        if (!target || target->kind != OrderIdKind::Order) [[unlikely]] return std::nullopt;
+
+        // allocate() only takes free entries: target stays put
+        TrackedOrder* entry = allocate();
+        if (!entry) [[unlikely]] return std::nullopt;
+        entry->origin = target->sequence;
+        entry->kind = kind;
+        entry->order_qty = order_qty;
+        entry->side = target->side;
+        entry->user = target->user;
+        return generator_.encode(entry->sequence);
+    }
+
+    [[nodiscard]] NFX_HOT TrackedOrder* lookup(std::string_view cl_ord_id) noexcept {
+        if (cl_ord_id.empty()) return nullptr;
+        const auto sequence = generator_.decode(cl_ord_id);
+        if (!sequence) [[unlikely]] return nullptr;
+        return entry_of(*sequence);
+    }
+
+    [[nodiscard]] TrackedOrder* entry_of(uint64_t sequence) noexcept {
+        TrackedOrder& e = slab_[sequence & (Capacity - 1)];
+        if (!e.live || e.sequence != sequence) [[unlikely]] return nullptr;
+        return &e;
+    }
+
+    /// Order a cancel/replace request acts on, if still live
+    [[nodiscard]] TrackedOrder* origin_of(const TrackedOrder& request) noexcept {
+        TrackedOrder* order = entry_of(request.origin);
+        return order && order->kind == OrderIdKind::Order ? order : nullptr;
+    }
+
+    void retire(TrackedOrder& entry) noexcept {
+        entry.live = false;
+        --live_;
+    }
+
+    Generator generator_;
+    std::array<TrackedOrder, Capacity> slab_{};
+    size_t live_{0};
+};
+
+} // namespace nfx
@@ -0,0 +1,1088 @@
+/*
+    NexusFIX QuickFIX Adapter
+
+    QuickFIX-shaped Application / Message / FieldMap API on top of a
+    SessionManager, so a QuickFIX application compiles against NexusFIX
+    with its namespace alias changed and gets the NexusFIX session, parser
+    and transport underneath. Hot paths can then move to the native API
+    (on_app_message + IndexedParser, typed builders) one message at a time.
+
+    Inbound messages are not copied or decoded up front: a Message handed
+    to fromApp()/fromAdmin() is a view over the session's IndexedParser,
+    and a field is converted only when the application asks for it (O(1)
+    tag lookup, no per-field allocation until a std::string is returned).
+    Copying such a Message - to keep it past the callback - takes a copy
+    of the bytes once; set/removed fields live in a small overlay.
+
+    Usage:
+        namespace FIX = nfx::qf;   // was: #include "quickfix/..."
+
+        class Strategy : public FIX::Application {
+            void fromApp(const FIX::Message& msg, const FIX::SessionID& id) override {
+                FIX::ClOrdID clOrdID;
+                msg.getField(clOrdID);          // throws FieldNotFound
+                ...
+                FIX::Session::sendToTarget(reply, id);
+            }
+            ...
+        };
+
+        nfx::SessionManager session{config};
+        Strategy app;
+        FIX::Session adapter{session, app, {.on_send = transport_send}};
+
+    Differences from QuickFIX:
+    - The engine builds admin messages (Logon, Heartbeat, ResendRequest...)
+      itself, so toAdmin() is never called.
+    - RejectLogon thrown from fromAdmin() logs the session out right after
+      the logon completes (the Logon response, if acceptor, is already out).
+    - FieldNotFound / IncorrectTagValue / IncorrectDataFormat escaping
+      fromApp() send a Reject (35=3), UnsupportedMessageType a
+      BusinessMessageReject (35=j), as QuickFIX does. Other exceptions
+      terminate: session callbacks are noexcept.
+    - No data dictionary, MessageCracker or generated FIX44::* classes;
+      groups are read by count tag and delimiter (Group).
+    - Single-threaded: send from the session thread, as with the native API.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/parser/repeating_group.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/session/session_manager.hpp"
+
+namespace nfx::qf {
+
+// ============================================================================
+// Exceptions
+// ============================================================================
+
+/// Base of the QuickFIX exception family
+struct Exception : std::logic_error {
+    Exception(const std::string& type, const std::string& what)
+        : std::logic_error{what.empty() ? type : type + ": " + what}
+        , type{type}
+        , detail{what} {}
+
+    std::string type;
+    std::string detail;
+};
+
+/// Field absent from the FieldMap (or group index out of range)
+struct FieldNotFound : Exception {
+    explicit FieldNotFound(int field = 0, const std::string& what = "")
+        : Exception{"Field not found", what}, field{field} {}
+    int field;
+};
+
+/// Field present but its value is not valid for the application
+struct IncorrectTagValue : Exception {
+    explicit IncorrectTagValue(int field = 0, const std::string& what = "")
+        : Exception{"Incorrect tag value", what}, field{field} {}
+    int field;
+};
+
+/// Field value does not convert to the requested type
+struct IncorrectDataFormat : Exception {
+    explicit IncorrectDataFormat(int field = 0, const std::string& what = "")
+        : Exception{"Incorrect data format for value", what}, field{field} {}
+    int field;
+};
+
+/// Message type the application does not handle
+struct UnsupportedMessageType : Exception {
+    explicit UnsupportedMessageType(const std::string& what = "")
+        : Exception{"Unsupported message type", what} {}
+};
+
+/// Thrown from toApp() to drop an outbound message
+struct DoNotSend : Exception {
+    explicit DoNotSend(const std::string& what = "")
+        : Exception{"Do not send message", what} {}
+};
+
+/// Thrown from fromAdmin() on a Logon to refuse the session
+struct RejectLogon : Exception {
+    explicit RejectLogon(const std::string& what = "")
+        : Exception{"Rejected Logon Attempt", what} {}
+};
+
+/// Raw bytes passed to Message(std::string_view) did not parse
+struct InvalidMessage : Exception {
+    explicit InvalidMessage(const std::string& what = "")
+        : Exception{"Invalid message", what} {}
+};
+
+/// No Session registered for the SessionID given to sendToTarget()
+struct SessionNotFound : Exception {
+    explicit SessionNotFound(const std::string& what = "")
+        : Exception{"Session Not Found", what} {}
+};
+
+// ============================================================================
+// Typed Fields
+// ============================================================================
+
+namespace detail {
+
+/// Wire value -> T; false if it does not convert
+template <typename T>
+[[nodiscard]] bool parse_value(std::string_view text, T& out) noexcept {
+    if constexpr (std::is_same_v<T, std::string>) {
+        out.assign(text.data(), text.size());
+        return true;
+    } else if constexpr (std::is_same_v<T, char>) {
+        if (text.size() != 1) return false;
+        out = text[0];
+        return true;
+    } else if constexpr (std::is_same_v<T, bool>) {
+        if (text != "Y" && text != "N") return false;
+        out = text[0] == 'Y';
+        return true;
+    } else {
+        static_assert(std::is_arithmetic_v<T>, "Field value must be string, char, bool or arithmetic");
+        const char* end = text.data() + text.size();
+        auto [ptr, ec] = std::from_chars(text.data(), end, out);
+        return ec == std::errc{} && ptr == end && !text.empty();
+    }
+}
+
+/// T -> wire value; doubles in shortest round-trip fixed notation
+template <typename T>
+[[nodiscard]] std::string format_value(const T& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return value;
+    } else if constexpr (std::is_same_v<T, char>) {
+        return std::string(1, value);
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return value ? "Y" : "N";
+    } else {
+        char buf[64];
+        std::to_chars_result result;
+        if constexpr (std::is_floating_point_v<T>) {
+            result = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::fixed);
+        } else {
+            result = std::to_chars(buf, buf + sizeof(buf), value);
+        }
+        return std::string(buf, result.ptr);
+    }
+}
+
+} // namespace detail
+
+/// A tag with a typed value (QuickFIX's StringField, CharField, ...)
+template <int Tag, typename T>
+class Field {
+public:
+    using value_type = T;
+    static constexpr int TAG = Tag;
+
+    Field() = default;
+    Field(const T& value) : value_{value} {}  // NOLINT: implicit, as in QuickFIX
+
+    [[nodiscard]] const T& getValue() const noexcept { return value_; }
+    void setValue(const T& value) { value_ = value; }
+
+    [[nodiscard]] static constexpr int getTag() noexcept { return Tag; }
+    [[nodiscard]] static constexpr int getField() noexcept { return Tag; }
+
+    /// Value as it goes on the wire
+    [[nodiscard]] std::string getString() const { return detail::format_value(value_); }
+
+    /// Set from a wire value
+    /// @throws IncorrectDataFormat if it does not convert to T
+    void setString(std::string_view text) {
+        if (!detail::parse_value(text, value_)) {
+            throw IncorrectDataFormat{Tag, std::string{text}};
+        }
+    }
+
+    operator const T&() const noexcept { return value_; }
+
+    [[nodiscard]] bool operator==(const Field&) const = default;
+
+private:
+    T value_{};
+};
+
+/// A Field<Tag, T>
+template <typename F>
+concept TypedField = requires(F& field, const F& cfield, std::string_view text) {
+    { F::TAG } -> std::convertible_to<int>;
+    field.setString(text);
+    { cfield.getString() } -> std::convertible_to<std::string>;
+};
+
+template <int Tag> using StringField = Field<Tag, std::string>;
+template <int Tag> using CharField = Field<Tag, char>;
+template <int Tag> using IntField = Field<Tag, int>;
+template <int Tag> using DoubleField = Field<Tag, double>;
+template <int Tag> using BoolField = Field<Tag, bool>;
+
+// Header
+using BeginString = StringField<8>;
+using MsgType = StringField<35>;
+using SenderCompID = StringField<49>;
+using TargetCompID = StringField<56>;
+using MsgSeqNum = IntField<34>;
+using SendingTime = StringField<52>;
+using PossDupFlag = BoolField<43>;
+
+// Orders and executions
+using Account = StringField<1>;
+using AvgPx = DoubleField<6>;
+using ClOrdID = StringField<11>;
+using CumQty = DoubleField<14>;
+using ExecID = StringField<17>;
+using LastPx = DoubleField<31>;
+using LastQty = DoubleField<32>;
+using OrderID = StringField<37>;
+using OrderQty = DoubleField<38>;
+using OrdStatus = CharField<39>;
+using OrdType = CharField<40>;
+using OrigClOrdID = StringField<41>;
+using Price = DoubleField<44>;
+using Side = CharField<54>;
+using Symbol = StringField<55>;
+using Text = StringField<58>;
+using TimeInForce = CharField<59>;
+using TransactTime = StringField<60>;
+using StopPx = DoubleField<99>;
+using ExecType = CharField<150>;
+using LeavesQty = DoubleField<151>;
+
+// Rejects
+using RefSeqNum = IntField<45>;
+using RefTagID = IntField<371>;
+using RefMsgType = StringField<372>;
+using SessionRejectReason = IntField<373>;
+using BusinessRejectReason = IntField<380>;
+
+// Market data
+using MDReqID = StringField<262>;
+using NoMDEntries = IntField<268>;
+using MDEntryType = CharField<269>;
+using MDEntryPx = DoubleField<270>;
+using MDEntrySize = DoubleField<271>;
+
+constexpr char Side_BUY = '1';
+constexpr char Side_SELL = '2';
+constexpr char Side_SELL_SHORT = '5';
+constexpr char OrdType_MARKET = '1';
+constexpr char OrdType_LIMIT = '2';
+constexpr char TimeInForce_DAY = '0';
+constexpr char TimeInForce_IMMEDIATE_OR_CANCEL = '3';
+constexpr char ExecType_NEW = '0';
+constexpr char ExecType_CANCELED = '4';
+constexpr char ExecType_REJECTED = '8';
+constexpr char ExecType_TRADE = 'F';
+constexpr char OrdStatus_NEW = '0';
+constexpr char OrdStatus_PARTIALLY_FILLED = '1';
+constexpr char OrdStatus_FILLED = '2';
+constexpr char OrdStatus_CANCELED = '4';
+constexpr char OrdStatus_REJECTED = '8';
+
+constexpr int SessionRejectReason_REQUIRED_TAG_MISSING = 1;
+constexpr int SessionRejectReason_VALUE_IS_INCORRECT = 5;
+constexpr int SessionRejectReason_INCORRECT_DATA_FORMAT_FOR_VALUE = 6;
+constexpr int BusinessRejectReason_UNSUPPORTED_MESSAGE_TYPE = 3;
+
+// ============================================================================
+// FieldMap
+// ============================================================================
+
+class Group;
+
+/// Tags and values of one part of a message (header, body, trailer or a
+/// group entry).
+///
+/// Reads go to the overlay of set/removed fields first, then to the
+/// IndexedParser the map is a view of (if any), restricted to the map's
+/// section. Writes only touch the overlay; the parsed bytes are never
+/// modified.
+class FieldMap {
+public:
+    enum class Section : uint8_t { Header, Body, Trailer };
+
+    explicit FieldMap(Section section = Section::Body) noexcept : section_{section} {}
+
+    virtual ~FieldMap() = default;
+    FieldMap(const FieldMap&) = default;
+    FieldMap& operator=(const FieldMap&) = default;
+    FieldMap(FieldMap&&) noexcept = default;
+    FieldMap& operator=(FieldMap&&) noexcept = default;
+
+    /// Standard header tags (FIX 4.4 StandardHeader)
+    [[nodiscard]] static constexpr bool is_header_tag(int tag) noexcept {
+        switch (tag) {
+            case 8: case 9: case 35: case 34: case 43: case 49: case 50:
+            case 52: case 56: case 57: case 90: case 91: case 97: case 115:
+            case 116: case 122: case 128: case 129: case 142: case 143:
+            case 144: case 145: case 212: case 213: case 347: case 369:
+            case 627: case 628: case 629: case 630: case 1128: case 1129:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /// Standard trailer tags
+    [[nodiscard]] static constexpr bool is_trailer_tag(int tag) noexcept {
+        return tag == 10 || tag == 89 || tag == 93;
+    }
+
+    // ------------------------------------------------------------------------
+    // Reading
+    // ------------------------------------------------------------------------
+
+    /// Value of `tag` without copying; only valid while the message (and,
+    /// for a callback message, the callback) is
+    [[nodiscard]] std::optional<std::string_view> lookup(int tag) const noexcept {
+        if (const Entry* entry = find(tag)) {
+            if (entry->removed) return std::nullopt;
+            return std::string_view{entry->value};
+        }
+        if (view_ && in_section(tag)) {
+            const FieldView field = view_->get_field(tag);
+            if (field.is_valid()) return field.as_string();
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] bool isSetField(int tag) const noexcept { return lookup(tag).has_value(); }
+
+    template <TypedField F>
+    [[nodiscard]] bool isSetField(const F&) const noexcept { return isSetField(F::TAG); }
+
+    /// Zero-copy value (NexusFIX extension)
+    /// @throws FieldNotFound
+    [[nodiscard]] std::string_view getFieldView(int tag) const {
+        if (auto value = lookup(tag)) return *value;
+        throw FieldNotFound{tag};
+    }
+
+    /// @throws FieldNotFound
+    [[nodiscard]] std::string getField(int tag) const {
+        return std::string{getFieldView(tag)};
+    }
+
+    /// @throws FieldNotFound, IncorrectDataFormat
+    template <TypedField F>
+    F& getField(F& field) const {
+        field.setString(getFieldView(F::TAG));
+        return field;
+    }
+
+    /// false (field untouched) if absent
+    /// @throws IncorrectDataFormat
+    template <TypedField F>
+    bool getFieldIfSet(F& field) const {
+        auto value = lookup(F::TAG);
+        if (!value) return false;
+        field.setString(*value);
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // Writing
+    // ------------------------------------------------------------------------
+
+    void setField(int tag, std::string_view value) {
+        if (Entry* entry = find(tag)) {
+            entry->value.assign(value.data(), value.size());
+            entry->removed = false;
+            return;
+        }
+        fields_.push_back(Entry{tag, std::string{value}, false});
+    }
+
+    template <TypedField F>
+    void setField(const F& field) { setField(F::TAG, field.getString()); }
+
+    void removeField(int tag) {
+        if (Entry* entry = find(tag)) {
+            entry->value.clear();
+            entry->removed = true;
+        } else if (view_ && in_section(tag) && view_->has_field(tag)) {
+            fields_.push_back(Entry{tag, {}, true});
+        }
+    }
+
+    /// Drop every field and group, including those of the viewed message
+    void clear() noexcept {
+        fields_.clear();
+        groups_.clear();
+        view_ = nullptr;
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept {
+        bool empty = true;
+        visit([&](int, std::string_view) { empty = false; });
+        return empty;
+    }
+
+    // ------------------------------------------------------------------------
+    // Repeating groups
+    // ------------------------------------------------------------------------
+
+    /// Append an entry; the count field is written when the message is
+    void addGroup(const Group& group);
+
+    /// Entry `num` (1-based) of the group `group` describes, copied into it.
+    /// Entries added with addGroup() come first; otherwise, for a received
+    /// message, the entries on the wire.
+    /// @throws FieldNotFound(count tag) if there is no such entry
+    Group& getGroup(size_t num, Group& group) const;
+
+    /// Number of entries of the group counted by `count_tag`
+    [[nodiscard]] size_t groupCount(int count_tag) const noexcept;
+
+    [[nodiscard]] bool hasGroup(int count_tag) const noexcept { return groupCount(count_tag) > 0; }
+
+    /// Visit every field as it would be sent: the viewed fields in wire
+    /// order with overlay values substituted, then fields only in the
+    /// overlay, then added groups (count field followed by the entries)
+    template <typename Fn>
+    void visit(Fn&& fn) const {
+        visit_fields(FieldSink{&fn, [](void* ctx, int tag, std::string_view value) {
+            (*static_cast<std::remove_reference_t<Fn>*>(ctx))(tag, value);
+        }});
+    }
+
+    /// true if nothing was set, removed or added since construction
+    [[nodiscard]] bool unmodified() const noexcept { return fields_.empty() && groups_.empty(); }
+
+protected:
+    struct Entry {
+        int tag;
+        std::string value;
+        bool removed;   // Hides the viewed field
+    };
+
+    struct GroupList;
+
+    /// View `parser`'s fields of this map's section
+    void bind(const IndexedParser* parser) noexcept { view_ = parser; }
+    [[nodiscard]] const IndexedParser* view() const noexcept { return view_; }
+
+private:
+    /// Type-erased visitor, so nested groups do not instantiate visit()
+    /// once per level
+    struct FieldSink {
+        void* ctx;
+        void (*fn)(void*, int, std::string_view);
+        void operator()(int tag, std::string_view value) const { fn(ctx, tag, value); }
+    };
+
+    void visit_fields(const FieldSink& fn, int skip_tag = 0) const;
+
+    [[nodiscard]] bool in_section(int tag) const noexcept {
+        switch (section_) {
+            case Section::Header: return is_header_tag(tag);
+            case Section::Trailer: return is_trailer_tag(tag);
+            case Section::Body: return !is_header_tag(tag) && !is_trailer_tag(tag);
+        }
+        return false;
+    }
+
+    [[nodiscard]] Entry* find(int tag) noexcept {
+        for (auto& entry : fields_) {
+            if (entry.tag == tag) return &entry;
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] const Entry* find(int tag) const noexcept {
+        return const_cast<FieldMap*>(this)->find(tag);
+    }
+
+    [[nodiscard]] const GroupList* find_groups(int count_tag) const noexcept;
+
+    Section section_;
+    const IndexedParser* view_{nullptr};
+    std::vector<Entry> fields_;
+    std::vector<GroupList> groups_;
+};
+
+/// One repeating group entry. `field` is the NoXXX count tag, `delim` the
+/// first tag of each entry; `order` lists the entry's tags, used to end the
+/// last received entry (which otherwise runs to the end of the body)
+class Group : public FieldMap {
+public:
+    Group(int field, int delim, std::vector<int> order = {})
+        : FieldMap{Section::Body}, field_{field}, delim_{delim}, order_{std::move(order)} {}
+
+    [[nodiscard]] int field() const noexcept { return field_; }
+    [[nodiscard]] int delim() const noexcept { return delim_; }
+
+    [[nodiscard]] bool is_member(int tag) const noexcept {
+        return order_.empty() || tag == delim_ ||
+               std::find(order_.begin(), order_.end(), tag) != order_.end();
+    }
+
+private:
+    int field_;
+    int delim_;
+    std::vector<int> order_;
+};
+
+struct FieldMap::GroupList {
+    int count_tag;
+    std::vector<Group> entries;
+};
+
+inline const FieldMap::GroupList* FieldMap::find_groups(int count_tag) const noexcept {
+    for (const auto& list : groups_) {
+        if (list.count_tag == count_tag) return &list;
+    }
+    return nullptr;
+}
+
+inline void FieldMap::addGroup(const Group& group) {
+    for (auto& list : groups_) {
+        if (list.count_tag == group.field()) {
+            list.entries.push_back(group);
+            return;
+        }
+    }
+    groups_.push_back(GroupList{group.field(), {group}});
+}
+
+inline size_t FieldMap::groupCount(int count_tag) const noexcept {
+    if (const GroupList* list = find_groups(count_tag)) return list->entries.size();
+    if (auto value = lookup(count_tag)) {
+        size_t count = 0;
+        if (detail::parse_value(*value, count)) return count;
+    }
+    return 0;
+}
+
+inline Group& FieldMap::getGroup(size_t num, Group& group) const {
+    if (const GroupList* list = find_groups(group.field())) {
+        if (num == 0 || num > list->entries.size()) throw FieldNotFound{group.field()};
+        group = list->entries[num - 1];
+        return group;
+    }
+
+    // Received entries: walk the bytes after the count field
+    const size_t count = groupCount(group.field());
+    if (!view_ || num == 0 || num > count) throw FieldNotFound{group.field()};
+    const FieldView count_field = view_->get_field(group.field());
+    const std::span<const char> raw = view_->raw();
+    const char* after = count_field.value.data() + count_field.value.size();
+    const auto offset = static_cast<size_t>(after - raw.data());
+    parser::RepeatingGroupIterator entries{raw.subspan(offset), group.delim(), count};
+    for (size_t i = 1; i < num && entries.has_next(); ++i) (void)entries.next();
+    if (!entries.has_next()) throw FieldNotFound{group.field()};
+
+    const parser::RepeatingGroupIterator::Entry entry = entries.next();
+    Group copy{group};
+    copy.clear();
+    bool in_entry = true;
+    entry.for_each_field([&](const FieldView& field) {
+        if (!in_entry || !group.is_member(field.tag) || is_trailer_tag(field.tag)) {
+            in_entry = false;
+            return;
+        }
+        copy.setField(field.tag, field.as_string());
+    });
+    group = std::move(copy);
+    return group;
+}
+
+inline void FieldMap::visit_fields(const FieldSink& fn, int skip_tag) const {
+    if (view_) {
+        for (const FieldView& field : *view_) {
+            if (!in_section(field.tag) || field.tag == skip_tag) continue;
+            if (const Entry* entry = find(field.tag)) {
+                if (!entry->removed) fn(field.tag, std::string_view{entry->value});
+            } else {
+                fn(field.tag, field.as_string());
+            }
+        }
+    }
+    for (const auto& entry : fields_) {
+        if (entry.removed || entry.tag == skip_tag) continue;
+        if (view_ && in_section(entry.tag) && view_->has_field(entry.tag)) continue;
+        fn(entry.tag, std::string_view{entry.value});
+    }
+    for (const auto& list : groups_) {
+        const std::string count = detail::format_value(list.entries.size());
+        fn(list.count_tag, std::string_view{count});
+        for (const Group& group : list.entries) {
+            // Delimiter first: it is what starts an entry on the wire
+            if (auto delim = group.lookup(group.delim())) fn(group.delim(), *delim);
+            group.visit_fields(fn, group.delim());
+        }
+    }
+}
+
+// ============================================================================
+// Message
+// ============================================================================
+
+class Header : public FieldMap {
+public:
+    Header() noexcept : FieldMap{Section::Header} {}
+    using FieldMap::bind;
+};
+
+class Trailer : public FieldMap {
+public:
+    Trailer() noexcept : FieldMap{Section::Trailer} {}
+    using FieldMap::bind;
+};
+
+/// A FIX message: body fields on the Message itself, getHeader() and
+/// getTrailer() for the rest
+class Message : public FieldMap {
+public:
+    Message() noexcept : FieldMap{Section::Body} {}
+
+    /// View of a parsed message; valid only while `parser` holds it (for
+    /// the session's parser, the callback). Copy to keep it.
+    explicit Message(const IndexedParser& parser) noexcept : FieldMap{Section::Body} {
+        bind_all(&parser);
+    }
+
+    /// Parse `raw` (a complete message) into an owned copy
+    /// @throws InvalidMessage
+    explicit Message(std::string_view raw) : FieldMap{Section::Body} {
+        own(std::span<const char>{raw.data(), raw.size()});
+    }
+
+    /// Copying a view keeps the bytes (once); an owned message shares them
+    Message(const Message& other)
+        : FieldMap{other}, header_{other.header_}, trailer_{other.trailer_}
+        , backing_{other.backing_}
+    {
+        if (!backing_ && other.view()) own(other.view()->raw());
+    }
+
+    Message& operator=(const Message& other) {
+        if (this != &other) *this = Message{other};
+        return *this;
+    }
+
+    Message(Message&&) noexcept = default;
+    Message& operator=(Message&&) noexcept = default;
+
+    [[nodiscard]] Header& getHeader() noexcept { return header_; }
+    [[nodiscard]] const Header& getHeader() const noexcept { return header_; }
+    [[nodiscard]] Trailer& getTrailer() noexcept { return trailer_; }
+    [[nodiscard]] const Trailer& getTrailer() const noexcept { return trailer_; }
+
+    /// MsgType (35), empty if unset
+    [[nodiscard]] std::string_view msg_type() const noexcept {
+        return header_.lookup(tag::MsgType::value).value_or(std::string_view{});
+    }
+
+    [[nodiscard]] static bool isAdminMsgType(std::string_view type) noexcept {
+        return type.size() == 1 && std::string_view{"0A12345"}.find(type[0]) != std::string_view::npos;
+    }
+
+    [[nodiscard]] bool isAdmin() const noexcept { return isAdminMsgType(msg_type()); }
+    [[nodiscard]] bool isApp() const noexcept { return !msg_type().empty() && !isAdmin(); }
+
+    /// The parsed message behind this one (NexusFIX extension: the native
+    /// API for hot paths), or nullptr if built from scratch
+    [[nodiscard]] const IndexedParser* native() const noexcept { return view(); }
+
+    /// The message in wire format. An unmodified received message is
+    /// returned byte for byte; otherwise BodyLength and CheckSum are
+    /// recomputed (header fields first, as on the wire).
+    [[nodiscard]] std::string toString() const {
+        if (view() && unmodified() && header_.unmodified() && trailer_.unmodified()) {
+            const auto raw = view()->raw();
+            return std::string{raw.data(), raw.size()};
+        }
+
+        std::string body;
+        auto append = [&](int tag, std::string_view value) {
+            body += detail::format_value(tag);
+            body += '=';
+            body += value;
+            body += fix::SOH;
+        };
+        append(tag::MsgType::value, msg_type());
+        header_.visit([&](int tag, std::string_view value) {
+            if (tag != 8 && tag != 9 && tag != tag::MsgType::value) append(tag, value);
+        });
+        visit(append);
+        trailer_.visit([&](int tag, std::string_view value) {
+            if (tag != tag::CheckSum::value) append(tag, value);
+        });
+
+        std::string out;
+        const auto begin = header_.lookup(tag::BeginString::value).value_or(fix::FIX_4_4);
+        out += "8=";
+        out += begin;
+        out += fix::SOH;
+        out += "9=";
+        out += detail::format_value(body.size());
+        out += fix::SOH;
+        out += body;
+
+        unsigned sum = 0;
+        for (char c : out) sum += static_cast<uint8_t>(c);
+        const auto checksum = checksum::format(static_cast<uint8_t>(sum % 256));
+        out += "10=";
+        out.append(checksum.data(), checksum.size());
+        out += fix::SOH;
+        return out;
+    }
+
+private:
+    struct Backing {
+        std::string bytes;
+        IndexedParser parser;
+    };
+
+    void own(std::span<const char> raw) {
+        auto backing = std::make_shared<Backing>();
+        backing->bytes.assign(raw.data(), raw.size());
+        const auto parsed = backing->parser.assign<ChecksumPolicy::Deferred>(
+            std::span<const char>{backing->bytes.data(), backing->bytes.size()});
+        if (!parsed) throw InvalidMessage{std::string{parse_error_message(parsed.error().code)}};
+        backing_ = std::move(backing);
+        bind_all(&backing_->parser);
+    }
+
+    void bind_all(const IndexedParser* parser) noexcept {
+        bind(parser);
+        header_.bind(parser);
+        trailer_.bind(parser);
+    }
+
+    Header header_;
+    Trailer trailer_;
+    std::shared_ptr<const Backing> backing_;   // Set when the bytes are ours
+};
+
+// ============================================================================
+// SessionID / Application
+// ============================================================================
+
+class SessionID {
+public:
+    SessionID() = default;
+    SessionID(std::string_view begin_string, std::string_view sender_comp_id,
+              std::string_view target_comp_id)
+        : begin_string_{std::string{begin_string}}
+        , sender_comp_id_{std::string{sender_comp_id}}
+        , target_comp_id_{std::string{target_comp_id}} {}
+
+    [[nodiscard]] const BeginString& getBeginString() const noexcept { return begin_string_; }
+    [[nodiscard]] const SenderCompID& getSenderCompID() const noexcept { return sender_comp_id_; }
+    [[nodiscard]] const TargetCompID& getTargetCompID() const noexcept { return target_comp_id_; }
+
+    /// "FIX.4.4:SENDER->TARGET"
+    [[nodiscard]] std::string toString() const {
+        return begin_string_.getValue() + ":" + sender_comp_id_.getValue() + "->" +
+               target_comp_id_.getValue();
+    }
+
+    [[nodiscard]] bool operator==(const SessionID&) const = default;
+
+private:
+    BeginString begin_string_;
+    SenderCompID sender_comp_id_;
+    TargetCompID target_comp_id_;
+};
+
+/// QuickFIX application callbacks
+class Application {
+public:
+    virtual ~Application() = default;
+
+    virtual void onCreate(const SessionID&) = 0;
+    virtual void onLogon(const SessionID&) = 0;
+    virtual void onLogout(const SessionID&) = 0;
+
+    /// Never called: the engine builds admin messages itself
+    virtual void toAdmin(Message&, const SessionID&) = 0;
+
+    /// Before each sendToTarget(); throw DoNotSend to drop the message
+    virtual void toApp(Message&, const SessionID&) = 0;
+
+    /// Each received admin message (Logon, Heartbeat, ...), before the
+    /// engine acts on it; throw RejectLogon on a Logon to refuse it
+    virtual void fromAdmin(const Message&, const SessionID&) = 0;
+
+    /// Each received application message
+    virtual void fromApp(const Message&, const SessionID&) = 0;
+};
+
+// ============================================================================
+// Session
+// ============================================================================
+
+namespace detail {
+
+/// A Message as a send_app_message() builder: the session supplies
+/// CompIDs, MsgSeqNum and SendingTime, the rest comes from the Message
+class OutboundMessage {
+public:
+    OutboundMessage(const Message& msg, std::string_view begin_string) noexcept
+        : msg_{msg}, begin_string_{begin_string} {}
+
+    OutboundMessage& sender_comp_id(std::string_view v) noexcept { sender_ = v; return *this; }
+    OutboundMessage& target_comp_id(std::string_view v) noexcept { target_ = v; return *this; }
+    OutboundMessage& msg_seq_num(uint32_t v) noexcept { seq_num_ = v; return *this; }
+    OutboundMessage& sending_time(std::string_view v) noexcept { sending_time_ = v; return *this; }
+
+    [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+        asm_.start(begin_string_)
+            .field(tag::MsgType::value, msg_.msg_type())
+            .field(tag::SenderCompID::value, sender_)
+            .field(tag::TargetCompID::value, target_)
+            .field(tag::MsgSeqNum::value, static_cast<int64_t>(seq_num_))
+            .field(tag::SendingTime::value, sending_time_);
+        msg_.getHeader().visit([&](int tag, std::string_view value) {
+            if (!session_owned(tag)) asm_.field(tag, value);
+        });
+        msg_.visit([&](int tag, std::string_view value) { asm_.field(tag, value); });
+        return asm_.finish();
+    }
+
+private:
+    [[nodiscard]] static constexpr bool session_owned(int tag) noexcept {
+        return tag == 8 || tag == 9 || tag == 35 || tag == 34 || tag == 43 ||
+               tag == 49 || tag == 52 || tag == 56 || tag == 97 || tag == 122;
+    }
+
+    const Message& msg_;
+    std::string_view begin_string_;
+    std::string_view sender_;
+    std::string_view target_;
+    uint32_t seq_num_{0};
+    std::string_view sending_time_;
+};
+
+} // namespace detail
+
+/// Runs an Application on a SessionManager.
+///
+/// Installs the session's callbacks: on_app_message, on_logon, on_logout
+/// and on_audit drive the Application (the ones in `callbacks` are still
+/// called afterwards); on_send and the rest are passed through. Registered
+/// by SessionID for the static sendToTarget() while alive. The
+/// SessionManager must outlive it.
+class Session {
+public:
+    Session(SessionManager& session, Application& app, SessionCallbacks callbacks = {})
+        : session_{session}
+        , app_{app}
+        , id_{session.config().begin_string, session.config().sender_comp_id,
+              session.config().target_comp_id}
+    {
+        install(std::move(callbacks));
+        {
+            std::lock_guard lock{registry_mutex()};
+            registry().push_back(this);
+        }
+        app_.onCreate(id_);
+    }
+
+    ~Session() {
+        std::lock_guard lock{registry_mutex()};
+        auto& sessions = registry();
+        sessions.erase(std::remove(sessions.begin(), sessions.end(), this), sessions.end());
+    }
+
+    Session(const Session&) = delete;
+    Session& operator=(const Session&) = delete;
+
+    [[nodiscard]] const SessionID& getSessionID() const noexcept { return id_; }
+    [[nodiscard]] SessionManager& native() noexcept { return session_; }
+    [[nodiscard]] bool isLoggedOn() const noexcept {
+        return session_.state() == SessionState::Active;
+    }
+
+    /// toApp(), then send through the session
+    /// @return false if toApp() threw DoNotSend or the session refused it
+    /// @throws FieldNotFound if the header has no MsgType
+    bool send(Message& msg) {
+        if (msg.msg_type().empty()) throw FieldNotFound{tag::MsgType::value};
+        try {
+            app_.toApp(msg, id_);
+        } catch (const DoNotSend&) {
+            return false;
+        }
+        detail::OutboundMessage out{msg, id_.getBeginString().getValue()};
+        return session_.send_app_message(out).has_value();
+    }
+
+    /// Send on the session registered under `id`
+    /// @throws SessionNotFound
+    static bool sendToTarget(Message& msg, const SessionID& id) {
+        Session* session = lookupSession(id);
+        if (!session) throw SessionNotFound{id.toString()};
+        return session->send(msg);
+    }
+
+    /// Send on the session the header's SenderCompID/TargetCompID name
+    /// @throws SessionNotFound
+    static bool sendToTarget(Message& msg) {
+        const auto& header = msg.getHeader();
+        const std::string_view sender = header.lookup(tag::SenderCompID::value).value_or("");
+        const std::string_view target = header.lookup(tag::TargetCompID::value).value_or("");
+        Session* found = nullptr;
+        {
+            std::lock_guard lock{registry_mutex()};
+            for (Session* session : registry()) {
+                if (session->id_.getSenderCompID().getValue() == sender &&
+                    session->id_.getTargetCompID().getValue() == target) {
+                    found = session;
+                    break;
+                }
+            }
+        }
+        if (!found) throw SessionNotFound{std::string{sender} + "->" + std::string{target}};
+        return found->send(msg);
+    }
+
+    [[nodiscard]] static Session* lookupSession(const SessionID& id) noexcept {
+        std::lock_guard lock{registry_mutex()};
+        for (Session* session : registry()) {
+            if (session->id_ == id) return session;
+        }
+        return nullptr;
+    }
+
+    /// Messages fromApp() rejected by throwing (Reject / BusinessMessageReject sent)
+    [[nodiscard]] uint64_t rejected() const noexcept { return rejected_; }
+
+private:
+    void install(SessionCallbacks callbacks) {
+        callbacks.on_app_message =
+            [this, user = std::move(callbacks.on_app_message)](
+                const IndexedParser& msg, const RxTimestamp& rx_ts) {
+                from_app(msg);
+                if (user) user(msg, rx_ts);
+            };
+        callbacks.on_logon = [this, user = std::move(callbacks.on_logon)] {
+            on_logon();
+            if (user) user();
+        };
+        callbacks.on_logout = [this, user = std::move(callbacks.on_logout)](std::string_view reason) {
+            app_.onLogout(id_);
+            if (user) user(reason);
+        };
+        callbacks.on_audit =
+            [this, user = std::move(callbacks.on_audit)](
+                AuditDirection direction, uint32_t seq_num, std::span<const char> msg) {
+                if (direction == AuditDirection::Inbound) from_admin(msg);
+                if (user) user(direction, seq_num, msg);
+            };
+        session_.set_callbacks(std::move(callbacks));
+    }
+
+    void from_app(const IndexedParser& parsed) {
+        const Message msg{parsed};
+        try {
+            app_.fromApp(msg, id_);
+        } catch (const FieldNotFound& e) {
+            reject(parsed, e.field, SessionRejectReason_REQUIRED_TAG_MISSING, e.what());
+        } catch (const IncorrectTagValue& e) {
+            reject(parsed, e.field, SessionRejectReason_VALUE_IS_INCORRECT, e.what());
+        } catch (const IncorrectDataFormat& e) {
+            reject(parsed, e.field, SessionRejectReason_INCORRECT_DATA_FORMAT_FOR_VALUE, e.what());
+        } catch (const UnsupportedMessageType& e) {
+            Message reply;
+            reply.getHeader().setField(tag::MsgType::value, "j");
+            reply.setField(RefSeqNum(static_cast<int>(parsed.msg_seq_num())));
+            reply.setField(RefMsgType(std::string{parsed.msg_type_str()}));
+            reply.setField(BusinessRejectReason(BusinessRejectReason_UNSUPPORTED_MESSAGE_TYPE));
+            reply.setField(Text(e.what()));
+            send_reject(reply);
+        }
+    }
+
+    /// Session-level Reject (35=3) for a message fromApp() refused
+    void reject(const IndexedParser& parsed, int field, int reason, std::string_view text) {
+        Message reply;
+        reply.getHeader().setField(tag::MsgType::value, "3");
+        reply.setField(RefSeqNum(static_cast<int>(parsed.msg_seq_num())));
+        if (field > 0) reply.setField(RefTagID(field));
+        reply.setField(RefMsgType(std::string{parsed.msg_type_str()}));
+        reply.setField(SessionRejectReason(reason));
+        reply.setField(tag::Text::value, text);
+        send_reject(reply);
+    }
+
+    void send_reject(const Message& reply) {
+        ++rejected_;
+        detail::OutboundMessage out{reply, id_.getBeginString().getValue()};
+        (void)session_.send_app_message(out);
+    }
+
+    /// The audit tap sees every inbound message before the session acts on
+    /// it; only admin ones are parsed again, for fromAdmin()
+    void from_admin(std::span<const char> bytes) {
+        if (!Message::isAdminMsgType(peek_msg_type(bytes))) return;
+        if (!admin_parser_.assign<ChecksumPolicy::Deferred>(bytes)) return;
+        const Message msg{admin_parser_};
+        try {
+            app_.fromAdmin(msg, id_);
+        } catch (const RejectLogon& e) {
+            logon_rejected_ = e.detail.empty() ? std::string{e.what()} : e.detail;
+        } catch (const Exception&) {
+            // Admin messages are the engine's to reject
+        }
+    }
+
+    void on_logon() {
+        if (logon_rejected_) {
+            const std::string text = std::move(*logon_rejected_);
+            logon_rejected_.reset();
+            (void)session_.initiate_logout(text);
+            return;
+        }
+        app_.onLogon(id_);
+    }
+
+    /// MsgType without parsing: the third field, "35=" after 8 and 9
+    [[nodiscard]] static std::string_view peek_msg_type(std::span<const char> bytes) noexcept {
+        const std::string_view text{bytes.data(), bytes.size()};
+        const size_t start = text.find("\x01" "35=");
+        if (start == std::string_view::npos) return {};
+        const size_t value = start + 4;
+        const size_t end = text.find(fix::SOH, value);
+        if (end == std::string_view::npos) return {};
+        return text.substr(value, end - value);
+    }
+
+    static std::vector<Session*>& registry() {
+        static std::vector<Session*> sessions;
+        return sessions;
+    }
+
+    static std::mutex& registry_mutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    SessionManager& session_;
+    Application& app_;
+    SessionID id_;
+    IndexedParser admin_parser_;
+    std::optional<std::string> logon_rejected_;
+    uint64_t rejected_{0};
+};
+
+} // namespace nfx::qf
@@ -0,0 +1,134 @@
+/*
+    NexusFIX Inbound Reorder Buffer
+
+    When a MsgSeqNum gap is detected, the session asks the counterparty to
+    resend only the missing range and holds the messages that arrived after
+    the gap here. Once the resent messages (or a GapFill) bring the expected
+    seq num up to a held message, it is released and dispatched in order.
+
+    Usage (inside SessionManager):
+        // Gap: hold instead of dispatching out of order
+        if (reorder->hold(seq, bytes)) return;
+
+        // After every in-order message
+        while (const auto* held = reorder->find(sequences.expected_inbound())) {
+            dispatch(reorder->bytes(*held));
+            reorder->release(held->seq_num);
+        }
+
+    Slots are indexed by seq num modulo the capacity, so only messages within
+    one capacity of the expected seq num can be held; bytes are bump-allocated
+    from an arena that rewinds whenever the buffer empties. Either bound being
+    hit makes hold() return false and the session falls back to dispatching
+    the message out of order.
+
+    Single-threaded: owned by the session thread.
+*/
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "nexusfix/memory/cache_line.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Reorder Buffer
+// ============================================================================
+
+/// Bounded seq-num-indexed store of inbound messages received past a gap
+template <size_t MaxMessages = 256, size_t MaxBytes = 128 * 1024>
+class BasicReorderBuffer {
+public:
+    static_assert(std::has_single_bit(MaxMessages), "Slots are indexed by seq & mask");
+    static_assert(MaxBytes <= UINT32_MAX, "Arena offsets are 32-bit");
+
+    /// One held message (seq_num 0 = free slot)
+    struct Held {
+        uint32_t seq_num{0};
+        uint32_t offset{0};
+        uint32_t length{0};
+    };
+
+    /// Copy `msg` into the slot for `seq_num`; `expected` is the seq num the
+    /// session is waiting for. A seq num already held is kept as is.
+    /// @return false if the message is outside the window or the arena is full
+    [[nodiscard]] bool hold(uint32_t seq_num, uint32_t expected,
+                            std::span<const char> msg) noexcept {
+        if (seq_num <= expected || seq_num - expected >= MaxMessages) return false;
+
+        Held& slot = slots_[seq_num & MASK];
+        if (slot.seq_num == seq_num) return true;  // Duplicate of a held message
+        if (slot.seq_num != 0 || MaxBytes - write_pos_ < msg.size()) return false;
+
+        const auto len = static_cast<uint32_t>(msg.size());
+        std::memcpy(arena_ + write_pos_, msg.data(), len);
+        slot = Held{seq_num, write_pos_, len};
+        write_pos_ += len;
+        ++count_;
+        return true;
+    }
+
+    /// Held message with `seq_num`, nullptr if none
+    [[nodiscard]] const Held* find(uint32_t seq_num) const noexcept {
+        const Held& slot = slots_[seq_num & MASK];
+        return count_ != 0 && slot.seq_num == seq_num ? &slot : nullptr;
+    }
+
+    /// Bytes of a held message (valid until the buffer empties)
+    [[nodiscard]] std::span<const char> bytes(const Held& held) const noexcept {
+        return {arena_ + held.offset, held.length};
+    }
+
+    /// Free the slot of a held message
+    /// @return false if `seq_num` is not held
+    bool release(uint32_t seq_num) noexcept {
+        Held& slot = slots_[seq_num & MASK];
+        if (count_ == 0 || slot.seq_num != seq_num) return false;
+        slot.seq_num = 0;
+        if (--count_ == 0) write_pos_ = 0;
+        return true;
+    }
+
+    /// Drop messages the expected seq num has moved past (SequenceReset)
+    void discard_below(uint32_t seq_num) noexcept {
+        if (count_ == 0) return;
+        for (Held& slot : slots_) {
+            if (slot.seq_num != 0 && slot.seq_num < seq_num) {
+                slot.seq_num = 0;
+                --count_;
+            }
+        }
+        if (count_ == 0) write_pos_ = 0;
+    }
+
+    void clear() noexcept {
+        if (count_ == 0) return;
+        for (Held& slot : slots_) slot.seq_num = 0;
+        count_ = 0;
+        write_pos_ = 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+    [[nodiscard]] size_t held_bytes() const noexcept { return write_pos_; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return MaxMessages; }
+
+private:
+    static constexpr uint32_t MASK = static_cast<uint32_t>(MaxMessages - 1);
+
+    Held slots_[MaxMessages]{};
+    size_t count_{0};
+    uint32_t write_pos_{0};
+    alignas(memory::CACHE_LINE_SIZE) char arena_[MaxBytes];
+};
+
+/// Session reorder buffer: up to 256 seq nums ahead / 128 KiB held
+using ReorderBuffer = BasicReorderBuffer<>;
+
+} // namespace nfx
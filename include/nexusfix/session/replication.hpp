@@ -0,0 +1,435 @@
+/*
+    NexusFIX Hot-Standby Session Replication
+
+    Streams a session's recovery state from the primary engine to a standby
+    process over a shared-memory ring (ShmPublisher / ShmSubscriber), so the
+    standby keeps a warm MemoryMessageStore and SequenceManager and can take
+    the session over with a plain logon at the right MsgSeqNum instead of a
+    cold start and a resend storm.
+
+    Primary (session thread):
+    - SessionReplicator is the session's message store: a decorator over
+      the real backend. Every message the backend accepts is published as
+      an Append record (one memcpy into the ring). The session stores a
+      message before it hands it to the transport, so the standby never
+      trails the wire on outbound sequence numbers.
+    - The session mirrors its sequence numbers into the replicator's
+      SequenceCheckpoint; poll() publishes them, with the session state,
+      whenever they changed (a Progress record).
+    - When the ring is full (standby too slow) or a new standby attaches,
+      poll() resynchronizes: a Snapshot of the whole backend, published in
+      chunks across polls, then Progress. Live appends are not published
+      while a snapshot runs; the snapshot picks them up.
+
+    Standby:
+    - StandbyReplica applies the records of one session; poll() drains a
+      subscriber. in_sync() is true once a snapshot completed, until a
+      jump in Append seq nums shows the primary dropped records.
+    - take_over() hands the mirror to a SessionManager: the store becomes
+      its message store and the checkpoint restores both sequence numbers.
+
+    Inbound sequence numbers are replicated by poll(), not per message, so
+    after a takeover the counterparty may resend the few messages received
+    since the last poll: a short gap fill, not a full replay.
+
+    Several sessions may share one ring (ReplicationConfig::session_id);
+    a ring has a single producer, so they must share the primary thread.
+
+    Usage:
+        // Primary
+        auto ring = ShmPublisher::create("oms.repl", {.capacity = 1 << 24});
+        SessionReplicator replicator{*ring, backend, {.session_id = 1}};
+        session.set_message_store(&replicator);
+        session.attach_sequence_checkpoint(replicator.checkpoint());
+        ...
+        session.on_timer_tick();
+        replicator.poll(session.state());
+
+        // Standby
+        auto sub = ShmSubscriber::attach("oms.repl");
+        StandbyReplica replica{{.session_id = 1}, store_config};
+        while (!primary_failed) replica.poll(*sub);
+        replica.poll(*sub);                 // Drain what the primary left
+        replica.take_over(session);
+        session.initiate_logon();
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/session/sequence.hpp"
+#include "nexusfix/session/state.hpp"
+#include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/store/sequence_checkpoint.hpp"
+#include "nexusfix/transport/shm_transport.hpp"
+
+namespace nfx {
+
+#if NFX_SHM_AVAILABLE
+
+// ============================================================================
+// Replication Records
+// ============================================================================
+
+/// Record kinds, in the ring's user payload range
+enum class ReplicationKind : uint16_t {
+    Append = 0x100,     ///< Stored outbound message (meta.seq_num)
+    Progress,           ///< ReplicationProgress
+    Reset,              ///< Store reset
+    SnapshotBegin,      ///< Resync starts: drop everything held
+    SnapshotEnd,        ///< Resync complete, ReplicationProgress
+};
+
+[[nodiscard]] constexpr ShmPayload to_payload(ReplicationKind kind) noexcept {
+    return static_cast<ShmPayload>(static_cast<uint16_t>(kind));
+}
+
+/// Sequence numbers and state of the primary session
+struct ReplicationProgress {
+    uint32_t next_outbound{SequenceManager::INITIAL_SEQ_NUM};
+    uint32_t expected_inbound{SequenceManager::INITIAL_SEQ_NUM};
+    SessionState state{SessionState::Disconnected};
+    uint8_t reserved[3]{};
+};
+
+static_assert(sizeof(ReplicationProgress) == 12);
+
+struct ReplicationConfig {
+    uint16_t session_id{0};         ///< Tags this session's records on a shared ring
+};
+
+// ============================================================================
+// Primary Side
+// ============================================================================
+
+struct ReplicatorStats {
+    uint64_t appends{0};            ///< Append records published
+    uint64_t progress{0};           ///< Progress records published
+    uint64_t snapshots{0};          ///< Resyncs completed
+    uint64_t overflows{0};          ///< Records the ring had no room for
+};
+
+/// Message store decorator publishing the session's recovery state.
+/// Single-threaded: the session thread calls store() and poll().
+class SessionReplicator final : public store::IMessageStore {
+public:
+    /// @param ring Replication ring (ownership NOT transferred)
+    /// @param backend Store that keeps the messages (ownership NOT transferred)
+    SessionReplicator(ShmPublisher& ring, store::IMessageStore& backend,
+                      ReplicationConfig config = {}) noexcept
+        : ring_{ring}
+        , backend_{backend}
+        , config_{config} {}
+
+    /// Record to attach to the session (SessionManager::attach_sequence_checkpoint);
+    /// it starts empty, so attaching seeds it from the session
+    [[nodiscard]] store::SequenceCheckpoint* checkpoint() noexcept { return &checkpoint_; }
+
+    /// Publish sequence/state changes and advance a pending resync
+    /// @param state The session's current state
+    /// @return true when the standby is up to date as far as the ring goes
+    bool poll(SessionState state) noexcept {
+        const size_t subscribers = ring_.subscribers();
+        if (subscribers > subscribers_) start_snapshot();
+        subscribers_ = subscribers;
+
+        if (snapshot_) {
+            if (!continue_snapshot(state)) return false;
+        }
+
+        const uint64_t updates = checkpoint_.update_count();
+        if (updates == progress_mark_ && state == progress_state_) return true;
+        if (!publish_progress(ReplicationKind::Progress, state)) return false;
+        progress_mark_ = updates;
+        progress_state_ = state;
+        ++stats_.progress;
+        return true;
+    }
+
+    /// A resync is in progress
+    [[nodiscard]] bool resyncing() const noexcept { return snapshot_; }
+
+    [[nodiscard]] const ReplicatorStats& replication_stats() const noexcept { return stats_; }
+
+    // ========================================================================
+    // IMessageStore (forwarded to the backend)
+    // ========================================================================
+
+    [[nodiscard]] NFX_HOT bool store(uint32_t seq_num, std::span<const char> msg) noexcept override {
+        if (!backend_.store(seq_num, msg)) return false;
+        if (!snapshot_) [[likely]] {
+            if (ring_.publish(to_payload(ReplicationKind::Append), msg, meta(seq_num))) [[likely]] {
+                ++stats_.appends;
+            } else {
+                overflow();
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] std::optional<std::vector<char>> retrieve(uint32_t seq_num) const noexcept override {
+        return backend_.retrieve(seq_num);
+    }
+
+    [[nodiscard]] std::vector<std::vector<char>>
+        retrieve_range(uint32_t begin_seq, uint32_t end_seq) const noexcept override {
+        return backend_.retrieve_range(begin_seq, end_seq);
+    }
+
+    size_t for_each_in_range(uint32_t begin_seq, uint32_t end_seq,
+                             store::MessageVisitor visitor) const noexcept override {
+        return backend_.for_each_in_range(begin_seq, end_seq, visitor);
+    }
+
+    void set_next_sender_seq_num(uint32_t seq) noexcept override {
+        backend_.set_next_sender_seq_num(seq);
+    }
+
+    void set_next_target_seq_num(uint32_t seq) noexcept override {
+        backend_.set_next_target_seq_num(seq);
+    }
+
+    [[nodiscard]] uint32_t get_next_sender_seq_num() const noexcept override {
+        return backend_.get_next_sender_seq_num();
+    }
+
+    [[nodiscard]] uint32_t get_next_target_seq_num() const noexcept override {
+        return backend_.get_next_target_seq_num();
+    }
+
+    void reset() noexcept override {
+        backend_.reset();
+        if (snapshot_) {
+            start_snapshot();   // Restart from the emptied backend
+        } else if (!ring_.publish(to_payload(ReplicationKind::Reset), {}, meta(0))) {
+            overflow();
+        }
+    }
+
+    void flush() noexcept override { backend_.flush(); }
+
+    [[nodiscard]] std::string_view session_id() const noexcept override {
+        return backend_.session_id();
+    }
+
+    size_t shrink_to_fit() noexcept override { return backend_.shrink_to_fit(); }
+
+    [[nodiscard]] Stats stats() const noexcept override { return backend_.stats(); }
+
+private:
+    [[nodiscard]] ShmMeta meta(uint32_t seq_num) const noexcept {
+        return ShmMeta{.session_id = config_.session_id, .seq_num = seq_num};
+    }
+
+    void overflow() noexcept {
+        ++stats_.overflows;
+        start_snapshot();
+    }
+
+    void start_snapshot() noexcept {
+        snapshot_ = true;
+        snapshot_begun_ = false;
+        snapshot_next_ = 1;
+    }
+
+    /// Publish as much of the snapshot as fits
+    /// @return true once SnapshotEnd is out
+    bool continue_snapshot(SessionState state) noexcept {
+        if (!snapshot_begun_) {
+            if (!ring_.publish(to_payload(ReplicationKind::SnapshotBegin), {}, meta(0))) {
+                ++stats_.overflows;
+                return false;
+            }
+            snapshot_begun_ = true;
+        }
+
+        bool full = false;
+        (void)backend_.visit_range(snapshot_next_, 0, [&](uint32_t seq, std::span<const char> msg) {
+            if (!ring_.publish(to_payload(ReplicationKind::Append), msg, meta(seq))) {
+                full = true;
+                return false;
+            }
+            snapshot_next_ = seq + 1;
+            return true;
+        });
+        if (full) {
+            ++stats_.overflows;
+            return false;
+        }
+
+        if (!publish_progress(ReplicationKind::SnapshotEnd, state)) return false;
+        snapshot_ = false;
+        progress_mark_ = checkpoint_.update_count();
+        progress_state_ = state;
+        ++stats_.snapshots;
+        return true;
+    }
+
+    bool publish_progress(ReplicationKind kind, SessionState state) noexcept {
+        const ReplicationProgress progress{
+            .next_outbound = checkpoint_.outbound(),
+            .expected_inbound = checkpoint_.inbound(),
+            .state = state,
+        };
+        if (ring_.publish(to_payload(kind),
+                          {reinterpret_cast<const char*>(&progress), sizeof(progress)},
+                          meta(0))) {
+            return true;
+        }
+        ++stats_.overflows;
+        return false;
+    }
+
+    ShmPublisher& ring_;
+    store::IMessageStore& backend_;
+    ReplicationConfig config_;
+    store::SequenceCheckpoint checkpoint_{};
+    ReplicatorStats stats_;
+
+    size_t subscribers_{0};
+    uint64_t progress_mark_{~uint64_t{0}};          // Checkpoint updates last published
+    SessionState progress_state_{SessionState::Disconnected};
+    bool snapshot_{false};
+    bool snapshot_begun_{false};
+    uint32_t snapshot_next_{1};                     // Next seq to copy into the snapshot
+};
+
+// ============================================================================
+// Standby Side
+// ============================================================================
+
+struct StandbyStats {
+    uint64_t appends{0};            ///< Messages stored
+    uint64_t progress{0};           ///< Progress records applied
+    uint64_t snapshots{0};          ///< Resyncs completed
+    uint64_t store_failures{0};     ///< Appends the mirror store refused
+};
+
+/// Warm mirror of one primary session
+class StandbyReplica {
+public:
+    /// @param store_config Mirror store; size it like the primary's backend
+    StandbyReplica(ReplicationConfig config, store::MemoryMessageStore::Config store_config)
+        : config_{config}
+        , store_{std::move(store_config)}
+    {
+        sequences_.attach_checkpoint(&checkpoint_);
+    }
+
+    StandbyReplica(const StandbyReplica&) = delete;
+    StandbyReplica& operator=(const StandbyReplica&) = delete;
+
+    /// Apply one record
+    /// @return false if it belongs to another session (or is not a
+    ///         replication record)
+    bool apply(const ShmMessage& record) noexcept {
+        const auto kind = static_cast<uint16_t>(record.kind);
+        if (record.meta.session_id != config_.session_id ||
+            kind < static_cast<uint16_t>(ReplicationKind::Append) ||
+            kind > static_cast<uint16_t>(ReplicationKind::SnapshotEnd)) {
+            return false;
+        }
+
+        switch (static_cast<ReplicationKind>(kind)) {
+            case ReplicationKind::Append:
+                // Appends arrive in seq order: a jump means the primary
+                // dropped records (ring full) and a snapshot will follow
+                if (last_append_ != 0 && record.meta.seq_num > last_append_ + 1) {
+                    in_sync_ = false;
+                }
+                // A seq num below the newest one means the primary's store
+                // restarted numbering without a Reset record reaching us
+                if (!store_.store(record.meta.seq_num, record.payload)) {
+                    store_.reset();
+                    if (!store_.store(record.meta.seq_num, record.payload)) {
+                        ++stats_.store_failures;
+                        break;
+                    }
+                }
+                last_append_ = record.meta.seq_num;
+                sequences_.set_outbound(record.meta.seq_num + 1);
+                ++stats_.appends;
+                break;
+            case ReplicationKind::Progress:
+                apply_progress(record.payload);
+                break;
+            case ReplicationKind::Reset:
+                store_.reset();
+                last_append_ = 0;
+                break;
+            case ReplicationKind::SnapshotBegin:
+                store_.reset();
+                last_append_ = 0;
+                in_sync_ = false;
+                break;
+            case ReplicationKind::SnapshotEnd:
+                apply_progress(record.payload);
+                in_sync_ = true;
+                ++stats_.snapshots;
+                break;
+        }
+        return true;
+    }
+
+    /// Apply everything a subscriber has for this session (records of
+    /// other sessions are skipped)
+    /// @return Records consumed
+    size_t poll(ShmSubscriber& ring, size_t max_count = SIZE_MAX) noexcept {
+        const size_t consumed = ring.poll([this](const ShmMessage& m) { (void)apply(m); }, max_count);
+        if (ring.detached()) in_sync_ = false;      // Evicted as too slow
+        return consumed;
+    }
+
+    /// A snapshot completed and no Append was missed since
+    [[nodiscard]] bool in_sync() const noexcept { return in_sync_; }
+
+    /// Last session state the primary reported
+    [[nodiscard]] SessionState primary_state() const noexcept { return primary_state_; }
+
+    [[nodiscard]] store::MemoryMessageStore& store() noexcept { return store_; }
+    [[nodiscard]] const SequenceManager& sequences() const noexcept { return sequences_; }
+    [[nodiscard]] const StandbyStats& stats() const noexcept { return stats_; }
+
+    /// Make a session continue from the mirror: the store becomes its
+    /// message store and its sequence numbers are restored. The replica
+    /// must outlive the session's use of both; stop applying records
+    /// once the session runs.
+    template <typename Session>
+    void take_over(Session& session) noexcept {
+        session.set_message_store(&store_);
+        session.attach_sequence_checkpoint(&checkpoint_);
+    }
+
+private:
+    void apply_progress(std::span<const char> payload) noexcept {
+        if (payload.size() < sizeof(ReplicationProgress)) return;
+        ReplicationProgress progress;
+        std::memcpy(&progress, payload.data(), sizeof(progress));
+        sequences_.set_outbound(progress.next_outbound);
+        sequences_.set_inbound(progress.expected_inbound);
+        primary_state_ = progress.state;
+        ++stats_.progress;
+    }
+
+    ReplicationConfig config_;
+    store::MemoryMessageStore store_;
+    store::SequenceCheckpoint checkpoint_{};
+    SequenceManager sequences_;
+    StandbyStats stats_;
+    SessionState primary_state_{SessionState::Disconnected};
+    uint32_t last_append_{0};
+    bool in_sync_{false};
+};
+
+#endif  // NFX_SHM_AVAILABLE
+
+} // namespace nfx
@@ -0,0 +1,505 @@
+/*
+    NexusFIX Resend Support
+
+    Rewrites stored messages for replay in response to a ResendRequest (35=2).
+    Per the FIX session protocol a resent message must carry:
+    - PossDupFlag (43) = Y
+    - SendingTime (52) = time of retransmission
+    - OrigSendingTime (122) = SendingTime of the original transmission
+
+    Session-level messages in the range are not replayed: contiguous runs
+    of admin messages and missing seq nums collapse into a single
+    SequenceReset-GapFill (35=4, 123=Y).
+
+    The rewrite is a single header splice into a preallocated buffer:
+    the structural index locates the header fields, everything else is
+    copied with the fused copy+checksum kernel, BodyLength is written
+    directly (its new value is known up front) and only the spliced-in
+    bytes are summed separately. No re-serialization, no allocation, and
+    the copied bytes are read once.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/types/tag.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/parser/structural_index.hpp"
+#include "nexusfix/parser/simd_checksum.hpp"
+#include "nexusfix/store/i_message_store.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Resend Rewriter
+// ============================================================================
+
+/// Splices PossDupFlag/SendingTime/OrigSendingTime into stored messages
+class ResendRewriter {
+public:
+    /// Extra bytes a rewrite can add: "43=Y|" + "122=<time>|" + BodyLength digit
+    static constexpr size_t MAX_GROWTH = 64;
+    static constexpr size_t MAX_MESSAGE_SIZE = fix::MAX_MESSAGE_SIZE;
+    static constexpr size_t TRAILER_SIZE = 7;  // "10=NNN" SOH
+
+    /// Number of leading fields searched for header tags
+    static constexpr size_t HEADER_SCAN_FIELDS = 16;
+
+    ResendRewriter() noexcept = default;
+
+    /// Rewrite a stored message for retransmission
+    /// @param stored Original message bytes (complete, with checksum)
+    /// @param sending_time New SendingTime (52) value
+    /// @return View into the internal buffer, valid until the next rewrite()
+    [[nodiscard]] NFX_HOT
+    ParseResult<std::span<const char>> rewrite(
+        std::span<const char> stored,
+        std::string_view sending_time) noexcept
+    {
+        return rewrite_into(buffer_, stored, sending_time);
+    }
+
+    /// Rewrite using the header summary the store kept with the message:
+    /// no structural index, only the BodyLength and SendingTime fields are
+    /// located. Messages already carrying PossDupFlag take rewrite() above.
+    [[nodiscard]] NFX_HOT
+    ParseResult<std::span<const char>> rewrite(
+        std::span<const char> stored,
+        const store::MessageMeta& meta,
+        std::string_view sending_time) noexcept
+    {
+        return rewrite_into(buffer_, stored, meta, sending_time);
+    }
+
+    /// Bytes rewrite_into() may need for `stored`
+    [[nodiscard]] static constexpr size_t max_rewritten_size(
+        size_t stored_size, std::string_view sending_time) noexcept {
+        return stored_size + sending_time.size() + MAX_GROWTH;
+    }
+
+    /// rewrite() into caller memory, e.g. the tail of an outbound batch, so
+    /// the stored bytes are copied once, straight into what is written
+    /// @param out At least max_rewritten_size() bytes
+    /// @return View into `out`
+    [[nodiscard]] NFX_HOT
+    static ParseResult<std::span<const char>> rewrite_into(
+        std::span<char> out,
+        std::span<const char> stored,
+        std::string_view sending_time) noexcept
+    {
+        if (stored.size() < fix::MIN_MESSAGE_SIZE ||
+            max_rewritten_size(stored.size(), sending_time) > out.size()) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::BufferTooShort}};
+        }
+
+        // Stage 1: structural index locates every field boundary
+        const simd::FIXStructuralIndex idx = simd::build_index(stored);
+        if (!idx.valid()) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::GarbledMessage}};
+        }
+
+        // Locate header fields of interest within the leading fields
+        HeaderLayout hdr;
+        const size_t scan = std::min<size_t>(idx.field_count(), HEADER_SCAN_FIELDS);
+        for (size_t i = 0; i < scan; ++i) {
+            switch (idx.tag_at(stored, i)) {
+                case tag::BodyLength::value:      hdr.body_length = i; break;
+                case tag::SendingTime::value:     hdr.sending_time = i; break;
+                case tag::PossDupFlag::value:     hdr.poss_dup = i; break;
+                case tag::OrigSendingTime::value: hdr.orig_sending_time = i; break;
+                default: break;
+            }
+        }
+
+        if (hdr.body_length != 1 || hdr.sending_time == HeaderLayout::NONE) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField,
+                hdr.body_length != 1 ? tag::BodyLength::value : tag::SendingTime::value}};
+        }
+
+        const auto bl = idx.field_bounds(hdr.body_length);       // 9=...
+        const auto st = idx.field_bounds(hdr.sending_time);      // 52=...
+        SpliceLayout layout{
+            .bl_value = bl[2],
+            .body_start = static_cast<size_t>(bl[3]) + 1,
+            .st_field = st[0],
+            .st_value = st[2],
+            .st_end = st[3],
+            .has_orig_time = hdr.orig_sending_time != HeaderLayout::NONE,
+        };
+        if (hdr.poss_dup != HeaderLayout::NONE) {
+            const auto pd = idx.field_bounds(hdr.poss_dup);
+            if (pd[3] - pd[2] != 1) [[unlikely]] {
+                return std::unexpected{ParseError{ParseErrorCode::InvalidFieldFormat,
+                    tag::PossDupFlag::value}};
+            }
+            layout.poss_dup_value = pd[2];
+        }
+        return splice(out, stored, layout, sending_time);
+    }
+
+    /// rewrite() by MessageMeta into caller memory
+    /// @param out At least max_rewritten_size() bytes
+    /// @return View into `out`
+    [[nodiscard]] NFX_HOT
+    static ParseResult<std::span<const char>> rewrite_into(
+        std::span<char> out,
+        std::span<const char> stored,
+        const store::MessageMeta& meta,
+        std::string_view sending_time) noexcept
+    {
+        if (!meta.valid() || meta.sending_time_offset == 0 ||
+            (meta.flags & store::MessageMeta::HAS_POSS_DUP)) [[unlikely]] {
+            return rewrite_into(out, stored, sending_time);
+        }
+        if (stored.size() < fix::MIN_MESSAGE_SIZE ||
+            max_rewritten_size(stored.size(), sending_time) > out.size() ||
+            meta.header_length > stored.size()) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::BufferTooShort}};
+        }
+
+        // "8=...|9=<len>|": BodyLength is always the second field
+        const char* data = stored.data();
+        const char* header_end = data + meta.header_length;
+        const auto* begin_soh = static_cast<const char*>(
+            std::memchr(data, fix::SOH, meta.header_length));
+        if (!begin_soh || header_end - begin_soh < 3 ||
+            begin_soh[1] != '9' || begin_soh[2] != '=') [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::MissingRequiredField,
+                tag::BodyLength::value}};
+        }
+        const size_t bl_value = static_cast<size_t>(begin_soh - data) + 3;
+        const auto* bl_soh = static_cast<const char*>(
+            std::memchr(data + bl_value, fix::SOH, meta.header_length - bl_value));
+
+        const size_t st_field = meta.sending_time_offset;
+        const auto* st_soh = st_field + 3 < meta.header_length
+            ? static_cast<const char*>(std::memchr(data + st_field + 3, fix::SOH,
+                                                   meta.header_length - st_field - 3))
+            : nullptr;
+        if (!bl_soh || !st_soh ||
+            std::string_view{data + st_field, 3} != "52=") [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::GarbledMessage}};
+        }
+
+        return splice(out, stored, SpliceLayout{
+            .bl_value = bl_value,
+            .body_start = static_cast<size_t>(bl_soh - data) + 1,
+            .st_field = st_field,
+            .st_value = st_field + 3,
+            .st_end = static_cast<size_t>(st_soh - data),
+            .has_orig_time = (meta.flags & store::MessageMeta::HAS_ORIG_SENDING_TIME) != 0,
+        }, sending_time);
+    }
+
+private:
+    /// Positions in the stored message that the splice needs
+    struct SpliceLayout {
+        size_t bl_value;                    // First BodyLength digit
+        size_t body_start;                  // Past BodyLength's SOH
+        size_t st_field;                    // Start of "52="
+        size_t st_value;                    // SendingTime value
+        size_t st_end;                      // SendingTime's SOH
+        size_t poss_dup_value{SIZE_MAX};    // Existing 43 value (SIZE_MAX = add one)
+        bool has_orig_time{false};          // 122 already present
+    };
+
+    [[nodiscard]] static ParseResult<std::span<const char>> splice(
+        std::span<char> dest,
+        std::span<const char> stored,
+        const SpliceLayout& at,
+        std::string_view sending_time) noexcept
+    {
+        // Trailer is always the fixed-width "10=NNN|" at the end
+        const size_t body_end = stored.size() - TRAILER_SIZE;
+        if (stored[body_end - 1] != fix::SOH ||
+            std::string_view{stored.data() + body_end, 3} != "10=" ||
+            stored.back() != fix::SOH) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::InvalidChecksum,
+                tag::CheckSum::value}};
+        }
+
+        const size_t body_start = at.body_start;
+        const size_t st_field_start = at.st_field;
+        const size_t st_field_end = at.st_end + 1;
+        const std::string_view orig_time{stored.data() + at.st_value, at.st_end - at.st_value};
+
+        if (body_start > st_field_start || st_field_end > body_end) [[unlikely]] {
+            return std::unexpected{ParseError{ParseErrorCode::GarbledMessage}};
+        }
+
+        const bool add_poss_dup = at.poss_dup_value == SIZE_MAX;
+        const bool add_orig_time = !at.has_orig_time;
+
+        // New BodyLength is known up front: no placeholder, no second pass
+        size_t new_body_len = (body_end - body_start)
+            - (st_field_end - st_field_start)
+            + (3 + sending_time.size() + 1);                     // "52=" value SOH
+        if (add_poss_dup) new_body_len += 5;                     // "43=Y" SOH
+        if (add_orig_time) new_body_len += 4 + orig_time.size() + 1;  // "122=" value SOH
+
+        char* out = dest.data();
+        size_t pos = 0;
+
+        // Running byte sum: copies are summed as they go, splices after
+        uint32_t sum = 0;
+
+        // "8=...|9="
+        sum += parser::copy_checksum(out, stored.data(), at.bl_value);
+        pos = at.bl_value;
+
+        // BodyLength, preserving the original zero-padded width when possible
+        pos += write_body_length(out + pos, new_body_len, body_start - 1 - at.bl_value);
+        out[pos++] = fix::SOH;
+        sum += parser::checksum(out + at.bl_value, pos - at.bl_value);
+
+        // Fields between BodyLength and SendingTime
+        const size_t before_len = st_field_start - body_start;
+        sum += parser::copy_checksum(out + pos, stored.data() + body_start, before_len);
+        const size_t before_out = pos;
+        pos += before_len;
+
+        const size_t splice_out = pos;
+        if (add_poss_dup) {
+            pos += append(out + pos, "43=Y\x01");
+        }
+
+        pos += append(out + pos, "52=");
+        pos += append(out + pos, sending_time);
+        out[pos++] = fix::SOH;
+
+        if (add_orig_time) {
+            pos += append(out + pos, "122=");
+            pos += append(out + pos, orig_time);
+            out[pos++] = fix::SOH;
+        }
+
+        sum += parser::checksum(out + splice_out, pos - splice_out);
+
+        // Remainder of header and the whole body in one copy
+        const size_t after_len = body_end - st_field_end;
+        sum += parser::copy_checksum(out + pos, stored.data() + st_field_end, after_len);
+        const size_t after_out = pos;
+        pos += after_len;
+
+        // Existing PossDupFlag (e.g. 43=N) is patched in place
+        if (!add_poss_dup) {
+            const size_t src = at.poss_dup_value;
+            const size_t dst = src < st_field_start
+                ? before_out + (src - body_start)
+                : after_out + (src - st_field_end);
+            sum += static_cast<uint32_t>('Y') - static_cast<uint8_t>(out[dst]);
+            out[dst] = 'Y';
+        }
+
+        // Trailer: byte sum mod 256 (unsigned wrap keeps it exact)
+        const auto cs = static_cast<uint8_t>(sum & 0xFF);
+        out[pos++] = '1';
+        out[pos++] = '0';
+        out[pos++] = '=';
+        parser::format_checksum(cs, out + pos);
+        pos += 3;
+        out[pos++] = fix::SOH;
+
+        return std::span<const char>{out, pos};
+    }
+
+    struct HeaderLayout {
+        static constexpr size_t NONE = SIZE_MAX;
+        size_t body_length{NONE};
+        size_t sending_time{NONE};
+        size_t poss_dup{NONE};
+        size_t orig_sending_time{NONE};
+    };
+
+    static size_t append(char* out, std::string_view sv) noexcept {
+        std::memcpy(out, sv.data(), sv.size());
+        return sv.size();
+    }
+
+    /// Write value with at least min_width digits (zero-padded)
+    static size_t write_body_length(char* out, size_t value, size_t min_width) noexcept {
+        char digits[20];
+        size_t n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + (value % 10));
+            value /= 10;
+        } while (value > 0);
+        while (n < min_width && n < sizeof(digits)) {
+            digits[n++] = '0';
+        }
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = digits[n - 1 - i];
+        }
+        return n;
+    }
+
+    std::array<char, MAX_MESSAGE_SIZE + MAX_GROWTH> buffer_;
+};
+
+// ============================================================================
+// In-Place MsgSeqNum Patch
+// ============================================================================
+
+/// Overwrite MsgSeqNum (34) of a complete message in place, zero-padded to
+/// the width already there, and adjust the CheckSum by the digit-sum
+/// difference. BodyLength is unchanged. Meant for messages serialized with
+/// SessionConfig::seq_num_width, where every seq num has the same width.
+/// @return false if 34 or the trailer is missing or seq needs more digits
+[[nodiscard]] inline bool patch_msg_seq_num(std::span<char> msg, uint32_t seq) noexcept {
+    constexpr std::string_view key{"\x01" "34="};
+    constexpr size_t TRAILER_SIZE = 7;      // "10=XXX|"
+    if (msg.size() < key.size() + TRAILER_SIZE) [[unlikely]] return false;
+
+    const std::string_view view{msg.data(), msg.size()};
+    const size_t pos = view.find(key);
+    if (pos == std::string_view::npos) [[unlikely]] return false;
+
+    char* value = msg.data() + pos + key.size();
+    char* const end = msg.data() + msg.size();
+    char* value_end = static_cast<char*>(std::memchr(value, fix::SOH,
+        static_cast<size_t>(end - value)));
+    char* trailer = end - TRAILER_SIZE;
+    if (!value_end || value_end >= trailer || trailer[-1] != fix::SOH ||
+        trailer[0] != '1' || trailer[1] != '0' || trailer[2] != '=') [[unlikely]] {
+        return false;
+    }
+
+    const size_t width = static_cast<size_t>(value_end - value);
+    size_t digits = 1;
+    for (uint32_t t = seq; t >= 10; t /= 10) ++digits;
+    if (digits > width) [[unlikely]] return false;
+
+    int delta = 0;
+    for (size_t i = width; i > 0; --i) {
+        const char digit = static_cast<char>('0' + seq % 10);
+        delta += digit - value[i - 1];
+        value[i - 1] = digit;
+        seq /= 10;
+    }
+
+    int checksum = (trailer[3] - '0') * 100 + (trailer[4] - '0') * 10 + (trailer[5] - '0');
+    checksum = ((checksum + delta) % 256 + 256) % 256;
+    trailer[3] = static_cast<char>('0' + checksum / 100);
+    trailer[4] = static_cast<char>('0' + (checksum / 10) % 10);
+    trailer[5] = static_cast<char>('0' + checksum % 10);
+    return true;
+}
+
+// ============================================================================
+// Gap Fill Coalescing
+// ============================================================================
+
+/// Whether a stored message is replaced by a GapFill instead of replayed.
+/// All session-level messages except Reject (35=3) are gap-filled.
+[[nodiscard]] inline constexpr bool is_gap_fill_on_resend(char type) noexcept {
+    return msg_type::is_admin(type) && type != msg_type::Reject;
+}
+
+/// Extract MsgType from stored message bytes (35 is always the third field)
+/// @return MsgType character, or '\0' if the header is malformed
+[[nodiscard]] inline char stored_msg_type(std::span<const char> msg) noexcept {
+    const char* ptr = msg.data();
+    const char* end = ptr + msg.size();
+
+    // Skip "8=...|" and "9=...|"
+    for (int i = 0; i < 2; ++i) {
+        ptr = static_cast<const char*>(std::memchr(ptr, fix::SOH,
+            static_cast<size_t>(end - ptr)));
+        if (!ptr) [[unlikely]] return '\0';
+        ++ptr;
+    }
+
+    if (end - ptr < 5 || ptr[0] != '3' || ptr[1] != '5' || ptr[2] != '=') [[unlikely]] {
+        return '\0';
+    }
+    return ptr[3];
+}
+
+/// Seq num range covered by one SequenceReset-GapFill
+struct GapFillRange {
+    uint32_t begin_seq;     // MsgSeqNum of the GapFill
+    uint32_t new_seq_no;    // NewSeqNo (36): first seq num after the run
+};
+
+/// Walks a resend range in seq order, collapsing contiguous runs of
+/// admin and missing seq nums into single GapFill ranges
+class GapFillCoalescer {
+public:
+    explicit GapFillCoalescer(uint32_t begin_seq) noexcept
+        : next_seq_{begin_seq}, run_start_{0} {}
+
+    /// Account for a stored message
+    /// @param flushed Set when a pending run ends before this message
+    /// @return true if the message should be replayed
+    [[nodiscard]] bool on_stored(
+        uint32_t seq,
+        char type,
+        std::optional<GapFillRange>& flushed) noexcept
+    {
+        return account(seq, is_gap_fill_on_resend(type), flushed);
+    }
+
+    /// Account for a stored message by the metadata its store kept
+    [[nodiscard]] bool on_stored(
+        uint32_t seq,
+        const store::MessageMeta& meta,
+        std::optional<GapFillRange>& flushed) noexcept
+    {
+        return account(seq, meta.gap_fill_on_resend(), flushed);
+    }
+
+    /// Close the range
+    /// @param end_seq First seq num after the resend range
+    /// @return Trailing run, if any
+    [[nodiscard]] std::optional<GapFillRange> finish(uint32_t end_seq) noexcept {
+        if (run_start_ == 0 && next_seq_ < end_seq) {
+            run_start_ = next_seq_;
+        }
+        if (run_start_ == 0) {
+            return std::nullopt;
+        }
+        GapFillRange range{run_start_, end_seq > run_start_ ? end_seq : next_seq_};
+        run_start_ = 0;
+        return range;
+    }
+
+private:
+    /// Shared by both on_stored() forms
+    [[nodiscard]] bool account(
+        uint32_t seq,
+        bool gap_fill,
+        std::optional<GapFillRange>& flushed) noexcept
+    {
+        flushed.reset();
+
+        // Seq nums missing from the store join the pending run
+        if (seq > next_seq_ && run_start_ == 0) {
+            run_start_ = next_seq_;
+        }
+        next_seq_ = seq + 1;
+
+        if (gap_fill) {
+            if (run_start_ == 0) run_start_ = seq;
+            return false;
+        }
+
+        if (run_start_ != 0) {
+            flushed = GapFillRange{run_start_, seq};
+            run_start_ = 0;
+        }
+        return true;
+    }
+
+    uint32_t next_seq_;     // First seq num not yet accounted for
+    uint32_t run_start_;    // Start of pending GapFill run (0 = none)
+};
+
+} // namespace nfx
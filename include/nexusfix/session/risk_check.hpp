@@ -0,0 +1,248 @@
+/*
+    NexusFIX Pre-trade Risk Check
+
+    Fat-finger and throttle checks run on every order before it is built:
+    price band around a reference price, max order quantity, max notional,
+    and message-rate limits per symbol and per session. Limits live in one
+    cache line per symbol, indexed by SymbolId, and all checks are evaluated
+    branch-free into a violation mask, so a passing and a failing order
+    cost the same.
+
+    Usage:
+        struct MyHandler {
+            util::SymbolTable& symbols;
+            PreTradeRisk risk{symbols};
+
+            // Optional SessionHandler member: runs in send_new_order() /
+            // send_app_message() before a sequence number is consumed
+            SessionResult<void> check_order(const fix44::NewOrderSingle::Builder& order) noexcept {
+                return risk.check(order, util::RdtscClock::now_ns());
+            }
+            // ... remaining SessionHandler members
+        };
+
+        handler.risk.set_limits(symbols.intern("AAPL"), RiskLimits{
+            .reference_price = FixedPrice::from_string("150.00"),
+            .price_band_bps = 500,                    // +/- 5%
+            .max_order_qty = Qty::from_int(10000),
+            .max_notional = FixedPrice::from_string("1000000"),
+            .max_orders_per_sec = 100,
+            .burst = 10});
+        handler.risk.set_session_rate(500, 50);
+
+    A check by SymbolId is ~25 cycles; the Builder overload adds one
+    SymbolTable::find(), so callers that already hold the id should use it.
+
+    Symbols without limits reject every order (max quantity 0). Rate limits
+    use GCRA (virtual scheduling): each accepted order advances a theoretical
+    arrival time (TAT) by 1/rate, and an order conforms while the TAT is at
+    most burst - 1 intervals ahead of now. Rejected orders consume no budget.
+
+    Single-threaded: check() mutates throttle state and runs on the session
+    thread; update limits from the same thread.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+
+#include "nexusfix/memory/cache_line.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/util/branchless.hpp"
+#include "nexusfix/util/symbol_table.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Limits and Violations
+// ============================================================================
+
+/// Violation bits reported by the last rejected check
+namespace risk_violation {
+    inline constexpr uint8_t None          = 0;
+    inline constexpr uint8_t PriceBand     = 1 << 0;  // Price outside reference band
+    inline constexpr uint8_t OrderQty      = 1 << 1;  // Qty <= 0 or above max
+    inline constexpr uint8_t Notional      = 1 << 2;  // Price * qty above max
+    inline constexpr uint8_t SymbolRate    = 1 << 3;  // Per-symbol throttle
+    inline constexpr uint8_t SessionRate   = 1 << 4;  // Session-wide throttle
+    inline constexpr uint8_t UnknownSymbol = 1 << 5;  // Not interned / out of range
+} // namespace risk_violation
+
+/// Per-symbol limits as configured
+struct RiskLimits {
+    FixedPrice reference_price;      // Band centre, and notional price for market orders
+    uint32_t price_band_bps{0};      // Max deviation from reference (basis points)
+    Qty max_order_qty;
+    FixedPrice max_notional;         // Max price * qty, in price units
+    uint32_t max_orders_per_sec{0};  // 0 = unthrottled
+    uint32_t burst{1};               // Orders allowed back to back
+};
+
+/// Rejection counters
+struct RiskStats {
+    uint64_t checked{0};
+    uint64_t rejected{0};
+    uint64_t price_band{0};
+    uint64_t order_qty{0};
+    uint64_t notional{0};
+    uint64_t rate_limited{0};
+};
+
+// ============================================================================
+// Pre-trade Risk Check
+// ============================================================================
+
+/// Per-symbol pre-trade limits indexed by SymbolId
+/// @tparam MaxSymbols Capacity of the SymbolTable the ids come from
+template <size_t MaxSymbols = 1024>
+class BasicPreTradeRisk {
+public:
+    using Symbols = util::BasicSymbolTable<MaxSymbols>;
+
+    explicit BasicPreTradeRisk(const Symbols& symbols) noexcept : symbols_{&symbols} {}
+
+    BasicPreTradeRisk(const BasicPreTradeRisk&) = delete;
+    BasicPreTradeRisk& operator=(const BasicPreTradeRisk&) = delete;
+
+    /// Install limits for a symbol (resets its throttle)
+    void set_limits(SymbolId id, const RiskLimits& limits) noexcept {
+        if (id.value >= MaxSymbols) [[unlikely]] return;
+        config_[id.value] = limits;
+        Entry& e = entries_[id.value];
+        e = Entry{};
+        e.max_qty_raw = limits.max_order_qty.raw;
+        e.max_notional_scaled = static_cast<double>(limits.max_notional.raw) *
+                                static_cast<double>(Qty::SCALE);
+        set_rate(e.symbol_rate, limits.max_orders_per_sec, limits.burst);
+        apply_reference(e, limits.reference_price, limits.price_band_bps);
+    }
+
+    /// Move a symbol's band to a new reference price (e.g. last trade)
+    void set_reference_price(SymbolId id, FixedPrice reference) noexcept {
+        if (id.value >= MaxSymbols) [[unlikely]] return;
+        config_[id.value].reference_price = reference;
+        apply_reference(entries_[id.value], reference, config_[id.value].price_band_bps);
+    }
+
+    /// Session-wide order rate (0 = unthrottled)
+    void set_session_rate(uint32_t max_orders_per_sec, uint32_t burst) noexcept {
+        set_rate(session_rate_, max_orders_per_sec, burst);
+    }
+
+    /// Check a NewOrderSingle before it is sent
+    [[nodiscard]] NFX_HOT SessionResult<void> check(const fix44::NewOrderSingle::Builder& order,
+                                                    uint64_t now_ns) noexcept {
+        return check(symbols_->find(order.symbol()), order.price(), order.order_qty(), now_ns);
+    }
+
+    /// Check an order; price 0 (market) skips the band and is valued at
+    /// the reference price. Throttles advance only if the order passes.
+    [[nodiscard]] NFX_HOT SessionResult<void> check(SymbolId id, FixedPrice price, Qty qty,
+                                                    uint64_t now_ns) noexcept {
+        ++stats_.checked;
+        if (id.value >= MaxSymbols) [[unlikely]] {
+            return reject(risk_violation::UnknownSymbol);
+        }
+        Entry& e = entries_[id.value];
+
+        const bool market = price.raw == 0;
+        const bool band_ok = market | util::in_range(price.raw, e.min_price_raw, e.max_price_raw);
+        const bool qty_ok = (qty.raw > 0) & (qty.raw <= e.max_qty_raw);
+        const int64_t px = util::branchless_select(market, e.reference_price_raw, price.raw);
+        const bool notional_ok =
+            static_cast<double>(px) * static_cast<double>(qty.raw) <= e.max_notional_scaled;
+
+        const uint64_t symbol_start = util::branchless_max(e.symbol_rate.tat_ns, now_ns);
+        const uint64_t session_start = util::branchless_max(session_rate_.tat_ns, now_ns);
+
+        const uint8_t violations = static_cast<uint8_t>(
+            (!band_ok ? risk_violation::PriceBand : 0) |
+            (!qty_ok ? risk_violation::OrderQty : 0) |
+            (!notional_ok ? risk_violation::Notional : 0) |
+            (symbol_start - now_ns > e.symbol_rate.window_ns ? risk_violation::SymbolRate : 0) |
+            (session_start - now_ns > session_rate_.window_ns ? risk_violation::SessionRate : 0));
+
+        const bool pass = violations == risk_violation::None;
+        e.symbol_rate.tat_ns = util::branchless_select(
+            pass, symbol_start + e.symbol_rate.interval_ns, e.symbol_rate.tat_ns);
+        session_rate_.tat_ns = util::branchless_select(
+            pass, session_start + session_rate_.interval_ns, session_rate_.tat_ns);
+
+        if (!pass) [[unlikely]] return reject(violations);
+        return {};
+    }
+
+    /// Violation bits of the most recent rejection (risk_violation::*)
+    [[nodiscard]] uint8_t last_violations() const noexcept { return last_violations_; }
+
+    [[nodiscard]] const RiskLimits& limits(SymbolId id) const noexcept {
+        return config_[id.value < MaxSymbols ? id.value : 0];
+    }
+
+    [[nodiscard]] const RiskStats& stats() const noexcept { return stats_; }
+
+private:
+    static constexpr uint64_t NANOS_PER_SECOND = 1'000'000'000ULL;
+    static constexpr uint64_t UNTHROTTLED = ~uint64_t{0};  // Any TAT conforms
+
+    /// GCRA state: theoretical arrival time, emission interval, tolerance
+    struct Throttle {
+        uint64_t tat_ns{0};
+        uint64_t interval_ns{0};  // 0 = unthrottled
+        uint64_t window_ns{UNTHROTTLED};  // (burst - 1) * interval
+    };
+
+    /// Hot per-symbol state: exactly one cache line
+    struct alignas(memory::CACHE_LINE_SIZE) Entry {
+        int64_t min_price_raw{0};
+        int64_t max_price_raw{0};
+        int64_t max_qty_raw{0};           // 0 = no limits installed (rejects all)
+        int64_t reference_price_raw{0};
+        double max_notional_scaled{0.0};  // max_notional.raw * Qty::SCALE
+        Throttle symbol_rate;
+    };
+    static_assert(sizeof(Entry) == memory::CACHE_LINE_SIZE, "Risk entry must fill one cache line");
+
+    static void set_rate(Throttle& t, uint32_t per_sec, uint32_t burst) noexcept {
+        t = Throttle{};
+        if (per_sec == 0) return;
+        t.interval_ns = NANOS_PER_SECOND / per_sec;
+        t.window_ns = t.interval_ns * (burst > 0 ? burst - 1 : 0);
+    }
+
+    static void apply_reference(Entry& e, FixedPrice reference, uint32_t band_bps) noexcept {
+        const int64_t band = reference.raw / 10000 * static_cast<int64_t>(band_bps);
+        e.reference_price_raw = reference.raw;
+        e.min_price_raw = reference.raw - band;
+        e.max_price_raw = reference.raw + band;
+    }
+
+    [[nodiscard]] std::unexpected<SessionError> reject(uint8_t violations) noexcept {
+        last_violations_ = violations;
+        ++stats_.rejected;
+        stats_.price_band += (violations & risk_violation::PriceBand) != 0;
+        stats_.order_qty += (violations & risk_violation::OrderQty) != 0;
+        stats_.notional += (violations & risk_violation::Notional) != 0;
+        stats_.rate_limited +=
+            (violations & (risk_violation::SymbolRate | risk_violation::SessionRate)) != 0;
+        return std::unexpected{SessionError{SessionErrorCode::RiskRejected}};
+    }
+
+    std::array<Entry, MaxSymbols> entries_{};
+    Throttle session_rate_;
+    const Symbols* symbols_;
+    uint8_t last_violations_{risk_violation::None};
+    RiskStats stats_;
+    std::array<RiskLimits, MaxSymbols> config_{};  // Cold: as configured
+};
+
+/// Default risk check: limits for up to 1024 symbols
+using PreTradeRisk = BasicPreTradeRisk<>;
+
+} // namespace nfx
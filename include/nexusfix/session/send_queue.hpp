@@ -0,0 +1,263 @@
+/*
+    NexusFIX Multi-Producer Session Send Queue
+
+    Lets several strategy threads send on one session without a mutex.
+    SequenceManager::next_outbound() is single-writer by design, so instead
+    of sharing it, producers serialize only the message body (the fields
+    after SendingTime) into a claimed memory::MPSCQueue slot. The session
+    thread drains the queue in claim order, assigns MsgSeqNum and
+    SendingTime, and adds the header and checksum through
+    send_app_message(). Sequence numbers on the wire therefore follow
+    claim order.
+
+    Producers only contend on the queue's head CAS: none waits for another
+    to finish writing. A producer still filling its slot delays delivery
+    of later slots, but not their claims.
+
+    Usage:
+        SendQueue<> queue;
+
+        // Any strategy thread
+        bool queued = queue.try_send("D", [&](BodyWriter& body) {
+            body.field(tag::ClOrdID::value, id)
+                .field(tag::Symbol::value, "AAPL")
+                .field(tag::Side::value, '1')
+                .field(tag::TransactTime::value, now)
+                .field(tag::OrderQty::value, int64_t{100})
+                .field(tag::OrdType::value, '2')
+                .field(tag::Price::value, px);
+        });
+
+        // Session thread, e.g. once per event-loop iteration
+        queue.drain(session);
+
+    Bodies go out as written: the session's risk checks (check_order) do
+    not see them, so pre-trade checks belong in the producer.
+*/
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/memory/cache_line.hpp"
+#include "nexusfix/memory/mpsc_queue.hpp"
+#include "nexusfix/messages/common/trailer.hpp"
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/tag.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Body Writer
+// ============================================================================
+
+/// Appends "tag=value<SOH>" fields into a fixed buffer
+/// Writes past the end are dropped and flagged by overflow().
+class BodyWriter {
+public:
+    explicit BodyWriter(std::span<char> out) noexcept : out_{out} {}
+
+    BodyWriter& field(int tag_num, std::string_view value) noexcept {
+        char tag_buf[12];
+        const auto end = std::to_chars(tag_buf, tag_buf + sizeof(tag_buf), tag_num).ptr;
+        const size_t tag_len = static_cast<size_t>(end - tag_buf);
+        if (pos_ + tag_len + value.size() + 2 > out_.size()) [[unlikely]] {
+            overflow_ = true;
+            return *this;
+        }
+        std::memcpy(out_.data() + pos_, tag_buf, tag_len);
+        pos_ += tag_len;
+        out_[pos_++] = '=';
+        std::memcpy(out_.data() + pos_, value.data(), value.size());
+        pos_ += value.size();
+        out_[pos_++] = fix::SOH;
+        return *this;
+    }
+
+    BodyWriter& field(int tag_num, int64_t value) noexcept {
+        char buf[20];
+        const auto end = std::to_chars(buf, buf + sizeof(buf), value).ptr;
+        return field(tag_num, std::string_view{buf, static_cast<size_t>(end - buf)});
+    }
+
+    BodyWriter& field(int tag_num, char value) noexcept {
+        return field(tag_num, std::string_view{&value, 1});
+    }
+
+    BodyWriter& field(int tag_num, FixedPrice value) noexcept {
+        char buf[FixedPrice::MAX_CHARS];
+        return field(tag_num, std::string_view{buf, value.to_chars(buf)});
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return pos_; }
+    [[nodiscard]] bool overflow() const noexcept { return overflow_; }
+    [[nodiscard]] std::string_view view() const noexcept { return {out_.data(), pos_}; }
+
+private:
+    std::span<char> out_;
+    size_t pos_{0};
+    bool overflow_{false};
+};
+
+// ============================================================================
+// Raw Body Builder
+// ============================================================================
+
+/// Message builder over a pre-encoded body, for send_app_message()
+/// The session fills in CompIDs, MsgSeqNum and SendingTime as usual.
+class RawBodyBuilder {
+public:
+    RawBodyBuilder(std::string_view begin_string, std::string_view msg_type,
+                   std::string_view body) noexcept
+        : begin_string_{begin_string}, msg_type_{msg_type}, body_{body} {}
+
+    RawBodyBuilder& sender_comp_id(std::string_view v) noexcept { sender_comp_id_ = v; return *this; }
+    RawBodyBuilder& target_comp_id(std::string_view v) noexcept { target_comp_id_ = v; return *this; }
+    RawBodyBuilder& msg_seq_num(uint32_t v) noexcept { msg_seq_num_ = v; return *this; }
+    RawBodyBuilder& sending_time(std::string_view v) noexcept { sending_time_ = v; return *this; }
+
+    [[nodiscard]] std::span<const char> build(MessageAssembler& asm_) const noexcept {
+        return asm_.start(begin_string_)
+            .field(tag::MsgType::value, msg_type_)
+            .field(tag::SenderCompID::value, sender_comp_id_)
+            .field(tag::TargetCompID::value, target_comp_id_)
+            .field(tag::MsgSeqNum::value, static_cast<int64_t>(msg_seq_num_))
+            .field(tag::SendingTime::value, sending_time_)
+            .raw_fields(body_)
+            .finish();
+    }
+
+private:
+    std::string_view begin_string_;
+    std::string_view msg_type_;
+    std::string_view body_;
+    std::string_view sender_comp_id_;
+    std::string_view target_comp_id_;
+    uint32_t msg_seq_num_{0};
+    std::string_view sending_time_;
+};
+
+// ============================================================================
+// Send Queue
+// ============================================================================
+
+/// Counters kept by the draining (session) thread
+struct SendQueueStats {
+    uint64_t sent{0};
+    uint64_t failed{0};     ///< Rejected by the session (not active, throttled out, ...)
+    uint64_t dropped{0};    ///< Body overflowed its slot
+};
+
+/// Multi-producer, session-thread-drained outbound queue
+/// @tparam Capacity Slots in flight (power of 2)
+/// @tparam MaxBody Largest body a slot holds
+template <size_t Capacity = 1024, size_t MaxBody = 440>
+class SendQueue {
+public:
+    static constexpr size_t MAX_MSG_TYPE = 2;
+
+    struct alignas(memory::CACHE_LINE_SIZE) Slot {
+        uint16_t body_len{0};
+        uint8_t msg_type_len{0};
+        bool overflow{false};
+        std::array<char, MAX_MSG_TYPE> msg_type{};
+        std::array<char, MaxBody> body{};
+    };
+
+    using Queue = memory::MPSCQueue<Slot, Capacity>;
+
+    SendQueue() : queue_{std::make_unique<Queue>()} {}
+
+    // ========================================================================
+    // Producer Interface (any thread)
+    // ========================================================================
+
+    /// Serialize a body straight into the next slot
+    /// @param write Called with a BodyWriter over the slot
+    /// @return false if the queue is full, msg_type is invalid or the body
+    ///         overflowed (that slot is then skipped by drain())
+    template <typename Write>
+    [[nodiscard]] bool try_send(std::string_view msg_type, Write&& write) noexcept {
+        if (msg_type.empty() || msg_type.size() > MAX_MSG_TYPE) [[unlikely]] return false;
+        bool written = false;
+        const bool claimed = queue_->try_produce([&](Slot& slot) {
+            BodyWriter body{slot.body};
+            write(body);
+            set_type(slot, msg_type);
+            slot.overflow = body.overflow();
+            slot.body_len = static_cast<uint16_t>(body.size());
+            written = !slot.overflow;
+        });
+        return claimed && written;
+    }
+
+    /// Copy an already encoded body into the next slot
+    [[nodiscard]] bool try_send(std::string_view msg_type, std::string_view body) noexcept {
+        if (msg_type.empty() || msg_type.size() > MAX_MSG_TYPE ||
+            body.size() > MaxBody) [[unlikely]] {
+            return false;
+        }
+        return queue_->try_produce([&](Slot& slot) {
+            set_type(slot, msg_type);
+            slot.overflow = false;
+            slot.body_len = static_cast<uint16_t>(body.size());
+            std::memcpy(slot.body.data(), body.data(), body.size());
+        });
+    }
+
+    // ========================================================================
+    // Consumer Interface (session thread only)
+    // ========================================================================
+
+    /// Send queued bodies in claim order
+    /// @param session SessionManager or BasicSessionManager<Handler>
+    /// @return Slots consumed (sent, failed or dropped)
+    template <typename Session>
+    size_t drain(Session& session, size_t max_messages = Capacity) noexcept {
+        size_t consumed = 0;
+        const std::string_view begin_string = session.begin_string();
+        while (consumed < max_messages && queue_->try_consume([&](Slot& slot) {
+            if (slot.overflow) [[unlikely]] {
+                ++stats_.dropped;
+                return;
+            }
+            RawBodyBuilder builder{begin_string,
+                                   {slot.msg_type.data(), slot.msg_type_len},
+                                   {slot.body.data(), slot.body_len}};
+            if (session.send_app_message(builder)) {
+                ++stats_.sent;
+            } else {
+                ++stats_.failed;
+            }
+        })) {
+            ++consumed;
+        }
+        return consumed;
+    }
+
+    /// Approximate number of queued bodies
+    [[nodiscard]] size_t size_approx() const noexcept { return queue_->size_approx(); }
+    [[nodiscard]] bool empty() const noexcept { return queue_->empty(); }
+
+    /// Read on the draining thread
+    [[nodiscard]] const SendQueueStats& stats() const noexcept { return stats_; }
+
+private:
+    static void set_type(Slot& slot, std::string_view msg_type) noexcept {
+        slot.msg_type_len = static_cast<uint8_t>(msg_type.size());
+        std::memcpy(slot.msg_type.data(), msg_type.data(), msg_type.size());
+    }
+
+    std::unique_ptr<Queue> queue_;
+    SendQueueStats stats_;
+};
+
+} // namespace nfx
@@ -6,6 +6,7 @@
 
 #include "nexusfix/types/field_types.hpp"
 #include "nexusfix/types/error.hpp"
+#include "nexusfix/store/sequence_checkpoint.hpp"
 
 namespace nfx {
 
@@ -39,6 +40,7 @@ public:
         uint32_t seq = next_outbound_.load(std::memory_order_relaxed);
         uint32_t next = (seq >= MAX_SEQ_NUM) ? INITIAL_SEQ_NUM : seq + 1;
         next_outbound_.store(next, std::memory_order_relaxed);
+        if (checkpoint_) checkpoint_->record_outbound(next);
         return seq;
     }
 
@@ -50,6 +52,7 @@ public:
     /// Set next outbound sequence number (for reset)
     void set_outbound(uint32_t seq) noexcept {
         next_outbound_.store(seq, std::memory_order_relaxed);
+        if (checkpoint_) checkpoint_->record_outbound(seq);
     }
 
     // ========================================================================
@@ -64,6 +67,7 @@ public:
         if (received == expected) {
             // Normal case - sequence matches
             expected_inbound_.store(expected + 1, std::memory_order_relaxed);
+            if (checkpoint_) checkpoint_->record_inbound(expected + 1);
             return SequenceResult::Ok;
         }
 
@@ -85,6 +89,7 @@ public:
     /// Set expected inbound sequence number (for reset or gap fill)
     void set_inbound(uint32_t seq) noexcept {
         expected_inbound_.store(seq, std::memory_order_relaxed);
+        if (checkpoint_) checkpoint_->record_inbound(seq);
     }
 
     // ========================================================================
@@ -95,6 +100,34 @@ public:
     void reset() noexcept {
         next_outbound_.store(INITIAL_SEQ_NUM, std::memory_order_relaxed);
         expected_inbound_.store(INITIAL_SEQ_NUM, std::memory_order_relaxed);
+        if (checkpoint_) {
+            checkpoint_->record_outbound(INITIAL_SEQ_NUM);
+            checkpoint_->record_inbound(INITIAL_SEQ_NUM);
+        }
+    }
+
+    // ========================================================================
+    // Persistence
+    // ========================================================================
+
+    /// Mirror every sequence change into a checkpoint record (nullptr detaches).
+    /// A valid record from a previous run restores both sequence numbers;
+    /// a fresh one is seeded with the current values.
+    /// @param checkpoint Record to update (ownership NOT transferred)
+    void attach_checkpoint(store::SequenceCheckpoint* checkpoint) noexcept {
+        checkpoint_ = checkpoint;
+        if (!checkpoint_) return;
+        if (checkpoint_->valid()) {
+            next_outbound_.store(checkpoint_->outbound(), std::memory_order_relaxed);
+            expected_inbound_.store(checkpoint_->inbound(), std::memory_order_relaxed);
+        } else {
+            checkpoint_->initialize(current_outbound(), expected_inbound());
+        }
+    }
+
+    /// Attached checkpoint record (may be nullptr)
+    [[nodiscard]] store::SequenceCheckpoint* checkpoint() const noexcept {
+        return checkpoint_;
     }
 
     /// Check if sequence gap exists
@@ -114,6 +147,7 @@ public:
 private:
     std::atomic<uint32_t> next_outbound_;
     std::atomic<uint32_t> expected_inbound_;
+    store::SequenceCheckpoint* checkpoint_{nullptr};
 };
 
 // ============================================================================
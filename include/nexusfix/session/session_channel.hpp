@@ -0,0 +1,188 @@
+/*
+    NexusFIX Coroutine Session Channel
+
+    Drives a session over an AsyncByteStream (transport/async_io.hpp) with
+    coroutines: logon, the steady-state receive loop (which answers
+    TestRequests and serves ResendRequests) and logout are each one Task
+    that suspends on I/O and is resumed from completion processing. One
+    thread can run many sessions; each costs its coroutine frames and its
+    channel buffers, and no allocation happens per await.
+
+    Usage:
+        SessionManager session{config};
+        IoUringSocket socket{ctx};
+        SessionChannel channel{session, socket};
+
+        SessionCallbacks callbacks;
+        callbacks.on_send = [&](std::span<const char> data) { return channel.stage(data); };
+        callbacks.on_app_message = ...;
+        session.set_callbacks(std::move(callbacks));
+
+        Task<void> trade(SessionChannel<SessionManager, IoUringSocket>& ch) {
+            auto logged_on = co_await ch.logon();
+            if (!logged_on) co_return;
+            co_await ch.run();                     // Until disconnect or logout
+        }
+
+        auto task = trade(channel);
+        task.resume();
+        while (!task.done()) ctx.dispatch_completions(1);
+
+    The session stays synchronous: on_send() only stages bytes, and the
+    channel writes them after each call into the session. Outbound
+    messages sent from outside a flow (send_new_order() from a strategy
+    on the same thread) go out with the next flush().
+
+    Bind an awaited Task's result to a local before testing it: GCC 12
+    miscompiles co_await of a temporary Task inside an if condition.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/session/coroutine.hpp"
+#include "nexusfix/session/state.hpp"
+#include "nexusfix/transport/async_io.hpp"
+#include "nexusfix/types/error.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Session Channel
+// ============================================================================
+
+/// Coroutine flows for one session over one stream
+/// @tparam Session SessionManager or BasicSessionManager<Handler>
+/// @tparam RxCapacity Receive buffer (one recv at a time)
+/// @tparam TxCapacity Each of the two staging buffers
+template <typename Session, AsyncByteStream Stream,
+          size_t RxCapacity = 16 * 1024, size_t TxCapacity = 16 * 1024>
+class SessionChannel {
+public:
+    SessionChannel(Session& session, Stream& stream) noexcept
+        : session_{session}, stream_{stream} {}
+
+    SessionChannel(const SessionChannel&) = delete;
+    SessionChannel& operator=(const SessionChannel&) = delete;
+
+    /// Session sender (on_send): copy bytes for the next flush()
+    /// @return false if the staging buffer is full
+    [[nodiscard]] bool stage(std::span<const char> data) noexcept {
+        if (data.size() > TxCapacity - staged_len_) [[unlikely]] return false;
+        std::memcpy(tx_[staging_].data() + staged_len_, data.data(), data.size());
+        staged_len_ += data.size();
+        return true;
+    }
+
+    /// Write everything staged, including bytes staged while a write is in
+    /// flight. A flush already in progress picks up new bytes itself.
+    /// @return false if the stream failed (the session is disconnected)
+    Task<bool> flush() {
+        if (flushing_) co_return true;
+        flushing_ = true;
+        while (staged_len_ > 0) {
+            // Swap buffers so the session can stage during the write
+            const char* data = tx_[staging_].data();
+            const size_t len = staged_len_;
+            staging_ ^= 1;
+            staged_len_ = 0;
+
+            for (size_t written = 0; written < len;) {
+                const int n = co_await stream_.async_send({data + written, len - written});
+                if (n <= 0) {
+                    flushing_ = false;
+                    fail();
+                    co_return false;
+                }
+                written += static_cast<size_t>(n);
+            }
+        }
+        flushing_ = false;
+        co_return true;
+    }
+
+    /// Receive once, feed the session, and write its replies
+    /// @return false on EOF or stream error (the session is disconnected)
+    Task<bool> pump() {
+        const int n = co_await stream_.async_recv(rx_);
+        if (n <= 0) {
+            fail();
+            co_return false;
+        }
+        ++receives_;
+        session_.on_bytes({rx_.data(), static_cast<size_t>(n)});
+        co_return co_await flush();
+    }
+
+    /// Connected stream -> Active session
+    Task<SessionResult<void>> logon() {
+        session_.on_connect();
+        if (auto sent = session_.initiate_logon(); !sent) co_return sent;
+        const bool flushed = co_await flush();
+        if (!flushed) {
+            co_return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+        }
+        while (session_.state() == SessionState::LogonSent) {
+            const bool received = co_await pump();
+            if (!received) {
+                co_return std::unexpected{SessionError{SessionErrorCode::Disconnected}};
+            }
+        }
+        if (session_.state() != SessionState::Active) {
+            co_return std::unexpected{SessionError{SessionErrorCode::LogonRejected}};
+        }
+        co_return SessionResult<void>{};
+    }
+
+    /// Send Logout and wait for the counterparty's
+    Task<SessionResult<void>> logout(std::string_view text = "") {
+        if (auto sent = session_.initiate_logout(text); !sent) co_return sent;
+        const bool flushed = co_await flush();
+        if (!flushed) {
+            co_return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+        }
+        while (session_.state() == SessionState::LogoutPending) {
+            const bool received = co_await pump();
+            if (!received) {
+                co_return std::unexpected{SessionError{SessionErrorCode::Disconnected}};
+            }
+        }
+        co_return SessionResult<void>{};
+    }
+
+    /// Steady state: receive and answer until the session leaves Active
+    /// (resends, heartbeats and test requests are answered by the session
+    /// and written by pump())
+    Task<void> run() {
+        while (session_.state() == SessionState::Active) {
+            const bool received = co_await pump();
+            if (!received) co_return;
+        }
+        (void)co_await flush();  // e.g. our Logout reply
+    }
+
+    [[nodiscard]] size_t staged_bytes() const noexcept { return staged_len_; }
+    [[nodiscard]] uint64_t receives() const noexcept { return receives_; }
+
+private:
+    void fail() noexcept {
+        staged_len_ = 0;
+        if (session_.state() != SessionState::Disconnected) session_.on_disconnect();
+    }
+
+    Session& session_;
+    Stream& stream_;
+    std::array<char, RxCapacity> rx_;
+    std::array<std::array<char, TxCapacity>, 2> tx_;
+    size_t staging_{0};
+    size_t staged_len_{0};
+    bool flushing_{false};
+    uint64_t receives_{0};
+};
+
+} // namespace nfx
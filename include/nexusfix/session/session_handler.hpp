@@ -6,7 +6,7 @@
 
     Usage:
         struct MyHandler {
-            void on_app_message(const ParsedMessage& msg) noexcept { ... }
+            void on_app_message(const IndexedParser& msg) noexcept { ... }
             void on_state_change(SessionState from, SessionState to) noexcept { ... }
             bool on_send(std::span<const char> data) noexcept { ... }
             void on_error(const SessionError& err) noexcept { ... }
@@ -14,7 +14,31 @@
             void on_logout(std::string_view reason) noexcept { ... }
         };
 
-        SessionManager<MyHandler> session{config, handler};
+        BasicSessionManager<MyHandler> session{config, MyHandler{...}};
+        BasicSessionManager<MyHandler&> borrowed{config, handler};  // Not owned
+
+    Optional members, used when present:
+        void on_app_message(const IndexedParser&, const RxTimestamp&) noexcept;
+        void on_app_message(const IndexedParser&, const RxTimestamp&,
+                            std::pmr::memory_resource& scratch) noexcept;
+                                          // Per-message monotonic buffer,
+                                          // reset after the call returns
+                                          // (message_scratch())
+        void on_shadow_send(std::span<const char> data) noexcept;
+        void on_audit(AuditDirection, uint32_t seq_num,
+                      std::span<const char> msg) noexcept;
+                                          // Every parsed inbound / stored
+                                          // outbound message (audit_tap.hpp)
+        bool can_send() const noexcept;   // false: sends fail before storing
+        SessionResult<void> check_order(const Builder&) noexcept;
+                                          // Veto before sending, e.g. a
+                                          // PreTradeRisk (risk_check.hpp)
+        using msg_routes = MsgRoutes<...>;  // Typed per-MsgType members
+                                            // (msg_dispatch.hpp); the rest
+                                            // go to on_app_message
+
+    SessionManager is BasicSessionManager<CallbackSessionHandler>, the
+    std::function-based SessionCallbacks adapter.
 */
 
 #pragma once
@@ -29,7 +53,7 @@
 namespace nfx {
 
 // Forward declaration
-class ParsedMessage;
+class IndexedParser;
 
 // ============================================================================
 // Session Handler Concepts
@@ -37,7 +61,7 @@ class ParsedMessage;
 
 /// Concept for application message callback
 template <typename T>
-concept HasOnAppMessage = requires(T& handler, const ParsedMessage& msg) {
+concept HasOnAppMessage = requires(T& handler, const IndexedParser& msg) {
     { handler.on_app_message(msg) } noexcept;
 };
 
@@ -86,7 +110,7 @@ concept SessionHandler = HasOnAppMessage<T> &&
 
 /// No-op handler for testing or minimal sessions
 struct NullSessionHandler {
-    void on_app_message(const ParsedMessage&) noexcept {}
+    void on_app_message(const IndexedParser&) noexcept {}
     void on_state_change(SessionState, SessionState) noexcept {}
     bool on_send(std::span<const char>) noexcept { return true; }
     void on_error(const SessionError&) noexcept {}
@@ -103,7 +127,7 @@ static_assert(SessionHandler<NullSessionHandler>, "NullSessionHandler must satis
 /// Handler using raw function pointers with user data
 /// Lower overhead than std::function, suitable for C-style callbacks
 struct FunctionPtrHandler {
-    using AppMessageFn = void(*)(void* ctx, const ParsedMessage&) noexcept;
+    using AppMessageFn = void(*)(void* ctx, const IndexedParser&) noexcept;
     using StateChangeFn = void(*)(void* ctx, SessionState, SessionState) noexcept;
     using SendFn = bool(*)(void* ctx, std::span<const char>) noexcept;
     using ErrorFn = void(*)(void* ctx, const SessionError&) noexcept;
@@ -118,7 +142,7 @@ struct FunctionPtrHandler {
     LogonFn logon_fn{nullptr};
     LogoutFn logout_fn{nullptr};
 
-    void on_app_message(const ParsedMessage& msg) noexcept {
+    void on_app_message(const IndexedParser& msg) noexcept {
         if (app_message_fn) [[likely]] app_message_fn(context, msg);
     }
 
@@ -0,0 +1,271 @@
+/*
+    NexusFIX Session Index
+
+    Minimal perfect hash from a session's (SenderCompID, TargetCompID,
+    BeginString) to its index, built once at startup over the configured
+    counterparties (hash and displace). Resolving the session of an
+    inbound message is:
+    - one 64-bit hash over the three byte ranges (8 bytes per step),
+      straight from the parser's header views of tags 49/56/8
+    - one displacement load and one slot load
+    - one hash compare and, only if it matches, one key compare
+
+    An unknown counterparty is rejected by the same single compare; no
+    probing, no chains. The table has exactly one slot per session.
+
+    Usage:
+        SessionIndex index;
+        index.add(SessionId{"EXCH", "CLIENT1", "FIX.4.4"}, 0);
+        index.add(SessionId{"EXCH", "CLIENT2", "FIX.4.4"}, 1);
+        if (!index.build()) { ... }          // Duplicate SessionId
+
+        // Per message: its SenderCompID is our TargetCompID
+        uint32_t session = index.route(parser);   // SessionIndex::NONE if unknown
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/session/state.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Session Index
+// ============================================================================
+
+/// Build-once minimal perfect hash over configured SessionIds
+class SessionIndex {
+public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    /// Register a session by its own ids before build() (strings are copied)
+    void add(const SessionId& id, uint32_t value) {
+        Key key;
+        key.offset = static_cast<uint32_t>(arena_.size());
+        key.sender_len = static_cast<uint16_t>(id.sender_comp_id.size());
+        key.target_len = static_cast<uint16_t>(id.target_comp_id.size());
+        key.begin_len = static_cast<uint16_t>(id.begin_string.size());
+        key.value = value;
+        arena_.append(id.sender_comp_id).append(id.target_comp_id).append(id.begin_string);
+        pending_.push_back(key);
+        built_ = false;
+    }
+
+    /// Lay out the table; lookups are valid once this returns true
+    /// @return false if two sessions share a SessionId
+    [[nodiscard]] bool build() {
+        const size_t n = pending_.size();
+        slots_.assign(n, Key{});
+        buckets_ = 1;
+        while (buckets_ * 2 < n) buckets_ <<= 1;  // ~2 keys per bucket
+        displacements_.assign(buckets_, 0);
+
+        // A 64-bit collision between distinct keys only needs a new seed
+        for (seed_ = 0; seed_ < MAX_SEEDS; ++seed_) {
+            for (auto& key : pending_) key.hash = hash(field(key, 0), field(key, 1), field(key, 2));
+            if (has_duplicate()) return false;
+            if (place()) {
+                built_ = true;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Index of the session with this id, NONE if unknown
+    [[nodiscard]] NFX_HOT uint32_t find(const SessionId& id) const noexcept {
+        return lookup(id.sender_comp_id, id.target_comp_id, id.begin_string);
+    }
+
+    /// Index of the session an inbound message belongs to, from its own
+    /// SenderCompID (49), TargetCompID (56) and BeginString (8)
+    [[nodiscard]] NFX_HOT uint32_t find_inbound(std::string_view sender_comp_id,
+                                                std::string_view target_comp_id,
+                                                std::string_view begin_string) const noexcept {
+        return lookup(target_comp_id, sender_comp_id, begin_string);
+    }
+
+    /// find_inbound() from a parsed message's header views
+    template <typename Message>
+    [[nodiscard]] NFX_HOT uint32_t route(const Message& msg) const noexcept {
+        return find_inbound(msg.sender_comp_id(), msg.target_comp_id(), msg.begin_string());
+    }
+
+    /// Request the displacement find_inbound() will read first; the key
+    /// slot depends on it, so only this line can be fetched ahead
+    NFX_HOT void prefetch_inbound(std::string_view sender_comp_id,
+                                  std::string_view target_comp_id,
+                                  std::string_view begin_string) const noexcept {
+        if (!built_ || slots_.empty()) [[unlikely]] return;
+        const uint64_t h = hash(target_comp_id, sender_comp_id, begin_string);
+        __builtin_prefetch(&displacements_[bucket_of(h)], 0, 3);
+    }
+
+    /// prefetch_inbound() from a parsed message's header views
+    template <typename Message>
+    NFX_HOT void prefetch_route(const Message& msg) const noexcept {
+        prefetch_inbound(msg.sender_comp_id(), msg.target_comp_id(), msg.begin_string());
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return pending_.size(); }
+    [[nodiscard]] bool built() const noexcept { return built_; }
+
+private:
+    static constexpr uint64_t MAX_SEEDS = 8;
+    static constexpr uint32_t MAX_DISPLACEMENT = 1u << 20;
+
+    struct Key {
+        uint64_t hash{0};
+        uint32_t offset{0};      // Into arena_: sender, target, begin string
+        uint16_t sender_len{0};
+        uint16_t target_len{0};
+        uint16_t begin_len{0};
+        uint32_t value{NONE};
+    };
+
+    static constexpr uint64_t M = 0xd6e8feb86659fd93ULL;
+
+    [[nodiscard]] static constexpr uint64_t mix(uint64_t x) noexcept {
+        x ^= x >> 32;
+        x *= M;
+        x ^= x >> 32;
+        x *= M;
+        x ^= x >> 32;
+        return x;
+    }
+
+    [[nodiscard]] static uint64_t hash_field(std::string_view s, uint64_t h) noexcept {
+        const char* p = s.data();
+        size_t len = s.size();
+        for (; len >= 8; p += 8, len -= 8) {
+            uint64_t word;
+            std::memcpy(&word, p, 8);
+            h = mix(h ^ word);
+        }
+        uint64_t tail = 0;
+        if (len != 0) std::memcpy(&tail, p, len);
+        // Length in the top byte: ("AB", "C") and ("A", "BC") differ
+        return mix(h ^ tail ^ (static_cast<uint64_t>(s.size()) << 56));
+    }
+
+    [[nodiscard]] uint64_t hash(std::string_view sender, std::string_view target,
+                                std::string_view begin) const noexcept {
+        return hash_field(begin, hash_field(target, hash_field(sender, seed_ * M + 1)));
+    }
+
+    [[nodiscard]] size_t bucket_of(uint64_t h) const noexcept {
+        return static_cast<size_t>(h >> 32) & (buckets_ - 1);
+    }
+
+    [[nodiscard]] size_t slot_of(uint64_t h, uint32_t displacement) const noexcept {
+        const uint64_t x = mix(h + displacement * 0x9E3779B97F4A7C15ULL) >> 32;
+        return static_cast<size_t>((x * slots_.size()) >> 32);
+    }
+
+    [[nodiscard]] std::string_view field(const Key& key, int which) const noexcept {
+        const char* base = arena_.data() + key.offset;
+        switch (which) {
+            case 0: return {base, key.sender_len};
+            case 1: return {base + key.sender_len, key.target_len};
+            default: return {base + key.sender_len + key.target_len, key.begin_len};
+        }
+    }
+
+    [[nodiscard]] NFX_HOT uint32_t lookup(std::string_view sender, std::string_view target,
+                                          std::string_view begin) const noexcept {
+        if (!built_ || slots_.empty()) [[unlikely]] return NONE;
+        const uint64_t h = hash(sender, target, begin);
+        const Key& key = slots_[slot_of(h, displacements_[bucket_of(h)])];
+        if (key.hash != h || key.sender_len != sender.size() ||
+            key.target_len != target.size() || key.begin_len != begin.size()) {
+            return NONE;
+        }
+        // The one string compare: the three fields are contiguous in arena_
+        const char* stored = arena_.data() + key.offset;
+        if (std::memcmp(stored, sender.data(), sender.size()) != 0 ||
+            std::memcmp(stored + sender.size(), target.data(), target.size()) != 0 ||
+            std::memcmp(stored + sender.size() + target.size(), begin.data(), begin.size()) != 0) {
+            return NONE;
+        }
+        return key.value;
+    }
+
+    [[nodiscard]] bool has_duplicate() const {
+        std::vector<const Key*> sorted;
+        sorted.reserve(pending_.size());
+        for (const auto& key : pending_) sorted.push_back(&key);
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const Key* a, const Key* b) { return a->hash < b->hash; });
+        for (size_t i = 1; i < sorted.size(); ++i) {
+            if (sorted[i]->hash == sorted[i - 1]->hash &&
+                field(*sorted[i], 0) == field(*sorted[i - 1], 0) &&
+                field(*sorted[i], 1) == field(*sorted[i - 1], 1) &&
+                field(*sorted[i], 2) == field(*sorted[i - 1], 2)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Hash and displace: largest buckets first, each takes the first
+    /// displacement that puts all its keys in distinct free slots
+    [[nodiscard]] bool place() {
+        std::vector<std::vector<const Key*>> buckets(buckets_);
+        for (const auto& key : pending_) buckets[bucket_of(key.hash)].push_back(&key);
+
+        std::vector<uint32_t> order(buckets_);
+        for (uint32_t b = 0; b < buckets_; ++b) order[b] = b;
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        std::vector<bool> taken(slots_.size(), false);
+        std::vector<size_t> chosen;
+        for (uint32_t b : order) {
+            const auto& keys = buckets[b];
+            if (keys.empty()) break;
+
+            bool placed = false;
+            for (uint32_t d = 0; d < MAX_DISPLACEMENT && !placed; ++d) {
+                chosen.clear();
+                placed = true;
+                for (const Key* key : keys) {
+                    const size_t slot = slot_of(key->hash, d);
+                    if (taken[slot] ||
+                        std::find(chosen.begin(), chosen.end(), slot) != chosen.end()) {
+                        placed = false;
+                        break;
+                    }
+                    chosen.push_back(slot);
+                }
+                if (placed) {
+                    displacements_[b] = d;
+                    for (size_t i = 0; i < keys.size(); ++i) {
+                        taken[chosen[i]] = true;
+                        slots_[chosen[i]] = *keys[i];
+                    }
+                }
+            }
+            if (!placed) return false;
+        }
+        return true;
+    }
+
+    std::string arena_;                    // Key bytes
+    std::vector<Key> pending_;             // In add() order
+    std::vector<Key> slots_;               // One per session, in hash order
+    std::vector<uint32_t> displacements_;  // Per bucket
+    size_t buckets_{1};
+    uint64_t seed_{0};
+    bool built_{false};
+};
+
+} // namespace nfx
@@ -1,8 +1,18 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <concepts>
+#include <cstring>
 #include <functional>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <span>
+#include <type_traits>
+#include <variant>
 
 #include "nexusfix/types/tag.hpp"
 #include "nexusfix/types/error.hpp"
@@ -10,14 +20,28 @@
 #include "nexusfix/parser/runtime_parser.hpp"
 #include "nexusfix/messages/common/header.hpp"
 #include "nexusfix/messages/common/trailer.hpp"
-#include "nexusfix/messages/fix44/logon.hpp"
-#include "nexusfix/messages/fix44/heartbeat.hpp"
+#include "nexusfix/memory/buffer_pool.hpp"
+#include "nexusfix/memory/mimalloc_resource.hpp"
+#include "nexusfix/messages/fix44/new_order_template.hpp"
+#include "nexusfix/session/audit_tap.hpp"
+#include "nexusfix/session/msg_dispatch.hpp"
+#include "nexusfix/session/session_handler.hpp"
+#include "nexusfix/session/session_version.hpp"
 #include "nexusfix/session/state.hpp"
 #include "nexusfix/session/sequence.hpp"
 #include "nexusfix/session/coroutine.hpp"
+#include "nexusfix/session/reorder_buffer.hpp"
+#include "nexusfix/session/resend.hpp"
+#include "nexusfix/session/throttle.hpp"
 #include "nexusfix/util/fast_timestamp.hpp"
+#include "nexusfix/util/icache_warmer.hpp"
+#include "nexusfix/util/event_trace.hpp"
+#include "nexusfix/util/latency_histogram.hpp"
+#include "nexusfix/util/perf_counters.hpp"
 #include "nexusfix/util/rdtsc_timestamp.hpp"
 #include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/transport/rx_timestamp.hpp"
 
 namespace nfx {
 
@@ -25,10 +49,52 @@ namespace nfx {
 // Session Callbacks
 // ============================================================================
 
+/// Application message callback.
+/// Accepts handlers taking (const IndexedParser&, const RxTimestamp&) or just
+/// (const IndexedParser&); the timestamp is that of the receive that carried
+/// the message (invalid when the transport does not timestamp).
+class AppMessageCallback {
+public:
+    using Function = std::function<void(const IndexedParser&, const RxTimestamp&)>;
+
+    AppMessageCallback() noexcept = default;
+    AppMessageCallback(std::nullptr_t) noexcept {}
+
+    template<typename F>
+        requires (!std::same_as<std::remove_cvref_t<F>, AppMessageCallback> &&
+                  std::invocable<F&, const IndexedParser&, const RxTimestamp&>)
+    AppMessageCallback(F&& f)
+        : fn_{std::forward<F>(f)} {}
+
+    template<typename F>
+        requires (!std::same_as<std::remove_cvref_t<F>, AppMessageCallback> &&
+                  !std::invocable<F&, const IndexedParser&, const RxTimestamp&> &&
+                  std::invocable<F&, const IndexedParser&>)
+    AppMessageCallback(F&& f) {
+        if constexpr (std::is_constructible_v<bool, const std::remove_cvref_t<F>&>) {
+            if (!static_cast<bool>(f)) return;  // Empty std::function / null pointer
+        }
+        fn_ = [g = std::forward<F>(f)](const IndexedParser& msg, const RxTimestamp&) mutable {
+            g(msg);
+        };
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return static_cast<bool>(fn_);
+    }
+
+    void operator()(const IndexedParser& msg, const RxTimestamp& rx_ts = {}) const {
+        fn_(msg, rx_ts);
+    }
+
+private:
+    Function fn_;
+};
+
 /// Callback interface for session events
 struct SessionCallbacks {
     /// Called when an application message is received
-    std::function<void(const ParsedMessage&)> on_app_message;
+    AppMessageCallback on_app_message;
 
     /// Called when session state changes
     std::function<void(SessionState, SessionState)> on_state_change;
@@ -44,8 +110,66 @@ struct SessionCallbacks {
 
     /// Called when logout is complete
     std::function<void(std::string_view)> on_logout;
+
+    /// Receives shadow_send() output, e.g. a transport's discard path;
+    /// must not put it on the wire (unset = dropped)
+    std::function<void(std::span<const char>)> on_shadow_send;
+
+    /// Every parsed inbound and stored outbound message (see AuditTap);
+    /// the bytes are only valid for the call
+    std::function<void(AuditDirection, uint32_t, std::span<const char>)> on_audit;
 };
 
+/// SessionHandler over SessionCallbacks (std::function per event); the
+/// handler behind SessionManager. Unset callbacks are skipped.
+struct CallbackSessionHandler {
+    SessionCallbacks callbacks;
+
+    void on_app_message(const IndexedParser& msg, const RxTimestamp& rx_ts) noexcept {
+        if (callbacks.on_app_message) callbacks.on_app_message(msg, rx_ts);
+    }
+
+    void on_app_message(const IndexedParser& msg) noexcept {
+        on_app_message(msg, RxTimestamp{});
+    }
+
+    void on_state_change(SessionState from, SessionState to) noexcept {
+        if (callbacks.on_state_change) callbacks.on_state_change(from, to);
+    }
+
+    bool on_send(std::span<const char> data) noexcept {
+        return callbacks.on_send && callbacks.on_send(data);
+    }
+
+    void on_error(const SessionError& err) noexcept {
+        if (callbacks.on_error) callbacks.on_error(err);
+    }
+
+    void on_logon() noexcept {
+        if (callbacks.on_logon) callbacks.on_logon();
+    }
+
+    void on_logout(std::string_view reason) noexcept {
+        if (callbacks.on_logout) callbacks.on_logout(reason);
+    }
+
+    void on_shadow_send(std::span<const char> data) noexcept {
+        if (callbacks.on_shadow_send) callbacks.on_shadow_send(data);
+    }
+
+    void on_audit(AuditDirection direction, uint32_t seq_num,
+                  std::span<const char> msg) noexcept {
+        if (callbacks.on_audit) callbacks.on_audit(direction, seq_num, msg);
+    }
+
+    [[nodiscard]] bool can_send() const noexcept {
+        return static_cast<bool>(callbacks.on_send);
+    }
+};
+
+static_assert(SessionHandler<CallbackSessionHandler>,
+              "CallbackSessionHandler must satisfy SessionHandler concept");
+
 // ============================================================================
 // Heartbeat Timer
 // ============================================================================
@@ -97,6 +221,14 @@ public:
         return elapsed >= interval_ * 2;
     }
 
+    /// Earliest of the heartbeat, test request and timeout deadlines
+    [[nodiscard]] TimePoint next_deadline() const noexcept {
+        const TimePoint heartbeat = last_sent_ + interval_;
+        const TimePoint silence = last_received_ + (test_request_pending_
+            ? interval_ * 2 : interval_ + Duration{interval_.count() / 2});
+        return std::min(heartbeat, silence);
+    }
+
     /// Mark that a test request was sent
     void test_request_sent() noexcept {
         test_request_pending_ = true;
@@ -131,28 +263,69 @@ private:
 // Session Manager
 // ============================================================================
 
-/// Manages FIX session lifecycle and message handling
-class SessionManager {
+/// Manages FIX session lifecycle and message handling.
+/// Events go straight to Handler (see session_handler.hpp), so its
+/// callbacks inline into the session: on_send into the transport write,
+/// on_app_message into the strategy. Handler may be a reference type to
+/// dispatch into an object owned elsewhere. Version selects the admin
+/// message set and BeginString at compile time (session_version.hpp).
+/// SessionManager is the std::function-based FIX 4.4 instantiation.
+template <typename Handler, typename Version = Fix44Session>
+    requires SessionHandler<std::remove_reference_t<Handler>>
+class BasicSessionManager {
 public:
-    explicit SessionManager(const SessionConfig& config) noexcept
-        : config_{config}
+    using handler_type = Handler;
+    using version_type = Version;
+
+    /// Coalescing buffer for begin_batch()/flush(); ~200 NewOrderSingles
+    static constexpr size_t OUTBOUND_BATCH_CAPACITY = 32 * 1024;
+
+    /// Largest message on_bytes() reassembles across chunks
+    static constexpr size_t REASSEMBLY_CAPACITY = fix::MAX_MESSAGE_SIZE;
+
+    /// Inline bytes of message_scratch() before it falls back to the resource
+    static constexpr size_t MESSAGE_SCRATCH_SIZE = 4096;
+
+    explicit BasicSessionManager(const SessionConfig& config) noexcept
+        requires std::default_initializable<Handler>
+        : BasicSessionManager{config, Handler{}} {}
+
+    BasicSessionManager(const SessionConfig& config, Handler handler) noexcept
+        : heap_{make_session_heap(config)}
+        , resource_{config.buffer_resource ? config.buffer_resource : heap_resource(heap_)}
+        , config_{config}
         , state_{SessionState::Disconnected}
         , heartbeat_timer_{config.heart_bt_int}
         , assembler_{}
         , sequences_{}
-        , stats_{} {}
+        , stats_{}
+        , timestamp_generator_{make_timestamp_generator(config.sending_time_precision)}
+        , handler_{std::forward<Handler>(handler)}
+        , app_throttle_{config.max_app_messages_per_sec, config.app_message_burst,
+                        util::RdtscClock::frequency_ghz()}
+    {
+        assembler_.seq_num_width(config.seq_num_width);
+    }
 
     // Non-copyable, non-movable
-    SessionManager(const SessionManager&) = delete;
-    SessionManager& operator=(const SessionManager&) = delete;
+    BasicSessionManager(const BasicSessionManager&) = delete;
+    BasicSessionManager& operator=(const BasicSessionManager&) = delete;
 
     // ========================================================================
     // Session Control
     // ========================================================================
 
     /// Set callbacks
-    void set_callbacks(SessionCallbacks callbacks) noexcept {
-        callbacks_ = std::move(callbacks);
+    void set_callbacks(SessionCallbacks callbacks) noexcept
+        requires std::same_as<Handler, CallbackSessionHandler>
+    {
+        handler_.callbacks = std::move(callbacks);
+    }
+
+    /// Handler receiving session events
+    [[nodiscard]] std::remove_reference_t<Handler>& handler() noexcept { return handler_; }
+    [[nodiscard]] const std::remove_reference_t<Handler>& handler() const noexcept {
+        return handler_;
     }
 
     /// Set message store for resend support
@@ -166,6 +339,51 @@ public:
         return message_store_;
     }
 
+    /// Create a MemoryMessageStore owned by this session, backed by its
+    /// memory resource, and make it the message store
+    /// @return The store, valid for the session's lifetime
+    store::MemoryMessageStore& own_message_store(store::MemoryMessageStore::Config store_config) {
+        store_config.upstream_resource = resource_;
+        if (message_store_ == owned_store_.get()) message_store_ = nullptr;
+        owned_store_.reset();
+        void* mem = resource_->allocate(sizeof(store::MemoryMessageStore),
+                                        alignof(store::MemoryMessageStore));
+        try {
+            owned_store_ = ResourcePtr<store::MemoryMessageStore>{
+                ::new (mem) store::MemoryMessageStore{std::move(store_config)}, {resource_}};
+        } catch (...) {
+            resource_->deallocate(mem, sizeof(store::MemoryMessageStore),
+                                  alignof(store::MemoryMessageStore));
+            throw;
+        }
+        message_store_ = owned_store_.get();
+        return *owned_store_;
+    }
+
+    /// Memory resource backing the session's allocations:
+    /// SessionConfig::buffer_resource if set, else its SessionHeap when
+    /// SessionConfig::session_heap_size is set (and mimalloc is
+    /// available), else the global heap
+    [[nodiscard]] std::pmr::memory_resource* memory_resource() const noexcept {
+        return resource_;
+    }
+
+    /// Whether the session owns a SessionHeap
+    [[nodiscard]] bool has_session_heap() const noexcept {
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+        return heap_ != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    /// Persist sequence numbers in a checkpoint record, restoring any valid
+    /// state it holds from a previous run (call before connecting)
+    /// @param checkpoint Record to update (ownership NOT transferred)
+    void attach_sequence_checkpoint(store::SequenceCheckpoint* checkpoint) noexcept {
+        sequences_.attach_checkpoint(checkpoint);
+    }
+
     /// Called when TCP connection is established
     void on_connect() noexcept {
         transition(SessionEvent::Connect);
@@ -173,6 +391,18 @@ public:
 
     /// Called when TCP connection is lost
     void on_disconnect() noexcept {
+        // Unwritten batched messages are already stored; they are resent on request
+        batch_active_ = false;
+        batch_len_ = 0;
+        batch_count_ = 0;
+        partial_len_ = 0;
+        // Held messages are stored too
+        if (throttle_queue_) throttle_queue_->clear();
+        // The counterparty resends from the logon's seq num on reconnect
+        if (reorder_) reorder_->clear();
+        gap_requested_through_ = 0;
+        // The counterparty asks again after the next logon
+        resend_.reset();
         transition(SessionEvent::Disconnect);
     }
 
@@ -183,7 +413,7 @@ public:
         }
 
         // Build logon message
-        auto msg = fix44::Logon::Builder{}
+        auto msg = Version::logon()
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
@@ -197,6 +427,7 @@ public:
             return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
         }
 
+        logon_sent_at_ = HeartbeatTimer::Clock::now();
         transition(SessionEvent::LogonSent);
         return {};
     }
@@ -207,7 +438,7 @@ public:
             return std::unexpected{SessionError{SessionErrorCode::InvalidState}};
         }
 
-        auto msg = fix44::Logout::Builder{}
+        auto msg = typename Version::Logout::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
@@ -223,46 +454,64 @@ public:
         return {};
     }
 
-    /// Process incoming data
-    void on_data_received(std::span<const char> data) noexcept {
-        // Update heartbeat timer
-        heartbeat_timer_.message_received();
-        ++stats_.messages_received;
-        stats_.bytes_received += data.size();
+    /// Process incoming data (one complete message). The IndexedParser
+    /// passed to on_app_message is valid until the callback returns.
+    /// @param rx_ts Receive timestamp from the transport (ITransport::last_rx_timestamp()),
+    ///              forwarded to on_app_message
+    void on_data_received(std::span<const char> data, const RxTimestamp& rx_ts = {}) noexcept {
+        receive_message(data, rx_ts, nullptr);
+    }
 
-        // Parse message
-        auto result = ParsedMessage::parse(data);
-        if (!result.has_value()) {
-            handle_parse_error(result.error());
-            return;
+    /// Process a chunk of the inbound byte stream: any number of complete
+    /// messages, with partial ones at either end. Complete messages are
+    /// dispatched in place from `data` (e.g. straight out of a multishot
+    /// recv buffer, which may be recycled once this returns); only a
+    /// message straddling two chunks is copied, into a reassembly buffer
+    /// allocated on first use, and structurally indexed as its pieces
+    /// arrive so it is not rescanned once complete. Bytes that cannot be
+    /// framed are dropped (stats().bytes_discarded) and parsing resumes at
+    /// the next "8=F".
+    void on_bytes(std::span<const char> data, const RxTimestamp& rx_ts = {}) noexcept {
+        if (partial_len_ > 0) [[unlikely]] {
+            data = complete_partial(data, rx_ts);
         }
 
-        auto& msg = *result;
-
-        // Validate sequence number
-        auto seq_result = sequences_.validate_inbound(msg.msg_seq_num());
-        if (seq_result == SequenceManager::SequenceResult::GapDetected) {
-            handle_sequence_gap(msg.msg_seq_num());
-        } else if (seq_result == SequenceManager::SequenceResult::TooLow) {
-            // Possible duplicate, check PossDupFlag
-            if (!msg.header().poss_dup_flag) {
-                // Sequence too low and not marked as duplicate
-                handle_sequence_error(msg.msg_seq_num());
-                return;
-            }
+        size_t pos = 0;
+        while (pos < data.size()) [[likely]] {
+            const simd::MessageBoundary boundary = simd::find_message_boundary(data, pos);
+            if (!boundary.complete) break;
+            stats_.bytes_discarded += boundary.start - pos;
+            on_data_received(data.subspan(boundary.start, boundary.size()), rx_ts);
+            pos = boundary.end;
         }
 
-        // Route by message type
-        char msg_type = msg.msg_type();
-        if (msg_type::is_admin(msg_type)) {
-            handle_admin_message(msg);
-        } else {
-            handle_app_message(msg);
+        if (pos < data.size()) [[unlikely]] {
+            stash_partial(data.subspan(pos));
         }
     }
 
-    /// Periodic timer tick (call regularly, e.g., every 100ms)
+    /// Bytes of a straddling message held for the next on_bytes() call
+    [[nodiscard]] size_t pending_bytes() const noexcept { return partial_len_; }
+
+    /// Periodic timer tick (call regularly, e.g., every 100ms, or when
+    /// next_timer_due() says so). Also bounds the latency of a batch left
+    /// open: it is flushed here.
     void on_timer_tick() noexcept {
+        release_throttled();
+
+        if (batch_active_) {
+            (void)flush();
+        }
+
+        if (state_ == SessionState::LogonSent) [[unlikely]] {
+            if (config_.logon_timeout > 0 &&
+                HeartbeatTimer::Clock::now() - logon_sent_at_ >=
+                    std::chrono::seconds{config_.logon_timeout}) {
+                transition(SessionEvent::HeartbeatTimeout);
+            }
+            return;
+        }
+
         if (state_ != SessionState::Active) return;
 
         if (heartbeat_timer_.has_timed_out()) {
@@ -274,7 +523,62 @@ public:
             send_test_request();
         } else if (heartbeat_timer_.should_send_heartbeat()) {
             send_heartbeat();
+            if (config_.idle_compact_heartbeats > 0) note_idle_heartbeat();
+        }
+
+        if (resend_) {
+            continue_resend();
+        }
+
+        if (config_.shadow_send_interval_ms > 0) {
+            maybe_shadow_send();
+        }
+    }
+
+    /// Time until on_timer_tick() next has work: zero while messages are
+    /// held or batched or a resend is streaming, nanoseconds::max() when
+    /// no timer is running.
+    /// A shared TimerWheel (timer_wheel.hpp) uses it to tick only sessions
+    /// with something due.
+    [[nodiscard]] std::chrono::nanoseconds next_timer_due() const noexcept {
+        using std::chrono::nanoseconds;
+        if (batch_active_ || held_messages() > 0 || resend_) return nanoseconds::zero();
+
+        HeartbeatTimer::TimePoint deadline;
+        if (state_ == SessionState::Active) {
+            deadline = heartbeat_timer_.next_deadline();
+            if (config_.shadow_send_interval_ms > 0) {
+                deadline = std::min(deadline, last_shadow_ +
+                    std::chrono::milliseconds{config_.shadow_send_interval_ms});
+            }
+        } else if (state_ == SessionState::LogonSent && config_.logon_timeout > 0) {
+            deadline = logon_sent_at_ + std::chrono::seconds{config_.logon_timeout};
+        } else {
+            return nanoseconds::max();
+        }
+
+        const auto now = HeartbeatTimer::Clock::now();
+        return deadline > now
+            ? std::chrono::duration_cast<nanoseconds>(deadline - now) : nanoseconds::zero();
+    }
+
+    /// Run the order build path and discard the result: template header,
+    /// serializer, checksum and SendingTime stay cache-resident while the
+    /// session is idle, and the parser is kept warm for the next inbound.
+    /// Consumes no seq num; nothing is stored or sent.
+    void shadow_send() noexcept {
+        if (state_ != SessionState::Active) return;
+        OrderTemplates* templates = order_templates();
+        if (!templates) [[unlikely]] return;
+
+        auto msg = templates->order.build(
+            shadow_order(), sequences_.current_outbound(), current_timestamp());
+        if constexpr (requires { handler_.on_shadow_send(msg); }) {
+            handler_.on_shadow_send(msg);
         }
+        (void)util::warm_icache(1);
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        ++stats_.shadow_sends;
     }
 
     // ========================================================================
@@ -287,6 +591,15 @@ public:
         if (!can_send_app_messages(state_)) {
             return std::unexpected{SessionError{SessionErrorCode::InvalidState}};
         }
+        if (auto checked = pre_send_check(builder); !checked) [[unlikely]] {
+            return checked;
+        }
+        const auto hold = admit_app_message();
+        if (!hold) [[unlikely]] return std::unexpected{hold.error()};
+        NFX_PERF_SCOPE(Send);
+        NFX_PROBE_TSC(build_tsc);
+        [[maybe_unused]] const uint32_t seq = sequences_.current_outbound();
+        NFX_TRACE_BEGIN(Serialize, trace_session_, seq);
 
         auto msg = builder
             .sender_comp_id(config_.sender_comp_id)
@@ -294,14 +607,130 @@ public:
             .msg_seq_num(sequences_.next_outbound())
             .sending_time(current_timestamp())
             .build(assembler_);
-
-        if (!send_message(msg)) {
+        NFX_TRACE_END(Serialize, trace_session_, seq);
+
+        if (*hold) [[unlikely]] return hold_app_message(msg);
+        NFX_TRACE_BEGIN(Send, trace_session_, seq);
+        const bool sent = send_message(msg);
+        NFX_TRACE_END(Send, trace_session_, seq);
+        NFX_PROBE_RECORD(BuildToSend, build_tsc);
+        if (!sent) {
             return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
         }
 
         return {};
     }
 
+    /// Send a NewOrderSingle through the session's pre-rendered header
+    /// Same semantics as send_app_message(), without re-encoding the
+    /// BeginString/MsgType/CompID fields on every order.
+    SessionResult<void> send_new_order(const fix44::NewOrderSingle::Builder& order) noexcept {
+        return send_templated(order, &OrderTemplates::order);
+    }
+
+    /// Send an OrderCancelRequest through the pre-rendered header
+    SessionResult<void> send_cancel(const fix44::OrderCancelRequest::Builder& cancel) noexcept {
+        return send_templated(cancel, &OrderTemplates::cancel);
+    }
+
+    /// Send an OrderCancelReplaceRequest through the pre-rendered header
+    SessionResult<void> send_replace(
+        const fix44::OrderCancelReplaceRequest::Builder& replace) noexcept {
+        return send_templated(replace, &OrderTemplates::replace);
+    }
+
+    /// Send an OrderStatusRequest through the pre-rendered header
+    SessionResult<void> send_status_request(
+        const fix44::OrderStatusRequest::Builder& status) noexcept {
+        return send_templated(status, &OrderTemplates::status);
+    }
+
+    /// Send an ExecutionReport through the pre-rendered header
+    /// (acceptor side: acks and fills back to the counterparty)
+    SessionResult<void> send_execution_report(
+        const fix44::ExecutionReport::Builder& report) noexcept {
+        return send_templated(report, &OrderTemplates::exec_report);
+    }
+
+    // ========================================================================
+    // Outbound Batching
+    // ========================================================================
+
+    /// Coalesce subsequent sends into one on_send() call until flush().
+    /// Each message still takes its own MsgSeqNum and store entry; only the
+    /// write is deferred. The batch flushes early when OUTBOUND_BATCH_CAPACITY
+    /// would be exceeded, and on the next on_timer_tick() at the latest.
+    void begin_batch() noexcept {
+        batch_active_ = true;
+    }
+
+    /// Write all batched messages with a single on_send() call and end the batch
+    /// @return false if on_send failed (the messages remain in the store for resend)
+    bool flush() noexcept {
+        batch_active_ = false;
+        return flush_batch();
+    }
+
+    [[nodiscard]] bool in_batch() const noexcept { return batch_active_; }
+
+    /// Messages held by the outbound throttle (ThrottlePolicy::Queue)
+    [[nodiscard]] size_t held_messages() const noexcept {
+        return throttle_queue_ ? throttle_queue_->size() : 0;
+    }
+
+    /// A streamed resend (SessionConfig::resend_chunk_messages) still has
+    /// chunks to send; on_timer_tick() sends the next one
+    [[nodiscard]] bool resend_in_progress() const noexcept { return resend_.has_value(); }
+
+    /// Bytes / messages waiting for flush()
+    [[nodiscard]] size_t batched_bytes() const noexcept { return batch_len_; }
+    [[nodiscard]] size_t batched_messages() const noexcept { return batch_count_; }
+
+    // ========================================================================
+    // Idle Compaction
+    // ========================================================================
+
+    /// Return the buffers an idle session can do without to the memory
+    /// resource: batch buffer, order templates, reassembly buffer, resend
+    /// and message scratch, empty throttle/reorder queues, and the store's spare
+    /// capacity (IMessageStore::shrink_to_fit()). Each is reallocated on next
+    /// use. Runs automatically with SessionConfig::idle_compact_heartbeats.
+    /// @return Bytes released
+    size_t compact() noexcept {
+        size_t released = 0;
+        if (batch_buffer_ && !batch_active_ && batch_len_ == 0) {
+            batch_buffer_.reset();
+            released += sizeof(BatchBuffer);
+        }
+        if (templates_) {
+            templates_.reset();
+            released += sizeof(OrderTemplates);
+        }
+        if (partial_ && partial_len_ == 0) {
+            partial_.reset();
+            released += sizeof(ReassemblyBuffer);
+        }
+        if (resend_rewriter_) {
+            resend_rewriter_.reset();
+            released += sizeof(ResendRewriter);
+        }
+        if (throttle_queue_ && throttle_queue_->empty()) {
+            throttle_queue_.reset();
+            released += sizeof(ThrottleQueue);
+        }
+        if (reorder_ && reorder_->empty()) {
+            reorder_.reset();
+            released += sizeof(ReorderBuffer);
+        }
+        if (scratch_) {
+            scratch_.reset();
+            released += sizeof(MessageScratch);
+        }
+        if (message_store_) released += message_store_->shrink_to_fit();
+        ++stats_.compactions;
+        return released;
+    }
+
     // ========================================================================
     // Accessors
     // ========================================================================
@@ -309,13 +738,182 @@ public:
     [[nodiscard]] SessionState state() const noexcept { return state_; }
     [[nodiscard]] const SessionConfig& config() const noexcept { return config_; }
     [[nodiscard]] const SessionStats& stats() const noexcept { return stats_; }
+
+    /// Receive timestamp of the message currently (or last) being processed
+    [[nodiscard]] const RxTimestamp& last_rx_timestamp() const noexcept { return rx_timestamp_; }
+
+    /// Per-message scratch for application callbacks: a MESSAGE_SCRATCH_SIZE
+    /// monotonic buffer (allocated on first use from the session's resource,
+    /// which also takes any overflow), reset after each on_app_message or
+    /// route returns. Handlers taking a std::pmr::memory_resource& get it
+    /// as a parameter; SessionCallbacks users call this from the callback.
+    /// Nothing allocated from it may outlive the callback.
+    [[nodiscard]] std::pmr::memory_resource& message_scratch() noexcept {
+        if (!scratch_) [[unlikely]] {
+            scratch_ = make_owned<MessageScratch>(resource_);
+            if (!scratch_) return *resource_;
+        }
+        return *scratch_;
+    }
     [[nodiscard]] const SequenceManager& sequences() const noexcept { return sequences_; }
 
     [[nodiscard]] SessionId session_id() const noexcept {
-        return SessionId{config_.sender_comp_id, config_.target_comp_id, config_.begin_string};
+        return SessionId{config_.sender_comp_id, config_.target_comp_id, begin_string()};
+    }
+
+    /// BeginString on the wire: FIXT.1.1 for FIX 5.0+, else config().begin_string
+    [[nodiscard]] std::string_view begin_string() const noexcept {
+        if constexpr (Version::IS_FIXT) {
+            return Version::BEGIN_STRING;
+        } else {
+            return config_.begin_string;
+        }
+    }
+
+    /// Counterparty's DefaultApplVerID (1137), from its Logon
+    [[nodiscard]] char peer_appl_ver_id() const noexcept { return peer_appl_ver_id_; }
+
+    /// Application version (ApplVerID 1128 or the counterparty's default)
+    /// of the message currently (or last) being processed
+    [[nodiscard]] char inbound_appl_ver_id() const noexcept {
+        return Version::appl_ver_id(inbound_, peer_appl_ver_id_);
     }
 
 private:
+    // ========================================================================
+    // Session Memory
+    // ========================================================================
+
+    /// Message straddling on_bytes() chunks, indexed as it grows
+    struct ReassemblyBuffer {
+        std::array<char, REASSEMBLY_CAPACITY> bytes;
+        simd::FIXStructuralIndex index;
+    };
+    using BatchBuffer = std::array<char, OUTBOUND_BATCH_CAPACITY>;
+    using MessageScratch = MonotonicPool<MESSAGE_SCRATCH_SIZE>;
+
+    /// Layout templates behind send_new_order() and friends
+    struct OrderTemplates {
+        fix44::NewOrderTemplate order;
+        fix44::OrderCancelTemplate cancel;
+        fix44::OrderCancelReplaceTemplate replace;
+        fix44::OrderStatusTemplate status;
+        fix44::ExecutionReportTemplate exec_report;
+    };
+
+    /// Destroys an object allocated from the session's memory resource
+    struct ResourceDelete {
+        std::pmr::memory_resource* resource{nullptr};
+
+        template <typename T>
+        void operator()(T* ptr) const noexcept {
+            ptr->~T();
+            resource->deallocate(ptr, sizeof(T), alignof(T));
+        }
+    };
+
+    template <typename T>
+    using ResourcePtr = std::unique_ptr<T, ResourceDelete>;
+
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+    using HeapPtr = std::unique_ptr<memory::SessionHeap>;
+
+    [[nodiscard]] static HeapPtr make_session_heap(const SessionConfig& config) noexcept {
+        if (config.session_heap_size == 0) return nullptr;
+        HeapPtr heap{new (std::nothrow) memory::SessionHeap{
+            config.session_heap_size, config.session_heap_numa_node}};
+        if (heap && !heap->valid()) heap.reset();
+        return heap;
+    }
+
+    [[nodiscard]] static std::pmr::memory_resource* heap_resource(const HeapPtr& heap) noexcept {
+        return heap ? static_cast<std::pmr::memory_resource*>(heap.get())
+                    : std::pmr::new_delete_resource();
+    }
+#else
+    struct HeapPtr {};
+
+    [[nodiscard]] static HeapPtr make_session_heap(const SessionConfig&) noexcept { return {}; }
+
+    [[nodiscard]] static std::pmr::memory_resource* heap_resource(const HeapPtr&) noexcept {
+        return std::pmr::new_delete_resource();
+    }
+#endif
+
+    /// Construct a T from the session's memory resource
+    /// @return nullptr if the resource is exhausted
+    template <typename T, typename... Args>
+    [[nodiscard]] ResourcePtr<T> make_owned(Args&&... args) noexcept {
+        void* mem = nullptr;
+        try {
+            mem = resource_->allocate(sizeof(T), alignof(T));
+        } catch (...) {
+            return ResourcePtr<T>{nullptr, ResourceDelete{resource_}};
+        }
+        return ResourcePtr<T>{::new (mem) T{std::forward<Args>(args)...}, ResourceDelete{resource_}};
+    }
+
+    /// Templates for the current session, allocated and prepared on first
+    /// use after compact() (nullptr if the resource is exhausted)
+    [[nodiscard]] OrderTemplates* order_templates() noexcept {
+        if (!templates_) [[unlikely]] {
+            templates_ = make_owned<OrderTemplates>();
+            if (templates_) prepare_templates(*templates_);
+        }
+        return templates_.get();
+    }
+
+    /// Messages sent or received other than heartbeats
+    [[nodiscard]] uint64_t non_heartbeat_traffic() const noexcept {
+        return stats_.messages_sent + stats_.messages_received -
+               stats_.heartbeats_sent - stats_.heartbeats_received;
+    }
+
+    void prepare_templates(OrderTemplates& t) noexcept {
+        const auto begin = begin_string();
+        const auto sender = config_.sender_comp_id;
+        const auto target = config_.target_comp_id;
+        t.order.prepare(begin, sender, target, config_.seq_num_width);
+        t.cancel.prepare(begin, sender, target, config_.seq_num_width);
+        t.replace.prepare(begin, sender, target, config_.seq_num_width);
+        t.status.prepare(begin, sender, target, config_.seq_num_width);
+        t.exec_report.prepare(begin, sender, target, config_.seq_num_width);
+    }
+
+    /// After each heartbeat sent on interval: compact once
+    /// idle_compact_heartbeats intervals have passed with only heartbeats
+    void note_idle_heartbeat() noexcept {
+        const uint64_t traffic = non_heartbeat_traffic();
+        if (traffic != idle_traffic_mark_) {
+            idle_traffic_mark_ = traffic;
+            idle_heartbeats_ = 0;
+            return;
+        }
+        if (++idle_heartbeats_ == config_.idle_compact_heartbeats) {
+            (void)compact();
+        }
+    }
+
+    /// Resend rewrite through the lazily allocated rewriter scratch
+    [[nodiscard]] ParseResult<std::span<const char>> rewrite_for_resend(
+        std::span<const char> msg, std::string_view sending_time) noexcept
+    {
+        return rewrite_for_resend(msg, store::describe_message(msg), sending_time);
+    }
+
+    [[nodiscard]] ParseResult<std::span<const char>> rewrite_for_resend(
+        std::span<const char> msg, const store::MessageMeta& meta,
+        std::string_view sending_time) noexcept
+    {
+        if (!resend_rewriter_) [[unlikely]] {
+            resend_rewriter_ = make_owned<ResendRewriter>();
+            if (!resend_rewriter_) {
+                return std::unexpected{ParseError{ParseErrorCode::BufferTooShort}};
+            }
+        }
+        return resend_rewriter_->rewrite(msg, meta, sending_time);
+    }
+
     // ========================================================================
     // State Machine
     // ========================================================================
@@ -326,9 +924,16 @@ private:
 
         if (next != prev) {
             state_ = next;
-            if (callbacks_.on_state_change) {
-                callbacks_.on_state_change(prev, next);
+            if (next == SessionState::Active) {
+                idle_traffic_mark_ = non_heartbeat_traffic();
+                idle_heartbeats_ = 0;
+                if (templates_) {
+                    prepare_templates(*templates_);
+                } else {
+                    (void)order_templates();
+                }
             }
+            handler_.on_state_change(prev, next);
         }
     }
 
@@ -336,7 +941,7 @@ private:
     // Admin Message Handling
     // ========================================================================
 
-    void handle_admin_message(const ParsedMessage& msg) noexcept {
+    void handle_admin_message(const IndexedParser& msg) noexcept {
         switch (msg.msg_type()) {
             case msg_type::Logon:
                 handle_logon(msg);
@@ -362,7 +967,9 @@ private:
         }
     }
 
-    void handle_logon(const ParsedMessage& msg) noexcept {
+    void handle_logon(const IndexedParser& msg) noexcept {
+        peer_appl_ver_id_ = Version::peer_default_appl_ver_id(msg);
+
         if (state_ == SessionState::LogonSent) {
             // Response to our logon
             if (auto v = msg.get_int(108)) {  // HeartBtInt
@@ -371,15 +978,13 @@ private:
             transition(SessionEvent::LogonReceived);
             heartbeat_timer_.reset();
 
-            if (callbacks_.on_logon) {
-                callbacks_.on_logon();
-            }
+            handler_.on_logon();
         } else if (state_ == SessionState::SocketConnected) {
             // Incoming logon - we're the acceptor
             transition(SessionEvent::LogonReceived);
 
             // Send logon response
-            auto response = fix44::Logon::Builder{}
+            auto response = Version::logon()
                 .sender_comp_id(config_.sender_comp_id)
                 .target_comp_id(config_.target_comp_id)
                 .msg_seq_num(sequences_.next_outbound())
@@ -392,13 +997,11 @@ private:
             transition(SessionEvent::LogonAcknowledged);
             heartbeat_timer_.reset();
 
-            if (callbacks_.on_logon) {
-                callbacks_.on_logon();
-            }
+            handler_.on_logon();
         }
     }
 
-    void handle_logout(const ParsedMessage& msg) noexcept {
+    void handle_logout(const IndexedParser& msg) noexcept {
         std::string_view text = msg.get_string(tag::Text::value);
 
         if (state_ == SessionState::LogoutPending) {
@@ -408,7 +1011,7 @@ private:
             // Incoming logout - send response
             transition(SessionEvent::LogoutReceived);
 
-            auto response = fix44::Logout::Builder{}
+            auto response = typename Version::Logout::Builder{}
                 .sender_comp_id(config_.sender_comp_id)
                 .target_comp_id(config_.target_comp_id)
                 .msg_seq_num(sequences_.next_outbound())
@@ -419,22 +1022,20 @@ private:
             transition(SessionEvent::LogoutSent);
         }
 
-        if (callbacks_.on_logout) {
-            callbacks_.on_logout(text);
-        }
+        handler_.on_logout(text);
     }
 
-    void handle_heartbeat(const ParsedMessage& msg) noexcept {
+    void handle_heartbeat(const IndexedParser& msg) noexcept {
         ++stats_.heartbeats_received;
         // TestReqID handling if present
         // Nothing else to do - heartbeat timer already updated
     }
 
-    void handle_test_request(const ParsedMessage& msg) noexcept {
+    void handle_test_request(const IndexedParser& msg) noexcept {
         // Send heartbeat with TestReqID
         std::string_view test_req_id = msg.get_string(tag::TestReqID::value);
 
-        auto response = fix44::Heartbeat::Builder{}
+        auto response = typename Version::Heartbeat::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
@@ -445,7 +1046,7 @@ private:
         send_message(response);
     }
 
-    void handle_resend_request(const ParsedMessage& msg) noexcept {
+    void handle_resend_request(const IndexedParser& msg) noexcept {
         ++stats_.resend_requests_sent;
 
         auto begin_seq = msg.get_int(7);  // BeginSeqNo
@@ -456,28 +1057,96 @@ private:
         uint32_t begin = static_cast<uint32_t>(*begin_seq);
         uint32_t end = static_cast<uint32_t>(*end_seq);
 
-        // Try to retrieve messages from store
-        if (message_store_) {
-            auto messages = message_store_->retrieve_range(begin, end);
-
-            if (!messages.empty()) {
-                // Resend stored messages with PossDupFlag=Y
-                for (const auto& stored_msg : messages) {
-                    // Note: In production, we should modify the message to set
-                    // PossDupFlag=Y (tag 43) and update SendingTime (tag 52)
-                    // For now, resend as-is
-                    if (callbacks_.on_send) {
-                        callbacks_.on_send(stored_msg);
-                        ++stats_.messages_sent;
-                        stats_.bytes_sent += stored_msg.size();
+        // Held messages in the range go out as replays (or are gap-filled)
+        // below; releasing them later would repeat their seq nums
+        drop_held_through(end == 0 ? UINT32_MAX : end);
+
+        // A new request replaces one still streaming. Messages sent while
+        // it streams take seq nums past the range and go out live.
+        const uint32_t next_out = sequences_.current_outbound();
+        resend_.emplace(ResendStream{
+            .next = begin,
+            .stop = (end == 0 || end >= next_out) ? next_out - 1 : end,
+            .end = end,
+            .end_seq = (end == 0 || end >= next_out) ? next_out : end + 1,
+            .begin = begin,
+            .coalescer = GapFillCoalescer{begin},
+        });
+        continue_resend();
+    }
+
+    /// Replay the next chunk of the pending resend: resend_chunk_messages
+    /// seq nums as one write, or the whole range when that is 0.
+    /// Replays go straight from store memory, splicing in PossDupFlag=Y,
+    /// a fresh SendingTime and OrigSendingTime (no per-message allocation).
+    /// Runs of admin messages and missing seq nums become one GapFill each.
+    /// Both decisions use the MessageMeta kept with each stored message.
+    void continue_resend() noexcept {
+        ResendStream& rs = *resend_;
+        if (!message_store_ || !can_send()) {
+            finish_resend(current_timestamp());
+            return;
+        }
+
+        const uint32_t chunk = config_.resend_chunk_messages;
+        const bool own_batch = chunk != 0 && !batch_active_;
+        if (own_batch) batch_active_ = true;
+
+        const std::string_view resend_time = current_timestamp();
+        const uint32_t remaining = rs.next <= rs.stop ? rs.stop - rs.next + 1 : 0;
+        const bool last_chunk = chunk == 0 || remaining <= chunk;
+        // All at once runs to the requested EndSeqNo (0 = all stored);
+        // streamed chunks stop before what was sent live meanwhile
+        const uint32_t last = !last_chunk ? rs.next + chunk - 1
+                            : chunk == 0 ? rs.end : rs.stop;
+        if (chunk == 0 || remaining > 0) {
+            std::optional<GapFillRange> gap;
+            rs.visited += message_store_->visit_range(rs.next, last,
+                [&](uint32_t seq, std::span<const char> stored_msg,
+                    const store::MessageMeta& meta) {
+                    bool replay = rs.coalescer.on_stored(seq, meta, gap);
+                    if (gap) {
+                        send_gap_fill(*gap, resend_time);
+                        ++rs.sent;
                     }
-                }
-                return;
+                    if (replay) {
+                        replay_stored(stored_msg, meta, resend_time);
+                        ++rs.sent;
+                    }
+                });
+        }
+        if (last_chunk) {
+            finish_resend(resend_time);
+        } else {
+            rs.next = last + 1;
+        }
+
+        if (own_batch) {
+            (void)flush();
+            ++stats_.resend_chunks;
+        }
+    }
+
+    /// Close the range with a trailing GapFill, or fall back to a reset
+    /// when nothing in it could be replayed
+    void finish_resend(std::string_view resend_time) noexcept {
+        ResendStream& rs = *resend_;
+        if (rs.visited > 0) {
+            if (auto tail = rs.coalescer.finish(rs.end_seq)) {
+                send_gap_fill(*tail, resend_time);
+                ++rs.sent;
             }
         }
+        const bool sent = rs.sent > 0;
+        const uint32_t begin = rs.begin;
+        resend_.reset();
+        if (sent) {
+            return;
+        }
 
         // Fallback: No store or messages not found - send SequenceReset (gap fill)
-        auto response = fix44::SequenceReset::Builder{}
+        drop_held_through(UINT32_MAX);
+        auto response = typename Version::SequenceReset::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(begin)
@@ -489,7 +1158,7 @@ private:
         send_message(response);
     }
 
-    void handle_sequence_reset(const ParsedMessage& msg) noexcept {
+    void handle_sequence_reset(const IndexedParser& msg) noexcept {
         ++stats_.sequence_resets;
 
         if (auto new_seq = msg.get_int(36)) {  // NewSeqNo
@@ -499,27 +1168,56 @@ private:
                 // Gap fill - update expected without error
                 sequences_.set_inbound(static_cast<uint32_t>(*new_seq));
             } else {
-                // Hard reset
+                // Hard reset - outstanding ResendRequests no longer apply
                 sequences_.set_inbound(static_cast<uint32_t>(*new_seq));
+                gap_requested_through_ = 0;
             }
+            // Held messages now below the expected seq num are never dispatched
+            if (reorder_) reorder_->discard_below(static_cast<uint32_t>(*new_seq));
         }
     }
 
-    void handle_reject(const ParsedMessage& msg) noexcept {
+    void handle_reject(const IndexedParser& msg) noexcept {
         // Session-level reject - log and continue
         [[maybe_unused]] std::string_view text = msg.get_string(tag::Text::value);
-        if (callbacks_.on_error) {
-            callbacks_.on_error(SessionError{SessionErrorCode::InvalidState});
-        }
+        handler_.on_error(SessionError{SessionErrorCode::InvalidState});
     }
 
     // ========================================================================
     // Application Message Handling
     // ========================================================================
 
-    void handle_app_message(const ParsedMessage& msg) noexcept {
-        if (callbacks_.on_app_message) {
-            callbacks_.on_app_message(msg);
+    void handle_app_message(const IndexedParser& msg) noexcept {
+        NFX_PROBE_RECORD(ParseToCallback, probe_parsed_tsc_);
+        NFX_PERF_SCOPE(Dispatch);
+#if NFX_EVENT_TRACE
+        NFX_TRACE_BEGIN(Dispatch, trace_session_, msg.msg_seq_num());
+        struct TraceDispatchEnd {
+            const BasicSessionManager& self;
+            uint32_t seq;
+            ~TraceDispatchEnd() {
+                const uint64_t now = util::detail::rdtscp();
+                util::trace_at(now, util::TraceEvent::Dispatch, util::TracePhase::End,
+                               self.trace_session_, seq);
+                util::TraceRegistry::check_outlier(self.trace_recv_tsc_, now,
+                                                   self.trace_session_, seq);
+            }
+        } trace_dispatch_end{*this, msg.msg_seq_num()};
+#endif
+        if constexpr (HasMsgRoutes<std::remove_reference_t<Handler>>) {
+            // Typed routes first (msg_dispatch.hpp); unrouted types fall through
+            using Table = HandlerDispatchTable<std::remove_reference_t<Handler>>;
+            std::pmr::memory_resource* scratch = nullptr;
+            if constexpr (Table::WANTS_SCRATCH) scratch = &message_scratch();
+            if (Table::dispatch(handler_, msg, rx_timestamp_, scratch)) return;
+        }
+        if constexpr (requires(std::pmr::memory_resource& r) {
+                          handler_.on_app_message(msg, rx_timestamp_, r); }) {
+            handler_.on_app_message(msg, rx_timestamp_, message_scratch());
+        } else if constexpr (requires { handler_.on_app_message(msg, rx_timestamp_); }) {
+            handler_.on_app_message(msg, rx_timestamp_);
+        } else {
+            handler_.on_app_message(msg);  // Timestamp via last_rx_timestamp()
         }
     }
 
@@ -527,16 +1225,30 @@ private:
     // Error Handling
     // ========================================================================
 
-    void handle_parse_error(const ParseError& error) noexcept {
-        if (callbacks_.on_error) {
-            callbacks_.on_error(SessionError{SessionErrorCode::InvalidState});
+    /// Route by message type ("AE" etc. share a first char with admin types)
+    void route_inbound(const IndexedParser& msg) noexcept {
+        if (msg.msg_type_str().size() == 1 && msg_type::is_admin(msg.msg_type())) {
+            handle_admin_message(msg);
+        } else {
+            handle_app_message(msg);
+            if (scratch_) scratch_->reset();
         }
     }
 
+    void handle_parse_error(const ParseError& error) noexcept {
+        handler_.on_error(SessionError{SessionErrorCode::InvalidState});
+    }
+
+    /// Request only seq nums not already requested or held: messages after
+    /// the gap each report it again until it is filled
     void handle_sequence_gap(uint32_t received) noexcept {
         auto [begin, end] = sequences_.gap_range(received);
+        const uint32_t covered = gap_requested_through_;
+        gap_requested_through_ = std::max(covered, received);
+        if (end <= covered) return;
+        begin = std::max(begin, covered + 1);
 
-        auto request = fix44::ResendRequest::Builder{}
+        auto request = typename Version::ResendRequest::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
@@ -548,32 +1260,448 @@ private:
         send_message(request);
     }
 
+    /// Hold a message received past a gap (see reorder_buffer.hpp).
+    /// Logon, Logout, ResendRequest and SequenceReset act on receipt.
+    /// @return false to dispatch it now, out of order
+    [[nodiscard]] bool hold_out_of_order(const IndexedParser& msg,
+                                         std::span<const char> data) noexcept {
+        if (!config_.reorder_inbound) return false;
+        if (msg.msg_type_str().size() == 1) {
+            switch (msg.msg_type()) {
+                case msg_type::Logon:
+                case msg_type::Logout:
+                case msg_type::ResendRequest:
+                case msg_type::SequenceReset:
+                    return false;
+                default:
+                    break;
+            }
+        }
+        if (!reorder_) [[unlikely]] {
+            reorder_ = make_owned<ReorderBuffer>();
+            if (!reorder_) return false;
+        }
+        if (!reorder_->hold(msg.msg_seq_num(), sequences_.expected_inbound(), data)) {
+            return false;
+        }
+        ++stats_.messages_reordered;
+        return true;
+    }
+
+    /// Dispatch held messages the expected seq num has reached
+    void release_reordered() noexcept {
+        while (const auto* held = reorder_->find(sequences_.expected_inbound())) {
+            const uint32_t seq = held->seq_num;
+            // Parsed once already, when it was held
+            if (inbound_.assign(reorder_->bytes(*held)).has_value()) {
+                (void)sequences_.validate_inbound(seq);
+                route_inbound(inbound_);
+            }
+            // The handler may have disconnected, which clears the buffer
+            if (!reorder_->release(seq)) return;
+        }
+    }
+
     void handle_sequence_error(uint32_t received) noexcept {
         // Sequence too low - reject or logout
-        if (callbacks_.on_error) {
-            callbacks_.on_error(SessionError{
-                SessionErrorCode::SequenceGap,
-                sequences_.expected_inbound(),
-                received
-            });
+        handler_.on_error(SessionError{
+            SessionErrorCode::SequenceGap,
+            sequences_.expected_inbound(),
+            received
+        });
+    }
+
+    // ========================================================================
+    // Stream Reassembly (see on_bytes())
+    // ========================================================================
+
+    static constexpr size_t FRAME_INVALID = ~size_t{0};
+    static constexpr size_t FRAME_HEADER_PROBE = 32;  // Covers "8=FIXT.1.1|9=65536|"
+
+    /// Total length of the message starting at head, from BodyLength:
+    /// 0 while "8=...|9=N|" is incomplete, FRAME_INVALID if head is no FIX header
+    [[nodiscard]] static size_t framed_length(std::span<const char> head) noexcept {
+        constexpr std::string_view BEGIN = "8=";
+        constexpr std::string_view LENGTH = "9=";
+        const std::string_view h{head.data(), head.size()};
+
+        if (h.size() < BEGIN.size()) return BEGIN.starts_with(h) ? 0 : FRAME_INVALID;
+        if (!h.starts_with(BEGIN)) return FRAME_INVALID;
+
+        const size_t begin_end = h.find(fix::SOH, BEGIN.size());
+        if (begin_end == std::string_view::npos) {
+            return h.size() > FRAME_HEADER_PROBE ? FRAME_INVALID : 0;
+        }
+        const std::string_view rest = h.substr(begin_end + 1);
+        if (rest.size() < LENGTH.size()) return LENGTH.starts_with(rest) ? 0 : FRAME_INVALID;
+        if (!rest.starts_with(LENGTH)) return FRAME_INVALID;
+
+        size_t body_length = 0;
+        for (size_t i = LENGTH.size(); i < rest.size(); ++i) {
+            const char c = rest[i];
+            if (c == fix::SOH) {
+                if (i == LENGTH.size()) return FRAME_INVALID;
+                return begin_end + 1 + i + 1 + body_length + 7;  // + "10=NNN|"
+            }
+            if (c < '0' || c > '9' || i >= LENGTH.size() + 6) return FRAME_INVALID;
+            body_length = body_length * 10 + static_cast<size_t>(c - '0');
         }
+        return 0;
+    }
+
+    /// on_data_received() with the message's structural index when the
+    /// reassembly buffer built it (nullptr = built while parsing)
+    void receive_message(std::span<const char> data, const RxTimestamp& rx_ts,
+                         const simd::FIXStructuralIndex* index) noexcept {
+        rx_timestamp_ = rx_ts;
+#if NFX_LATENCY_PROBES
+        // From the transport's receive completion when it stamped one
+        const uint64_t recv_tsc = util::detail::probe_recv_tsc != 0
+            ? util::detail::probe_recv_tsc : util::probe_tsc();
+#endif
+#if NFX_EVENT_TRACE
+        const uint64_t trace_parse_tsc = util::detail::rdtscp();
+        trace_recv_tsc_ = util::detail::probe_recv_tsc != 0
+            ? util::detail::probe_recv_tsc : trace_parse_tsc;
+#endif
+
+        // Update heartbeat timer
+        heartbeat_timer_.message_received();
+        ++stats_.messages_received;
+        stats_.bytes_received += data.size();
+
+        // Parse once into the session's parser; admin handling and the
+        // application callback all read this index
+        auto result = [&] {
+            NFX_PERF_SCOPE(Parse);
+            if (index) [[unlikely]] {
+                return config_.dictionary ? inbound_.assign(data, *index, *config_.dictionary)
+                                          : inbound_.assign(data, *index);
+            }
+            return config_.dictionary ? inbound_.assign(data, *config_.dictionary)
+                                      : inbound_.assign(data);
+        }();
+#if NFX_LATENCY_PROBES
+        probe_parsed_tsc_ = util::probe_tsc();
+        util::record_latency(util::LatencyProbe::RecvToParse, recv_tsc, probe_parsed_tsc_);
+#endif
+#if NFX_EVENT_TRACE
+        {
+            // Seq num known only now: back-date the recv and parse start
+            const uint32_t seq = result.has_value() ? inbound_.msg_seq_num() : 0;
+            util::trace_at(trace_recv_tsc_, util::TraceEvent::Recv, util::TracePhase::Instant,
+                           trace_session_, seq);
+            util::trace_at(trace_parse_tsc, util::TraceEvent::Parse, util::TracePhase::Begin,
+                           trace_session_, seq);
+            NFX_TRACE_END(Parse, trace_session_, seq);
+        }
+#endif
+        if (!result.has_value()) {
+            handle_parse_error(result.error());
+            return;
+        }
+
+        const IndexedParser& msg = inbound_;
+        audit(AuditDirection::Inbound, msg.msg_seq_num(), data);
+
+        // Validate sequence number
+        auto seq_result = sequences_.validate_inbound(msg.msg_seq_num());
+        if (seq_result == SequenceManager::SequenceResult::GapDetected) {
+            handle_sequence_gap(msg.msg_seq_num());
+            // Past the gap: held and dispatched once the gap is filled
+            if (hold_out_of_order(msg, data)) return;
+        } else if (seq_result == SequenceManager::SequenceResult::TooLow) {
+            // Possible duplicate, check PossDupFlag
+            if (!msg.header().poss_dup_flag) {
+                // Sequence too low and not marked as duplicate
+                handle_sequence_error(msg.msg_seq_num());
+                return;
+            }
+        }
+
+        route_inbound(msg);
+
+        if (reorder_ && !reorder_->empty()) [[unlikely]] {
+            release_reordered();
+        }
+    }
+
+    /// Append the head of `data` to the straddling message, dispatching it
+    /// once complete
+    /// @return The bytes of `data` after it
+    [[nodiscard]] std::span<const char> complete_partial(std::span<const char> data,
+                                                         const RxTimestamp& rx_ts) noexcept {
+        while (!data.empty()) {
+            const size_t total = framed_length({partial_->bytes.data(), partial_len_});
+            if (total == FRAME_INVALID || total > REASSEMBLY_CAPACITY ||
+                (total != 0 && total < partial_len_)) [[unlikely]] {
+                drop_partial();
+                return data;
+            }
+
+            // Until BodyLength is known, take just enough to read it
+            const size_t take = total == 0
+                ? std::min({data.size(), FRAME_HEADER_PROBE, REASSEMBLY_CAPACITY - partial_len_})
+                : std::min(data.size(), total - partial_len_);
+            std::memcpy(partial_->bytes.data() + partial_len_, data.data(), take);
+            partial_len_ += take;
+            data = data.subspan(take);
+            simd::extend_index(partial_->index, {partial_->bytes.data(), partial_len_});
+
+            if (total != 0 && partial_len_ == total) {
+                partial_len_ = 0;
+                ++stats_.messages_reassembled;
+                receive_message({partial_->bytes.data(), total}, rx_ts, &partial_->index);
+                return data;
+            }
+        }
+        return data;
+    }
+
+    /// Keep the unframed tail of a chunk: from the next "8=F", or a cut
+    /// "8=FIX" prefix at the very end
+    void stash_partial(std::span<const char> tail) noexcept {
+        const std::string_view t{tail.data(), tail.size()};
+        const simd::MessageBoundary boundary = simd::find_message_boundary(tail);
+
+        size_t start = t.size();
+        if (t.substr(boundary.start).starts_with("8=F")) {
+            start = boundary.start;
+        } else {
+            const size_t last_soh = t.rfind(fix::SOH);
+            const size_t piece = last_soh == std::string_view::npos ? 0 : last_soh + 1;
+            if (std::string_view{"8=FIX"}.starts_with(t.substr(piece))) start = piece;
+        }
+        stats_.bytes_discarded += start;
+
+        const size_t keep = t.size() - start;
+        if (keep == 0) return;
+        if (keep > REASSEMBLY_CAPACITY) [[unlikely]] {
+            stats_.bytes_discarded += keep;
+            handler_.on_error(SessionError{SessionErrorCode::InvalidState});
+            return;
+        }
+        if (!partial_) [[unlikely]] {
+            partial_ = make_owned<ReassemblyBuffer>();
+            if (!partial_) {
+                stats_.bytes_discarded += keep;
+                return;
+            }
+        }
+        std::memcpy(partial_->bytes.data(), t.data() + start, keep);
+        partial_len_ = keep;
+        partial_->index.clear();
+        simd::extend_index(partial_->index, {partial_->bytes.data(), keep});
+    }
+
+    void drop_partial() noexcept {
+        stats_.bytes_discarded += partial_len_;
+        partial_len_ = 0;
+        handler_.on_error(SessionError{SessionErrorCode::InvalidState});
     }
 
     // ========================================================================
     // Message Sending
     // ========================================================================
 
+    /// shadow_send() once per interval without outbound messages
+    void maybe_shadow_send() noexcept {
+        const auto now = std::chrono::steady_clock::now();
+        if (stats_.messages_sent != shadow_mark_) {
+            // Traffic since the last tick: the path is warm already
+            shadow_mark_ = stats_.messages_sent;
+            last_shadow_ = now;
+            return;
+        }
+        if (now - last_shadow_ >= std::chrono::milliseconds{config_.shadow_send_interval_ms}) {
+            shadow_send();
+            last_shadow_ = now;
+        }
+    }
+
+    /// Order built by shadow_send()
+    [[nodiscard]] static const fix44::NewOrderSingle::Builder& shadow_order() noexcept {
+        static const auto order = fix44::NewOrderSingle::Builder{}
+            .cl_ord_id("SHADOW0000000001")
+            .symbol("SHADOW")
+            .side(Side::Buy)
+            .transact_time("20260101-00:00:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_string("100.00"))
+            .time_in_force(TimeInForce::Day);
+        return order;
+    }
+
+    /// Handlers may report an unbound sender through can_send(); sends
+    /// then fail before anything is stored
+    [[nodiscard]] bool can_send() const noexcept {
+        if constexpr (requires(const std::remove_reference_t<Handler>& h) {
+                          { h.can_send() } noexcept -> std::same_as<bool>;
+                      }) {
+            return handler_.can_send();
+        } else {
+            return true;
+        }
+    }
+
+    /// Handlers may veto an outbound message through check_order() (e.g. a
+    /// PreTradeRisk stage); runs before a sequence number is consumed
+    template <typename MsgBuilder>
+    [[nodiscard]] SessionResult<void> pre_send_check(const MsgBuilder& builder) noexcept {
+        if constexpr (requires {
+                          { handler_.check_order(builder) } noexcept
+                              -> std::same_as<SessionResult<void>>;
+                      }) {
+            auto checked = handler_.check_order(builder);
+            if (!checked) [[unlikely]] ++stats_.risk_rejects;
+            return checked;
+        } else {
+            return {};
+        }
+    }
+
+    /// send_app_message() through one of the session's layout templates
+    template <typename MsgBuilder, typename Template>
+    SessionResult<void> send_templated(const MsgBuilder& builder,
+                                       Template OrderTemplates::* member) noexcept {
+        if (!can_send_app_messages(state_)) {
+            return std::unexpected{SessionError{SessionErrorCode::InvalidState}};
+        }
+        OrderTemplates* templates = order_templates();
+        if (!templates) [[unlikely]] {
+            // No memory for the templates: encode through the builder
+            MsgBuilder generic = builder;
+            return send_app_message(generic);
+        }
+        Template& tmpl = templates->*member;
+        if (auto checked = pre_send_check(builder); !checked) [[unlikely]] {
+            return checked;
+        }
+        const auto hold = admit_app_message();
+        if (!hold) [[unlikely]] return std::unexpected{hold.error()};
+        NFX_PERF_SCOPE(Send);
+        NFX_PROBE_TSC(build_tsc);
+        [[maybe_unused]] const uint32_t seq = sequences_.current_outbound();
+        NFX_TRACE_BEGIN(Serialize, trace_session_, seq);
+
+        auto msg = tmpl.build(builder, sequences_.next_outbound(), current_timestamp());
+        NFX_TRACE_END(Serialize, trace_session_, seq);
+
+        if (*hold) [[unlikely]] return hold_app_message(msg);
+        NFX_TRACE_BEGIN(Send, trace_session_, seq);
+        const bool sent = send_message(msg);
+        NFX_TRACE_END(Send, trace_session_, seq);
+        NFX_PROBE_RECORD(BuildToSend, build_tsc);
+        if (!sent) {
+            return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+        }
+
+        return {};
+    }
+
     bool send_message(std::span<const char> msg) noexcept {
-        if (!callbacks_.on_send) return false;
+        if (!can_send()) return false;
+
+        store_outbound(msg);
 
-        // Store message for potential resend (before actual send)
+        // Never overtake held application messages: MsgSeqNum stays in
+        // order on the wire. If the queue is full, release it early.
+        if (throttle_queue_ && !throttle_queue_->empty()) [[unlikely]] {
+            if (throttle_queue_->push(msg, sequences_.current_outbound() - 1, false)) return true;
+            release_throttled(true);
+        }
+
+        return transmit(msg);
+    }
+
+    // ========================================================================
+    // Outbound Throttle
+    // ========================================================================
+
+    /// Throttle gate for an application message, before its seq num is taken
+    /// @return true to hold the message, false to send it now, or Throttled
+    [[nodiscard]] SessionResult<bool> admit_app_message() noexcept {
+        if (!app_throttle_.enabled()) [[likely]] return false;
+        const bool queued = throttle_queue_ && !throttle_queue_->empty();
+        if (!queued && app_throttle_.try_acquire(util::detail::rdtscp())) return false;
+
+        ++stats_.messages_throttled;
+        if (config_.throttle_policy == ThrottlePolicy::Queue) {
+            if (!throttle_queue_) {
+                throttle_queue_ = make_owned<ThrottleQueue>();
+            }
+            if (throttle_queue_ && throttle_queue_->size() < ThrottleQueue::capacity()) {
+                return true;
+            }
+        }
+        return std::unexpected{SessionError{SessionErrorCode::Throttled}};
+    }
+
+    /// Store and hold a built application message for release_throttled()
+    /// A message too large for the free arena stays stored only; the peer
+    /// sees the seq gap and it is replayed on ResendRequest.
+    SessionResult<void> hold_app_message(std::span<const char> msg) noexcept {
+        if (!can_send()) {
+            return std::unexpected{SessionError{SessionErrorCode::NotConnected}};
+        }
+        store_outbound(msg);
+        if (!throttle_queue_->push(msg, sequences_.current_outbound() - 1, true)) [[unlikely]] {
+            return std::unexpected{SessionError{SessionErrorCode::Throttled}};
+        }
+        return {};
+    }
+
+    /// Send held messages in order while tokens last (all of them if
+    /// `force`); admin messages behind the throttle need no token
+    void release_throttled(bool force = false) noexcept {
+        if (!throttle_queue_ || !can_send()) return;
+        while (const auto* held = throttle_queue_->front()) {
+            if (held->counted && !force &&
+                !app_throttle_.try_acquire(util::detail::rdtscp())) {
+                break;
+            }
+            (void)transmit(throttle_queue_->bytes(*held));
+            throttle_queue_->pop();
+        }
+    }
+
+    /// Discard held messages with seq num <= `seq_num`
+    void drop_held_through(uint32_t seq_num) noexcept {
+        if (!throttle_queue_) return;
+        while (const auto* held = throttle_queue_->front()) {
+            if (held->seq_num > seq_num) break;
+            throttle_queue_->pop();
+        }
+    }
+
+    /// Store a message for potential resend (before actual send)
+    void store_outbound(std::span<const char> msg) noexcept {
+        // Callers have already consumed the seq num via next_outbound(),
+        // so the message carries the one just before current_outbound()
+        const uint32_t seq_num = sequences_.current_outbound() - 1;
         if (message_store_) {
-            // Get sequence number from message for storage key
-            uint32_t seq_num = sequences_.current_outbound();
-            message_store_->store(seq_num, msg);
+            (void)message_store_->store(seq_num, msg);
+        }
+        audit(AuditDirection::Outbound, seq_num, msg);
+    }
+
+    /// Handlers may tap every parsed inbound and every stored outbound
+    /// message through on_audit() (e.g. into an AuditTap); replays are not
+    /// tapped again. `msg` is only valid for the call.
+    void audit(AuditDirection direction, uint32_t seq_num, std::span<const char> msg) noexcept {
+        if constexpr (requires { handler_.on_audit(direction, seq_num, msg); }) {
+            handler_.on_audit(direction, seq_num, msg);
+        }
+    }
+
+    /// Write a stored message now (or into the open batch)
+    bool transmit(std::span<const char> msg) noexcept {
+        if (batch_active_) {
+            return append_to_batch(msg);
         }
 
-        bool sent = callbacks_.on_send(msg);
+        bool sent = handler_.on_send(msg);
         if (sent) {
             heartbeat_timer_.message_sent();
             ++stats_.messages_sent;
@@ -582,8 +1710,108 @@ private:
         return sent;
     }
 
+    /// Replay a stored message. Into an open batch it is rewritten at the
+    /// batch tail, so the stored bytes are copied once, into the write.
+    void replay_stored(std::span<const char> stored, const store::MessageMeta& meta,
+                       std::string_view resend_time) noexcept {
+        const size_t need = ResendRewriter::max_rewritten_size(stored.size(), resend_time);
+        if (batch_active_ && need <= OUTBOUND_BATCH_CAPACITY) {
+            if (batch_len_ + need > OUTBOUND_BATCH_CAPACITY) (void)flush_batch();
+            if (!batch_buffer_) [[unlikely]] batch_buffer_ = make_owned<BatchBuffer>();
+            if (batch_buffer_) [[likely]] {
+                auto rewritten = ResendRewriter::rewrite_into(
+                    std::span<char>{batch_buffer_->data() + batch_len_,
+                                    OUTBOUND_BATCH_CAPACITY - batch_len_},
+                    stored, meta, resend_time);
+                if (rewritten) {
+                    batch_len_ += rewritten->size();
+                    ++batch_count_;
+                    return;
+                }
+            }
+        }
+
+        auto rewritten = rewrite_for_resend(stored, meta, resend_time);
+        // Unparseable stored bytes are replayed unchanged
+        send_resent(rewritten ? *rewritten : stored);
+    }
+
+    /// Send a replayed message (already stored, never re-stored)
+    void send_resent(std::span<const char> msg) noexcept {
+        if (batch_active_) {
+            (void)append_to_batch(msg);
+            return;
+        }
+
+        if (handler_.on_send(msg)) {
+            ++stats_.messages_sent;
+            stats_.bytes_sent += msg.size();
+        }
+    }
+
+    /// Queue an already-stored message into the open batch
+    bool append_to_batch(std::span<const char> msg) noexcept {
+        if (batch_len_ + msg.size() > OUTBOUND_BATCH_CAPACITY) {
+            if (!flush_batch()) return false;
+        }
+
+        if (!batch_buffer_) [[unlikely]] batch_buffer_ = make_owned<BatchBuffer>();
+
+        // Larger than the whole batch buffer (or none could be allocated):
+        // write it on its own, in order
+        if (msg.size() > OUTBOUND_BATCH_CAPACITY || !batch_buffer_) [[unlikely]] {
+            bool sent = handler_.on_send(msg);
+            if (sent) {
+                heartbeat_timer_.message_sent();
+                ++stats_.messages_sent;
+                stats_.bytes_sent += msg.size();
+            }
+            return sent;
+        }
+
+        std::memcpy(batch_buffer_->data() + batch_len_, msg.data(), msg.size());
+        batch_len_ += msg.size();
+        ++batch_count_;
+        return true;
+    }
+
+    /// Write the batch buffer with one on_send() call
+    bool flush_batch() noexcept {
+        if (batch_len_ == 0) return true;
+
+        std::span<const char> data{batch_buffer_->data(), batch_len_};
+        size_t count = batch_count_;
+        batch_len_ = 0;
+        batch_count_ = 0;
+
+        if (!can_send() || !handler_.on_send(data)) {
+            return false;
+        }
+
+        heartbeat_timer_.message_sent();
+        stats_.messages_sent += count;
+        stats_.bytes_sent += data.size();
+        ++stats_.batches_flushed;
+        return true;
+    }
+
+    /// Send SequenceReset-GapFill covering [range.begin_seq, range.new_seq_no)
+    void send_gap_fill(const GapFillRange& range, std::string_view resend_time) noexcept {
+        auto msg = typename Version::SequenceReset::Builder{}
+            .sender_comp_id(config_.sender_comp_id)
+            .target_comp_id(config_.target_comp_id)
+            .msg_seq_num(range.begin_seq)
+            .sending_time(resend_time)
+            .new_seq_no(range.new_seq_no)
+            .gap_fill_flag(true)
+            .build(assembler_);
+
+        auto marked = rewrite_for_resend(msg, resend_time);
+        send_resent(marked ? *marked : msg);
+    }
+
     void send_heartbeat(std::string_view test_req_id = "") noexcept {
-        auto msg = fix44::Heartbeat::Builder{}
+        auto msg = typename Version::Heartbeat::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
@@ -601,7 +1829,7 @@ private:
         auto len = std::snprintf(id_buf, sizeof(id_buf), "TEST%lu",
             static_cast<unsigned long>(stats_.test_requests_sent + 1));
 
-        auto msg = fix44::TestRequest::Builder{}
+        auto msg = typename Version::TestRequest::Builder{}
             .sender_comp_id(config_.sender_comp_id)
             .target_comp_id(config_.target_comp_id)
             .msg_seq_num(sequences_.next_outbound())
@@ -621,22 +1849,104 @@ private:
     [[nodiscard]] std::string_view current_timestamp() noexcept {
         // RDTSC-based timestamp: ~10ns hot path (no syscall)
         // Periodic calibration (~200ns) once per second to prevent drift
-        return timestamp_generator_.get();
+        return std::visit([](auto& generator) { return generator.get(); },
+                          timestamp_generator_);
+    }
+
+    using TimestampGenerator = std::variant<
+        util::RdtscTimestamp, util::RdtscTimestampUs, util::RdtscTimestampNs>;
+
+    [[nodiscard]] static TimestampGenerator make_timestamp_generator(
+        TimestampPrecision precision) noexcept {
+        switch (precision) {
+            case TimestampPrecision::Microseconds:
+                return TimestampGenerator{std::in_place_type<util::RdtscTimestampUs>};
+            case TimestampPrecision::Nanoseconds:
+                return TimestampGenerator{std::in_place_type<util::RdtscTimestampNs>};
+            case TimestampPrecision::Milliseconds:
+                break;
+        }
+        return TimestampGenerator{std::in_place_type<util::RdtscTimestamp>};
     }
 
     // ========================================================================
     // Member Variables
     // ========================================================================
 
+    // Declared first so that everything allocated from it goes before it
+    [[no_unique_address]] HeapPtr heap_;
+    std::pmr::memory_resource* resource_;     // heap_ or the global heap
+
     SessionConfig config_;
     SessionState state_;
-    SessionCallbacks callbacks_;
     HeartbeatTimer heartbeat_timer_;
     MessageAssembler assembler_;
     SequenceManager sequences_;
     SessionStats stats_;
-    util::RdtscTimestamp timestamp_generator_;  // RDTSC-based: ~10ns vs ~50ns chrono
+    RxTimestamp rx_timestamp_{};
+    TimestampGenerator timestamp_generator_;  // RDTSC-based: ~10ns vs ~50ns chrono
     store::IMessageStore* message_store_{nullptr};
+    ResourcePtr<store::MemoryMessageStore> owned_store_{nullptr, ResourceDelete{resource_}};
+    ResourcePtr<ResendRewriter> resend_rewriter_{nullptr, ResourceDelete{resource_}};  // Allocated on first resend
+    ResourcePtr<OrderTemplates> templates_{nullptr, ResourceDelete{resource_}};  // Prepared on each transition to Active
+    Handler handler_;
+    IndexedParser inbound_;                   // Message being dispatched
+    char peer_appl_ver_id_{Version::DEFAULT_APPL_VER_ID};  // Set at Logon
+
+    // Message straddling on_bytes() chunks
+    ResourcePtr<ReassemblyBuffer> partial_{nullptr, ResourceDelete{resource_}};
+    size_t partial_len_{0};
+
+#if NFX_LATENCY_PROBES
+    uint64_t probe_parsed_tsc_{0};            // Parse end of the message in dispatch
+#endif
+#if NFX_EVENT_TRACE
+    uint16_t trace_session_{util::TraceRegistry::next_session()};  // Session tag in trace records
+    uint64_t trace_recv_tsc_{0};              // Receive stamp of the message in dispatch
+#endif
+
+    HeartbeatTimer::TimePoint logon_sent_at_{};  // Logon timeout start
+
+    // Idle cache warming (see shadow_send())
+    uint64_t shadow_mark_{0};                 // messages_sent at the last check
+    std::chrono::steady_clock::time_point last_shadow_{};
+
+    // Outbound batch (see begin_batch()/flush())
+    ResourcePtr<BatchBuffer> batch_buffer_{nullptr, ResourceDelete{resource_}};  // Allocated on first batched write
+    size_t batch_len_{0};
+    size_t batch_count_{0};
+    bool batch_active_{false};
+
+    // Outbound throttle (see admit_app_message()); queue allocated on first hold
+    TokenBucket app_throttle_;
+    ResourcePtr<ThrottleQueue> throttle_queue_{nullptr, ResourceDelete{resource_}};
+
+    // Inbound gap recovery (see hold_out_of_order()); buffer allocated on first hold
+    ResourcePtr<ReorderBuffer> reorder_{nullptr, ResourceDelete{resource_}};
+
+    // Application callback scratch (see message_scratch())
+    ResourcePtr<MessageScratch> scratch_{nullptr, ResourceDelete{resource_}};
+    uint32_t gap_requested_through_{0};       // Highest seq num requested or held
+
+    /// ResendRequest range being replayed (see continue_resend())
+    struct ResendStream {
+        uint32_t next;              // First seq num not yet visited
+        uint32_t stop;              // Last seq num sent before the request
+        uint32_t end;               // EndSeqNo (0 = infinity)
+        uint32_t end_seq;           // First seq num past the range
+        uint32_t begin;             // BeginSeqNo, for the fallback reset
+        GapFillCoalescer coalescer;
+        size_t visited{0};          // Stored messages found so far
+        size_t sent{0};             // Replays and GapFills sent so far
+    };
+    std::optional<ResendStream> resend_;      // Set while a resend streams
+
+    // Idle compaction (see note_idle_heartbeat())
+    uint64_t idle_traffic_mark_{0};           // Non-heartbeat messages at the last heartbeat
+    uint32_t idle_heartbeats_{0};
 };
 
+/// Session manager dispatching through SessionCallbacks
+using SessionManager = BasicSessionManager<CallbackSessionHandler>;
+
 } // namespace nfx
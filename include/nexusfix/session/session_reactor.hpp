@@ -0,0 +1,741 @@
+/*
+    NexusFIX Session Reactor
+
+    Drives many FIX sessions from a single io_uring ring on one thread.
+    Run one reactor per core; each owns its ring and a ProvidedBufferGroup
+    shared by the multishot receives of all its sockets.
+
+    Completions are demultiplexed by user_data, which packs the operation,
+    the session slot and a slot generation (so late CQEs of a removed
+    session are dropped). Complete messages are framed per session and
+    handed to the session's callback - in place from the kernel-selected
+    buffer when nothing is pending, otherwise after reassembly of the
+    partial message.
+
+    Timers: tick() runs on_timer_tick() only for sessions with a deadline
+    due, off a timer wheel (timer_wheel.hpp) keyed by each session's
+    next_timer_due(), so thousands of idle sessions cost nothing per tick.
+
+    Syscalls: run_once() submits every queued SQE (sends, buffer
+    replenishes, re-armed receives) and reaps completions in a single
+    io_uring_enter. There is no thread and no extra syscall per session.
+
+    Acceptors: add_listener() arms a multishot accept on a listening
+    socket (one SQE accepts every connection), and add_connection()
+    registers a socket before its session is known. Its messages go to
+    the unbound handler until bind_session() attaches a SessionManager,
+    e.g. once the Logon's CompIDs identify the counterparty.
+
+    Threading: all calls must come from the thread that called init()
+    (the ring is set up SINGLE_ISSUER where supported).
+
+    Usage:
+        SessionReactor reactor;
+        reactor.init();
+        auto handle = reactor.add_session(fd, session);
+        callbacks.on_send = reactor.sender(*handle);
+        session.set_callbacks(std::move(callbacks));
+        while (running) {
+            reactor.run_once(100);
+            reactor.tick();
+        }
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/parser/simd_scanner.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/session/timer_wheel.hpp"
+#include "nexusfix/transport/io_uring_transport.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/util/latency_histogram.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+#if NFX_PLATFORM_POSIX
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace nfx {
+
+#if NFX_IO_URING_AVAILABLE
+
+// ============================================================================
+// Reactor Configuration
+// ============================================================================
+
+/// Configuration for SessionReactor
+struct SessionReactorConfig {
+    /// Submission queue depth (CQ ring is twice this)
+    unsigned queue_depth{4096};
+
+    /// Provided buffers shared by all multishot receives
+    size_t num_recv_buffers{1024};
+    size_t recv_buffer_size{4096};
+    uint16_t buffer_group_id{0};
+    bool huge_page_buffers{false};  // Prefaulted huge pages (THP fallback)
+
+    /// Per-session reassembly capacity for messages split across receives
+    size_t inbound_buffer_size{fix::MAX_MESSAGE_SIZE};
+
+    /// Maximum completions reaped per run_once()
+    unsigned max_cqes_per_poll{256};
+
+    /// Core to pin the reactor thread to in init() (-1 = no pinning)
+    int cpu_core{-1};
+
+    /// NUMA node for the receive buffers (-1 = node of cpu_core, if known)
+    int numa_node{-1};
+
+    /// Resolution of the timer wheel driving on_timer_tick() from tick()
+    std::chrono::milliseconds timer_resolution{10};
+
+    /// Longest a session goes without on_timer_tick() while no deadline is
+    /// due (bounds how late e.g. a Logon sent since is noticed)
+    std::chrono::milliseconds timer_max_delay{1000};
+};
+
+/// Handle identifying a session registered with a reactor
+struct ReactorSessionHandle {
+    uint32_t slot;
+    uint32_t generation;
+};
+
+// ============================================================================
+// Session Reactor
+// ============================================================================
+
+/// Single-ring event loop for many FIX sessions
+class SessionReactor {
+public:
+    /// Receives each complete inbound message of one session
+    using MessageHandler = std::function<void(std::span<const char>)>;
+
+    /// Notified when a session's connection closes or fails
+    /// (error is 0 on orderly shutdown by the peer, else an errno)
+    using CloseHandler = std::function<void(ReactorSessionHandle, int error)>;
+
+    /// Receives each connection accepted by a listener (the fd is the handler's)
+    using AcceptHandler = std::function<void(int fd)>;
+
+    /// Receives the messages of connections not yet bound to a session
+    using UnboundHandler = std::function<void(ReactorSessionHandle, std::span<const char>)>;
+
+    static constexpr size_t OUTBOUND_BUFFER_SIZE = 65536;
+
+    SessionReactor() noexcept = default;
+    explicit SessionReactor(const SessionReactorConfig& config) noexcept
+        : config_{config} {}
+
+    // Non-copyable, non-movable (slots are referenced from SQE user_data)
+    SessionReactor(const SessionReactor&) = delete;
+    SessionReactor& operator=(const SessionReactor&) = delete;
+
+    /// Set up the ring and the shared receive buffers
+    /// Call from the thread that will run the loop.
+    [[nodiscard]] TransportResult<void> init() noexcept {
+        if (config_.cpu_core >= 0) {
+            (void)util::CpuAffinity::pin_to_core(config_.cpu_core);
+        }
+
+        auto result = ctx_.init(config_.queue_depth);
+        if (!result) return result;
+
+        if (!recv_buffers_.init(ctx_, config_.buffer_group_id,
+                                config_.recv_buffer_size, config_.num_recv_buffers,
+                                config_.huge_page_buffers, buffer_numa_node())) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+        }
+
+        cqes_.resize(config_.max_cqes_per_poll);
+
+        util::RdtscClock::initialize();
+        timers_ = std::make_unique<TimerWheel>(
+            config_.timer_resolution, util::RdtscClock::frequency_ghz(), util::detail::rdtscp());
+        timers_->set_max_delay(config_.timer_max_delay);
+        return {};
+    }
+
+    // ========================================================================
+    // Session Registration
+    // ========================================================================
+
+    /// Register a connected socket and arm its multishot receive
+    /// @param fd Connected socket (ownership stays with the caller)
+    /// @param session Session fed with inbound messages
+    /// @param on_message Optional handler replacing session.on_data_received()
+    [[nodiscard]] TransportResult<ReactorSessionHandle> add_session(
+        int fd,
+        SessionManager& session,
+        MessageHandler on_message = {}) noexcept
+    {
+        auto handle = register_slot(fd, &session, std::move(on_message));
+        if (handle) session.on_connect();
+        return handle;
+    }
+
+    /// Register a connected socket with no session yet; its messages go to
+    /// the unbound handler until bind_session()
+    [[nodiscard]] TransportResult<ReactorSessionHandle> add_connection(int fd) noexcept {
+        return register_slot(fd, nullptr, {});
+    }
+
+    /// Attach a session to a connection from add_connection() and connect
+    /// it; the rest of the current receive is already delivered to it
+    /// @return false if the connection is gone or already bound
+    bool bind_session(ReactorSessionHandle handle, SessionManager& session) noexcept {
+        if (!is_live(handle) || slots_[handle.slot]->session != nullptr) return false;
+        slots_[handle.slot]->session = &session;
+        session.on_connect();
+        schedule_tick(handle);
+        return true;
+    }
+
+    /// Set handler for messages of unbound connections
+    void set_unbound_handler(UnboundHandler handler) noexcept {
+        on_unbound_ = std::move(handler);
+    }
+
+    /// Stop serving a session; in-flight operations are cancelled
+    /// The fd is not closed and the slot is reused once they complete.
+    void remove_session(ReactorSessionHandle handle) noexcept {
+        if (!is_live(handle)) return;
+        retire_slot(handle.slot);
+    }
+
+    /// Set handler for connections closed by the peer or by errors
+    void set_close_handler(CloseHandler handler) noexcept {
+        on_close_ = std::move(handler);
+    }
+
+    // ========================================================================
+    // Listeners
+    // ========================================================================
+
+    /// Accept connections on a listening socket with a multishot accept
+    /// (single-shot accepts re-armed per connection on kernels before 5.19)
+    /// @param listen_fd Listening socket (ownership stays with the caller)
+    /// @return false if no SQE was available
+    [[nodiscard]] bool add_listener(int listen_fd, AcceptHandler on_accept) noexcept {
+        if (!ctx_.is_initialized()) return false;
+        const auto index = static_cast<uint32_t>(listeners_.size());
+        listeners_.push_back(Listener{listen_fd, std::move(on_accept)});
+        if (!arm_accept(index)) {
+            listeners_.pop_back();
+            return false;
+        }
+        return true;
+    }
+
+    /// Stop accepting on every listener (pending accepts are cancelled)
+    void remove_listeners() noexcept {
+        for (uint32_t i = 0; i < listeners_.size(); ++i) {
+            Listener& listener = listeners_[i];
+            if (!listener.active) continue;
+            listener.active = false;
+            if (!listener.armed) continue;
+            if (auto* sqe = ctx_.get_sqe()) {
+                io_uring_prep_cancel64(sqe, pack_accept(Op::Accept, i), 0);
+                io_uring_sqe_set_data64(sqe, pack_accept(Op::CancelAccept, i));
+            }
+        }
+    }
+
+    // ========================================================================
+    // Outbound
+    // ========================================================================
+
+    /// Queue bytes for a session; submitted by the next run_once()/flush()
+    /// @return false if the session is gone or its outbound buffer is full
+    [[nodiscard]] NFX_HOT
+    bool send(ReactorSessionHandle handle, std::span<const char> data) noexcept {
+        if (!is_live(handle)) [[unlikely]] return false;
+
+        Slot& slot = *slots_[handle.slot];
+        if (slot.outbound->available() < data.size()) [[unlikely]] {
+            return false;  // Backpressure: never send a partial message
+        }
+        (void)slot.outbound->write(data);
+
+        if (slot.send_in_flight == 0) {
+            arm_send(handle.slot);
+        }
+        return true;
+    }
+
+    /// SessionCallbacks::on_send bound to a registered session
+    [[nodiscard]] std::function<bool(std::span<const char>)> sender(
+        ReactorSessionHandle handle) noexcept
+    {
+        return [this, handle](std::span<const char> data) {
+            return send(handle, data);
+        };
+    }
+
+    // ========================================================================
+    // Event Loop
+    // ========================================================================
+
+    /// Submit queued SQEs and process completions, in one syscall
+    /// @param timeout_ms Wait for at least one completion (-1 = forever,
+    ///                   0 = poll without blocking)
+    /// @return Completions processed, or negative errno
+    int run_once(int timeout_ms = -1) noexcept {
+        struct io_uring* ring = ctx_.ring();
+        struct io_uring_cqe* cqe = nullptr;
+
+        int ret;
+        if (timeout_ms < 0) {
+            ret = io_uring_submit_and_wait(ring, 1);
+        } else {
+            struct __kernel_timespec ts;
+            ts.tv_sec = timeout_ms / 1000;
+            ts.tv_nsec = (timeout_ms % 1000) * 1000000;
+            ret = io_uring_submit_and_wait_timeout(ring, &cqe, 1, &ts, nullptr);
+        }
+        if (ret < 0 && ret != -ETIME && ret != -EINTR) [[unlikely]] {
+            return ret;
+        }
+
+        unsigned count = io_uring_peek_batch_cqe(ring, cqes_.data(),
+                                                 static_cast<unsigned>(cqes_.size()));
+        for (unsigned i = 0; i < count; ++i) {
+            dispatch(cqes_[i]);
+        }
+        io_uring_cq_advance(ring, count);
+
+        return static_cast<int>(count);
+    }
+
+    /// Submit queued SQEs without waiting
+    int flush() noexcept {
+        return ctx_.submit();
+    }
+
+    /// Drive heartbeats and timeouts: on_timer_tick() runs only for the
+    /// sessions whose next_timer_due() has come, each then rescheduled on
+    /// the reactor's timer wheel. Call at least every timer_resolution.
+    void tick() noexcept {
+        if (!timers_) return;
+        timers_->advance(util::detail::rdtscp(), [this](TimerNode& node) {
+            Slot& slot = *slots_[node.user_data];
+            if (!slot.active || !slot.session) return;
+            slot.session->on_timer_tick();
+            timers_->schedule(node, timers_->ticks_for(slot.session->next_timer_due()));
+        });
+    }
+
+    /// Run a session's on_timer_tick() on the next tick(), e.g. after
+    /// initiate_logon() or a message held by the throttle
+    void schedule_tick(ReactorSessionHandle handle) noexcept {
+        if (!timers_ || !is_live(handle)) return;
+        timers_->schedule(slots_[handle.slot]->timer, 0);
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    [[nodiscard]] size_t session_count() const noexcept { return active_sessions_; }
+    [[nodiscard]] uint64_t accepted() const noexcept { return accepted_; }
+    [[nodiscard]] IoUringContext& context() noexcept { return ctx_; }
+    [[nodiscard]] const SessionReactorConfig& config() const noexcept { return config_; }
+
+    /// Session behind a handle, or nullptr if it was removed or is unbound
+    [[nodiscard]] SessionManager* session(ReactorSessionHandle handle) noexcept {
+        return is_live(handle) ? slots_[handle.slot]->session : nullptr;
+    }
+
+private:
+    /// Receive buffers live on the configured node, else the reactor core's
+    [[nodiscard]] int buffer_numa_node() const noexcept {
+        if (config_.numa_node >= 0) return config_.numa_node;
+        return util::NumaTopology::node_of_cpu(config_.cpu_core);
+    }
+
+    // ========================================================================
+    // user_data Encoding
+    // ========================================================================
+    // [63:56] operation | [55:32] slot generation | [31:0] slot index
+    // Listener operations: [63:56] operation | [31:0] listener index
+
+    enum class Op : uint8_t { Recv = 1, Send = 2, Cancel = 3, Accept = 4, CancelAccept = 5 };
+
+    struct Listener {
+        int fd{-1};
+        AcceptHandler on_accept;
+        bool active{true};
+        bool armed{false};
+        bool multishot{true};
+    };
+
+    struct Slot {
+        uint32_t index{0};
+        int fd{-1};
+        SessionManager* session{nullptr};
+        MessageHandler on_message;
+        uint32_t generation{0};
+        uint32_t pending_ops{0};      // SQEs whose final CQE is outstanding
+        size_t send_in_flight{0};     // Bytes of the outstanding send
+        bool active{false};
+        bool recv_armed{false};       // Multishot receive outstanding
+        std::vector<char> inbound;    // Partial message awaiting more bytes
+        size_t inbound_len{0};
+        std::unique_ptr<RingBuffer<OUTBOUND_BUFFER_SIZE>> outbound;
+        TimerNode timer;              // On timers_ while a session is bound
+#if NFX_LATENCY_PROBES
+        uint64_t send_tsc{0};         // Outstanding send's submission stamp
+#endif
+    };
+
+    static constexpr uint32_t GENERATION_MASK = 0xFFFFFF;
+
+    [[nodiscard]] uint64_t pack(Op op, uint32_t index) const noexcept {
+        return (static_cast<uint64_t>(op) << 56) |
+               (static_cast<uint64_t>(slots_[index]->generation & GENERATION_MASK) << 32) |
+               index;
+    }
+
+    [[nodiscard]] static uint64_t pack_accept(Op op, uint32_t listener) noexcept {
+        return (static_cast<uint64_t>(op) << 56) | listener;
+    }
+
+    [[nodiscard]] bool is_live(ReactorSessionHandle handle) const noexcept {
+        return handle.slot < slots_.size() &&
+               slots_[handle.slot]->active &&
+               slots_[handle.slot]->generation == handle.generation;
+    }
+
+    // ========================================================================
+    // Submission
+    // ========================================================================
+
+    [[nodiscard]] TransportResult<ReactorSessionHandle> register_slot(
+        int fd,
+        SessionManager* session,
+        MessageHandler on_message) noexcept
+    {
+        if (!ctx_.is_initialized()) {
+            return std::unexpected{TransportError{TransportErrorCode::NotConnected}};
+        }
+
+        uint32_t index;
+        if (!free_slots_.empty()) {
+            index = free_slots_.back();
+            free_slots_.pop_back();
+        } else {
+            index = static_cast<uint32_t>(slots_.size());
+            slots_.push_back(std::make_unique<Slot>());
+            slots_.back()->index = index;
+            slots_.back()->timer.user_data = index;
+        }
+
+        Slot& slot = *slots_[index];
+        slot.fd = fd;
+        slot.session = session;
+        slot.on_message = std::move(on_message);
+        slot.active = true;
+        slot.send_in_flight = 0;
+        slot.inbound_len = 0;
+        slot.inbound.resize(config_.inbound_buffer_size);
+        if (!slot.outbound) {
+            slot.outbound = std::make_unique<RingBuffer<OUTBOUND_BUFFER_SIZE>>();
+        }
+        slot.outbound->clear();
+        if (session) timers_->schedule(slot.timer, 0);
+        ++active_sessions_;
+
+        if (!arm_recv(index)) {
+            retire_slot(index);
+            return std::unexpected{TransportError{TransportErrorCode::SocketError, EBUSY}};
+        }
+        return ReactorSessionHandle{index, slot.generation};
+    }
+
+    [[nodiscard]] bool arm_accept(uint32_t index) noexcept {
+        auto* sqe = ctx_.get_sqe();
+        if (!sqe) [[unlikely]] return false;
+
+        Listener& listener = listeners_[index];
+        if (listener.multishot) {
+            io_uring_prep_multishot_accept(sqe, listener.fd, nullptr, nullptr, SOCK_CLOEXEC);
+        } else {
+            io_uring_prep_accept(sqe, listener.fd, nullptr, nullptr, SOCK_CLOEXEC);
+        }
+        io_uring_sqe_set_data64(sqe, pack_accept(Op::Accept, index));
+        listener.armed = true;
+        return true;
+    }
+
+    [[nodiscard]] bool arm_recv(uint32_t index) noexcept {
+        auto* sqe = ctx_.get_sqe();
+        if (!sqe) [[unlikely]] return false;
+
+        io_uring_prep_recv(sqe, slots_[index]->fd, nullptr, 0, 0);
+        sqe->flags |= IOSQE_BUFFER_SELECT;
+        sqe->buf_group = recv_buffers_.group_id();
+        sqe->ioprio |= IORING_RECV_MULTISHOT;
+        io_uring_sqe_set_data64(sqe, pack(Op::Recv, index));
+
+        ++slots_[index]->pending_ops;
+        slots_[index]->recv_armed = true;
+        return true;
+    }
+
+    void arm_send(uint32_t index) noexcept {
+        Slot& slot = *slots_[index];
+        auto data = slot.outbound->read_span();
+        if (data.empty()) return;
+
+        auto* sqe = ctx_.get_sqe();
+        if (!sqe) [[unlikely]] return;  // Retried on the next send completion
+
+        io_uring_prep_send(sqe, slot.fd, data.data(), data.size(), MSG_NOSIGNAL);
+        io_uring_sqe_set_data64(sqe, pack(Op::Send, index));
+
+        slot.send_in_flight = data.size();
+        ++slot.pending_ops;
+#if NFX_LATENCY_PROBES
+        slot.send_tsc = util::probe_tsc();
+#endif
+    }
+
+    // ========================================================================
+    // Completion Dispatch
+    // ========================================================================
+
+    NFX_HOT
+    void dispatch(struct io_uring_cqe* cqe) noexcept {
+        const uint64_t data = io_uring_cqe_get_data64(cqe);
+        const auto op = static_cast<Op>(data >> 56);
+        const auto generation = static_cast<uint32_t>(data >> 32) & GENERATION_MASK;
+        const auto index = static_cast<uint32_t>(data);
+
+        if (op == Op::Accept) {
+            if (index < listeners_.size()) on_accept(index, cqe);
+            return;
+        }
+
+        // Buffer replenishes complete with user_data 0
+        if (op != Op::Recv && op != Op::Send && op != Op::Cancel) return;
+        if (index >= slots_.size()) [[unlikely]] return;
+
+        Slot& slot = *slots_[index];
+        const bool current = (slot.generation & GENERATION_MASK) == generation;
+        const bool last = !ProvidedBufferGroup::has_more(cqe->flags);
+
+        if (op == Op::Recv) {
+            on_recv(index, cqe, current && slot.active);
+        } else if (op == Op::Send) {
+            on_send(index, cqe->res, current && slot.active);
+        }
+
+        if (last && current) {
+            --slot.pending_ops;
+            if (!slot.active && slot.pending_ops == 0) {
+                release_slot(index);
+            }
+        }
+    }
+
+    NFX_HOT
+    void on_recv(uint32_t index, struct io_uring_cqe* cqe, bool live) noexcept {
+        Slot& slot = *slots_[index];
+        const int res = cqe->res;
+
+        if (ProvidedBufferGroup::has_buffer(cqe->flags)) {
+            const uint16_t buf_id = ProvidedBufferGroup::buffer_id_from_cqe(cqe->flags);
+            if (live && res > 0) {
+#if NFX_LATENCY_PROBES || NFX_EVENT_TRACE
+                util::detail::probe_recv_tsc = util::probe_tsc();
+#endif
+                deliver(slot, {recv_buffers_.buffer(buf_id), static_cast<size_t>(res)});
+#if NFX_LATENCY_PROBES || NFX_EVENT_TRACE
+                util::detail::probe_recv_tsc = 0;
+#endif
+            }
+            (void)recv_buffers_.replenish(buf_id);
+        }
+
+        if (ProvidedBufferGroup::has_more(cqe->flags)) return;
+        slot.recv_armed = false;
+        if (!live) return;
+
+        // Multishot ended: buffer group ran dry (re-arm) or connection closed
+        if (res == -ENOBUFS || res > 0) {
+            if (arm_recv(index)) return;
+        }
+        close_slot(index, res < 0 ? -res : 0);
+    }
+
+    void on_accept(uint32_t index, struct io_uring_cqe* cqe) noexcept {
+        Listener& listener = listeners_[index];
+        const int res = cqe->res;
+        const bool more = (cqe->flags & IORING_CQE_F_MORE) != 0;
+
+        if (res >= 0) {
+            if (listener.active && listener.on_accept) {
+                ++accepted_;
+                listener.on_accept(res);
+            } else {
+                ::close(res);
+            }
+        }
+        if (more) return;
+
+        listener.armed = false;
+        if (!listener.active || res == -ECANCELED || res == -EBADF) return;
+        if (res == -EINVAL && listener.multishot) {
+            listener.multishot = false;  // Kernel without multishot accept
+        }
+        (void)arm_accept(index);  // Also after EMFILE / ENFILE: retried per completion
+    }
+
+    void on_send(uint32_t index, int res, bool live) noexcept {
+        Slot& slot = *slots_[index];
+        slot.send_in_flight = 0;
+        NFX_PROBE_RECORD(SendToCompletion, slot.send_tsc);
+        if (!live) return;
+
+        if (res < 0) [[unlikely]] {
+            close_slot(index, -res);
+            return;
+        }
+
+        slot.outbound->skip(static_cast<size_t>(res));
+        arm_send(index);  // Remainder, wrapped data or messages queued meanwhile
+    }
+
+    /// Frame complete messages out of received bytes
+    NFX_HOT
+    void deliver(Slot& slot, std::span<const char> data) noexcept {
+        std::span<const char> stream = data;
+
+        // Complete the pending partial message first
+        if (slot.inbound_len > 0) {
+            const size_t space = slot.inbound.size() - slot.inbound_len;
+            const size_t n = std::min(space, data.size());
+            std::memcpy(slot.inbound.data() + slot.inbound_len, data.data(), n);
+            slot.inbound_len += n;
+
+            std::span<const char> pending{slot.inbound.data(), slot.inbound_len};
+            const size_t pending_before = slot.inbound_len - n;
+            const size_t consumed = deliver_complete(slot, pending);
+            if (consumed == 0) {
+                if (slot.inbound_len == slot.inbound.size()) [[unlikely]] {
+                    slot.inbound_len = 0;  // Larger than any valid message: drop
+                }
+                return;
+            }
+
+            // Bytes of data beyond the reassembled messages are scanned in place
+            slot.inbound_len = 0;
+            if (!slot.active) return;
+            stream = data.subspan(consumed > pending_before ? consumed - pending_before : 0);
+        }
+
+        const size_t consumed = deliver_complete(slot, stream);
+        const size_t rest = stream.size() - consumed;
+        if (rest > 0) {
+            const size_t keep = std::min(rest, slot.inbound.size());
+            std::memcpy(slot.inbound.data(), stream.data() + consumed, keep);
+            slot.inbound_len = keep;
+        }
+    }
+
+    /// Hand every complete message to the session
+    /// @return Bytes up to the end of the last complete message
+    NFX_HOT
+    size_t deliver_complete(Slot& slot, std::span<const char> data) noexcept {
+        size_t pos = 0;
+        while (pos < data.size()) {
+            auto boundary = simd::find_message_boundary(data, pos);
+            if (!boundary.complete) break;
+
+            auto msg = data.subspan(boundary.start, boundary.end - boundary.start);
+            if (slot.on_message) {
+                slot.on_message(msg);
+            } else if (slot.session) [[likely]] {
+                slot.session->on_data_received(msg);
+            } else if (on_unbound_) {
+                on_unbound_(ReactorSessionHandle{slot.index, slot.generation}, msg);
+            }
+            pos = boundary.end;
+
+            if (!slot.active) break;  // Handler removed the session
+        }
+        return pos;
+    }
+
+    // ========================================================================
+    // Slot Lifecycle
+    // ========================================================================
+
+    void close_slot(uint32_t index, int error) noexcept {
+        Slot& slot = *slots_[index];
+        if (!slot.active) return;
+
+        const ReactorSessionHandle handle{index, slot.generation};
+        if (slot.session) slot.session->on_disconnect();
+        retire_slot(index);
+
+        if (on_close_) on_close_(handle, error);
+    }
+
+    void retire_slot(uint32_t index) noexcept {
+        Slot& slot = *slots_[index];
+
+        // Cancel the multishot receive; its final CQE releases the slot
+        if (slot.recv_armed) {
+            if (auto* sqe = ctx_.get_sqe()) {
+                io_uring_prep_cancel64(sqe, pack(Op::Recv, index), 0);
+                io_uring_sqe_set_data64(sqe, pack(Op::Cancel, index));
+                ++slot.pending_ops;
+            }
+        }
+
+        slot.active = false;
+        timers_->cancel(slot.timer);
+        --active_sessions_;
+        if (slot.pending_ops == 0) {
+            release_slot(index);
+        }
+    }
+
+    void release_slot(uint32_t index) noexcept {
+        Slot& slot = *slots_[index];
+        slot.fd = -1;
+        slot.session = nullptr;
+        slot.on_message = nullptr;
+        slot.inbound_len = 0;
+        ++slot.generation;
+        free_slots_.push_back(index);
+    }
+
+    SessionReactorConfig config_{};
+    IoUringContext ctx_;
+    ProvidedBufferGroup recv_buffers_;
+    std::vector<std::unique_ptr<Slot>> slots_;
+    std::vector<uint32_t> free_slots_;
+    std::unique_ptr<TimerWheel> timers_;      // Session timers (see tick())
+    std::vector<struct io_uring_cqe*> cqes_;
+    std::vector<Listener> listeners_;
+    CloseHandler on_close_;
+    UnboundHandler on_unbound_;
+    size_t active_sessions_{0};
+    uint64_t accepted_{0};
+};
+
+#endif  // NFX_IO_URING_AVAILABLE
+
+} // namespace nfx
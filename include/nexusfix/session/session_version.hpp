@@ -0,0 +1,128 @@
+/*
+    NexusFIX Session Version Policies
+
+    Compile-time choice of the session layer's protocol: BeginString, the
+    admin message set (Logon, Heartbeat, ...) and ApplVerID handling.
+    BasicSessionManager takes one as its second template argument, so a
+    FIX 5.0 session builds its admin messages through the same inlined,
+    non-virtual path as a FIX 4.4 one; nothing is decided per message.
+
+    - FIX 4.4: BeginString FIX.4.4, fix44:: admin messages, no ApplVerID
+    - FIX 5.0 / SP1 / SP2: BeginString FIXT.1.1, fixt11:: admin messages;
+      our Logon carries DefaultApplVerID (1137) for the application
+      version, and the counterparty's DefaultApplVerID applies to every
+      inbound message without its own ApplVerID (1128)
+
+    Usage:
+        SessionConfig config;
+        config.sender_comp_id = "CLIENT";
+        config.target_comp_id = "VENUE";
+
+        BasicSessionManager<MyHandler> fix44_session{config};
+        BasicSessionManager<MyHandler, Fix50Sp2Session> fix50_session{config};
+
+        // In on_app_message: application version of the message
+        char ver = fix50_session.inbound_appl_ver_id();   // appl_ver_id::FIX_5_0_SP2
+*/
+
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+
+#include "nexusfix/types/fix_version.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/messages/fix44/logon.hpp"
+#include "nexusfix/messages/fix44/heartbeat.hpp"
+#include "nexusfix/messages/fixt11/logon.hpp"
+#include "nexusfix/messages/fixt11/session.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Session Version Policy
+// ============================================================================
+
+namespace detail {
+
+/// ApplVerID (1128) value of an application version
+[[nodiscard]] consteval char appl_ver_of(FixVersion ver) noexcept {
+    switch (ver) {
+        case FixVersion::FIX_4_0: return appl_ver_id::FIX_4_0;
+        case FixVersion::FIX_4_1: return appl_ver_id::FIX_4_1;
+        case FixVersion::FIX_4_2: return appl_ver_id::FIX_4_2;
+        case FixVersion::FIX_4_3: return appl_ver_id::FIX_4_3;
+        case FixVersion::FIX_4_4: return appl_ver_id::FIX_4_4;
+        case FixVersion::FIX_5_0: return appl_ver_id::FIX_5_0;
+        case FixVersion::FIX_5_0_SP1: return appl_ver_id::FIX_5_0_SP1;
+        case FixVersion::FIX_5_0_SP2: return appl_ver_id::FIX_5_0_SP2;
+        default: return '\0';
+    }
+}
+
+} // namespace detail
+
+/// Session layer for application version Ver: FIX 4.4 itself, or FIX 5.0+
+/// over FIXT 1.1
+template <FixVersion Ver>
+struct SessionVersion {
+    static_assert(Ver == FixVersion::FIX_4_4 || Ver == FixVersion::FIX_5_0 ||
+                  Ver == FixVersion::FIX_5_0_SP1 || Ver == FixVersion::FIX_5_0_SP2,
+                  "Session admin messages exist for FIX 4.4 and FIX 5.0+ (FIXT 1.1)");
+
+    static constexpr FixVersion APPL_VERSION = Ver;
+    static constexpr bool IS_FIXT = is_fixt_version<Ver>();
+    static constexpr std::string_view BEGIN_STRING =
+        IS_FIXT ? version_string<FixVersion::FIXT_1_1>() : version_string<Ver>();
+
+    /// DefaultApplVerID (1137) we send at Logon
+    static constexpr char DEFAULT_APPL_VER_ID = detail::appl_ver_of(Ver);
+
+    using Logon = std::conditional_t<IS_FIXT, fixt11::Logon, fix44::Logon>;
+    using Logout = std::conditional_t<IS_FIXT, fixt11::Logout, fix44::Logout>;
+    using Heartbeat = std::conditional_t<IS_FIXT, fixt11::Heartbeat, fix44::Heartbeat>;
+    using TestRequest = std::conditional_t<IS_FIXT, fixt11::TestRequest, fix44::TestRequest>;
+    using ResendRequest = std::conditional_t<IS_FIXT, fixt11::ResendRequest, fix44::ResendRequest>;
+    using SequenceReset = std::conditional_t<IS_FIXT, fixt11::SequenceReset, fix44::SequenceReset>;
+    using Reject = std::conditional_t<IS_FIXT, fixt11::Reject, fix44::Reject>;
+
+    /// Logon builder with the version's DefaultApplVerID set
+    [[nodiscard]] static typename Logon::Builder logon() noexcept {
+        typename Logon::Builder builder{};
+        if constexpr (IS_FIXT) builder.default_appl_ver_id(DEFAULT_APPL_VER_ID);
+        return builder;
+    }
+
+    /// Counterparty's DefaultApplVerID from its Logon, ours if it sent none
+    [[nodiscard]] static char peer_default_appl_ver_id(const IndexedParser& logon) noexcept {
+        if constexpr (IS_FIXT) {
+            const char ver = logon.get_char(tag::DefaultApplVerID::value);
+            return ver != '\0' ? ver : DEFAULT_APPL_VER_ID;
+        } else {
+            return DEFAULT_APPL_VER_ID;
+        }
+    }
+
+    /// Application version of an inbound message: its ApplVerID (1128),
+    /// else the counterparty's default. One scan for FIXT (1128 is above
+    /// the parser's direct index); a constant for FIX 4.4.
+    [[nodiscard]] static char appl_ver_id(const IndexedParser& msg, char peer_default) noexcept {
+        if constexpr (IS_FIXT) {
+            const char ver = msg.get_char(tag::ApplVerID::value);
+            return ver != '\0' ? ver : peer_default;
+        } else {
+            return DEFAULT_APPL_VER_ID;
+        }
+    }
+};
+
+using Fix44Session = SessionVersion<FixVersion::FIX_4_4>;
+using Fix50Session = SessionVersion<FixVersion::FIX_5_0>;
+using Fix50Sp1Session = SessionVersion<FixVersion::FIX_5_0_SP1>;
+using Fix50Sp2Session = SessionVersion<FixVersion::FIX_5_0_SP2>;
+
+static_assert(Fix44Session::BEGIN_STRING == "FIX.4.4");
+static_assert(Fix50Sp2Session::BEGIN_STRING == "FIXT.1.1");
+static_assert(Fix50Sp2Session::DEFAULT_APPL_VER_ID == appl_ver_id::FIX_5_0_SP2);
+
+} // namespace nfx
@@ -0,0 +1,626 @@
+/*
+    NexusFIX Sharded Session Engine
+
+    Thread-per-core deployment of SessionReactor. Each shard is one worker
+    thread pinned to its own core, owning:
+    - a SessionReactor (its own io_uring ring and provided buffers)
+    - the SessionManagers and MemoryMessageStores of its sessions
+    - a mimalloc SessionHeap backing those stores (NFX_HAS_MIMALLOC)
+
+    Nothing on the hot path is shared between shards. A session is only
+    ever touched by its shard's thread; work for it from anywhere else
+    (another shard, the application thread) is posted as a ShardTask into
+    the shard's inbox: one SPSCQueue per producer, so no queue ever has
+    more than one writer.
+
+    Producers: shard i posts with producer index i, from its own thread
+    (i.e. from inside a task or callback). A single application thread
+    posts with external_producer(). Posting from other threads is a
+    data race on the inbox.
+
+    Usage:
+        ShardedSessionEngine engine{ShardedEngineConfig{.num_shards = 4}};
+        engine.start();
+        (void)engine.warmup();   // Before the open: prime every shard
+        auto id = engine.add_session(fd, session_config, callbacks);
+        engine.post(engine.external_producer(), id, [](SessionManager& s) {
+            (void)s.initiate_logon();
+        });
+        ...
+        engine.stop();
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/session/session_reactor.hpp"
+#include "nexusfix/session/warmup.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+    #include "nexusfix/memory/mimalloc_resource.hpp"
+#endif
+
+#if NFX_IO_URING_AVAILABLE
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Shard Task
+// ============================================================================
+
+/// Identifies a session of a sharded engine
+struct ShardedSessionId {
+    uint32_t shard{0};
+    uint32_t index{0};   // Shard-local session index
+};
+
+/// Unit of work executed on the shard that owns a session.
+/// Holds the callable inline, so posting never allocates. The callable must
+/// be trivially copyable and own everything it refers to (copy order fields
+/// into fixed arrays; a captured string_view outlives nothing).
+class ShardTask {
+public:
+    static constexpr size_t STORAGE_SIZE = 96;
+
+    ShardTask() noexcept = default;
+
+    template<typename F>
+    [[nodiscard]] static ShardTask make(uint32_t session_index, const F& fn) noexcept {
+        static_assert(std::is_trivially_copyable_v<F>,
+                      "ShardTask callables are copied byte-wise between threads");
+        static_assert(sizeof(F) <= STORAGE_SIZE, "ShardTask callable too large");
+        static_assert(alignof(F) <= alignof(std::max_align_t), "ShardTask callable over-aligned");
+        static_assert(std::is_invocable_v<const F&, SessionManager&>,
+                      "ShardTask callable must accept SessionManager&");
+
+        ShardTask task;
+        task.session_index_ = session_index;
+        task.invoke_ = [](const void* storage, SessionManager& session) noexcept {
+            (*std::launder(static_cast<const F*>(storage)))(session);
+        };
+        ::new (static_cast<void*>(task.storage_)) F(fn);
+        return task;
+    }
+
+    [[nodiscard]] uint32_t session_index() const noexcept { return session_index_; }
+    [[nodiscard]] bool empty() const noexcept { return invoke_ == nullptr; }
+
+    void run(SessionManager& session) const noexcept {
+        if (invoke_) invoke_(storage_, session);
+    }
+
+private:
+    using Invoke = void (*)(const void*, SessionManager&) noexcept;
+
+    alignas(std::max_align_t) unsigned char storage_[STORAGE_SIZE]{};
+    Invoke invoke_{nullptr};
+    uint32_t session_index_{0};
+};
+
+#if NFX_IO_URING_AVAILABLE
+
+// ============================================================================
+// Engine Configuration
+// ============================================================================
+
+/// Configuration for ShardedSessionEngine
+struct ShardedEngineConfig {
+    /// Number of shards (0 = one per allowed core)
+    size_t num_shards{0};
+
+    /// Cores the shards are pinned to, round-robin
+    util::CpuAffinityConfig affinity{util::CpuAffinityConfig::default_config()};
+
+    /// Per-shard reactor settings (cpu_core is set from affinity)
+    SessionReactorConfig reactor{};
+
+    /// run_once() wait when the inboxes were empty (0 = busy poll)
+    int poll_timeout_ms{1};
+
+    /// Interval between SessionReactor::tick() calls, which run
+    /// on_timer_tick() for sessions with a deadline due
+    std::chrono::milliseconds tick_interval{10};
+
+    /// Tasks taken from each inbox per loop iteration
+    size_t max_tasks_per_poll{256};
+
+    /// Per-session message store limits
+    size_t store_max_messages{10000};
+    size_t store_max_bytes{100'000'000};
+    size_t store_pool_size{4 * 1024 * 1024};  // Fixed byte log capacity
+
+    /// Initial size of each shard's SessionHeap (mimalloc builds only)
+    size_t shard_heap_size{64 * 1024 * 1024};
+};
+
+/// Counters of one shard (relaxed snapshots, readable from any thread)
+struct ShardStats {
+    uint64_t sessions_added{0};
+    uint64_t sessions_failed{0};     // Reactor refused the socket
+    uint64_t sessions_closed{0};
+    uint64_t tasks_run{0};
+    uint64_t tasks_dropped{0};       // Target session unknown or disconnected
+    uint64_t loop_iterations{0};
+};
+
+// ============================================================================
+// Sharded Session Engine
+// ============================================================================
+
+/// Thread-per-core FIX engine: sessions are spread over pinned shards
+class ShardedSessionEngine {
+public:
+    /// Inbox depth per (producer, shard) pair
+    static constexpr size_t INBOX_CAPACITY = 1024;
+
+    explicit ShardedSessionEngine(ShardedEngineConfig config = {}) noexcept
+        : config_{std::move(config)}
+    {
+        if (config_.affinity.allowed_cores.empty()) {
+            config_.affinity = util::CpuAffinityConfig::default_config();
+        }
+        if (config_.num_shards == 0) {
+            config_.num_shards = config_.affinity.allowed_cores.size();
+        }
+
+        const auto& cores = config_.affinity.allowed_cores;
+        shards_.reserve(config_.num_shards);
+        for (size_t i = 0; i < config_.num_shards; ++i) {
+            shards_.push_back(std::make_unique<Shard>(
+                config_, cores[i % cores.size()], config_.num_shards + 1));
+        }
+    }
+
+    // Non-copyable, non-movable (worker threads reference the shards)
+    ShardedSessionEngine(const ShardedSessionEngine&) = delete;
+    ShardedSessionEngine& operator=(const ShardedSessionEngine&) = delete;
+
+    ~ShardedSessionEngine() {
+        stop();
+    }
+
+    // ========================================================================
+    // Lifecycle
+    // ========================================================================
+
+    /// Launch the shard threads; returns once every ring is set up
+    /// @return The first shard's init error, if any (the engine is then stopped)
+    [[nodiscard]] TransportResult<void> start() noexcept {
+        if (running_.load(std::memory_order_relaxed)) return {};
+
+        running_.store(true, std::memory_order_release);
+        std::latch ready{static_cast<std::ptrdiff_t>(shards_.size())};
+        for (auto& shard : shards_) {
+            shard->thread = std::thread([this, s = shard.get(), &ready] {
+                run(*s, ready);
+            });
+        }
+        ready.wait();
+
+        for (auto& shard : shards_) {
+            if (!shard->init_result) {
+                auto error = shard->init_result;
+                stop();
+                return error;
+            }
+        }
+        return {};
+    }
+
+    /// Stop and join all shard threads; their sessions are removed
+    void stop() noexcept {
+        running_.store(false, std::memory_order_release);
+        for (auto& shard : shards_) {
+            if (shard->thread.joinable()) shard->thread.join();
+        }
+    }
+
+    [[nodiscard]] bool running() const noexcept {
+        return running_.load(std::memory_order_acquire);
+    }
+
+    /// Prime every shard's hot path on its own core (PipelineWarmer, with
+    /// sends through the shard's reactor to a null peer socket), then
+    /// prefault and lock memory once for the whole process.
+    /// Blocks until all shards are done; call after start(), before the
+    /// sessions carry traffic (each shard's loop pauses while it warms).
+    [[nodiscard]] PipelineWarmupStats warmup(const WarmupConfig& config = {}) noexcept {
+        PipelineWarmupStats total{};
+        if (!running()) return total;
+
+        WarmupConfig shard_config = config;
+        shard_config.lock_memory = false;  // Process-wide: done once below
+        for (auto& shard : shards_) {
+            shard->warmup_request.store(&shard_config, std::memory_order_release);
+        }
+        for (auto& shard : shards_) {
+            while (shard->warmup_request.load(std::memory_order_acquire) == &shard_config) {
+                shard->warmup_request.wait(&shard_config, std::memory_order_acquire);
+            }
+            total.merge(shard->warmup_stats);
+        }
+
+        if (config.prefault_stack) {
+            prefault_stack();
+        }
+        if (config.lock_memory) {
+            total.memory_locked = util::lock_all_memory().has_value();
+        }
+        return total;
+    }
+
+    // ========================================================================
+    // Session Registration
+    // ========================================================================
+
+    /// Shard a session is placed on by add_session() (stable per CompID pair)
+    [[nodiscard]] size_t shard_for(std::string_view sender_comp_id,
+                                   std::string_view target_comp_id) const noexcept {
+        return util::CpuAffinity::session_hash(sender_comp_id, target_comp_id) % shards_.size();
+    }
+
+    /// Hand a connected socket to the shard chosen by shard_for()
+    /// Thread-safe. The session is created on its shard's next loop
+    /// iteration; config strings are copied, callbacks.on_send is replaced.
+    [[nodiscard]] ShardedSessionId add_session(int fd,
+                                               const SessionConfig& config,
+                                               SessionCallbacks callbacks = {}) {
+        return add_session_on(shard_for(config.sender_comp_id, config.target_comp_id),
+                              fd, config, std::move(callbacks));
+    }
+
+    /// Hand a connected socket to a specific shard (thread-safe)
+    [[nodiscard]] ShardedSessionId add_session_on(size_t shard_index,
+                                                  int fd,
+                                                  const SessionConfig& config,
+                                                  SessionCallbacks callbacks = {}) {
+        Shard& shard = *shards_[shard_index % shards_.size()];
+
+        PendingSession pending;
+        pending.fd = fd;
+        pending.sender_comp_id = std::string{config.sender_comp_id};
+        pending.target_comp_id = std::string{config.target_comp_id};
+        pending.begin_string = std::string{config.begin_string};
+        pending.config = config;
+        pending.callbacks = std::move(callbacks);
+
+        std::lock_guard lock{shard.pending_mutex};
+        pending.index = shard.next_index++;
+        const ShardedSessionId id{static_cast<uint32_t>(shard_index % shards_.size()), pending.index};
+        shard.pending.push_back(std::move(pending));
+        shard.has_pending.store(true, std::memory_order_release);
+        return id;
+    }
+
+    // ========================================================================
+    // Cross-Shard Routing
+    // ========================================================================
+
+    /// Producer index for the (single) application thread
+    [[nodiscard]] size_t external_producer() const noexcept { return shards_.size(); }
+
+    /// Run fn(SessionManager&) on the session's shard
+    /// @param producer Calling shard's index, or external_producer()
+    /// @return false if the inbox is full (back-pressure; nothing was queued)
+    template<typename F>
+    [[nodiscard]] bool post(size_t producer, ShardedSessionId id, const F& fn) noexcept {
+        if (id.shard >= shards_.size() || producer > shards_.size()) [[unlikely]] return false;
+        return shards_[id.shard]->inboxes[producer]->try_push(ShardTask::make(id.index, fn));
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    [[nodiscard]] size_t shard_count() const noexcept { return shards_.size(); }
+    [[nodiscard]] const ShardedEngineConfig& config() const noexcept { return config_; }
+
+    /// Core a shard is pinned to
+    [[nodiscard]] int shard_core(size_t shard_index) const noexcept {
+        return shards_[shard_index]->reactor_config.cpu_core;
+    }
+
+    [[nodiscard]] ShardStats stats(size_t shard_index) const noexcept {
+        const auto& c = shards_[shard_index]->counters;
+        return ShardStats{
+            c.sessions_added.load(std::memory_order_relaxed),
+            c.sessions_failed.load(std::memory_order_relaxed),
+            c.sessions_closed.load(std::memory_order_relaxed),
+            c.tasks_run.load(std::memory_order_relaxed),
+            c.tasks_dropped.load(std::memory_order_relaxed),
+            c.loop_iterations.load(std::memory_order_relaxed)
+        };
+    }
+
+private:
+    using Inbox = memory::SPSCQueue<ShardTask, INBOX_CAPACITY>;
+
+    /// Registration handed from add_session() to the shard thread
+    struct PendingSession {
+        int fd{-1};
+        uint32_t index{0};
+        std::string sender_comp_id;
+        std::string target_comp_id;
+        std::string begin_string;
+        SessionConfig config;
+        SessionCallbacks callbacks;
+    };
+
+    /// A session owned by a shard (shard thread only)
+    struct EngineSession {
+        std::string sender_comp_id;   // Backing storage for config's views
+        std::string target_comp_id;
+        std::string begin_string;
+        SessionConfig config;
+        std::unique_ptr<store::MemoryMessageStore> store;
+        std::unique_ptr<SessionManager> session;
+        ReactorSessionHandle handle{};
+        bool connected{false};
+    };
+
+    struct Counters {
+        std::atomic<uint64_t> sessions_added{0};
+        std::atomic<uint64_t> sessions_failed{0};
+        std::atomic<uint64_t> sessions_closed{0};
+        std::atomic<uint64_t> tasks_run{0};
+        std::atomic<uint64_t> tasks_dropped{0};
+        std::atomic<uint64_t> loop_iterations{0};
+    };
+
+    struct Shard {
+        Shard(const ShardedEngineConfig& engine_config, int core, size_t producers)
+            : reactor_config{engine_config.reactor}
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+            , heap{std::make_unique<memory::SessionHeap>(engine_config.shard_heap_size)}
+#endif
+        {
+            reactor_config.cpu_core = core;
+            reactor = std::make_unique<SessionReactor>(reactor_config);
+            inboxes.reserve(producers);
+            for (size_t i = 0; i < producers; ++i) {
+                inboxes.push_back(std::make_unique<Inbox>());
+            }
+        }
+
+        SessionReactorConfig reactor_config;
+        std::unique_ptr<SessionReactor> reactor;
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+        std::unique_ptr<memory::SessionHeap> heap;
+#endif
+        std::vector<std::unique_ptr<Inbox>> inboxes;      // Indexed by producer
+        std::vector<std::unique_ptr<EngineSession>> sessions;
+
+        std::mutex pending_mutex;
+        std::vector<PendingSession> pending;              // Guarded by pending_mutex
+        uint32_t next_index{0};                           // Guarded by pending_mutex
+        std::atomic<bool> has_pending{false};
+
+        std::atomic<const WarmupConfig*> warmup_request{nullptr};
+        PipelineWarmupStats warmup_stats{};               // Written before request clears
+
+        std::thread thread;
+        TransportResult<void> init_result{};
+        Counters counters;
+    };
+
+    // ========================================================================
+    // Shard Loop
+    // ========================================================================
+
+    void run(Shard& shard, std::latch& ready) noexcept {
+        // Pins the thread to the shard's core and sets up its ring
+        shard.init_result = shard.reactor->init();
+        const bool ok = shard.init_result.has_value();
+        ready.count_down();
+        if (!ok) return;
+
+        shard.reactor->set_close_handler([&shard](ReactorSessionHandle handle, int) {
+            for (auto& entry : shard.sessions) {
+                if (entry && entry->connected && entry->handle.slot == handle.slot &&
+                    entry->handle.generation == handle.generation) {
+                    entry->connected = false;
+                    shard.counters.sessions_closed.fetch_add(1, std::memory_order_relaxed);
+                    break;
+                }
+            }
+        });
+
+        using Clock = std::chrono::steady_clock;
+        auto next_tick = Clock::now() + config_.tick_interval;
+
+        while (running_.load(std::memory_order_acquire)) {
+            if (const auto* request = shard.warmup_request.load(std::memory_order_acquire))
+                [[unlikely]] {
+                warm(shard, *request);
+            }
+            drain_pending(shard);
+            const size_t tasks = drain_inboxes(shard);
+            (void)shard.reactor->run_once(tasks > 0 ? 0 : config_.poll_timeout_ms);
+
+            const auto now = Clock::now();
+            if (now >= next_tick) {
+                shard.reactor->tick();
+                next_tick = now + config_.tick_interval;
+            }
+            shard.counters.loop_iterations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Sessions and their stores die on the thread that allocated them
+        for (auto& entry : shard.sessions) {
+            if (entry && entry->connected) {
+                shard.reactor->remove_session(entry->handle);
+                entry->session->on_disconnect();
+            }
+        }
+        (void)shard.reactor->flush();
+        shard.sessions.clear();
+    }
+
+    /// Run a PipelineWarmer on the shard thread, its sends going through
+    /// the reactor to one end of a socketpair whose other end is drained
+    void warm(Shard& shard, const WarmupConfig& config) noexcept {
+        PipelineWarmer warmer{config};
+
+        // The real inboxes may be live: warm the same queue type on a spare
+        auto inbox = std::make_unique<Inbox>();
+        const auto noop = ShardTask::make(0, [](SessionManager&) noexcept {});
+        const size_t queue_ops = warm_queue(*inbox, noop, config.iterations);
+
+        int fds[2] = {-1, -1};
+        std::optional<ReactorSessionHandle> handle;
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds) == 0) {
+            auto added = shard.reactor->add_session(fds[0], warmer.session());
+            if (added) {
+                handle = *added;
+                warmer.set_sink(shard.reactor->sender(*handle));
+            }
+        }
+
+        char discard[4096];
+        auto stats = warmer.run([&] {
+            if (!handle) return;
+            (void)shard.reactor->run_once(0);
+            while (::recv(fds[1], discard, sizeof(discard), MSG_DONTWAIT) > 0) {}
+        });
+        stats.queue_ops = queue_ops;
+
+        if (handle) {
+            shard.reactor->remove_session(*handle);
+            (void)shard.reactor->run_once(0);  // Submit the receive's cancel
+        }
+        for (int fd : fds) {
+            if (fd >= 0) ::close(fd);
+        }
+
+        shard.warmup_stats = stats;
+        shard.warmup_request.store(nullptr, std::memory_order_release);
+        shard.warmup_request.notify_all();
+    }
+
+    /// Create sessions registered since the last iteration
+    void drain_pending(Shard& shard) noexcept {
+        if (!shard.has_pending.load(std::memory_order_acquire)) return;
+
+        std::vector<PendingSession> batch;
+        {
+            std::lock_guard lock{shard.pending_mutex};
+            batch.swap(shard.pending);
+            shard.has_pending.store(false, std::memory_order_relaxed);
+        }
+
+        for (auto& pending : batch) {
+            attach(shard, pending);
+        }
+    }
+
+    void attach(Shard& shard, PendingSession& pending) noexcept {
+        auto entry = std::make_unique<EngineSession>();
+        entry->sender_comp_id = std::move(pending.sender_comp_id);
+        entry->target_comp_id = std::move(pending.target_comp_id);
+        entry->begin_string = std::move(pending.begin_string);
+        entry->config = pending.config;
+        entry->config.sender_comp_id = entry->sender_comp_id;
+        entry->config.target_comp_id = entry->target_comp_id;
+        entry->config.begin_string = entry->begin_string;
+
+        store::MemoryMessageStore::Config store_config{
+            .session_id = entry->sender_comp_id + "-" + entry->target_comp_id,
+            .max_messages = config_.store_max_messages,
+            .max_bytes = config_.store_max_bytes,
+            .pool_size_bytes = config_.store_pool_size,
+        };
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+        store_config.upstream_resource = shard.heap.get();
+#endif
+        entry->store = std::make_unique<store::MemoryMessageStore>(std::move(store_config));
+        entry->session = std::make_unique<SessionManager>(entry->config);
+        entry->session->set_message_store(entry->store.get());
+
+        // on_send resolves the handle at call time: add_session() already
+        // connects the session, before its handle is known here
+        SessionReactor* reactor = shard.reactor.get();
+        EngineSession* raw = entry.get();
+        pending.callbacks.on_send = [reactor, raw](std::span<const char> data) {
+            return reactor->send(raw->handle, data);
+        };
+        entry->session->set_callbacks(std::move(pending.callbacks));
+        entry->handle = ReactorSessionHandle{UINT32_MAX, 0};
+
+        auto handle = reactor->add_session(pending.fd, *entry->session);
+        if (!handle) {
+            shard.counters.sessions_failed.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            entry->handle = *handle;
+            entry->connected = true;
+            shard.counters.sessions_added.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (shard.sessions.size() <= pending.index) {
+            shard.sessions.resize(pending.index + 1);
+        }
+        shard.sessions[pending.index] = std::move(entry);
+    }
+
+    /// Run queued tasks of every producer
+    /// @return Tasks taken
+    NFX_HOT
+    size_t drain_inboxes(Shard& shard) noexcept {
+        size_t total = 0;
+        ShardTask task;
+        for (auto& inbox : shard.inboxes) {
+            for (size_t n = 0; n < config_.max_tasks_per_poll && inbox->try_pop(task); ++n) {
+                execute(shard, task);
+                ++total;
+            }
+        }
+        return total;
+    }
+
+    NFX_HOT
+    void execute(Shard& shard, const ShardTask& task) noexcept {
+        const uint32_t index = task.session_index();
+
+        // A task may overtake its session's registration within one iteration
+        if (index >= shard.sessions.size() || !shard.sessions[index]) [[unlikely]] {
+            drain_pending(shard);
+        }
+
+        if (index < shard.sessions.size() && shard.sessions[index] &&
+            shard.sessions[index]->connected) [[likely]] {
+            task.run(*shard.sessions[index]->session);
+            shard.counters.tasks_run.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            shard.counters.tasks_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    ShardedEngineConfig config_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::atomic<bool> running_{false};
+};
+
+#endif  // NFX_IO_URING_AVAILABLE
+
+} // namespace nfx
@@ -4,9 +4,14 @@
 #include <cstdint>
 #include <string_view>
 #include <chrono>
+#include <memory_resource>
+
+#include "nexusfix/types/field_types.hpp"
 
 namespace nfx {
 
+class DictionaryValidator;  // parser/data_dictionary.hpp
+
 // ============================================================================
 // Session State Machine
 // ============================================================================
@@ -393,6 +398,12 @@ static_assert(detail::TRANSITION_TABLE[4][7] == 6);  // Active + LogoutReceived
 // Session Configuration
 // ============================================================================
 
+/// What send_app_message() does with a message over the outbound rate
+enum class ThrottlePolicy : uint8_t {
+    Reject,  // Fail with SessionErrorCode::Throttled (no seq num consumed)
+    Queue    // Build, store and hold it; on_timer_tick() releases it
+};
+
 /// Session configuration parameters
 struct SessionConfig {
     std::string_view sender_comp_id;
@@ -412,6 +423,58 @@ struct SessionConfig {
     bool validate_checksum{true};
     bool persist_messages{false};
 
+    // SendingTime (52) sub-second digits; us/ns for MiFID II clock sync
+    TimestampPrecision sending_time_precision{TimestampPrecision::Milliseconds};
+
+    // Outbound MsgSeqNum (34) zero-padded to this many digits (0 = natural
+    // width, max 10). Only for counterparties accepting leading zeros: with
+    // a fixed width (and the fixed 6-digit BodyLength) a stored or
+    // pre-serialized message takes a new seq num by overwrite, see
+    // patch_msg_seq_num()
+    uint8_t seq_num_width{0};
+
+    // Per-session mimalloc heap of this many bytes backing the session's
+    // reassembly buffer, resend scratch, throttle queue and owned store
+    // (0 = global heap). Teardown releases it in one mi_heap_destroy();
+    // ignored without NFX_HAS_MIMALLOC
+    size_t session_heap_size{0};
+    int session_heap_numa_node{-1}; // Bind the heap's initial buffer (-1 = local)
+
+    // Shared resource (e.g. a pool over many sessions) for the same
+    // buffers plus the batch buffer and order templates; overrides the
+    // session heap (nullptr = session heap or global heap)
+    std::pmr::memory_resource* buffer_resource{nullptr};
+
+    // Idle compaction: after N heartbeat intervals with no other traffic,
+    // return the buffers above and the store's spare capacity to the
+    // resource; they are reallocated on next use (0 = off)
+    uint32_t idle_compact_heartbeats{0};
+
+    // Idle cache warming: build a discarded order every N ms without
+    // outbound traffic, from on_timer_tick() (0 = off)
+    int shadow_send_interval_ms{0};
+
+    // Outbound application-message throttle (token bucket, 0 = off);
+    // see session/throttle.hpp
+    uint32_t max_app_messages_per_sec{0};
+    uint32_t app_message_burst{1};
+    ThrottlePolicy throttle_policy{ThrottlePolicy::Reject};
+
+    // Hold inbound messages received past a seq num gap and dispatch them
+    // in order once it is filled; see session/reorder_buffer.hpp
+    bool reorder_inbound{true};
+
+    // Stream long resends: replay at most this many seq nums per chunk,
+    // each chunk one coalesced on_send() write. The first chunk goes out on
+    // the ResendRequest, the rest one per on_timer_tick(), so inbound
+    // messages and heartbeats are handled in between (0 = whole range at once)
+    uint32_t resend_chunk_messages{0};
+
+    // Validate inbound messages against the venue's data dictionary while
+    // parsing (nullptr = off); invalid ones are reported like parse errors.
+    // See parser/data_dictionary.hpp; must outlive the session
+    const DictionaryValidator* dictionary{nullptr};
+
     // CPU affinity (for latency optimization)
     int cpu_affinity_core{-1};      // Pin session thread to specific core (-1 = auto/disabled)
     bool auto_pin_to_core{false};   // Auto-pin based on session ID hash
@@ -435,6 +498,15 @@ struct SessionStats {
     uint64_t resend_requests_sent{0};
     uint64_t sequence_resets{0};
     uint64_t reconnect_count{0};
+    uint64_t batches_flushed{0};    // Coalesced writes issued by SessionManager::flush()
+    uint64_t shadow_sends{0};       // Discarded cache-warming builds (shadow_send())
+    uint64_t messages_reassembled{0};  // Messages straddling on_bytes() chunks
+    uint64_t bytes_discarded{0};    // Unframeable on_bytes() input dropped
+    uint64_t risk_rejects{0};       // Sends vetoed by the handler's check_order()
+    uint64_t messages_throttled{0}; // App sends over the rate (rejected or held)
+    uint64_t messages_reordered{0}; // Inbound held past a gap, dispatched in order
+    uint64_t compactions{0};        // Idle buffer releases (compact())
+    uint64_t resend_chunks{0};      // Streamed resend chunks written (resend_chunk_messages)
 
     using TimePoint = std::chrono::steady_clock::time_point;
     TimePoint session_start;
@@ -454,6 +526,15 @@ struct SessionStats {
         resend_requests_sent = 0;
         sequence_resets = 0;
         reconnect_count = 0;
+        batches_flushed = 0;
+        shadow_sends = 0;
+        messages_reassembled = 0;
+        bytes_discarded = 0;
+        risk_rejects = 0;
+        messages_throttled = 0;
+        messages_reordered = 0;
+        compactions = 0;
+        resend_chunks = 0;
     }
 };
 
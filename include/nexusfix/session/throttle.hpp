@@ -0,0 +1,173 @@
+/*
+    NexusFIX Outbound Message Throttle
+
+    Venues cap messages per second and disconnect sessions that exceed the
+    cap. TokenBucket meters sends in TSC cycles (one RDTSCP and a few
+    integer ops per check, no syscall); ThrottleQueue holds built messages
+    that arrived over the rate until on_timer_tick() releases them.
+
+    Usage:
+        SessionConfig config;
+        config.max_app_messages_per_sec = 50;
+        config.app_message_burst = 10;
+        config.throttle_policy = ThrottlePolicy::Queue;   // or Reject
+
+        // Over the rate: Reject returns SessionErrorCode::Throttled before a
+        // seq num is consumed; Queue builds and stores the message, and
+        // on_timer_tick() sends it once a token is available
+        auto result = session.send_new_order(order);
+
+    While messages are held, every outbound message (admin included) queues
+    behind them so MsgSeqNum stays in order on the wire. Only application
+    messages consume tokens.
+
+    Single-threaded: the session thread is both producer and consumer.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/util/branchless.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Token Bucket
+// ============================================================================
+
+/// Token bucket metered in TSC cycles: credit accrues one cycle per cycle
+/// up to burst tokens' worth; a send spends one token's worth
+class TokenBucket {
+public:
+    /// Unthrottled: every acquire succeeds
+    constexpr TokenBucket() noexcept = default;
+
+    /// @param per_sec Sustained tokens per second (0 = unthrottled)
+    /// @param burst Tokens available back to back (at least 1)
+    /// @param tsc_ghz TSC cycles per nanosecond (RdtscClock::frequency_ghz())
+    TokenBucket(uint32_t per_sec, uint32_t burst, double tsc_ghz) noexcept {
+        if (per_sec == 0 || tsc_ghz <= 0.0) return;
+        cycles_per_token_ = static_cast<uint64_t>(tsc_ghz * 1e9 / per_sec);
+        if (cycles_per_token_ == 0) cycles_per_token_ = 1;
+        capacity_ = cycles_per_token_ * (burst > 0 ? burst : 1);
+        credit_ = capacity_;
+    }
+
+    [[nodiscard]] bool enabled() const noexcept { return cycles_per_token_ != 0; }
+
+    /// Spend one token at `tsc`; false if the bucket is empty
+    [[nodiscard]] NFX_HOT bool try_acquire(uint64_t tsc) noexcept {
+        refill(tsc);
+        if (credit_ < cycles_per_token_) return false;
+        credit_ -= cycles_per_token_;
+        return true;
+    }
+
+    /// Cycles until a token is available at `tsc` (0 = now)
+    [[nodiscard]] uint64_t cycles_until_token(uint64_t tsc) noexcept {
+        refill(tsc);
+        return credit_ >= cycles_per_token_ ? 0 : cycles_per_token_ - credit_;
+    }
+
+private:
+    void refill(uint64_t tsc) noexcept {
+        // A TSC read behind last_tsc_ (e.g. after a core migration) adds nothing
+        const uint64_t elapsed = util::branchless_select(tsc > last_tsc_, tsc - last_tsc_, uint64_t{0});
+        credit_ = util::branchless_min(credit_ + elapsed, capacity_);
+        last_tsc_ = util::branchless_max(tsc, last_tsc_);
+    }
+
+    uint64_t cycles_per_token_{0};
+    uint64_t capacity_{0};
+    uint64_t credit_{0};
+    uint64_t last_tsc_{0};
+};
+
+// ============================================================================
+// Held Message Queue
+// ============================================================================
+
+/// Bounded FIFO of built messages waiting for the throttle: descriptors in
+/// an SPSCQueue, bytes in a ring arena (each message contiguous)
+template <size_t MaxMessages = 512, size_t MaxBytes = 64 * 1024>
+class BasicThrottleQueue {
+public:
+    static_assert(MaxBytes <= UINT32_MAX, "Arena offsets are 32-bit");
+
+    /// One held message
+    struct Held {
+        uint32_t offset{0};
+        uint32_t length{0};
+        uint32_t seq_num{0};
+        bool counted{false};  // Spends a token when released (app message)
+    };
+
+    /// Copy `msg` to the back of the queue
+    /// @return false if the message count or arena is exhausted
+    [[nodiscard]] bool push(std::span<const char> msg, uint32_t seq_num, bool counted) noexcept {
+        if (msg.size() > MaxBytes || descriptors_.full()) return false;
+
+        const auto len = static_cast<uint32_t>(msg.size());
+        uint32_t offset = write_pos_;
+        if (const Held* head = descriptors_.front()) {
+            const uint32_t read_pos = head->offset;
+            if (write_pos_ >= read_pos) {
+                // Free: [write_pos_, MaxBytes) then [0, read_pos)
+                if (MaxBytes - write_pos_ < len) {
+                    if (len >= read_pos) return false;
+                    offset = 0;
+                }
+            } else if (read_pos - write_pos_ <= len) {
+                return false;
+            }
+        } else {
+            offset = 0;  // Empty: restart at the front of the arena
+        }
+
+        std::memcpy(arena_ + offset, msg.data(), len);
+        if (!descriptors_.try_push(Held{offset, len, seq_num, counted})) return false;
+        write_pos_ = offset + len;
+        bytes_ += len;
+        return true;
+    }
+
+    /// Oldest held message, nullptr if empty
+    [[nodiscard]] const Held* front() const noexcept { return descriptors_.front(); }
+
+    /// Bytes of a held message (valid until it is popped)
+    [[nodiscard]] std::span<const char> bytes(const Held& held) const noexcept {
+        return {arena_ + held.offset, held.length};
+    }
+
+    void pop() noexcept {
+        Held held;
+        if (descriptors_.try_pop(held)) bytes_ -= held.length;
+    }
+
+    void clear() noexcept {
+        while (front() != nullptr) pop();
+        write_pos_ = 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return descriptors_.empty(); }
+    [[nodiscard]] size_t size() const noexcept { return descriptors_.size_approx(); }
+    [[nodiscard]] size_t held_bytes() const noexcept { return bytes_; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return MaxMessages - 1; }
+
+private:
+    memory::SPSCQueue<Held, MaxMessages> descriptors_;
+    uint32_t write_pos_{0};
+    size_t bytes_{0};
+    alignas(memory::CACHE_LINE_SIZE) char arena_[MaxBytes];
+};
+
+/// Session throttle queue: up to 511 messages / 64 KiB held
+using ThrottleQueue = BasicThrottleQueue<>;
+
+} // namespace nfx
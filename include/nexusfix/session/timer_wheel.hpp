@@ -0,0 +1,206 @@
+/*
+    NexusFIX Session Timer Wheel
+
+    Sweeping every session with on_timer_tick() every 100ms costs a few
+    clock reads and branches per session per sweep, nearly all of which find
+    nothing due: heartbeats are seconds apart. TimerWheel is a hashed timing
+    wheel shared by all sessions of a thread. Each session is scheduled at
+    its next deadline (SessionManager::next_timer_due()) and only sessions
+    whose slot comes up are touched.
+
+    Ticks are TSC cycles (one RDTSCP per advance(), no syscall). Nodes are
+    intrusive and doubly linked, so schedule() and cancel() are O(1) and
+    nothing is allocated. Deadlines further out than one turn of the wheel
+    stay in their slot until their turn comes round.
+
+    Deadlines move later on their own (traffic pushes the next heartbeat
+    out); the session is simply rescheduled when its early timer fires.
+    Anything that moves a deadline earlier (a Logon sent, a message held by
+    the throttle) is picked up at the next timer or after max_delay at the
+    latest (set_max_delay(), 1s by default); call schedule() with 0 ticks
+    to react at once.
+
+    Usage:
+        TimerWheel wheel{std::chrono::milliseconds{10},
+                         util::RdtscClock::frequency_ghz(), util::detail::rdtscp()};
+        node.user_data = index;
+        wheel.schedule(node, 0);
+        ...
+        wheel.advance(util::detail::rdtscp(), [&](TimerNode& due) {
+            auto& session = *sessions[due.user_data];
+            session.on_timer_tick();
+            wheel.schedule(due, wheel.ticks_for(session.next_timer_due()));
+        });
+
+    Single-threaded: owned by the thread that runs the sessions.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace nfx {
+
+// ============================================================================
+// Timer Node
+// ============================================================================
+
+/// Intrusive wheel entry; must not move while scheduled
+struct TimerNode {
+    TimerNode* prev{nullptr};
+    TimerNode* next{nullptr};
+    uint64_t expiry_tick{0};
+    uint64_t user_data{0};          // Identifies the owner to the expiry callback
+
+    TimerNode() noexcept = default;
+    TimerNode(const TimerNode&) = delete;
+    TimerNode& operator=(const TimerNode&) = delete;
+
+    [[nodiscard]] bool scheduled() const noexcept { return next != nullptr; }
+
+    void unlink() noexcept {
+        if (next == nullptr) return;
+        prev->next = next;
+        next->prev = prev;
+        prev = next = nullptr;
+    }
+};
+
+// ============================================================================
+// Timer Wheel
+// ============================================================================
+
+/// Hashed timing wheel over TSC ticks
+template <size_t Slots = 4096>
+class BasicTimerWheel {
+public:
+    static_assert(std::has_single_bit(Slots), "Slots are indexed by tick & mask");
+
+    /// @param tick Wheel resolution
+    /// @param tsc_ghz TSC cycles per nanosecond (RdtscClock::frequency_ghz())
+    /// @param now_tsc Current TSC; tick 0 of the wheel
+    BasicTimerWheel(std::chrono::nanoseconds tick, double tsc_ghz, uint64_t now_tsc) noexcept
+        : tick_ns_{std::max<uint64_t>(static_cast<uint64_t>(tick.count()), 1)}
+        , tick_cycles_{std::max<uint64_t>(
+              static_cast<uint64_t>(static_cast<double>(tick_ns_) * tsc_ghz), 1)}
+        , origin_tsc_{now_tsc}
+    {
+        for (TimerNode& head : slots_) head.prev = head.next = &head;
+        set_max_delay(std::chrono::seconds{1});
+    }
+
+    // Slot heads are referenced by scheduled nodes
+    BasicTimerWheel(const BasicTimerWheel&) = delete;
+    BasicTimerWheel& operator=(const BasicTimerWheel&) = delete;
+
+    /// Whole ticks covering `delay`, rounded up and capped at the max delay
+    [[nodiscard]] uint64_t ticks_for(std::chrono::nanoseconds delay) const noexcept {
+        if (delay.count() <= 0) return 0;
+        if (delay >= max_delay_) return max_delay_ticks_;
+        const auto ns = static_cast<uint64_t>(delay.count());
+        return (ns + tick_ns_ - 1) / tick_ns_;
+    }
+
+    /// Longest ticks_for() returns, however far the deadline: bounds how
+    /// late a deadline that moved earlier is noticed
+    void set_max_delay(std::chrono::nanoseconds max_delay) noexcept {
+        max_delay_ = max_delay;
+        max_delay_ticks_ = std::max<uint64_t>(
+            static_cast<uint64_t>(max_delay.count()) / tick_ns_, 1);
+    }
+
+    /// (Re)schedule `node` to expire `delay_ticks` after the current tick.
+    /// 0 expires it on the next advance().
+    void schedule(TimerNode& node, uint64_t delay_ticks) noexcept {
+        cancel(node);
+        node.expiry_tick = current_tick_ + std::max<uint64_t>(delay_ticks, 1);
+        TimerNode& head = slots_[node.expiry_tick & MASK];
+        node.prev = head.prev;
+        node.next = &head;
+        head.prev->next = &node;
+        head.prev = &node;
+        ++size_;
+    }
+
+    /// Remove `node` if scheduled
+    void cancel(TimerNode& node) noexcept {
+        if (!node.scheduled()) return;
+        node.unlink();
+        --size_;
+    }
+
+    /// Expire every node due by `now_tsc`, calling on_expire(TimerNode&)
+    /// for each. The callback may schedule or cancel any node.
+    /// @return Number of nodes expired
+    template <typename OnExpire>
+    size_t advance(uint64_t now_tsc, OnExpire&& on_expire) noexcept {
+        if (now_tsc < origin_tsc_) return 0;
+        const uint64_t target = (now_tsc - origin_tsc_) / tick_cycles_;
+        if (target <= current_tick_) return 0;
+
+        // A late caller visits each slot once at most
+        const uint64_t base = current_tick_;
+        const bool late = target - base > Slots;
+        const uint64_t steps = late ? Slots : target - base;
+        size_t expired = 0;
+        for (uint64_t i = 1; i <= steps; ++i) {
+            // Callbacks schedule relative to the tick being expired
+            current_tick_ = late ? target : base + i;
+            TimerNode& head = slots_[(base + i) & MASK];
+            // Move due nodes to a local list first: callbacks reschedule
+            // into the wheel, possibly into this very slot
+            TimerNode due;
+            due.prev = due.next = &due;
+            for (TimerNode* node = head.next; node != &head;) {
+                TimerNode* following = node->next;
+                if (node->expiry_tick <= target) {
+                    node->unlink();
+                    node->prev = due.prev;
+                    node->next = &due;
+                    due.prev->next = node;
+                    due.prev = node;
+                }
+                node = following;
+            }
+            while (due.next != &due) {
+                TimerNode* node = due.next;
+                node->unlink();
+                --size_;
+                ++expired;
+                on_expire(*node);
+            }
+        }
+        current_tick_ = target;
+        return expired;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] uint64_t current_tick() const noexcept { return current_tick_; }
+    [[nodiscard]] uint64_t tick_cycles() const noexcept { return tick_cycles_; }
+    [[nodiscard]] std::chrono::nanoseconds tick() const noexcept {
+        return std::chrono::nanoseconds{tick_ns_};
+    }
+    [[nodiscard]] static constexpr size_t slot_count() noexcept { return Slots; }
+
+private:
+    static constexpr uint64_t MASK = Slots - 1;
+
+    uint64_t tick_ns_;
+    uint64_t tick_cycles_;
+    uint64_t origin_tsc_;
+    uint64_t current_tick_{0};
+    std::chrono::nanoseconds max_delay_{};
+    uint64_t max_delay_ticks_{1};
+    size_t size_{0};
+    TimerNode slots_[Slots];
+};
+
+/// Session timer wheel: 4096 slots (41s per turn at 10ms ticks)
+using TimerWheel = BasicTimerWheel<>;
+
+} // namespace nfx
@@ -0,0 +1,307 @@
+/*
+    NexusFIX Hot Path Warmup
+
+    util::warm_all() only primes the parser and the SIMD scanner. The first
+    order of the day also runs the builders and serializer, the checksum,
+    SessionManager dispatch, the message store, queue push/pop and the
+    transport send path - each cold on its first call (I-cache, branch
+    predictors, TLB, first-touch page faults).
+
+    PipelineWarmer drives all of them through a scratch session that talks
+    to an in-process counterparty:
+    - Logon exchange, then per iteration: NewOrderSingle via the header
+      template and the generic builder, inbound Heartbeat / TestRequest /
+      ExecutionReport dispatch, a periodic ResendRequest (store retrieval
+      and resend rewriting), a timer tick
+    - Outbound bytes go through a caller-supplied sink (e.g. a transport
+      writing to a null peer), or are discarded
+    - Before returning, the calling thread's stack is prefaulted and, if
+      configured, all memory is locked (mlockall current + future)
+
+    Real sessions are never touched: the counterparty, the store and the
+    sequence numbers all belong to the scratch session.
+
+    Usage:
+        // Single-threaded deployment, before the open
+        auto stats = nfx::warmup();
+
+        // Thread-per-core deployment: every shard warms on its own core
+        engine.start();
+        auto stats = engine.warmup();
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/messages/fix44/execution_report.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/util/icache_warmer.hpp"
+#include "nexusfix/util/memory_lock.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Warmup Configuration
+// ============================================================================
+
+/// Configuration for PipelineWarmer / warmup()
+struct WarmupConfig {
+    /// Pipeline iterations (each: 2 orders out, 2-3 messages in)
+    size_t iterations{util::DEFAULT_WARMUP_ITERATIONS};
+
+    /// mlockall(MCL_CURRENT | MCL_FUTURE) once warm: faults in and pins
+    /// every mapped page, including the buffers and stores allocated so far
+    bool lock_memory{true};
+
+    /// Touch STACK_PREFAULT_BYTES of the warming thread's stack
+    bool prefault_stack{true};
+};
+
+/// Results of a pipeline warmup
+struct PipelineWarmupStats {
+    util::WarmupStats parser{};      // util::warm_all() part
+    size_t messages_built{0};        // Outbound messages serialized
+    size_t messages_dispatched{0};   // Inbound messages through SessionManager
+    size_t store_reads{0};           // Messages read back from the store
+    size_t queue_ops{0};             // Queue push + pop pairs
+    size_t bytes_sent{0};            // Bytes handed to the send sink
+    size_t errors{0};                // Sends refused or warmup steps failed
+    bool memory_locked{false};
+
+    [[nodiscard]] constexpr bool success() const noexcept {
+        return parser.success() && errors == 0;
+    }
+
+    /// Add another thread's results (memory_locked is process-wide: OR)
+    constexpr void merge(const PipelineWarmupStats& other) noexcept {
+        parser.iterations += other.parser.iterations;
+        parser.messages_parsed += other.parser.messages_parsed;
+        parser.parse_errors += other.parser.parse_errors;
+        messages_built += other.messages_built;
+        messages_dispatched += other.messages_dispatched;
+        store_reads += other.store_reads;
+        queue_ops += other.queue_ops;
+        bytes_sent += other.bytes_sent;
+        errors += other.errors;
+        memory_locked = memory_locked || other.memory_locked;
+    }
+};
+
+// ============================================================================
+// Memory Preparation
+// ============================================================================
+
+/// Stack touched by prefault_stack() (default thread stacks are 8MB)
+inline constexpr size_t STACK_PREFAULT_BYTES = 256 * 1024;
+
+/// Fault in the calling thread's next STACK_PREFAULT_BYTES of stack
+NFX_NO_INLINE inline void prefault_stack() noexcept {
+    char frame[STACK_PREFAULT_BYTES];
+    util::prefault_memory_write(frame, sizeof(frame));
+}
+
+/// Push/pop `count` copies of `item` through an SPSC-style queue
+/// (try_push / try_pop), warming that queue instantiation's code
+/// @return Pairs completed
+template<typename Queue, typename T>
+size_t warm_queue(Queue& queue, const T& item, size_t count) noexcept {
+    T out{};
+    size_t done = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!queue.try_push(item)) break;
+        if (!queue.try_pop(out)) break;
+        ++done;
+    }
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    return done;
+}
+
+// ============================================================================
+// Pipeline Warmer
+// ============================================================================
+
+/// Scratch session + counterparty that exercise the full hot path
+class PipelineWarmer {
+public:
+    using SendSink = std::function<bool(std::span<const char>)>;
+
+    /// Messages between ResendRequests from the counterparty
+    static constexpr size_t RESEND_INTERVAL = 64;
+
+    explicit PipelineWarmer(const WarmupConfig& config = {})
+        : config_{config}
+        , store_{store::MemoryMessageStore::Config{
+              .session_id = "WARMUP-PEER",
+              .max_messages = 1024,
+              .pool_size_bytes = 1024 * 1024}}
+        , session_{make_session_config()}
+    {
+        SessionCallbacks callbacks;
+        callbacks.on_send = [this](std::span<const char> data) {
+            stats_.bytes_sent += data.size();
+            return sink_ ? sink_(data) : true;
+        };
+        callbacks.on_app_message = [this](const IndexedParser&, const RxTimestamp&) {
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        };
+        session_.set_callbacks(std::move(callbacks));
+        session_.set_message_store(&store_);
+    }
+
+    PipelineWarmer(const PipelineWarmer&) = delete;
+    PipelineWarmer& operator=(const PipelineWarmer&) = delete;
+
+    /// Scratch session (e.g. to register with a reactor before run())
+    [[nodiscard]] SessionManager& session() noexcept { return session_; }
+
+    /// Route outbound bytes through a transport (default: discarded)
+    void set_sink(SendSink sink) noexcept { sink_ = std::move(sink); }
+
+    /// Run the warmup on the calling thread
+    /// @param poll Called once per iteration, e.g. to reap a transport's
+    ///        completions and drain its null peer
+    template<typename Poll>
+    [[nodiscard]] PipelineWarmupStats run(Poll&& poll) noexcept {
+        stats_.parser = util::warm_all(config_.iterations);
+
+        if (session_.state() == SessionState::Disconnected) {
+            session_.on_connect();
+        }
+        if (!session_.initiate_logon()) ++stats_.errors;
+        auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+        receive(logon);
+        if (session_.state() != SessionState::Active) ++stats_.errors;
+
+        auto order = fix44::NewOrderSingle::Builder{}
+            .cl_ord_id("WARM0001")
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20260101-00:00:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_string("150.25"))
+            .time_in_force(TimeInForce::Day);
+        auto report = fix44::ExecutionReport::Builder{}
+            .order_id("O1")
+            .exec_id("E1")
+            .exec_type(ExecType::New)
+            .ord_status(OrdStatus::New)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .leaves_qty(Qty::from_int(100))
+            .cum_qty(Qty::from_int(0))
+            .avg_px(FixedPrice::from_string("0"))
+            .cl_ord_id("WARM0001");
+        auto heartbeat = fix44::Heartbeat::Builder{};
+        auto test_request = fix44::TestRequest::Builder{}.test_req_id("WARM");
+
+        for (size_t i = 0; i < config_.iterations; ++i) {
+            count_send(session_.send_new_order(order).has_value());
+            count_send(session_.send_app_message(order).has_value());
+
+            receive(report);
+            if (i % 16 == 0) {
+                receive(test_request);  // Heartbeat reply
+            } else {
+                receive(heartbeat);
+            }
+
+            if (i % RESEND_INTERVAL == RESEND_INTERVAL - 1) {
+                replay_recent();
+            }
+
+            session_.on_timer_tick();
+            poll();
+        }
+
+        if (!session_.initiate_logout("warmup")) ++stats_.errors;
+        auto logout = fix44::Logout::Builder{};
+        receive(logout);
+        poll();
+        session_.on_disconnect();
+
+        finish();
+        return stats_;
+    }
+
+    [[nodiscard]] PipelineWarmupStats run() noexcept {
+        return run([] {});
+    }
+
+private:
+    static SessionConfig make_session_config() noexcept {
+        SessionConfig config;
+        config.sender_comp_id = "WARMUP";
+        config.target_comp_id = "PEER";
+        return config;
+    }
+
+    void count_send(bool ok) noexcept {
+        ++stats_.messages_built;
+        if (!ok) ++stats_.errors;
+    }
+
+    /// Build a counterparty message and dispatch it into the session
+    template<typename Builder>
+    void receive(Builder& builder) noexcept {
+        auto msg = builder
+            .sender_comp_id("PEER")
+            .target_comp_id("WARMUP")
+            .msg_seq_num(peer_seq_++)
+            .sending_time("20260101-00:00:00.000")
+            .build(peer_assembler_);
+        session_.on_data_received(msg);
+        ++stats_.messages_dispatched;
+    }
+
+    /// Counterparty asks for the last few messages: store retrieval,
+    /// resend rewriting and gap fills over the admin messages
+    void replay_recent() noexcept {
+        const uint32_t next = session_.sequences().current_outbound();
+        const uint32_t begin = next > 5 ? next - 4 : 1;
+        auto touch = [](uint32_t, std::span<const char> msg) {
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            return !msg.empty();
+        };
+        stats_.store_reads += store_.for_each_in_range(begin, next - 1, touch);
+        auto resend = fix44::ResendRequest::Builder{}.begin_seq_no(begin).end_seq_no(next - 1);
+        receive(resend);
+    }
+
+    void finish() noexcept {
+        if (config_.prefault_stack) {
+            prefault_stack();
+        }
+        if (config_.lock_memory) {
+            stats_.memory_locked = util::lock_all_memory().has_value();
+        }
+    }
+
+    WarmupConfig config_;
+    store::MemoryMessageStore store_;
+    SessionManager session_;
+    SendSink sink_;
+    MessageAssembler peer_assembler_;
+    uint32_t peer_seq_{1};
+    PipelineWarmupStats stats_{};
+};
+
+// ============================================================================
+// Convenience
+// ============================================================================
+
+/// Warm the full hot path on the calling thread, outbound bytes discarded
+[[nodiscard]] inline PipelineWarmupStats warmup(const WarmupConfig& config = {}) noexcept {
+    PipelineWarmer warmer{config};
+    return warmer.run();
+}
+
+} // namespace nfx
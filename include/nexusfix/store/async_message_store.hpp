@@ -0,0 +1,257 @@
+/*
+    NexusFIX Async Write-Behind Message Store
+
+    IMessageStore decorator that takes durable stores off the send path:
+    - store() copies the message into a preallocated slab slot and pushes
+      a (seq, slot, length) descriptor into an SPSCQueue
+    - A background flusher thread (optionally pinned) drains descriptors
+      in batches into the backend store (e.g. MmapMessageStore)
+    - flush() is a barrier: it waits until everything queued so far has
+      reached the backend, then flushes the backend
+
+    Session thread cost: one memcpy plus a queue publish.
+
+    Thread-safety:
+    - store(), reset(), drain(), flush(): producer (session) thread only
+    - Reads drain first, so resends see every stored message
+    - The backend must be thread-safe (the flusher writes while other
+      threads may read); MemoryMessageStore and MmapMessageStore are
+*/
+
+#pragma once
+
+#include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/memory/cache_line.hpp"
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/memory/wait_strategy.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+namespace nfx::store {
+
+// ============================================================================
+// Async Store Configuration
+// ============================================================================
+
+/// Configuration for AsyncMessageStore
+struct AsyncStoreConfig {
+    /// Bytes per slab slot; larger messages bypass the queue (drain, then
+    /// store synchronously)
+    size_t slot_size{2048};
+
+    /// Core to pin the flusher thread to (-1 = don't pin)
+    int flusher_cpu{-1};
+
+    /// Flusher sleep when the queue is empty
+    std::chrono::microseconds idle_sleep{50};
+};
+
+// ============================================================================
+// Async Message Store
+// ============================================================================
+
+/// Write-behind decorator over a thread-safe backend store
+class AsyncMessageStore final : public IMessageStore {
+public:
+    /// Queued messages (slab slots and queue descriptors)
+    static constexpr size_t QUEUE_CAPACITY = 4096;
+
+    /// Descriptors drained per flusher iteration
+    static constexpr size_t FLUSH_BATCH = 64;
+
+    explicit AsyncMessageStore(IMessageStore& backend)
+        : AsyncMessageStore(backend, AsyncStoreConfig{}) {}
+
+    AsyncMessageStore(IMessageStore& backend, const AsyncStoreConfig& config)
+        : backend_(backend)
+        , config_(config)
+        , slab_(std::make_unique_for_overwrite<char[]>(QUEUE_CAPACITY * config_.slot_size))
+        , queue_(std::make_unique<Queue>())
+        , flusher_([this] { run_flusher(); }) {}
+
+    ~AsyncMessageStore() override {
+        running_.store(false, std::memory_order_release);
+        flusher_.join();
+        backend_.flush();
+    }
+
+    AsyncMessageStore(const AsyncMessageStore&) = delete;
+    AsyncMessageStore& operator=(const AsyncMessageStore&) = delete;
+
+    // ========================================================================
+    // Message Storage (producer thread)
+    // ========================================================================
+
+    /// Queue a message for the backend. Returns once the bytes are copied;
+    /// backend failures surface in stats().store_failures after the flush.
+    [[nodiscard]] bool store(uint32_t seq_num,
+                            std::span<const char> msg) noexcept override {
+        if (msg.size() > config_.slot_size) [[unlikely]] {
+            drain();
+            ++oversize_;
+            return backend_.store(seq_num, msg);
+        }
+
+        // Slot n is reused once the message QUEUE_CAPACITY before it is
+        // in the backend
+        const uint64_t n = enqueued_;
+        if (n - written_.load(std::memory_order_acquire) >= QUEUE_CAPACITY) [[unlikely]] {
+            ++full_waits_;
+            memory::YieldingWait::wait_until([&] {
+                return n - written_.load(std::memory_order_acquire) < QUEUE_CAPACITY;
+            });
+        }
+
+        const auto slot = static_cast<uint32_t>(n & (QUEUE_CAPACITY - 1));
+        std::memcpy(slab_.get() + slot * config_.slot_size, msg.data(), msg.size());
+        queue_->push(Entry{seq_num, slot, static_cast<uint32_t>(msg.size())});
+        enqueued_ = n + 1;
+        return true;
+    }
+
+    [[nodiscard]] std::optional<std::vector<char>>
+        retrieve(uint32_t seq_num) const noexcept override {
+        drain();
+        return backend_.retrieve(seq_num);
+    }
+
+    [[nodiscard]] std::vector<std::vector<char>>
+        retrieve_range(uint32_t begin_seq, uint32_t end_seq) const noexcept override {
+        drain();
+        return backend_.retrieve_range(begin_seq, end_seq);
+    }
+
+    size_t for_each_in_range(uint32_t begin_seq, uint32_t end_seq,
+                             MessageVisitor visitor) const noexcept override {
+        drain();
+        return backend_.for_each_in_range(begin_seq, end_seq, visitor);
+    }
+
+    // ========================================================================
+    // Sequence Number Persistence
+    // ========================================================================
+
+    void set_next_sender_seq_num(uint32_t seq) noexcept override {
+        backend_.set_next_sender_seq_num(seq);
+    }
+
+    void set_next_target_seq_num(uint32_t seq) noexcept override {
+        backend_.set_next_target_seq_num(seq);
+    }
+
+    [[nodiscard]] uint32_t get_next_sender_seq_num() const noexcept override {
+        return backend_.get_next_sender_seq_num();
+    }
+
+    [[nodiscard]] uint32_t get_next_target_seq_num() const noexcept override {
+        return backend_.get_next_target_seq_num();
+    }
+
+    // ========================================================================
+    // Session Management (producer thread)
+    // ========================================================================
+
+    void reset() noexcept override {
+        drain();
+        backend_.reset();
+    }
+
+    /// Barrier: every message stored so far is in the backend and flushed
+    void flush() noexcept override {
+        drain();
+        backend_.flush();
+    }
+
+    /// Wait until the flusher has written everything queued so far
+    void drain() const noexcept {
+        const uint64_t target = enqueued_;
+        memory::YieldingWait::wait_until([&] {
+            return written_.load(std::memory_order_acquire) >= target;
+        });
+    }
+
+    [[nodiscard]] std::string_view session_id() const noexcept override {
+        return backend_.session_id();
+    }
+
+    /// Backend statistics (messages still queued are not yet counted)
+    [[nodiscard]] Stats stats() const noexcept override {
+        return backend_.stats();
+    }
+
+    // ========================================================================
+    // Additional Methods
+    // ========================================================================
+
+    /// Messages queued but not yet written to the backend
+    [[nodiscard]] size_t pending() const noexcept {
+        return static_cast<size_t>(enqueued_ - written_.load(std::memory_order_acquire));
+    }
+
+    /// Stores that waited for a free slot (flusher fell behind)
+    [[nodiscard]] uint64_t full_waits() const noexcept { return full_waits_; }
+
+    /// Stores larger than slot_size written synchronously
+    [[nodiscard]] uint64_t oversize_stores() const noexcept { return oversize_; }
+
+    /// The decorated store
+    [[nodiscard]] IMessageStore& backend() const noexcept { return backend_; }
+
+private:
+    struct Entry {
+        uint32_t seq_num;
+        uint32_t slot;
+        uint32_t length;
+    };
+
+    using Queue = memory::SPSCQueue<Entry, QUEUE_CAPACITY, memory::YieldingWait>;
+
+    void run_flusher() noexcept {
+        if (config_.flusher_cpu >= 0) {
+            (void)util::CpuAffinity::pin_to_core(config_.flusher_cpu);
+        }
+
+        std::array<Entry, FLUSH_BATCH> batch;
+        for (;;) {
+            const size_t n = queue_->try_pop_n(batch);
+            if (n == 0) {
+                // Producer is gone once running_ drops: exit when empty
+                if (!running_.load(std::memory_order_acquire) && queue_->empty()) break;
+                std::this_thread::sleep_for(config_.idle_sleep);
+                continue;
+            }
+
+            for (size_t i = 0; i < n; ++i) {
+                const Entry& e = batch[i];
+                (void)backend_.store(e.seq_num, std::span<const char>{
+                    slab_.get() + e.slot * config_.slot_size, e.length});
+            }
+            written_.store(written_.load(std::memory_order_relaxed) + n,
+                           std::memory_order_release);
+        }
+    }
+
+    IMessageStore& backend_;
+    AsyncStoreConfig config_;
+    std::unique_ptr<char[]> slab_;
+    std::unique_ptr<Queue> queue_;
+
+    // Producer side
+    uint64_t enqueued_{0};
+    uint64_t full_waits_{0};
+    uint64_t oversize_{0};
+
+    // Flusher side
+    alignas(memory::CACHE_LINE_SIZE) std::atomic<uint64_t> written_{0};
+    std::atomic<bool> running_{true};
+
+    std::thread flusher_;  // Last: starts once everything above exists
+};
+
+} // namespace nfx::store
@@ -9,14 +9,212 @@
 
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <cstdint>
+#include <cstring>
 #include <span>
+#include <type_traits>
 #include <optional>
 #include <vector>
 #include <string_view>
 
+#include "nexusfix/interfaces/i_message.hpp"
+
 namespace nfx::store {
 
+// ============================================================================
+// Message Metadata
+// ============================================================================
+
+/// Per-message header summary kept next to each stored payload, so resend
+/// handling can gap-fill or rewrite a message without scanning it again
+struct MessageMeta {
+    static constexpr uint8_t VALID = 0x01;              // Header parsed
+    static constexpr uint8_t ADMIN = 0x02;              // Session-level MsgType
+    static constexpr uint8_t HAS_POSS_DUP = 0x04;       // 43 present
+    static constexpr uint8_t HAS_ORIG_SENDING_TIME = 0x08;  // 122 present
+    static constexpr uint8_t CHECKSUM_OK = 0x10;        // Trailer matched when stored
+
+    char msg_type[2]{};             // MsgType (35); second byte 0 for one-char types
+    uint8_t flags{0};
+    uint8_t reserved{0};
+    uint16_t sending_time_offset{0};    // Start of the "52=" field (0 = none)
+    uint16_t header_length{0};          // Bytes up to the first body field
+
+    [[nodiscard]] constexpr bool valid() const noexcept { return flags & VALID; }
+    [[nodiscard]] constexpr bool is_admin() const noexcept { return flags & ADMIN; }
+
+    [[nodiscard]] constexpr std::string_view type() const noexcept {
+        return {msg_type, msg_type[1] != '\0' ? 2u : msg_type[0] != '\0' ? 1u : 0u};
+    }
+
+    /// Session-level messages other than Reject are gap-filled on resend
+    [[nodiscard]] constexpr bool gap_fill_on_resend() const noexcept {
+        return is_admin() && msg_type[0] != ::nfx::msg_type::Reject;
+    }
+
+    /// 8-byte form for atomic slots
+    [[nodiscard]] uint64_t pack() const noexcept { return std::bit_cast<uint64_t>(*this); }
+    [[nodiscard]] static MessageMeta unpack(uint64_t bits) noexcept {
+        return std::bit_cast<MessageMeta>(bits);
+    }
+};
+
+static_assert(sizeof(MessageMeta) == 8);
+
+namespace detail {
+
+/// Standard header tags (FIX 4.2 - FIXT 1.1)
+[[nodiscard]] constexpr bool is_header_tag(uint32_t tag) noexcept {
+    switch (tag) {
+        case 8: case 9: case 35: case 49: case 56: case 115: case 128: case 90:
+        case 91: case 34: case 50: case 142: case 57: case 143: case 116: case 144:
+        case 129: case 145: case 43: case 97: case 52: case 122: case 212: case 213:
+        case 347: case 369: case 627: case 628: case 629: case 630: case 1128: case 1129:
+        case 1156:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace detail
+
+/// Summarise the header of a complete FIX message (one pass over the
+/// header fields only)
+/// @param soh Offsets of the first SOHs if already known (e.g. from
+///        parser::copy_checksum_soh()); later fields fall back to memchr
+/// @return Meta without VALID if 8/9/35 are not the first three fields
+[[nodiscard]] inline MessageMeta describe_message(std::span<const char> msg,
+                                                  std::span<const uint32_t> soh = {}) noexcept {
+    MessageMeta meta;
+    const char* data = msg.data();
+    const size_t size = std::min<size_t>(msg.size(), UINT16_MAX);
+    size_t pos = 0;
+
+    for (size_t field = 0; pos < size; ++field) {
+        size_t end;
+        if (field < soh.size()) {
+            end = soh[field];
+            if (end >= size) return MessageMeta{};
+        } else {
+            const auto* p = static_cast<const char*>(std::memchr(data + pos, '\x01', size - pos));
+            if (!p) return MessageMeta{};
+            end = static_cast<size_t>(p - data);
+        }
+
+        uint32_t tag = 0;
+        size_t i = pos;
+        while (i < end && data[i] >= '0' && data[i] <= '9' && tag < 100000) {
+            tag = tag * 10 + static_cast<uint32_t>(data[i] - '0');
+            ++i;
+        }
+        if (i == pos || i >= end || data[i] != '=') return MessageMeta{};
+
+        constexpr uint32_t EXPECTED[] = {8, 9, 35};
+        if (field < 3 && tag != EXPECTED[field]) return MessageMeta{};
+
+        if (!detail::is_header_tag(tag)) {
+            meta.header_length = static_cast<uint16_t>(pos);
+            meta.flags |= MessageMeta::VALID;
+            return meta;
+        }
+
+        const size_t value = i + 1;
+        switch (tag) {
+            case 35:
+                if (end - value == 0 || end - value > 2) return MessageMeta{};
+                meta.msg_type[0] = data[value];
+                meta.msg_type[1] = end - value == 2 ? data[value + 1] : '\0';
+                if (end - value == 1 && msg_type::is_admin(data[value])) {
+                    meta.flags |= MessageMeta::ADMIN;
+                }
+                break;
+            case 52:  meta.sending_time_offset = static_cast<uint16_t>(pos); break;
+            case 43:  meta.flags |= MessageMeta::HAS_POSS_DUP; break;
+            case 122: meta.flags |= MessageMeta::HAS_ORIG_SENDING_TIME; break;
+            default: break;
+        }
+        pos = end + 1;
+    }
+    return MessageMeta{};   // Header never ended (no trailer)
+}
+
+/// Does the "10=NNN" trailer match byte_sum, the checksum of the whole
+/// message including the trailer (as returned by a copy+checksum kernel)?
+[[nodiscard]] inline bool trailer_matches(std::span<const char> msg, uint8_t byte_sum) noexcept {
+    constexpr size_t TRAILER = 7;   // "10=NNN" SOH
+    if (msg.size() <= TRAILER) return false;
+    const char* t = msg.data() + msg.size() - TRAILER;
+    if (t[-1] != '\x01' || t[0] != '1' || t[1] != '0' || t[2] != '=' || t[6] != '\x01') {
+        return false;
+    }
+    unsigned expected = 0;
+    uint8_t trailer_sum = 0;
+    for (size_t i = 0; i < TRAILER; ++i) trailer_sum += static_cast<uint8_t>(t[i]);
+    for (size_t i = 3; i < 6; ++i) {
+        if (t[i] < '0' || t[i] > '9') return false;
+        expected = expected * 10 + static_cast<unsigned>(t[i] - '0');
+    }
+    return static_cast<uint8_t>(byte_sum - trailer_sum) == expected;
+}
+
+// ============================================================================
+// Message Visitor
+// ============================================================================
+
+/// Non-owning callback over stored messages (no allocation, no std::function)
+/// The callable receives (seq_num, message bytes) or (seq_num, message
+/// bytes, const MessageMeta&) and may return false to stop.
+/// The span is only valid for the duration of the call.
+class MessageVisitor {
+public:
+    template <typename F>
+        requires std::is_invocable_v<F&, uint32_t, std::span<const char>> ||
+                 std::is_invocable_v<F&, uint32_t, std::span<const char>, const MessageMeta&>
+    MessageVisitor(F& fn) noexcept  // NOLINT: implicit by design
+        : ctx_{static_cast<void*>(&fn)}
+        , invoke_{&invoke_impl<F>} {}
+
+    /// Visit with the metadata the store kept for the message
+    bool operator()(uint32_t seq_num, std::span<const char> msg,
+                    const MessageMeta& meta) const noexcept {
+        return invoke_(ctx_, seq_num, msg, &meta);
+    }
+
+    /// Visit a message whose metadata the store did not keep (described
+    /// on demand if the callable asks for it)
+    bool operator()(uint32_t seq_num, std::span<const char> msg) const noexcept {
+        return invoke_(ctx_, seq_num, msg, nullptr);
+    }
+
+private:
+    template <typename F>
+    static bool invoke_impl(void* ctx, uint32_t seq_num, std::span<const char> msg,
+                            const MessageMeta* meta) noexcept {
+        auto& fn = *static_cast<F*>(ctx);
+        if constexpr (std::is_invocable_v<F&, uint32_t, std::span<const char>, const MessageMeta&>) {
+            const MessageMeta described = meta ? *meta : describe_message(msg);
+            if constexpr (std::is_void_v<std::invoke_result_t<F&, uint32_t, std::span<const char>,
+                                                              const MessageMeta&>>) {
+                fn(seq_num, msg, described);
+                return true;
+            } else {
+                return static_cast<bool>(fn(seq_num, msg, described));
+            }
+        } else if constexpr (std::is_same_v<std::invoke_result_t<F&, uint32_t, std::span<const char>>, void>) {
+            fn(seq_num, msg);
+            return true;
+        } else {
+            return static_cast<bool>(fn(seq_num, msg));
+        }
+    }
+
+    void* ctx_;
+    bool (*invoke_)(void*, uint32_t, std::span<const char>, const MessageMeta*) noexcept;
+};
+
 // ============================================================================
 // Message Store Interface
 // ============================================================================
@@ -50,6 +248,38 @@ public:
     [[nodiscard]] virtual std::vector<std::vector<char>>
         retrieve_range(uint32_t begin_seq, uint32_t end_seq) const noexcept = 0;
 
+    /// Visit a range of stored messages in sequence order without copying
+    /// @param begin_seq Start sequence number (inclusive)
+    /// @param end_seq End sequence number (inclusive, 0 = infinity)
+    /// @param visitor Called once per stored message; return false to stop
+    /// @return Number of messages visited
+    /// @note The visitor must not call back into this store. The default
+    ///       implementation copies via retrieve(); stores override it to
+    ///       serve views straight from their own storage.
+    virtual size_t for_each_in_range(uint32_t begin_seq, uint32_t end_seq,
+                                     MessageVisitor visitor) const noexcept {
+        uint32_t last = end_seq;
+        if (last == 0) {
+            uint32_t next = get_next_sender_seq_num();
+            last = next > 0 ? next - 1 : 0;
+        }
+
+        size_t visited = 0;
+        for (uint32_t seq = begin_seq; seq != 0 && seq <= last; ++seq) {
+            if (auto msg = retrieve(seq)) {
+                ++visited;
+                if (!visitor(seq, *msg)) break;
+            }
+        }
+        return visited;
+    }
+
+    /// Convenience wrapper: visit a range with any callable
+    template <typename F>
+    size_t visit_range(uint32_t begin_seq, uint32_t end_seq, F&& fn) const noexcept {
+        return for_each_in_range(begin_seq, end_seq, MessageVisitor{fn});
+    }
+
     // ========================================================================
     // Sequence Number Persistence
     // ========================================================================
@@ -79,6 +309,11 @@ public:
     /// Get the session identifier
     [[nodiscard]] virtual std::string_view session_id() const noexcept = 0;
 
+    /// Return buffer memory an idle session does not need, keeping every
+    /// stored message; the next store() takes it back
+    /// @return Bytes released (0 if the store cannot shrink)
+    virtual size_t shrink_to_fit() noexcept { return 0; }
+
     // ========================================================================
     // Store Statistics
     // ========================================================================
@@ -118,6 +353,10 @@ public:
         return {};
     }
 
+    size_t for_each_in_range(uint32_t, uint32_t, MessageVisitor) const noexcept override {
+        return 0;
+    }
+
     void set_next_sender_seq_num(uint32_t seq) noexcept override {
         next_sender_seq_ = seq;
     }
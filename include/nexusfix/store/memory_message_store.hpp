@@ -8,45 +8,45 @@
     - Scenarios where durability is not critical
 
     For production with durability requirements, use MmapMessageStore.
+
+    Layout (outbound seq nums are dense and increasing):
+    - Byte log: one fixed circular buffer; a store is an append, wrapping
+      to the start when a message would straddle the end. The copy also
+      checksums the message and locates the header SOHs, so describing
+      it touches no byte a second time
+    - Index: dense ring of (seq, offset, length, MessageMeta) slots
+      addressed by seq & mask; retrieve is one slot load, no hashing
+    - Eviction: advancing the oldest seq; space is reused in place
+    - Header elision (Config::elide_session_header): BeginString and the
+      SenderCompID/TargetCompID pair repeat in every outbound message, so
+      they are kept once and spliced back in on retrieval
+
+    Memory is allocated once at construction and never grows.
 */
 
 #pragma once
 
 #include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/memory/huge_page_allocator.hpp"
+#include "nexusfix/parser/simd_checksum.hpp"
 
+#include <atomic>
 #include <mutex>
 #include <shared_mutex>
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
 #include <memory_resource>
-
-// Use Abseil flat_hash_map for ~3x faster lookups (Swiss Tables with SIMD probing)
-#if defined(NFX_HAS_ABSEIL) && NFX_HAS_ABSEIL
-    #include <absl/container/flat_hash_map.h>
-    #define NFX_USE_ABSEIL_HASH_MAP 1
-#else
-    #include <unordered_map>
-    #define NFX_USE_ABSEIL_HASH_MAP 0
-#endif
+#include <new>
 
 namespace nfx::store {
 
-// ============================================================================
-// Hash Map Type Selection
-// ============================================================================
-
-/// Hash map type - absl::flat_hash_map when available, std::unordered_map otherwise
-template<typename K, typename V>
-#if NFX_USE_ABSEIL_HASH_MAP
-using HashMap = absl::flat_hash_map<K, V>;
-#else
-using HashMap = std::unordered_map<K, V>;
-#endif
-
 // ============================================================================
 // Memory Message Store
 // ============================================================================
 
-/// In-memory message store with optional size limits
+/// In-memory message store with bounded, preallocated storage
 class MemoryMessageStore final : public IMessageStore {
 public:
     /// Configuration for the memory store
@@ -55,118 +55,206 @@ public:
         size_t max_messages = 10000;      // Maximum messages to retain
         size_t max_bytes = 100'000'000;   // 100MB max
         bool evict_oldest = true;         // Evict oldest when full
-        size_t pool_size_bytes = 64 * 1024 * 1024;  // 64MB PMR pool
+        size_t pool_size_bytes = 64 * 1024 * 1024;  // 64MB byte log capacity
         std::pmr::memory_resource* upstream_resource = nullptr;  // Optional: mimalloc SessionHeap
+        bool huge_pages = false;          // Byte log on prefaulted huge pages
+        int numa_node = -1;               // Huge-page log's NUMA node (-1 = local)
+        bool elide_session_header = false;  // Drop BeginString/CompIDs from stored bytes
     };
 
-    /// PMR pool metrics for monitoring
+    /// Byte log metrics for monitoring
     struct PoolMetrics {
-        size_t pool_capacity{0};          // Total pool size in bytes
-        size_t bytes_allocated{0};        // Current bytes allocated from pool
+        size_t pool_capacity{0};          // Byte log size in bytes
+        size_t bytes_allocated{0};        // Log bytes in use (incl. wrap padding)
         size_t peak_usage{0};             // High water mark
-        size_t reset_count{0};            // Number of pool resets
+        size_t reset_count{0};            // Number of store resets
+        size_t bytes_elided{0};           // Header bytes not written (elide_session_header)
     };
 
     explicit MemoryMessageStore(Config config)
         : config_(std::move(config))
-        , pool_storage_(config_.upstream_resource ? 0 : config_.pool_size_bytes)
-        , pool_(pool_storage_.data(), pool_storage_.size(),
-                config_.upstream_resource ? config_.upstream_resource
-                                         : std::pmr::null_memory_resource())
-        , pool_metrics_{.pool_capacity = config_.pool_size_bytes} {}
+        , resource_(config_.upstream_resource ? config_.upstream_resource
+                                              : std::pmr::new_delete_resource())
+        , log_capacity_(full_log_capacity())
+        , log_(allocate_log())
+        , index_(full_index_size(), Slot{},
+                 std::pmr::polymorphic_allocator<Slot>(resource_))
+        , index_mask_(index_.size() - 1)
+        , pool_metrics_{.pool_capacity = log_capacity_} {}
 
     explicit MemoryMessageStore(std::string_view session_id)
         : MemoryMessageStore(Config{.session_id = std::string(session_id)}) {}
 
+    ~MemoryMessageStore() override {
+        if (config_.huge_pages) {
+            memory::HugePageAllocator::deallocate(log_, log_capacity_);
+        } else {
+            resource_->deallocate(log_, log_capacity_, LOG_ALIGNMENT);
+        }
+    }
+
+    MemoryMessageStore(const MemoryMessageStore&) = delete;
+    MemoryMessageStore& operator=(const MemoryMessageStore&) = delete;
+
     // ========================================================================
     // Message Storage
     // ========================================================================
 
+    /// Store a message. Sequence numbers must increase: a seq num at or
+    /// below the newest stored one is rejected (duplicates without
+    /// counting as a failure).
     [[nodiscard]] bool store(uint32_t seq_num,
                             std::span<const char> msg) noexcept override {
         std::unique_lock lock(mutex_);
 
-        // Check capacity
-        if (messages_.size() >= config_.max_messages ||
-            total_bytes_ + msg.size() > config_.max_bytes) {
-            if (config_.evict_oldest && !messages_.empty()) {
-                evict_oldest_locked();
-            } else {
+        if (seq_num == 0 || (count_ > 0 && seq_num <= max_seq_)) {
+            if (!contains_locked(seq_num)) ++stats_.store_failures;
+            return false;
+        }
+        if (shrunk_) [[unlikely]] {
+            if (!relocate_locked(full_log_capacity(), full_index_size())) {
                 ++stats_.store_failures;
                 return false;
             }
         }
-
-        // Allocate message buffer from PMR pool (O(1), no syscall)
-        std::pmr::polymorphic_allocator<char> alloc(&pool_);
-        PmrVector pmr_msg(alloc);
-        try {
-            pmr_msg.assign(msg.begin(), msg.end());
-        } catch (const std::bad_alloc&) {
-            // Pool exhausted
+        if (msg.size() > log_capacity_ || msg.size() > config_.max_bytes) {
             ++stats_.store_failures;
             return false;
         }
 
-        // Store the message
-        auto [it, inserted] = messages_.try_emplace(
-            seq_num,
-            std::move(pmr_msg)
-        );
-
-        if (inserted) {
-            total_bytes_ += msg.size();
-            ++stats_.messages_stored;
-            stats_.bytes_stored += msg.size();
-
-            // Update pool metrics
-            pool_metrics_.bytes_allocated += msg.size();
-            if (pool_metrics_.bytes_allocated > pool_metrics_.peak_usage) {
-                pool_metrics_.peak_usage = pool_metrics_.bytes_allocated;
+        // Session-constant header fields are cut before sizing the write
+        MessageMeta meta;
+        size_t block_at = 0;
+        if (config_.elide_session_header) {
+            meta = describe_message(msg);
+            block_at = elision_point(msg, meta);
+        }
+        const size_t stored = block_at ? msg.size() - elided_size() : msg.size();
+
+        // Log position: wrap to the start rather than split the message
+        uint64_t pos = write_pos_;
+        const size_t physical = static_cast<size_t>(pos % log_capacity_);
+        if (physical + stored > log_capacity_) {
+            pos += log_capacity_ - physical;
+        }
+
+        // Make room: index window, message count, byte budget, log space
+        while (count_ > 0 &&
+               (seq_num - min_seq_ > index_mask_ ||
+                count_ >= config_.max_messages ||
+                total_bytes_ + stored > config_.max_bytes ||
+                pos + stored - index_[min_seq_ & index_mask_].offset > log_capacity_)) {
+            if (!config_.evict_oldest) {
+                ++stats_.store_failures;
+                return false;
             }
+            evict_oldest_locked();
+        }
+        if (count_ == 0) {
+            // Empty log: restart at offset 0, no slot refers to old positions
+            pos = 0;
+            min_seq_ = seq_num;
+        }
 
-            // Track min/max sequence for efficient range queries
-            if (seq_num < min_seq_) min_seq_ = seq_num;
-            if (seq_num > max_seq_) max_seq_ = seq_num;
+        char* dst = log_ + (pos % log_capacity_);
+        uint8_t sum;
+        if (block_at) {
+            // Two copies around the elided fields; their bytes are constant
+            const size_t prefix = template_prefix_;
+            const size_t block = template_size_ - prefix;
+            const size_t head = block_at - prefix;
+            sum = static_cast<uint8_t>(template_sum_ +
+                parser::copy_checksum(dst, msg.data() + prefix, head) +
+                parser::copy_checksum(dst + head, msg.data() + block_at + block,
+                                      msg.size() - block_at - block));
+            pool_metrics_.bytes_elided += template_size_;
+        } else if (config_.elide_session_header) {
+            sum = parser::copy_checksum(dst, msg.data(), msg.size());
+        } else {
+            std::array<uint32_t, HEADER_SOH_SCAN> soh;
+            const auto scan = parser::copy_checksum_soh(dst, msg.data(), msg.size(), soh);
+            meta = describe_message(msg, std::span{soh.data(), scan.soh_count});
+            sum = scan.checksum;
+        }
+        if (trailer_matches(msg, sum)) meta.flags |= MessageMeta::CHECKSUM_OK;
+
+        index_[seq_num & index_mask_] = Slot{
+            .offset = pos,
+            .length = static_cast<uint32_t>(stored),
+            .seq_num = seq_num,
+            .meta = meta,
+            .block_at = static_cast<uint16_t>(block_at),
+        };
+        write_pos_ = pos + stored;
+        max_seq_ = seq_num;
+        ++count_;
+
+        total_bytes_ += stored;
+        ++stats_.messages_stored;
+        stats_.bytes_stored += msg.size();
+
+        pool_metrics_.bytes_allocated =
+            static_cast<size_t>(write_pos_ - index_[min_seq_ & index_mask_].offset);
+        if (pool_metrics_.bytes_allocated > pool_metrics_.peak_usage) {
+            pool_metrics_.peak_usage = pool_metrics_.bytes_allocated;
         }
 
-        return inserted;
+        return true;
     }
 
     [[nodiscard]] std::optional<std::vector<char>>
         retrieve(uint32_t seq_num) const noexcept override {
         std::shared_lock lock(mutex_);
 
-        auto it = messages_.find(seq_num);
-        if (it != messages_.end()) {
+        if (const Slot* slot = find_locked(seq_num)) {
             ++stats_.messages_retrieved;
-            // Copy from PMR storage to regular vector for return
-            return std::vector<char>(it->second.begin(), it->second.end());
+            const char* data = slot_data(*slot);
+            if (slot->block_at == 0) {
+                return std::vector<char>(data, data + slot->length);
+            }
+            std::vector<char> msg(slot->length + template_size_);
+            (void)expand(*slot, msg.data());
+            return msg;
         }
         return std::nullopt;
     }
 
     [[nodiscard]] std::vector<std::vector<char>>
         retrieve_range(uint32_t begin_seq, uint32_t end_seq) const noexcept override {
-        std::shared_lock lock(mutex_);
-
         std::vector<std::vector<char>> result;
+        (void)visit_range(begin_seq, end_seq, [&](uint32_t, std::span<const char> msg) {
+            result.emplace_back(msg.begin(), msg.end());
+        });
+        return result;
+    }
 
-        // End sequence 0 means "to infinity"
-        uint32_t actual_end = (end_seq == 0) ? max_seq_ : end_seq;
+    /// Zero-copy range visit served straight from the byte log (messages
+    /// stored with an elided header are rebuilt in a stack buffer)
+    size_t for_each_in_range(uint32_t begin_seq, uint32_t end_seq,
+                             MessageVisitor visitor) const noexcept override {
+        std::shared_lock lock(mutex_);
 
-        for (uint32_t seq = begin_seq; seq <= actual_end; ++seq) {
-            auto it = messages_.find(seq);
-            if (it != messages_.end()) {
-                // Copy from PMR storage to regular vector
-                result.emplace_back(it->second.begin(), it->second.end());
+        if (count_ == 0) return 0;
+        uint32_t actual_end = (end_seq == 0 || end_seq > max_seq_) ? max_seq_ : end_seq;
+        size_t visited = 0;
+        std::array<char, MAX_EXPANDED_SIZE> scratch;
+
+        for (uint32_t seq = std::max(begin_seq, min_seq_); seq <= actual_end; ++seq) {
+            if (const Slot* slot = find_locked(seq)) {
+                ++visited;
                 ++stats_.messages_retrieved;
+                std::span<const char> msg{slot_data(*slot), slot->length};
+                if (slot->block_at != 0) {
+                    msg = {scratch.data(), expand(*slot, scratch.data())};
+                }
+                if (!visitor(seq, msg, slot->meta)) {
+                    break;
+                }
             }
         }
 
-        return result;
+        return visited;
     }
-
     // ========================================================================
     // Sequence Number Persistence
     // ========================================================================
@@ -193,16 +281,18 @@ public:
 
     void reset() noexcept override {
         std::unique_lock lock(mutex_);
-        messages_.clear();
 
-        // Release PMR pool - O(1) memory reclamation
-        pool_.release();
+        // O(capacity) slot clear; the byte log is simply overwritten
+        std::fill(index_.begin(), index_.end(), Slot{});
         ++pool_metrics_.reset_count;
         pool_metrics_.bytes_allocated = 0;
 
+        count_ = 0;
+        write_pos_ = 0;
         total_bytes_ = 0;
-        min_seq_ = UINT32_MAX;
+        min_seq_ = 0;
         max_seq_ = 0;
+        template_size_ = 0;     // Relearned from the next stored message
         next_sender_seq_.store(1, std::memory_order_release);
         next_target_seq_.store(1, std::memory_order_release);
         stats_ = Stats{};
@@ -216,11 +306,45 @@ public:
         return config_.session_id;
     }
 
+    /// Shrink the byte log and index to the stored messages, e.g. for an
+    /// idle session. Retrieval is unaffected; the next store() restores
+    /// the configured sizes. Huge-page logs are left alone.
+    size_t shrink_to_fit() noexcept override {
+        std::unique_lock lock(mutex_);
+        if (config_.huge_pages) return 0;
+
+        const size_t window = count_ > 0 ? static_cast<size_t>(max_seq_ - min_seq_) + 1 : 1;
+        const size_t index_size = std::bit_ceil(window);
+        const size_t log_size = std::max<size_t>(
+            (total_bytes_ + LOG_ALIGNMENT - 1) & ~(LOG_ALIGNMENT - 1), LOG_ALIGNMENT);
+        if (log_size >= log_capacity_ && index_size >= index_.size()) return 0;
+
+        const size_t before = log_capacity_ + index_.size() * sizeof(Slot);
+        if (!relocate_locked(std::min(log_size, log_capacity_),
+                             std::min(index_size, index_.size()))) {
+            return 0;
+        }
+        shrunk_ = true;
+        return before - (log_capacity_ + index_.size() * sizeof(Slot));
+    }
+
+    /// Whether shrink_to_fit() shrank the buffers and no store() has run since
+    [[nodiscard]] bool shrunk() const noexcept {
+        std::shared_lock lock(mutex_);
+        return shrunk_;
+    }
+
+    /// Byte log plus index bytes currently allocated
+    [[nodiscard]] size_t memory_footprint() const noexcept {
+        std::shared_lock lock(mutex_);
+        return log_capacity_ + index_.size() * sizeof(Slot);
+    }
+
     [[nodiscard]] Stats stats() const noexcept override {
         return stats_;
     }
 
-    /// Get PMR pool metrics for monitoring
+    /// Get byte log metrics for monitoring
     [[nodiscard]] PoolMetrics pool_metrics() const noexcept {
         std::shared_lock lock(mutex_);
         return pool_metrics_;
@@ -233,7 +357,7 @@ public:
     /// Get current message count
     [[nodiscard]] size_t message_count() const noexcept {
         std::shared_lock lock(mutex_);
-        return messages_.size();
+        return count_;
     }
 
     /// Get total bytes stored
@@ -245,47 +369,199 @@ public:
     /// Check if a sequence number exists
     [[nodiscard]] bool contains(uint32_t seq_num) const noexcept {
         std::shared_lock lock(mutex_);
-        return messages_.contains(seq_num);
+        return contains_locked(seq_num);
     }
 
 private:
-    /// PMR-allocated vector type for message storage
-    using PmrVector = std::pmr::vector<char>;
+    static constexpr size_t LOG_ALIGNMENT = 64;
+    static constexpr size_t HEADER_SOH_SCAN = 16;   // Header fields located during the copy
+    static constexpr size_t TEMPLATE_CAPACITY = 128;  // BeginString + CompID fields
+    static constexpr size_t MAX_EXPANDED_SIZE = fix::MAX_MESSAGE_SIZE;
+
+    /// Byte log from huge pages (prefaulted, THP fallback) or the resource
+    [[nodiscard]] char* allocate_log() {
+        if (config_.huge_pages) {
+            void* p = memory::HugePageAllocator::allocate_prefaulted(
+                log_capacity_, memory::HugePageSize::Huge2MB, config_.numa_node);
+            if (!p) throw std::bad_alloc();
+            return static_cast<char*>(p);
+        }
+        return static_cast<char*>(resource_->allocate(log_capacity_, LOG_ALIGNMENT));
+    }
 
-    void evict_oldest_locked() noexcept {
-        // Find and remove the oldest message (smallest sequence number)
-        if (messages_.empty()) return;
-
-        auto it = messages_.find(min_seq_);
-        if (it != messages_.end()) {
-            size_t msg_size = it->second.size();
-            total_bytes_ -= msg_size;
-            // Note: PMR monotonic buffer doesn't reclaim on erase,
-            // memory is reclaimed on pool reset()
-            messages_.erase(it);
-
-            // Update min_seq_
-            if (messages_.empty()) {
-                min_seq_ = UINT32_MAX;
-            } else {
-                // Find new minimum
-                min_seq_ = UINT32_MAX;
-                for (const auto& [seq, _] : messages_) {
-                    if (seq < min_seq_) min_seq_ = seq;
+    [[nodiscard]] size_t full_log_capacity() const noexcept {
+        return std::max<size_t>(config_.pool_size_bytes, 1);
+    }
+
+    [[nodiscard]] size_t full_index_size() const noexcept {
+        return std::bit_ceil(std::max<size_t>(config_.max_messages, 1));
+    }
+
+    /// Index entry; seq_num 0 marks a never-used slot
+    struct Slot {
+        uint64_t offset{0};       // Monotonic log position (mod capacity = byte offset)
+        uint32_t length{0};
+        uint32_t seq_num{0};
+        MessageMeta meta;
+        uint16_t block_at{0};     // Elided CompID block's offset in the full message (0 = stored whole)
+    };
+
+    [[nodiscard]] const Slot* find_locked(uint32_t seq_num) const noexcept {
+        if (count_ == 0 || seq_num < min_seq_ || seq_num > max_seq_) return nullptr;
+        const Slot& slot = index_[seq_num & index_mask_];
+        return slot.seq_num == seq_num ? &slot : nullptr;
+    }
+
+    [[nodiscard]] bool contains_locked(uint32_t seq_num) const noexcept {
+        return find_locked(seq_num) != nullptr;
+    }
+
+    [[nodiscard]] const char* slot_data(const Slot& slot) const noexcept {
+        return log_ + (slot.offset % log_capacity_);
+    }
+
+    [[nodiscard]] size_t elided_size() const noexcept { return template_size_; }
+
+    /// Where the session-constant CompID block sits in msg, or 0 if msg
+    /// cannot be stored elided. The first eligible message defines the
+    /// template: its BeginString field and adjacent 49/56 fields.
+    [[nodiscard]] size_t elision_point(std::span<const char> msg, const MessageMeta& meta) noexcept {
+        if (!meta.valid() || msg.size() > MAX_EXPANDED_SIZE) return 0;
+        const std::string_view header{msg.data(), meta.header_length};
+
+        if (template_size_ == 0 && !learn_template(header)) return 0;
+
+        const std::string_view prefix{header_template_.data(), template_prefix_};
+        const std::string_view block{header_template_.data() + template_prefix_,
+                                     template_size_ - template_prefix_};
+        if (!header.starts_with(prefix)) return 0;
+        if (block.empty()) return template_prefix_;
+
+        // Block starts with a tag, so a match after an SOH is a field boundary
+        for (size_t at = header.find(block, template_prefix_); at != std::string_view::npos;
+             at = header.find(block, at + 1)) {
+            if (header[at - 1] == '\x01') return at;
+        }
+        return 0;
+    }
+
+    /// Take the BeginString field and the adjacent SenderCompID and
+    /// TargetCompID fields (either order) of header as the template
+    [[nodiscard]] bool learn_template(std::string_view header) noexcept {
+        const size_t prefix = header.find('\x01') + 1;
+        if (prefix == 0 || prefix > TEMPLATE_CAPACITY) return false;
+
+        std::string_view block;
+        for (size_t pos = prefix; pos < header.size();) {
+            const size_t end = header.find('\x01', pos);
+            if (end == std::string_view::npos) break;
+            const std::string_view field = header.substr(pos, end + 1 - pos);
+            const bool first = field.starts_with("49=") || field.starts_with("56=");
+            if (first && end + 1 < header.size()) {
+                const size_t next_end = header.find('\x01', end + 1);
+                const std::string_view next = header.substr(end + 1, next_end - end);
+                if (next_end != std::string_view::npos &&
+                    next.starts_with(field.starts_with("49=") ? "56=" : "49=")) {
+                    block = header.substr(pos, next_end + 1 - pos);
                 }
+                break;
             }
+            pos = end + 1;
+        }
+        if (prefix + block.size() > TEMPLATE_CAPACITY) block = {};
+
+        std::memcpy(header_template_.data(), header.data(), prefix);
+        std::memcpy(header_template_.data() + prefix, block.data(), block.size());
+        template_prefix_ = prefix;
+        template_size_ = prefix + block.size();
+        template_sum_ = parser::checksum(header_template_.data(), template_size_);
+        return true;
+    }
+
+    /// Rebuild an elided message into out; returns its length
+    size_t expand(const Slot& slot, char* out) const noexcept {
+        const char* data = slot_data(slot);
+        const size_t prefix = template_prefix_;
+        const size_t block = template_size_ - prefix;
+        const size_t head = slot.block_at - prefix;
+        std::memcpy(out, header_template_.data(), prefix);
+        std::memcpy(out + prefix, data, head);
+        std::memcpy(out + slot.block_at, header_template_.data() + prefix, block);
+        std::memcpy(out + slot.block_at + block, data + head, slot.length - head);
+        return slot.length + template_size_;
+    }
+
+    /// Move the stored messages into a log and index of the given sizes,
+    /// packed from offset 0 (both must hold what is stored)
+    [[nodiscard]] bool relocate_locked(size_t log_size, size_t index_size) noexcept {
+        char* log = nullptr;
+        std::pmr::vector<Slot> index{std::pmr::polymorphic_allocator<Slot>(resource_)};
+        try {
+            log = static_cast<char*>(resource_->allocate(log_size, LOG_ALIGNMENT));
+            index.assign(index_size, Slot{});
+        } catch (...) {
+            if (log) resource_->deallocate(log, log_size, LOG_ALIGNMENT);
+            return false;
+        }
+
+        uint64_t pos = 0;
+        for (uint32_t seq = min_seq_; count_ > 0 && seq <= max_seq_; ++seq) {
+            const Slot& slot = index_[seq & index_mask_];
+            if (slot.seq_num != seq) continue;
+            std::memcpy(log + pos, slot_data(slot), slot.length);
+            Slot& moved = index[seq & (index_size - 1)];
+            moved = slot;
+            moved.offset = pos;
+            pos += slot.length;
         }
+
+        resource_->deallocate(log_, log_capacity_, LOG_ALIGNMENT);
+        log_ = log;
+        log_capacity_ = log_size;
+        index_ = std::move(index);
+        index_mask_ = index_size - 1;
+        write_pos_ = pos;
+        shrunk_ = false;
+        pool_metrics_.pool_capacity = log_capacity_;
+        pool_metrics_.bytes_allocated = static_cast<size_t>(pos);
+        return true;
+    }
+
+    /// Drop the oldest message and advance min_seq_ to the next stored one.
+    /// Live seq nums always span at most the index window, so the forward
+    /// scan over gaps is bounded and amortised O(1) per stored message.
+    void evict_oldest_locked() noexcept {
+        total_bytes_ -= index_[min_seq_ & index_mask_].length;
+        if (--count_ == 0) return;
+
+        uint32_t seq = min_seq_ + 1;
+        while (index_[seq & index_mask_].seq_num != seq) ++seq;
+        min_seq_ = seq;
     }
 
     Config config_;
 
-    // PMR pool for zero-syscall message allocation
-    std::vector<char> pool_storage_;              // Backing storage
-    std::pmr::monotonic_buffer_resource pool_;    // PMR resource
+    // Byte log: fixed circular buffer, allocated once
+    std::pmr::memory_resource* resource_;
+    size_t log_capacity_;
+    char* log_;
+    uint64_t write_pos_{0};                       // Monotonic append position
+
+    // Dense seq -> slot index (power-of-two ring)
+    std::pmr::vector<Slot> index_;
+    size_t index_mask_;
+    size_t count_{0};
+
+    // Session-constant header fields (elide_session_header); fixed from
+    // the first eligible store until reset()
+    std::array<char, TEMPLATE_CAPACITY> header_template_{};
+    size_t template_prefix_{0};                   // BeginString field incl. SOH
+    size_t template_size_{0};                     // Prefix + CompID block
+    uint8_t template_sum_{0};
 
-    HashMap<uint32_t, PmrVector> messages_;       // Swiss Tables when Abseil available
     size_t total_bytes_{0};
-    uint32_t min_seq_{UINT32_MAX};
+    bool shrunk_{false};                       // Shrunk by shrink_to_fit(); store() regrows
+    uint32_t min_seq_{0};
     uint32_t max_seq_{0};
 
     std::atomic<uint32_t> next_sender_seq_{1};
@@ -0,0 +1,1023 @@
+/*
+    NexusFIX Memory-Mapped Message Store
+
+    Durable, append-only journal for FIX message persistence.
+    - store() is a memcpy into a shared file mapping (no syscall on the send path)
+    - Seq-num -> (offset, MessageMeta) index for O(1) retrieve and resend
+      filtering, rebuilt on open; seq num jumps (SequenceReset, NewSeqNo)
+      start a new dense run instead of filling the gap
+    - Configurable msync/fdatasync policy
+    - Crash-safe recovery: torn or partial tail records are discarded on open,
+      sequence numbers are restored from the header page and the journal itself
+
+    File layout:
+        [JournalHeader (one page)] [Record] [Record] ...
+        Record = RecordHeader (16 bytes) + payload, padded to 8 bytes
+
+    A record becomes visible to recovery only when its commit word is written,
+    which happens after the payload and header fields are in place.
+
+    Compaction (sessions that never reset their sequence numbers): compact()
+    or the start_compactor() thread copies the records still needed (at or
+    above the acknowledged seq num, within the SendingTime retention window)
+    into "<path>.compact" through its own read-only mapping, without taking
+    the store's lock. Records appended meanwhile are caught up the same way;
+    only the last few, the rename() over the journal and the remap happen
+    under the lock, so store() never waits for the copy itself.
+
+    Available on POSIX platforms (Linux, macOS).
+*/
+
+#pragma once
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/store/i_message_store.hpp"
+#include "nexusfix/types/field_types.hpp"
+
+#if NFX_PLATFORM_POSIX
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace nfx::store {
+
+// ============================================================================
+// Sync Policy
+// ============================================================================
+
+/// When the journal is forced to stable storage
+enum class SyncPolicy : uint8_t {
+    None,          // Kernel write-back only (survives process crash, not power loss)
+    Async,         // msync(MS_ASYNC) after every store (schedules write-back)
+    EveryN,        // msync(MS_SYNC) + fdatasync every sync_interval stores
+    EveryMessage   // msync(MS_SYNC) + fdatasync on every store (slowest)
+};
+
+// ============================================================================
+// Journal On-Disk Format
+// ============================================================================
+
+namespace detail {
+
+inline constexpr uint64_t JOURNAL_MAGIC = 0x4C4E524A5846584EULL;  // "NXFXJRNL"
+inline constexpr uint32_t JOURNAL_VERSION = 1;
+inline constexpr uint32_t RECORD_COMMIT = 0x52435846u;            // "FXCR"
+inline constexpr size_t JOURNAL_HEADER_SIZE = 4096;
+inline constexpr size_t RECORD_ALIGNMENT = 8;
+
+/// Journal header (first page of the file)
+struct JournalHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t reserved;
+    uint32_t next_sender_seq;   // Updated via std::atomic_ref
+    uint32_t next_target_seq;   // Updated via std::atomic_ref
+};
+
+/// Per-message record header
+struct RecordHeader {
+    uint32_t commit;    // RECORD_COMMIT once the record is complete
+    uint32_t seq_num;
+    uint32_t length;    // Payload length in bytes
+    uint32_t checksum;  // journal_checksum(seq_num, payload)
+};
+
+static_assert(sizeof(JournalHeader) <= JOURNAL_HEADER_SIZE);
+static_assert(sizeof(RecordHeader) == 16);
+
+[[nodiscard]] constexpr size_t record_size(size_t payload) noexcept {
+    return (sizeof(RecordHeader) + payload + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+}
+
+/// Word-at-a-time payload checksum (detects torn writes after power loss)
+[[nodiscard]] inline uint32_t journal_checksum(uint32_t seq_num,
+                                               std::span<const char> data) noexcept {
+    constexpr uint64_t PRIME = 0x9E3779B97F4A7C15ULL;
+    uint64_t h = (static_cast<uint64_t>(seq_num) << 32) ^ data.size();
+    size_t i = 0;
+    for (; i + 8 <= data.size(); i += 8) {
+        uint64_t w;
+        std::memcpy(&w, data.data() + i, 8);
+        h = (h ^ w) * PRIME;
+        h ^= h >> 29;
+    }
+    if (i < data.size()) {
+        uint64_t w = 0;
+        std::memcpy(&w, data.data() + i, data.size() - i);
+        h = (h ^ w) * PRIME;
+        h ^= h >> 29;
+    }
+    return static_cast<uint32_t>(h ^ (h >> 32));
+}
+
+} // namespace detail
+
+// ============================================================================
+// Memory-Mapped Message Store
+// ============================================================================
+
+/// Durable journal-backed message store
+class MmapMessageStore final : public IMessageStore {
+public:
+    /// Configuration for the journal
+    struct Config {
+        std::string session_id;
+        std::string path;                              // Journal file path
+        size_t initial_size = 64 * 1024 * 1024;        // 64MB preallocated
+        size_t max_size = 1024ULL * 1024 * 1024;       // 1GB hard limit
+        SyncPolicy sync_policy = SyncPolicy::None;
+        uint32_t sync_interval = 1024;                 // For SyncPolicy::EveryN
+        std::chrono::seconds retention{0};             // Compaction drops older SendingTime (0 = keep)
+        size_t compact_threshold = 0;                  // Compactor runs once bytes_used() reaches this
+    };
+
+    /// Recovery information from the last open()
+    struct RecoveryInfo {
+        uint32_t records_recovered{0};
+        uint32_t highest_seq_num{0};
+        size_t bytes_discarded{0};     // Torn tail bytes dropped
+    };
+
+    /// Outcome of one compaction
+    struct CompactionResult {
+        bool compacted{false};         // Journal replaced
+        size_t records_dropped{0};
+        size_t records_kept{0};
+        size_t bytes_before{0};        // bytes_used() before and after
+        size_t bytes_after{0};
+    };
+
+    /// Records copied outside the lock until fewer than this many bytes remain
+    static constexpr size_t COMPACT_LOCKED_TAIL = 64 * 1024;
+
+    /// Open (or create) the journal and recover its contents
+    explicit MmapMessageStore(Config config) noexcept
+        : config_(std::move(config)) {
+        open_journal();
+    }
+
+    MmapMessageStore(std::string_view session_id, std::string path) noexcept
+        : MmapMessageStore(Config{.session_id = std::string(session_id),
+                                  .path = std::move(path)}) {}
+
+    ~MmapMessageStore() override {
+        stop_compactor();
+        close_journal();
+    }
+
+    MmapMessageStore(const MmapMessageStore&) = delete;
+    MmapMessageStore& operator=(const MmapMessageStore&) = delete;
+
+    // ========================================================================
+    // Message Storage
+    // ========================================================================
+
+    [[nodiscard]] bool store(uint32_t seq_num,
+                            std::span<const char> msg) noexcept override {
+        std::unique_lock lock(mutex_);
+
+        if (base_ == nullptr || msg.size() > UINT32_MAX) [[unlikely]] {
+            ++stats_.store_failures;
+            return false;
+        }
+        if (index_lookup(seq_num) != 0) {
+            return false;  // Already stored
+        }
+
+        const size_t rec_size = detail::record_size(msg.size());
+        if (write_pos_ + rec_size + sizeof(detail::RecordHeader) > mapped_size_) [[unlikely]] {
+            if (!grow_locked(write_pos_ + rec_size + sizeof(detail::RecordHeader))) {
+                ++stats_.store_failures;
+                return false;
+            }
+        }
+
+        // Index first: a record that cannot be found must not be committed
+        if (!index_.put(seq_num, IndexEntry{write_pos_, describe_message(msg)})) [[unlikely]] {
+            ++stats_.store_failures;
+            return false;
+        }
+
+        char* rec = base_ + write_pos_;
+        detail::RecordHeader hdr{
+            .commit = 0,
+            .seq_num = seq_num,
+            .length = static_cast<uint32_t>(msg.size()),
+            .checksum = detail::journal_checksum(seq_num, msg)
+        };
+        std::memcpy(rec + sizeof(hdr), msg.data(), msg.size());
+        std::memcpy(rec, &hdr, sizeof(hdr));
+
+        // Terminate the journal after this record before committing it
+        std::memset(rec + rec_size, 0, sizeof(detail::RecordHeader));
+
+        std::atomic_ref<uint32_t>(reinterpret_cast<detail::RecordHeader*>(rec)->commit)
+            .store(detail::RECORD_COMMIT, std::memory_order_release);
+
+        write_pos_ += rec_size;
+        ++record_count_;
+        ++stats_.messages_stored;
+        stats_.bytes_stored += msg.size();
+
+        apply_sync_policy_locked(rec, rec_size);
+        return true;
+    }
+
+    [[nodiscard]] std::optional<std::vector<char>>
+        retrieve(uint32_t seq_num) const noexcept override {
+        std::shared_lock lock(mutex_);
+
+        auto payload = payload_locked(seq_num);
+        if (payload.empty()) return std::nullopt;
+
+        ++stats_.messages_retrieved;
+        return std::vector<char>(payload.begin(), payload.end());
+    }
+
+    [[nodiscard]] std::vector<std::vector<char>>
+        retrieve_range(uint32_t begin_seq, uint32_t end_seq) const noexcept override {
+        std::shared_lock lock(mutex_);
+
+        std::vector<std::vector<char>> result;
+
+        // End sequence 0 means "to infinity"
+        index_.for_each(begin_seq, end_seq == 0 ? UINT32_MAX : end_seq,
+                        [&](uint32_t, const IndexEntry& entry) {
+            auto payload = payload_at(entry.offset);
+            result.emplace_back(payload.begin(), payload.end());
+            ++stats_.messages_retrieved;
+            return true;
+        });
+
+        return result;
+    }
+
+    /// Zero-copy range visit served straight from the mapping
+    size_t for_each_in_range(uint32_t begin_seq, uint32_t end_seq,
+                             MessageVisitor visitor) const noexcept override {
+        std::shared_lock lock(mutex_);
+        size_t visited = 0;
+
+        index_.for_each(begin_seq, end_seq == 0 ? UINT32_MAX : end_seq,
+                        [&](uint32_t seq, const IndexEntry& entry) {
+            ++visited;
+            ++stats_.messages_retrieved;
+            return visitor(seq, payload_at(entry.offset), entry.meta);
+        });
+
+        return visited;
+    }
+
+    // ========================================================================
+    // Sequence Number Persistence
+    // ========================================================================
+
+    void set_next_sender_seq_num(uint32_t seq) noexcept override {
+        next_sender_seq_.store(seq, std::memory_order_release);
+        if (auto* hdr = header()) {
+            std::atomic_ref<uint32_t>(hdr->next_sender_seq).store(seq, std::memory_order_release);
+        }
+    }
+
+    void set_next_target_seq_num(uint32_t seq) noexcept override {
+        next_target_seq_.store(seq, std::memory_order_release);
+        if (auto* hdr = header()) {
+            std::atomic_ref<uint32_t>(hdr->next_target_seq).store(seq, std::memory_order_release);
+        }
+    }
+
+    [[nodiscard]] uint32_t get_next_sender_seq_num() const noexcept override {
+        return next_sender_seq_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] uint32_t get_next_target_seq_num() const noexcept override {
+        return next_target_seq_.load(std::memory_order_acquire);
+    }
+
+    // ========================================================================
+    // Session Management
+    // ========================================================================
+
+    void reset() noexcept override {
+        std::unique_lock lock(mutex_);
+        if (base_ == nullptr) return;
+        ++generation_;   // A compaction in progress must not swap in old records
+
+        write_pos_ = detail::JOURNAL_HEADER_SIZE;
+        std::memset(base_ + write_pos_, 0, sizeof(detail::RecordHeader));
+        index_.clear();
+        record_count_ = 0;
+        unsynced_ = 0;
+
+        set_next_sender_seq_num(1);
+        set_next_target_seq_num(1);
+        stats_ = Stats{};
+
+        sync_range_locked(base_, detail::JOURNAL_HEADER_SIZE + sizeof(detail::RecordHeader));
+    }
+
+    void flush() noexcept override {
+        std::unique_lock lock(mutex_);
+        if (base_ == nullptr) return;
+        sync_range_locked(base_, write_pos_ + sizeof(detail::RecordHeader));
+        unsynced_ = 0;
+    }
+
+    [[nodiscard]] std::string_view session_id() const noexcept override {
+        return config_.session_id;
+    }
+
+    [[nodiscard]] Stats stats() const noexcept override {
+        std::shared_lock lock(mutex_);
+        return stats_;
+    }
+
+    // ========================================================================
+    // Additional Methods
+    // ========================================================================
+
+    /// Check if the journal was opened successfully
+    [[nodiscard]] bool is_open() const noexcept {
+        return base_ != nullptr;
+    }
+
+    /// Recovery results from opening the journal
+    [[nodiscard]] const RecoveryInfo& recovery_info() const noexcept {
+        return recovery_;
+    }
+
+    /// Get current message count
+    [[nodiscard]] size_t message_count() const noexcept {
+        std::shared_lock lock(mutex_);
+        return record_count_;
+    }
+
+    /// Get bytes of journal in use (including header page)
+    [[nodiscard]] size_t bytes_used() const noexcept {
+        std::shared_lock lock(mutex_);
+        return write_pos_;
+    }
+
+    /// Get current mapped file size
+    [[nodiscard]] size_t mapped_size() const noexcept {
+        std::shared_lock lock(mutex_);
+        return mapped_size_;
+    }
+
+    /// Check if a sequence number exists
+    [[nodiscard]] bool contains(uint32_t seq_num) const noexcept {
+        std::shared_lock lock(mutex_);
+        return index_lookup(seq_num) != 0;
+    }
+
+    // ========================================================================
+    // Compaction
+    // ========================================================================
+
+    /// Messages below seq_num will never be resent (e.g. confirmed end of
+    /// day); the next compaction drops them. Never moves backward.
+    void set_acknowledged(uint32_t seq_num) noexcept {
+        uint32_t current = acknowledged_.load(std::memory_order_relaxed);
+        while (seq_num > current &&
+               !acknowledged_.compare_exchange_weak(current, seq_num, std::memory_order_relaxed)) {}
+    }
+
+    [[nodiscard]] uint32_t acknowledged() const noexcept {
+        return acknowledged_.load(std::memory_order_relaxed);
+    }
+
+    /// Rewrite the journal without acknowledged or expired messages and
+    /// swap it in. Runs on the calling thread (the compactor's, normally);
+    /// concurrent store() calls wait only for the final swap.
+    /// @return compacted = false if nothing could be dropped, the journal
+    ///         was reset meanwhile, or the new file could not be written
+    [[nodiscard]] CompactionResult compact() noexcept {
+        std::lock_guard guard(compact_mutex_);
+        Compaction job;
+        job.floor = acknowledged();
+        if (config_.retention.count() > 0) {
+            const auto now = std::chrono::system_clock::now().time_since_epoch();
+            job.cutoff_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                now - config_.retention).count();
+        }
+        return run_compaction(job);
+    }
+
+    /// Compact from a background thread every interval, once bytes_used()
+    /// has reached Config::compact_threshold
+    /// @return false if the compactor is already running or the journal is not open
+    bool start_compactor(std::chrono::milliseconds interval = std::chrono::seconds{10}) noexcept {
+        std::lock_guard lock(compactor_mutex_);
+        if (compactor_.joinable() || !is_open()) return false;
+
+        compactor_stop_ = false;
+        try {
+            compactor_ = std::thread([this, interval] {
+                std::unique_lock guard(compactor_mutex_);
+                while (!compactor_cv_.wait_for(guard, interval, [this] { return compactor_stop_; })) {
+                    guard.unlock();
+                    if (bytes_used() >= config_.compact_threshold) (void)compact();
+                    guard.lock();
+                }
+            });
+        } catch (const std::system_error&) {
+            return false;
+        }
+        return true;
+    }
+
+    /// Stop the compactor thread (also done by the destructor)
+    void stop_compactor() noexcept {
+        std::thread finished;
+        {
+            std::lock_guard lock(compactor_mutex_);
+            if (!compactor_.joinable()) return;
+            compactor_stop_ = true;
+            finished = std::move(compactor_);
+        }
+        compactor_cv_.notify_all();
+        finished.join();
+    }
+
+    /// Journals replaced by compaction since open
+    [[nodiscard]] uint64_t compactions() const noexcept {
+        return compactions_.load(std::memory_order_relaxed);
+    }
+
+private:
+    // ========================================================================
+    // Open / Recovery
+    // ========================================================================
+
+    void open_journal() noexcept {
+        if (config_.path.empty()) return;
+
+        fd_ = ::open(config_.path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0) return;
+
+        struct stat st{};
+        if (::fstat(fd_, &st) != 0) {
+            close_journal();
+            return;
+        }
+
+        size_t file_size = static_cast<size_t>(st.st_size);
+        const bool fresh = file_size < detail::JOURNAL_HEADER_SIZE;
+        size_t target = std::max(file_size, config_.initial_size);
+        target = std::max(target, detail::JOURNAL_HEADER_SIZE + 2 * sizeof(detail::RecordHeader));
+
+        if (target != file_size && ::ftruncate(fd_, static_cast<off_t>(target)) != 0) {
+            close_journal();
+            return;
+        }
+
+        if (!map_locked(target)) {
+            close_journal();
+            return;
+        }
+
+        auto* hdr = header();
+        if (fresh || hdr->magic == 0) {
+            std::memset(base_, 0, detail::JOURNAL_HEADER_SIZE + sizeof(detail::RecordHeader));
+            hdr->magic = detail::JOURNAL_MAGIC;
+            hdr->version = detail::JOURNAL_VERSION;
+            hdr->next_sender_seq = 1;
+            hdr->next_target_seq = 1;
+            sync_range_locked(base_, detail::JOURNAL_HEADER_SIZE + sizeof(detail::RecordHeader));
+        } else if (hdr->magic != detail::JOURNAL_MAGIC ||
+                   hdr->version != detail::JOURNAL_VERSION) {
+            close_journal();  // Not a journal we understand; never overwrite it
+            return;
+        }
+
+        recover_locked();
+    }
+
+    /// Scan the journal, rebuild the index and drop any torn tail
+    void recover_locked() noexcept {
+        size_t pos = detail::JOURNAL_HEADER_SIZE;
+        uint32_t highest = 0;
+
+        while (pos + sizeof(detail::RecordHeader) <= mapped_size_) {
+            detail::RecordHeader hdr;
+            std::memcpy(&hdr, base_ + pos, sizeof(hdr));
+            if (hdr.commit != detail::RECORD_COMMIT) break;
+
+            const size_t rec_size = detail::record_size(hdr.length);
+            if (pos + rec_size > mapped_size_) break;
+
+            std::span<const char> payload{base_ + pos + sizeof(hdr), hdr.length};
+            if (detail::journal_checksum(hdr.seq_num, payload) != hdr.checksum) break;
+
+            if (index_lookup(hdr.seq_num) == 0) {
+                index_insert(hdr.seq_num, IndexEntry{pos, describe_message(payload)});
+                ++record_count_;
+                stats_.bytes_stored += hdr.length;
+            }
+            highest = std::max(highest, hdr.seq_num);
+            pos += rec_size;
+        }
+
+        // Invalidate a torn tail record so a later crash cannot resurrect it
+        size_t discarded = 0;
+        if (pos + sizeof(detail::RecordHeader) <= mapped_size_) {
+            detail::RecordHeader tail;
+            std::memcpy(&tail, base_ + pos, sizeof(tail));
+            if (tail.commit != 0) {
+                discarded = std::min(detail::record_size(tail.length), mapped_size_ - pos);
+                std::memset(base_ + pos, 0, sizeof(detail::RecordHeader));
+            }
+        }
+
+        write_pos_ = pos;
+        recovery_.records_recovered = record_count_;
+        recovery_.highest_seq_num = highest;
+        recovery_.bytes_discarded = discarded;
+        stats_.messages_stored = record_count_;
+
+        // The journal is the source of truth for the outbound sequence:
+        // never hand out a seq num that is already on disk.
+        auto* hdr = header();
+        uint32_t sender = std::atomic_ref<uint32_t>(hdr->next_sender_seq).load(std::memory_order_acquire);
+        uint32_t target = std::atomic_ref<uint32_t>(hdr->next_target_seq).load(std::memory_order_acquire);
+        if (highest != 0 && sender <= highest) sender = highest + 1;
+        next_sender_seq_.store(sender == 0 ? 1 : sender, std::memory_order_release);
+        next_target_seq_.store(target == 0 ? 1 : target, std::memory_order_release);
+    }
+
+    void close_journal() noexcept {
+        if (base_ != nullptr) {
+            ::msync(base_, mapped_size_, MS_SYNC);
+            ::munmap(base_, mapped_size_);
+            base_ = nullptr;
+            mapped_size_ = 0;
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    [[nodiscard]] bool map_locked(size_t size) noexcept {
+        void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (ptr == MAP_FAILED) return false;
+        base_ = static_cast<char*>(ptr);
+        mapped_size_ = size;
+        return true;
+    }
+
+    /// Extend the file and remap (rare; size initial_size for a full session)
+    [[nodiscard]] bool grow_locked(size_t required) noexcept {
+        if (required > config_.max_size) return false;
+
+        size_t new_size = std::max(mapped_size_ * 2, required);
+        new_size = std::min(new_size, config_.max_size);
+
+        if (::ftruncate(fd_, static_cast<off_t>(new_size)) != 0) return false;
+
+        char* old_base = base_;
+        size_t old_size = mapped_size_;
+        if (!map_locked(new_size)) {
+            base_ = old_base;
+            mapped_size_ = old_size;
+            return false;
+        }
+        ::munmap(old_base, old_size);
+        return true;
+    }
+
+    // ========================================================================
+    // Durability
+    // ========================================================================
+
+    void apply_sync_policy_locked(char* rec, size_t rec_size) noexcept {
+        switch (config_.sync_policy) {
+            case SyncPolicy::None:
+                break;
+            case SyncPolicy::Async:
+                async_range_locked(rec, rec_size);
+                break;
+            case SyncPolicy::EveryN:
+                if (++unsynced_ >= config_.sync_interval) {
+                    sync_range_locked(base_, write_pos_ + sizeof(detail::RecordHeader));
+                    unsynced_ = 0;
+                }
+                break;
+            case SyncPolicy::EveryMessage:
+                sync_range_locked(rec, rec_size + sizeof(detail::RecordHeader));
+                break;
+        }
+    }
+
+    /// msync requires a page-aligned start address
+    [[nodiscard]] std::pair<char*, size_t> page_span(char* ptr, size_t len) const noexcept {
+        static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        size_t offset = static_cast<size_t>(ptr - base_);
+        size_t aligned = offset & ~(page - 1);
+        size_t end = std::min(offset + len, mapped_size_);
+        return {base_ + aligned, end - aligned};
+    }
+
+    void async_range_locked(char* ptr, size_t len) noexcept {
+        auto [start, size] = page_span(ptr, len);
+        ::msync(start, size, MS_ASYNC);
+    }
+
+    void sync_range_locked(char* ptr, size_t len) noexcept {
+        auto [start, size] = page_span(ptr, len);
+        ::msync(start, size, MS_SYNC);
+#if NFX_PLATFORM_LINUX
+        ::fdatasync(fd_);
+#else
+        ::fsync(fd_);
+#endif
+    }
+
+    /// Index slot; offset 0 marks a missing seq num
+    struct IndexEntry {
+        size_t offset{0};
+        MessageMeta meta;
+    };
+
+    /// Seq num -> record index: sorted, non-overlapping dense runs of slots.
+    /// Seq nums are contiguous within a session, so one run covers it; a
+    /// seq num more than MAX_GAP slots away from every run (SequenceReset,
+    /// NewSeqNo jump) starts its own run rather than allocating the gap.
+    class SeqIndex {
+    public:
+        static constexpr uint32_t MAX_GAP = 4096;
+
+        [[nodiscard]] bool empty() const noexcept { return runs_.empty(); }
+        void clear() noexcept { runs_.clear(); }
+
+        /// Lowest stored seq num (the first slot of a run is always filled)
+        [[nodiscard]] uint32_t first() const noexcept { return runs_.front().base; }
+
+        [[nodiscard]] const IndexEntry* find(uint32_t seq_num) const noexcept {
+            const Run* run = run_at(seq_num);
+            if (run == nullptr) return nullptr;
+            const size_t slot = seq_num - run->base;
+            if (slot >= run->slots.size() || run->slots[slot].offset == 0) return nullptr;
+            return &run->slots[slot];
+        }
+
+        /// Returns false if the index could not grow (allocation failure)
+        [[nodiscard]] bool put(uint32_t seq_num, const IndexEntry& entry) noexcept {
+            try {
+                auto next = std::upper_bound(runs_.begin(), runs_.end(), seq_num,
+                    [](uint32_t seq, const Run& run) { return seq < run.base; });
+                if (next != runs_.begin()) {
+                    Run& prev = *std::prev(next);
+                    const size_t slot = seq_num - prev.base;
+                    if (slot < prev.slots.size() + MAX_GAP) {
+                        if (slot >= prev.slots.size()) prev.slots.resize(slot + 1);
+                        prev.slots[slot] = entry;
+                        return true;
+                    }
+                }
+                if (next != runs_.end() && next->base - seq_num <= MAX_GAP) {
+                    next->slots.insert(next->slots.begin(), next->base - seq_num, IndexEntry{});
+                    next->base = seq_num;
+                    next->slots.front() = entry;
+                    return true;
+                }
+                runs_.insert(next, Run{seq_num, {entry}});
+                return true;
+            } catch (const std::bad_alloc&) {
+                return false;
+            }
+        }
+
+        /// Visit stored seq nums in [begin_seq, end_seq] in order until
+        /// fn(seq_num, entry) returns false
+        template <typename Fn>
+        void for_each(uint32_t begin_seq, uint32_t end_seq, Fn&& fn) const {
+            for (const Run& run : runs_) {
+                const uint64_t last = static_cast<uint64_t>(run.base) + run.slots.size() - 1;
+                if (last < begin_seq) continue;
+                if (run.base > end_seq) return;
+                const uint64_t to = std::min<uint64_t>(last, end_seq);
+                for (uint64_t seq = std::max(begin_seq, run.base); seq <= to; ++seq) {
+                    const IndexEntry& entry = run.slots[seq - run.base];
+                    if (entry.offset != 0 && !fn(static_cast<uint32_t>(seq), entry)) return;
+                }
+            }
+        }
+
+    private:
+        struct Run {
+            uint32_t base;
+            std::vector<IndexEntry> slots;
+        };
+
+        /// Run whose base is at or below seq_num (the last one is the hot path)
+        [[nodiscard]] const Run* run_at(uint32_t seq_num) const noexcept {
+            if (runs_.empty()) return nullptr;
+            if (seq_num >= runs_.back().base) return &runs_.back();
+            auto next = std::upper_bound(runs_.begin(), runs_.end(), seq_num,
+                [](uint32_t seq, const Run& run) { return seq < run.base; });
+            return next == runs_.begin() ? nullptr : &*std::prev(next);
+        }
+
+        std::vector<Run> runs_;
+    };
+
+    // ========================================================================
+    // Compaction
+    // ========================================================================
+
+    /// One compaction: the replacement journal being written
+    struct Compaction {
+        uint32_t floor{0};            // Drop seq nums below
+        int64_t cutoff_ns{0};         // Drop SendingTime before (0 = no window)
+        int fd{-1};
+        std::string path;
+        size_t write_pos{detail::JOURNAL_HEADER_SIZE};
+        SeqIndex index;
+        std::vector<char> pending;    // Records not yet written to fd
+        size_t dropped{0};
+        size_t kept{0};
+        bool failed{false};
+    };
+
+    [[nodiscard]] CompactionResult run_compaction(Compaction& job) noexcept {
+        CompactionResult result;
+        uint64_t generation = 0;
+        size_t cut = 0;
+        {
+            std::shared_lock lock(mutex_);
+            if (base_ == nullptr || !has_expired_locked(job)) return result;
+            generation = generation_;
+            cut = write_pos_;
+            result.bytes_before = write_pos_;
+        }
+
+        job.path = config_.path + ".compact";
+        job.fd = ::open(job.path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (job.fd < 0) return result;
+
+        // Copy what is committed, then what arrived meanwhile, until the
+        // remainder is small enough to copy under the lock
+        size_t copied = detail::JOURNAL_HEADER_SIZE;
+        while (!job.failed) {
+            copy_mapped(job, copied, cut);
+            copied = cut;
+
+            std::shared_lock lock(mutex_);
+            if (generation_ != generation) job.failed = true;
+            if (job.failed || write_pos_ - copied < COMPACT_LOCKED_TAIL) break;
+            cut = write_pos_;
+        }
+        if (!job.failed && config_.sync_policy != SyncPolicy::None) {
+            job.failed = !write_pending(job) || ::fdatasync(job.fd) != 0;
+        }
+
+        if (!job.failed) {
+            std::unique_lock lock(mutex_);
+            if (generation_ == generation && base_ != nullptr) {
+                copy_records(job, base_, copied, write_pos_);
+                if (!job.failed && job.dropped > 0 && swap_journal_locked(job)) {
+                    result.compacted = true;
+                    result.records_dropped = job.dropped;
+                    result.records_kept = job.kept;
+                    result.bytes_after = write_pos_;
+                    compactions_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        if (job.fd >= 0) {
+            ::close(job.fd);
+            ::unlink(job.path.c_str());
+        }
+        return result;
+    }
+
+    /// Whether the oldest record falls below the floor or outside the
+    /// window (cheap check before writing a new journal)
+    [[nodiscard]] bool has_expired_locked(const Compaction& job) const noexcept {
+        if (index_.empty()) return false;
+        if (job.floor > index_.first()) return true;
+        if (job.cutoff_ns == 0) return false;
+        const auto sent = sending_time_ns(payload_locked(index_.first()));
+        return sent && *sent < job.cutoff_ns;
+    }
+
+    /// Copy [from, to) of the journal through a private read-only mapping
+    /// (committed records never change until reset(), which aborts the job)
+    void copy_mapped(Compaction& job, size_t from, size_t to) noexcept {
+        if (from >= to) return;
+        void* ptr = ::mmap(nullptr, to, PROT_READ, MAP_SHARED, fd_, 0);
+        if (ptr == MAP_FAILED) {
+            job.failed = true;
+            return;
+        }
+        copy_records(job, static_cast<const char*>(ptr), from, to);
+        ::munmap(ptr, to);
+    }
+
+    /// Append the records in [from, to) of src that are still needed
+    void copy_records(Compaction& job, const char* src, size_t from, size_t to) noexcept {
+        size_t pos = from;
+        while (!job.failed && pos + sizeof(detail::RecordHeader) <= to) {
+            detail::RecordHeader hdr;
+            std::memcpy(&hdr, src + pos, sizeof(hdr));
+            const size_t rec_size = detail::record_size(hdr.length);
+            std::span<const char> payload{src + pos + sizeof(hdr), hdr.length};
+            if (hdr.commit != detail::RECORD_COMMIT || pos + rec_size > to ||
+                detail::journal_checksum(hdr.seq_num, payload) != hdr.checksum) {
+                job.failed = true;   // Overwritten by a concurrent reset()
+                break;
+            }
+
+            bool keep = hdr.seq_num >= job.floor;
+            if (keep && job.cutoff_ns != 0) {
+                const auto sent = sending_time_ns(payload);
+                keep = !sent || *sent >= job.cutoff_ns;
+            }
+            const bool duplicate = job.index.find(hdr.seq_num) != nullptr;
+
+            if (!keep) {
+                ++job.dropped;
+            } else if (!duplicate) {
+                try {
+                    job.pending.insert(job.pending.end(), src + pos, src + pos + rec_size);
+                } catch (const std::bad_alloc&) {
+                    job.failed = true;
+                    break;
+                }
+                if (!job.index.put(hdr.seq_num, IndexEntry{job.write_pos, describe_message(payload)})) {
+                    job.failed = true;
+                    break;
+                }
+                job.write_pos += rec_size;
+                ++job.kept;
+                if (job.pending.size() >= COMPACT_LOCKED_TAIL && !write_pending(job)) {
+                    job.failed = true;
+                }
+            }
+            pos += rec_size;
+        }
+    }
+
+    /// Write buffered records at their place in the new journal
+    [[nodiscard]] static bool write_pending(Compaction& job) noexcept {
+        const size_t offset = job.write_pos - job.pending.size();
+        size_t done = 0;
+        while (done < job.pending.size()) {
+            const ssize_t n = ::pwrite(job.fd, job.pending.data() + done, job.pending.size() - done,
+                                       static_cast<off_t>(offset + done));
+            if (n <= 0) return false;
+            done += static_cast<size_t>(n);
+        }
+        job.pending.clear();
+        return true;
+    }
+
+    /// Finish the new journal, rename it over the old one and switch to it
+    [[nodiscard]] bool swap_journal_locked(Compaction& job) noexcept {
+        if (!write_pending(job)) return false;
+
+        static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        const size_t used = job.write_pos + sizeof(detail::RecordHeader);
+        const size_t size = std::max(config_.initial_size, (used + page - 1) & ~(page - 1));
+        if (size > std::max(config_.max_size, mapped_size_)) return false;
+
+        // Header page with the current seq nums; the file is zero-filled
+        // past the last record, which terminates the journal
+        alignas(detail::JournalHeader) char page_buf[detail::JOURNAL_HEADER_SIZE] = {};
+        auto* hdr = reinterpret_cast<detail::JournalHeader*>(page_buf);
+        hdr->magic = detail::JOURNAL_MAGIC;
+        hdr->version = detail::JOURNAL_VERSION;
+        hdr->next_sender_seq = next_sender_seq_.load(std::memory_order_acquire);
+        hdr->next_target_seq = next_target_seq_.load(std::memory_order_acquire);
+        if (::pwrite(job.fd, page_buf, sizeof(page_buf), 0) != static_cast<ssize_t>(sizeof(page_buf))) {
+            return false;
+        }
+        if (::ftruncate(job.fd, static_cast<off_t>(size)) != 0) return false;
+        if (config_.sync_policy != SyncPolicy::None && ::fdatasync(job.fd) != 0) return false;
+
+        void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, job.fd, 0);
+        if (ptr == MAP_FAILED) return false;
+        if (::rename(job.path.c_str(), config_.path.c_str()) != 0) {
+            ::munmap(ptr, size);
+            return false;
+        }
+        if (config_.sync_policy != SyncPolicy::None) sync_parent_directory();
+
+        ::munmap(base_, mapped_size_);
+        ::close(fd_);
+        fd_ = std::exchange(job.fd, -1);
+        base_ = static_cast<char*>(ptr);
+        mapped_size_ = size;
+        write_pos_ = job.write_pos;
+        index_ = std::move(job.index);
+        record_count_ = job.kept;
+        unsynced_ = 0;
+        return true;
+    }
+
+    /// Make the rename durable
+    void sync_parent_directory() const noexcept {
+        const size_t slash = config_.path.rfind('/');
+        const std::string dir = slash == std::string::npos ? "." :
+                                slash == 0 ? "/" : config_.path.substr(0, slash);
+        const int dfd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+        if (dfd < 0) return;
+        (void)::fsync(dfd);
+        ::close(dfd);
+    }
+
+    /// SendingTime (52) of a stored message, ns since epoch
+    [[nodiscard]] static std::optional<int64_t> sending_time_ns(std::span<const char> msg) noexcept {
+        const std::string_view text{msg.data(), msg.size()};
+        const size_t tag = text.find("\x01" "52=");
+        if (tag == std::string_view::npos) return std::nullopt;
+        const size_t begin = tag + 4;
+        const size_t end = text.find('\x01', begin);
+        if (end == std::string_view::npos) return std::nullopt;
+        const auto ts = Timestamp::from_utc_string(text.substr(begin, end - begin));
+        if (!ts) return std::nullopt;
+        return ts->nanos;
+    }
+
+    // ========================================================================
+    // Index (seq num -> record offset)
+    // ========================================================================
+
+    [[nodiscard]] detail::JournalHeader* header() const noexcept {
+        return reinterpret_cast<detail::JournalHeader*>(base_);
+    }
+
+    /// Returns record offset, or 0 if not present (offset 0 is the header page)
+    [[nodiscard]] size_t index_lookup(uint32_t seq_num) const noexcept {
+        const IndexEntry* entry = index_.find(seq_num);
+        return entry != nullptr ? entry->offset : 0;
+    }
+
+    void index_insert(uint32_t seq_num, const IndexEntry& entry) noexcept {
+        if (!index_.put(seq_num, entry)) {
+            ++stats_.store_failures;
+        }
+    }
+
+    [[nodiscard]] std::span<const char> payload_locked(uint32_t seq_num) const noexcept {
+        return payload_at(index_lookup(seq_num));
+    }
+
+    [[nodiscard]] std::span<const char> payload_at(size_t offset) const noexcept {
+        if (offset == 0) return {};
+        detail::RecordHeader hdr;
+        std::memcpy(&hdr, base_ + offset, sizeof(hdr));
+        return {base_ + offset + sizeof(hdr), hdr.length};
+    }
+
+    // ========================================================================
+    // Member Variables
+    // ========================================================================
+
+    Config config_;
+    int fd_{-1};
+    char* base_{nullptr};
+    size_t mapped_size_{0};
+    size_t write_pos_{detail::JOURNAL_HEADER_SIZE};
+
+    SeqIndex index_;
+    size_t record_count_{0};
+    uint32_t unsynced_{0};
+    RecoveryInfo recovery_;
+
+    std::atomic<uint32_t> next_sender_seq_{1};
+    std::atomic<uint32_t> next_target_seq_{1};
+
+    mutable std::shared_mutex mutex_;
+    mutable Stats stats_;
+
+    // Compaction
+    std::atomic<uint32_t> acknowledged_{0};
+    std::atomic<uint64_t> compactions_{0};
+    uint64_t generation_{0};                  // Bumped by reset() (under mutex_)
+    std::mutex compact_mutex_;                // One compaction at a time
+    std::mutex compactor_mutex_;
+    std::condition_variable compactor_cv_;
+    std::thread compactor_;
+    bool compactor_stop_{false};
+};
+
+} // namespace nfx::store
+
+#endif // NFX_PLATFORM_POSIX
@@ -0,0 +1,244 @@
+/*
+    NexusFIX Sequence Checkpoint
+
+    One cache line per session holding the next outbound and next expected
+    inbound sequence numbers, so a restart resumes where the session left
+    off instead of triggering a large ResendRequest or a manual seq reset.
+
+    - SequenceCheckpoint is the 64-byte record itself; SequenceManager
+      mirrors every sequence change into it with relaxed stores (O(1), no
+      syscall, no journal write on the message path)
+    - MmapSequenceCheckpoint maps the record from a small file with
+      MAP_SHARED: updates survive a process crash as soon as they are
+      stored, and flush_async() schedules write-back for power loss
+    - Every field is an aligned 32/64-bit word, so a torn page can never
+      produce a half-written sequence number
+
+    Usage:
+        MmapSequenceCheckpoint checkpoint("/var/lib/nfx/SENDER-TARGET.seq");
+        session.attach_sequence_checkpoint(checkpoint.get());  // Restores
+        // Timer thread, e.g. every 100ms:
+        checkpoint.flush_async();
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "nexusfix/platform/platform.hpp"
+
+#if NFX_PLATFORM_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nfx::store {
+
+// ============================================================================
+// Checkpoint Record
+// ============================================================================
+
+/// Cache-line sized sequence number record (single writer: the session thread)
+struct alignas(64) SequenceCheckpoint {
+    static constexpr uint64_t MAGIC = 0x5150434B5846584EULL;  // "NXFXCKPQ"
+    static constexpr uint32_t VERSION = 1;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t reserved;
+    uint32_t next_outbound;      // Next MsgSeqNum to send
+    uint32_t expected_inbound;   // Next MsgSeqNum expected from the peer
+    uint64_t updates;            // Bumped on every change (flush bookkeeping)
+
+    /// Stamp a fresh record
+    void initialize(uint32_t outbound, uint32_t inbound) noexcept {
+        std::memset(static_cast<void*>(this), 0, sizeof(*this));
+        version = VERSION;
+        next_outbound = outbound;
+        expected_inbound = inbound;
+        // Magic last: a record without it is treated as fresh on open
+        std::atomic_ref<uint64_t>(magic).store(MAGIC, std::memory_order_release);
+    }
+
+    /// Record holds sequence numbers written by a previous run
+    [[nodiscard]] bool valid() const noexcept {
+        return load(magic) == MAGIC && version == VERSION &&
+               load(next_outbound) != 0 && load(expected_inbound) != 0;
+    }
+
+    void record_outbound(uint32_t seq) noexcept {
+        std::atomic_ref<uint32_t>(next_outbound).store(seq, std::memory_order_relaxed);
+        bump();
+    }
+
+    void record_inbound(uint32_t seq) noexcept {
+        std::atomic_ref<uint32_t>(expected_inbound).store(seq, std::memory_order_relaxed);
+        bump();
+    }
+
+    [[nodiscard]] uint32_t outbound() const noexcept { return load(next_outbound); }
+    [[nodiscard]] uint32_t inbound() const noexcept { return load(expected_inbound); }
+    [[nodiscard]] uint64_t update_count() const noexcept { return load(updates); }
+
+private:
+    template<typename T>
+    [[nodiscard]] static T load(const T& word) noexcept {
+        return std::atomic_ref<T>(const_cast<T&>(word)).load(std::memory_order_relaxed);
+    }
+
+    /// Single writer: plain load + store, no locked RMW
+    void bump() noexcept {
+        std::atomic_ref<uint64_t> ref(updates);
+        ref.store(ref.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+};
+
+static_assert(sizeof(SequenceCheckpoint) == 64);
+
+#if NFX_PLATFORM_POSIX
+
+// ============================================================================
+// Memory-Mapped Checkpoint File
+// ============================================================================
+
+/// SequenceCheckpoint backed by a one-page shared file mapping
+class MmapSequenceCheckpoint {
+public:
+    /// What open found on disk
+    struct RecoveryInfo {
+        bool recovered{false};          // A valid checkpoint was read
+        uint32_t next_outbound{0};
+        uint32_t expected_inbound{0};
+    };
+
+    /// Open (or create) the checkpoint file
+    explicit MmapSequenceCheckpoint(std::string path) noexcept
+        : path_(std::move(path)) {
+        open_file();
+    }
+
+    ~MmapSequenceCheckpoint() {
+        close_file();
+    }
+
+    MmapSequenceCheckpoint(const MmapSequenceCheckpoint&) = delete;
+    MmapSequenceCheckpoint& operator=(const MmapSequenceCheckpoint&) = delete;
+
+    /// Mapped record, or nullptr if the file could not be opened
+    [[nodiscard]] SequenceCheckpoint* get() const noexcept { return record_; }
+
+    [[nodiscard]] bool is_open() const noexcept { return record_ != nullptr; }
+
+    [[nodiscard]] const RecoveryInfo& recovery_info() const noexcept { return recovery_; }
+
+    [[nodiscard]] const std::string& path() const noexcept { return path_; }
+
+    /// Schedule write-back if the record changed since the last flush
+    /// (msync MS_ASYNC: returns immediately). Call from any thread.
+    /// @return true if a write-back was scheduled
+    bool flush_async() noexcept {
+        if (!record_) return false;
+        const uint64_t updates = record_->update_count();
+        if (updates == flushed_updates_.load(std::memory_order_relaxed)) return false;
+        flushed_updates_.store(updates, std::memory_order_relaxed);
+        ::msync(record_, page_size(), MS_ASYNC);
+        return true;
+    }
+
+    /// Force the record to stable storage (blocking; logout / shutdown)
+    void flush() noexcept {
+        if (!record_) return;
+        flushed_updates_.store(record_->update_count(), std::memory_order_relaxed);
+        ::msync(record_, page_size(), MS_SYNC);
+#if NFX_PLATFORM_LINUX
+        ::fdatasync(fd_);
+#else
+        ::fsync(fd_);
+#endif
+    }
+
+private:
+    [[nodiscard]] static size_t page_size() noexcept {
+        static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return page;
+    }
+
+    void open_file() noexcept {
+        if (path_.empty()) return;
+
+        fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0) return;
+
+        struct stat st{};
+        if (::fstat(fd_, &st) != 0) {
+            close_file();
+            return;
+        }
+
+        const size_t size = page_size();
+        bool fresh = st.st_size == 0;
+        if (!fresh) {
+            // Validate before resizing: a foreign file must not be touched
+            SequenceCheckpoint existing{};
+            if (::pread(fd_, &existing, sizeof(existing), 0) !=
+                    static_cast<ssize_t>(sizeof(existing)) ||
+                (existing.magic != 0 && !existing.valid())) {
+                close_file();
+                return;
+            }
+            fresh = existing.magic == 0;
+        }
+
+        if (static_cast<size_t>(st.st_size) < size &&
+            ::ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+            close_file();
+            return;
+        }
+
+        void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (ptr == MAP_FAILED) {
+            close_file();
+            return;
+        }
+        auto* record = static_cast<SequenceCheckpoint*>(ptr);
+
+        if (fresh) {
+            record->initialize(1, 1);
+            ::msync(ptr, size, MS_SYNC);
+        } else {
+            recovery_ = {.recovered = true,
+                         .next_outbound = record->outbound(),
+                         .expected_inbound = record->inbound()};
+        }
+
+        record_ = record;
+        flushed_updates_.store(record->update_count(), std::memory_order_relaxed);
+    }
+
+    void close_file() noexcept {
+        if (record_ != nullptr) {
+            ::msync(record_, page_size(), MS_SYNC);
+            ::munmap(record_, page_size());
+            record_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    std::string path_;
+    int fd_{-1};
+    SequenceCheckpoint* record_{nullptr};
+    RecoveryInfo recovery_{};
+    std::atomic<uint64_t> flushed_updates_{0};
+};
+
+#endif // NFX_PLATFORM_POSIX
+
+} // namespace nfx::store
@@ -0,0 +1,360 @@
+/*
+    NexusFIX Single-Writer Message Store
+
+    Lock-free variant of MemoryMessageStore for the common case where the
+    session thread is the only writer and resend handling / monitoring
+    are the only readers.
+
+    Same layout as MemoryMessageStore (fixed circular byte log + dense
+    seq -> slot ring), but no mutex:
+    - Writer: plain loads and release stores, no atomic RMW, never waits
+    - Readers: snapshot a slot, copy its bytes, then validate; a stored
+      message is immutable, so any change seen during the copy means it
+      was evicted and the read reports it as missing (no retry loop)
+
+    Thread-safety:
+    - store(), reset(), set_next_*_seq_num(): writer thread only
+    - retrieve*(), for_each_in_range(), stats and queries: any thread
+*/
+
+#pragma once
+
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/memory/cache_line.hpp"
+
+#include <atomic>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <memory_resource>
+
+namespace nfx::store {
+
+// ============================================================================
+// Single-Writer Message Store
+// ============================================================================
+
+/// In-memory message store with a wait-free writer and validating readers
+class SingleWriterMessageStore final : public IMessageStore {
+public:
+    using Config = MemoryMessageStore::Config;
+
+    explicit SingleWriterMessageStore(Config config)
+        : config_(std::move(config))
+        , resource_(config_.upstream_resource ? config_.upstream_resource
+                                              : std::pmr::new_delete_resource())
+        , log_capacity_(std::max<size_t>(config_.pool_size_bytes, 1))
+        , log_(allocate_log())
+        , index_(std::bit_ceil(std::max<size_t>(config_.max_messages, 1)),
+                 std::pmr::polymorphic_allocator<Slot>(resource_))
+        , index_mask_(index_.size() - 1) {}
+
+    explicit SingleWriterMessageStore(std::string_view session_id)
+        : SingleWriterMessageStore(Config{.session_id = std::string(session_id)}) {}
+
+    ~SingleWriterMessageStore() override {
+        if (config_.huge_pages) {
+            memory::HugePageAllocator::deallocate(log_, log_capacity_);
+        } else {
+            resource_->deallocate(log_, log_capacity_, LOG_ALIGNMENT);
+        }
+    }
+
+    SingleWriterMessageStore(const SingleWriterMessageStore&) = delete;
+    SingleWriterMessageStore& operator=(const SingleWriterMessageStore&) = delete;
+
+    // ========================================================================
+    // Message Storage (writer thread)
+    // ========================================================================
+
+    /// Store a message. Sequence numbers must increase, as for
+    /// MemoryMessageStore.
+    [[nodiscard]] bool store(uint32_t seq_num,
+                            std::span<const char> msg) noexcept override {
+        size_t count = count_.load(std::memory_order_relaxed);
+        uint32_t min_seq = min_seq_.load(std::memory_order_relaxed);
+        const uint32_t max_seq = max_seq_.load(std::memory_order_relaxed);
+
+        if (seq_num == 0 || (count > 0 && seq_num <= max_seq)) {
+            if (!(count > 0 && seq_num >= min_seq &&
+                  index_[seq_num & index_mask_].seq_num.load(std::memory_order_relaxed) == seq_num)) {
+                bump(stats_.store_failures);
+            }
+            return false;
+        }
+        if (msg.size() > log_capacity_ || msg.size() > config_.max_bytes) {
+            bump(stats_.store_failures);
+            return false;
+        }
+
+        // Log position: wrap to the start rather than split the message
+        uint64_t pos = write_pos_;
+        const size_t physical = static_cast<size_t>(pos % log_capacity_);
+        if (physical + msg.size() > log_capacity_) {
+            pos += log_capacity_ - physical;
+        }
+
+        // Make room. Evicted bytes are only reclaimed by advancing
+        // reserve_pos_ below, so readers still copying them notice.
+        size_t total = total_bytes_.load(std::memory_order_relaxed);
+        while (count > 0 &&
+               (seq_num - min_seq > index_mask_ ||
+                count >= config_.max_messages ||
+                total + msg.size() > config_.max_bytes ||
+                pos + msg.size() - slot_offset(min_seq) > log_capacity_)) {
+            if (!config_.evict_oldest) {
+                bump(stats_.store_failures);
+                return false;
+            }
+            total -= index_[min_seq & index_mask_].length.load(std::memory_order_relaxed);
+            if (--count > 0) {
+                do { ++min_seq; } while (
+                    index_[min_seq & index_mask_].seq_num.load(std::memory_order_relaxed) != min_seq);
+            }
+        }
+        if (count == 0) min_seq = seq_num;
+        min_seq_.store(min_seq, std::memory_order_release);
+
+        // Claim the bytes before overwriting them: readers that copied
+        // from this region re-check reserve_pos_ after their copy
+        reserve_pos_.store(pos + msg.size(), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(log_ + (pos % log_capacity_), msg.data(), msg.size());
+
+        // Publish the slot: seq_num last, so a reader that sees it also
+        // sees the offset and length
+        Slot& slot = index_[seq_num & index_mask_];
+        slot.seq_num.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.offset.store(pos, std::memory_order_relaxed);
+        slot.length.store(static_cast<uint32_t>(msg.size()), std::memory_order_relaxed);
+        slot.meta.store(describe_message(msg).pack(), std::memory_order_relaxed);
+        slot.seq_num.store(seq_num, std::memory_order_release);
+
+        write_pos_ = pos + msg.size();
+        max_seq_.store(seq_num, std::memory_order_release);
+        count_.store(count + 1, std::memory_order_relaxed);
+        total_bytes_.store(total + msg.size(), std::memory_order_relaxed);
+
+        bump(stats_.messages_stored);
+        stats_.bytes_stored.store(stats_.bytes_stored.load(std::memory_order_relaxed) + msg.size(),
+                                  std::memory_order_relaxed);
+        return true;
+    }
+
+    // ========================================================================
+    // Message Retrieval (any thread)
+    // ========================================================================
+
+    [[nodiscard]] std::optional<std::vector<char>>
+        retrieve(uint32_t seq_num) const noexcept override {
+        std::vector<char> out;
+        MessageMeta meta;
+        if (!read_message(seq_num, out, meta)) return std::nullopt;
+        stats_.messages_retrieved.fetch_add(1, std::memory_order_relaxed);
+        return out;
+    }
+
+    [[nodiscard]] std::vector<std::vector<char>>
+        retrieve_range(uint32_t begin_seq, uint32_t end_seq) const noexcept override {
+        std::vector<std::vector<char>> result;
+        (void)visit_range(begin_seq, end_seq, [&](uint32_t, std::span<const char> msg) {
+            result.emplace_back(msg.begin(), msg.end());
+        });
+        return result;
+    }
+
+    /// Visit a snapshot of each message. Views point into a per-call
+    /// scratch copy (the log may be overwritten while the visitor runs).
+    size_t for_each_in_range(uint32_t begin_seq, uint32_t end_seq,
+                             MessageVisitor visitor) const noexcept override {
+        const uint32_t max_seq = max_seq_.load(std::memory_order_acquire);
+        const uint32_t last = (end_seq == 0 || end_seq > max_seq) ? max_seq : end_seq;
+        std::vector<char> scratch;
+        MessageMeta meta;
+        size_t visited = 0;
+
+        for (uint32_t seq = std::max(begin_seq, min_seq_.load(std::memory_order_acquire));
+             seq != 0 && seq <= last; ++seq) {
+            if (!read_message(seq, scratch, meta)) continue;
+            ++visited;
+            stats_.messages_retrieved.fetch_add(1, std::memory_order_relaxed);
+            if (!visitor(seq, std::span<const char>{scratch.data(), scratch.size()}, meta)) {
+                break;
+            }
+        }
+
+        return visited;
+    }
+
+    // ========================================================================
+    // Sequence Number Persistence
+    // ========================================================================
+
+    void set_next_sender_seq_num(uint32_t seq) noexcept override {
+        next_sender_seq_.store(seq, std::memory_order_release);
+    }
+
+    void set_next_target_seq_num(uint32_t seq) noexcept override {
+        next_target_seq_.store(seq, std::memory_order_release);
+    }
+
+    [[nodiscard]] uint32_t get_next_sender_seq_num() const noexcept override {
+        return next_sender_seq_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] uint32_t get_next_target_seq_num() const noexcept override {
+        return next_target_seq_.load(std::memory_order_acquire);
+    }
+
+    // ========================================================================
+    // Session Management (writer thread)
+    // ========================================================================
+
+    /// Clear all messages. Log positions keep increasing, so a reader
+    /// racing the reset still validates against reserve_pos_.
+    void reset() noexcept override {
+        for (Slot& slot : index_) {
+            slot.seq_num.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        total_bytes_.store(0, std::memory_order_relaxed);
+        min_seq_.store(0, std::memory_order_relaxed);
+        max_seq_.store(0, std::memory_order_release);
+        next_sender_seq_.store(1, std::memory_order_release);
+        next_target_seq_.store(1, std::memory_order_release);
+        stats_.messages_stored.store(0, std::memory_order_relaxed);
+        stats_.messages_retrieved.store(0, std::memory_order_relaxed);
+        stats_.bytes_stored.store(0, std::memory_order_relaxed);
+        stats_.store_failures.store(0, std::memory_order_relaxed);
+    }
+
+    void flush() noexcept override {
+        // No-op for memory store
+    }
+
+    [[nodiscard]] std::string_view session_id() const noexcept override {
+        return config_.session_id;
+    }
+
+    [[nodiscard]] Stats stats() const noexcept override {
+        return Stats{
+            .messages_stored = stats_.messages_stored.load(std::memory_order_relaxed),
+            .messages_retrieved = stats_.messages_retrieved.load(std::memory_order_relaxed),
+            .bytes_stored = stats_.bytes_stored.load(std::memory_order_relaxed),
+            .store_failures = stats_.store_failures.load(std::memory_order_relaxed),
+        };
+    }
+
+    // ========================================================================
+    // Additional Methods
+    // ========================================================================
+
+    /// Get current message count
+    [[nodiscard]] size_t message_count() const noexcept {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    /// Get total bytes stored
+    [[nodiscard]] size_t bytes_used() const noexcept {
+        return total_bytes_.load(std::memory_order_relaxed);
+    }
+
+    /// Check if a sequence number exists
+    [[nodiscard]] bool contains(uint32_t seq_num) const noexcept {
+        uint64_t offset;
+        uint32_t length;
+        MessageMeta meta;
+        return read_slot(seq_num, offset, length, meta);
+    }
+
+private:
+    static constexpr size_t LOG_ALIGNMENT = 64;
+
+    /// Byte log from huge pages (prefaulted, THP fallback) or the resource
+    [[nodiscard]] char* allocate_log() {
+        if (config_.huge_pages) {
+            void* p = memory::HugePageAllocator::allocate_prefaulted(
+                log_capacity_, memory::HugePageSize::Huge2MB, config_.numa_node);
+            if (!p) throw std::bad_alloc();
+            return static_cast<char*>(p);
+        }
+        return static_cast<char*>(resource_->allocate(log_capacity_, LOG_ALIGNMENT));
+    }
+
+    /// Index entry; seq_num 0 marks an empty (or being rewritten) slot
+    struct Slot {
+        std::atomic<uint64_t> offset{0};    // Monotonic log position
+        std::atomic<uint32_t> length{0};
+        std::atomic<uint32_t> seq_num{0};
+        std::atomic<uint64_t> meta{0};      // MessageMeta::pack()
+    };
+
+    /// Writer-owned counters; readers only increment messages_retrieved
+    struct AtomicStats {
+        std::atomic<uint64_t> messages_stored{0};
+        std::atomic<uint64_t> messages_retrieved{0};
+        std::atomic<uint64_t> bytes_stored{0};
+        std::atomic<uint64_t> store_failures{0};
+    };
+
+    /// Single-writer increment: load + store, no RMW
+    static void bump(std::atomic<uint64_t>& counter) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t slot_offset(uint32_t seq_num) const noexcept {
+        return index_[seq_num & index_mask_].offset.load(std::memory_order_relaxed);
+    }
+
+    /// Consistent (offset, length, meta) snapshot of a live slot
+    [[nodiscard]] bool read_slot(uint32_t seq_num, uint64_t& offset, uint32_t& length,
+                                 MessageMeta& meta) const noexcept {
+        if (seq_num == 0 || seq_num < min_seq_.load(std::memory_order_acquire)) return false;
+        const Slot& slot = index_[seq_num & index_mask_];
+        if (slot.seq_num.load(std::memory_order_acquire) != seq_num) return false;
+        offset = slot.offset.load(std::memory_order_relaxed);
+        length = slot.length.load(std::memory_order_relaxed);
+        meta = MessageMeta::unpack(slot.meta.load(std::memory_order_relaxed));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.seq_num.load(std::memory_order_relaxed) == seq_num;
+    }
+
+    /// Copy a message out of the log; false if missing or overwritten
+    /// while copying
+    bool read_message(uint32_t seq_num, std::vector<char>& out, MessageMeta& meta) const noexcept {
+        uint64_t offset;
+        uint32_t length;
+        if (!read_slot(seq_num, offset, length, meta)) return false;
+
+        out.resize(length);
+        std::memcpy(out.data(), log_ + (offset % log_capacity_), length);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return reserve_pos_.load(std::memory_order_relaxed) <= offset + log_capacity_;
+    }
+
+    Config config_;
+
+    // Byte log: fixed circular buffer, allocated once
+    std::pmr::memory_resource* resource_;
+    size_t log_capacity_;
+    char* log_;
+    std::pmr::vector<Slot> index_;
+    size_t index_mask_;
+
+    // Writer-side state: write_pos_ is private to the writer; the rest is
+    // published for readers
+    uint64_t write_pos_{0};
+    alignas(memory::CACHE_LINE_SIZE) std::atomic<uint64_t> reserve_pos_{0};
+    std::atomic<uint32_t> min_seq_{0};
+    std::atomic<uint32_t> max_seq_{0};
+    std::atomic<size_t> count_{0};
+    std::atomic<size_t> total_bytes_{0};
+
+    std::atomic<uint32_t> next_sender_seq_{1};
+    std::atomic<uint32_t> next_target_seq_{1};
+
+    alignas(memory::CACHE_LINE_SIZE) mutable AtomicStats stats_;
+};
+
+} // namespace nfx::store
@@ -0,0 +1,97 @@
+/*
+    NexusFIX Awaitable I/O
+
+    Completion-based I/O for coroutines: an operation's submission carries
+    a pointer to an IoCompletion (io_uring user_data), and the event loop
+    resumes the awaiting coroutine straight from CQE processing. There is
+    no callback table and no per-await allocation; the IoCompletion lives
+    in the awaiting coroutine's frame.
+
+    Usage:
+        Task<void> echo(IoUringSocket& socket) {
+            std::array<char, 4096> buf;
+            for (;;) {
+                int n = co_await socket.async_recv(buf);   // bytes or -errno
+                if (n <= 0) co_return;
+                (void)co_await socket.async_send({buf.data(), static_cast<size_t>(n)});
+            }
+        }
+
+        auto task = echo(socket);
+        task.resume();                         // Runs to the first co_await
+        while (!task.done()) ctx.dispatch_completions();
+
+    Any type with async_recv()/async_send() returning int-valued awaitables
+    is an AsyncByteStream (IoUringSocket, or a test double).
+*/
+
+#pragma once
+
+#include <concepts>
+#include <coroutine>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+namespace nfx {
+
+// ============================================================================
+// Completion Slot
+// ============================================================================
+
+/// Shared by an in-flight operation and the event loop
+struct IoCompletion {
+    std::coroutine_handle<> waiter{};
+    int result{0};      // Bytes transferred, or -errno (cqe->res)
+    uint32_t flags{0};  // cqe->flags
+
+    /// Complete the operation submitted with `user_data` and resume its
+    /// coroutine, which runs until its next suspension
+    static void resume(void* user_data, int result, uint32_t flags = 0) noexcept {
+        auto* completion = static_cast<IoCompletion*>(user_data);
+        completion->result = result;
+        completion->flags = flags;
+        completion->waiter.resume();
+    }
+};
+
+// ============================================================================
+// Awaitable Operation
+// ============================================================================
+
+/// Awaitable I/O operation. `Submit(IoCompletion*)` queues the operation
+/// with the completion as its user data and returns 0, or returns a
+/// negative errno if nothing was queued; the await then completes at once
+/// with that result.
+template <typename Submit>
+class IoAwaitable {
+public:
+    explicit IoAwaitable(Submit submit) noexcept : submit_{std::move(submit)} {}
+
+    [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> waiter) noexcept {
+        completion_.waiter = waiter;
+        const int rc = submit_(&completion_);
+        if (rc < 0) [[unlikely]] {
+            completion_.result = rc;
+            return false;  // Not queued: resume immediately
+        }
+        return true;
+    }
+
+    [[nodiscard]] int await_resume() const noexcept { return completion_.result; }
+
+private:
+    Submit submit_;
+    IoCompletion completion_;
+};
+
+/// Byte stream with awaitable receive and send
+template <typename S>
+concept AsyncByteStream = requires(S& stream, std::span<char> rx, std::span<const char> tx) {
+    { stream.async_recv(rx).await_resume() } -> std::same_as<int>;
+    { stream.async_send(tx).await_resume() } -> std::same_as<int>;
+};
+
+} // namespace nfx
@@ -378,6 +378,25 @@ public:
         return true;
     }
 
+    /// Bound the operation added last by a deadline (IORING_OP_LINK_TIMEOUT):
+    /// if it has not completed within *timeout (relative) the kernel cancels
+    /// it with -ECANCELED, and the timeout's own CQE carries -ETIME. The
+    /// timeout does not count as a chained operation; what follows is not
+    /// linked to it.
+    /// @param timeout Must stay valid until submit()
+    [[nodiscard]] bool link_timeout(const struct __kernel_timespec* timeout,
+                                    void* user_data = nullptr) noexcept {
+        if (!last_sqe_) return false;
+        auto* sqe = ctx_.get_sqe();
+        if (!sqe) return false;
+
+        last_sqe_->flags |= IOSQE_IO_LINK;
+        io_uring_prep_link_timeout(sqe, const_cast<struct __kernel_timespec*>(timeout), 0);
+        io_uring_sqe_set_data(sqe, user_data);
+        last_sqe_ = nullptr;
+        return true;
+    }
+
     /// Submit the linked chain
     [[nodiscard]] int submit() noexcept {
         if (count_ == 0) return 0;
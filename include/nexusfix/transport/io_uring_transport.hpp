@@ -1,25 +1,47 @@
 #pragma once
 
+#include "nexusfix/transport/async_io.hpp"
 #include "nexusfix/transport/socket.hpp"
+#include "nexusfix/transport/resolved_address.hpp"
+#include "nexusfix/transport/tls_record.hpp"
 #include "nexusfix/session/coroutine.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/memory/huge_page_allocator.hpp"
+#include "nexusfix/memory/wait_strategy.hpp"
+#include "nexusfix/util/inline_function.hpp"
 
 // Only include io_uring on Linux when available
 #if defined(NFX_HAS_IO_URING) && NFX_HAS_IO_URING
     #include <liburing.h>
     #define NFX_IO_URING_AVAILABLE 1
+    // Provided buffer rings (io_uring_setup_buf_ring) arrived in liburing 2.4,
+    // the release that introduced IO_URING_CHECK_VERSION
+    #if defined(IO_URING_CHECK_VERSION)
+        #define NFX_IO_URING_BUF_RING 1
+    #else
+        #define NFX_IO_URING_BUF_RING 0
+    #endif
 #else
     #define NFX_IO_URING_AVAILABLE 0
 #endif
 
-#include <sys/socket.h>
-#include <netinet/in.h>
-#include <netinet/tcp.h>
-#include <arpa/inet.h>
-#include <netdb.h>
-#include <unistd.h>
+#if NFX_PLATFORM_POSIX
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <arpa/inet.h>
+    #include <netdb.h>
+    #include <unistd.h>
+#endif
 #include <vector>
+#include <bit>
+#include <chrono>
+#include <cerrno>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
 
 namespace nfx {
 
@@ -51,6 +73,44 @@ struct IoEvent {
 // io_uring Context
 // ============================================================================
 
+/// Kernel-side submission polling (IORING_SETUP_SQPOLL)
+/// A kernel thread consumes the SQ ring, so submissions need no syscall
+/// while it is awake. It sleeps after sq_thread_idle_ms without work and
+/// is woken by the next submit().
+struct SqPollConfig {
+    /// Core for the kernel SQ thread (-1 = pick via CpuAffinity, away from
+    /// the submitting thread's core)
+    int sq_thread_cpu{-1};
+
+    /// Idle time before the SQ thread sleeps
+    unsigned sq_thread_idle_ms{2000};
+
+    /// Pin the calling (submitting) thread to this core first (-1 = leave)
+    int submitter_cpu{-1};
+};
+
+/// Busy-poll completion reaping (IoUringContext::init_busy_poll)
+/// The reaping thread spins on the CQ ring tail instead of sleeping in
+/// io_uring_enter. DEFER_TASKRUN is left off, since it only posts
+/// completions from io_uring_enter; COOP_TASKRUN + TASKRUN_FLAG mark in the
+/// SQ flags when the kernel has completions waiting for a syscall to run.
+struct BusyPollConfig {
+    /// Also let a kernel SQ thread consume submissions: with it, the
+    /// steady state needs no syscall to submit or to reap
+    bool sqpoll{false};
+
+    /// SQ thread placement when sqpoll is set
+    SqPollConfig sq{};
+};
+
+/// Counters for the busy-poll reaping path
+struct CqPollStats {
+    uint64_t polls{0};          // reap() calls
+    uint64_t empty_polls{0};    // reap() calls that found nothing
+    uint64_t cqes{0};           // Completions handed out
+    uint64_t enters{0};         // io_uring_enter calls made by reap() and submit()
+};
+
 /// Manages io_uring instance
 class IoUringContext {
 public:
@@ -88,12 +148,118 @@ public:
         return {};
     }
 
+    /// Initialize io_uring with kernel-side submission polling
+    /// Falls back to init() when SQPOLL is refused (kernel < 5.11 without
+    /// CAP_SYS_NICE, or an invalid CPU); check is_sqpoll() afterwards.
+    /// SQPOLL excludes DEFER_TASKRUN: completions are posted by the SQ
+    /// thread, so pair it with busy polling via peek() for zero syscalls.
+    [[nodiscard]] TransportResult<void> init_sqpoll(
+        const SqPollConfig& config = {},
+        unsigned queue_depth = QUEUE_DEPTH) noexcept
+    {
+        if (config.submitter_cpu >= 0) {
+            (void)util::CpuAffinity::pin_to_core(config.submitter_cpu);
+        }
+
+        int cpu = config.sq_thread_cpu;
+        if (cpu < 0) {
+            cpu = util::CpuAffinity::pick_companion_core(util::CpuAffinity::current_core());
+        }
+
+        struct io_uring_params params = {};
+        params.flags = IORING_SETUP_SQPOLL;
+        params.sq_thread_idle = config.sq_thread_idle_ms;
+        if (cpu >= 0) {
+            params.flags |= IORING_SETUP_SQ_AFF;
+            params.sq_thread_cpu = static_cast<unsigned>(cpu);
+        }
+
+        if (io_uring_queue_init_params(queue_depth, &ring_, &params) < 0) {
+            return init(queue_depth);
+        }
+
+        initialized_ = true;
+        optimized_ = false;
+        sqpoll_ = true;
+        sq_thread_cpu_ = cpu;
+        return {};
+    }
+
+    /// Initialize for busy-poll reaping with reap() / busy_poll()
+    /// Falls back to init() flags the kernel refuses; check is_busy_poll()
+    /// and is_sqpoll() afterwards.
+    [[nodiscard]] TransportResult<void> init_busy_poll(
+        const BusyPollConfig& config = {},
+        unsigned queue_depth = QUEUE_DEPTH) noexcept
+    {
+        if (config.sqpoll) {
+            auto result = init_sqpoll(config.sq, queue_depth);
+            busy_poll_ = result.has_value() && !optimized_;
+            return result;
+        }
+
+        struct io_uring_params params = {};
+#if defined(IORING_SETUP_TASKRUN_FLAG)
+        params.flags = IORING_SETUP_COOP_TASKRUN | IORING_SETUP_TASKRUN_FLAG;
+#if defined(IORING_SETUP_SINGLE_ISSUER)
+        params.flags |= IORING_SETUP_SINGLE_ISSUER;
+#endif
+        if (io_uring_queue_init_params(queue_depth, &ring_, &params) == 0) {
+            initialized_ = true;
+            optimized_ = false;
+            busy_poll_ = true;
+            return {};
+        }
+#else
+        (void)params;
+#endif
+        auto result = init(queue_depth);
+        // DEFER_TASKRUN rings post completions only from io_uring_enter
+        busy_poll_ = result.has_value() && !optimized_;
+        return result;
+    }
+
+    /// Check if the ring was set up for busy-poll reaping
+    [[nodiscard]] bool is_busy_poll() const noexcept {
+        return busy_poll_;
+    }
+
     /// Check if using optimized mode (DEFER_TASKRUN enabled)
     [[nodiscard]] bool is_optimized() const noexcept {
         return optimized_;
     }
 
+    /// Check if the kernel SQ thread polls submissions (SQPOLL mode)
+    [[nodiscard]] bool is_sqpoll() const noexcept {
+        return sqpoll_;
+    }
+
+    /// Core the SQ thread is pinned to (-1 if unpinned or not SQPOLL)
+    [[nodiscard]] int sq_thread_cpu() const noexcept {
+        return sq_thread_cpu_;
+    }
+
+    /// Check if the idle SQ thread must be woken by the next submit()
+    [[nodiscard]] bool sq_needs_wakeup() const noexcept {
+        return sqpoll_ &&
+               (__atomic_load_n(ring_.sq.kflags, __ATOMIC_ACQUIRE) & IORING_SQ_NEED_WAKEUP) != 0;
+    }
+
+    /// Submits that had to wake the SQ thread (each one costs a syscall)
+    [[nodiscard]] uint64_t sq_wakeups() const noexcept {
+        return sq_wakeups_;
+    }
+
 private:
+    /// Completions the kernel holds until the next io_uring_enter
+    [[nodiscard]] bool kernel_has_completions() const noexcept {
+        const unsigned flags = __atomic_load_n(ring_.sq.kflags, __ATOMIC_ACQUIRE);
+#if defined(IORING_SQ_TASKRUN)
+        if (flags & IORING_SQ_TASKRUN) return true;
+#endif
+        return (flags & IORING_SQ_CQ_OVERFLOW) != 0;
+    }
+
     /// Try to initialize with modern kernel flags (kernel 6.0+)
     /// Returns 0 on success, negative errno on failure
     [[nodiscard]] int try_init_optimized(unsigned queue_depth) noexcept {
@@ -139,7 +305,17 @@ public:
     }
 
     /// Submit pending entries
+    /// In SQPOLL mode this only publishes the SQ tail; liburing enters the
+    /// kernel with IORING_ENTER_SQ_WAKEUP only if the SQ thread is asleep.
     int submit() noexcept {
+        if (sqpoll_) {
+            if (sq_needs_wakeup()) [[unlikely]] {
+                ++sq_wakeups_;
+                ++poll_stats_.enters;
+            }
+        } else if (io_uring_sq_ready(&ring_) > 0) {
+            ++poll_stats_.enters;
+        }
         return io_uring_submit(&ring_);
     }
 
@@ -165,6 +341,99 @@ public:
         return io_uring_peek_cqe(&ring_, cqe);
     }
 
+    /// Submit queued SQEs, then resume the coroutine of every ready CQE
+    /// whose user_data is an IoCompletion (the async_* socket operations).
+    /// Each CQE is marked seen before its coroutine resumes, so resumed
+    /// code may submit and reap freely.
+    /// @param timeout_ms Wait this long for a first completion (0 = poll)
+    /// @return Completions dispatched
+    unsigned dispatch_completions(int timeout_ms = 0) noexcept {
+        (void)submit();
+
+        struct io_uring_cqe* cqe = nullptr;
+        if (timeout_ms != 0 && peek(&cqe) != 0) {
+            if (wait(&cqe, timeout_ms) < 0) return 0;
+        }
+
+        unsigned dispatched = 0;
+        while (peek(&cqe) == 0) {
+            void* user_data = io_uring_cqe_get_data(cqe);
+            const int result = cqe->res;
+            const uint32_t flags = cqe->flags;
+            seen(cqe);
+            if (user_data != nullptr) {
+                IoCompletion::resume(user_data, result, flags);
+            }
+            ++dispatched;
+        }
+        return dispatched;
+    }
+
+    // ========================================================================
+    // Busy-poll Reaping
+    // ========================================================================
+    // reap() reads the CQ ring directly (io_uring_peek_batch_cqe); it enters
+    // the kernel only when the kernel flags deferred completions
+    // (IORING_SQ_TASKRUN) or an overflowed CQ. On an init_busy_poll() ring
+    // the steady-state receive path makes no syscalls: CqPollStats::enters
+    // stays flat while cqes grows.
+
+    /// CQEs handed out per reap()
+    static constexpr unsigned REAP_BATCH = 32;
+
+    /// Hand every ready CQE (up to max) to handler(io_uring_cqe*) and mark
+    /// the batch seen; never blocks
+    /// @return CQEs handled
+    template<typename Handler>
+    unsigned reap(Handler&& handler, unsigned max = REAP_BATCH) noexcept {
+        struct io_uring_cqe* cqes[REAP_BATCH];
+        max = std::min(max, REAP_BATCH);
+        ++poll_stats_.polls;
+
+        unsigned count = io_uring_peek_batch_cqe(&ring_, cqes, max);
+        if (count == 0 && kernel_has_completions()) [[unlikely]] {
+            ++poll_stats_.enters;
+            (void)io_uring_get_events(&ring_);
+            count = io_uring_peek_batch_cqe(&ring_, cqes, max);
+        }
+        if (count == 0) {
+            ++poll_stats_.empty_polls;
+            return 0;
+        }
+
+        for (unsigned i = 0; i < count; ++i) {
+            handler(cqes[i]);
+        }
+        io_uring_cq_advance(&ring_, count);
+        poll_stats_.cqes += count;
+        return count;
+    }
+
+    /// Spin on the CQ ring until stop() returns true, submitting queued
+    /// SQEs on the way; WaitStrategyT::wait() runs on every empty poll
+    /// @return CQEs handled
+    template<typename WaitStrategyT = memory::BusySpinWait, typename Handler, typename Stop>
+        requires memory::WaitStrategy<WaitStrategyT>
+    uint64_t busy_poll(Handler&& handler, Stop&& stop) noexcept {
+        uint64_t handled = 0;
+        while (!stop()) {
+            if (io_uring_sq_ready(&ring_) > 0) {
+                (void)submit();
+            }
+            const unsigned n = reap(handler);
+            if (n == 0) {
+                WaitStrategyT::wait();
+            }
+            handled += n;
+        }
+        return handled;
+    }
+
+    /// Busy-poll counters
+    [[nodiscard]] const CqPollStats& poll_stats() const noexcept {
+        return poll_stats_;
+    }
+
     /// Get underlying ring
     [[nodiscard]] struct io_uring* ring() noexcept {
         return &ring_;
@@ -237,12 +506,134 @@ public:
         return nr_registered_buffers_;
     }
 
+    // ========================================================================
+    // Registered Files (kernel 5.5+, sparse registration 5.19+)
+    // ========================================================================
+    // SQEs flagged IOSQE_FIXED_FILE name a slot in this table instead of an
+    // fd, so the kernel skips the per-op fd table lookup and file refcount.
+    // Slots are handed out LIFO: a session that reconnects gets its old
+    // slot back.
+
+    /// Register an empty table of `slots` fixed files
+    /// @return 0 on success (or if a table exists), negative errno on failure
+    [[nodiscard]] int register_file_table(unsigned slots = QUEUE_DEPTH) noexcept {
+        if (!initialized_) return -EINVAL;
+        if (file_slots_ > 0) return 0;
+
+        int ret = -EINVAL;
+#if defined(IORING_RSRC_REGISTER_SPARSE)
+        ret = io_uring_register_files_sparse(&ring_, slots);
+#endif
+        if (ret < 0) {
+            // Older kernels: register the table with every slot empty
+            std::vector<int> empty(slots, -1);
+            ret = io_uring_register_files(&ring_, empty.data(), slots);
+        }
+        if (ret < 0) return ret;
+
+        file_slots_ = slots;
+        free_file_slots_.clear();
+        free_file_slots_.reserve(slots);
+        for (unsigned slot = slots; slot > 0; --slot) {
+            free_file_slots_.push_back(slot - 1);
+        }
+        return 0;
+    }
+
+    /// Install fd in a free slot
+    /// @return Slot index, or -1 if there is no table or it is full
+    [[nodiscard]] int acquire_file_slot(int fd) noexcept {
+        if (free_file_slots_.empty()) return -1;
+        const unsigned slot = free_file_slots_.back();
+        if (io_uring_register_files_update(&ring_, slot, &fd, 1) != 1) return -1;
+        free_file_slots_.pop_back();
+        return static_cast<int>(slot);
+    }
+
+    /// Empty a slot and make it available again; in-flight operations keep
+    /// their own reference to the file
+    void release_file_slot(int slot) noexcept {
+        if (slot < 0 || static_cast<unsigned>(slot) >= file_slots_) return;
+        int empty = -1;
+        (void)io_uring_register_files_update(&ring_, static_cast<unsigned>(slot), &empty, 1);
+        free_file_slots_.push_back(static_cast<unsigned>(slot));
+    }
+
+    /// Check if a fixed file table is registered
+    [[nodiscard]] bool has_file_table() const noexcept {
+        return file_slots_ > 0;
+    }
+
+    /// Slots not holding a socket
+    [[nodiscard]] size_t free_file_slots() const noexcept {
+        return free_file_slots_.size();
+    }
+
 private:
     struct io_uring ring_;
     bool initialized_;
     bool optimized_;  // True if DEFER_TASKRUN is enabled (kernel 6.1+)
+    bool sqpoll_{false};
+    bool busy_poll_{false};
+    int sq_thread_cpu_{-1};
+    uint64_t sq_wakeups_{0};
+    CqPollStats poll_stats_{};
     bool registered_buffers_{false};
     unsigned nr_registered_buffers_{0};
+    unsigned file_slots_{0};
+    std::vector<unsigned> free_file_slots_;   // LIFO, so slots are reused
+};
+
+// ============================================================================
+// I/O Buffer Memory
+// ============================================================================
+
+/// Backing region for the buffer pools below: page-aligned heap memory, or
+/// a prefaulted huge-page mapping (THP fallback) so that the whole pool is
+/// covered by a few TLB entries on both the user and kernel side.
+/// Optionally bound to the NUMA node of the NIC or the polling core.
+class IoBufferMemory {
+public:
+    IoBufferMemory() noexcept = default;
+    ~IoBufferMemory() { release(); }
+
+    IoBufferMemory(const IoBufferMemory&) = delete;
+    IoBufferMemory& operator=(const IoBufferMemory&) = delete;
+
+    /// @param numa_node Bind the pages to this node (-1 = local policy)
+    [[nodiscard]] bool allocate(size_t size, bool huge_pages, int numa_node = -1) noexcept {
+        release();
+        size_ = size;
+        huge_pages_ = huge_pages;
+        data_ = static_cast<char*>(huge_pages
+            ? memory::HugePageAllocator::allocate_prefaulted(
+                  size, memory::HugePageSize::Huge2MB, numa_node)
+            : aligned_alloc(4096, size));
+        if (data_ && !huge_pages && numa_node >= 0) {
+            // Untouched heap pages: bound before first use
+            (void)util::bind_memory_to_node(data_, size, numa_node);
+        }
+        return data_ != nullptr;
+    }
+
+    void release() noexcept {
+        if (!data_) return;
+        if (huge_pages_) {
+            memory::HugePageAllocator::deallocate(data_, size_);
+        } else {
+            free(data_);
+        }
+        data_ = nullptr;
+    }
+
+    [[nodiscard]] char* data() const noexcept { return data_; }
+    [[nodiscard]] bool huge_pages() const noexcept { return huge_pages_; }
+    explicit operator bool() const noexcept { return data_ != nullptr; }
+
+private:
+    char* data_{nullptr};
+    size_t size_{0};
+    bool huge_pages_{false};
 };
 
 // ============================================================================
@@ -270,27 +661,28 @@ public:
     /// @param ctx io_uring context to register with
     /// @param buffer_size Size of each buffer
     /// @param num_buffers Number of buffers to allocate
+    /// @param huge_pages Back the buffers with prefaulted huge pages
+    /// @param numa_node Bind the buffers to this NUMA node (-1 = local)
     /// @return true on success
     [[nodiscard]] bool init(
         IoUringContext& ctx,
         size_t buffer_size = DEFAULT_BUFFER_SIZE,
-        size_t num_buffers = DEFAULT_NUM_BUFFERS) noexcept
+        size_t num_buffers = DEFAULT_NUM_BUFFERS,
+        bool huge_pages = false,
+        int numa_node = -1) noexcept
     {
         if (initialized_) return false;
 
         buffer_size_ = buffer_size;
         num_buffers_ = num_buffers;
 
-        // Allocate aligned memory for all buffers
         // Page-aligned for optimal kernel mapping
-        size_t total_size = buffer_size * num_buffers;
-        memory_ = static_cast<char*>(aligned_alloc(4096, total_size));
-        if (!memory_) return false;
+        if (!memory_.allocate(buffer_size * num_buffers, huge_pages, numa_node)) return false;
 
         // Build iovec array
         iovecs_.resize(num_buffers);
         for (size_t i = 0; i < num_buffers; ++i) {
-            iovecs_[i].iov_base = memory_ + (i * buffer_size);
+            iovecs_[i].iov_base = memory_.data() + (i * buffer_size);
             iovecs_[i].iov_len = buffer_size;
         }
 
@@ -352,17 +744,14 @@ private:
         if (ctx_ && initialized_) {
             (void)ctx_->unregister_buffers();
         }
-        if (memory_) {
-            free(memory_);
-            memory_ = nullptr;
-        }
+        memory_.release();
         iovecs_.clear();
         free_indices_.clear();
         initialized_ = false;
     }
 
     IoUringContext* ctx_{nullptr};
-    char* memory_{nullptr};
+    IoBufferMemory memory_;
     std::vector<struct iovec> iovecs_;
     std::vector<uint16_t> free_indices_;
     size_t buffer_size_{0};
@@ -403,12 +792,16 @@ public:
     /// @param group_id Buffer group ID (0 is default)
     /// @param buffer_size Size of each buffer
     /// @param num_buffers Number of buffers in group
+    /// @param huge_pages Back the buffers with prefaulted huge pages
+    /// @param numa_node Bind the buffers to this NUMA node (-1 = local)
     /// @return true on success
     [[nodiscard]] bool init(
         IoUringContext& ctx,
         uint16_t group_id = DEFAULT_GROUP_ID,
         size_t buffer_size = DEFAULT_BUFFER_SIZE,
-        size_t num_buffers = DEFAULT_NUM_BUFFERS) noexcept
+        size_t num_buffers = DEFAULT_NUM_BUFFERS,
+        bool huge_pages = false,
+        int numa_node = -1) noexcept
     {
         if (initialized_) return false;
 
@@ -419,9 +812,7 @@ public:
         num_buffers_ = num_buffers;
 
         // Allocate contiguous memory for all buffers
-        size_t total_size = buffer_size * num_buffers;
-        memory_ = static_cast<char*>(aligned_alloc(4096, total_size));
-        if (!memory_) return false;
+        if (!memory_.allocate(buffer_size * num_buffers, huge_pages, numa_node)) return false;
 
         // Register buffers with kernel using PROVIDE_BUFFERS
         auto* sqe = ctx.get_sqe();
@@ -430,7 +821,7 @@ public:
             return false;
         }
 
-        io_uring_prep_provide_buffers(sqe, memory_, static_cast<int>(buffer_size),
+        io_uring_prep_provide_buffers(sqe, memory_.data(), static_cast<int>(buffer_size),
                                       static_cast<int>(num_buffers), group_id, 0);
 
         int ret = ctx.submit();
@@ -452,15 +843,156 @@ public:
         return true;
 #else
         (void)ctx; (void)group_id; (void)buffer_size; (void)num_buffers;
+        (void)huge_pages; (void)numa_node;
         return false;  // Kernel too old
 #endif
     }
 
+    // ========================================================================
+    // Buffer Ring (kernel 5.19+)
+    // ========================================================================
+    // Buffers live in a ring shared with the kernel instead of being handed
+    // over by PROVIDE_BUFFERS SQEs: giving a buffer back is a store into the
+    // ring, and all buffers returned by one completion are published with a
+    // single tail update. A ring also enables:
+    //   - bundles (IORING_RECVSEND_BUNDLE, kernel 6.10+): one recv CQE covers
+    //     several consecutive ring entries, so a burst of small messages
+    //     costs one completion instead of one per buffer
+    //   - incremental consumption (IOU_PBUF_RING_INC, kernel 6.12+): each
+    //     recv takes only the bytes it needs from the head buffer, which
+    //     keeps filling (IORING_CQE_F_BUF_MORE) until it is full
+    // consume() walks whichever layout a CQE uses.
+
+    /// Initialize the group as a provided buffer ring
+    /// @param num_buffers Rounded down to a power of two (ring requirement)
+    /// @param incremental Consume buffers incrementally (not with bundles)
+    /// @return false if the kernel or liburing lacks buffer rings (or
+    ///         incremental mode); init() is the fallback
+    [[nodiscard]] bool init_ring(
+        IoUringContext& ctx,
+        uint16_t group_id = DEFAULT_GROUP_ID,
+        size_t buffer_size = DEFAULT_BUFFER_SIZE,
+        size_t num_buffers = DEFAULT_NUM_BUFFERS,
+        bool huge_pages = false,
+        int numa_node = -1,
+        bool incremental = false) noexcept
+    {
+        if (initialized_) return false;
+
+#if NFX_IO_URING_BUF_RING
+        unsigned flags = 0;
+        if (incremental) {
+#if defined(IORING_CQE_F_BUF_MORE)
+            flags |= IOU_PBUF_RING_INC;
+#else
+            return false;
+#endif
+        }
+
+        num_buffers = std::bit_floor(std::min<size_t>(num_buffers, MAX_RING_ENTRIES));
+        if (num_buffers == 0) return false;
+
+        ctx_ = &ctx;
+        group_id_ = group_id;
+        buffer_size_ = buffer_size;
+        num_buffers_ = num_buffers;
+
+        if (!memory_.allocate(buffer_size * num_buffers, huge_pages, numa_node)) return false;
+        if (incremental) {
+            consumed_.assign(num_buffers, 0);
+        }
+
+        int ret = 0;
+        buf_ring_ = io_uring_setup_buf_ring(ctx.ring(), static_cast<unsigned>(num_buffers),
+                                            group_id, flags, &ret);
+        if (!buf_ring_) {
+            cleanup();
+            return false;
+        }
+
+        ring_mask_ = io_uring_buf_ring_mask(static_cast<unsigned>(num_buffers));
+        for (size_t i = 0; i < num_buffers; ++i) {
+            recycle(static_cast<uint16_t>(i));
+        }
+        publish();
+
+        incremental_ = incremental;
+        initialized_ = true;
+        return true;
+#else
+        (void)ctx; (void)group_id; (void)buffer_size; (void)num_buffers;
+        (void)huge_pages; (void)numa_node; (void)incremental;
+        return false;
+#endif
+    }
+
+    /// Check if the group is a buffer ring (bundles possible)
+    [[nodiscard]] bool is_ring() const noexcept {
+#if NFX_IO_URING_BUF_RING
+        return buf_ring_ != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    /// Check if buffers are consumed incrementally
+    [[nodiscard]] bool is_incremental() const noexcept { return incremental_; }
+
+    /// Hand the bytes of a recv CQE to fn(std::span<const char>), in
+    /// order, and give every buffer it finished back to the group: one ring
+    /// tail update per CQE, or a PROVIDE_BUFFERS SQE per buffer without a
+    /// ring (the caller submits those)
+    /// @return Buffers given back
+    template<typename Fn>
+    size_t consume(int result, uint32_t cqe_flags, Fn&& fn) noexcept {
+        if (!initialized_ || !has_buffer(cqe_flags)) return 0;
+        uint16_t buf_id = buffer_id_from_cqe(cqe_flags);
+        if (buf_id >= num_buffers_) return 0;
+        size_t left = result > 0 ? static_cast<size_t>(result) : 0;
+
+#if NFX_IO_URING_BUF_RING
+        if (buf_ring_ && incremental_) {
+            // Data continues where the previous recv into this buffer stopped
+            uint32_t& offset = consumed_[buf_id];
+            if (left > 0) fn(std::span<const char>{buffer(buf_id) + offset, left});
+            if (buffer_has_more(cqe_flags)) {
+                offset += static_cast<uint32_t>(left);
+                return 0;
+            }
+            offset = 0;
+            ++ring_head_;
+            recycle(buf_id);
+            publish();
+            return 1;
+        }
+
+        if (buf_ring_) {
+            // A bundle fills consecutive ring entries from the head
+            size_t returned = 0;
+            do {
+                const size_t take = std::min(left, buffer_size_);
+                if (take > 0) fn(std::span<const char>{buffer(buf_id), take});
+                left -= take;
+                ++ring_head_;
+                recycle(buf_id);
+                ++returned;
+                buf_id = buf_ring_->bufs[ring_head_ & ring_mask_].bid;
+            } while (left > 0 && returned < num_buffers_);
+            publish();
+            return returned;
+        }
+#endif
+
+        if (left > 0) fn(std::span<const char>{buffer(buf_id), left});
+        (void)replenish(buf_id);
+        return 1;
+    }
+
     /// Get buffer pointer from completion buffer ID
     /// @param buf_id Buffer ID from CQE (cqe->flags >> IORING_CQE_BUFFER_SHIFT)
     [[nodiscard]] char* buffer(uint16_t buf_id) noexcept {
         if (!memory_ || buf_id >= num_buffers_) return nullptr;
-        return memory_ + (buf_id * buffer_size_);
+        return memory_.data() + (buf_id * buffer_size_);
     }
 
     /// Replenish a consumed buffer back to the group
@@ -468,12 +1000,21 @@ public:
     [[nodiscard]] bool replenish(uint16_t buf_id) noexcept {
 #if defined(IORING_OP_PROVIDE_BUFFERS)
         if (!initialized_ || !ctx_ || buf_id >= num_buffers_) return false;
+#if NFX_IO_URING_BUF_RING
+        if (buf_ring_) {
+            ++ring_head_;
+            recycle(buf_id);
+            publish();
+            return true;
+        }
+#endif
 
         auto* sqe = ctx_->get_sqe();
         if (!sqe) return false;
 
-        char* buf = memory_ + (buf_id * buffer_size_);
+        char* buf = memory_.data() + (buf_id * buffer_size_);
         io_uring_prep_provide_buffers(sqe, buf, static_cast<int>(buffer_size_), 1, group_id_, buf_id);
+        io_uring_sqe_set_data(sqe, nullptr);  // Not mistaken for a tagged op
 
         return true;  // Caller should batch and submit
 #else
@@ -524,22 +1065,65 @@ public:
 #endif
     }
 
+    /// Check if an incrementally consumed buffer keeps receiving data
+    [[nodiscard]] static bool buffer_has_more(uint32_t cqe_flags) noexcept {
+#if defined(IORING_CQE_F_BUF_MORE)
+        return (cqe_flags & IORING_CQE_F_BUF_MORE) != 0;
+#else
+        (void)cqe_flags;
+        return false;
+#endif
+    }
+
 private:
+    /// Buffer ring entries the kernel accepts
+    static constexpr size_t MAX_RING_ENTRIES = 32768;
+
+#if NFX_IO_URING_BUF_RING
+    /// Stage a buffer at the ring tail; visible to the kernel on publish()
+    void recycle(uint16_t buf_id) noexcept {
+        io_uring_buf_ring_add(buf_ring_, buffer(buf_id), static_cast<unsigned>(buffer_size_),
+                              buf_id, static_cast<int>(ring_mask_), static_cast<int>(staged_));
+        ++staged_;
+    }
+
+    /// Make staged buffers visible with one tail update
+    void publish() noexcept {
+        if (staged_ == 0) return;
+        io_uring_buf_ring_advance(buf_ring_, static_cast<int>(staged_));
+        staged_ = 0;
+    }
+#endif
+
     void cleanup() noexcept {
-        if (memory_) {
-            // Note: kernel automatically cleans up provided buffers on ring exit
-            free(memory_);
-            memory_ = nullptr;
+        // Note: kernel automatically cleans up provided buffers on ring exit
+#if NFX_IO_URING_BUF_RING
+        if (buf_ring_) {
+            (void)io_uring_free_buf_ring(ctx_->ring(), buf_ring_,
+                                         static_cast<unsigned>(num_buffers_), group_id_);
+            buf_ring_ = nullptr;
         }
+#endif
+        memory_.release();
+        consumed_.clear();
+        incremental_ = false;
         initialized_ = false;
     }
 
     IoUringContext* ctx_{nullptr};
-    char* memory_{nullptr};
+    IoBufferMemory memory_;
     uint16_t group_id_{0};
     size_t buffer_size_{0};
     size_t num_buffers_{0};
     bool initialized_{false};
+#if NFX_IO_URING_BUF_RING
+    struct io_uring_buf_ring* buf_ring_{nullptr};
+    unsigned ring_mask_{0};
+    uint16_t ring_head_{0};     // Next entry the kernel fills (wraps with the ring)
+    unsigned staged_{0};        // Recycled since the last publish()
+#endif
+    bool incremental_{false};
+    std::vector<uint32_t> consumed_;    // Incremental mode: bytes used per buffer
 };
 
 // ============================================================================
@@ -563,14 +1147,33 @@ public:
     IoUringSocket& operator=(const IoUringSocket&) = delete;
 
     /// Create socket
-    [[nodiscard]] TransportResult<void> create() noexcept {
+    /// @param fixed_file Install it in the context's fixed file table, if
+    ///        one is registered and has a free slot; SQEs then carry the
+    ///        slot with IOSQE_FIXED_FILE instead of the fd
+    [[nodiscard]] TransportResult<void> create(bool fixed_file = false) noexcept {
+        close_sync();
         fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
         if (fd_ < 0) {
             return std::unexpected{TransportError{TransportErrorCode::SocketError, errno}};
         }
+        if (fixed_file && ctx_.has_file_table()) {
+            fixed_slot_ = ctx_.acquire_file_slot(fd_);
+        }
         return {};
     }
 
+    /// Take ownership of a connected socket, installed in the fixed file
+    /// table like create() does
+    void adopt(int fd, bool fixed_file = false) noexcept {
+        close_sync();
+        fd_ = fd;
+        (void)set_socket_nonblocking(fd_, true);
+        if (fixed_file && ctx_.has_file_table()) {
+            fixed_slot_ = ctx_.acquire_file_slot(fd_);
+        }
+        on_connect_complete(0);
+    }
+
     /// Submit async connect
     [[nodiscard]] TransportResult<void> submit_connect(
         const struct sockaddr* addr,
@@ -582,7 +1185,8 @@ public:
             return std::unexpected{TransportError{TransportErrorCode::SocketError}};
         }
 
-        io_uring_prep_connect(sqe, fd_, addr, addrlen);
+        io_uring_prep_connect(sqe, target_fd(), addr, addrlen);
+        mark_fixed_file(sqe);
         io_uring_sqe_set_data(sqe, user_data);
         state_ = ConnectionState::Connecting;
 
@@ -599,28 +1203,91 @@ public:
             return std::unexpected{TransportError{TransportErrorCode::SocketError}};
         }
 
-        io_uring_prep_recv(sqe, fd_, buffer.data(), buffer.size(), 0);
+        io_uring_prep_recv(sqe, target_fd(), buffer.data(), buffer.size(), 0);
+        mark_fixed_file(sqe);
+        io_uring_sqe_set_data(sqe, user_data);
+
+        return {};
+    }
+
+    /// Submit async recvmsg (IORING_OP_RECVMSG); msg must stay valid
+    /// until the completion is reaped
+    [[nodiscard]] TransportResult<void> submit_recvmsg(
+        struct msghdr* msg,
+        void* user_data = nullptr) noexcept
+    {
+        auto sqe = ctx_.get_sqe();
+        if (!sqe) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError}};
+        }
+
+        io_uring_prep_recvmsg(sqe, target_fd(), msg, 0);
+        mark_fixed_file(sqe);
         io_uring_sqe_set_data(sqe, user_data);
 
         return {};
     }
 
     /// Submit async write
+    /// @param deadline If set, a linked IORING_OP_LINK_TIMEOUT cancels the
+    ///        write (-ECANCELED) when it is still blocked after this
+    ///        relative time; must stay valid until the SQEs are submitted.
+    ///        The timeout posts its own CQE with deadline_user_data.
     [[nodiscard]] TransportResult<void> submit_write(
         std::span<const char> data,
-        void* user_data = nullptr) noexcept
+        void* user_data = nullptr,
+        const struct __kernel_timespec* deadline = nullptr,
+        void* deadline_user_data = nullptr) noexcept
     {
-        auto sqe = ctx_.get_sqe();
+        auto sqe = get_sqes(deadline ? 2 : 1);
         if (!sqe) {
             return std::unexpected{TransportError{TransportErrorCode::SocketError}};
         }
 
-        io_uring_prep_send(sqe, fd_, data.data(), data.size(), 0);
+        io_uring_prep_send(sqe, target_fd(), data.data(), data.size(), MSG_NOSIGNAL);
+        mark_fixed_file(sqe);
         io_uring_sqe_set_data(sqe, user_data);
+        if (deadline) link_deadline(sqe, deadline, deadline_user_data);
 
         return {};
     }
 
+    // ========================================================================
+    // Awaitable Operations (transport/async_io.hpp)
+    // ========================================================================
+    // co_await yields cqe->res: bytes transferred (0 on EOF) or -errno; the
+    // coroutine resumes from IoUringContext::dispatch_completions().
+    // Buffers must stay valid until the await completes.
+
+    /// Awaitable recv
+    [[nodiscard]] auto async_recv(std::span<char> buffer) noexcept {
+        return IoAwaitable{[this, buffer](IoCompletion* completion) noexcept {
+            return prep(completion, [&](struct io_uring_sqe* sqe) {
+                io_uring_prep_recv(sqe, target_fd(), buffer.data(), buffer.size(), 0);
+            });
+        }};
+    }
+
+    /// Awaitable send
+    [[nodiscard]] auto async_send(std::span<const char> data) noexcept {
+        return IoAwaitable{[this, data](IoCompletion* completion) noexcept {
+            return prep(completion, [&](struct io_uring_sqe* sqe) {
+                io_uring_prep_send(sqe, target_fd(), data.data(), data.size(), MSG_NOSIGNAL);
+            });
+        }};
+    }
+
+    /// Awaitable connect (0 on success); pass the result to
+    /// on_connect_complete() to apply the socket options
+    [[nodiscard]] auto async_connect(const struct sockaddr* addr, socklen_t addrlen) noexcept {
+        state_ = ConnectionState::Connecting;
+        return IoAwaitable{[this, addr, addrlen](IoCompletion* completion) noexcept {
+            return prep(completion, [&](struct io_uring_sqe* sqe) {
+                io_uring_prep_connect(sqe, target_fd(), addr, addrlen);
+            });
+        }};
+    }
+
     // ========================================================================
     // Fixed Buffer Operations (requires registered buffers)
     // ========================================================================
@@ -644,7 +1311,8 @@ public:
         }
 
         // Use read_fixed which uses pre-registered buffer
-        io_uring_prep_read_fixed(sqe, fd_, nullptr, len, offset, buf_index);
+        io_uring_prep_read_fixed(sqe, target_fd(), nullptr, len, offset, buf_index);
+        mark_fixed_file(sqe);
         io_uring_sqe_set_data(sqe, user_data);
 
         return {};
@@ -659,18 +1327,68 @@ public:
         uint16_t buf_index,
         size_t len,
         size_t offset = 0,
+        void* user_data = nullptr,
+        const struct __kernel_timespec* deadline = nullptr,
+        void* deadline_user_data = nullptr) noexcept
+    {
+        auto sqe = get_sqes(deadline ? 2 : 1);
+        if (!sqe) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError}};
+        }
+
+        // Use write_fixed which uses pre-registered buffer
+        io_uring_prep_write_fixed(sqe, target_fd(), nullptr, len, offset, buf_index);
+        mark_fixed_file(sqe);
+        io_uring_sqe_set_data(sqe, user_data);
+        if (deadline) link_deadline(sqe, deadline, deadline_user_data);
+
+        return {};
+    }
+
+    // ========================================================================
+    // Zero-copy Send (kernel 6.0+)
+    // ========================================================================
+    // SEND_ZC transmits straight from the registered pages instead of copying
+    // into kernel socket buffers. Each send posts two CQEs with the same
+    // user_data: the result (IORING_CQE_F_MORE set when a notification
+    // follows) and a notification (IORING_CQE_F_NOTIF) once the kernel no
+    // longer references the buffer. The buffer must not be reused before it.
+
+    /// Submit zero-copy send from a registered buffer
+    /// @param buf_index Index of registered buffer containing data
+    /// @param data Bytes to send (must lie within the registered buffer)
+    /// @param user_data User context (returned in both CQEs)
+    [[nodiscard]] TransportResult<void> submit_send_zc_fixed(
+        uint16_t buf_index,
+        std::span<const char> data,
         void* user_data = nullptr) noexcept
     {
+#if defined(IORING_CQE_F_NOTIF)
         auto sqe = ctx_.get_sqe();
         if (!sqe) {
             return std::unexpected{TransportError{TransportErrorCode::SocketError}};
         }
 
-        // Use write_fixed which uses pre-registered buffer
-        io_uring_prep_write_fixed(sqe, fd_, nullptr, len, offset, buf_index);
+        io_uring_prep_send_zc_fixed(sqe, target_fd(), data.data(), data.size(),
+                                    MSG_NOSIGNAL, 0, buf_index);
+        mark_fixed_file(sqe);
         io_uring_sqe_set_data(sqe, user_data);
 
         return {};
+#else
+        (void)buf_index; (void)data; (void)user_data;
+        return std::unexpected{TransportError{TransportErrorCode::SocketError, ENOTSUP}};
+#endif
+    }
+
+    /// Check if CQE is a zero-copy send notification (buffer released)
+    [[nodiscard]] static bool is_send_zc_notification(uint32_t cqe_flags) noexcept {
+#if defined(IORING_CQE_F_NOTIF)
+        return (cqe_flags & IORING_CQE_F_NOTIF) != 0;
+#else
+        (void)cqe_flags;
+        return false;
+#endif
     }
 
     // ========================================================================
@@ -682,6 +1400,7 @@ public:
     /// Submit multishot receive with provided buffer group
     /// @param buf_group_id Buffer group ID from ProvidedBufferGroup
     /// @param user_data User context (returned in each CQE)
+    /// @param bundle Let each CQE span several buffers (buffer rings only)
     /// @return true if supported and submitted
     ///
     /// Usage:
@@ -693,7 +1412,8 @@ public:
     ///   // Process data, then replenish buffer
     [[nodiscard]] TransportResult<void> submit_recv_multishot(
         uint16_t buf_group_id,
-        void* user_data = nullptr) noexcept
+        void* user_data = nullptr,
+        bool bundle = false) noexcept
     {
 #if defined(IORING_RECV_MULTISHOT)
         auto sqe = ctx_.get_sqe();
@@ -702,16 +1422,21 @@ public:
         }
 
         // Prep multishot recv - no buffer needed, kernel picks from group
-        io_uring_prep_recv(sqe, fd_, nullptr, 0, 0);
+        io_uring_prep_recv(sqe, target_fd(), nullptr, 0, 0);
+        mark_fixed_file(sqe);
         sqe->flags |= IOSQE_BUFFER_SELECT;
         sqe->buf_group = buf_group_id;
         sqe->ioprio |= IORING_RECV_MULTISHOT;
+#if defined(IORING_RECVSEND_BUNDLE)
+        // Buffer rings only: fill several buffers per CQE (kernel 6.10+)
+        if (bundle) sqe->ioprio |= IORING_RECVSEND_BUNDLE;
+#endif
         io_uring_sqe_set_data(sqe, user_data);
 
         multishot_active_ = true;
         return {};
 #else
-        (void)buf_group_id; (void)user_data;
+        (void)buf_group_id; (void)user_data; (void)bundle;
         return std::unexpected{TransportError{TransportErrorCode::SocketError, ENOTSUP}};
 #endif
     }
@@ -748,6 +1473,7 @@ public:
             return std::unexpected{TransportError{TransportErrorCode::SocketError}};
         }
 
+        release_fixed_file();   // The close below drops the last fd reference
         io_uring_prep_close(sqe, fd_);
         io_uring_sqe_set_data(sqe, user_data);
         state_ = ConnectionState::Disconnecting;
@@ -757,6 +1483,7 @@ public:
 
     /// Synchronous close (for cleanup)
     void close_sync() noexcept {
+        release_fixed_file();
         if (fd_ >= 0) {
             ::close(fd_);
             fd_ = -1;
@@ -802,18 +1529,71 @@ public:
     [[nodiscard]] ConnectionState state() const noexcept { return state_; }
     [[nodiscard]] int fd() const noexcept { return fd_; }
 
+    /// Fixed file slot SQEs target (-1 = plain fd)
+    [[nodiscard]] int fixed_file_slot() const noexcept { return fixed_slot_; }
+
 private:
+    /// What SQEs name: the fixed file slot, else the fd
+    [[nodiscard]] int target_fd() const noexcept {
+        return fixed_slot_ >= 0 ? fixed_slot_ : fd_;
+    }
+
+    /// Flag an SQE prepared with target_fd() as naming a fixed file
+    void mark_fixed_file(struct io_uring_sqe* sqe) const noexcept {
+        if (fixed_slot_ >= 0) sqe->flags |= IOSQE_FIXED_FILE;
+    }
+
+    void release_fixed_file() noexcept {
+        if (fixed_slot_ >= 0) {
+            ctx_.release_file_slot(fixed_slot_);
+            fixed_slot_ = -1;
+        }
+    }
+
     void apply_options() noexcept {
         set_nodelay(true);
         set_keepalive(true);
     }
 
+    /// Prepare one SQE tagged with `completion`; -EBUSY if the SQ is full
+    template <typename Prep>
+    [[nodiscard]] int prep(IoCompletion* completion, Prep&& prepare) noexcept {
+        auto sqe = ctx_.get_sqe();
+        if (!sqe) [[unlikely]] return -EBUSY;
+        prepare(sqe);
+        mark_fixed_file(sqe);
+        io_uring_sqe_set_data(sqe, completion);
+        return 0;
+    }
+
+    /// First of `count` SQEs, or nullptr if the SQ cannot take them all:
+    /// a linked pair must never be split across submissions
+    [[nodiscard]] struct io_uring_sqe* get_sqes(unsigned count) noexcept {
+        if (count > 1 && io_uring_sq_space_left(ctx_.ring()) < count) [[unlikely]] {
+            return nullptr;
+        }
+        return ctx_.get_sqe();
+    }
+
+    /// Link a relative deadline to the SQE just prepared
+    void link_deadline(struct io_uring_sqe* sqe,
+                       const struct __kernel_timespec* deadline,
+                       void* deadline_user_data) noexcept {
+        sqe->flags |= IOSQE_IO_LINK;
+        auto* timeout = ctx_.get_sqe();     // Space checked by get_sqes()
+        io_uring_prep_link_timeout(timeout, const_cast<struct __kernel_timespec*>(deadline), 0);
+        io_uring_sqe_set_data(timeout, deadline_user_data);
+    }
+
     IoUringContext& ctx_;
     int fd_;
+    int fixed_slot_{-1};
     ConnectionState state_;
     bool multishot_active_{false};
 };
 
+static_assert(AsyncByteStream<IoUringSocket>);
+
 // ============================================================================
 // io_uring Transport
 // ============================================================================
@@ -826,6 +1606,15 @@ struct IoUringTransportConfig {
     /// Enable multishot receive for ~30% syscall reduction (kernel 5.20+)
     bool use_multishot_recv{true};
 
+    /// Put the socket in the ring's fixed file table (IOSQE_FIXED_FILE),
+    /// sparing every SQE the fd lookup and file refcount (kernel 5.5+).
+    /// The table is registered by the first transport to connect; without
+    /// a free slot the socket is used by fd.
+    bool use_registered_files{true};
+
+    /// Slots in the fixed file table, shared by every session on the ring
+    unsigned registered_file_slots{IoUringContext::QUEUE_DEPTH};
+
     /// Number of registered buffers for send/recv
     size_t num_registered_buffers{64};
 
@@ -840,6 +1629,59 @@ struct IoUringTransportConfig {
 
     /// Buffer group ID for multishot receive
     uint16_t multishot_group_id{0};
+
+    /// Serve multishot receive from a provided buffer ring and let one CQE
+    /// cover several buffers (IORING_RECVSEND_BUNDLE, kernel 6.10+), so a
+    /// burst of small messages costs one completion; falls back to a
+    /// single buffer per CQE, then to PROVIDE_BUFFERS on older kernels
+    bool use_recv_bundle{true};
+
+    /// Consume ring buffers incrementally (IOU_PBUF_RING_INC, kernel
+    /// 6.12+): small messages pack into one buffer instead of taking a
+    /// whole buffer each. Replaces bundles when both are set.
+    bool incremental_recv_buffers{false};
+
+    /// Back registered and multishot buffers with prefaulted huge pages
+    bool huge_page_buffers{false};
+
+    /// NUMA node for registered and multishot buffers, normally the NIC's
+    /// (NumaTopology::nic(ifname).node); -1 = allocating thread's policy
+    int buffer_numa_node{-1};
+
+    /// Send from registered buffers with SEND_ZC, skipping the copy into
+    /// kernel socket buffers (kernel 6.0+, requires registered buffers).
+    /// Pays off for large payloads such as drop-copy ExecutionReport bursts.
+    bool use_zero_copy_send{false};
+
+    /// Sends smaller than this take the copying path; below a few KB the
+    /// notification round trip costs more than the copy it saves
+    size_t zero_copy_min_bytes{2048};
+
+    /// Deadline for every send, sync or async (0 = none). Enforced in the
+    /// kernel by a linked IORING_OP_LINK_TIMEOUT, so a counterparty whose
+    /// TCP window stays closed cannot hold the ring: the send is cancelled
+    /// and send() reports Timeout. Zero-copy sends are not bounded.
+    int send_timeout_ms{0};
+
+    /// Deadline expiries send_async() retries for the same bytes before it
+    /// gives up on the counterparty and disconnects
+    uint32_t send_timeout_retries{2};
+
+    /// Leave async_send()/send_async() SQEs queued until the next
+    /// poll_completions() (or IoUringContext::submit()), so one
+    /// io_uring_enter carries the sends of every session on the ring
+    bool defer_async_submit{false};
+
+    /// Receive timestamps (SO_TIMESTAMPING). When on, receive() issues
+    /// IORING_OP_RECVMSG to get the control message, in place of multishot
+    /// and fixed-buffer reads.
+    RxTimestampMode rx_timestamps{RxTimestampMode::Off};
+
+    /// The connect hook enables kernel TLS on the socket (KtlsSession,
+    /// ktls_transport.hpp). receive() then issues IORING_OP_RECVMSG so TLS
+    /// control records arrive with their type instead of failing the read
+    /// with EIO; sends are unchanged and the kernel encrypts them.
+    bool kernel_tls{false};
 };
 
 /// High-performance transport using io_uring
@@ -847,6 +1689,22 @@ class IoUringTransport : public ITransport {
 public:
     static constexpr size_t RECV_BUFFER_SIZE = 65536;
 
+    /// Bytes send_async() holds while earlier sends are in flight
+    static constexpr size_t ASYNC_SEND_BUFFER_SIZE = 262144;
+
+    /// async_send() calls awaiting their completion
+    static constexpr size_t MAX_SEND_TOKENS = 256;
+
+    /// Received bytes, in place (valid during the call only)
+    using ReceiveHandler = util::InlineFunction<void(std::span<const char>)>;
+
+    /// async_send() completion: its token and its size, or the error that
+    /// ended the connection
+    using SendHandler = util::InlineFunction<void(uint64_t, TransportResult<size_t>)>;
+
+    /// Runs on the connected socket's fd before any receive is posted
+    using ConnectHook = util::InlineFunction<TransportResult<void>(int)>;
+
     explicit IoUringTransport(IoUringContext& ctx) noexcept
         : ctx_{ctx}
         , socket_{ctx}
@@ -869,32 +1727,27 @@ public:
         std::string_view host,
         uint16_t port) override
     {
-        auto result = socket_.create();
-        if (!result) return result;
-
-        // Resolve address
-        struct addrinfo hints{};
-        hints.ai_family = AF_INET;
-        hints.ai_socktype = SOCK_STREAM;
-
-        char port_str[8];
-        std::snprintf(port_str, sizeof(port_str), "%u", port);
-
-        char host_buf[256];
-        size_t host_len = std::min(host.size(), sizeof(host_buf) - 1);
-        std::memcpy(host_buf, host.data(), host_len);
-        host_buf[host_len] = '\0';
-
-        struct addrinfo* addr_result = nullptr;
-        int ret = ::getaddrinfo(host_buf, port_str, &hints, &addr_result);
-        if (ret != 0) {
+        auto address = resolve_address(host, port);
+        if (!address) {
             return std::unexpected{TransportError{TransportErrorCode::AddressResolutionFailed}};
         }
+        return connect(*address);
+    }
 
-        // Submit async connect
-        result = socket_.submit_connect(addr_result->ai_addr, addr_result->ai_addrlen);
-        ::freeaddrinfo(addr_result);
+    /// Connect to an already resolved address (AddressCache): no
+    /// getaddrinfo on the reconnect path
+    [[nodiscard]] TransportResult<void> connect(const ResolvedAddress& address) noexcept {
+        quiesce_receive();
+        if (config_.use_registered_files) {
+            // Non-fatal: sockets are used by fd without a table
+            (void)ctx_.register_file_table(config_.registered_file_slots);
+        }
+        auto result = socket_.create(config_.use_registered_files);
+        if (!result) return result;
+        reset_async_send();
 
+        // Submit async connect
+        result = socket_.submit_connect(address.data(), address.size());
         if (!result) return result;
 
         // Submit and wait for connect
@@ -910,47 +1763,27 @@ public:
         if (connect_result < 0) {
             return std::unexpected{TransportError{TransportErrorCode::ConnectionFailed, -connect_result}};
         }
+        return start_connection();
+    }
 
-        // Initialize registered buffers for fixed I/O (~11% improvement)
-        if (config_.use_registered_buffers) {
-            if (!registered_pool_.init(ctx_,
-                                       config_.registered_buffer_size,
-                                       config_.num_registered_buffers)) {
-                // Non-fatal: fall back to regular buffers
-                use_fixed_buffers_ = false;
-            } else {
-                use_fixed_buffers_ = true;
-            }
-        }
-
-        // Initialize multishot receive buffers (~30% syscall reduction)
-        if (config_.use_multishot_recv) {
-            if (!multishot_buffers_.init(ctx_,
-                                         config_.multishot_group_id,
-                                         config_.multishot_buffer_size,
-                                         config_.num_multishot_buffers)) {
-                // Non-fatal: fall back to regular receive
-                use_multishot_ = false;
-            } else {
-                use_multishot_ = true;
-                // Start multishot receive
-                auto ms_result = socket_.submit_recv_multishot(
-                    multishot_buffers_.group_id(), this);
-                if (!ms_result) {
-                    use_multishot_ = false;
-                }
-            }
-        }
-
-        // Start async receive (fallback if multishot not enabled)
-        if (!use_multishot_) {
-            submit_recv();
+    /// Take over a connected socket (StandbyConnections::take(),
+    /// TcpAcceptor::accept()): the TCP handshake is already done, only the
+    /// connect hook and receive setup run
+    [[nodiscard]] TransportResult<void> adopt(int fd) noexcept {
+        quiesce_receive();
+        if (config_.use_registered_files) {
+            (void)ctx_.register_file_table(config_.registered_file_slots);
         }
-
-        return {};
+        socket_.adopt(fd, config_.use_registered_files);
+        reset_async_send();
+        return start_connection();
     }
 
+    /// Close the socket. Registered buffers, the multishot buffer group
+    /// and the fixed file table stay registered for the next connect() or
+    /// adopt(), which reuses them instead of registering again.
     void disconnect() override {
+        quiesce_receive();
         socket_.close_sync();
     }
 
@@ -963,7 +1796,32 @@ public:
             return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
         }
 
+        // Bytes from send_async() still queued go first
+        if (async_pending() > 0) [[unlikely]] {
+            return send_async(data);
+        }
+
         TransportResult<void> result;
+        const struct __kernel_timespec* deadline = arm_send_deadline(sync_deadline_);
+
+        // Zero-copy send for large payloads; buffers stay with the kernel
+        // until their notification CQE, so reap those when the pool runs dry
+        if (use_zero_copy_ && data.size() >= config_.zero_copy_min_bytes &&
+            data.size() <= registered_pool_.buffer_size()) {
+            int buf_idx = registered_pool_.acquire();
+            if (buf_idx < 0 && zc_in_flight_ > 0) {
+                poll();
+                buf_idx = registered_pool_.acquire();
+            }
+            if (buf_idx >= 0) {
+                auto zc_result = send_zero_copy(data, buf_idx);
+                if (zc_result || !is_zero_copy_unsupported(zc_result.error())) {
+                    return zc_result;
+                }
+                // Kernel or socket rejects SEND_ZC: stay on the copying path
+                use_zero_copy_ = false;
+            }
+        }
 
         // Use fixed buffer if available (~11% improvement)
         if (use_fixed_buffers_ && data.size() <= registered_pool_.buffer_size()) {
@@ -974,7 +1832,8 @@ public:
                 std::memcpy(buf, data.data(), data.size());
 
                 result = socket_.submit_write_fixed(
-                    static_cast<uint16_t>(buf_idx), data.size());
+                    static_cast<uint16_t>(buf_idx), data.size(), 0, sync_user_data(),
+                    deadline, deadline_user_data());
 
                 if (!result) {
                     registered_pool_.release(buf_idx);
@@ -984,36 +1843,28 @@ public:
                 ctx_.submit();
 
                 struct io_uring_cqe* cqe;
-                ctx_.wait(&cqe);
+                wait_completion(&cqe);
                 int send_result = cqe->res;
                 ctx_.seen(cqe);
 
                 registered_pool_.release(buf_idx);
-
-                if (send_result < 0) {
-                    return std::unexpected{TransportError{TransportErrorCode::WriteError, -send_result}};
-                }
-                return static_cast<size_t>(send_result);
+                return sync_send_result(send_result);
             }
             // Fall through to regular send if no buffer available
         }
 
         // Regular send (fallback or data too large)
-        result = socket_.submit_write(data);
+        result = socket_.submit_write(data, sync_user_data(), deadline, deadline_user_data());
         if (!result) return std::unexpected{result.error()};
 
         ctx_.submit();
 
         struct io_uring_cqe* cqe;
-        ctx_.wait(&cqe);
+        wait_completion(&cqe);
         int send_result = cqe->res;
         ctx_.seen(cqe);
 
-        if (send_result < 0) {
-            return std::unexpected{TransportError{TransportErrorCode::WriteError, -send_result}};
-        }
-
-        return static_cast<size_t>(send_result);
+        return sync_send_result(send_result);
     }
 
     [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) override {
@@ -1026,6 +1877,10 @@ public:
             return recv_buffer_.read(buffer);
         }
 
+        if (rx_recvmsg_) {
+            return receive_with_control(buffer);
+        }
+
         // Multishot receive: data comes via poll(), just wait for completion
         if (use_multishot_) {
             // Process pending completions and check buffer again
@@ -1045,12 +1900,31 @@ public:
             return std::unexpected{TransportError{TransportErrorCode::Timeout}};
         }
 
+        // A receive pre-posted by submit_recv() lands in recv_buffer_: wait
+        // for it rather than racing it with a second read on the socket
+        if (recv_pending_) {
+            struct io_uring_cqe* cqe;
+            while (recv_pending_ && ctx_.wait(&cqe) == 0) {
+                process_cqe(cqe);
+                ctx_.seen(cqe);
+            }
+            if (!recv_buffer_.empty()) {
+                return recv_buffer_.read(buffer);
+            }
+        }
+        if (last_recv_result_ <= 0) {
+            if (last_recv_result_ == 0) {
+                return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+            }
+            return std::unexpected{TransportError{TransportErrorCode::ReadError, -last_recv_result_}};
+        }
+
         // Use fixed buffer for receive if available (~11% improvement)
         if (use_fixed_buffers_ && buffer.size() <= registered_pool_.buffer_size()) {
             int buf_idx = registered_pool_.acquire();
             if (buf_idx >= 0) {
                 auto result = socket_.submit_read_fixed(
-                    static_cast<uint16_t>(buf_idx), buffer.size());
+                    static_cast<uint16_t>(buf_idx), buffer.size(), 0, sync_user_data());
 
                 if (!result) {
                     registered_pool_.release(buf_idx);
@@ -1060,7 +1934,7 @@ public:
                 ctx_.submit();
 
                 struct io_uring_cqe* cqe;
-                ctx_.wait(&cqe);
+                wait_completion(&cqe);
                 int recv_result = cqe->res;
                 ctx_.seen(cqe);
 
@@ -1083,13 +1957,13 @@ public:
         }
 
         // Regular receive (fallback)
-        auto result = socket_.submit_read(buffer);
+        auto result = socket_.submit_read(buffer, sync_user_data());
         if (!result) return std::unexpected{result.error()};
 
         ctx_.submit();
 
         struct io_uring_cqe* cqe;
-        ctx_.wait(&cqe);
+        wait_completion(&cqe);
         int recv_result = cqe->res;
         ctx_.seen(cqe);
 
@@ -1118,11 +1992,114 @@ public:
         return true;
     }
 
-    bool set_send_timeout(int /*milliseconds*/) override {
-        // io_uring uses async operations, timeout handled differently
+    /// Bound each send by a kernel-side deadline (0 = none)
+    bool set_send_timeout(int milliseconds) override {
+        config_.send_timeout_ms = milliseconds > 0 ? milliseconds : 0;
         return true;
     }
 
+    // ========================================================================
+    // Asynchronous Send
+    // ========================================================================
+
+    /// Queue bytes and return without waiting for the socket. One send is
+    /// in flight at a time, each under the send_timeout_ms deadline;
+    /// completions reaped by poll() (or any wait in send()/receive())
+    /// resubmit the remainder of short writes, retry sends that hit the
+    /// deadline and disconnect after send_timeout_retries expiries in a
+    /// row, so a stalled counterparty costs no thread time.
+    /// @return Bytes queued (all of data); NoBufferSpace if the pending
+    ///         bytes would exceed ASYNC_SEND_BUFFER_SIZE, Timeout if an
+    ///         earlier send gave up and closed the connection
+    [[nodiscard]] TransportResult<size_t> send_async(std::span<const char> data) noexcept {
+        if (!is_connected()) {
+            return std::unexpected{TransportError{async_error_ != TransportErrorCode::None
+                ? async_error_ : TransportErrorCode::ConnectionClosed}};
+        }
+        if (!async_) {
+            async_.reset(new (std::nothrow) AsyncSendState);
+            if (!async_) {
+                return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+            }
+        }
+        if (data.size() > async_->pending.available()) [[unlikely]] {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+        }
+        (void)async_->pending.write(data);
+        async_->queued_total += data.size();
+        submit_async_send();
+        return data.size();
+    }
+
+    /// Queue a message like send_async(); the send handler gets
+    /// (token, data.size()) once all of it has been sent, or the error
+    /// that closed the connection
+    [[nodiscard]] TransportResult<void> async_send(std::span<const char> data,
+                                                   uint64_t token) noexcept {
+        if (async_ && async_->tokens_size == MAX_SEND_TOKENS) [[unlikely]] {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+        }
+        auto queued = send_async(data);
+        if (!queued) return std::unexpected{queued.error()};
+
+        AsyncSendState& state = *async_;
+        state.tokens[(state.tokens_head + state.tokens_size) % MAX_SEND_TOKENS] =
+            SendToken{state.queued_total, data.size(), token};
+        ++state.tokens_size;
+        return {};
+    }
+
+    /// Handler for async_send() completions, run from poll_completions()
+    void on_send_complete(SendHandler handler) noexcept {
+        send_handler_ = std::move(handler);
+    }
+
+    /// Deliver received bytes to handler as they complete instead of
+    /// buffering them for receive(). Multishot completions are handed over
+    /// straight from the provided buffer, without a copy.
+    void on_receive(ReceiveHandler handler) noexcept {
+        receive_handler_ = std::move(handler);
+    }
+
+    /// Hook run by connect() once the TCP connection is up and before the
+    /// first receive is posted, e.g. a TLS handshake that hands the record
+    /// layer to the kernel (see KtlsSession and config.kernel_tls). If it
+    /// fails the socket is closed and connect() returns its error.
+    void on_connect(ConnectHook hook) noexcept {
+        connect_hook_ = std::move(hook);
+    }
+
+    /// Submit queued SQEs, then process up to budget ready completions
+    /// without waiting: received bytes go to the receive handler, finished
+    /// async_send() calls to the send handler
+    /// @return Completions processed
+    size_t poll_completions(size_t budget = std::numeric_limits<size_t>::max()) noexcept {
+        if (config_.defer_async_submit) {
+            ctx_.submit();
+        }
+        deliver_received();
+
+        struct io_uring_cqe* cqe;
+        size_t processed = 0;
+        while (processed < budget && ctx_.peek(&cqe) == 0) {
+            process_cqe(cqe);
+            ctx_.seen(cqe);
+            ++processed;
+        }
+        return processed;
+    }
+
+    /// Bytes queued by send_async() not yet acknowledged by a send CQE
+    [[nodiscard]] size_t async_pending() const noexcept {
+        return async_ ? async_->pending.size() : 0;
+    }
+
+    /// Sends cancelled by their deadline (sync and async)
+    [[nodiscard]] uint64_t send_timeouts() const noexcept { return send_timeouts_; }
+
+    /// Why send_async() closed the connection (None while it has not)
+    [[nodiscard]] TransportErrorCode async_send_error() const noexcept { return async_error_; }
+
     /// Process pending completions (non-blocking)
     int poll() noexcept {
         struct io_uring_cqe* cqe;
@@ -1137,6 +2114,21 @@ public:
         return processed;
     }
 
+    /// Bytes already received (completions reaped by poll() or during a
+    /// send) that receive() returns without waiting
+    [[nodiscard]] size_t buffered() const noexcept {
+        return recv_buffer_.size();
+    }
+
+    [[nodiscard]] RxTimestamp last_rx_timestamp() const noexcept override {
+        return last_rx_ts_;
+    }
+
+    /// Check if receives carry SO_TIMESTAMPING timestamps
+    [[nodiscard]] bool uses_rx_timestamps() const noexcept {
+        return rx_timestamping_;
+    }
+
     /// Check if using registered buffers
     [[nodiscard]] bool uses_fixed_buffers() const noexcept {
         return use_fixed_buffers_;
@@ -1147,55 +2139,358 @@ public:
         return use_multishot_;
     }
 
+    /// Buffer registrations (fixed buffers, multishot group) a connect()
+    /// or adopt() reused from an earlier connection instead of registering
+    [[nodiscard]] uint64_t reused_registrations() const noexcept {
+        return reused_registrations_;
+    }
+
+    /// Check if using zero-copy send
+    [[nodiscard]] bool uses_zero_copy_send() const noexcept {
+        return use_zero_copy_;
+    }
+
+    /// Zero-copy sends whose buffer is still referenced by the kernel
+    [[nodiscard]] size_t zero_copy_in_flight() const noexcept {
+        return zc_in_flight_;
+    }
+
     /// Get current configuration
     [[nodiscard]] const IoUringTransportConfig& config() const noexcept {
         return config_;
     }
 
 private:
+    /// Longest disconnect() waits for the old connection's receive to end
+    static constexpr int QUIESCE_TIMEOUT_MS = 100;
+
+    /// Everything after the TCP handshake: connect hook, buffers, receive.
+    /// Registrations made by an earlier connection are reused; only the
+    /// first connect registers buffers with the kernel.
+    [[nodiscard]] TransportResult<void> start_connection() noexcept {
+        recv_buffer_.clear();
+        recv_pending_ = false;
+        multishot_armed_ = false;
+
+        if (connect_hook_) {
+            if (auto hooked = connect_hook_(socket_.fd()); !hooked) {
+                socket_.close_sync();
+                return hooked;
+            }
+        }
+
+        // Initialize registered buffers for fixed I/O (~11% improvement)
+        if (config_.use_registered_buffers) {
+            if (registered_pool_.is_initialized()) {
+                ++reused_registrations_;
+                use_fixed_buffers_ = true;
+            } else {
+                // Non-fatal: fall back to regular buffers
+                use_fixed_buffers_ = registered_pool_.init(ctx_,
+                                                           config_.registered_buffer_size,
+                                                           config_.num_registered_buffers,
+                                                           config_.huge_page_buffers,
+                                                           config_.buffer_numa_node);
+            }
+        }
+
+        // Zero-copy send rides on the registered pool; kernel support is
+        // confirmed by the first send, which falls back if it is rejected
+#if defined(IORING_CQE_F_NOTIF)
+        use_zero_copy_ = config_.use_zero_copy_send && use_fixed_buffers_;
+#endif
+
+        // Timestamped and kernel TLS receives go through recvmsg; no
+        // pre-posted reads
+        rx_timestamping_ = false;
+        if (config_.rx_timestamps != RxTimestampMode::Off) {
+            rx_timestamping_ = enable_rx_timestamping(socket_.fd(), config_.rx_timestamps);
+        }
+        rx_recvmsg_ = rx_timestamping_ || config_.kernel_tls;
+
+        // Initialize multishot receive buffers (~30% syscall reduction)
+        use_multishot_ = false;
+        if (config_.use_multishot_recv && !rx_recvmsg_) {
+            if (multishot_buffers_.is_initialized()) {
+                ++reused_registrations_;
+                use_multishot_ = true;
+            } else {
+                const bool ring = (config_.use_recv_bundle || config_.incremental_recv_buffers) &&
+                    multishot_buffers_.init_ring(ctx_,
+                                                 config_.multishot_group_id,
+                                                 config_.multishot_buffer_size,
+                                                 config_.num_multishot_buffers,
+                                                 config_.huge_page_buffers,
+                                                 config_.buffer_numa_node,
+                                                 config_.incremental_recv_buffers);
+                recv_bundle_ = ring && config_.use_recv_bundle && !multishot_buffers_.is_incremental();
+                // Non-fatal: fall back to regular receive
+                use_multishot_ = ring || multishot_buffers_.init(ctx_,
+                                                                 config_.multishot_group_id,
+                                                                 config_.multishot_buffer_size,
+                                                                 config_.num_multishot_buffers,
+                                                                 config_.huge_page_buffers,
+                                                                 config_.buffer_numa_node);
+            }
+            if (use_multishot_) {
+                // Start multishot receive
+                auto ms_result = socket_.submit_recv_multishot(
+                    multishot_buffers_.group_id(), this, recv_bundle_);
+                use_multishot_ = ms_result.has_value();
+                multishot_armed_ = use_multishot_;
+            }
+        }
+
+        // Start async receive (fallback if multishot not enabled)
+        last_recv_result_ = 1;
+        if (!use_multishot_) {
+            submit_recv();
+        }
+
+        return {};
+    }
+
+    /// End the receive still posted on the closing connection before its
+    /// buffers serve the next one: shut the socket down so the multishot
+    /// (or pre-posted) recv completes, and reap until it has. Bytes still
+    /// arriving are dropped with the connection.
+    void quiesce_receive() noexcept {
+        if (socket_.fd() < 0 || (!multishot_armed_ && !recv_pending_)) return;
+        (void)::shutdown(socket_.fd(), SHUT_RDWR);
+
+        ReceiveHandler handler = std::move(receive_handler_);
+        receive_handler_.reset();
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::milliseconds{QUIESCE_TIMEOUT_MS};
+        struct io_uring_cqe* cqe;
+        while ((multishot_armed_ || recv_pending_) &&
+               std::chrono::steady_clock::now() < deadline) {
+            if (ctx_.wait(&cqe, 1) != 0) continue;
+            process_cqe(cqe);
+            ctx_.seen(cqe);
+        }
+        receive_handler_ = std::move(handler);
+        recv_buffer_.clear();
+    }
+
     /// Process a single completion queue entry
     void process_cqe(struct io_uring_cqe* cqe) noexcept {
         int result = cqe->res;
 
+        // Linked deadline CQEs: -ETIME when it fired (the send's own CQE
+        // reports the cancellation), -ECANCELED when the send beat it
+        if (io_uring_cqe_get_data(cqe) == deadline_user_data()) {
+            return;
+        }
+        if (async_ && io_uring_cqe_get_data(cqe) == async_.get()) {
+            on_async_send_complete(result);
+            return;
+        }
+        if (retired_async_ && io_uring_cqe_get_data(cqe) == retired_async_.get()) {
+            retired_async_.reset();     // Previous connection's send finished
+            return;
+        }
+
+        // Zero-copy send: the buffer returns to the pool on its notification,
+        // or on the result CQE when no notification follows (failed send)
+        if (int buf_idx = zc_buffer_index(io_uring_cqe_get_data(cqe)); buf_idx >= 0) {
+            if (IoUringSocket::is_send_zc_notification(cqe->flags) ||
+                !ProvidedBufferGroup::has_more(cqe->flags)) {
+                registered_pool_.release(buf_idx);
+                --zc_in_flight_;
+            }
+            return;
+        }
+
         // Handle multishot receive completion
-        if (use_multishot_ && ProvidedBufferGroup::has_buffer(cqe->flags)) {
+        if (use_multishot_ && (ProvidedBufferGroup::has_buffer(cqe->flags) ||
+                               io_uring_cqe_get_data(cqe) == this)) {
             if (result > 0) {
-                // Extract buffer ID and copy data to recv_buffer_
-                uint16_t buf_id = ProvidedBufferGroup::buffer_id_from_cqe(cqe->flags);
-                char* data = multishot_buffers_.buffer(buf_id);
-                if (data) {
-                    auto write_span = recv_buffer_.write_span();
-                    size_t to_copy = std::min(static_cast<size_t>(result), write_span.size());
-                    if (to_copy > 0) {
-                        std::memcpy(write_span.data(), data, to_copy);
-                        recv_buffer_.commit_write(to_copy);
-                    }
-                }
-                // Replenish buffer for reuse
-                (void)multishot_buffers_.replenish(buf_id);
+                if (receive_handler_) deliver_received();   // Keep earlier buffered bytes first
+                // Hand over each buffer the CQE filled (several for a bundle)
+                // and give them back to the group
+                (void)multishot_buffers_.consume(result, cqe->flags,
+                    [this](std::span<const char> data) noexcept {
+                        if (receive_handler_) {
+                            receive_handler_(data);
+                            return;
+                        }
+                        auto write_span = recv_buffer_.write_span();
+                        size_t to_copy = std::min(data.size(), write_span.size());
+                        if (to_copy > 0) {
+                            std::memcpy(write_span.data(), data.data(), to_copy);
+                            recv_buffer_.commit_write(to_copy);
+                        }
+                    });
+            }
+            const bool bundle_refused = result == -EINVAL && recv_bundle_;
+            if (bundle_refused) {
+                recv_bundle_ = false;   // Kernel predates bundles
             }
 
             // Check if multishot is still active
             if (!ProvidedBufferGroup::has_more(cqe->flags)) {
-                // Multishot terminated - restart if still connected
-                if (socket_.is_connected()) {
-                    (void)socket_.submit_recv_multishot(multishot_buffers_.group_id(), this);
+                multishot_armed_ = false;
+                // Multishot terminated - restart if still connected and it
+                // stopped for want of buffers rather than a socket error
+                if (socket_.is_connected() &&
+                    (result > 0 || result == -ENOBUFS || bundle_refused)) {
+                    multishot_armed_ = socket_.submit_recv_multishot(
+                        multishot_buffers_.group_id(), this, recv_bundle_).has_value();
                     ctx_.submit();
                 }
             }
             return;
         }
 
-        // Handle regular receive completion
-        if (recv_pending_ && result > 0) {
+        // Handle the pre-posted receive; with registered buffers the data
+        // is in the fixed buffer and is copied into recv_buffer_ here
+        if (io_uring_cqe_get_data(cqe) == recv_user_data()) {
             recv_pending_ = false;
-            recv_buffer_.commit_write(static_cast<size_t>(result));
-            submit_recv();
+            last_recv_result_ = result;
+            if (recv_buf_idx_ >= 0) {
+                if (result > 0) {
+                    std::memcpy(recv_buffer_.write_span().data(),
+                                registered_pool_.buffer(recv_buf_idx_),
+                                static_cast<size_t>(result));
+                }
+                registered_pool_.release(recv_buf_idx_);
+                recv_buf_idx_ = -1;
+            }
+            if (result > 0) {
+                recv_buffer_.commit_write(static_cast<size_t>(result));
+                deliver_received();
+                submit_recv();
+            }
+        }
+    }
+
+    /// Hand buffered bytes to the receive handler, if one is set
+    void deliver_received() noexcept {
+        if (!receive_handler_ || recv_buffer_.empty()) return;
+        const auto segments = recv_buffer_.read_segments();
+        receive_handler_(segments.first);
+        if (!segments.second.empty()) receive_handler_(segments.second);
+        recv_buffer_.clear();
+    }
+
+    // ========================================================================
+    // Send Deadlines
+    // ========================================================================
+
+    /// Fill ts from send_timeout_ms; nullptr when sends are unbounded
+    [[nodiscard]] const struct __kernel_timespec* arm_send_deadline(
+        struct __kernel_timespec& ts) const noexcept
+    {
+        if (config_.send_timeout_ms <= 0) return nullptr;
+        ts.tv_sec = config_.send_timeout_ms / 1000;
+        ts.tv_nsec = static_cast<long long>(config_.send_timeout_ms % 1000) * 1'000'000LL;
+        return &ts;
+    }
+
+    /// A send cancelled by its deadline completes with -ECANCELED (or
+    /// -EINTR when interrupted after the timer fired)
+    [[nodiscard]] static bool is_deadline_expiry(int result) noexcept {
+        return result == -ECANCELED || result == -EINTR;
+    }
+
+    [[nodiscard]] TransportResult<size_t> sync_send_result(int send_result) noexcept {
+        if (send_result >= 0) return static_cast<size_t>(send_result);
+        if (is_deadline_expiry(send_result)) {
+            ++send_timeouts_;
+            return std::unexpected{TransportError{TransportErrorCode::Timeout, -send_result}};
+        }
+        return std::unexpected{TransportError{TransportErrorCode::WriteError, -send_result}};
+    }
+
+    /// Put the next contiguous run of queued bytes in flight
+    void submit_async_send() noexcept {
+        AsyncSendState& state = *async_;
+        if (state.in_flight > 0 || state.pending.empty() || !is_connected()) return;
+
+        const auto run = state.pending.read_span();
+        auto result = socket_.submit_write(run, async_.get(),
+                                           arm_send_deadline(state.deadline),
+                                           deadline_user_data());
+        if (!result) return;    // SQ full: the next completion or send_async() retries
+        state.in_flight = run.size();
+        if (!config_.defer_async_submit) {
+            ctx_.submit();
+        }
+    }
+
+    void on_async_send_complete(int result) noexcept {
+        AsyncSendState& state = *async_;
+        state.in_flight = 0;
+
+        if (result > 0) {
+            state.pending.skip(static_cast<size_t>(result));
+            state.expiries = 0;
+            state.sent_total += static_cast<size_t>(result);
+            complete_send_tokens();
+        } else if (result == 0 || is_deadline_expiry(result)) {
+            ++send_timeouts_;
+            if (++state.expiries > config_.send_timeout_retries) {
+                fail_async_send(TransportErrorCode::Timeout);
+                return;
+            }
+        } else {
+            fail_async_send(result == -EPIPE || result == -ECONNRESET
+                ? TransportErrorCode::ConnectionReset : TransportErrorCode::WriteError);
+            return;
+        }
+        submit_async_send();
+    }
+
+    /// Start a connection with nothing queued; a send still in flight from
+    /// the previous one keeps its buffer until its CQE arrives
+    void reset_async_send() noexcept {
+        async_error_ = TransportErrorCode::None;
+        if (!async_) return;
+        fail_send_tokens(TransportErrorCode::ConnectionClosed);
+        if (async_->in_flight > 0) {
+            retired_async_ = std::move(async_);
+            return;
+        }
+        async_->pending.clear();
+        async_->expiries = 0;
+    }
+
+    /// Report async_send() calls whose bytes have all been sent
+    void complete_send_tokens() noexcept {
+        AsyncSendState& state = *async_;
+        while (state.tokens_size > 0) {
+            const SendToken done = state.tokens[state.tokens_head];
+            if (done.end > state.sent_total) break;
+            state.tokens_head = (state.tokens_head + 1) % MAX_SEND_TOKENS;
+            --state.tokens_size;
+            if (send_handler_) send_handler_(done.token, done.length);
         }
     }
 
+    /// Report every outstanding async_send() call as failed
+    void fail_send_tokens(TransportErrorCode code) noexcept {
+        AsyncSendState& state = *async_;
+        while (state.tokens_size > 0) {
+            const SendToken done = state.tokens[state.tokens_head];
+            state.tokens_head = (state.tokens_head + 1) % MAX_SEND_TOKENS;
+            --state.tokens_size;
+            if (send_handler_) send_handler_(done.token, std::unexpected{TransportError{code}});
+        }
+        state.queued_total = state.sent_total = 0;
+    }
+
+    /// Give up on the counterparty: drop queued bytes and disconnect
+    void fail_async_send(TransportErrorCode code) noexcept {
+        async_error_ = code;
+        async_->pending.clear();
+        async_->expiries = 0;
+        socket_.close_sync();
+        fail_send_tokens(code);
+    }
+
     void submit_recv() noexcept {
-        if (recv_pending_ || use_multishot_) return;
+        if (recv_pending_ || use_multishot_ || rx_recvmsg_) return;
 
         auto span = recv_buffer_.write_span();
         if (span.empty()) return;
@@ -1205,7 +2500,8 @@ private:
             recv_buf_idx_ = registered_pool_.acquire();
             if (recv_buf_idx_ >= 0) {
                 size_t len = std::min(span.size(), registered_pool_.buffer_size());
-                (void)socket_.submit_read_fixed(static_cast<uint16_t>(recv_buf_idx_), len);
+                (void)socket_.submit_read_fixed(static_cast<uint16_t>(recv_buf_idx_), len,
+                                                0, recv_user_data());
                 ctx_.submit();
                 recv_pending_ = true;
                 return;
@@ -1213,15 +2509,166 @@ private:
         }
 
         // Fallback to regular receive
-        (void)socket_.submit_read(span);
+        (void)socket_.submit_read(span, recv_user_data());
         ctx_.submit();
         recv_pending_ = true;
     }
 
+    /// IORING_OP_RECVMSG into the caller's buffer, keeping the timestamp and
+    /// consuming TLS control records
+    [[nodiscard]] TransportResult<size_t> receive_with_control(std::span<char> buffer) noexcept {
+        for (;;) {
+            rx_iov_.iov_base = buffer.data();
+            rx_iov_.iov_len = buffer.size();
+            rx_msg_ = msghdr{};
+            rx_msg_.msg_iov = &rx_iov_;
+            rx_msg_.msg_iovlen = 1;
+            rx_msg_.msg_control = rx_control_;
+            rx_msg_.msg_controllen = sizeof(rx_control_);
+
+            auto result = socket_.submit_recvmsg(&rx_msg_, sync_user_data());
+            if (!result) return std::unexpected{result.error()};
+
+            ctx_.submit();
+
+            struct io_uring_cqe* cqe;
+            if (int ret = wait_completion(&cqe); ret < 0) {
+                return std::unexpected{TransportError{TransportErrorCode::ReadError, -ret}};
+            }
+            int recv_result = cqe->res;
+            ctx_.seen(cqe);
+
+            if (recv_result <= 0) {
+                if (recv_result == 0) {
+                    return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+                }
+                return std::unexpected{TransportError{TransportErrorCode::ReadError, -recv_result}};
+            }
+
+            // Control records other than session tickets end the connection
+            if (config_.kernel_tls) {
+                switch (tls_record_action(rx_msg_, buffer.first(static_cast<size_t>(recv_result)))) {
+                    case TlsRecordAction::Deliver:
+                        break;
+                    case TlsRecordAction::Skip:
+                        continue;
+                    case TlsRecordAction::Close:
+                        return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+                    case TlsRecordAction::Fail:
+                        return std::unexpected{TransportError{TransportErrorCode::TlsError, EPROTO}};
+                }
+            }
+            if (rx_timestamping_) {
+                last_rx_ts_ = extract_rx_timestamp(rx_msg_);
+            }
+            return static_cast<size_t>(recv_result);
+        }
+    }
+
+    // ========================================================================
+    // Zero-copy Send
+    // ========================================================================
+    // Both CQEs of a SEND_ZC carry the buffer index, tagged in the top bit of
+    // user_data. A buffer is reused only after its notification, so a tag
+    // identifies a single send at any time.
+
+    static constexpr uintptr_t ZC_SEND_TAG = uintptr_t{1} << (sizeof(uintptr_t) * 8 - 1);
+
+    [[nodiscard]] static void* zc_user_data(int buf_idx) noexcept {
+        return reinterpret_cast<void*>(ZC_SEND_TAG | static_cast<uintptr_t>(buf_idx));
+    }
+
+    /// Buffer index of a zero-copy send CQE, or -1 for other completions
+    [[nodiscard]] static int zc_buffer_index(void* user_data) noexcept {
+        const auto bits = reinterpret_cast<uintptr_t>(user_data);
+        if ((bits & ZC_SEND_TAG) == 0) return -1;
+        return static_cast<int>(bits & ~ZC_SEND_TAG);
+    }
+
+    // Synchronous operations (send, direct reads) and the pre-posted
+    // receive carry fixed user_data values; multishot receives carry `this`
+
+    [[nodiscard]] static void* sync_user_data() noexcept {
+        return reinterpret_cast<void*>(uintptr_t{1});
+    }
+
+    [[nodiscard]] static void* recv_user_data() noexcept {
+        return reinterpret_cast<void*>(uintptr_t{2});
+    }
+
+    /// Linked send deadlines; asynchronous sends carry their state's address
+    [[nodiscard]] static void* deadline_user_data() noexcept {
+        return reinterpret_cast<void*>(uintptr_t{3});
+    }
+
+    /// Wait for the completion of the synchronous operation in flight.
+    /// Receive completions and zero-copy notifications that arrive first
+    /// are processed on the way, so incoming data is buffered, not lost.
+    int wait_completion(struct io_uring_cqe** cqe) noexcept {
+        for (;;) {
+            int ret = ctx_.wait(cqe);
+            if (ret < 0 || io_uring_cqe_get_data(*cqe) == sync_user_data()) {
+                return ret;
+            }
+            process_cqe(*cqe);
+            ctx_.seen(*cqe);
+        }
+    }
+
+    [[nodiscard]] static bool is_zero_copy_unsupported(const TransportError& err) noexcept {
+        return err.system_errno == EINVAL || err.system_errno == EOPNOTSUPP ||
+               err.system_errno == ENOTSUP;
+    }
+
+    /// Copy into a registered buffer and send it with SEND_ZC
+    /// Returns once the send result is known; the buffer is released later
+    /// by process_cqe() when its notification arrives.
+    [[nodiscard]] TransportResult<size_t> send_zero_copy(
+        std::span<const char> data,
+        int buf_idx) noexcept
+    {
+        char* buf = registered_pool_.buffer(buf_idx);
+        std::memcpy(buf, data.data(), data.size());
+
+        void* tag = zc_user_data(buf_idx);
+        auto result = socket_.submit_send_zc_fixed(
+            static_cast<uint16_t>(buf_idx), {buf, data.size()}, tag);
+        if (!result) {
+            registered_pool_.release(buf_idx);
+            return std::unexpected{result.error()};
+        }
+
+        ++zc_in_flight_;
+        ctx_.submit();
+
+        // Earlier notifications and receive completions may arrive first
+        for (;;) {
+            struct io_uring_cqe* cqe;
+            int ret = ctx_.wait(&cqe);
+            if (ret < 0) {
+                // Buffer stays in flight; its CQEs are reaped by poll()
+                return std::unexpected{TransportError{TransportErrorCode::WriteError, -ret}};
+            }
+
+            const bool is_result = io_uring_cqe_get_data(cqe) == tag &&
+                                   !IoUringSocket::is_send_zc_notification(cqe->flags);
+            const int send_result = cqe->res;
+            process_cqe(cqe);
+            ctx_.seen(cqe);
+
+            if (!is_result) continue;
+            if (send_result < 0) {
+                return std::unexpected{TransportError{TransportErrorCode::WriteError, -send_result}};
+            }
+            return static_cast<size_t>(send_result);
+        }
+    }
+
     IoUringContext& ctx_;
     IoUringSocket socket_;
     RingBuffer<RECV_BUFFER_SIZE> recv_buffer_;
     bool recv_pending_;
+    int last_recv_result_{1};  // Pre-posted receive result (<= 0: closed / failed)
 
     // Configuration
     IoUringTransportConfig config_;
@@ -1232,9 +2679,51 @@ private:
     int send_buf_idx_;  // Currently acquired send buffer
     int recv_buf_idx_;  // Currently acquired recv buffer
 
+    // Zero-copy send (buffers from registered_pool_)
+    bool use_zero_copy_{false};
+    size_t zc_in_flight_{0};  // Sends awaiting their notification CQE
+
+    // Send deadlines and send_async() (state allocated on first use)
+    struct SendToken {
+        uint64_t end;       // queued_total once this message was queued
+        size_t length;
+        uint64_t token;
+    };
+    struct AsyncSendState {
+        RingBuffer<ASYNC_SEND_BUFFER_SIZE> pending;  // Queued, not yet sent
+        size_t in_flight{0};                 // Bytes of the outstanding send
+        uint32_t expiries{0};                // Deadline expiries in a row
+        struct __kernel_timespec deadline{}; // Read by the kernel at submit
+        uint64_t queued_total{0};            // Bytes ever queued
+        uint64_t sent_total{0};              // Bytes confirmed by send CQEs
+        std::array<SendToken, MAX_SEND_TOKENS> tokens{};  // FIFO of async_send() calls
+        size_t tokens_head{0};
+        size_t tokens_size{0};
+    };
+    ReceiveHandler receive_handler_;
+    ConnectHook connect_hook_;
+    SendHandler send_handler_;
+    std::unique_ptr<AsyncSendState> async_;
+    std::unique_ptr<AsyncSendState> retired_async_;  // In flight across a reconnect
+    struct __kernel_timespec sync_deadline_{};
+    uint64_t send_timeouts_{0};
+    TransportErrorCode async_error_{TransportErrorCode::None};
+
     // Multishot receive buffers
     ProvidedBufferGroup multishot_buffers_;
     bool use_multishot_{false};
+    bool recv_bundle_{false};
+    bool multishot_armed_{false};       // A multishot recv is posted (until its final CQE)
+    uint64_t reused_registrations_{0};  // Buffer registrations kept across reconnects
+
+    // Timestamped / kernel TLS receive (recvmsg state lives here until the
+    // CQE is reaped)
+    bool rx_timestamping_{false};
+    bool rx_recvmsg_{false};
+    struct msghdr rx_msg_{};
+    struct iovec rx_iov_{};
+    alignas(struct cmsghdr) char rx_control_[RX_TIMESTAMP_CONTROL_SIZE + TLS_RECORD_CONTROL_SIZE]{};
+    RxTimestamp last_rx_ts_{};
 };
 
 #else  // !NFX_IO_URING_AVAILABLE
@@ -1255,6 +2744,12 @@ public:
     [[nodiscard]] TransportResult<void> connect(std::string_view, uint16_t) override {
         return std::unexpected{TransportError{TransportErrorCode::SocketError}};
     }
+    [[nodiscard]] TransportResult<void> connect(const ResolvedAddress&) noexcept {
+        return std::unexpected{TransportError{TransportErrorCode::SocketError}};
+    }
+    [[nodiscard]] TransportResult<void> adopt(int) noexcept {
+        return std::unexpected{TransportError{TransportErrorCode::SocketError}};
+    }
     void disconnect() override {}
     [[nodiscard]] bool is_connected() const override { return false; }
     [[nodiscard]] TransportResult<size_t> send(std::span<const char>) override {
@@ -0,0 +1,634 @@
+#pragma once
+
+/// @file iocp_transport.hpp
+/// @brief Windows Registered I/O (RIO) transport with an IOCP fallback
+///
+/// IocpTransport keeps several receives and sends in flight over one block of
+/// pre-allocated buffers, split into fixed-size slots:
+/// - RIO (Windows 8+): the block is registered once (RIORegisterBuffer), so
+///   posting a receive or send does no buffer probing or locking in the
+///   kernel. Completions are dequeued from a polled completion queue in
+///   batches; when a short spin finds nothing, the queue is armed with
+///   RIONotify() and the thread sleeps on an I/O completion port.
+/// - IOCP: if the RIO extension table cannot be loaded, the same slots are
+///   posted with overlapped WSARecv/WSASend and reaped in batches with
+///   GetQueuedCompletionStatusEx().
+///
+/// receive() copies from completed receive slots in posting order and
+/// re-posts a slot once drained. send() copies into free send slots; with RIO
+/// all chunks of one call are posted with RIO_MSG_DEFER and committed once.
+/// All calls come from the session thread; nothing here locks.
+
+#include "nexusfix/platform/platform.hpp"
+
+#if NFX_PLATFORM_WINDOWS
+
+#include "nexusfix/platform/socket_types.hpp"
+#include "nexusfix/platform/error_mapping.hpp"
+#include "nexusfix/transport/socket.hpp"
+#include "nexusfix/transport/winsock_init.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace nfx {
+
+// ============================================================================
+// IOCP / RIO Configuration
+// ============================================================================
+
+/// Configuration for IocpTransport
+struct IocpConfig {
+    uint32_t recv_slots{16};            // Receives kept in flight
+    uint32_t send_slots{16};            // Sends in flight before send() waits
+    uint32_t slot_size{16384};          // Bytes per slot
+    bool use_rio{true};                 // Registered I/O; false forces IOCP
+    uint32_t spin_polls{4096};          // Completion queue polls before sleeping
+    int recv_timeout_ms{30000};         // receive() wait bound, 0 = no wait
+    int send_timeout_ms{30000};         // send() wait for a free slot
+    bool tcp_nodelay{true};
+    bool keep_alive{true};
+};
+
+/// Completion mechanism an IocpTransport ended up with
+enum class IocpBackend : uint8_t {
+    None,   // Not connected
+    Rio,    // Registered I/O, polled completion queue
+    Iocp    // Overlapped WSARecv/WSASend on an I/O completion port
+};
+
+// ============================================================================
+// IOCP / RIO Transport (implements ITransport)
+// ============================================================================
+
+/// Windows transport with batched, syscall-light completion handling
+class IocpTransport : public ITransport {
+public:
+    explicit IocpTransport(const IocpConfig& config = {}) noexcept
+        : config_{config} {}
+
+    ~IocpTransport() override {
+        disconnect();
+        release_region();
+    }
+
+    // Non-copyable, non-movable (the kernel holds pointers into slots_)
+    IocpTransport(const IocpTransport&) = delete;
+    IocpTransport& operator=(const IocpTransport&) = delete;
+
+    [[nodiscard]] TransportResult<void> connect(
+        std::string_view host,
+        uint16_t port) override
+    {
+        disconnect();
+        if (!WinsockInit::ensure()) {
+            return std::unexpected{WinsockInit::make_init_error()};
+        }
+        if (config_.recv_slots == 0 || config_.send_slots == 0 || config_.slot_size == 0) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+        }
+
+        struct addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_protocol = IPPROTO_TCP;
+
+        char port_str[8];
+        std::snprintf(port_str, sizeof(port_str), "%u", port);
+
+        // Need null-terminated string for getaddrinfo
+        char host_buf[256];
+        size_t host_len = std::min(host.size(), sizeof(host_buf) - 1);
+        std::memcpy(host_buf, host.data(), host_len);
+        host_buf[host_len] = '\0';
+
+        struct addrinfo* resolved = nullptr;
+        int ret = ::getaddrinfo(host_buf, port_str, &hints, &resolved);
+        if (ret != 0) {
+            return std::unexpected{make_gai_error(ret)};
+        }
+
+        // A registered-I/O socket also accepts overlapped calls, so the IOCP
+        // fallback can use it too
+        DWORD flags = WSA_FLAG_OVERLAPPED | (config_.use_rio ? WSA_FLAG_REGISTERED_IO : 0);
+        fd_ = ::WSASocketW(AF_INET, SOCK_STREAM, IPPROTO_TCP, nullptr, 0, flags);
+        if (!is_valid_socket(fd_) && config_.use_rio) {
+            fd_ = ::WSASocketW(AF_INET, SOCK_STREAM, IPPROTO_TCP, nullptr, 0, WSA_FLAG_OVERLAPPED);
+        }
+        if (!is_valid_socket(fd_)) {
+            ::freeaddrinfo(resolved);
+            return std::unexpected{make_socket_error()};
+        }
+
+        state_ = ConnectionState::Connecting;
+        ret = ::connect(fd_, resolved->ai_addr, static_cast<int>(resolved->ai_addrlen));
+        ::freeaddrinfo(resolved);
+        if (ret == SOCKET_ERROR) {
+            auto err = make_socket_error();
+            close_handles();
+            state_ = ConnectionState::Error;
+            return std::unexpected{err};
+        }
+        (void)set_tcp_nodelay(fd_, config_.tcp_nodelay);
+        (void)set_socket_keepalive(fd_, config_.keep_alive);
+
+        if (auto result = open_completion(); !result) {
+            close_handles();
+            state_ = ConnectionState::Error;
+            return result;
+        }
+
+        // Every receive slot goes out now; they come back in this order
+        for (uint32_t i = 0; i < config_.recv_slots; ++i) {
+            if (auto result = post_receive(i); !result) {
+                disconnect();
+                state_ = ConnectionState::Error;
+                return result;
+            }
+        }
+        state_ = ConnectionState::Connected;
+        return {};
+    }
+
+    void disconnect() noexcept override {
+        if (!is_valid_socket(fd_)) return;
+        state_ = ConnectionState::Disconnecting;
+        ::shutdown(fd_, SD_BOTH);
+        close_handles();
+        state_ = ConnectionState::Disconnected;
+    }
+
+    [[nodiscard]] bool is_connected() const noexcept override {
+        return state_ == ConnectionState::Connected && is_valid_socket(fd_);
+    }
+
+    /// Copy data into free send slots and post them
+    /// @return Bytes accepted; 0 if no slot freed up within send_timeout_ms
+    [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept override {
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+        if (pending_error_.code != TransportErrorCode::None) return fail(pending_error_);
+
+        size_t accepted = 0;
+        bool deferred = false;
+        while (accepted < data.size()) {
+            Slot& slot = slots_[config_.recv_slots + send_next_];
+            if (slot.busy) {
+                if (deferred) break;   // Commit what is queued first
+                if (!wait([&slot] { return !slot.busy; }, config_.send_timeout_ms)) {
+                    if (pending_error_.code != TransportErrorCode::None) return fail(pending_error_);
+                    break;
+                }
+            }
+
+            const size_t n = std::min<size_t>(data.size() - accepted, config_.slot_size);
+            std::memcpy(slot_data(slot), data.data() + accepted, n);
+            slot.length = static_cast<uint32_t>(n);
+            const bool more = accepted + n < data.size();
+            if (auto result = post_send(slot, more); !result) return fail(result.error());
+
+            deferred = deferred || more;
+            accepted += n;
+            send_next_ = (send_next_ + 1) % config_.send_slots;
+        }
+        if (deferred) commit_sends();
+        return accepted;
+    }
+
+    /// Copy out received bytes, waiting up to recv_timeout_ms for the first
+    /// @return Bytes copied; 0 on timeout
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept override {
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+
+        Slot* head = &slots_[recv_head_];
+        if (!head->done) {
+            reap(0);
+            if (!head->done &&
+                !wait([head] { return head->done; }, config_.recv_timeout_ms)) {
+                return 0;
+            }
+        }
+        if (head->error != 0) {
+            return fail(make_socket_error(head->error));
+        }
+        if (head->length == 0) {
+            state_ = ConnectionState::Disconnected;
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+
+        // Drain completed slots in posting order
+        size_t copied = 0;
+        while (copied < buffer.size() && head->done && head->error == 0 && head->length > 0) {
+            const size_t n = std::min<size_t>(buffer.size() - copied, head->length - recv_offset_);
+            std::memcpy(buffer.data() + copied, slot_data(*head) + recv_offset_, n);
+            copied += n;
+            recv_offset_ += static_cast<uint32_t>(n);
+            if (recv_offset_ < head->length) break;
+
+            recv_offset_ = 0;
+            if (auto result = post_receive(recv_head_); !result) return fail(result.error());
+            recv_head_ = (recv_head_ + 1) % config_.recv_slots;
+            head = &slots_[recv_head_];
+        }
+        return copied;
+    }
+
+    [[nodiscard]] bool set_nodelay(bool enable) noexcept override {
+        config_.tcp_nodelay = enable;
+        return !is_valid_socket(fd_) || set_tcp_nodelay(fd_, enable);
+    }
+
+    [[nodiscard]] bool set_keepalive(bool enable) noexcept override {
+        config_.keep_alive = enable;
+        return !is_valid_socket(fd_) || set_socket_keepalive(fd_, enable);
+    }
+
+    /// Bounds the wait in receive() (the socket itself never blocks)
+    [[nodiscard]] bool set_receive_timeout(int milliseconds) noexcept override {
+        config_.recv_timeout_ms = milliseconds;
+        return true;
+    }
+
+    /// Bounds the wait for a free send slot
+    [[nodiscard]] bool set_send_timeout(int milliseconds) noexcept override {
+        config_.send_timeout_ms = milliseconds;
+        return true;
+    }
+
+    /// Completion mechanism in use (None until connected)
+    [[nodiscard]] IocpBackend backend() const noexcept { return backend_; }
+
+    [[nodiscard]] const char* backend_name() const noexcept {
+        switch (backend_) {
+            case IocpBackend::Rio:  return "RIO";
+            case IocpBackend::Iocp: return "IOCP";
+            default:                return "none";
+        }
+    }
+
+    /// Completions reaped per dequeue call, summed (batching indicator)
+    [[nodiscard]] uint64_t completions() const noexcept { return completions_; }
+
+    /// Dequeue calls that returned at least one completion
+    [[nodiscard]] uint64_t reap_calls() const noexcept { return reap_calls_; }
+
+    /// Raw socket handle
+    [[nodiscard]] SocketHandle fd() const noexcept { return fd_; }
+
+    [[nodiscard]] const IocpConfig& config() const noexcept { return config_; }
+
+private:
+    /// One receive or send buffer; `ov` must stay first (OVERLAPPED* -> Slot*)
+    struct Slot {
+        OVERLAPPED ov{};
+        uint32_t length{0};   // Bytes received / to send
+        int error{0};         // Winsock error of the completion
+        bool busy{false};     // Posted, completion not reaped
+        bool done{false};     // Receive completed, not yet drained
+    };
+
+    static constexpr ULONG REAP_BATCH = 64;
+    static constexpr ULONG_PTR RIO_NOTIFY_KEY = 1;
+
+    // ------------------------------------------------------------------------
+    // Setup
+    // ------------------------------------------------------------------------
+
+    [[nodiscard]] TransportResult<void> open_completion() noexcept {
+        if (!region_ && !allocate_region()) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace,
+                                                  static_cast<int>(::GetLastError())}};
+        }
+        for (Slot& slot : slots_) slot = Slot{};
+        recv_head_ = 0;
+        recv_offset_ = 0;
+        send_next_ = 0;
+        pending_error_ = TransportError{};
+
+        iocp_ = ::CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+        if (!iocp_) return iocp_error();
+
+        if (config_.use_rio && open_rio()) {
+            backend_ = IocpBackend::Rio;
+            return {};
+        }
+
+        // Fallback: overlapped calls completing on the port
+        if (!::CreateIoCompletionPort(reinterpret_cast<HANDLE>(fd_), iocp_, 0, 0)) {
+            return iocp_error();
+        }
+        (void)::SetFileCompletionNotificationModes(reinterpret_cast<HANDLE>(fd_),
+                                                   FILE_SKIP_SET_EVENT_ON_HANDLE);
+        backend_ = IocpBackend::Iocp;
+        return {};
+    }
+
+    /// Load the RIO table, register the slots and create the queues
+    [[nodiscard]] bool open_rio() noexcept {
+        GUID id = WSAID_MULTIPLE_RIO;
+        DWORD bytes = 0;
+        rio_ = RIO_EXTENSION_FUNCTION_TABLE{};
+        rio_.cbSize = sizeof(rio_);
+        if (::WSAIoctl(fd_, SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER,
+                       &id, sizeof(id), &rio_, sizeof(rio_), &bytes,
+                       nullptr, nullptr) == SOCKET_ERROR) {
+            return false;
+        }
+
+        if (buffer_id_ == RIO_INVALID_BUFFERID) {
+            buffer_id_ = rio_.RIORegisterBuffer(region_, static_cast<DWORD>(region_size()));
+            if (buffer_id_ == RIO_INVALID_BUFFERID) return false;
+        }
+
+        RIO_NOTIFICATION_COMPLETION notify{};
+        notify.Type = RIO_IOCP_COMPLETION;
+        notify.Iocp.IocpHandle = iocp_;
+        notify.Iocp.CompletionKey = reinterpret_cast<PVOID>(RIO_NOTIFY_KEY);
+        notify.Iocp.Overlapped = &notify_ov_;
+
+        cq_ = rio_.RIOCreateCompletionQueue(config_.recv_slots + config_.send_slots, &notify);
+        if (cq_ == RIO_INVALID_CQ) return false;
+
+        rq_ = rio_.RIOCreateRequestQueue(fd_, config_.recv_slots, 1, config_.send_slots, 1,
+                                         cq_, cq_, this);
+        if (rq_ == RIO_INVALID_RQ) {
+            rio_.RIOCloseCompletionQueue(cq_);
+            cq_ = RIO_INVALID_CQ;
+            return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool allocate_region() noexcept {
+        const size_t slots = static_cast<size_t>(config_.recv_slots) + config_.send_slots;
+        region_ = static_cast<char*>(::VirtualAlloc(nullptr, region_size(),
+                                                    MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+        if (!region_) return false;
+        slots_.assign(slots, Slot{});
+        return true;
+    }
+
+    void release_region() noexcept {
+        if (buffer_id_ != RIO_INVALID_BUFFERID) {
+            rio_.RIODeregisterBuffer(buffer_id_);
+            buffer_id_ = RIO_INVALID_BUFFERID;
+        }
+        if (region_) {
+            ::VirtualFree(region_, 0, MEM_RELEASE);
+            region_ = nullptr;
+        }
+    }
+
+    /// Close the socket, then wait out cancelled overlapped calls so the
+    /// kernel is done with the slots before they are reused
+    void close_handles() noexcept {
+        if (is_valid_socket(fd_)) {
+            close_socket(fd_);   // Also frees the RIO request queue
+            fd_ = INVALID_SOCKET_HANDLE;
+        }
+        if (backend_ == IocpBackend::Iocp) {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{1};
+            while (in_flight() > 0 && std::chrono::steady_clock::now() < deadline) {
+                reap_iocp(10);
+            }
+        }
+        if (cq_ != RIO_INVALID_CQ) {
+            rio_.RIOCloseCompletionQueue(cq_);
+            cq_ = RIO_INVALID_CQ;
+        }
+        rq_ = RIO_INVALID_RQ;
+        if (iocp_) {
+            ::CloseHandle(iocp_);
+            iocp_ = nullptr;
+        }
+        backend_ = IocpBackend::None;
+    }
+
+    // ------------------------------------------------------------------------
+    // Posting
+    // ------------------------------------------------------------------------
+
+    [[nodiscard]] TransportResult<void> post_receive(uint32_t index) noexcept {
+        Slot& slot = slots_[index];
+        slot = Slot{};
+        slot.busy = true;
+
+        if (backend_ == IocpBackend::Rio) {
+            RIO_BUF buf{buffer_id_, offset_of(slot), config_.slot_size};
+            if (!rio_.RIOReceive(rq_, &buf, 1, 0, &slot)) {
+                slot.busy = false;
+                return std::unexpected{make_socket_error()};
+            }
+            return {};
+        }
+
+        WSABUF buf{config_.slot_size, slot_data(slot)};
+        DWORD flags = 0;
+        if (::WSARecv(fd_, &buf, 1, nullptr, &flags, &slot.ov, nullptr) == SOCKET_ERROR) {
+            const int err = get_last_socket_error();
+            if (err != WSA_IO_PENDING) {
+                slot.busy = false;
+                return std::unexpected{make_socket_error(err)};
+            }
+        }
+        return {};
+    }
+
+    [[nodiscard]] TransportResult<void> post_send(Slot& slot, bool defer) noexcept {
+        slot.ov = OVERLAPPED{};
+        slot.error = 0;
+        slot.busy = true;
+
+        if (backend_ == IocpBackend::Rio) {
+            RIO_BUF buf{buffer_id_, offset_of(slot), slot.length};
+            if (!rio_.RIOSend(rq_, &buf, 1, defer ? RIO_MSG_DEFER : 0, &slot)) {
+                slot.busy = false;
+                return std::unexpected{make_socket_error()};
+            }
+            return {};
+        }
+
+        WSABUF buf{slot.length, slot_data(slot)};
+        if (::WSASend(fd_, &buf, 1, nullptr, 0, &slot.ov, nullptr) == SOCKET_ERROR) {
+            const int err = get_last_socket_error();
+            if (err != WSA_IO_PENDING) {
+                slot.busy = false;
+                return std::unexpected{make_socket_error(err)};
+            }
+        }
+        return {};
+    }
+
+    /// Hand RIO_MSG_DEFER sends to the NIC in one call
+    void commit_sends() noexcept {
+        if (backend_ == IocpBackend::Rio) {
+            (void)rio_.RIOSend(rq_, nullptr, 0, RIO_MSG_COMMIT_ONLY, nullptr);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Completions
+    // ------------------------------------------------------------------------
+
+    /// Take completed operations without sleeping longer than timeout_ms
+    void reap(DWORD timeout_ms) noexcept {
+        if (backend_ == IocpBackend::Rio) {
+            reap_rio();
+        } else {
+            reap_iocp(timeout_ms);
+        }
+    }
+
+    void reap_rio() noexcept {
+        std::array<RIORESULT, REAP_BATCH> results;
+        const ULONG n = rio_.RIODequeueCompletion(cq_, results.data(), REAP_BATCH);
+        if (n == 0 || n == RIO_CORRUPT_CQ) return;
+        ++reap_calls_;
+        completions_ += n;
+        for (ULONG i = 0; i < n; ++i) {
+            complete(*reinterpret_cast<Slot*>(static_cast<uintptr_t>(results[i].RequestContext)),
+                     results[i].BytesTransferred, results[i].Status);
+        }
+    }
+
+    void reap_iocp(DWORD timeout_ms) noexcept {
+        std::array<OVERLAPPED_ENTRY, REAP_BATCH> entries;
+        ULONG n = 0;
+        if (!::GetQueuedCompletionStatusEx(iocp_, entries.data(), REAP_BATCH, &n,
+                                           timeout_ms, FALSE) || n == 0) {
+            return;
+        }
+        ++reap_calls_;
+        completions_ += n;
+        for (ULONG i = 0; i < n; ++i) {
+            Slot& slot = *reinterpret_cast<Slot*>(entries[i].lpOverlapped);
+            DWORD bytes = 0;
+            DWORD flags = 0;
+            const int error = ::WSAGetOverlappedResult(fd_, &slot.ov, &bytes, FALSE, &flags)
+                                  ? 0 : get_last_socket_error();
+            complete(slot, entries[i].dwNumberOfBytesTransferred, error);
+        }
+    }
+
+    void complete(Slot& slot, ULONG bytes, int error) noexcept {
+        slot.busy = false;
+        slot.error = error;
+        if (is_send_slot(slot)) {
+            if (error != 0 && pending_error_.code == TransportErrorCode::None) {
+                pending_error_ = make_socket_error(error);
+            }
+            return;
+        }
+        slot.length = bytes;
+        slot.done = true;
+    }
+
+    /// Spin on the completion queue, then sleep on the port until ready()
+    /// or timeout_ms passes (0: spin only)
+    template<typename Ready>
+    [[nodiscard]] bool wait(Ready&& ready, int timeout_ms) noexcept {
+        for (uint32_t i = 0; i < config_.spin_polls && !ready(); ++i) {
+            reap(0);
+        }
+        if (ready() || timeout_ms <= 0) return ready();
+
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::milliseconds{timeout_ms};
+        while (!ready()) {
+            const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now()).count();
+            if (left <= 0) return false;
+
+            if (backend_ == IocpBackend::Iocp) {
+                reap_iocp(static_cast<DWORD>(left));
+                continue;
+            }
+
+            // Arm the queue, then sleep until it has entries
+            const INT armed = rio_.RIONotify(cq_);
+            if (armed == ERROR_SUCCESS || armed == WSAEALREADY) {
+                DWORD bytes = 0;
+                ULONG_PTR key = 0;
+                OVERLAPPED* ov = nullptr;
+                (void)::GetQueuedCompletionStatus(iocp_, &bytes, &key, &ov,
+                                                  static_cast<DWORD>(left));
+            }
+            reap_rio();
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // Helpers
+    // ------------------------------------------------------------------------
+
+    [[nodiscard]] TransportResult<size_t> fail(TransportError error) noexcept {
+        state_ = ConnectionState::Error;
+        return std::unexpected{error};
+    }
+
+    [[nodiscard]] static std::unexpected<TransportError> iocp_error() noexcept {
+        return std::unexpected{TransportError{TransportErrorCode::IocpError,
+                                              static_cast<int>(::GetLastError())}};
+    }
+
+    [[nodiscard]] size_t region_size() const noexcept {
+        return (static_cast<size_t>(config_.recv_slots) + config_.send_slots) * config_.slot_size;
+    }
+
+    [[nodiscard]] size_t index_of(const Slot& slot) const noexcept {
+        return static_cast<size_t>(&slot - slots_.data());
+    }
+
+    [[nodiscard]] bool is_send_slot(const Slot& slot) const noexcept {
+        return index_of(slot) >= config_.recv_slots;
+    }
+
+    [[nodiscard]] ULONG offset_of(const Slot& slot) const noexcept {
+        return static_cast<ULONG>(index_of(slot) * config_.slot_size);
+    }
+
+    [[nodiscard]] char* slot_data(const Slot& slot) const noexcept {
+        return region_ + index_of(slot) * config_.slot_size;
+    }
+
+    [[nodiscard]] size_t in_flight() const noexcept {
+        return static_cast<size_t>(std::count_if(slots_.begin(), slots_.end(),
+                                                 [](const Slot& s) { return s.busy; }));
+    }
+
+    IocpConfig config_;
+    SocketHandle fd_{INVALID_SOCKET_HANDLE};
+    ConnectionState state_{ConnectionState::Disconnected};
+    IocpBackend backend_{IocpBackend::None};
+    TransportError pending_error_{};   // Failed send completion, reported by send()
+
+    // Buffers: receive slots [0, recv_slots), then send slots
+    char* region_{nullptr};
+    std::vector<Slot> slots_;
+    uint32_t recv_head_{0};            // Next receive slot to drain
+    uint32_t recv_offset_{0};          // Bytes of it already copied out
+    uint32_t send_next_{0};            // Next send slot to fill
+
+    // Completion
+    HANDLE iocp_{nullptr};
+    RIO_EXTENSION_FUNCTION_TABLE rio_{};
+    RIO_BUFFERID buffer_id_{RIO_INVALID_BUFFERID};
+    RIO_CQ cq_{RIO_INVALID_CQ};
+    RIO_RQ rq_{RIO_INVALID_RQ};
+    OVERLAPPED notify_ov_{};
+
+    uint64_t completions_{0};
+    uint64_t reap_calls_{0};
+};
+
+} // namespace nfx
+
+#endif  // NFX_PLATFORM_WINDOWS
@@ -0,0 +1,678 @@
+#pragma once
+
+/// @file kernel_bypass_transport.hpp
+/// @brief Kernel-bypass transport: userspace network stacks behind ITransport
+///
+/// KernelBypassTransport implements ITransport on top of a pluggable BypassStack,
+/// so SessionManager and the session loop are unchanged. Stacks provided here:
+/// - SocketApiStack: non-blocking POSIX sockets, spun from userspace. Under
+///   Onload / VMA / XLIO (LD_PRELOAD) these calls never enter the kernel.
+/// - XdpStack: AF_XDP socket (UMEM + fill/completion/RX/TX rings) carrying raw
+///   frames to a UserspaceTcp implementation supplied by the application.
+///
+/// Vendor stacks (ef_vi, TCPDirect, F-Stack, ...) plug in by implementing
+/// BypassStack and calling register_bypass_stack() before the factory runs.
+///
+/// AF_XDP needs only kernel headers; steering traffic to the socket requires an
+/// XDP program with an XSKMAP entry for XdpSocket::fd() (loaded externally,
+/// e.g. with xdp-loader), and CAP_NET_RAW / CAP_BPF at open time.
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/transport/socket.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+#include "nexusfix/memory/wait_strategy.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#if NFX_PLATFORM_LINUX && __has_include(<linux/if_xdp.h>)
+    #include <linux/if_xdp.h>
+    #include <net/if.h>
+    #include <sys/mman.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+    #define NFX_AF_XDP_AVAILABLE 1
+    #ifndef SOL_XDP
+        #define SOL_XDP 283
+    #endif
+#else
+    #define NFX_AF_XDP_AVAILABLE 0
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Kernel-bypass Configuration
+// ============================================================================
+
+/// Configuration for kernel-bypass stacks
+struct KernelBypassConfig {
+    std::string_view interface_name{};  // NIC for AF_XDP / ef_vi (read during open only)
+    uint32_t queue_id{0};               // NIC RX queue bound to the socket
+    uint32_t num_frames{4096};          // UMEM frames (half RX fill, half TX)
+    uint32_t frame_size{4096};          // UMEM chunk size (2048 or 4096)
+    uint32_t ring_size{2048};           // Entries per ring (power of two)
+    bool zero_copy{true};               // XDP_ZEROCOPY, falls back to XDP_COPY
+    int recv_timeout_ms{30000};         // receive() spin bound, 0 = spin forever
+};
+
+// ============================================================================
+// Bypass Stack Interface
+// ============================================================================
+
+/// Userspace network stack driven by KernelBypassTransport.
+/// All calls come from the session thread; implementations need no locking.
+class BypassStack {
+public:
+    virtual ~BypassStack() = default;
+
+    /// Short identifier for logs ("socket-api", "af_xdp", "ef_vi", ...)
+    [[nodiscard]] virtual const char* name() const noexcept = 0;
+
+    /// Establish a TCP connection (may spin poll() internally)
+    [[nodiscard]] virtual TransportResult<void> connect(
+        std::string_view host, uint16_t port) noexcept = 0;
+
+    virtual void close() noexcept = 0;
+
+    [[nodiscard]] virtual bool is_connected() const noexcept = 0;
+
+    /// Queue stream bytes for transmission; may accept fewer than given
+    [[nodiscard]] virtual TransportResult<size_t> send(
+        std::span<const char> data) noexcept = 0;
+
+    /// Copy out already-received stream bytes; 0 when none are pending
+    [[nodiscard]] virtual TransportResult<size_t> try_receive(
+        std::span<char> buffer) noexcept = 0;
+
+    /// Drive the stack: reap NIC events, run timers, send ACKs
+    virtual void poll() noexcept {}
+
+    [[nodiscard]] virtual bool set_nodelay(bool /*enable*/) noexcept { return true; }
+    [[nodiscard]] virtual bool set_keepalive(bool /*enable*/) noexcept { return true; }
+};
+
+/// Factory for a vendor stack; returning nullptr falls through to the default
+using BypassStackFactory = std::unique_ptr<BypassStack> (*)(const KernelBypassConfig&);
+
+namespace detail {
+
+inline BypassStackFactory& bypass_stack_factory_slot() noexcept {
+    static BypassStackFactory factory{nullptr};
+    return factory;
+}
+
+} // namespace detail
+
+/// Install the stack used by TransportPreference::KernelBypass (nullptr resets)
+inline void register_bypass_stack(BypassStackFactory factory) noexcept {
+    detail::bypass_stack_factory_slot() = factory;
+}
+
+/// Currently registered vendor stack factory, if any
+[[nodiscard]] inline BypassStackFactory registered_bypass_stack() noexcept {
+    return detail::bypass_stack_factory_slot();
+}
+
+// ============================================================================
+// Socket API Stack (Onload / VMA compatible)
+// ============================================================================
+
+/// Non-blocking BSD sockets polled from userspace.
+/// Plain kernel TCP with SO_BUSY_POLL by default; when the process runs under
+/// an LD_PRELOAD bypass library the same calls are served by the NIC directly.
+class SocketApiStack final : public BypassStack {
+public:
+    SocketApiStack() noexcept
+        : socket_{SocketOptions::busy_poll()} {}
+
+    [[nodiscard]] const char* name() const noexcept override {
+        return accelerated() ? "socket-api (accelerated)" : "socket-api";
+    }
+
+    [[nodiscard]] TransportResult<void> connect(
+        std::string_view host, uint16_t port) noexcept override
+    {
+        return socket_.connect(host, port);
+    }
+
+    void close() noexcept override { socket_.close(); }
+
+    [[nodiscard]] bool is_connected() const noexcept override {
+        return socket_.is_connected();
+    }
+
+    [[nodiscard]] TransportResult<size_t> send(
+        std::span<const char> data) noexcept override
+    {
+        return socket_.send(data);
+    }
+
+    [[nodiscard]] TransportResult<size_t> try_receive(
+        std::span<char> buffer) noexcept override
+    {
+        return socket_.receive_once(buffer);
+    }
+
+    [[nodiscard]] bool set_nodelay(bool enable) noexcept override {
+        return socket_.set_nodelay(enable);
+    }
+
+    [[nodiscard]] bool set_keepalive(bool enable) noexcept override {
+        return socket_.set_keepalive(enable);
+    }
+
+    /// True if an LD_PRELOAD bypass library (Onload, VMA, XLIO) is loaded
+    [[nodiscard]] static bool accelerated() noexcept {
+        const char* preload = std::getenv("LD_PRELOAD");
+        if (preload == nullptr) return false;
+        std::string_view libs{preload};
+        return libs.find("libonload") != std::string_view::npos
+            || libs.find("libvma") != std::string_view::npos
+            || libs.find("libxlio") != std::string_view::npos;
+    }
+
+    [[nodiscard]] TcpSocket& socket() noexcept { return socket_; }
+
+private:
+    TcpSocket socket_;
+};
+
+#if NFX_AF_XDP_AVAILABLE
+
+// ============================================================================
+// AF_XDP Socket
+// ============================================================================
+
+/// AF_XDP socket with its own UMEM: raw L2 frames in and out of one NIC queue.
+/// RX frames are recycled to the fill ring after the callback returns, so the
+/// span passed to poll_rx() callbacks is only valid during the call.
+class XdpSocket {
+public:
+    XdpSocket() noexcept = default;
+    ~XdpSocket() { close(); }
+
+    XdpSocket(const XdpSocket&) = delete;
+    XdpSocket& operator=(const XdpSocket&) = delete;
+
+    /// Create socket, register UMEM, map rings and bind to interface/queue
+    [[nodiscard]] TransportResult<void> open(const KernelBypassConfig& config) noexcept {
+        if (is_open()) return {};
+
+        const uint32_t frames = config.num_frames;
+        if (frames < 2 || config.ring_size == 0 ||
+            (config.ring_size & (config.ring_size - 1)) != 0 ||
+            config.ring_size < frames / 2) {
+            return std::unexpected{make_transport_error(TransportErrorCode::SocketError, EINVAL)};
+        }
+
+        char ifname[IF_NAMESIZE] = {};
+        std::memcpy(ifname, config.interface_name.data(),
+                    std::min(config.interface_name.size(), sizeof(ifname) - 1));
+        unsigned ifindex = ::if_nametoindex(ifname);
+        if (ifindex == 0) {
+            return std::unexpected{make_transport_error(TransportErrorCode::SocketError, ENODEV)};
+        }
+
+        fd_ = ::socket(AF_XDP, SOCK_RAW | SOCK_CLOEXEC, 0);
+        if (fd_ < 0) {
+            return fail(errno);
+        }
+
+        frame_size_ = config.frame_size;
+        umem_len_ = static_cast<size_t>(frames) * frame_size_;
+        void* area = ::mmap(nullptr, umem_len_, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+        if (area == MAP_FAILED) {
+            return fail(errno);
+        }
+        umem_ = static_cast<uint8_t*>(area);
+
+        xdp_umem_reg reg{};
+        reg.addr = reinterpret_cast<uint64_t>(umem_);
+        reg.len = umem_len_;
+        reg.chunk_size = frame_size_;
+        reg.headroom = 0;
+        if (::setsockopt(fd_, SOL_XDP, XDP_UMEM_REG, &reg, sizeof(reg)) != 0) {
+            return fail(errno);
+        }
+
+        int ring = static_cast<int>(config.ring_size);
+        if (::setsockopt(fd_, SOL_XDP, XDP_UMEM_FILL_RING, &ring, sizeof(ring)) != 0 ||
+            ::setsockopt(fd_, SOL_XDP, XDP_UMEM_COMPLETION_RING, &ring, sizeof(ring)) != 0 ||
+            ::setsockopt(fd_, SOL_XDP, XDP_RX_RING, &ring, sizeof(ring)) != 0 ||
+            ::setsockopt(fd_, SOL_XDP, XDP_TX_RING, &ring, sizeof(ring)) != 0) {
+            return fail(errno);
+        }
+
+        xdp_mmap_offsets off{};
+        socklen_t optlen = sizeof(off);
+        if (::getsockopt(fd_, SOL_XDP, XDP_MMAP_OFFSETS, &off, &optlen) != 0) {
+            return fail(errno);
+        }
+
+        if (!map_ring(fill_, off.fr, config.ring_size, sizeof(uint64_t), XDP_UMEM_PGOFF_FILL_RING) ||
+            !map_ring(comp_, off.cr, config.ring_size, sizeof(uint64_t), XDP_UMEM_PGOFF_COMPLETION_RING) ||
+            !map_ring(rx_, off.rx, config.ring_size, sizeof(xdp_desc), XDP_PGOFF_RX_RING) ||
+            !map_ring(tx_, off.tx, config.ring_size, sizeof(xdp_desc), XDP_PGOFF_TX_RING)) {
+            return fail(errno);
+        }
+
+        sockaddr_xdp sxdp{};
+        sxdp.sxdp_family = AF_XDP;
+        sxdp.sxdp_ifindex = ifindex;
+        sxdp.sxdp_queue_id = config.queue_id;
+        sxdp.sxdp_flags = XDP_USE_NEED_WAKEUP | (config.zero_copy ? XDP_ZEROCOPY : XDP_COPY);
+        int ret = ::bind(fd_, reinterpret_cast<sockaddr*>(&sxdp), sizeof(sxdp));
+        if (ret != 0 && config.zero_copy) {
+            // Driver lacks zero-copy support: fall back to copy mode
+            sxdp.sxdp_flags = XDP_USE_NEED_WAKEUP | XDP_COPY;
+            ret = ::bind(fd_, reinterpret_cast<sockaddr*>(&sxdp), sizeof(sxdp));
+            zero_copy_ = false;
+        } else {
+            zero_copy_ = config.zero_copy;
+        }
+        if (ret != 0) {
+            return fail(errno);
+        }
+
+        // Lower half of UMEM feeds RX, upper half is the TX pool
+        const uint32_t rx_frames = frames / 2;
+        for (uint32_t i = 0; i < rx_frames; ++i) {
+            fill_.entry<uint64_t>(fill_.cached_prod++) = static_cast<uint64_t>(i) * frame_size_;
+        }
+        store_release(fill_.producer, fill_.cached_prod);
+
+        tx_free_.clear();
+        tx_free_.reserve(frames - rx_frames);
+        for (uint32_t i = rx_frames; i < frames; ++i) {
+            tx_free_.push_back(static_cast<uint64_t>(i) * frame_size_);
+        }
+        return {};
+    }
+
+    void close() noexcept {
+        unmap_ring(fill_);
+        unmap_ring(comp_);
+        unmap_ring(rx_);
+        unmap_ring(tx_);
+        if (umem_ != nullptr) {
+            ::munmap(umem_, umem_len_);
+            umem_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        tx_free_.clear();
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return fd_ >= 0; }
+
+    /// Socket fd to insert into the redirecting XDP program's XSKMAP
+    [[nodiscard]] int fd() const noexcept { return fd_; }
+
+    /// True if bound in XDP_ZEROCOPY mode (false after copy-mode fallback)
+    [[nodiscard]] bool is_zero_copy() const noexcept { return zero_copy_; }
+
+    [[nodiscard]] uint32_t frame_size() const noexcept { return frame_size_; }
+
+    /// Deliver up to max_frames received frames to on_frame(std::span<const uint8_t>)
+    template<typename OnFrame>
+    size_t poll_rx(OnFrame&& on_frame, uint32_t max_frames = 64) noexcept {
+        uint32_t available = load_acquire(rx_.producer) - rx_.cached_cons;
+        uint32_t n = std::min(available, max_frames);
+        if (n == 0) {
+            kick_fill();
+            return 0;
+        }
+
+        for (uint32_t i = 0; i < n; ++i) {
+            const xdp_desc& desc = rx_.entry<xdp_desc>(rx_.cached_cons + i);
+            on_frame(std::span<const uint8_t>{umem_ + desc.addr, desc.len});
+            // Same UMEM frame goes straight back to the kernel
+            fill_.entry<uint64_t>(fill_.cached_prod++) = desc.addr & ~static_cast<uint64_t>(frame_size_ - 1);
+        }
+        rx_.cached_cons += n;
+        store_release(rx_.consumer, rx_.cached_cons);
+        store_release(fill_.producer, fill_.cached_prod);
+        kick_fill();
+        return n;
+    }
+
+    /// Copy one L2 frame into a TX UMEM frame and post it
+    [[nodiscard]] TransportResult<void> send_frame(std::span<const uint8_t> frame) noexcept {
+        reap_completions();
+        if (frame.size() > frame_size_) {
+            return std::unexpected{make_transport_error(TransportErrorCode::WriteError, EMSGSIZE)};
+        }
+        if (tx_free_.empty() || tx_.cached_prod - load_acquire(tx_.consumer) >= tx_.size) {
+            return std::unexpected{make_transport_error(TransportErrorCode::NoBufferSpace, ENOBUFS)};
+        }
+
+        uint64_t addr = tx_free_.back();
+        tx_free_.pop_back();
+        std::memcpy(umem_ + addr, frame.data(), frame.size());
+
+        xdp_desc& desc = tx_.entry<xdp_desc>(tx_.cached_prod++);
+        desc.addr = addr;
+        desc.len = static_cast<uint32_t>(frame.size());
+        desc.options = 0;
+        store_release(tx_.producer, tx_.cached_prod);
+
+        // TX always needs a kick unless the driver is already polling
+        if (load_acquire(tx_.flags) & XDP_RING_NEED_WAKEUP) {
+            (void)::sendto(fd_, nullptr, 0, MSG_DONTWAIT, nullptr, 0);
+        }
+        return {};
+    }
+
+    /// Return completed TX frames to the pool
+    void reap_completions() noexcept {
+        uint32_t done = load_acquire(comp_.producer) - comp_.cached_cons;
+        for (uint32_t i = 0; i < done; ++i) {
+            tx_free_.push_back(comp_.entry<uint64_t>(comp_.cached_cons + i));
+        }
+        comp_.cached_cons += done;
+        if (done > 0) {
+            store_release(comp_.consumer, comp_.cached_cons);
+        }
+    }
+
+private:
+    /// One mmap'd producer/consumer ring shared with the kernel
+    struct Ring {
+        uint32_t* producer{nullptr};
+        uint32_t* consumer{nullptr};
+        uint32_t* flags{nullptr};
+        uint8_t* entries{nullptr};
+        void* map{nullptr};
+        size_t map_len{0};
+        uint32_t size{0};
+        uint32_t mask{0};
+        uint32_t cached_prod{0};
+        uint32_t cached_cons{0};
+
+        template<typename T>
+        [[nodiscard]] T& entry(uint32_t idx) noexcept {
+            return reinterpret_cast<T*>(entries)[idx & mask];
+        }
+    };
+
+    [[nodiscard]] bool map_ring(Ring& ring, const xdp_ring_offset& off,
+                                uint32_t size, size_t entry_size, off_t pgoff) noexcept {
+        ring.map_len = off.desc + size * entry_size;
+        void* map = ::mmap(nullptr, ring.map_len, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, fd_, pgoff);
+        if (map == MAP_FAILED) {
+            ring.map = nullptr;
+            return false;
+        }
+        auto* base = static_cast<uint8_t*>(map);
+        ring.map = map;
+        ring.producer = reinterpret_cast<uint32_t*>(base + off.producer);
+        ring.consumer = reinterpret_cast<uint32_t*>(base + off.consumer);
+        ring.flags = reinterpret_cast<uint32_t*>(base + off.flags);
+        ring.entries = base + off.desc;
+        ring.size = size;
+        ring.mask = size - 1;
+        ring.cached_prod = load_acquire(ring.producer);
+        ring.cached_cons = load_acquire(ring.consumer);
+        return true;
+    }
+
+    static void unmap_ring(Ring& ring) noexcept {
+        if (ring.map != nullptr) {
+            ::munmap(ring.map, ring.map_len);
+        }
+        ring = Ring{};
+    }
+
+    void kick_fill() noexcept {
+        if (load_acquire(fill_.flags) & XDP_RING_NEED_WAKEUP) {
+            (void)::recvfrom(fd_, nullptr, 0, MSG_DONTWAIT, nullptr, nullptr);
+        }
+    }
+
+    [[nodiscard]] std::unexpected<TransportError> fail(int err) noexcept {
+        close();
+        return std::unexpected{make_socket_error(err)};
+    }
+
+    [[nodiscard]] static uint32_t load_acquire(uint32_t* p) noexcept {
+        return std::atomic_ref<uint32_t>{*p}.load(std::memory_order_acquire);
+    }
+
+    static void store_release(uint32_t* p, uint32_t value) noexcept {
+        std::atomic_ref<uint32_t>{*p}.store(value, std::memory_order_release);
+    }
+
+    int fd_{-1};
+    uint8_t* umem_{nullptr};
+    size_t umem_len_{0};
+    uint32_t frame_size_{0};
+    bool zero_copy_{false};
+    Ring fill_;
+    Ring comp_;
+    Ring rx_;
+    Ring tx_;
+    std::vector<uint64_t> tx_free_;
+};
+
+// ============================================================================
+// AF_XDP Stack
+// ============================================================================
+
+/// Userspace TCP running over raw frames (supplied by the application).
+/// Ethernet/IP/TCP framing, ARP, retransmission and reassembly live here.
+class UserspaceTcp {
+public:
+    virtual ~UserspaceTcp() = default;
+
+    /// Start the handshake; XdpStack::poll() delivers frames until established
+    [[nodiscard]] virtual TransportResult<void> connect(
+        XdpSocket& xsk, std::string_view host, uint16_t port) noexcept = 0;
+
+    virtual void close(XdpSocket& xsk) noexcept = 0;
+
+    [[nodiscard]] virtual bool is_established() const noexcept = 0;
+
+    /// Ingress L2 frame (valid only for the duration of the call)
+    virtual void on_frame(XdpSocket& xsk, std::span<const uint8_t> frame) noexcept = 0;
+
+    /// Segment and transmit stream bytes
+    [[nodiscard]] virtual TransportResult<size_t> send(
+        XdpSocket& xsk, std::span<const char> data) noexcept = 0;
+
+    /// Drain reassembled in-order stream bytes; 0 when none
+    [[nodiscard]] virtual size_t read(std::span<char> buffer) noexcept = 0;
+
+    /// Retransmit / delayed-ACK timers, called once per poll
+    virtual void on_timer(XdpSocket& /*xsk*/) noexcept {}
+};
+
+/// BypassStack over an AF_XDP socket and an application-provided UserspaceTcp
+class XdpStack final : public BypassStack {
+public:
+    XdpStack(const KernelBypassConfig& config, std::unique_ptr<UserspaceTcp> tcp) noexcept
+        : config_{config}
+        , tcp_{std::move(tcp)} {}
+
+    [[nodiscard]] const char* name() const noexcept override { return "af_xdp"; }
+
+    [[nodiscard]] TransportResult<void> connect(
+        std::string_view host, uint16_t port) noexcept override
+    {
+        if (!tcp_) {
+            return std::unexpected{make_transport_error(
+                TransportErrorCode::ConnectionFailed, EPROTONOSUPPORT)};
+        }
+        if (auto opened = xsk_.open(config_); !opened) {
+            return opened;
+        }
+        return tcp_->connect(xsk_, host, port);
+    }
+
+    void close() noexcept override {
+        if (tcp_ && xsk_.is_open()) {
+            tcp_->close(xsk_);
+        }
+        xsk_.close();
+    }
+
+    [[nodiscard]] bool is_connected() const noexcept override {
+        return tcp_ && xsk_.is_open() && tcp_->is_established();
+    }
+
+    [[nodiscard]] TransportResult<size_t> send(
+        std::span<const char> data) noexcept override
+    {
+        return tcp_->send(xsk_, data);
+    }
+
+    [[nodiscard]] TransportResult<size_t> try_receive(
+        std::span<char> buffer) noexcept override
+    {
+        size_t n = tcp_->read(buffer);
+        if (n == 0 && !tcp_->is_established()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+        return n;
+    }
+
+    void poll() noexcept override {
+        xsk_.poll_rx([this](std::span<const uint8_t> frame) {
+            tcp_->on_frame(xsk_, frame);
+        });
+        xsk_.reap_completions();
+        tcp_->on_timer(xsk_);
+    }
+
+    [[nodiscard]] XdpSocket& xdp_socket() noexcept { return xsk_; }
+
+private:
+    KernelBypassConfig config_;
+    XdpSocket xsk_;
+    std::unique_ptr<UserspaceTcp> tcp_;
+};
+
+#endif // NFX_AF_XDP_AVAILABLE
+
+// ============================================================================
+// Kernel-bypass Transport (implements ITransport)
+// ============================================================================
+
+/// ITransport over a BypassStack. receive() spins on the stack (never sleeps
+/// in the kernel) until data arrives or recv_timeout_ms elapses.
+class KernelBypassTransport : public ITransport {
+public:
+    /// Use the registered vendor stack, else SocketApiStack
+    explicit KernelBypassTransport(const KernelBypassConfig& config = {}) noexcept
+        : stack_{make_stack(config)}
+        , recv_timeout_ms_{config.recv_timeout_ms} {}
+
+    /// Use an explicit stack (e.g. XdpStack with an application UserspaceTcp)
+    explicit KernelBypassTransport(std::unique_ptr<BypassStack> stack,
+                                   int recv_timeout_ms = 30000) noexcept
+        : stack_{std::move(stack)}
+        , recv_timeout_ms_{recv_timeout_ms} {}
+
+    ~KernelBypassTransport() override {
+        disconnect();
+    }
+
+    [[nodiscard]] TransportResult<void> connect(
+        std::string_view host,
+        uint16_t port) override
+    {
+        if (!stack_) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionFailed}};
+        }
+        return stack_->connect(host, port);
+    }
+
+    void disconnect() noexcept override {
+        if (stack_) stack_->close();
+    }
+
+    [[nodiscard]] bool is_connected() const noexcept override {
+        return stack_ && stack_->is_connected();
+    }
+
+    [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept override {
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+        stack_->poll();  // Reap TX completions / ACKs before queuing more
+        return stack_->send(data);
+    }
+
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept override {
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+
+        using Clock = std::chrono::steady_clock;
+        const bool bounded = recv_timeout_ms_ > 0;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(recv_timeout_ms_);
+
+        for (uint32_t polls = 0; ; ++polls) {
+            stack_->poll();
+            auto result = stack_->try_receive(buffer);
+            if (!result.has_value() || *result > 0) {
+                return result;
+            }
+            if (bounded && (polls & 1023) == 1023 && Clock::now() >= deadline) {
+                return 0;
+            }
+            memory::BusySpinWait::wait();
+        }
+    }
+
+    [[nodiscard]] bool set_nodelay(bool enable) noexcept override {
+        return stack_ && stack_->set_nodelay(enable);
+    }
+
+    [[nodiscard]] bool set_keepalive(bool enable) noexcept override {
+        return stack_ && stack_->set_keepalive(enable);
+    }
+
+    [[nodiscard]] bool set_receive_timeout(int milliseconds) noexcept override {
+        recv_timeout_ms_ = milliseconds;
+        return true;
+    }
+
+    /// Userspace stacks never block on send; accepted for interface parity
+    [[nodiscard]] bool set_send_timeout(int /*milliseconds*/) noexcept override {
+        return true;
+    }
+
+    /// Active stack name ("socket-api", "af_xdp", vendor name)
+    [[nodiscard]] const char* stack_name() const noexcept {
+        return stack_ ? stack_->name() : "none";
+    }
+
+    [[nodiscard]] BypassStack* stack() noexcept { return stack_.get(); }
+
+private:
+    [[nodiscard]] static std::unique_ptr<BypassStack> make_stack(
+        const KernelBypassConfig& config) noexcept
+    {
+        if (auto factory = registered_bypass_stack()) {
+            if (auto stack = factory(config)) {
+                return stack;
+            }
+        }
+        return std::make_unique<SocketApiStack>();
+    }
+
+    std::unique_ptr<BypassStack> stack_;
+    int recv_timeout_ms_;
+};
+
+} // namespace nfx
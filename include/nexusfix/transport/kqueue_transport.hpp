@@ -0,0 +1,321 @@
+#pragma once
+
+/// @file kqueue_transport.hpp
+/// @brief kqueue reactor and transport for macOS/BSD
+///
+/// KqueueReactor multiplexes many non-blocking sockets on one kqueue. Interest
+/// changes (add, remove, enabling write readiness) are only appended to a
+/// changelist; run_once() hands the whole changelist to the kernel and
+/// collects up to max_events ready sockets in the same kevent() call, so a
+/// thread driving N sessions makes one syscall per loop iteration instead of
+/// one poll() per socket per read. Filters are edge-triggered (EV_CLEAR) and
+/// report the bytes readable / writable, so handlers read until EAGAIN.
+///
+/// KqueueTransport is the single-socket ITransport on the same primitive: it
+/// tries recv()/send() first and waits in kevent() only when the socket would
+/// block, with its read filter registered once at connect time.
+
+#include "nexusfix/platform/platform.hpp"
+
+#if NFX_ASYNC_IO_KQUEUE
+
+#include "nexusfix/platform/socket_types.hpp"
+#include "nexusfix/platform/error_mapping.hpp"
+#include "nexusfix/transport/socket.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+
+#include <sys/event.h>
+#include <sys/time.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace nfx {
+
+// ============================================================================
+// Kqueue Reactor
+// ============================================================================
+
+/// One ready socket, as reported by KqueueReactor::run_once()
+struct KqueueEvent {
+    SocketHandle fd{INVALID_SOCKET_HANDLE};
+    void* context{nullptr};     // Value given to add()
+    bool readable{false};
+    bool writable{false};
+    bool eof{false};            // Peer closed its side (data may remain)
+    int error{0};               // Socket error reported with EOF, or change failure
+    int64_t available{0};       // Bytes readable / space writable
+};
+
+/// Multi-socket kqueue event loop with batched interest changes.
+/// Single-threaded: all calls from the thread running run_once().
+class KqueueReactor {
+public:
+    KqueueReactor() noexcept = default;
+
+    ~KqueueReactor() {
+        close();
+    }
+
+    // Non-copyable, non-movable
+    KqueueReactor(const KqueueReactor&) = delete;
+    KqueueReactor& operator=(const KqueueReactor&) = delete;
+
+    /// Create the kqueue
+    /// @param max_events Ready sockets collected per run_once()
+    [[nodiscard]] TransportResult<void> init(size_t max_events = 256) noexcept {
+        close();
+        kq_ = ::kqueue();
+        if (kq_ < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::KqueueError, errno}};
+        }
+        events_.resize(max_events > 0 ? max_events : 1);
+        changes_.reserve(events_.size());
+        return {};
+    }
+
+    void close() noexcept {
+        if (kq_ >= 0) {
+            ::close(kq_);
+            kq_ = -1;
+        }
+        changes_.clear();
+    }
+
+    [[nodiscard]] bool is_initialized() const noexcept { return kq_ >= 0; }
+
+    // ========================================================================
+    // Interest (queued; applied by the next run_once() or flush())
+    // ========================================================================
+
+    /// Watch a non-blocking socket; write readiness starts disabled
+    void add(SocketHandle fd, void* context = nullptr, bool want_write = false) noexcept {
+        queue(fd, EVFILT_READ, EV_ADD | EV_CLEAR, context);
+        queue(fd, EVFILT_WRITE, EV_ADD | EV_CLEAR | (want_write ? EV_ENABLE : EV_DISABLE), context);
+    }
+
+    /// Report write readiness (after a send would block) or stop doing so
+    void set_write_interest(SocketHandle fd, void* context, bool enable) noexcept {
+        queue(fd, EVFILT_WRITE, enable ? EV_ENABLE : EV_DISABLE, context);
+    }
+
+    /// Stop watching a socket; call before closing it
+    void remove(SocketHandle fd) noexcept {
+        queue(fd, EVFILT_READ, EV_DELETE, nullptr);
+        queue(fd, EVFILT_WRITE, EV_DELETE, nullptr);
+    }
+
+    /// Apply queued changes now without collecting events
+    [[nodiscard]] TransportResult<void> flush() noexcept {
+        if (changes_.empty()) return {};
+        const int n = ::kevent(kq_, changes_.data(), static_cast<int>(changes_.size()),
+                               nullptr, 0, nullptr);
+        changes_.clear();
+        if (n < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::KqueueError, errno}};
+        }
+        return {};
+    }
+
+    /// Changes waiting for the next kevent() call
+    [[nodiscard]] size_t pending_changes() const noexcept { return changes_.size(); }
+
+    // ========================================================================
+    // Event Loop
+    // ========================================================================
+
+    /// Submit queued changes and wait for ready sockets in one kevent() call;
+    /// handler(const KqueueEvent&) runs once per ready filter
+    /// @param timeout_ms -1 waits indefinitely, 0 polls
+    /// @return Events delivered (0 on timeout or EINTR)
+    template<typename Handler>
+    TransportResult<size_t> run_once(int timeout_ms, Handler&& handler) noexcept {
+        struct timespec ts{};
+        struct timespec* timeout = nullptr;
+        if (timeout_ms >= 0) {
+            ts.tv_sec = timeout_ms / 1000;
+            ts.tv_nsec = static_cast<long>(timeout_ms % 1000) * 1'000'000L;
+            timeout = &ts;
+        }
+
+        const int n = ::kevent(kq_, changes_.data(), static_cast<int>(changes_.size()),
+                               events_.data(), static_cast<int>(events_.size()), timeout);
+        changes_.clear();
+        ++syscalls_;
+        if (n < 0) {
+            if (errno == EINTR) return 0;
+            return std::unexpected{TransportError{TransportErrorCode::KqueueError, errno}};
+        }
+
+        size_t delivered = 0;
+        for (int i = 0; i < n; ++i) {
+            const struct kevent& ev = events_[static_cast<size_t>(i)];
+            KqueueEvent out;
+            out.fd = static_cast<SocketHandle>(ev.ident);
+            out.context = ev.udata;
+
+            if (ev.flags & EV_ERROR) {
+                // A change failed; removing an already-closed socket is expected
+                const int err = static_cast<int>(ev.data);
+                if (err == ENOENT || err == EBADF) continue;
+                out.error = err;
+            } else {
+                out.readable = ev.filter == EVFILT_READ;
+                out.writable = ev.filter == EVFILT_WRITE;
+                out.eof = (ev.flags & EV_EOF) != 0;
+                out.error = out.eof ? static_cast<int>(ev.fflags) : 0;
+                out.available = static_cast<int64_t>(ev.data);
+            }
+            handler(static_cast<const KqueueEvent&>(out));
+            ++delivered;
+        }
+        return delivered;
+    }
+
+    /// kevent() calls made by run_once()
+    [[nodiscard]] uint64_t syscalls() const noexcept { return syscalls_; }
+
+    [[nodiscard]] int fd() const noexcept { return kq_; }
+
+private:
+    void queue(SocketHandle fd, int16_t filter, uint16_t flags, void* context) noexcept {
+        // Keep the changelist within one kevent() call's event buffer so
+        // failed changes can still be reported
+        if (changes_.size() >= events_.size()) (void)flush();
+        struct kevent change;
+        EV_SET(&change, static_cast<uintptr_t>(fd), filter, flags, 0, 0, context);
+        changes_.push_back(change);
+    }
+
+    int kq_{-1};
+    std::vector<struct kevent> changes_;
+    std::vector<struct kevent> events_;
+    uint64_t syscalls_{0};
+};
+
+// ============================================================================
+// Kqueue Transport (implements ITransport)
+// ============================================================================
+
+/// TCP transport waiting in kevent() instead of poll() or blocking recv()
+class KqueueTransport : public ITransport {
+public:
+    KqueueTransport() noexcept = default;
+
+    /// Construct with options applied on connect; receive_mode is ignored
+    explicit KqueueTransport(const SocketOptions& options) noexcept
+        : socket_{options} {}
+
+    [[nodiscard]] TransportResult<void> connect(
+        std::string_view host,
+        uint16_t port) override
+    {
+        disconnect();
+        if (auto result = reactor_.init(4); !result) return result;
+        if (auto result = socket_.connect(host, port); !result) {
+            reactor_.close();
+            return result;
+        }
+        socket_.set_nonblocking(true);
+        reactor_.add(socket_.fd());
+        if (auto result = reactor_.flush(); !result) {
+            disconnect();
+            return result;
+        }
+        return {};
+    }
+
+    void disconnect() noexcept override {
+        socket_.close();      // Closing the socket drops its filters
+        reactor_.close();
+    }
+
+    [[nodiscard]] bool is_connected() const noexcept override {
+        return socket_.is_connected();
+    }
+
+    /// Send, waiting up to the send timeout once if the socket buffer is full
+    [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept override {
+        auto sent = socket_.send(data);
+        if (!sent || *sent > 0 || data.empty()) return sent;
+
+        reactor_.set_write_interest(socket_.fd(), nullptr, true);
+        const bool ready = wait_for(false, socket_.options().send_timeout_ms);
+        reactor_.set_write_interest(socket_.fd(), nullptr, false);
+        if (!ready) return 0;
+        return socket_.send(data);
+    }
+
+    /// Receive, sleeping in kevent() up to the receive timeout
+    /// @return Bytes received; 0 on timeout
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept override {
+        auto got = socket_.receive_once(buffer);
+        if (!got || *got > 0) return got;
+        // Edge-triggered: data arriving after that recv is still reported
+        if (!wait_for(true, socket_.options().recv_timeout_ms)) return 0;
+        return socket_.receive_once(buffer);
+    }
+
+    /// Gather-send header/body/trailer segments (see ScatterAssembler)
+    [[nodiscard]] TransportResult<size_t> send_segments(
+        std::span<const std::span<const char>> segments) noexcept
+    {
+        return socket_.send_segments(segments);
+    }
+
+    [[nodiscard]] bool set_nodelay(bool enable) noexcept override {
+        return socket_.set_nodelay(enable);
+    }
+
+    [[nodiscard]] bool set_keepalive(bool enable) noexcept override {
+        return socket_.set_keepalive(enable);
+    }
+
+    /// Bounds the kevent() wait in receive() (0 = wait indefinitely)
+    [[nodiscard]] bool set_receive_timeout(int milliseconds) noexcept override {
+        return socket_.set_receive_timeout(milliseconds);
+    }
+
+    [[nodiscard]] bool set_send_timeout(int milliseconds) noexcept override {
+        return socket_.set_send_timeout(milliseconds);
+    }
+
+    /// Get underlying socket
+    [[nodiscard]] TcpSocket& socket() noexcept { return socket_; }
+    [[nodiscard]] const TcpSocket& socket() const noexcept { return socket_; }
+
+    [[nodiscard]] const KqueueReactor& reactor() const noexcept { return reactor_; }
+
+private:
+    /// Wait until the socket is readable (or writable), closed, or timeout_ms
+    [[nodiscard]] bool wait_for(bool read, int timeout_ms) noexcept {
+        using Clock = std::chrono::steady_clock;
+        const bool bounded = timeout_ms > 0;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+
+        bool ready = false;
+        while (!ready) {
+            int left = -1;
+            if (bounded) {
+                left = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - Clock::now()).count());
+                if (left <= 0) return false;
+            }
+            auto n = reactor_.run_once(left, [&](const KqueueEvent& ev) {
+                // EOF or an error also ends the wait: the next call reports it
+                ready = ready || (read ? ev.readable : ev.writable) || ev.eof || ev.error != 0;
+            });
+            if (!n) return true;
+        }
+        return true;
+    }
+
+    TcpSocket socket_;
+    KqueueReactor reactor_;
+};
+
+} // namespace nfx
+
+#endif  // NFX_ASYNC_IO_KQUEUE
@@ -0,0 +1,445 @@
+#pragma once
+
+/// @file ktls_transport.hpp
+/// @brief FIX-over-TLS with the record layer in the kernel (kTLS)
+///
+/// The TLS handshake runs in userspace (OpenSSL); once it completes, the
+/// session keys are installed in the kernel (TCP_ULP "tls", TLS_TX/TLS_RX)
+/// and the socket carries plaintext from then on. Every existing send path
+/// keeps working unchanged: TcpSocket send()/sendmsg(), IoUringTransport
+/// fixed-buffer and batched sends, with no userspace copy into a TLS
+/// library. On NICs with TLS offload (e.g. ConnectX-6 Dx and later with
+/// tls-hw-tx-offload / tls-hw-rx-offload enabled), the kernel hands record
+/// crypto to the NIC automatically.
+///
+/// Requires NFX_ENABLE_KTLS (OpenSSL 3 built with kTLS support) and the
+/// kernel "tls" module. Only AES-GCM and ChaCha20-Poly1305 suites can be
+/// offloaded; the defaults below offer nothing else. A handshake that
+/// ends without offload fails, unless allow_userspace_fallback is set, in
+/// which case KtlsTransport encrypts through OpenSSL instead.
+///
+/// Usage (TcpSocket based):
+///     auto ctx = KtlsContext::create(TlsRole::Client, {.ca_file = "venue-ca.pem"});
+///     KtlsTransport transport{*ctx};
+///     transport.set_server_name("fix.venue.com");
+///     (void)transport.connect("fix.venue.com", 4443);
+///
+/// Usage (io_uring):
+///     KtlsSession tls;
+///     IoUringTransport transport{ring, {.kernel_tls = true}};
+///     transport.on_connect([&](int fd) { return tls.handshake(*ctx, fd, "fix.venue.com"); });
+
+#include "nexusfix/platform/platform.hpp"
+
+#if NFX_PLATFORM_LINUX && defined(NFX_HAS_KTLS) && NFX_HAS_KTLS
+
+#include "nexusfix/transport/socket.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+#include "nexusfix/transport/tls_record.hpp"
+
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+
+#include <poll.h>
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace nfx {
+
+// ============================================================================
+// TLS Configuration
+// ============================================================================
+
+/// Which end of the handshake this side plays
+enum class TlsRole : uint8_t {
+    Client,
+    Server
+};
+
+/// TLS settings shared by every session created from one KtlsContext
+struct KtlsConfig {
+    std::string_view ca_file{};        // Trust store (PEM); empty = system default paths
+    std::string_view cert_file{};      // Own certificate chain (PEM); required for servers
+    std::string_view key_file{};       // Private key for cert_file
+    bool verify_peer{true};            // Verify the peer's certificate (and host name for clients)
+    bool allow_tls13{true};            // TLS 1.3 RX offload needs kernel 5.x+; false caps at 1.2
+
+    /// TLS 1.2 suites; AEAD only, since only those can be offloaded
+    std::string_view cipher_list{
+        "ECDHE-ECDSA-AES128-GCM-SHA256:ECDHE-RSA-AES128-GCM-SHA256:"
+        "ECDHE-ECDSA-AES256-GCM-SHA384:ECDHE-RSA-AES256-GCM-SHA384:"
+        "ECDHE-ECDSA-CHACHA20-POLY1305:ECDHE-RSA-CHACHA20-POLY1305"};
+
+    int handshake_timeout_ms{5000};    // Bound on the whole handshake (non-blocking sockets too)
+    bool allow_userspace_fallback{false};  // Keep the session if the kernel refuses a direction
+};
+
+/// Which record directions the kernel handles
+struct KtlsStatus {
+    bool tx{false};
+    bool rx{false};
+
+    [[nodiscard]] constexpr bool offloaded() const noexcept { return tx && rx; }
+};
+
+namespace detail {
+
+/// Transport error carrying OpenSSL's last reason code
+[[nodiscard]] inline TransportError make_tls_error() noexcept {
+    const unsigned long err = ERR_get_error();
+    ERR_clear_error();
+    return TransportError{TransportErrorCode::TlsError, ERR_GET_REASON(err)};
+}
+
+} // namespace detail
+
+// ============================================================================
+// TLS Context
+// ============================================================================
+
+/// Owns the OpenSSL SSL_CTX (certificates, trust store, suites). Create
+/// once per role and configuration, at startup; sessions share it.
+class KtlsContext {
+public:
+    [[nodiscard]] static TransportResult<KtlsContext> create(TlsRole role,
+                                                             const KtlsConfig& config = {}) noexcept {
+        SSL_CTX* ctx = SSL_CTX_new(role == TlsRole::Client ? TLS_client_method() : TLS_server_method());
+        if (!ctx) return std::unexpected{detail::make_tls_error()};
+        KtlsContext result{ctx, role, config};
+
+        // Ask OpenSSL to install the keys in the kernel after the handshake
+        SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+        // Renegotiation would need new kernel keys mid-session
+        SSL_CTX_set_options(ctx, SSL_OP_NO_RENEGOTIATION);
+        (void)SSL_CTX_set_min_proto_version(ctx, TLS1_2_VERSION);
+        (void)SSL_CTX_set_max_proto_version(ctx, config.allow_tls13 ? TLS1_3_VERSION : TLS1_2_VERSION);
+
+        const std::string ciphers{config.cipher_list};
+        if (SSL_CTX_set_cipher_list(ctx, ciphers.c_str()) != 1) {
+            return std::unexpected{detail::make_tls_error()};
+        }
+
+        if (!config.cert_file.empty()) {
+            const std::string cert{config.cert_file};
+            const std::string key{config.key_file.empty() ? config.cert_file : config.key_file};
+            if (SSL_CTX_use_certificate_chain_file(ctx, cert.c_str()) != 1 ||
+                SSL_CTX_use_PrivateKey_file(ctx, key.c_str(), SSL_FILETYPE_PEM) != 1 ||
+                SSL_CTX_check_private_key(ctx) != 1) {
+                return std::unexpected{detail::make_tls_error()};
+            }
+        } else if (role == TlsRole::Server) {
+            return std::unexpected{TransportError{TransportErrorCode::TlsError, EINVAL}};
+        }
+
+        if (config.verify_peer) {
+            const bool loaded = config.ca_file.empty()
+                ? SSL_CTX_set_default_verify_paths(ctx) == 1
+                : SSL_CTX_load_verify_locations(ctx, std::string{config.ca_file}.c_str(), nullptr) == 1;
+            if (!loaded) return std::unexpected{detail::make_tls_error()};
+            SSL_CTX_set_verify(ctx, role == TlsRole::Client
+                ? SSL_VERIFY_PEER
+                : SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT, nullptr);
+        }
+        return result;
+    }
+
+    ~KtlsContext() {
+        if (ctx_) SSL_CTX_free(ctx_);
+    }
+
+    KtlsContext(const KtlsContext&) = delete;
+    KtlsContext& operator=(const KtlsContext&) = delete;
+
+    KtlsContext(KtlsContext&& other) noexcept
+        : ctx_{std::exchange(other.ctx_, nullptr)}
+        , role_{other.role_}
+        , config_{other.config_} {}
+
+    KtlsContext& operator=(KtlsContext&& other) noexcept {
+        if (this != &other) {
+            if (ctx_) SSL_CTX_free(ctx_);
+            ctx_ = std::exchange(other.ctx_, nullptr);
+            role_ = other.role_;
+            config_ = other.config_;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] SSL_CTX* native() const noexcept { return ctx_; }
+    [[nodiscard]] TlsRole role() const noexcept { return role_; }
+    [[nodiscard]] const KtlsConfig& config() const noexcept { return config_; }
+
+private:
+    KtlsContext(SSL_CTX* ctx, TlsRole role, const KtlsConfig& config) noexcept
+        : ctx_{ctx}, role_{role}, config_{config} {}
+
+    SSL_CTX* ctx_;
+    TlsRole role_;
+    KtlsConfig config_;   // Settings read after create(); string views are not kept alive
+};
+
+// ============================================================================
+// TLS Session
+// ============================================================================
+
+/// One TLS connection: runs the handshake on a connected socket and, once
+/// the kernel holds the keys, stays out of the data path. Keeps the SSL
+/// object for close_notify and for the userspace fallback.
+class KtlsSession {
+public:
+    KtlsSession() noexcept = default;
+
+    ~KtlsSession() { reset(); }
+
+    KtlsSession(const KtlsSession&) = delete;
+    KtlsSession& operator=(const KtlsSession&) = delete;
+
+    /// Handshake on a connected TCP socket (blocking or not), then move the
+    /// record layer into the kernel
+    /// @param server_name SNI and certificate host name (clients only)
+    [[nodiscard]] TransportResult<void> handshake(const KtlsContext& ctx, int fd,
+                                                  std::string_view server_name = {}) noexcept {
+        reset();
+        ssl_ = SSL_new(ctx.native());
+        if (!ssl_ || SSL_set_fd(ssl_, fd) != 1) return std::unexpected{detail::make_tls_error()};
+        fd_ = fd;
+
+        const KtlsConfig& config = ctx.config();
+        if (ctx.role() == TlsRole::Client) {
+            if (!server_name.empty()) {
+                const std::string name{server_name};
+                if (SSL_set_tlsext_host_name(ssl_, name.c_str()) != 1 ||
+                    (config.verify_peer && SSL_set1_host(ssl_, name.c_str()) != 1)) {
+                    return std::unexpected{detail::make_tls_error()};
+                }
+            }
+            SSL_set_connect_state(ssl_);
+        } else {
+            SSL_set_accept_state(ssl_);
+        }
+
+        if (auto done = drive([this] { return SSL_do_handshake(ssl_); }, config.handshake_timeout_ms);
+            !done) {
+            return std::unexpected{done.error()};
+        }
+
+        status_.tx = BIO_get_ktls_send(SSL_get_wbio(ssl_)) != 0;
+        status_.rx = BIO_get_ktls_recv(SSL_get_rbio(ssl_)) != 0;
+        if (!status_.offloaded() && !config.allow_userspace_fallback) {
+            return std::unexpected{TransportError{TransportErrorCode::TlsError, EOPNOTSUPP}};
+        }
+        return {};
+    }
+
+    /// Send close_notify (through the kernel when TX is offloaded)
+    void shutdown() noexcept {
+        if (ssl_) (void)SSL_shutdown(ssl_);
+    }
+
+    /// Free the SSL object; the socket is not closed
+    void reset() noexcept {
+        if (ssl_) SSL_free(ssl_);
+        ssl_ = nullptr;
+        fd_ = -1;
+        status_ = {};
+    }
+
+    [[nodiscard]] KtlsStatus status() const noexcept { return status_; }
+    [[nodiscard]] SSL* native() const noexcept { return ssl_; }
+
+    /// Negotiated protocol and suite, e.g. "TLSv1.3" / "TLS_AES_128_GCM_SHA256"
+    [[nodiscard]] std::string_view version() const noexcept {
+        return ssl_ ? SSL_get_version(ssl_) : std::string_view{};
+    }
+    [[nodiscard]] std::string_view cipher() const noexcept {
+        return ssl_ ? SSL_get_cipher_name(ssl_) : std::string_view{};
+    }
+
+    // ------------------------------------------------------------------------
+    // Userspace fallback (only used for directions the kernel refused)
+    // ------------------------------------------------------------------------
+
+    [[nodiscard]] TransportResult<size_t> write(std::span<const char> data) noexcept {
+        size_t written = 0;
+        const int ret = SSL_write_ex(ssl_, data.data(), data.size(), &written);
+        if (ret == 1) return written;
+        return result_of(ret, TransportErrorCode::WriteError);
+    }
+
+    [[nodiscard]] TransportResult<size_t> read(std::span<char> buffer) noexcept {
+        size_t read = 0;
+        const int ret = SSL_read_ex(ssl_, buffer.data(), buffer.size(), &read);
+        if (ret == 1) return read;
+        return result_of(ret, TransportErrorCode::ReadError);
+    }
+
+private:
+    /// Map an OpenSSL I/O failure: would-block is 0 bytes, as for sockets
+    [[nodiscard]] TransportResult<size_t> result_of(int ret, TransportErrorCode code) noexcept {
+        switch (SSL_get_error(ssl_, ret)) {
+            case SSL_ERROR_WANT_READ:
+            case SSL_ERROR_WANT_WRITE:
+                return size_t{0};
+            case SSL_ERROR_ZERO_RETURN:
+                return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+            case SSL_ERROR_SYSCALL:
+                ERR_clear_error();
+                return std::unexpected{TransportError{code, errno}};
+            default:
+                return std::unexpected{detail::make_tls_error()};
+        }
+    }
+
+    /// Repeat op until it succeeds, polling the socket while it would block
+    template<typename Op>
+    [[nodiscard]] TransportResult<void> drive(Op op, int timeout_ms) noexcept {
+        using Clock = std::chrono::steady_clock;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+        for (;;) {
+            const int ret = op();
+            if (ret == 1) return {};
+
+            short events = 0;
+            switch (SSL_get_error(ssl_, ret)) {
+                case SSL_ERROR_WANT_READ:
+                    events = POLLIN;
+                    break;
+                case SSL_ERROR_WANT_WRITE:
+                    events = POLLOUT;
+                    break;
+                case SSL_ERROR_SYSCALL:
+                    ERR_clear_error();
+                    return std::unexpected{TransportError{TransportErrorCode::ConnectionFailed, errno}};
+                default:
+                    return std::unexpected{detail::make_tls_error()};
+            }
+
+            const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - Clock::now()).count();
+            if (left <= 0) return std::unexpected{TransportError{TransportErrorCode::Timeout}};
+            struct pollfd pfd{fd_, events, 0};
+            if (::poll(&pfd, 1, static_cast<int>(left)) < 0 && errno != EINTR) {
+                return std::unexpected{TransportError{TransportErrorCode::SocketError, errno}};
+            }
+        }
+    }
+
+    SSL* ssl_{nullptr};
+    int fd_{-1};
+    KtlsStatus status_{};
+};
+
+// ============================================================================
+// kTLS Transport (implements ITransport)
+// ============================================================================
+
+/// TcpTransport with a TLS handshake on connect. With both directions in
+/// the kernel, send(), send_segments() and receive() are the plain socket
+/// calls; receive() reads through recvmsg() to consume TLS control records.
+class KtlsTransport : public ITransport {
+public:
+    explicit KtlsTransport(const KtlsContext& ctx, const SocketOptions& options = {}) noexcept
+        : ctx_{&ctx}, socket_{options} {}
+
+    ~KtlsTransport() override { disconnect(); }
+
+    /// SNI and verified host name; defaults to the host given to connect()
+    void set_server_name(std::string_view name) { server_name_ = name; }
+
+    [[nodiscard]] TransportResult<void> connect(std::string_view host, uint16_t port) override {
+        if (auto connected = socket_.connect(host, port); !connected) return connected;
+        return start(server_name_.empty() ? host : std::string_view{server_name_});
+    }
+
+    /// Take over a socket from TcpAcceptor::accept() and run the server
+    /// side of the handshake
+    [[nodiscard]] TransportResult<void> accept(SocketHandle fd) noexcept {
+        disconnect();
+        socket_.adopt(fd);
+        return start({});
+    }
+
+    void disconnect() noexcept override {
+        if (socket_.is_connected()) session_.shutdown();
+        session_.reset();
+        socket_.close();
+    }
+
+    [[nodiscard]] bool is_connected() const noexcept override {
+        return socket_.is_connected();
+    }
+
+    [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept override {
+        if (session_.status().tx) [[likely]] return socket_.send(data);
+        return session_.write(data);
+    }
+
+    /// Gather-send; one sendmsg() whose bytes the kernel frames into records
+    [[nodiscard]] TransportResult<size_t> send_segments(
+        std::span<const std::span<const char>> segments) noexcept
+    {
+        if (session_.status().tx) [[likely]] return socket_.send_segments(segments);
+        size_t total = 0;
+        for (const auto& seg : segments) {
+            auto sent = session_.write(seg);
+            if (!sent) return sent;
+            total += *sent;
+            if (*sent < seg.size()) break;
+        }
+        return total;
+    }
+
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept override {
+        if (session_.status().rx) [[likely]] return socket_.receive(buffer);
+        return session_.read(buffer);
+    }
+
+    [[nodiscard]] bool set_nodelay(bool enable) noexcept override {
+        return socket_.set_nodelay(enable);
+    }
+
+    [[nodiscard]] bool set_keepalive(bool enable) noexcept override {
+        return socket_.set_keepalive(enable);
+    }
+
+    [[nodiscard]] bool set_receive_timeout(int milliseconds) noexcept override {
+        return socket_.set_receive_timeout(milliseconds);
+    }
+
+    [[nodiscard]] bool set_send_timeout(int milliseconds) noexcept override {
+        return socket_.set_send_timeout(milliseconds);
+    }
+
+    [[nodiscard]] RxTimestamp last_rx_timestamp() const noexcept override {
+        return socket_.last_rx_timestamp();
+    }
+
+    /// Which directions the kernel handles for the current connection
+    [[nodiscard]] KtlsStatus ktls_status() const noexcept { return session_.status(); }
+
+    [[nodiscard]] KtlsSession& session() noexcept { return session_; }
+    [[nodiscard]] TcpSocket& socket() noexcept { return socket_; }
+
+private:
+    [[nodiscard]] TransportResult<void> start(std::string_view server_name) noexcept {
+        if (auto done = session_.handshake(*ctx_, socket_.fd(), server_name); !done) {
+            session_.reset();
+            socket_.close();
+            return done;
+        }
+        socket_.set_tls_records(session_.status().rx);
+        return {};
+    }
+
+    const KtlsContext* ctx_;
+    TcpSocket socket_;
+    KtlsSession session_;
+    std::string server_name_;
+};
+
+} // namespace nfx
+
+#endif // NFX_PLATFORM_LINUX && NFX_HAS_KTLS
@@ -0,0 +1,260 @@
+#pragma once
+
+/// @file line_arbitrator.hpp
+/// @brief A/B multicast line arbitration with gap detection
+///
+/// Exchanges publish every packet on two redundant lines. The arbitrator
+/// takes the first copy of each sequence number from whichever line
+/// delivers it, drops the second copy, and tracks holes that neither line
+/// has filled yet. Packets that arrive ahead of a hole are accepted at
+/// once and marked in a fixed bitmap window, so a loss on one line costs
+/// nothing while the other line covers it.
+///
+/// A hole that stays open past gap_timeout_ns (or trails the newest
+/// packet by more than max_gap_lag) is given up on: poll_gap() reports it
+/// with the recovery action to take (retransmission for short gaps, a
+/// snapshot for long ones) and moves on. The in-order path, where every
+/// packet is next or a duplicate, is two compares and never touches the
+/// bitmap. Nothing allocates.
+///
+/// Usage:
+///     LineArbitrator<> arb;
+///     arb.reset(1);
+///     line_a.poll([&](std::span<const Datagram> batch) {
+///         for (const Datagram& pkt : batch) {
+///             if (arb.on_packet(FeedLine::A, seq_of(pkt), now) == ArbitrationResult::Accept) {
+///                 handle(pkt);
+///             }
+///         }
+///     });
+///     // ... same for line_b with FeedLine::B
+///     while (auto gap = arb.poll_gap(now)) request_recovery(*gap);
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include "nexusfix/platform/platform.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Arbitration Types
+// ============================================================================
+
+/// Redundant feed line
+enum class FeedLine : uint8_t {
+    A = 0,
+    B = 1
+};
+
+/// Verdict on one packet
+enum class ArbitrationResult : uint8_t {
+    Accept,      // First copy: process it
+    Duplicate    // Already taken from either line, or inside a gap given up on
+};
+
+/// How to recover a given-up gap
+enum class RecoveryAction : uint8_t {
+    Retransmit,  // Request the missing range from the retransmission server
+    Snapshot     // Too much missed: rebuild from a snapshot, then reset()
+};
+
+/// Sequence range [begin, end) lost on both lines
+struct SequenceGap {
+    uint64_t begin{0};
+    uint64_t end{0};
+    RecoveryAction action{RecoveryAction::Retransmit};
+
+    [[nodiscard]] constexpr uint64_t size() const noexcept { return end - begin; }
+};
+
+/// Arbitration counters
+struct ArbitrationStats {
+    uint64_t accepted{0};
+    uint64_t duplicates{0};
+    uint64_t gaps{0};                           // Gaps reported by poll_gap()
+    uint64_t lost{0};                           // Sequence numbers in those gaps
+    std::array<uint64_t, 2> first_copies{};     // Accepted packets per line (which line is faster)
+};
+
+/// Recovery thresholds
+struct ArbitrationConfig {
+    int64_t gap_timeout_ns{1'000'000};  // Hole open this long is given up on
+    uint64_t max_gap_lag{1024};         // ... or once the newest packet is this far ahead
+    uint64_t snapshot_threshold{512};   // Gaps at least this long ask for a snapshot
+};
+
+// ============================================================================
+// Line Arbitrator
+// ============================================================================
+
+/// First-copy-wins arbitration of two lines carrying the same sequence space
+/// @tparam Window Sequence numbers tracked ahead of the oldest hole (power of 2)
+template <size_t Window = 4096>
+class LineArbitrator {
+    static_assert(Window >= 64 && std::has_single_bit(Window),
+                  "Window must be a power of two of at least 64");
+
+public:
+    static constexpr size_t WINDOW = Window;
+
+    explicit LineArbitrator(const ArbitrationConfig& config = {}) noexcept
+        : config_{config} {}
+
+    /// Start (or restart after a snapshot) expecting next_seq
+    void reset(uint64_t next_seq) noexcept {
+        next_ = next_seq;
+        high_ = next_seq;
+        bits_.fill(0);
+        pending_ = std::nullopt;
+    }
+
+    /// Arbitrate one packet
+    /// @param now_ns Receive time, used to age holes
+    [[nodiscard]] NFX_HOT ArbitrationResult on_packet(FeedLine line, uint64_t seq,
+                                                      int64_t now_ns) noexcept {
+        if (seq == next_ && high_ == next_) [[likely]] {
+            // In order with no hole behind: nothing to mark
+            ++next_;
+            ++high_;
+            return accept(line);
+        }
+        if (seq < next_) {
+            ++stats_.duplicates;
+            return ArbitrationResult::Duplicate;
+        }
+        return on_out_of_order(line, seq, now_ns);
+    }
+
+    /// Next gap to recover, if the oldest hole has timed out or fallen too
+    /// far behind; the arbitrator then continues past it
+    [[nodiscard]] std::optional<SequenceGap> poll_gap(int64_t now_ns) noexcept {
+        if (pending_) {
+            return std::exchange(pending_, std::nullopt);
+        }
+        if (high_ == next_) [[likely]] return std::nullopt;
+        if (now_ns - gap_since_ns_ < config_.gap_timeout_ns &&
+            high_ - next_ < config_.max_gap_lag) {
+            return std::nullopt;
+        }
+
+        // Holes behind the one given up keep its age, so a burst of
+        // losses drains in one poll_gap() loop
+        const int64_t since = gap_since_ns_;
+        const uint64_t end = next_received();
+        const SequenceGap gap = make_gap(next_, end);
+        next_ = end;
+        advance(now_ns);
+        gap_since_ns_ = since;
+        return gap;
+    }
+
+    /// Next sequence number not yet taken from either line
+    [[nodiscard]] uint64_t next_expected() const noexcept { return next_; }
+
+    /// One past the newest sequence number taken
+    [[nodiscard]] uint64_t highest() const noexcept { return high_; }
+
+    /// A hole is open (packets ahead of next_expected() were taken)
+    [[nodiscard]] bool has_gap() const noexcept { return high_ != next_; }
+
+    [[nodiscard]] const ArbitrationStats& stats() const noexcept { return stats_; }
+
+private:
+    static constexpr size_t WORDS = Window / 64;
+    static constexpr uint64_t MASK = Window - 1;
+
+    [[nodiscard]] ArbitrationResult accept(FeedLine line) noexcept {
+        ++stats_.accepted;
+        ++stats_.first_copies[static_cast<size_t>(line)];
+        return ArbitrationResult::Accept;
+    }
+
+    [[nodiscard]] bool test(uint64_t seq) const noexcept {
+        return (bits_[(seq & MASK) >> 6] >> (seq & 63)) & 1;
+    }
+
+    void set(uint64_t seq) noexcept { bits_[(seq & MASK) >> 6] |= uint64_t{1} << (seq & 63); }
+
+    void clear(uint64_t seq) noexcept { bits_[(seq & MASK) >> 6] &= ~(uint64_t{1} << (seq & 63)); }
+
+    [[nodiscard]] ArbitrationResult on_out_of_order(FeedLine line, uint64_t seq,
+                                                    int64_t now_ns) noexcept {
+        if (seq >= next_ + Window) [[unlikely]] {
+            // Too far ahead for the window: the range it pushes out is
+            // recovered from a snapshot (packets taken inside it included)
+            const uint64_t new_next = seq - Window + 1;
+            const uint64_t marked_end = new_next < high_ ? new_next : high_;
+            for (uint64_t s = next_; s < marked_end; ++s) clear(s);
+            if (pending_) {
+                stats_.lost += new_next - pending_->end;
+                pending_->end = new_next;
+            } else {
+                pending_ = make_gap(next_, new_next);
+            }
+            pending_->action = RecoveryAction::Snapshot;
+            next_ = new_next;
+            if (high_ < next_) high_ = next_;
+            advance(now_ns);
+        } else if (test(seq)) {
+            ++stats_.duplicates;
+            return ArbitrationResult::Duplicate;
+        }
+
+        if (seq == next_) {
+            ++next_;
+            advance(now_ns);
+        } else {
+            if (high_ == next_) gap_since_ns_ = now_ns;   // Hole opens
+            set(seq);
+        }
+        if (seq >= high_) high_ = seq + 1;
+        return accept(line);
+    }
+
+    /// Move next_ over packets already taken ahead of it
+    void advance(int64_t now_ns) noexcept {
+        const uint64_t before = next_;
+        while (next_ < high_ && test(next_)) {
+            clear(next_);
+            ++next_;
+        }
+        if (next_ != before && next_ != high_) gap_since_ns_ = now_ns;  // Next hole starts aging
+    }
+
+    /// First taken sequence number after next_ (high_ if none)
+    [[nodiscard]] uint64_t next_received() const noexcept {
+        uint64_t seq = next_ + 1;
+        while (seq < high_) {
+            const uint64_t word = bits_[(seq & MASK) >> 6] >> (seq & 63);
+            if (word != 0) {
+                const uint64_t found = seq + static_cast<uint64_t>(std::countr_zero(word));
+                return found < high_ ? found : high_;
+            }
+            seq += 64 - (seq & 63);
+        }
+        return high_;
+    }
+
+    [[nodiscard]] SequenceGap make_gap(uint64_t begin, uint64_t end) noexcept {
+        ++stats_.gaps;
+        stats_.lost += end - begin;
+        return SequenceGap{begin, end,
+                           end - begin >= config_.snapshot_threshold
+                               ? RecoveryAction::Snapshot : RecoveryAction::Retransmit};
+    }
+
+    ArbitrationConfig config_;
+    uint64_t next_{1};
+    uint64_t high_{1};
+    int64_t gap_since_ns_{0};
+    std::optional<SequenceGap> pending_{};
+    ArbitrationStats stats_{};
+    std::array<uint64_t, WORDS> bits_{};
+};
+
+} // namespace nfx
@@ -0,0 +1,390 @@
+#pragma once
+
+/// @file multicast_receiver.hpp
+/// @brief UDP multicast market data receiver with recvmmsg() batching (Linux)
+///
+/// Joins one or more multicast groups (any-source or source-specific) on a
+/// bound UDP socket and drains it with recvmmsg(): one system call returns
+/// up to batch_size datagrams, each in its own preallocated slot with its
+/// SO_TIMESTAMPING receive time. poll() hands the whole batch to a handler
+/// as a span; poll_sbe() and poll_fix() run every datagram through
+/// sbe::dispatch() or the FIX parser in place, so the payload is never
+/// copied out of the receive slots.
+///
+/// Kernel-side drops (socket buffer overruns) are reported through
+/// SO_RXQ_OVFL and show up in stats().kernel_drops.
+///
+/// Usage:
+///     MulticastReceiver feed;
+///     MulticastConfig config;
+///     config.group = "239.1.1.1";
+///     config.port = 30001;
+///     config.interface_addr = "10.0.0.5";
+///     if (!feed.open(config)) { ... }
+///     while (running) {
+///         (void)feed.poll_sbe([&](auto& codec, const Datagram& pkt) { ... });
+///     }
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/platform/socket_types.hpp"
+#include "nexusfix/platform/error_mapping.hpp"
+#include "nexusfix/transport/rx_timestamp.hpp"
+#include "nexusfix/types/error.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/sbe/sbe.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if NFX_PLATFORM_LINUX
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Multicast Types
+// ============================================================================
+
+/// Socket and batching parameters of a MulticastReceiver (the address
+/// strings are only read by open())
+struct MulticastConfig {
+    std::string_view group;                      // Group to join on open() (empty = plain UDP)
+    uint16_t port{0};                            // Local port (0 = ephemeral)
+    std::string_view interface_addr{"0.0.0.0"};  // Local interface address for the join
+    std::string_view source;                     // SSM source address (empty = any source)
+    size_t batch_size{64};                       // Datagrams per recvmmsg()
+    size_t max_datagram{2048};                   // Slot size; longer datagrams are truncated
+    int receive_buffer_bytes{0};                 // SO_RCVBUF (0 = kernel default)
+    int busy_poll_us{0};                         // SO_BUSY_POLL (0 = off)
+    RxTimestampMode rx_timestamps{RxTimestampMode::Software};
+    bool blocking{false};                        // Block in poll() until one datagram arrives
+};
+
+/// One received datagram; data points into the receiver's slot and stays
+/// valid until the next poll
+struct Datagram {
+    std::span<const char> data;
+    RxTimestamp rx_ts;           // Kernel/NIC receive time (invalid if timestamps are off)
+    bool truncated{false};       // Longer than max_datagram; data holds the prefix
+};
+
+/// Receive counters
+struct MulticastStats {
+    uint64_t packets{0};
+    uint64_t bytes{0};
+    uint64_t batches{0};         // recvmmsg() calls that returned data
+    uint64_t truncated{0};
+    uint64_t kernel_drops{0};    // Socket buffer overruns (SO_RXQ_OVFL), cumulative
+    uint64_t parse_errors{0};    // Malformed FIX messages skipped by poll_fix()
+};
+
+#if NFX_PLATFORM_LINUX
+
+// ============================================================================
+// Multicast Receiver
+// ============================================================================
+
+/// Batched UDP multicast receiver; one instance per feed and thread
+class MulticastReceiver {
+public:
+    /// Control space per slot: SCM_TIMESTAMPING plus the SO_RXQ_OVFL counter
+    static constexpr size_t CONTROL_SIZE = RX_TIMESTAMP_CONTROL_SIZE + CMSG_SPACE(sizeof(uint32_t));
+
+    MulticastReceiver() noexcept = default;
+
+    ~MulticastReceiver() { close(); }
+
+    MulticastReceiver(const MulticastReceiver&) = delete;
+    MulticastReceiver& operator=(const MulticastReceiver&) = delete;
+
+    /// Create, configure and bind the socket, join config.group if set,
+    /// and allocate the receive slots
+    [[nodiscard]] TransportResult<void> open(const MulticastConfig& config) {
+        close();
+        config_ = config;
+        if (config_.batch_size == 0 || config_.max_datagram == 0) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+        }
+
+        fd_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, IPPROTO_UDP);
+        if (!is_valid_socket(fd_)) {
+            return fail(make_socket_error());
+        }
+
+        const int one = 1;
+        const int zero = 0;
+        (void)::setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        (void)::setsockopt(fd_, SOL_SOCKET, SO_RXQ_OVFL, &one, sizeof(one));
+        // Only datagrams of groups this socket joined, not every group on the port
+        (void)::setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_ALL, &zero, sizeof(zero));
+        if (config_.receive_buffer_bytes > 0) {
+            (void)::setsockopt(fd_, SOL_SOCKET, SO_RCVBUF,
+                               &config_.receive_buffer_bytes, sizeof(config_.receive_buffer_bytes));
+        }
+        if (config_.busy_poll_us > 0) {
+            (void)::setsockopt(fd_, SOL_SOCKET, SO_BUSY_POLL,
+                               &config_.busy_poll_us, sizeof(config_.busy_poll_us));
+        }
+        if (config_.rx_timestamps != RxTimestampMode::Off) {
+            (void)enable_rx_timestamping(fd_, config_.rx_timestamps);
+        }
+
+        // Bound to the group address, the socket sees no unicast traffic;
+        // without config.group it binds the wildcard and join() adds groups
+        sockaddr_in local{};
+        local.sin_family = AF_INET;
+        local.sin_port = htons(config_.port);
+        local.sin_addr.s_addr = htonl(INADDR_ANY);
+        if (!config_.group.empty() && !parse_address(config_.group, local.sin_addr)) {
+            return fail(TransportError{TransportErrorCode::AddressResolutionFailed});
+        }
+        if (::bind(fd_, reinterpret_cast<const sockaddr*>(&local), sizeof(local)) != 0) {
+            return fail(make_socket_error());
+        }
+
+        if (!config_.group.empty()) {
+            if (auto joined = join(config_.group, config_.interface_addr, config_.source); !joined) {
+                return fail(joined.error());
+            }
+        }
+
+        allocate_slots();
+        return {};
+    }
+
+    /// Join a group (source-specific when source is set)
+    [[nodiscard]] TransportResult<void> join(std::string_view group,
+                                             std::string_view interface_addr = "0.0.0.0",
+                                             std::string_view source = {}) noexcept {
+        return membership(group, interface_addr, source, true);
+    }
+
+    /// Leave a group joined with the same arguments
+    [[nodiscard]] TransportResult<void> leave(std::string_view group,
+                                              std::string_view interface_addr = "0.0.0.0",
+                                              std::string_view source = {}) noexcept {
+        return membership(group, interface_addr, source, false);
+    }
+
+    /// Close the socket (memberships are dropped with it)
+    void close() noexcept {
+        if (is_valid_socket(fd_)) {
+            close_socket(fd_);
+            fd_ = INVALID_SOCKET_HANDLE;
+        }
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return is_valid_socket(fd_); }
+    [[nodiscard]] SocketHandle fd() const noexcept { return fd_; }
+    [[nodiscard]] const MulticastStats& stats() const noexcept { return stats_; }
+
+    /// Header field order poll_fix() learned from the feed (hits()/misses())
+    [[nodiscard]] const HeaderLayout& header_layout() const noexcept { return header_layout_; }
+
+    /// Port the socket is bound to (the ephemeral one when config.port was 0)
+    [[nodiscard]] uint16_t local_port() const noexcept {
+        sockaddr_in addr{};
+        socklen_t len = sizeof(addr);
+        if (::getsockname(fd_, reinterpret_cast<sockaddr*>(&addr), &len) != 0) return 0;
+        return ntohs(addr.sin_port);
+    }
+
+    // ========================================================================
+    // Receive
+    // ========================================================================
+
+    /// One recvmmsg(): handler(std::span<const Datagram>) sees every
+    /// datagram it returned
+    /// @return Datagrams received (0 if none were waiting)
+    template <typename Handler>
+    [[nodiscard]] NFX_HOT TransportResult<size_t> poll(Handler&& handler) {
+        auto received = receive_batch();
+        if (received && *received > 0) [[likely]] {
+            handler(std::span<const Datagram>{datagrams_.data(), *received});
+        }
+        return received;
+    }
+
+    /// One recvmmsg(), each datagram decoded with sbe::dispatch():
+    /// handler(auto& codec, const Datagram&)
+    template <typename Handler>
+    [[nodiscard]] NFX_HOT TransportResult<size_t> poll_sbe(Handler&& handler) {
+        return poll([&handler](std::span<const Datagram> batch) {
+            for (const Datagram& pkt : batch) {
+                sbe::dispatch(pkt.data, [&handler, &pkt](auto& codec) { handler(codec, pkt); });
+            }
+        });
+    }
+
+    /// One recvmmsg(), every FIX message of each datagram parsed in place:
+    /// handler(const ParsedMessage&, const Datagram&). Malformed messages
+    /// are skipped and counted in stats().parse_errors. Headers are read
+    /// along the feed's learned field order (header_layout()).
+    template <ChecksumPolicy Policy = ChecksumPolicy::Validate, typename Handler>
+    [[nodiscard]] NFX_HOT TransportResult<size_t> poll_fix(Handler&& handler) {
+        return poll([this, &handler](std::span<const Datagram> batch) {
+            for (const Datagram& pkt : batch) {
+                size_t pos = 0;
+                while (pos < pkt.data.size()) {
+                    const simd::MessageBoundary boundary = simd::find_message_boundary(pkt.data, pos);
+                    if (!boundary.complete) break;
+                    if (parsed_.template assign<Policy>(boundary.slice(pkt.data), header_layout_)) [[likely]] {
+                        handler(static_cast<const ParsedMessage&>(parsed_), pkt);
+                    } else {
+                        ++stats_.parse_errors;
+                    }
+                    pos = boundary.end;
+                }
+            }
+        });
+    }
+
+private:
+    [[nodiscard]] static bool parse_address(std::string_view text, in_addr& out) noexcept {
+        char buf[INET_ADDRSTRLEN];
+        if (text.size() >= sizeof(buf)) return false;
+        std::memcpy(buf, text.data(), text.size());
+        buf[text.size()] = '\0';
+        return ::inet_pton(AF_INET, buf, &out) == 1;
+    }
+
+    [[nodiscard]] TransportResult<void> membership(std::string_view group,
+                                                   std::string_view interface_addr,
+                                                   std::string_view source, bool add) noexcept {
+        if (!is_valid_socket(fd_)) {
+            return std::unexpected{TransportError{TransportErrorCode::NotConnected}};
+        }
+        in_addr group_addr{};
+        in_addr iface{};
+        if (!parse_address(group, group_addr) || !parse_address(interface_addr, iface)) {
+            return std::unexpected{TransportError{TransportErrorCode::AddressResolutionFailed}};
+        }
+
+        int rc;
+        if (source.empty()) {
+            ip_mreq mreq{};
+            mreq.imr_multiaddr = group_addr;
+            mreq.imr_interface = iface;
+            rc = ::setsockopt(fd_, IPPROTO_IP, add ? IP_ADD_MEMBERSHIP : IP_DROP_MEMBERSHIP,
+                              &mreq, sizeof(mreq));
+        } else {
+            ip_mreq_source mreq{};
+            if (!parse_address(source, mreq.imr_sourceaddr)) {
+                return std::unexpected{TransportError{TransportErrorCode::AddressResolutionFailed}};
+            }
+            mreq.imr_multiaddr = group_addr;
+            mreq.imr_interface = iface;
+            rc = ::setsockopt(fd_, IPPROTO_IP,
+                              add ? IP_ADD_SOURCE_MEMBERSHIP : IP_DROP_SOURCE_MEMBERSHIP,
+                              &mreq, sizeof(mreq));
+        }
+        if (rc != 0) {
+            return std::unexpected{make_socket_error()};
+        }
+        return {};
+    }
+
+    [[nodiscard]] TransportResult<void> fail(const TransportError& error) noexcept {
+        close();
+        return std::unexpected{error};
+    }
+
+    /// Slots are allocated once here; poll() only re-arms lengths
+    void allocate_slots() {
+        const size_t n = config_.batch_size;
+        buffers_.assign(n * config_.max_datagram, '\0');
+        control_.assign(n, ControlSlot{});
+        iovecs_.resize(n);
+        headers_.resize(n);
+        datagrams_.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            iovecs_[i].iov_base = buffers_.data() + i * config_.max_datagram;
+            iovecs_[i].iov_len = config_.max_datagram;
+            headers_[i] = mmsghdr{};
+            headers_[i].msg_hdr.msg_iov = &iovecs_[i];
+            headers_[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    [[nodiscard]] NFX_HOT TransportResult<size_t> receive_batch() noexcept {
+        if (!is_valid_socket(fd_)) [[unlikely]] {
+            return std::unexpected{TransportError{TransportErrorCode::NotConnected}};
+        }
+
+        const size_t n = headers_.size();
+        for (size_t i = 0; i < n; ++i) {
+            msghdr& hdr = headers_[i].msg_hdr;
+            hdr.msg_control = control_[i].bytes;
+            hdr.msg_controllen = sizeof(control_[i].bytes);
+            hdr.msg_flags = 0;
+        }
+
+        const int flags = config_.blocking ? MSG_WAITFORONE : MSG_DONTWAIT;
+        const int received = ::recvmmsg(fd_, headers_.data(), static_cast<unsigned>(n), flags, nullptr);
+        if (received < 0) [[unlikely]] {
+            const int err = get_last_socket_error();
+            if (is_would_block_error(err) || err == EINTR) return 0;
+            return std::unexpected{make_socket_error(err)};
+        }
+
+        const size_t count = static_cast<size_t>(received);
+        for (size_t i = 0; i < count; ++i) {
+            const msghdr& hdr = headers_[i].msg_hdr;
+            const size_t len = std::min<size_t>(headers_[i].msg_len, config_.max_datagram);
+            Datagram& pkt = datagrams_[i];
+            pkt.data = {static_cast<const char*>(iovecs_[i].iov_base), len};
+            pkt.truncated = (hdr.msg_flags & MSG_TRUNC) != 0;
+            pkt.rx_ts = config_.rx_timestamps != RxTimestampMode::Off
+                ? extract_rx_timestamp(hdr) : RxTimestamp{};
+            read_drop_counter(hdr);
+
+            stats_.bytes += len;
+            stats_.truncated += pkt.truncated;
+        }
+        if (count > 0) {
+            stats_.packets += count;
+            ++stats_.batches;
+        }
+        return count;
+    }
+
+    /// SO_RXQ_OVFL carries the socket's cumulative drop count
+    void read_drop_counter(const msghdr& hdr) noexcept {
+        for (cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr;
+             cmsg = CMSG_NXTHDR(const_cast<msghdr*>(&hdr), cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL) {
+                uint32_t drops;
+                std::memcpy(&drops, CMSG_DATA(cmsg), sizeof(drops));
+                stats_.kernel_drops = drops;
+            }
+        }
+    }
+
+    struct ControlSlot {
+        alignas(cmsghdr) char bytes[CONTROL_SIZE];
+    };
+
+    SocketHandle fd_{INVALID_SOCKET_HANDLE};
+    MulticastConfig config_{};
+    MulticastStats stats_{};
+    std::vector<char> buffers_;
+    std::vector<ControlSlot> control_;
+    std::vector<iovec> iovecs_;
+    std::vector<mmsghdr> headers_;
+    std::vector<Datagram> datagrams_;
+    ParsedMessage parsed_{};      // poll_fix() parses into this in place
+    HeaderLayout header_layout_{};
+};
+
+#endif // NFX_PLATFORM_LINUX
+
+} // namespace nfx
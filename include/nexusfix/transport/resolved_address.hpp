@@ -0,0 +1,193 @@
+#pragma once
+
+/// @file resolved_address.hpp
+/// @brief Resolved IPv4 endpoints and a small resolution cache
+///
+/// getaddrinfo() can take milliseconds (or block on a slow resolver) and
+/// sits on the reconnect path of every transport. Resolve once, keep the
+/// sockaddr, and connect to it directly: TcpSocket::connect(ResolvedAddress),
+/// IoUringTransport::connect(ResolvedAddress) and StandbyConnections take
+/// one.
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/platform/socket_types.hpp"
+#include "nexusfix/platform/error_mapping.hpp"
+#include "nexusfix/types/error.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+
+namespace nfx {
+
+// ============================================================================
+// Resolved Address
+// ============================================================================
+
+/// IPv4 socket address ready for ::connect()
+struct ResolvedAddress {
+    struct sockaddr_in addr{};
+
+    [[nodiscard]] const struct sockaddr* data() const noexcept {
+        return reinterpret_cast<const struct sockaddr*>(&addr);
+    }
+
+    [[nodiscard]] static constexpr SocketLength size() noexcept {
+        return static_cast<SocketLength>(sizeof(struct sockaddr_in));
+    }
+
+    [[nodiscard]] uint16_t port() const noexcept { return ntohs(addr.sin_port); }
+
+    [[nodiscard]] bool valid() const noexcept { return addr.sin_family == AF_INET; }
+
+    [[nodiscard]] bool operator==(const ResolvedAddress& other) const noexcept {
+        return addr.sin_addr.s_addr == other.addr.sin_addr.s_addr &&
+               addr.sin_port == other.addr.sin_port;
+    }
+};
+
+/// Resolve host:port to its first IPv4 address (getaddrinfo)
+[[nodiscard]] inline TransportResult<ResolvedAddress> resolve_address(
+    std::string_view host,
+    uint16_t port) noexcept
+{
+    struct addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    char port_str[8];
+    std::snprintf(port_str, sizeof(port_str), "%u", port);
+
+    // Need null-terminated string for getaddrinfo
+    char host_buf[256];
+    size_t host_len = std::min(host.size(), sizeof(host_buf) - 1);
+    std::memcpy(host_buf, host.data(), host_len);
+    host_buf[host_len] = '\0';
+
+    struct addrinfo* result = nullptr;
+    int ret = ::getaddrinfo(host_buf, port_str, &hints, &result);
+    if (ret != 0) {
+        return std::unexpected{make_gai_error(ret)};
+    }
+
+    ResolvedAddress resolved;
+    std::memcpy(&resolved.addr, result->ai_addr,
+                std::min(sizeof(resolved.addr), static_cast<size_t>(result->ai_addrlen)));
+    ::freeaddrinfo(result);
+    return resolved;
+}
+
+// ============================================================================
+// Address Cache
+// ============================================================================
+
+/// host:port -> ResolvedAddress, refreshed after a TTL
+///
+/// A few gateways per process: a fixed table with linear lookup, the
+/// least recently resolved entry replaced when it is full. Not thread-safe;
+/// keep one per session thread.
+class AddressCache {
+public:
+    static constexpr size_t CAPACITY = 16;
+    static constexpr size_t MAX_HOST_LENGTH = 63;
+
+    using Clock = std::chrono::steady_clock;
+
+    /// @param ttl How long a resolution is reused (zero = until invalidated)
+    explicit AddressCache(std::chrono::milliseconds ttl = std::chrono::minutes{5}) noexcept
+        : ttl_{ttl} {}
+
+    /// Cached address for host:port, resolving on a miss or once the TTL
+    /// has passed. If a refresh fails the stale address is kept and
+    /// returned: a reconnect should not fail on a resolver outage.
+    [[nodiscard]] TransportResult<ResolvedAddress> resolve(
+        std::string_view host,
+        uint16_t port) noexcept
+    {
+        const auto now = Clock::now();
+        Entry* entry = find(host, port);
+        if (entry && (ttl_.count() == 0 || now - entry->resolved_at < ttl_)) {
+            ++hits_;
+            return entry->address;
+        }
+
+        ++misses_;
+        auto fresh = resolve_address(host, port);
+        if (!fresh) {
+            if (entry) return entry->address;
+            return fresh;
+        }
+        if (!entry) entry = slot_for(host, port);
+        if (entry) {
+            entry->address = *fresh;
+            entry->resolved_at = now;
+        }
+        return fresh;
+    }
+
+    /// Drop host:port so the next resolve() asks the resolver, e.g. after
+    /// connect() to the cached address failed
+    void invalidate(std::string_view host, uint16_t port) noexcept {
+        if (Entry* entry = find(host, port)) {
+            entry->host_len = 0;
+            entry->port = 0;
+        }
+    }
+
+    void clear() noexcept {
+        for (auto& entry : entries_) {
+            entry.host_len = 0;
+            entry.port = 0;
+        }
+    }
+
+    [[nodiscard]] uint64_t hits() const noexcept { return hits_; }
+    [[nodiscard]] uint64_t misses() const noexcept { return misses_; }
+
+private:
+    struct Entry {
+        std::array<char, MAX_HOST_LENGTH> host{};
+        uint8_t host_len{0};
+        uint16_t port{0};   // 0 = free
+        ResolvedAddress address;
+        Clock::time_point resolved_at{};
+    };
+
+    [[nodiscard]] Entry* find(std::string_view host, uint16_t port) noexcept {
+        for (auto& entry : entries_) {
+            if (entry.port == port && port != 0 &&
+                std::string_view{entry.host.data(), entry.host_len} == host) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    /// A free entry, else the oldest; nullptr for hosts too long to cache
+    [[nodiscard]] Entry* slot_for(std::string_view host, uint16_t port) noexcept {
+        if (host.size() > MAX_HOST_LENGTH || port == 0) return nullptr;
+        Entry* slot = &entries_[0];
+        for (auto& entry : entries_) {
+            if (entry.port == 0) {
+                slot = &entry;
+                break;
+            }
+            if (entry.resolved_at < slot->resolved_at) slot = &entry;
+        }
+        std::memcpy(slot->host.data(), host.data(), host.size());
+        slot->host_len = static_cast<uint8_t>(host.size());
+        slot->port = port;
+        return slot;
+    }
+
+    std::array<Entry, CAPACITY> entries_{};
+    std::chrono::milliseconds ttl_;
+    uint64_t hits_{0};
+    uint64_t misses_{0};
+};
+
+} // namespace nfx
@@ -0,0 +1,120 @@
+#pragma once
+
+/// @file rx_timestamp.hpp
+/// @brief Per-receive kernel/NIC timestamps (SO_TIMESTAMPING)
+///
+/// Software timestamps are taken when the kernel receives the packet
+/// (CLOCK_REALTIME). Hardware timestamps come from the NIC's PTP clock and
+/// additionally require the NIC to be configured with
+/// enable_nic_rx_timestamping() (CAP_NET_ADMIN). For TCP, the timestamp of a
+/// recvmsg() is that of the most recent segment whose data was returned.
+
+#include "nexusfix/platform/platform.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if NFX_PLATFORM_LINUX
+    #include <linux/errqueue.h>
+    #include <linux/net_tstamp.h>
+    #include <linux/sockios.h>
+    #include <net/if.h>
+    #include <sys/ioctl.h>
+    #include <sys/socket.h>
+    #include <time.h>
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// Receive Timestamp Types
+// ============================================================================
+
+/// Which timestamps a socket should request
+enum class RxTimestampMode : uint8_t {
+    Off,        // No timestamping (default, no recvmsg overhead)
+    Software,   // Kernel receive time
+    Hardware    // NIC time, software as fallback when the NIC gives none
+};
+
+/// Origin of a delivered timestamp
+enum class RxTimestampSource : uint8_t {
+    None,
+    Software,
+    Hardware
+};
+
+/// Receive timestamp attached to the data returned by one receive call
+struct RxTimestamp {
+    int64_t ns{0};                                   // Nanoseconds since epoch of the source clock
+    RxTimestampSource source{RxTimestampSource::None};
+
+    [[nodiscard]] constexpr bool valid() const noexcept {
+        return source != RxTimestampSource::None;
+    }
+};
+
+#if NFX_PLATFORM_LINUX
+
+// ============================================================================
+// SO_TIMESTAMPING Helpers (Linux)
+// ============================================================================
+
+/// Control buffer size needed by recvmsg() to carry SCM_TIMESTAMPING
+inline constexpr size_t RX_TIMESTAMP_CONTROL_SIZE = CMSG_SPACE(sizeof(scm_timestamping));
+
+/// Request receive timestamps on a socket
+/// @return false if the kernel refuses (mode Off always succeeds)
+[[nodiscard]] inline bool enable_rx_timestamping(int fd, RxTimestampMode mode) noexcept {
+    int flags = 0;
+    if (mode != RxTimestampMode::Off) {
+        flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+    }
+    if (mode == RxTimestampMode::Hardware) {
+        flags |= SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+    }
+    return ::setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0;
+}
+
+/// Turn on NIC hardware RX timestamping for all packets on an interface
+/// (SIOCSHWTSTAMP). Needs CAP_NET_ADMIN; affects every socket on the NIC.
+[[nodiscard]] inline bool enable_nic_rx_timestamping(int fd, std::string_view interface_name) noexcept {
+    hwtstamp_config config{};
+    config.tx_type = HWTSTAMP_TX_OFF;
+    config.rx_filter = HWTSTAMP_FILTER_ALL;
+
+    ifreq ifr{};
+    std::memcpy(ifr.ifr_name, interface_name.data(),
+                interface_name.size() < IFNAMSIZ ? interface_name.size() : IFNAMSIZ - 1);
+    ifr.ifr_data = reinterpret_cast<char*>(&config);
+    return ::ioctl(fd, SIOCSHWTSTAMP, &ifr) == 0;
+}
+
+/// Pull the SCM_TIMESTAMPING control message out of a recvmsg() result.
+/// Prefers the raw hardware stamp, falls back to software.
+[[nodiscard]] inline RxTimestamp extract_rx_timestamp(const msghdr& msg) noexcept {
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(const_cast<msghdr*>(&msg), cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_TIMESTAMPING) {
+            continue;
+        }
+        scm_timestamping ts;
+        std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+
+        auto to_ns = [](const timespec& t) noexcept {
+            return static_cast<int64_t>(t.tv_sec) * 1'000'000'000 + t.tv_nsec;
+        };
+        if (ts.ts[2].tv_sec != 0 || ts.ts[2].tv_nsec != 0) {
+            return RxTimestamp{to_ns(ts.ts[2]), RxTimestampSource::Hardware};
+        }
+        if (ts.ts[0].tv_sec != 0 || ts.ts[0].tv_nsec != 0) {
+            return RxTimestamp{to_ns(ts.ts[0]), RxTimestampSource::Software};
+        }
+    }
+    return RxTimestamp{};
+}
+
+#endif // NFX_PLATFORM_LINUX
+
+} // namespace nfx
@@ -0,0 +1,988 @@
+#pragma once
+
+/// @file shm_transport.hpp
+/// @brief Shared-memory IPC between the FIX engine and strategy processes
+///
+/// A ShmRing is a single-producer, multi-consumer byte ring in a POSIX
+/// shared-memory object (/dev/shm on Linux). Records carry a raw FIX or SBE
+/// message plus metadata (session, MsgSeqNum, timestamp) and are read in
+/// place. As with memory::BroadcastRing, every subscriber sees every record
+/// and the slowest attached subscriber gates the producer.
+///
+/// Publishing is a bounds check against a cached gate, one memcpy and one
+/// release store, the same work as an in-process SPSCQueue push. With
+/// futex wakeup enabled, idle subscribers park on a process-shared futex
+/// and publish() adds a fence and one load while nobody is parked.
+///
+/// - ShmPublisher / ShmSubscriber: fan-out API (engine -> N strategies)
+/// - ShmTransport: ITransport over a pair of rings, one per direction, so
+///   a SessionManager can talk to a process on the same host
+///
+/// Usage:
+///     // Engine
+///     auto feed = ShmPublisher::create("md", {.capacity = 1 << 22});
+///     feed->publish(ShmPayload::Sbe, encoded, {.session_id = 1, .timestamp_ns = rx.ns});
+///
+///     // Strategy process
+///     auto sub = ShmSubscriber::attach("md");
+///     sub->poll([](const ShmMessage& m) { on_market_data(m.payload); });
+///
+/// Fault isolation: a crashed subscriber keeps its slot and gates the
+/// producer until detach_dead() (pid check) or detach_slow() frees it.
+/// Both sides must run the same build: the layout is checked by version.
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/memory/cache_line.hpp"
+#include "nexusfix/memory/wait_strategy.hpp"
+#include "nexusfix/transport/socket.hpp"
+#include "nexusfix/types/error.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <new>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#if NFX_PLATFORM_POSIX
+    #include <cerrno>
+    #include <csignal>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #if NFX_PLATFORM_LINUX
+        #include <climits>
+        #include <linux/futex.h>
+        #include <sys/syscall.h>
+    #endif
+    #define NFX_SHM_AVAILABLE 1
+#else
+    #define NFX_SHM_AVAILABLE 0
+#endif
+
+namespace nfx {
+
+#if NFX_SHM_AVAILABLE
+
+// ============================================================================
+// Messages
+// ============================================================================
+
+/// Record payload kind
+enum class ShmPayload : uint16_t {
+    Padding = 0,  // Internal: skip to the end of the ring
+    Fix = 1,      // Tag=value FIX message
+    Sbe = 2,      // SBE-encoded message
+    User = 3      // Application-defined (first of the user range)
+};
+
+/// Metadata carried with every record
+struct ShmMeta {
+    uint16_t session_id{0};
+    uint32_t seq_num{0};       // MsgSeqNum, or 0
+    uint64_t timestamp_ns{0};  // e.g. RxTimestamp::ns of the original message
+};
+
+/// Record delivered to subscribers, valid until the handler returns
+struct ShmMessage {
+    ShmPayload kind;
+    ShmMeta meta;
+    std::span<const char> payload;
+    uint64_t position;  // Byte position of the record in the stream
+};
+
+/// Ring creation parameters
+struct ShmRingConfig {
+    size_t capacity{1 << 20};  // Data bytes (power of 2; max record is capacity / 2)
+    bool futex_wakeup{true};   // Let idle subscribers park (else they spin/yield)
+};
+
+inline constexpr size_t SHM_MAX_SUBSCRIBERS = 8;
+
+// ============================================================================
+// Shared Layout
+// ============================================================================
+
+namespace shm_detail {
+
+inline constexpr uint64_t MAGIC = 0x4E46585F53484D31ULL;  // "NFX_SHM1"
+inline constexpr uint32_t VERSION = 1;
+inline constexpr uint64_t DETACHED = ~uint64_t{0};
+inline constexpr size_t RECORD_ALIGN = 8;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+              std::atomic<uint32_t>::is_always_lock_free,
+              "Shared-memory atomics must be address-free");
+
+/// Producer attachment state
+enum : uint32_t { PRODUCER_NONE = 0, PRODUCER_ATTACHED = 1, PRODUCER_CLOSED = 2 };
+
+struct alignas(memory::CACHE_LINE_SIZE) SubscriberSlot {
+    std::atomic<uint64_t> cursor{DETACHED};  // Byte position read up to
+    std::atomic<uint32_t> taken{0};
+    std::atomic<uint32_t> evicted{0};        // Set by the producer (detach_slow)
+    std::atomic<int32_t> pid{0};
+};
+
+/// Control block at the start of the mapping; data follows it
+struct alignas(memory::CACHE_LINE_SIZE) RingHeader {
+    uint64_t magic{MAGIC};
+    uint32_t version{VERSION};
+    uint32_t futex_wakeup{1};
+    uint64_t capacity{0};
+    std::atomic<uint32_t> ready{0};
+    std::atomic<uint32_t> producer{PRODUCER_NONE};
+
+    alignas(memory::CACHE_LINE_SIZE) std::atomic<uint64_t> published{0};
+
+    alignas(memory::CACHE_LINE_SIZE) std::atomic<uint32_t> wake_epoch{0};
+    std::atomic<uint32_t> sleepers{0};
+
+    std::array<SubscriberSlot, SHM_MAX_SUBSCRIBERS> subscribers{};
+};
+
+/// On-ring record header (8-byte aligned; the first 8 bytes are all a
+/// padding record needs)
+struct RecordHeader {
+    uint32_t length;  // Whole record, header included, rounded to RECORD_ALIGN
+    uint16_t kind;
+    uint16_t session_id;
+    uint32_t payload_length;
+    uint32_t seq_num;
+    uint64_t timestamp_ns;
+};
+static_assert(sizeof(RecordHeader) == 24);
+
+inline void release_slot(SubscriberSlot& slot) noexcept {
+    slot.cursor.store(DETACHED, std::memory_order_release);
+    slot.evicted.store(0, std::memory_order_relaxed);
+    slot.pid.store(0, std::memory_order_relaxed);
+    slot.taken.store(0, std::memory_order_release);
+}
+
+[[nodiscard]] constexpr size_t align_record(size_t n) noexcept {
+    return (n + RECORD_ALIGN - 1) & ~(RECORD_ALIGN - 1);
+}
+
+inline void futex_wake(std::atomic<uint32_t>& word) noexcept {
+#if NFX_PLATFORM_LINUX
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX,
+              nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+inline void futex_wait(std::atomic<uint32_t>& word, uint32_t seen,
+                       std::chrono::microseconds timeout) noexcept {
+#if NFX_PLATFORM_LINUX
+    struct timespec ts;
+    ts.tv_sec = static_cast<time_t>(timeout.count() / 1'000'000);
+    ts.tv_nsec = static_cast<long>((timeout.count() % 1'000'000) * 1000);
+    // Not FUTEX_PRIVATE: the word is shared between processes
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, seen,
+              &ts, nullptr, 0);
+#else
+    (void)word;
+    (void)seen;
+    ::usleep(static_cast<useconds_t>(timeout.count() < 100 ? timeout.count() : 100));
+#endif
+}
+
+} // namespace shm_detail
+
+// ============================================================================
+// Shared-memory Region
+// ============================================================================
+
+/// Mapped POSIX shared-memory object. The creator unlinks the name when it
+/// is destroyed; processes that still map it keep their mapping.
+class ShmRegion {
+public:
+    ShmRegion() noexcept = default;
+
+    ~ShmRegion() { reset(); }
+
+    ShmRegion(ShmRegion&& other) noexcept { *this = std::move(other); }
+
+    ShmRegion& operator=(ShmRegion&& other) noexcept {
+        if (this != &other) {
+            reset();
+            base_ = std::exchange(other.base_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            owner_ = std::exchange(other.owner_, false);
+            name_ = other.name_;
+        }
+        return *this;
+    }
+
+    ShmRegion(const ShmRegion&) = delete;
+    ShmRegion& operator=(const ShmRegion&) = delete;
+
+    /// Create (replacing a stale object of the same name) and map `size` bytes
+    [[nodiscard]] static TransportResult<ShmRegion> create(std::string_view name,
+                                                           size_t size) noexcept {
+        ShmRegion region;
+        if (!region.set_name(name)) {
+            return std::unexpected{TransportError{TransportErrorCode::AddressResolutionFailed}};
+        }
+        ::shm_unlink(region.name_.data());
+        const int fd = ::shm_open(region.name_.data(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionFailed, errno}};
+        }
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            const int err = errno;
+            ::close(fd);
+            ::shm_unlink(region.name_.data());
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace, err}};
+        }
+        region.owner_ = true;
+        if (auto mapped = region.map(fd, size); !mapped) return std::unexpected{mapped.error()};
+        return region;
+    }
+
+    /// Map an existing object with its full size
+    [[nodiscard]] static TransportResult<ShmRegion> open(std::string_view name) noexcept {
+        ShmRegion region;
+        if (!region.set_name(name)) {
+            return std::unexpected{TransportError{TransportErrorCode::AddressResolutionFailed}};
+        }
+        const int fd = ::shm_open(region.name_.data(), O_RDWR, 0);
+        if (fd < 0) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionRefused, errno}};
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+            const int err = errno;
+            ::close(fd);
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionRefused, err}};
+        }
+        if (auto mapped = region.map(fd, static_cast<size_t>(st.st_size)); !mapped) {
+            return std::unexpected{mapped.error()};
+        }
+        return region;
+    }
+
+    void reset() noexcept {
+        if (base_ != nullptr) ::munmap(base_, size_);
+        if (owner_) ::shm_unlink(name_.data());
+        base_ = nullptr;
+        size_ = 0;
+        owner_ = false;
+    }
+
+    [[nodiscard]] void* data() const noexcept { return base_; }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] explicit operator bool() const noexcept { return base_ != nullptr; }
+
+private:
+    /// "/nfx.<name>"
+    [[nodiscard]] bool set_name(std::string_view name) noexcept {
+        constexpr std::string_view prefix = "/nfx.";
+        if (name.empty() || name.size() + prefix.size() >= name_.size() ||
+            name.find('/') != std::string_view::npos) {
+            return false;
+        }
+        std::memcpy(name_.data(), prefix.data(), prefix.size());
+        std::memcpy(name_.data() + prefix.size(), name.data(), name.size());
+        name_[prefix.size() + name.size()] = '\0';
+        return true;
+    }
+
+    [[nodiscard]] TransportResult<void> map(int fd, size_t size) noexcept {
+        int flags = MAP_SHARED;
+#if NFX_PLATFORM_LINUX
+        flags |= MAP_POPULATE;  // Prefault: no page faults on the first laps
+#endif
+        void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+        const int err = errno;
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace, err}};
+        }
+        base_ = base;
+        size_ = size;
+        return {};
+    }
+
+    void* base_{nullptr};
+    size_t size_{0};
+    bool owner_{false};
+    std::array<char, 64> name_{};
+};
+
+// ============================================================================
+// Ring Access
+// ============================================================================
+
+/// Typed view of a mapped ring
+class ShmRingView {
+public:
+    ShmRingView() noexcept = default;
+    explicit ShmRingView(shm_detail::RingHeader* header) noexcept : header_{header} {}
+
+    /// Lay out a new ring in a freshly created region
+    [[nodiscard]] static ShmRingView initialize(ShmRegion& region,
+                                                const ShmRingConfig& config) noexcept {
+        auto* header = new (region.data()) shm_detail::RingHeader{};
+        header->capacity = config.capacity;
+        header->futex_wakeup = config.futex_wakeup ? 1 : 0;
+        header->ready.store(1, std::memory_order_release);
+        return ShmRingView{header};
+    }
+
+    /// Validate and view an existing ring
+    [[nodiscard]] static TransportResult<ShmRingView> validate(const ShmRegion& region) noexcept {
+        if (region.size() < sizeof(shm_detail::RingHeader)) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionRefused}};
+        }
+        auto* header = static_cast<shm_detail::RingHeader*>(region.data());
+        if (header->ready.load(std::memory_order_acquire) != 1 ||
+            header->magic != shm_detail::MAGIC || header->version != shm_detail::VERSION ||
+            region.size() < bytes_for(header->capacity)) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionRefused}};
+        }
+        return ShmRingView{header};
+    }
+
+    /// Mapping size for a ring of `capacity` data bytes
+    [[nodiscard]] static constexpr size_t bytes_for(size_t capacity) noexcept {
+        return sizeof(shm_detail::RingHeader) + capacity;
+    }
+
+    [[nodiscard]] static constexpr bool valid_capacity(size_t capacity) noexcept {
+        return capacity >= 4096 && (capacity & (capacity - 1)) == 0 &&
+               capacity <= (size_t{1} << 31);
+    }
+
+    [[nodiscard]] shm_detail::RingHeader* header() const noexcept { return header_; }
+    [[nodiscard]] char* data() const noexcept {
+        return reinterpret_cast<char*>(header_) + sizeof(shm_detail::RingHeader);
+    }
+    [[nodiscard]] uint64_t capacity() const noexcept { return header_->capacity; }
+    [[nodiscard]] uint64_t mask() const noexcept { return header_->capacity - 1; }
+
+    /// Lowest attached subscriber cursor (`head` when none are attached)
+    [[nodiscard]] uint64_t min_cursor(uint64_t head) const noexcept {
+        uint64_t lowest = head;
+        for (const auto& slot : header_->subscribers) {
+            const uint64_t c = slot.cursor.load(std::memory_order_acquire);
+            if (c != shm_detail::DETACHED && c < lowest &&
+                slot.evicted.load(std::memory_order_relaxed) == 0) {
+                lowest = c;
+            }
+        }
+        return lowest;
+    }
+
+private:
+    shm_detail::RingHeader* header_{nullptr};
+};
+
+// ============================================================================
+// Publisher
+// ============================================================================
+
+/// Producer side of a ring (one per ring, any process)
+class ShmPublisher {
+public:
+    ShmPublisher() noexcept = default;
+
+    ~ShmPublisher() { close(); }
+
+    ShmPublisher(ShmPublisher&& other) noexcept { *this = std::move(other); }
+
+    ShmPublisher& operator=(ShmPublisher&& other) noexcept {
+        if (this != &other) {
+            close();
+            region_ = std::move(other.region_);
+            ring_ = std::exchange(other.ring_, ShmRingView{});
+            next_ = other.next_;
+            gate_ = other.gate_;
+            pending_ = other.pending_;
+            wake_ = other.wake_;
+        }
+        return *this;
+    }
+
+    ShmPublisher(const ShmPublisher&) = delete;
+    ShmPublisher& operator=(const ShmPublisher&) = delete;
+
+    /// Create a ring and become its producer
+    [[nodiscard]] static TransportResult<ShmPublisher> create(std::string_view name,
+                                                              const ShmRingConfig& config = {}) noexcept {
+        auto region = create_ring(name, config);
+        if (!region) return std::unexpected{region.error()};
+
+        ShmPublisher publisher;
+        publisher.region_ = std::move(*region);
+        publisher.ring_ = ShmRingView{static_cast<shm_detail::RingHeader*>(publisher.region_.data())};
+        publisher.ring_.header()->producer.store(shm_detail::PRODUCER_ATTACHED,
+                                                 std::memory_order_release);
+        publisher.wake_ = config.futex_wakeup;
+        return publisher;
+    }
+
+    /// Create a ring with no producer (another process attach()es as one);
+    /// the name is unlinked when the returned region is destroyed
+    [[nodiscard]] static TransportResult<ShmRegion> create_ring(std::string_view name,
+                                                                const ShmRingConfig& config = {}) noexcept {
+        if (!ShmRingView::valid_capacity(config.capacity)) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+        }
+        auto region = ShmRegion::create(name, ShmRingView::bytes_for(config.capacity));
+        if (!region) return std::unexpected{region.error()};
+        (void)ShmRingView::initialize(*region, config);
+        return region;
+    }
+
+    /// Become the producer of a ring another process created
+    [[nodiscard]] static TransportResult<ShmPublisher> attach(std::string_view name) noexcept {
+        auto region = ShmRegion::open(name);
+        if (!region) return std::unexpected{region.error()};
+        auto ring = ShmRingView::validate(*region);
+        if (!ring) return std::unexpected{ring.error()};
+
+        // Free, or closed by a previous producer: taking over is allowed
+        uint32_t state = ring->header()->producer.load(std::memory_order_acquire);
+        do {
+            if (state == shm_detail::PRODUCER_ATTACHED) {
+                return std::unexpected{TransportError{TransportErrorCode::ConnectionRefused}};
+            }
+        } while (!ring->header()->producer.compare_exchange_weak(
+            state, shm_detail::PRODUCER_ATTACHED, std::memory_order_acq_rel));
+        ShmPublisher publisher;
+        publisher.region_ = std::move(*region);
+        publisher.ring_ = *ring;
+        publisher.next_ = ring->header()->published.load(std::memory_order_acquire);
+        publisher.gate_ = ring->min_cursor(publisher.next_);
+        publisher.wake_ = ring->header()->futex_wakeup != 0;
+        return publisher;
+    }
+
+    /// Copy a message into the ring and publish it
+    /// @return false while the slowest subscriber holds the space (or the
+    ///         message exceeds capacity / 2)
+    [[nodiscard]] NFX_HOT bool publish(ShmPayload kind, std::span<const char> payload,
+                                       const ShmMeta& meta = {}) noexcept {
+        char* dst = claim(payload.size(), kind, meta);
+        if (dst == nullptr) [[unlikely]] return false;
+        std::memcpy(dst, payload.data(), payload.size());
+        commit();
+        return true;
+    }
+
+    /// Reserve space for a `length`-byte payload written in place before
+    /// commit() (e.g. encode SBE directly into the ring)
+    /// @return Payload destination, nullptr if there is no room
+    [[nodiscard]] NFX_HOT char* claim(size_t length, ShmPayload kind,
+                                      const ShmMeta& meta = {}) noexcept {
+        if (!ring_.header()) [[unlikely]] return nullptr;
+        const uint64_t capacity = ring_.capacity();
+        const size_t record = shm_detail::align_record(sizeof(shm_detail::RecordHeader) + length);
+        if (record > capacity / 2) [[unlikely]] return nullptr;
+
+        const uint64_t offset = next_ & ring_.mask();
+        const uint64_t to_end = capacity - offset;
+        const uint64_t padding = to_end < record ? to_end : 0;
+        const uint64_t needed = padding + record;
+
+        if (next_ + needed - gate_ > capacity) {
+            gate_ = ring_.min_cursor(next_);
+            if (next_ + needed - gate_ > capacity) return nullptr;
+        }
+
+        if (padding != 0) {
+            auto* pad = reinterpret_cast<shm_detail::RecordHeader*>(ring_.data() + offset);
+            pad->length = static_cast<uint32_t>(padding);
+            pad->kind = static_cast<uint16_t>(ShmPayload::Padding);
+            next_ += padding;
+        }
+
+        auto* header = reinterpret_cast<shm_detail::RecordHeader*>(
+            ring_.data() + (next_ & ring_.mask()));
+        header->length = static_cast<uint32_t>(record);
+        header->kind = static_cast<uint16_t>(kind);
+        header->session_id = meta.session_id;
+        header->payload_length = static_cast<uint32_t>(length);
+        header->seq_num = meta.seq_num;
+        header->timestamp_ns = meta.timestamp_ns;
+        pending_ = record;
+        return reinterpret_cast<char*>(header + 1);
+    }
+
+    /// Publish the record reserved by claim()
+    NFX_HOT void commit() noexcept {
+        next_ += pending_;
+        pending_ = 0;
+        auto* header = ring_.header();
+        header->published.store(next_, std::memory_order_release);
+        if (wake_) {
+            // Pairs with the fence in ShmSubscriber::wait()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (header->sleepers.load(std::memory_order_relaxed) != 0) [[unlikely]] {
+                header->wake_epoch.fetch_add(1, std::memory_order_release);
+                shm_detail::futex_wake(header->wake_epoch);
+            }
+        }
+    }
+
+    /// Detach subscribers whose process has exited
+    /// @return Slots freed
+    size_t detach_dead() noexcept {
+        if (!ring_.header()) return 0;
+        size_t freed = 0;
+        for (auto& slot : ring_.header()->subscribers) {
+            const int32_t pid = slot.pid.load(std::memory_order_acquire);
+            if (slot.taken.load(std::memory_order_acquire) == 0 || pid <= 0) continue;
+            if (::kill(pid, 0) == 0 || errno != ESRCH) continue;
+            shm_detail::release_slot(slot);
+            ++freed;
+        }
+        gate_ = ring_.min_cursor(next_);
+        return freed;
+    }
+
+    /// Detach subscribers lagging by at least `max_lag` bytes; their next
+    /// poll() returns nothing and ShmSubscriber::detached() reports it
+    /// @return Subscribers detached
+    size_t detach_slow(uint64_t max_lag) noexcept {
+        if (!ring_.header()) return 0;
+        size_t detached = 0;
+        for (auto& slot : ring_.header()->subscribers) {
+            const uint64_t cursor = slot.cursor.load(std::memory_order_acquire);
+            if (cursor == shm_detail::DETACHED || next_ - cursor < max_lag ||
+                slot.evicted.load(std::memory_order_relaxed) != 0) {
+                continue;
+            }
+            // The slot stays taken until its owner detach()es
+            slot.evicted.store(1, std::memory_order_release);
+            ++detached;
+        }
+        gate_ = ring_.min_cursor(next_);
+        return detached;
+    }
+
+    /// Mark the stream closed (subscribers drain, then see end of stream)
+    void close() noexcept {
+        if (auto* header = ring_.header()) {
+            header->producer.store(shm_detail::PRODUCER_CLOSED, std::memory_order_release);
+            header->wake_epoch.fetch_add(1, std::memory_order_release);
+            shm_detail::futex_wake(header->wake_epoch);
+        }
+        ring_ = ShmRingView{};
+        region_.reset();
+    }
+
+    /// Attached subscribers
+    [[nodiscard]] size_t subscribers() const noexcept {
+        if (!ring_.header()) return 0;
+        size_t n = 0;
+        for (const auto& slot : ring_.header()->subscribers) {
+            n += slot.cursor.load(std::memory_order_acquire) != shm_detail::DETACHED &&
+                 slot.evicted.load(std::memory_order_relaxed) == 0;
+        }
+        return n;
+    }
+
+    [[nodiscard]] uint64_t position() const noexcept { return next_; }
+    [[nodiscard]] uint64_t capacity() const noexcept {
+        return ring_.header() ? ring_.capacity() : 0;
+    }
+    [[nodiscard]] explicit operator bool() const noexcept { return ring_.header() != nullptr; }
+
+private:
+    ShmRegion region_;
+    ShmRingView ring_;
+    uint64_t next_{0};     // Producer's own copy of published
+    uint64_t gate_{0};     // Cached slowest subscriber cursor
+    size_t pending_{0};    // Record size reserved by claim()
+    bool wake_{true};
+};
+
+// ============================================================================
+// Subscriber
+// ============================================================================
+
+/// Consumer side of a ring: one subscriber slot, read in place
+class ShmSubscriber {
+public:
+    ShmSubscriber() noexcept = default;
+
+    ~ShmSubscriber() { detach(); }
+
+    ShmSubscriber(ShmSubscriber&& other) noexcept { *this = std::move(other); }
+
+    ShmSubscriber& operator=(ShmSubscriber&& other) noexcept {
+        if (this != &other) {
+            detach();
+            region_ = std::move(other.region_);
+            ring_ = std::exchange(other.ring_, ShmRingView{});
+            slot_ = other.slot_;
+            cursor_ = other.cursor_;
+            cached_published_ = other.cached_published_;
+        }
+        return *this;
+    }
+
+    ShmSubscriber(const ShmSubscriber&) = delete;
+    ShmSubscriber& operator=(const ShmSubscriber&) = delete;
+
+    /// Subscribe to a ring; records published from now on are delivered
+    [[nodiscard]] static TransportResult<ShmSubscriber> attach(std::string_view name) noexcept {
+        auto region = ShmRegion::open(name);
+        if (!region) return std::unexpected{region.error()};
+        auto ring = ShmRingView::validate(*region);
+        if (!ring) return std::unexpected{ring.error()};
+
+        auto* header = ring->header();
+        for (size_t i = 0; i < SHM_MAX_SUBSCRIBERS; ++i) {
+            auto& slot = header->subscribers[i];
+            uint32_t expected = 0;
+            if (!slot.taken.compare_exchange_strong(expected, 1, std::memory_order_acq_rel)) {
+                continue;
+            }
+            ShmSubscriber subscriber;
+            subscriber.region_ = std::move(*region);
+            subscriber.ring_ = *ring;
+            subscriber.slot_ = i;
+            const uint64_t start = header->published.load(std::memory_order_acquire);
+            subscriber.cursor_ = start;
+            subscriber.cached_published_ = start;
+            slot.pid.store(static_cast<int32_t>(::getpid()), std::memory_order_relaxed);
+            slot.evicted.store(0, std::memory_order_relaxed);
+            slot.cursor.store(start, std::memory_order_release);
+            return subscriber;
+        }
+        return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+    }
+
+    /// Deliver up to max_count records in place: handler(const ShmMessage&)
+    /// @return Records delivered
+    template <typename Handler>
+    NFX_HOT size_t poll(Handler&& handler, size_t max_count = SIZE_MAX) noexcept {
+        if (!ring_.header()) [[unlikely]] return 0;
+        if (cached_published_ == cursor_) {
+            cached_published_ = ring_.header()->published.load(std::memory_order_acquire);
+            if (cached_published_ == cursor_) return 0;
+        }
+        auto& slot = ring_.header()->subscribers[slot_];
+        if (slot.evicted.load(std::memory_order_acquire) != 0) [[unlikely]] return 0;
+
+        size_t delivered = 0;
+        uint64_t cursor = cursor_;
+        while (cursor != cached_published_ && delivered < max_count) {
+            const auto* header = record_at(cursor);
+            if (header->kind != static_cast<uint16_t>(ShmPayload::Padding)) {
+                handler(message(*header, cursor));
+                ++delivered;
+            }
+            cursor += header->length;
+        }
+
+        // Plain store: only this subscriber writes its cursor
+        slot.cursor.store(cursor, std::memory_order_release);
+        cursor_ = cursor;
+        return delivered;
+    }
+
+    /// Next record without consuming it
+    [[nodiscard]] std::optional<ShmMessage> peek() noexcept {
+        if (!ring_.header() || detached()) return std::nullopt;
+        for (;;) {
+            if (cached_published_ == cursor_) {
+                cached_published_ = ring_.header()->published.load(std::memory_order_acquire);
+                if (cached_published_ == cursor_) return std::nullopt;
+            }
+            const auto* header = record_at(cursor_);
+            if (header->kind != static_cast<uint16_t>(ShmPayload::Padding)) {
+                return message(*header, cursor_);
+            }
+            if (!advance_to(cursor_ + header->length)) return std::nullopt;
+        }
+    }
+
+    /// Consume the record returned by peek()
+    /// @return false if the subscriber was detached
+    bool advance() noexcept {
+        if (!ring_.header() || cursor_ == cached_published_) return false;
+        return advance_to(cursor_ + record_at(cursor_)->length);
+    }
+
+    /// Wait until a record is available, the producer closes, or timeout
+    /// @return true if a record is available
+    bool wait(std::chrono::microseconds timeout) noexcept {
+        if (!ring_.header()) return false;
+        auto* header = ring_.header();
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        for (uint32_t spins = 0;; ++spins) {
+            if (available()) return true;
+            if (producer_closed()) return false;
+            if (spins < 256) {
+                memory::BusySpinWait::wait();
+                continue;
+            }
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) return false;
+            if (header->futex_wakeup == 0) {
+                memory::YieldingWait::wait();
+                continue;
+            }
+            const uint32_t seen = header->wake_epoch.load(std::memory_order_acquire);
+            header->sleepers.fetch_add(1, std::memory_order_relaxed);
+            // Pairs with the fence in ShmPublisher::commit()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!available() && !producer_closed()) {
+                shm_detail::futex_wait(header->wake_epoch, seen,
+                    std::chrono::duration_cast<std::chrono::microseconds>(deadline - now));
+            }
+            header->sleepers.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    /// Records published but not yet consumed
+    [[nodiscard]] bool available() noexcept {
+        if (!ring_.header()) return false;
+        if (cached_published_ == cursor_) {
+            cached_published_ = ring_.header()->published.load(std::memory_order_acquire);
+        }
+        return cached_published_ != cursor_;
+    }
+
+    /// The producer closed the stream (records may remain to drain)
+    [[nodiscard]] bool producer_closed() const noexcept {
+        return ring_.header() &&
+               ring_.header()->producer.load(std::memory_order_acquire) == shm_detail::PRODUCER_CLOSED;
+    }
+
+    /// Detached by the producer (detach_slow / detach_dead)
+    [[nodiscard]] bool detached() const noexcept {
+        return !ring_.header() ||
+               ring_.header()->subscribers[slot_].evicted.load(std::memory_order_acquire) != 0;
+    }
+
+    /// Release the slot
+    void detach() noexcept {
+        if (auto* header = ring_.header()) {
+            shm_detail::release_slot(header->subscribers[slot_]);
+        }
+        ring_ = ShmRingView{};
+        region_.reset();
+    }
+
+    /// Bytes published but not yet consumed
+    [[nodiscard]] uint64_t lag() const noexcept {
+        return ring_.header()
+            ? ring_.header()->published.load(std::memory_order_acquire) - cursor_
+            : 0;
+    }
+
+    [[nodiscard]] uint64_t position() const noexcept { return cursor_; }
+    [[nodiscard]] explicit operator bool() const noexcept { return ring_.header() != nullptr; }
+
+private:
+    [[nodiscard]] const shm_detail::RecordHeader* record_at(uint64_t position) const noexcept {
+        return reinterpret_cast<const shm_detail::RecordHeader*>(
+            ring_.data() + (position & ring_.mask()));
+    }
+
+    [[nodiscard]] static ShmMessage message(const shm_detail::RecordHeader& header,
+                                            uint64_t position) noexcept {
+        return ShmMessage{
+            static_cast<ShmPayload>(header.kind),
+            ShmMeta{header.session_id, header.seq_num, header.timestamp_ns},
+            {reinterpret_cast<const char*>(&header + 1), header.payload_length},
+            position};
+    }
+
+    bool advance_to(uint64_t next) noexcept {
+        auto& slot = ring_.header()->subscribers[slot_];
+        if (slot.evicted.load(std::memory_order_acquire) != 0) [[unlikely]] return false;
+        slot.cursor.store(next, std::memory_order_release);
+        cursor_ = next;
+        return true;
+    }
+
+    ShmRegion region_;
+    ShmRingView ring_;
+    size_t slot_{0};
+    uint64_t cursor_{0};
+    uint64_t cached_published_{0};
+};
+
+// ============================================================================
+// Shared-memory Transport
+// ============================================================================
+
+/// ITransport over two rings, "<name>.up" (connector -> listener) and
+/// "<name>.down" (listener -> connector). Each send() is one FIX record;
+/// receive() returns record payloads as a byte stream.
+///
+///     ShmTransport engine;                      // Engine process
+///     engine.listen("oms");
+///     ShmTransport strategy;                    // Strategy process
+///     strategy.connect("oms", 0);               // Port is ignored
+class ShmTransport : public ITransport {
+public:
+    explicit ShmTransport(const ShmRingConfig& config = {}) noexcept : config_{config} {}
+
+    ~ShmTransport() override { disconnect(); }
+
+    /// Create both rings and attach as the listener
+    [[nodiscard]] TransportResult<void> listen(std::string_view name) noexcept {
+        disconnect();
+        std::array<char, 64> up{};
+        std::array<char, 64> down{};
+        if (!ring_names(name, up, down)) {
+            return std::unexpected{TransportError{TransportErrorCode::AddressResolutionFailed}};
+        }
+        auto tx = ShmPublisher::create(down.data(), config_);
+        if (!tx) return std::unexpected{tx.error()};
+        auto inbound = ShmPublisher::create_ring(up.data(), config_);
+        if (!inbound) return std::unexpected{inbound.error()};
+        auto rx = ShmSubscriber::attach(up.data());
+        if (!rx) return std::unexpected{rx.error()};
+        up_region_ = std::move(*inbound);
+        tx_ = std::move(*tx);
+        rx_ = std::move(*rx);
+        return {};
+    }
+
+    /// Attach to a listener's rings (`port` is not used)
+    [[nodiscard]] TransportResult<void> connect(std::string_view host,
+                                                uint16_t /*port*/) override {
+        disconnect();
+        std::array<char, 64> up{};
+        std::array<char, 64> down{};
+        if (!ring_names(host, up, down)) {
+            return std::unexpected{TransportError{TransportErrorCode::AddressResolutionFailed}};
+        }
+        auto rx = ShmSubscriber::attach(down.data());
+        if (!rx) return std::unexpected{rx.error()};
+        auto tx = ShmPublisher::attach(up.data());
+        if (!tx) return std::unexpected{tx.error()};
+        rx_ = std::move(*rx);
+        tx_ = std::move(*tx);
+        return {};
+    }
+
+    void disconnect() noexcept override {
+        tx_.close();
+        rx_.detach();
+        up_region_.reset();
+        partial_ = 0;
+    }
+
+    [[nodiscard]] bool is_connected() const noexcept override {
+        return static_cast<bool>(tx_) && static_cast<bool>(rx_) && !rx_.detached();
+    }
+
+    [[nodiscard]] TransportResult<size_t> send(std::span<const char> data) noexcept override {
+        if (!is_connected()) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+        if (shm_detail::align_record(sizeof(shm_detail::RecordHeader) + data.size()) >
+            tx_.capacity() / 2) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+        }
+        if (tx_.publish(ShmPayload::Fix, data)) [[likely]] return data.size();
+
+        // Peer is behind: wait for space up to the send timeout
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::milliseconds(send_timeout_ms_);
+        for (uint32_t spins = 0;; ++spins) {
+            memory::BusySpinWait::wait();
+            if (tx_.publish(ShmPayload::Fix, data)) return data.size();
+            if ((spins & 1023) == 1023 && std::chrono::steady_clock::now() >= deadline) {
+                return std::unexpected{TransportError{TransportErrorCode::WouldBlock}};
+            }
+        }
+    }
+
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept override {
+        if (!static_cast<bool>(rx_)) {
+            return std::unexpected{TransportError{TransportErrorCode::NotConnected}};
+        }
+        if (!rx_.available()) {
+            const auto timeout = std::chrono::milliseconds(
+                recv_timeout_ms_ > 0 ? recv_timeout_ms_ : 24 * 3600 * 1000);
+            if (!rx_.wait(timeout)) {
+                if (rx_.producer_closed() || rx_.detached()) {
+                    return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+                }
+                return 0;  // Timeout, as the socket transports report it
+            }
+        }
+        auto msg = rx_.peek();
+        if (!msg) return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+
+        // A record larger than the buffer is returned over several calls
+        const size_t remaining = msg->payload.size() - partial_;
+        const size_t n = remaining < buffer.size() ? remaining : buffer.size();
+        std::memcpy(buffer.data(), msg->payload.data() + partial_, n);
+        partial_ += n;
+        if (partial_ == msg->payload.size()) {
+            partial_ = 0;
+            rx_.advance();
+        }
+        return n;
+    }
+
+    /// Process-local: no Nagle
+    [[nodiscard]] bool set_nodelay(bool /*enable*/) noexcept override { return true; }
+    [[nodiscard]] bool set_keepalive(bool /*enable*/) noexcept override { return true; }
+
+    [[nodiscard]] bool set_receive_timeout(int milliseconds) noexcept override {
+        recv_timeout_ms_ = milliseconds;
+        return true;
+    }
+
+    [[nodiscard]] bool set_send_timeout(int milliseconds) noexcept override {
+        send_timeout_ms_ = milliseconds;
+        return true;
+    }
+
+    /// Publish with metadata and payload kind (e.g. SBE) on the outbound ring
+    [[nodiscard]] bool publish(ShmPayload kind, std::span<const char> payload,
+                               const ShmMeta& meta = {}) noexcept {
+        return tx_.publish(kind, payload, meta);
+    }
+
+    /// The peer is attached to our outbound ring
+    [[nodiscard]] bool peer_attached() const noexcept { return tx_.subscribers() > 0; }
+
+    [[nodiscard]] ShmSubscriber& inbound() noexcept { return rx_; }
+    [[nodiscard]] ShmPublisher& outbound() noexcept { return tx_; }
+
+private:
+    [[nodiscard]] static bool ring_names(std::string_view name, std::array<char, 64>& up,
+                                         std::array<char, 64>& down) noexcept {
+        constexpr size_t SUFFIX = 6;  // ".down" + NUL
+        if (name.empty() || name.size() + SUFFIX > up.size()) return false;
+        std::memcpy(up.data(), name.data(), name.size());
+        std::memcpy(up.data() + name.size(), ".up", 4);
+        std::memcpy(down.data(), name.data(), name.size());
+        std::memcpy(down.data() + name.size(), ".down", 6);
+        return true;
+    }
+
+    ShmRingConfig config_;
+    ShmPublisher tx_;
+    ShmSubscriber rx_;
+    ShmRegion up_region_;  // Listener: owns "<name>.up", produced by the connector
+    size_t partial_{0};    // Bytes of the current record already returned
+    int recv_timeout_ms_{30000};
+    int send_timeout_ms_{1000};
+};
+
+#endif // NFX_SHM_AVAILABLE
+
+} // namespace nfx
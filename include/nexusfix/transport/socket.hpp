@@ -1,12 +1,24 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <span>
 #include <string_view>
 #include <cstdint>
+#include <cstring>
 #include <optional>
 
+#include "nexusfix/platform/platform.hpp"
 #include "nexusfix/types/error.hpp"
+#include "nexusfix/transport/rx_timestamp.hpp"
+
+#if NFX_PLATFORM_POSIX
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+    #include <cstdio>
+#endif
 
 namespace nfx {
 
@@ -43,6 +55,10 @@ public:
     [[nodiscard]] virtual bool set_keepalive(bool enable) = 0;
     [[nodiscard]] virtual bool set_receive_timeout(int milliseconds) = 0;
     [[nodiscard]] virtual bool set_send_timeout(int milliseconds) = 0;
+
+    /// Kernel/NIC timestamp of the data returned by the last receive()
+    /// (invalid unless the transport was configured for RX timestamping)
+    [[nodiscard]] virtual RxTimestamp last_rx_timestamp() const noexcept { return {}; }
 };
 
 // ============================================================================
@@ -64,6 +80,13 @@ struct SocketAddress {
 // Socket Options
 // ============================================================================
 
+/// How receive() waits for data
+enum class ReceiveMode : uint8_t {
+    Blocking,   // Blocking recv bounded by SO_RCVTIMEO (default)
+    BusySpin,   // Non-blocking recv in a tight loop (memory::BusySpinWait)
+    Backoff     // Non-blocking recv, spin -> yield -> sleep (memory::BackoffWait)
+};
+
 /// Common socket configuration options
 struct SocketOptions {
     bool tcp_nodelay{true};           // Disable Nagle's algorithm
@@ -72,8 +95,22 @@ struct SocketOptions {
     int send_timeout_ms{30000};       // Send timeout in ms
     int recv_buffer_size{65536};      // SO_RCVBUF
     int send_buffer_size{65536};      // SO_SNDBUF
+    ReceiveMode receive_mode{ReceiveMode::Blocking};
+    int busy_poll_us{0};              // SO_BUSY_POLL (0 = leave kernel default)
+    bool prefer_busy_poll{false};     // SO_PREFER_BUSY_POLL
+    RxTimestampMode rx_timestamps{RxTimestampMode::Off};  // SO_TIMESTAMPING (Linux)
 
     constexpr SocketOptions() noexcept = default;
+
+    /// Spin on non-blocking recv and ask the kernel to busy-poll the NIC.
+    /// Burns the calling core; intended for colocated, pinned session threads.
+    [[nodiscard]] static constexpr SocketOptions busy_poll(int poll_us = 50) noexcept {
+        SocketOptions opts;
+        opts.receive_mode = ReceiveMode::BusySpin;
+        opts.busy_poll_us = poll_us;
+        opts.prefer_busy_poll = true;
+        return opts;
+    }
 };
 
 // ============================================================================
@@ -147,7 +184,23 @@ template<ConnectionState S>
 // Ring Buffer for Network I/O
 // ============================================================================
 
+/// Readable region of a ring buffer as at most two contiguous segments
+/// (second is empty unless the data wraps around the end of the buffer)
+struct RingSegments {
+    std::span<const char> first;
+    std::span<const char> second;
+
+    [[nodiscard]] size_t size() const noexcept {
+        return first.size() + second.size();
+    }
+
+    [[nodiscard]] bool contiguous() const noexcept {
+        return second.empty();
+    }
+};
+
 /// Lock-free ring buffer for efficient I/O
+/// Wraparound is handled as two memcpy segments.
 template <size_t Size>
 class RingBuffer {
 public:
@@ -159,10 +212,12 @@ public:
     [[nodiscard]] size_t write(std::span<const char> data) noexcept {
         size_t available = Size - size();
         size_t to_write = std::min(data.size(), available);
+        if (to_write == 0) return 0;
 
-        for (size_t i = 0; i < to_write; ++i) {
-            buffer_[(tail_ + i) & (Size - 1)] = data[i];
-        }
+        const size_t start = tail_ & (Size - 1);
+        const size_t first = std::min(to_write, Size - start);
+        std::memcpy(buffer_.data() + start, data.data(), first);
+        std::memcpy(buffer_.data(), data.data() + first, to_write - first);
         tail_ += to_write;
 
         return to_write;
@@ -170,12 +225,7 @@ public:
 
     /// Read data from buffer
     [[nodiscard]] size_t read(std::span<char> dest) noexcept {
-        size_t available = size();
-        size_t to_read = std::min(dest.size(), available);
-
-        for (size_t i = 0; i < to_read; ++i) {
-            dest[i] = buffer_[(head_ + i) & (Size - 1)];
-        }
+        size_t to_read = peek(dest);
         head_ += to_read;
 
         return to_read;
@@ -185,10 +235,12 @@ public:
     [[nodiscard]] size_t peek(std::span<char> dest) const noexcept {
         size_t available = size();
         size_t to_peek = std::min(dest.size(), available);
+        if (to_peek == 0) return 0;
 
-        for (size_t i = 0; i < to_peek; ++i) {
-            dest[i] = buffer_[(head_ + i) & (Size - 1)];
-        }
+        const size_t start = head_ & (Size - 1);
+        const size_t first = std::min(to_peek, Size - start);
+        std::memcpy(dest.data(), buffer_.data() + start, first);
+        std::memcpy(dest.data() + first, buffer_.data(), to_peek - first);
 
         return to_peek;
     }
@@ -227,16 +279,20 @@ public:
 
     /// Get contiguous read span (for zero-copy operations)
     [[nodiscard]] std::span<const char> read_span() const noexcept {
-        size_t start = head_ & (Size - 1);
-        size_t end = tail_ & (Size - 1);
+        return read_segments().first;
+    }
 
-        if (start < end) {
-            return std::span<const char>{buffer_.data() + start, end - start};
-        } else if (size() > 0) {
-            // Wraps around - return first segment
-            return std::span<const char>{buffer_.data() + start, Size - start};
-        }
-        return {};
+    /// Get all readable bytes in place (for zero-copy parsing)
+    /// Complete messages in `first` can be parsed straight from the ring;
+    /// only a message straddling the wrap needs peek() into scratch space.
+    [[nodiscard]] RingSegments read_segments() const noexcept {
+        const size_t start = head_ & (Size - 1);
+        const size_t count = size();
+        const size_t first = std::min(count, Size - start);
+        return RingSegments{
+            std::span<const char>{buffer_.data() + start, first},
+            std::span<const char>{buffer_.data(), count - first}
+        };
     }
 
     /// Get contiguous write span (for zero-copy operations)
@@ -263,6 +319,176 @@ private:
     size_t tail_;
 };
 
+// ============================================================================
+// Virtual Ring Buffer (double-mapped pages)
+// ============================================================================
+
+#if NFX_PLATFORM_POSIX
+
+/// Ring buffer whose storage is mapped twice back to back, so the byte
+/// after the last one is the first one again: the readable and writable
+/// regions are always contiguous and every copy is a single memcpy.
+/// Same interface as RingBuffer; Size must be a multiple of the page size.
+template <size_t Size>
+class VirtualRingBuffer {
+public:
+    static_assert((Size & (Size - 1)) == 0, "Size must be power of 2");
+    static_assert(Size >= 4096, "Size must cover at least one page");
+
+    VirtualRingBuffer() noexcept : base_{map_mirrored()}, head_{0}, tail_{0} {}
+
+    ~VirtualRingBuffer() {
+        if (base_) {
+            ::munmap(base_, 2 * Size);
+        }
+    }
+
+    VirtualRingBuffer(const VirtualRingBuffer&) = delete;
+    VirtualRingBuffer& operator=(const VirtualRingBuffer&) = delete;
+    VirtualRingBuffer(VirtualRingBuffer&&) = delete;
+    VirtualRingBuffer& operator=(VirtualRingBuffer&&) = delete;
+
+    /// Check if the mirrored mapping was created
+    [[nodiscard]] bool is_mapped() const noexcept {
+        return base_ != nullptr;
+    }
+
+    /// Write data to buffer
+    [[nodiscard]] size_t write(std::span<const char> data) noexcept {
+        auto dest = write_span();
+        size_t to_write = std::min(data.size(), dest.size());
+        if (to_write == 0) return 0;
+        std::memcpy(dest.data(), data.data(), to_write);
+        tail_ += to_write;
+        return to_write;
+    }
+
+    /// Read data from buffer
+    [[nodiscard]] size_t read(std::span<char> dest) noexcept {
+        size_t to_read = peek(dest);
+        head_ += to_read;
+        return to_read;
+    }
+
+    /// Peek at data without consuming
+    [[nodiscard]] size_t peek(std::span<char> dest) const noexcept {
+        auto src = read_span();
+        size_t to_peek = std::min(dest.size(), src.size());
+        if (to_peek == 0) return 0;
+        std::memcpy(dest.data(), src.data(), to_peek);
+        return to_peek;
+    }
+
+    /// Skip bytes (consume without copying)
+    void skip(size_t count) noexcept {
+        head_ += std::min(count, size());
+    }
+
+    /// Get number of bytes in buffer
+    [[nodiscard]] size_t size() const noexcept {
+        return tail_ - head_;
+    }
+
+    /// Get available space (0 if unmapped)
+    [[nodiscard]] size_t available() const noexcept {
+        return base_ ? Size - size() : 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return head_ == tail_;
+    }
+
+    [[nodiscard]] bool full() const noexcept {
+        return size() == Size;
+    }
+
+    void clear() noexcept {
+        head_ = 0;
+        tail_ = 0;
+    }
+
+    /// All readable bytes, contiguous (even across the wrap)
+    [[nodiscard]] std::span<const char> read_span() const noexcept {
+        if (!base_) [[unlikely]] return {};
+        return std::span<const char>{base_ + (head_ & (Size - 1)), size()};
+    }
+
+    /// All readable bytes in place; `second` is always empty
+    [[nodiscard]] RingSegments read_segments() const noexcept {
+        return RingSegments{read_span(), {}};
+    }
+
+    /// All writable space, contiguous (even across the wrap)
+    [[nodiscard]] std::span<char> write_span() noexcept {
+        if (!base_) [[unlikely]] return {};
+        return std::span<char>{base_ + (tail_ & (Size - 1)), available()};
+    }
+
+    /// Commit bytes written to write_span
+    void commit_write(size_t count) noexcept {
+        tail_ += std::min(count, available());
+    }
+
+private:
+    /// Map one Size-byte shared memory object at [base, base + Size) and
+    /// again at [base + Size, base + 2 * Size)
+    [[nodiscard]] static char* map_mirrored() noexcept {
+        const long page = ::sysconf(_SC_PAGESIZE);
+        if (page <= 0 || Size % static_cast<size_t>(page) != 0) [[unlikely]] {
+            return nullptr;
+        }
+
+        const int fd = open_backing();
+        if (fd < 0) [[unlikely]] return nullptr;
+
+        char* base = nullptr;
+        if (::ftruncate(fd, static_cast<off_t>(Size)) == 0) {
+            // Reserve the full 2 * Size range, then overlay both halves
+            void* reserved = ::mmap(nullptr, 2 * Size, PROT_NONE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (reserved != MAP_FAILED) {
+                char* r = static_cast<char*>(reserved);
+                void* lo = ::mmap(r, Size, PROT_READ | PROT_WRITE,
+                                  MAP_SHARED | MAP_FIXED, fd, 0);
+                void* hi = lo == MAP_FAILED ? MAP_FAILED
+                    : ::mmap(r + Size, Size, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_FIXED, fd, 0);
+                if (hi != MAP_FAILED) {
+                    base = r;
+                } else {
+                    ::munmap(reserved, 2 * Size);
+                }
+            }
+        }
+
+        ::close(fd);  // Mappings keep the memory alive
+        return base;
+    }
+
+    /// Anonymous shared memory object of Size bytes
+    [[nodiscard]] static int open_backing() noexcept {
+#if NFX_PLATFORM_LINUX
+        return ::memfd_create("nfx-virtual-ring", MFD_CLOEXEC);
+#else
+        static std::atomic<uint32_t> counter{0};
+        char name[64];
+        std::snprintf(name, sizeof(name), "/nfx-ring-%d-%u", static_cast<int>(::getpid()),
+                      counter.fetch_add(1, std::memory_order_relaxed));
+        const int fd = ::shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd >= 0) {
+            ::shm_unlink(name);
+        }
+        return fd;
+#endif
+    }
+
+    char* base_;
+    size_t head_;
+    size_t tail_;
+};
+
+#endif  // NFX_PLATFORM_POSIX
+
 // ============================================================================
 // Buffer Manager
 // ============================================================================
@@ -0,0 +1,297 @@
+#pragma once
+
+/// @file standby_connections.hpp
+/// @brief Warm standby TCP connections to backup gateways
+///
+/// After a drop, a reconnect pays for name resolution, the TCP handshake
+/// and (for a new gateway) slow start before Logon can even be sent.
+/// StandbyConnections keeps TCP connections to the secondary gateways
+/// already established, so failing over is take() plus Logon:
+///
+/// @code
+///     AddressCache cache;
+///     StandbyConnections standby{cache};
+///     standby.add_gateway("fix-a.venue.com", 9001);   // primary
+///     standby.add_gateway("fix-b.venue.com", 9001);   // kept warm
+///     standby.set_active(0);
+///
+///     // From the session's timer tick:
+///     standby.maintain();
+///
+///     // On disconnect:
+///     if (auto warm = standby.take()) {
+///         transport.adopt(warm->fd);                  // TcpTransport / IoUringTransport
+///         standby.set_active(warm->gateway);
+///         session.on_connect();
+///         (void)session.initiate_logon();
+///     }
+/// @endcode
+///
+/// Standby sockets carry no FIX traffic until taken. A gateway that closes
+/// idle connections without a Logon (a logon timeout) is noticed by
+/// maintain(), which opens a replacement.
+
+#include "nexusfix/platform/platform.hpp"
+#include "nexusfix/platform/socket_types.hpp"
+#include "nexusfix/platform/error_mapping.hpp"
+#include "nexusfix/transport/resolved_address.hpp"
+#include "nexusfix/transport/socket.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace nfx {
+
+/// A connected socket handed over by StandbyConnections::take()
+struct StandbySocket {
+    SocketHandle fd;
+    size_t gateway;     // Index from add_gateway()
+};
+
+/// Counters for StandbyConnections
+struct StandbyConnectionStats {
+    uint64_t connects_started{0};
+    uint64_t connects_failed{0};    // Refused, unreachable or timed out
+    uint64_t dropped{0};            // Ready standbys the gateway closed
+    uint64_t taken{0};
+};
+
+/// Pre-established backup connections, one per non-active gateway
+///
+/// Connects are non-blocking: maintain() only polls, so it can run from
+/// the session thread. Not thread-safe.
+class StandbyConnections {
+public:
+    static constexpr size_t MAX_GATEWAYS = 8;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Config {
+        size_t max_standby{1};          // Gateways kept warm, in add order
+        std::chrono::milliseconds connect_timeout{2000};
+        std::chrono::milliseconds retry_interval{1000};  // After a failure or drop
+        SocketOptions options{};        // nodelay, keepalive, buffers
+    };
+
+    explicit StandbyConnections(AddressCache& cache) noexcept
+        : cache_{cache} {}
+
+    StandbyConnections(AddressCache& cache, const Config& config) noexcept
+        : cache_{cache}, config_{config} {}
+
+    ~StandbyConnections() {
+        close_all();
+    }
+
+    StandbyConnections(const StandbyConnections&) = delete;
+    StandbyConnections& operator=(const StandbyConnections&) = delete;
+
+    /// Add a gateway, in priority order (resolved now, through the cache)
+    /// @return Its index, or the resolution error / SocketError when full
+    [[nodiscard]] TransportResult<size_t> add_gateway(std::string_view host, uint16_t port) noexcept {
+        if (count_ == MAX_GATEWAYS) {
+            return std::unexpected{TransportError{TransportErrorCode::SocketError}};
+        }
+        auto address = cache_.resolve(host, port);
+        if (!address) return std::unexpected{address.error()};
+        gateways_[count_] = Gateway{};
+        gateways_[count_].address = *address;
+        return count_++;
+    }
+
+    /// Gateway the session is connected to; never kept on standby, and its
+    /// standby socket (if one was open) is closed
+    void set_active(size_t gateway) noexcept {
+        active_ = gateway;
+        if (gateway < count_) close(gateways_[gateway]);
+    }
+
+    /// Advance pending connects, replace dropped standbys and start new
+    /// ones up to Config::max_standby. Never blocks.
+    void maintain() noexcept {
+        const auto now = Clock::now();
+        size_t wanted = config_.max_standby;
+        for (size_t i = 0; i < count_; ++i) {
+            if (i == active_) continue;
+            Gateway& gw = gateways_[i];
+            switch (gw.state) {
+                case State::Connecting:
+                    poll_connect(gw, now);
+                    break;
+                case State::Ready:
+                    if (!alive(gw.fd)) {
+                        ++stats_.dropped;
+                        close(gw);
+                        gw.retry_at = now + config_.retry_interval;
+                    }
+                    break;
+                case State::Idle:
+                    break;
+            }
+            if (wanted == 0) {
+                close(gw);  // Over quota (set_active() moved the window)
+                continue;
+            }
+            if (gw.state == State::Idle && now >= gw.retry_at) start_connect(gw, now);
+            if (gw.state != State::Idle) --wanted;
+        }
+    }
+
+    /// Hand over the first ready standby in priority order; the caller owns
+    /// the fd. nullopt if none is ready (fall back to a cold connect).
+    [[nodiscard]] std::optional<StandbySocket> take() noexcept {
+        for (size_t i = 0; i < count_; ++i) {
+            Gateway& gw = gateways_[i];
+            if (i == active_ || gw.state != State::Ready) continue;
+            if (!alive(gw.fd)) {
+                ++stats_.dropped;
+                close(gw);
+                continue;
+            }
+            StandbySocket taken{gw.fd, i};
+            gw.fd = INVALID_SOCKET_HANDLE;
+            gw.state = State::Idle;
+            ++stats_.taken;
+            return taken;
+        }
+        return std::nullopt;
+    }
+
+    /// Close every standby socket
+    void close_all() noexcept {
+        for (size_t i = 0; i < count_; ++i) close(gateways_[i]);
+    }
+
+    /// Cached address of a gateway (for a cold connect when nothing is ready)
+    [[nodiscard]] const ResolvedAddress& address(size_t gateway) const noexcept {
+        return gateways_[gateway].address;
+    }
+
+    [[nodiscard]] size_t gateway_count() const noexcept { return count_; }
+    [[nodiscard]] size_t active() const noexcept { return active_; }
+
+    /// Standbys connected and ready to take
+    [[nodiscard]] size_t ready() const noexcept { return in_state(State::Ready); }
+
+    /// Standbys still completing their handshake
+    [[nodiscard]] size_t connecting() const noexcept { return in_state(State::Connecting); }
+
+    [[nodiscard]] const StandbyConnectionStats& stats() const noexcept { return stats_; }
+
+private:
+    enum class State : uint8_t { Idle, Connecting, Ready };
+
+    struct Gateway {
+        ResolvedAddress address;
+        SocketHandle fd{INVALID_SOCKET_HANDLE};
+        State state{State::Idle};
+        Clock::time_point deadline{};   // Connecting: give up after
+        Clock::time_point retry_at{};   // Idle: next attempt not before
+    };
+
+    void start_connect(Gateway& gw, Clock::time_point now) noexcept {
+        gw.fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (!is_valid_socket(gw.fd)) {
+            gw.fd = INVALID_SOCKET_HANDLE;
+            fail(gw, now);
+            return;
+        }
+        (void)set_socket_nonblocking(gw.fd, true);
+        (void)set_tcp_nodelay(gw.fd, config_.options.tcp_nodelay);
+        (void)set_socket_keepalive(gw.fd, config_.options.keep_alive);
+        (void)set_socket_recv_buffer(gw.fd, config_.options.recv_buffer_size);
+        (void)set_socket_send_buffer(gw.fd, config_.options.send_buffer_size);
+
+        ++stats_.connects_started;
+        if (::connect(gw.fd, gw.address.data(), gw.address.size()) == 0) {
+            ready(gw);
+            return;
+        }
+        if (!is_in_progress_error(get_last_socket_error())) {
+            fail(gw, now);
+            return;
+        }
+        gw.state = State::Connecting;
+        gw.deadline = now + config_.connect_timeout;
+    }
+
+    void poll_connect(Gateway& gw, Clock::time_point now) noexcept {
+#if NFX_PLATFORM_WINDOWS
+        WSAPOLLFD pfd{};
+        pfd.fd = gw.fd;
+        pfd.events = POLLOUT;
+        const int ret = WSAPoll(&pfd, 1, 0);
+#else
+        struct pollfd pfd{};
+        pfd.fd = gw.fd;
+        pfd.events = POLLOUT;
+        const int ret = ::poll(&pfd, 1, 0);
+#endif
+        if (ret <= 0) {
+            if (now >= gw.deadline) fail(gw, now);
+            return;
+        }
+        int err = 0;
+        SocketLength len = sizeof(err);
+        if (::getsockopt(gw.fd, SOL_SOCKET, SO_ERROR, sockopt_ptr_mut(&err), &len) != 0 || err != 0) {
+            fail(gw, now);
+            return;
+        }
+        ready(gw);
+    }
+
+    /// Connected: back to the blocking mode a fresh TcpSocket would have
+    void ready(Gateway& gw) noexcept {
+        (void)set_socket_nonblocking(gw.fd, false);
+        gw.state = State::Ready;
+    }
+
+    void fail(Gateway& gw, Clock::time_point now) noexcept {
+        ++stats_.connects_failed;
+        close(gw);
+        gw.retry_at = now + config_.retry_interval;
+    }
+
+    void close(Gateway& gw) noexcept {
+        if (is_valid_socket(gw.fd)) close_socket(gw.fd);
+        gw.fd = INVALID_SOCKET_HANDLE;
+        gw.state = State::Idle;
+    }
+
+    /// No FIN or error pending on an idle connected socket. The gateway
+    /// sends nothing before our Logon, so readable means closed.
+    [[nodiscard]] static bool alive(SocketHandle fd) noexcept {
+        char byte;
+#if NFX_PLATFORM_WINDOWS
+        WSAPOLLFD pfd{};
+        pfd.fd = fd;
+        pfd.events = POLLIN;
+        if (WSAPoll(&pfd, 1, 0) <= 0) return true;
+        return ::recv(fd, &byte, 1, MSG_PEEK) > 0;
+#else
+        const IoSize n = ::recv(fd, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+        if (n > 0) return true;
+        return n < 0 && is_would_block_error(get_last_socket_error());
+#endif
+    }
+
+    [[nodiscard]] size_t in_state(State state) const noexcept {
+        size_t n = 0;
+        for (size_t i = 0; i < count_; ++i) {
+            if (i != active_ && gateways_[i].state == state) ++n;
+        }
+        return n;
+    }
+
+    AddressCache& cache_;
+    Config config_{};
+    std::array<Gateway, MAX_GATEWAYS> gateways_{};
+    size_t count_{0};
+    size_t active_{0};
+    StandbyConnectionStats stats_{};
+};
+
+} // namespace nfx
@@ -10,10 +10,15 @@
 #include "nexusfix/platform/socket_types.hpp"
 #include "nexusfix/platform/error_mapping.hpp"
 #include "nexusfix/transport/socket.hpp"
+#include "nexusfix/transport/resolved_address.hpp"
+#include "nexusfix/transport/tls_record.hpp"
+#include "nexusfix/memory/wait_strategy.hpp"
 
 #include <cstring>
 #include <cstdio>
 #include <algorithm>
+#include <array>
+#include <chrono>
 
 // Platform-specific headers
 #if NFX_PLATFORM_POSIX
@@ -25,6 +30,18 @@
 
 namespace nfx {
 
+namespace detail {
+
+/// Per-call state for stateful wait strategies (BackoffWait::State), empty otherwise
+template<typename W>
+struct WaitStateOf { struct type {}; };
+
+template<typename W>
+    requires requires { typename W::State; }
+struct WaitStateOf<W> { using type = typename W::State; };
+
+} // namespace detail
+
 // ============================================================================
 // TCP Socket (Cross-platform)
 // ============================================================================
@@ -36,6 +53,11 @@ public:
         : fd_{INVALID_SOCKET_HANDLE}
         , state_{ConnectionState::Disconnected} {}
 
+    explicit TcpSocket(const SocketOptions& options) noexcept
+        : fd_{INVALID_SOCKET_HANDLE}
+        , state_{ConnectionState::Disconnected}
+        , options_{options} {}
+
     ~TcpSocket() {
         close();
     }
@@ -49,6 +71,8 @@ public:
         : fd_{other.fd_}
         , state_{other.state_}
         , options_{other.options_}
+        , last_rx_ts_{other.last_rx_ts_}
+        , tls_records_{other.tls_records_}
     {
         other.fd_ = INVALID_SOCKET_HANDLE;
         other.state_ = ConnectionState::Disconnected;
@@ -60,6 +84,8 @@ public:
             fd_ = other.fd_;
             state_ = other.state_;
             options_ = other.options_;
+            last_rx_ts_ = other.last_rx_ts_;
+            tls_records_ = other.tls_records_;
             other.fd_ = INVALID_SOCKET_HANDLE;
             other.state_ = ConnectionState::Disconnected;
         }
@@ -86,39 +112,24 @@ public:
         std::string_view host,
         uint16_t port) noexcept
     {
+        auto address = resolve_address(host, port);
+        if (!address) {
+            state_ = ConnectionState::Error;
+            return std::unexpected{address.error()};
+        }
+        return connect(*address);
+    }
+
+    /// Connect to an already resolved address (AddressCache): no
+    /// getaddrinfo on the reconnect path
+    [[nodiscard]] TransportResult<void> connect(const ResolvedAddress& address) noexcept {
         if (!is_valid_socket(fd_)) {
             auto result = create();
             if (!result) return result;
         }
 
         state_ = ConnectionState::Connecting;
-
-        // Resolve hostname
-        struct addrinfo hints{};
-        hints.ai_family = AF_INET;
-        hints.ai_socktype = SOCK_STREAM;
-
-        char port_str[8];
-        std::snprintf(port_str, sizeof(port_str), "%u", port);
-
-        // Need null-terminated string for getaddrinfo
-        char host_buf[256];
-        size_t host_len = std::min(host.size(), sizeof(host_buf) - 1);
-        std::memcpy(host_buf, host.data(), host_len);
-        host_buf[host_len] = '\0';
-
-        struct addrinfo* result = nullptr;
-        int ret = ::getaddrinfo(host_buf, port_str, &hints, &result);
-        if (ret != 0) {
-            state_ = ConnectionState::Error;
-            return std::unexpected{make_gai_error(ret)};
-        }
-
-        // Try to connect
-        ret = ::connect(fd_, result->ai_addr, static_cast<SocketLength>(result->ai_addrlen));
-        ::freeaddrinfo(result);
-
-        if (ret != 0) {
+        if (::connect(fd_, address.data(), address.size()) != 0) {
             state_ = ConnectionState::Error;
             return std::unexpected{make_socket_error()};
         }
@@ -128,6 +139,15 @@ public:
         return {};
     }
 
+    /// Take ownership of a connected socket (e.g. from TcpAcceptor::accept()
+    /// or StandbyConnections::take())
+    void adopt(SocketHandle fd) noexcept {
+        close();
+        fd_ = fd;
+        apply_options();
+        state_ = ConnectionState::Connected;
+    }
+
     /// Close socket
     void close() noexcept {
         if (is_valid_socket(fd_)) {
@@ -136,6 +156,7 @@ public:
             fd_ = INVALID_SOCKET_HANDLE;
             state_ = ConnectionState::Disconnected;
         }
+        tls_records_ = false;
     }
 
     /// Check if connected
@@ -162,14 +183,32 @@ public:
         return static_cast<size_t>(sent);
     }
 
-    /// Receive data
-    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept {
+    /// Send several buffers as one gathered write (sendmsg on POSIX)
+    /// Like send(), may write fewer bytes than the segments hold.
+    [[nodiscard]] TransportResult<size_t> send_segments(
+        std::span<const std::span<const char>> segments) noexcept
+    {
         if (!is_connected()) {
             return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
         }
 
-        IoSize received = ::recv(fd_, buffer.data(), static_cast<IoSize>(buffer.size()), 0);
-        if (received < 0) {
+#if NFX_PLATFORM_POSIX
+        constexpr size_t MAX_SEGMENTS = 16;
+        if (segments.size() > MAX_SEGMENTS) {
+            return std::unexpected{TransportError{TransportErrorCode::WriteError, EINVAL}};
+        }
+        std::array<struct iovec, MAX_SEGMENTS> iov;
+        for (size_t i = 0; i < segments.size(); ++i) {
+            iov[i].iov_base = const_cast<char*>(segments[i].data());
+            iov[i].iov_len = segments[i].size();
+        }
+
+        // sendmsg rather than writev so MSG_NOSIGNAL applies
+        struct msghdr msg{};
+        msg.msg_iov = iov.data();
+        msg.msg_iovlen = segments.size();
+        IoSize sent = ::sendmsg(fd_, &msg, MSG_NOSIGNAL_COMPAT);
+        if (sent < 0) {
             int err = get_last_socket_error();
             if (is_would_block_error(err)) {
                 return 0;
@@ -177,13 +216,69 @@ public:
             state_ = ConnectionState::Error;
             return std::unexpected{make_socket_error(err)};
         }
+        return static_cast<size_t>(sent);
+#else
+        size_t total = 0;
+        for (const auto& seg : segments) {
+            auto sent = send(seg);
+            if (!sent) return sent;
+            total += *sent;
+            if (*sent < seg.size()) break;
+        }
+        return total;
+#endif
+    }
 
-        if (received == 0) {
-            state_ = ConnectionState::Disconnected;
+    /// Receive data
+    /// In spin modes this does not return until data arrives, the peer closes,
+    /// or recv_timeout_ms elapses (returns 0, as a blocking SO_RCVTIMEO would).
+    [[nodiscard]] TransportResult<size_t> receive(std::span<char> buffer) noexcept {
+        if (!is_connected()) {
             return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
         }
 
-        return static_cast<size_t>(received);
+        switch (options_.receive_mode) {
+            case ReceiveMode::BusySpin:
+                return receive_spin<memory::BusySpinWait>(buffer);
+            case ReceiveMode::Backoff:
+                return receive_spin<memory::BackoffWait<>>(buffer);
+            case ReceiveMode::Blocking:
+                break;
+        }
+        return receive_once(buffer);
+    }
+
+    /// Single recv attempt; 0 means no data available yet
+    [[nodiscard]] TransportResult<size_t> receive_once(std::span<char> buffer) noexcept {
+#if NFX_PLATFORM_LINUX
+        if (options_.rx_timestamps != RxTimestampMode::Off || tls_records_) {
+            return receive_with_control(buffer);
+        }
+#endif
+        IoSize received = ::recv(fd_, buffer.data(), static_cast<IoSize>(buffer.size()), 0);
+        return finish_receive(received);
+    }
+
+    /// Timestamp of the data returned by the last receive()
+    [[nodiscard]] RxTimestamp last_rx_timestamp() const noexcept { return last_rx_ts_; }
+
+    /// Request SO_TIMESTAMPING receive timestamps (Linux only)
+    [[nodiscard]] bool set_rx_timestamping(RxTimestampMode mode) noexcept {
+#if NFX_PLATFORM_LINUX
+        options_.rx_timestamps = mode;
+        if (is_valid_socket(fd_)) {
+            return enable_rx_timestamping(fd_, mode);
+        }
+        return true;
+#else
+        return mode == RxTimestampMode::Off;
+#endif
+    }
+
+    /// Read through recvmsg() and act on TLS record types: required once
+    /// kernel TLS receive is enabled on the socket (see tls_record.hpp)
+    void set_tls_records(bool enable) noexcept {
+        tls_records_ = enable;
     }
 
     /// Poll for read events
@@ -277,6 +372,36 @@ public:
         }
     }
 
+    /// Select how receive() waits; spin modes switch the socket to non-blocking
+    void set_receive_mode(ReceiveMode mode) noexcept {
+        options_.receive_mode = mode;
+        if (is_valid_socket(fd_)) {
+            (void)set_socket_nonblocking(fd_, mode != ReceiveMode::Blocking);
+        }
+    }
+
+    /// Set SO_BUSY_POLL / SO_PREFER_BUSY_POLL
+    /// Returns false if the kernel refuses (unsupported, or CAP_NET_ADMIN needed
+    /// to raise above net.core.busy_poll)
+    [[nodiscard]] bool set_busy_poll(int microseconds, bool prefer) noexcept {
+        options_.busy_poll_us = microseconds;
+        options_.prefer_busy_poll = prefer;
+        if (!is_valid_socket(fd_)) {
+            return true;
+        }
+        bool ok = true;
+        if (microseconds > 0) {
+            ok = set_socket_busy_poll(fd_, microseconds);
+        }
+        if (prefer) {
+            ok = set_socket_prefer_busy_poll(fd_, true) && ok;
+        }
+        return ok;
+    }
+
+    /// Get current options
+    [[nodiscard]] const SocketOptions& options() const noexcept { return options_; }
+
     /// Get socket state
     [[nodiscard]] ConnectionState state() const noexcept { return state_; }
 
@@ -284,17 +409,109 @@ public:
     [[nodiscard]] SocketHandle fd() const noexcept { return fd_; }
 
 private:
+#if NFX_PLATFORM_LINUX
+    /// recvmsg() carrying the SCM_TIMESTAMPING and TLS record type control
+    /// messages; TLS records other than application data are consumed here
+    [[nodiscard]] TransportResult<size_t> receive_with_control(std::span<char> buffer) noexcept {
+        alignas(cmsghdr) char control[RX_TIMESTAMP_CONTROL_SIZE + TLS_RECORD_CONTROL_SIZE];
+        for (;;) {
+            iovec iov{buffer.data(), buffer.size()};
+            msghdr msg{};
+            msg.msg_iov = &iov;
+            msg.msg_iovlen = 1;
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+
+            IoSize received = ::recvmsg(fd_, &msg, 0);
+            if (received > 0 && tls_records_) {
+                switch (tls_record_action(msg, buffer.first(static_cast<size_t>(received)))) {
+                    case TlsRecordAction::Deliver:
+                        break;
+                    case TlsRecordAction::Skip:
+                        continue;
+                    case TlsRecordAction::Close:
+                        state_ = ConnectionState::Disconnected;
+                        return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+                    case TlsRecordAction::Fail:
+                        state_ = ConnectionState::Error;
+                        return std::unexpected{TransportError{TransportErrorCode::TlsError, EPROTO}};
+                }
+            }
+            if (received > 0 && options_.rx_timestamps != RxTimestampMode::Off) {
+                last_rx_ts_ = extract_rx_timestamp(msg);
+            }
+            return finish_receive(received);
+        }
+    }
+#endif
+
+    [[nodiscard]] TransportResult<size_t> finish_receive(IoSize received) noexcept {
+        if (received < 0) {
+            int err = get_last_socket_error();
+            if (is_would_block_error(err)) {
+                return 0;
+            }
+            state_ = ConnectionState::Error;
+            return std::unexpected{make_socket_error(err)};
+        }
+
+        if (received == 0) {
+            state_ = ConnectionState::Disconnected;
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionClosed}};
+        }
+
+        return static_cast<size_t>(received);
+    }
+
     void apply_options() noexcept {
         (void)set_nodelay(options_.tcp_nodelay);
         (void)set_keepalive(options_.keep_alive);
         (void)set_receive_timeout(options_.recv_timeout_ms);
         (void)set_send_timeout(options_.send_timeout_ms);
         set_buffer_sizes(options_.recv_buffer_size, options_.send_buffer_size);
+        if (options_.receive_mode != ReceiveMode::Blocking) {
+            set_receive_mode(options_.receive_mode);
+            (void)set_busy_poll(options_.busy_poll_us, options_.prefer_busy_poll);
+        }
+        if (options_.rx_timestamps != RxTimestampMode::Off) {
+            (void)set_rx_timestamping(options_.rx_timestamps);
+        }
+    }
+
+    /// Spin on non-blocking recv until data, error, or recv_timeout_ms
+    template<typename Wait>
+    [[nodiscard]] TransportResult<size_t> receive_spin(std::span<char> buffer) noexcept {
+        using Clock = std::chrono::steady_clock;
+        using State = typename detail::WaitStateOf<Wait>::type;
+        constexpr bool stateful = requires(State& st) { Wait::wait(st); };
+        // Pure spin reads the clock every 1024 polls; backoff may sleep, so every poll
+        constexpr uint32_t clock_mask = stateful ? 0 : 1023;
+
+        const bool bounded = options_.recv_timeout_ms > 0;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(options_.recv_timeout_ms);
+        [[maybe_unused]] State state{};
+
+        for (uint32_t polls = 0; ; ++polls) {
+            auto result = receive_once(buffer);
+            if (!result.has_value() || *result > 0) {
+                return result;
+            }
+            if (bounded && (polls & clock_mask) == clock_mask && Clock::now() >= deadline) {
+                return 0;
+            }
+            if constexpr (stateful) {
+                Wait::wait(state);
+            } else {
+                Wait::wait();
+            }
+        }
     }
 
     SocketHandle fd_;
     ConnectionState state_;
     SocketOptions options_;
+    RxTimestamp last_rx_ts_{};
+    bool tls_records_{false};
 };
 
 // ============================================================================
@@ -306,6 +523,10 @@ class TcpTransport : public ITransport {
 public:
     TcpTransport() noexcept = default;
 
+    /// Construct with options applied on connect (e.g. SocketOptions::busy_poll())
+    explicit TcpTransport(const SocketOptions& options) noexcept
+        : socket_{options} {}
+
     [[nodiscard]] TransportResult<void> connect(
         std::string_view host,
         uint16_t port) override
@@ -313,6 +534,16 @@ public:
         return socket_.connect(host, port);
     }
 
+    /// Connect to a cached address (see AddressCache)
+    [[nodiscard]] TransportResult<void> connect(const ResolvedAddress& address) noexcept {
+        return socket_.connect(address);
+    }
+
+    /// Take over a connected socket (see StandbyConnections::take())
+    void adopt(SocketHandle fd) noexcept {
+        socket_.adopt(fd);
+    }
+
     void disconnect() noexcept override {
         socket_.close();
     }
@@ -329,6 +560,13 @@ public:
         return socket_.receive(buffer);
     }
 
+    /// Gather-send header/body/trailer segments (see ScatterAssembler)
+    [[nodiscard]] TransportResult<size_t> send_segments(
+        std::span<const std::span<const char>> segments) noexcept
+    {
+        return socket_.send_segments(segments);
+    }
+
     [[nodiscard]] bool set_nodelay(bool enable) noexcept override {
         return socket_.set_nodelay(enable);
     }
@@ -345,6 +583,10 @@ public:
         return socket_.set_send_timeout(milliseconds);
     }
 
+    [[nodiscard]] RxTimestamp last_rx_timestamp() const noexcept override {
+        return socket_.last_rx_timestamp();
+    }
+
     /// Get underlying socket
     [[nodiscard]] TcpSocket& socket() noexcept { return socket_; }
     [[nodiscard]] const TcpSocket& socket() const noexcept { return socket_; }
@@ -371,9 +613,13 @@ public:
     TcpAcceptor& operator=(const TcpAcceptor&) = delete;
 
     /// Bind and listen on port
+    /// @param port Port to bind (0 = ephemeral, see local_port())
+    /// @param reuse_port SO_REUSEPORT: one acceptor per worker on the same
+    ///        port, the kernel spreading connections over them
     [[nodiscard]] TransportResult<void> listen(
         uint16_t port,
-        int backlog = 128) noexcept
+        int backlog = 128,
+        bool reuse_port = false) noexcept
     {
 #if NFX_PLATFORM_WINDOWS
         // Ensure Winsock is initialized before any socket operations
@@ -388,6 +634,11 @@ public:
 
         // Allow address reuse
         (void)set_socket_reuseaddr(fd_, true);
+        if (reuse_port && !set_socket_reuseport(fd_, true)) {
+            auto err = make_socket_error();
+            close();
+            return std::unexpected{err};
+        }
 
         struct sockaddr_in addr{};
         addr.sin_family = AF_INET;
@@ -409,6 +660,15 @@ public:
         return {};
     }
 
+    /// Port the acceptor is bound to (0 if not listening)
+    [[nodiscard]] uint16_t local_port() const noexcept {
+        if (!is_valid_socket(fd_)) return 0;
+        struct sockaddr_in addr{};
+        SocketLength len = sizeof(addr);
+        if (::getsockname(fd_, reinterpret_cast<struct sockaddr*>(&addr), &len) < 0) return 0;
+        return ntohs(addr.sin_port);
+    }
+
     /// Accept a connection
     [[nodiscard]] TransportResult<SocketHandle> accept() noexcept {
         if (!is_valid_socket(fd_)) {
@@ -0,0 +1,101 @@
+#pragma once
+
+/// @file tls_record.hpp
+/// @brief Kernel TLS (kTLS) record-layer helpers
+///
+/// Once a TLS session's keys are installed in the kernel (TCP_ULP "tls",
+/// see ktls_transport.hpp), send() and recv() on the socket carry plaintext
+/// and the kernel (or a NIC with TLS offload) does the record crypto. The
+/// only thing left to userspace is the occasional non-data record: a plain
+/// recv() fails with EIO when the next record is an alert or a
+/// post-handshake message, so kTLS sockets are read with recvmsg() and a
+/// control buffer that receives the record type. This header has no TLS
+/// library dependency; transports include it to read kTLS sockets.
+
+#include "nexusfix/platform/platform.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#if NFX_PLATFORM_LINUX
+    #include <sys/socket.h>
+#endif
+
+namespace nfx {
+
+// ============================================================================
+// TLS Record Types
+// ============================================================================
+
+/// TLS record content type (RFC 8446 section 5.1)
+enum class TlsRecordType : uint8_t {
+    ChangeCipherSpec = 20,
+    Alert = 21,
+    Handshake = 22,
+    ApplicationData = 23
+};
+
+/// What a receive path does with one record read from a kTLS socket
+enum class TlsRecordAction : uint8_t {
+    Deliver,   // Application data: hand to the caller
+    Skip,      // NewSessionTicket: nothing to do, read again
+    Close,     // close_notify alert: orderly shutdown
+    Fail       // Fatal alert, KeyUpdate or unexpected record
+};
+
+#if NFX_PLATFORM_LINUX
+
+// ============================================================================
+// kTLS Helpers (Linux)
+// ============================================================================
+
+#ifndef SOL_TLS
+    #define SOL_TLS 282
+#endif
+
+inline constexpr int TLS_GET_RECORD_TYPE_OPT = 2;   // TLS_GET_RECORD_TYPE (linux/tls.h)
+
+/// Control buffer size needed by recvmsg() to carry the record type
+inline constexpr size_t TLS_RECORD_CONTROL_SIZE = CMSG_SPACE(sizeof(uint8_t));
+
+/// Record type of a recvmsg() result on a kTLS socket (ApplicationData
+/// when the kernel attached none)
+[[nodiscard]] inline TlsRecordType tls_record_type(const msghdr& msg) noexcept {
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(const_cast<msghdr*>(&msg), cmsg)) {
+        if (cmsg->cmsg_level == SOL_TLS && cmsg->cmsg_type == TLS_GET_RECORD_TYPE_OPT) {
+            return static_cast<TlsRecordType>(*CMSG_DATA(cmsg));
+        }
+    }
+    return TlsRecordType::ApplicationData;
+}
+
+/// Decide what to do with the bytes of one recvmsg() on a kTLS socket.
+/// The kernel never mixes a control record with application data in one
+/// read, so data is the whole record body.
+[[nodiscard]] inline TlsRecordAction tls_record_action(const msghdr& msg,
+                                                       std::span<const char> data) noexcept {
+    constexpr uint8_t NEW_SESSION_TICKET = 4;
+    constexpr uint8_t CLOSE_NOTIFY = 0;
+
+    switch (tls_record_type(msg)) {
+        case TlsRecordType::ApplicationData:
+            return TlsRecordAction::Deliver;
+        case TlsRecordType::Handshake:
+            // TLS 1.3 servers send session tickets after the handshake; a
+            // KeyUpdate would need new kernel keys and is not supported
+            return !data.empty() && static_cast<uint8_t>(data[0]) == NEW_SESSION_TICKET
+                ? TlsRecordAction::Skip : TlsRecordAction::Fail;
+        case TlsRecordType::Alert:
+            return data.size() >= 2 && static_cast<uint8_t>(data[1]) == CLOSE_NOTIFY
+                ? TlsRecordAction::Close : TlsRecordAction::Fail;
+        default:
+            return TlsRecordAction::Fail;
+    }
+}
+
+#endif // NFX_PLATFORM_LINUX
+
+} // namespace nfx
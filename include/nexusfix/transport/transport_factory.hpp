@@ -6,8 +6,10 @@
 /// Provides a unified interface for creating transports that automatically
 /// selects the best implementation for the current platform:
 /// - Linux: TcpTransport (POSIX) or IoUringTransport (if available)
-/// - Windows: WinsockTransport or IocpTransport (future)
-/// - macOS: TcpTransport (POSIX) or KqueueTransport (future)
+/// - Windows: IocpTransport (Registered I/O, IOCP fallback) or WinsockTransport
+/// - macOS: KqueueTransport (kevent waits) or TcpTransport (POSIX)
+/// - POSIX: KernelBypassTransport (AF_XDP / Onload / vendor stacks) on request
+/// - POSIX: ShmTransport (shared-memory rings) for engine <-> strategy on one host
 
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/transport/socket.hpp"
@@ -17,8 +19,12 @@
 // Include platform-appropriate headers
 #if NFX_PLATFORM_WINDOWS
     #include "nexusfix/transport/winsock_transport.hpp"
+    #include "nexusfix/transport/iocp_transport.hpp"
 #else
     #include "nexusfix/transport/tcp_transport.hpp"
+    #include "nexusfix/transport/kernel_bypass_transport.hpp"
+    #include "nexusfix/transport/shm_transport.hpp"
+    #include "nexusfix/transport/kqueue_transport.hpp"
 #endif
 
 // Include async transport if available
@@ -43,12 +49,21 @@ enum class TransportPreference : uint8_t {
     /// Simple blocking TCP (POSIX sockets/Winsock)
     Simple,
 
+    /// POSIX TCP spinning on non-blocking recv with SO_BUSY_POLL
+    BusyPoll,
+
+    /// Userspace stack (registered vendor stack, AF_XDP, or Onload sockets)
+    KernelBypass,
+
+    /// Shared-memory rings to a process on the same host (connect(name, 0))
+    SharedMemory,
+
     /// Explicit transport selection
     TcpPosix,       // POSIX TCP (Linux/macOS)
     IoUring,        // Linux io_uring
     Winsock,        // Windows Winsock2
-    Iocp,           // Windows IOCP (future)
-    Kqueue          // macOS kqueue (future)
+    Iocp,           // Windows Registered I/O, IOCP fallback
+    Kqueue          // macOS kqueue
 };
 
 // ============================================================================
@@ -94,6 +109,15 @@ public:
             case TransportPreference::Winsock:
                 return create_simple();
 
+            case TransportPreference::BusyPoll:
+                return create_busy_poll();
+
+            case TransportPreference::KernelBypass:
+                return create_kernel_bypass();
+
+            case TransportPreference::SharedMemory:
+                return create_shared_memory();
+
             case TransportPreference::IoUring:
                 return create_io_uring();
 
@@ -119,6 +143,49 @@ public:
 #endif
     }
 
+    /// Create busy-polling TCP transport (POSIX only)
+    /// Returns simple transport on Windows
+    [[nodiscard]] static std::unique_ptr<ITransport> create_busy_poll(
+        const SocketOptions& options = SocketOptions::busy_poll()) noexcept
+    {
+#if NFX_PLATFORM_WINDOWS
+        (void)options;
+        return create_simple();
+#else
+        return std::make_unique<TcpTransport>(options);
+#endif
+    }
+
+    /// Create kernel-bypass transport (POSIX only)
+    /// Uses the stack installed with register_bypass_stack(), else Onload-compatible
+    /// busy-polled sockets. Returns simple transport on Windows.
+#if NFX_PLATFORM_WINDOWS
+    [[nodiscard]] static std::unique_ptr<ITransport> create_kernel_bypass() noexcept {
+        return create_simple();
+    }
+#else
+    [[nodiscard]] static std::unique_ptr<ITransport> create_kernel_bypass(
+        const KernelBypassConfig& config = {}) noexcept
+    {
+        return std::make_unique<KernelBypassTransport>(config);
+    }
+#endif
+
+    /// Create shared-memory IPC transport (POSIX only)
+    /// connect(name, 0) attaches to the rings an engine created with listen(name).
+    /// Returns simple transport on Windows.
+#if NFX_PLATFORM_WINDOWS
+    [[nodiscard]] static std::unique_ptr<ITransport> create_shared_memory() noexcept {
+        return create_simple();
+    }
+#else
+    [[nodiscard]] static std::unique_ptr<ITransport> create_shared_memory(
+        const ShmRingConfig& config = {}) noexcept
+    {
+        return std::make_unique<ShmTransport>(config);
+    }
+#endif
+
     /// Create io_uring transport (Linux only)
     /// Returns simple transport on other platforms or if io_uring unavailable
     [[nodiscard]] static std::unique_ptr<ITransport> create_io_uring() noexcept {
@@ -139,28 +206,33 @@ public:
     }
 
     /// Create IOCP transport (Windows only)
-    /// Returns simple transport on other platforms or if IOCP unavailable
-    [[nodiscard]] static std::unique_ptr<ITransport> create_iocp() noexcept {
+    /// Uses Registered I/O when the RIO extension loads, overlapped IOCP
+    /// otherwise. Returns simple transport on other platforms.
 #if NFX_PLATFORM_WINDOWS && NFX_ASYNC_IO_IOCP
-        // TODO: Implement IOCP transport in Phase 3
-        // For now, fall back to Winsock
-        return create_simple();
+    [[nodiscard]] static std::unique_ptr<ITransport> create_iocp(
+        const IocpConfig& config = {}) noexcept
+    {
+        return std::make_unique<IocpTransport>(config);
+    }
 #else
+    [[nodiscard]] static std::unique_ptr<ITransport> create_iocp() noexcept {
         return create_simple();
-#endif
     }
+#endif
 
     /// Create kqueue transport (macOS only)
     /// Returns simple transport on other platforms or if kqueue unavailable
-    [[nodiscard]] static std::unique_ptr<ITransport> create_kqueue() noexcept {
-#if NFX_PLATFORM_MACOS && NFX_ASYNC_IO_KQUEUE
-        // TODO: Implement kqueue transport in Phase 4
-        // For now, fall back to POSIX TCP
-        return create_simple();
+#if NFX_ASYNC_IO_KQUEUE
+    [[nodiscard]] static std::unique_ptr<ITransport> create_kqueue(
+        const SocketOptions& options = {}) noexcept
+    {
+        return std::make_unique<KqueueTransport>(options);
+    }
 #else
+    [[nodiscard]] static std::unique_ptr<ITransport> create_kqueue() noexcept {
         return create_simple();
-#endif
     }
+#endif
 
     /// Create best available transport for current platform
     [[nodiscard]] static std::unique_ptr<ITransport> create_best() noexcept {
@@ -213,10 +285,12 @@ public:
     [[nodiscard]] static constexpr const char* default_transport_name() noexcept {
 #if NFX_PLATFORM_LINUX && NFX_ASYNC_IO_IOURING
         return "IoUringTransport";
+#elif NFX_PLATFORM_WINDOWS && NFX_ASYNC_IO_IOCP
+        return "IocpTransport";
 #elif NFX_PLATFORM_WINDOWS
         return "WinsockTransport";
-#elif NFX_PLATFORM_MACOS
-        return "TcpTransport (POSIX)";
+#elif NFX_PLATFORM_MACOS && NFX_ASYNC_IO_KQUEUE
+        return "KqueueTransport";
 #else
         return "TcpTransport (POSIX)";
 #endif
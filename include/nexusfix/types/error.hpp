@@ -37,10 +37,13 @@ enum class ParseErrorCode : uint8_t {
     DuplicateTag,
     UnterminatedField,
     InvalidMsgType,
-    GarbledMessage
+    GarbledMessage,
+    UndefinedTag,           // Tag not in the data dictionary
+    InvalidTagValue,        // Value not among the field's enums
+    IncorrectNumInGroup     // NumInGroup disagrees with the group entries
 };
 
-inline constexpr size_t PARSE_ERROR_COUNT = 12;
+inline constexpr size_t PARSE_ERROR_COUNT = 15;
 
 // ============================================================================
 // Compile-time ParseError Info (TICKET_023)
@@ -101,6 +104,18 @@ template<> struct ParseErrorInfo<ParseErrorCode::GarbledMessage> {
     static constexpr std::string_view message = "Garbled message";
 };
 
+template<> struct ParseErrorInfo<ParseErrorCode::UndefinedTag> {
+    static constexpr std::string_view message = "Undefined tag";
+};
+
+template<> struct ParseErrorInfo<ParseErrorCode::InvalidTagValue> {
+    static constexpr std::string_view message = "Value is incorrect for this tag";
+};
+
+template<> struct ParseErrorInfo<ParseErrorCode::IncorrectNumInGroup> {
+    static constexpr std::string_view message = "Incorrect NumInGroup count for repeating group";
+};
+
 /// Generate ParseError lookup table at compile time
 consteval std::array<std::string_view, PARSE_ERROR_COUNT> create_parse_error_table() {
     std::array<std::string_view, PARSE_ERROR_COUNT> table{};
@@ -116,6 +131,9 @@ consteval std::array<std::string_view, PARSE_ERROR_COUNT> create_parse_error_tab
     table[9]  = ParseErrorInfo<ParseErrorCode::UnterminatedField>::message;
     table[10] = ParseErrorInfo<ParseErrorCode::InvalidMsgType>::message;
     table[11] = ParseErrorInfo<ParseErrorCode::GarbledMessage>::message;
+    table[12] = ParseErrorInfo<ParseErrorCode::UndefinedTag>::message;
+    table[13] = ParseErrorInfo<ParseErrorCode::InvalidTagValue>::message;
+    table[14] = ParseErrorInfo<ParseErrorCode::IncorrectNumInGroup>::message;
     return table;
 }
 
@@ -187,10 +205,12 @@ enum class SessionErrorCode : uint8_t {
     HeartbeatTimeout,
     SequenceGap,
     InvalidState,
-    Disconnected
+    Disconnected,
+    RiskRejected,
+    Throttled
 };
 
-inline constexpr size_t SESSION_ERROR_COUNT = 9;
+inline constexpr size_t SESSION_ERROR_COUNT = 11;
 
 // ============================================================================
 // Compile-time SessionError Info (TICKET_023)
@@ -239,6 +259,14 @@ template<> struct SessionErrorInfo<SessionErrorCode::Disconnected> {
     static constexpr std::string_view message = "Disconnected";
 };
 
+template<> struct SessionErrorInfo<SessionErrorCode::RiskRejected> {
+    static constexpr std::string_view message = "Rejected by pre-trade risk check";
+};
+
+template<> struct SessionErrorInfo<SessionErrorCode::Throttled> {
+    static constexpr std::string_view message = "Outbound message rate exceeded";
+};
+
 /// Generate SessionError lookup table at compile time
 consteval std::array<std::string_view, SESSION_ERROR_COUNT> create_session_error_table() {
     std::array<std::string_view, SESSION_ERROR_COUNT> table{};
@@ -251,6 +279,8 @@ consteval std::array<std::string_view, SESSION_ERROR_COUNT> create_session_error
     table[6] = SessionErrorInfo<SessionErrorCode::SequenceGap>::message;
     table[7] = SessionErrorInfo<SessionErrorCode::InvalidState>::message;
     table[8] = SessionErrorInfo<SessionErrorCode::Disconnected>::message;
+    table[9] = SessionErrorInfo<SessionErrorCode::RiskRejected>::message;
+    table[10] = SessionErrorInfo<SessionErrorCode::Throttled>::message;
     return table;
 }
 
@@ -336,10 +366,13 @@ enum class TransportErrorCode : uint8_t {
     // Platform-specific errors
     WinsockInitFailed,    // WSAStartup failed (Windows)
     IocpError,            // IOCP operation failed (Windows)
-    KqueueError           // kqueue operation failed (macOS)
+    KqueueError,          // kqueue operation failed (macOS)
+
+    // TLS errors
+    TlsError              // TLS handshake or record layer failure
 };
 
-inline constexpr size_t TRANSPORT_ERROR_COUNT = 20;
+inline constexpr size_t TRANSPORT_ERROR_COUNT = 21;
 
 // ============================================================================
 // Compile-time TransportError Info (TICKET_023)
@@ -437,6 +470,11 @@ template<> struct TransportErrorInfo<TransportErrorCode::KqueueError> {
     static constexpr std::string_view message = "kqueue operation failed";
 };
 
+// TLS errors
+template<> struct TransportErrorInfo<TransportErrorCode::TlsError> {
+    static constexpr std::string_view message = "TLS failure";
+};
+
 /// Generate TransportError lookup table at compile time
 consteval std::array<std::string_view, TRANSPORT_ERROR_COUNT> create_transport_error_table() {
     std::array<std::string_view, TRANSPORT_ERROR_COUNT> table{};
@@ -460,6 +498,7 @@ consteval std::array<std::string_view, TRANSPORT_ERROR_COUNT> create_transport_e
     table[17] = TransportErrorInfo<TransportErrorCode::WinsockInitFailed>::message;
     table[18] = TransportErrorInfo<TransportErrorCode::IocpError>::message;
     table[19] = TransportErrorInfo<TransportErrorCode::KqueueError>::message;
+    table[20] = TransportErrorInfo<TransportErrorCode::TlsError>::message;
     return table;
 }
 
@@ -2,13 +2,16 @@
 
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <compare>
 #include <concepts>
 #include <string_view>
 #include <charconv>
 #include <limits>
+#include <optional>
 
 #include "nexusfix/platform/platform.hpp"
+#include "nexusfix/types/swar_decimal.hpp"
 
 namespace nfx {
 
@@ -92,6 +95,24 @@ struct FixedPrice {
 
     constexpr auto operator<=>(const FixedPrice&) const noexcept = default;
 
+    /// from_string() for text known to carry exactly Decimals fraction
+    /// digits (a venue's fixed price format): the point is not searched
+    /// for. Other text gets from_string()'s result.
+    template <int Decimals>
+    [[nodiscard]] static constexpr FixedPrice from_fixed_decimals(std::string_view sv) noexcept {
+        if !consteval {
+            if (!sv.empty()) [[likely]] {
+                const bool negative = sv[0] == '-';
+                int64_t scaled;
+                if (detail::swar_parse_fixed_decimals<Decimals, DECIMAL_PLACES>(
+                        sv.substr(negative ? 1 : 0), scaled)) [[likely]] {
+                    return FixedPrice{negative ? -scaled : scaled};
+                }
+            }
+        }
+        return from_string(sv);
+    }
+
     /// Parse from string view (zero-copy)
     [[nodiscard]] NFX_HOT
     static constexpr FixedPrice from_string(std::string_view sv) noexcept {
@@ -105,6 +126,14 @@ struct FixedPrice {
             pos = 1;
         }
 
+        // SWAR fast path; unusual text falls through to the scalar loop
+        if !consteval {
+            int64_t scaled;
+            if (detail::swar_parse_scaled<DECIMAL_PLACES>(sv.substr(pos), scaled)) [[likely]] {
+                return FixedPrice{negative ? -scaled : scaled};
+            }
+        }
+
         int64_t integer_part = 0;
         int64_t fractional_part = 0;
         int fractional_digits = 0;
@@ -130,7 +159,7 @@ struct FixedPrice {
 
         // Scale fractional part to full precision (branch-free multiplication)
         // Use lookup table for power of 10
-        static constexpr int64_t POW10[] = {
+        constexpr int64_t POW10[] = {
             100000000LL, 10000000LL, 1000000LL, 100000LL,
             10000LL, 1000LL, 100LL, 10LL, 1LL
         };
@@ -139,6 +168,46 @@ struct FixedPrice {
         int64_t result = integer_part * SCALE + fractional_part;
         return FixedPrice{negative ? -result : result};
     }
+
+    /// Longest text to_chars() can produce ("-92233720368.54775808")
+    static constexpr size_t MAX_CHARS = 32;
+
+    /// Format as exact decimal text, trailing fractional zeros trimmed
+    /// (150.25 -> "150.25", 100 -> "100"). No rounding, no allocation.
+    /// @param out Buffer of at least MAX_CHARS bytes
+    /// @return Number of characters written
+    [[nodiscard]] NFX_HOT
+    constexpr size_t to_chars(char* out) const noexcept {
+        uint64_t mag = raw < 0 ? 0 - static_cast<uint64_t>(raw) : static_cast<uint64_t>(raw);
+        uint64_t integer_part = mag / static_cast<uint64_t>(SCALE);
+        uint64_t fractional_part = mag % static_cast<uint64_t>(SCALE);
+
+        size_t len = 0;
+        if (raw < 0) out[len++] = '-';
+
+        char digits[20];
+        size_t n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + (integer_part % 10));
+            integer_part /= 10;
+        } while (integer_part > 0);
+        while (n > 0) out[len++] = digits[--n];
+
+        if (fractional_part != 0) {
+            int frac_digits = DECIMAL_PLACES;
+            while (fractional_part % 10 == 0) {
+                fractional_part /= 10;
+                --frac_digits;
+            }
+            out[len++] = '.';
+            for (int i = frac_digits - 1; i >= 0; --i) {
+                out[len + static_cast<size_t>(i)] = static_cast<char>('0' + (fractional_part % 10));
+                fractional_part /= 10;
+            }
+            len += static_cast<size_t>(frac_digits);
+        }
+        return len;
+    }
 };
 
 // ============================================================================
@@ -180,6 +249,24 @@ struct Qty {
 
     constexpr auto operator<=>(const Qty&) const noexcept = default;
 
+    /// from_string() for text known to carry exactly Decimals fraction
+    /// digits (a venue's fixed quantity format): the point is not searched
+    /// for. Other text gets from_string()'s result.
+    template <int Decimals>
+    [[nodiscard]] static constexpr Qty from_fixed_decimals(std::string_view sv) noexcept {
+        if !consteval {
+            if (!sv.empty()) [[likely]] {
+                const bool negative = sv[0] == '-';
+                int64_t scaled;
+                if (detail::swar_parse_fixed_decimals<Decimals, DECIMAL_PLACES>(
+                        sv.substr(negative ? 1 : 0), scaled)) [[likely]] {
+                    return Qty{negative ? -scaled : scaled};
+                }
+            }
+        }
+        return from_string(sv);
+    }
+
     [[nodiscard]] NFX_HOT
     static constexpr Qty from_string(std::string_view sv) noexcept {
         if (sv.empty()) [[unlikely]] return Qty{0};
@@ -192,6 +279,14 @@ struct Qty {
             pos = 1;
         }
 
+        // SWAR fast path; unusual text falls through to the scalar loop
+        if !consteval {
+            int64_t scaled;
+            if (detail::swar_parse_scaled<DECIMAL_PLACES>(sv.substr(pos), scaled)) [[likely]] {
+                return Qty{negative ? -scaled : scaled};
+            }
+        }
+
         int64_t integer_part = 0;
         int64_t fractional_part = 0;
         int fractional_digits = 0;
@@ -216,12 +311,52 @@ struct Qty {
         }
 
         // Scale fractional part to full precision (branch-free with lookup table)
-        static constexpr int64_t POW10[] = {10000LL, 1000LL, 100LL, 10LL, 1LL};
+        constexpr int64_t POW10[] = {10000LL, 1000LL, 100LL, 10LL, 1LL};
         fractional_part *= POW10[fractional_digits];
 
         int64_t result = integer_part * SCALE + fractional_part;
         return Qty{negative ? -result : result};
     }
+
+    /// Longest text to_chars() can produce ("-922337203685477.5808")
+    static constexpr size_t MAX_CHARS = 24;
+
+    /// Format as exact decimal text, trailing fractional zeros trimmed
+    /// (100 -> "100", 0.5 -> "0.5"). No rounding, no allocation.
+    /// @param out Buffer of at least MAX_CHARS bytes
+    /// @return Number of characters written
+    [[nodiscard]] NFX_HOT
+    constexpr size_t to_chars(char* out) const noexcept {
+        uint64_t mag = raw < 0 ? 0 - static_cast<uint64_t>(raw) : static_cast<uint64_t>(raw);
+        uint64_t integer_part = mag / static_cast<uint64_t>(SCALE);
+        uint64_t fractional_part = mag % static_cast<uint64_t>(SCALE);
+
+        size_t len = 0;
+        if (raw < 0) out[len++] = '-';
+
+        char digits[20];
+        size_t n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + (integer_part % 10));
+            integer_part /= 10;
+        } while (integer_part > 0);
+        while (n > 0) out[len++] = digits[--n];
+
+        if (fractional_part != 0) {
+            int frac_digits = DECIMAL_PLACES;
+            while (fractional_part % 10 == 0) {
+                fractional_part /= 10;
+                --frac_digits;
+            }
+            out[len++] = '.';
+            for (int i = frac_digits - 1; i >= 0; --i) {
+                out[len + static_cast<size_t>(i)] = static_cast<char>('0' + (fractional_part % 10));
+                fractional_part /= 10;
+            }
+            len += static_cast<size_t>(frac_digits);
+        }
+        return len;
+    }
 };
 
 // ============================================================================
@@ -240,6 +375,150 @@ struct Timestamp {
     [[nodiscard]] constexpr int64_t as_seconds() const noexcept { return nanos / 1000000000; }
 
     constexpr auto operator<=>(const Timestamp&) const noexcept = default;
+
+    /// Longest text to_utc_chars() can produce ("YYYYMMDD-HH:MM:SS.nnnnnnnnn")
+    static constexpr size_t MAX_CHARS = 27;
+
+    /// Parse FIX UTCTimestamp "YYYYMMDD-HH:MM:SS[.sss[sss[sss]]]"
+    /// Digits past nanoseconds are truncated. Integer math only.
+    /// @return nullopt on malformed text
+    [[nodiscard]] NFX_HOT
+    static constexpr std::optional<Timestamp> from_utc_string(std::string_view sv) noexcept {
+        // SWAR fast path; unusual text falls through to the scalar loop,
+        // which also decides what counts as malformed
+        if !consteval {
+            if (sv.size() >= 17 && sv.size() <= MAX_CHARS) [[likely]] {
+                uint64_t date;
+                std::memcpy(&date, sv.data(), 8);
+                int64_t year, month, day, tod;
+                if (detail::swar_utc_date(date, year, month, day) &&
+                    detail::swar_utc_time_of_day(sv, tod)) [[likely]] {
+                    return Timestamp{days_from_civil(year, month, day) * NANOS_PER_DAY + tod};
+                }
+            }
+        }
+
+        if (sv.size() < 17 || sv[8] != '-' || sv[11] != ':' || sv[14] != ':') [[unlikely]] {
+            return std::nullopt;
+        }
+        int64_t parts[6]{};
+        constexpr size_t POS[6] = {0, 4, 6, 9, 12, 15};
+        constexpr size_t LEN[6] = {4, 2, 2, 2, 2, 2};
+        for (size_t p = 0; p < 6; ++p) {
+            for (size_t i = POS[p]; i < POS[p] + LEN[p]; ++i) {
+                const char c = sv[i];
+                if (c < '0' || c > '9') [[unlikely]] return std::nullopt;
+                parts[p] = parts[p] * 10 + (c - '0');
+            }
+        }
+        const int64_t month = parts[1], day = parts[2];
+        if (month < 1 || month > 12 || day < 1 || day > 31 ||
+            parts[3] > 23 || parts[4] > 59 || parts[5] > 60) [[unlikely]] {
+            return std::nullopt;
+        }
+
+        int64_t frac = 0;
+        int frac_digits = 0;
+        if (sv.size() > 17) {
+            if (sv[17] != '.' || sv.size() == 18) [[unlikely]] return std::nullopt;
+            for (size_t i = 18; i < sv.size(); ++i) {
+                const char c = sv[i];
+                if (c < '0' || c > '9') [[unlikely]] return std::nullopt;
+                if (frac_digits < 9) {
+                    frac = frac * 10 + (c - '0');
+                    ++frac_digits;
+                }
+            }
+        }
+        for (; frac_digits < 9; ++frac_digits) frac *= 10;
+
+        const int64_t days = days_from_civil(parts[0], month, day);
+        const int64_t secs = days * 86400 + parts[3] * 3600 + parts[4] * 60 + parts[5];
+        return Timestamp{secs * NANOS_PER_SECOND + frac};
+    }
+
+    /// Format as FIX UTCTimestamp with the shortest exact sub-second part:
+    /// none, milliseconds, microseconds or nanoseconds.
+    /// @param out Buffer of at least MAX_CHARS bytes
+    /// @return Number of characters written
+    [[nodiscard]] NFX_HOT
+    constexpr size_t to_utc_chars(char* out) const noexcept {
+        // Floor division so pre-epoch times keep a positive sub-second part
+        int64_t secs = nanos / NANOS_PER_SECOND;
+        int64_t frac = nanos % NANOS_PER_SECOND;
+        if (frac < 0) {
+            frac += NANOS_PER_SECOND;
+            --secs;
+        }
+        int64_t days = secs / 86400;
+        int64_t tod = secs % 86400;
+        if (tod < 0) {
+            tod += 86400;
+            --days;
+        }
+
+        // Civil date from days since 1970-01-01 (proleptic Gregorian)
+        const int64_t z = days + 719468;
+        const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+        const int64_t doe = z - era * 146097;
+        const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const int64_t mp = (5 * doy + 2) / 153;
+        const int64_t day = doy - (153 * mp + 2) / 5 + 1;
+        const int64_t month = mp < 10 ? mp + 3 : mp - 9;
+        const int64_t year = yoe + era * 400 + (month <= 2 ? 1 : 0);
+
+        auto put = [out](size_t pos, int64_t value, size_t width) constexpr noexcept {
+            for (size_t i = width; i > 0; --i) {
+                out[pos + i - 1] = static_cast<char>('0' + (value % 10));
+                value /= 10;
+            }
+        };
+        put(0, year, 4);
+        put(4, month, 2);
+        put(6, day, 2);
+        out[8] = '-';
+        put(9, tod / 3600, 2);
+        out[11] = ':';
+        put(12, (tod / 60) % 60, 2);
+        out[14] = ':';
+        put(15, tod % 60, 2);
+
+        if (frac == 0) return 17;
+        out[17] = '.';
+        if (frac % 1000000 == 0) {
+            put(18, frac / 1000000, 3);
+            return 21;
+        }
+        if (frac % 1000 == 0) {
+            put(18, frac / 1000, 6);
+            return 24;
+        }
+        put(18, frac, 9);
+        return MAX_CHARS;
+    }
+
+    static constexpr int64_t NANOS_PER_SECOND = 1000000000LL;
+    static constexpr int64_t NANOS_PER_DAY = 86400 * NANOS_PER_SECOND;
+
+    /// Days since 1970-01-01 for a proleptic Gregorian date
+    [[nodiscard]] static constexpr int64_t days_from_civil(
+        int64_t y, int64_t m, int64_t d) noexcept {
+        y -= m <= 2 ? 1 : 0;
+        const int64_t era = (y >= 0 ? y : y - 399) / 400;
+        const int64_t yoe = y - era * 400;
+        const int64_t doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+        const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+    }
+};
+
+/// Sub-second digits of a generated UTCTimestamp ("ss.sss", "ss.ssssss",
+/// "ss.sssssssss"); MiFID II clock-sync rules call for us or ns
+enum class TimestampPrecision : uint8_t {
+    Milliseconds = 3,
+    Microseconds = 6,
+    Nanoseconds = 9
 };
 
 // ============================================================================
@@ -464,6 +743,70 @@ template<OrdStatus S>
            s == OrdStatus::DoneForDay;
 }
 
+// Compile-time OrdStatus transition table: may an order reported in
+// `from` next be reported in `to`? Repeats are allowed (another partial
+// fill), PendingNew is never re-entered, and terminal states only repeat
+// - except DoneForDay, which a GTC order leaves on the next day.
+// Trade corrections/cancels bypass the table (see is_trade_correction).
+namespace detail {
+    inline constexpr std::array<OrdStatus, 15> ORD_STATUS_VALUES{
+        OrdStatus::New, OrdStatus::PartiallyFilled, OrdStatus::Filled,
+        OrdStatus::DoneForDay, OrdStatus::Canceled, OrdStatus::Replaced,
+        OrdStatus::PendingCancel, OrdStatus::Stopped, OrdStatus::Rejected,
+        OrdStatus::Suspended, OrdStatus::PendingNew, OrdStatus::Calculated,
+        OrdStatus::Expired, OrdStatus::AcceptedForBidding, OrdStatus::PendingReplace};
+
+    /// Position in ORD_STATUS_VALUES by character, 0xFF if not a status
+    consteval std::array<uint8_t, 128> create_ord_status_ordinals() {
+        std::array<uint8_t, 128> table{};
+        for (auto& e : table) e = 0xFF;
+        for (size_t i = 0; i < ORD_STATUS_VALUES.size(); ++i) {
+            table[static_cast<unsigned char>(ORD_STATUS_VALUES[i])] = static_cast<uint8_t>(i);
+        }
+        return table;
+    }
+    inline constexpr auto ORD_STATUS_ORDINAL = create_ord_status_ordinals();
+
+    /// Bit `to` of entry `from` (both ordinals) set if the move is allowed
+    consteval std::array<uint16_t, 15> create_ord_status_transitions() {
+        std::array<uint16_t, 15> table{};
+        for (size_t f = 0; f < ORD_STATUS_VALUES.size(); ++f) {
+            const OrdStatus from = ORD_STATUS_VALUES[f];
+            for (size_t t = 0; t < ORD_STATUS_VALUES.size(); ++t) {
+                const OrdStatus to = ORD_STATUS_VALUES[t];
+                bool allowed = true;
+                if (from != to) {
+                    if (to == OrdStatus::PendingNew) allowed = false;
+                    if (is_terminal_status(from) && from != OrdStatus::DoneForDay) allowed = false;
+                }
+                if (allowed) table[f] = static_cast<uint16_t>(table[f] | (1u << t));
+            }
+        }
+        return table;
+    }
+    inline constexpr auto ORD_STATUS_TRANSITIONS = create_ord_status_transitions();
+}
+
+/// True for the 15 OrdStatus (39) values defined above
+[[nodiscard]] inline constexpr bool is_valid_ord_status(char c) noexcept {
+    const auto idx = static_cast<unsigned char>(c);
+    return idx < 128 && detail::ORD_STATUS_ORDINAL[idx] != 0xFF;
+}
+
+[[nodiscard]] inline constexpr bool can_transition(OrdStatus from, OrdStatus to) noexcept {
+    const auto f = static_cast<unsigned char>(static_cast<char>(from));
+    const auto t = static_cast<unsigned char>(static_cast<char>(to));
+    if (f >= 128 || t >= 128) [[unlikely]] return false;
+    const uint8_t fi = detail::ORD_STATUS_ORDINAL[f];
+    const uint8_t ti = detail::ORD_STATUS_ORDINAL[t];
+    if (fi == 0xFF || ti == 0xFF) [[unlikely]] return false;
+    return (detail::ORD_STATUS_TRANSITIONS[fi] >> ti) & 1u;
+}
+
+static_assert(can_transition(OrdStatus::PartiallyFilled, OrdStatus::Filled));
+static_assert(!can_transition(OrdStatus::Filled, OrdStatus::PartiallyFilled));
+static_assert(!can_transition(OrdStatus::New, OrdStatus::PendingNew));
+
 // ============================================================================
 // Execution Type
 // ============================================================================
@@ -553,6 +896,23 @@ template<ExecType E>
     return "Unknown";
 }
 
+/// True for the ExecType (150) values defined above
+[[nodiscard]] inline constexpr bool is_valid_exec_type(char c) noexcept {
+    const auto idx = static_cast<unsigned char>(c);
+    return idx < 128 && detail::EXEC_TYPE_TABLE[idx] != "Unknown";
+}
+
+/// Report carries a fill in LastQty (32) / LastPx (31)
+[[nodiscard]] constexpr bool is_fill_exec(ExecType e) noexcept {
+    return e == ExecType::Trade || e == ExecType::PartialFill || e == ExecType::Fill;
+}
+
+/// Report amends earlier fills: CumQty may go down, terminal states reopen
+[[nodiscard]] constexpr bool is_trade_correction(ExecType e) noexcept {
+    return e == ExecType::TradeCorrect || e == ExecType::TradeCancel ||
+           e == ExecType::Restated;
+}
+
 // ============================================================================
 // Time In Force
 // ============================================================================
@@ -1,9 +1,13 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string_view>
 
+#include "nexusfix/types/field_types.hpp"
+
 namespace nfx {
 
 // ============================================================================
@@ -403,6 +407,51 @@ struct MDEntry {
     }
 };
 
+// ============================================================================
+// Market Data Entry Columns (structure-of-arrays)
+// ============================================================================
+
+/// Book-building fields of a decoded MDEntry group, one contiguous column per
+/// field, so book updates can run over prices and sizes as vectors.
+/// Row i of every column describes entry i; filled by
+/// parser::decode_md_columns().
+template <size_t Capacity>
+struct MDEntryColumns {
+    static constexpr size_t CAPACITY = Capacity;
+
+    alignas(64) std::array<FixedPrice, Capacity> prices{};
+    alignas(64) std::array<Qty, Capacity> sizes{};
+    std::array<MDEntryType, Capacity> types{};
+    std::array<MDUpdateAction, Capacity> actions{};
+    std::array<int32_t, Capacity> levels{};  // MDEntryPositionNo, 0 if absent
+    size_t count{0};
+    bool truncated{false};  // Group had more than Capacity entries
+
+    constexpr void clear() noexcept {
+        count = 0;
+        truncated = false;
+    }
+
+    [[nodiscard]] constexpr size_t size() const noexcept { return count; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return count == 0; }
+
+    [[nodiscard]] std::span<const FixedPrice> price_column() const noexcept {
+        return {prices.data(), count};
+    }
+    [[nodiscard]] std::span<const Qty> size_column() const noexcept {
+        return {sizes.data(), count};
+    }
+    [[nodiscard]] std::span<const MDEntryType> type_column() const noexcept {
+        return {types.data(), count};
+    }
+    [[nodiscard]] std::span<const MDUpdateAction> action_column() const noexcept {
+        return {actions.data(), count};
+    }
+    [[nodiscard]] std::span<const int32_t> level_column() const noexcept {
+        return {levels.data(), count};
+    }
+};
+
 // ============================================================================
 // Related Symbol Entry (for subscription requests)
 // ============================================================================
@@ -0,0 +1,306 @@
+#pragma once
+
+/// @file swar_decimal.hpp
+/// @brief SWAR decimal text conversion (prices, quantities, timestamps)
+///
+/// Converts "123.4567"-style field values into integers scaled by 10^Places
+/// (the FixedPrice / Qty representation) eight digits per step instead of one:
+///
+///   1. Load the first and last 8 bytes of the text
+///   2. Locate '.' with a byte-equality test over each whole word
+///   3. Shift the integer and fraction runs into '0'-padded 8-byte words
+///   4. Validate every byte is a digit with one mask compare
+///   5. Reduce 8 ASCII digits to an integer two multiplies deep
+///
+/// Loads never touch bytes outside the input. Anything outside the fast
+/// path's shape (sign handled by the caller, fewer than 8 bytes, more than
+/// 16 digits, more than Places fraction digits, stray characters) is
+/// reported as not handled so the caller falls back to its scalar loop
+/// with unchanged semantics.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+
+namespace nfx::detail {
+
+// ============================================================================
+// 8-Digit Word Primitives
+// ============================================================================
+
+inline constexpr uint64_t SWAR_ONES = 0x0101010101010101ULL;
+inline constexpr uint64_t SWAR_ASCII_ZEROS = 0x3030303030303030ULL;
+
+/// Nonzero unless all 8 bytes are ASCII '0'..'9'; OR several words'
+/// results together to validate them with a single branch
+[[nodiscard]] NFX_FORCE_INLINE constexpr uint64_t swar_non_digits(uint64_t word) noexcept {
+    return ((word & 0xF0F0F0F0F0F0F0F0ULL) |
+            (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))
+           ^ 0x3333333333333333ULL;
+}
+
+/// Eight ASCII digits (first digit in the lowest byte) to their value.
+/// Pairs are combined with a multiply-by-10 (lea/add), then all four pairs
+/// with two independent multiplies, so the chain is two multiplies deep.
+[[nodiscard]] NFX_FORCE_INLINE constexpr uint64_t swar_parse_8(uint64_t word) noexcept {
+    constexpr uint64_t MASK = 0x000000FF000000FFULL;
+    constexpr uint64_t MUL1 = 100ULL + (1000000ULL << 32);
+    constexpr uint64_t MUL2 = 1ULL + (10000ULL << 32);
+    word -= SWAR_ASCII_ZEROS;
+    word = word * 10 + (word >> 8);
+    return (((word & MASK) * MUL1) + (((word >> 16) & MASK) * MUL2)) >> 32;
+}
+
+/// Value below 10^8 to eight ASCII digits (first digit in the lowest byte):
+/// split into 4-digit lanes, then 2-digit, then 1-digit lanes with
+/// reciprocal multiplies, all lanes at once
+[[nodiscard]] NFX_FORCE_INLINE constexpr uint64_t swar_format_8(uint32_t value) noexcept {
+    const uint64_t x = (value / 10000) | (static_cast<uint64_t>(value % 10000) << 32);
+    const uint64_t hundreds = ((x * 5243) >> 19) & 0x0000007F0000007FULL;   // n / 100
+    const uint64_t y = hundreds | ((x - hundreds * 100) << 16);
+    const uint64_t tens = ((y * 103) >> 10) & 0x000F000F000F000FULL;        // n / 10
+    return (tens | ((y - tens * 10) << 8)) + SWAR_ASCII_ZEROS;
+}
+
+/// Index of the first '.' in a word, or 8 if there is none (exact: no
+/// false positives from borrows, unlike the subtract-based zero test)
+[[nodiscard]] NFX_FORCE_INLINE constexpr size_t swar_find_dot(uint64_t word) noexcept {
+    constexpr uint64_t LOW7 = 0x7F7F7F7F7F7F7F7FULL;
+    const uint64_t x = word ^ (SWAR_ONES * '.');
+    const uint64_t hit = ~(((x & LOW7) + LOW7) | x | LOW7);
+    return static_cast<size_t>(std::countr_zero(hit)) / 8;
+}
+
+/// Keep the low `len` bytes of a word (len <= 8), '0'-filling the rest
+[[nodiscard]] NFX_FORCE_INLINE constexpr uint64_t swar_keep_low(uint64_t word, size_t len) noexcept {
+    const uint64_t keep = len >= 8 ? ~0ULL : (1ULL << (len * 8)) - 1;
+    return (word & keep) | (SWAR_ASCII_ZEROS & ~keep);
+}
+
+/// Keep the low `len` bytes of a word (0 < len <= 8) as its high bytes,
+/// '0'-filling below: right-aligns a digit run for swar_parse_8
+[[nodiscard]] NFX_FORCE_INLINE constexpr uint64_t swar_align_high(uint64_t word, size_t len) noexcept {
+    const size_t shift = (8 - len) * 8;
+    return (word << shift) | (SWAR_ASCII_ZEROS & ~(~0ULL << shift));
+}
+
+// ============================================================================
+// Scaled Decimal Parse
+// ============================================================================
+
+/// Parse unsigned decimal text (at most 16 digits and one point, at most
+/// Places fraction digits) into value * 10^Places. Returns false without
+/// touching `out` when the text is outside the fast path; the caller's
+/// scalar parser then defines the result.
+template <int Places>
+[[nodiscard]] inline bool swar_parse_scaled(std::string_view sv, int64_t& out) noexcept {
+    static_assert(Places >= 0 && Places <= 8, "fraction must fit one word");
+    static constexpr uint64_t POW10[] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL,
+        100000ULL, 1000000ULL, 10000000ULL, 100000000ULL
+    };
+
+    if constexpr (std::endian::native != std::endian::little) {
+        return false;
+    } else {
+        // Below 8 bytes the scalar loop finishes within the SWAR setup
+        // latency (find point, shift, reduce), so only longer text is taken
+        const size_t n = sv.size();
+        if (n < 8 || n > 17) return false;
+
+        // head: bytes [0, 8); tail: the last 8 bytes, so the fraction ends
+        // in its high bytes. Both loads stay inside the text.
+        const char* p = sv.data();
+        uint64_t head, tail;
+        std::memcpy(&head, p, 8);
+        std::memcpy(&tail, p + n - 8, 8);
+
+        // First '.': head, then tail (its overlap with head holds none),
+        // then byte 8, the only one neither covers when n == 17
+        size_t dot = swar_find_dot(head);
+        if (dot == 8) {
+            const size_t in_tail = swar_find_dot(tail);
+            dot = in_tail < 8 ? n - 8 + in_tail : (n == 17 && p[8] == '.' ? 8 : n);
+        }
+        if (dot > 16) [[unlikely]] return false;
+        const size_t frac_len = dot < n ? n - dot - 1 : 0;
+        if (frac_len > static_cast<size_t>(Places)) [[unlikely]] return false;
+
+        // Integer part: one word, or a leading remainder plus the 8 digits
+        // ending at the point
+        uint64_t int_hi = SWAR_ASCII_ZEROS;
+        uint64_t int_lo = SWAR_ASCII_ZEROS;
+        if (dot <= 8) [[likely]] {
+            if (dot > 0) int_lo = swar_align_high(head, dot);
+        } else {
+            std::memcpy(&int_lo, p + dot - 8, 8);
+            int_hi = swar_align_high(head, dot - 8);
+        }
+
+        // Fraction: the last frac_len bytes, left-aligned so that the '0'
+        // fill supplies the scaling to 8 places
+        const uint64_t frac = frac_len > 0
+            ? swar_keep_low(tail >> ((8 - frac_len) * 8), frac_len)
+            : SWAR_ASCII_ZEROS;
+
+        if ((swar_non_digits(int_hi) | swar_non_digits(int_lo) |
+             swar_non_digits(frac)) != 0) [[unlikely]] {
+            return false;
+        }
+
+        const uint64_t integer = swar_parse_8(int_hi) * POW10[8] + swar_parse_8(int_lo);
+        const uint64_t fraction = swar_parse_8(frac) / POW10[8 - Places];
+        out = static_cast<int64_t>(integer * POW10[Places] + fraction);
+        return true;
+    }
+}
+
+// ============================================================================
+// Fixed-Width Fields
+// ============================================================================
+// When a venue promises a field's shape (zero-padded sequence numbers,
+// prices always sent with N decimals) every position is known up front:
+// constant-size loads, no point search, one validity branch.
+
+/// Exactly Width ASCII digits at p (1 <= Width <= 16). False on a non-digit
+/// (or a big-endian target); the caller then uses its general parser.
+template <size_t Width>
+[[nodiscard]] NFX_FORCE_INLINE bool swar_parse_fixed(const char* p, uint64_t& out) noexcept {
+    static_assert(Width >= 1 && Width <= 16, "fixed fields span at most two words");
+
+    if constexpr (std::endian::native != std::endian::little) {
+        return false;
+    } else {
+        // Digits land in the high bytes; the '0' fill acts as leading zeros
+        uint64_t hi = SWAR_ASCII_ZEROS;
+        uint64_t lo = SWAR_ASCII_ZEROS;
+        if constexpr (Width <= 8) {
+            std::memcpy(reinterpret_cast<char*>(&lo) + (8 - Width), p, Width);
+        } else {
+            std::memcpy(reinterpret_cast<char*>(&hi) + (16 - Width), p, Width - 8);
+            std::memcpy(&lo, p + Width - 8, 8);
+        }
+        if ((swar_non_digits(hi) | swar_non_digits(lo)) != 0) [[unlikely]] return false;
+        out = swar_parse_8(hi) * 100000000ULL + swar_parse_8(lo);
+        return true;
+    }
+}
+
+/// Unsigned "I.F" text with exactly Decimals fraction digits and 1..8
+/// integer digits, 8..17 bytes long, into value * 10^Places. The point's
+/// position follows from the length, so unlike swar_parse_scaled() there
+/// is no search; false leaves `out` untouched for the scalar parser.
+template <int Decimals, int Places>
+[[nodiscard]] NFX_FORCE_INLINE bool swar_parse_fixed_decimals(
+    std::string_view sv, int64_t& out) noexcept
+{
+    static_assert(Decimals >= 1 && Decimals <= Places && Places <= 8,
+                  "fraction must fit the target scale");
+    static constexpr uint64_t POW10[] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL,
+        100000ULL, 1000000ULL, 10000000ULL, 100000000ULL
+    };
+
+    if constexpr (std::endian::native != std::endian::little) {
+        return false;
+    } else {
+        const size_t n = sv.size();
+        const size_t int_len = n - Decimals - 1;     // Wraps when n is too short
+        if (n < 8 || int_len - 1 >= 8) return false;
+
+        const char* p = sv.data();
+        uint64_t head, tail;
+        std::memcpy(&head, p, 8);
+        std::memcpy(&tail, p + n - 8, 8);
+
+        // Fraction: the high Decimals bytes of tail; integer: the first
+        // int_len bytes of head, right-aligned
+        constexpr uint64_t FRAC_KEEP = ~0ULL << ((8 - Decimals) * 8);
+        const uint64_t frac = (tail & FRAC_KEEP) | (SWAR_ASCII_ZEROS & ~FRAC_KEEP);
+        const uint64_t integer = swar_align_high(head, int_len);
+
+        if (((swar_non_digits(integer) | swar_non_digits(frac)) != 0) |
+            (p[int_len] != '.')) [[unlikely]] {
+            return false;
+        }
+        out = static_cast<int64_t>(swar_parse_8(integer) * POW10[Places] +
+                                   swar_parse_8(frac) * POW10[Places - Decimals]);
+        return true;
+    }
+}
+
+// ============================================================================
+// UTCTimestamp Fields ("YYYYMMDD-HH:MM:SS[.fffffffff]")
+// ============================================================================
+// Fixed offsets make every field a constant-position byte run, so each
+// 8-byte block is validated with one compare and split into its two-digit
+// fields with a single multiply-by-10 step.
+
+/// Decode a "YYYYMMDD" word. False on non-digits or month/day out of range.
+[[nodiscard]] NFX_FORCE_INLINE bool swar_utc_date(
+    uint64_t word, int64_t& year, int64_t& month, int64_t& day) noexcept
+{
+    if (swar_non_digits(word) != 0) [[unlikely]] return false;
+    uint64_t v = word - SWAR_ASCII_ZEROS;
+    v = v * 10 + (v >> 8);  // two-digit values in bytes 0, 2, 4, 6
+    year = static_cast<int64_t>((v & 0xFF) * 100 + ((v >> 16) & 0xFF));
+    month = static_cast<int64_t>((v >> 32) & 0xFF);
+    day = static_cast<int64_t>((v >> 48) & 0xFF);
+    return month >= 1 && month <= 12 && day >= 1 && day <= 31;
+}
+
+/// Nanoseconds since midnight from a whole UTCTimestamp of 17..27 bytes:
+/// '-' at [8], "HH:MM:SS" at [9, 17), then optionally '.' and 1-9 digits.
+/// False on malformed text (including >9 fraction digits, which the
+/// scalar parser truncates).
+[[nodiscard]] NFX_FORCE_INLINE bool swar_utc_time_of_day(
+    std::string_view sv, int64_t& nanos) noexcept
+{
+    constexpr uint64_t COLON_MASK = 0x0000FF0000FF0000ULL;  // bytes 2 and 5
+    constexpr uint64_t COLONS = 0x00003A00003A0000ULL;
+
+    const char* p = sv.data();
+    const size_t n = sv.size();
+    if (p[8] != '-') [[unlikely]] return false;
+
+    uint64_t hms;
+    std::memcpy(&hms, p + 9, 8);
+    const uint64_t digits = (hms & ~COLON_MASK) | (SWAR_ASCII_ZEROS & COLON_MASK);
+    if ((hms & COLON_MASK) != COLONS || swar_non_digits(digits) != 0) [[unlikely]] {
+        return false;
+    }
+    uint64_t v = digits - SWAR_ASCII_ZEROS;
+    v = v * 10 + (v >> 8);  // HH in byte 0, MM in byte 3, SS in byte 6
+    const uint64_t hh = v & 0xFF;
+    const uint64_t mm = (v >> 24) & 0xFF;
+    const uint64_t ss = (v >> 48) & 0xFF;
+    if (hh > 23 || mm > 59 || ss > 60) [[unlikely]] return false;
+
+    uint64_t frac = 0;
+    if (n > 17) {
+        const size_t frac_len = n - 18;
+        if (p[17] != '.' || frac_len == 0 || frac_len > 9) [[unlikely]] return false;
+        // First 8 digits left-aligned and '0'-filled: value in units of 10ns
+        uint64_t word;
+        if (frac_len >= 8) {
+            std::memcpy(&word, p + 18, 8);
+        } else {
+            std::memcpy(&word, p + n - 8, 8);  // n >= 19, stays in bounds
+            word = swar_keep_low(word >> ((8 - frac_len) * 8), frac_len);
+        }
+        const char ninth = frac_len == 9 ? p[26] : '0';
+        if (swar_non_digits(word) != 0 || ninth < '0' || ninth > '9') [[unlikely]] {
+            return false;
+        }
+        frac = swar_parse_8(word) * 10 + static_cast<uint64_t>(ninth - '0');
+    }
+
+    nanos = static_cast<int64_t>((hh * 3600 + mm * 60 + ss) * 1000000000ULL + frac);
+    return true;
+}
+
+}  // namespace nfx::detail
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <concepts>
 #include <string_view>
@@ -36,6 +37,8 @@ using SendingTime   = Tag<52>;   // Time of message transmission
 using PossDupFlag   = Tag<43>;   // Possible duplicate
 using PossResend    = Tag<97>;   // Possible resend
 using OrigSendingTime = Tag<122>; // Original sending time
+using OnBehalfOfCompID = Tag<115>; // Original sender when a hub forwards
+using DeliverToCompID  = Tag<128>; // Final target behind a hub
 
 // ============================================================================
 // FIX 4.4 Standard Trailer Tags
@@ -53,6 +56,10 @@ using ResetSeqNumFlag  = Tag<141>;  // Reset sequence numbers
 using TestReqID        = Tag<112>;  // Test request ID
 using RefSeqNum        = Tag<45>;   // Reference sequence number
 using Text             = Tag<58>;   // Free format text
+using BeginSeqNo       = Tag<7>;    // ResendRequest range start
+using EndSeqNo         = Tag<16>;   // ResendRequest range end (0 = infinity)
+using NewSeqNo         = Tag<36>;   // SequenceReset next sequence number
+using GapFillFlag      = Tag<123>;  // SequenceReset gap fill mode
 
 // ============================================================================
 // Order Tags (NewOrderSingle 35=D)
@@ -126,6 +133,87 @@ using TradeCondition   = Tag<277>;  // Trade condition
 using NumberOfOrders   = Tag<346>;  // Number of orders at price level
 using TotalVolumeTraded = Tag<387>; // Total volume traded
 
+// ============================================================================
+// Quote Tags (MassQuote 35=i, MassQuoteAcknowledgement 35=b)
+// ============================================================================
+
+using QuoteID          = Tag<117>;  // Quote identifier
+using QuoteReqID       = Tag<131>;  // Quote request identifier
+using BidPx            = Tag<132>;  // Bid price
+using OfferPx          = Tag<133>;  // Offer price
+using BidSize          = Tag<134>;  // Bid quantity
+using OfferSize        = Tag<135>;  // Offer quantity
+using NoQuoteEntries   = Tag<295>;  // Number of quote entries in a set
+using NoQuoteSets      = Tag<296>;  // Number of quote sets
+using QuoteStatus      = Tag<297>;  // Quote acknowledgement status
+using QuoteEntryID     = Tag<299>;  // Quote entry identifier
+using QuoteRejectReason = Tag<300>; // Whole-quote reject reason
+using QuoteResponseLevel = Tag<301>; // Acknowledgement level requested
+using QuoteSetID       = Tag<302>;  // Quote set identifier
+using TotNoQuoteEntries = Tag<304>; // Entries in the set across fragments
+using UnderlyingSymbol = Tag<311>;  // Quote set underlying
+using QuoteEntryRejectReason = Tag<368>; // Per-entry reject reason
+
+// ============================================================================
+// User-defined Tags
+// ============================================================================
+
+/// Value layouts a typed tag may promise. A promised layout selects a
+/// straight-line conversion; text that does not match it still gets the
+/// general conversion's result.
+struct AnyWidth {};
+
+/// Exactly Width digits (zero-padded sequence numbers, fixed-length ids)
+template <size_t Width>
+struct FixedDigits {
+    static_assert(Width >= 1 && Width <= 16, "Fixed-width integers span at most 16 digits");
+    static constexpr size_t width = Width;
+};
+
+/// Prices / quantities always sent with Decimals fraction digits
+template <int Decimals>
+struct FixedDecimals {
+    static_assert(Decimals >= 1 && Decimals <= 8, "FixedPrice keeps 8 decimal places");
+    static constexpr int decimals = Decimals;
+};
+
+/// Tag with a declared value type and, optionally, value layout
+template <int N, typename T, typename Layout = AnyWidth>
+struct TypedField : Tag<N> {
+    using value_type = T;
+    using layout = Layout;
+};
+
+/// Custom (venue) tag with a declared value type. Venue headers declare
+/// each tag once, next to their messages:
+///
+///     using VenueOrderRef = nfx::tag::CustomTag<5001, std::string_view>;
+///     using VenueFee      = nfx::tag::CustomTag<9050, FixedPrice, nfx::tag::FixedDecimals<4>>;
+///     using VenueSeqNum   = nfx::tag::TypedField<34, SeqNum, nfx::tag::FixedDigits<9>>;
+///
+/// and read it already converted: parser.get<VenueFee>(). Supported value
+/// types are those of FieldView::as<T>().
+template <int N, typename T, typename Layout = AnyWidth>
+struct CustomTag : TypedField<N, T, Layout> {
+    static_assert(N >= 5000, "Custom tags live in the user-defined ranges (5000+)");
+};
+
+/// Tag declaring the type of its value (TypedField, CustomTag or a user
+/// equivalent)
+template <typename T>
+concept TypedTag = IsTag<T> && requires { typename T::value_type; };
+
+/// Declared layout of a typed tag (AnyWidth if it declares none)
+template <typename T>
+struct tag_layout { using type = AnyWidth; };
+
+template <typename T>
+    requires requires { typename T::layout; }
+struct tag_layout<T> { using type = typename T::layout; };
+
+template <typename T>
+using tag_layout_t = typename tag_layout<T>::type;
+
 // ============================================================================
 // Compile-time Tag Metadata (TICKET_023)
 // ============================================================================
@@ -208,6 +296,18 @@ template<> struct TagInfo<122> {
     static constexpr bool is_required = false;
 };
 
+template<> struct TagInfo<115> {
+    static constexpr std::string_view name = "OnBehalfOfCompID";
+    static constexpr bool is_header = true;
+    static constexpr bool is_required = false;
+};
+
+template<> struct TagInfo<128> {
+    static constexpr std::string_view name = "DeliverToCompID";
+    static constexpr bool is_header = true;
+    static constexpr bool is_required = false;
+};
+
 // Trailer tag
 template<> struct TagInfo<10> {
     static constexpr std::string_view name = "CheckSum";
@@ -252,6 +352,30 @@ template<> struct TagInfo<58> {
     static constexpr bool is_required = false;
 };
 
+template<> struct TagInfo<7> {
+    static constexpr std::string_view name = "BeginSeqNo";
+    static constexpr bool is_header = false;
+    static constexpr bool is_required = false;
+};
+
+template<> struct TagInfo<16> {
+    static constexpr std::string_view name = "EndSeqNo";
+    static constexpr bool is_header = false;
+    static constexpr bool is_required = false;
+};
+
+template<> struct TagInfo<36> {
+    static constexpr std::string_view name = "NewSeqNo";
+    static constexpr bool is_header = false;
+    static constexpr bool is_required = false;
+};
+
+template<> struct TagInfo<123> {
+    static constexpr std::string_view name = "GapFillFlag";
+    static constexpr bool is_header = false;
+    static constexpr bool is_required = false;
+};
+
 // Order tags
 template<> struct TagInfo<11> {
     static constexpr std::string_view name = "ClOrdID";
@@ -0,0 +1,1248 @@
+/*
+    NexusFIX Binary Structured Log
+
+    Logging without formatting on either the hot thread or the backend:
+    - The hot thread writes a record (call-site id, TSC stamp, raw argument
+      bytes) into its own SPSC byte ring: no locks, no allocation, no
+      std::format. A full ring drops the record and counts it.
+    - BinaryLogWriter, a background thread, drains every ring into one
+      compact binary file, together with the call-site table (format
+      string, file, line, level, channel, argument types), thread ids and
+      TSC calibration needed to read it back.
+    - BinaryLogReader decodes a file offline into text or JSON lines
+      (tools/binlog_decode); formatting happens only there.
+
+    Call sites are registered once, on their first execution. Format
+    strings use std::format placeholders ("{}", "{:.2f}", ...); the
+    placeholder count is checked against the arguments at compile time.
+    Arguments: integers, enums, floating point, bool, char and anything
+    convertible to std::string_view (copied, truncated at MAX_STRING_ARG).
+
+    Usage:
+        nfx::util::BinaryLogWriter writer{{.path = "trade.blog"}};
+        NFX_BLOG_INFO(Ops, "session {} logged on, hb={}s", session_id, hb);
+        NFX_BLOG_INFO(Trade, "fill {} {} @ {:.4f}", cl_ord_id, qty, px);
+
+        $ binlog_decode trade.blog --json
+
+    Channels mirror src/utils/logdump.hpp (OPS / TRADE / PLUGIN).
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#if defined(__linux__)
+    #include <fcntl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+#include "nexusfix/memory/cache_line.hpp"
+#include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+namespace nfx::util {
+
+// ============================================================================
+// Levels, Channels, Argument Types
+// ============================================================================
+
+enum class LogLevel : uint8_t {
+    Debug = 0,
+    Info  = 1,
+    Warn  = 2,
+    Error = 3,
+};
+
+[[nodiscard]] constexpr std::string_view log_level_name(LogLevel level) noexcept {
+    switch (level) {
+        case LogLevel::Debug: return "DBG";
+        case LogLevel::Info:  return "INF";
+        case LogLevel::Warn:  return "WRN";
+        case LogLevel::Error: return "ERR";
+    }
+    return "???";
+}
+
+enum class LogChannel : uint8_t {
+    Ops    = 0,   // Operational (sessions, transports, health)
+    Trade  = 1,   // Orders, fills, positions
+    Plugin = 2,   // Plugin lifecycle
+};
+
+[[nodiscard]] constexpr std::string_view log_channel_name(LogChannel channel) noexcept {
+    switch (channel) {
+        case LogChannel::Ops:    return "ops";
+        case LogChannel::Trade:  return "trade";
+        case LogChannel::Plugin: return "plugin";
+    }
+    return "?";
+}
+
+/// Wire type of one logged argument
+enum class BinaryArgType : uint8_t {
+    Int    = 0,   // int64_t
+    UInt   = 1,   // uint64_t
+    Float  = 2,   // double
+    Bool   = 3,   // uint8_t
+    Char   = 4,   // char
+    String = 5,   // uint16_t length + bytes
+};
+
+/// Longest string argument kept (longer ones are truncated)
+inline constexpr size_t MAX_STRING_ARG = 1024;
+
+/// Arguments per call site
+inline constexpr size_t MAX_LOG_ARGS = 16;
+
+namespace detail {
+
+template<typename T>
+[[nodiscard]] consteval BinaryArgType binary_arg_type() noexcept {
+    using U = std::remove_cvref_t<T>;
+    if constexpr (std::is_same_v<U, bool>) {
+        return BinaryArgType::Bool;
+    } else if constexpr (std::is_same_v<U, char>) {
+        return BinaryArgType::Char;
+    } else if constexpr (std::is_enum_v<U>) {
+        return std::is_signed_v<std::underlying_type_t<U>> ? BinaryArgType::Int
+                                                           : BinaryArgType::UInt;
+    } else if constexpr (std::is_integral_v<U>) {
+        return std::is_signed_v<U> ? BinaryArgType::Int : BinaryArgType::UInt;
+    } else if constexpr (std::is_floating_point_v<U>) {
+        return BinaryArgType::Float;
+    } else {
+        static_assert(std::is_convertible_v<const U&, std::string_view>,
+                      "binary log arguments: arithmetic, enum, char, bool or string-like");
+        return BinaryArgType::String;
+    }
+}
+
+/// Replacement fields in a std::format-style string ("{{" / "}}" excluded)
+[[nodiscard]] constexpr size_t count_placeholders(std::string_view fmt) noexcept {
+    size_t count = 0;
+    for (size_t i = 0; i < fmt.size(); ++i) {
+        if (fmt[i] == '{') {
+            if (i + 1 < fmt.size() && fmt[i + 1] == '{') {
+                ++i;
+                continue;
+            }
+            ++count;
+            while (i < fmt.size() && fmt[i] != '}') ++i;
+        } else if (fmt[i] == '}' && i + 1 < fmt.size() && fmt[i + 1] == '}') {
+            ++i;
+        }
+    }
+    return count;
+}
+
+template<typename T>
+[[nodiscard]] inline size_t encoded_size(const T& value) noexcept {
+    constexpr BinaryArgType type = binary_arg_type<T>();
+    if constexpr (type == BinaryArgType::String) {
+        return sizeof(uint16_t) +
+               std::min(std::string_view{value}.size(), MAX_STRING_ARG);
+    } else if constexpr (type == BinaryArgType::Bool || type == BinaryArgType::Char) {
+        return 1;
+    } else {
+        return 8;
+    }
+}
+
+template<typename T>
+inline char* encode_arg(char* out, const T& value) noexcept {
+    constexpr BinaryArgType type = binary_arg_type<T>();
+    if constexpr (type == BinaryArgType::String) {
+        const std::string_view s{value};
+        const auto len = static_cast<uint16_t>(std::min(s.size(), MAX_STRING_ARG));
+        std::memcpy(out, &len, sizeof(len));
+        std::memcpy(out + sizeof(len), s.data(), len);
+        return out + sizeof(len) + len;
+    } else if constexpr (type == BinaryArgType::Bool) {
+        *out = value ? 1 : 0;
+        return out + 1;
+    } else if constexpr (type == BinaryArgType::Char) {
+        *out = value;
+        return out + 1;
+    } else if constexpr (type == BinaryArgType::Float) {
+        const double v = static_cast<double>(value);
+        std::memcpy(out, &v, 8);
+        return out + 8;
+    } else if constexpr (type == BinaryArgType::Int) {
+        const auto v = static_cast<int64_t>(value);
+        std::memcpy(out, &v, 8);
+        return out + 8;
+    } else {
+        const auto v = static_cast<uint64_t>(value);
+        std::memcpy(out, &v, 8);
+        return out + 8;
+    }
+}
+
+[[nodiscard]] inline uint32_t current_os_tid() noexcept {
+#if defined(__linux__) && defined(SYS_gettid)
+    return static_cast<uint32_t>(::syscall(SYS_gettid));
+#else
+    return 0;
+#endif
+}
+
+} // namespace detail
+
+// ============================================================================
+// Call Sites
+// ============================================================================
+
+/// Static description of one NFX_BLOG call site
+struct LogSite {
+    std::string_view format;
+    std::string_view file;
+    uint32_t line{0};
+    LogLevel level{LogLevel::Info};
+    LogChannel channel{LogChannel::Ops};
+    uint8_t arg_count{0};
+    std::array<BinaryArgType, MAX_LOG_ARGS> arg_types{};
+};
+
+// ============================================================================
+// Per-Thread Record Ring
+// ============================================================================
+
+/// Variable-size record ring: one producer (its thread), one consumer
+/// (BinaryLogWriter). Records are 16-byte aligned; a record that does not
+/// fit before the end of the buffer is preceded by a padding record.
+class BinaryLogRing {
+public:
+    static constexpr size_t CAPACITY = 256 * 1024;
+    static constexpr size_t MAX_RECORD = CAPACITY / 4;
+    static constexpr uint32_t PADDING = 0xFFFFFFFFu;
+
+    struct RecordHeader {
+        uint32_t site;
+        uint32_t size;    // Header + payload + alignment
+        uint64_t tsc;
+    };
+    static_assert(sizeof(RecordHeader) == 16);
+
+    explicit BinaryLogRing(uint32_t os_tid) noexcept
+        : buffer_{std::make_unique_for_overwrite<char[]>(CAPACITY)}
+        , os_tid_{os_tid} {}
+
+    /// Producer: space for a `bytes` record (multiple of 16), nullptr when
+    /// the ring is full (the record is counted as dropped)
+    [[nodiscard]] char* reserve(size_t bytes) noexcept {
+        const uint64_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t pos = static_cast<size_t>(tail) & MASK;
+        const size_t to_end = CAPACITY - pos;
+        const size_t needed = to_end < bytes ? to_end + bytes : bytes;
+
+        if (tail + needed - cached_head_ > CAPACITY) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail + needed - cached_head_ > CAPACITY) [[unlikely]] {
+                dropped_.store(dropped_.load(std::memory_order_relaxed) + 1,
+                               std::memory_order_relaxed);
+                return nullptr;
+            }
+        }
+
+        if (needed != bytes) {
+            RecordHeader pad{PADDING, static_cast<uint32_t>(to_end), 0};
+            std::memcpy(buffer_.get() + pos, &pad, sizeof(pad));
+            pending_ = tail + to_end;
+            return buffer_.get();
+        }
+        pending_ = tail;
+        return buffer_.get() + pos;
+    }
+
+    /// Producer: publish the record written into reserve()'s space
+    void commit(size_t bytes) noexcept {
+        tail_.store(pending_ + bytes, std::memory_order_release);
+    }
+
+    /// Consumer: hand every published record to fn(header, payload)
+    /// @return Records consumed
+    template<typename Fn>
+    size_t drain(Fn&& fn) noexcept {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        const uint64_t tail = tail_.load(std::memory_order_acquire);
+        size_t count = 0;
+        while (head < tail) {
+            const char* p = buffer_.get() + (static_cast<size_t>(head) & MASK);
+            RecordHeader hdr;
+            std::memcpy(&hdr, p, sizeof(hdr));
+            if (hdr.site != PADDING) {
+                fn(hdr, std::span<const char>{p + sizeof(hdr), hdr.size - sizeof(hdr)});
+                ++count;
+            }
+            head += hdr.size;
+        }
+        head_.store(head, std::memory_order_release);
+        return count;
+    }
+
+    /// Records lost to a full ring (cumulative)
+    [[nodiscard]] uint64_t dropped() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint32_t os_tid() const noexcept { return os_tid_; }
+
+private:
+    static constexpr size_t MASK = CAPACITY - 1;
+    static_assert((CAPACITY & MASK) == 0, "CAPACITY must be a power of 2");
+
+    std::unique_ptr<char[]> buffer_;
+    uint32_t os_tid_;
+
+    // Producer side
+    alignas(memory::CACHE_LINE_SIZE) std::atomic<uint64_t> tail_{0};
+    uint64_t cached_head_{0};
+    uint64_t pending_{0};
+    std::atomic<uint64_t> dropped_{0};
+
+    // Consumer side
+    alignas(memory::CACHE_LINE_SIZE) std::atomic<uint64_t> head_{0};
+};
+
+// ============================================================================
+// Registry (call sites and rings)
+// ============================================================================
+
+/// Process-wide call-site table and per-thread rings. Rings live until
+/// process exit, so the writer never races a thread's teardown.
+class BinaryLog {
+public:
+    static constexpr size_t MAX_THREADS = 64;
+    static constexpr size_t MAX_SITES = 4096;
+    static constexpr uint32_t INVALID_SITE = 0xFFFFFFFFu;
+
+    /// Register a call site (once per site, from NFX_BLOG)
+    /// @return Site id, INVALID_SITE once MAX_SITES are registered
+    template<typename... Args>
+    [[nodiscard]] static uint32_t register_site(LogChannel channel, LogLevel level,
+                                                std::string_view format,
+                                                std::string_view file, uint32_t line) noexcept {
+        static_assert(sizeof...(Args) <= MAX_LOG_ARGS, "too many binary log arguments");
+        LogSite site{format, file, line, level, channel,
+                     static_cast<uint8_t>(sizeof...(Args)),
+                     {detail::binary_arg_type<Args>()...}};
+
+        State& s = state();
+        std::lock_guard lock{s.site_mutex};
+        const size_t id = s.site_count.load(std::memory_order_relaxed);
+        if (id >= MAX_SITES) return INVALID_SITE;
+        s.sites[id] = site;
+        s.site_count.store(id + 1, std::memory_order_release);
+        return static_cast<uint32_t>(id);
+    }
+
+    /// Append one record to the calling thread's ring (hot path)
+    template<typename... Args>
+    static void write(uint32_t site, const Args&... args) noexcept {
+        if (site == INVALID_SITE) [[unlikely]] return;
+        BinaryLogRing* ring = local();
+        if (!ring) [[unlikely]] return;
+
+        constexpr size_t HEADER = sizeof(BinaryLogRing::RecordHeader);
+        const size_t payload = (size_t{0} + ... + detail::encoded_size(args));
+        const size_t bytes = (HEADER + payload + 15) & ~size_t{15};
+        if (bytes > BinaryLogRing::MAX_RECORD) [[unlikely]] return;
+
+        char* out = ring->reserve(bytes);
+        if (!out) [[unlikely]] return;
+
+        const BinaryLogRing::RecordHeader hdr{site, static_cast<uint32_t>(bytes),
+                                              detail::rdtscp()};
+        std::memcpy(out, &hdr, HEADER);
+        if constexpr (sizeof...(Args) > 0) {
+            char* p = out + HEADER;
+            ((p = detail::encode_arg(p, args)), ...);
+        }
+        ring->commit(bytes);
+    }
+
+    /// Records below this level are skipped before any argument is encoded
+    static void set_level(LogLevel level) noexcept {
+        state().min_level.store(level, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static bool enabled(LogLevel level) noexcept {
+        return level >= state().min_level.load(std::memory_order_relaxed);
+    }
+
+    /// The calling thread's ring, created on first use
+    /// @return nullptr once MAX_THREADS threads have logged
+    [[nodiscard]] static BinaryLogRing* local() noexcept {
+        thread_local BinaryLogRing* ring = claim();
+        return ring;
+    }
+
+    /// Registered ring count
+    [[nodiscard]] static size_t threads() noexcept {
+        return std::min(state().published.load(std::memory_order_acquire), MAX_THREADS);
+    }
+
+    [[nodiscard]] static BinaryLogRing& ring(size_t index) noexcept {
+        return *state().rings[index];
+    }
+
+    /// Registered call-site count
+    [[nodiscard]] static size_t sites() noexcept {
+        return state().site_count.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] static const LogSite& site(size_t id) noexcept {
+        return state().sites[id];
+    }
+
+private:
+    struct State {
+        std::array<LogSite, MAX_SITES> sites{};
+        std::atomic<size_t> site_count{0};
+        std::mutex site_mutex;
+
+        std::array<std::unique_ptr<BinaryLogRing>, MAX_THREADS> rings;
+        std::atomic<size_t> claimed{0};
+        std::atomic<size_t> published{0};
+
+        std::atomic<LogLevel> min_level{LogLevel::Debug};
+    };
+
+    [[nodiscard]] static State& state() noexcept {
+        static State s;
+        return s;
+    }
+
+    [[nodiscard]] static BinaryLogRing* claim() noexcept {
+        State& s = state();
+        const size_t index = s.claimed.fetch_add(1, std::memory_order_relaxed);
+        if (index >= MAX_THREADS) return nullptr;
+
+        s.rings[index] = std::make_unique<BinaryLogRing>(detail::current_os_tid());
+        // Publish in claim order so the writer only sees constructed rings
+        size_t expected = index;
+        while (!s.published.compare_exchange_weak(expected, index + 1,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+            expected = index;
+        }
+        return s.rings[index].get();
+    }
+};
+
+// ============================================================================
+// File Format
+// ============================================================================
+//
+// "NFXBLOG1" then a stream of entries, each starting with a one-byte kind
+// (all integers little-endian, unaligned):
+//   Site         u32 id, u8 level, u8 channel, u8 argc, u8 types[argc],
+//                u32 line, u16 len + format, u16 len + file
+//   Thread       u16 index, u32 os tid
+//   Calibration  u64 tsc, i64 unix ns, f64 tsc GHz
+//   Record       u32 site, u16 thread, u64 tsc, u32 len + argument bytes
+//   Dropped      u16 thread, u64 records dropped so far
+// A site or thread is always defined before its first record.
+
+inline constexpr std::string_view BINARY_LOG_MAGIC = "NFXBLOG1";
+
+enum class BinaryLogEntry : uint8_t {
+    Site        = 1,
+    Thread      = 2,
+    Calibration = 3,
+    Record      = 4,
+    Dropped     = 5,
+};
+
+// ============================================================================
+// Writer (backend thread)
+// ============================================================================
+
+/// Configuration for BinaryLogWriter
+struct BinaryLogConfig {
+    /// Output file (truncated)
+    std::string path{"nexusfix.blog"};
+
+    /// Core to pin the writer thread to (-1 = don't pin)
+    int writer_cpu{-1};
+
+    /// Writer sleep when every ring is empty
+    std::chrono::microseconds idle_sleep{200};
+
+    /// TSC / wall clock pairs written this often (decoder drift correction)
+    std::chrono::milliseconds calibration_interval{1000};
+};
+
+/// Drains every thread's ring into the log file. Only one writer may run
+/// at a time (the rings have a single consumer); a second one stays closed.
+class BinaryLogWriter {
+public:
+    explicit BinaryLogWriter(const BinaryLogConfig& config = {})
+        : config_{config}
+    {
+        bool expected = false;
+        if (!active().compare_exchange_strong(expected, true)) {
+            error_ = EBUSY;
+            return;
+        }
+        file_ = std::fopen(config_.path.c_str(), "wb");
+        if (!file_) {
+            error_ = errno;
+            active().store(false);
+            return;
+        }
+        RdtscClock::initialize();
+        out_.reserve(FLUSH_BYTES * 2);
+        out_.insert(out_.end(), BINARY_LOG_MAGIC.begin(), BINARY_LOG_MAGIC.end());
+        write_calibration();
+        thread_ = std::thread([this] { run(); });
+    }
+
+    ~BinaryLogWriter() {
+        if (!file_) return;
+        running_.store(false, std::memory_order_release);
+        thread_.join();
+        std::fclose(file_);
+        active().store(false);
+    }
+
+    BinaryLogWriter(const BinaryLogWriter&) = delete;
+    BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+
+    [[nodiscard]] bool is_open() const noexcept { return file_ != nullptr; }
+
+    /// errno of the open failure (EBUSY: another writer is running)
+    [[nodiscard]] int error() const noexcept { return error_; }
+
+    /// Barrier: everything logged before the call is in the file
+    void flush() noexcept {
+        if (!file_) return;
+        const uint64_t ticket = flush_requested_.fetch_add(1, std::memory_order_acq_rel) + 1;
+        while (flush_done_.load(std::memory_order_acquire) < ticket) {
+            std::this_thread::yield();
+        }
+    }
+
+    /// Records written to the file so far
+    [[nodiscard]] uint64_t records() const noexcept {
+        return records_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t FLUSH_BYTES = 64 * 1024;
+
+    [[nodiscard]] static std::atomic<bool>& active() noexcept {
+        static std::atomic<bool> flag{false};
+        return flag;
+    }
+
+    void run() noexcept {
+        if (config_.writer_cpu >= 0) {
+            (void)CpuAffinity::pin_to_core(config_.writer_cpu);
+        }
+        auto last_calibration = std::chrono::steady_clock::now();
+
+        for (;;) {
+            const bool stopping = !running_.load(std::memory_order_acquire);
+            const uint64_t ticket = flush_requested_.load(std::memory_order_acquire);
+
+            const size_t drained = drain_all();
+            write_out();
+            if (ticket > flush_done_.load(std::memory_order_relaxed)) {
+                std::fflush(file_);
+                flush_done_.store(ticket, std::memory_order_release);
+            }
+            if (stopping) break;
+
+            const auto now = std::chrono::steady_clock::now();
+            if (now - last_calibration >= config_.calibration_interval) {
+                RdtscClock::calibrate();
+                write_calibration();
+                last_calibration = now;
+            }
+            if (drained == 0) {
+                std::this_thread::sleep_for(config_.idle_sleep);
+            }
+        }
+        std::fflush(file_);
+    }
+
+    size_t drain_all() noexcept {
+        size_t total = 0;
+        const size_t threads = BinaryLog::threads();
+        for (size_t t = 0; t < threads; ++t) {
+            BinaryLogRing& ring = BinaryLog::ring(t);
+            if (t >= threads_written_) {
+                put(BinaryLogEntry::Thread);
+                put(static_cast<uint16_t>(t));
+                put(ring.os_tid());
+                threads_written_ = t + 1;
+            }
+
+            total += ring.drain([&](const BinaryLogRing::RecordHeader& hdr,
+                                    std::span<const char> payload) {
+                define_sites(hdr.site);
+                put(BinaryLogEntry::Record);
+                put(hdr.site);
+                put(static_cast<uint16_t>(t));
+                put(hdr.tsc);
+                put(static_cast<uint32_t>(payload.size()));
+                out_.insert(out_.end(), payload.begin(), payload.end());
+                if (out_.size() >= FLUSH_BYTES) write_out();
+            });
+
+            if (t >= dropped_seen_.size()) dropped_seen_.resize(t + 1, 0);
+            if (const uint64_t dropped = ring.dropped(); dropped != dropped_seen_[t]) {
+                put(BinaryLogEntry::Dropped);
+                put(static_cast<uint16_t>(t));
+                put(dropped);
+                dropped_seen_[t] = dropped;
+            }
+        }
+        records_.fetch_add(total, std::memory_order_relaxed);
+        return total;
+    }
+
+    /// Site definitions up to and including `id`
+    void define_sites(uint32_t id) {
+        while (sites_written_ <= id) {
+            const LogSite& site = BinaryLog::site(sites_written_);
+            put(BinaryLogEntry::Site);
+            put(static_cast<uint32_t>(sites_written_));
+            put(static_cast<uint8_t>(site.level));
+            put(static_cast<uint8_t>(site.channel));
+            put(site.arg_count);
+            for (size_t i = 0; i < site.arg_count; ++i) {
+                put(static_cast<uint8_t>(site.arg_types[i]));
+            }
+            put(site.line);
+            put_string(site.format);
+            put_string(site.file);
+            ++sites_written_;
+        }
+    }
+
+    void write_calibration() {
+        const uint64_t tsc = detail::rdtscp();
+        const int64_t unix_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        put(BinaryLogEntry::Calibration);
+        put(tsc);
+        put(unix_ns);
+        put(RdtscClock::frequency_ghz());
+    }
+
+    template<typename T>
+    void put(const T& value) {
+        const char* p = reinterpret_cast<const char*>(&value);
+        out_.insert(out_.end(), p, p + sizeof(T));
+    }
+
+    void put(BinaryLogEntry kind) { put(static_cast<uint8_t>(kind)); }
+
+    void put_string(std::string_view s) {
+        const auto len = static_cast<uint16_t>(std::min<size_t>(s.size(), UINT16_MAX));
+        put(len);
+        out_.insert(out_.end(), s.begin(), s.begin() + len);
+    }
+
+    void write_out() noexcept {
+        if (out_.empty()) return;
+        (void)std::fwrite(out_.data(), 1, out_.size(), file_);
+        out_.clear();
+    }
+
+    BinaryLogConfig config_;
+    std::FILE* file_{nullptr};
+    int error_{0};
+    std::vector<char> out_;
+    size_t sites_written_{0};
+    size_t threads_written_{0};
+    std::vector<uint64_t> dropped_seen_;
+    std::atomic<uint64_t> records_{0};
+    std::atomic<uint64_t> flush_requested_{0};
+    std::atomic<uint64_t> flush_done_{0};
+    std::atomic<bool> running_{true};
+    std::thread thread_;  // Last: starts once everything above exists
+};
+
+// ============================================================================
+// Reader (offline decoder)
+// ============================================================================
+
+/// One decoded argument
+using BinaryLogArg = std::variant<int64_t, uint64_t, double, bool, char, std::string_view>;
+
+/// One decoded record; views point into the reader's buffer
+struct BinaryLogRecord {
+    int64_t unix_ns{0};
+    uint16_t thread{0};
+    uint32_t os_tid{0};
+    const LogSite* site{nullptr};
+    std::vector<BinaryLogArg> args;
+};
+
+/// Reads a binary log file produced by BinaryLogWriter
+class BinaryLogReader {
+public:
+    /// Load a file; false if unreadable or not a binary log
+    [[nodiscard]] bool open(const std::string& path) {
+        std::ifstream in{path, std::ios::binary};
+        if (!in) return false;
+        data_.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+        if (data_.size() < BINARY_LOG_MAGIC.size() ||
+            std::string_view{data_.data(), BINARY_LOG_MAGIC.size()} != BINARY_LOG_MAGIC) {
+            return false;
+        }
+        pos_ = BINARY_LOG_MAGIC.size();
+        return true;
+    }
+
+    /// Next record, std::nullopt at the end (see truncated())
+    [[nodiscard]] std::optional<BinaryLogRecord> next() {
+        while (pos_ < data_.size()) {
+            const size_t entry_start = pos_;
+            uint8_t kind = 0;
+            if (!get(kind)) break;
+
+            bool ok = true;
+            switch (static_cast<BinaryLogEntry>(kind)) {
+                case BinaryLogEntry::Site:        ok = read_site(); break;
+                case BinaryLogEntry::Thread:      ok = read_thread(); break;
+                case BinaryLogEntry::Calibration: ok = read_calibration(); break;
+                case BinaryLogEntry::Dropped:     ok = read_dropped(); break;
+                case BinaryLogEntry::Record: {
+                    BinaryLogRecord record;
+                    if (read_record(record)) return record;
+                    ok = false;
+                    break;
+                }
+                default: ok = false; break;
+            }
+            if (!ok) {
+                // Partial tail (writer killed mid-write) or corruption
+                pos_ = entry_start;
+                truncated_ = true;
+                break;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// The file ended inside an entry
+    [[nodiscard]] bool truncated() const noexcept { return truncated_; }
+
+    /// Records dropped by full rings, over all threads
+    [[nodiscard]] uint64_t dropped() const noexcept {
+        uint64_t total = 0;
+        for (uint64_t d : dropped_) total += d;
+        return total;
+    }
+
+    /// Format string with the record's arguments substituted
+    [[nodiscard]] static std::string message(const BinaryLogRecord& record) {
+        std::string out;
+        const std::string_view fmt = record.site->format;
+        size_t arg = 0;
+        for (size_t i = 0; i < fmt.size(); ++i) {
+            const char c = fmt[i];
+            if ((c == '{' || c == '}') && i + 1 < fmt.size() && fmt[i + 1] == c) {
+                out += c;
+                ++i;
+            } else if (c == '{') {
+                const size_t close = fmt.find('}', i);
+                if (close == std::string_view::npos) {
+                    out.append(fmt.substr(i));
+                    break;
+                }
+                const std::string_view spec = fmt.substr(i, close - i + 1);
+                if (arg < record.args.size()) {
+                    out += format_arg(record.args[arg++], spec);
+                } else {
+                    out.append(spec);
+                }
+                i = close;
+            } else {
+                out += c;
+            }
+        }
+        return out;
+    }
+
+    /// "2026-01-02 09:30:00.123456789 INF trade [t1 4242] file.cpp:42 message"
+    [[nodiscard]] static std::string format_text(const BinaryLogRecord& record) {
+        std::string out = format_time(record.unix_ns);
+        out += ' ';
+        out += log_level_name(record.site->level);
+        out += ' ';
+        out += pad(log_channel_name(record.site->channel), 6, ' ', '<');
+        out += " [t" + std::to_string(record.thread) + ' ' + std::to_string(record.os_tid) + "] ";
+        out += basename(record.site->file);
+        out += ':' + std::to_string(record.site->line) + ' ';
+        out += message(record);
+        return out;
+    }
+
+    /// One JSON object with the formatted message and the typed arguments
+    [[nodiscard]] static std::string format_json(const BinaryLogRecord& record) {
+        std::string out = R"({"ts":")" + format_time(record.unix_ns);
+        out += R"(","ns":)" + std::to_string(record.unix_ns);
+        out += R"(,"level":")";
+        out += log_level_name(record.site->level);
+        out += R"(","channel":")";
+        out += log_channel_name(record.site->channel);
+        out += R"(","thread":)" + std::to_string(record.thread);
+        out += R"(,"tid":)" + std::to_string(record.os_tid);
+        out += R"(,"file":")" + json_escape(basename(record.site->file));
+        out += R"(","line":)" + std::to_string(record.site->line);
+        out += R"(,"msg":")" + json_escape(message(record));
+        out += R"(","args":[)";
+        for (size_t i = 0; i < record.args.size(); ++i) {
+            if (i > 0) out += ',';
+            std::visit([&](const auto& v) {
+                using V = std::decay_t<decltype(v)>;
+                if constexpr (std::is_same_v<V, std::string_view>) {
+                    out += '"';
+                    out += json_escape(v);
+                    out += '"';
+                } else if constexpr (std::is_same_v<V, char>) {
+                    out += '"';
+                    out += json_escape(std::string_view{&v, 1});
+                    out += '"';
+                } else if constexpr (std::is_same_v<V, bool>) {
+                    out += v ? "true" : "false";
+                } else {
+                    out += format_arg(record.args[i], "{}");
+                }
+            }, record.args[i]);
+        }
+        out += "]}";
+        return out;
+    }
+
+private:
+    struct Calibration {
+        uint64_t tsc{0};
+        int64_t unix_ns{0};
+        double ghz{0};
+    };
+
+    template<typename T>
+    [[nodiscard]] bool get(T& value) noexcept {
+        if (data_.size() - pos_ < sizeof(T)) return false;
+        std::memcpy(&value, data_.data() + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    [[nodiscard]] bool get_string(std::string_view& s) noexcept {
+        uint16_t len = 0;
+        if (!get(len) || data_.size() - pos_ < len) return false;
+        s = std::string_view{data_.data() + pos_, len};
+        pos_ += len;
+        return true;
+    }
+
+    [[nodiscard]] bool read_site() {
+        uint32_t id = 0;
+        uint8_t level = 0, channel = 0, argc = 0;
+        if (!get(id) || !get(level) || !get(channel) || !get(argc) || argc > MAX_LOG_ARGS) {
+            return false;
+        }
+        LogSite site;
+        site.level = static_cast<LogLevel>(level);
+        site.channel = static_cast<LogChannel>(channel);
+        site.arg_count = argc;
+        for (size_t i = 0; i < argc; ++i) {
+            uint8_t type = 0;
+            if (!get(type)) return false;
+            site.arg_types[i] = static_cast<BinaryArgType>(type);
+        }
+        if (!get(site.line) || !get_string(site.format) || !get_string(site.file)) {
+            return false;
+        }
+        if (sites_.size() <= id) sites_.resize(id + 1);
+        sites_[id] = std::make_unique<LogSite>(site);
+        return true;
+    }
+
+    [[nodiscard]] bool read_thread() {
+        uint16_t index = 0;
+        uint32_t tid = 0;
+        if (!get(index) || !get(tid)) return false;
+        if (tids_.size() <= index) tids_.resize(index + 1, 0);
+        tids_[index] = tid;
+        return true;
+    }
+
+    [[nodiscard]] bool read_calibration() noexcept {
+        Calibration c;
+        if (!get(c.tsc) || !get(c.unix_ns) || !get(c.ghz)) return false;
+        if (c.ghz <= 0) c.ghz = calibration_.ghz > 0 ? calibration_.ghz : 1.0;
+        calibration_ = c;
+        return true;
+    }
+
+    [[nodiscard]] bool read_dropped() {
+        uint16_t index = 0;
+        uint64_t count = 0;
+        if (!get(index) || !get(count)) return false;
+        if (dropped_.size() <= index) dropped_.resize(index + 1, 0);
+        dropped_[index] = count;
+        return true;
+    }
+
+    [[nodiscard]] bool read_record(BinaryLogRecord& record) {
+        uint32_t site = 0;
+        uint64_t tsc = 0;
+        uint32_t len = 0;
+        if (!get(site) || !get(record.thread) || !get(tsc) || !get(len) ||
+            data_.size() - pos_ < len || site >= sites_.size() || !sites_[site]) {
+            return false;
+        }
+        const size_t end = pos_ + len;
+        record.site = sites_[site].get();
+        record.os_tid = record.thread < tids_.size() ? tids_[record.thread] : 0;
+        const double delta = static_cast<double>(static_cast<int64_t>(tsc - calibration_.tsc));
+        record.unix_ns = calibration_.unix_ns + static_cast<int64_t>(delta / calibration_.ghz);
+
+        record.args.reserve(record.site->arg_count);
+        for (size_t i = 0; i < record.site->arg_count; ++i) {
+            switch (record.site->arg_types[i]) {
+                case BinaryArgType::Int: {
+                    int64_t v = 0;
+                    if (!get(v)) return false;
+                    record.args.emplace_back(v);
+                    break;
+                }
+                case BinaryArgType::UInt: {
+                    uint64_t v = 0;
+                    if (!get(v)) return false;
+                    record.args.emplace_back(v);
+                    break;
+                }
+                case BinaryArgType::Float: {
+                    double v = 0;
+                    if (!get(v)) return false;
+                    record.args.emplace_back(v);
+                    break;
+                }
+                case BinaryArgType::Bool: {
+                    uint8_t v = 0;
+                    if (!get(v)) return false;
+                    record.args.emplace_back(v != 0);
+                    break;
+                }
+                case BinaryArgType::Char: {
+                    char v = 0;
+                    if (!get(v)) return false;
+                    record.args.emplace_back(v);
+                    break;
+                }
+                case BinaryArgType::String: {
+                    std::string_view v;
+                    if (!get_string(v)) return false;
+                    record.args.emplace_back(v);
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+        if (pos_ > end) return false;
+        pos_ = end;  // Skip alignment padding
+        return true;
+    }
+
+    /// Parsed std::format standard spec: [[fill]align][sign][#][0][width][.precision][type]
+    struct FormatSpec {
+        char fill{' '};
+        char align{0};
+        char sign{'-'};
+        bool alternate{false};
+        bool zero{false};
+        size_t width{0};
+        int precision{-1};
+        char type{0};
+    };
+
+    [[nodiscard]] static FormatSpec parse_spec(std::string_view field) noexcept {
+        FormatSpec spec;
+        const size_t colon = field.find(':');
+        if (colon == std::string_view::npos) return spec;
+        std::string_view s = field.substr(colon + 1, field.size() - colon - 2);  // Drop '}'
+
+        auto is_align = [](char c) { return c == '<' || c == '>' || c == '^'; };
+        if (s.size() >= 2 && is_align(s[1])) {
+            spec.fill = s[0];
+            spec.align = s[1];
+            s.remove_prefix(2);
+        } else if (!s.empty() && is_align(s[0])) {
+            spec.align = s[0];
+            s.remove_prefix(1);
+        }
+        if (!s.empty() && (s[0] == '+' || s[0] == '-' || s[0] == ' ')) {
+            spec.sign = s[0];
+            s.remove_prefix(1);
+        }
+        if (!s.empty() && s[0] == '#') {
+            spec.alternate = true;
+            s.remove_prefix(1);
+        }
+        if (!s.empty() && s[0] == '0') {
+            spec.zero = true;
+            s.remove_prefix(1);
+        }
+        while (!s.empty() && s[0] >= '0' && s[0] <= '9') {
+            spec.width = spec.width * 10 + static_cast<size_t>(s[0] - '0');
+            s.remove_prefix(1);
+        }
+        if (!s.empty() && s[0] == '.') {
+            s.remove_prefix(1);
+            spec.precision = 0;
+            while (!s.empty() && s[0] >= '0' && s[0] <= '9') {
+                spec.precision = spec.precision * 10 + (s[0] - '0');
+                s.remove_prefix(1);
+            }
+        }
+        if (!s.empty() && s[0] == 'L') s.remove_prefix(1);
+        if (!s.empty()) spec.type = s[0];
+        return spec;
+    }
+
+    [[nodiscard]] static std::string pad(std::string_view body, size_t width, char fill,
+                                         char align) {
+        if (body.size() >= width) return std::string{body};
+        const size_t total = width - body.size();
+        const size_t before = align == '<' ? 0 : align == '^' ? total / 2 : total;
+        std::string out(before, fill);
+        out += body;
+        out.append(total - before, fill);
+        return out;
+    }
+
+    /// Sign, base prefix and digits of a number, padded per the spec
+    [[nodiscard]] static std::string pad_number(bool negative, std::string_view prefix,
+                                                std::string_view digits,
+                                                const FormatSpec& spec) {
+        std::string head;
+        if (negative) head += '-';
+        else if (spec.sign != '-') head += spec.sign;
+        head += prefix;
+        if (spec.zero && !spec.align && head.size() + digits.size() < spec.width) {
+            head.append(spec.width - head.size() - digits.size(), '0');
+        }
+        head += digits;
+        return pad(head, spec.width, spec.fill, spec.align ? spec.align : '>');
+    }
+
+    [[nodiscard]] static std::string format_integer(uint64_t magnitude, bool negative,
+                                                    const FormatSpec& spec) {
+        int base = 10;
+        std::string_view prefix;
+        switch (spec.type) {
+            case 'x': base = 16; prefix = "0x"; break;
+            case 'X': base = 16; prefix = "0X"; break;
+            case 'o': base = 8;  prefix = "0"; break;
+            case 'b': base = 2;  prefix = "0b"; break;
+            case 'B': base = 2;  prefix = "0B"; break;
+            case 'c': {
+                const char c = static_cast<char>(magnitude);
+                return pad(std::string_view{&c, 1}, spec.width, spec.fill,
+                           spec.align ? spec.align : '<');
+            }
+            default: break;
+        }
+        std::array<char, 72> buf{};
+        auto [end, ec] = std::to_chars(buf.data(), buf.data() + buf.size(), magnitude, base);
+        (void)ec;
+        if (spec.type == 'X') {
+            std::transform(buf.data(), end, buf.data(),
+                           [](char c) { return c >= 'a' && c <= 'f' ? static_cast<char>(c - 32) : c; });
+        }
+        if (!spec.alternate || (base == 8 && magnitude == 0)) prefix = {};
+        return pad_number(negative, prefix, {buf.data(), end}, spec);
+    }
+
+    [[nodiscard]] static std::string format_float(double value, const FormatSpec& spec) {
+        std::array<char, 512> buf{};
+        char* first = buf.data();
+        char* last = buf.data() + buf.size();
+        const bool negative = std::signbit(value);
+        const double magnitude = negative ? -value : value;
+        const int precision = spec.precision >= 0 ? spec.precision : 6;
+
+        std::to_chars_result r{};
+        switch (spec.type) {
+            case 'f': case 'F':
+                r = std::to_chars(first, last, magnitude, std::chars_format::fixed, precision);
+                break;
+            case 'e': case 'E':
+                r = std::to_chars(first, last, magnitude, std::chars_format::scientific, precision);
+                break;
+            case 'g': case 'G':
+                r = std::to_chars(first, last, magnitude, std::chars_format::general, precision);
+                break;
+            case 'a': case 'A':
+                r = spec.precision >= 0
+                    ? std::to_chars(first, last, magnitude, std::chars_format::hex, precision)
+                    : std::to_chars(first, last, magnitude, std::chars_format::hex);
+                break;
+            default:
+                r = spec.precision >= 0
+                    ? std::to_chars(first, last, magnitude, std::chars_format::general, precision)
+                    : std::to_chars(first, last, magnitude);
+                break;
+        }
+        if (r.ec != std::errc{}) return "?";
+        if (spec.type >= 'A' && spec.type <= 'Z') {
+            std::transform(first, r.ptr, first, [](char c) {
+                return c >= 'a' && c <= 'z' ? static_cast<char>(c - 32) : c;
+            });
+        }
+        return pad_number(negative, {}, {first, r.ptr}, spec);
+    }
+
+    /// One argument through its replacement field, e.g. "{:.2f}". The
+    /// decoder renders the std::format standard spec itself, so it builds
+    /// against standard libraries without <format>.
+    [[nodiscard]] static std::string format_arg(const BinaryLogArg& arg, std::string_view field) {
+        const FormatSpec spec = parse_spec(field);
+        return std::visit([&spec](const auto& v) -> std::string {
+            using V = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<V, std::string_view>) {
+                const std::string_view s = spec.precision >= 0
+                    ? v.substr(0, static_cast<size_t>(spec.precision)) : v;
+                return pad(s, spec.width, spec.fill, spec.align ? spec.align : '<');
+            } else if constexpr (std::is_same_v<V, bool>) {
+                if (spec.type == 0 || spec.type == 's') {
+                    return pad(v ? "true" : "false", spec.width, spec.fill,
+                               spec.align ? spec.align : '<');
+                }
+                return format_integer(v ? 1 : 0, false, spec);
+            } else if constexpr (std::is_same_v<V, char>) {
+                if (spec.type == 0 || spec.type == 'c') {
+                    return pad(std::string_view{&v, 1}, spec.width, spec.fill,
+                               spec.align ? spec.align : '<');
+                }
+                return format_integer(static_cast<unsigned char>(v), false, spec);
+            } else if constexpr (std::is_same_v<V, double>) {
+                return format_float(v, spec);
+            } else if constexpr (std::is_same_v<V, int64_t>) {
+                const uint64_t magnitude = v < 0 ? ~static_cast<uint64_t>(v) + 1
+                                                 : static_cast<uint64_t>(v);
+                return format_integer(magnitude, v < 0, spec);
+            } else {
+                return format_integer(v, false, spec);
+            }
+        }, arg);
+    }
+
+    /// "YYYY-MM-DD HH:MM:SS.nnnnnnnnn" (UTC)
+    [[nodiscard]] static std::string format_time(int64_t unix_ns) {
+        int64_t secs = unix_ns / 1'000'000'000;
+        int64_t nanos = unix_ns % 1'000'000'000;
+        if (nanos < 0) {
+            nanos += 1'000'000'000;
+            --secs;
+        }
+        const std::time_t t = static_cast<std::time_t>(secs);
+        std::tm tm{};
+#if defined(_WIN32)
+        gmtime_s(&tm, &t);
+#else
+        gmtime_r(&t, &tm);
+#endif
+        std::array<char, 48> buf{};
+        const int n = std::snprintf(buf.data(), buf.size(), "%04d-%02d-%02d %02d:%02d:%02d.%09lld",
+                                    tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour,
+                                    tm.tm_min, tm.tm_sec, static_cast<long long>(nanos));
+        return std::string{buf.data(), n > 0 ? static_cast<size_t>(n) : 0};
+    }
+
+    [[nodiscard]] static std::string_view basename(std::string_view path) noexcept {
+        const size_t slash = path.find_last_of("/\\");
+        return slash == std::string_view::npos ? path : path.substr(slash + 1);
+    }
+
+    [[nodiscard]] static std::string json_escape(std::string_view s) {
+        std::string out;
+        out.reserve(s.size());
+        for (char c : s) {
+            switch (c) {
+                case '"':  out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        std::array<char, 8> buf{};
+                        std::snprintf(buf.data(), buf.size(), "\\u%04x", static_cast<unsigned>(c));
+                        out += buf.data();
+                    } else {
+                        out += c;
+                    }
+            }
+        }
+        return out;
+    }
+
+    std::vector<char> data_;
+    size_t pos_{0};
+    bool truncated_{false};
+    Calibration calibration_{0, 0, 1.0};
+    std::vector<std::unique_ptr<LogSite>> sites_;
+    std::vector<uint32_t> tids_;
+    std::vector<uint64_t> dropped_;
+};
+
+} // namespace nfx::util
+
+// ============================================================================
+// Logging Macros
+// ============================================================================
+
+/// Log to the binary log: NFX_BLOG(Trade, Info, "fill {} @ {}", id, px)
+/// The call site registers itself on first execution; arguments are
+/// evaluated once.
+#define NFX_BLOG(channel, level, fmt, ...)                                              \
+    [](const auto&... nfx_blog_args) {                                                  \
+        static_assert(::nfx::util::detail::count_placeholders(fmt) ==                   \
+                      sizeof...(nfx_blog_args),                                         \
+                      "binary log: placeholder count does not match arguments");        \
+        if (!::nfx::util::BinaryLog::enabled(::nfx::util::LogLevel::level)) return;    \
+        static const uint32_t nfx_blog_site = ::nfx::util::BinaryLog::register_site<    \
+            std::remove_cvref_t<decltype(nfx_blog_args)>...>(                           \
+            ::nfx::util::LogChannel::channel, ::nfx::util::LogLevel::level, fmt,        \
+            __FILE__, __LINE__);                                                        \
+        ::nfx::util::BinaryLog::write(nfx_blog_site, nfx_blog_args...);                 \
+    }(__VA_ARGS__)
+
+#define NFX_BLOG_DEBUG(channel, fmt, ...) NFX_BLOG(channel, Debug, fmt __VA_OPT__(,) __VA_ARGS__)
+#define NFX_BLOG_INFO(channel, fmt, ...)  NFX_BLOG(channel, Info, fmt __VA_OPT__(,) __VA_ARGS__)
+#define NFX_BLOG_WARN(channel, fmt, ...)  NFX_BLOG(channel, Warn, fmt __VA_OPT__(,) __VA_ARGS__)
+#define NFX_BLOG_ERROR(channel, fmt, ...) NFX_BLOG(channel, Error, fmt __VA_OPT__(,) __VA_ARGS__)
@@ -27,6 +27,8 @@
 #include <thread>
 #include <optional>
 
+#include "nexusfix/util/numa.hpp"
+
 #if defined(__linux__)
     #include <sched.h>
     #include <pthread.h>
@@ -161,6 +163,22 @@ public:
         return pin_to_core(core_id);
     }
 
+    /// Pick a core for a helper thread that should not compete with
+    /// the given core (e.g. the io_uring SQPOLL kernel thread)
+    /// Prefers the highest allowed core; session threads fill from the low end.
+    /// @param avoid_core Core to keep free (typically the current thread's)
+    /// @param config Affinity configuration
+    /// @return Core ID, or -1 if no other allowed core exists
+    [[nodiscard]] static int pick_companion_core(
+        int avoid_core,
+        const CpuAffinityConfig& config = CpuAffinityConfig::default_config()) noexcept
+    {
+        for (auto it = config.allowed_cores.rbegin(); it != config.allowed_cores.rend(); ++it) {
+            if (*it != avoid_core) return *it;
+        }
+        return -1;
+    }
+
     /// Calculate session hash for core assignment
     /// Uses FNV-1a for fast, well-distributed hash
     [[nodiscard]] static uint64_t session_hash(
@@ -239,25 +257,14 @@ public:
     // NUMA Support
     // ========================================================================
 
-    /// Get NUMA node for a given CPU core
-    [[nodiscard]] static int get_numa_node([[maybe_unused]] int core_id) noexcept {
-#if defined(__linux__)
-        // Read from /sys/devices/system/cpu/cpuN/node*
-        // For simplicity, return -1 (unknown)
-        // In production, parse /sys/devices/system/node/nodeN/cpulist
-        return -1;
-#else
-        return -1;
-#endif
+    /// Get NUMA node for a given CPU core (-1 = unknown)
+    [[nodiscard]] static int get_numa_node(int core_id) noexcept {
+        return NumaTopology::node_of_cpu(core_id);
     }
 
     /// Get cores on a specific NUMA node
-    [[nodiscard]] static std::vector<int> cores_on_numa_node(
-        [[maybe_unused]] int node_id) noexcept
-    {
-        std::vector<int> cores;
-        // In production, parse /sys/devices/system/node/nodeN/cpulist
-        return cores;
+    [[nodiscard]] static std::vector<int> cores_on_numa_node(int node_id) noexcept {
+        return NumaTopology::cpus_of_node(node_id);
     }
 
     // ========================================================================
@@ -0,0 +1,336 @@
+/*
+    NexusFIX CPU Topology and Thread Placement
+
+    CpuAffinity pins a thread to the core it is given; this header decides
+    which cores to give. CpuTopology reads the host layout from sysfs
+    (online cores, SMT siblings, L3 domains, NUMA nodes, isolcpus) and
+    plan_placement() assigns the engine's threads:
+
+    - I/O thread and session shards: one physical core each (no SMT
+      sibling is shared or handed to anyone else), on the NIC's node,
+      packed into as few L3 domains as possible, off the NIC's IRQ cores
+    - Logger and flusher: noisy (syscalls, cache-polluting copies), so on
+      an L3 domain the latency-critical threads do not use when there is
+      one, and never on a sibling of a critical core
+    - isolcpus cores are preferred for critical threads when configured
+
+    Usage:
+        auto topo = nfx::util::CpuTopology::detect();
+        nfx::util::PlacementRequest request;
+        request.session_shards = 4;
+        request.nic = nfx::util::NumaTopology::nic("eth0");
+
+        auto plan = nfx::util::plan_placement(topo, request);
+        ShardedEngineConfig config;
+        config.affinity = plan.shard_affinity();
+        // I/O thread: CpuAffinity::pin_to_core(plan.io_core), etc.
+
+    Missing sysfs entries degrade to "each CPU its own core, one L3, node
+    0"; unplaceable threads get core -1 (leave them unpinned).
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/util/cpu_affinity.hpp"
+#include "nexusfix/util/numa.hpp"
+
+#if defined(__linux__)
+    #include <dirent.h>
+#endif
+
+namespace nfx::util {
+
+// ============================================================================
+// CPU Topology
+// ============================================================================
+
+/// One logical CPU
+struct CpuInfo {
+    int cpu{-1};
+    int core{-1};       // Physical core: lowest CPU among its SMT siblings
+    int l3{-1};         // L3 domain (CCX / slice): lowest CPU sharing it
+    int node{0};        // NUMA node
+    bool isolated{false};   // In isolcpus
+};
+
+/// Host CPU layout as read from sysfs
+class CpuTopology {
+public:
+    CpuTopology() = default;
+
+    /// Build from explicit CPU records (tests, or a layout read elsewhere)
+    explicit CpuTopology(std::vector<CpuInfo> cpus) : cpus_{std::move(cpus)} {
+        std::sort(cpus_.begin(), cpus_.end(),
+                  [](const CpuInfo& a, const CpuInfo& b) { return a.cpu < b.cpu; });
+    }
+
+    /// Read the layout under `sysfs` (/sys, or a copy of it)
+    [[nodiscard]] static CpuTopology detect(std::string_view sysfs = "/sys") {
+        const std::string cpu_dir = std::string{sysfs} + "/devices/system/cpu";
+        std::vector<int> online = parse_cpu_list(read_file(cpu_dir + "/online"));
+        if (online.empty()) {
+            for (int i = 0; i < CpuAffinity::core_count(); ++i) online.push_back(i);
+        }
+        const std::vector<int> isolated = parse_cpu_list(read_file(cpu_dir + "/isolated"));
+
+        std::vector<CpuInfo> cpus;
+        cpus.reserve(online.size());
+        for (int cpu : online) {
+            const std::string dir = cpu_dir + "/cpu" + std::to_string(cpu);
+            CpuInfo info;
+            info.cpu = cpu;
+            info.core = lowest(parse_cpu_list(
+                read_file(dir + "/topology/thread_siblings_list")), cpu);
+            info.l3 = lowest(l3_cpus(dir), -1);
+            info.node = std::max(node_link(dir), 0);
+            info.isolated = std::find(isolated.begin(), isolated.end(), cpu) != isolated.end();
+            cpus.push_back(info);
+        }
+        // No L3 information: one domain per node
+        for (auto& info : cpus) {
+            if (info.l3 < 0) info.l3 = first_cpu_of_node(cpus, info.node);
+        }
+        return CpuTopology{std::move(cpus)};
+    }
+
+    [[nodiscard]] const std::vector<CpuInfo>& cpus() const noexcept { return cpus_; }
+
+    /// Record of a CPU, nullptr if it is not online
+    [[nodiscard]] const CpuInfo* find(int cpu) const noexcept {
+        for (const auto& info : cpus_) {
+            if (info.cpu == cpu) return &info;
+        }
+        return nullptr;
+    }
+
+    /// Online CPUs sharing a physical core with `cpu` (itself included)
+    [[nodiscard]] std::vector<int> siblings(int cpu) const {
+        std::vector<int> out;
+        if (const CpuInfo* info = find(cpu)) {
+            for (const auto& other : cpus_) {
+                if (other.core == info->core) out.push_back(other.cpu);
+            }
+        }
+        return out;
+    }
+
+private:
+    [[nodiscard]] static int lowest(const std::vector<int>& list, int fallback) noexcept {
+        return list.empty() ? fallback : *std::min_element(list.begin(), list.end());
+    }
+
+    [[nodiscard]] static int first_cpu_of_node(const std::vector<CpuInfo>& cpus, int node) {
+        for (const auto& info : cpus) {
+            if (info.node == node) return info.cpu;
+        }
+        return 0;
+    }
+
+    /// CPUs sharing the level-3 cache of a CPU (empty if unknown)
+    [[nodiscard]] static std::vector<int> l3_cpus(const std::string& cpu_dir) {
+        for (int index = 0; index < 8; ++index) {
+            const std::string cache = cpu_dir + "/cache/index" + std::to_string(index);
+            const std::string level = read_file(cache + "/level");
+            if (level.empty()) break;
+            if (level.front() == '3') return parse_cpu_list(read_file(cache + "/shared_cpu_list"));
+        }
+        return {};
+    }
+
+    /// Node from the cpuN/nodeM link, -1 if absent
+    [[nodiscard]] static int node_link([[maybe_unused]] const std::string& cpu_dir) {
+#if defined(__linux__)
+        DIR* d = ::opendir(cpu_dir.c_str());
+        if (!d) return -1;
+        int node = -1;
+        while (dirent* e = ::readdir(d)) {
+            std::string_view name{e->d_name};
+            if (name.size() > 4 && name.starts_with("node")) {
+                auto ids = parse_cpu_list(name.substr(4));
+                if (ids.size() == 1) {
+                    node = ids.front();
+                    break;
+                }
+            }
+        }
+        ::closedir(d);
+        return node;
+#else
+        return -1;
+#endif
+    }
+
+    [[nodiscard]] static std::string read_file(const std::string& path) {
+        std::string out;
+        if (std::FILE* f = std::fopen(path.c_str(), "r")) {
+            char buf[4096];
+            size_t n = std::fread(buf, 1, sizeof(buf), f);
+            out.assign(buf, n);
+            std::fclose(f);
+        }
+        return out;
+    }
+
+    std::vector<CpuInfo> cpus_;
+};
+
+// ============================================================================
+// Placement Planner
+// ============================================================================
+
+/// Threads to place
+struct PlacementRequest {
+    size_t session_shards{1};
+    bool io_thread{true};
+    bool logger{true};
+    bool flusher{true};
+    NicTopology nic;                 // Node and IRQ cores of the order-entry NIC
+    std::vector<int> exclude;        // CPUs never to use (e.g. 0 for the OS)
+};
+
+/// Core per thread (-1 = no suitable core: leave it unpinned)
+struct PlacementPlan {
+    int node{-1};                    // Node the critical threads run on
+    int io_core{-1};
+    std::vector<int> shard_cores;
+    int logger_core{-1};
+    int flusher_core{-1};
+
+    /// Every requested critical thread got a core of its own
+    [[nodiscard]] bool complete(const PlacementRequest& request) const noexcept {
+        if (request.io_thread && io_core < 0) return false;
+        return std::count_if(shard_cores.begin(), shard_cores.end(),
+                             [](int c) { return c >= 0; }) ==
+               static_cast<std::ptrdiff_t>(request.session_shards);
+    }
+
+    /// Affinity for ShardedEngine / AcceptorEngine workers
+    [[nodiscard]] CpuAffinityConfig shard_affinity() const {
+        CpuAffinityConfig config;
+        for (int core : shard_cores) {
+            if (core >= 0) config.allowed_cores.push_back(core);
+        }
+        config.isolate_from_system = false;
+        config.numa_node = node;
+        return config;
+    }
+};
+
+/// Assign cores to the engine's threads (see the file comment for the rules)
+[[nodiscard]] inline PlacementPlan plan_placement(const CpuTopology& topo,
+                                                  const PlacementRequest& request) {
+    PlacementPlan plan;
+    const auto& cpus = topo.cpus();
+    if (cpus.empty()) {
+        plan.shard_cores.assign(request.session_shards, -1);
+        return plan;
+    }
+
+    auto listed = [](const std::vector<int>& list, int cpu) {
+        return std::find(list.begin(), list.end(), cpu) != list.end();
+    };
+
+    // Physical cores that may host a thread: every sibling usable
+    std::map<int, std::vector<const CpuInfo*>> cores;   // core -> its CPUs
+    for (const auto& info : cpus) cores[info.core].push_back(&info);
+    std::vector<int> usable;                            // Physical core ids
+    for (const auto& [core, members] : cores) {
+        const bool ok = std::none_of(members.begin(), members.end(), [&](const CpuInfo* c) {
+            return listed(request.exclude, c->cpu);
+        });
+        if (ok) usable.push_back(core);
+    }
+
+    auto info_of = [&](int core) { return cores[core].front(); };
+    auto on_irq_core = [&](int core) {
+        return std::any_of(cores[core].begin(), cores[core].end(),
+                           [&](const CpuInfo* c) { return listed(request.nic.irq_cores, c->cpu); });
+    };
+    auto isolated = [&](int core) {
+        return std::all_of(cores[core].begin(), cores[core].end(),
+                           [](const CpuInfo* c) { return c->isolated; });
+    };
+
+    plan.node = request.nic.node >= 0 ? request.nic.node : info_of(usable.empty()
+        ? cores.begin()->first : usable.front())->node;
+
+    // Critical candidates grouped by L3 domain: the NIC's node first, and
+    // the largest domains first so the threads share as few L3 slices as
+    // possible. Other nodes only once the NIC's node is full.
+    std::map<int, std::vector<int>> by_l3;
+    for (int core : usable) by_l3[info_of(core)->l3].push_back(core);
+    std::vector<std::pair<int, std::vector<int>>> domains(by_l3.begin(), by_l3.end());
+    std::stable_sort(domains.begin(), domains.end(), [&](const auto& a, const auto& b) {
+        const bool a_local = info_of(a.second.front())->node == plan.node;
+        const bool b_local = info_of(b.second.front())->node == plan.node;
+        if (a_local != b_local) return a_local;
+        return a.second.size() > b.second.size();
+    });
+
+    // Within a domain: isolated cores first, IRQ cores last, then by id
+    std::vector<int> critical;
+    for (auto& [l3, members] : domains) {
+        std::stable_sort(members.begin(), members.end(), [&](int a, int b) {
+            if (isolated(a) != isolated(b)) return isolated(a);
+            return !on_irq_core(a) && on_irq_core(b);
+        });
+        critical.insert(critical.end(), members.begin(), members.end());
+    }
+    // IRQ cores only when nothing else is left
+    std::stable_partition(critical.begin(), critical.end(),
+                          [&](int core) { return !on_irq_core(core); });
+
+    std::vector<int> taken;
+    size_t next = 0;
+    auto take_critical = [&]() -> int {
+        if (next >= critical.size()) return -1;
+        const int core = critical[next++];
+        taken.push_back(core);
+        return info_of(core)->cpu;
+    };
+
+    if (request.io_thread) plan.io_core = take_critical();
+    plan.shard_cores.reserve(request.session_shards);
+    for (size_t i = 0; i < request.session_shards; ++i) {
+        plan.shard_cores.push_back(take_critical());
+    }
+
+    // Noisy threads: a free core, preferring L3 domains with no critical
+    // thread, then the critical node, then isolated cores last (leave
+    // those for latency work)
+    std::vector<int> critical_l3;
+    for (int core : taken) critical_l3.push_back(info_of(core)->l3);
+
+    std::vector<int> noisy;
+    for (int core : usable) {
+        if (!listed(taken, core)) noisy.push_back(core);
+    }
+    std::stable_sort(noisy.begin(), noisy.end(), [&](int a, int b) {
+        const bool a_shared = listed(critical_l3, info_of(a)->l3);
+        const bool b_shared = listed(critical_l3, info_of(b)->l3);
+        if (a_shared != b_shared) return !a_shared;
+        const bool a_node = info_of(a)->node == plan.node;
+        const bool b_node = info_of(b)->node == plan.node;
+        if (a_node != b_node) return a_node;
+        return !isolated(a) && isolated(b);
+    });
+
+    size_t next_noisy = 0;
+    auto take_noisy = [&]() -> int {
+        if (next_noisy < noisy.size()) return info_of(noisy[next_noisy++])->cpu;
+        // Out of cores: share the last noisy one rather than a critical sibling
+        return next_noisy > 0 ? info_of(noisy[next_noisy - 1])->cpu : -1;
+    };
+    if (request.logger) plan.logger_core = take_noisy();
+    if (request.flusher) plan.flusher_core = take_noisy();
+    return plan;
+}
+
+} // namespace nfx::util
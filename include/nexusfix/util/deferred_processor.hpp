@@ -17,6 +17,12 @@
     |  - publish       |                  |  - callbacks         |
     +------------------+                  +----------------------+
 
+    LanedDeferredProcessor scales the background side out: messages are
+    hashed by session key onto N lanes, one SPSC queue and worker each, so
+    order is kept within a session while sessions proceed in parallel.
+    Its callback is a template parameter (no std::function), and submit()
+    reports backpressure before a lane fills.
+
     Usage:
         DeferredProcessor<FIXMessage, 65536> processor;
 
@@ -38,13 +44,20 @@
 
 #include "nexusfix/platform/platform.hpp"
 #include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/memory/wait_strategy.hpp"
+#include "nexusfix/util/inline_function.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
 
 #include <thread>
 #include <atomic>
 #include <functional>
 #include <cstring>
 #include <chrono>
+#include <concepts>
+#include <memory>
+#include <optional>
 #include <span>
+#include <utility>
 
 namespace nfx::util {
 
@@ -80,8 +93,11 @@ struct DeferredMessageBuffer {
 /// Lock-free deferred processor for moving expensive work off hot path
 /// @tparam BufferType Message buffer type
 /// @tparam QueueCapacity SPSC queue capacity (must be power of 2)
+/// @tparam WaitStrategyT How the worker idles on an empty queue
+///         (memory::AdaptiveWait parks it during quiet periods)
 template<typename BufferType = DeferredMessageBuffer<4096>,
-         size_t QueueCapacity = 65536>
+         size_t QueueCapacity = 65536,
+         typename WaitStrategyT = memory::YieldingWait>
 class DeferredProcessor {
 public:
     using ProcessCallback = std::function<void(const BufferType&)>;
@@ -138,6 +154,7 @@ public:
         }
 
         drain_on_stop_ = drain;
+        memory::notify_waiters<WaitStrategyT>();  // Worker may be parked
 
         if (worker_.joinable()) {
             worker_.join();
@@ -243,6 +260,13 @@ private:
     // Background Processing
     // ========================================================================
 
+    /// Idle until a message arrives or stop() is called
+    void wait_for_work() noexcept {
+        WaitStrategyT::wait_until([this] {
+            return !queue_.empty() || !running_.load(std::memory_order_relaxed);
+        });
+    }
+
     void process_loop() noexcept {
         while (running_.load(std::memory_order_relaxed) || drain_on_stop_) {
             BufferType buffer;
@@ -261,8 +285,7 @@ private:
                 if (!running_.load(std::memory_order_relaxed)) {
                     break;  // Stopped and queue empty
                 }
-                // Brief pause to avoid spinning
-                std::this_thread::yield();
+                wait_for_work();
             }
         }
     }
@@ -289,7 +312,7 @@ private:
                 if (!running_.load(std::memory_order_relaxed)) {
                     break;
                 }
-                std::this_thread::yield();
+                wait_for_work();
             }
         }
     }
@@ -298,7 +321,7 @@ private:
     // Member Variables
     // ========================================================================
 
-    memory::SPSCQueue<BufferType, QueueCapacity> queue_;
+    memory::SPSCQueue<BufferType, QueueCapacity, WaitStrategyT> queue_;
     std::atomic<bool> running_{false};
     bool drain_on_stop_{true};
 
@@ -325,13 +348,327 @@ using HighThroughputProcessor = DeferredProcessor<DeferredMessageBuffer<4096>, 2
 /// Compact processor for low-latency scenarios
 using CompactProcessor = DeferredProcessor<DeferredMessageBuffer<512>, 16384>;
 
+// ============================================================================
+// Laned Deferred Processor
+// ============================================================================
+
+/// Outcome of LanedDeferredProcessor::submit()
+enum class SubmitStatus : uint8_t {
+    Accepted,       // Queued
+    Backpressure,   // Queued, but the lane is past its high-water mark
+    Full            // Not queued: the lane is full
+};
+
+/// Deferred processor with N worker lanes; messages of one session key
+/// always take the same lane, so they are processed in submission order.
+/// One producer thread; the callback runs on every lane's worker, each
+/// with its own copy: callback(uint64_t session_key, const BufferType&)
+/// @tparam Callback Invocable, copied once per lane
+/// @tparam LaneCapacity Per-lane SPSC queue capacity (power of 2)
+template<typename Callback,
+         typename BufferType = DeferredMessageBuffer<4096>,
+         size_t LaneCapacity = 16384,
+         typename WaitStrategyT = memory::YieldingWait>
+    requires std::copy_constructible<Callback> &&
+             std::invocable<Callback&, uint64_t, const BufferType&>
+class LanedDeferredProcessor {
+public:
+    /// Per-lane counters
+    struct LaneStats {
+        uint64_t submitted{0};        // Queued (including under backpressure)
+        uint64_t processed{0};        // Handed to the callback
+        uint64_t rejected{0};         // Lane full
+        uint64_t backpressured{0};    // Queued past the high-water mark
+        uint64_t max_depth{0};        // Deepest queue seen by the producer
+    };
+
+    /// @param lanes Worker lanes (at least 1)
+    /// @param callback Copied into every lane
+    /// @param high_water Depth at which submit() signals Backpressure
+    ///        (0 = three quarters of the lane capacity)
+    LanedDeferredProcessor(size_t lanes, Callback callback, size_t high_water = 0)
+        : lane_count_{lanes > 0 ? lanes : 1}
+        , lanes_{std::make_unique<Lane[]>(lane_count_)}
+        , high_water_{high_water > 0 ? std::min(high_water, Queue::capacity())
+                                     : Queue::capacity() * 3 / 4}
+    {
+        for (size_t i = 0; i < lane_count_; ++i) {
+            lanes_[i].callback.emplace(callback);
+        }
+    }
+
+    ~LanedDeferredProcessor() {
+        stop();
+    }
+
+    // Non-copyable, non-movable
+    LanedDeferredProcessor(const LanedDeferredProcessor&) = delete;
+    LanedDeferredProcessor& operator=(const LanedDeferredProcessor&) = delete;
+    LanedDeferredProcessor(LanedDeferredProcessor&&) = delete;
+    LanedDeferredProcessor& operator=(LanedDeferredProcessor&&) = delete;
+
+    // ========================================================================
+    // Lifecycle
+    // ========================================================================
+
+    /// Start one worker per lane; messages submitted earlier are waiting
+    /// @return true if started, false if already running
+    bool start() {
+        if (running_.exchange(true)) {
+            return false;
+        }
+        drain_on_stop_.store(true, std::memory_order_relaxed);
+        for (size_t i = 0; i < lane_count_; ++i) {
+            lanes_[i].worker = std::thread([this, i] { lane_loop(lanes_[i]); });
+        }
+        return true;
+    }
+
+    /// Stop all workers
+    /// @param drain If true, every lane processes what it holds first
+    void stop(bool drain = true) noexcept {
+        drain_on_stop_.store(drain, std::memory_order_relaxed);
+        if (!running_.exchange(false)) {
+            return;
+        }
+        memory::notify_waiters<WaitStrategyT>();  // Workers may be parked
+
+        for (size_t i = 0; i < lane_count_; ++i) {
+            if (lanes_[i].worker.joinable()) {
+                lanes_[i].worker.join();
+            }
+        }
+    }
+
+    [[nodiscard]] bool is_running() const noexcept {
+        return running_.load(std::memory_order_relaxed);
+    }
+
+    // ========================================================================
+    // Hot Path Interface (producer thread only)
+    // ========================================================================
+
+    /// Submit a message to its session's lane (HOT PATH)
+    /// @param session_key Messages with equal keys keep their order
+    /// @param timestamp Optional RDTSC timestamp (0 = auto)
+    [[nodiscard]] NFX_HOT
+    SubmitStatus submit(uint64_t session_key, std::span<const char> data,
+                        uint64_t timestamp = 0) noexcept {
+        if (timestamp == 0) {
+            timestamp = rdtsc();
+        }
+
+        Lane& lane = lanes_[lane_for(session_key)];
+        Entry entry;
+        entry.session_key = session_key;
+        entry.buffer.set(data, timestamp);
+
+        if (!lane.queue.try_push(std::move(entry))) [[unlikely]] {
+            bump(lane.rejected);
+            return SubmitStatus::Full;
+        }
+        bump(lane.submitted);
+
+        const size_t depth = lane.queue.size_approx();
+        if (depth > lane.max_depth.load(std::memory_order_relaxed)) {
+            lane.max_depth.store(depth, std::memory_order_relaxed);
+        }
+        if (depth >= high_water_) [[unlikely]] {
+            bump(lane.backpressured);
+            return SubmitStatus::Backpressure;
+        }
+        return SubmitStatus::Accepted;
+    }
+
+    /// Lane a session key maps to
+    [[nodiscard]] size_t lane_for(uint64_t session_key) const noexcept {
+        // Fibonacci mix, then the high 32 bits scaled onto the lane count
+        const uint64_t mixed = session_key * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(((mixed >> 32) * lane_count_) >> 32);
+    }
+
+    /// Whether a session's lane is past its high-water mark
+    [[nodiscard]] bool backpressured(uint64_t session_key) const noexcept {
+        return lanes_[lane_for(session_key)].queue.size_approx() >= high_water_;
+    }
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+
+    [[nodiscard]] size_t lane_count() const noexcept { return lane_count_; }
+    [[nodiscard]] size_t high_water() const noexcept { return high_water_; }
+
+    [[nodiscard]] size_t lane_depth(size_t lane) const noexcept {
+        return lanes_[lane].queue.size_approx();
+    }
+
+    [[nodiscard]] LaneStats lane_stats(size_t lane) const noexcept {
+        const Lane& l = lanes_[lane];
+        return LaneStats{
+            .submitted = l.submitted.load(std::memory_order_relaxed),
+            .processed = l.processed.load(std::memory_order_relaxed),
+            .rejected = l.rejected.load(std::memory_order_relaxed),
+            .backpressured = l.backpressured.load(std::memory_order_relaxed),
+            .max_depth = l.max_depth.load(std::memory_order_relaxed),
+        };
+    }
+
+    /// Counters summed over all lanes (max_depth: deepest lane)
+    [[nodiscard]] LaneStats stats() const noexcept {
+        LaneStats total;
+        for (size_t i = 0; i < lane_count_; ++i) {
+            const LaneStats lane = lane_stats(i);
+            total.submitted += lane.submitted;
+            total.processed += lane.processed;
+            total.rejected += lane.rejected;
+            total.backpressured += lane.backpressured;
+            total.max_depth = std::max(total.max_depth, lane.max_depth);
+        }
+        return total;
+    }
+
+private:
+    struct Entry {
+        uint64_t session_key;
+        BufferType buffer;
+    };
+
+    using Queue = memory::SPSCQueue<Entry, LaneCapacity, WaitStrategyT>;
+
+    /// One queue, worker and callback; counters single-writer each
+    struct alignas(memory::CACHE_LINE_SIZE) Lane {
+        Queue queue;
+        std::optional<Callback> callback;
+        std::thread worker;
+
+        // Producer-written
+        alignas(memory::CACHE_LINE_SIZE) std::atomic<uint64_t> submitted{0};
+        std::atomic<uint64_t> rejected{0};
+        std::atomic<uint64_t> backpressured{0};
+        std::atomic<uint64_t> max_depth{0};
+
+        // Worker-written
+        alignas(memory::CACHE_LINE_SIZE) std::atomic<uint64_t> processed{0};
+    };
+
+    static uint64_t rdtsc() noexcept {
+        uint64_t lo, hi;
+        asm volatile("rdtscp" : "=a"(lo), "=d"(hi) :: "rcx");
+        return (hi << 32) | lo;
+    }
+
+    /// Single-writer increment
+    static void bump(std::atomic<uint64_t>& counter) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    void lane_loop(Lane& lane) noexcept {
+        Entry entry;
+        while (running_.load(std::memory_order_relaxed) ||
+               drain_on_stop_.load(std::memory_order_relaxed)) {
+            if (lane.queue.try_pop(entry)) {
+                (*lane.callback)(entry.session_key, std::as_const(entry.buffer));
+                bump(lane.processed);
+            } else {
+                if (!running_.load(std::memory_order_relaxed)) {
+                    break;  // Stopped and lane empty
+                }
+                WaitStrategyT::wait_until([&] {
+                    return !lane.queue.empty() || !running_.load(std::memory_order_relaxed);
+                });
+            }
+        }
+    }
+
+    size_t lane_count_;
+    std::unique_ptr<Lane[]> lanes_;
+    size_t high_water_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> drain_on_stop_{true};
+};
+
+// ============================================================================
+// Deferred Checksum Verification
+// ============================================================================
+
+/// Verifies CheckSum (10) off the hot path for messages parsed with
+/// ChecksumPolicy::Deferred. Handlers see the message first; a failure is
+/// reported afterwards through the error callback (background thread).
+/// Messages larger than MaxSize cannot be queued and are verified inline.
+template<size_t MaxSize = 4096, size_t QueueCapacity = 65536>
+class DeferredChecksumVerifier {
+public:
+    using Buffer = DeferredMessageBuffer<MaxSize>;
+    using ErrorCallback = std::function<void(std::span<const char>, ParseError)>;
+
+    DeferredChecksumVerifier() noexcept = default;
+
+    ~DeferredChecksumVerifier() {
+        stop();
+    }
+
+    DeferredChecksumVerifier(const DeferredChecksumVerifier&) = delete;
+    DeferredChecksumVerifier& operator=(const DeferredChecksumVerifier&) = delete;
+
+    /// Start background verification
+    /// @param on_error Called with the message copy and error on mismatch
+    bool start(ErrorCallback on_error) noexcept {
+        on_error_ = std::move(on_error);
+        return processor_.start([this](const Buffer& buffer) {
+            check(buffer.span());
+        });
+    }
+
+    /// Stop, verifying everything still queued
+    void stop() noexcept {
+        processor_.stop(true);
+    }
+
+    /// Queue a message for verification (HOT PATH: one memcpy)
+    /// @return false if the queue is full (message not verified)
+    [[nodiscard]] NFX_HOT
+    bool submit(std::span<const char> msg) noexcept {
+        if (msg.size() > MaxSize) [[unlikely]] {
+            check(msg);
+            return true;
+        }
+        return processor_.submit(msg);
+    }
+
+    [[nodiscard]] uint64_t verified() const noexcept {
+        return verified_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t failed() const noexcept {
+        return failed_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void check(std::span<const char> msg) noexcept {
+        ParseError err = verify_checksum(msg);
+        if (err.code != ParseErrorCode::None) [[unlikely]] {
+            failed_.fetch_add(1, std::memory_order_relaxed);
+            if (on_error_) on_error_(msg, err);
+        }
+        verified_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    DeferredProcessor<Buffer, QueueCapacity> processor_;
+    ErrorCallback on_error_;
+    std::atomic<uint64_t> verified_{0};
+    std::atomic<uint64_t> failed_{0};
+};
+
 // ============================================================================
 // Deferred Callback Helper
 // ============================================================================
 
 /// Helper for deferring callback execution
-/// Useful for session callbacks that shouldn't block hot path
-template<typename Callback, size_t QueueCapacity = 4096>
+/// Useful for session callbacks that shouldn't block hot path. The default
+/// InlineFunction keeps captures in the queue slot: scheduling a lambda
+/// never allocates (captures over 64 bytes fail to compile)
+template<typename Callback = InlineFunction<void()>, size_t QueueCapacity = 4096>
 class DeferredCallbackExecutor {
 public:
     struct CallbackItem {
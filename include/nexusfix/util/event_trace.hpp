@@ -0,0 +1,438 @@
+/*
+    NexusFIX Event Tracing
+
+    Per-message trace points for following one message through the hot
+    path when chasing tail outliers. Each trace point appends a 16-byte
+    record (TSC, event, phase, session, MsgSeqNum) to the calling thread's
+    ring; (session, MsgSeqNum) is the message's trace ID, so an inbound
+    message and the orders sent from its callback line up in the viewer.
+
+        recv        message handed to the session (instant, at the
+                    transport's receive stamp when it set one)
+        parse       parse into the session's IndexedParser
+        dispatch    typed route / on_app_message callback
+        strategy    application spans (NFX_TRACE_BEGIN/END in user code)
+        serialize   outbound build
+        send        handed to the transport
+        outlier     recv-to-callback-return above the outlier threshold
+
+    Recording costs an rdtscp and two relaxed 8-byte stores: no RMW, no
+    sharing, no branches beyond the thread's first record. Rings overwrite
+    their oldest records, so tracing can stay on in production; a monitor
+    thread dumps the last TraceRing::CAPACITY records of every thread as
+    Chrome trace JSON (loadable in Perfetto and chrome://tracing), either
+    on demand or when take_outlier() reports a trigger.
+
+    The trace points are compiled in with NFX_HAS_EVENT_TRACE=1 (CMake
+    option NFX_ENABLE_EVENT_TRACE) and expand to nothing otherwise.
+
+    Usage (monitoring thread):
+        nfx::util::TraceRegistry::set_outlier_threshold_ns(50'000);
+        ...
+        if (auto hit = nfx::util::TraceRegistry::take_outlier()) {
+            nfx::util::TraceRegistry::dump_chrome_trace("outlier.json");
+        }
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+#if defined(NFX_HAS_EVENT_TRACE) && NFX_HAS_EVENT_TRACE
+    #define NFX_EVENT_TRACE 1
+#else
+    #define NFX_EVENT_TRACE 0
+#endif
+
+namespace nfx::util {
+
+// ============================================================================
+// Trace Events
+// ============================================================================
+
+enum class TraceEvent : uint8_t {
+    Recv,
+    Parse,
+    Dispatch,
+    Strategy,
+    Serialize,
+    Send,
+    Outlier,
+};
+
+inline constexpr size_t TRACE_EVENT_COUNT = 7;
+
+[[nodiscard]] constexpr std::string_view trace_event_name(TraceEvent event) noexcept {
+    switch (event) {
+        case TraceEvent::Recv:      return "recv";
+        case TraceEvent::Parse:     return "parse";
+        case TraceEvent::Dispatch:  return "dispatch";
+        case TraceEvent::Strategy:  return "strategy";
+        case TraceEvent::Serialize: return "serialize";
+        case TraceEvent::Send:      return "send";
+        case TraceEvent::Outlier:   return "outlier";
+    }
+    return "unknown";
+}
+
+/// Span boundary or point event (Chrome trace "B", "E", "i")
+enum class TracePhase : uint8_t {
+    Begin,
+    End,
+    Instant,
+};
+
+/// One trace point
+struct TraceRecord {
+    uint64_t tsc{0};
+    uint32_t seq_num{0};
+    uint16_t session{0};
+    TraceEvent event{TraceEvent::Recv};
+    TracePhase phase{TracePhase::Instant};
+};
+
+// ============================================================================
+// Per-Thread Ring
+// ============================================================================
+
+/// Single-writer ring of the last CAPACITY trace records of one thread.
+/// Records are two relaxed atomic words, so a dumping thread may copy
+/// the ring while the owner keeps writing; snapshot() drops whatever the
+/// writer may have overwritten during the copy.
+class TraceRing {
+public:
+    static constexpr size_t CAPACITY = 8192;     // 128 KiB per thread
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+    /// Append one record (owning thread only)
+    void record(uint64_t tsc, TraceEvent event, TracePhase phase,
+                uint16_t session, uint32_t seq_num) noexcept {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[head & MASK];
+        slot.tsc.store(tsc, std::memory_order_relaxed);
+        slot.meta.store(pack(event, phase, session, seq_num), std::memory_order_relaxed);
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    /// Records written since the thread started tracing
+    [[nodiscard]] uint64_t written() const noexcept {
+        return head_.load(std::memory_order_acquire);
+    }
+
+    /// Oldest-first copy of the records still in the ring
+    void snapshot(std::vector<TraceRecord>& out) const {
+        const uint64_t end = head_.load(std::memory_order_acquire);
+        uint64_t begin = end > CAPACITY ? end - CAPACITY : 0;
+
+        const size_t base = out.size();
+        out.reserve(base + static_cast<size_t>(end - begin));
+        for (uint64_t i = begin; i < end; ++i) {
+            const Slot& slot = slots_[i & MASK];
+            out.push_back(unpack(slot.tsc.load(std::memory_order_relaxed),
+                                 slot.meta.load(std::memory_order_relaxed)));
+        }
+
+        // Slots below after - CAPACITY may hold newer records than the
+        // ones we meant to read
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t after = head_.load(std::memory_order_relaxed);
+        if (after > CAPACITY && after - CAPACITY > begin) {
+            const uint64_t torn = std::min(after - CAPACITY, end) - begin;
+            out.erase(out.begin() + static_cast<ptrdiff_t>(base),
+                      out.begin() + static_cast<ptrdiff_t>(base + torn));
+        }
+    }
+
+private:
+    static constexpr uint64_t MASK = CAPACITY - 1;
+
+    struct Slot {
+        std::atomic<uint64_t> tsc{0};
+        std::atomic<uint64_t> meta{0};   // seq_num | session << 32 | event << 48 | phase << 56
+    };
+
+    [[nodiscard]] static constexpr uint64_t pack(TraceEvent event, TracePhase phase,
+                                                 uint16_t session, uint32_t seq_num) noexcept {
+        return static_cast<uint64_t>(seq_num)
+             | static_cast<uint64_t>(session) << 32
+             | static_cast<uint64_t>(event) << 48
+             | static_cast<uint64_t>(phase) << 56;
+    }
+
+    [[nodiscard]] static constexpr TraceRecord unpack(uint64_t tsc, uint64_t meta) noexcept {
+        return TraceRecord{
+            tsc,
+            static_cast<uint32_t>(meta),
+            static_cast<uint16_t>(meta >> 32),
+            static_cast<TraceEvent>(static_cast<uint8_t>(meta >> 48)),
+            static_cast<TracePhase>(static_cast<uint8_t>(meta >> 56)),
+        };
+    }
+
+    std::atomic<uint64_t> head_{0};
+    std::array<Slot, CAPACITY> slots_{};
+};
+
+// ============================================================================
+// Trace Registry
+// ============================================================================
+
+/// Message whose recv-to-callback-return time crossed the threshold
+struct TraceOutlier {
+    uint16_t session{0};
+    uint32_t seq_num{0};
+    uint64_t cycles{0};
+};
+
+/// Process-wide set of per-thread trace rings
+class TraceRegistry {
+public:
+    static constexpr size_t MAX_THREADS = 64;
+
+    /// The calling thread's ring, created on first use
+    /// @return nullptr once MAX_THREADS threads have registered
+    [[nodiscard]] static TraceRing* local() noexcept {
+        thread_local TraceRing* ring = claim();
+        return ring;
+    }
+
+    /// Registered ring count
+    [[nodiscard]] static size_t threads() noexcept {
+        return std::min(state().published.load(std::memory_order_acquire), MAX_THREADS);
+    }
+
+    /// One thread's ring (index < threads())
+    [[nodiscard]] static const TraceRing* ring(size_t thread_index) noexcept {
+        if (thread_index >= threads()) return nullptr;
+        return state().rings[thread_index].get();
+    }
+
+    /// Short session tag for trace records (one per SessionManager)
+    [[nodiscard]] static uint16_t next_session() noexcept {
+        return static_cast<uint16_t>(state().sessions.fetch_add(1, std::memory_order_relaxed) + 1);
+    }
+
+    // ------------------------------------------------------------------------
+    // Outlier trigger
+    // ------------------------------------------------------------------------
+
+    /// Flag messages slower than ns from receive to callback return
+    /// (0 disables the trigger)
+    static void set_outlier_threshold_ns(uint64_t ns) noexcept {
+        RdtscClock::initialize();
+        const double cycles = static_cast<double>(ns) * RdtscClock::frequency_ghz();
+        state().outlier_cycles.store(static_cast<uint64_t>(cycles), std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static uint64_t outlier_threshold_cycles() noexcept {
+        return state().outlier_cycles.load(std::memory_order_relaxed);
+    }
+
+    /// Hot path: record an Outlier instant and raise the trigger when
+    /// end_tsc - start_tsc is over the threshold. The first trigger wins
+    /// until a monitor takes it.
+    static void check_outlier(uint64_t start_tsc, uint64_t end_tsc,
+                              uint16_t session, uint32_t seq_num) noexcept {
+        const uint64_t threshold = outlier_threshold_cycles();
+        if (threshold == 0 || start_tsc == 0 || end_tsc - start_tsc <= threshold) [[likely]] return;
+
+        if (auto* ring = local()) {
+            ring->record(end_tsc, TraceEvent::Outlier, TracePhase::Instant, session, seq_num);
+        }
+        State& s = state();
+        bool expected = false;
+        if (s.outlier_pending.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            s.outlier = TraceOutlier{session, seq_num, end_tsc - start_tsc};
+            s.outlier_ready.store(true, std::memory_order_release);
+        }
+    }
+
+    /// Monitor: the pending trigger, if any, re-arming it
+    [[nodiscard]] static std::optional<TraceOutlier> take_outlier() noexcept {
+        State& s = state();
+        if (!s.outlier_ready.load(std::memory_order_acquire)) return std::nullopt;
+        const TraceOutlier hit = s.outlier;
+        s.outlier_ready.store(false, std::memory_order_relaxed);
+        s.outlier_pending.store(false, std::memory_order_release);
+        return hit;
+    }
+
+    // ------------------------------------------------------------------------
+    // Dump
+    // ------------------------------------------------------------------------
+
+    /// Append every ring as Chrome trace JSON ({"traceEvents":[...]});
+    /// timestamps are microseconds since the epoch
+    static void write_chrome_trace(std::string& out) {
+        RdtscClock::initialize();
+        out += "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool first = true;
+        std::vector<TraceRecord> records;
+
+        for (size_t t = 0, n = threads(); t < n; ++t) {
+            records.clear();
+            state().rings[t]->snapshot(records);
+
+            append_separator(out, first);
+            out += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+            append_uint(out, t);
+            out += ",\"args\":{\"name\":\"nfx-";
+            append_uint(out, t);
+            out += "\"}}";
+
+            // A ring that wrapped may open with the end of a span
+            size_t depth = 0;
+            for (const TraceRecord& r : records) {
+                if (r.phase == TracePhase::Begin) ++depth;
+                if (r.phase == TracePhase::End) {
+                    if (depth == 0) continue;
+                    --depth;
+                }
+                append_separator(out, first);
+                append_event(out, r, t);
+            }
+        }
+        out += "]}\n";
+    }
+
+    /// write_chrome_trace() to a file
+    /// @return false if the file cannot be written
+    [[nodiscard]] static bool dump_chrome_trace(const char* path) {
+        std::string json;
+        write_chrome_trace(json);
+        std::FILE* file = std::fopen(path, "w");
+        if (!file) return false;
+        const bool ok = std::fwrite(json.data(), 1, json.size(), file) == json.size();
+        return std::fclose(file) == 0 && ok;
+    }
+
+private:
+    struct State {
+        std::array<std::unique_ptr<TraceRing>, MAX_THREADS> rings;
+        std::atomic<size_t> claimed{0};
+        std::atomic<size_t> published{0};
+        std::atomic<uint32_t> sessions{0};
+        std::atomic<uint64_t> outlier_cycles{0};
+        std::atomic<bool> outlier_pending{false};   // Claimed by a hot thread
+        std::atomic<bool> outlier_ready{false};     // outlier filled in
+        TraceOutlier outlier;
+    };
+
+    [[nodiscard]] static State& state() noexcept {
+        static State s;
+        return s;
+    }
+
+    [[nodiscard]] static TraceRing* claim() noexcept {
+        State& s = state();
+        const size_t index = s.claimed.fetch_add(1, std::memory_order_relaxed);
+        if (index >= MAX_THREADS) return nullptr;
+
+        s.rings[index] = std::make_unique<TraceRing>();
+        // Publish in claim order so readers only see constructed slots
+        size_t expected = index;
+        while (!s.published.compare_exchange_weak(expected, index + 1,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+            expected = index;
+        }
+        return s.rings[index].get();
+    }
+
+    static void append_separator(std::string& out, bool& first) {
+        if (!first) out += ',';
+        first = false;
+    }
+
+    static void append_uint(std::string& out, uint64_t value) {
+        char buf[24];
+        const auto res = std::to_chars(buf, buf + sizeof(buf), value);
+        out.append(buf, res.ptr);
+    }
+
+    static void append_event(std::string& out, const TraceRecord& r, size_t tid) {
+        out += "{\"name\":\"";
+        out += trace_event_name(r.event);
+        out += "\",\"cat\":\"nfx\",\"ph\":\"";
+        out += r.phase == TracePhase::Begin ? 'B' : r.phase == TracePhase::End ? 'E' : 'i';
+        out += '"';
+        if (r.phase == TracePhase::Instant) out += ",\"s\":\"t\"";
+
+        const uint64_t ns = RdtscClock::to_ns(r.tsc);
+        out += ",\"ts\":";
+        append_uint(out, ns / 1000);
+        const uint64_t frac = ns % 1000;
+        out += '.';
+        out += static_cast<char>('0' + frac / 100);
+        out += static_cast<char>('0' + frac / 10 % 10);
+        out += static_cast<char>('0' + frac % 10);
+
+        out += ",\"pid\":1,\"tid\":";
+        append_uint(out, tid);
+        out += ",\"args\":{\"trace_id\":\"";
+        append_uint(out, r.session);
+        out += ':';
+        append_uint(out, r.seq_num);
+        out += "\",\"session\":";
+        append_uint(out, r.session);
+        out += ",\"seq\":";
+        append_uint(out, r.seq_num);
+        out += "}}";
+    }
+};
+
+// ============================================================================
+// Trace Helpers
+// ============================================================================
+
+/// Record a trace point at tsc on the calling thread's ring
+inline void trace_at(uint64_t tsc, TraceEvent event, TracePhase phase,
+                     uint16_t session, uint32_t seq_num) noexcept {
+    if (auto* ring = TraceRegistry::local()) [[likely]] {
+        ring->record(tsc, event, phase, session, seq_num);
+    }
+}
+
+/// Record a trace point now
+inline void trace(TraceEvent event, TracePhase phase,
+                  uint16_t session, uint32_t seq_num) noexcept {
+    trace_at(detail::rdtscp(), event, phase, session, seq_num);
+}
+
+} // namespace nfx::util
+
+// ============================================================================
+// Trace Macros (compiled out unless NFX_HAS_EVENT_TRACE)
+// ============================================================================
+
+#if NFX_EVENT_TRACE
+    /// Open a span of `event` for message (session, seq)
+    #define NFX_TRACE_BEGIN(event, session, seq) \
+        ::nfx::util::trace(::nfx::util::TraceEvent::event, \
+                           ::nfx::util::TracePhase::Begin, (session), (seq))
+    /// Close the innermost span of `event`
+    #define NFX_TRACE_END(event, session, seq) \
+        ::nfx::util::trace(::nfx::util::TraceEvent::event, \
+                           ::nfx::util::TracePhase::End, (session), (seq))
+    /// Point event
+    #define NFX_TRACE_INSTANT(event, session, seq) \
+        ::nfx::util::trace(::nfx::util::TraceEvent::event, \
+                           ::nfx::util::TracePhase::Instant, (session), (seq))
+#else
+    #define NFX_TRACE_BEGIN(event, session, seq) static_cast<void>(0)
+    #define NFX_TRACE_END(event, session, seq) static_cast<void>(0)
+    #define NFX_TRACE_INSTANT(event, session, seq) static_cast<void>(0)
+#endif
@@ -44,30 +44,30 @@ namespace warmup_messages {
 
 /// ExecutionReport (35=8) - most common message type
 inline constexpr std::string_view EXECUTION_REPORT =
-    "8=FIX.4.4\x01" "9=200\x01" "35=8\x01" "49=BROKER\x01" "56=CLIENT\x01"
+    "8=FIX.4.4\x01" "9=207\x01" "35=8\x01" "49=BROKER\x01" "56=CLIENT\x01"
     "34=12345\x01" "52=20240115-09:30:00.123456\x01" "37=ORD001\x01"
     "11=CLORD001\x01" "17=EXEC001\x01" "150=0\x01" "39=0\x01"
     "55=AAPL\x01" "54=1\x01" "38=1000\x01" "44=150.50\x01"
     "32=500\x01" "31=150.45\x01" "151=500\x01" "14=500\x01"
-    "6=150.475\x01" "60=20240115-09:30:00.123000\x01" "10=123\x01";
+    "6=150.475\x01" "60=20240115-09:30:00.123000\x01" "10=152\x01";
 
 /// NewOrderSingle (35=D)
 inline constexpr std::string_view NEW_ORDER_SINGLE =
-    "8=FIX.4.4\x01" "9=150\x01" "35=D\x01" "49=CLIENT\x01" "56=BROKER\x01"
+    "8=FIX.4.4\x01" "9=140\x01" "35=D\x01" "49=CLIENT\x01" "56=BROKER\x01"
     "34=100\x01" "52=20240115-09:29:59.999999\x01" "11=CLORD002\x01"
     "55=MSFT\x01" "54=2\x01" "38=500\x01" "40=2\x01" "44=400.00\x01"
-    "59=0\x01" "60=20240115-09:29:59.999000\x01" "10=456\x01";
+    "59=0\x01" "60=20240115-09:29:59.999000\x01" "10=086\x01";
 
 /// Heartbeat (35=0) - frequent admin message
 inline constexpr std::string_view HEARTBEAT =
-    "8=FIX.4.4\x01" "9=60\x01" "35=0\x01" "49=BROKER\x01" "56=CLIENT\x01"
-    "34=99\x01" "52=20240115-09:30:30.000000\x01" "112=TEST1\x01" "10=789\x01";
+    "8=FIX.4.4\x01" "9=69\x01" "35=0\x01" "49=BROKER\x01" "56=CLIENT\x01"
+    "34=99\x01" "52=20240115-09:30:30.000000\x01" "112=TEST1\x01" "10=097\x01";
 
 /// Logon (35=A) - session establishment
 inline constexpr std::string_view LOGON =
-    "8=FIX.4.4\x01" "9=100\x01" "35=A\x01" "49=CLIENT\x01" "56=BROKER\x01"
+    "8=FIX.4.4\x01" "9=76\x01" "35=A\x01" "49=CLIENT\x01" "56=BROKER\x01"
     "34=1\x01" "52=20240115-09:00:00.000000\x01" "98=0\x01" "108=30\x01"
-    "141=Y\x01" "10=012\x01";
+    "141=Y\x01" "10=044\x01";
 
 } // namespace warmup_messages
 
@@ -0,0 +1,127 @@
+/*
+    NexusFIX Inline Function
+
+    Move-only type-erased callable with fixed inline storage, for queue
+    items scheduled from the hot path. std::function heap-allocates any
+    capture larger than its small buffer (16 bytes on libstdc++); here a
+    capture that does not fit is a compile-time error, so constructing,
+    moving and destroying an InlineFunction never touches malloc.
+
+    Usage:
+        InlineFunction<void()> fn = [order, session]() { persist(order, session); };
+        fn();   // Invoke; an empty InlineFunction must not be called
+
+        // Up to 128 bytes of captures
+        InlineFunction<void(uint64_t), 128> wide = [big_state](uint64_t ts) { ... };
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace nfx::util {
+
+template<typename Signature, size_t Capacity = 64>
+class InlineFunction;
+
+/// Move-only callable stored in Capacity bytes, never on the heap
+/// @tparam Capacity Inline storage; larger captures fail to compile
+template<typename R, typename... Args, size_t Capacity>
+class InlineFunction<R(Args...), Capacity> {
+public:
+    static constexpr size_t capacity = Capacity;
+
+    InlineFunction() noexcept = default;
+    InlineFunction(std::nullptr_t) noexcept {}
+
+    /// Store a callable in place
+    template<typename F>
+        requires (!std::is_same_v<std::remove_cvref_t<F>, InlineFunction> &&
+                  std::is_invocable_r_v<R, std::remove_cvref_t<F>&, Args...>)
+    InlineFunction(F&& fn) noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<F>, F>) {
+        using Fn = std::remove_cvref_t<F>;
+        static_assert(sizeof(Fn) <= Capacity,
+                      "Callable captures exceed InlineFunction capacity");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t),
+                      "Callable is over-aligned for InlineFunction storage");
+        static_assert(std::is_nothrow_move_constructible_v<Fn>,
+                      "Callable must be nothrow move constructible");
+
+        std::construct_at(reinterpret_cast<Fn*>(storage_), std::forward<F>(fn));
+        ops_ = &OPS<Fn>;
+    }
+
+    InlineFunction(InlineFunction&& other) noexcept {
+        take(other);
+    }
+
+    InlineFunction& operator=(InlineFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction&) = delete;
+    InlineFunction& operator=(const InlineFunction&) = delete;
+
+    ~InlineFunction() {
+        reset();
+    }
+
+    /// Invoke the stored callable (must not be empty)
+    R operator()(Args... args) {
+        return ops_->invoke(storage_, std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+    /// Destroy the stored callable
+    void reset() noexcept {
+        if (ops_) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+private:
+    /// Per-type operations: one static table per stored callable type
+    struct Ops {
+        R (*invoke)(void*, Args&&...);
+        void (*move)(void* dst, void* src) noexcept;   // Move-construct, destroy src
+        void (*destroy)(void*) noexcept;
+    };
+
+    template<typename Fn>
+    static constexpr Ops OPS{
+        [](void* self, Args&&... args) -> R {
+            return std::invoke(*static_cast<Fn*>(self), std::forward<Args>(args)...);
+        },
+        [](void* dst, void* src) noexcept {
+            Fn* from = static_cast<Fn*>(src);
+            std::construct_at(static_cast<Fn*>(dst), std::move(*from));
+            std::destroy_at(from);
+        },
+        [](void* self) noexcept {
+            std::destroy_at(static_cast<Fn*>(self));
+        },
+    };
+
+    void take(InlineFunction& other) noexcept {
+        if (other.ops_) {
+            other.ops_->move(storage_, other.storage_);
+            ops_ = std::exchange(other.ops_, nullptr);
+        }
+    }
+
+    alignas(std::max_align_t) std::byte storage_[Capacity];
+    const Ops* ops_{nullptr};
+};
+
+} // namespace nfx::util
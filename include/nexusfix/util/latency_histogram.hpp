@@ -0,0 +1,340 @@
+/*
+    NexusFIX Latency Histograms
+
+    Per-thread, lock-free latency histograms at named probe points of the
+    library's hot path, timestamped with RDTSCP:
+
+        RecvToParse       receive completion (or on_data_received entry)
+                          to parsed message
+        ParseToCallback   parsed message to on_app_message invocation
+        BuildToSend       outbound build start to handed to the transport
+        SendToCompletion  send SQE armed to its completion (SessionReactor)
+
+    Histograms are HdrHistogram-style log-linear: 32 linear sub-buckets per
+    power of two, so any recorded value is reported within ~3%. Each thread
+    records into its own LatencyRecorder (no sharing, no RMW); every probe
+    is a Seqlock, so a monitoring thread reads consistent snapshots while
+    the hot thread keeps recording.
+
+    The probes are compiled in with NFX_HAS_LATENCY_PROBES=1 (CMake option
+    NFX_ENABLE_LATENCY_PROBES) and expand to nothing otherwise.
+
+    Usage (monitoring thread):
+        auto recv = nfx::util::LatencyRegistry::aggregate(LatencyProbe::RecvToParse);
+        printf("p50=%.0fns p99=%.0fns\n", recv.percentile_ns(50), recv.percentile_ns(99));
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string_view>
+
+#include "nexusfix/memory/seqlock.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+
+#if defined(NFX_HAS_LATENCY_PROBES) && NFX_HAS_LATENCY_PROBES
+    #define NFX_LATENCY_PROBES 1
+#else
+    #define NFX_LATENCY_PROBES 0
+#endif
+
+namespace nfx::util {
+
+// ============================================================================
+// Probe Points
+// ============================================================================
+
+enum class LatencyProbe : uint8_t {
+    RecvToParse,
+    ParseToCallback,
+    BuildToSend,
+    SendToCompletion,
+};
+
+inline constexpr size_t LATENCY_PROBE_COUNT = 4;
+
+[[nodiscard]] constexpr std::string_view latency_probe_name(LatencyProbe probe) noexcept {
+    switch (probe) {
+        case LatencyProbe::RecvToParse:      return "recv->parse";
+        case LatencyProbe::ParseToCallback:  return "parse->callback";
+        case LatencyProbe::BuildToSend:      return "build->send";
+        case LatencyProbe::SendToCompletion: return "send->completion";
+    }
+    return "unknown";
+}
+
+// ============================================================================
+// Histogram Buckets
+// ============================================================================
+
+/// Log-linear bucket layout (values in TSC cycles)
+struct HistogramLayout {
+    static constexpr unsigned SUB_BUCKET_BITS = 5;           // 32 per power of two
+    static constexpr uint64_t SUB_BUCKETS = 1ULL << SUB_BUCKET_BITS;
+    static constexpr unsigned MAX_BITS = 40;                 // ~5 min at 3 GHz
+    static constexpr uint64_t MAX_VALUE = (1ULL << MAX_BITS) - 1;
+    static constexpr size_t BUCKETS = (MAX_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    /// Bucket of a value; values below 2 * SUB_BUCKETS map one-to-one
+    [[nodiscard]] static constexpr size_t index(uint64_t value) noexcept {
+        value = std::min(value, MAX_VALUE);
+        if (value < 2 * SUB_BUCKETS) return static_cast<size_t>(value);
+        const unsigned msb = static_cast<unsigned>(std::bit_width(value)) - 1;
+        const unsigned shift = msb - SUB_BUCKET_BITS;
+        return static_cast<size_t>(((shift + 1) << SUB_BUCKET_BITS) |
+                                   ((value >> shift) & (SUB_BUCKETS - 1)));
+    }
+
+    /// Highest value that maps to a bucket
+    [[nodiscard]] static constexpr uint64_t upper_bound(size_t bucket) noexcept {
+        if (bucket < 2 * SUB_BUCKETS) return bucket;
+        const uint64_t shift = (bucket >> SUB_BUCKET_BITS) - 1;
+        const uint64_t base = (SUB_BUCKETS | (bucket & (SUB_BUCKETS - 1))) << shift;
+        return base + (1ULL << shift) - 1;
+    }
+};
+
+/// Histogram contents (trivially copyable: published through a Seqlock)
+struct HistogramData {
+    std::array<uint64_t, HistogramLayout::BUCKETS> counts{};
+    uint64_t count{0};
+    uint64_t sum{0};
+    uint64_t min{std::numeric_limits<uint64_t>::max()};
+    uint64_t max{0};
+
+    void record(uint64_t cycles) noexcept {
+        ++counts[HistogramLayout::index(cycles)];
+        ++count;
+        sum += cycles;
+        min = std::min(min, cycles);
+        max = std::max(max, cycles);
+    }
+
+    void merge(const HistogramData& other) noexcept {
+        for (size_t i = 0; i < counts.size(); ++i) counts[i] += other.counts[i];
+        count += other.count;
+        sum += other.sum;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+    }
+};
+
+// ============================================================================
+// Histogram Snapshot
+// ============================================================================
+
+/// Point-in-time copy of a histogram, reported in nanoseconds
+class LatencySnapshot {
+public:
+    LatencySnapshot() noexcept = default;
+
+    explicit LatencySnapshot(const HistogramData& data) noexcept
+        : data_{data}
+        , ns_per_cycle_{cycles_to_ns_factor()} {}
+
+    [[nodiscard]] uint64_t count() const noexcept { return data_.count; }
+    [[nodiscard]] bool empty() const noexcept { return data_.count == 0; }
+
+    [[nodiscard]] double min_ns() const noexcept {
+        return empty() ? 0.0 : to_ns(data_.min);
+    }
+    [[nodiscard]] double max_ns() const noexcept { return to_ns(data_.max); }
+    [[nodiscard]] double mean_ns() const noexcept {
+        return empty() ? 0.0 : to_ns(data_.sum) / static_cast<double>(data_.count);
+    }
+
+    /// Value at a percentile (0-100), as the upper bound of its bucket
+    /// clamped to the recorded maximum
+    [[nodiscard]] double percentile_ns(double percentile) const noexcept {
+        return to_ns(percentile_cycles(percentile));
+    }
+
+    [[nodiscard]] uint64_t percentile_cycles(double percentile) const noexcept {
+        if (empty()) return 0;
+        const double clamped = std::clamp(percentile, 0.0, 100.0);
+        const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(
+            clamped / 100.0 * static_cast<double>(data_.count) + 0.5));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < data_.counts.size(); ++i) {
+            seen += data_.counts[i];
+            if (seen >= rank) {
+                return std::min(HistogramLayout::upper_bound(i), data_.max);
+            }
+        }
+        return data_.max;
+    }
+
+    [[nodiscard]] const HistogramData& data() const noexcept { return data_; }
+
+    /// Fold another snapshot in (e.g. the same probe of another thread)
+    void merge(const LatencySnapshot& other) noexcept {
+        data_.merge(other.data_);
+        if (ns_per_cycle_ == 0.0) ns_per_cycle_ = other.ns_per_cycle_;
+    }
+
+private:
+    [[nodiscard]] static double cycles_to_ns_factor() noexcept {
+        double ghz = RdtscClock::frequency_ghz();
+        if (ghz == 0.0) {
+            RdtscClock::initialize();  // Off the hot path: snapshots only
+            ghz = RdtscClock::frequency_ghz();
+        }
+        return ghz > 0.0 ? 1.0 / ghz : 1.0;
+    }
+
+    [[nodiscard]] double to_ns(uint64_t cycles) const noexcept {
+        return static_cast<double>(cycles) * ns_per_cycle_;
+    }
+
+    HistogramData data_{};
+    double ns_per_cycle_{0.0};
+};
+
+// ============================================================================
+// Per-Thread Recorder
+// ============================================================================
+
+/// One thread's histograms; written by its owner, read by anyone
+class LatencyRecorder {
+public:
+    /// Record a duration in cycles (owner thread only)
+    void record(LatencyProbe probe, uint64_t cycles) noexcept {
+        auto& lock = probes_[static_cast<size_t>(probe)];
+        lock.begin_write();
+        lock.data().record(cycles);
+        lock.end_write();
+    }
+
+    /// Consistent copy of one probe (any thread)
+    [[nodiscard]] LatencySnapshot snapshot(LatencyProbe probe) const noexcept {
+        return LatencySnapshot{probes_[static_cast<size_t>(probe)].read()};
+    }
+
+private:
+    std::array<memory::Seqlock<HistogramData>, LATENCY_PROBE_COUNT> probes_;
+};
+
+// ============================================================================
+// Recorder Registry
+// ============================================================================
+
+/// Process-wide directory of the per-thread recorders. Recorders live
+/// until process exit, so a reader never races a thread's teardown.
+class LatencyRegistry {
+public:
+    static constexpr size_t MAX_THREADS = 64;
+
+    /// The calling thread's recorder, created on first use
+    /// @return nullptr once MAX_THREADS threads have registered
+    [[nodiscard]] static LatencyRecorder* local() noexcept {
+        thread_local LatencyRecorder* recorder = claim();
+        return recorder;
+    }
+
+    /// Registered recorder count
+    [[nodiscard]] static size_t threads() noexcept {
+        return std::min(state().published.load(std::memory_order_acquire), MAX_THREADS);
+    }
+
+    /// Snapshot of one thread's probe (index < threads())
+    [[nodiscard]] static LatencySnapshot snapshot(size_t thread_index,
+                                                  LatencyProbe probe) noexcept {
+        if (thread_index >= threads()) return {};
+        return state().recorders[thread_index]->snapshot(probe);
+    }
+
+    /// One probe merged over all threads
+    [[nodiscard]] static LatencySnapshot aggregate(LatencyProbe probe) noexcept {
+        LatencySnapshot total;
+        for (size_t i = 0, n = threads(); i < n; ++i) {
+            total.merge(state().recorders[i]->snapshot(probe));
+        }
+        return total;
+    }
+
+private:
+    struct State {
+        std::array<std::unique_ptr<LatencyRecorder>, MAX_THREADS> recorders;
+        std::atomic<size_t> claimed{0};
+        std::atomic<size_t> published{0};
+    };
+
+    [[nodiscard]] static State& state() noexcept {
+        static State s;
+        return s;
+    }
+
+    [[nodiscard]] static LatencyRecorder* claim() noexcept {
+        State& s = state();
+        const size_t index = s.claimed.fetch_add(1, std::memory_order_relaxed);
+        if (index >= MAX_THREADS) return nullptr;
+
+        s.recorders[index] = std::make_unique<LatencyRecorder>();
+        // Publish in claim order so readers only see constructed slots
+        size_t expected = index;
+        while (!s.published.compare_exchange_weak(expected, index + 1,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+            expected = index;
+        }
+        return s.recorders[index].get();
+    }
+};
+
+// ============================================================================
+// Probe Helpers
+// ============================================================================
+
+/// Probe timestamp (TSC cycles)
+[[nodiscard]] inline uint64_t probe_tsc() noexcept {
+    return detail::rdtscp();
+}
+
+/// Record now - start_tsc on the calling thread's recorder
+inline void record_latency(LatencyProbe probe, uint64_t start_tsc) noexcept {
+    if (start_tsc == 0) return;
+    const uint64_t now = detail::rdtscp();
+    if (auto* recorder = LatencyRegistry::local()) [[likely]] {
+        recorder->record(probe, now - start_tsc);
+    }
+}
+
+/// Record end_tsc - start_tsc when both stamps are at hand
+inline void record_latency(LatencyProbe probe, uint64_t start_tsc, uint64_t end_tsc) noexcept {
+    if (start_tsc == 0) return;
+    if (auto* recorder = LatencyRegistry::local()) [[likely]] {
+        recorder->record(probe, end_tsc - start_tsc);
+    }
+}
+
+namespace detail {
+
+/// Receive completion stamp of the message being delivered on this thread
+/// (set by the transport around delivery, 0 = none)
+inline thread_local uint64_t probe_recv_tsc = 0;
+
+} // namespace detail
+
+} // namespace nfx::util
+
+// ============================================================================
+// Probe Macros (compiled out unless NFX_HAS_LATENCY_PROBES)
+// ============================================================================
+
+#if NFX_LATENCY_PROBES
+    /// Declare `var` holding the current probe timestamp
+    #define NFX_PROBE_TSC(var) const uint64_t var = ::nfx::util::probe_tsc()
+    /// Record the time since `start` at `probe`
+    #define NFX_PROBE_RECORD(probe, start) \
+        ::nfx::util::record_latency(::nfx::util::LatencyProbe::probe, (start))
+#else
+    #define NFX_PROBE_TSC(var) static_cast<void>(0)
+    #define NFX_PROBE_RECORD(probe, start) static_cast<void>(0)
+#endif
@@ -0,0 +1,232 @@
+/*
+    NexusFIX NUMA Topology and Memory Binding
+
+    On multi-socket hosts the NIC, its IRQ cores and the session threads
+    should share one NUMA node, and so should the buffers they touch.
+    CpuAffinity places threads; this header places memory:
+
+    - NumaTopology: node of a core, cores of a node, node and IRQ cores
+      of a NIC (read from sysfs / procfs, no libnuma dependency)
+    - bind_memory_to_node(): mbind(2) a range to one node before it is
+      first touched (or migrate it if already touched)
+
+    Usage:
+        auto nic = nfx::util::NumaTopology::nic("eth0");
+        // Pin the session to one of nic.irq_cores' siblings on nic.node,
+        // then allocate its buffers with numa_node = nic.node
+
+    Everything degrades to "unknown" (-1 / empty) on single-node hosts,
+    non-Linux systems, or when sysfs is not mounted.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__linux__)
+    #include <dirent.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace nfx::util {
+
+// ============================================================================
+// CPU List Parsing
+// ============================================================================
+
+/// Parse a kernel cpu list ("0-3,8,10-11") into core ids.
+/// Malformed entries are skipped.
+[[nodiscard]] inline std::vector<int> parse_cpu_list(std::string_view list) noexcept {
+    std::vector<int> cpus;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t end = list.find(',', pos);
+        if (end == std::string_view::npos) end = list.size();
+        std::string_view item = list.substr(pos, end - pos);
+        pos = end + 1;
+
+        // Trim whitespace / trailing newline
+        while (!item.empty() && (item.back() == '\n' || item.back() == ' ')) item.remove_suffix(1);
+        while (!item.empty() && item.front() == ' ') item.remove_prefix(1);
+        if (item.empty()) continue;
+
+        auto parse_int = [](std::string_view s, int& out) noexcept {
+            if (s.empty()) return false;
+            int v = 0;
+            for (char c : s) {
+                if (c < '0' || c > '9') return false;
+                v = v * 10 + (c - '0');
+            }
+            out = v;
+            return true;
+        };
+
+        const size_t dash = item.find('-');
+        int first = 0;
+        int last = 0;
+        if (dash == std::string_view::npos) {
+            if (!parse_int(item, first)) continue;
+            last = first;
+        } else if (!parse_int(item.substr(0, dash), first) ||
+                   !parse_int(item.substr(dash + 1), last) || last < first) {
+            continue;
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+// ============================================================================
+// NUMA Topology
+// ============================================================================
+
+/// Placement of a network interface
+struct NicTopology {
+    int node{-1};                  // NUMA node of the PCI device (-1 = unknown)
+    std::vector<int> irqs;         // MSI(-X) vectors of the device
+    std::vector<int> irq_cores;    // Cores the IRQs are steered to
+    std::vector<int> node_cores;   // All cores on the device's node
+};
+
+/// Read-only view of the host's NUMA layout
+class NumaTopology {
+public:
+    /// Number of online NUMA nodes (1 when NUMA is absent)
+    [[nodiscard]] static int node_count() noexcept {
+        auto nodes = parse_cpu_list(read_file("/sys/devices/system/node/online"));
+        return nodes.empty() ? 1 : nodes.back() + 1;
+    }
+
+    /// NUMA node of a core, or -1 if unknown
+    [[nodiscard]] static int node_of_cpu([[maybe_unused]] int core_id) noexcept {
+#if defined(__linux__)
+        if (core_id < 0) return -1;
+        // cpuN/ holds a "nodeM" link for its node
+        const std::string dir = "/sys/devices/system/cpu/cpu" + std::to_string(core_id);
+        DIR* d = ::opendir(dir.c_str());
+        if (!d) return -1;
+        int node = -1;
+        while (dirent* e = ::readdir(d)) {
+            std::string_view name{e->d_name};
+            if (name.size() > 4 && name.starts_with("node")) {
+                auto ids = parse_cpu_list(name.substr(4));
+                if (ids.size() == 1) {
+                    node = ids.front();
+                    break;
+                }
+            }
+        }
+        ::closedir(d);
+        return node;
+#else
+        return -1;
+#endif
+    }
+
+    /// Cores on a NUMA node (empty if unknown)
+    [[nodiscard]] static std::vector<int> cpus_of_node(int node_id) noexcept {
+        if (node_id < 0) return {};
+        return parse_cpu_list(read_file(
+            "/sys/devices/system/node/node" + std::to_string(node_id) + "/cpulist"));
+    }
+
+    /// Cores an IRQ is steered to (empty if unknown)
+    [[nodiscard]] static std::vector<int> irq_cores(int irq) noexcept {
+        if (irq < 0) return {};
+        return parse_cpu_list(read_file(
+            "/proc/irq/" + std::to_string(irq) + "/smp_affinity_list"));
+    }
+
+    /// NUMA node, IRQs and IRQ cores of a network interface
+    [[nodiscard]] static NicTopology nic(std::string_view ifname) noexcept {
+        NicTopology topo;
+        const std::string device = "/sys/class/net/" + std::string(ifname) + "/device";
+
+        auto node = parse_cpu_list(read_file(device + "/numa_node"));
+        if (node.size() == 1) topo.node = node.front();  // "-1" parses as empty
+
+#if defined(__linux__)
+        if (DIR* d = ::opendir((device + "/msi_irqs").c_str())) {
+            while (dirent* e = ::readdir(d)) {
+                auto irq = parse_cpu_list(e->d_name);
+                if (irq.size() == 1) topo.irqs.push_back(irq.front());
+            }
+            ::closedir(d);
+        }
+#endif
+
+        for (int irq : topo.irqs) {
+            for (int core : irq_cores(irq)) {
+                if (std::find(topo.irq_cores.begin(), topo.irq_cores.end(), core) ==
+                    topo.irq_cores.end()) {
+                    topo.irq_cores.push_back(core);
+                }
+            }
+        }
+        std::sort(topo.irqs.begin(), topo.irqs.end());
+        std::sort(topo.irq_cores.begin(), topo.irq_cores.end());
+
+        // Node unknown (VMs): fall back to the node of the IRQ cores
+        if (topo.node < 0 && !topo.irq_cores.empty()) {
+            topo.node = node_of_cpu(topo.irq_cores.front());
+        }
+        topo.node_cores = cpus_of_node(topo.node);
+        return topo;
+    }
+
+private:
+    [[nodiscard]] static std::string read_file(const std::string& path) noexcept {
+        std::string out;
+        if (std::FILE* f = std::fopen(path.c_str(), "r")) {
+            char buf[4096];
+            size_t n = std::fread(buf, 1, sizeof(buf), f);
+            out.assign(buf, n);
+            std::fclose(f);
+        }
+        return out;
+    }
+};
+
+// ============================================================================
+// Memory Binding
+// ============================================================================
+
+/// How strictly a range is tied to its node
+enum class NumaPolicy : int {
+    Preferred = 1,  // MPOL_PREFERRED: node first, others when it is full
+    Bind = 2,       // MPOL_BIND: node only
+};
+
+/// Bind [addr, addr + length) to a NUMA node with mbind(2). Call before
+/// the pages are first touched; already-resident pages are migrated.
+/// @param addr Page-aligned start (mmap / huge-page allocations are)
+/// @return errno of the failure, 0 on success (EINVAL for node < 0)
+[[nodiscard]] inline int bind_memory_to_node(
+    [[maybe_unused]] void* addr,
+    [[maybe_unused]] size_t length,
+    int node,
+    [[maybe_unused]] NumaPolicy policy = NumaPolicy::Preferred) noexcept
+{
+    if (node < 0 || node >= 64) return EINVAL;  // Single-word node mask
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr unsigned MPOL_MF_MOVE_FLAG = 1u << 1;
+    const unsigned long mask = 1UL << node;
+    const long rc = ::syscall(SYS_mbind, addr, length, static_cast<int>(policy),
+                              &mask, sizeof(mask) * 8 + 1, MPOL_MF_MOVE_FLAG);
+    return rc == 0 ? 0 : errno;
+#else
+    return ENOSYS;
+#endif
+}
+
+} // namespace nfx::util
@@ -0,0 +1,446 @@
+/*
+    NexusFIX Runtime Performance Counters
+
+    Sampled hardware counters around the hot-path stages of a session, for
+    diagnosing live regressions ("it got slower after the kernel upgrade")
+    without attaching perf:
+
+        parse       inbound message indexed by the session's parser
+        dispatch    typed route / on_app_message callback (includes any
+                    sends the callback makes)
+        send        outbound build and hand-off to the transport
+
+    Every thread opens one perf_event group (cycles, instructions, cache
+    misses, branch misses; user space only) the first time it samples, and
+    keeps it for its lifetime. The group's pages are mmapped so a sample is
+    read with rdpmc, no syscall: each stage scope reads the four counters on
+    entry and exit, and adds the deltas to the thread's per-stage totals.
+    Only every Nth scope of a stage is sampled (set_sample_every(), default
+    1024); the others cost a thread_local decrement and a branch.
+
+    Totals are relaxed single-writer words, like the trace rings: a
+    monitoring thread aggregates all threads with PerfCounterRegistry and
+    publishes them (util::PerfMetrics in shm_metrics.hpp exports them to
+    Prometheus, where IPC is rate(instructions) / rate(cycles)). A read may
+    see one stage's fields one sample apart; each field on its own is exact.
+
+    When perf_event_open is refused (perf_event_paranoid, containers, no
+    PMU) the thread's scopes stay disabled and PerfCounterRegistry reports
+    it through open_failures(). Where rdpmc is not permitted or the CPU is
+    not x86, samples fall back to read() on each counter.
+
+    The scopes are compiled in with NFX_HAS_PERF_COUNTERS=1 (CMake option
+    NFX_ENABLE_PERF_COUNTERS) and expand to nothing otherwise.
+
+    Usage (monitoring thread):
+        nfx::util::PerfCounterRegistry::set_sample_every(256);
+        auto parse = nfx::util::PerfCounterRegistry::aggregate(PerfStage::Parse);
+        printf("parse ipc=%.2f llc-miss/msg=%.2f\n",
+               parse.ipc(), parse.per_sample(parse.cache_misses));
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "nexusfix/platform/platform.hpp"
+
+#if NFX_PLATFORM_LINUX
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+#if defined(NFX_HAS_PERF_COUNTERS) && NFX_HAS_PERF_COUNTERS
+    #define NFX_PERF_COUNTERS 1
+#else
+    #define NFX_PERF_COUNTERS 0
+#endif
+
+namespace nfx::util {
+
+// ============================================================================
+// Stages and Counters
+// ============================================================================
+
+enum class PerfStage : uint8_t {
+    Parse,
+    Dispatch,
+    Send,
+};
+
+inline constexpr size_t PERF_STAGE_COUNT = 3;
+
+[[nodiscard]] constexpr std::string_view perf_stage_name(PerfStage stage) noexcept {
+    switch (stage) {
+        case PerfStage::Parse:    return "parse";
+        case PerfStage::Dispatch: return "dispatch";
+        case PerfStage::Send:     return "send";
+    }
+    return "unknown";
+}
+
+/// Counters of the per-thread group, in group order (cycles leads)
+enum class PerfCounter : uint8_t {
+    Cycles,
+    Instructions,
+    CacheMisses,
+    BranchMisses,
+};
+
+inline constexpr size_t PERF_COUNTER_COUNT = 4;
+
+/// Counter values at one instant, or the deltas over one scope
+using PerfReading = std::array<uint64_t, PERF_COUNTER_COUNT>;
+
+// ============================================================================
+// Stage Totals
+// ============================================================================
+
+/// Summed deltas of the sampled scopes of one stage
+struct PerfTotals {
+    uint64_t samples{0};
+    uint64_t cycles{0};
+    uint64_t instructions{0};
+    uint64_t cache_misses{0};
+    uint64_t branch_misses{0};
+
+    [[nodiscard]] double ipc() const noexcept {
+        return cycles == 0 ? 0.0
+             : static_cast<double>(instructions) / static_cast<double>(cycles);
+    }
+
+    /// Average of a total over the sampled scopes
+    [[nodiscard]] double per_sample(uint64_t total) const noexcept {
+        return samples == 0 ? 0.0
+             : static_cast<double>(total) / static_cast<double>(samples);
+    }
+
+    void merge(const PerfTotals& other) noexcept {
+        samples += other.samples;
+        cycles += other.cycles;
+        instructions += other.instructions;
+        cache_misses += other.cache_misses;
+        branch_misses += other.branch_misses;
+    }
+};
+
+// ============================================================================
+// Per-Thread Counter Group
+// ============================================================================
+
+/// One thread's perf_event group and per-stage totals. The group counts
+/// the owning thread only, so it must be opened and read on that thread;
+/// totals() may be called from anywhere.
+class PerfThreadCounters {
+public:
+    PerfThreadCounters() noexcept = default;
+    ~PerfThreadCounters() { close(); }
+
+    PerfThreadCounters(const PerfThreadCounters&) = delete;
+    PerfThreadCounters& operator=(const PerfThreadCounters&) = delete;
+
+    /// Open the group on the calling thread (idempotent)
+    /// @return false if the kernel refused any counter
+    bool open() noexcept {
+        if (state_ != State::Closed) return state_ == State::Open;
+#if NFX_PLATFORM_LINUX
+        static constexpr std::array<uint64_t, PERF_COUNTER_COUNT> CONFIGS{
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES,
+        };
+        for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = CONFIGS[i];
+            attr.disabled = i == 0 ? 1 : 0;     // Members follow the leader
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            const int group = i == 0 ? -1 : fds_[0];
+            fds_[i] = static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, group, 0));
+            if (fds_[i] < 0) {
+                close();
+                state_ = State::Failed;
+                return false;
+            }
+            void* page = ::mmap(nullptr, static_cast<size_t>(::sysconf(_SC_PAGESIZE)),
+                                PROT_READ, MAP_SHARED, fds_[i], 0);
+            pages_[i] = page == MAP_FAILED ? nullptr : static_cast<const perf_event_mmap_page*>(page);
+        }
+        ::ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ::ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        state_ = State::Open;
+        return true;
+#else
+        state_ = State::Failed;
+        return false;
+#endif
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return state_ == State::Open; }
+    [[nodiscard]] bool failed() const noexcept { return state_ == State::Failed; }
+
+    /// Current counter values (owner thread, group open)
+    [[nodiscard]] PerfReading read() const noexcept {
+        PerfReading values{};
+        for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i) values[i] = read_counter(i);
+        return values;
+    }
+
+    /// Add one scope's deltas to a stage (owner thread only)
+    void record(PerfStage stage, const PerfReading& begin, const PerfReading& end) noexcept {
+        Slots& s = stages_[static_cast<size_t>(stage)];
+        bump(s.samples, 1);
+        for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i) {
+            // A counter that went backwards was reset under us: skip it
+            if (end[i] >= begin[i]) bump(s.counters[i], end[i] - begin[i]);
+        }
+    }
+
+    /// Stage totals so far (any thread)
+    [[nodiscard]] PerfTotals totals(PerfStage stage) const noexcept {
+        const Slots& s = stages_[static_cast<size_t>(stage)];
+        return PerfTotals{
+            .samples = s.samples.load(std::memory_order_relaxed),
+            .cycles = s.counters[0].load(std::memory_order_relaxed),
+            .instructions = s.counters[1].load(std::memory_order_relaxed),
+            .cache_misses = s.counters[2].load(std::memory_order_relaxed),
+            .branch_misses = s.counters[3].load(std::memory_order_relaxed),
+        };
+    }
+
+    /// Countdown to the next sampled scope of a stage (owner thread only)
+    [[nodiscard]] uint32_t& countdown(PerfStage stage) noexcept {
+        return countdown_[static_cast<size_t>(stage)];
+    }
+
+private:
+    enum class State : uint8_t { Closed, Open, Failed };
+
+    struct Slots {
+        std::atomic<uint64_t> samples{0};
+        std::array<std::atomic<uint64_t>, PERF_COUNTER_COUNT> counters{};
+    };
+
+    /// Single-writer increment: relaxed load and store, no locked instruction
+    static void bump(std::atomic<uint64_t>& slot, uint64_t n) noexcept {
+        slot.store(slot.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+#if NFX_PLATFORM_LINUX
+    /// rdpmc through the event's mmap page (perf_event_open(2), "rdpmc");
+    /// read() when user-space reads are not available
+    [[nodiscard]] uint64_t read_counter(size_t i) const noexcept {
+#if NFX_ARCH_X64 || NFX_ARCH_X86
+        if (const perf_event_mmap_page* pc = pages_[i]) [[likely]] {
+            const volatile perf_event_mmap_page* page = pc;
+            uint32_t seq;
+            uint64_t count;
+            bool user = false;
+            do {
+                seq = page->lock;
+                std::atomic_signal_fence(std::memory_order_seq_cst);
+                const uint32_t index = page->index;
+                count = static_cast<uint64_t>(page->offset);
+                user = page->cap_user_rdpmc && index != 0;
+                if (user) {
+                    uint32_t lo, hi;
+                    asm volatile("rdpmc" : "=a"(lo), "=d"(hi) : "c"(index - 1));
+                    const unsigned shift = 64 - page->pmc_width;
+                    const int64_t pmc = static_cast<int64_t>(
+                        (static_cast<uint64_t>(hi) << 32 | lo) << shift) >> shift;
+                    count += static_cast<uint64_t>(pmc);
+                }
+                std::atomic_signal_fence(std::memory_order_seq_cst);
+            } while (page->lock != seq);
+            if (user) return count;
+        }
+#endif
+        uint64_t value = 0;
+        if (fds_[i] < 0 || ::read(fds_[i], &value, sizeof(value)) != sizeof(value)) return 0;
+        return value;
+    }
+
+    void close() noexcept {
+        const auto page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i) {
+            if (pages_[i]) ::munmap(const_cast<perf_event_mmap_page*>(pages_[i]), page_size);
+            if (fds_[i] >= 0) ::close(fds_[i]);
+            pages_[i] = nullptr;
+            fds_[i] = -1;
+        }
+        if (state_ == State::Open) state_ = State::Closed;
+    }
+
+    std::array<int, PERF_COUNTER_COUNT> fds_{-1, -1, -1, -1};
+    std::array<const perf_event_mmap_page*, PERF_COUNTER_COUNT> pages_{};
+#else
+    [[nodiscard]] uint64_t read_counter(size_t) const noexcept { return 0; }
+    void close() noexcept {}
+#endif
+
+    State state_{State::Closed};
+    std::array<uint32_t, PERF_STAGE_COUNT> countdown_{1, 1, 1};   // First scope samples
+    std::array<Slots, PERF_STAGE_COUNT> stages_{};
+};
+
+// ============================================================================
+// Counter Registry
+// ============================================================================
+
+/// Process-wide directory of the per-thread counter groups. Groups live
+/// until process exit, so a reader never races a thread's teardown.
+class PerfCounterRegistry {
+public:
+    static constexpr size_t MAX_THREADS = 64;
+    static constexpr uint32_t DEFAULT_SAMPLE_EVERY = 1024;
+
+    /// The calling thread's counters, created on first use (the group is
+    /// opened by the first sampled scope, or explicitly by open_local())
+    /// @return nullptr once MAX_THREADS threads have registered
+    [[nodiscard]] static PerfThreadCounters* local() noexcept {
+        thread_local PerfThreadCounters* counters = claim();
+        return counters;
+    }
+
+    /// Open the calling thread's group now, e.g. at worker start-up, so
+    /// the first sampled scope does not pay for the syscalls
+    static bool open_local() noexcept {
+        auto* counters = local();
+        return counters && open(*counters);
+    }
+
+    /// Sample one scope in n per stage and thread (0 stops sampling)
+    static void set_sample_every(uint32_t n) noexcept {
+        state().sample_every.store(n, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static uint32_t sample_every() noexcept {
+        return state().sample_every.load(std::memory_order_relaxed);
+    }
+
+    /// Registered thread count
+    [[nodiscard]] static size_t threads() noexcept {
+        return std::min(state().published.load(std::memory_order_acquire), MAX_THREADS);
+    }
+
+    /// Threads whose group the kernel refused
+    [[nodiscard]] static size_t open_failures() noexcept {
+        return state().open_failures.load(std::memory_order_relaxed);
+    }
+
+    /// One thread's stage totals (index < threads())
+    [[nodiscard]] static PerfTotals totals(size_t thread_index, PerfStage stage) noexcept {
+        if (thread_index >= threads()) return {};
+        return state().threads[thread_index]->totals(stage);
+    }
+
+    /// One stage summed over all threads
+    [[nodiscard]] static PerfTotals aggregate(PerfStage stage) noexcept {
+        PerfTotals total;
+        for (size_t i = 0, n = threads(); i < n; ++i) {
+            total.merge(state().threads[i]->totals(stage));
+        }
+        return total;
+    }
+
+    /// Open a thread's group, counting refusals (owner thread)
+    static bool open(PerfThreadCounters& counters) noexcept {
+        if (counters.is_open()) return true;
+        if (counters.failed()) return false;
+        if (counters.open()) return true;
+        state().open_failures.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+private:
+    struct State {
+        std::array<std::unique_ptr<PerfThreadCounters>, MAX_THREADS> threads;
+        std::atomic<size_t> claimed{0};
+        std::atomic<size_t> published{0};
+        std::atomic<size_t> open_failures{0};
+        std::atomic<uint32_t> sample_every{DEFAULT_SAMPLE_EVERY};
+    };
+
+    [[nodiscard]] static State& state() noexcept {
+        static State s;
+        return s;
+    }
+
+    [[nodiscard]] static PerfThreadCounters* claim() noexcept {
+        State& s = state();
+        const size_t index = s.claimed.fetch_add(1, std::memory_order_relaxed);
+        if (index >= MAX_THREADS) return nullptr;
+
+        s.threads[index] = std::make_unique<PerfThreadCounters>();
+        // Publish in claim order so readers only see constructed slots
+        size_t expected = index;
+        while (!s.published.compare_exchange_weak(expected, index + 1,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+            expected = index;
+        }
+        return s.threads[index].get();
+    }
+};
+
+// ============================================================================
+// Stage Scope
+// ============================================================================
+
+/// Samples the calling thread's counters over its lifetime, one scope in
+/// sample_every() per stage
+class PerfScope {
+public:
+    explicit PerfScope(PerfStage stage) noexcept : stage_{stage} {
+        auto* counters = PerfCounterRegistry::local();
+        if (!counters) [[unlikely]] return;
+        uint32_t& countdown = counters->countdown(stage);
+        if (--countdown != 0) [[likely]] return;
+
+        const uint32_t every = PerfCounterRegistry::sample_every();
+        countdown = every == 0 ? UINT32_MAX : every;
+        if (every == 0 || !PerfCounterRegistry::open(*counters)) return;
+        counters_ = counters;
+        begin_ = counters->read();
+    }
+
+    ~PerfScope() {
+        if (counters_) [[unlikely]] counters_->record(stage_, begin_, counters_->read());
+    }
+
+    PerfScope(const PerfScope&) = delete;
+    PerfScope& operator=(const PerfScope&) = delete;
+
+    [[nodiscard]] bool sampling() const noexcept { return counters_ != nullptr; }
+
+private:
+    PerfStage stage_;
+    PerfThreadCounters* counters_{nullptr};
+    PerfReading begin_{};
+};
+
+} // namespace nfx::util
+
+// ============================================================================
+// Scope Macro (compiled out unless NFX_HAS_PERF_COUNTERS)
+// ============================================================================
+
+#if NFX_PERF_COUNTERS
+    /// Sample hardware counters from here to the end of the enclosing block
+    #define NFX_PERF_SCOPE(stage) \
+        const ::nfx::util::PerfScope nfx_perf_scope_##stage{::nfx::util::PerfStage::stage}
+#else
+    #define NFX_PERF_SCOPE(stage) static_cast<void>(0)
+#endif
@@ -3,11 +3,12 @@
 
     Inspired by Quill logging library's approach:
     - Uses RDTSC for minimal latency (~10ns vs ~50ns for chrono)
-    - Periodic calibration to maintain accuracy
+    - Periodic calibration to maintain accuracy, published process-wide
+      (optionally by one service thread: RdtscClock::start_service())
     - Zero syscall on hot path
 
-    FIX Timestamp Format: YYYYMMDD-HH:MM:SS.mmm
-    Example: 20260122-14:30:45.123
+    FIX Timestamp Format: YYYYMMDD-HH:MM:SS.mmm[uuu[nnn]]
+    Example: 20260122-14:30:45.123 (ms), 20260122-14:30:45.123456789 (ns)
 */
 
 #pragma once
@@ -17,8 +18,18 @@
 #include <string_view>
 #include <chrono>
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/swar_decimal.hpp"
+#include "nexusfix/memory/seqlock.hpp"
+
 namespace nfx::util {
 
 // ============================================================================
@@ -45,49 +56,89 @@ inline void compiler_barrier() noexcept {
 // RDTSC Clock (calibrated)
 // ============================================================================
 
-/// High-performance clock using RDTSC with periodic calibration
+/// Process-wide clock using RDTSC, shared by every thread
+///
+/// Calibration (TSC base, wall-clock base and a fixed-point cycles-to-ns
+/// multiplier) is published through a Seqlock, so now_ns() costs an
+/// rdtscp, a seqlock read and a multiply/shift, and every thread converts
+/// with the same parameters. One writer recalibrates: the service thread
+/// started by start_service(), or otherwise whichever caller of
+/// calibrate() gets there first. The frequency is re-estimated over the
+/// whole span since the first calibration, so it sharpens over time.
+///
+/// Recalibration never steps time backward by a small amount: if the
+/// clock is ahead of the system clock by less than MAX_SLEW_NS it holds
+/// its current value as the new base. Larger steps (an NTP step, a
+/// suspended VM) are taken as is.
+///
+/// Cross-thread consistency relies on an invariant TSC (constant rate and
+/// synchronized across cores); has_invariant_tsc() reports it.
 class RdtscClock {
 public:
-    /// Initialize and calibrate the clock
-    /// Should be called once at startup
+    /// Fraction bits of Calibration::mult
+    static constexpr unsigned SHIFT = 32;
+
+    /// Largest backward correction absorbed instead of stepped
+    static constexpr uint64_t MAX_SLEW_NS = 1'000'000;
+
+    /// Conversion parameters: ns = base_ns + ((tsc - base_tsc) * mult) >> SHIFT
+    /// (all zero before the first calibration)
+    struct Calibration {
+        uint64_t base_tsc;
+        uint64_t base_ns;       // Nanoseconds since epoch at base_tsc
+        uint64_t mult;          // Nanoseconds per cycle << SHIFT
+    };
+
+    /// Calibrate unless already done; returns once the clock is usable
     static void initialize() noexcept {
-        calibrate();
+        while (calibration_.sequence() == 0) {
+            calibrate();
+            if (calibration_.sequence() == 0) std::this_thread::yield();
+        }
     }
 
     /// Get current nanoseconds since epoch (fast path)
     /// ~10ns latency, no syscall
     [[nodiscard]] static uint64_t now_ns() noexcept {
-        uint64_t tsc = detail::rdtscp();
-        uint64_t base_ns = base_ns_.load(std::memory_order_relaxed);
-        uint64_t base_tsc = base_tsc_.load(std::memory_order_relaxed);
-        double freq = freq_ghz_.load(std::memory_order_relaxed);
-
-        // Calculate nanoseconds from TSC delta
-        int64_t delta_tsc = static_cast<int64_t>(tsc - base_tsc);
-        int64_t delta_ns = static_cast<int64_t>(static_cast<double>(delta_tsc) / freq);
+        return to_ns(detail::rdtscp());
+    }
 
-        return base_ns + delta_ns;
+    /// Convert a TSC reading taken on any thread
+    [[nodiscard]] static uint64_t to_ns(uint64_t tsc) noexcept {
+        return convert(calibration_.read(), tsc);
     }
 
-    /// Recalibrate (call periodically, e.g., every second)
-    /// This syncs with system clock to prevent drift
+    /// Recalibrate against the system clock to prevent drift
+    /// A concurrent caller skips the round instead of waiting for it.
     static void calibrate() noexcept {
         using namespace std::chrono;
 
-        // Get system time and TSC together
-        auto sys_time = system_clock::now();
-        uint64_t tsc = detail::rdtscp();
-
-        // Convert to nanoseconds since epoch
-        auto ns = duration_cast<nanoseconds>(sys_time.time_since_epoch()).count();
-
-        base_ns_.store(static_cast<uint64_t>(ns), std::memory_order_relaxed);
-        base_tsc_.store(tsc, std::memory_order_relaxed);
+        if (calibrating_.exchange(true, std::memory_order_acquire)) return;
 
-        // Estimate frequency if not done yet
         if (freq_ghz_.load(std::memory_order_relaxed) == 0.0) {
             estimate_frequency();
         }
+
+        // Get system time and TSC together
+        const auto sys_time = system_clock::now();
+        const uint64_t tsc = detail::rdtscp();
+        const auto steady_ns = static_cast<uint64_t>(
+            duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+        const auto sys_ns = static_cast<uint64_t>(
+            duration_cast<nanoseconds>(sys_time.time_since_epoch()).count());
+
+        refine_frequency(tsc, steady_ns);
+
+        Calibration next{tsc, sys_ns, multiplier(freq_ghz_.load(std::memory_order_relaxed))};
+        if (calibration_.sequence() != 0) {
+            const uint64_t current = convert(calibration_.read(), tsc);
+            if (current > sys_ns && current - sys_ns < MAX_SLEW_NS) {
+                next.base_ns = current;
+            }
+        }
+        calibration_.write(next);
+
+        calibrating_.store(false, std::memory_order_release);
     }
 
     /// Get CPU frequency in GHz
@@ -95,7 +146,63 @@ public:
         return freq_ghz_.load(std::memory_order_relaxed);
     }
 
+    /// Current conversion parameters
+    [[nodiscard]] static Calibration calibration() noexcept {
+        return calibration_.read();
+    }
+
+    /// Check for an invariant TSC (CPUID 0x80000007 EDX bit 8)
+    [[nodiscard]] static bool has_invariant_tsc() noexcept {
+        static const bool invariant = detect_invariant_tsc();
+        return invariant;
+    }
+
+    // ========================================================================
+    // Calibration Service
+    // ========================================================================
+
+    /// Recalibrate from one background thread every interval; timestamp
+    /// generators stop recalibrating on their own while it runs
+    /// @return false if already running
+    static bool start_service(std::chrono::milliseconds interval = std::chrono::seconds{1}) noexcept {
+        std::lock_guard lock{service_.mutex};
+        if (service_.thread.joinable()) return false;
+
+        initialize();
+        service_.stop = false;
+        service_.thread = std::thread([interval] {
+            std::unique_lock guard{service_.mutex};
+            while (!service_.cv.wait_for(guard, interval, [] { return service_.stop; })) {
+                calibrate();
+            }
+        });
+        service_running_.store(true, std::memory_order_release);
+        return true;
+    }
+
+    /// Stop the service thread (also done at exit)
+    static void stop_service() noexcept {
+        service_.shutdown();
+    }
+
+    /// Check if the service thread owns recalibration
+    [[nodiscard]] static bool service_running() noexcept {
+        return service_running_.load(std::memory_order_acquire);
+    }
+
 private:
+    [[nodiscard]] static uint64_t convert(const Calibration& c, uint64_t tsc) noexcept {
+        // Signed: a TSC read just before the latest calibration is slightly behind it
+        const auto delta = static_cast<int64_t>(tsc - c.base_tsc);
+        __extension__ typedef __int128 i128;  // No -Wpedantic: a GCC/Clang extension
+        const auto scaled = static_cast<i128>(delta) * static_cast<i128>(c.mult);
+        return c.base_ns + static_cast<uint64_t>(static_cast<int64_t>(scaled >> SHIFT));
+    }
+
+    [[nodiscard]] static uint64_t multiplier(double ghz) noexcept {
+        return static_cast<uint64_t>(static_cast<double>(uint64_t{1} << SHIFT) / ghz + 0.5);
+    }
+
     static void estimate_frequency() noexcept {
         using namespace std::chrono;
 
@@ -115,10 +222,60 @@ private:
         freq_ghz_.store(cycles / elapsed_ns, std::memory_order_relaxed);
     }
 
-    // Calibration data (atomic for thread safety)
-    inline static std::atomic<uint64_t> base_ns_{0};
-    inline static std::atomic<uint64_t> base_tsc_{0};
+    /// Re-estimate the frequency over the span since the first calibration
+    /// (writer only)
+    static void refine_frequency(uint64_t tsc, uint64_t steady_ns) noexcept {
+        if (anchor_steady_ns_ == 0) {
+            anchor_tsc_ = tsc;
+            anchor_steady_ns_ = steady_ns;
+            return;
+        }
+        const uint64_t elapsed_ns = steady_ns - anchor_steady_ns_;
+        if (elapsed_ns < 1'000'000'000ULL) return;  // The 10ms estimate is better
+        freq_ghz_.store(static_cast<double>(tsc - anchor_tsc_) / static_cast<double>(elapsed_ns),
+                        std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static bool detect_invariant_tsc() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) return false;
+        return (edx & (1U << 8)) != 0;
+#else
+        return false;
+#endif
+    }
+
+    /// Background recalibration thread, joined at exit
+    struct Service {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::thread thread;
+        bool stop;              // Static storage: starts false
+
+        void shutdown() noexcept {
+            std::thread finished;
+            {
+                std::lock_guard lock{mutex};
+                if (!thread.joinable()) return;
+                stop = true;
+                finished = std::move(thread);
+            }
+            cv.notify_all();
+            finished.join();
+            service_running_.store(false, std::memory_order_release);
+        }
+
+        ~Service() { shutdown(); }
+    };
+
+    inline static memory::Seqlock<Calibration> calibration_;
     inline static std::atomic<double> freq_ghz_{0.0};
+    inline static std::atomic<bool> calibrating_{false};
+    inline static uint64_t anchor_tsc_{0};          // Writer only
+    inline static uint64_t anchor_steady_ns_{0};    // Writer only
+    inline static std::atomic<bool> service_running_{false};
+    inline static Service service_;
 };
 
 // ============================================================================
@@ -126,15 +283,20 @@ private:
 // ============================================================================
 
 /// High-performance FIX timestamp generator using RDTSC
-/// Hot path: ~10ns (no syscall)
+/// Hot path: ~10ns (no syscall), at any precision
 /// Calibration: ~200ns (periodic, once per second)
-class RdtscTimestamp {
+///
+/// The date and HH:MM:SS prefix are cached per second; the hot path only
+/// rewrites the 3/6/9 fraction digits (SWAR-formatted for us/ns).
+template <TimestampPrecision Precision>
+class BasicRdtscTimestamp {
 public:
-    static constexpr size_t TIMESTAMP_LEN = 21;  // "YYYYMMDD-HH:MM:SS.mmm"
+    static constexpr size_t FRACTION_DIGITS = static_cast<size_t>(Precision);
+    static constexpr size_t TIMESTAMP_LEN = 18 + FRACTION_DIGITS;  // "YYYYMMDD-HH:MM:SS." + digits
 
-    RdtscTimestamp() noexcept {
+    BasicRdtscTimestamp() noexcept {
         // Initialize buffer with template
-        std::memcpy(buffer_, "00000000-00:00:00.000", TIMESTAMP_LEN);
+        std::memcpy(buffer_, "00000000-00:00:00.000000000", TIMESTAMP_LEN);
         buffer_[TIMESTAMP_LEN] = '\0';
 
         // Force initial calibration
@@ -145,7 +307,7 @@ public:
     }
 
     /// Get current FIX-formatted timestamp
-    /// Fast path: ~10ns (milliseconds only, using RDTSC)
+    /// Fast path: ~10ns (fraction digits only, using RDTSC)
     /// Slow path: ~200ns (full date/time update + recalibration)
     [[nodiscard]] std::string_view get() noexcept {
         uint64_t now_ns = RdtscClock::now_ns();
@@ -156,23 +318,37 @@ public:
             update_full(now_ns);
             cached_second_ = now_sec;
 
-            // Recalibrate once per second to prevent drift
-            RdtscClock::calibrate();
+            // Recalibrate once per second to prevent drift, unless the
+            // service thread does it for everyone
+            if (!RdtscClock::service_running()) {
+                RdtscClock::calibrate();
+            }
         }
 
-        // Fast path: only update milliseconds
-        uint64_t ms = (now_ns % 1'000'000'000ULL) / 1'000'000ULL;
-        update_milliseconds(static_cast<int>(ms));
+        // Fast path: only update the fraction
+        update_fraction(static_cast<uint32_t>(now_ns % 1'000'000'000ULL));
 
         return {buffer_, TIMESTAMP_LEN};
     }
 
 private:
-    /// Update milliseconds only (fast path)
-    void update_milliseconds(int ms) noexcept {
-        buffer_[18] = '0' + static_cast<char>(ms / 100);
-        buffer_[19] = '0' + static_cast<char>((ms / 10) % 10);
-        buffer_[20] = '0' + static_cast<char>(ms % 10);
+    /// Update fraction digits only (fast path), positions 18+
+    void update_fraction(uint32_t ns) noexcept {
+        if constexpr (Precision == TimestampPrecision::Milliseconds) {
+            const uint32_t ms = ns / 1'000'000U;
+            buffer_[18] = '0' + static_cast<char>(ms / 100);
+            buffer_[19] = '0' + static_cast<char>((ms / 10) % 10);
+            buffer_[20] = '0' + static_cast<char>(ms % 10);
+        } else if constexpr (Precision == TimestampPrecision::Microseconds) {
+            // "00uuuuuu": drop the two leading zeros
+            const uint64_t digits = nfx::detail::swar_format_8(ns / 1'000U) >> 16;
+            std::memcpy(buffer_ + 18, &digits, 6);
+        } else {
+            // Leading digit, then the remaining eight in one word
+            buffer_[18] = '0' + static_cast<char>(ns / 100'000'000U);
+            const uint64_t digits = nfx::detail::swar_format_8(ns % 100'000'000U);
+            std::memcpy(buffer_ + 19, &digits, 8);
+        }
     }
 
     /// Update full timestamp (slow path)
@@ -240,6 +416,16 @@ private:
     uint64_t cached_second_;
 };
 
+/// Millisecond SendingTime (the FIX 4.2 / 4.4 default)
+using RdtscTimestamp = BasicRdtscTimestamp<TimestampPrecision::Milliseconds>;
+
+/// Microsecond SendingTime
+using RdtscTimestampUs = BasicRdtscTimestamp<TimestampPrecision::Microseconds>;
+
+/// Nanosecond SendingTime
+using RdtscTimestampNs = BasicRdtscTimestamp<TimestampPrecision::Nanoseconds>;
+
+
 // ============================================================================
 // Global Instance & Convenience Function
 // ============================================================================
@@ -0,0 +1,658 @@
+/*
+    NexusFIX Shared-Memory Metrics
+
+    Counters, gauges and histograms for sessions, stores and transports,
+    kept in a POSIX shared-memory segment so a monitoring process can read
+    them without calling into the engine:
+
+    - The engine creates a ShmMetricsRegistry and registers metrics (cold
+      path, typically at startup). Each registration appends a descriptor
+      (name, Prometheus labels, kind, value slots) and bumps the segment's
+      generation, so a scraper knows when to rescan.
+    - Handles (ShmCounter, ShmGauge, ShmHistogram) write their slots with
+      relaxed loads and stores only: no locked instructions, no fences. A
+      metric has a single writer, the thread that drives what it measures.
+    - ShmMetricsReader attaches from any process, reads every slot with
+      relaxed loads and never writes; write_prometheus() renders the text
+      exposition format (tools/metrics_exporter serves it over HTTP).
+
+    Values are read individually, so a scrape may see a histogram's buckets
+    one record apart from its count; each value on its own is exact.
+
+    Usage:
+        // Engine
+        auto metrics = ShmMetricsRegistry::create("engine");
+        SessionMetrics session_metrics{*metrics, "session=\"OMS1\""};
+        ...
+        session.on_timer_tick();
+        session_metrics.publish(session.stats());
+
+        // Monitoring process
+        auto reader = ShmMetricsReader::attach("engine");
+        std::string text;
+        write_prometheus(*reader, text);
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/session/state.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/transport/shm_transport.hpp"
+#include "nexusfix/util/perf_counters.hpp"
+
+namespace nfx::util {
+
+#if NFX_SHM_AVAILABLE
+
+// ============================================================================
+// Shared Layout
+// ============================================================================
+
+/// Metric kind, as exported to Prometheus
+enum class MetricKind : uint32_t {
+    Counter = 1,    // Monotonic uint64
+    Gauge = 2,      // int64, may go down
+    Histogram = 3   // Log2 buckets + sum + count
+};
+
+/// Segment size limits
+struct ShmMetricsConfig {
+    uint32_t max_metrics{1024};     // Descriptors
+    uint32_t max_slots{16384};      // 8-byte value slots shared by all metrics
+};
+
+namespace metrics_detail {
+
+inline constexpr uint64_t MAGIC = 0x4E46585F4D455431ULL;  // "NFX_MET1"
+inline constexpr uint32_t VERSION = 1;
+inline constexpr size_t NAME_SIZE = 64;
+inline constexpr size_t LABELS_SIZE = 96;
+
+/// Histogram bucket i counts values v with bit_width(v) == i (v < 2^i);
+/// the last bucket takes everything larger
+inline constexpr size_t HISTOGRAM_BUCKETS = 40;
+inline constexpr size_t HISTOGRAM_SLOTS = HISTOGRAM_BUCKETS + 2;   // + sum, count
+
+/// Control block at the start of the segment; descriptors, then value
+/// slots follow it
+struct alignas(memory::CACHE_LINE_SIZE) MetricsHeader {
+    uint64_t magic{MAGIC};
+    uint32_t version{VERSION};
+    uint32_t max_metrics{0};
+    uint32_t max_slots{0};
+    int32_t pid{0};
+    uint64_t created_ns{0};                     // system_clock, ns since epoch
+    std::atomic<uint32_t> count{0};             // Published descriptors
+    std::atomic<uint64_t> generation{0};        // Bumped by every registration
+};
+
+struct MetricDescriptor {
+    char name[NAME_SIZE];
+    char labels[LABELS_SIZE];   // Prometheus label list without braces
+    MetricKind kind;
+    uint32_t slot;              // First value slot
+};
+
+[[nodiscard]] constexpr size_t align_up(size_t n) noexcept {
+    return (n + memory::CACHE_LINE_SIZE - 1) & ~(memory::CACHE_LINE_SIZE - 1);
+}
+
+[[nodiscard]] constexpr size_t descriptors_offset() noexcept {
+    return align_up(sizeof(MetricsHeader));
+}
+
+[[nodiscard]] constexpr size_t slots_offset(uint32_t max_metrics) noexcept {
+    return align_up(descriptors_offset() + size_t{max_metrics} * sizeof(MetricDescriptor));
+}
+
+[[nodiscard]] constexpr size_t segment_size(const ShmMetricsConfig& config) noexcept {
+    return slots_offset(config.max_metrics) + size_t{config.max_slots} * sizeof(uint64_t);
+}
+
+/// Slots of metrics that could not be registered: writes land here and
+/// are never exported, so handles need no null check on the hot path
+inline std::array<std::atomic<uint64_t>, HISTOGRAM_SLOTS> discard_slots{};
+
+/// Single-writer increment: relaxed load and store, no locked instruction
+inline void bump(std::atomic<uint64_t>& slot, uint64_t n) noexcept {
+    slot.store(slot.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+} // namespace metrics_detail
+
+// ============================================================================
+// Handles (engine side, single writer per metric)
+// ============================================================================
+
+/// Monotonic counter
+class ShmCounter {
+public:
+    ShmCounter() noexcept : slot_{&metrics_detail::discard_slots[0]} {}
+    explicit ShmCounter(std::atomic<uint64_t>* slot) noexcept : slot_{slot} {}
+
+    void add(uint64_t n = 1) noexcept { metrics_detail::bump(*slot_, n); }
+
+    /// Mirror a total kept elsewhere (e.g. a SessionStats field)
+    void set(uint64_t total) noexcept { slot_->store(total, std::memory_order_relaxed); }
+
+    [[nodiscard]] uint64_t value() const noexcept { return slot_->load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t>* slot_;
+};
+
+/// Value that may go up and down
+class ShmGauge {
+public:
+    ShmGauge() noexcept : slot_{&metrics_detail::discard_slots[0]} {}
+    explicit ShmGauge(std::atomic<uint64_t>* slot) noexcept : slot_{slot} {}
+
+    void set(int64_t value) noexcept {
+        slot_->store(static_cast<uint64_t>(value), std::memory_order_relaxed);
+    }
+
+    void add(int64_t delta) noexcept { metrics_detail::bump(*slot_, static_cast<uint64_t>(delta)); }
+
+    [[nodiscard]] int64_t value() const noexcept {
+        return static_cast<int64_t>(slot_->load(std::memory_order_relaxed));
+    }
+
+private:
+    std::atomic<uint64_t>* slot_;
+};
+
+/// Log2-bucketed distribution (e.g. latencies in ns)
+class ShmHistogram {
+public:
+    static constexpr size_t BUCKETS = metrics_detail::HISTOGRAM_BUCKETS;
+
+    ShmHistogram() noexcept : slots_{metrics_detail::discard_slots.data()} {}
+    explicit ShmHistogram(std::atomic<uint64_t>* slots) noexcept : slots_{slots} {}
+
+    void record(uint64_t value) noexcept {
+        const size_t bucket = std::min<size_t>(static_cast<size_t>(std::bit_width(value)), BUCKETS - 1);
+        metrics_detail::bump(slots_[bucket], 1);
+        metrics_detail::bump(slots_[BUCKETS], value);       // Sum
+        metrics_detail::bump(slots_[BUCKETS + 1], 1);       // Count
+    }
+
+    /// Upper bound of bucket i (values < 2^i), Prometheus "le"
+    [[nodiscard]] static constexpr uint64_t upper_bound(size_t bucket) noexcept {
+        return bucket == 0 ? 0 : (uint64_t{1} << bucket) - 1;
+    }
+
+    [[nodiscard]] uint64_t count() const noexcept {
+        return slots_[BUCKETS + 1].load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t>* slots_;
+};
+
+// ============================================================================
+// Registry (engine side)
+// ============================================================================
+
+/// Owner of a metrics segment; the name is unlinked when it is destroyed
+class ShmMetricsRegistry {
+public:
+    ShmMetricsRegistry() noexcept = default;
+
+    ShmMetricsRegistry(ShmMetricsRegistry&& other) noexcept
+        : region_{std::move(other.region_)}
+        , header_{std::exchange(other.header_, nullptr)}
+        , next_slot_{other.next_slot_} {}
+
+    ShmMetricsRegistry& operator=(ShmMetricsRegistry&& other) noexcept {
+        if (this != &other) {
+            region_ = std::move(other.region_);
+            header_ = std::exchange(other.header_, nullptr);
+            next_slot_ = other.next_slot_;
+        }
+        return *this;
+    }
+
+    ShmMetricsRegistry(const ShmMetricsRegistry&) = delete;
+    ShmMetricsRegistry& operator=(const ShmMetricsRegistry&) = delete;
+
+    /// Create the segment "/nfx.<name>" (replacing a stale one)
+    [[nodiscard]] static TransportResult<ShmMetricsRegistry> create(
+        std::string_view name, const ShmMetricsConfig& config = {}) noexcept
+    {
+        if (config.max_metrics == 0 || config.max_slots == 0) {
+            return std::unexpected{TransportError{TransportErrorCode::NoBufferSpace}};
+        }
+        auto region = ShmRegion::create(name, metrics_detail::segment_size(config));
+        if (!region) return std::unexpected{region.error()};
+
+        ShmMetricsRegistry registry;
+        registry.region_ = std::move(*region);
+        auto* header = new (registry.region_.data()) metrics_detail::MetricsHeader{};
+        header->max_metrics = config.max_metrics;
+        header->max_slots = config.max_slots;
+        header->pid = static_cast<int32_t>(::getpid());
+        header->created_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+        registry.header_ = header;
+        return registry;
+    }
+
+    /// Register a counter; a full segment returns a handle that is never
+    /// exported
+    /// @param labels Prometheus labels without braces, e.g. session="OMS1"
+    [[nodiscard]] ShmCounter counter(std::string_view name, std::string_view labels = {}) noexcept {
+        auto* slots = add(name, labels, MetricKind::Counter, 1);
+        return slots ? ShmCounter{slots} : ShmCounter{};
+    }
+
+    [[nodiscard]] ShmGauge gauge(std::string_view name, std::string_view labels = {}) noexcept {
+        auto* slots = add(name, labels, MetricKind::Gauge, 1);
+        return slots ? ShmGauge{slots} : ShmGauge{};
+    }
+
+    [[nodiscard]] ShmHistogram histogram(std::string_view name, std::string_view labels = {}) noexcept {
+        auto* slots = add(name, labels, MetricKind::Histogram, metrics_detail::HISTOGRAM_SLOTS);
+        return slots ? ShmHistogram{slots} : ShmHistogram{};
+    }
+
+    /// Registered metrics
+    [[nodiscard]] size_t size() const noexcept {
+        return header_ ? header_->count.load(std::memory_order_relaxed) : 0;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept { return header_ != nullptr; }
+
+private:
+    [[nodiscard]] std::atomic<uint64_t>* add(std::string_view name, std::string_view labels,
+                                             MetricKind kind, uint32_t slots) noexcept {
+        if (!header_ || name.size() >= metrics_detail::NAME_SIZE ||
+            labels.size() >= metrics_detail::LABELS_SIZE) {
+            return nullptr;
+        }
+        std::lock_guard lock{mutex_};
+        const uint32_t index = header_->count.load(std::memory_order_relaxed);
+        if (index >= header_->max_metrics || header_->max_slots - next_slot_ < slots) {
+            return nullptr;
+        }
+
+        auto* base = static_cast<std::byte*>(region_.data());
+        auto* descriptor = reinterpret_cast<metrics_detail::MetricDescriptor*>(
+            base + metrics_detail::descriptors_offset()) + index;
+        std::memset(descriptor, 0, sizeof(*descriptor));
+        std::memcpy(descriptor->name, name.data(), name.size());
+        std::memcpy(descriptor->labels, labels.data(), labels.size());
+        descriptor->kind = kind;
+        descriptor->slot = next_slot_;
+
+        auto* values = reinterpret_cast<std::atomic<uint64_t>*>(
+            base + metrics_detail::slots_offset(header_->max_metrics)) + next_slot_;
+        next_slot_ += slots;
+
+        // Descriptor complete before readers can count it
+        header_->count.store(index + 1, std::memory_order_release);
+        header_->generation.fetch_add(1, std::memory_order_release);
+        return values;
+    }
+
+    ShmRegion region_;
+    metrics_detail::MetricsHeader* header_{nullptr};
+    uint32_t next_slot_{0};
+    std::mutex mutex_;      // Registration only
+};
+
+// ============================================================================
+// Reader (monitoring side)
+// ============================================================================
+
+/// One metric as read by ShmMetricsReader, valid during the callback
+struct MetricSample {
+    std::string_view name;
+    std::string_view labels;
+    MetricKind kind;
+    uint64_t value{0};                  // Counter; gauge as int64 bits
+    std::span<const uint64_t> buckets;  // Histogram: per-bucket counts
+    uint64_t sum{0};                    // Histogram
+    uint64_t count{0};                  // Histogram
+};
+
+/// Read-only view of a metrics segment from any process
+class ShmMetricsReader {
+public:
+    ShmMetricsReader() noexcept = default;
+
+    /// Map "/nfx.<name>" and check its layout
+    [[nodiscard]] static TransportResult<ShmMetricsReader> attach(std::string_view name) noexcept {
+        auto region = ShmRegion::open(name);
+        if (!region) return std::unexpected{region.error()};
+
+        const auto* header = static_cast<const metrics_detail::MetricsHeader*>(region->data());
+        if (region->size() < sizeof(metrics_detail::MetricsHeader) ||
+            header->magic != metrics_detail::MAGIC || header->version != metrics_detail::VERSION ||
+            region->size() < metrics_detail::segment_size({header->max_metrics, header->max_slots})) {
+            return std::unexpected{TransportError{TransportErrorCode::ConnectionRefused}};
+        }
+
+        ShmMetricsReader reader;
+        reader.region_ = std::move(*region);
+        reader.header_ = header;
+        return reader;
+    }
+
+    /// Changes whenever a metric is registered
+    [[nodiscard]] uint64_t generation() const noexcept {
+        return header_->generation.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return header_->count.load(std::memory_order_acquire);
+    }
+
+    /// Engine process id
+    [[nodiscard]] int32_t pid() const noexcept { return header_->pid; }
+
+    /// Call fn(const MetricSample&) for every registered metric
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        const auto* base = static_cast<const std::byte*>(region_.data());
+        const auto* descriptors = reinterpret_cast<const metrics_detail::MetricDescriptor*>(
+            base + metrics_detail::descriptors_offset());
+        const auto* slots = reinterpret_cast<const std::atomic<uint64_t>*>(
+            base + metrics_detail::slots_offset(header_->max_metrics));
+
+        std::array<uint64_t, ShmHistogram::BUCKETS> buckets{};
+        const size_t count = size();
+        for (size_t i = 0; i < count; ++i) {
+            const auto& d = descriptors[i];
+            MetricSample sample{
+                .name = {d.name, ::strnlen(d.name, metrics_detail::NAME_SIZE)},
+                .labels = {d.labels, ::strnlen(d.labels, metrics_detail::LABELS_SIZE)},
+                .kind = d.kind,
+                .buckets = {},
+            };
+            const auto* values = slots + d.slot;
+            if (d.kind == MetricKind::Histogram) {
+                for (size_t b = 0; b < buckets.size(); ++b) {
+                    buckets[b] = values[b].load(std::memory_order_relaxed);
+                }
+                sample.buckets = buckets;
+                sample.sum = values[ShmHistogram::BUCKETS].load(std::memory_order_relaxed);
+                sample.count = values[ShmHistogram::BUCKETS + 1].load(std::memory_order_relaxed);
+            } else {
+                sample.value = values[0].load(std::memory_order_relaxed);
+            }
+            fn(static_cast<const MetricSample&>(sample));
+        }
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept { return header_ != nullptr; }
+
+private:
+    ShmRegion region_;
+    const metrics_detail::MetricsHeader* header_{nullptr};
+};
+
+// ============================================================================
+// Prometheus Exposition
+// ============================================================================
+
+namespace metrics_detail {
+
+inline void append_number(std::string& out, uint64_t value) {
+    char buf[24];
+    const auto end = std::to_chars(buf, buf + sizeof(buf), value).ptr;
+    out.append(buf, end);
+}
+
+inline void append_number(std::string& out, int64_t value) {
+    char buf[24];
+    const auto end = std::to_chars(buf, buf + sizeof(buf), value).ptr;
+    out.append(buf, end);
+}
+
+/// name{labels[,extra]}
+inline void append_series(std::string& out, std::string_view name, std::string_view suffix,
+                          std::string_view labels, std::string_view extra = {}) {
+    out.append(name).append(suffix);
+    if (!labels.empty() || !extra.empty()) {
+        out.push_back('{');
+        out.append(labels);
+        if (!labels.empty() && !extra.empty()) out.push_back(',');
+        out.append(extra);
+        out.push_back('}');
+    }
+    out.push_back(' ');
+}
+
+} // namespace metrics_detail
+
+/// Append every metric in Prometheus text exposition format (0.0.4);
+/// the series of one metric name are grouped under a single TYPE line
+inline void write_prometheus(const ShmMetricsReader& reader, std::string& out) {
+    using namespace metrics_detail;
+
+    std::vector<std::string> names;
+    reader.for_each([&](const MetricSample& m) {
+        if (std::find(names.begin(), names.end(), m.name) == names.end()) {
+            names.emplace_back(m.name);
+        }
+    });
+
+    for (const std::string& name : names) {
+        bool typed = false;
+        reader.for_each([&](const MetricSample& m) {
+            if (m.name != name) return;
+            if (!typed) {
+                out.append("# TYPE ").append(m.name);
+                out.append(m.kind == MetricKind::Counter ? " counter\n"
+                         : m.kind == MetricKind::Gauge   ? " gauge\n"
+                                                         : " histogram\n");
+                typed = true;
+            }
+
+            if (m.kind == MetricKind::Counter) {
+                append_series(out, m.name, {}, m.labels);
+                append_number(out, m.value);
+            } else if (m.kind == MetricKind::Gauge) {
+                append_series(out, m.name, {}, m.labels);
+                append_number(out, static_cast<int64_t>(m.value));
+            } else {
+                uint64_t cumulative = 0;
+                std::string le;
+                for (size_t b = 0; b + 1 < m.buckets.size(); ++b) {
+                    cumulative += m.buckets[b];
+                    le.assign("le=\"");
+                    append_number(le, ShmHistogram::upper_bound(b));
+                    le.push_back('"');
+                    append_series(out, m.name, "_bucket", m.labels, le);
+                    append_number(out, cumulative);
+                    out.push_back('\n');
+                }
+                append_series(out, m.name, "_bucket", m.labels, "le=\"+Inf\"");
+                append_number(out, m.count);
+                out.push_back('\n');
+                append_series(out, m.name, "_sum", m.labels);
+                append_number(out, m.sum);
+                out.push_back('\n');
+                append_series(out, m.name, "_count", m.labels);
+                append_number(out, m.count);
+            }
+            out.push_back('\n');
+        });
+    }
+}
+
+// ============================================================================
+// Component Bindings
+// ============================================================================
+
+/// SessionStats mirrored into a metrics segment; publish() from the thread
+/// driving the session (e.g. after on_timer_tick())
+class SessionMetrics {
+public:
+    /// @param labels Prometheus labels identifying the session, e.g.
+    ///        session="OMS1"
+    SessionMetrics(ShmMetricsRegistry& registry, std::string_view labels) noexcept
+        : messages_sent_{registry.counter("nfx_session_messages_sent_total", labels)}
+        , messages_received_{registry.counter("nfx_session_messages_received_total", labels)}
+        , bytes_sent_{registry.counter("nfx_session_bytes_sent_total", labels)}
+        , bytes_received_{registry.counter("nfx_session_bytes_received_total", labels)}
+        , heartbeats_sent_{registry.counter("nfx_session_heartbeats_sent_total", labels)}
+        , heartbeats_received_{registry.counter("nfx_session_heartbeats_received_total", labels)}
+        , resend_requests_sent_{registry.counter("nfx_session_resend_requests_sent_total", labels)}
+        , sequence_resets_{registry.counter("nfx_session_sequence_resets_total", labels)}
+        , reconnects_{registry.counter("nfx_session_reconnects_total", labels)}
+        , risk_rejects_{registry.counter("nfx_session_risk_rejects_total", labels)}
+        , messages_throttled_{registry.counter("nfx_session_messages_throttled_total", labels)}
+        , bytes_discarded_{registry.counter("nfx_session_bytes_discarded_total", labels)}
+        , latency_{registry.histogram("nfx_session_latency_ns", labels)} {}
+
+    /// Copy the session's counters (relaxed stores, no locks)
+    void publish(const SessionStats& stats) noexcept {
+        messages_sent_.set(stats.messages_sent);
+        messages_received_.set(stats.messages_received);
+        bytes_sent_.set(stats.bytes_sent);
+        bytes_received_.set(stats.bytes_received);
+        heartbeats_sent_.set(stats.heartbeats_sent);
+        heartbeats_received_.set(stats.heartbeats_received);
+        resend_requests_sent_.set(stats.resend_requests_sent);
+        sequence_resets_.set(stats.sequence_resets);
+        reconnects_.set(stats.reconnect_count);
+        risk_rejects_.set(stats.risk_rejects);
+        messages_throttled_.set(stats.messages_throttled);
+        bytes_discarded_.set(stats.bytes_discarded);
+    }
+
+    /// Application-defined latency (e.g. tick-to-order), in ns
+    void record_latency(uint64_t ns) noexcept { latency_.record(ns); }
+
+private:
+    ShmCounter messages_sent_;
+    ShmCounter messages_received_;
+    ShmCounter bytes_sent_;
+    ShmCounter bytes_received_;
+    ShmCounter heartbeats_sent_;
+    ShmCounter heartbeats_received_;
+    ShmCounter resend_requests_sent_;
+    ShmCounter sequence_resets_;
+    ShmCounter reconnects_;
+    ShmCounter risk_rejects_;
+    ShmCounter messages_throttled_;
+    ShmCounter bytes_discarded_;
+    ShmHistogram latency_;
+};
+
+/// MemoryMessageStore::PoolMetrics mirrored into a metrics segment
+class StoreMetrics {
+public:
+    StoreMetrics(ShmMetricsRegistry& registry, std::string_view labels) noexcept
+        : capacity_{registry.gauge("nfx_store_pool_capacity_bytes", labels)}
+        , allocated_{registry.gauge("nfx_store_pool_allocated_bytes", labels)}
+        , peak_{registry.gauge("nfx_store_pool_peak_bytes", labels)}
+        , resets_{registry.counter("nfx_store_resets_total", labels)} {}
+
+    void publish(const store::MemoryMessageStore::PoolMetrics& metrics) noexcept {
+        capacity_.set(static_cast<int64_t>(metrics.pool_capacity));
+        allocated_.set(static_cast<int64_t>(metrics.bytes_allocated));
+        peak_.set(static_cast<int64_t>(metrics.peak_usage));
+        resets_.set(metrics.reset_count);
+    }
+
+private:
+    ShmGauge capacity_;
+    ShmGauge allocated_;
+    ShmGauge peak_;
+    ShmCounter resets_;
+};
+
+/// Transport traffic, counted by whoever calls send()/receive()
+class TransportMetrics {
+public:
+    TransportMetrics(ShmMetricsRegistry& registry, std::string_view labels) noexcept
+        : bytes_sent_{registry.counter("nfx_transport_bytes_sent_total", labels)}
+        , bytes_received_{registry.counter("nfx_transport_bytes_received_total", labels)}
+        , errors_{registry.counter("nfx_transport_errors_total", labels)}
+        , send_latency_{registry.histogram("nfx_transport_send_latency_ns", labels)} {}
+
+    void on_send(size_t bytes) noexcept { bytes_sent_.add(bytes); }
+    void on_receive(size_t bytes) noexcept { bytes_received_.add(bytes); }
+    void on_error() noexcept { errors_.add(); }
+    void record_send_latency(uint64_t ns) noexcept { send_latency_.record(ns); }
+
+private:
+    ShmCounter bytes_sent_;
+    ShmCounter bytes_received_;
+    ShmCounter errors_;
+    ShmHistogram send_latency_;
+};
+
+/// PerfCounterRegistry stage totals (all threads) mirrored into a metrics
+/// segment, one series per stage; publish() from the monitoring thread
+class PerfMetrics {
+public:
+    /// @param labels Extra Prometheus labels, e.g. engine="oms"; each
+    ///        series also gets stage="parse" etc.
+    PerfMetrics(ShmMetricsRegistry& registry, std::string_view labels = {}) {
+        std::string stage_labels;
+        for (size_t i = 0; i < PERF_STAGE_COUNT; ++i) {
+            stage_labels.assign("stage=\"");
+            stage_labels.append(perf_stage_name(static_cast<PerfStage>(i)));
+            stage_labels.push_back('"');
+            if (!labels.empty()) stage_labels.append(",").append(labels);
+
+            Stage& s = stages_[i];
+            s.samples = registry.counter("nfx_perf_samples_total", stage_labels);
+            s.cycles = registry.counter("nfx_perf_cycles_total", stage_labels);
+            s.instructions = registry.counter("nfx_perf_instructions_total", stage_labels);
+            s.cache_misses = registry.counter("nfx_perf_cache_misses_total", stage_labels);
+            s.branch_misses = registry.counter("nfx_perf_branch_misses_total", stage_labels);
+        }
+        open_failures_ = registry.gauge("nfx_perf_open_failures", labels);
+    }
+
+    void publish() noexcept {
+        for (size_t i = 0; i < PERF_STAGE_COUNT; ++i) {
+            const PerfTotals totals = PerfCounterRegistry::aggregate(static_cast<PerfStage>(i));
+            Stage& s = stages_[i];
+            s.samples.set(totals.samples);
+            s.cycles.set(totals.cycles);
+            s.instructions.set(totals.instructions);
+            s.cache_misses.set(totals.cache_misses);
+            s.branch_misses.set(totals.branch_misses);
+        }
+        open_failures_.set(static_cast<int64_t>(PerfCounterRegistry::open_failures()));
+    }
+
+private:
+    struct Stage {
+        ShmCounter samples;
+        ShmCounter cycles;
+        ShmCounter instructions;
+        ShmCounter cache_misses;
+        ShmCounter branch_misses;
+    };
+
+    std::array<Stage, PERF_STAGE_COUNT> stages_;
+    ShmGauge open_failures_;
+};
+
+#endif  // NFX_SHM_AVAILABLE
+
+} // namespace nfx::util
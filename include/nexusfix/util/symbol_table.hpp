@@ -0,0 +1,227 @@
+/*
+    NexusFIX Symbol Interning
+
+    Maps Symbol (55) strings to dense integer SymbolIds once, so books,
+    positions and per-instrument state can be plain arrays indexed by id
+    instead of string-keyed hash maps probed on every entry.
+
+    Keys are up to 32 bytes, stored zero-padded in 32-byte aligned slots and
+    compared in one AVX2 (two SSE2) compare. The open-addressing index keeps
+    a 32-bit hash beside each id so most probe misses never touch a key.
+
+    Usage:
+        inline constexpr std::array<std::string_view, 3> SEED{"AAPL", "MSFT", "GOOGL"};
+        inline constexpr SymbolId AAPL = util::seeded_symbol_id(SEED, "AAPL");  // {0}
+
+        util::SymbolTable symbols{SEED};           // Seed ids 0..N-1, in order
+        SymbolId id = symbols.intern("TSLA");      // {3}: next dense id
+        SymbolId same = msg.get_symbol_id(symbols); // Lookup only, no insert
+
+    Single-threaded: intern() and find() run on the thread that owns the
+    table (typically the session thread). Large: allocate it once.
+*/
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    #include <immintrin.h>
+#endif
+
+#include "nexusfix/platform/platform.hpp"
+
+namespace nfx {
+
+// ============================================================================
+// Symbol Id
+// ============================================================================
+
+/// Dense id of an interned symbol: 0, 1, 2, ... in order of first intern
+struct SymbolId {
+    static constexpr uint32_t INVALID = 0xFFFFFFFFu;
+
+    uint32_t value{INVALID};
+
+    [[nodiscard]] constexpr bool valid() const noexcept { return value != INVALID; }
+
+    constexpr bool operator==(const SymbolId&) const noexcept = default;
+};
+
+} // namespace nfx
+
+namespace nfx::util {
+
+// ============================================================================
+// Compile-time Seed Lookup
+// ============================================================================
+
+/// Id a symbol receives when `seed` pre-populates a table (its position);
+/// invalid if absent, so `static_assert(seeded_symbol_id(SEED, "X").valid())`
+/// catches a typo at compile time
+template <size_t N>
+[[nodiscard]] consteval SymbolId seeded_symbol_id(const std::array<std::string_view, N>& seed,
+                                                  std::string_view symbol) noexcept {
+    for (size_t i = 0; i < N; ++i) {
+        if (seed[i] == symbol) return SymbolId{static_cast<uint32_t>(i)};
+    }
+    return SymbolId{};
+}
+
+// ============================================================================
+// Symbol Table
+// ============================================================================
+
+/// Fixed-capacity symbol interner with dense ids
+/// @tparam MaxSymbols Maximum distinct symbols (ids are < MaxSymbols)
+template <size_t MaxSymbols = 1024>
+class BasicSymbolTable {
+public:
+    static constexpr size_t MAX_SYMBOL_LEN = 32;
+    static constexpr size_t CAPACITY = MaxSymbols;
+
+    static_assert(MaxSymbols > 0 && MaxSymbols < SymbolId::INVALID, "Bad symbol capacity");
+
+    BasicSymbolTable() noexcept = default;
+
+    /// Pre-intern `seed` so seed[i] gets SymbolId{i} (see seeded_symbol_id)
+    template <size_t N>
+    explicit BasicSymbolTable(const std::array<std::string_view, N>& seed) noexcept {
+        static_assert(N <= MaxSymbols, "Seed list exceeds table capacity");
+        for (std::string_view symbol : seed) {
+            (void)intern(symbol);
+        }
+    }
+
+    BasicSymbolTable(const BasicSymbolTable&) = delete;
+    BasicSymbolTable& operator=(const BasicSymbolTable&) = delete;
+
+    /// Id of `symbol`, assigning the next dense id on first sight
+    /// @return Invalid if empty, longer than MAX_SYMBOL_LEN, or the table is full
+    [[nodiscard]] NFX_HOT SymbolId intern(std::string_view symbol) noexcept {
+        if (symbol.empty() || symbol.size() > MAX_SYMBOL_LEN) [[unlikely]] return SymbolId{};
+
+        const Key key = make_key(symbol);
+        const uint32_t hash = hash_key(key, symbol.size());
+        size_t slot = hash & (INDEX_SIZE - 1);
+        for (;;) {
+            const Slot& s = index_[slot];
+            if (s.id_plus_1 == 0) break;
+            if (s.hash == hash && matches(s.id_plus_1 - 1, key, symbol.size())) {
+                return SymbolId{s.id_plus_1 - 1};
+            }
+            slot = (slot + 1) & (INDEX_SIZE - 1);
+        }
+
+        if (count_ == MaxSymbols) [[unlikely]] return SymbolId{};
+        const auto id = static_cast<uint32_t>(count_++);
+        keys_[id] = key;
+        lengths_[id] = static_cast<uint8_t>(symbol.size());
+        index_[slot] = Slot{hash, id + 1};
+        return SymbolId{id};
+    }
+
+    /// Id of an already interned symbol; invalid if unknown
+    [[nodiscard]] NFX_HOT SymbolId find(std::string_view symbol) const noexcept {
+        if (symbol.empty() || symbol.size() > MAX_SYMBOL_LEN) [[unlikely]] return SymbolId{};
+
+        const Key key = make_key(symbol);
+        const uint32_t hash = hash_key(key, symbol.size());
+        size_t slot = hash & (INDEX_SIZE - 1);
+        for (;;) {
+            const Slot& s = index_[slot];
+            if (s.id_plus_1 == 0) return SymbolId{};
+            if (s.hash == hash && matches(s.id_plus_1 - 1, key, symbol.size())) {
+                return SymbolId{s.id_plus_1 - 1};
+            }
+            slot = (slot + 1) & (INDEX_SIZE - 1);
+        }
+    }
+
+    /// Request the index slot find()/intern() of `symbol` will probe first
+    /// (pipelined dispatch: issue for message N+1 while N is handled)
+    NFX_HOT void prefetch(std::string_view symbol) const noexcept {
+        if (symbol.empty() || symbol.size() > MAX_SYMBOL_LEN) [[unlikely]] return;
+        const uint32_t hash = hash_key(make_key(symbol), symbol.size());
+        __builtin_prefetch(&index_[hash & (INDEX_SIZE - 1)], 0, 3);
+    }
+
+    /// Symbol text of an id (empty if not interned)
+    [[nodiscard]] std::string_view name(SymbolId id) const noexcept {
+        if (id.value >= count_) [[unlikely]] return {};
+        return {keys_[id.value].bytes.data(), lengths_[id.value]};
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return MaxSymbols; }
+
+private:
+    // Load factor <= 0.5, so a probe run always ends at an empty slot
+    static constexpr size_t INDEX_SIZE = std::bit_ceil(MaxSymbols * 2);
+
+    struct alignas(32) Key {
+        std::array<char, MAX_SYMBOL_LEN> bytes;
+    };
+
+    struct Slot {
+        uint32_t hash{0};
+        uint32_t id_plus_1{0};  // 0 = empty
+    };
+
+    [[nodiscard]] static Key make_key(std::string_view symbol) noexcept {
+        Key key{};
+        std::memcpy(key.bytes.data(), symbol.data(), symbol.size());
+        return key;
+    }
+
+    /// Word-wise multiply-xor over the padded key (4 multiplies regardless
+    /// of length, vs one per byte for FNV-1a)
+    [[nodiscard]] static uint32_t hash_key(const Key& key, size_t len) noexcept {
+        uint64_t w[4];
+        std::memcpy(w, key.bytes.data(), sizeof(w));
+        uint64_t h = (w[0] * 0x9E3779B97F4A7C15ULL) ^ (w[1] * 0xC2B2AE3D27D4EB4FULL) ^
+                     (w[2] * 0x165667B19E3779F9ULL) ^ (w[3] * 0xD6E8FEB86659FD93ULL) ^ len;
+        h ^= h >> 32;
+        h *= 0x9E3779B97F4A7C15ULL;
+        return static_cast<uint32_t>(h >> 32);
+    }
+
+    [[nodiscard]] bool matches(uint32_t id, const Key& key, size_t len) const noexcept {
+        return lengths_[id] == len && keys_equal(keys_[id], key);
+    }
+
+    [[nodiscard]] static bool keys_equal(const Key& a, const Key& b) noexcept {
+#if defined(__AVX2__)
+        const __m256i va = _mm256_load_si256(reinterpret_cast<const __m256i*>(a.bytes.data()));
+        const __m256i vb = _mm256_load_si256(reinterpret_cast<const __m256i*>(b.bytes.data()));
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)) == -1;
+#elif defined(__SSE2__)
+        const auto* pa = reinterpret_cast<const __m128i*>(a.bytes.data());
+        const auto* pb = reinterpret_cast<const __m128i*>(b.bytes.data());
+        const __m128i eq = _mm_and_si128(
+            _mm_cmpeq_epi8(_mm_load_si128(pa), _mm_load_si128(pb)),
+            _mm_cmpeq_epi8(_mm_load_si128(pa + 1), _mm_load_si128(pb + 1)));
+        return _mm_movemask_epi8(eq) == 0xFFFF;
+#else
+        uint64_t wa[4], wb[4];
+        std::memcpy(wa, a.bytes.data(), sizeof(wa));
+        std::memcpy(wb, b.bytes.data(), sizeof(wb));
+        return ((wa[0] ^ wb[0]) | (wa[1] ^ wb[1]) | (wa[2] ^ wb[2]) | (wa[3] ^ wb[3])) == 0;
+#endif
+    }
+
+    std::array<Slot, INDEX_SIZE> index_{};
+    std::array<Key, MaxSymbols> keys_{};
+    std::array<uint8_t, MaxSymbols> lengths_{};
+    size_t count_{0};
+};
+
+/// Default interner: up to 1024 symbols
+using SymbolTable = BasicSymbolTable<>;
+
+} // namespace nfx::util
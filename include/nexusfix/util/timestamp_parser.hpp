@@ -0,0 +1,81 @@
+/*
+    NexusFIX UTCTimestamp Parser with Cached Date
+
+    Counterpart of FastTimestamp for the receive side:
+    - SendingTime (52) / TransactTime (60) arrive on every message and
+      nearly always share the current trading day
+    - The "YYYYMMDD" block is compared as one 8-byte word against the last
+      date seen; on a hit the epoch-day conversion is skipped entirely
+    - Time of day and fraction are decoded with SWAR (fixed offsets)
+    - Anything unusual falls back to Timestamp::from_utc_string()
+
+    Fast path: load + compare date word, SWAR time of day (~few ns)
+    Slow path: date changed, validate and convert date (once per day)
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+#include "nexusfix/types/field_types.hpp"
+#include "nexusfix/types/swar_decimal.hpp"
+
+namespace nfx::util {
+
+class TimestampParser {
+public:
+    TimestampParser() noexcept = default;
+
+    /// Parse FIX UTCTimestamp "YYYYMMDD-HH:MM:SS[.sss[sss[sss]]]"
+    /// Same results as Timestamp::from_utc_string().
+    /// @return nullopt on malformed text
+    [[nodiscard]] std::optional<Timestamp> parse(std::string_view sv) noexcept {
+        if (sv.size() < 17 || sv.size() > Timestamp::MAX_CHARS) [[unlikely]] {
+            return Timestamp::from_utc_string(sv);
+        }
+
+        int64_t tod;
+        if (!nfx::detail::swar_utc_time_of_day(sv, tod)) [[unlikely]] {
+            return Timestamp::from_utc_string(sv);
+        }
+
+        uint64_t date;
+        std::memcpy(&date, sv.data(), 8);
+
+        // Slow path: new date, validate and convert
+        if (date != cached_date_) [[unlikely]] {
+            int64_t year, month, day;
+            if (!nfx::detail::swar_utc_date(date, year, month, day)) [[unlikely]] {
+                return std::nullopt;
+            }
+            cached_date_ = date;
+            cached_day_nanos_ = Timestamp::days_from_civil(year, month, day) *
+                                Timestamp::NANOS_PER_DAY;
+        }
+
+        return Timestamp{cached_day_nanos_ + tod};
+    }
+
+    /// Forget the cached date (e.g. after a session reset)
+    void reset() noexcept {
+        cached_date_ = 0;
+        cached_day_nanos_ = 0;
+    }
+
+private:
+    uint64_t cached_date_{0};      // Raw "YYYYMMDD" bytes; 0 never matches text
+    int64_t cached_day_nanos_{0};  // Midnight of cached_date_, ns since epoch
+};
+
+// Global instance for convenience (thread-local for thread safety)
+inline thread_local TimestampParser g_timestamp_parser;
+
+// Convenience function
+[[nodiscard]] inline std::optional<Timestamp> parse_timestamp(std::string_view sv) noexcept {
+    return g_timestamp_parser.parse(sv);
+}
+
+} // namespace nfx::util
@@ -1,14 +1,16 @@
 #!/bin/bash
 # check_perf_regression.sh - Performance regression gate
-# TICKET_228 Phase 3: Compares parse_benchmark --json output against baselines.json thresholds.
-# Exits non-zero if any benchmark exceeds its absolute threshold.
+# TICKET_228 Phase 3: Compares benchmark --json output against baselines.json thresholds.
+# Each baseline names its binary in "benchmark" (default: parse_benchmark); every
+# referenced binary is run once. Exits non-zero if any benchmark exceeds its
+# absolute threshold (p50_max_ns, p99_max_ns and, when present, p999_max_ns).
 
 set -e
 
 SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
 PROJECT_DIR="$(dirname "${SCRIPT_DIR}")"
 BUILD_DIR="${PROJECT_DIR}/build"
-BENCHMARK_BIN="${BUILD_DIR}/bin/benchmarks/parse_benchmark"
+BENCHMARK_DIR="${BUILD_DIR}/bin/benchmarks"
 BASELINES="${PROJECT_DIR}/benchmarks/baselines.json"
 ITERATIONS="${1:-10000}"
 
@@ -27,33 +29,45 @@ if [ ! -f "${BASELINES}" ]; then
     exit 1
 fi
 
-# Build parse_benchmark if not found
-if [ ! -x "${BENCHMARK_BIN}" ]; then
-    echo -e "${YELLOW}[WARN]${NC} parse_benchmark not found, building..."
-    cmake --build "${BUILD_DIR}" --target parse_benchmark -j"$(nproc 2>/dev/null || echo 4)"
-fi
+BENCHMARKS=$(jq -r '[.baselines[] | .benchmark // "parse_benchmark"] | unique | .[]' "${BASELINES}")
+RESULT_DIR=$(mktemp -d)
+trap 'rm -rf "${RESULT_DIR}"' EXIT
 
-echo "Running parse_benchmark (${ITERATIONS} iterations, JSON mode)..."
-RESULTS=$("${BENCHMARK_BIN}" "${ITERATIONS}" --json)
+for BENCH in ${BENCHMARKS}; do
+    BENCHMARK_BIN="${BENCHMARK_DIR}/${BENCH}"
 
-if ! echo "${RESULTS}" | jq . >/dev/null 2>&1; then
-    echo -e "${RED}[ERROR]${NC} parse_benchmark --json produced invalid JSON"
-    echo "${RESULTS}"
-    exit 1
-fi
+    # Build the benchmark if not found
+    if [ ! -x "${BENCHMARK_BIN}" ]; then
+        echo -e "${YELLOW}[WARN]${NC} ${BENCH} not found, building..."
+        cmake --build "${BUILD_DIR}" --target "${BENCH}" -j"$(nproc 2>/dev/null || echo 4)"
+    fi
+
+    echo "Running ${BENCH} (${ITERATIONS} iterations, JSON mode)..."
+    "${BENCHMARK_BIN}" "${ITERATIONS}" --json > "${RESULT_DIR}/${BENCH}.json"
+
+    if ! jq . "${RESULT_DIR}/${BENCH}.json" >/dev/null 2>&1; then
+        echo -e "${RED}[ERROR]${NC} ${BENCH} --json produced invalid JSON"
+        cat "${RESULT_DIR}/${BENCH}.json"
+        exit 1
+    fi
+done
 
 FAILURES=0
 CHECKED=0
 BASELINE_COUNT=$(jq '.baselines | length' "${BASELINES}")
 
 for i in $(seq 0 $((BASELINE_COUNT - 1))); do
+    BENCH=$(jq -r ".baselines[$i].benchmark // \"parse_benchmark\"" "${BASELINES}")
     NAME=$(jq -r ".baselines[$i].name" "${BASELINES}")
     P50_MAX=$(jq ".baselines[$i].p50_max_ns" "${BASELINES}")
     P99_MAX=$(jq ".baselines[$i].p99_max_ns" "${BASELINES}")
+    P999_MAX=$(jq ".baselines[$i].p999_max_ns" "${BASELINES}")
+    RESULTS="${RESULT_DIR}/${BENCH}.json"
 
     # Find matching benchmark in results
-    P50_ACTUAL=$(echo "${RESULTS}" | jq -r ".benchmarks[] | select(.name == \"${NAME}\") | .p50_ns")
-    P99_ACTUAL=$(echo "${RESULTS}" | jq -r ".benchmarks[] | select(.name == \"${NAME}\") | .p99_ns")
+    P50_ACTUAL=$(jq -r ".benchmarks[] | select(.name == \"${NAME}\") | .p50_ns" "${RESULTS}")
+    P99_ACTUAL=$(jq -r ".benchmarks[] | select(.name == \"${NAME}\") | .p99_ns" "${RESULTS}")
+    P999_ACTUAL=$(jq -r ".benchmarks[] | select(.name == \"${NAME}\") | .p999_ns" "${RESULTS}")
 
     if [ -z "${P50_ACTUAL}" ] || [ "${P50_ACTUAL}" = "null" ]; then
         echo -e "${YELLOW}[SKIP]${NC} ${NAME} - not found in benchmark results"
@@ -65,8 +79,12 @@ for i in $(seq 0 $((BASELINE_COUNT - 1))); do
     # Compare using awk for floating point
     P50_FAIL=$(awk "BEGIN { print (${P50_ACTUAL} > ${P50_MAX}) ? 1 : 0 }")
     P99_FAIL=$(awk "BEGIN { print (${P99_ACTUAL} > ${P99_MAX}) ? 1 : 0 }")
+    P999_FAIL=0
+    if [ "${P999_MAX}" != "null" ]; then
+        P999_FAIL=$(awk "BEGIN { print (${P999_ACTUAL} > ${P999_MAX}) ? 1 : 0 }")
+    fi
 
-    if [ "${P50_FAIL}" -eq 1 ] || [ "${P99_FAIL}" -eq 1 ]; then
+    if [ "${P50_FAIL}" -eq 1 ] || [ "${P99_FAIL}" -eq 1 ] || [ "${P999_FAIL}" -eq 1 ]; then
         echo -e "${RED}[FAIL]${NC} ${NAME}"
         if [ "${P50_FAIL}" -eq 1 ]; then
             echo "        P50: ${P50_ACTUAL} ns > ${P50_MAX} ns (threshold)"
@@ -74,6 +92,9 @@ for i in $(seq 0 $((BASELINE_COUNT - 1))); do
         if [ "${P99_FAIL}" -eq 1 ]; then
             echo "        P99: ${P99_ACTUAL} ns > ${P99_MAX} ns (threshold)"
         fi
+        if [ "${P999_FAIL}" -eq 1 ]; then
+            echo "        P99.9: ${P999_ACTUAL} ns > ${P999_MAX} ns (threshold)"
+        fi
         FAILURES=$((FAILURES + 1))
     else
         echo -e "${GREEN}[PASS]${NC} ${NAME}  P50=${P50_ACTUAL}ns/<${P50_MAX}  P99=${P99_ACTUAL}ns/<${P99_MAX}"
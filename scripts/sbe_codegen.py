@@ -0,0 +1,1045 @@
+#!/usr/bin/env python3
+"""sbe_codegen.py - Generate NexusFIX SBE flyweight codecs from an SBE XML schema.
+
+Emits header-only codecs in the style of include/nexusfix/sbe/codecs/:
+constexpr Offset/Size structs, wrapForDecode()/isValid()/accessors,
+wrapForEncode()/encodeHeader()/fluent encoders, static_assert layout
+checks, is_sbe_codec specializations and a per-schema dispatch().
+
+Supported (SBE 1.0 subset used by exchange order entry / market data):
+  - <type> primitives, fixed-length char arrays, constant / optional presence
+  - <enum>, <set>, <composite> (nested composites and <ref>)
+  - <field> with explicit or implicit offsets, valueRef constants
+  - one level of <group> per message, any number of groups in sequence
+  - standard 8-byte messageHeader, littleEndian byte order
+Not supported: <data> (variable-length) fields and nested groups; the
+generator fails with a message naming the offending element.
+
+Usage:
+  sbe_codegen.py --schema venue.xml --namespace venue::sbe --output-dir gen
+  sbe_codegen.py --schema venue.xml --namespace venue::sbe --list-outputs
+"""
+
+from __future__ import annotations
+
+import argparse
+import re
+import sys
+import xml.etree.ElementTree as ET
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Optional
+
+# ============================================================================
+# Schema Model
+# ============================================================================
+
+# name -> (C++ type, size, SBE null value expression)
+PRIMITIVES = {
+    "char": ("char", 1, "null_value::CHAR"),
+    "int8": ("SbeInt8", 1, "null_value::INT8"),
+    "int16": ("SbeInt16", 2, "null_value::INT16"),
+    "int32": ("SbeInt32", 4, "null_value::INT32"),
+    "int64": ("SbeInt64", 8, "null_value::INT64"),
+    "uint8": ("SbeUint8", 1, "null_value::UINT8"),
+    "uint16": ("SbeUint16", 2, "null_value::UINT16"),
+    "uint32": ("SbeUint32", 4, "null_value::UINT32"),
+    "uint64": ("SbeUint64", 8, "null_value::UINT64"),
+    "float": ("float", 4, "std::numeric_limits<float>::quiet_NaN()"),
+    "double": ("double", 8, "std::numeric_limits<double>::quiet_NaN()"),
+}
+
+CPP_KEYWORDS = {
+    "alignas", "alignof", "and", "auto", "bool", "break", "case", "catch", "char",
+    "class", "const", "constexpr", "continue", "default", "delete", "do", "double",
+    "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend",
+    "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept",
+    "not", "operator", "or", "private", "protected", "public", "register", "return",
+    "short", "signed", "sizeof", "static", "struct", "switch", "template", "this",
+    "throw", "true", "try", "typedef", "typename", "union", "unsigned", "using",
+    "virtual", "void", "volatile", "while", "xor",
+}
+
+
+class SchemaError(Exception):
+    pass
+
+
+@dataclass
+class Primitive:
+    name: str
+    prim: str
+    length: int = 1
+    presence: str = "required"
+    null_value: Optional[str] = None
+    constant: Optional[str] = None
+
+    @property
+    def size(self) -> int:
+        return 0 if self.presence == "constant" else PRIMITIVES[self.prim][1] * self.length
+
+
+@dataclass
+class Enum:
+    name: str
+    prim: str
+    values: list[tuple[str, str]]
+
+    @property
+    def size(self) -> int:
+        return PRIMITIVES[self.prim][1]
+
+
+@dataclass
+class Set:
+    name: str
+    prim: str
+    choices: list[tuple[str, int]]
+
+    @property
+    def size(self) -> int:
+        return PRIMITIVES[self.prim][1]
+
+
+@dataclass
+class Member:
+    name: str
+    type: object           # Primitive | Enum | Set | Composite
+    offset: int
+    presence: str = "required"
+    value_ref: Optional[str] = None
+
+    @property
+    def size(self) -> int:
+        if self.presence == "constant":
+            return 0
+        return self.type.size
+
+
+@dataclass
+class Composite:
+    name: str
+    members: list[Member]
+
+    @property
+    def size(self) -> int:
+        return max((m.offset + m.size for m in self.members), default=0)
+
+
+@dataclass
+class Group:
+    name: str
+    id: int
+    dimension: Composite
+    block_length: int
+    fields: list[Member]
+
+
+@dataclass
+class Message:
+    name: str
+    id: int
+    block_length: int
+    fields: list[Member]
+    groups: list[Group] = field(default_factory=list)
+
+
+@dataclass
+class Schema:
+    package: str
+    id: int
+    version: int
+    types: dict
+    messages: list[Message]
+
+
+# ============================================================================
+# Naming
+# ============================================================================
+
+def ident(name: str) -> str:
+    name = re.sub(r"[^0-9A-Za-z_]", "_", name)
+    if name[:1].isdigit():
+        name = "_" + name
+    return name + "_" if name in CPP_KEYWORDS else name
+
+
+def upper_first(name: str) -> str:
+    return ident(name[:1].upper() + name[1:])
+
+
+def lower_first(name: str) -> str:
+    return ident(name[:1].lower() + name[1:])
+
+
+def member_const(name: str) -> str:
+    """Offset::/Size:: constant name; must not collide with the struct names"""
+    name = upper_first(name)
+    return name + "_" if name in ("Offset", "Size") else name
+
+
+def snake(name: str) -> str:
+    s = re.sub(r"([a-z0-9])([A-Z])", r"\1_\2", name)
+    s = re.sub(r"([A-Z]+)([A-Z][a-z])", r"\1_\2", s)
+    return re.sub(r"[^0-9a-z_]", "_", s.lower())
+
+
+def codec_name(message: Message) -> str:
+    return upper_first(message.name) + "Codec"
+
+
+# ============================================================================
+# Parsing
+# ============================================================================
+
+def local(tag: str) -> str:
+    return tag.rsplit("}", 1)[-1]
+
+
+def int_attr(elem: ET.Element, name: str, default: Optional[int] = None) -> Optional[int]:
+    value = elem.get(name)
+    return default if value is None else int(value)
+
+
+class Parser:
+    def __init__(self, root: ET.Element):
+        self.root = root
+        self.types: dict = {}
+
+    def parse(self) -> Schema:
+        root = self.root
+        if local(root.tag) != "messageSchema":
+            raise SchemaError("root element must be <messageSchema>")
+        if root.get("byteOrder", "littleEndian") != "littleEndian":
+            raise SchemaError("only byteOrder=\"littleEndian\" is supported")
+
+        type_elems = [e for types in root if local(types.tag) == "types" for e in types]
+        pending = {e.get("name"): e for e in type_elems}
+        for name in list(pending):
+            self.resolve(name, pending)
+
+        header = self.types.get("messageHeader")
+        if header is not None:
+            self.check_header(header)
+
+        messages = [self.parse_message(e) for e in root if local(e.tag) == "message"]
+        if not messages:
+            raise SchemaError("schema defines no <message>")
+        ids = [m.id for m in messages]
+        if len(ids) != len(set(ids)):
+            raise SchemaError("duplicate message id in schema")
+
+        return Schema(
+            package=root.get("package", "schema"),
+            id=int_attr(root, "id", 0),
+            version=int_attr(root, "version", 0),
+            types=self.types,
+            messages=messages,
+        )
+
+    # ------------------------------------------------------------------------
+    # Types
+    # ------------------------------------------------------------------------
+
+    def resolve(self, name: str, pending: dict):
+        if name in self.types:
+            return self.types[name]
+        if name in PRIMITIVES:
+            return Primitive(name, name)
+        elem = pending.get(name)
+        if elem is None:
+            raise SchemaError(f"unknown type '{name}'")
+        kind = local(elem.tag)
+        if kind == "type":
+            t = self.parse_type(elem)
+        elif kind == "enum":
+            t = self.parse_enum(elem, pending)
+        elif kind == "set":
+            t = self.parse_set(elem, pending)
+        elif kind == "composite":
+            t = self.parse_composite(elem, pending)
+        else:
+            raise SchemaError(f"unsupported type element <{kind}> '{name}'")
+        self.types[name] = t
+        return t
+
+    def parse_type(self, elem: ET.Element) -> Primitive:
+        prim = elem.get("primitiveType")
+        if prim not in PRIMITIVES:
+            raise SchemaError(f"type '{elem.get('name')}': unknown primitiveType '{prim}'")
+        presence = elem.get("presence", "required")
+        length = int_attr(elem, "length", 1)
+        if elem.get("characterEncoding") and prim != "char":
+            raise SchemaError(f"type '{elem.get('name')}': characterEncoding requires char")
+        return Primitive(
+            name=elem.get("name"),
+            prim=prim,
+            length=length,
+            presence=presence,
+            null_value=elem.get("nullValue"),
+            constant=(elem.text or "").strip() if presence == "constant" else None,
+        )
+
+    def encoding(self, elem: ET.Element, pending: dict) -> str:
+        enc = elem.get("encodingType")
+        if enc in PRIMITIVES:
+            return enc
+        target = self.resolve(enc, pending) if enc else None
+        if isinstance(target, Primitive) and target.length == 1:
+            return target.prim
+        raise SchemaError(f"'{elem.get('name')}': unsupported encodingType '{enc}'")
+
+    def parse_enum(self, elem: ET.Element, pending: dict) -> Enum:
+        prim = self.encoding(elem, pending)
+        values = [(v.get("name"), (v.text or "").strip())
+                  for v in elem if local(v.tag) == "validValue"]
+        return Enum(elem.get("name"), prim, values)
+
+    def parse_set(self, elem: ET.Element, pending: dict) -> Set:
+        prim = self.encoding(elem, pending)
+        choices = [(c.get("name"), int((c.text or "").strip()))
+                   for c in elem if local(c.tag) == "choice"]
+        bits = PRIMITIVES[prim][1] * 8
+        for name, bit in choices:
+            if bit >= bits:
+                raise SchemaError(f"set '{elem.get('name')}': choice '{name}' exceeds {bits} bits")
+        return Set(elem.get("name"), prim, choices)
+
+    def parse_composite(self, elem: ET.Element, pending: dict) -> Composite:
+        members: list[Member] = []
+        offset = 0
+        for child in elem:
+            kind = local(child.tag)
+            if kind == "ref":
+                t = self.resolve(child.get("type"), pending)
+            elif kind == "type":
+                t = self.parse_type(child)
+            elif kind == "enum":
+                t = self.parse_enum(child, pending)
+            elif kind == "set":
+                t = self.parse_set(child, pending)
+            elif kind == "composite":
+                t = self.parse_composite(child, pending)
+            else:
+                raise SchemaError(f"composite '{elem.get('name')}': unsupported <{kind}>")
+            presence = getattr(t, "presence", "required")
+            m = Member(child.get("name"), t, int_attr(child, "offset", offset), presence)
+            members.append(m)
+            offset = m.offset + m.size
+        return Composite(elem.get("name"), members)
+
+    def check_header(self, header: Composite):
+        expected = [("blockLength", 0), ("templateId", 2), ("schemaId", 4), ("version", 6)]
+        actual = [(m.name, m.offset) for m in header.members]
+        uint16 = all(isinstance(m.type, Primitive) and m.type.prim == "uint16"
+                     and m.type.length == 1 for m in header.members)
+        if actual != expected or not uint16:
+            raise SchemaError("only the standard 8-byte messageHeader "
+                              "(blockLength, templateId, schemaId, version as uint16) "
+                              "is supported")
+
+    # ------------------------------------------------------------------------
+    # Messages
+    # ------------------------------------------------------------------------
+
+    def parse_fields(self, owner: str, elems) -> list[Member]:
+        fields: list[Member] = []
+        offset = 0
+        for e in elems:
+            t = self.resolve(e.get("type"), {})
+            presence = e.get("presence", getattr(t, "presence", "required"))
+            m = Member(e.get("name"), t, int_attr(e, "offset", offset), presence,
+                       e.get("valueRef"))
+            if presence == "constant" and m.value_ref is None and \
+                    not (isinstance(t, Primitive) and t.constant is not None):
+                raise SchemaError(f"{owner}.{m.name}: constant field needs a value")
+            for other in fields:
+                if m.size and other.size and m.offset < other.offset + other.size \
+                        and other.offset < m.offset + m.size:
+                    raise SchemaError(f"{owner}.{m.name} overlaps {other.name}")
+            fields.append(m)
+            offset = max(offset, m.offset + m.size)
+        return fields
+
+    def parse_message(self, elem: ET.Element) -> Message:
+        name = elem.get("name")
+        field_elems, groups = [], []
+        for child in elem:
+            kind = local(child.tag)
+            if kind == "field":
+                if groups:
+                    raise SchemaError(f"{name}.{child.get('name')}: fields must precede groups")
+                field_elems.append(child)
+            elif kind == "group":
+                groups.append(self.parse_group(name, child))
+            elif kind == "data":
+                raise SchemaError(f"{name}.{child.get('name')}: <data> fields are not supported")
+        fields = self.parse_fields(name, field_elems)
+        computed = max((f.offset + f.size for f in fields), default=0)
+        block_length = int_attr(elem, "blockLength", computed)
+        if block_length < computed:
+            raise SchemaError(f"{name}: blockLength {block_length} < fields ({computed})")
+        return Message(name, int(elem.get("id")), block_length, fields, groups)
+
+    def parse_group(self, message: str, elem: ET.Element) -> Group:
+        name = elem.get("name")
+        for child in elem:
+            if local(child.tag) in ("group", "data"):
+                raise SchemaError(f"{message}.{name}: nested <{local(child.tag)}> "
+                                  "is not supported")
+        dim = self.resolve(elem.get("dimensionType", "groupSizeEncoding"), {})
+        if not isinstance(dim, Composite) or \
+                {m.name for m in dim.members} < {"blockLength", "numInGroup"}:
+            raise SchemaError(f"{message}.{name}: dimensionType needs blockLength and numInGroup")
+        fields = self.parse_fields(f"{message}.{name}",
+                                   [c for c in elem if local(c.tag) == "field"])
+        computed = max((f.offset + f.size for f in fields), default=0)
+        block_length = int_attr(elem, "blockLength", computed)
+        if block_length < computed:
+            raise SchemaError(f"{message}.{name}: blockLength {block_length} < fields")
+        return Group(name, int_attr(elem, "id", 0), dim, block_length, fields)
+
+
+# ============================================================================
+# Code Emission
+# ============================================================================
+
+HEADER_BANNER = """// Generated by scripts/sbe_codegen.py from {schema} - do not edit.
+// SPDX-License-Identifier: MIT
+"""
+
+
+def banner(title: str) -> list[str]:
+    return [
+        "// " + "=" * 76,
+        f"// {title}",
+        "// " + "=" * 76,
+    ]
+
+
+def int_literal(value: int, prim: str) -> str:
+    if prim.startswith("uint"):
+        return f"{value}ULL"
+    if value == -(2 ** 63):
+        return "(-9223372036854775807LL - 1)"
+    return f"{value}LL"
+
+
+def prim_literal(value: str, prim: str) -> str:
+    cpp = PRIMITIVES[prim][0]
+    if prim == "char":
+        ch = value if len(value) == 1 else chr(int(value))
+        return "'\\''" if ch == "'" else ("'\\\\'" if ch == "\\" else f"'{ch}'")
+    if prim in ("float", "double"):
+        return f"static_cast<{cpp}>({value})"
+    return f"static_cast<{cpp}>({int_literal(int(value, 0), prim)})"
+
+
+def null_expr(t: Primitive) -> str:
+    if t.null_value is not None:
+        return prim_literal(t.null_value, t.prim)
+    return PRIMITIVES[t.prim][2]
+
+
+def read_expr(prim: str, ptr: str) -> str:
+    cpp = PRIMITIVES[prim][0]
+    if prim in ("float", "double"):
+        return f"detail::read_float<{cpp}>({ptr})"
+    return f"read_le<{cpp}>({ptr})"
+
+
+def write_stmt(prim: str, ptr: str, value: str) -> str:
+    cpp = PRIMITIVES[prim][0]
+    if prim in ("float", "double"):
+        return f"detail::write_float<{cpp}>({ptr}, {value});"
+    return f"write_le<{cpp}>({ptr}, {value});"
+
+
+class Emitter:
+    """Emits accessor lines for a flyweight over a block of members."""
+
+    def __init__(self, schema: Schema):
+        self.schema = schema
+
+    def value_ref(self, ref: str) -> str:
+        enum_name, _, value = ref.partition(".")
+        return f"{upper_first(enum_name)}::{ident(value)}"
+
+    def cpp_type(self, t) -> str:
+        if isinstance(t, Enum):
+            return upper_first(t.name)
+        if isinstance(t, Set):
+            return PRIMITIVES[t.prim][0]
+        if isinstance(t, Composite):
+            return upper_first(t.name)
+        return PRIMITIVES[t.prim][0]
+
+    def offset_structs(self, members: list[Member], ind: str) -> list[str]:
+        out = [f"{ind}// Field offsets", f"{ind}struct Offset {{"]
+        for m in members:
+            out.append(f"{ind}    static constexpr std::size_t {member_const(m.name)} = {m.offset};")
+        out += [f"{ind}}};", "", f"{ind}// Field sizes", f"{ind}struct Size {{"]
+        for m in members:
+            out.append(f"{ind}    static constexpr std::size_t {member_const(m.name)} = {m.size};")
+        out.append(f"{ind}}};")
+        return out
+
+    def getters(self, members: list[Member], base: str, ind: str) -> list[str]:
+        out: list[str] = []
+        hot = "[[nodiscard]] NFX_HOT NFX_FORCE_INLINE"
+        for m in members:
+            t, acc, off = m.type, lower_first(m.name), f"{base} + Offset::{member_const(m.name)}"
+            if m.presence == "constant":
+                if m.value_ref:
+                    out.append(f"{ind}[[nodiscard]] static constexpr {self.cpp_type(t)} "
+                               f"{acc}() noexcept {{ return {self.value_ref(m.value_ref)}; }}")
+                elif t.length > 1:
+                    out.append(f"{ind}[[nodiscard]] static constexpr std::string_view "
+                               f"{acc}() noexcept {{ return \"{t.constant}\"; }}")
+                else:
+                    out.append(f"{ind}[[nodiscard]] static constexpr {self.cpp_type(t)} "
+                               f"{acc}() noexcept {{ return {prim_literal(t.constant, t.prim)}; }}")
+                out.append("")
+                continue
+            if isinstance(t, Composite):
+                out += [f"{ind}{hot} {self.cpp_type(t)} {acc}() const noexcept {{",
+                        f"{ind}    return {self.cpp_type(t)}{{{off}}};",
+                        f"{ind}}}"]
+            elif isinstance(t, Enum):
+                out += [f"{ind}{hot} {self.cpp_type(t)} {acc}() const noexcept {{",
+                        f"{ind}    return static_cast<{self.cpp_type(t)}>({read_expr(t.prim, off)});",
+                        f"{ind}}}"]
+            elif isinstance(t, Set):
+                out += [f"{ind}{hot} {self.cpp_type(t)} {acc}() const noexcept {{",
+                        f"{ind}    return {read_expr(t.prim, off)};",
+                        f"{ind}}}"]
+            elif t.prim == "char" and t.length > 1:
+                out += [f"{ind}{hot} std::string_view {acc}() const noexcept {{",
+                        f"{ind}    return FixedString<{t.length}>::decode({off});",
+                        f"{ind}}}"]
+            elif t.length > 1:
+                cpp = self.cpp_type(t)
+                out += [f"{ind}{hot} {cpp} {acc}(std::size_t index) const noexcept {{",
+                        f"{ind}    return {read_expr(t.prim, f'{off} + index * sizeof({cpp})')};",
+                        f"{ind}}}"]
+            else:
+                out += [f"{ind}{hot} {self.cpp_type(t)} {acc}() const noexcept {{",
+                        f"{ind}    return {read_expr(t.prim, off)};",
+                        f"{ind}}}"]
+            if m.presence == "optional" and isinstance(t, Primitive) and t.length == 1:
+                check = (f"std::isnan({acc}())" if t.prim in ("float", "double")
+                         else f"{acc}() == {null_expr(t)}")
+                out += ["", f"{ind}[[nodiscard]] NFX_FORCE_INLINE bool {acc}IsNull() const noexcept {{",
+                        f"{ind}    return {check};",
+                        f"{ind}}}"]
+            out.append("")
+        return out
+
+    def setters(self, members: list[Member], base: str, cls: str, ind: str) -> list[str]:
+        out: list[str] = []
+        fi = "NFX_FORCE_INLINE"
+        for m in members:
+            t, acc, off = m.type, lower_first(m.name), f"{base} + Offset::{member_const(m.name)}"
+            if m.presence == "constant" or isinstance(t, Composite):
+                continue  # Composites are written through their own flyweight
+            if isinstance(t, Enum):
+                enc = PRIMITIVES[t.prim][0]
+                out += [f"{ind}{fi} {cls}& {acc}({self.cpp_type(t)} value) noexcept {{",
+                        f"{ind}    {write_stmt(t.prim, off, f'static_cast<{enc}>(value)')}",
+                        f"{ind}    return *this;", f"{ind}}}", ""]
+            elif isinstance(t, Set):
+                out += [f"{ind}{fi} {cls}& {acc}({self.cpp_type(t)} value) noexcept {{",
+                        f"{ind}    {write_stmt(t.prim, off, 'value')}",
+                        f"{ind}    return *this;", f"{ind}}}", ""]
+            elif t.prim == "char" and t.length > 1:
+                out += [f"{ind}{fi} {cls}& {acc}(std::string_view value) noexcept {{",
+                        f"{ind}    FixedString<{t.length}>::encode({off}, value);",
+                        f"{ind}    return *this;", f"{ind}}}", ""]
+            elif t.length > 1:
+                cpp = self.cpp_type(t)
+                out += [f"{ind}{fi} {cls}& {acc}(std::size_t index, {cpp} value) noexcept {{",
+                        f"{ind}    {write_stmt(t.prim, f'{off} + index * sizeof({cpp})', 'value')}",
+                        f"{ind}    return *this;", f"{ind}}}", ""]
+            else:
+                out += [f"{ind}{fi} {cls}& {acc}({self.cpp_type(t)} value) noexcept {{",
+                        f"{ind}    {write_stmt(t.prim, off, 'value')}",
+                        f"{ind}    return *this;", f"{ind}}}", ""]
+        return out
+
+    def null_init(self, members: list[Member], base: str, ind: str) -> list[str]:
+        """Optional scalars start out null rather than zero."""
+        out = []
+        for m in members:
+            t = m.type
+            if m.presence == "optional" and isinstance(t, Primitive) and t.length == 1:
+                out.append(f"{ind}{write_stmt(t.prim, f'{base} + Offset::{member_const(m.name)}', null_expr(t))}")
+        return out
+
+    # ------------------------------------------------------------------------
+    # Flyweight classes (composites, group entries)
+    # ------------------------------------------------------------------------
+
+    def flyweight(self, name: str, members: list[Member], size: int, doc: str,
+                  ind: str = "") -> list[str]:
+        out = [f"{ind}// {doc}", f"{ind}class {name} {{", f"{ind}public:",
+               f"{ind}    static constexpr std::size_t SIZE = {size};", ""]
+        out += self.offset_structs(members, ind + "    ")
+        out += ["",
+                f"{ind}    explicit {name}(const char* buffer) noexcept",
+                f"{ind}        : buffer_{{const_cast<char*>(buffer)}} {{}}", ""]
+        out += self.getters(members, "buffer_", ind + "    ")
+        out += self.setters(members, "buffer_", name, ind + "    ")
+        out += [f"{ind}    // Set optional fields to null, everything else to zero",
+                f"{ind}    NFX_FORCE_INLINE {name}& clear() noexcept {{",
+                f"{ind}        std::memset(buffer_, 0, SIZE);"]
+        out += self.null_init(members, "buffer_", ind + "        ")
+        out += [f"{ind}        return *this;", f"{ind}    }}", "",
+                f"{ind}private:", f"{ind}    char* buffer_;", f"{ind}}};"]
+        return out
+
+
+# ============================================================================
+# Files
+# ============================================================================
+
+def namespace_open(ns: str) -> str:
+    return f"namespace {ns} {{"
+
+
+def namespace_close(ns: str) -> str:
+    return f"}}  // namespace {ns}"
+
+
+def emit_types(schema: Schema, ns: str, schema_file: str) -> str:
+    e = Emitter(schema)
+    out = [HEADER_BANNER.format(schema=schema_file), "#pragma once", "",
+           "#include <cmath>", "#include <cstddef>", "#include <cstring>", "#include <limits>",
+           "#include <string_view>", "",
+           '#include "nexusfix/platform/platform.hpp"',
+           '#include "nexusfix/sbe/types/composite_types.hpp"',
+           '#include "nexusfix/sbe/types/group_view.hpp"',
+           '#include "nexusfix/sbe/types/sbe_types.hpp"', "",
+           namespace_open(ns), "",
+           "using namespace ::nfx::sbe;", "",
+           *banner(f"Schema {schema.package} (id={schema.id}, version={schema.version})"), "",
+           "struct Schema {",
+           f"    static constexpr SbeUint16 ID = {schema.id};",
+           f"    static constexpr SbeUint16 VERSION = {schema.version};",
+           "};", "",
+           "namespace detail {", "",
+           "template <typename T>",
+           "[[nodiscard]] NFX_FORCE_INLINE T read_float(const char* buffer) noexcept {",
+           "    T value;",
+           "    std::memcpy(&value, buffer, sizeof(T));",
+           "    return value;",
+           "}", "",
+           "template <typename T>",
+           "NFX_FORCE_INLINE void write_float(char* buffer, T value) noexcept {",
+           "    std::memcpy(buffer, &value, sizeof(T));",
+           "}", "",
+           "}  // namespace detail", ""]
+
+    enums = [t for t in schema.types.values() if isinstance(t, Enum)]
+    sets = [t for t in schema.types.values() if isinstance(t, Set)]
+    composites = [t for t in schema.types.values()
+                  if isinstance(t, Composite) and t.name not in ("messageHeader",)]
+    # Inline enums/sets/composites declared inside composites
+    for c in list(composites):
+        for m in c.members:
+            if isinstance(m.type, Enum) and m.type not in enums:
+                enums.append(m.type)
+            if isinstance(m.type, Set) and m.type not in sets:
+                sets.append(m.type)
+
+    if enums:
+        out += banner("Enums") + [""]
+        for t in enums:
+            out.append(f"enum class {upper_first(t.name)} : {PRIMITIVES[t.prim][0]} {{")
+            for name, value in t.values:
+                out.append(f"    {ident(name)} = {prim_literal(value, t.prim)},")
+            out.append(f"    NullValue = {PRIMITIVES[t.prim][2]}")
+            out += ["};", ""]
+
+    if sets:
+        out += banner("Sets (bit choices)") + [""]
+        for t in sets:
+            cpp = PRIMITIVES[t.prim][0]
+            out.append(f"struct {upper_first(t.name)} {{")
+            out.append(f"    using type = {cpp};")
+            for name, bit in t.choices:
+                out.append(f"    static constexpr {cpp} {ident(name)} = static_cast<{cpp}>({cpp}{{1}} << {bit});")
+            out += ["",
+                    f"    [[nodiscard]] static constexpr bool has({cpp} bits, {cpp} choice) noexcept {{",
+                    "        return (bits & choice) != 0;",
+                    "    }", "};", ""]
+
+    if composites:
+        out += banner("Composites") + [""]
+        # Dependencies first: a composite member type must be declared before use
+        ordered: list[Composite] = []
+
+        def visit(c: Composite):
+            if c in ordered:
+                return
+            for m in c.members:
+                if isinstance(m.type, Composite):
+                    visit(m.type)
+            ordered.append(c)
+
+        for c in composites:
+            visit(c)
+        for c in ordered:
+            out += e.flyweight(upper_first(c.name), c.members, c.size,
+                               f"Composite {c.name} ({c.size} bytes)")
+            out.append("")
+
+    out += [namespace_close(ns), ""]
+    return "\n".join(out)
+
+
+def dim_member(group: Group, name: str) -> Member:
+    return next(m for m in group.dimension.members if m.name == name)
+
+
+def emit_group(e: Emitter, group: Group, index: int, msg: Message, max_entries: int) -> list[str]:
+    g = upper_first(group.name)
+    acc = lower_first(group.name)
+    bl, num = dim_member(group, "blockLength"), dim_member(group, "numInGroup")
+    bl_ptr = f"buffer_ + {acc}Position() + {bl.offset}"
+    num_ptr = f"buffer_ + {acc}Position() + {num.offset}"
+    ind = "    "
+    out = [f"{ind}// {'-' * 72}", f"{ind}// {group.name} repeating group (id={group.id})",
+           f"{ind}// {'-' * 72}", ""]
+    out += e.flyweight(f"{g}Entry", group.fields, group.block_length,
+                       f"One {group.name} entry ({group.block_length} bytes)", ind)
+    out += ["",
+            f"{ind}using {g}Entries = GroupView<{g}Entry>;",
+            f"{ind}static constexpr std::size_t {snake(group.name).upper()}_DIMENSION_SIZE = {group.dimension.size};",
+            f"{ind}static constexpr std::size_t {snake(group.name).upper()}_MAX_COUNT = {PRIMITIVES[num.type.prim][2]} - 1;",
+            "",
+            f"{ind}[[nodiscard]] NFX_HOT NFX_FORCE_INLINE std::size_t {acc}Count() const noexcept {{",
+            f"{ind}    return {read_expr(num.type.prim, num_ptr)};",
+            f"{ind}}}", "",
+            f"{ind}// Entry size on the wire (>= {g}Entry::SIZE)",
+            f"{ind}[[nodiscard]] NFX_FORCE_INLINE std::size_t {acc}BlockLength() const noexcept {{",
+            f"{ind}    return {read_expr(bl.type.prim, bl_ptr)};",
+            f"{ind}}}", "",
+            f"{ind}// {group.name} entries, iterated in place (call isValid() first)",
+            f"{ind}[[nodiscard]] NFX_HOT NFX_FORCE_INLINE {g}Entries {acc}() const noexcept {{",
+            f"{ind}    return {g}Entries{{buffer_ + {acc}Position() + {snake(group.name).upper()}_DIMENSION_SIZE,",
+            f"{ind}                      {acc}Count(), {acc}BlockLength()}};",
+            f"{ind}}}", "",
+            f"{ind}// Declare the number of {group.name} entries (clamped to the buffer);",
+            f"{ind}// entries are cleared, then filled through {acc}Entry(i). Set group",
+            f"{ind}// counts in schema order: later groups follow earlier entries.",
+            f"{ind}NFX_FORCE_INLINE {codec_name(msg)}& {acc}Count(std::size_t count) noexcept {{",
+            f"{ind}    const std::size_t pos = {acc}Position();",
+            f"{ind}    const std::size_t tail = pos + {snake(group.name).upper()}_DIMENSION_SIZE;",
+            f"{ind}    if (tail > length_) {{",
+            f"{ind}        return *this;",
+            f"{ind}    }}",
+            f"{ind}    std::size_t fits = length_ > tail + TRAILING_DIMENSIONS_{index}",
+            f"{ind}        ? (length_ - tail - TRAILING_DIMENSIONS_{index}) / {g}Entry::SIZE : 0;",
+            f"{ind}    count = std::min({{count, fits, {snake(group.name).upper()}_MAX_COUNT}});",
+            f"{ind}    {write_stmt(bl.type.prim, f'mutableBuffer() + pos + {bl.offset}', f'static_cast<{PRIMITIVES[bl.type.prim][0]}>({g}Entry::SIZE)')}",
+            f"{ind}    {write_stmt(num.type.prim, f'mutableBuffer() + pos + {num.offset}', f'static_cast<{PRIMITIVES[num.type.prim][0]}>(count)')}",
+            f"{ind}    for (std::size_t i = 0; i < count; ++i) {{",
+            f"{ind}        {acc}Entry(i).clear();",
+            f"{ind}    }}"]
+    if index + 1 < len(msg.groups):
+        nxt = lower_first(msg.groups[index + 1].name)
+        out.append(f"{ind}    clearGroupsFrom{upper_first(nxt)}();")
+    out += [f"{ind}    return *this;", f"{ind}}}", "",
+            f"{ind}[[nodiscard]] NFX_FORCE_INLINE {g}Entry {acc}Entry(std::size_t index) noexcept {{",
+            f"{ind}    return {g}Entry{{mutableBuffer() + {acc}Position() +",
+            f"{ind}                    {snake(group.name).upper()}_DIMENSION_SIZE + index * {g}Entry::SIZE}};",
+            f"{ind}}}", ""]
+    return out
+
+
+def emit_message(schema: Schema, msg: Message, ns: str, schema_file: str,
+                 max_entries: int) -> str:
+    e = Emitter(schema)
+    cls = codec_name(msg)
+    ind = "    "
+    has_groups = bool(msg.groups)
+    dims = [g.dimension.size for g in msg.groups]
+    min_size = 8 + msg.block_length + sum(dims)
+    total = min_size + sum(max_entries * g.block_length for g in msg.groups)
+
+    if has_groups:
+        summary = f"{min_size} bytes + group entries"
+    else:
+        summary = f"{8 + msg.block_length} bytes total: 8 header + {msg.block_length} body"
+    layout = [f"// Message Layout ({summary}):", "//", "// Body:"]
+    for f in msg.fields:
+        if f.size:
+            layout.append(f"//   Offset {f.offset:3d}-{f.offset + f.size - 1:<3d}: {f.name} ({f.type.name})")
+        else:
+            layout.append(f"//   (constant): {f.name}")
+    for g in msg.groups:
+        layout.append(f"// Group {g.name}: {g.dimension.name} + numInGroup x {g.block_length} bytes")
+
+    out = [HEADER_BANNER.format(schema=schema_file), "#pragma once", "",
+           "#include <algorithm>", "#include <cstddef>", "#include <cstring>", "#include <span>",
+           "#include <string_view>", "",
+           '#include "nexusfix/sbe/message_header.hpp"',
+           '#include "types.hpp"', "",
+           namespace_open(ns), "",
+           *banner(f"{cls}: SBE Flyweight Codec for {msg.name} (templateId={msg.id})"),
+           "//", *layout, "", f"class {cls} {{", "public:",
+           f"{ind}// Message constants",
+           f"{ind}static constexpr SbeUint16 TEMPLATE_ID = {msg.id};",
+           f"{ind}static constexpr std::size_t BLOCK_LENGTH = {msg.block_length};"]
+    if has_groups:
+        out += [f"{ind}static constexpr std::size_t MIN_SIZE = {min_size};",
+                f"{ind}// Buffer size that holds {max_entries} entries per group",
+                f"{ind}static constexpr std::size_t TOTAL_SIZE = {total};"]
+    else:
+        out.append(f"{ind}static constexpr std::size_t TOTAL_SIZE = MessageHeader::SIZE + BLOCK_LENGTH;")
+    out.append("")
+    out += e.offset_structs(msg.fields, ind)
+
+    # Decode API
+    out += ["", f"{ind}// {'=' * 72}", f"{ind}// Decode API (Zero-Copy Flyweight)", f"{ind}// {'=' * 72}", "",
+            f"{ind}[[nodiscard]] NFX_FORCE_INLINE static {cls} wrapForDecode(",
+            f"{ind}    const char* buffer, std::size_t length) noexcept {{",
+            f"{ind}    return {cls}{{buffer, length}};",
+            f"{ind}}}", "",
+            f"{ind}// Check header, schema and (for groups) every declared entry",
+            f"{ind}[[nodiscard]] NFX_FORCE_INLINE bool isValid() const noexcept {{",
+            f"{ind}    if (buffer_ == nullptr || length_ < {'MIN_SIZE' if has_groups else 'TOTAL_SIZE'}) {{",
+            f"{ind}        return false;",
+            f"{ind}    }}",
+            f"{ind}    auto header = MessageHeader::wrapForDecode(buffer_, length_);",
+            f"{ind}    if (!header.isValid() ||",
+            f"{ind}        header.templateId() != TEMPLATE_ID ||",
+            f"{ind}        header.schemaId() != Schema::ID ||",
+            f"{ind}        header.blockLength() != BLOCK_LENGTH) {{",
+            f"{ind}        return false;",
+            f"{ind}    }}"]
+    for g in msg.groups:
+        acc = lower_first(g.name)
+        out += [f"{ind}    if (!check_bounds({acc}Position(), {snake(g.name).upper()}_DIMENSION_SIZE, length_) ||",
+                f"{ind}        {acc}BlockLength() < {upper_first(g.name)}Entry::SIZE ||",
+                f"{ind}        !check_bounds({acc}Position(), {snake(g.name).upper()}_DIMENSION_SIZE +",
+                f"{ind}                      {acc}Count() * {acc}BlockLength(), length_)) {{",
+                f"{ind}        return false;",
+                f"{ind}    }}"]
+    out += [f"{ind}    return true;", f"{ind}}}", ""]
+    out += e.getters(msg.fields, "body()", ind)
+    out += [f"{ind}[[nodiscard]] NFX_FORCE_INLINE const char* body() const noexcept {{",
+            f"{ind}    return buffer_ + MessageHeader::SIZE;",
+            f"{ind}}}", "",
+            f"{ind}[[nodiscard]] NFX_FORCE_INLINE MessageHeader header() const noexcept {{",
+            f"{ind}    return MessageHeader::wrapForDecode(buffer_, length_);",
+            f"{ind}}}", ""]
+
+    # Encode API
+    out += [f"{ind}// {'=' * 72}", f"{ind}// Encode API (Fluent Builder)", f"{ind}// {'=' * 72}", "",
+            f"{ind}[[nodiscard]] NFX_FORCE_INLINE static {cls} wrapForEncode(",
+            f"{ind}    char* buffer, std::size_t length) noexcept {{",
+            f"{ind}    return {cls}{{buffer, length}};",
+            f"{ind}}}", "",
+            f"{ind}// Encode header (call first); optional fields start out null",
+            f"{ind}NFX_FORCE_INLINE {cls}& encodeHeader() noexcept {{",
+            f"{ind}    char* buf = mutableBuffer();",
+            f"{ind}    write_uint16(buf + MessageHeader::Offset::BlockLength, BLOCK_LENGTH);",
+            f"{ind}    write_uint16(buf + MessageHeader::Offset::TemplateId, TEMPLATE_ID);",
+            f"{ind}    write_uint16(buf + MessageHeader::Offset::SchemaId, Schema::ID);",
+            f"{ind}    write_uint16(buf + MessageHeader::Offset::Version, Schema::VERSION);",
+            f"{ind}    std::memset(mutableBody(), 0, BLOCK_LENGTH);"]
+    out += e.null_init(msg.fields, "mutableBody()", ind + "    ")
+    if has_groups:
+        out.append(f"{ind}    clearGroupsFrom{upper_first(lower_first(msg.groups[0].name))}();")
+    out += [f"{ind}    return *this;", f"{ind}}}", ""]
+    out += e.setters(msg.fields, "mutableBody()", cls, ind)
+
+    if has_groups:
+        out += [f"{ind}// Encoded length including every group entry",
+                f"{ind}[[nodiscard]] NFX_FORCE_INLINE std::size_t encodedLength() const noexcept {{",
+                f"{ind}    return endOfGroups();",
+                f"{ind}}}", "",
+                f"{ind}[[nodiscard]] NFX_FORCE_INLINE std::span<const char> encoded() const noexcept {{",
+                f"{ind}    return std::span<const char>{{buffer_, encodedLength()}};",
+                f"{ind}}}", ""]
+    else:
+        out += [f"{ind}[[nodiscard]] NFX_FORCE_INLINE std::span<const char> encoded() const noexcept {{",
+                f"{ind}    return std::span<const char>{{buffer_, TOTAL_SIZE}};",
+                f"{ind}}}", "",
+                f"{ind}[[nodiscard]] static constexpr std::size_t encodedSize() noexcept {{",
+                f"{ind}    return TOTAL_SIZE;",
+                f"{ind}}}", ""]
+    out += [f"{ind}[[nodiscard]] NFX_FORCE_INLINE char* mutableBody() noexcept {{",
+            f"{ind}    return mutableBuffer() + MessageHeader::SIZE;",
+            f"{ind}}}", "",
+            f"{ind}[[nodiscard]] NFX_FORCE_INLINE char* mutableBuffer() noexcept {{",
+            f"{ind}    return const_cast<char*>(buffer_);",
+            f"{ind}}}", ""]
+
+    for i, g in enumerate(msg.groups):
+        out += emit_group(e, g, i, msg, max_entries)
+
+    out += ["private:",
+            f"{ind}{cls}(const char* buffer, std::size_t length) noexcept",
+            f"{ind}    : buffer_{{buffer}}, length_{{length}} {{}}", ""]
+    if has_groups:
+        for i, g in enumerate(msg.groups):
+            trailing = sum(dims[i + 1:])
+            out.append(f"{ind}// Room kept after {g.name} entries for the group headers that follow")
+            out.append(f"{ind}static constexpr std::size_t TRAILING_DIMENSIONS_{i} = {trailing};")
+        out.append("")
+        first = lower_first(msg.groups[0].name)
+        out += [f"{ind}[[nodiscard]] NFX_FORCE_INLINE std::size_t {first}Position() const noexcept {{",
+                f"{ind}    return MessageHeader::SIZE + BLOCK_LENGTH;",
+                f"{ind}}}", ""]
+        for prev, g in zip(msg.groups, msg.groups[1:]):
+            p, acc = lower_first(prev.name), lower_first(g.name)
+            out += [f"{ind}[[nodiscard]] NFX_FORCE_INLINE std::size_t {acc}Position() const noexcept {{",
+                    f"{ind}    return {p}Position() + {snake(prev.name).upper()}_DIMENSION_SIZE +",
+                    f"{ind}           {p}Count() * {p}BlockLength();",
+                    f"{ind}}}", ""]
+        last = lower_first(msg.groups[-1].name)
+        out += [f"{ind}[[nodiscard]] NFX_FORCE_INLINE std::size_t endOfGroups() const noexcept {{",
+                f"{ind}    return {last}Position() + {snake(msg.groups[-1].name).upper()}_DIMENSION_SIZE +",
+                f"{ind}           {last}Count() * {last}BlockLength();",
+                f"{ind}}}", ""]
+        for i, g in enumerate(msg.groups):
+            acc = lower_first(g.name)
+            out += [f"{ind}// Write empty headers for {g.name} and every later group",
+                    f"{ind}NFX_FORCE_INLINE void clearGroupsFrom{upper_first(acc)}() noexcept {{",
+                    f"{ind}    std::size_t pos = {acc}Position();"]
+            for later in msg.groups[i:]:
+                bl, num = dim_member(later, "blockLength"), dim_member(later, "numInGroup")
+                dsz = f"{snake(later.name).upper()}_DIMENSION_SIZE"
+                out += [f"{ind}    if (pos + {dsz} > length_) return;",
+                        f"{ind}    {write_stmt(bl.type.prim, f'mutableBuffer() + pos + {bl.offset}', f'static_cast<{PRIMITIVES[bl.type.prim][0]}>({upper_first(later.name)}Entry::SIZE)')}",
+                        f"{ind}    {write_stmt(num.type.prim, f'mutableBuffer() + pos + {num.offset}', f'static_cast<{PRIMITIVES[num.type.prim][0]}>(0)')}",
+                        f"{ind}    pos += {dsz};"]
+            out += [f"{ind}    (void)pos;", f"{ind}}}", ""]
+    out += [f"{ind}const char* buffer_{{nullptr}};", f"{ind}std::size_t length_{{0}};", "};", ""]
+
+    # Layout assertions
+    out += banner("Static Assertions: Verify Layout") + [""]
+    for f in msg.fields:
+        if f.size:
+            out += [f"static_assert({cls}::Offset::{member_const(f.name)} +",
+                    f"              {cls}::Size::{member_const(f.name)} <= {cls}::BLOCK_LENGTH);"]
+    if not has_groups:
+        out.append(f"static_assert({cls}::TOTAL_SIZE == {8 + msg.block_length});")
+    out += ["", namespace_close(ns), "",
+            "namespace nfx::sbe {", "",
+            "template <>",
+            f"struct is_sbe_codec<{ns}::{cls}> : std::true_type {{}};", "",
+            "}  // namespace nfx::sbe", ""]
+    return "\n".join(out)
+
+
+def emit_schema_header(schema: Schema, ns: str, schema_file: str, files: list[str]) -> str:
+    out = [HEADER_BANNER.format(schema=schema_file), "#pragma once", "",
+           "#include <algorithm>", "#include <cstddef>", "#include <span>", "#include <utility>", "",
+           '#include "nexusfix/sbe/sbe.hpp"', '#include "types.hpp"']
+    out += [f'#include "{f}"' for f in files]
+    out += ["", namespace_open(ns), "",
+            *banner("Message Dispatch by Template ID"), "",
+            "// Handler signature: void(auto& codec) where codec is one of:"]
+    out += [f"//   - {codec_name(m)}" for m in schema.messages]
+    out += ["//   - UnknownMessage (other schema, unknown template or short buffer)",
+            "template <typename Handler>",
+            "NFX_HOT NFX_FORCE_INLINE void dispatch(",
+            "    const char* buffer, std::size_t length, Handler&& handler) noexcept {",
+            "    auto header = MessageHeader::wrapForDecode(buffer, length);",
+            "    if (!header.isValid() || header.schemaId() != Schema::ID) {",
+            "        UnknownMessage unknown{0, buffer, length};",
+            "        handler(unknown);",
+            "        return;",
+            "    }", "",
+            "    const SbeUint16 templateId = header.templateId();",
+            "    switch (templateId) {"]
+    for m in schema.messages:
+        out += [f"        case {codec_name(m)}::TEMPLATE_ID: {{",
+                f"            auto codec = {codec_name(m)}::wrapForDecode(buffer, length);",
+                "            handler(codec);",
+                "            break;",
+                "        }"]
+    out += ["        default: {",
+            "            UnknownMessage unknown{templateId, buffer, length};",
+            "            handler(unknown);",
+            "            break;",
+            "        }",
+            "    }",
+            "}", "",
+            "template <typename Handler>",
+            "NFX_FORCE_INLINE void dispatch(",
+            "    std::span<const char> buffer, Handler&& handler) noexcept {",
+            "    dispatch(buffer.data(), buffer.size(), std::forward<Handler>(handler));",
+            "}", "",
+            "// Maximum message size across the schema",
+            "inline constexpr std::size_t MAX_MESSAGE_SIZE = std::max({"]
+    out.append(",\n".join(f"    {codec_name(m)}::TOTAL_SIZE" for m in schema.messages) + "});")
+    out += ["", namespace_close(ns), ""]
+    return "\n".join(out)
+
+
+# ============================================================================
+# Driver
+# ============================================================================
+
+def outputs(schema: Schema, prefix: str) -> dict[str, str]:
+    """Relative output path -> generator key"""
+    files = {f"{prefix}/types.hpp": "types", f"{prefix}/schema.hpp": "schema"}
+    for m in schema.messages:
+        files[f"{prefix}/{snake(m.name)}.hpp"] = m.name
+    return files
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--schema", required=True, help="SBE XML schema")
+    ap.add_argument("--namespace", required=True, help="C++ namespace, e.g. venue::sbe")
+    ap.add_argument("--output-dir", default=".", help="Root of the generated include tree")
+    ap.add_argument("--header-prefix", default=None,
+                    help="Include path under output-dir (default: namespace as a path)")
+    ap.add_argument("--max-group-entries", type=int, default=32,
+                    help="Entries per group assumed by TOTAL_SIZE (buffer sizing)")
+    ap.add_argument("--list-outputs", action="store_true",
+                    help="Print the files that would be generated (';'-separated) and exit")
+    args = ap.parse_args(argv)
+
+    if not re.fullmatch(r"[A-Za-z_]\w*(::[A-Za-z_]\w*)*", args.namespace):
+        print(f"sbe_codegen: invalid namespace '{args.namespace}'", file=sys.stderr)
+        return 2
+    prefix = args.header_prefix or args.namespace.replace("::", "/")
+
+    try:
+        schema = Parser(ET.parse(args.schema).getroot()).parse()
+    except (SchemaError, ET.ParseError, ValueError, TypeError) as err:
+        print(f"sbe_codegen: {args.schema}: {err}", file=sys.stderr)
+        return 1
+
+    files = outputs(schema, prefix)
+    if args.list_outputs:
+        print(";".join(str(Path(args.output_dir) / f) for f in files))
+        return 0
+
+    schema_file = Path(args.schema).name
+    message_files = [Path(f).name for f, key in files.items() if key not in ("types", "schema")]
+    by_name = {m.name: m for m in schema.messages}
+    for rel, key in files.items():
+        if key == "types":
+            text = emit_types(schema, args.namespace, schema_file)
+        elif key == "schema":
+            text = emit_schema_header(schema, args.namespace, schema_file, message_files)
+        else:
+            text = emit_message(schema, by_name[key], args.namespace, schema_file,
+                                args.max_group_entries)
+        path = Path(args.output_dir) / rel
+        path.parent.mkdir(parents=True, exist_ok=True)
+        # Leave unchanged files alone so dependents are not rebuilt
+        if not path.exists() or path.read_text() != text:
+            path.write_text(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -8,8 +8,11 @@
 #include "nexusfix/transport/winsock_init.hpp"
 #include "nexusfix/transport/winsock_transport.hpp"
 #include "nexusfix/transport/transport_factory.hpp"
+#include "nexusfix/transport/kqueue_transport.hpp"
 
+#include <cstring>
 #include <iostream>
+#include <vector>
 #include <stdexcept>
 
 // Test assertion that works in Release mode (unlike cassert)
@@ -147,6 +150,253 @@ void test_tcp_acceptor() {
     std::cout << "TCP acceptor: PASS\n";
 }
 
+#if NFX_PLATFORM_POSIX
+void test_tcp_busy_poll_receive() {
+    TcpAcceptor acceptor;
+    TEST_ASSERT(acceptor.listen(0).has_value());
+
+    sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    TEST_ASSERT(::getsockname(acceptor.fd(), reinterpret_cast<sockaddr*>(&addr), &len) == 0);
+    uint16_t port = ntohs(addr.sin_port);
+
+    for (ReceiveMode mode : {ReceiveMode::BusySpin, ReceiveMode::Backoff}) {
+        SocketOptions opts = SocketOptions::busy_poll();
+        opts.receive_mode = mode;
+        opts.recv_timeout_ms = 20;
+        TcpTransport transport{opts};
+        TEST_ASSERT(transport.connect("127.0.0.1", port).has_value());
+
+        auto server_fd = acceptor.accept();
+        TEST_ASSERT(server_fd.has_value());
+
+        // Nothing sent yet: spin gives up after recv_timeout_ms
+        char buf[16];
+        auto idle = transport.receive(buf);
+        TEST_ASSERT(idle.has_value() && *idle == 0);
+
+        const char msg[] = "8=FIX.4.4";
+        TEST_ASSERT(::send(*server_fd, msg, sizeof(msg) - 1, 0) == static_cast<IoSize>(sizeof(msg) - 1));
+        auto got = transport.receive(buf);
+        TEST_ASSERT(got.has_value() && *got == sizeof(msg) - 1);
+        TEST_ASSERT(std::memcmp(buf, msg, *got) == 0);
+
+        // Peer close surfaces as an error, not a spin
+        close_socket(*server_fd);
+        auto closed = transport.receive(buf);
+        TEST_ASSERT(!closed.has_value());
+    }
+
+    auto busy = TransportFactory::create(TransportPreference::BusyPoll);
+    TEST_ASSERT(busy != nullptr);
+
+    std::cout << "TCP busy-poll receive: PASS\n";
+}
+
+#if NFX_PLATFORM_LINUX
+void test_tcp_rx_timestamps() {
+    TcpAcceptor acceptor;
+    TEST_ASSERT(acceptor.listen(0).has_value());
+    sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    TEST_ASSERT(::getsockname(acceptor.fd(), reinterpret_cast<sockaddr*>(&addr), &len) == 0);
+
+    SocketOptions opts;
+    opts.rx_timestamps = RxTimestampMode::Software;
+    TcpTransport transport{opts};
+    TEST_ASSERT(!transport.last_rx_timestamp().valid());
+    TEST_ASSERT(transport.connect("127.0.0.1", ntohs(addr.sin_port)).has_value());
+    auto server_fd = acceptor.accept();
+    TEST_ASSERT(server_fd.has_value());
+
+    timespec before{};
+    ::clock_gettime(CLOCK_REALTIME, &before);
+    TEST_ASSERT(::send(*server_fd, "35=0", 4, 0) == 4);
+
+    char buf[16];
+    auto got = transport.receive(buf);
+    TEST_ASSERT(got.has_value() && *got == 4);
+
+    // Loopback gets software stamps, taken after `before` on the same clock
+    RxTimestamp ts = transport.last_rx_timestamp();
+    TEST_ASSERT(ts.source == RxTimestampSource::Software);
+    TEST_ASSERT(ts.ns >= static_cast<int64_t>(before.tv_sec) * 1'000'000'000 + before.tv_nsec);
+    close_socket(*server_fd);
+
+    std::cout << "TCP RX timestamps: PASS\n";
+}
+#endif
+
+/// In-memory stack echoing sent bytes back, to exercise vendor registration
+class LoopbackBypassStack final : public BypassStack {
+public:
+    const char* name() const noexcept override { return "loopback"; }
+    TransportResult<void> connect(std::string_view, uint16_t) noexcept override {
+        connected_ = true;
+        return {};
+    }
+    void close() noexcept override { connected_ = false; }
+    bool is_connected() const noexcept override { return connected_; }
+    TransportResult<size_t> send(std::span<const char> data) noexcept override {
+        pending_.assign(data.begin(), data.end());
+        return data.size();
+    }
+    TransportResult<size_t> try_receive(std::span<char> buffer) noexcept override {
+        size_t n = std::min(buffer.size(), pending_.size());
+        std::memcpy(buffer.data(), pending_.data(), n);
+        pending_.erase(pending_.begin(), pending_.begin() + static_cast<std::ptrdiff_t>(n));
+        return n;
+    }
+    void poll() noexcept override { ++polls; }
+
+    static inline int polls = 0;
+
+private:
+    bool connected_{false};
+    std::vector<char> pending_;
+};
+
+void test_kernel_bypass_transport() {
+    // Registered vendor stack is picked up by the factory
+    register_bypass_stack([](const KernelBypassConfig&) -> std::unique_ptr<BypassStack> {
+        return std::make_unique<LoopbackBypassStack>();
+    });
+    KernelBypassConfig config;
+    config.recv_timeout_ms = 5;
+    auto transport = TransportFactory::create_kernel_bypass(config);
+    TEST_ASSERT(transport != nullptr);
+    auto* bypass = static_cast<KernelBypassTransport*>(transport.get());
+    TEST_ASSERT(std::string_view{bypass->stack_name()} == "loopback");
+
+    TEST_ASSERT(transport->connect("10.0.0.1", 9876).has_value());
+    char buf[16];
+    auto idle = transport->receive(buf);
+    TEST_ASSERT(idle.has_value() && *idle == 0);
+    TEST_ASSERT(LoopbackBypassStack::polls > 0);
+
+    const char msg[] = "35=A";
+    TEST_ASSERT(transport->send(std::span<const char>{msg, 4}).value_or(0) == 4);
+    auto got = transport->receive(buf);
+    TEST_ASSERT(got.has_value() && *got == 4 && std::memcmp(buf, msg, 4) == 0);
+    transport->disconnect();
+    TEST_ASSERT(!transport->is_connected());
+
+    // Without a registration the socket-API stack is used
+    register_bypass_stack(nullptr);
+    KernelBypassTransport fallback;
+    TEST_ASSERT(std::string_view{fallback.stack_name()}.starts_with("socket-api"));
+
+    TcpAcceptor acceptor;
+    TEST_ASSERT(acceptor.listen(0).has_value());
+    sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    TEST_ASSERT(::getsockname(acceptor.fd(), reinterpret_cast<sockaddr*>(&addr), &len) == 0);
+    TEST_ASSERT(fallback.set_receive_timeout(20));
+    TEST_ASSERT(fallback.connect("127.0.0.1", ntohs(addr.sin_port)).has_value());
+    auto server_fd = acceptor.accept();
+    TEST_ASSERT(server_fd.has_value());
+    TEST_ASSERT(::send(*server_fd, msg, 4, 0) == 4);
+    got = fallback.receive(buf);
+    TEST_ASSERT(got.has_value() && *got == 4);
+    close_socket(*server_fd);
+
+#if NFX_AF_XDP_AVAILABLE
+    // AF_XDP without a UserspaceTcp refuses to connect
+    KernelBypassConfig xdp_config;
+    xdp_config.interface_name = "nfx-no-such-if";
+    KernelBypassTransport xdp{std::make_unique<XdpStack>(xdp_config, nullptr)};
+    TEST_ASSERT(!xdp.connect("127.0.0.1", 1).has_value());
+
+    XdpSocket xsk;
+    TEST_ASSERT(!xsk.open(xdp_config).has_value());
+    TEST_ASSERT(!xsk.is_open());
+#endif
+
+    std::cout << "Kernel-bypass transport: PASS\n";
+}
+#endif
+
+#if NFX_ASYNC_IO_KQUEUE
+void test_kqueue_reactor() {
+    int pair_a[2];
+    int pair_b[2];
+    TEST_ASSERT(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair_a) == 0);
+    TEST_ASSERT(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair_b) == 0);
+    TEST_ASSERT(set_socket_nonblocking(pair_a[0], true));
+    TEST_ASSERT(set_socket_nonblocking(pair_b[0], true));
+
+    KqueueReactor reactor;
+    TEST_ASSERT(reactor.init(8).has_value());
+    int ctx_a = 1;
+    int ctx_b = 2;
+    reactor.add(pair_a[0], &ctx_a);
+    reactor.add(pair_b[0], &ctx_b);
+    TEST_ASSERT(reactor.pending_changes() == 4);
+
+    // Both registrations and the wait go out in one kevent() call
+    auto idle = reactor.run_once(0, [](const KqueueEvent&) {});
+    TEST_ASSERT(idle.has_value() && *idle == 0);
+    TEST_ASSERT(reactor.pending_changes() == 0);
+    TEST_ASSERT(reactor.syscalls() == 1);
+
+    TEST_ASSERT(::write(pair_a[1], "35=0", 4) == 4);
+    TEST_ASSERT(::write(pair_b[1], "35=1|", 5) == 5);
+    int seen = 0;
+    int64_t bytes = 0;
+    auto ready = reactor.run_once(100, [&](const KqueueEvent& ev) {
+        TEST_ASSERT(ev.readable);
+        seen |= *static_cast<int*>(ev.context);
+        bytes += ev.available;
+    });
+    TEST_ASSERT(ready.has_value() && *ready == 2);
+    TEST_ASSERT(seen == 3 && bytes == 9);
+
+    // Write readiness is reported only while enabled
+    reactor.set_write_interest(pair_a[0], &ctx_a, true);
+    bool writable = false;
+    TEST_ASSERT(reactor.run_once(100, [&](const KqueueEvent& ev) {
+        writable = writable || (ev.writable && ev.fd == pair_a[0]);
+    }).has_value());
+    TEST_ASSERT(writable);
+
+    // Peer close shows up as EOF
+    reactor.remove(pair_a[0]);
+    ::close(pair_b[1]);
+    bool eof = false;
+    TEST_ASSERT(reactor.run_once(100, [&](const KqueueEvent& ev) {
+        eof = eof || (ev.eof && ev.fd == pair_b[0]);
+    }).has_value());
+    TEST_ASSERT(eof);
+
+    ::close(pair_a[0]);
+    ::close(pair_a[1]);
+    ::close(pair_b[0]);
+
+    // Transport: receive() sleeps in kevent() and wakes on data
+    TcpAcceptor acceptor;
+    TEST_ASSERT(acceptor.listen(0).has_value());
+    sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    TEST_ASSERT(::getsockname(acceptor.fd(), reinterpret_cast<sockaddr*>(&addr), &len) == 0);
+
+    auto transport = TransportFactory::create(TransportPreference::Kqueue);
+    TEST_ASSERT(transport->set_receive_timeout(20));
+    TEST_ASSERT(transport->connect("127.0.0.1", ntohs(addr.sin_port)).has_value());
+    auto server_fd = acceptor.accept();
+    TEST_ASSERT(server_fd.has_value());
+
+    char buf[16];
+    auto timed_out = transport->receive(buf);
+    TEST_ASSERT(timed_out.has_value() && *timed_out == 0);
+    TEST_ASSERT(::send(*server_fd, "35=A", 4, 0) == 4);
+    auto got = transport->receive(buf);
+    TEST_ASSERT(got.has_value() && *got == 4 && std::memcmp(buf, "35=A", 4) == 0);
+    close_socket(*server_fd);
+
+    std::cout << "kqueue reactor and transport: PASS\n";
+}
+#endif
+
 void test_new_error_codes() {
     // Verify new error codes exist and have messages
     TransportError err;
@@ -238,6 +488,16 @@ int main() {
     test_tcp_socket();
     test_tcp_transport();
     test_tcp_acceptor();
+#if NFX_PLATFORM_POSIX
+    test_tcp_busy_poll_receive();
+    test_kernel_bypass_transport();
+#endif
+#if NFX_PLATFORM_LINUX
+    test_tcp_rx_timestamps();
+#endif
+#if NFX_ASYNC_IO_KQUEUE
+    test_kqueue_reactor();
+#endif
     test_new_error_codes();
     test_transport_factory();
     test_winsock_init_stub();
@@ -0,0 +1,405 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nexusfix/fast/fast.hpp"
+
+using namespace nfx;
+using namespace nfx::fast;
+
+namespace {
+
+/// Minimal FAST encoder for building test messages
+struct Encoder {
+    std::string bytes;
+
+    Encoder& uint(uint64_t v) {
+        char groups[10];
+        size_t n = 0;
+        do {
+            groups[n++] = static_cast<char>(v & 0x7F);
+            v >>= 7;
+        } while (v != 0);
+        for (size_t i = n; i-- > 0;) bytes += groups[i];
+        bytes.back() = static_cast<char>(bytes.back() | 0x80);
+        return *this;
+    }
+
+    Encoder& sint(int64_t v) {
+        char groups[10];
+        size_t n = 0;
+        for (;;) {
+            groups[n++] = static_cast<char>(v & 0x7F);
+            const int64_t rest = v >> 7;
+            // Stop once the sign bit (bit 6) of this group matches the rest
+            if ((rest == 0 && !(groups[n - 1] & 0x40)) || (rest == -1 && (groups[n - 1] & 0x40))) break;
+            v = rest;
+        }
+        for (size_t i = n; i-- > 0;) bytes += groups[i];
+        bytes.back() = static_cast<char>(bytes.back() | 0x80);
+        return *this;
+    }
+
+    Encoder& null() { return uint(0); }
+
+    Encoder& ascii(std::string_view s) {
+        if (s.empty()) {
+            bytes += static_cast<char>(0x80);
+            return *this;
+        }
+        bytes += s;
+        bytes.back() = static_cast<char>(bytes.back() | 0x80);
+        return *this;
+    }
+
+    /// Presence map from bits, most significant first
+    Encoder& pmap(std::initializer_list<bool> bits) {
+        std::string out;
+        char byte = 0;
+        int used = 0;
+        for (bool b : bits) {
+            byte = static_cast<char>((byte << 1) | (b ? 1 : 0));
+            if (++used == 7) {
+                out += byte;
+                byte = 0;
+                used = 0;
+            }
+        }
+        if (used > 0 || out.empty()) out += static_cast<char>(byte << (7 - used));
+        out.back() = static_cast<char>(out.back() | 0x80);
+        bytes += out;
+        return *this;
+    }
+
+    [[nodiscard]] std::span<const char> span() const { return {bytes.data(), bytes.size()}; }
+};
+
+/// Collects every present field
+struct Recorder {
+    std::vector<std::pair<uint32_t, FieldValue>> fields;
+    std::vector<std::string> texts;
+    uint32_t sequence_length{0};
+
+    void on_field(const FieldDef& def, const FieldValue& value) {
+        fields.emplace_back(def.tag, value);
+        texts.emplace_back(value.text);
+    }
+    void on_sequence(const FieldDef&, uint32_t length) { sequence_length = length; }
+};
+
+} // namespace
+
+// ============================================================================
+// Primitives
+// ============================================================================
+
+TEST_CASE("FAST stop-bit integers", "[fast][primitives]") {
+    SECTION("Unsigned, fast path and tail of the buffer") {
+        for (uint64_t v : std::initializer_list<uint64_t>{
+                 0ULL, 1ULL, 127ULL, 128ULL, 16383ULL, 942755ULL,
+                 (1ULL << 56) - 1, 1ULL << 56, UINT64_MAX}) {
+            Encoder e;
+            e.uint(v);
+            Reader tail{e.span()};
+            REQUIRE(tail.read_uint().value() == v);
+            REQUIRE(tail.at_end());
+
+            e.bytes += std::string(8, '\x80');   // Room for the 8-byte load
+            Reader padded{e.span()};
+            REQUIRE(padded.read_uint().value() == v);
+            REQUIRE(padded.position() == e.bytes.size() - 8);
+        }
+    }
+
+    SECTION("Signed values sign-extend") {
+        for (int64_t v : std::initializer_list<int64_t>{
+                 0LL, 1LL, -1LL, 63LL, 64LL, -64LL, -65LL, 942755LL, -7942755LL,
+                 INT64_MAX, INT64_MIN}) {
+            Encoder e;
+            e.sint(v).sint(v);
+            Reader r{e.span()};
+            REQUIRE(r.read_int().value() == v);
+            REQUIRE(r.read_int().value() == v);
+        }
+    }
+
+    SECTION("Nullable values are offset by one") {
+        Encoder e;
+        e.null().uint(1).uint(6).sint(0).sint(-3);
+        Reader r{e.span()};
+        bool present = true;
+        REQUIRE(r.read_nullable_uint(present).value() == 0);
+        REQUIRE_FALSE(present);
+        REQUIRE(r.read_nullable_uint(present).value() == 0);
+        REQUIRE(present);
+        REQUIRE(r.read_nullable_uint(present).value() == 5);
+        REQUIRE(r.read_nullable_int(present).value() == 0);
+        REQUIRE_FALSE(present);
+        REQUIRE(r.read_nullable_int(present).value() == -3);
+        REQUIRE(present);
+    }
+
+    SECTION("Truncated and overlong input") {
+        const std::string missing_stop = "\x01\x02";
+        Reader truncated{std::span<const char>{missing_stop.data(), missing_stop.size()}};
+        REQUIRE(truncated.read_uint().error() == FastError::Truncated);
+
+        const std::string eleven(11, '\x01');
+        Reader overlong{std::span<const char>{eleven.data(), eleven.size()}};
+        REQUIRE(overlong.read_uint().error() == FastError::Overlong);
+    }
+}
+
+TEST_CASE("FAST strings and presence maps", "[fast][primitives]") {
+    SECTION("find_stop_bit across SIMD, SWAR and scalar steps") {
+        std::string data(40, 'a');
+        for (size_t at : {0u, 7u, 15u, 16u, 31u, 39u}) {
+            std::string s = data;
+            s[at] = static_cast<char>('z' | 0x80);
+            REQUIRE(find_stop_bit({s.data(), s.size()}, 0) == at);
+        }
+        REQUIRE(find_stop_bit({data.data(), data.size()}, 0) == data.size());
+    }
+
+    SECTION("ASCII with null and empty encodings") {
+        Encoder e;
+        e.ascii("AAPL").ascii("").bytes += std::string{"\x00\x80", 2};
+        std::array<char, 16> buf{};
+        bool present = false;
+
+        Reader r{e.span()};
+        auto len = r.read_ascii(buf, false, present);
+        REQUIRE(std::string_view{buf.data(), len.value()} == "AAPL");
+        REQUIRE(present);
+
+        REQUIRE(r.read_ascii(buf, true, present).value() == 0);
+        REQUIRE_FALSE(present);
+        REQUIRE(r.read_ascii(buf, true, present).value() == 0);
+        REQUIRE(present);
+        REQUIRE(r.at_end());
+
+        Reader small{e.span()};
+        REQUIRE(small.read_ascii(std::span<char>{buf.data(), 3}, false, present).error() ==
+                FastError::TextTooLong);
+    }
+
+    SECTION("Presence map bits past the encoded bytes read as zero") {
+        Encoder e;
+        e.pmap({true, false, true, true, false, false, false, true});
+        Reader r{e.span()};
+        auto pmap = PresenceMap::read(r);
+        REQUIRE(pmap.has_value());
+        for (bool expected : {true, false, true, true, false, false, false, true, false, false}) {
+            REQUIRE(pmap->next() == expected);
+        }
+    }
+}
+
+// ============================================================================
+// Decoder
+// ============================================================================
+
+TEST_CASE("FAST decoder applies field operators", "[fast][decoder]") {
+    TemplateRegistry templates;
+    REQUIRE(templates.add(7, {
+        {.tag = 34, .type = FieldType::UInt32, .op = Operator::Increment},
+        {.tag = 35, .type = FieldType::Ascii, .op = Operator::Constant,
+         .has_initial = true, .initial_text = "X"},
+        {.tag = 55, .type = FieldType::Ascii, .op = Operator::Copy},
+        {.tag = 270, .type = FieldType::Decimal, .op = Operator::Delta},
+        {.tag = 271, .type = FieldType::Int64, .op = Operator::Default,
+         .presence = Presence::Optional},
+        {.tag = 278, .type = FieldType::Ascii, .op = Operator::Tail},
+        {.tag = 336, .type = FieldType::Ascii, .op = Operator::Delta},
+    }).has_value());
+
+    Decoder decoder{templates};
+
+    // Message 1: pmap(tid, 34, 55, 271, 278), everything sent explicitly
+    Encoder first;
+    first.pmap({true, true, true, true, true})
+        .uint(7)
+        .uint(100)
+        .ascii("ESZ5")
+        .sint(-2).sint(450025)        // 4500.25
+        .uint(11)                      // Nullable: 10
+        .ascii("ORD0001")
+        .sint(0).ascii("OPEN");
+
+    Recorder r1;
+    auto used = decoder.decode(first.span(), r1);
+    REQUIRE(used.value() == first.bytes.size());
+    REQUIRE(r1.fields.size() == 7);
+    REQUIRE(r1.fields[0].second.integer == 100);
+    REQUIRE(r1.texts[1] == "X");
+    REQUIRE(r1.texts[2] == "ESZ5");
+    REQUIRE(r1.fields[3].second.as_price() == FixedPrice::from_double(4500.25));
+    REQUIRE(r1.fields[4].second.as_qty().raw == 10 * Qty::SCALE);
+    REQUIRE(r1.texts[5] == "ORD0001");
+    REQUIRE(r1.texts[6] == "OPEN");
+
+    // Message 2: template id, 34 and 55 from the dictionary; deltas and tail
+    Encoder second;
+    second.pmap({false, false, false, false, true})
+        .sint(0).sint(-25)            // 4500.00
+        .ascii("02")                   // Tail: ORD0002
+        .sint(2).ascii("EN");          // Drop "EN", append: OPEN
+
+    Recorder r2;
+    REQUIRE(decoder.decode(second.span(), r2).value() == second.bytes.size());
+    REQUIRE(r2.fields.size() == 6);   // 271 absent: optional default without initial
+    REQUIRE(r2.fields[0].second.integer == 101);
+    REQUIRE(r2.texts[2] == "ESZ5");
+    REQUIRE(r2.fields[3].second.as_price() == FixedPrice::from_double(4500.0));
+    REQUIRE(r2.texts[4] == "ORD0002");
+    REQUIRE(r2.texts[5] == "OPEN");
+
+    // Negative subtraction length edits the front
+    Encoder third;
+    third.pmap({false, false, false, false, false})
+        .sint(0).sint(0)
+        .sint(-3).ascii("PRE_");       // Drop "OP", prepend: PRE_EN
+
+    Recorder r3;
+    REQUIRE(decoder.decode(third.span(), r3).has_value());
+    REQUIRE(r3.texts.back() == "PRE_EN");
+
+    SECTION("reset() forgets the dictionary") {
+        decoder.reset();
+        Recorder r4;
+        REQUIRE(decoder.decode(second.span(), r4).error() == FastError::UnknownTemplate);
+    }
+}
+
+TEST_CASE("FAST decoder rejects bad input and templates", "[fast][decoder]") {
+    TemplateRegistry templates;
+    REQUIRE(templates.add(1, {
+        {.tag = 34, .type = FieldType::UInt32, .op = Operator::Copy},
+    }).has_value());
+
+    SECTION("Invalid operator for the type") {
+        REQUIRE(templates.add(2, {
+            {.tag = 55, .type = FieldType::Ascii, .op = Operator::Increment},
+        }).error() == FastError::UnsupportedOperator);
+        REQUIRE(templates.add(3, {
+            {.tag = 34, .type = FieldType::UInt32, .op = Operator::Constant},
+        }).error() == FastError::MandatoryAbsent);
+    }
+
+    Decoder decoder{templates};
+
+    SECTION("Mandatory copy field with nothing to copy") {
+        Encoder e;
+        e.pmap({true, false}).uint(1);
+        Recorder r;
+        REQUIRE(decoder.decode(e.span(), r).error() == FastError::MandatoryAbsent);
+    }
+
+    SECTION("Unknown template and truncated message") {
+        Encoder unknown;
+        unknown.pmap({true}).uint(99);
+        Recorder r;
+        REQUIRE(decoder.decode(unknown.span(), r).error() == FastError::UnknownTemplate);
+
+        Encoder cut;
+        cut.pmap({true, true}).uint(1);
+        Recorder r2;
+        REQUIRE(decoder.decode(cut.span(), r2).error() == FastError::Truncated);
+    }
+}
+
+// ============================================================================
+// Market Data
+// ============================================================================
+
+namespace {
+
+void add_md_template(TemplateRegistry& templates) {
+    REQUIRE(templates.add(120, {
+        {.tag = 34, .type = FieldType::UInt32, .op = Operator::Increment},
+        {.tag = 55, .type = FieldType::Ascii, .op = Operator::Copy},
+        {.tag = 268, .type = FieldType::Sequence, .children = 6},
+        {.tag = 279, .type = FieldType::UInt32, .op = Operator::Copy},
+        {.tag = 269, .type = FieldType::Ascii, .op = Operator::Copy},
+        {.tag = 270, .type = FieldType::Decimal, .op = Operator::Delta},
+        {.tag = 271, .type = FieldType::Int64, .op = Operator::Delta},
+        {.tag = 290, .type = FieldType::UInt32, .op = Operator::Increment,
+         .has_initial = true, .initial = 1},
+        {.tag = 346, .type = FieldType::UInt32, .op = Operator::None,
+         .presence = Presence::Optional},
+    }).has_value());
+}
+
+/// Incremental refresh: bid 1 @ 4500.25 x 10, bid 2 @ 4500.00 x 25 (delete),
+/// offer 1 @ 4500.50 x 7
+Encoder md_message() {
+    Encoder e;
+    e.pmap({true, true, true}).uint(120).uint(500).ascii("ESZ5").uint(3);
+    // Element pmap bits: 279, 269, 290
+    e.pmap({true, true, true}).uint(0).ascii("0").sint(-2).sint(450025).sint(10).uint(1).uint(4);
+    e.pmap({true, false, false}).uint(2).sint(0).sint(-25).sint(15).null();
+    e.pmap({true, true, true}).uint(0).ascii("1").sint(0).sint(50).sint(-18).uint(1).uint(2);
+    return e;
+}
+
+} // namespace
+
+TEST_CASE("FAST market data fills MDEntryColumns", "[fast][market_data]") {
+    TemplateRegistry templates;
+    add_md_template(templates);
+    Decoder decoder{templates};
+    const Encoder msg = md_message();
+
+    MDEntryColumns<4> columns;
+    auto used = decode_md_columns(decoder, msg.span(), columns);
+    REQUIRE(used.value() == msg.bytes.size());
+    REQUIRE(columns.size() == 3);
+    REQUIRE_FALSE(columns.truncated);
+
+    REQUIRE(columns.prices[0] == FixedPrice::from_double(4500.25));
+    REQUIRE(columns.prices[1] == FixedPrice::from_double(4500.00));
+    REQUIRE(columns.prices[2] == FixedPrice::from_double(4500.50));
+    REQUIRE(columns.sizes[0].raw == 10 * Qty::SCALE);
+    REQUIRE(columns.sizes[1].raw == 25 * Qty::SCALE);
+    REQUIRE(columns.sizes[2].raw == 7 * Qty::SCALE);
+    REQUIRE(columns.types[1] == MDEntryType::Bid);
+    REQUIRE(columns.types[2] == MDEntryType::Offer);
+    REQUIRE(columns.actions[0] == MDUpdateAction::New);
+    REQUIRE(columns.actions[1] == MDUpdateAction::Delete);
+    REQUIRE(columns.levels[0] == 1);
+    REQUIRE(columns.levels[1] == 2);   // Incremented from the dictionary
+    REQUIRE(columns.levels[2] == 1);
+
+    MDEntryColumns<2> small;
+    REQUIRE(decode_md_columns(decoder, md_message().span(), small).has_value());
+    REQUIRE(small.size() == 2);
+    REQUIRE(small.truncated);
+}
+
+TEST_CASE("FAST market data fills MDEntry rows", "[fast][market_data]") {
+    TemplateRegistry templates;
+    add_md_template(templates);
+    Decoder decoder{templates};
+    const Encoder msg = md_message();
+
+    std::array<MDEntry, 8> entries{};
+    size_t count = 0;
+    REQUIRE(decode_md_entries(decoder, msg.span(), entries, count).has_value());
+    REQUIRE(count == 3);
+    REQUIRE(entries[0].symbol == "ESZ5");   // Message-level Symbol
+    REQUIRE(entries[0].is_bid());
+    REQUIRE(entries[0].price_raw == FixedPrice::from_double(4500.25).raw);
+    REQUIRE(entries[0].number_of_orders == 3);
+    REQUIRE(entries[1].number_of_orders == 0);
+    REQUIRE(entries[1].update_action == MDUpdateAction::Delete);
+    REQUIRE(entries[2].is_offer());
+    REQUIRE(entries[2].size_raw == 7 * Qty::SCALE);
+    REQUIRE(entries[2].position_no == 1);
+}
@@ -1,9 +1,18 @@
 #include <catch2/catch_test_macros.hpp>
 #include <string>
 #include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "nexusfix/messages/fix44/market_data.hpp"
+#include "nexusfix/messages/fix44/mass_quote.hpp"
 #include "nexusfix/messages/common/trailer.hpp"
+#include "nexusfix/book/order_book.hpp"
+#include "nexusfix/book/mbo_book.hpp"
+#include "nexusfix/book/snapshot_encoder.hpp"
+#include "nexusfix/transport/multicast_receiver.hpp"
+#include "nexusfix/transport/line_arbitrator.hpp"
 
 using namespace nfx;
 using namespace nfx::fix44;
@@ -156,6 +165,110 @@ TEST_CASE("MarketDataSnapshotFullRefresh Parser - Iterate entries", "[market_dat
     REQUIRE_FALSE(iter.has_next());
 }
 
+TEST_CASE("RepeatingGroupIterator indexes entries in one walk", "[market_data][iterator]") {
+    SECTION("Entry boundaries and indexed fields") {
+        std::string raw = make_fix_message("55=AAPL|268=100|");
+        for (int level = 0; level < 100; ++level) {
+            raw += make_fix_message("269=" + std::string{level % 2 == 0 ? "0" : "1"} +
+                "|270=" + std::to_string(100 + level) + ".25|271=" + std::to_string(level + 1) +
+                "|290=" + std::to_string(level / 2 + 1) + "|346=3|");
+        }
+        raw += make_fix_message("10=000|");
+
+        parser::MDEntryIterator iter{std::span<const char>{raw.data(), raw.size()}, 100};
+        int level = 0;
+        while (iter.has_next()) {
+            const auto entry = iter.next_entry();
+            REQUIRE(entry.field_count() == 5);
+            REQUIRE_FALSE(entry.overflowed());
+            REQUIRE(entry.field_at(0).tag == tag::MDEntryType::value);
+            REQUIRE(entry.get_char(tag::MDEntryType::value) == (level % 2 == 0 ? '0' : '1'));
+            REQUIRE(entry.get_price(tag::MDEntryPx::value).raw ==
+                    FixedPrice::from_double(100 + level + 0.25).raw);
+            REQUIRE(entry.get_int(tag::MDEntrySize::value) == level + 1);
+            REQUIRE(entry.get_int(tag::NumberOfOrders::value) == 3);
+            REQUIRE_FALSE(entry.get_field(tag::Symbol::value).is_valid());
+            // Boundaries: entries tile the group, the last stops before CheckSum
+            REQUIRE(raw.compare(entry.start_pos, 4, "269=") == 0);
+            REQUIRE(entry.data.size() == entry.end_pos - entry.start_pos);
+            ++level;
+        }
+        REQUIRE(level == 100);
+    }
+
+    SECTION("Fields beyond MAX_ENTRY_FIELDS are still found") {
+        std::string raw = make_fix_message("268=1|269=2|");
+        for (int t = 5000; t < 5020; ++t) {
+            raw += make_fix_message(std::to_string(t) + "=" + std::to_string(t) + "|");
+        }
+        raw += make_fix_message("10=000|");
+
+        parser::RepeatingGroupIterator iter{std::span<const char>{raw.data(), raw.size()},
+                                            tag::MDEntryType::value, 1};
+        const auto entry = iter.next();
+        REQUIRE(entry.overflowed());
+        REQUIRE(entry.field_count() == parser::RepeatingGroupIterator::MAX_ENTRY_FIELDS);
+        REQUIRE(entry.get_int(5000) == 5000);
+        REQUIRE(entry.get_int(5019) == 5019);
+        REQUIRE_FALSE(entry.get_field(10).is_valid());
+
+        size_t visited = 0;
+        entry.for_each_field([&visited](const FieldView&) noexcept { ++visited; });
+        REQUIRE(visited == 21);
+    }
+}
+
+TEST_CASE("MarketData groups decode into SoA columns", "[market_data][columns]") {
+    SECTION("Snapshot") {
+        std::string raw = make_fix_message("55=GOOGL|268=3|"
+            "269=0|270=2800.50|271=200|290=1|"
+            "269=1|270=2801.00|271=150|290=1|"
+            "269=2|270=2800.75|271=5|"
+            "10=000|");
+        MarketDataSnapshotFullRefresh msg;
+        msg.raw_data = std::span<const char>{raw.data(), raw.size()};
+        msg.no_md_entries = 3;
+
+        MDEntryColumns<8> cols;
+        REQUIRE(msg.decode_columns(cols) == 3);
+        REQUIRE_FALSE(cols.truncated);
+        REQUIRE(cols.types[0] == MDEntryType::Bid);
+        REQUIRE(cols.types[1] == MDEntryType::Offer);
+        REQUIRE(cols.types[2] == MDEntryType::Trade);
+        REQUIRE(cols.prices[0].raw == FixedPrice::from_string("2800.50").raw);
+        REQUIRE(cols.prices[2].raw == FixedPrice::from_string("2800.75").raw);
+        REQUIRE(cols.sizes[1].raw == Qty::from_string("150").raw);
+        REQUIRE(cols.levels[0] == 1);
+        REQUIRE(cols.levels[2] == 0);
+        for (MDUpdateAction a : cols.action_column()) REQUIRE(a == MDUpdateAction::New);
+    }
+
+    SECTION("Incremental, with truncation past capacity") {
+        std::string raw = make_fix_message("268=3|"
+            "279=0|269=0|270=10.5|271=100|290=1|"
+            "279=2|269=1|270=11.25|271=0|"
+            "279=1|269=0|270=10.25|271=300|"
+            "10=000|");
+        MarketDataIncrementalRefresh msg;
+        msg.raw_data = std::span<const char>{raw.data(), raw.size()};
+        msg.no_md_entries = 3;
+
+        MDEntryColumns<4> cols;
+        REQUIRE(msg.decode_columns(cols) == 3);
+        REQUIRE(cols.actions[0] == MDUpdateAction::New);
+        REQUIRE(cols.actions[1] == MDUpdateAction::Delete);
+        REQUIRE(cols.actions[2] == MDUpdateAction::Change);
+        REQUIRE(cols.types[1] == MDEntryType::Offer);
+        REQUIRE(cols.prices[1].raw == FixedPrice::from_string("11.25").raw);
+        REQUIRE(cols.sizes[2].raw == Qty::from_string("300").raw);
+
+        MDEntryColumns<2> small;
+        REQUIRE(msg.decode_columns(small) == 2);
+        REQUIRE(small.truncated);
+        REQUIRE(small.price_column().size() == 2);
+    }
+}
+
 // ============================================================================
 // MarketDataIncrementalRefresh Tests
 // ============================================================================
@@ -220,6 +333,515 @@ TEST_CASE("MarketDataIncrementalRefresh Parser - Update actions", "[market_data]
     REQUIRE(e3.entry_type == MDEntryType::Offer);
 }
 
+// ============================================================================
+// Order Book Tests
+// ============================================================================
+
+namespace {
+
+/// Wrap "35=..|...|" body fields with BeginString, BodyLength and CheckSum
+std::string frame_md(std::string_view body) {
+    std::string b = make_fix_message(body);
+    std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(b.size()) + "\x01" + b;
+    auto cs = fix::format_checksum(
+        fix::calculate_checksum(std::span<const char>{msg.data(), msg.size()}));
+    return msg + "10=" + std::string{cs.data(), 3} + "\x01";
+}
+
+template <typename Msg>
+Msg parse_md(const std::string& raw) {
+    auto result = Msg::from_buffer(std::span<const char>{raw.data(), raw.size()});
+    REQUIRE(result.has_value());
+    return *result;
+}
+
+} // namespace
+
+TEST_CASE("BookCache applies snapshot and incremental refresh", "[market_data][book]") {
+    auto cache = std::make_unique<book::BookCache<8, 4>>();
+
+    std::string snapshot = frame_md(
+        "35=W|49=SERVER|56=CLIENT|34=1|52=20260122-10:00:00.000|"
+        "55=MSFT|268=4|"
+        "269=0|270=399.90|271=100|"
+        "269=0|270=400.00|271=200|"
+        "269=1|270=400.10|271=300|"
+        "269=1|270=400.20|271=50|");
+    REQUIRE(cache->apply(parse_md<MarketDataSnapshotFullRefresh>(snapshot)) == 4);
+
+    const auto* msft = cache->find("MSFT");
+    REQUIRE(msft != nullptr);
+    REQUIRE(cache->find("AAPL") == nullptr);
+
+    auto top = msft->top();
+    REQUIRE(top.bid() == FixedPrice::from_string("400.00"));
+    REQUIRE(top.bid_size_raw == Qty::from_int(200).raw);
+    REQUIRE(top.ask() == FixedPrice::from_string("400.10"));
+    REQUIRE(top.msg_seq_num == 1);
+    REQUIRE(msft->bids().size() == 2);
+    REQUIRE(msft->bids()[1].price_raw == FixedPrice::from_string("399.90").raw);
+    uint64_t version = msft->version();
+
+    SECTION("Incremental updates move the top once per message") {
+        std::string update = frame_md(
+            "35=X|49=SERVER|56=CLIENT|34=2|52=20260122-10:00:01.000|"
+            "268=3|"
+            "279=0|269=0|55=MSFT|270=400.05|271=10|"
+            "279=2|269=1|270=400.10|"
+            "279=1|269=1|270=400.20|271=75|");
+        REQUIRE(cache->apply(parse_md<MarketDataIncrementalRefresh>(update)) == 3);
+
+        top = msft->top();
+        REQUIRE(top.bid() == FixedPrice::from_string("400.05"));
+        REQUIRE(top.ask() == FixedPrice::from_string("400.20"));
+        REQUIRE(top.ask_size_raw == Qty::from_int(75).raw);
+        REQUIRE(top.msg_seq_num == 2);
+        REQUIRE(msft->version() == version + 1);
+        REQUIRE(msft->bids().size() == 3);
+    }
+
+    SECTION("DeleteThru clears the top levels of a side") {
+        std::string update = frame_md(
+            "35=X|49=SERVER|56=CLIENT|34=2|52=20260122-10:00:01.000|"
+            "268=1|279=3|269=0|55=MSFT|290=1|");
+        REQUIRE(cache->apply(parse_md<MarketDataIncrementalRefresh>(update)) == 1);
+        REQUIRE(msft->bids().size() == 1);
+        REQUIRE(msft->top().bid() == FixedPrice::from_string("399.90"));
+    }
+
+    SECTION("Unchanged quote does not publish a new version") {
+        std::string same_quote = frame_md(
+            "35=X|49=SERVER|56=CLIENT|34=2|52=20260122-10:00:01.000|"
+            "268=1|279=1|269=0|55=MSFT|270=399.90|271=100|");
+        REQUIRE(cache->apply(parse_md<MarketDataIncrementalRefresh>(same_quote)) == 1);
+        REQUIRE(msft->version() == version);
+    }
+
+    SECTION("Depth is capped; worse levels are dropped") {
+        std::string update = frame_md(
+            "35=X|49=SERVER|56=CLIENT|34=2|52=20260122-10:00:01.000|"
+            "268=4|"
+            "279=0|269=0|55=MSFT|270=399.80|271=1|"
+            "279=0|269=0|270=399.70|271=1|"
+            "279=0|269=0|270=399.60|271=1|"
+            "279=0|269=0|270=400.01|271=1|");
+        REQUIRE(cache->apply(parse_md<MarketDataIncrementalRefresh>(update)) == 4);
+        REQUIRE(msft->bids().size() == 4);
+        REQUIRE(msft->bids()[0].price_raw == FixedPrice::from_string("400.01").raw);
+        REQUIRE(msft->bids()[3].price_raw == FixedPrice::from_string("399.80").raw);
+    }
+}
+
+TEST_CASE("MboBook keeps order queues and aggregated levels", "[market_data][book][mbo]") {
+    using book::MboBook;
+    auto mbo = std::make_unique<MboBook<64, 16>>("MSFT");
+    const auto px = [](const char* p) { return FixedPrice::from_string(p).raw; };
+    const auto qty = [](int64_t q) { return Qty::from_int(q).raw; };
+
+    REQUIRE(mbo->add(1, MDEntryType::Bid, px("400.00"), qty(100)));
+    REQUIRE(mbo->add(2, MDEntryType::Bid, px("400.00"), qty(50)));
+    REQUIRE(mbo->add(3, MDEntryType::Bid, px("399.90"), qty(70)));
+    REQUIRE(mbo->add(4, MDEntryType::Offer, px("400.20"), qty(30)));
+    REQUIRE(mbo->add(5, MDEntryType::Offer, px("400.10"), qty(10)));
+    REQUIRE_FALSE(mbo->add(1, MDEntryType::Bid, px("398.00"), qty(1)));   // Duplicate id
+    REQUIRE_FALSE(mbo->add(9, MDEntryType::Trade, px("400.00"), qty(1)));
+    REQUIRE(mbo->order_count() == 5);
+
+    REQUIRE(mbo->depth(MDEntryType::Bid) == 2);
+    const auto* best_bid = mbo->level(MDEntryType::Bid, 0);
+    REQUIRE(best_bid->price_raw == px("400.00"));
+    REQUIRE(best_bid->size_raw == qty(150));
+    REQUIRE(best_bid->orders == 2);
+    REQUIRE(best_bid->head->order_id == 1);
+    REQUIRE(best_bid->tail->order_id == 2);
+    REQUIRE(mbo->level(MDEntryType::Offer, 0)->price_raw == px("400.10"));
+    REQUIRE(mbo->level(MDEntryType::Offer, 2) == nullptr);
+
+    SECTION("A smaller quantity keeps queue position, a larger one loses it") {
+        REQUIRE(mbo->modify(1, px("400.00"), qty(80)));
+        REQUIRE(best_bid->head->order_id == 1);
+        REQUIRE(best_bid->size_raw == qty(130));
+
+        REQUIRE(mbo->modify(1, px("400.00"), qty(120)));
+        REQUIRE(best_bid->head->order_id == 2);
+        REQUIRE(best_bid->tail->order_id == 1);
+        REQUIRE(best_bid->size_raw == qty(170));
+    }
+
+    SECTION("A price change moves the order and empties levels") {
+        REQUIRE(mbo->modify(3, px("400.05"), qty(70)));
+        REQUIRE(mbo->depth(MDEntryType::Bid) == 2);
+        REQUIRE(mbo->level(MDEntryType::Bid, 0)->price_raw == px("400.05"));
+        REQUIRE(mbo->level_at(MDEntryType::Bid, px("399.90")) == nullptr);
+        REQUIRE(mbo->find(3)->level == mbo->level(MDEntryType::Bid, 0));
+    }
+
+    SECTION("Executions and deletes shrink the aggregates") {
+        REQUIRE(mbo->execute(5, qty(4)));
+        REQUIRE(mbo->level(MDEntryType::Offer, 0)->size_raw == qty(6));
+        REQUIRE(mbo->execute(5, qty(6)));
+        REQUIRE(mbo->find(5) == nullptr);
+        REQUIRE(mbo->level(MDEntryType::Offer, 0)->price_raw == px("400.20"));
+
+        REQUIRE(mbo->remove(1));
+        REQUIRE_FALSE(mbo->remove(1));
+        REQUIRE(mbo->level(MDEntryType::Bid, 0)->head->order_id == 2);
+        REQUIRE(mbo->level(MDEntryType::Bid, 0)->head->prev == nullptr);
+
+        std::array<book::PriceLevel, 4> levels{};
+        REQUIRE(mbo->copy_levels(MDEntryType::Bid, levels) == 2);
+        REQUIRE(levels[0].size_raw == qty(50));
+        REQUIRE(levels[1].price_raw == px("399.90"));
+
+        REQUIRE(mbo->publish(7));
+        auto top = mbo->top();
+        REQUIRE(top.bid_price_raw == px("400.00"));
+        REQUIRE(top.ask_price_raw == px("400.20"));
+        REQUIRE(top.last_price_raw == px("400.10"));
+        REQUIRE(top.last_size_raw == qty(6));
+    }
+
+    SECTION("Pools bound the book") {
+        auto small = std::make_unique<MboBook<3, 2>>();
+        REQUIRE(small->add(1, MDEntryType::Bid, px("1"), qty(1)));
+        REQUIRE(small->add(2, MDEntryType::Bid, px("2"), qty(1)));
+        REQUIRE_FALSE(small->add(3, MDEntryType::Offer, px("3"), qty(1)));  // No level left
+        REQUIRE(small->find(3) == nullptr);
+        REQUIRE(small->add(3, MDEntryType::Bid, px("2"), qty(1)));
+        REQUIRE_FALSE(small->add(4, MDEntryType::Bid, px("2"), qty(1)));    // No order left
+        small->clear();
+        REQUIRE(small->order_count() == 0);
+        REQUIRE(small->depth(MDEntryType::Bid) == 0);
+        REQUIRE(small->add(4, MDEntryType::Offer, px("3"), qty(1)));
+    }
+
+    SECTION("Incremental refresh entries keyed by MDEntryID") {
+        std::string update = frame_md(
+            "35=X|49=SERVER|56=CLIENT|34=3|52=20260122-10:00:01.000|"
+            "268=5|"
+            "279=0|269=0|55=MSFT|278=10|270=400.01|271=5|"
+            "279=1|269=0|278=2|270=400.00|271=20|"
+            "279=2|269=1|278=5|"
+            "279=0|269=0|55=AAPL|278=11|270=150|271=1|"
+            "279=0|269=1|55=MSFT|278=A-12|270=400.30|271=3|");
+        REQUIRE(mbo->apply(parse_md<MarketDataIncrementalRefresh>(update)) == 4);
+
+        REQUIRE(mbo->level(MDEntryType::Bid, 0)->price_raw == px("400.01"));
+        REQUIRE(mbo->find(2)->qty_raw == qty(20));
+        REQUIRE(mbo->find(11) == nullptr);
+        REQUIRE(mbo->find(MboBook<>::order_id_of("A-12")) != nullptr);
+        REQUIRE(mbo->top().ask_price_raw == px("400.20"));
+        REQUIRE(mbo->top().msg_seq_num == 3);
+    }
+}
+
+TEST_CASE("SnapshotEncoder re-encodes only changed levels", "[market_data][book][snapshot]") {
+    using book::PriceLevel;
+    auto px = [](const char* s) { return FixedPrice::from_string(s).raw; };
+    auto qty = [](int64_t q) { return Qty::from_int(q).raw; };
+
+    std::vector<PriceLevel> bids{{px("400.00"), qty(200), 2}, {px("399.90"), qty(100), 0}};
+    std::vector<PriceLevel> asks{{px("400.10"), qty(300), 1}, {px("400.20"), qty(50), 0}};
+
+    auto encoder = std::make_unique<book::SnapshotEncoder<4>>();
+    encoder->prepare("FIX.4.4", "SERVER", "CLIENT", "MSFT", "MD7");
+    encoder->update(bids, asks);
+    REQUIRE(encoder->encoded_levels() == 4);
+
+    // Same bytes as a snapshot encoded from scratch, valid BodyLength/CheckSum
+    auto fresh = [&](uint32_t seq) {
+        auto other = std::make_unique<book::SnapshotEncoder<4>>();
+        other->prepare("FIX.4.4", "SERVER", "CLIENT", "MSFT", "MD7");
+        other->update(bids, asks);
+        auto out = other->build(seq, "20260122-10:00:00.000");
+        return std::string{out.data(), out.size()};
+    };
+    auto check = [&](uint32_t seq) {
+        auto out = encoder->build(seq, "20260122-10:00:00.000");
+        std::string msg{out.data(), out.size()};
+        REQUIRE(msg == fresh(seq));
+        REQUIRE(checksum::validate(out).ok());
+        auto snapshot = parse_md<MarketDataSnapshotFullRefresh>(msg);
+        REQUIRE(snapshot.symbol == "MSFT");
+        REQUIRE(snapshot.md_req_id == "MD7");
+        REQUIRE(snapshot.no_md_entries == bids.size() + asks.size());
+        REQUIRE(snapshot.msg_seq_num() == seq);
+        return msg;
+    };
+
+    std::string first = check(1);
+    REQUIRE(first.find(make_fix_message(
+        "35=W|49=SERVER|56=CLIENT|34=1|52=20260122-10:00:00.000|262=MD7|55=MSFT|268=4|"
+        "269=0|270=400|271=200|346=2|269=0|270=399.9|271=100|"
+        "269=1|270=400.1|271=300|346=1|269=1|270=400.2|271=50|10=")) != std::string::npos);
+
+    SECTION("Unchanged book re-encodes nothing; the header follows the sequence") {
+        encoder->update(bids, asks);
+        REQUIRE(encoder->encoded_levels() == 4);
+        (void)check(100000);
+    }
+
+    SECTION("Changed levels are rewritten in place or moved") {
+        asks[1].size_raw = qty(75);                     // Same length
+        bids[0] = {px("400.05"), qty(10), 1};           // Longer
+        encoder->update(bids, asks);
+        REQUIRE(encoder->encoded_levels() == 6);
+        (void)check(2);
+
+        bids[0] = {px("401"), qty(1), 0};               // Shorter
+        encoder->update(bids, asks);
+        REQUIRE(encoder->encoded_levels() == 7);
+        (void)check(3);
+    }
+
+    SECTION("Levels are added and removed at the end of a side") {
+        bids.push_back({px("399.80"), qty(5), 0});
+        asks.erase(asks.begin() + 1);
+        encoder->update(bids, asks);
+        REQUIRE(encoder->encoded_levels() == 5);
+        REQUIRE(encoder->levels(true) == 3);
+        REQUIRE(encoder->levels(false) == 1);
+        (void)check(2);
+
+        bids.clear();
+        encoder->update(bids, asks);
+        REQUIRE(encoder->levels(true) == 0);
+        (void)check(3);
+
+        bids.push_back({px("1"), qty(1), 0});
+        asks.push_back({px("500"), qty(1), 0});
+        encoder->update(bids, asks);
+        (void)check(4);
+    }
+
+    SECTION("Depth past MaxLevels is not published") {
+        for (int i = 0; i < 4; ++i) asks.push_back({px("401") + i, qty(1), 0});
+        encoder->update(bids, asks);
+        REQUIRE(encoder->levels(false) == 4);
+    }
+}
+
+// ============================================================================
+// Multicast Receiver Tests
+// ============================================================================
+
+#if NFX_PLATFORM_LINUX
+TEST_CASE("MulticastReceiver batches datagrams into the decoders", "[market_data][multicast]") {
+    MulticastReceiver feed;
+    MulticastConfig config;
+    config.batch_size = 8;
+    REQUIRE(feed.open(config));
+    REQUIRE(feed.local_port() != 0);
+
+    const int tx = ::socket(AF_INET, SOCK_DGRAM, 0);
+    REQUIRE(tx >= 0);
+    sockaddr_in to{};
+    to.sin_family = AF_INET;
+    to.sin_port = htons(feed.local_port());
+    to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    auto send_to_feed = [&](std::span<const char> payload) {
+        REQUIRE(::sendto(tx, payload.data(), payload.size(), 0,
+                         reinterpret_cast<const sockaddr*>(&to), sizeof(to)) ==
+                static_cast<ssize_t>(payload.size()));
+    };
+    // Loopback delivery is synchronous, but allow a few empty polls
+    auto drain = [](auto&& poll_once, size_t want) {
+        size_t got = 0;
+        for (int attempt = 0; attempt < 1000 && got < want; ++attempt) {
+            auto n = poll_once();
+            REQUIRE(n.has_value());
+            got += *n;
+        }
+        return got;
+    };
+
+    SECTION("One recvmmsg returns the queued datagrams with receive times") {
+        for (int i = 0; i < 5; ++i) {
+            const std::string payload = "pkt" + std::to_string(i);
+            send_to_feed(payload);
+        }
+        std::vector<std::string> seen;
+        bool stamped = true;
+        const size_t got = drain([&] {
+            return feed.poll([&](std::span<const Datagram> batch) {
+                for (const Datagram& pkt : batch) {
+                    seen.emplace_back(pkt.data.data(), pkt.data.size());
+                    stamped = stamped && pkt.rx_ts.valid();
+                }
+            });
+        }, 5);
+        REQUIRE(got == 5);
+        REQUIRE(seen == std::vector<std::string>{"pkt0", "pkt1", "pkt2", "pkt3", "pkt4"});
+        REQUIRE(stamped);
+        REQUIRE(feed.stats().packets == 5);
+        REQUIRE(feed.stats().batches <= 5);
+    }
+
+    SECTION("SBE datagrams go through sbe::dispatch") {
+        alignas(8) char buffer[sbe::NewOrderSingleCodec::TOTAL_SIZE];
+        sbe::NewOrderSingleCodec::wrapForEncode(buffer, sizeof(buffer))
+            .encodeHeader()
+            .clOrdId("MC1")
+            .symbol("AAPL")
+            .side(Side::Buy);
+        send_to_feed(std::span<const char>{buffer, sizeof(buffer)});
+
+        std::string symbol;
+        const size_t got = drain([&] {
+            return feed.poll_sbe([&](auto& codec, const Datagram&) {
+                if constexpr (std::is_same_v<std::decay_t<decltype(codec)>, sbe::NewOrderSingleCodec>) {
+                    symbol = std::string{codec.symbol()};
+                }
+            });
+        }, 1);
+        REQUIRE(got == 1);
+        REQUIRE(symbol == "AAPL");
+    }
+
+    SECTION("FIX datagrams are parsed message by message") {
+        auto with_checksum = [](std::string msg) {
+            char cs[4];
+            parser::format_checksum(fix::calculate_checksum(
+                std::span<const char>{msg.data(), msg.size()}), cs);
+            return msg + "10=" + std::string{cs, 3} + "\x01";
+        };
+        const std::string one = with_checksum(make_fix_message(
+            "8=FIX.4.4|9=40|35=X|49=FEED|56=CLIENT|34=1|262=A|"));
+        const std::string two = with_checksum(make_fix_message(
+            "8=FIX.4.4|9=40|35=X|49=FEED|56=CLIENT|34=2|262=B|"));
+        send_to_feed(one + two);
+        std::string corrupt = with_checksum(make_fix_message(
+            "8=FIX.4.4|9=40|35=X|49=FEED|56=CLIENT|34=3|262=C|"));
+        corrupt[corrupt.size() - 2] = corrupt[corrupt.size() - 2] == '0' ? '1' : '0';
+        send_to_feed(corrupt);
+
+        std::vector<uint32_t> seqs;
+        const size_t got = drain([&] {
+            return feed.poll_fix([&](const ParsedMessage& msg, const Datagram&) {
+                seqs.push_back(msg.msg_seq_num());
+            });
+        }, 2);
+        REQUIRE(got == 2);
+        REQUIRE(seqs == std::vector<uint32_t>{1, 2});
+        REQUIRE(feed.stats().parse_errors == 1);
+    }
+
+    ::close(tx);
+}
+
+TEST_CASE("LineArbitrator takes the first copy and reports gaps", "[market_data][multicast][arbitration]") {
+    ArbitrationConfig config;
+    config.gap_timeout_ns = 1000;
+    config.max_gap_lag = 100;
+    config.snapshot_threshold = 50;
+    LineArbitrator<256> arb{config};
+    arb.reset(1);
+
+    SECTION("Second copy of every packet is dropped") {
+        for (uint64_t seq = 1; seq <= 10; ++seq) {
+            const FeedLine first = seq % 3 == 0 ? FeedLine::B : FeedLine::A;
+            const FeedLine second = first == FeedLine::A ? FeedLine::B : FeedLine::A;
+            REQUIRE(arb.on_packet(first, seq, 0) == ArbitrationResult::Accept);
+            REQUIRE(arb.on_packet(second, seq, 0) == ArbitrationResult::Duplicate);
+        }
+        REQUIRE(arb.next_expected() == 11);
+        REQUIRE(arb.stats().accepted == 10);
+        REQUIRE(arb.stats().duplicates == 10);
+        REQUIRE(arb.stats().first_copies[0] == 7);
+        REQUIRE(arb.stats().first_copies[1] == 3);
+        REQUIRE_FALSE(arb.poll_gap(1'000'000));
+    }
+
+    SECTION("A loss on one line is covered by the other") {
+        REQUIRE(arb.on_packet(FeedLine::A, 1, 0) == ArbitrationResult::Accept);
+        REQUIRE(arb.on_packet(FeedLine::A, 3, 0) == ArbitrationResult::Accept);   // A lost 2
+        REQUIRE(arb.on_packet(FeedLine::A, 4, 0) == ArbitrationResult::Accept);
+        REQUIRE(arb.has_gap());
+        REQUIRE(arb.on_packet(FeedLine::B, 1, 10) == ArbitrationResult::Duplicate);
+        REQUIRE(arb.on_packet(FeedLine::B, 2, 10) == ArbitrationResult::Accept);
+        REQUIRE(arb.on_packet(FeedLine::B, 3, 10) == ArbitrationResult::Duplicate);
+        REQUIRE(arb.on_packet(FeedLine::B, 4, 10) == ArbitrationResult::Duplicate);
+        REQUIRE_FALSE(arb.has_gap());
+        REQUIRE(arb.next_expected() == 5);
+        REQUIRE_FALSE(arb.poll_gap(1'000'000));
+    }
+
+    SECTION("A hole missing on both lines times out into a retransmission") {
+        for (uint64_t seq : {1, 2, 5, 6}) {
+            REQUIRE(arb.on_packet(FeedLine::A, seq, 100) == ArbitrationResult::Accept);
+            REQUIRE(arb.on_packet(FeedLine::B, seq, 100) == ArbitrationResult::Duplicate);
+        }
+        REQUIRE_FALSE(arb.poll_gap(500));
+
+        auto gap = arb.poll_gap(1100);
+        REQUIRE(gap);
+        REQUIRE(gap->begin == 3);
+        REQUIRE(gap->end == 5);
+        REQUIRE(gap->action == RecoveryAction::Retransmit);
+        REQUIRE(arb.next_expected() == 7);
+        REQUIRE_FALSE(arb.has_gap());
+        REQUIRE(arb.on_packet(FeedLine::B, 3, 1200) == ArbitrationResult::Duplicate);
+        REQUIRE(arb.stats().lost == 2);
+    }
+
+    SECTION("Holes ahead of each other are reported one at a time") {
+        for (uint64_t seq : {1, 3, 5, 7}) {
+            REQUIRE(arb.on_packet(FeedLine::A, seq, 0) == ArbitrationResult::Accept);
+        }
+        std::vector<std::pair<uint64_t, uint64_t>> gaps;
+        while (auto gap = arb.poll_gap(5000)) gaps.emplace_back(gap->begin, gap->end);
+        REQUIRE(gaps == std::vector<std::pair<uint64_t, uint64_t>>{{2, 3}, {4, 5}, {6, 7}});
+        REQUIRE(arb.next_expected() == 8);
+    }
+
+    SECTION("A hole trailing too far behind is given up without waiting") {
+        REQUIRE(arb.on_packet(FeedLine::A, 1, 0) == ArbitrationResult::Accept);
+        for (uint64_t seq = 3; seq <= 100; ++seq) {
+            REQUIRE(arb.on_packet(FeedLine::A, seq, 0) == ArbitrationResult::Accept);
+        }
+        REQUIRE_FALSE(arb.poll_gap(0));
+        REQUIRE(arb.on_packet(FeedLine::A, 101, 0) == ArbitrationResult::Accept);
+        auto gap = arb.poll_gap(0);
+        REQUIRE(gap);
+        REQUIRE(gap->begin == 2);
+        REQUIRE(gap->end == 3);
+        REQUIRE(arb.next_expected() == 102);
+    }
+
+    SECTION("A jump past the window asks for a snapshot") {
+        REQUIRE(arb.on_packet(FeedLine::A, 1, 0) == ArbitrationResult::Accept);
+        REQUIRE(arb.on_packet(FeedLine::A, 1001, 0) == ArbitrationResult::Accept);
+        auto gap = arb.poll_gap(0);
+        REQUIRE(gap);
+        REQUIRE(gap->begin == 2);
+        REQUIRE(gap->end == 1001 - 256 + 1);
+        REQUIRE(gap->action == RecoveryAction::Snapshot);
+        REQUIRE(arb.has_gap());
+        REQUIRE(arb.on_packet(FeedLine::B, 1001, 0) == ArbitrationResult::Duplicate);
+
+        arb.reset(2000);
+        REQUIRE(arb.on_packet(FeedLine::A, 2000, 0) == ArbitrationResult::Accept);
+        REQUIRE_FALSE(arb.has_gap());
+        REQUIRE_FALSE(arb.poll_gap(1'000'000));
+    }
+}
+
+TEST_CASE("MulticastReceiver rejects bad group addresses", "[market_data][multicast]") {
+    MulticastReceiver feed;
+    MulticastConfig config;
+    config.group = "not-an-address";
+    auto opened = feed.open(config);
+    REQUIRE_FALSE(opened);
+    REQUIRE(opened.error().code == TransportErrorCode::AddressResolutionFailed);
+    REQUIRE_FALSE(feed.is_open());
+
+    config.group = {};
+    REQUIRE(feed.open(config));
+    REQUIRE(feed.join("239.1.1.1", "bogus").error().code ==
+            TransportErrorCode::AddressResolutionFailed);
+}
+#endif
+
 // ============================================================================
 // MarketDataRequestReject Tests
 // ============================================================================
@@ -262,6 +884,191 @@ TEST_CASE("MarketDataRequestReject Parser - Insufficient permissions", "[market_
     REQUIRE(msg.rejection_reason_name() == "InsufficientPermissions");
 }
 
+// ============================================================================
+// MassQuote / MassQuoteAcknowledgement Tests
+// ============================================================================
+
+TEST_CASE("MassQuoteEncoder writes nested quote groups", "[market_data][quote]") {
+    MassQuoteEncoder enc;
+    enc.prepare("FIX.4.4", "MM01", "VENUE");
+    enc.quote_response_level(1);
+
+    REQUIRE(enc.begin(7, "20260122-10:00:00.000", "Q42", 2));
+    REQUIRE(enc.add_set("S1", "AAPL", 2));
+    REQUIRE(enc.add_entry({"E1", "AAPL-C150", FixedPrice::from_double(1.25),
+                           FixedPrice::from_double(1.3), Qty::from_int(10), Qty::from_int(20)}));
+    REQUIRE(enc.add_entry({"E2", "AAPL-P150", FixedPrice::from_double(0.95), FixedPrice{},
+                           Qty::from_int(5), Qty{}}));
+    REQUIRE(enc.add_set("S2", {}, 1));
+    REQUIRE(enc.add_entry({"E3", "MSFT", FixedPrice::from_double(410.5),
+                           FixedPrice::from_double(410.75), Qty::from_double(0.5),
+                           Qty::from_double(1.5)}));
+    auto msg = enc.finish();
+    REQUIRE_FALSE(msg.empty());
+
+    const std::string body =
+        "35=i|49=MM01|56=VENUE|34=7|52=20260122-10:00:00.000|117=Q42|301=1|296=2|"
+        "302=S1|311=AAPL|295=2|"
+        "299=E1|55=AAPL-C150|132=1.25|133=1.3|134=10|135=20|"
+        "299=E2|55=AAPL-P150|132=0.95|134=5|"
+        "302=S2|295=1|"
+        "299=E3|55=MSFT|132=410.5|133=410.75|134=0.5|135=1.5|";
+    const std::string head = "8=FIX.4.4|9=" + std::string(6 - std::to_string(body.size()).size(), '0') +
+                             std::to_string(body.size()) + "|";
+    const std::string expected = make_fix_message(head + body);
+    const std::string_view text{msg.data(), msg.size()};
+    REQUIRE(text.substr(0, expected.size()) == expected);
+    REQUIRE(msg.size() == expected.size() + 7);
+    REQUIRE(checksum::validate(msg).code == ParseErrorCode::None);
+
+    auto parsed = MassQuote::from_buffer(msg);
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->quote_id == "Q42");
+    REQUIRE(parsed->quote_response_level == 1);
+    REQUIRE(parsed->no_quote_sets == 2);
+
+    auto sets = parsed->quote_sets();
+    REQUIRE(sets.has_next());
+    auto s1 = sets.next();
+    REQUIRE(s1.quote_set_id == "S1");
+    REQUIRE(s1.underlying_symbol == "AAPL");
+    REQUIRE(s1.no_quote_entries == 2);
+    auto entries = s1.entries();
+    auto e1 = entries.next();
+    REQUIRE(e1.quote_entry_id == "E1");
+    REQUIRE(e1.offer_px == FixedPrice::from_double(1.3));
+    REQUIRE(e1.offer_size == Qty::from_int(20));
+    auto e2 = entries.next();
+    REQUIRE(e2.quote_entry_id == "E2");
+    REQUIRE(e2.offer_px.raw == 0);
+    REQUIRE_FALSE(entries.has_next());
+
+    auto s2 = sets.next();
+    REQUIRE(s2.quote_set_id == "S2");
+    REQUIRE(s2.underlying_symbol.empty());
+    auto e3 = s2.entries().next();
+    REQUIRE(e3.symbol == "MSFT");
+    REQUIRE(e3.bid_size == Qty::from_double(0.5));
+    REQUIRE_FALSE(sets.has_next());
+
+    SECTION("Next message reuses the prepared header") {
+        REQUIRE(enc.begin(8, "20260122-10:00:00.001", "Q43", 1));
+        REQUIRE(enc.add_set("S1", "AAPL", 1));
+        REQUIRE(enc.add_entry({"E1", {}, FixedPrice::from_double(1.2), FixedPrice::from_double(1.3),
+                               Qty::from_int(10), Qty::from_int(10)}));
+        auto next = enc.finish();
+        REQUIRE(checksum::validate(next).code == ParseErrorCode::None);
+        REQUIRE(MassQuote::from_buffer(next)->msg_seq_num() == 8);
+    }
+}
+
+TEST_CASE("MassQuoteEncoder enforces declared group counts", "[market_data][quote]") {
+    MassQuoteEncoder enc;
+    const QuoteEntry quote{"E1", "AAPL", FixedPrice::from_double(1.0),
+                           FixedPrice::from_double(1.1), Qty::from_int(1), Qty::from_int(1)};
+
+    REQUIRE_FALSE(enc.begin(1, "20260122-10:00:00.000", "Q1", 1));  // Not prepared
+    enc.prepare("FIX.4.4", "MM01", "VENUE");
+    REQUIRE_FALSE(enc.begin(1, "20260122-10:00:00.000", "Q1", 0));
+
+    SECTION("Missing entries leave nothing to send") {
+        REQUIRE(enc.begin(1, "20260122-10:00:00.000", "Q1", 1));
+        REQUIRE(enc.add_set("S1", {}, 2));
+        REQUIRE(enc.add_entry(quote));
+        REQUIRE(enc.finish().empty());
+    }
+
+    SECTION("Entries past the declared count abandon the message") {
+        REQUIRE(enc.begin(1, "20260122-10:00:00.000", "Q1", 1));
+        REQUIRE(enc.add_set("S1", {}, 1));
+        REQUIRE(enc.add_entry(quote));
+        REQUIRE_FALSE(enc.add_entry(quote));
+        REQUIRE_FALSE(enc.in_progress());
+        REQUIRE(enc.finish().empty());
+    }
+
+    SECTION("A set cannot open before the previous one is complete") {
+        REQUIRE(enc.begin(1, "20260122-10:00:00.000", "Q1", 2));
+        REQUIRE(enc.add_set("S1", {}, 2));
+        REQUIRE(enc.add_entry(quote));
+        REQUIRE_FALSE(enc.add_set("S2", {}, 1));
+    }
+
+    SECTION("A full buffer stops the message") {
+        BasicMassQuoteEncoder<1024> small;
+        small.prepare("FIX.4.4", "MM01", "VENUE");
+        const size_t fit = small.entries_left_in_buffer();
+        REQUIRE(fit > 0);
+        REQUIRE(small.begin(1, "20260122-10:00:00.000", "Q1", 1));
+        REQUIRE(small.add_set("S1", {}, 1000));
+        size_t written = 0;
+        while (small.add_entry(quote)) ++written;
+        REQUIRE(written >= fit);
+        REQUIRE(small.finish().empty());
+    }
+}
+
+TEST_CASE("MassQuoteAck decodes per-entry rejects", "[market_data][quote]") {
+    // Acks are checksum-validated; append a matching trailer
+    auto with_trailer = [](std::string_view text) {
+        std::string msg = make_fix_message(text);
+        const auto sum = checksum::format(checksum::calculate(msg));
+        return msg + "10=" + std::string{sum.data(), 3} + fix::SOH;
+    };
+
+    std::string raw_msg = with_trailer(
+        "8=FIX.4.4|9=200|35=b|49=VENUE|56=MM01|34=3|52=20260122-10:00:00.002|"
+        "117=Q42|297=0|296=1|"
+        "302=S1|311=AAPL|295=3|"
+        "299=E1|368=0|"
+        "299=E2|55=AAPL-P150|368=6|"
+        "299=E3|132=1.5|");
+
+    auto result = MassQuoteAck::from_buffer(
+        std::span<const char>{raw_msg.data(), raw_msg.size()});
+    REQUIRE(result.has_value());
+    REQUIRE(result->quote_id == "Q42");
+    REQUIRE(result->is_accepted());
+    REQUIRE(result->no_quote_sets == 1);
+
+    auto sets = result->quote_sets();
+    auto set = sets.next();
+    REQUIRE(set.quote_set_id == "S1");
+    REQUIRE(set.no_quote_entries == 3);
+
+    auto entries = set.entries();
+    REQUIRE(entries.count() == 3);
+    REQUIRE_FALSE(entries.next().rejected());
+    auto e2 = entries.next();
+    REQUIRE(e2.quote_entry_id == "E2");
+    REQUIRE(e2.symbol == "AAPL-P150");
+    REQUIRE(e2.entry_reject_reason == 6);
+    auto e3 = entries.next();
+    REQUIRE(e3.quote_entry_id == "E3");
+    REQUIRE(e3.bid_px == FixedPrice::from_double(1.5));
+    REQUIRE_FALSE(entries.has_next());
+
+    SECTION("Whole-quote reject without groups") {
+        std::string reject = with_trailer(
+            "8=FIX.4.4|9=100|35=b|49=VENUE|56=MM01|34=4|52=20260122-10:00:00.003|"
+            "117=Q43|297=5|300=1|58=Unknown symbol|");
+        auto rej = MassQuoteAck::from_buffer(std::span<const char>{reject.data(), reject.size()});
+        REQUIRE(rej.has_value());
+        REQUIRE(rej->is_rejected());
+        REQUIRE(rej->quote_reject_reason == 1);
+        REQUIRE(rej->text == "Unknown symbol");
+        REQUIRE_FALSE(rej->quote_sets().has_next());
+    }
+
+    SECTION("QuoteStatus is required") {
+        std::string bad = with_trailer(
+            "8=FIX.4.4|9=80|35=b|49=VENUE|56=MM01|34=5|52=20260122-10:00:00.004|117=Q44|");
+        auto missing = MassQuoteAck::from_buffer(std::span<const char>{bad.data(), bad.size()});
+        REQUIRE_FALSE(missing.has_value());
+        REQUIRE(missing.error().tag == tag::QuoteStatus::value);
+    }
+}
+
 // ============================================================================
 // Market Data Types Tests
 // ============================================================================
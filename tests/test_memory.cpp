@@ -1,6 +1,36 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "nexusfix/memory/broadcast_ring.hpp"
 #include "nexusfix/memory/buffer_pool.hpp"
+#include "nexusfix/memory/conflating_queue.hpp"
+#include "nexusfix/memory/epoch_reclaim.hpp"
+#include "nexusfix/memory/huge_page_allocator.hpp"
+#include "nexusfix/memory/message_handoff.hpp"
+#include "nexusfix/memory/spsc_queue.hpp"
+#include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/transport/shm_transport.hpp"
+#include "nexusfix/transport/socket.hpp"
+#include "nexusfix/util/deferred_processor.hpp"
+#include "nexusfix/util/numa.hpp"
+#include "nexusfix/util/thread_local_pool.hpp"
+
+#if NFX_SHM_AVAILABLE
+#include <unistd.h>
+#endif
 
 using namespace nfx;
 
@@ -94,6 +124,150 @@ TEST_CASE("FixedPool allocation", "[memory][pool][regression]") {
     }
 }
 
+TEST_CASE("FixedPool reclaims blocks freed on other threads", "[memory][pool][remote]") {
+    SECTION("Remote frees are reclaimed when the free list runs dry") {
+        FixedPool<64, 16> pool;
+        std::array<void*, 16> blocks{};
+        for (auto& b : blocks) b = pool.allocate();
+        REQUIRE(pool.allocate() == nullptr);
+
+        std::vector<std::thread> consumers;
+        for (size_t t = 0; t < 4; ++t) {
+            consumers.emplace_back([&pool, &blocks, t] {
+                for (size_t i = t * 4; i < t * 4 + 4; ++i) pool.deallocate_remote(blocks[i]);
+            });
+        }
+        for (auto& c : consumers) c.join();
+
+        REQUIRE(pool.allocated() == 16);  // Not reclaimed yet
+        void* again = pool.allocate();
+        REQUIRE(again != nullptr);
+        REQUIRE(pool.owns(again));
+        REQUIRE(pool.allocated() == 1);
+        REQUIRE(pool.reclaim_remote() == 0);
+    }
+
+    SECTION("Producer-consumer buffer flow with a small pool") {
+        constexpr uint32_t COUNT = 50'000;
+        auto pool = std::make_unique<FixedPool<64, 8>>();
+        auto queue = std::make_unique<memory::SPSCQueue<void*, 16>>();
+
+        std::thread consumer([&] {
+            for (uint32_t received = 0; received < COUNT;) {
+                void* block = nullptr;
+                if (!queue->try_pop(block)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                pool->deallocate_remote(block);
+                ++received;
+            }
+        });
+
+        for (uint32_t sent = 0; sent < COUNT; ++sent) {
+            void* block = nullptr;
+            while ((block = pool->allocate()) == nullptr) std::this_thread::yield();
+            std::memcpy(block, &sent, sizeof(sent));
+            while (!queue->try_push(block)) std::this_thread::yield();
+        }
+        consumer.join();
+
+        (void)pool->reclaim_remote();
+        REQUIRE(pool->available() == 8);
+        REQUIRE(pool->allocated() == 0);
+    }
+}
+
+TEST_CASE("ThreadLocalPool objects released on another thread", "[memory][pool][remote]") {
+    struct Slot { uint64_t payload[8]; };
+    using Pool = util::ThreadLocalPool<Slot, 4>;
+    using Ptr = util::PooledPtr<Slot, 4>;
+
+    Pool& pool = Pool::instance();
+    REQUIRE(Pool::local() == &pool);
+
+    std::vector<Ptr> held;
+    for (int i = 0; i < 4; ++i) held.push_back(Ptr::acquire_pooled_only());
+    REQUIRE(pool.available() == 0);
+
+    bool pool_created_remotely = true;
+    std::thread other{[&] {
+        held.clear();
+        pool_created_remotely = Pool::local() != nullptr;
+    }};
+    other.join();
+    REQUIRE_FALSE(pool_created_remotely);
+
+    REQUIRE(pool.available() == 0);
+    auto again = Ptr::acquire_pooled_only();
+    REQUIRE(again.is_from_pool());
+    REQUIRE(pool.stats().remote_reclaimed == 4);
+    REQUIRE(pool.available() == 3);
+}
+
+TEST_CASE("FixedPool on huge pages", "[memory][pool][hugepage]") {
+    FixedPool<256, 64, true> pool;
+
+    // hugetlbfs or the THP fallback: either way a 2MB-aligned mapping
+    void* first = pool.allocate();
+    REQUIRE(first != nullptr);
+    REQUIRE(reinterpret_cast<uintptr_t>(first) % (2 * 1024 * 1024) == 0);
+    REQUIRE(pool.owns(first));
+    REQUIRE(pool.available() == 63);
+
+    pool.deallocate(first);
+    REQUIRE(pool.allocated() == 0);
+
+    HugePageMessagePool tiered;
+    {
+        HugePagePooledBuffer buf{tiered, tiered.allocate(1000)};
+        REQUIRE(buf.size() == HugePageMessagePool::MEDIUM_SIZE);
+        REQUIRE(tiered.stats().medium_allocated == 1);
+    }
+    REQUIRE(tiered.stats().medium_allocated == 0);
+}
+
+TEST_CASE("NUMA topology and node-bound buffers", "[memory][numa]") {
+    using nfx::util::NumaTopology;
+
+    SECTION("cpu list parsing") {
+        REQUIRE(nfx::util::parse_cpu_list("0-3,8,10-11\n") ==
+                std::vector<int>{0, 1, 2, 3, 8, 10, 11});
+        REQUIRE(nfx::util::parse_cpu_list("5") == std::vector<int>{5});
+        REQUIRE(nfx::util::parse_cpu_list("3-1,x,-1,7") == std::vector<int>{7});
+        REQUIRE(nfx::util::parse_cpu_list("").empty());
+    }
+
+    SECTION("core 0 belongs to its node") {
+        REQUIRE(NumaTopology::node_count() >= 1);
+        const int node = NumaTopology::node_of_cpu(0);
+        if (node >= 0) {
+            auto cpus = NumaTopology::cpus_of_node(node);
+            REQUIRE(std::find(cpus.begin(), cpus.end(), 0) != cpus.end());
+        }
+        REQUIRE(NumaTopology::node_of_cpu(-1) == -1);
+    }
+
+    SECTION("virtual interfaces have no placement") {
+        auto lo = NumaTopology::nic("lo");
+        REQUIRE(lo.node == -1);
+        REQUIRE(lo.irqs.empty());
+        REQUIRE(lo.node_cores.empty());
+    }
+
+    SECTION("huge-page buffer bound to a node") {
+        const int node = std::max(NumaTopology::node_of_cpu(0), 0);
+        memory::HugePageBuffer buf{2 * 1024 * 1024, memory::HugePageSize::Huge2MB, true, node};
+        REQUIRE(buf.valid());
+        static_cast<char*>(buf.data())[0] = 1;
+
+        // Sandboxes may forbid mbind; the allocation itself must not care
+        const int rc = nfx::util::bind_memory_to_node(buf.data(), buf.size(), node);
+        REQUIRE((rc == 0 || rc == EPERM || rc == ENOSYS));
+        REQUIRE(nfx::util::bind_memory_to_node(buf.data(), buf.size(), -1) == EINVAL);
+    }
+}
+
 // ============================================================================
 // MessagePool Tests
 // ============================================================================
@@ -258,4 +432,866 @@ TEST_CASE("Cache line alignment", "[memory][cache]") {
 
     // First allocation should be aligned
     REQUIRE((addr % CACHE_LINE_SIZE) == 0);
+
+    // buffer_pool.hpp pulls in cache_line.hpp; with both namespaces visible
+    // the name must still resolve to one constant
+    using namespace nfx::memory;
+    STATIC_REQUIRE(&nfx::CACHE_LINE_SIZE == &nfx::memory::CACHE_LINE_SIZE);
+    constexpr size_t alignment = CACHE_LINE_SIZE;
+    STATIC_REQUIRE(alignment == 64);
+}
+
+// ============================================================================
+// Ring Buffer Tests
+// ============================================================================
+
+namespace {
+
+std::span<const char> as_span(std::string_view sv) {
+    return std::span<const char>{sv.data(), sv.size()};
+}
+
+std::string as_string(const RingSegments& seg) {
+    std::string out{seg.first.data(), seg.first.size()};
+    out.append(seg.second.data(), seg.second.size());
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("RingBuffer wraparound", "[memory][ring][regression]") {
+    RingBuffer<16> ring;
+    std::array<char, 16> out{};
+
+    // Move head/tail to offset 12 so the next write wraps
+    REQUIRE(ring.write(as_span("0123456789AB")) == 12);
+    REQUIRE(ring.read(std::span<char>{out.data(), 12}) == 12);
+
+    SECTION("Write and read across the end") {
+        REQUIRE(ring.write(as_span("abcdefgh")) == 8);
+        REQUIRE(ring.peek(std::span<char>{out.data(), 8}) == 8);
+        REQUIRE(std::string_view{out.data(), 8} == "abcdefgh");
+        REQUIRE(ring.read(std::span<char>{out.data(), 8}) == 8);
+        REQUIRE(std::string_view{out.data(), 8} == "abcdefgh");
+        REQUIRE(ring.empty());
+    }
+
+    SECTION("Write is limited to free space") {
+        REQUIRE(ring.write(as_span("0123456789abcdefXYZ")) == 16);
+        REQUIRE(ring.full());
+        REQUIRE(ring.write(as_span("x")) == 0);
+    }
+
+    SECTION("Read segments expose both halves in place") {
+        REQUIRE(ring.write(as_span("abcdefgh")) == 8);
+        auto seg = ring.read_segments();
+        REQUIRE(seg.size() == 8);
+        REQUIRE_FALSE(seg.contiguous());
+        REQUIRE(std::string_view{seg.first.data(), seg.first.size()} == "abcd");
+        REQUIRE(as_string(seg) == "abcdefgh");
+        REQUIRE(ring.read_span().size() == 4);
+    }
+}
+
+TEST_CASE("StreamParser parses from ring segments", "[memory][ring][parser][regression]") {
+    const std::string msg =
+        "8=FIX.4.4\x01" "9=40\x01" "35=0\x01" "34=7\x01" "49=SENDER\x01"
+        "56=TARGET\x01" "52=20260101-00:00:00\x01" "10=000\x01";
+    RingBuffer<256> ring;
+
+    REQUIRE(ring.write(as_span(msg)) == msg.size());
+    REQUIRE(ring.write(as_span(msg)) == msg.size());
+
+    auto seg = ring.read_segments();
+    REQUIRE(seg.contiguous());
+
+    StreamParser parser;
+    REQUIRE(parser.feed(seg.first) == 2 * msg.size());
+    for (int i = 0; i < 2; ++i) {
+        REQUIRE(parser.has_message());
+        auto [start, end] = parser.next_message();
+        REQUIRE(std::string_view{seg.first.data() + start, end - start} == msg);
+    }
+    REQUIRE_FALSE(parser.has_message());
+}
+
+#if NFX_PLATFORM_POSIX
+
+TEST_CASE("VirtualRingBuffer contiguous across wrap", "[memory][ring][regression]") {
+    VirtualRingBuffer<4096> ring;
+    REQUIRE(ring.is_mapped());
+
+    std::string filler(4000, 'f');
+    std::array<char, 4096> out{};
+    REQUIRE(ring.write(as_span(filler)) == filler.size());
+    REQUIRE(ring.read(std::span<char>{out.data(), filler.size()}) == filler.size());
+
+    // 200 bytes starting 96 bytes before the end of the mapping
+    std::string payload;
+    for (int i = 0; i < 200; ++i) payload += static_cast<char>('a' + i % 26);
+    REQUIRE(ring.write(as_span(payload)) == payload.size());
+
+    auto view = ring.read_span();
+    REQUIRE(view.size() == payload.size());
+    REQUIRE(std::string_view{view.data(), view.size()} == payload);
+    REQUIRE(ring.read_segments().contiguous());
+
+    REQUIRE(ring.write_span().size() == 4096 - payload.size());
+    REQUIRE(ring.read(std::span<char>{out.data(), out.size()}) == payload.size());
+    REQUIRE(std::string_view{out.data(), payload.size()} == payload);
+    REQUIRE(ring.empty());
+}
+
+#endif // NFX_PLATFORM_POSIX
+
+// ============================================================================
+// MessageHandoff Tests
+// ============================================================================
+
+namespace {
+
+std::string framed(std::string_view body) {
+    std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(body.size()) + "\x01" + std::string{body};
+    auto cs = fix::format_checksum(
+        fix::calculate_checksum(std::span<const char>{msg.data(), msg.size()}));
+    return msg + "10=" + std::string{cs.data(), 3} + "\x01";
+}
+
+} // namespace
+
+TEST_CASE("MessageHandoff pins buffers until messages are released", "[memory][handoff]") {
+    using Handoff = memory::MessageHandoff<4, 8>;
+    auto handoff = std::make_unique<Handoff>();
+
+    // Two messages framed out of receive buffer 3
+    const std::string buffer =
+        framed("35=0\x01" "49=SENDER\x01" "56=TARGET\x01" "34=7\x01" "52=20260101-00:00:00\x01") +
+        framed("35=0\x01" "49=SENDER\x01" "56=TARGET\x01" "34=8\x01" "52=20260101-00:00:00\x01");
+    const size_t first = buffer.size() / 2;
+    std::span<const char> data{buffer.data(), buffer.size()};
+
+    REQUIRE(handoff->publish(3, data.first(first)) == memory::HandoffStatus::Published);
+    REQUIRE(handoff->publish(3, data.subspan(first)) == memory::HandoffStatus::Published);
+    REQUIRE(handoff->publish(3, as_span(std::string_view{"garbage"})) ==
+            memory::HandoffStatus::ParseFailed);
+    REQUIRE(handoff->publish(9, data) == memory::HandoffStatus::BadBuffer);
+    REQUIRE_FALSE(handoff->done_with(3));
+    REQUIRE(handoff->pins(3) == 2);
+
+    std::vector<uint16_t> freed;
+    auto on_free = [&](uint16_t id) { freed.push_back(id); };
+
+    {
+        auto msg = handoff->try_consume();
+        REQUIRE(msg.has_value());
+        REQUIRE(msg->parser().msg_seq_num() == 7);
+        REQUIRE(msg->raw().data() == buffer.data());  // Parsed in place, not copied
+
+        auto second = handoff->try_consume();
+        REQUIRE(second.has_value());
+        REQUIRE((*second)->msg_seq_num() == 8);
+        REQUIRE_FALSE(handoff->try_consume().has_value());
+
+        second->release();
+        REQUIRE(handoff->reclaim(on_free) == 0);  // First message still points into it
+        REQUIRE(handoff->pins(3) == 1);
+    }
+
+    REQUIRE(handoff->reclaim(on_free) == 1);
+    REQUIRE(freed == std::vector<uint16_t>{3});
+    REQUIRE(handoff->in_flight() == 0);
+
+    SECTION("Unused buffers are free immediately") {
+        REQUIRE(handoff->done_with(5));
+    }
+
+    SECTION("Full when the consumer holds every slot") {
+        std::vector<Handoff::PinnedMessage> held;
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(handoff->publish(1, data.first(first)) == memory::HandoffStatus::Published);
+            held.push_back(std::move(*handoff->try_consume()));
+        }
+        REQUIRE(handoff->publish(1, data.first(first)) == memory::HandoffStatus::Full);
+
+        held.pop_back();
+        REQUIRE(handoff->publish(1, data.first(first)) == memory::HandoffStatus::Published);
+    }
+}
+
+// ============================================================================
+// SPSCQueue Tests
+// ============================================================================
+
+TEST_CASE("SPSCQueue batch push and pop", "[memory][spsc]") {
+    memory::SPSCQueue<int, 8> queue;
+    const std::array<int, 10> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::array<int, 10> output{};
+
+    // Only capacity() elements fit
+    REQUIRE(queue.try_push_n(input) == 7);
+    REQUIRE(queue.full());
+    REQUIRE(queue.try_push_n(std::span{input}.subspan(7)) == 0);
+
+    REQUIRE(queue.try_pop_n(std::span{output}.first(5)) == 5);
+    REQUIRE(output[0] == 0);
+    REQUIRE(output[4] == 4);
+
+    // Wraps around the end of the ring
+    REQUIRE(queue.try_push_n(std::span{input}.subspan(7)) == 3);
+    REQUIRE(queue.size_approx() == 5);
+    REQUIRE(queue.try_pop_n(output) == 5);
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(output[static_cast<size_t>(i)] == 5 + i);
+    }
+    REQUIRE(queue.empty());
+    REQUIRE(queue.try_pop_n(output) == 0);
+
+    // Single-element operations share the same indices
+    REQUIRE(queue.try_push(42));
+    int value = 0;
+    REQUIRE(queue.try_pop(value));
+    REQUIRE(value == 42);
+}
+
+TEST_CASE("SPSCQueue preserves order across threads", "[memory][spsc]") {
+    constexpr uint32_t COUNT = 100'000;
+    auto queue = std::make_unique<memory::SPSCQueue<uint32_t, 256, memory::YieldingWait>>();
+
+    std::thread producer([&] {
+        std::array<uint32_t, 16> batch{};
+        uint32_t next = 0;
+        while (next < COUNT) {
+            size_t n = std::min<size_t>(batch.size(), COUNT - next);
+            for (size_t i = 0; i < n; ++i) batch[i] = next + static_cast<uint32_t>(i);
+            size_t pushed = 0;
+            while (pushed < n) {
+                pushed += queue->try_push_n(std::span{batch}.subspan(pushed, n - pushed));
+            }
+            next += static_cast<uint32_t>(n);
+        }
+    });
+
+    uint32_t expected = 0;
+    bool ordered = true;
+    std::array<uint32_t, 32> out{};
+    while (expected < COUNT) {
+        size_t n = queue->try_pop_n(out);
+        for (size_t i = 0; i < n; ++i) {
+            ordered = ordered && out[i] == expected;
+            ++expected;
+        }
+        if (n == 0 && expected < COUNT) {
+            ordered = ordered && queue->pop() == expected;
+            ++expected;
+        }
+    }
+    producer.join();
+
+    REQUIRE(ordered);
+    REQUIRE(queue->empty());
+}
+
+// ============================================================================
+// BroadcastRing Tests
+// ============================================================================
+
+TEST_CASE("BroadcastRing delivers every entry to every consumer", "[memory][broadcast]") {
+    memory::BroadcastRing<int, 4, 4> ring;
+    auto a = ring.subscribe();
+    auto b = ring.subscribe();
+    REQUIRE(a.has_value());
+    REQUIRE(b.has_value());
+
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(ring.try_publish(i));
+    }
+    // Both consumers still need slot 0
+    REQUIRE_FALSE(ring.try_publish(4));
+    REQUIRE(ring.lag(*a) == 4);
+
+    std::vector<int> seen_a;
+    REQUIRE(ring.poll(*a, [&](const int& v, size_t) { seen_a.push_back(v); }) == 4);
+    REQUIRE(seen_a == std::vector<int>{0, 1, 2, 3});
+
+    // b gates the producer until it moves
+    REQUIRE_FALSE(ring.try_publish(4));
+    REQUIRE(ring.slowest() == b);
+
+    std::vector<int> seen_b;
+    REQUIRE(ring.poll(*b, [&](const int& v, size_t) { seen_b.push_back(v); }, 2) == 2);
+    REQUIRE(ring.try_publish(4));
+    REQUIRE(ring.try_publish(5));
+    REQUIRE_FALSE(ring.try_publish(6));
+
+    // In-place claim, read back through peek/advance
+    REQUIRE(ring.poll(*a, [](const int&, size_t) {}) == 2);
+    REQUIRE(ring.poll(*b, [&](const int& v, size_t) { seen_b.push_back(v); }) == 4);
+    REQUIRE(seen_b == std::vector<int>{0, 1, 2, 3, 4, 5});
+    int* slot = ring.try_claim();
+    REQUIRE(slot != nullptr);
+    *slot = 6;
+    ring.publish();
+    const int* next = ring.peek(*a);
+    REQUIRE(next != nullptr);
+    REQUIRE(*next == 6);
+    REQUIRE(ring.advance(*a));
+    REQUIRE(ring.peek(*a) == nullptr);
+
+    SECTION("Slow consumer is detached and stops gating") {
+        REQUIRE(ring.try_publish(7));
+        REQUIRE(ring.try_publish(8));
+        REQUIRE(ring.try_publish(9));
+        REQUIRE_FALSE(ring.try_publish(10));  // b lags by 4
+
+        REQUIRE(ring.detach_slow(4) == 1);
+        REQUIRE(ring.detached(*b));
+        REQUIRE_FALSE(ring.detached(*a));
+        REQUIRE(ring.lag(*b) == 0);
+        REQUIRE(ring.try_publish(10));
+        REQUIRE(ring.poll(*b, [](const int&, size_t) {}) == 0);
+
+        ring.unsubscribe(*b);
+        auto c = ring.subscribe();
+        REQUIRE(c == b);  // Slot reused, starting at the current sequence
+        REQUIRE(ring.lag(*c) == 0);
+    }
+}
+
+TEST_CASE("BroadcastRing fan-out across threads", "[memory][broadcast]") {
+    constexpr size_t COUNT = 50'000;
+    auto ring = std::make_unique<memory::BroadcastRing<size_t, 256, 2, memory::YieldingWait>>();
+    auto first = ring->subscribe();
+    auto second = ring->subscribe();
+    REQUIRE(first.has_value());
+    REQUIRE(second.has_value());
+
+    auto consume = [&ring](size_t id, bool& ordered) {
+        size_t expected = 0;
+        while (expected < COUNT) {
+            size_t n = ring->poll(id, [&](const size_t& v, size_t seq) {
+                ordered = ordered && v == expected && seq == expected;
+                ++expected;
+            });
+            if (n == 0) std::this_thread::yield();
+        }
+    };
+
+    bool ordered_1 = true;
+    bool ordered_2 = true;
+    std::thread c1([&] { consume(*first, ordered_1); });
+    std::thread c2([&] { consume(*second, ordered_2); });
+    for (size_t i = 0; i < COUNT; ++i) {
+        ring->publish(i);
+    }
+    c1.join();
+    c2.join();
+
+    REQUIRE(ordered_1);
+    REQUIRE(ordered_2);
+    REQUIRE(ring->published() == COUNT);
+}
+
+// ============================================================================
+// ConflatingQueue Tests
+// ============================================================================
+
+namespace {
+
+struct Quote {
+    uint32_t symbol;
+    int64_t bid;
+};
+
+} // namespace
+
+TEST_CASE("ConflatingQueue keeps the newest value per key", "[memory][conflate]") {
+    auto queue = std::make_unique<memory::ConflatingQueue<Quote, 8>>();
+    using Seen = std::vector<std::pair<uint32_t, int64_t>>;
+    Seen seen;
+    auto collect = [&seen](SymbolId id, const Quote& q) { seen.emplace_back(id.value, q.bid); };
+
+    REQUIRE(queue->publish(SymbolId{3}, {3, 100}));
+    REQUIRE(queue->publish(SymbolId{1}, {1, 200}));
+    REQUIRE(queue->publish(SymbolId{3}, {3, 101}));
+    REQUIRE(queue->publish(SymbolId{3}, {3, 102}));
+    REQUIRE_FALSE(queue->publish(SymbolId{8}, {8, 1}));
+    REQUIRE(queue->pending() == 2);
+    REQUIRE(queue->published() == 4);
+    REQUIRE(queue->conflated() == 2);
+
+    // Dirty keys only, in the order they turned dirty, newest value each
+    REQUIRE(queue->drain(collect) == 2);
+    REQUIRE(seen == Seen{{3, 102}, {1, 200}});
+    REQUIRE(queue->drain(collect) == 0);
+    REQUIRE(queue->latest(SymbolId{3}).bid == 102);
+
+    // Every key dirty at once still fits; max_keys bounds one drain
+    for (uint32_t k = 0; k < 8; ++k) {
+        for (int64_t v = 0; v < 5; ++v) REQUIRE(queue->publish(SymbolId{k}, {k, v}));
+    }
+    seen.clear();
+    REQUIRE(queue->drain(collect, 3) == 3);
+    REQUIRE(queue->drain(collect) == 5);
+    REQUIRE(seen.size() == 8);
+    for (const auto& [key, bid] : seen) REQUIRE(bid == 4);
+
+    SECTION("absorb() conflates a broadcast ring consumer") {
+        memory::BroadcastRing<Quote, 16, 1> ring;
+        auto id = ring.subscribe();
+        REQUIRE(id.has_value());
+        for (int64_t v = 0; v < 12; ++v) {
+            REQUIRE(ring.try_publish(Quote{static_cast<uint32_t>(v % 2), v}));
+        }
+        REQUIRE(queue->absorb(ring, *id, [](const Quote& q) { return SymbolId{q.symbol}; }) == 12);
+        REQUIRE(ring.lag(*id) == 0);
+
+        seen.clear();
+        REQUIRE(queue->drain(collect) == 2);
+        REQUIRE(seen == Seen{{0, 10}, {1, 11}});
+    }
+}
+
+TEST_CASE("ConflatingQueue delivers the final value across threads", "[memory][conflate]") {
+    constexpr uint32_t KEYS = 16;
+    constexpr int64_t ROUNDS = 20'000;
+    auto queue = std::make_unique<memory::ConflatingQueue<Quote, KEYS>>();
+
+    std::atomic<bool> done{false};
+    std::array<int64_t, KEYS> last{};
+    last.fill(-1);
+    bool monotonic = true;
+
+    std::thread consumer([&] {
+        auto take = [&](SymbolId id, const Quote& q) {
+            monotonic = monotonic && q.symbol == id.value && q.bid >= last[id.value];
+            last[id.value] = q.bid;
+        };
+        while (!done.load(std::memory_order_acquire)) {
+            if (queue->drain(take) == 0) std::this_thread::yield();
+        }
+        (void)queue->drain(take);
+    });
+
+    for (int64_t v = 0; v < ROUNDS; ++v) {
+        for (uint32_t k = 0; k < KEYS; ++k) (void)queue->publish(SymbolId{k}, {k, v});
+    }
+    done.store(true, std::memory_order_release);
+    consumer.join();
+
+    REQUIRE(monotonic);
+    for (uint32_t k = 0; k < KEYS; ++k) REQUIRE(last[k] == ROUNDS - 1);
+    REQUIRE(queue->pending() == 0);
+}
+
+// ============================================================================
+// Epoch Reclamation Tests
+// ============================================================================
+
+namespace {
+
+/// Counts its own destruction; `alive` is cleared before the memory goes
+struct Tracked {
+    explicit Tracked(std::atomic<int>& freed, uint64_t v = 0) : freed_{freed}, value{v} {}
+    ~Tracked() {
+        alive = false;
+        freed_.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::atomic<int>& freed_;
+    uint64_t value;
+    bool alive{true};
+};
+
+} // namespace
+
+TEST_CASE("EpochDomain frees retired objects after readers leave", "[memory][epoch]") {
+    std::atomic<int> freed{0};
+    memory::EpochDomain<4, 1024> domain;
+    auto writer = domain.register_thread();
+    auto reader = domain.register_thread();
+    REQUIRE(writer.has_value());
+    REQUIRE(reader.has_value());
+
+    {
+        auto guard = reader->pin();
+        auto nested = reader->pin();
+        REQUIRE(reader->pinned());
+
+        writer->retire(new Tracked{freed});
+        for (int i = 0; i < 8; ++i) (void)writer->collect();
+        // The reader pinned before the retire: at most one epoch passes
+        REQUIRE(domain.epoch() == 1);
+        REQUIRE(freed == 0);
+        REQUIRE(writer->pending() == 1);
+    }
+    REQUIRE_FALSE(reader->pinned());
+
+    REQUIRE(writer->collect() == 1);
+    REQUIRE(freed == 1);
+    REQUIRE(writer->pending() == 0);
+
+    SECTION("Retirement is batched") {
+        memory::EpochDomain<2, 4> batched;
+        auto me = batched.register_thread();
+        for (int i = 0; i < 3; ++i) me->retire(new Tracked{freed});
+        REQUIRE(batched.epoch() == 0);       // No collect before the batch fills
+        me->retire(new Tracked{freed});
+        REQUIRE(batched.epoch() == 1);
+    }
+
+    SECTION("A leaving thread hands its objects to the domain") {
+        reader->retire(new Tracked{freed});
+        reader.reset();
+        REQUIRE(domain.orphaned() == 1);
+        (void)writer->collect();
+        (void)writer->collect();
+        REQUIRE(domain.orphaned() == 0);
+        REQUIRE(freed == 2);
+
+        auto again = domain.register_thread();  // Slot reused
+        REQUIRE(again.has_value());
+    }
+
+    SECTION("Registration is bounded") {
+        memory::EpochDomain<1> single;
+        auto only = single.register_thread();
+        REQUIRE(only.has_value());
+        REQUIRE_FALSE(single.register_thread().has_value());
+    }
+}
+
+TEST_CASE("EpochDomain protects readers across threads", "[memory][epoch]") {
+    constexpr int SWAPS = 20'000;
+    std::atomic<int> freed{0};
+    memory::EpochDomain<4, 32> domain;
+    std::atomic<Tracked*> shared{new Tracked{freed}};
+    std::atomic<bool> done{false};
+    std::atomic<bool> violated{false};
+
+    auto read = [&] {
+        auto me = domain.register_thread();
+        while (!done.load(std::memory_order_acquire)) {
+            auto guard = me->pin();
+            const Tracked* t = shared.load(std::memory_order_acquire);
+            if (!t->alive) violated.store(true, std::memory_order_relaxed);
+        }
+    };
+    std::thread r1{read};
+    std::thread r2{read};
+
+    {
+        auto writer = domain.register_thread();
+        for (int i = 1; i <= SWAPS; ++i) {
+            Tracked* old = shared.exchange(new Tracked{freed, static_cast<uint64_t>(i)},
+                                           std::memory_order_acq_rel);
+            writer->retire(old);
+        }
+        done.store(true, std::memory_order_release);
+        r1.join();
+        r2.join();
+        while (writer->pending() > 0) (void)writer->collect();
+    }
+
+    REQUIRE_FALSE(violated.load());
+    REQUIRE(freed == SWAPS);
+    delete shared.load();
+}
+
+// ============================================================================
+// Shared-memory Ring Tests
+// ============================================================================
+
+#if NFX_SHM_AVAILABLE
+
+namespace {
+
+/// Per-process ring name so parallel test runs do not collide
+std::string shm_test_name(std::string_view base) {
+    return std::string{base} + "." + std::to_string(::getpid());
+}
+
+} // namespace
+
+TEST_CASE("ShmPublisher broadcasts records to every subscriber", "[memory][shm]") {
+    const auto name = shm_test_name("bcast");
+    auto publisher = ShmPublisher::create(name, {.capacity = 4096});
+    REQUIRE(publisher.has_value());
+    auto a = ShmSubscriber::attach(name);
+    auto b = ShmSubscriber::attach(name);
+    REQUIRE(a.has_value());
+    REQUIRE(b.has_value());
+    REQUIRE(publisher->subscribers() == 2);
+
+    const std::string_view fix = "8=FIX.4.4\x01" "35=D\x01";
+    REQUIRE(publisher->publish(ShmPayload::Fix, as_span(fix),
+                               {.session_id = 3, .seq_num = 17, .timestamp_ns = 123}));
+    char* sbe = publisher->claim(4, ShmPayload::Sbe);
+    REQUIRE(sbe != nullptr);
+    std::memcpy(sbe, "\x01\x02\x03\x04", 4);
+    publisher->commit();
+
+    std::vector<ShmMessage> seen;
+    std::string first_payload;
+    REQUIRE(a->poll([&](const ShmMessage& m) {
+        if (seen.empty()) first_payload.assign(m.payload.data(), m.payload.size());
+        seen.push_back(m);
+    }) == 2);
+    REQUIRE(seen[0].kind == ShmPayload::Fix);
+    REQUIRE(first_payload == fix);
+    REQUIRE(seen[0].meta.session_id == 3);
+    REQUIRE(seen[0].meta.seq_num == 17);
+    REQUIRE(seen[0].meta.timestamp_ns == 123);
+    REQUIRE(seen[1].kind == ShmPayload::Sbe);
+    REQUIRE(seen[1].payload.size() == 4);
+
+    // b reads the same records with peek/advance
+    auto msg = b->peek();
+    REQUIRE(msg.has_value());
+    REQUIRE(msg->meta.seq_num == 17);
+    REQUIRE(b->advance());
+    REQUIRE(b->peek()->kind == ShmPayload::Sbe);
+    REQUIRE(b->advance());
+    REQUIRE_FALSE(b->peek().has_value());
+
+    SECTION("Wrap inserts padding and records stay contiguous") {
+        const std::string big(1000, 'x');
+        for (int i = 0; i < 20; ++i) {
+            REQUIRE(publisher->publish(ShmPayload::User, as_span(big),
+                                       {.seq_num = static_cast<uint32_t>(i)}));
+            size_t got = 0;
+            bool intact = true;
+            auto check = [&](const ShmMessage& m) {
+                intact = intact && m.payload.size() == big.size() &&
+                         std::string_view{m.payload.data(), m.payload.size()} == big &&
+                         m.meta.seq_num == static_cast<uint32_t>(i);
+                ++got;
+            };
+            REQUIRE(a->poll(check) == 1);
+            REQUIRE(b->poll(check) == 1);
+            REQUIRE(got == 2);
+            REQUIRE(intact);
+        }
+        REQUIRE(publisher->position() > 4096);
+    }
+
+    SECTION("Slowest subscriber gates, then is detached") {
+        const std::string big(1000, 'y');
+        size_t published = 0;
+        while (publisher->publish(ShmPayload::User, as_span(big))) {
+            REQUIRE(a->poll([](const ShmMessage&) {}) == 1);
+            ++published;
+        }
+        REQUIRE(published == 3);  // b holds the rest of the 4 KiB
+        REQUIRE(b->lag() >= 3000);
+
+        REQUIRE(publisher->detach_slow(3000) == 1);
+        REQUIRE(b->detached());
+        REQUIRE_FALSE(a->detached());
+        REQUIRE(b->poll([](const ShmMessage&) {}) == 0);
+        REQUIRE(publisher->publish(ShmPayload::User, as_span(big)));
+        REQUIRE(publisher->subscribers() == 1);
+    }
+
+    SECTION("Oversized records and a second producer are rejected") {
+        const std::string huge(4096 / 2, 'z');
+        REQUIRE_FALSE(publisher->publish(ShmPayload::User, as_span(huge)));
+        auto second = ShmPublisher::attach(name);
+        REQUIRE_FALSE(second.has_value());
+        REQUIRE(second.error().code == TransportErrorCode::ConnectionRefused);
+    }
+}
+
+TEST_CASE("ShmSubscriber parks on the futex until a record arrives", "[memory][shm]") {
+    const auto name = shm_test_name("wake");
+    auto publisher = ShmPublisher::create(name, {.capacity = 4096});
+    REQUIRE(publisher.has_value());
+    auto subscriber = ShmSubscriber::attach(name);
+    REQUIRE(subscriber.has_value());
+
+    REQUIRE_FALSE(subscriber->wait(std::chrono::microseconds(1000)));
+
+    std::atomic<bool> woke{false};
+    std::thread consumer([&] {
+        woke.store(subscriber->wait(std::chrono::seconds(5)), std::memory_order_release);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(publisher->publish(ShmPayload::Fix, as_span(std::string_view{"35=0"})));
+    consumer.join();
+    REQUIRE(woke.load());
+    REQUIRE(subscriber->poll([](const ShmMessage&) {}) == 1);
+
+    publisher->close();
+    REQUIRE(subscriber->producer_closed());
+    REQUIRE_FALSE(subscriber->wait(std::chrono::seconds(5)));
+}
+
+#endif // NFX_SHM_AVAILABLE
+
+// ============================================================================
+// AdaptiveWait Tests
+// ============================================================================
+
+TEST_CASE("AdaptiveWait adapts its spin budget to recent waits", "[memory][wait]") {
+    using Wait = memory::AdaptiveWait<50, 1000>;
+
+    Wait::State busy{.avg_wait_ns = 500};
+    Wait::State steady{.avg_wait_ns = 5'000};
+    Wait::State quiet{.avg_wait_ns = 10'000'000};
+    REQUIRE(Wait::spin_budget_ns(busy) == 2'000);
+    REQUIRE(Wait::spin_budget_ns(steady) == 20'000);
+    REQUIRE(Wait::spin_budget_ns(quiet) == 1'000);
+
+    // An already-true predicate returns without touching the history
+    Wait::State state{};
+    Wait::wait_until(state, [] { return true; });
+    REQUIRE(state.avg_wait_ns == 0);
+}
+
+TEST_CASE("AdaptiveWait parks a consumer and wakes it on publish", "[memory][wait]") {
+    struct QueueTag {};
+    using Wait = memory::AdaptiveWait<10, 100'000, QueueTag>;
+    auto queue = std::make_unique<memory::SPSCQueue<int, 16, Wait>>();
+
+    std::atomic<int> received{-1};
+    std::thread consumer([&] {
+        received.store(queue->pop(), std::memory_order_release);
+    });
+
+    // Long enough for the consumer to pass spinning and park on the futex
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(received.load() == -1);
+
+    const auto published = std::chrono::steady_clock::now();
+    queue->push(42);
+    consumer.join();
+    const auto woken = std::chrono::steady_clock::now() - published;
+
+    REQUIRE(received.load() == 42);
+    REQUIRE(Wait::signal().sleepers() == 0);
+    // Woken by notify(), well before the 100ms park timeout
+    REQUIRE(woken < std::chrono::milliseconds(50));
+}
+
+TEST_CASE("DeferredProcessor idles with AdaptiveWait", "[memory][wait][deferred]") {
+    using Processor = util::DeferredProcessor<util::DeferredMessageBuffer<64>, 64,
+                                              memory::AdaptiveWait<>>;
+    auto processor = std::make_unique<Processor>();
+
+    std::atomic<int> processed{0};
+    REQUIRE(processor->start([&](const auto&) { processed.fetch_add(1); }));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    REQUIRE(processor->submit(as_span(std::string_view{"abc"}), 1));
+    REQUIRE(processor->submit(as_span(std::string_view{"def"}), 2));
+    while (processed.load() < 2) {
+        std::this_thread::yield();
+    }
+    processor->stop();
+    REQUIRE(processed.load() == 2);
+}
+
+TEST_CASE("InlineFunction stores captures inline", "[memory][deferred]") {
+    SECTION("Invokes, moves and destroys the callable") {
+        auto counter = std::make_shared<int>(0);
+        util::InlineFunction<int(int)> fn = [counter, pad = std::array<char, 32>{}](int x) {
+            return (*counter += x) + pad[0];
+        };
+        REQUIRE(fn);
+        REQUIRE(fn(2) == 2);
+        REQUIRE(counter.use_count() == 2);
+
+        util::InlineFunction<int(int)> moved = std::move(fn);
+        REQUIRE_FALSE(fn);
+        REQUIRE(moved(3) == 5);
+        REQUIRE(counter.use_count() == 2);
+
+        moved = nullptr;
+        REQUIRE_FALSE(moved);
+        REQUIRE(counter.use_count() == 1);
+    }
+
+    SECTION("Move-only captures") {
+        auto owned = std::make_unique<int>(7);
+        util::InlineFunction<int()> fn = [p = std::move(owned)] { return *p; };
+        REQUIRE(fn() == 7);
+    }
+
+    SECTION("DeferredCallbackExecutor runs scheduled lambdas") {
+        auto executor = std::make_unique<util::DeferredCallbackExecutor<>>();
+        std::atomic<int> total{0};
+        REQUIRE(executor->start());
+        for (int i = 1; i <= 10; ++i) {
+            REQUIRE(executor->schedule([&total, i, tag = std::array<int, 8>{}] {
+                total.fetch_add(i + tag[0]);
+            }));
+        }
+        while (total.load() < 55) {
+            std::this_thread::yield();
+        }
+        executor->stop();
+        REQUIRE(total.load() == 55);
+    }
+}
+
+TEST_CASE("LanedDeferredProcessor keeps per-session order across lanes", "[memory][deferred]") {
+    struct Seen {
+        std::mutex mutex;
+        std::vector<std::pair<uint64_t, std::string>> items;
+    } seen;
+    auto record = [&seen](uint64_t key, const util::DeferredMessageBuffer<64>& buffer) {
+        std::lock_guard lock{seen.mutex};
+        seen.items.emplace_back(key, std::string{buffer.span().data(), buffer.span().size()});
+    };
+    using Processor = util::LanedDeferredProcessor<decltype(record),
+                                                   util::DeferredMessageBuffer<64>, 16>;
+
+    SECTION("Every session stays in submission order") {
+        auto processor = std::make_unique<Processor>(4, record);
+        REQUIRE(processor->start());
+        for (int i = 0; i < 200; ++i) {
+            const uint64_t key = static_cast<uint64_t>(i % 7);
+            const std::string msg = std::to_string(i);
+            while (processor->submit(key, as_span(msg), 1) == util::SubmitStatus::Full) {
+                std::this_thread::yield();
+            }
+        }
+        processor->stop();
+        REQUIRE(processor->stats().processed == 200);
+
+        std::array<int, 7> last{};
+        last.fill(-1);
+        for (const auto& [key, msg] : seen.items) {
+            const int i = std::stoi(msg);
+            REQUIRE(i % 7 == static_cast<int>(key));
+            REQUIRE(i > last[key]);
+            last[key] = i;
+        }
+    }
+
+    SECTION("submit() signals backpressure before the lane fills") {
+        auto processor = std::make_unique<Processor>(2, record, 8);
+        const size_t lane = processor->lane_for(42);
+        const auto msg = as_span(std::string_view{"x"});
+
+        // Workers not started: the lane only fills
+        for (int i = 0; i < 7; ++i) {
+            REQUIRE(processor->submit(42, msg, 1) == util::SubmitStatus::Accepted);
+        }
+        REQUIRE_FALSE(processor->backpressured(42));
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(processor->submit(42, msg, 1) == util::SubmitStatus::Backpressure);
+        }
+        REQUIRE(processor->backpressured(42));
+        REQUIRE(processor->submit(42, msg, 1) == util::SubmitStatus::Full);
+
+        auto stats = processor->lane_stats(lane);
+        REQUIRE(stats.submitted == 15);
+        REQUIRE(stats.backpressured == 8);
+        REQUIRE(stats.rejected == 1);
+        REQUIRE(stats.max_depth == 15);
+
+        REQUIRE(processor->start());
+        processor->stop();
+        REQUIRE(processor->lane_stats(lane).processed == 15);
+        REQUIRE(seen.items.size() == 15);
+    }
 }
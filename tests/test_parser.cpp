@@ -1,14 +1,30 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <string>
+#include <array>
+#include <atomic>
+#include <cstdio>
 #include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
 
 #include "nexusfix/parser/field_view.hpp"
 #include "nexusfix/parser/simd_scanner.hpp"
 #include "nexusfix/parser/consteval_parser.hpp"
 #include "nexusfix/parser/runtime_parser.hpp"
+#include "nexusfix/parser/parallel_scanner.hpp"
 #include "nexusfix/parser/structural_index.hpp"
+#include "nexusfix/parser/simd_checksum.hpp"
 #include "nexusfix/interfaces/i_message.hpp"
+#include "nexusfix/messages/fix44/execution_report.hpp"
+#include "nexusfix/messages/fix44/new_order_single.hpp"
+#include "nexusfix/messages/fix44/new_order_template.hpp"
+#include "nexusfix/messages/fixt11/logon.hpp"
+#include "nexusfix/messages/common/scatter_message.hpp"
+#include "nexusfix/serializer/constexpr_serializer.hpp"
+#include "nexusfix/util/deferred_processor.hpp"
+#include "nexusfix/util/symbol_table.hpp"
 
 using namespace nfx;
 
@@ -206,6 +222,137 @@ TEST_CASE("SIMD SOH scanning", "[parser][simd][regression]") {
     }
 }
 
+TEST_CASE("SIMD scanner and checksum runtime dispatch", "[parser][simd][regression]") {
+    // Long buffer with fields straddling every kernel's chunk boundaries
+    std::string data;
+    while (data.size() < 700) {
+        data += "9" + std::to_string(data.size() % 97) + "=" +
+                std::string(data.size() % 13, 'v') + "\x01";
+    }
+    std::span<const char> span{data.data(), data.size()};
+
+    SECTION("Selected tiers are supported by this CPU") {
+        REQUIRE(simd::cpu_supports(simd::active_scanner_impl()));
+        REQUIRE(simd::cpu_supports(parser::active_checksum_impl()));
+    }
+
+    SECTION("Dispatched results match scalar") {
+        auto expected = simd::scan_soh_scalar(span);
+        auto actual = simd::scan_soh(span);
+        REQUIRE(actual.count == expected.count);
+        for (size_t i = 0; i < expected.count; ++i) {
+            REQUIRE(actual[i] == expected[i]);
+        }
+
+        for (size_t start : {size_t{0}, size_t{5}, size_t{131}, size_t{400}}) {
+            REQUIRE(simd::find_soh(span, start) == simd::find_soh_scalar(span, start));
+            REQUIRE(simd::find_equals(span, start) == simd::find_equals_scalar(span, start));
+        }
+        REQUIRE(simd::count_soh(span) == simd::count_soh_scalar(span));
+        REQUIRE(parser::checksum(data.data(), data.size()) ==
+                parser::checksum_scalar(data.data(), data.size()));
+    }
+
+    SECTION("Fused copy+checksum matches memcpy and checksum") {
+        for (size_t len : {size_t{0}, size_t{1}, size_t{15}, size_t{33}, size_t{257}, data.size()}) {
+            std::string out(len, '\0');
+            REQUIRE(parser::copy_checksum(out.data(), data.data(), len) ==
+                    parser::checksum_scalar(data.data(), len));
+            REQUIRE(out == data.substr(0, len));
+        }
+
+        // SOH offsets agree with the scanner up to the caller's capacity
+        auto expected = simd::scan_soh_scalar(span);
+        for (size_t cap : {size_t{0}, size_t{3}, size_t{40}, size_t{1000}}) {
+            std::vector<uint32_t> soh(cap);
+            std::string out(data.size(), '\0');
+            auto scan = parser::copy_checksum_soh(out.data(), data.data(), data.size(), soh);
+            REQUIRE(out == data);
+            REQUIRE(scan.checksum == parser::checksum_scalar(data.data(), data.size()));
+            REQUIRE(scan.soh_count == std::min(cap, expected.count));
+            for (size_t i = 0; i < scan.soh_count; ++i) {
+                REQUIRE(soh[i] == expected[i]);
+            }
+        }
+    }
+
+#if NFX_AVX512_DISPATCH
+    SECTION("AVX-512 kernels match scalar where supported") {
+        if (simd::cpu_supports(simd::SimdImpl::AVX512)) {
+            REQUIRE(simd::count_soh_avx512(span) == simd::count_soh_scalar(span));
+            REQUIRE(simd::find_equals_avx512(span, 200) == simd::find_equals_scalar(span, 200));
+        }
+    }
+#endif
+
+#if NFX_HAS_NEON
+    SECTION("NEON kernels match scalar") {
+        auto expected = simd::scan_soh_scalar(span);
+        auto actual = simd::scan_soh_neon(span);
+        REQUIRE(actual.count == expected.count);
+        for (size_t i = 0; i < expected.count; ++i) {
+            REQUIRE(actual[i] == expected[i]);
+        }
+        for (size_t start : {size_t{0}, size_t{5}, size_t{131}, size_t{400}}) {
+            REQUIRE(simd::find_soh_neon(span, start) == simd::find_soh_scalar(span, start));
+            REQUIRE(simd::find_equals_neon(span, start) == simd::find_equals_scalar(span, start));
+        }
+        REQUIRE(simd::count_soh_neon(span) == simd::count_soh_scalar(span));
+        REQUIRE(parser::checksum_neon(data.data(), data.size()) ==
+                parser::checksum_scalar(data.data(), data.size()));
+
+        std::span<const char> msg{EXEC_REPORT.data(), EXEC_REPORT.size()};
+        auto ref = simd::build_index_scalar(msg);
+        auto idx = simd::build_index_neon(msg);
+        REQUIRE(idx.soh_count == ref.soh_count);
+        REQUIRE(idx.equals_count == ref.equals_count);
+        REQUIRE(idx.msg_type_start == ref.msg_type_start);
+        REQUIRE(idx.checksum_start == ref.checksum_start);
+    }
+#endif
+
+#if NFX_HAS_SVE2
+    SECTION("SVE2 kernels match scalar where supported") {
+        if (simd::cpu_supports(simd::SimdImpl::SVE2)) {
+            REQUIRE(simd::scan_soh_sve2(span).count == simd::scan_soh_scalar(span).count);
+            REQUIRE(simd::find_equals_sve2(span, 200) == simd::find_equals_scalar(span, 200));
+            REQUIRE(simd::count_soh_sve2(span) == simd::count_soh_scalar(span));
+            REQUIRE(parser::checksum_sve2(data.data(), data.size()) ==
+                    parser::checksum_scalar(data.data(), data.size()));
+
+            std::span<const char> msg{EXEC_REPORT.data(), EXEC_REPORT.size()};
+            auto ref = simd::build_index_scalar(msg);
+            auto idx = simd::build_index_sve2(msg);
+            REQUIRE(idx.soh_count == ref.soh_count);
+            REQUIRE(idx.equals_count == ref.equals_count);
+            REQUIRE(idx.checksum_start == ref.checksum_start);
+        }
+    }
+#endif
+
+#if NFX_CHECKSUM_DISPATCH
+    SECTION("Checksum kernels match scalar where supported") {
+        const uint8_t expected = parser::checksum_scalar(data.data(), data.size());
+        REQUIRE(parser::checksum_sse2(data.data(), data.size()) == expected);
+        if (simd::cpu_supports(simd::SimdImpl::AVX2)) {
+            REQUIRE(parser::checksum_avx2(data.data(), data.size()) == expected);
+        }
+        if (simd::cpu_supports(simd::SimdImpl::AVX512)) {
+            REQUIRE(parser::checksum_avx512(data.data(), data.size()) == expected);
+        }
+
+        std::string out(data.size(), '\0');
+        REQUIRE(parser::copy_checksum_sse2(out.data(), data.data(), data.size()) == expected);
+        REQUIRE(out == data);
+        if (simd::cpu_supports(simd::SimdImpl::AVX2)) {
+            out.assign(data.size(), '\0');
+            REQUIRE(parser::copy_checksum_avx2(out.data(), data.data(), data.size()) == expected);
+            REQUIRE(out == data);
+        }
+    }
+#endif
+}
+
 // ============================================================================
 // Consteval Parser Tests
 // ============================================================================
@@ -244,6 +391,75 @@ TEST_CASE("Header parsing", "[parser][consteval][regression]") {
     }
 }
 
+TEST_CASE("HeaderLayout matches parse_header", "[parser][consteval][regression]") {
+    auto same = [](const HeaderParseResult& a, const HeaderParseResult& b) {
+        REQUIRE(a.error.code == b.error.code);
+        REQUIRE(a.error.tag == b.error.tag);
+        REQUIRE(a.body_start == b.body_start);
+        REQUIRE(a.header.begin_string == b.header.begin_string);
+        REQUIRE(a.header.body_length == b.header.body_length);
+        REQUIRE(a.header.msg_type == b.header.msg_type);
+        REQUIRE(a.header.sender_comp_id == b.header.sender_comp_id);
+        REQUIRE(a.header.target_comp_id == b.header.target_comp_id);
+        REQUIRE(a.header.msg_seq_num == b.header.msg_seq_num);
+        REQUIRE(a.header.sending_time == b.header.sending_time);
+    };
+    const std::span<const char> exec{EXEC_REPORT.data(), EXEC_REPORT.size()};
+    const std::span<const char> logon{LOGON.data(), LOGON.size()};
+
+    SECTION("Learned from the first message") {
+        HeaderLayout layout;
+        same(layout.parse(exec), parse_header(exec));
+        REQUIRE(layout.learned());
+        REQUIRE(layout.field_count() == 7);
+        REQUIRE(layout.tag_at(2) == tag::MsgType::value);
+
+        same(layout.parse(exec), parse_header(exec));
+        same(layout.parse(logon), parse_header(logon));
+        REQUIRE(layout.hits() == 2);
+        REQUIRE(layout.misses() == 1);
+    }
+
+    SECTION("Different order falls back") {
+        const std::array<int, 7> order{8, 9, 35, 34, 49, 52, 56};
+        HeaderLayout layout{order};
+        REQUIRE(layout.learned());
+        same(layout.parse(exec), parse_header(exec));
+        REQUIRE(layout.hits() == 0);
+        REQUIRE(layout.misses() == 1);
+    }
+
+    SECTION("Relearns after consecutive misses") {
+        const std::array<int, 7> order{8, 9, 35, 34, 49, 52, 56};
+        HeaderLayout layout{order};
+        for (uint32_t i = 0; i < HeaderLayout::RELEARN_AFTER; ++i) {
+            (void)layout.parse(exec);
+        }
+        REQUIRE(layout.tag_at(3) == tag::SenderCompID::value);
+        (void)layout.parse(exec);
+        REQUIRE(layout.hits() == 1);
+    }
+
+    SECTION("Malformed values report parse_header's error") {
+        std::string bad = EXEC_REPORT;
+        bad.replace(bad.find("34=1"), 4, "34=x");
+        HeaderLayout layout;
+        (void)layout.parse(exec);
+        const std::span<const char> data{bad.data(), bad.size()};
+        same(layout.parse(data), parse_header(data));
+        REQUIRE(layout.hits() == 0);
+    }
+
+    SECTION("Rejects a non-header order") {
+        const std::array<int, 3> partial{8, 9, 35};
+        const std::array<int, 7> body{8, 9, 35, 55, 49, 56, 34};
+        HeaderLayout layout;
+        REQUIRE_FALSE(layout.configure(partial));
+        REQUIRE_FALSE(layout.configure(body));
+        REQUIRE_FALSE(layout.learned());
+    }
+}
+
 // ============================================================================
 // Runtime Parser Tests
 // ============================================================================
@@ -281,6 +497,235 @@ TEST_CASE("ParsedMessage", "[parser][runtime][regression]") {
         }
         REQUIRE(count == result->field_count());
     }
+
+    SECTION("Value containing '=' parses via scan path") {
+        std::string msg = "8=FIX.4.4\x01" "9=38\x01" "35=j\x01" "49=SENDER\x01"
+                          "56=TARGET\x01" "34=2\x01" "58=a=b\x01";
+        char cs[4];
+        parser::format_checksum(fix::calculate_checksum(
+            std::span<const char>{msg.data(), msg.size()}), cs);
+        msg += "10=" + std::string{cs, 3} + "\x01";
+
+        auto result = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(result.has_value());
+        REQUIRE(result->get_string(58) == "a=b");
+        REQUIRE(result->get_int(34) == 2);
+    }
+
+    SECTION("Indexed path keeps every field including the trailer") {
+        auto result = ParsedMessage::parse(
+            std::span<const char>{EXEC_REPORT.data(), EXEC_REPORT.size()});
+        REQUIRE(result.has_value());
+        REQUIRE(result->field_count() == 19);
+        REQUIRE(result->field_at(0).tag == 8);
+        REQUIRE(result->field_at(18).tag == 10);
+        REQUIRE(result->field_at(18).as_string() == "004");
+    }
+
+    SECTION("Fields are compact offsets into the raw buffer") {
+        STATIC_REQUIRE(sizeof(ParsedMessage) <= ParsedMessage::MAX_FIELDS * 6 + 256);
+
+        auto result = ParsedMessage::parse(
+            std::span<const char>{EXEC_REPORT.data(), EXEC_REPORT.size()});
+        REQUIRE(result.has_value());
+        const FieldView symbol = result->get_field(55);
+        REQUIRE(symbol.value.data() >= EXEC_REPORT.data());
+        REQUIRE(symbol.value.data() < EXEC_REPORT.data() + EXEC_REPORT.size());
+        REQUIRE(symbol.as_string() == "AAPL");
+    }
+
+    SECTION("assign() parses into caller-provided storage") {
+        auto storage = std::make_unique<ParsedMessage>();
+        REQUIRE(storage->assign(std::span<const char>{EXEC_REPORT.data(), EXEC_REPORT.size()}));
+        REQUIRE(storage->msg_type() == '8');
+        REQUIRE(storage->get_string(37) == "ORDER123");
+
+        REQUIRE(storage->assign(std::span<const char>{HEARTBEAT.data(), HEARTBEAT.size()}));
+        REQUIRE(storage->msg_type() == '0');
+        REQUIRE_FALSE(storage->has_field(37));
+
+        const std::string garbled = "8=FIX.4.4\x01" "9=5\x01";
+        REQUIRE_FALSE(storage->assign(std::span<const char>{garbled.data(), garbled.size()}));
+        REQUIRE(storage->field_count() == 0);
+    }
+
+    SECTION("Messages beyond 16-bit offsets are rejected") {
+        const std::string text(70000, 'x');
+        const std::string body = "35=B\x01" "49=SENDER\x01" "56=TARGET\x01" "34=3\x01"
+                                 "148=" + text + "\x01" "33=1\x01";
+        std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(body.size()) + "\x01" + body;
+        char cs[4];
+        parser::format_checksum(fix::calculate_checksum(
+            std::span<const char>{msg.data(), msg.size()}), cs);
+        msg += "10=" + std::string{cs, 3} + "\x01";
+
+        auto result = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::GarbledMessage);
+    }
+
+    SECTION("Tags beyond 16 bits are rejected") {
+        std::string msg = "8=FIX.4.4\x01" "9=46\x01" "35=0\x01" "49=SENDER\x01"
+                          "56=TARGET\x01" "34=2\x01" "70000=1\x01";
+        char cs[4];
+        parser::format_checksum(fix::calculate_checksum(
+            std::span<const char>{msg.data(), msg.size()}), cs);
+        msg += "10=" + std::string{cs, 3} + "\x01";
+
+        auto result = ParsedMessage::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::InvalidTagNumber);
+    }
+}
+
+TEST_CASE("Schema-driven ExecutionReport decode", "[parser][schema][regression]") {
+    std::span<const char> data{EXEC_REPORT.data(), EXEC_REPORT.size()};
+
+    SECTION("Matches from_buffer field-for-field") {
+        auto decoded = fix44::ExecutionReport::decode(data);
+        auto reference = fix44::ExecutionReport::from_buffer(data);
+        REQUIRE(decoded.has_value());
+        REQUIRE(reference.has_value());
+
+        REQUIRE(decoded->header.msg_seq_num == reference->header.msg_seq_num);
+        REQUIRE(decoded->header.sender_comp_id == "SENDER");
+        REQUIRE(decoded->header.body_length == 176);
+        REQUIRE(decoded->order_id == reference->order_id);
+        REQUIRE(decoded->exec_id == reference->exec_id);
+        REQUIRE(decoded->exec_type == reference->exec_type);
+        REQUIRE(decoded->ord_status == reference->ord_status);
+        REQUIRE(decoded->symbol == "AAPL");
+        REQUIRE(decoded->side == Side::Buy);
+        REQUIRE(decoded->order_qty.raw == reference->order_qty.raw);
+        REQUIRE(decoded->price.raw == reference->price.raw);
+        REQUIRE(decoded->leaves_qty.raw == reference->leaves_qty.raw);
+        REQUIRE(decoded->raw().size() == EXEC_REPORT.size());
+    }
+
+    SECTION("Missing required field reported by tag") {
+        std::string msg = "8=FIX.4.4\x01" "9=60\x01" "35=8\x01" "49=SENDER\x01"
+                          "56=TARGET\x01" "34=1\x01" "17=E1\x01" "150=0\x01"
+                          "39=0\x01" "55=AAPL\x01" "54=1\x01";
+        char cs[4];
+        parser::format_checksum(fix::calculate_checksum(
+            std::span<const char>{msg.data(), msg.size()}), cs);
+        msg += "10=" + std::string{cs, 3} + "\x01";
+
+        auto decoded = fix44::ExecutionReport::decode(
+            std::span<const char>{msg.data(), msg.size()});
+        REQUIRE_FALSE(decoded.has_value());
+        REQUIRE(decoded.error().code == ParseErrorCode::MissingRequiredField);
+        REQUIRE(decoded.error().tag == tag::OrderID::value);
+    }
+
+    SECTION("Wrong message type rejected") {
+        auto decoded = fix44::ExecutionReport::decode(
+            std::span<const char>{HEARTBEAT.data(), HEARTBEAT.size()});
+        REQUIRE_FALSE(decoded.has_value());
+    }
+
+    SECTION("Strict check rejects a repeated schema tag") {
+        std::string msg = "8=FIX.4.4\x01" "9=70\x01" "35=8\x01" "49=SENDER\x01"
+                          "56=TARGET\x01" "34=1\x01" "37=O1\x01" "17=E1\x01"
+                          "150=0\x01" "39=0\x01" "55=AAPL\x01" "55=MSFT\x01" "54=1\x01";
+        char cs[4];
+        parser::format_checksum(fix::calculate_checksum(
+            std::span<const char>{msg.data(), msg.size()}), cs);
+        msg += "10=" + std::string{cs, 3} + "\x01";
+        std::span<const char> span{msg.data(), msg.size()};
+
+        REQUIRE(fix44::ExecutionReport::decode(span).has_value());
+
+        auto strict = fix44::ExecutionReport::decode<SchemaCheck::Strict>(span);
+        REQUIRE_FALSE(strict.has_value());
+        REQUIRE(strict.error().code == ParseErrorCode::DuplicateTag);
+        REQUIRE(strict.error().tag == tag::Symbol::value);
+
+        REQUIRE(fix44::ExecutionReport::decode<SchemaCheck::Strict>(data).has_value());
+    }
+}
+
+TEST_CASE("SchemaValidator presence mask", "[parser][schema]") {
+    using Schema = MessageSchema<
+        FieldSpec<35>, FieldSpec<49>,
+        FieldSpec<58, FieldRequirement::Optional>, FieldSpec<56>>;
+    using Validator = SchemaValidator<Schema>;
+
+    static_assert(Schema::required_mask == 0b1011);
+    static_assert(Schema::index_of(56) == 3);
+    static_assert(Schema::index_of(10) == -1);
+
+    Validator::Tracker tracker;
+    REQUIRE(tracker.add(35));
+    REQUIRE(tracker.add(999));
+    REQUIRE(tracker.add(56));
+    REQUIRE(tracker.result().code == ParseErrorCode::MissingRequiredField);
+    REQUIRE(tracker.result().tag == 49);
+
+    REQUIRE(tracker.add(49));
+    REQUIRE(tracker.add(999));      // Tags outside the schema may repeat
+    REQUIRE(tracker.result().ok());
+
+    REQUIRE_FALSE(tracker.add(35));
+    REQUIRE(tracker.result().code == ParseErrorCode::DuplicateTag);
+    REQUIRE(tracker.result().tag == 35);
+}
+
+TEST_CASE("Deferred checksum verification", "[parser][checksum][regression]") {
+    std::string bad = HEARTBEAT;
+    bad[bad.size() - 2] = (bad[bad.size() - 2] == '0') ? '1' : '0';
+    std::span<const char> good_span{HEARTBEAT.data(), HEARTBEAT.size()};
+    std::span<const char> bad_span{bad.data(), bad.size()};
+
+    SECTION("Deferred policy delivers, verify_checksum catches") {
+        REQUIRE_FALSE(ParsedMessage::parse(bad_span).has_value());
+
+        auto deferred = ParsedMessage::parse<ChecksumPolicy::Deferred>(bad_span);
+        REQUIRE(deferred.has_value());
+        REQUIRE(deferred->msg_seq_num() == 5);
+        REQUIRE(deferred->verify_checksum().code == ParseErrorCode::InvalidChecksum);
+
+        auto ok = ParsedMessage::parse<ChecksumPolicy::Deferred>(good_span);
+        REQUIRE(ok->verify_checksum().code == ParseErrorCode::None);
+    }
+
+    SECTION("SIMD verify agrees with validate_checksum") {
+        REQUIRE(verify_checksum(good_span).code == validate_checksum(good_span).code);
+        REQUIRE(verify_checksum(bad_span).code == validate_checksum(bad_span).code);
+        std::span<const char> exec{EXEC_REPORT.data(), EXEC_REPORT.size()};
+        REQUIRE(verify_checksum(exec).code == ParseErrorCode::None);
+    }
+
+    SECTION("Batched verification after parse_batch") {
+        std::string buffer = HEARTBEAT + bad + LOGON;
+        std::vector<ParsedMessage> out(4);
+        auto result = parse_batch<ChecksumPolicy::Deferred>(
+            std::span<const char>{buffer.data(), buffer.size()}, out);
+        REQUIRE(result.count == 3);
+
+        std::vector<size_t> failed;
+        size_t failures = verify_checksums(
+            std::span<const ParsedMessage>{out.data(), result.count},
+            [&](size_t i, ParseError) { failed.push_back(i); });
+        REQUIRE(failures == 1);
+        REQUIRE(failed == std::vector<size_t>{1});
+    }
+
+    SECTION("Background verifier reports failures") {
+        std::atomic<int> errors{0};
+        util::DeferredChecksumVerifier<512, 64> verifier;
+        REQUIRE(verifier.start([&](std::span<const char>, ParseError err) {
+            if (err.code == ParseErrorCode::InvalidChecksum) ++errors;
+        }));
+        REQUIRE(verifier.submit(good_span));
+        REQUIRE(verifier.submit(bad_span));
+        REQUIRE(verifier.submit(good_span));
+        verifier.stop();
+
+        REQUIRE(verifier.verified() == 3);
+        REQUIRE(verifier.failed() == 1);
+        REQUIRE(errors == 1);
+    }
 }
 
 TEST_CASE("IndexedParser O(1) lookup", "[parser][runtime][regression]") {
@@ -307,6 +752,208 @@ TEST_CASE("IndexedParser O(1) lookup", "[parser][runtime][regression]") {
     }
 }
 
+TEST_CASE("SymbolTable interns symbols to dense ids", "[parser][symbol]") {
+    static constexpr std::array<std::string_view, 3> SEED{"AAPL", "MSFT", "GOOGL"};
+    static_assert(util::seeded_symbol_id(SEED, "GOOGL") == SymbolId{2});
+    static_assert(!util::seeded_symbol_id(SEED, "TSLA").valid());
+
+    auto symbols = std::make_unique<util::SymbolTable>(SEED);
+    REQUIRE(symbols->size() == 3);
+    REQUIRE(symbols->find("MSFT") == SymbolId{1});
+    REQUIRE_FALSE(symbols->find("TSLA").valid());
+
+    // Dense ids in order of first sight; repeat interns are lookups
+    REQUIRE(symbols->intern("TSLA") == SymbolId{3});
+    REQUIRE(symbols->intern("TSLA") == SymbolId{3});
+    REQUIRE(symbols->intern("AAPL") == SymbolId{0});
+    REQUIRE(symbols->name(SymbolId{3}) == "TSLA");
+
+    // Prefixes and padding must not alias
+    REQUIRE_FALSE(symbols->find("AAP").valid());
+    REQUIRE_FALSE(symbols->find(std::string_view{"AAPL\0", 5}).valid());
+
+    const std::string longest(util::SymbolTable::MAX_SYMBOL_LEN, 'X');
+    REQUIRE(symbols->intern(longest).valid());
+    REQUIRE_FALSE(symbols->intern(longest + "X").valid());
+    REQUIRE_FALSE(symbols->intern("").valid());
+
+    auto parsed = IndexedParser::parse(std::span<const char>{EXEC_REPORT.data(), EXEC_REPORT.size()});
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->get_symbol_id(*symbols) == SymbolId{0});
+
+    SECTION("Full table rejects new symbols but still finds old ones") {
+        util::BasicSymbolTable<4> small;
+        for (std::string_view s : {"A", "B", "C", "D"}) REQUIRE(small.intern(s).valid());
+        REQUIRE_FALSE(small.intern("E").valid());
+        REQUIRE(small.find("D") == SymbolId{3});
+        REQUIRE(small.intern("C") == SymbolId{2});
+    }
+}
+
+TEST_CASE("IndexedParser indexes once and re-parses in place", "[parser][runtime]") {
+    auto with_checksum = [](std::string msg) {
+        char cs[4];
+        parser::format_checksum(fix::calculate_checksum(
+            std::span<const char>{msg.data(), msg.size()}), cs);
+        return msg + "10=" + std::string{cs, 3} + "\x01";
+    };
+
+    SECTION("Header comes from the field index") {
+        const std::string msg = with_checksum(
+            "8=FIX.4.4\x01" "9=80\x01" "35=D\x01" "34=7\x01" "49=SENDER\x01"
+            "52=20260101-00:00:00.000\x01" "56=TARGET\x01" "43=Y\x01"
+            "122=20251231-23:59:59.000\x01" "11=ORD1\x01");
+        auto parsed = IndexedParser::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->msg_type() == 'D');
+        REQUIRE(parsed->msg_seq_num() == 7);
+        REQUIRE(parsed->sender_comp_id() == "SENDER");
+        REQUIRE(parsed->target_comp_id() == "TARGET");
+        REQUIRE(parsed->sending_time() == "20260101-00:00:00.000");
+        REQUIRE(parsed->header().poss_dup_flag);
+        REQUIRE(parsed->header().orig_sending_time == "20251231-23:59:59.000");
+        REQUIRE(parsed->field_count() == 11);
+        REQUIRE(parsed->field_at(0).tag == 8);
+        REQUIRE(parsed->field_at(10).tag == 10);
+    }
+
+    SECTION("assign() forgets the previous message's fields") {
+        IndexedParser parser;
+        REQUIRE(parser.assign(std::span<const char>{EXEC_REPORT.data(), EXEC_REPORT.size()}));
+        REQUIRE(parser.get_string(55) == "AAPL");
+
+        REQUIRE(parser.assign(std::span<const char>{HEARTBEAT.data(), HEARTBEAT.size()}));
+        REQUIRE(parser.msg_type() == '0');
+        REQUIRE(parser.msg_seq_num() == 5);
+        REQUIRE_FALSE(parser.has_field(55));
+        REQUIRE_FALSE(parser.has_field(37));
+
+        std::string bad = HEARTBEAT;
+        bad.replace(bad.find("34=5"), 4, "34=X");
+        auto err = parser.assign(std::span<const char>{bad.data(), bad.size()});
+        REQUIRE_FALSE(err.has_value());
+        REQUIRE(err.error().code == ParseErrorCode::InvalidFieldFormat);
+        REQUIRE(parser.field_count() == 0);
+        REQUIRE_FALSE(parser.has_field(49));
+    }
+
+    SECTION("Missing header fields are reported like parse_header") {
+        const std::string msg = with_checksum(
+            "8=FIX.4.4\x01" "9=40\x01" "35=0\x01" "49=SENDER\x01"
+            "56=TARGET\x01" "52=20260101-00:00:00\x01");
+        auto parsed = IndexedParser::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE_FALSE(parsed.has_value());
+        REQUIRE(parsed.error().code == ParseErrorCode::MissingRequiredField);
+        REQUIRE(parsed.error().tag == tag::MsgSeqNum::value);
+    }
+
+    SECTION("Fields past MAX_FIELDS are still found") {
+        std::string body = "8=FIX.4.4\x01" "9=1\x01" "35=W\x01" "34=1\x01"
+                           "49=SENDER\x01" "52=20260101-00:00:00\x01" "56=TARGET\x01";
+        for (size_t i = 0; i < IndexedParser::MAX_FIELDS; ++i) body += "269=0\x01";
+        body += "58=tail\x01";
+        const std::string msg = with_checksum(body);
+        auto parsed = IndexedParser::parse(std::span<const char>{msg.data(), msg.size()});
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->field_count() == IndexedParser::MAX_FIELDS);
+        REQUIRE(parsed->get_string(58) == "tail");
+        REQUIRE_FALSE(parsed->has_field(60));
+    }
+
+    SECTION("Custom tags are indexed and forgotten with the message") {
+        std::string body = "8=FIX.4.4\x01" "9=1\x01" "35=D\x01" "34=1\x01"
+                           "49=SENDER\x01" "52=20260101-00:00:00\x01" "56=TARGET\x01"
+                           "1128=9\x01" "5001=alpha\x01" "9001=beta\x01";
+        for (int t = 9100; t < 9100 + 60; ++t) body += std::to_string(t) + "=x\x01";
+        const std::string msg = with_checksum(body);
+
+        IndexedParser parser;
+        REQUIRE(parser.assign(std::span<const char>{msg.data(), msg.size()}));
+        REQUIRE(parser.get_string(1128) == "9");
+        REQUIRE(parser.get_string(5001) == "alpha");
+        REQUIRE(parser.get_string(9001) == "beta");
+        REQUIRE(parser.get_string(9159) == "x");   // Past the spill limit: scanned
+
+        REQUIRE(parser.assign(std::span<const char>{HEARTBEAT.data(), HEARTBEAT.size()}));
+        REQUIRE_FALSE(parser.has_field(5001));
+        REQUIRE_FALSE(parser.has_field(9159));
+    }
+}
+
+namespace venue {
+using OrderRef   = tag::CustomTag<5001, std::string_view>;
+using Fee        = tag::CustomTag<9050, FixedPrice>;
+using Priority   = tag::CustomTag<9051, uint32_t>;
+using Offset     = tag::CustomTag<9052, int32_t>;
+using Liquidity  = tag::CustomTag<9053, Side>;
+using Hidden     = tag::CustomTag<9054, bool>;
+using Missing    = tag::CustomTag<9999, uint32_t>;
+using FixedFee   = tag::CustomTag<9050, FixedPrice, tag::FixedDecimals<4>>;
+using SeqNo      = tag::TypedField<34, SeqNum, tag::FixedDigits<1>>;
+using PaddedId   = tag::CustomTag<9056, uint64_t, tag::FixedDigits<10>>;
+}  // namespace venue
+
+TEST_CASE("IndexedParser typed custom tags", "[parser][runtime]") {
+    static_assert(tag::TypedTag<venue::Fee>);
+    static_assert(!tag::TypedTag<tag::Price>);
+    static_assert(venue::Fee::value == 9050);
+
+    std::string msg = "8=FIX.4.4\x01" "9=1\x01" "35=8\x01" "34=3\x01"
+                      "49=VENUE\x01" "52=20260101-00:00:00\x01" "56=CLIENT\x01"
+                      "5001=REF-7\x01" "9050=0.0125\x01" "9051=42\x01" "9052=-3\x01"
+                      "9053=2\x01" "9054=Y\x01" "9055=abc\x01" "9056=0000012345\x01";
+    char cs[4];
+    parser::format_checksum(fix::calculate_checksum(
+        std::span<const char>{msg.data(), msg.size()}), cs);
+    msg += "10=" + std::string{cs, 3} + "\x01";
+
+    auto parsed = IndexedParser::parse(std::span<const char>{msg.data(), msg.size()});
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->get<venue::OrderRef>() == "REF-7");
+    REQUIRE(parsed->get<venue::Fee>()->raw == FixedPrice::from_string("0.0125").raw);
+    REQUIRE(parsed->get<venue::Priority>() == 42u);
+    REQUIRE(parsed->get<venue::Offset>() == -3);
+    REQUIRE(parsed->get<venue::Liquidity>() == Side::Sell);
+    REQUIRE(parsed->get<venue::Hidden>() == true);
+    REQUIRE_FALSE(parsed->get<venue::Missing>().has_value());
+    REQUIRE_FALSE(parsed->get<tag::CustomTag<9055, int64_t>>().has_value());
+
+    // Declared layouts take the fixed-width conversions, same values
+    REQUIRE(parsed->get<venue::FixedFee>()->raw == parsed->get<venue::Fee>()->raw);
+    REQUIRE(parsed->get<venue::SeqNo>()->get() == 3);
+    REQUIRE(parsed->get<venue::PaddedId>() == 12345u);
+    REQUIRE(parsed->get<tag::CustomTag<9052, int32_t, tag::FixedDigits<2>>>() == -3);
+}
+
+TEST_CASE("CompactTagMap", "[parser][runtime]") {
+    CompactTagMap<512, 8> map;
+    REQUIRE(map.set(35, 2));
+    REQUIRE(map.set(9001, 7));
+    REQUIRE(map.get(35) == 2);
+    REQUIRE(map.get(9001) == 7);
+    REQUIRE_FALSE(map.has(9002));
+    REQUIRE_FALSE(map.set(0, 1));
+    REQUIRE_FALSE(map.set(36, CompactTagMap<512, 8>::INVALID_INDEX));
+
+    REQUIRE(map.set(9001, 9));                  // Last write wins
+    REQUIRE(map.get(9001) == 9);
+    REQUIRE(map.spilled() == 1);
+
+    for (int t = 6000; map.spilled() < CompactTagMap<512, 8>::SPILL_LIMIT; ++t) {
+        REQUIRE(map.set(t, 1));
+    }
+    REQUIRE_FALSE(map.set(7000, 1));
+
+    // 300 clears wrap the 8-bit generation at least once
+    for (int i = 0; i < 300; ++i) {
+        map.clear();
+        REQUIRE_FALSE(map.has(35));
+        REQUIRE_FALSE(map.has(9001));
+        REQUIRE(map.set(35, static_cast<uint8_t>(i % 200)));
+        REQUIRE(map.get(35) == i % 200);
+    }
+}
+
 // ============================================================================
 // Message Type Detection
 // ============================================================================
@@ -384,6 +1031,114 @@ TEST_CASE("StreamParser message framing", "[parser][stream][regression]") {
         REQUIRE(start == 0);
         REQUIRE(end == HEARTBEAT.size());
     }
+
+    SECTION("More messages than pending slots are not dropped") {
+        constexpr size_t COUNT = StreamParser::MAX_PENDING + 4;
+        std::string buffer;
+        for (size_t i = 0; i < COUNT; ++i) buffer += HEARTBEAT;
+        std::span<const char> data{buffer.data(), buffer.size()};
+
+        size_t found = 0;
+        size_t pos = 0;
+        while (pos < data.size()) {
+            size_t consumed = parser.feed(data.subspan(pos));
+            REQUIRE(consumed > 0);
+            while (parser.has_message()) {
+                auto [start, end] = parser.next_message();
+                REQUIRE(end - start == HEARTBEAT.size());
+                ++found;
+            }
+            pos += consumed;
+        }
+        REQUIRE(found == COUNT);
+    }
+}
+
+TEST_CASE("dispatch_batch overlaps state prefetch with handling", "[parser][stream][prefetch]") {
+    auto table = std::make_unique<util::SymbolTable>();
+    auto& symbols = *table;
+    const SymbolId aapl = symbols.intern("AAPL");
+
+    std::string bad = HEARTBEAT;
+    bad[bad.size() - 2] = (bad[bad.size() - 2] == '0') ? '1' : '0';  // Break checksum
+    std::string buffer = EXEC_REPORT + HEARTBEAT + bad + EXEC_REPORT + LOGON.substr(0, 30);
+
+    // Events in call order: 'p' = prefetch_state, 'h' = handler, then msg type
+    std::vector<std::string> events;
+    std::vector<SymbolId> resolved;
+    auto result = dispatch_batch(
+        std::span<const char>{buffer.data(), buffer.size()},
+        [&](const ParsedMessage& msg) {
+            symbols.prefetch(msg.get_string(55));
+            events.push_back(std::string{"p"} + msg.msg_type());
+        },
+        [&](const ParsedMessage& msg) {
+            events.push_back(std::string{"h"} + msg.msg_type());
+            if (msg.msg_type() == msg_type::ExecutionReport) {
+                resolved.push_back(symbols.find(msg.get_string(55)));
+            }
+        });
+
+    REQUIRE(result.count == 3);
+    REQUIRE(result.errors == 1);
+    REQUIRE(result.consumed == buffer.size() - 30);
+    // Message N+1's state is requested before message N is handled
+    REQUIRE(events == std::vector<std::string>{"p8", "p0", "h8", "p8", "h0", "h8"});
+    REQUIRE(resolved == std::vector<SymbolId>{aapl, aapl});
+
+    SECTION("Nothing complete") {
+        auto none = dispatch_batch(std::span<const char>{buffer.data(), 20},
+                                   [](const ParsedMessage&) {},
+                                   [](const ParsedMessage&) { FAIL(); });
+        REQUIRE(none.count == 0);
+        REQUIRE(none.consumed == 0);
+    }
+}
+
+TEST_CASE("parse_batch multi-message buffer", "[parser][stream][regression]") {
+    std::vector<ParsedMessage> out(8);
+
+    SECTION("All complete messages parsed in order") {
+        std::string buffer = EXEC_REPORT + HEARTBEAT + EXEC_REPORT + LOGON;
+        auto result = parse_batch(std::span<const char>{buffer.data(), buffer.size()}, out);
+
+        REQUIRE(result.count == 4);
+        REQUIRE(result.errors == 0);
+        REQUIRE(result.consumed == buffer.size());
+        REQUIRE(out[0].msg_type() == msg_type::ExecutionReport);
+        REQUIRE(out[1].msg_type() == msg_type::Heartbeat);
+        REQUIRE(out[3].msg_type() == msg_type::Logon);
+        REQUIRE(out[2].get_string(55) == "AAPL");
+    }
+
+    SECTION("Partial trailing message left unconsumed") {
+        std::string buffer = HEARTBEAT + EXEC_REPORT.substr(0, 40);
+        auto result = parse_batch(std::span<const char>{buffer.data(), buffer.size()}, out);
+
+        REQUIRE(result.count == 1);
+        REQUIRE(result.consumed == HEARTBEAT.size());
+    }
+
+    SECTION("Output span bounds the batch") {
+        std::string buffer = HEARTBEAT + HEARTBEAT + HEARTBEAT;
+        auto result = parse_batch(std::span<const char>{buffer.data(), buffer.size()},
+                                  std::span<ParsedMessage>{out.data(), 2});
+
+        REQUIRE(result.count == 2);
+        REQUIRE(result.consumed == 2 * HEARTBEAT.size());
+    }
+
+    SECTION("Corrupt message skipped and counted") {
+        std::string bad = HEARTBEAT;
+        bad[bad.size() - 2] = (bad[bad.size() - 2] == '0') ? '1' : '0';  // Break checksum
+        std::string buffer = HEARTBEAT + bad + LOGON;
+        auto result = parse_batch(std::span<const char>{buffer.data(), buffer.size()}, out);
+
+        REQUIRE(result.count == 2);
+        REQUIRE(result.errors == 1);
+        REQUIRE(result.consumed == buffer.size());
+        REQUIRE(out[1].msg_type() == msg_type::Logon);
+    }
 }
 
 // ============================================================================
@@ -399,6 +1154,158 @@ TEST_CASE("Message boundary detection", "[parser][simd][regression]") {
         REQUIRE(boundary.start == 0);
         REQUIRE(boundary.end == EXEC_REPORT.size());
     }
+
+    SECTION("Trailer search tiers match scalar") {
+        std::string data = std::string(150, 'x') + "\x01" "1\x01" "10" "\x01" "10=" +
+                           std::string(70, 'y') + "\x01" "10=123\x01";
+        std::span<const char> span{data.data(), data.size()};
+        for (size_t start = 0; start < data.size(); start += 7) {
+            REQUIRE(simd::find_trailer(span, start) == simd::find_trailer_scalar(span, start));
+#if NFX_SIMD_AVAILABLE
+            if (simd::cpu_supports(simd::SimdImpl::AVX2)) {
+                REQUIRE(simd::find_trailer_avx2(span, start) == simd::find_trailer_scalar(span, start));
+            }
+#endif
+#if NFX_AVX512_DISPATCH
+            if (simd::cpu_supports(simd::SimdImpl::AVX512)) {
+                REQUIRE(simd::find_trailer_avx512(span, start) == simd::find_trailer_scalar(span, start));
+            }
+#endif
+#if NFX_HAS_NEON
+            REQUIRE(simd::find_trailer_neon(span, start) == simd::find_trailer_scalar(span, start));
+#endif
+#if NFX_HAS_SVE2
+            if (simd::cpu_supports(simd::SimdImpl::SVE2)) {
+                REQUIRE(simd::find_trailer_sve2(span, start) == simd::find_trailer_scalar(span, start));
+            }
+#endif
+        }
+        REQUIRE(simd::find_trailer_scalar(span, 0) == 155);
+    }
+
+    SECTION("Bulk framing matches message-at-a-time framing") {
+        std::string buffer;
+        for (int i = 0; i < 300; ++i) {
+            buffer += (i % 3 == 0) ? EXEC_REPORT : (i % 3 == 1) ? LOGON : HEARTBEAT;
+        }
+        buffer += LOGON.substr(0, 40);  // Partial tail
+        std::span<const char> span{buffer.data(), buffer.size()};
+
+        std::vector<simd::MessageBoundary> bulk(400);
+        const size_t found = simd::find_message_boundaries(span, bulk);
+        REQUIRE(found == 300);
+
+        size_t pos = 0;
+        for (size_t i = 0; i < found; ++i) {
+            auto one = simd::find_message_boundary(span, pos);
+            REQUIRE(one.complete);
+            REQUIRE(bulk[i].start == one.start);
+            REQUIRE(bulk[i].end == one.end);
+            pos = one.end;
+        }
+        REQUIRE_FALSE(simd::find_message_boundary(span, pos).complete);
+    }
+
+    SECTION("BodyLength frames messages whose data holds a trailer") {
+        // RawData (96) carrying "|10=" frames by BodyLength, not first match
+        const std::string body = std::string{"35=0\x01" "95=10\x01" "96="} +
+                                 "ab\x01" "10=cd\x01" "e" + "\x01";
+        const std::string raw = "8=FIX.4.4\x01" "9=" + std::to_string(body.size()) +
+                                "\x01" + body + "10=000\x01";
+        std::string buffer = raw + HEARTBEAT;
+        std::array<simd::MessageBoundary, 4> out{};
+        REQUIRE(simd::find_message_boundaries({buffer.data(), buffer.size()}, out) == 2);
+        REQUIRE(out[0].end == raw.size());
+        REQUIRE(out[1].end == buffer.size());
+    }
+
+    SECTION("Wrong BodyLength falls back to the trailer search") {
+        std::string bad = HEARTBEAT;
+        bad.replace(bad.find("9=55"), 4, "9=54");
+        std::string buffer = bad + LOGON;
+        std::array<simd::MessageBoundary, 4> out{};
+        REQUIRE(simd::find_message_boundaries({buffer.data(), buffer.size()}, out) == 2);
+        REQUIRE(out[0].end == bad.size());
+        REQUIRE(out[1].end == buffer.size());
+    }
+}
+
+// ============================================================================
+// Parallel Log Scanner
+// ============================================================================
+
+TEST_CASE("ParallelLogScanner splits logs at message boundaries", "[parser][parallel]") {
+    // Log lines with a timestamp prefix, as written by session loggers
+    std::string log;
+    std::vector<size_t> offsets;
+    for (int i = 0; i < 2000; ++i) {
+        log += "20260101-00:00:00.000 : ";
+        offsets.push_back(log.size());
+        log += (i % 3 == 0) ? EXEC_REPORT : (i % 3 == 1) ? LOGON : HEARTBEAT;
+        log += "\n";
+    }
+    std::span<const char> bytes{log.data(), log.size()};
+
+    SECTION("Chunks end just past a CheckSum field") {
+        auto chunks = ParallelLogScanner::split(bytes, 16);
+        REQUIRE(chunks.size() > 1);
+        REQUIRE(chunks.front().begin == 0);
+        REQUIRE(chunks.back().end == log.size());
+        for (size_t i = 1; i < chunks.size(); ++i) {
+            REQUIRE(chunks[i].begin == chunks[i - 1].end);
+            REQUIRE(std::string_view{log}.substr(0, chunks[i].begin).ends_with(
+                std::string_view{"\x01"}));
+            REQUIRE(std::string_view{log}.substr(chunks[i].begin - 8, 4) == "\x01" "10=");
+        }
+    }
+
+    SECTION("Visits every message once, merged in file order") {
+        ParallelLogScanner scanner{4, 1024};
+        auto seen = scanner.reduce<std::vector<size_t>>(bytes,
+            [](std::vector<size_t>& acc, std::span<const char> msg,
+               const simd::FIXStructuralIndex& idx, size_t offset) {
+                if (idx.valid() && msg.size() > 0) acc.push_back(offset);
+            },
+            [](std::vector<size_t>& into, std::vector<size_t>&& part) {
+                into.insert(into.end(), part.begin(), part.end());
+            });
+        REQUIRE(seen == offsets);
+
+        auto results = scanner.map<size_t>(bytes,
+            [](size_t& n, std::span<const char>, const simd::FIXStructuralIndex&, size_t) { ++n; });
+        size_t total = 0;
+        for (const auto& r : results) {
+            REQUIRE(r.acc == r.messages);
+            total += r.messages;
+        }
+        REQUIRE(results.size() > 1);
+        REQUIRE(total == offsets.size());
+    }
+
+#if NFX_PLATFORM_POSIX
+    SECTION("Scans a memory-mapped file") {
+        const std::string path = "/tmp/nfx_parallel_scan_test.log";
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        REQUIRE(file != nullptr);
+        REQUIRE(std::fwrite(log.data(), 1, log.size(), file) == log.size());
+        std::fclose(file);
+
+        MappedFile mapped;
+        REQUIRE(mapped.open(path.c_str()));
+        REQUIRE(mapped.size() == log.size());
+
+        ParallelLogScanner scanner{3, 4096};
+        auto logons = scanner.reduce<size_t>(mapped.bytes(),
+            [](size_t& n, std::span<const char> msg, const simd::FIXStructuralIndex& idx, size_t) {
+                n += msg[idx.msg_type_start + 3] == 'A';
+            },
+            [](size_t& total, size_t&& part) { total += part; });
+        REQUIRE(logons == 667);
+
+        mapped.close();
+        std::remove(path.c_str());
+    }
+#endif
 }
 
 // ============================================================================
@@ -477,6 +1384,55 @@ TEST_CASE("FIXStructuralIndex runtime dispatch", "[parser][simd][structural][reg
     }
 }
 
+#if NFX_INDEX_AVX512_VBMI2
+
+TEST_CASE("FIXStructuralIndex AVX-512 VBMI2 matches scalar", "[parser][simd][structural][regression]") {
+    // Compiled in, but the CPU running the tests may not have it
+    if (!simd::cpu_supports(simd::SimdImpl::AVX512_VBMI2)) {
+        return;
+    }
+
+    auto expect_same = [](std::string_view msg) {
+        std::span<const char> data{msg.data(), msg.size()};
+        auto ref = simd::build_index_scalar(data);
+        auto idx = simd::build_index_avx512_vbmi2(data);
+
+        REQUIRE(idx.soh_count == ref.soh_count);
+        REQUIRE(idx.equals_count == ref.equals_count);
+        for (size_t i = 0; i < ref.soh_count; ++i) {
+            REQUIRE(idx.soh_positions[i] == ref.soh_positions[i]);
+        }
+        for (size_t i = 0; i < ref.equals_count; ++i) {
+            REQUIRE(idx.equals_positions[i] == ref.equals_positions[i]);
+        }
+        return idx;
+    };
+
+    SECTION("ExecutionReport") {
+        auto idx = expect_same(EXEC_REPORT);
+        REQUIRE(idx.valid());
+        REQUIRE(idx.msg_type_start == EXEC_REPORT.find("35="));
+        REQUIRE(idx.checksum_start == EXEC_REPORT.rfind("10="));
+    }
+
+    SECTION("Dense message beyond MAX_FIELDS") {
+        std::string dense;
+        for (int i = 0; i < 300; ++i) {
+            dense += std::to_string(100 + i % 10) + "=" + std::string(static_cast<size_t>(i % 3), 'x') + "\x01";
+        }
+        auto idx = expect_same(dense);
+        REQUIRE(idx.soh_count == simd::MAX_FIELDS);
+    }
+
+    SECTION("Lengths around the 64-byte chunk size") {
+        for (size_t len : {size_t{1}, size_t{63}, size_t{64}, size_t{65}, size_t{127}, size_t{130}}) {
+            (void)expect_same(std::string_view{EXEC_REPORT.data(), std::min(len, EXEC_REPORT.size())});
+        }
+    }
+}
+
+#endif
+
 TEST_CASE("IndexedFieldAccessor", "[parser][simd][structural][regression]") {
     auto idx = simd::build_index(
         std::span<const char>{EXEC_REPORT.data(), EXEC_REPORT.size()});
@@ -510,6 +1466,81 @@ TEST_CASE("IndexedFieldAccessor", "[parser][simd][structural][regression]") {
         REQUIRE(accessor.get(999) == "");
         REQUIRE(accessor.get_int(999) == 0);
     }
+
+    SECTION("Decode all tags") {
+        std::array<int, 32> tags{};
+        REQUIRE(accessor.decode_tags(tags) == 19);
+        REQUIRE(tags[0] == 8);
+        REQUIRE(tags[9] == 150);
+        REQUIRE(tags[18] == 10);
+    }
+}
+
+TEST_CASE("TagLookupTable dense lookup", "[parser][simd][structural][regression]") {
+    std::span<const char> exec{EXEC_REPORT.data(), EXEC_REPORT.size()};
+    std::span<const char> hb{HEARTBEAT.data(), HEARTBEAT.size()};
+    auto idx = simd::build_index(exec);
+
+    simd::TagLookupTable table;
+    table.rebuild(idx, exec);
+
+    SECTION("Matches linear find_tag") {
+        for (int tag : {8, 9, 35, 37, 55, 150, 151, 10, 999, 2000}) {
+            INFO("tag " << tag);
+            REQUIRE(table.find(tag) == idx.find_tag(exec, tag));
+        }
+    }
+
+    SECTION("Accessor uses the table") {
+        simd::IndexedFieldAccessor accessor{idx, exec, table};
+        REQUIRE(accessor.get(55) == "AAPL");
+        REQUIRE(accessor.get_int(38) == 100);
+        REQUIRE(accessor.get(999) == "");
+    }
+
+    SECTION("Rebuild for another message clears stale tags") {
+        auto hb_idx = simd::build_index(hb);
+        table.rebuild(hb_idx, hb);
+        REQUIRE(table.find(55) == hb_idx.field_count());
+        REQUIRE(hb_idx.value_at(hb, table.find(34)) == "5");
+    }
+}
+
+TEST_CASE("SWAR tag decoding", "[parser][simd][structural][regression]") {
+    // Prefix guarantees at least 8 bytes before every '=' (SWAR path)
+    auto decode = [](std::string_view tag, std::string_view prefix = "\x01\x01\x01\x01\x01\x01\x01\x01") {
+        std::string buf = std::string{prefix} + std::string{tag} + "=";
+        size_t start = prefix.size();
+        return std::pair{simd::decode_tag(buf.data(), start, start + tag.size()),
+                         simd::decode_tag_scalar(buf.data(), start, start + tag.size())};
+    };
+
+    SECTION("Matches scalar for 1-8 digit tags") {
+        for (std::string_view tag : {"8", "35", "150", "9999", "12345", "123456",
+                                     "1234567", "99999999", "0", "007"}) {
+            auto [swar, scalar] = decode(tag);
+            INFO("tag " << tag);
+            REQUIRE(swar == scalar);
+            REQUIRE(swar == std::stoi(std::string{tag}));
+        }
+    }
+
+    SECTION("Near buffer start falls back to scalar") {
+        auto [swar, scalar] = decode("35", "");
+        REQUIRE(swar == 35);
+        REQUIRE(scalar == 35);
+    }
+
+    SECTION("Non-digit rejected") {
+        REQUIRE(decode("3a").first == 0);
+        REQUIRE(decode("a35").first == 0);
+        REQUIRE(decode("").first == 0);
+        REQUIRE(decode("\xFF" "1").first == 0);
+    }
+
+    SECTION("Digits before the tag are ignored") {
+        REQUIRE(decode("44", "\x01" "1234567").first == 44);
+    }
 }
 
 TEST_CASE("PaddedMessageBuffer", "[parser][simd][structural][regression]") {
@@ -545,3 +1576,623 @@ TEST_CASE("PaddedMessageBuffer", "[parser][simd][structural][regression]") {
         REQUIRE(idx.soh_count == 19);
     }
 }
+
+// ============================================================================
+// Scatter-Gather Assembly Tests
+// ============================================================================
+
+namespace {
+
+std::string flatten(const ScatterAssembler& sg) {
+    std::string out(sg.total_size(), '\0');
+    REQUIRE(sg.copy_to(std::span<char>{out.data(), out.size()}) == out.size());
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("Layout templates match MessageAssembler output", "[parser][serializer][template]") {
+    MessageAssembler asm_;
+    constexpr std::string_view time = "20231215-10:30:00.000";
+
+    SECTION("NewOrderSingle across sequence numbers and optional fields") {
+        fix44::NewOrderTemplate tmpl;
+        tmpl.prepare("FIX.4.4", "CLIENT", "BROKER");
+        REQUIRE(tmpl.prepared());
+
+        auto order = fix44::NewOrderSingle::Builder{}
+            .sender_comp_id("CLIENT")
+            .target_comp_id("BROKER")
+            .sending_time(time)
+            .cl_ord_id("ORD001")
+            .symbol("AAPL")
+            .side(Side::Sell)
+            .transact_time(time)
+            .order_qty(Qty::from_int(250))
+            .ord_type(OrdType::StopLimit)
+            .price(FixedPrice::from_string("150.25"))
+            .stop_px(FixedPrice::from_string("149.5"))
+            .handl_inst('1')
+            .text("layout test");
+
+        for (uint32_t seq : {1u, 9u, 10u, 123456u}) {
+            auto generic = order.msg_seq_num(seq).build(asm_);
+            auto fast = tmpl.build(order, seq, time);
+            REQUIRE(std::string_view{fast.data(), fast.size()} ==
+                    std::string_view{generic.data(), generic.size()});
+        }
+
+        auto market = fix44::NewOrderSingle::Builder{}
+            .sender_comp_id("CLIENT").target_comp_id("BROKER")
+            .msg_seq_num(7).sending_time(time)
+            .cl_ord_id("ORD002").symbol("MSFT").side(Side::Buy)
+            .transact_time(time).order_qty(Qty::from_int(1))
+            .ord_type(OrdType::Market).account("ACC9");
+        auto generic = market.build(asm_);
+        auto fast = tmpl.build(market, 7, time);
+        REQUIRE(std::string_view{fast.data(), fast.size()} ==
+                std::string_view{generic.data(), generic.size()});
+        REQUIRE(fix44::NewOrderSingle::from_buffer(fast).has_value());
+    }
+
+    SECTION("OrderCancelRequest") {
+        fix44::OrderCancelTemplate tmpl;
+        tmpl.prepare("FIX.4.4", "CLIENT", "BROKER");
+
+        auto cancel = fix44::OrderCancelRequest::Builder{}
+            .sender_comp_id("CLIENT")
+            .target_comp_id("BROKER")
+            .msg_seq_num(31)
+            .sending_time(time)
+            .orig_cl_ord_id("ORD001")
+            .cl_ord_id("CXL001")
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time(time)
+            .order_qty(Qty::from_int(100));
+
+        auto generic = cancel.build(asm_);
+        auto fast = tmpl.build(cancel, 31, time);
+        REQUIRE(std::string_view{fast.data(), fast.size()} ==
+                std::string_view{generic.data(), generic.size()});
+
+        cancel.order_qty(Qty{}).order_id("EX77");
+        generic = cancel.build(asm_);
+        fast = tmpl.build(cancel, 31, time);
+        REQUIRE(std::string_view{fast.data(), fast.size()} ==
+                std::string_view{generic.data(), generic.size()});
+
+        auto parsed = fix44::OrderCancelRequest::from_buffer(fast);
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->order_id == "EX77");
+    }
+
+    SECTION("OrderCancelReplaceRequest") {
+        fix44::OrderCancelReplaceTemplate tmpl;
+        tmpl.prepare("FIX.4.4", "CLIENT", "BROKER");
+
+        auto replace = fix44::OrderCancelReplaceRequest::Builder{}
+            .sender_comp_id("CLIENT")
+            .target_comp_id("BROKER")
+            .sending_time(time)
+            .orig_cl_ord_id("ORD001")
+            .cl_ord_id("RPL001")
+            .symbol("AAPL")
+            .side(Side::Sell)
+            .transact_time(time)
+            .order_qty(Qty::from_int(75))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_string("150.75"))
+            .order_id("EX77");
+
+        for (uint32_t seq : {1u, 42u, 1000000u}) {
+            auto generic = replace.msg_seq_num(seq).build(asm_);
+            auto fast = tmpl.build(replace, seq, time);
+            REQUIRE(std::string_view{fast.data(), fast.size()} ==
+                    std::string_view{generic.data(), generic.size()});
+        }
+
+        replace.ord_type(OrdType::StopLimit).stop_px(FixedPrice::from_string("150.5"))
+            .time_in_force(TimeInForce::GoodTillCancel).account("ACC9").text("px up");
+        auto generic = replace.msg_seq_num(43).build(asm_);
+        auto fast = tmpl.build(replace, 43, time);
+        REQUIRE(std::string_view{fast.data(), fast.size()} ==
+                std::string_view{generic.data(), generic.size()});
+
+        auto parsed = fix44::OrderCancelReplaceRequest::from_buffer(fast);
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->orig_cl_ord_id == "ORD001");
+        REQUIRE(parsed->cl_ord_id == "RPL001");
+        REQUIRE(parsed->order_qty == Qty::from_int(75));
+        REQUIRE(parsed->ord_type == OrdType::StopLimit);
+        REQUIRE(parsed->stop_px == FixedPrice::from_string("150.5"));
+        REQUIRE(parsed->time_in_force == TimeInForce::GoodTillCancel);
+        REQUIRE(parsed->order_id == "EX77");
+        REQUIRE(parsed->account == "ACC9");
+        REQUIRE(parsed->text == "px up");
+    }
+
+    SECTION("OrderStatusRequest") {
+        fix44::OrderStatusTemplate tmpl;
+        tmpl.prepare("FIX.4.4", "CLIENT", "BROKER");
+
+        auto status = fix44::OrderStatusRequest::Builder{}
+            .sender_comp_id("CLIENT")
+            .target_comp_id("BROKER")
+            .msg_seq_num(8)
+            .sending_time(time)
+            .cl_ord_id("ORD001")
+            .symbol("AAPL")
+            .side(Side::Buy);
+
+        auto generic = status.build(asm_);
+        auto fast = tmpl.build(status, 8, time);
+        REQUIRE(std::string_view{fast.data(), fast.size()} ==
+                std::string_view{generic.data(), generic.size()});
+
+        status.order_id("EX77").ord_status_req_id("STAT1");
+        generic = status.build(asm_);
+        fast = tmpl.build(status, 8, time);
+        REQUIRE(std::string_view{fast.data(), fast.size()} ==
+                std::string_view{generic.data(), generic.size()});
+
+        auto parsed = fix44::OrderStatusRequest::from_buffer(fast);
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->cl_ord_id == "ORD001");
+        REQUIRE(parsed->order_id == "EX77");
+        REQUIRE(parsed->ord_status_req_id == "STAT1");
+    }
+
+    SECTION("ExecutionReport") {
+        fix44::ExecutionReportTemplate tmpl;
+        tmpl.prepare("FIX.4.4", "BROKER", "CLIENT");
+
+        auto report = fix44::ExecutionReport::Builder{}
+            .sender_comp_id("BROKER")
+            .target_comp_id("CLIENT")
+            .msg_seq_num(12)
+            .sending_time(time)
+            .order_id("EX77")
+            .exec_id("E1")
+            .exec_type(ExecType::New)
+            .ord_status(OrdStatus::New)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .leaves_qty(Qty::from_int(100))
+            .cum_qty(Qty{})
+            .avg_px(FixedPrice{})
+            .cl_ord_id("ORD001")
+            .order_qty(Qty::from_int(100));
+
+        auto generic = report.build(asm_);
+        auto fast = tmpl.build(report, 12, time);
+        REQUIRE(std::string_view{fast.data(), fast.size()} ==
+                std::string_view{generic.data(), generic.size()});
+
+        report.exec_id("E2").exec_type(ExecType::PartialFill)
+            .ord_status(OrdStatus::PartiallyFilled)
+            .leaves_qty(Qty::from_int(60)).cum_qty(Qty::from_int(40))
+            .avg_px(FixedPrice::from_string("150.25"))
+            .last_qty(Qty::from_int(40)).last_px(FixedPrice::from_string("150.25"))
+            .transact_time(time).account("ACC9").text("partial");
+        generic = report.msg_seq_num(13).build(asm_);
+        fast = tmpl.build(report, 13, time);
+        REQUIRE(std::string_view{fast.data(), fast.size()} ==
+                std::string_view{generic.data(), generic.size()});
+
+        auto parsed = fix44::ExecutionReport::from_buffer(fast);
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->exec_type == ExecType::PartialFill);
+        REQUIRE(parsed->leaves_qty == Qty::from_int(60));
+        REQUIRE(parsed->cum_qty == Qty::from_int(40));
+        REQUIRE(parsed->last_px == FixedPrice::from_string("150.25"));
+        REQUIRE(parsed->text == "partial");
+    }
+}
+
+TEST_CASE("OrderCancelReplaceRequest and OrderStatusRequest reject missing fields", "[parser][messages]") {
+    auto make_fix_message = [](std::string_view body) {
+        std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(body.size()) + "\x01";
+        msg += body;
+        char cs[4];
+        parser::format_checksum(fix::calculate_checksum(
+            std::span<const char>{msg.data(), msg.size()}), cs);
+        return msg + "10=" + std::string{cs, 3} + "\x01";
+    };
+
+    SECTION("Replace without OrigClOrdID") {
+        const std::string msg = make_fix_message("35=G\x01" "34=1\x01" "49=A\x01" "56=B\x01"
+            "52=20231215-10:30:00.000\x01" "11=RPL1\x01" "55=AAPL\x01" "54=1\x01"
+            "38=10\x01" "40=1\x01");
+        auto parsed = fix44::OrderCancelReplaceRequest::from_buffer(
+            std::span<const char>{msg.data(), msg.size()});
+        REQUIRE_FALSE(parsed.has_value());
+        REQUIRE(parsed.error().tag == tag::OrigClOrdID::value);
+    }
+
+    SECTION("Limit replace without Price") {
+        const std::string msg = make_fix_message("35=G\x01" "34=1\x01" "49=A\x01" "56=B\x01"
+            "52=20231215-10:30:00.000\x01" "41=ORD1\x01" "11=RPL1\x01" "55=AAPL\x01"
+            "54=1\x01" "38=10\x01" "40=2\x01");
+        auto parsed = fix44::OrderCancelReplaceRequest::from_buffer(
+            std::span<const char>{msg.data(), msg.size()});
+        REQUIRE_FALSE(parsed.has_value());
+        REQUIRE(parsed.error().tag == tag::Price::value);
+    }
+
+    SECTION("Status request without ClOrdID") {
+        const std::string msg = make_fix_message("35=H\x01" "34=1\x01" "49=A\x01" "56=B\x01"
+            "52=20231215-10:30:00.000\x01" "55=AAPL\x01" "54=1\x01");
+        auto parsed = fix44::OrderStatusRequest::from_buffer(
+            std::span<const char>{msg.data(), msg.size()});
+        REQUIRE_FALSE(parsed.has_value());
+        REQUIRE(parsed.error().tag == tag::ClOrdID::value);
+    }
+}
+
+TEST_CASE("ScatterAssembler matches MessageAssembler output", "[parser][scatter][regression]") {
+    MessageAssembler asm_;
+    ScatterAssembler sg;
+
+    SECTION("NewOrderSingle") {
+        HeaderTemplate header{"D", "CLIENT", "BROKER"};
+        REQUIRE(header.valid());
+
+        auto builder = fix44::NewOrderSingle::Builder{}
+            .sender_comp_id("CLIENT")
+            .target_comp_id("BROKER")
+            .msg_seq_num(42)
+            .sending_time("20231215-10:30:00.000")
+            .cl_ord_id("ORD001")
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .transact_time("20231215-10:30:00.000")
+            .order_qty(Qty::from_int(100))
+            .ord_type(OrdType::Limit)
+            .price(FixedPrice::from_double(150.25));
+
+        auto contiguous = builder.build(asm_);
+        const auto& segments = builder.build(sg, header);
+
+        REQUIRE(segments.size() == ScatterAssembler::SEGMENT_COUNT);
+        REQUIRE(flatten(sg) == std::string(contiguous.data(), contiguous.size()));
+
+        auto parsed = fix44::NewOrderSingle::from_buffer(contiguous);
+        REQUIRE(parsed.has_value());
+    }
+
+    SECTION("ExecutionReport reuses the template across sequence numbers") {
+        HeaderTemplate header{"8", "SENDER", "TARGET"};
+
+        for (uint32_t seq : {1u, 2u, 1000000u}) {
+            auto builder = fix44::ExecutionReport::Builder{}
+                .sender_comp_id("SENDER")
+                .target_comp_id("TARGET")
+                .msg_seq_num(seq)
+                .sending_time("20231215-10:30:00.000")
+                .order_id("ORDER123")
+                .exec_id("EXEC456")
+                .exec_type(ExecType::New)
+                .ord_status(OrdStatus::New)
+                .symbol("AAPL")
+                .side(Side::Buy)
+                .leaves_qty(Qty::from_int(100))
+                .cum_qty(Qty::from_int(0))
+                .avg_px(FixedPrice::from_double(0));
+
+            auto contiguous = builder.build(asm_);
+            (void)builder.build(sg, header);
+            REQUIRE(flatten(sg) == std::string(contiguous.data(), contiguous.size()));
+        }
+    }
+
+    SECTION("Segments land in a gather list") {
+        HeaderTemplate header{"0", "A", "B"};
+        sg.start(header, 7, "20231215-10:30:00");
+        (void)sg.finish();
+
+        struct Sink {
+            size_t count{0};
+            size_t bytes{0};
+            bool add(std::span<const char> seg) noexcept {
+                ++count;
+                bytes += seg.size();
+                return true;
+            }
+        } sink;
+
+        REQUIRE(sg.add_to(sink));
+        REQUIRE(sink.count == ScatterAssembler::SEGMENT_COUNT);
+        REQUIRE(sink.bytes == sg.total_size());
+        REQUIRE(flatten(sg).starts_with("8=FIX.4.4\x01" "9=000"));
+        REQUIRE(flatten(sg).ends_with("\x01"));
+    }
+}
+
+// ============================================================================
+// Running Checksum Tests
+// ============================================================================
+
+namespace {
+
+/// Trailer checksum equals a full pass over everything before "10="
+bool trailer_checksum_matches(std::span<const char> msg) {
+    std::string_view sv{msg.data(), msg.size()};
+    size_t trailer = sv.rfind("\x01" "10=") + 1;
+    auto expected = fix::format_checksum(
+        fix::calculate_checksum(std::span<const char>{msg.data(), trailer}));
+    return sv.substr(trailer + 3, 3) == std::string_view{expected.data(), 3};
+}
+
+} // namespace
+
+TEST_CASE("Serializers checksum while appending", "[parser][checksum][regression]") {
+    SECTION("FastMessageBuilder via MessageFactory") {
+        serializer::MessageFactory<> factory{"FIX.4.4", "SENDER", "TARGET"};
+        REQUIRE(trailer_checksum_matches(factory.build_heartbeat(1, "20231215-10:30:00.000")));
+        REQUIRE(trailer_checksum_matches(factory.build_logon(2, "20231215-10:30:00.000", 30, 0, true)));
+        REQUIRE(trailer_checksum_matches(factory.build_test_request(12345, "20231215-10:30:00.000", "PING")));
+    }
+
+    SECTION("FastMessageBuilder truncate restores the prefix sum") {
+        serializer::FastMessageBuilder<256> builder;
+        builder.begin_string("FIX.4.4");
+        size_t len_pos = builder.body_length_placeholder();
+        builder.mark_body_start();
+        builder.msg_type('0');
+        size_t prefix = builder.size();
+        uint32_t prefix_sum = builder.running_sum();
+
+        for (uint32_t seq : {1u, 99999u}) {
+            builder.truncate(prefix, prefix_sum);
+            builder.msg_seq_num(seq);
+            builder.update_body_length(len_pos, builder.size() - builder.body_start());
+            builder.finalize_checksum();
+            REQUIRE(trailer_checksum_matches(builder.data()));
+
+            // The BodyLength slot in the kept prefix now holds this message's digits
+            prefix_sum = 0;
+            for (size_t i = 0; i < prefix; ++i) {
+                prefix_sum += static_cast<uint8_t>(builder.c_str()[i]);
+            }
+        }
+    }
+
+    SECTION("MessageAssembler") {
+        MessageAssembler asm_;
+        auto msg = fix44::ExecutionReport::Builder{}
+            .sender_comp_id("SENDER")
+            .target_comp_id("TARGET")
+            .msg_seq_num(7)
+            .sending_time("20231215-10:30:00.000")
+            .order_id("ORDER123")
+            .exec_id("EXEC456")
+            .exec_type(ExecType::New)
+            .ord_status(OrdStatus::New)
+            .symbol("AAPL")
+            .side(Side::Buy)
+            .leaves_qty(Qty::from_int(100))
+            .cum_qty(Qty::from_int(0))
+            .avg_px(FixedPrice::from_double(0))
+            .build(asm_);
+        REQUIRE(trailer_checksum_matches(msg));
+    }
+}
+
+TEST_CASE("IndexedParser finds tags above the index", "[parser][fixt11][regression]") {
+    MessageAssembler asm_;
+    auto msg = fixt11::Logon::Builder{}
+        .sender_comp_id("SENDER")
+        .target_comp_id("TARGET")
+        .msg_seq_num(1)
+        .sending_time("20231215-10:30:00.000")
+        .heart_bt_int(30)
+        .default_appl_ver_id(appl_ver_id::FIX_5_0_SP2)
+        .build(asm_);
+
+    auto parsed = IndexedParser::parse(msg);
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->has_field(tag::DefaultApplVerID::value));
+    REQUIRE(parsed->get_char(tag::DefaultApplVerID::value) == appl_ver_id::FIX_5_0_SP2);
+    REQUIRE_FALSE(parsed->has_field(tag::ApplVerID::value));
+    REQUIRE(parsed->get_int(108) == 30);
+
+    auto logon = fixt11::Logon::from_buffer(msg);
+    REQUIRE(logon.has_value());
+    REQUIRE(logon->default_appl_ver_id == appl_ver_id::FIX_5_0_SP2);
+}
+
+TEST_CASE("extend_index resumes across partial reads", "[parser][simd][structural][regression]") {
+    const std::span<const char> whole{EXEC_REPORT.data(), EXEC_REPORT.size()};
+    const auto ref = simd::build_index(whole);
+
+    // Cut points land mid-tag, on '=', on SOH and mid-value
+    for (size_t step : {size_t{1}, size_t{7}, size_t{19}, size_t{64}}) {
+        simd::FIXStructuralIndex idx;
+        for (size_t end = step; ; end += step) {
+            simd::extend_index(idx, whole.first(std::min(end, whole.size())));
+            if (end >= whole.size()) break;
+        }
+
+        REQUIRE(idx.valid());
+        REQUIRE(idx.soh_count == ref.soh_count);
+        REQUIRE(idx.equals_count == ref.equals_count);
+        for (size_t i = 0; i < ref.soh_count; ++i) {
+            REQUIRE(idx.soh_positions[i] == ref.soh_positions[i]);
+            REQUIRE(idx.equals_positions[i] == ref.equals_positions[i]);
+        }
+        REQUIRE(idx.msg_type_start == ref.msg_type_start);
+        REQUIRE(idx.checksum_start == ref.checksum_start);
+        REQUIRE(idx.message_size == whole.size());
+    }
+
+    SECTION("IndexedParser reuses the index") {
+        simd::FIXStructuralIndex idx;
+        simd::extend_index(idx, whole.first(40));
+        simd::extend_index(idx, whole);
+
+        IndexedParser parser;
+        REQUIRE(parser.assign(whole, idx).has_value());
+        REQUIRE(parser.msg_type() == '8');
+        REQUIRE(parser.get_string(tag::Symbol::value) == "AAPL");
+    }
+}
+
+TEST_CASE("DataDictionary validates in the parse pass", "[parser][dictionary]") {
+    static constexpr std::string_view XML = R"(<?xml version="1.0" encoding="UTF-8"?>
+<!-- Venue dictionary (excerpt) -->
+<fix type='FIX' major='4' minor='4'>
+ <header>
+  <field name='BeginString' required='Y'/>
+  <field name='BodyLength' required='Y'/>
+  <field name='MsgType' required='Y'/>
+  <field name='SenderCompID' required='Y'/>
+  <field name='TargetCompID' required='Y'/>
+  <field name='MsgSeqNum' required='Y'/>
+  <field name='SendingTime' required='Y'/>
+ </header>
+ <trailer>
+  <field name='CheckSum' required='Y'/>
+ </trailer>
+ <messages>
+  <message name='Heartbeat' msgtype='0' msgcat='admin'/>
+  <message name='NewOrderSingle' msgtype='D' msgcat='app'>
+   <field name='ClOrdID' required='Y'/>
+   <component name='Parties' required='N'/>
+   <field name='Symbol' required='Y'/>
+   <field name='Side' required='Y'/>
+   <field name='OrderQty' required='N'/>
+   <field name='OrdType' required='Y'/>
+   <field name='Price' required='N'/>
+  </message>
+ </messages>
+ <components>
+  <component name='Parties'>
+   <group name='NoPartyIDs' required='N'>
+    <field name='PartyID' required='N'/>
+    <field name='PartyIDSource' required='N'/>
+    <field name='PartyRole' required='N'/>
+   </group>
+  </component>
+ </components>
+ <fields>
+  <field number='8' name='BeginString' type='STRING'/>
+  <field number='9' name='BodyLength' type='LENGTH'/>
+  <field number='10' name='CheckSum' type='STRING'/>
+  <field number='11' name='ClOrdID' type='STRING'/>
+  <field number='34' name='MsgSeqNum' type='SEQNUM'/>
+  <field number='35' name='MsgType' type='STRING'>
+   <value enum='0' description='HEARTBEAT'/>
+   <value enum='D' description='ORDER_SINGLE'/>
+  </field>
+  <field number='38' name='OrderQty' type='QTY'/>
+  <field number='40' name='OrdType' type='CHAR'>
+   <value enum='1' description='MARKET'/>
+   <value enum='2' description='LIMIT'/>
+  </field>
+  <field number='44' name='Price' type='PRICE'/>
+  <field number='49' name='SenderCompID' type='STRING'/>
+  <field number='52' name='SendingTime' type='UTCTIMESTAMP'/>
+  <field number='54' name='Side' type='CHAR'>
+   <value enum='1' description='BUY'/>
+   <value enum='2' description='SELL'/>
+  </field>
+  <field number='55' name='Symbol' type='STRING'/>
+  <field number='56' name='TargetCompID' type='STRING'/>
+  <field number='447' name='PartyIDSource' type='CHAR'/>
+  <field number='448' name='PartyID' type='STRING'/>
+  <field number='452' name='PartyRole' type='INT'/>
+  <field number='453' name='NoPartyIDs' type='NUMINGROUP'/>
+ </fields>
+</fix>
+)";
+
+    auto dict = DataDictionary::load(XML);
+    REQUIRE(dict.has_value());
+    REQUIRE(dict->message_count() == 2);
+    REQUIRE(dict->group_count() == 1);
+    REQUIRE(dict->enum_count() == 2);     // OrdType, Side (MsgType is a STRING)
+    REQUIRE(dict->message("D") != nullptr);
+    REQUIRE(dict->message("8") == nullptr);
+
+    auto make_fix_message = [](std::string_view body) {
+        std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(body.size()) + "\x01";
+        msg += body;
+        char cs[4];
+        parser::format_checksum(fix::calculate_checksum(
+            std::span<const char>{msg.data(), msg.size()}), cs);
+        return msg + "10=" + std::string{cs, 3} + "\x01";
+    };
+    const std::string header = "35=D\x01" "49=A\x01" "56=B\x01" "34=2\x01"
+                               "52=20231215-10:30:00.000\x01";
+    auto validate = [&](const DictionaryValidator& validator, const std::string& body) {
+        const std::string msg = make_fix_message(header + body);
+        IndexedParser parser;
+        return parser.assign(std::span<const char>{msg.data(), msg.size()}, validator);
+    };
+
+    DictionaryValidator venue{*dict};
+
+    SECTION("Valid order with a party group") {
+        REQUIRE(validate(venue, "11=ORD1\x01" "453=2\x01" "448=X\x01" "447=D\x01" "452=1\x01"
+                                "448=Y\x01" "452=3\x01" "55=AAPL\x01" "54=1\x01" "38=100\x01"
+                                "40=2\x01" "44=150.25\x01").has_value());
+    }
+
+    SECTION("Missing required body field") {
+        auto result = validate(venue, "11=ORD1\x01" "55=AAPL\x01" "54=1\x01");
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::MissingRequiredField);
+        REQUIRE(result.error().tag == tag::OrdType::value);
+    }
+
+    SECTION("Enum and format violations") {
+        auto side = validate(venue, "11=ORD1\x01" "55=AAPL\x01" "54=7\x01" "40=2\x01");
+        REQUIRE_FALSE(side.has_value());
+        REQUIRE(side.error().code == ParseErrorCode::InvalidTagValue);
+        REQUIRE(side.error().tag == tag::Side::value);
+
+        auto qty = validate(venue, "11=ORD1\x01" "55=AAPL\x01" "54=1\x01" "38=1O0\x01" "40=2\x01");
+        REQUIRE_FALSE(qty.has_value());
+        REQUIRE(qty.error().code == ParseErrorCode::InvalidFieldFormat);
+        REQUIRE(qty.error().tag == tag::OrderQty::value);
+    }
+
+    SECTION("NumInGroup disagreeing with the entries") {
+        auto short_group = validate(venue, "11=ORD1\x01" "453=2\x01" "448=X\x01" "452=1\x01"
+                                           "55=AAPL\x01" "54=1\x01" "40=2\x01");
+        REQUIRE_FALSE(short_group.has_value());
+        REQUIRE(short_group.error().code == ParseErrorCode::IncorrectNumInGroup);
+        REQUIRE(short_group.error().tag == 453);
+
+        auto no_delimiter = validate(venue, "11=ORD1\x01" "453=1\x01" "452=1\x01"
+                                            "55=AAPL\x01" "54=1\x01" "40=2\x01");
+        REQUIRE_FALSE(no_delimiter.has_value());
+        REQUIRE(no_delimiter.error().code == ParseErrorCode::IncorrectNumInGroup);
+    }
+
+    SECTION("Strictness is per venue") {
+        const std::string custom = "11=ORD1\x01" "55=AAPL\x01" "54=1\x01" "40=2\x01" "9001=X\x01";
+        REQUIRE(validate(venue, custom).has_value());
+        DictionaryValidator strict{*dict, ValidationConfig::strict()};
+        auto result = validate(strict, custom);
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(result.error().code == ParseErrorCode::UndefinedTag);
+        REQUIRE(result.error().tag == 9001);
+
+        DictionaryValidator lenient{*dict, ValidationConfig::lenient()};
+        REQUIRE(validate(lenient, "11=ORD1\x01" "55=AAPL\x01" "54=9\x01" "40=2\x01").has_value());
+    }
+
+    SECTION("Load errors") {
+        REQUIRE(DataDictionary::load("<fix><messages>").error().code ==
+                DictionaryErrorCode::MalformedXml);
+        auto undefined = DataDictionary::load(
+            "<fix><messages><message msgtype='0'><field name='Nope' required='Y'/>"
+            "</message></messages><fields/></fix>");
+        REQUIRE_FALSE(undefined.has_value());
+        REQUIRE(undefined.error().code == DictionaryErrorCode::UndefinedField);
+        REQUIRE(DataDictionary::load_file("/nonexistent/FIX44.xml").error().code ==
+                DictionaryErrorCode::FileNotFound);
+    }
+}
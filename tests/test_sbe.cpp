@@ -404,6 +404,148 @@ TEST_CASE("ExecutionReportCodec alignment verification", "[sbe][execrpt]") {
     REQUIRE(ExecutionReportCodec::Offset::TransactTime % 8 == 0);
 }
 
+// ============================================================================
+// Order Lifecycle Codec Tests
+// ============================================================================
+
+TEST_CASE("OrderCancelRequestCodec encode/decode roundtrip", "[sbe][cancel][regression]") {
+    alignas(8) char buffer[OrderCancelRequestCodec::TOTAL_SIZE]{};
+
+    OrderCancelRequestCodec::wrapForEncode(buffer, sizeof(buffer))
+        .encodeHeader()
+        .origClOrdId("ORD001")
+        .clOrdId("CXL001")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .orderQty(Qty::from_int(100))
+        .transactTime(Timestamp{1'700'000'000'000'000'000LL});
+
+    auto codec = OrderCancelRequestCodec::wrapForDecode(buffer, sizeof(buffer));
+    REQUIRE(codec.isValid());
+    REQUIRE(codec.origClOrdId() == "ORD001");
+    REQUIRE(codec.clOrdId() == "CXL001");
+    REQUIRE(codec.symbol() == "AAPL");
+    REQUIRE(codec.side() == Side::Buy);
+    REQUIRE(codec.orderQty().whole() == 100);
+    REQUIRE(codec.transactTime().nanos == 1'700'000'000'000'000'000LL);
+
+    REQUIRE_FALSE(OrderCancelRequestCodec::wrapForDecode(buffer, sizeof(buffer) - 1).isValid());
+    REQUIRE_FALSE(NewOrderSingleCodec::wrapForDecode(buffer, sizeof(buffer)).isValid());
+}
+
+TEST_CASE("OrderCancelReplaceRequestCodec encode/decode roundtrip", "[sbe][replace][regression]") {
+    alignas(8) char buffer[OrderCancelReplaceRequestCodec::TOTAL_SIZE]{};
+
+    OrderCancelReplaceRequestCodec::wrapForEncode(buffer, sizeof(buffer))
+        .encodeHeader()
+        .origClOrdId("ORD001")
+        .clOrdId("RPL001")
+        .symbol("MSFT")
+        .side(Side::Sell)
+        .ordType(OrdType::Limit)
+        .timeInForce(TimeInForce::Day)
+        .price(FixedPrice::from_double(410.25))
+        .orderQty(Qty::from_int(250));
+
+    auto codec = OrderCancelReplaceRequestCodec::wrapForDecode(buffer, sizeof(buffer));
+    REQUIRE(codec.isValid());
+    REQUIRE(codec.origClOrdId() == "ORD001");
+    REQUIRE(codec.clOrdId() == "RPL001");
+    REQUIRE(codec.symbol() == "MSFT");
+    REQUIRE(codec.side() == Side::Sell);
+    REQUIRE(codec.ordType() == OrdType::Limit);
+    REQUIRE(codec.timeInForce() == TimeInForce::Day);
+    REQUIRE(codec.price() == FixedPrice::from_double(410.25));
+    REQUIRE(codec.orderQty().whole() == 250);
+    REQUIRE(codec.encoded().size() == 88u);
+}
+
+TEST_CASE("OrderCancelRejectCodec encode/decode roundtrip", "[sbe][cxlrej][regression]") {
+    alignas(8) char buffer[OrderCancelRejectCodec::TOTAL_SIZE]{};
+
+    OrderCancelRejectCodec::wrapForEncode(buffer, sizeof(buffer))
+        .encodeHeader()
+        .orderId("EX001")
+        .clOrdId("CXL001")
+        .origClOrdId("ORD001")
+        .ordStatus(OrdStatus::Filled)
+        .cxlRejResponseTo(OrderCancelRejectCodec::ResponseTo::CancelRequest)
+        .cxlRejReason(0);  // Too late to cancel
+
+    auto codec = OrderCancelRejectCodec::wrapForDecode(buffer, sizeof(buffer));
+    REQUIRE(codec.isValid());
+    REQUIRE(codec.orderId() == "EX001");
+    REQUIRE(codec.clOrdId() == "CXL001");
+    REQUIRE(codec.origClOrdId() == "ORD001");
+    REQUIRE(codec.ordStatus() == OrdStatus::Filled);
+    REQUIRE(codec.cxlRejResponseTo() == '1');
+    REQUIRE(codec.cxlRejReason() == 0);
+}
+
+TEST_CASE("MarketDataIncrementalRefreshCodec repeating group", "[sbe][md][regression]") {
+    using Codec = MarketDataIncrementalRefreshCodec;
+    alignas(8) char buffer[Codec::TOTAL_SIZE]{};
+
+    auto encoder = Codec::wrapForEncode(buffer, sizeof(buffer));
+    encoder.encodeHeader()
+        .transactTime(Timestamp{42})
+        .entryCount(3);
+    for (size_t i = 0; i < 3; ++i) {
+        encoder.entry(i)
+            .mdEntryPx(FixedPrice::from_double(100.0 + static_cast<double>(i)))
+            .mdEntrySize(Qty::from_int(static_cast<int64_t>(10 * (i + 1))))
+            .rptSeq(static_cast<uint32_t>(500 + i))
+            .symbol("ESZ5")
+            .mdUpdateAction(MDUpdateAction::New)
+            .mdEntryType(i == 2 ? MDEntryType::Offer : MDEntryType::Bid)
+            .mdPriceLevel(static_cast<uint8_t>(i + 1));
+    }
+    const auto wire = encoder.encoded();
+    REQUIRE(wire.size() == Codec::encodedSize(3));
+
+    SECTION("Entries are iterated in place") {
+        auto codec = Codec::wrapForDecode(wire.data(), wire.size());
+        REQUIRE(codec.isValid());
+        REQUIRE(codec.transactTime().nanos == 42);
+        REQUIRE(codec.entryCount() == 3);
+
+        uint32_t expected_seq = 500;
+        for (auto entry : codec.entries()) {
+            REQUIRE(entry.rptSeq() == expected_seq++);
+            REQUIRE(entry.symbol() == "ESZ5");
+            REQUIRE(entry.mdUpdateAction() == MDUpdateAction::New);
+        }
+        REQUIRE(expected_seq == 503);
+        REQUIRE(codec.entries()[2].mdEntryType() == MDEntryType::Offer);
+        REQUIRE(codec.entries()[1].mdEntrySize().whole() == 20);
+        REQUIRE(codec.entries()[0].mdEntryPx() == FixedPrice::from_double(100.0));
+    }
+
+    SECTION("Truncated group is rejected") {
+        REQUIRE_FALSE(Codec::wrapForDecode(wire.data(), wire.size() - 1).isValid());
+        REQUIRE_FALSE(Codec::wrapForDecode(wire.data(), Codec::MIN_SIZE - 1).isValid());
+    }
+
+    SECTION("Entry count is clamped to the buffer") {
+        alignas(8) char small[Codec::encodedSize(2)]{};
+        auto md = Codec::wrapForEncode(small, sizeof(small));
+        md.encodeHeader().entryCount(5);
+        REQUIRE(md.encoded().size() == sizeof(small));
+        REQUIRE(Codec::wrapForDecode(small, sizeof(small)).entryCount() == 2);
+    }
+
+    SECTION("Dispatch") {
+        bool dispatched = false;
+        dispatch(wire, [&](auto& codec) {
+            using T = std::decay_t<decltype(codec)>;
+            if constexpr (std::is_same_v<T, Codec>) {
+                dispatched = codec.isValid() && codec.entries().size() == 3;
+            }
+        });
+        REQUIRE(dispatched);
+    }
+}
+
 // ============================================================================
 // Dispatch Tests
 // ============================================================================
@@ -487,6 +629,10 @@ TEST_CASE("SBE type traits", "[sbe][traits]") {
     SECTION("is_sbe_codec") {
         REQUIRE(is_sbe_codec_v<NewOrderSingleCodec>);
         REQUIRE(is_sbe_codec_v<ExecutionReportCodec>);
+        REQUIRE(is_sbe_codec_v<OrderCancelRequestCodec>);
+        REQUIRE(is_sbe_codec_v<OrderCancelReplaceRequestCodec>);
+        REQUIRE(is_sbe_codec_v<OrderCancelRejectCodec>);
+        REQUIRE(is_sbe_codec_v<MarketDataIncrementalRefreshCodec>);
         REQUIRE_FALSE(is_sbe_codec_v<MessageHeader>);
         REQUIRE_FALSE(is_sbe_codec_v<int>);
     }
@@ -497,7 +643,9 @@ TEST_CASE("SBE type traits", "[sbe][traits]") {
     }
 
     SECTION("MAX_MESSAGE_SIZE") {
-        REQUIRE(MAX_MESSAGE_SIZE == 144u);  // ExecutionReport is largest
+        // A full MarketDataIncrementalRefresh is largest
+        REQUIRE(MAX_MESSAGE_SIZE == MarketDataIncrementalRefreshCodec::TOTAL_SIZE);
+        REQUIRE(MAX_MESSAGE_SIZE >= ExecutionReportCodec::TOTAL_SIZE);
     }
 }
 
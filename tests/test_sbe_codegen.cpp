@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+// Codecs generated at build time from tests/schemas/test_schema.xml by
+// scripts/sbe_codegen.py (see nfx_sbe_generate in tests/CMakeLists.txt).
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include "nexusfix/sbe/sbe.hpp"
+#include "nfx/test_sbe/schema.hpp"
+
+namespace gen = nfx::test_sbe;
+
+// ============================================================================
+// Generated Layout Tests
+// ============================================================================
+
+TEST_CASE("Generated codec matches handwritten layout", "[sbe][codegen][regression]") {
+    using Handwritten = nfx::sbe::NewOrderSingleCodec;
+    using Generated = gen::NewOrderSingleCodec;
+
+    STATIC_REQUIRE(Generated::TEMPLATE_ID == Handwritten::TEMPLATE_ID);
+    STATIC_REQUIRE(Generated::BLOCK_LENGTH == Handwritten::BLOCK_LENGTH);
+    STATIC_REQUIRE(Generated::TOTAL_SIZE == Handwritten::TOTAL_SIZE);
+    STATIC_REQUIRE(Generated::Offset::Price == Handwritten::Offset::Price);
+    STATIC_REQUIRE(Generated::Offset::TransactTime == Handwritten::Offset::TransactTime);
+    STATIC_REQUIRE(nfx::sbe::is_sbe_codec_v<Generated>);
+
+    alignas(8) char expected[Handwritten::TOTAL_SIZE]{};
+    Handwritten::wrapForEncode(expected, sizeof(expected))
+        .encodeHeader()
+        .clOrdId("ORD001")
+        .symbol("AAPL")
+        .side(nfx::Side::Buy)
+        .ordType(nfx::OrdType::Limit)
+        .price(nfx::FixedPrice{15050000000LL})
+        .orderQty(nfx::Qty{1000000LL})
+        .transactTime(nfx::Timestamp{1234567890123456789LL});
+
+    alignas(8) char actual[Generated::TOTAL_SIZE]{};
+    Generated::wrapForEncode(actual, sizeof(actual))
+        .encodeHeader()
+        .clOrdId("ORD001")
+        .symbol("AAPL")
+        .side(gen::Side::Buy)
+        .ordType(gen::OrdType::Limit)
+        .price(15050000000LL)
+        .orderQty(1000000LL)
+        .transactTime(1234567890123456789LL);
+
+    REQUIRE(std::memcmp(expected, actual, sizeof(expected)) == 0);
+
+    // Each decodes the other's bytes
+    auto decoded = Generated::wrapForDecode(expected, sizeof(expected));
+    REQUIRE(decoded.isValid());
+    REQUIRE(decoded.clOrdId() == "ORD001");
+    REQUIRE(decoded.side() == gen::Side::Buy);
+    REQUIRE(decoded.price() == 15050000000LL);
+    REQUIRE(Handwritten::wrapForDecode(actual, sizeof(actual)).isValid());
+}
+
+TEST_CASE("Generated codec schema features", "[sbe][codegen]") {
+    using Quote = gen::QuoteUpdateCodec;
+    alignas(8) char buffer[Quote::TOTAL_SIZE]{};
+
+    auto quote = Quote::wrapForEncode(buffer, sizeof(buffer));
+    quote.encodeHeader()
+        .transactTime(42)
+        .condition(gen::QuoteCondition::Indicative)
+        .flags(gen::QuoteFlags::Stale);
+    quote.referencePrice().mantissa(15050000000LL);
+
+    SECTION("Optional fields start out null") {
+        REQUIRE(quote.levelIsNull());
+        quote.level(3);
+        REQUIRE_FALSE(quote.levelIsNull());
+    }
+
+    SECTION("Enums, sets, composites and constants") {
+        auto decoded = Quote::wrapForDecode(buffer, quote.encodedLength());
+        REQUIRE(decoded.isValid());
+        REQUIRE(decoded.transactTime() == 42);
+        REQUIRE(decoded.condition() == gen::QuoteCondition::Indicative);
+        REQUIRE(gen::QuoteFlags::has(decoded.flags(), gen::QuoteFlags::Stale));
+        REQUIRE_FALSE(gen::QuoteFlags::has(decoded.flags(), gen::QuoteFlags::Implied));
+        REQUIRE(decoded.referencePrice().mantissa() == 15050000000LL);
+        STATIC_REQUIRE(gen::PriceNull::exponent() == -8);
+        STATIC_REQUIRE(Quote::venue() == "XNFX");
+        STATIC_REQUIRE(Quote::defaultSide() == gen::Side::Buy);
+    }
+
+    SECTION("Consecutive repeating groups") {
+        quote.bidsCount(2);
+        quote.bidsEntry(0).price(100).size(10);
+        quote.bidsEntry(1).price(99).size(20);
+        quote.asksCount(1);
+        quote.asksEntry(0).price(101).size(5).orderCount(3);
+        REQUIRE(quote.encodedLength() == Quote::MIN_SIZE + 2 * 16 + 24);
+
+        auto decoded = Quote::wrapForDecode(buffer, quote.encodedLength());
+        REQUIRE(decoded.isValid());
+        REQUIRE(decoded.bids().size() == 2);
+        std::int64_t total = 0;
+        for (auto bid : decoded.bids()) {
+            total += bid.size();
+        }
+        REQUIRE(total == 30);
+        REQUIRE(decoded.bids()[1].price() == 99);
+        REQUIRE(decoded.asks().size() == 1);
+        REQUIRE(decoded.asks()[0].orderCount() == 3);
+
+        // Truncated asks group is rejected
+        REQUIRE_FALSE(Quote::wrapForDecode(buffer, quote.encodedLength() - 1).isValid());
+    }
+
+    SECTION("Group count is clamped to the buffer") {
+        auto small = Quote::wrapForEncode(buffer, Quote::MIN_SIZE + 3 * 16);
+        small.encodeHeader().bidsCount(10);
+        REQUIRE(small.bidsCount() == 3);
+        REQUIRE(small.asksCount() == 0);
+        REQUIRE(Quote::wrapForDecode(buffer, small.encodedLength()).isValid());
+    }
+}
+
+TEST_CASE("Generated schema dispatch", "[sbe][codegen][dispatch]") {
+    alignas(8) char buffer[gen::MAX_MESSAGE_SIZE]{};
+    auto quote = gen::QuoteUpdateCodec::wrapForEncode(buffer, sizeof(buffer));
+    quote.encodeHeader();
+
+    bool dispatched = false;
+    gen::dispatch(buffer, quote.encodedLength(), [&](auto& codec) {
+        using T = std::decay_t<decltype(codec)>;
+        dispatched = std::is_same_v<T, gen::QuoteUpdateCodec>;
+    });
+    REQUIRE(dispatched);
+
+    // Messages from another schema are not decoded as ours
+    nfx::sbe::write_uint16(buffer + nfx::sbe::MessageHeader::Offset::SchemaId, 99);
+    bool unknown = false;
+    gen::dispatch(buffer, quote.encodedLength(), [&](auto& codec) {
+        using T = std::decay_t<decltype(codec)>;
+        unknown = std::is_same_v<T, nfx::sbe::UnknownMessage>;
+    });
+    REQUIRE(unknown);
+}
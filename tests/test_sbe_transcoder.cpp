@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 SilverstreamsAI
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "nexusfix/sbe/sbe.hpp"
+#include "nexusfix/sbe/transcoder.hpp"
+
+// nfx also has a FIX MessageHeader: only pull in the sbe namespace
+using nfx::FixedPrice;
+using nfx::OrdStatus;
+using nfx::OrdType;
+using nfx::ParseErrorCode;
+using nfx::Qty;
+using nfx::Side;
+using nfx::TimeInForce;
+using nfx::Timestamp;
+using nfx::ExecType;
+namespace simd = nfx::simd;
+using namespace nfx::sbe;
+
+// ============================================================================
+// FIX <-> SBE Transcoding Tests
+// ============================================================================
+
+TEST_CASE("FIX to SBE transcoding", "[sbe][transcode][regression]") {
+    auto transcode = [](const std::string& fix, char* out, std::size_t length) {
+        std::span<const char> msg{fix.data(), fix.size()};
+        auto idx = simd::build_index(msg);
+        simd::IndexedFieldAccessor accessor{idx, msg};
+        return fix_to_sbe(accessor, out, length);
+    };
+    alignas(8) char buffer[MAX_MESSAGE_SIZE]{};
+
+    SECTION("NewOrderSingle without doubles") {
+        const std::string nos =
+            "8=FIX.4.4\x01" "9=120\x01" "35=D\x01" "49=CLIENT\x01" "56=GW\x01" "34=7\x01"
+            "11=ORD001\x01" "55=AAPL\x01" "54=2\x01" "40=2\x01" "38=100.25\x01"
+            "44=150.12345678\x01" "60=20240102-03:04:05.123456789\x01" "10=000\x01";
+        auto len = transcode(nos, buffer, sizeof(buffer));
+        REQUIRE(len.has_value());
+        REQUIRE(*len == NewOrderSingleCodec::TOTAL_SIZE);
+
+        auto codec = NewOrderSingleCodec::wrapForDecode(buffer, *len);
+        REQUIRE(codec.isValid());
+        REQUIRE(codec.clOrdId() == "ORD001");
+        REQUIRE(codec.symbol() == "AAPL");
+        REQUIRE(codec.side() == Side::Sell);
+        REQUIRE(codec.ordType() == OrdType::Limit);
+        REQUIRE(codec.price().raw == 15012345678LL);
+        REQUIRE(codec.orderQty().raw == 1002500LL);
+        REQUIRE(codec.transactTime().nanos == 1704164645123456789LL);
+    }
+
+    SECTION("Market order has a null price") {
+        const std::string nos =
+            "8=FIX.4.4\x01" "9=60\x01" "35=D\x01" "11=ORD002\x01" "55=MSFT\x01"
+            "54=1\x01" "40=1\x01" "38=5\x01" "10=000\x01";
+        auto len = transcode(nos, buffer, sizeof(buffer));
+        REQUIRE(len.has_value());
+        auto codec = NewOrderSingleCodec::wrapForDecode(buffer, *len);
+        REQUIRE(DecimalPrice::is_null(codec.body() + NewOrderSingleCodec::Offset::Price));
+        REQUIRE(SbeTimestamp::is_null(codec.body() + NewOrderSingleCodec::Offset::TransactTime));
+    }
+
+    SECTION("Cancel/replace") {
+        const std::string ocrr =
+            "8=FIX.4.4\x01" "9=90\x01" "35=G\x01" "41=ORD001\x01" "11=ORD003\x01"
+            "55=AAPL\x01" "54=1\x01" "40=2\x01" "59=3\x01" "38=50\x01" "44=151\x01"
+            "10=000\x01";
+        auto len = transcode(ocrr, buffer, sizeof(buffer));
+        REQUIRE(len.has_value());
+        auto codec = OrderCancelReplaceRequestCodec::wrapForDecode(buffer, *len);
+        REQUIRE(codec.isValid());
+        REQUIRE(codec.origClOrdId() == "ORD001");
+        REQUIRE(codec.timeInForce() == TimeInForce::ImmediateOrCancel);
+        REQUIRE(codec.price().raw == 15100000000LL);
+        REQUIRE(codec.orderQty().raw == 500000LL);
+    }
+
+    SECTION("Errors") {
+        const std::string missing =
+            "8=FIX.4.4\x01" "9=40\x01" "35=D\x01" "11=ORD004\x01" "54=1\x01"
+            "40=1\x01" "38=5\x01" "10=000\x01";
+        auto r = transcode(missing, buffer, sizeof(buffer));
+        REQUIRE_FALSE(r.has_value());
+        REQUIRE(r.error().code == ParseErrorCode::MissingRequiredField);
+        REQUIRE(r.error().tag == 55);
+
+        const std::string too_long =
+            "8=FIX.4.4\x01" "9=60\x01" "35=F\x01" "41=ORD001\x01" "11=ORD005\x01"
+            "55=VERYLONGSYM\x01" "54=1\x01" "10=000\x01";
+        r = transcode(too_long, buffer, sizeof(buffer));
+        REQUIRE_FALSE(r.has_value());
+        REQUIRE(r.error().code == ParseErrorCode::InvalidFieldFormat);
+        REQUIRE(r.error().tag == 55);
+
+        const std::string heartbeat = "8=FIX.4.4\x01" "9=5\x01" "35=0\x01" "10=000\x01";
+        r = transcode(heartbeat, buffer, sizeof(buffer));
+        REQUIRE_FALSE(r.has_value());
+        REQUIRE(r.error().code == ParseErrorCode::InvalidMsgType);
+    }
+}
+
+TEST_CASE("SBE ExecutionReport to FIX transcoding", "[sbe][transcode][regression]") {
+    alignas(8) char buffer[ExecutionReportCodec::TOTAL_SIZE]{};
+    auto enc = ExecutionReportCodec::wrapForEncode(buffer, sizeof(buffer));
+    enc.encodeHeader()
+        .orderId("EX1")
+        .execId("E1")
+        .clOrdId("ORD001")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .execType(ExecType::Trade)
+        .ordStatus(OrdStatus::PartiallyFilled)
+        .price(FixedPrice{15050000000LL})
+        .orderQty(Qty{1000000LL})
+        .lastPx(FixedPrice{15049500000LL})
+        .lastQty(Qty{250000LL})
+        .leavesQty(Qty{750000LL})
+        .cumQty(Qty{250000LL})
+        .avgPx(FixedPrice{15049500000LL})
+        .transactTime(Timestamp{1704164645123000000LL});
+
+    ExecutionReportTranscoder transcoder;
+    REQUIRE_FALSE(transcoder.build(
+        ExecutionReportCodec::wrapForDecode(buffer, sizeof(buffer)), 1, "x").has_value());
+    transcoder.prepare("FIX.4.4", "GW", "CLIENT");
+
+    auto fix = transcoder.build(
+        ExecutionReportCodec::wrapForDecode(buffer, sizeof(buffer)), 42,
+        "20240102-03:04:05.200");
+    REQUIRE(fix.has_value());
+    std::string_view text{fix->data(), fix->size()};
+    REQUIRE(text.find("35=8\x01" "49=GW\x01" "56=CLIENT\x01" "34=42\x01") != std::string_view::npos);
+
+    auto idx = simd::build_index(*fix);
+    simd::IndexedFieldAccessor accessor{idx, *fix};
+    REQUIRE(accessor.get(37) == "EX1");
+    REQUIRE(accessor.get(150) == "F");
+    REQUIRE(accessor.get(44) == "150.5");
+    REQUIRE(accessor.get(31) == "150.495");
+    REQUIRE(accessor.get(32) == "25");
+    REQUIRE(accessor.get(151) == "75");
+    REQUIRE(accessor.get(6) == "150.495");
+    REQUIRE(accessor.get(60) == "20240102-03:04:05.123");
+
+    // BodyLength and CheckSum are consistent with the bytes
+    const auto body_start = text.find("35=");
+    const auto trailer = text.rfind("10=");
+    REQUIRE(accessor.get_int(9) == static_cast<int64_t>(trailer - body_start));
+    unsigned sum = 0;
+    for (std::size_t i = 0; i < trailer; ++i) sum += static_cast<unsigned char>(text[i]);
+    REQUIRE(accessor.get_int(10) == static_cast<int64_t>(sum % 256));
+
+    SECTION("Non-fill omits LastPx/LastQty") {
+        auto zero = ExecutionReportCodec::wrapForEncode(buffer, sizeof(buffer));
+        zero.execType(ExecType::New).lastQty(Qty{0});
+        auto ack = transcoder.build(
+            ExecutionReportCodec::wrapForDecode(buffer, sizeof(buffer)), 43, "x");
+        REQUIRE(ack.has_value());
+        std::string_view ack_text{ack->data(), ack->size()};
+        REQUIRE(ack_text.find("\x01" "31=") == std::string_view::npos);
+        REQUIRE(ack_text.find("\x01" "32=") == std::string_view::npos);
+    }
+}
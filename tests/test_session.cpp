@@ -0,0 +1,3060 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/session/acceptor_engine.hpp"
+#include "nexusfix/session/audit_tap.hpp"
+#include "nexusfix/session/cl_ord_id.hpp"
+#include "nexusfix/session/exchange_simulator.hpp"
+#include "nexusfix/session/md_subscriptions.hpp"
+#include "nexusfix/session/message_router.hpp"
+#include "nexusfix/session/order_tracker.hpp"
+#include "nexusfix/session/quickfix_adapter.hpp"
+#include "nexusfix/session/replication.hpp"
+#include "nexusfix/session/resend.hpp"
+#include "nexusfix/session/risk_check.hpp"
+#include "nexusfix/session/send_queue.hpp"
+#include "nexusfix/session/session_channel.hpp"
+#include "nexusfix/session/session_index.hpp"
+#include "nexusfix/session/session_manager.hpp"
+#include "nexusfix/session/session_reactor.hpp"
+#include "nexusfix/session/sharded_engine.hpp"
+#include "nexusfix/session/throttle.hpp"
+#include "nexusfix/session/timer_wheel.hpp"
+#include "nexusfix/session/warmup.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+
+using namespace nfx;
+
+namespace {
+
+std::span<const char> as_span(std::string_view sv) {
+    return std::span<const char>{sv.data(), sv.size()};
+}
+
+/// Session wired to an in-memory store, capturing every outbound message
+struct SessionFixture {
+    SessionConfig config;
+    std::unique_ptr<SessionManager> session;
+    store::MemoryMessageStore store{"CLIENT-SERVER"};
+    std::vector<std::string> sent;
+    MessageAssembler assembler;
+
+    explicit SessionFixture(const SessionConfig& base = SessionConfig{}) : config{base} {
+        config.sender_comp_id = "CLIENT";
+        config.target_comp_id = "SERVER";
+        session = std::make_unique<SessionManager>(config);
+
+        SessionCallbacks callbacks;
+        callbacks.on_send = [this](std::span<const char> msg) {
+            sent.emplace_back(msg.data(), msg.size());
+            return true;
+        };
+        session->set_callbacks(std::move(callbacks));
+        session->set_message_store(&store);
+    }
+
+    /// Build an inbound message from the counterparty and feed it
+    template <typename Builder>
+    void receive(Builder& builder, uint32_t seq) {
+        auto msg = builder
+            .sender_comp_id("SERVER")
+            .target_comp_id("CLIENT")
+            .msg_seq_num(seq)
+            .sending_time("20260101-00:00:00.000")
+            .build(assembler);
+        session->on_data_received(msg);
+    }
+
+    /// Build an outbound message as it would have been originally sent
+    template <typename Builder>
+    std::string original(Builder& builder, uint32_t seq) {
+        auto msg = builder
+            .sender_comp_id("CLIENT")
+            .target_comp_id("SERVER")
+            .msg_seq_num(seq)
+            .sending_time("20260101-00:00:00.000")
+            .build(assembler);
+        return std::string{msg.data(), msg.size()};
+    }
+
+    void receive_resend_request(uint32_t begin, uint32_t end, uint32_t seq = 1) {
+        auto builder = fix44::ResendRequest::Builder{}.begin_seq_no(begin).end_seq_no(end);
+        receive(builder, seq);
+    }
+};
+
+/// Assemble a complete stored message from header/body fields
+std::string make_message(std::string_view body, std::string_view begin_string = "FIX.4.4") {
+    std::string msg = "8=" + std::string{begin_string} + "\x01" "9=" +
+        std::to_string(body.size()) + "\x01";
+    msg += body;
+    char cs[3];
+    parser::format_checksum(parser::checksum(msg.data(), msg.size()), cs);
+    msg += "10=" + std::string{cs, 3} + "\x01";
+    return msg;
+}
+
+/// Outbound message of the given type as stored by the session
+std::string make_stored(char type, uint32_t seq) {
+    return make_message(std::string{"35="} + type + "\x01" "34=" + std::to_string(seq) +
+        "\x01" "49=CLIENT\x01" "52=20260101-00:00:00.000\x01" "56=SERVER\x01");
+}
+
+/// BodyLength (9) must equal the byte count between its SOH and "10="
+bool body_length_matches(std::string_view msg) {
+    size_t body_start = msg.find('\x01', msg.find("9=")) + 1;
+    size_t body_end = msg.rfind("\x01" "10=") + 1;
+    size_t value_start = msg.find("9=") + 2;
+    size_t declared = std::stoul(std::string{msg.substr(value_start, body_start - 1 - value_start)});
+    return declared == body_end - body_start;
+}
+
+} // namespace
+
+// ============================================================================
+// ResendRewriter Tests
+// ============================================================================
+
+TEST_CASE("ResendRewriter splices resend header fields", "[session][resend][regression]") {
+    SessionFixture f;
+    ResendRewriter rewriter;
+    constexpr std::string_view now = "20260102-12:34:56.789";
+
+    SECTION("Adds PossDupFlag and OrigSendingTime") {
+        auto builder = fix44::TestRequest::Builder{}.test_req_id("PING");
+        std::string stored = f.original(builder, 5);
+
+        auto out = rewriter.rewrite(as_span(stored), now);
+        REQUIRE(out.has_value());
+
+        auto parsed = ParsedMessage::parse(*out);
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->msg_seq_num() == 5);
+        REQUIRE(parsed->get_char(43) == 'Y');
+        REQUIRE(parsed->sending_time() == now);
+        REQUIRE(parsed->get_string(122) == "20260101-00:00:00.000");
+        REQUIRE(parsed->get_string(112) == "PING");
+        REQUIRE(body_length_matches({out->data(), out->size()}));
+    }
+
+    SECTION("Existing PossDupFlag and OrigSendingTime are preserved") {
+        std::string stored = make_message(
+            "35=0\x01" "34=7\x01" "43=N\x01" "49=CLIENT\x01"
+            "52=20260101-00:00:05.000\x01" "56=SERVER\x01"
+            "122=20260101-00:00:00.000\x01");
+
+        auto out = rewriter.rewrite(as_span(stored), now);
+        REQUIRE(out.has_value());
+
+        auto parsed = ParsedMessage::parse(*out);
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->get_char(43) == 'Y');
+        REQUIRE(parsed->sending_time() == now);
+        REQUIRE(parsed->get_string(122) == "20260101-00:00:00.000");
+        REQUIRE(body_length_matches({out->data(), out->size()}));
+    }
+
+    SECTION("Rejects bytes that are not a FIX message") {
+        REQUIRE_FALSE(rewriter.rewrite(as_span("not a fix message at all"), now).has_value());
+    }
+
+    SECTION("Rewrite from stored metadata matches the scanning rewrite") {
+        auto builder = fix44::NewOrderSingle::Builder{}
+            .cl_ord_id("ORD-1").symbol("AAPL").side(Side::Buy)
+            .order_qty(Qty::from_int(100)).ord_type(OrdType::Market)
+            .transact_time("20260101-00:00:00.000");
+        for (const std::string& stored : {f.original(builder, 9), make_stored('D', 10),
+                                          make_stored('0', 11)}) {
+            const auto meta = nfx::store::describe_message(as_span(stored));
+            REQUIRE(meta.valid());
+            REQUIRE(meta.sending_time_offset > 0);
+
+            auto scanned = rewriter.rewrite(as_span(stored), now);
+            REQUIRE(scanned.has_value());
+            const std::string expected{scanned->data(), scanned->size()};
+
+            auto fast = rewriter.rewrite(as_span(stored), meta, now);
+            REQUIRE(fast.has_value());
+            REQUIRE(std::string_view{fast->data(), fast->size()} == expected);
+        }
+    }
+}
+
+// ============================================================================
+// MessageRouter Tests
+// ============================================================================
+
+TEST_CASE("MessageRouter forwards between hub sessions", "[session][router]") {
+    MessageRouter router;
+    const auto venue = router.add_destination({.sender_comp_id = "HUB", .target_comp_id = "VENUE-A",
+                                               .stamp_on_behalf_of = true,
+                                               .strip_deliver_to = true, .next_seq_num = 40});
+    const auto client = router.add_destination({.sender_comp_id = "HUB", .target_comp_id = "CLIENT"});
+    REQUIRE(router.add_rule({{128, "VENUE-A"}, {35, "D"}}, venue));
+    REQUIRE(router.add_rule({{128, "VENUE-A"}, {35, "F"}}, venue));
+    REQUIRE(router.add_rule({{56, "HUB"}, {9000}}, client));      // 9000 present
+    REQUIRE_FALSE(router.add_rule({{55, "AAPL"}}, 7));             // Unknown destination
+    REQUIRE(router.rule_count() == 3);
+    constexpr std::string_view now = "20260102-12:34:56.789";
+
+    const std::string order = make_message(
+        "35=D\x01" "49=CLIENT\x01" "56=HUB\x01" "34=12\x01" "128=VENUE-A\x01"
+        "52=20260101-00:00:00.000\x01" "11=ORD-1\x01" "55=AAPL\x01" "54=1\x01" "38=100\x01");
+
+    SECTION("Rewrites the header and fixes up length and checksum") {
+        auto fwd = router.route(as_span(order), now);
+        REQUIRE(fwd.has_value());
+        REQUIRE(fwd->routed());
+        REQUIRE(fwd->destination == venue);
+        REQUIRE(fwd->seq_num == 40);
+        REQUIRE(router.destination(venue).next_seq_num == 41);
+
+        const std::string_view out{fwd->message.data(), fwd->message.size()};
+        REQUIRE(out == make_message(
+            "35=D\x01" "49=HUB\x01" "56=VENUE-A\x01" "115=CLIENT\x01" "34=40\x01"
+            "52=20260102-12:34:56.789\x01" "11=ORD-1\x01" "55=AAPL\x01" "54=1\x01" "38=100\x01"));
+        REQUIRE(parser::validate_fix_checksum(out));
+        REQUIRE(body_length_matches(out));
+    }
+
+    SECTION("Unmatched messages are left unrouted unless a default is set") {
+        const std::string cancel_other = make_message(
+            "35=F\x01" "49=CLIENT\x01" "56=HUB\x01" "34=13\x01" "128=VENUE-B\x01"
+            "52=20260101-00:00:00.000\x01" "11=C-1\x01");
+        auto fwd = router.route(as_span(cancel_other), now);
+        REQUIRE(fwd.has_value());
+        REQUIRE_FALSE(fwd->routed());
+
+        router.set_default(client);
+        fwd = router.route(as_span(cancel_other), now);
+        REQUIRE(fwd.has_value());
+        REQUIRE(fwd->destination == client);
+        const std::string_view out{fwd->message.data(), fwd->message.size()};
+        REQUIRE(out.find("128=VENUE-B\x01") != std::string_view::npos);  // Kept: not stripped
+        REQUIRE(out.find("115=") == std::string_view::npos);
+        REQUIRE(parser::validate_fix_checksum(out));
+        REQUIRE(body_length_matches(out));
+    }
+
+    SECTION("Presence conditions and explicit forwards") {
+        const std::string report = make_message(
+            "35=8\x01" "49=VENUE-A\x01" "56=HUB\x01" "34=7\x01" "52=20260101-00:00:00.000\x01"
+            "115=CLIENT\x01" "37=X1\x01" "9000=Y\x01");
+        const auto idx = simd::build_index(as_span(report));
+        REQUIRE(router.match(as_span(report), idx) == client);
+
+        auto out = router.forward(as_span(report), idx, client, 123456, now);
+        REQUIRE(out.has_value());
+        const std::string_view bytes{out->data(), out->size()};
+        REQUIRE(bytes.find("\x01" "34=123456\x01") != std::string_view::npos);
+        REQUIRE(bytes.find("\x01" "56=CLIENT\x01") != std::string_view::npos);
+        REQUIRE(parser::validate_fix_checksum(bytes));
+        REQUIRE(body_length_matches(bytes));
+    }
+
+    SECTION("Messages without the rewritten header fields are rejected") {
+        const std::string no_seq = make_message(
+            "35=D\x01" "49=CLIENT\x01" "56=HUB\x01" "128=VENUE-A\x01"
+            "52=20260101-00:00:00.000\x01" "11=ORD-1\x01");
+        auto fwd = router.route(as_span(no_seq), now);
+        REQUIRE_FALSE(fwd.has_value());
+        REQUIRE(fwd.error().tag == 34);
+        REQUIRE(router.destination(venue).next_seq_num == 40);
+    }
+}
+
+// ============================================================================
+// Resend Tests
+// ============================================================================
+
+TEST_CASE("SessionManager releases buffers when idle", "[session][compact]") {
+    using namespace std::chrono_literals;
+    SessionConfig config;
+    config.heart_bt_int = 1;
+    config.idle_compact_heartbeats = 1;
+    SessionFixture f{config};
+    auto& store = f.session->own_message_store(store::MemoryMessageStore::Config{
+        .session_id = "CLIENT-SERVER", .max_messages = 1024, .pool_size_bytes = 256 * 1024});
+
+    f.session->on_connect();
+    REQUIRE(f.session->initiate_logon().has_value());
+    auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(1);
+    f.receive(logon, 1);
+    REQUIRE(f.session->state() == SessionState::Active);
+
+    auto order = fix44::NewOrderSingle::Builder{}
+        .cl_ord_id("ORD001").symbol("AAPL").side(Side::Buy)
+        .transact_time("20260101-00:00:00.000").order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit).price(FixedPrice::from_string("150.25"));
+
+    SECTION("Explicit compact() keeps the session usable") {
+        f.session->begin_batch();
+        REQUIRE(f.session->send_new_order(order).has_value());
+        REQUIRE(f.session->flush());
+
+        const size_t full = store.memory_footprint();
+        const size_t released = f.session->compact();
+        REQUIRE(released > full - store.memory_footprint());
+        REQUIRE(store.shrunk());
+        REQUIRE(f.session->stats().compactions == 1);
+
+        // Templates, batch buffer and store come back on next use
+        f.session->begin_batch();
+        REQUIRE(f.session->send_new_order(order).has_value());
+        REQUIRE(f.session->flush());
+        REQUIRE_FALSE(store.shrunk());
+        REQUIRE(f.sent.size() == 3);
+        auto parsed = fix44::NewOrderSingle::from_buffer(as_span(f.sent[2]));
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->header.msg_seq_num == 3);
+        REQUIRE(body_length_matches(f.sent[2]));
+        REQUIRE(std::string_view{store.retrieve(2)->data(), store.retrieve(2)->size()} == f.sent[1]);
+    }
+
+    SECTION("Heartbeat intervals without traffic trigger it") {
+        std::this_thread::sleep_for(1100ms);
+        auto heartbeat = fix44::Heartbeat::Builder{};
+        f.receive(heartbeat, 2);  // Counterparty's heartbeat: no test request due
+        f.session->on_timer_tick();
+        REQUIRE(f.session->stats().heartbeats_sent == 1);
+        REQUIRE(f.session->stats().compactions == 1);
+        REQUIRE(store.shrunk());
+        REQUIRE(f.session->send_new_order(order).has_value());
+        REQUIRE_FALSE(store.shrunk());
+    }
+}
+
+#if NFX_SHM_AVAILABLE
+TEST_CASE("StandbyReplica mirrors the primary and takes the session over", "[session][replication]") {
+    const std::string name = "repl." + std::to_string(::getpid());
+    auto ring = ShmPublisher::create(name, {.capacity = 4096, .futex_wakeup = false});
+    REQUIRE(ring.has_value());
+    auto sub = ShmSubscriber::attach(name);
+    REQUIRE(sub.has_value());
+
+    SessionFixture f;
+    SessionReplicator replicator{*ring, f.store, {.session_id = 7}};
+    f.session->set_message_store(&replicator);
+    f.session->attach_sequence_checkpoint(replicator.checkpoint());
+
+    StandbyReplica replica{{.session_id = 7}, {.session_id = "CLIENT-SERVER",
+                                               .max_messages = 1024,
+                                               .pool_size_bytes = 256 * 1024}};
+    auto order = fix44::NewOrderSingle::Builder{}
+        .cl_ord_id("ORD001").symbol("AAPL").side(Side::Buy)
+        .transact_time("20260101-00:00:00.000").order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit).price(FixedPrice::from_string("150.25"));
+
+    f.session->on_connect();
+    REQUIRE(f.session->initiate_logon().has_value());
+    auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+    f.receive(logon, 1);
+    REQUIRE(f.session->state() == SessionState::Active);
+    REQUIRE(replicator.poll(f.session->state()));   // New standby: snapshot
+    REQUIRE(replica.poll(*sub) > 0);
+    REQUIRE(replica.in_sync());
+
+    SECTION("appends and progress keep the mirror warm") {
+        for (int i = 0; i < 3; ++i) REQUIRE(f.session->send_new_order(order).has_value());
+        auto heartbeat = fix44::Heartbeat::Builder{};
+        f.receive(heartbeat, 2);
+        REQUIRE(replicator.poll(f.session->state()));
+        (void)replica.poll(*sub);
+
+        REQUIRE(replica.in_sync());
+        REQUIRE(replica.primary_state() == SessionState::Active);
+        REQUIRE(replica.stats().snapshots == 1);
+        REQUIRE(replica.sequences().current_outbound() == 5);
+        REQUIRE(replica.sequences().expected_inbound() == 3);
+        auto mirrored = replica.store().retrieve(4);
+        REQUIRE(mirrored.has_value());
+        REQUIRE(std::string_view{mirrored->data(), mirrored->size()} == f.sent[3]);
+
+        // Failover: the standby logs on at the next seq num, no reset
+        SessionFixture standby;
+        replica.take_over(*standby.session);
+        REQUIRE(standby.session->message_store() == &replica.store());
+        REQUIRE(standby.session->sequences().current_outbound() == 5);
+        REQUIRE(standby.session->sequences().expected_inbound() == 3);
+        standby.session->on_connect();
+        REQUIRE(standby.session->initiate_logon().has_value());
+        auto parsed = fix44::Logon::from_buffer(as_span(standby.sent.back()));
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->header.msg_seq_num == 5);
+    }
+
+    SECTION("a full ring triggers a snapshot resync") {
+        // The standby stops reading: the 4 KiB ring fills up
+        size_t sent = 0;
+        while (replicator.replication_stats().overflows == 0) {
+            REQUIRE(f.session->send_new_order(order).has_value());
+            ++sent;
+        }
+        REQUIRE(replicator.resyncing());
+        for (int i = 0; i < 4; ++i) REQUIRE(f.session->send_new_order(order).has_value());
+
+        (void)replica.poll(*sub);
+        const uint32_t newest = f.session->sequences().current_outbound() - 1;
+        for (int i = 0; i < 100 && !replicator.poll(f.session->state()); ++i) {
+            (void)replica.poll(*sub);
+        }
+        (void)replica.poll(*sub);
+
+        REQUIRE_FALSE(replicator.resyncing());
+        REQUIRE(replicator.replication_stats().snapshots == 2);
+        REQUIRE(replica.in_sync());
+        REQUIRE(replica.sequences().current_outbound() == newest + 1);
+        for (uint32_t seq = 1; seq <= newest; ++seq) {
+            REQUIRE(replica.store().retrieve(seq) == f.store.retrieve(seq));
+        }
+        REQUIRE(sent > 4);
+    }
+
+    SECTION("records of other sessions are ignored") {
+        ShmMessage foreign{to_payload(ReplicationKind::Reset), ShmMeta{.session_id = 8}, {}, 0};
+        REQUIRE_FALSE(replica.apply(foreign));
+        ShmMessage fix{ShmPayload::Fix, ShmMeta{.session_id = 7}, {}, 0};
+        REQUIRE_FALSE(replica.apply(fix));
+        REQUIRE(replica.store().retrieve(1).has_value());
+    }
+}
+#endif
+
+TEST_CASE("ExchangeSimulator answers orders with configured fill patterns", "[session][simulator]") {
+    SessionFixture f;
+    f.session->on_connect();
+    REQUIRE(f.session->initiate_logon().has_value());
+    auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+    f.receive(logon, 1);
+    REQUIRE(f.session->state() == SessionState::Active);
+
+    auto order_msg = fix44::NewOrderSingle::Builder{}
+        .sender_comp_id("SERVER").target_comp_id("CLIENT").msg_seq_num(2)
+        .sending_time("20260101-00:00:00.000").cl_ord_id("ORD001").symbol("AAPL")
+        .side(Side::Sell).transact_time("20260101-00:00:00.000")
+        .order_qty(Qty::from_int(10)).ord_type(OrdType::Limit)
+        .price(FixedPrice::from_string("150.5"))
+        .build(f.assembler);
+    const std::string raw{order_msg.data(), order_msg.size()};
+    auto order = fix44::NewOrderSingle::from_buffer(as_span(raw));
+    REQUIRE(order.has_value());
+
+    auto send = [&](const fix44::ExecutionReport::Builder& report) {
+        REQUIRE(f.session->send_execution_report(report).has_value());
+    };
+
+    SECTION("Ack and partial fills through the session template") {
+        ExchangeSimulator sim{{.fill = FillPattern::PartialFills, .partial_fills = 3}};
+        sim.on_new_order(*order, 0, send);
+        REQUIRE(f.sent.size() == 5);  // Logon + ack + 3 fills
+        REQUIRE(sim.stats().reports == 4);
+        REQUIRE(sim.stats().fills == 3);
+
+        auto ack = fix44::ExecutionReport::from_buffer(as_span(f.sent[1]));
+        REQUIRE(ack.has_value());
+        REQUIRE(body_length_matches(f.sent[1]));
+        REQUIRE(ack->header.msg_seq_num == 2);
+        REQUIRE(ack->exec_type == ExecType::New);
+        REQUIRE(ack->cl_ord_id == "ORD001");
+        REQUIRE(ack->leaves_qty == Qty::from_int(10));
+
+        int64_t filled = 0;
+        for (size_t i = 2; i < f.sent.size(); ++i) {
+            auto fill = fix44::ExecutionReport::from_buffer(as_span(f.sent[i]));
+            REQUIRE(fill.has_value());
+            REQUIRE(fill->order_id == ack->order_id);
+            REQUIRE(fill->exec_id != ack->exec_id);
+            REQUIRE(fill->last_px == FixedPrice::from_string("150.5"));
+            filled += fill->last_qty.whole();
+            REQUIRE(fill->cum_qty == Qty::from_int(filled));
+        }
+        auto last = fix44::ExecutionReport::from_buffer(as_span(f.sent.back()));
+        REQUIRE(filled == 10);
+        REQUIRE(last->exec_type == ExecType::Fill);
+        REQUIRE(last->ord_status == OrdStatus::Filled);
+        REQUIRE(last->leaves_qty == Qty{});
+    }
+
+    SECTION("Reject every Nth order") {
+        ExchangeSimulator sim{{.fill = FillPattern::AckOnly, .reject_every = 2}};
+        sim.on_new_order(*order, 0, send);
+        sim.on_new_order(*order, 0, send);
+        REQUIRE(f.sent.size() == 3);
+        auto reject = fix44::ExecutionReport::from_buffer(as_span(f.sent[2]));
+        REQUIRE(reject.has_value());
+        REQUIRE(reject->exec_type == ExecType::Rejected);
+        REQUIRE(reject->text == "simulated reject");
+        REQUIRE(sim.stats().rejects == 1);
+    }
+
+    SECTION("Injected latency holds reports until poll") {
+        ExchangeSimulator sim{{.latency_ns = 1000, .queue_capacity = 2}};
+        sim.on_new_order(*order, 100, send);
+        sim.on_new_order(*order, 200, send);
+        REQUIRE(f.sent.size() == 1);
+        REQUIRE(sim.pending() == 2);
+        REQUIRE(sim.next_due() == 1100);
+
+        sim.on_new_order(*order, 300, send);  // Queue full: answered now
+        REQUIRE(sim.stats().undelayed == 1);
+        REQUIRE(f.sent.size() == 3);
+
+        REQUIRE(sim.poll(1099, send) == 0);
+        REQUIRE(sim.poll(1100, send) == 1);
+        REQUIRE(sim.poll(5000, send) == 1);
+        REQUIRE(sim.pending() == 0);
+        REQUIRE(f.sent.size() == 7);
+        auto delayed = fix44::ExecutionReport::from_buffer(as_span(f.sent[3]));
+        REQUIRE(delayed.has_value());
+        REQUIRE(delayed->cl_ord_id == "ORD001");
+        REQUIRE(delayed->symbol == "AAPL");
+    }
+}
+
+TEST_CASE("SendQueue funnels several producers into one session", "[session][send_queue]") {
+    SessionFixture f;
+    f.session->on_connect();
+    REQUIRE(f.session->initiate_logon().has_value());
+    auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+    f.receive(logon, 1);
+    REQUIRE(f.session->state() == SessionState::Active);
+
+    SECTION("Body bytes match the builder path") {
+        SendQueue<16> queue;
+        REQUIRE(queue.try_send("H", [](BodyWriter& body) {
+            body.field(tag::ClOrdID::value, "ORD003")
+                .field(tag::Symbol::value, "AAPL")
+                .field(tag::Side::value, '1');
+        }));
+        REQUIRE(queue.drain(*f.session) == 1);
+        REQUIRE(f.sent.size() == 2);
+
+        auto parsed = fix44::OrderStatusRequest::from_buffer(as_span(f.sent[1]));
+        REQUIRE(parsed.has_value());
+        auto generic = fix44::OrderStatusRequest::Builder{}
+            .cl_ord_id("ORD003").symbol("AAPL").side(Side::Buy)
+            .sender_comp_id("CLIENT").target_comp_id("SERVER").msg_seq_num(2)
+            .sending_time(parsed->header.sending_time)
+            .build(f.assembler);
+        REQUIRE(f.sent[1] == std::string_view{generic.data(), generic.size()});
+        REQUIRE(queue.stats().sent == 1);
+    }
+
+    SECTION("Oversize bodies and bad MsgTypes are refused") {
+        SendQueue<4, 32> queue;
+        const std::string big(40, 'x');
+        REQUIRE_FALSE(queue.try_send("D", std::string_view{big}));
+        REQUIRE_FALSE(queue.try_send("ABC", std::string_view{"58=x\x01"}));
+        REQUIRE_FALSE(queue.try_send("D", [&](BodyWriter& body) {
+            body.field(tag::Text::value, big);
+        }));
+        REQUIRE(queue.drain(*f.session) == 1);
+        REQUIRE(queue.stats().dropped == 1);
+        REQUIRE(f.sent.size() == 1);
+    }
+
+    SECTION("Concurrent producers get contiguous sequence numbers") {
+        constexpr int PRODUCERS = 4;
+        constexpr int PER_PRODUCER = 250;
+        SendQueue<64> queue;
+        std::atomic<int> done{0};
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < PRODUCERS; ++p) {
+            producers.emplace_back([&, p] {
+                for (int i = 0; i < PER_PRODUCER; ++i) {
+                    const std::string id = std::to_string(p) + "-" + std::to_string(i);
+                    while (!queue.try_send("H", [&](BodyWriter& body) {
+                        body.field(tag::ClOrdID::value, id)
+                            .field(tag::Symbol::value, "AAPL")
+                            .field(tag::Side::value, '1');
+                    })) {
+                        std::this_thread::yield();
+                    }
+                }
+                done.fetch_add(1);
+            });
+        }
+        while (done.load() < PRODUCERS || !queue.empty()) {
+            (void)queue.drain(*f.session);
+        }
+        for (auto& t : producers) t.join();
+
+        REQUIRE(queue.stats().sent == PRODUCERS * PER_PRODUCER);
+        REQUIRE(f.sent.size() == PRODUCERS * PER_PRODUCER + 1);
+
+        // Wire order is claim order: seq nums contiguous, each producer's
+        // orders in the order it sent them
+        std::array<int, PRODUCERS> next{};
+        for (size_t i = 1; i < f.sent.size(); ++i) {
+            auto parsed = fix44::OrderStatusRequest::from_buffer(as_span(f.sent[i]));
+            REQUIRE(parsed.has_value());
+            REQUIRE(parsed->header.msg_seq_num == i + 1);
+            const auto id = parsed->cl_ord_id;
+            const int p = id[0] - '0';
+            REQUIRE(id.substr(2) == std::to_string(next[p]++));
+        }
+    }
+}
+
+TEST_CASE("SessionManager replays stored messages on ResendRequest", "[session][resend][regression]") {
+    SessionFixture f;
+
+    REQUIRE(f.store.store(1, as_span("MSG-1")));
+    REQUIRE(f.store.store(2, as_span("MSG-2")));
+    REQUIRE(f.store.store(3, as_span("MSG-3")));
+
+    SECTION("Bounded range") {
+        f.receive_resend_request(2, 3);
+        REQUIRE(f.sent.size() == 2);
+        REQUIRE(f.sent[0] == "MSG-2");
+        REQUIRE(f.sent[1] == "MSG-3");
+    }
+
+    SECTION("Open-ended range") {
+        f.receive_resend_request(1, 0);
+        REQUIRE(f.sent.size() == 3);
+        REQUIRE(f.sent[2] == "MSG-3");
+    }
+
+    SECTION("Replayed messages are marked as possible duplicates") {
+        REQUIRE(f.store.store(4, as_span(make_stored(msg_type::NewOrderSingle, 4))));
+
+        f.receive_resend_request(4, 4);
+        REQUIRE(f.sent.size() == 1);
+        auto parsed = ParsedMessage::parse(as_span(f.sent[0]));
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->msg_seq_num() == 4);
+        REQUIRE(parsed->get_char(43) == 'Y');
+        REQUIRE(parsed->get_string(122) == "20260101-00:00:00.000");
+    }
+
+    SECTION("Nothing stored falls back to gap fill") {
+        f.receive_resend_request(10, 20);
+        REQUIRE(f.sent.size() == 1);
+        auto parsed = ParsedMessage::parse(as_span(f.sent[0]));
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->msg_type() == msg_type::SequenceReset);
+        REQUIRE(parsed->get_char(123) == 'Y');
+    }
+}
+
+TEST_CASE("SessionManager coalesces admin messages into GapFill on resend", "[session][resend][regression]") {
+    SessionFixture f;
+
+    // 1-2 admin, 3 app, 4 missing, 5 admin, 6 app, 7 admin, 8 Reject
+    REQUIRE(f.store.store(1, as_span(make_stored(msg_type::Heartbeat, 1))));
+    REQUIRE(f.store.store(2, as_span(make_stored(msg_type::TestRequest, 2))));
+    REQUIRE(f.store.store(3, as_span(make_stored(msg_type::NewOrderSingle, 3))));
+    REQUIRE(f.store.store(5, as_span(make_stored(msg_type::Heartbeat, 5))));
+    REQUIRE(f.store.store(6, as_span(make_stored(msg_type::NewOrderSingle, 6))));
+    REQUIRE(f.store.store(7, as_span(make_stored(msg_type::Heartbeat, 7))));
+    REQUIRE(f.store.store(8, as_span(make_stored(msg_type::Reject, 8))));
+
+    auto expect_gap_fill = [&](size_t i, uint32_t seq, uint32_t new_seq) {
+        auto parsed = ParsedMessage::parse(as_span(f.sent[i]));
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->msg_type() == msg_type::SequenceReset);
+        REQUIRE(parsed->msg_seq_num() == seq);
+        REQUIRE(parsed->get_int(36) == new_seq);
+        REQUIRE(parsed->get_char(123) == 'Y');
+        REQUIRE(parsed->get_char(43) == 'Y');
+    };
+    auto expect_replay = [&](size_t i, char type, uint32_t seq) {
+        auto parsed = ParsedMessage::parse(as_span(f.sent[i]));
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->msg_type() == type);
+        REQUIRE(parsed->msg_seq_num() == seq);
+        REQUIRE(parsed->get_char(43) == 'Y');
+    };
+
+    SECTION("Full range") {
+        f.receive_resend_request(1, 8);
+        REQUIRE(f.sent.size() == 6);
+        expect_gap_fill(0, 1, 3);
+        expect_replay(1, msg_type::NewOrderSingle, 3);
+        expect_gap_fill(2, 4, 6);
+        expect_replay(3, msg_type::NewOrderSingle, 6);
+        expect_gap_fill(4, 7, 8);
+        expect_replay(5, msg_type::Reject, 8);
+    }
+
+    SECTION("Trailing admin run") {
+        f.receive_resend_request(5, 7);
+        REQUIRE(f.sent.size() == 3);
+        expect_gap_fill(0, 5, 6);
+        expect_replay(1, msg_type::NewOrderSingle, 6);
+        expect_gap_fill(2, 7, 8);
+    }
+}
+
+TEST_CASE("SessionManager streams long resends in chunks", "[session][resend]") {
+    SessionConfig config;
+    config.resend_chunk_messages = 3;
+    SessionFixture f{config};
+
+    f.session->on_connect();
+    REQUIRE(f.session->initiate_logon().has_value());
+    auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+    f.receive(logon, 1);
+    REQUIRE(f.session->state() == SessionState::Active);
+
+    auto order = fix44::NewOrderSingle::Builder{}
+        .cl_ord_id("ORD001").symbol("AAPL").side(Side::Buy)
+        .transact_time("20260101-00:00:00.000").order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit).price(FixedPrice::from_string("150.25"));
+    for (int i = 0; i < 7; ++i) REQUIRE(f.session->send_new_order(order).has_value());  // 2-8
+    f.sent.clear();
+
+    // Split a coalesced write into its messages' seq nums
+    auto seq_nums = [](std::string_view write) {
+        std::vector<uint32_t> seqs;
+        while (!write.empty()) {
+            const size_t end = write.find("\x01" "10=") + 8;
+            auto parsed = ParsedMessage::parse(as_span(write.substr(0, end)));
+            REQUIRE(parsed.has_value());
+            REQUIRE(parsed->get_char(43) == 'Y');
+            seqs.push_back(parsed->msg_seq_num());
+            write.remove_prefix(end);
+        }
+        return seqs;
+    };
+
+    f.receive_resend_request(1, 0, 2);
+    REQUIRE(f.session->resend_in_progress());
+    REQUIRE(f.session->next_timer_due() == std::chrono::nanoseconds::zero());
+    REQUIRE(f.sent.size() == 1);
+    REQUIRE(seq_nums(f.sent[0]) == std::vector<uint32_t>{1, 2, 3});  // GapFill for the Logon
+
+    // Between chunks the session keeps handling traffic in both directions
+    auto heartbeat = fix44::Heartbeat::Builder{};
+    f.receive(heartbeat, 3);
+    REQUIRE(f.session->sequences().expected_inbound() == 4);
+    REQUIRE(f.session->send_new_order(order).has_value());
+    REQUIRE(f.sent.size() == 2);
+    REQUIRE(ParsedMessage::parse(as_span(f.sent[1]))->msg_seq_num() == 9);
+
+    f.session->on_timer_tick();
+    REQUIRE(f.sent.size() == 3);
+    REQUIRE(seq_nums(f.sent[2]) == std::vector<uint32_t>{4, 5, 6});
+    REQUIRE(f.session->resend_in_progress());
+
+    // The last chunk ends where the request found the session: 9 went out live
+    f.session->on_timer_tick();
+    REQUIRE(f.sent.size() == 4);
+    REQUIRE(seq_nums(f.sent[3]) == std::vector<uint32_t>{7, 8});
+    REQUIRE_FALSE(f.session->resend_in_progress());
+    REQUIRE(f.session->stats().resend_chunks == 3);
+
+    SECTION("A disconnect abandons the stream") {
+        f.receive_resend_request(2, 0, 4);
+        REQUIRE(f.session->resend_in_progress());
+        f.session->on_disconnect();
+        REQUIRE_FALSE(f.session->resend_in_progress());
+    }
+}
+
+TEST_CASE("SessionManager holds messages past a gap until it is filled", "[session][resend][regression]") {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+    SessionManager session{config};
+
+    std::vector<std::string> sent;
+    std::vector<uint32_t> dispatched;
+    SessionCallbacks callbacks;
+    callbacks.on_send = [&](std::span<const char> msg) {
+        sent.emplace_back(msg.data(), msg.size());
+        return true;
+    };
+    callbacks.on_app_message = [&](const IndexedParser& msg, const RxTimestamp&) {
+        dispatched.push_back(msg.msg_seq_num());
+    };
+    session.set_callbacks(std::move(callbacks));
+
+    auto order = [](uint32_t seq, bool poss_dup = false) {
+        return make_message("35=D\x01" "34=" + std::to_string(seq) + "\x01" +
+            (poss_dup ? "43=Y\x01" : "") + "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "11=ORD\x01");
+    };
+    auto expect_resend_request = [&](size_t i, int64_t begin, int64_t end) {
+        auto parsed = ParsedMessage::parse(as_span(sent[i]));
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed->msg_type() == msg_type::ResendRequest);
+        REQUIRE(parsed->get_int(7) == begin);
+        REQUIRE(parsed->get_int(16) == end);
+    };
+
+    session.on_data_received(as_span(order(1)));
+    for (uint32_t seq : {4u, 5u, 6u}) session.on_data_received(as_span(order(seq)));
+
+    SECTION("Only the missing range is requested, once") {
+        REQUIRE(sent.size() == 1);
+        expect_resend_request(0, 2, 3);
+        REQUIRE(dispatched == std::vector<uint32_t>{1});
+        REQUIRE(session.stats().messages_reordered == 3);
+        REQUIRE(session.sequences().expected_inbound() == 2);
+    }
+
+    SECTION("Held messages are released in order once the gap is filled") {
+        session.on_data_received(as_span(order(2, true)));
+        REQUIRE(dispatched == std::vector<uint32_t>{1, 2});
+        session.on_data_received(as_span(order(3, true)));
+        REQUIRE(dispatched == std::vector<uint32_t>{1, 2, 3, 4, 5, 6});
+        REQUIRE(session.sequences().expected_inbound() == 7);
+
+        session.on_data_received(as_span(order(7)));
+        REQUIRE(dispatched.back() == 7);
+        REQUIRE(sent.size() == 1);
+    }
+
+    SECTION("A second gap among held messages requests just that range") {
+        session.on_data_received(as_span(order(9)));
+        REQUIRE(sent.size() == 2);
+        expect_resend_request(1, 7, 8);
+    }
+
+    SECTION("GapFill releases held messages") {
+        const std::string gap_fill = make_message("35=4\x01" "34=2\x01" "43=Y\x01"
+            "49=SERVER\x01" "52=20260101-00:00:00.000\x01" "56=CLIENT\x01"
+            "36=4\x01" "123=Y\x01");
+        session.on_data_received(as_span(gap_fill));
+        REQUIRE(dispatched == std::vector<uint32_t>{1, 4, 5, 6});
+        REQUIRE(session.sequences().expected_inbound() == 7);
+    }
+
+    SECTION("Disconnect drops held messages") {
+        session.on_disconnect();
+        session.on_data_received(as_span(order(2, true)));
+        session.on_data_received(as_span(order(3, true)));
+        REQUIRE(dispatched == std::vector<uint32_t>{1, 2, 3});
+        REQUIRE(session.sequences().expected_inbound() == 4);
+    }
+}
+
+TEST_CASE("SessionManager dispatches past a gap when reordering is off", "[session][resend][regression]") {
+    SessionConfig config;
+    config.reorder_inbound = false;
+    SessionFixture f{config};
+
+    std::vector<uint32_t> dispatched;
+    SessionCallbacks callbacks;
+    callbacks.on_send = [&](std::span<const char> msg) {
+        f.sent.emplace_back(msg.data(), msg.size());
+        return true;
+    };
+    callbacks.on_app_message = [&](const IndexedParser& msg, const RxTimestamp&) {
+        dispatched.push_back(msg.msg_seq_num());
+    };
+    f.session->set_callbacks(std::move(callbacks));
+
+    for (uint32_t seq : {3u, 4u}) {
+        auto builder = fix44::NewOrderSingle::Builder{}
+            .cl_ord_id("ORD").symbol("AAPL").side(Side::Buy)
+            .order_qty(Qty::from_int(100)).ord_type(OrdType::Market)
+            .transact_time("20260101-00:00:00.000");
+        f.receive(builder, seq);
+    }
+    REQUIRE(dispatched == std::vector<uint32_t>{3, 4});
+    REQUIRE(f.sent.size() == 1);  // The gap is still requested once
+}
+
+TEST_CASE("SessionManager stores outbound messages under their seq num", "[session][store][regression]") {
+    SessionFixture f;
+
+    auto builder = fix44::TestRequest::Builder{}.test_req_id("PING");
+    f.receive(builder, 1);  // Triggers a Heartbeat response with seq 1
+
+    REQUIRE(f.sent.size() == 1);
+    auto stored = f.store.retrieve(1);
+    REQUIRE(stored.has_value());
+    REQUIRE(std::string_view{stored->data(), stored->size()} == f.sent[0]);
+    REQUIRE_FALSE(f.store.contains(2));
+}
+
+TEST_CASE("SessionManager stamps SendingTime at the configured precision", "[session][timestamp]") {
+    auto sending_time = [](TimestampPrecision precision) {
+        SessionConfig config;
+        config.sender_comp_id = "CLIENT";
+        config.target_comp_id = "SERVER";
+        config.sending_time_precision = precision;
+        SessionManager session{config};
+
+        std::string sent;
+        SessionCallbacks callbacks;
+        callbacks.on_send = [&sent](std::span<const char> msg) {
+            sent.assign(msg.data(), msg.size());
+            return true;
+        };
+        session.set_callbacks(std::move(callbacks));
+
+        std::string ping = make_message("35=1\x01" "34=1\x01" "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "112=PING\x01");
+        session.on_data_received(as_span(ping));
+
+        const size_t start = sent.find("\x01" "52=") + 4;
+        return sent.substr(start, sent.find('\x01', start) - start);
+    };
+
+    const auto now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    for (auto [precision, length] : {std::pair{TimestampPrecision::Milliseconds, 21uz},
+                                     std::pair{TimestampPrecision::Microseconds, 24uz},
+                                     std::pair{TimestampPrecision::Nanoseconds, 27uz}}) {
+        const std::string text = sending_time(precision);
+        INFO("SendingTime: " << text);
+        REQUIRE(text.size() == length);
+        const auto ts = Timestamp::from_utc_string(text);
+        REQUIRE(ts.has_value());
+        REQUIRE(ts->nanos > now_ns - 60'000'000'000LL);
+        REQUIRE(ts->nanos < now_ns + 60'000'000'000LL);
+    }
+}
+
+TEST_CASE("SessionManager forwards receive timestamps to on_app_message", "[session][timestamp]") {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+    SessionManager session{config};
+
+    std::vector<RxTimestamp> seen;
+    SessionCallbacks callbacks;
+    callbacks.on_send = [](std::span<const char>) { return true; };
+    callbacks.on_app_message = [&seen](const IndexedParser&, const RxTimestamp& ts) {
+        seen.push_back(ts);
+    };
+    session.set_callbacks(std::move(callbacks));
+
+    std::string order = make_message("35=D\x01" "34=1\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "11=ORD1\x01");
+    session.on_data_received(as_span(order), RxTimestamp{1'234'567'890, RxTimestampSource::Hardware});
+
+    REQUIRE(seen.size() == 1);
+    REQUIRE(seen[0].ns == 1'234'567'890);
+    REQUIRE(seen[0].source == RxTimestampSource::Hardware);
+    REQUIRE(session.last_rx_timestamp().valid());
+
+    SECTION("Single-argument handlers still bind") {
+        int calls = 0;
+        SessionCallbacks legacy;
+        legacy.on_app_message = [&calls](const IndexedParser&) { ++calls; };
+        session.set_callbacks(std::move(legacy));
+
+        std::string next = make_message("35=D\x01" "34=2\x01" "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "11=ORD2\x01");
+        session.on_data_received(as_span(next));
+        REQUIRE(calls == 1);
+        REQUIRE_FALSE(session.last_rx_timestamp().valid());
+    }
+
+    SECTION("Empty std::function leaves the callback unset") {
+        AppMessageCallback cb{std::function<void(const IndexedParser&)>{}};
+        REQUIRE_FALSE(static_cast<bool>(cb));
+    }
+}
+
+TEST_CASE("SessionManager hands its parsed message to on_app_message", "[session][parser]") {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+    SessionManager session{config};
+
+    std::vector<const IndexedParser*> handles;
+    std::vector<std::string> cl_ord_ids;
+    SessionCallbacks callbacks;
+    callbacks.on_send = [](std::span<const char>) { return true; };
+    callbacks.on_app_message = [&](const IndexedParser& msg, const RxTimestamp&) {
+        handles.push_back(&msg);
+        cl_ord_ids.emplace_back(msg.get_string(11));
+        REQUIRE(msg.sender_comp_id() == "SERVER");
+    };
+    session.set_callbacks(std::move(callbacks));
+
+    const std::string first = make_message("35=D\x01" "34=1\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "11=ORD1\x01" "55=AAPL\x01");
+    const std::string second = make_message("35=F\x01" "34=2\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "11=ORD2\x01");
+    session.on_data_received(as_span(first));
+    session.on_data_received(as_span(second));
+
+    REQUIRE(cl_ord_ids == std::vector<std::string>{"ORD1", "ORD2"});
+    // One parser per session, reused: nothing is re-scanned for the callback
+    REQUIRE(handles.size() == 2);
+    REQUIRE(handles[0] == handles[1]);
+    REQUIRE(session.sequences().expected_inbound() == 3);
+}
+
+namespace {
+
+/// QuickFIX-style application: echoes orders as ExecutionReports
+struct EchoApplication : qf::Application {
+    std::vector<std::string> events;
+    std::vector<qf::Message> kept;
+    bool reject_logon{false};
+
+    void onCreate(const qf::SessionID& id) override { events.push_back("create " + id.toString()); }
+    void onLogon(const qf::SessionID&) override { events.push_back("logon"); }
+    void onLogout(const qf::SessionID&) override { events.push_back("logout"); }
+    void toAdmin(qf::Message&, const qf::SessionID&) override {}
+
+    void toApp(qf::Message& msg, const qf::SessionID&) override {
+        if (msg.isSetField(qf::Text::TAG)) throw qf::DoNotSend{};
+    }
+
+    void fromAdmin(const qf::Message& msg, const qf::SessionID&) override {
+        events.push_back("admin " + std::string{msg.msg_type()});
+        if (reject_logon && msg.msg_type() == "A") throw qf::RejectLogon{"not today"};
+    }
+
+    void fromApp(const qf::Message& msg, const qf::SessionID& id) override {
+        if (msg.msg_type() != "D") throw qf::UnsupportedMessageType{};
+        qf::ClOrdID cl_ord_id;
+        qf::OrderQty qty;
+        msg.getField(cl_ord_id);
+        msg.getField(qty);
+        if (qty.getValue() <= 0) throw qf::IncorrectTagValue{qf::OrderQty::TAG};
+        kept.push_back(msg);
+
+        qf::Message report;
+        report.getHeader().setField(qf::MsgType("8"));
+        report.setField(cl_ord_id);
+        report.setField(qf::ExecType(qf::ExecType_NEW));
+        report.setField(qf::LeavesQty(qty));
+        REQUIRE(qf::Session::sendToTarget(report, id));
+    }
+};
+
+} // namespace
+
+TEST_CASE("QuickFIX adapter runs an Application on SessionManager", "[session][quickfix]") {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+    SessionManager session{config};
+    EchoApplication app;
+    std::vector<std::string> sent;
+    qf::Session adapter{session, app, {
+        .on_app_message = {},
+        .on_state_change = {},
+        .on_send = [&](std::span<const char> msg) {
+            sent.emplace_back(msg.data(), msg.size());
+            return true;
+        },
+        .on_error = {},
+        .on_logon = {},
+        .on_logout = {},
+        .on_shadow_send = {},
+        .on_audit = {}}};
+    REQUIRE(app.events == std::vector<std::string>{"create FIX.4.4:CLIENT->SERVER"});
+    REQUIRE(qf::Session::lookupSession(adapter.getSessionID()) == &adapter);
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    session.on_data_received(as_span(make_message("35=A\x01" "34=1\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "98=0\x01" "108=30\x01")));
+    REQUIRE(adapter.isLoggedOn());
+    REQUIRE(app.events == std::vector<std::string>{
+        "create FIX.4.4:CLIENT->SERVER", "admin A", "logon"});
+
+    SECTION("fromApp sees a lazy view and replies through sendToTarget") {
+        const std::string order = make_message("35=D\x01" "34=2\x01" "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "11=ORD1\x01" "55=AAPL\x01"
+            "54=1\x01" "38=100\x01");
+        session.on_data_received(as_span(order));
+        REQUIRE(sent.size() == 2);  // Logon + ExecutionReport
+
+        auto report = IndexedParser::parse(as_span(sent[1]));
+        REQUIRE(report.has_value());
+        REQUIRE(report->msg_type() == '8');
+        REQUIRE(report->msg_seq_num() == 2);
+        REQUIRE(report->get_string(11) == "ORD1");
+        REQUIRE(report->get_string(151) == "100");
+
+        // A copy outlives the callback and round-trips unchanged
+        REQUIRE(app.kept.size() == 1);
+        const qf::Message& kept = app.kept[0];
+        REQUIRE(kept.native() != nullptr);
+        REQUIRE(kept.toString() == order);
+        qf::Symbol symbol;
+        REQUIRE(kept.getField(symbol).getValue() == "AAPL");
+        REQUIRE(kept.getHeader().getField(49) == "SERVER");
+        REQUIRE_FALSE(kept.isSetField(49));  // Header tags are not body fields
+        REQUIRE_THROWS_AS(kept.getField(44), qf::FieldNotFound);
+
+        qf::Message modified{kept};
+        modified.setField(qf::Symbol("MSFT"));
+        modified.removeField(qf::Side::TAG);
+        auto reparsed = IndexedParser::parse(as_span(modified.toString()));
+        REQUIRE(reparsed.has_value());
+        REQUIRE(reparsed->get_string(55) == "MSFT");
+        REQUIRE_FALSE(reparsed->has_field(54));
+        REQUIRE(reparsed->get_string(11) == "ORD1");
+    }
+
+    SECTION("Exceptions from fromApp become rejects") {
+        session.on_data_received(as_span(make_message("35=D\x01" "34=2\x01" "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "55=AAPL\x01" "38=100\x01")));
+        session.on_data_received(as_span(make_message("35=D\x01" "34=3\x01" "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "11=ORD2\x01" "38=0\x01")));
+        session.on_data_received(as_span(make_message("35=AE\x01" "34=4\x01" "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01")));
+        REQUIRE(adapter.rejected() == 3);
+        REQUIRE(sent.size() == 4);
+
+        auto missing = IndexedParser::parse(as_span(sent[1]));
+        REQUIRE(missing->msg_type() == '3');
+        REQUIRE(missing->get_string(45) == "2");
+        REQUIRE(missing->get_string(371) == "11");
+        REQUIRE(missing->get_string(373) == "1");
+        auto incorrect = IndexedParser::parse(as_span(sent[2]));
+        REQUIRE(incorrect->get_string(371) == "38");
+        REQUIRE(incorrect->get_string(373) == "5");
+        auto unsupported = IndexedParser::parse(as_span(sent[3]));
+        REQUIRE(unsupported->msg_type() == 'j');
+        REQUIRE(unsupported->get_string(372) == "AE");
+        REQUIRE(unsupported->get_string(380) == "3");
+    }
+
+    SECTION("toApp can veto a send") {
+        qf::Message msg;
+        msg.getHeader().setField(qf::MsgType("B"));
+        msg.setField(qf::Text("dropped"));
+        REQUIRE_FALSE(adapter.send(msg));
+        REQUIRE(sent.size() == 1);
+    }
+
+    SECTION("Groups read from the wire and written by addGroup") {
+        const qf::Message snapshot{make_message("35=W\x01" "34=2\x01" "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "55=AAPL\x01" "268=2\x01"
+            "269=0\x01" "270=150.25\x01" "271=100\x01" "269=1\x01" "270=150.5\x01"
+            "271=200\x01" "58=end\x01")};
+        REQUIRE(snapshot.groupCount(qf::NoMDEntries::TAG) == 2);
+        qf::Group entry{qf::NoMDEntries::TAG, qf::MDEntryType::TAG,
+                        {qf::MDEntryType::TAG, qf::MDEntryPx::TAG, qf::MDEntrySize::TAG}};
+        snapshot.getGroup(2, entry);
+        qf::MDEntryPx px;
+        REQUIRE(entry.getField(px).getValue() == 150.5);
+        REQUIRE_FALSE(entry.isSetField(58));  // Bounded by the group's tags
+        REQUIRE_THROWS_AS(snapshot.getGroup(3, entry), qf::FieldNotFound);
+
+        qf::Message request;
+        request.getHeader().setField(qf::MsgType("V"));
+        qf::Group type{qf::NoMDEntries::TAG, qf::MDEntryType::TAG};
+        type.setField(qf::MDEntryType('0'));
+        request.addGroup(type);
+        type.setField(qf::MDEntryType('1'));
+        request.addGroup(type);
+        REQUIRE(adapter.send(request));
+        REQUIRE(std::string_view{sent.back()}.find("268=2\x01" "269=0\x01" "269=1\x01") !=
+                std::string_view::npos);
+    }
+}
+
+TEST_CASE("QuickFIX adapter turns RejectLogon into a logout", "[session][quickfix]") {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+    SessionManager session{config};
+    EchoApplication app;
+    app.reject_logon = true;
+    std::vector<std::string> sent;
+    qf::Session adapter{session, app, {
+        .on_app_message = {},
+        .on_state_change = {},
+        .on_send = [&](std::span<const char> msg) {
+            sent.emplace_back(msg.data(), msg.size());
+            return true;
+        },
+        .on_error = {},
+        .on_logon = {},
+        .on_logout = {},
+        .on_shadow_send = {},
+        .on_audit = {}}};
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    session.on_data_received(as_span(make_message("35=A\x01" "34=1\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "98=0\x01" "108=30\x01")));
+    REQUIRE(std::find(app.events.begin(), app.events.end(), "logon") == app.events.end());
+    REQUIRE(sent.size() == 2);
+    auto logout = IndexedParser::parse(as_span(sent[1]));
+    REQUIRE(logout->msg_type() == '5');
+    REQUIRE(logout->get_string(58) == "not today");
+}
+
+TEST_CASE("SessionManager on_bytes frames a byte stream", "[session][stream]") {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+
+    auto order = [](uint32_t seq) {
+        return make_message("35=D\x01" "34=" + std::to_string(seq) + "\x01" "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "11=ORD" + std::to_string(seq) +
+            "\x01");
+    };
+    const std::string stream = order(1) + order(2) + order(3);
+
+    struct Capture {
+        std::vector<std::string> ids;
+        std::vector<const char*> starts;
+        int errors{0};
+    };
+    auto make_session = [&config](Capture& c) {
+        auto session = std::make_unique<SessionManager>(config);
+        SessionCallbacks callbacks;
+        callbacks.on_send = [](std::span<const char>) { return true; };
+        callbacks.on_app_message = [&c](const IndexedParser& msg, const RxTimestamp&) {
+            c.ids.emplace_back(msg.get_string(11));
+            c.starts.push_back(msg.raw().data());
+        };
+        callbacks.on_error = [&c](const SessionError&) { ++c.errors; };
+        session->set_callbacks(std::move(callbacks));
+        return session;
+    };
+    const std::vector<std::string> expected{"ORD1", "ORD2", "ORD3"};
+
+    SECTION("Whole messages are dispatched in place") {
+        Capture c;
+        auto session = make_session(c);
+        session->on_bytes(as_span(stream));
+        REQUIRE(c.ids == expected);
+        REQUIRE(c.starts[0] == stream.data());
+        REQUIRE(c.starts[2] == stream.data() + 2 * order(1).size());
+        REQUIRE(session->pending_bytes() == 0);
+        REQUIRE(session->stats().messages_reassembled == 0);
+    }
+
+    SECTION("Every split point and chunk size reassembles once") {
+        for (size_t chunk = 1; chunk <= stream.size(); chunk += (chunk < 24 ? 1 : 17)) {
+            Capture c;
+            auto session = make_session(c);
+            for (size_t pos = 0; pos < stream.size(); pos += chunk) {
+                session->on_bytes(as_span(std::string_view{stream}.substr(pos, chunk)));
+            }
+            INFO("chunk " << chunk);
+            REQUIRE(c.ids == expected);
+            REQUIRE(c.errors == 0);
+            REQUIRE(session->pending_bytes() == 0);
+            REQUIRE(session->stats().bytes_discarded == 0);
+        }
+    }
+
+    SECTION("Garbage between messages is skipped") {
+        Capture c;
+        auto session = make_session(c);
+        const std::string noisy = "xx\x01junk\x01" + order(1) + "8=\x01" + order(2);
+        session->on_bytes(as_span(std::string_view{noisy}.substr(0, 20)));
+        session->on_bytes(as_span(std::string_view{noisy}.substr(20)));
+        REQUIRE(c.ids == std::vector<std::string>{"ORD1", "ORD2"});
+        REQUIRE(session->stats().bytes_discarded == 11);
+    }
+
+    SECTION("A broken BodyLength drops the fragment and resyncs") {
+        Capture c;
+        auto session = make_session(c);
+        session->on_bytes(as_span("8=FIX.4.4\x01" "9=X"));
+        session->on_bytes(as_span("X\x01" + order(1)));
+        REQUIRE(c.ids == std::vector<std::string>{"ORD1"});
+        REQUIRE(c.errors == 1);
+        REQUIRE(session->pending_bytes() == 0);
+    }
+
+    SECTION("Disconnect forgets a pending fragment") {
+        Capture c;
+        auto session = make_session(c);
+        session->on_bytes(as_span(std::string_view{stream}.substr(0, 30)));
+        REQUIRE(session->pending_bytes() == 30);
+        session->on_disconnect();
+        REQUIRE(session->pending_bytes() == 0);
+    }
+}
+
+/// Concept handler recording every event (no std::function)
+struct RecordingHandler {
+    std::vector<std::string> sent;
+    std::vector<std::string> orders;
+    std::vector<std::pair<SessionState, SessionState>> transitions;
+    int logons{0};
+    int errors{0};
+
+    void on_app_message(const IndexedParser& msg) noexcept {
+        orders.emplace_back(msg.get_string(11));
+    }
+    void on_state_change(SessionState from, SessionState to) noexcept {
+        transitions.emplace_back(from, to);
+    }
+    bool on_send(std::span<const char> data) noexcept {
+        sent.emplace_back(data.data(), data.size());
+        return true;
+    }
+    void on_error(const SessionError&) noexcept { ++errors; }
+    void on_logon() noexcept { ++logons; }
+    void on_logout(std::string_view) noexcept {}
+};
+
+TEST_CASE("BasicSessionManager dispatches to a concept handler", "[session][handler]") {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+
+    auto drive = [](auto& session) {
+        session.on_connect();
+        REQUIRE(session.initiate_logon().has_value());
+        session.on_data_received(as_span(make_message("35=A\x01" "34=1\x01" "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "98=0\x01" "108=30\x01")));
+        session.on_data_received(as_span(make_message("35=D\x01" "34=2\x01" "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "11=ORD1\x01")));
+        REQUIRE(session.state() == SessionState::Active);
+    };
+
+    SECTION("Owned handler") {
+        BasicSessionManager<RecordingHandler> session{config};
+        drive(session);
+        const RecordingHandler& h = session.handler();
+        REQUIRE(h.sent.size() == 1);
+        REQUIRE(h.sent[0].find("35=A\x01") != std::string::npos);
+        REQUIRE(h.orders == std::vector<std::string>{"ORD1"});
+        REQUIRE(h.logons == 1);
+        REQUIRE(h.errors == 0);
+        REQUIRE(h.transitions.front().first == SessionState::Disconnected);
+        REQUIRE(h.transitions.back().second == SessionState::Active);
+    }
+
+    SECTION("Borrowed handler") {
+        RecordingHandler handler;
+        BasicSessionManager<RecordingHandler&> session{config, handler};
+        drive(session);
+        REQUIRE(&session.handler() == &handler);
+        REQUIRE(handler.orders.size() == 1);
+        REQUIRE(handler.logons == 1);
+    }
+
+    SECTION("Unset std::function sender fails before storing") {
+        store::MemoryMessageStore store{"CLIENT-SERVER"};
+        SessionManager session{config};
+        session.set_message_store(&store);
+        session.on_connect();
+        REQUIRE_FALSE(session.initiate_logon().has_value());
+        REQUIRE(store.message_count() == 0);
+    }
+}
+
+TEST_CASE("BasicSessionManager runs FIXT 1.1 sessions through a version policy", "[session][handler]") {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+
+    BasicSessionManager<RecordingHandler, Fix50Sp2Session> session{config};
+    const RecordingHandler& h = session.handler();
+    REQUIRE(session.begin_string() == "FIXT.1.1");
+    REQUIRE(session.session_id().begin_string == "FIXT.1.1");
+
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    REQUIRE(h.sent.size() == 1);
+    auto logon = IndexedParser::parse(as_span(h.sent[0]));
+    REQUIRE(logon.has_value());
+    REQUIRE(logon->begin_string() == "FIXT.1.1");
+    REQUIRE(logon->msg_type() == msg_type::Logon);
+    REQUIRE(logon->get_char(tag::DefaultApplVerID::value) == appl_ver_id::FIX_5_0_SP2);
+
+    // Counterparty defaults to FIX 5.0 SP1
+    session.on_data_received(as_span(make_message("35=A\x01" "34=1\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "98=0\x01" "108=30\x01" "1137=8\x01",
+        "FIXT.1.1")));
+    REQUIRE(session.state() == SessionState::Active);
+    REQUIRE(session.peer_appl_ver_id() == appl_ver_id::FIX_5_0_SP1);
+
+    session.on_data_received(as_span(make_message("35=8\x01" "34=2\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "11=ORD1\x01", "FIXT.1.1")));
+    REQUIRE(session.inbound_appl_ver_id() == appl_ver_id::FIX_5_0_SP1);
+
+    // Per-message ApplVerID overrides the default
+    session.on_data_received(as_span(make_message("35=8\x01" "34=3\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "1128=7\x01" "11=ORD2\x01",
+        "FIXT.1.1")));
+    REQUIRE(session.inbound_appl_ver_id() == appl_ver_id::FIX_5_0);
+    REQUIRE(h.orders == std::vector<std::string>{"ORD1", "ORD2"});
+
+    // Admin replies use the FIXT admin messages
+    session.on_data_received(as_span(make_message("35=1\x01" "34=4\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "112=PING\x01", "FIXT.1.1")));
+    REQUIRE(h.sent.size() == 2);
+    auto heartbeat = IndexedParser::parse(as_span(h.sent[1]));
+    REQUIRE(heartbeat.has_value());
+    REQUIRE(heartbeat->begin_string() == "FIXT.1.1");
+    REQUIRE(heartbeat->msg_type() == msg_type::Heartbeat);
+    REQUIRE(heartbeat->get_string(tag::TestReqID::value) == "PING");
+
+    // Orders go out under the FIXT BeginString
+    auto order = fix44::NewOrderSingle::Builder{}
+        .cl_ord_id("OUT1")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time("20260101-00:00:00.000")
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Market);
+    REQUIRE(session.send_new_order(order).has_value());
+    REQUIRE(h.sent.size() == 3);
+    REQUIRE(h.sent[2].starts_with("8=FIXT.1.1\x01"));
+
+    SECTION("FIX 4.4 sessions report a constant application version") {
+        BasicSessionManager<RecordingHandler> fix44_session{config};
+        REQUIRE(fix44_session.begin_string() == "FIX.4.4");
+        REQUIRE(fix44_session.inbound_appl_ver_id() == appl_ver_id::FIX_4_4);
+    }
+}
+
+struct AuditingHandler : RecordingHandler {
+    AuditTap<64, 2, 8>* tap{nullptr};
+    uint16_t buffer{0};   // Receive buffer the session is reading
+
+    void on_audit(AuditDirection dir, uint32_t seq, std::span<const char> msg) noexcept {
+        (void)tap->record(dir, buffer, seq, msg);
+    }
+};
+
+TEST_CASE("AuditTap publishes message locations and pins receive buffers", "[session][audit]") {
+    AuditTap<64, 2, 8> tap;
+    auto consumer = tap.subscribe();
+    REQUIRE(consumer.has_value());
+
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+    store::MemoryMessageStore store{"CLIENT-SERVER"};
+    BasicSessionManager<AuditingHandler> session{config};
+    session.handler().tap = &tap;
+    session.set_message_store(&store);
+
+    // Receive buffer 3 holds the counterparty's Logon and an order
+    const std::string rx = make_message("35=A\x01" "34=1\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "98=0\x01" "108=30\x01") +
+        make_message("35=D\x01" "34=2\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "11=ORD1\x01");
+    session.on_connect();
+    REQUIRE(session.initiate_logon().has_value());
+    session.handler().buffer = 3;
+    session.on_bytes(as_span(rx));
+    REQUIRE(session.state() == SessionState::Active);
+    REQUIRE(tap.published() == 3);
+
+    // Consumers still read buffer 3: it stays pinned
+    REQUIRE_FALSE(tap.done_with(3));
+    REQUIRE(tap.pinned_buffers() == 1);
+    std::vector<uint16_t> freed;
+    REQUIRE(tap.reclaim([&](uint16_t id) { freed.push_back(id); }) == 0);
+
+    std::vector<AuditRecord> records;
+    REQUIRE(tap.poll(*consumer, [&](const AuditRecord& r) { records.push_back(r); }) == 3);
+    REQUIRE(records[0].direction == AuditDirection::Outbound);
+    REQUIRE(records[0].seq_num == 1);
+    REQUIRE(records[0].bytes().empty());
+    auto stored = store.retrieve(records[0].seq_num);
+    REQUIRE(stored.has_value());
+    REQUIRE(stored->size() == records[0].length);
+
+    REQUIRE(records[1].direction == AuditDirection::Inbound);
+    REQUIRE(records[1].buffer == 3);
+    REQUIRE(records[1].bytes().data() == rx.data());   // In place, not copied
+    REQUIRE(records[2].seq_num == 2);
+    REQUIRE(records[2].bytes().data() + records[2].length == rx.data() + rx.size());
+    REQUIRE(records[1].tsc <= records[2].tsc);
+
+    REQUIRE(tap.reclaim([&](uint16_t id) { freed.push_back(id); }) == 1);
+    REQUIRE(freed == std::vector<uint16_t>{3});
+    REQUIRE(tap.pinned_buffers() == 0);
+
+    SECTION("Without lagging consumers a buffer is free at once") {
+        session.handler().buffer = 5;
+        session.on_data_received(as_span(make_message("35=0\x01" "34=3\x01" "49=SERVER\x01"
+            "52=20260101-00:00:00.000\x01" "56=CLIENT\x01")));
+        tap.unsubscribe(*consumer);
+        REQUIRE(tap.done_with(5));
+    }
+
+    SECTION("A full ring drops records instead of blocking the session") {
+        AuditTap<64, 2, 8> small;
+        REQUIRE(small.subscribe().has_value());
+        const std::string msg = "MSG";
+        for (uint32_t i = 0; i < 64; ++i) {
+            REQUIRE(small.record_outbound(i + 1, as_span(msg)));
+        }
+        REQUIRE_FALSE(small.record_outbound(65, as_span(msg)));
+        REQUIRE(small.dropped() == 1);
+        REQUIRE(small.detach_slow(64) == 1);
+        REQUIRE(small.record_outbound(65, as_span(msg)));
+    }
+}
+
+struct RoutedHandler : RecordingHandler {
+    std::vector<std::string> routed;
+    int64_t last_rx_ns{0};
+
+    void on_execution_report(const IndexedParser& msg) noexcept {
+        routed.emplace_back("8:" + std::string{msg.get_string(17)});
+    }
+    void on_md_incremental(const IndexedParser&, const RxTimestamp& rx) noexcept {
+        routed.emplace_back("X");
+        last_rx_ns = rx.ns;
+    }
+    void on_trade_capture_report(const IndexedParser& msg) noexcept {
+        routed.emplace_back("AE:" + std::string{msg.get_string(571)});
+    }
+
+    using msg_routes = MsgRoutes<
+        MsgRoute<msg_type::ExecutionReport, &RoutedHandler::on_execution_report>,
+        MsgRoute<msg_type::MarketDataIncrementalRefresh, &RoutedHandler::on_md_incremental>,
+        MsgRoute<"AE", &RoutedHandler::on_trade_capture_report>>;
+};
+
+TEST_CASE("MsgDispatchTable routes MsgTypes to typed handlers", "[session][handler]") {
+    using Table = HandlerDispatchTable<RoutedHandler>;
+    static_assert(Table::find("8") != nullptr);
+    static_assert(Table::find("AE") != nullptr);
+    static_assert(Table::find("A") == nullptr);
+    static_assert(Table::find("AD") == nullptr);
+    static_assert(Table::find("D") == nullptr);
+    static_assert(Table::find("") == nullptr);
+
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+    BasicSessionManager<RoutedHandler> session{config};
+
+    auto app = [](std::string_view type, uint32_t seq, std::string_view body) {
+        return make_message("35=" + std::string{type} + "\x01" "34=" + std::to_string(seq) +
+            "\x01" "49=SERVER\x01" "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" +
+            std::string{body});
+    };
+    session.on_data_received(as_span(app("8", 1, "17=EXEC1\x01")));
+    session.on_data_received(as_span(app("X", 2, "262=MD\x01")),
+                             RxTimestamp{42, RxTimestampSource::Software});
+    session.on_data_received(as_span(app("AE", 3, "571=TRADE1\x01")));
+    session.on_data_received(as_span(app("D", 4, "11=ORD1\x01")));
+    session.on_data_received(as_span(app("AD", 5, "11=ORD2\x01")));
+
+    const RoutedHandler& h = session.handler();
+    REQUIRE(h.routed == std::vector<std::string>{"8:EXEC1", "X", "AE:TRADE1"});
+    REQUIRE(h.last_rx_ns == 42);
+    // Unrouted types, including a two-char type sharing 'A' with Logon, reach
+    // on_app_message
+    REQUIRE(h.orders == std::vector<std::string>{"ORD1", "ORD2"});
+    REQUIRE(h.logons == 0);
+    REQUIRE(session.sequences().expected_inbound() == 6);
+}
+
+struct ScratchHandler : RecordingHandler {
+    using RecordingHandler::on_app_message;
+    std::vector<const void*> blocks;
+
+    void on_app_message(const IndexedParser& msg, const RxTimestamp&,
+                        std::pmr::memory_resource& scratch) noexcept {
+        std::pmr::vector<int> decoded{&scratch};
+        decoded.reserve(16);
+        blocks.push_back(decoded.data());
+        orders.emplace_back(msg.get_string(11));
+    }
+    void on_execution_report(const IndexedParser&, const RxTimestamp&,
+                             std::pmr::memory_resource& scratch) noexcept {
+        std::pmr::string text{"exec report decoded into scratch", &scratch};
+        blocks.push_back(text.data());
+    }
+
+    using msg_routes = MsgRoutes<
+        MsgRoute<msg_type::ExecutionReport, &ScratchHandler::on_execution_report>>;
+};
+
+TEST_CASE("Application callbacks get a per-message scratch resource", "[session][handler]") {
+    static_assert(HandlerDispatchTable<ScratchHandler>::WANTS_SCRATCH);
+    static_assert(!HandlerDispatchTable<RoutedHandler>::WANTS_SCRATCH);
+
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+    BasicSessionManager<ScratchHandler> session{config};
+
+    auto app = [](std::string_view type, uint32_t seq, std::string_view body) {
+        return make_message("35=" + std::string{type} + "\x01" "34=" + std::to_string(seq) +
+            "\x01" "49=SERVER\x01" "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" +
+            std::string{body});
+    };
+    session.on_data_received(as_span(app("D", 1, "11=ORD1\x01")));
+    session.on_data_received(as_span(app("D", 2, "11=ORD2\x01")));
+    session.on_data_received(as_span(app("8", 3, "17=EXEC1\x01")));
+
+    const ScratchHandler& h = session.handler();
+    REQUIRE(h.orders == std::vector<std::string>{"ORD1", "ORD2"});
+    REQUIRE(h.blocks.size() == 3);
+    // Reset after each callback: every message reuses the same bytes
+    REQUIRE(h.blocks[0] == h.blocks[1]);
+    REQUIRE(h.blocks[2] == h.blocks[0]);
+
+    REQUIRE(session.compact() >= BasicSessionManager<ScratchHandler>::MESSAGE_SCRATCH_SIZE);
+    session.on_data_received(as_span(app("D", 4, "11=ORD3\x01")));
+    REQUIRE(h.orders.size() == 3);
+}
+
+TEST_CASE("SessionManager coalesces batched sends into one write", "[session][batch]") {
+    SessionFixture f;
+    auto builder = fix44::TestRequest::Builder{}.test_req_id("PING");
+
+    f.session->begin_batch();
+    REQUIRE(f.session->in_batch());
+    for (uint32_t seq = 1; seq <= 3; ++seq) {
+        f.receive(builder, seq);  // Each triggers a Heartbeat response
+    }
+
+    REQUIRE(f.sent.empty());
+    REQUIRE(f.session->batched_messages() == 3);
+
+    // Every message already has its own seq num and store entry
+    std::string expected;
+    for (uint32_t seq = 1; seq <= 3; ++seq) {
+        auto stored = f.store.retrieve(seq);
+        REQUIRE(stored.has_value());
+        expected.append(stored->data(), stored->size());
+    }
+
+    REQUIRE(f.session->flush());
+    REQUIRE_FALSE(f.session->in_batch());
+    REQUIRE(f.sent.size() == 1);
+    REQUIRE(f.sent[0] == expected);
+    REQUIRE(f.session->stats().messages_sent == 3);
+    REQUIRE(f.session->stats().batches_flushed == 1);
+
+    SECTION("Sends after flush go out immediately") {
+        f.receive(builder, 4);
+        REQUIRE(f.sent.size() == 2);
+        REQUIRE(f.session->batched_bytes() == 0);
+    }
+
+    SECTION("Timer tick flushes an open batch") {
+        f.session->begin_batch();
+        f.receive(builder, 4);
+        REQUIRE(f.sent.size() == 1);
+        f.session->on_timer_tick();
+        REQUIRE(f.sent.size() == 2);
+        REQUIRE_FALSE(f.session->in_batch());
+    }
+}
+
+TEST_CASE("SessionManager send_new_order matches the generic builder", "[session][template]") {
+    SessionFixture f;
+    f.session->on_connect();
+    REQUIRE(f.session->initiate_logon().has_value());
+    auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+    f.receive(logon, 1);
+    REQUIRE(f.session->state() == SessionState::Active);
+
+    auto order = fix44::NewOrderSingle::Builder{}
+        .cl_ord_id("ORD001")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time("20260101-00:00:00.000")
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit)
+        .price(FixedPrice::from_string("150.25"))
+        .account("ACC1");
+
+    REQUIRE(f.session->send_new_order(order).has_value());
+    REQUIRE(f.sent.size() == 2);  // Logon + order
+    REQUIRE(body_length_matches(f.sent[1]));
+
+    auto parsed = fix44::NewOrderSingle::from_buffer(as_span(f.sent[1]));
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->header.msg_seq_num == 2);
+    REQUIRE(parsed->cl_ord_id == "ORD001");
+
+    // Same bytes as the generic path with the same header values
+    auto sending_time = parsed->header.sending_time;
+    auto generic = order
+        .sender_comp_id("CLIENT")
+        .target_comp_id("SERVER")
+        .msg_seq_num(2)
+        .sending_time(sending_time)
+        .build(f.assembler);
+    REQUIRE(f.sent[1] == std::string_view{generic.data(), generic.size()});
+
+    auto stored = f.store.retrieve(2);
+    REQUIRE(stored.has_value());
+    REQUIRE(std::string_view{stored->data(), stored->size()} == f.sent[1]);
+}
+
+TEST_CASE("SessionManager sends cancels, replaces and status requests from templates", "[session][template]") {
+    SessionFixture f;
+    f.session->on_connect();
+    REQUIRE(f.session->initiate_logon().has_value());
+    auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+    f.receive(logon, 1);
+    REQUIRE(f.session->state() == SessionState::Active);
+
+    auto cancel = fix44::OrderCancelRequest::Builder{}
+        .orig_cl_ord_id("ORD001").cl_ord_id("CXL001").symbol("AAPL")
+        .side(Side::Buy).transact_time("20260101-00:00:00.000");
+    auto replace = fix44::OrderCancelReplaceRequest::Builder{}
+        .orig_cl_ord_id("ORD002").cl_ord_id("RPL001").symbol("AAPL")
+        .side(Side::Sell).transact_time("20260101-00:00:00.000")
+        .order_qty(Qty::from_int(50)).ord_type(OrdType::Limit)
+        .price(FixedPrice::from_string("151.5"));
+    auto status = fix44::OrderStatusRequest::Builder{}
+        .cl_ord_id("ORD003").symbol("AAPL").side(Side::Buy).order_id("EX9");
+
+    REQUIRE(f.session->send_cancel(cancel).has_value());
+    REQUIRE(f.session->send_replace(replace).has_value());
+    REQUIRE(f.session->send_status_request(status).has_value());
+    REQUIRE(f.sent.size() == 4);
+    for (size_t i = 1; i < f.sent.size(); ++i) REQUIRE(body_length_matches(f.sent[i]));
+
+    auto parsed_cancel = fix44::OrderCancelRequest::from_buffer(as_span(f.sent[1]));
+    REQUIRE(parsed_cancel.has_value());
+    REQUIRE(parsed_cancel->header.msg_seq_num == 2);
+    REQUIRE(parsed_cancel->orig_cl_ord_id == "ORD001");
+
+    auto parsed_replace = fix44::OrderCancelReplaceRequest::from_buffer(as_span(f.sent[2]));
+    REQUIRE(parsed_replace.has_value());
+    REQUIRE(parsed_replace->header.msg_seq_num == 3);
+    REQUIRE(parsed_replace->price == FixedPrice::from_string("151.5"));
+
+    auto parsed_status = fix44::OrderStatusRequest::from_buffer(as_span(f.sent[3]));
+    REQUIRE(parsed_status.has_value());
+    REQUIRE(parsed_status->header.msg_seq_num == 4);
+    REQUIRE(parsed_status->order_id == "EX9");
+
+    // Same bytes as the generic path with the same header values
+    auto generic = replace
+        .sender_comp_id("CLIENT")
+        .target_comp_id("SERVER")
+        .msg_seq_num(3)
+        .sending_time(parsed_replace->header.sending_time)
+        .build(f.assembler);
+    REQUIRE(f.sent[2] == std::string_view{generic.data(), generic.size()});
+    REQUIRE(f.store.contains(4));
+}
+
+TEST_CASE("SessionManager owns a message store on its memory resource", "[session][store]") {
+    SessionConfig config;
+    config.session_heap_size = 1024 * 1024;
+    SessionFixture f{config};
+#if defined(NFX_HAS_MIMALLOC) && NFX_HAS_MIMALLOC
+    REQUIRE(f.session->has_session_heap());
+#else
+    // Without mimalloc the option falls back to the global heap
+    REQUIRE_FALSE(f.session->has_session_heap());
+    REQUIRE(f.session->memory_resource() == std::pmr::new_delete_resource());
+#endif
+
+    auto& owned = f.session->own_message_store({.session_id = "CLIENT-SERVER",
+                                                .max_messages = 64,
+                                                .pool_size_bytes = 64 * 1024});
+    REQUIRE(f.session->message_store() == &owned);
+
+    f.session->on_connect();
+    REQUIRE(f.session->initiate_logon().has_value());
+    auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+    f.receive(logon, 1);
+    REQUIRE(f.session->state() == SessionState::Active);
+    REQUIRE(owned.message_count() == 1);
+    REQUIRE(f.store.message_count() == 0);
+
+    // Partial input lands in the session-owned reassembly buffer
+    const std::string order = f.original(fix44::NewOrderSingle::Builder{}
+        .cl_ord_id("ORD001").symbol("AAPL").side(Side::Buy)
+        .transact_time("20260101-00:00:00.000")
+        .order_qty(Qty::from_int(100)).ord_type(OrdType::Limit)
+        .price(FixedPrice::from_string("150.25")), 2);
+    f.session->on_bytes(as_span(std::string_view{order}.substr(0, 20)));
+    REQUIRE(f.session->pending_bytes() == 20);
+
+    // Resend replays from the owned store through the rewriter scratch
+    f.sent.clear();
+    f.receive_resend_request(1, 0, 2);
+    REQUIRE_FALSE(f.sent.empty());
+    REQUIRE(f.sent[0].find("\x01" "43=Y\x01") != std::string::npos);
+}
+
+TEST_CASE("SessionManager pads MsgSeqNum to the configured width", "[session][template]") {
+    SessionConfig config;
+    config.seq_num_width = 8;
+    SessionFixture f{config};
+    f.session->on_connect();
+    REQUIRE(f.session->initiate_logon().has_value());
+    REQUIRE(f.sent.size() == 1);
+    REQUIRE(f.sent[0].find("\x01" "34=00000001\x01") != std::string::npos);
+
+    auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+    f.receive(logon, 1);
+    REQUIRE(f.session->state() == SessionState::Active);
+
+    auto order = fix44::NewOrderSingle::Builder{}
+        .cl_ord_id("ORD001")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time("20260101-00:00:00.000")
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit)
+        .price(FixedPrice::from_string("150.25"));
+    REQUIRE(f.session->send_new_order(order).has_value());
+    REQUIRE(f.sent.size() == 2);
+    REQUIRE(f.sent[1].find("\x01" "34=00000002\x01") != std::string::npos);
+    REQUIRE(body_length_matches(f.sent[1]));
+
+    auto parsed = fix44::NewOrderSingle::from_buffer(as_span(f.sent[1]));
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->header.msg_seq_num == 2);
+
+    // Template and generic builder pad alike
+    MessageAssembler padded;
+    padded.seq_num_width(8);
+    auto generic = order
+        .sender_comp_id("CLIENT")
+        .target_comp_id("SERVER")
+        .msg_seq_num(2)
+        .sending_time(parsed->header.sending_time)
+        .build(padded);
+    REQUIRE(f.sent[1] == std::string_view{generic.data(), generic.size()});
+
+    SECTION("patch_msg_seq_num rewrites in place") {
+        std::string msg = f.sent[1];
+        REQUIRE(patch_msg_seq_num({msg.data(), msg.size()}, 12345));
+        REQUIRE(msg.size() == f.sent[1].size());
+        REQUIRE(msg.find("\x01" "34=00012345\x01") != std::string::npos);
+
+        auto patched = ParsedMessage::parse(as_span(msg));
+        REQUIRE(patched.has_value());
+        REQUIRE(patched->msg_seq_num() == 12345);
+        REQUIRE(body_length_matches(msg));
+        const size_t trailer = msg.rfind("10=");
+        char cs[3];
+        parser::format_checksum(parser::checksum(msg.data(), trailer), cs);
+        REQUIRE(std::string_view{cs, 3} == std::string_view{msg}.substr(trailer + 3, 3));
+    }
+
+    SECTION("patch_msg_seq_num refuses seq nums wider than the field") {
+        std::string msg = f.sent[1];
+        REQUIRE_FALSE(patch_msg_seq_num({msg.data(), msg.size()}, 123456789));
+        REQUIRE(msg == f.sent[1]);
+    }
+}
+
+TEST_CASE("ShardTask carries its callable by value", "[session][shard]") {
+    SessionFixture f;
+    f.session->on_connect();
+
+    struct Request {
+        std::array<char, 16> text{};
+        size_t len{0};
+    };
+    Request request;
+    std::memcpy(request.text.data(), "shutdown", 8);
+    request.len = 8;
+
+    auto task = ShardTask::make(7, [request](SessionManager& s) {
+        s.on_disconnect();
+        REQUIRE(std::string_view{request.text.data(), request.len} == "shutdown");
+    });
+    REQUIRE(task.session_index() == 7);
+    REQUIRE_FALSE(task.empty());
+
+    // Copies (as made by the inbox) run the same callable
+    ShardTask copy = task;
+    copy.run(*f.session);
+    REQUIRE(f.session->state() == SessionState::Disconnected);
+
+    ShardTask none;
+    REQUIRE(none.empty());
+    none.run(*f.session);
+}
+
+// ============================================================================
+// Acceptor Tests
+// ============================================================================
+
+namespace {
+
+/// Logon as a client would send it
+std::string client_logon(std::string_view sender, std::string_view target, uint32_t seq = 1) {
+    MessageAssembler assembler;
+    auto msg = fix44::Logon::Builder{}
+        .sender_comp_id(sender)
+        .target_comp_id(target)
+        .msg_seq_num(seq)
+        .sending_time("20260101-00:00:00.000")
+        .encrypt_method(0)
+        .heart_bt_int(30)
+        .build(assembler);
+    return std::string{msg.data(), msg.size()};
+}
+
+} // namespace
+
+TEST_CASE("CompIdRouter routes Logons to their session slots", "[session][acceptor]") {
+    CompIdRouter router;
+    constexpr uint32_t COUNT = 500;
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        REQUIRE(router.insert("EXCH", "CLIENT" + std::to_string(i), i));
+    }
+    REQUIRE(router.size() == COUNT);
+    REQUIRE_FALSE(router.insert("EXCH", "CLIENT7", 999));  // Pair already taken
+    REQUIRE(router.insert("EXCH2", "CLIENT7", COUNT));     // Same client, other CompID
+
+    for (uint32_t i = 0; i < COUNT; i += 37) {
+        const auto logon = client_logon("CLIENT" + std::to_string(i), "EXCH");
+        const auto identity = identify_logon(as_span(logon));
+        REQUIRE(identity.has_value());
+        REQUIRE(identity->sender_comp_id == "CLIENT" + std::to_string(i));
+        REQUIRE(router.route(*identity) == i);
+    }
+    const auto other = client_logon("CLIENT7", "EXCH2");
+    REQUIRE(router.route(*identify_logon(as_span(other))) == COUNT);
+
+    const auto unknown = client_logon("NOBODY", "EXCH");
+    REQUIRE(router.route(*identify_logon(as_span(unknown))) == CompIdRouter::NONE);
+    REQUIRE(CompIdRouter{}.find("EXCH", "CLIENT1") == CompIdRouter::NONE);
+
+    // Only a Logon identifies a connection
+    const auto heartbeat = make_message("35=0\x01" "34=1\x01" "49=CLIENT1\x01"
+                                        "52=20260101-00:00:00.000\x01" "56=EXCH\x01");
+    REQUIRE_FALSE(identify_logon(as_span(heartbeat)).has_value());
+    REQUIRE_FALSE(identify_logon(as_span(std::string_view{"8=FIX.4.4\x01"})).has_value());
+}
+
+TEST_CASE("SessionIndex resolves sessions through a perfect hash", "[session][acceptor]") {
+    SessionIndex index;
+    constexpr uint32_t COUNT = 500;
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        index.add(SessionId{"EXCH", "CLIENT" + std::to_string(i), "FIX.4.4"}, i);
+    }
+    index.add(SessionId{"EXCH", "CLIENT7", "FIXT.1.1"}, COUNT);  // Same pair, other version
+    REQUIRE(index.size() == COUNT + 1);
+    REQUIRE_FALSE(index.built());
+    REQUIRE(index.find(SessionId{"EXCH", "CLIENT1", "FIX.4.4"}) == SessionIndex::NONE);
+    REQUIRE(index.build());
+
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        REQUIRE(index.find(SessionId{"EXCH", "CLIENT" + std::to_string(i), "FIX.4.4"}) == i);
+    }
+    REQUIRE(index.find(SessionId{"EXCH", "CLIENT7", "FIXT.1.1"}) == COUNT);
+    REQUIRE(index.find(SessionId{"EXCH", "CLIENT7", "FIX.4.2"}) == SessionIndex::NONE);
+    REQUIRE(index.find(SessionId{"EXCH", "NOBODY", "FIX.4.4"}) == SessionIndex::NONE);
+    REQUIRE(index.find(SessionId{"EXCHCLIENT1", "", "FIX.4.4"}) == SessionIndex::NONE);
+
+    SECTION("Inbound messages resolve from their header views") {
+        const auto logon = client_logon("CLIENT42", "EXCH");
+        auto parsed = IndexedParser::parse(as_span(logon));
+        REQUIRE(parsed.has_value());
+        REQUIRE(index.route(*parsed) == 42);
+
+        const auto unknown = client_logon("NOBODY", "EXCH");
+        auto other = IndexedParser::parse(as_span(unknown));
+        REQUIRE(other.has_value());
+        REQUIRE(index.route(*other) == SessionIndex::NONE);
+    }
+
+    SECTION("Duplicate SessionIds fail the build") {
+        SessionIndex dup;
+        dup.add(SessionId{"EXCH", "CLIENT1", "FIX.4.4"}, 0);
+        dup.add(SessionId{"EXCH", "CLIENT1", "FIX.4.4"}, 1);
+        REQUIRE_FALSE(dup.build());
+        REQUIRE_FALSE(dup.built());
+    }
+
+    SECTION("An empty index finds nothing") {
+        SessionIndex empty;
+        REQUIRE(empty.build());
+        REQUIRE(empty.find(SessionId{"EXCH", "CLIENT1", "FIX.4.4"}) == SessionIndex::NONE);
+    }
+}
+
+#if NFX_IO_URING_AVAILABLE
+TEST_CASE("AcceptorEngine routes client logons across workers", "[session][acceptor][io_uring]") {
+    AcceptorEngineConfig config;
+    config.num_workers = 2;
+    config.affinity.allowed_cores = {0};
+    config.reactor.num_recv_buffers = 64;
+    config.logon_timeout = std::chrono::milliseconds(200);
+    AcceptorEngine engine{config};
+
+    std::atomic<int> logons{0};
+    for (int i = 0; i < 4; ++i) {
+        SessionConfig session;
+        session.sender_comp_id = "EXCH";
+        const std::string client = "CLIENT" + std::to_string(i);
+        session.target_comp_id = client;  // Copied by add_counterparty
+        SessionCallbacks callbacks;
+        callbacks.on_logon = [&logons] { logons.fetch_add(1); };
+        REQUIRE(engine.add_counterparty(session, std::move(callbacks)) == static_cast<uint32_t>(i));
+    }
+    auto started = engine.start();
+    if (!started) {
+        WARN("io_uring unavailable: " << started.error().message());
+        return;
+    }
+    REQUIRE(engine.worker_count() == 2);
+
+    auto connect = [&](std::string_view sender) {
+        auto transport = std::make_unique<TcpTransport>();
+        REQUIRE(transport->connect("127.0.0.1", engine.port()).has_value());
+        REQUIRE(transport->set_receive_timeout(2000));
+        const auto logon = client_logon(sender, "EXCH");
+        REQUIRE(transport->send(as_span(logon)).has_value());
+        return transport;
+    };
+    auto reply_of = [](TcpTransport& transport) {
+        std::array<char, 512> buf{};
+        auto n = transport.receive(buf);
+        return n && *n > 0 ? std::string{buf.data(), *n} : std::string{};
+    };
+
+    std::vector<std::unique_ptr<TcpTransport>> clients;
+    for (int i = 0; i < 4; ++i) {
+        clients.push_back(connect("CLIENT" + std::to_string(i)));
+    }
+    for (auto& client : clients) {
+        const auto reply = reply_of(*client);
+        REQUIRE(reply.find("35=A\x01") != std::string::npos);
+        REQUIRE(reply.find("49=EXCH\x01") != std::string::npos);
+    }
+    REQUIRE(logons.load() == 4);
+    REQUIRE(engine.is_connected(2));
+
+    // Duplicate and unknown logons are closed without a reply
+    auto duplicate = connect("CLIENT2");
+    auto unknown = connect("NOBODY");
+    REQUIRE(reply_of(*duplicate).empty());
+    REQUIRE(reply_of(*unknown).empty());
+
+    // A client that reconnects gets its slot back
+    clients[1]->disconnect();
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (engine.is_connected(1) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    REQUIRE_FALSE(engine.is_connected(1));
+    auto again = connect("CLIENT1");
+    REQUIRE(reply_of(*again).find("35=A\x01") != std::string::npos);
+
+    engine.stop();
+    AcceptorStats total{};
+    for (size_t w = 0; w < engine.worker_count(); ++w) {
+        const auto stats = engine.stats(w);
+        total.accepted += stats.accepted;
+        total.logons_routed += stats.logons_routed;
+        total.rejected_unknown += stats.rejected_unknown;
+        total.rejected_duplicate += stats.rejected_duplicate;
+    }
+    REQUIRE(total.accepted == 7);
+    REQUIRE(total.logons_routed == 5);
+    REQUIRE(total.rejected_unknown == 1);
+    REQUIRE(total.rejected_duplicate == 1);
+}
+#endif
+
+#if NFX_IO_URING_AVAILABLE
+TEST_CASE("SessionReactor routes bytes and timer ticks to its sessions", "[session][reactor][io_uring]") {
+    SessionReactorConfig config;
+    config.queue_depth = 256;
+    config.num_recv_buffers = 64;
+    SessionReactor reactor{config};
+    if (auto ready = reactor.init(); !ready) {
+        WARN("io_uring unavailable: " << ready.error().message());
+        return;
+    }
+
+    constexpr size_t COUNT = 3;
+    constexpr std::array<std::string_view, COUNT> clients{"CLIENT0", "CLIENT1", "CLIENT2"};
+    std::array<int, COUNT> local{};
+    std::array<int, COUNT> peers{};
+    std::array<int, COUNT> logons{};
+    std::vector<std::unique_ptr<SessionManager>> sessions;
+    std::vector<ReactorSessionHandle> handles;
+    std::vector<std::pair<uint32_t, int>> closed;
+    reactor.set_close_handler([&closed](ReactorSessionHandle handle, int error) {
+        closed.emplace_back(handle.slot, error);
+    });
+
+    for (size_t i = 0; i < COUNT; ++i) {
+        int fds[2];
+        REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+        local[i] = fds[0];
+        peers[i] = fds[1];
+
+        SessionConfig session;
+        session.sender_comp_id = clients[i];
+        session.target_comp_id = "EXCH";
+        session.heart_bt_int = 1;
+        sessions.push_back(std::make_unique<SessionManager>(session));
+        auto handle = reactor.add_session(local[i], *sessions.back());
+        REQUIRE(handle.has_value());
+        handles.push_back(*handle);
+
+        SessionCallbacks callbacks;
+        callbacks.on_send = reactor.sender(*handle);
+        callbacks.on_logon = [&logons, i] { ++logons[i]; };
+        sessions.back()->set_callbacks(std::move(callbacks));
+    }
+    REQUIRE(reactor.session_count() == COUNT);
+
+    auto pump_until = [&](auto&& done) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{3};
+        while (!done() && std::chrono::steady_clock::now() < deadline) {
+            (void)reactor.run_once(1);
+            reactor.tick();
+        }
+        return done();
+    };
+    // Drive the reactor until the peer holds complete messages containing needle
+    auto read_peer = [&](size_t i, std::string_view needle) {
+        std::string data;
+        (void)pump_until([&] {
+            char buf[512];
+            const IoSize n = ::recv(peers[i], buf, sizeof(buf), MSG_DONTWAIT);
+            if (n > 0) data.append(buf, static_cast<size_t>(n));
+            return data.find(needle) != std::string::npos && data.size() >= 8 &&
+                   data.compare(data.size() - 8, 4, "\x01" "10=") == 0;
+        });
+        return data;
+    };
+    auto write_peer = [&](size_t i, std::string_view body) {
+        const std::string msg = make_message(body);
+        REQUIRE(::send(peers[i], msg.data(), msg.size(), MSG_NOSIGNAL) ==
+                static_cast<IoSize>(msg.size()));
+    };
+    auto logon_reply = [&](size_t i) {
+        write_peer(i, "35=A\x01" "34=1\x01" "49=EXCH\x01" "52=20260101-00:00:00.000\x01"
+                      "56=" + std::string{clients[i]} + "\x01" "98=0\x01" "108=1\x01");
+    };
+
+    // Each Logon leaves on its own session's socket
+    for (size_t i = 0; i < COUNT; ++i) {
+        REQUIRE(sessions[i]->initiate_logon().has_value());
+    }
+    for (size_t i = 0; i < COUNT; ++i) {
+        const std::string logon = read_peer(i, "35=A\x01");
+        REQUIRE(logon.find("35=A\x01") != std::string::npos);
+        REQUIRE(logon.find("49=" + std::string{clients[i]} + "\x01") != std::string::npos);
+    }
+
+    // Inbound bytes reach only the session behind that socket
+    logon_reply(1);
+    REQUIRE(pump_until([&] { return logons[1] == 1; }));
+    REQUIRE(logons == std::array<int, COUNT>{0, 1, 0});
+    logon_reply(0);
+    logon_reply(2);
+    REQUIRE(pump_until([&] { return logons[0] == 1 && logons[2] == 1; }));
+    REQUIRE(logons == std::array<int, COUNT>{1, 1, 1});
+
+    // tick() runs each session's timer: heartbeats after the 1s interval
+    for (size_t i = 0; i < COUNT; ++i) {
+        const std::string heartbeat = read_peer(i, "35=0\x01");
+        REQUIRE(heartbeat.find("35=0\x01") != std::string::npos);
+        REQUIRE(heartbeat.find("49=" + std::string{clients[i]} + "\x01") != std::string::npos);
+    }
+
+    // A removed session gets nothing more; the others carry on
+    reactor.remove_session(handles[1]);
+    REQUIRE(reactor.session_count() == COUNT - 1);
+    REQUIRE(reactor.session(handles[1]) == nullptr);
+    REQUIRE_FALSE(reactor.send(handles[1], as_span(std::string_view{"8=FIX.4.4\x01"})));
+    const uint64_t before = sessions[1]->stats().messages_received;
+    write_peer(1, "35=1\x01" "34=2\x01" "49=EXCH\x01" "52=20260101-00:00:00.000\x01"
+                  "56=CLIENT1\x01" "112=GONE\x01");
+    write_peer(0, "35=1\x01" "34=2\x01" "49=EXCH\x01" "52=20260101-00:00:00.000\x01"
+                  "56=CLIENT0\x01" "112=PING\x01");
+    REQUIRE(read_peer(0, "112=PING\x01").find("112=PING\x01") != std::string::npos);
+    REQUIRE(sessions[1]->stats().messages_received == before);
+
+    // The peer closing its end reports an orderly close for that session
+    close_socket(peers[2]);
+    REQUIRE(pump_until([&] { return !closed.empty(); }));
+    REQUIRE(closed.size() == 1);
+    REQUIRE(closed[0].first == handles[2].slot);
+    REQUIRE(closed[0].second == 0);
+    REQUIRE(reactor.session_count() == COUNT - 2);
+
+    for (size_t i = 0; i < COUNT; ++i) {
+        close_socket(local[i]);
+        if (i != 2) close_socket(peers[i]);
+    }
+}
+#endif
+
+TEST_CASE("PipelineWarmer drives the full session path", "[session][warmup]") {
+    WarmupConfig config;
+    config.iterations = 200;
+    config.lock_memory = false;  // Would pin the whole test process
+
+    size_t sunk = 0;
+    size_t polls = 0;
+    PipelineWarmer warmer{config};
+    warmer.set_sink([&sunk](std::span<const char> data) {
+        sunk += data.size();
+        return true;
+    });
+    auto stats = warmer.run([&polls] { ++polls; });
+
+    INFO("errors: " << stats.errors << ", parse errors: " << stats.parser.parse_errors);
+    REQUIRE(stats.success());
+    REQUIRE(stats.parser.messages_parsed > 0);
+    REQUIRE(stats.messages_built == 2 * config.iterations);
+    REQUIRE(stats.messages_dispatched >= 2 * config.iterations);
+    REQUIRE(stats.store_reads > 0);
+    REQUIRE(stats.bytes_sent == sunk);
+    REQUIRE(polls == config.iterations + 1);
+    REQUIRE(warmer.session().state() == SessionState::Disconnected);
+
+    SECTION("Refused sends are reported") {
+        PipelineWarmer refused{config};
+        refused.set_sink([](std::span<const char>) { return false; });
+        REQUIRE_FALSE(refused.run().success());
+    }
+
+    SECTION("Queue warming round-trips every item") {
+        memory::SPSCQueue<ShardTask, 16> queue;
+        REQUIRE(warm_queue(queue, ShardTask{}, 100) == 100);
+        REQUIRE(queue.empty());
+    }
+}
+
+TEST_CASE("SessionManager shadow sends keep the order path warm while idle", "[session][warmup]") {
+    SessionFixture f;
+    f.config.shadow_send_interval_ms = 1;
+    f.session = std::make_unique<SessionManager>(f.config);
+
+    std::vector<std::string> shadows;
+    SessionCallbacks callbacks;
+    callbacks.on_send = [&f](std::span<const char> msg) {
+        f.sent.emplace_back(msg.data(), msg.size());
+        return true;
+    };
+    callbacks.on_shadow_send = [&shadows](std::span<const char> msg) {
+        shadows.emplace_back(msg.data(), msg.size());
+    };
+    f.session->set_callbacks(std::move(callbacks));
+    f.session->set_message_store(&f.store);
+
+    f.session->on_connect();
+    REQUIRE(f.session->initiate_logon().has_value());
+    auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+    f.receive(logon, 1);
+    REQUIRE(f.session->state() == SessionState::Active);
+
+    // First tick sees the Logon go out: not idle yet
+    f.session->on_timer_tick();
+    REQUIRE(shadows.empty());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    f.session->on_timer_tick();
+    REQUIRE(shadows.size() == 1);
+    REQUIRE(f.session->stats().shadow_sends == 1);
+
+    // Built like a real order on the next seq num, which stays unused
+    auto parsed = fix44::NewOrderSingle::from_buffer(as_span(shadows[0]));
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->header.msg_seq_num == 2);
+    REQUIRE(body_length_matches(shadows[0]));
+    REQUIRE(f.session->sequences().current_outbound() == 2);
+    REQUIRE(f.sent.size() == 1);
+    REQUIRE_FALSE(f.store.contains(2));
+
+    SECTION("Real traffic postpones the next shadow send") {
+        auto ping = fix44::TestRequest::Builder{}.test_req_id("PING");
+        f.receive(ping, 2);  // Heartbeat reply goes out
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        f.session->on_timer_tick();
+        REQUIRE(shadows.size() == 1);
+    }
+
+    SECTION("Disabled by default") {
+        SessionConfig config;
+        REQUIRE(config.shadow_send_interval_ms == 0);
+    }
+}
+
+TEST_CASE("TimerWheel expires nodes at their tick", "[session][timer]") {
+    using namespace std::chrono_literals;
+    // 1 GHz: one tick per 1'000'000 cycles
+    auto wheel = std::make_unique<BasicTimerWheel<64>>(1ms, 1.0, 1'000'000'000);
+    const auto at = [](uint64_t ticks) { return 1'000'000'000 + ticks * 1'000'000; };
+
+    std::array<TimerNode, 4> nodes;
+    for (size_t i = 0; i < nodes.size(); ++i) nodes[i].user_data = i;
+    std::vector<uint64_t> fired;
+    const auto record = [&](TimerNode& node) { fired.push_back(node.user_data); };
+
+    wheel->schedule(nodes[0], 3);
+    wheel->schedule(nodes[1], 5);
+    wheel->schedule(nodes[2], 5 + 64);  // Same slot, next turn
+    wheel->schedule(nodes[3], 0);       // Next tick
+    REQUIRE(wheel->size() == 4);
+
+    REQUIRE(wheel->advance(at(1), record) == 1);
+    REQUIRE(fired == std::vector<uint64_t>{3});
+    REQUIRE(wheel->advance(at(2) + 999'999, record) == 0);
+
+    SECTION("Due nodes fire in tick order; later turns stay") {
+        REQUIRE(wheel->advance(at(10), record) == 2);
+        REQUIRE(fired == std::vector<uint64_t>{3, 0, 1});
+        REQUIRE(wheel->advance(at(68), record) == 0);
+        REQUIRE(wheel->advance(at(69), record) == 1);
+        REQUIRE(fired.back() == 2);
+        REQUIRE(wheel->empty());
+    }
+
+    SECTION("Cancel and reschedule are O(1) relinks") {
+        wheel->cancel(nodes[0]);
+        wheel->schedule(nodes[1], 20);  // From tick 2: due at 22
+        REQUIRE(wheel->size() == 2);
+        REQUIRE(wheel->advance(at(21), record) == 0);
+        REQUIRE(wheel->advance(at(22), record) == 1);
+        REQUIRE(fired.back() == 1);
+    }
+
+    SECTION("Callbacks reschedule within one advance") {
+        wheel->cancel(nodes[1]);
+        wheel->cancel(nodes[2]);
+        size_t runs = 0;
+        wheel->advance(at(12), [&](TimerNode& node) {
+            ++runs;
+            wheel->schedule(node, 4);  // Fires at 3, 7, 11
+        });
+        REQUIRE(runs == 3);
+        REQUIRE(nodes[0].expiry_tick == 15);
+    }
+
+    SECTION("A late advance visits each slot once") {
+        REQUIRE(wheel->advance(at(1000), record) == 3);
+        REQUIRE(wheel->empty());
+        REQUIRE(wheel->current_tick() == 1000);
+    }
+
+    SECTION("Delays convert to ticks, capped at the max delay") {
+        REQUIRE(wheel->ticks_for(0ns) == 0);
+        REQUIRE(wheel->ticks_for(1500us) == 2);
+        REQUIRE(wheel->ticks_for(std::chrono::nanoseconds::max()) == 1000);
+        wheel->set_max_delay(50ms);
+        REQUIRE(wheel->ticks_for(10s) == 50);
+    }
+}
+
+TEST_CASE("SessionManager reports when its timers are next due", "[session][timer]") {
+    using namespace std::chrono_literals;
+    SessionConfig config;
+    config.heart_bt_int = 30;
+    config.logon_timeout = 1;
+    SessionFixture f{config};
+
+    // Nothing runs before the Logon
+    REQUIRE(f.session->next_timer_due() == std::chrono::nanoseconds::max());
+
+    f.session->on_connect();
+    REQUIRE(f.session->initiate_logon().has_value());
+    REQUIRE(f.session->next_timer_due() > 900ms);
+    REQUIRE(f.session->next_timer_due() <= 1s);
+
+    SECTION("Logon timeout") {
+        f.session->on_timer_tick();
+        REQUIRE(f.session->state() == SessionState::LogonSent);
+        std::this_thread::sleep_for(1s);
+        REQUIRE(f.session->next_timer_due() == 0ns);
+        f.session->on_timer_tick();
+        REQUIRE(f.session->state() == SessionState::Error);
+    }
+
+    SECTION("Active: the next heartbeat") {
+        auto logon = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+        f.receive(logon, 1);
+        REQUIRE(f.session->state() == SessionState::Active);
+        REQUIRE(f.session->next_timer_due() > 29s);
+        REQUIRE(f.session->next_timer_due() <= 30s);
+
+        f.session->begin_batch();
+        REQUIRE(f.session->next_timer_due() == 0ns);
+    }
+}
+
+TEST_CASE("ClOrdIdMap maps generated ClOrdIDs back to slots", "[session][clordid]") {
+    SECTION("Fixed-width base-62 ids sort like their sequences") {
+        ClOrdIdGenerator<4> gen{"NX", 61};
+        REQUIRE(gen.next().view() == "NX000z");
+        REQUIRE(gen.next().view() == "NX0010");
+        REQUIRE(gen.decode("NX0010") == 62);
+        REQUIRE_FALSE(gen.decode("NY0010").has_value());   // Foreign prefix
+        REQUIRE_FALSE(gen.decode("NX001").has_value());    // Wrong width
+        REQUIRE_FALSE(gen.decode("NX00-1").has_value());   // Not base 62
+        REQUIRE(gen.encode(gen.peek_sequence()).view() < gen.encode(gen.peek_sequence() + 1).view());
+
+        // Wraps within 62^Width so every id decodes to its own sequence
+        ClOrdIdGenerator<2> tiny{"", 62 * 62 - 1};
+        REQUIRE(tiny.next().view() == "zz");
+        REQUIRE(tiny.next().view() == "00");
+    }
+
+    SECTION("assign, find, erase") {
+        auto orders = std::make_unique<ClOrdIdMap<8>>("S1", 1000);
+        const auto a = orders->assign(7);
+        const auto b = orders->assign(42);
+        REQUIRE(a.has_value());
+        REQUIRE(b.has_value());
+        REQUIRE(a->view() != b->view());
+        REQUIRE(orders->find(a->view()) == 7u);
+        REQUIRE(orders->find(b->view()) == 42u);
+        REQUIRE(orders->size() == 2);
+
+        REQUIRE(orders->erase(a->view()));
+        REQUIRE_FALSE(orders->find(a->view()).has_value());
+        REQUIRE_FALSE(orders->erase(a->view()));
+        REQUIRE_FALSE(orders->find("S2000000001").has_value());
+    }
+
+    SECTION("Live orders are never overwritten; stale ids miss") {
+        ClOrdIdMap<4> orders{"S", 0};
+        const auto first = orders.assign(0);   // Sequence 0 stays live
+        std::vector<ClOrdId> ids;
+        for (uint32_t i = 1; i < 4; ++i) ids.push_back(*orders.assign(i));
+        REQUIRE_FALSE(orders.assign(99).has_value());   // Full
+
+        for (const ClOrdId& id : ids) REQUIRE(orders.erase(id.view()));
+        // Sequence 4 would reuse entry 0, still held by `first`: skipped
+        const auto next = orders.assign(5);
+        REQUIRE(next.has_value());
+        REQUIRE(orders.generator().decode(next->view()) == 5u);
+        REQUIRE(orders.find(first->view()) == 0u);
+        // An erased id whose entry was reused by a later sequence misses
+        REQUIRE_FALSE(orders.find(ids[0].view()).has_value());
+        REQUIRE(orders.find(next->view()) == 5u);
+    }
+}
+
+TEST_CASE("OrderTracker follows orders through ExecutionReports", "[session][orders]") {
+    auto orders = std::make_unique<OrderTracker<16, 4>>("T", 0);
+    IndexedParser msg;
+
+    // ExecutionReport with the given ClOrdID (OrigClOrdID if non-empty)
+    auto report = [&](std::string_view cl_ord_id, char exec, char status, int cum, int leaves,
+                      std::string_view orig = {}, int last = 0) -> const IndexedParser& {
+        std::string body = "35=8\x01" "34=2\x01" "49=VENUE\x01" "56=CLIENT\x01"
+                           "11=" + std::string{cl_ord_id} + "\x01";
+        if (!orig.empty()) body += "41=" + std::string{orig} + "\x01";
+        body += std::string{"150="} + exec + "\x01" "39=" + status + "\x01"
+                "14=" + std::to_string(cum) + "\x01" "151=" + std::to_string(leaves) + "\x01";
+        if (last > 0) body += "32=" + std::to_string(last) + "\x01" "31=10.5\x01" "6=10.5\x01";
+        static std::string raw;
+        raw = make_message(body);
+        REQUIRE(msg.assign(as_span(raw)).has_value());
+        return msg;
+    };
+
+    const auto id = orders->open(Side::Buy, Qty::from_int(100), 7);
+    REQUIRE(id.has_value());
+    REQUIRE(id->view() == "T0000");
+    REQUIRE(orders->find(id->view())->status == OrdStatus::PendingNew);
+
+    SECTION("fills to completion") {
+        auto ack = orders->on_execution_report(report(id->view(), '0', '0', 0, 100));
+        REQUIRE(ack.applied());
+        REQUIRE(ack.previous == OrdStatus::PendingNew);
+        REQUIRE(ack.order.status == OrdStatus::New);
+
+        auto partial = orders->on_execution_report(report(id->view(), 'F', '1', 40, 60, {}, 40));
+        REQUIRE(partial.applied());
+        REQUIRE(partial.last_qty == Qty::from_int(40));
+        REQUIRE(partial.order.cum_qty == Qty::from_int(40));
+        REQUIRE(partial.order.last_px == FixedPrice::from_double(10.5));
+        REQUIRE(partial.order.user == 7);
+
+        // Out of order: a New after a fill, a lower CumQty
+        REQUIRE(orders->on_execution_report(report(id->view(), '0', '0', 0, 100)).result ==
+                OrderUpdateResult::Stale);
+        REQUIRE(orders->on_execution_report(report(id->view(), 'F', '1', 30, 70, {}, 30)).result ==
+                OrderUpdateResult::Stale);
+
+        auto fill = orders->on_execution_report(report(id->view(), 'F', '2', 100, 0, {}, 60));
+        REQUIRE(fill.terminal());
+        REQUIRE(fill.order.cum_qty == Qty::from_int(100));
+        REQUIRE(orders->size() == 0);
+        REQUIRE(orders->find(id->view()) == nullptr);
+        REQUIRE(orders->on_execution_report(report(id->view(), 'F', '2', 100, 0, {}, 60)).result ==
+                OrderUpdateResult::Unknown);
+    }
+
+    SECTION("replace moves the order onto the new ClOrdID") {
+        (void)orders->on_execution_report(report(id->view(), '0', '0', 0, 100));
+        const auto new_id = orders->replace(id->view(), Qty::from_int(150));
+        REQUIRE(new_id.has_value());
+        REQUIRE(orders->size() == 2);
+
+        auto pending = orders->on_execution_report(report(new_id->view(), 'E', 'E', 0, 100, id->view()));
+        REQUIRE(pending.applied());
+        REQUIRE(orders->find(id->view())->status == OrdStatus::PendingReplace);
+
+        auto replaced = orders->on_execution_report(report(new_id->view(), '5', '0', 0, 150, id->view()));
+        REQUIRE(replaced.applied());
+        REQUIRE(replaced.order.order_qty == Qty::from_int(150));
+        REQUIRE(orders->size() == 1);
+        REQUIRE(orders->find(id->view()) == nullptr);
+        REQUIRE(orders->find(new_id->view())->kind == OrderIdKind::Order);
+        REQUIRE(orders->find(new_id->view())->user == 7);
+    }
+
+    SECTION("cancel answered by the venue or rejected") {
+        (void)orders->on_execution_report(report(id->view(), '0', '0', 0, 100));
+        const auto cancel = orders->cancel(id->view());
+        REQUIRE(cancel.has_value());
+
+        std::string reject_raw = make_message("35=9\x01" "34=3\x01" "49=VENUE\x01" "56=CLIENT\x01"
+                                              "11=" + std::string{cancel->view()} + "\x01"
+                                              "41=" + std::string{id->view()} + "\x01" "39=0\x01");
+        IndexedParser reject;
+        REQUIRE(reject.assign(as_span(reject_raw)).has_value());
+        auto rejected = orders->on_cancel_reject(reject);
+        REQUIRE(rejected.applied());
+        REQUIRE(rejected.order.status == OrdStatus::New);
+        REQUIRE(orders->find(cancel->view()) == nullptr);
+        REQUIRE(orders->size() == 1);
+
+        const auto retry = orders->cancel(id->view());
+        auto canceled = orders->on_execution_report(report(retry->view(), '4', '4', 0, 0, id->view()));
+        REQUIRE(canceled.terminal());
+        REQUIRE(orders->size() == 0);
+    }
+
+    SECTION("malformed and foreign reports") {
+        REQUIRE(orders->on_execution_report(report(id->view(), 'Z', '0', 0, 100)).result ==
+                OrderUpdateResult::Malformed);
+        REQUIRE(orders->on_execution_report(report("X0000", '0', '0', 0, 100)).result ==
+                OrderUpdateResult::Unknown);
+        REQUIRE_FALSE(orders->cancel("T0009").has_value());
+    }
+}
+
+/// Handler running a PreTradeRisk stage on a test clock
+struct RiskHandler : RecordingHandler {
+    util::SymbolTable symbols;
+    PreTradeRisk risk{symbols};
+    uint64_t now_ns{1'000'000'000};
+
+    SessionResult<void> check_order(const fix44::NewOrderSingle::Builder& order) noexcept {
+        return risk.check(order, now_ns);
+    }
+};
+
+TEST_CASE("PreTradeRisk rejects orders outside per-symbol limits", "[session][risk]") {
+    util::SymbolTable symbols;
+    auto risk = std::make_unique<PreTradeRisk>(symbols);
+    const SymbolId aapl = symbols.intern("AAPL");
+    risk->set_limits(aapl, RiskLimits{
+        .reference_price = FixedPrice::from_string("100.00"),
+        .price_band_bps = 500,
+        .max_order_qty = Qty::from_int(1000),
+        .max_notional = FixedPrice::from_string("50000"),
+        .max_orders_per_sec = 10,
+        .burst = 2});
+    const uint64_t t0 = 1'000'000'000;
+    auto px = [](std::string_view v) { return FixedPrice::from_string(v); };
+
+    SECTION("Bands, quantity and notional") {
+        REQUIRE(risk->check(aapl, px("104.99"), Qty::from_int(100), t0).has_value());
+        REQUIRE(risk->check(aapl, px("95.00"), Qty::from_int(100), t0 + 200'000'000).has_value());
+
+        auto fat_finger = risk->check(aapl, px("150.00"), Qty::from_int(100), t0 + 400'000'000);
+        REQUIRE_FALSE(fat_finger.has_value());
+        REQUIRE(fat_finger.error().code == SessionErrorCode::RiskRejected);
+        REQUIRE(risk->last_violations() == risk_violation::PriceBand);
+
+        REQUIRE_FALSE(risk->check(aapl, px("100.00"), Qty::from_int(0), t0 + 400'000'000).has_value());
+        REQUIRE(risk->last_violations() == risk_violation::OrderQty);
+
+        // 100 * 600 = 60000 > 50000; both violations are reported together
+        REQUIRE_FALSE(risk->check(aapl, px("100.00"), Qty::from_int(600), t0 + 400'000'000).has_value());
+        REQUIRE(risk->last_violations() == risk_violation::Notional);
+        REQUIRE_FALSE(risk->check(aapl, px("200.00"), Qty::from_int(2000), t0 + 400'000'000).has_value());
+        REQUIRE(risk->last_violations() ==
+                (risk_violation::PriceBand | risk_violation::OrderQty | risk_violation::Notional));
+
+        // Market orders skip the band and are valued at the reference
+        REQUIRE(risk->check(aapl, FixedPrice{}, Qty::from_int(400), t0 + 400'000'000).has_value());
+        REQUIRE_FALSE(risk->check(aapl, FixedPrice{}, Qty::from_int(600), t0 + 600'000'000).has_value());
+
+        risk->set_reference_price(aapl, px("150.00"));
+        REQUIRE(risk->check(aapl, px("150.00"), Qty::from_int(100), t0 + 800'000'000).has_value());
+
+        REQUIRE(risk->stats().checked == 9);
+        REQUIRE(risk->stats().rejected == 5);
+        REQUIRE(risk->stats().price_band == 2);
+        REQUIRE(risk->stats().notional == 3);
+    }
+
+    SECTION("Throttles allow a burst, then one order per interval") {
+        REQUIRE(risk->check(aapl, px("100.00"), Qty::from_int(1), t0).has_value());
+        REQUIRE(risk->check(aapl, px("100.00"), Qty::from_int(1), t0).has_value());
+        REQUIRE_FALSE(risk->check(aapl, px("100.00"), Qty::from_int(1), t0).has_value());
+        REQUIRE(risk->last_violations() == risk_violation::SymbolRate);
+        REQUIRE_FALSE(risk->check(aapl, px("100.00"), Qty::from_int(1), t0 + 99'000'000).has_value());
+        REQUIRE(risk->check(aapl, px("100.00"), Qty::from_int(1), t0 + 100'000'000).has_value());
+        REQUIRE(risk->stats().rate_limited == 2);
+
+        // Session-wide limit applies across symbols
+        const SymbolId msft = symbols.intern("MSFT");
+        risk->set_limits(msft, risk->limits(aapl));
+        risk->set_session_rate(1, 1);
+        const uint64_t t1 = t0 + 10'000'000'000;
+        REQUIRE(risk->check(aapl, px("100.00"), Qty::from_int(1), t1).has_value());
+        REQUIRE_FALSE(risk->check(msft, px("100.00"), Qty::from_int(1), t1).has_value());
+        REQUIRE(risk->last_violations() == risk_violation::SessionRate);
+    }
+
+    SECTION("Unknown and unconfigured symbols are rejected") {
+        REQUIRE_FALSE(risk->check(SymbolId{}, px("100.00"), Qty::from_int(1), t0).has_value());
+        REQUIRE(risk->last_violations() == risk_violation::UnknownSymbol);
+        const SymbolId tsla = symbols.intern("TSLA");
+        REQUIRE_FALSE(risk->check(tsla, FixedPrice{}, Qty::from_int(1), t0).has_value());
+        REQUIRE((risk->last_violations() & risk_violation::OrderQty) != 0);
+    }
+}
+
+TEST_CASE("SessionManager runs the handler's check_order before sending", "[session][risk]") {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+    auto handler = std::make_unique<RiskHandler>();  // Limits table is large
+    RiskHandler& h = *handler;
+    auto session = std::make_unique<BasicSessionManager<RiskHandler&>>(config, h);
+    h.risk.set_limits(h.symbols.intern("AAPL"), RiskLimits{
+        .reference_price = FixedPrice::from_string("150.00"),
+        .price_band_bps = 100,
+        .max_order_qty = Qty::from_int(500),
+        .max_notional = FixedPrice::from_string("1000000")});
+
+    session->on_connect();
+    REQUIRE(session->initiate_logon().has_value());
+    session->on_data_received(as_span(make_message("35=A\x01" "34=1\x01" "49=SERVER\x01"
+        "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" "98=0\x01" "108=30\x01")));
+    REQUIRE(session->state() == SessionState::Active);
+
+    auto order = fix44::NewOrderSingle::Builder{}
+        .cl_ord_id("ORD1")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time("20260101-00:00:00.000")
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit)
+        .price(FixedPrice::from_string("150.50"));
+    REQUIRE(session->send_new_order(order).has_value());
+
+    order.price(FixedPrice::from_string("165.00"));
+    auto rejected = session->send_new_order(order);
+    REQUIRE_FALSE(rejected.has_value());
+    REQUIRE(rejected.error().code == SessionErrorCode::RiskRejected);
+    order.price(FixedPrice::from_string("150.00")).symbol("MSFT");
+    REQUIRE_FALSE(session->send_app_message(order).has_value());
+
+    // Vetoed orders consume no sequence number and are never sent
+    REQUIRE(h.sent.size() == 2);  // Logon + ORD1
+    REQUIRE(session->sequences().current_outbound() == 3);
+    REQUIRE(session->stats().risk_rejects == 2);
+}
+
+TEST_CASE("TokenBucket meters tokens in TSC cycles", "[session][throttle]") {
+    TokenBucket unlimited;
+    REQUIRE_FALSE(unlimited.enabled());
+    REQUIRE(unlimited.try_acquire(0));
+
+    TokenBucket bucket{1000, 2, 1.0};  // 1 GHz: one token per 1'000'000 cycles
+    const uint64_t t0 = 5'000'000'000;
+    REQUIRE(bucket.try_acquire(t0));
+    REQUIRE(bucket.try_acquire(t0));
+    REQUIRE_FALSE(bucket.try_acquire(t0));
+    REQUIRE(bucket.cycles_until_token(t0 + 400'000) == 600'000);
+    REQUIRE_FALSE(bucket.try_acquire(t0 + 999'999));
+    REQUIRE(bucket.try_acquire(t0 + 1'000'000));
+    // A TSC read behind the last one adds no credit
+    REQUIRE_FALSE(bucket.try_acquire(t0));
+    // Credit never exceeds the burst
+    REQUIRE(bucket.try_acquire(t0 + 100'000'000));
+    REQUIRE(bucket.try_acquire(t0 + 100'000'000));
+    REQUIRE_FALSE(bucket.try_acquire(t0 + 100'000'000));
+}
+
+TEST_CASE("ThrottleQueue holds messages in a ring arena", "[session][throttle]") {
+    auto queue = std::make_unique<BasicThrottleQueue<8, 64>>();
+    const std::string a(30, 'a'), b(30, 'b'), c(20, 'c'), d(10, 'd');
+
+    REQUIRE(queue->push(as_span(a), 1, true));
+    REQUIRE(queue->push(as_span(b), 2, false));
+    REQUIRE_FALSE(queue->push(as_span(d), 3, true));  // 4 bytes left at the end
+    queue->pop();
+    REQUIRE(queue->push(as_span(c), 3, true));        // Wraps to the front
+    REQUIRE_FALSE(queue->push(as_span(d), 4, true));  // Would reach the oldest
+    REQUIRE(queue->size() == 2);
+    REQUIRE(queue->held_bytes() == 50);
+
+    const auto* held = queue->front();
+    REQUIRE(held->seq_num == 2);
+    REQUIRE_FALSE(held->counted);
+    REQUIRE(std::string_view{queue->bytes(*held).data(), held->length} == b);
+    queue->pop();
+    REQUIRE(std::string_view{queue->bytes(*queue->front()).data(), 20} == c);
+    queue->clear();
+    REQUIRE(queue->empty());
+    REQUIRE(queue->push(as_span(std::string(64, 'x')), 5, true));
+}
+
+TEST_CASE("SessionManager throttles outbound application messages", "[session][throttle]") {
+    auto order = fix44::NewOrderSingle::Builder{}
+        .cl_ord_id("ORD1")
+        .symbol("AAPL")
+        .side(Side::Buy)
+        .transact_time("20260101-00:00:00.000")
+        .order_qty(Qty::from_int(100))
+        .ord_type(OrdType::Limit)
+        .price(FixedPrice::from_string("150.25"));
+    auto logon = [](SessionFixture& f) {
+        f.session->on_connect();
+        REQUIRE(f.session->initiate_logon().has_value());
+        auto reply = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+        f.receive(reply, 1);
+        REQUIRE(f.session->state() == SessionState::Active);
+    };
+    SessionConfig config;
+    config.max_app_messages_per_sec = 1;
+    config.app_message_burst = 2;
+
+    SECTION("Reject fails before a seq num is consumed") {
+        SessionFixture f{config};
+        logon(f);
+        REQUIRE(f.session->send_new_order(order).has_value());
+        REQUIRE(f.session->send_app_message(order).has_value());
+        auto third = f.session->send_new_order(order);
+        REQUIRE_FALSE(third.has_value());
+        REQUIRE(third.error().code == SessionErrorCode::Throttled);
+        REQUIRE(f.session->sequences().current_outbound() == 4);
+        REQUIRE(f.sent.size() == 3);  // Logon + 2 orders
+        REQUIRE(f.session->stats().messages_throttled == 1);
+    }
+
+    SECTION("Queue holds messages, admin included, and releases them in order") {
+        config.max_app_messages_per_sec = 20;
+        config.app_message_burst = 1;
+        config.throttle_policy = ThrottlePolicy::Queue;
+        SessionFixture f{config};
+        logon(f);
+        REQUIRE(f.session->send_new_order(order).has_value());
+        REQUIRE(f.session->send_new_order(order.cl_ord_id("ORD2")).has_value());
+        // The Heartbeat answering a TestRequest queues behind ORD2
+        auto ping = fix44::TestRequest::Builder{}.test_req_id("PING");
+        f.receive(ping, 2);
+        REQUIRE(f.session->held_messages() == 2);
+        REQUIRE(f.sent.size() == 2);
+        REQUIRE(f.store.retrieve(3).has_value());  // Held messages are stored
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(60));
+        f.session->on_timer_tick();
+        REQUIRE(f.session->held_messages() == 0);
+        REQUIRE(f.sent.size() == 4);
+        REQUIRE(f.sent[2].find("\x01" "34=3\x01") != std::string::npos);
+        REQUIRE(f.sent[2].find("11=ORD2\x01") != std::string::npos);
+        REQUIRE(f.sent[3].find("35=0\x01") != std::string::npos);
+        REQUIRE(f.sent[3].find("\x01" "34=4\x01") != std::string::npos);
+    }
+
+    SECTION("A ResendRequest replays held messages instead") {
+        config.app_message_burst = 1;
+        config.throttle_policy = ThrottlePolicy::Queue;
+        SessionFixture f{config};
+        logon(f);
+        REQUIRE(f.session->send_new_order(order).has_value());
+        REQUIRE(f.session->send_new_order(order.cl_ord_id("ORD2")).has_value());
+        REQUIRE(f.session->held_messages() == 1);
+
+        f.receive_resend_request(3, 0, 2);
+        REQUIRE(f.session->held_messages() == 0);
+        REQUIRE(f.sent.size() == 3);
+        REQUIRE(f.sent[2].find("43=Y\x01") != std::string::npos);
+        REQUIRE(f.sent[2].find("11=ORD2\x01") != std::string::npos);
+    }
+}
+
+TEST_CASE("MarketDataSubscriptions batch requests behind the throttle", "[session][market_data]") {
+    auto logon = [](SessionFixture& f) {
+        f.session->on_connect();
+        REQUIRE(f.session->initiate_logon().has_value());
+        auto reply = fix44::Logon::Builder{}.encrypt_method(0).heart_bt_int(30);
+        f.receive(reply, 1);
+        REQUIRE(f.session->state() == SessionState::Active);
+    };
+    auto md_req_id = [](const std::string& msg) {
+        const size_t at = msg.find("\x01" "262=") + 5;
+        return msg.substr(at, msg.find('\x01', at) - at);
+    };
+    auto inbound = [](std::string_view body) {
+        return make_message("35=" + std::string{body.substr(0, 1)} +
+                            "\x01" "49=SERVER\x01" "56=CLIENT\x01" "34=2\x01"
+                            "52=20260101-00:00:00.000\x01" + std::string{body.substr(1)});
+    };
+    const std::array<std::string_view, 7> universe{"S0", "S1", "S2", "S3", "S4", "S5", "S6"};
+    MarketDataSubscriptions md{{.md_req_id_prefix = "MD", .max_symbols_per_request = 3}};
+    for (std::string_view symbol : universe) REQUIRE(md.subscribe(symbol));
+    REQUIRE(md.subscribe("S0"));  // Already queued: no duplicate
+    REQUIRE(md.queued() == 7);
+
+    SECTION("Venue limit and throttle") {
+        SessionConfig config;
+        config.max_app_messages_per_sec = 1;
+        config.app_message_burst = 2;
+        SessionFixture f{config};
+        REQUIRE(md.pump(*f.session) == 0);  // Not logged on
+        REQUIRE(md.last_error() == SessionErrorCode::InvalidState);
+
+        logon(f);
+        REQUIRE(md.pump(*f.session) == 2);
+        REQUIRE(md.last_error() == SessionErrorCode::Throttled);
+        REQUIRE(md.queued() == 1);
+        REQUIRE(md.count(SubscriptionState::Requested) == 6);
+        REQUIRE(f.sent.size() == 3);
+        REQUIRE(f.sent[1].find("35=V\x01") != std::string::npos);
+        REQUIRE(f.sent[1].find("146=3\x01" "55=S0\x01" "55=S1\x01" "55=S2\x01") != std::string::npos);
+        REQUIRE(f.sent[2].find("146=3\x01" "55=S3\x01") != std::string::npos);
+
+        std::vector<std::string> symbols;
+        REQUIRE(md.for_each_symbol(md_req_id(f.sent[2]), [&](std::string_view s) {
+            symbols.emplace_back(s);
+        }));
+        REQUIRE(symbols.size() == 3);
+        REQUIRE_FALSE(md.for_each_symbol("MD999", [](std::string_view) {}));
+    }
+
+    SECTION("Refreshes activate, batch rejects are split per symbol") {
+        SessionFixture f;
+        logon(f);
+        REQUIRE(md.pump(*f.session) == 3);
+        REQUIRE(md.queued() == 0);
+
+        const std::string snapshot = inbound("W262=" + md_req_id(f.sent[1]) + "\x01" "55=S0\x01");
+        REQUIRE(md.on_message(*IndexedParser::parse(snapshot)));
+        REQUIRE(md.state("S1") == SubscriptionState::Active);
+        REQUIRE(md.count(SubscriptionState::Active) == 3);
+
+        // UnknownSymbol on a batch: each symbol is retried alone
+        const std::string reject = inbound("Y262=" + md_req_id(f.sent[2]) + "\x01" "281=0\x01");
+        auto outcome = md.on_reject(*IndexedParser::parse(reject));
+        REQUIRE(outcome.known);
+        REQUIRE(outcome.requeued == 3);
+        REQUIRE(md.queued() == 3);
+        REQUIRE_FALSE(md.on_reject(*IndexedParser::parse(reject)).known);  // Released
+
+        REQUIRE(md.pump(*f.session) == 3);
+        REQUIRE(f.sent[4].find("146=1\x01" "55=S3\x01") != std::string::npos);
+        const std::string single = inbound("Y262=" + md_req_id(f.sent[4]) + "\x01" "281=0\x01");
+        outcome = md.on_reject(*IndexedParser::parse(single));
+        REQUIRE(outcome.rejected == 1);
+        REQUIRE(md.state("S3") == SubscriptionState::Rejected);
+        REQUIRE(md.reject_reason("S3") == MDReqRejReason::UnknownSymbol);
+        REQUIRE(md.state("S4") == SubscriptionState::Requested);
+
+        // Request-wide reasons reject the whole batch
+        const std::string depth = inbound("Y262=" + md_req_id(f.sent[1]) + "\x01" "281=4\x01");
+        REQUIRE(md.on_reject(*IndexedParser::parse(depth)).rejected == 3);
+        REQUIRE(md.count(SubscriptionState::Rejected) == 4);
+
+        md.resubscribe_all();
+        REQUIRE(md.queued() == 3);  // S4, S5, S6; rejected symbols stay rejected
+        REQUIRE(md.live_requests() == 0);
+        REQUIRE(md.stats().requests_sent == 6);
+    }
+}
+
+/// AsyncByteStream whose operations complete when the test says so, like
+/// CQEs reaped by an event loop
+struct ManualStream {
+    struct Pending {
+        IoCompletion* completion;
+        std::span<char> rx;
+        std::span<const char> tx;
+    };
+    std::vector<Pending> recvs;
+    std::vector<Pending> sends;
+    std::string wire;  // Everything written so far
+
+    auto async_recv(std::span<char> buffer) noexcept {
+        return IoAwaitable{[this, buffer](IoCompletion* c) {
+            recvs.push_back({c, buffer, {}});
+            return 0;
+        }};
+    }
+    auto async_send(std::span<const char> data) noexcept {
+        return IoAwaitable{[this, data](IoCompletion* c) {
+            sends.push_back({c, {}, data});
+            return 0;
+        }};
+    }
+
+    void complete_sends() {
+        while (!sends.empty()) {
+            const Pending op = sends.front();
+            sends.erase(sends.begin());
+            wire.append(op.tx.data(), op.tx.size());
+            IoCompletion::resume(op.completion, static_cast<int>(op.tx.size()));
+        }
+    }
+    void deliver(std::string_view bytes) {
+        REQUIRE(recvs.size() == 1);
+        const Pending op = recvs.front();
+        recvs.clear();
+        std::memcpy(op.rx.data(), bytes.data(), bytes.size());
+        IoCompletion::resume(op.completion, static_cast<int>(bytes.size()));
+    }
+    void close() {
+        const Pending op = recvs.front();
+        recvs.clear();
+        IoCompletion::resume(op.completion, 0);
+    }
+};
+static_assert(AsyncByteStream<ManualStream>);
+
+TEST_CASE("SessionChannel runs logon, steady state and logout as coroutines", "[session][coroutine]") {
+    SessionConfig config;
+    config.sender_comp_id = "CLIENT";
+    config.target_comp_id = "SERVER";
+    SessionManager session{config};
+    ManualStream stream;
+    auto channel = std::make_unique<SessionChannel<SessionManager, ManualStream>>(session, stream);
+
+    std::vector<std::string> orders;
+    SessionCallbacks callbacks;
+    callbacks.on_send = [&](std::span<const char> data) { return channel->stage(data); };
+    callbacks.on_app_message = [&](const IndexedParser& msg, const RxTimestamp&) {
+        orders.emplace_back(msg.get_string(11));
+    };
+    session.set_callbacks(std::move(callbacks));
+
+    auto server = [](std::string_view type, uint32_t seq, std::string_view body = "") {
+        return make_message("35=" + std::string{type} + "\x01" "34=" + std::to_string(seq) +
+                            "\x01" "49=SERVER\x01" "52=20260101-00:00:00.000\x01" "56=CLIENT\x01" +
+                            std::string{body});
+    };
+
+    auto logon = channel->logon();
+    logon.resume();                        // Runs until the Logon write is in flight
+    REQUIRE(session.state() == SessionState::LogonSent);
+    REQUIRE(stream.sends.size() == 1);
+    stream.complete_sends();               // Resumes into the receive loop
+    REQUIRE(stream.wire.find("35=A\x01") != std::string::npos);
+    REQUIRE_FALSE(logon.done());
+    stream.deliver(server("A", 1, "98=0\x01" "108=30\x01"));
+    REQUIRE(logon.done());
+    REQUIRE(logon.get().has_value());
+    REQUIRE(session.state() == SessionState::Active);
+
+    auto run = channel->run();
+    run.resume();
+    stream.wire.clear();
+    // Two messages in one read, the TestRequest answered from pump()
+    stream.deliver(server("D", 2, "11=ORD1\x01") + server("1", 3, "112=PING\x01"));
+    stream.complete_sends();
+    REQUIRE(orders == std::vector<std::string>{"ORD1"});
+    REQUIRE(stream.wire.find("35=0\x01") != std::string::npos);
+    REQUIRE(stream.wire.find("112=PING\x01") != std::string::npos);
+
+    // Counterparty logout ends the steady-state loop after our reply
+    stream.wire.clear();
+    stream.deliver(server("5", 4));
+    stream.complete_sends();
+    REQUIRE(stream.wire.find("35=5\x01") != std::string::npos);
+    REQUIRE(run.done());
+    REQUIRE(channel->receives() == 3);
+
+    SECTION("EOF disconnects the session") {
+        session.on_connect();
+        auto again = channel->logon();
+        again.resume();
+        stream.complete_sends();
+        stream.close();
+        REQUIRE(again.done());
+        REQUIRE(again.get().error().code == SessionErrorCode::Disconnected);
+        REQUIRE(session.state() == SessionState::Disconnected);
+    }
+}
+
+namespace {
+
+Task<int> small_frame(int x) { co_return x + 1; }
+
+Task<int> large_frame(int x) {
+    std::array<char, 2048> scratch{};
+    scratch[static_cast<size_t>(x)] = 1;
+    co_await std::suspend_always{};  // Keeps scratch in the frame
+    co_return scratch[static_cast<size_t>(x)];
+}
+
+} // namespace
+
+TEST_CASE("Task frames come from the thread's frame pool", "[session][coroutine]") {
+    FramePool::reset_stats();
+
+    {
+        auto task = small_frame(1);
+        REQUIRE(task.get() == 2);
+    }
+    REQUIRE(FramePool::stats().pooled == 1);
+    REQUIRE(FramePool::stats().heap == 0);
+
+    SECTION("Freed frames are reused") {
+        for (int i = 0; i < 1000; ++i) {
+            auto task = small_frame(i);
+            REQUIRE(task.get() == i + 1);
+        }
+        REQUIRE(FramePool::stats().pooled == 1001);
+        REQUIRE(FramePool::stats().heap == 0);
+    }
+
+    SECTION("Oversized frames fall back to the heap") {
+        auto task = large_frame(3);
+        REQUIRE(task.get() == 1);
+        REQUIRE(FramePool::stats().heap == 1);
+    }
+
+    SECTION("A frame freed on another thread returns to its owner's pool") {
+        auto task = std::make_unique<Task<int>>(small_frame(5));
+        uint64_t remote = 0;
+        std::thread other{[&] {
+            task.reset();
+            remote = FramePool::stats().remote_frees;
+        }};
+        other.join();
+        REQUIRE(remote == 1);
+        REQUIRE(FramePool::stats().remote_frees == 0);  // Counted on the freeing thread
+    }
+
+    SECTION("SessionChannel flows allocate no heap frames") {
+        FramePool::reset_stats();
+        SessionConfig config;
+        SessionManager session{config};
+        ManualStream stream;
+        auto channel = std::make_unique<SessionChannel<SessionManager, ManualStream>>(session, stream);
+        SessionCallbacks callbacks;
+        callbacks.on_send = [&](std::span<const char> data) { return channel->stage(data); };
+        session.set_callbacks(std::move(callbacks));
+
+        auto logon = channel->logon();
+        logon.resume();
+        stream.complete_sends();
+        stream.close();
+        REQUIRE(logon.done());
+        REQUIRE(FramePool::stats().pooled >= 3);  // logon, flush, pump
+        REQUIRE(FramePool::stats().heap == 0);
+    }
+}
@@ -0,0 +1,873 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "nexusfix/store/async_message_store.hpp"
+#include "nexusfix/store/memory_message_store.hpp"
+#include "nexusfix/store/mmap_message_store.hpp"
+#include "nexusfix/store/single_writer_message_store.hpp"
+#include "nexusfix/store/sequence_checkpoint.hpp"
+#include "nexusfix/session/sequence.hpp"
+
+using namespace nfx::store;
+
+namespace {
+
+std::span<const char> as_span(std::string_view sv) {
+    return std::span<const char>{sv.data(), sv.size()};
+}
+
+std::string_view as_view(const std::vector<char>& v) {
+    return std::string_view{v.data(), v.size()};
+}
+
+#if NFX_PLATFORM_POSIX
+
+/// Unique journal path removed at scope exit
+struct TempJournal {
+    std::string path;
+
+    explicit TempJournal(std::string_view name) {
+        path = (std::filesystem::temp_directory_path() /
+                (std::string("nfx_test_") + std::string(name) + "_" +
+                 std::to_string(::getpid()) + ".journal")).string();
+        std::filesystem::remove(path);
+    }
+
+    ~TempJournal() {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+};
+
+MmapMessageStore::Config small_config(const TempJournal& j) {
+    return MmapMessageStore::Config{
+        .session_id = "SENDER-TARGET",
+        .path = j.path,
+        .initial_size = 64 * 1024,
+        .max_size = 16 * 1024 * 1024
+    };
+}
+
+#endif
+
+} // namespace
+
+// ============================================================================
+// MmapMessageStore Tests
+// ============================================================================
+
+#if NFX_PLATFORM_POSIX
+
+TEST_CASE("MmapMessageStore store and retrieve", "[store][mmap][regression]") {
+    TempJournal journal("basic");
+    MmapMessageStore store(small_config(journal));
+    REQUIRE(store.is_open());
+    REQUIRE(store.session_id() == "SENDER-TARGET");
+
+    SECTION("Single message") {
+        REQUIRE(store.store(1, as_span("8=FIX.4.4\x01" "35=D\x01")));
+        auto msg = store.retrieve(1);
+        REQUIRE(msg.has_value());
+        REQUIRE(as_view(*msg) == "8=FIX.4.4\x01" "35=D\x01");
+        REQUIRE_FALSE(store.retrieve(2).has_value());
+    }
+
+    SECTION("Duplicate seq num rejected") {
+        REQUIRE(store.store(1, as_span("first")));
+        REQUIRE_FALSE(store.store(1, as_span("second")));
+        REQUIRE(as_view(*store.retrieve(1)) == "first");
+    }
+
+    SECTION("Range retrieval skips missing seq nums") {
+        REQUIRE(store.store(1, as_span("one")));
+        REQUIRE(store.store(2, as_span("two")));
+        REQUIRE(store.store(4, as_span("four")));
+
+        auto range = store.retrieve_range(1, 0);
+        REQUIRE(range.size() == 3);
+        REQUIRE(as_view(range[0]) == "one");
+        REQUIRE(as_view(range[2]) == "four");
+
+        REQUIRE(store.retrieve_range(2, 3).size() == 1);
+    }
+
+    SECTION("Seq num jumps do not allocate the gap") {
+        REQUIRE(store.store(1, as_span("one")));
+        REQUIRE(store.store(2, as_span("two")));
+        REQUIRE(store.store(3'000'000'000u, as_span("jump")));   // NewSeqNo
+        REQUIRE(store.store(3'000'000'001u, as_span("after")));
+        REQUIRE(store.store(1'000'000, as_span("middle")));
+        REQUIRE_FALSE(store.store(2, as_span("dup")));
+
+        REQUIRE(as_view(*store.retrieve(3'000'000'000u)) == "jump");
+        REQUIRE_FALSE(store.retrieve(3).has_value());
+        REQUIRE_FALSE(store.retrieve(2'999'999'999u).has_value());
+
+        auto range = store.retrieve_range(2, 0);
+        REQUIRE(range.size() == 4);
+        REQUIRE(as_view(range[0]) == "two");
+        REQUIRE(as_view(range[1]) == "middle");
+        REQUIRE(as_view(range[2]) == "jump");
+        REQUIRE(as_view(range[3]) == "after");
+        REQUIRE(store.retrieve_range(3, 2'999'999'999u).size() == 1);
+    }
+
+    SECTION("Journal grows beyond initial size") {
+        std::string payload(1000, 'x');
+        for (uint32_t seq = 1; seq <= 200; ++seq) {
+            REQUIRE(store.store(seq, as_span(payload)));
+        }
+        REQUIRE(store.mapped_size() > 64 * 1024);
+        REQUIRE(store.message_count() == 200);
+        REQUIRE(store.retrieve(200)->size() == 1000);
+    }
+
+    SECTION("Reset clears messages and sequence numbers") {
+        REQUIRE(store.store(1, as_span("one")));
+        store.set_next_sender_seq_num(10);
+        store.reset();
+        REQUIRE(store.message_count() == 0);
+        REQUIRE(store.get_next_sender_seq_num() == 1);
+        REQUIRE_FALSE(store.retrieve(1).has_value());
+    }
+}
+
+TEST_CASE("MmapMessageStore recovery", "[store][mmap][regression]") {
+    TempJournal journal("recovery");
+
+    SECTION("Messages and sequence numbers survive reopen") {
+        {
+            MmapMessageStore store(small_config(journal));
+            REQUIRE(store.store(1, as_span("one")));
+            REQUIRE(store.store(2, as_span("two")));
+            store.set_next_sender_seq_num(3);
+            store.set_next_target_seq_num(7);
+        }
+
+        MmapMessageStore reopened(small_config(journal));
+        REQUIRE(reopened.is_open());
+        REQUIRE(reopened.recovery_info().records_recovered == 2);
+        REQUIRE(reopened.message_count() == 2);
+        REQUIRE(as_view(*reopened.retrieve(2)) == "two");
+        REQUIRE(reopened.get_next_sender_seq_num() == 3);
+        REQUIRE(reopened.get_next_target_seq_num() == 7);
+
+        // Appending after recovery continues the journal
+        REQUIRE(reopened.store(3, as_span("three")));
+        REQUIRE(reopened.retrieve_range(1, 3).size() == 3);
+    }
+
+    SECTION("Sender seq num never behind journal contents") {
+        {
+            MmapMessageStore store(small_config(journal));
+            REQUIRE(store.store(1, as_span("one")));
+            REQUIRE(store.store(2, as_span("two")));
+            // Crash before set_next_sender_seq_num()
+        }
+
+        MmapMessageStore reopened(small_config(journal));
+        REQUIRE(reopened.get_next_sender_seq_num() == 3);
+    }
+
+    SECTION("Torn tail record is discarded") {
+        {
+            MmapMessageStore store(small_config(journal));
+            REQUIRE(store.store(1, as_span("one")));
+            REQUIRE(store.store(2, as_span("two-payload")));
+        }
+
+        // Corrupt the payload of the last record (simulates a torn write)
+        {
+            FILE* f = std::fopen(journal.path.c_str(), "r+b");
+            REQUIRE(f != nullptr);
+            long offset = static_cast<long>(detail::JOURNAL_HEADER_SIZE +
+                                            detail::record_size(3) +
+                                            sizeof(detail::RecordHeader) + 2);
+            std::fseek(f, offset, SEEK_SET);
+            std::fputc('#', f);
+            std::fclose(f);
+        }
+
+        MmapMessageStore reopened(small_config(journal));
+        REQUIRE(reopened.is_open());
+        REQUIRE(reopened.message_count() == 1);
+        REQUIRE(reopened.recovery_info().bytes_discarded > 0);
+        REQUIRE_FALSE(reopened.retrieve(2).has_value());
+
+        // Slot is reusable after recovery
+        REQUIRE(reopened.store(2, as_span("two-again")));
+        REQUIRE(as_view(*reopened.retrieve(2)) == "two-again");
+    }
+
+    SECTION("Foreign file is not overwritten") {
+        {
+            FILE* f = std::fopen(journal.path.c_str(), "wb");
+            REQUIRE(f != nullptr);
+            std::string junk(8192, 'J');
+            std::fwrite(junk.data(), 1, junk.size(), f);
+            std::fclose(f);
+        }
+
+        MmapMessageStore store(small_config(journal));
+        REQUIRE_FALSE(store.is_open());
+        REQUIRE_FALSE(store.store(1, as_span("one")));
+    }
+}
+
+TEST_CASE("MmapMessageStore sync policies", "[store][mmap]") {
+    TempJournal journal("sync");
+    auto config = small_config(journal);
+
+    SECTION("EveryMessage") {
+        config.sync_policy = SyncPolicy::EveryMessage;
+        MmapMessageStore store(config);
+        REQUIRE(store.store(1, as_span("one")));
+        REQUIRE(store.retrieve(1).has_value());
+    }
+
+    SECTION("EveryN") {
+        config.sync_policy = SyncPolicy::EveryN;
+        config.sync_interval = 2;
+        MmapMessageStore store(config);
+        for (uint32_t seq = 1; seq <= 5; ++seq) {
+            REQUIRE(store.store(seq, as_span("msg")));
+        }
+        store.flush();
+        REQUIRE(store.message_count() == 5);
+    }
+}
+
+TEST_CASE("MmapMessageStore compaction", "[store][mmap][compaction]") {
+    TempJournal journal("compact");
+    auto config = small_config(journal);
+    const std::string payload(200, 'p');
+
+    SECTION("Acknowledged messages are dropped and the journal shrinks") {
+        {
+            MmapMessageStore store(config);
+            for (uint32_t seq = 1; seq <= 1000; ++seq) {
+                REQUIRE(store.store(seq, as_span(payload)));
+            }
+            store.set_next_sender_seq_num(1001);
+            const size_t grown = store.mapped_size();
+
+            REQUIRE_FALSE(store.compact().compacted);   // Nothing acknowledged
+            store.set_acknowledged(990);
+            store.set_acknowledged(10);                 // Never moves backward
+            REQUIRE(store.acknowledged() == 990);
+
+            auto result = store.compact();
+            REQUIRE(result.compacted);
+            REQUIRE(result.records_dropped == 989);
+            REQUIRE(result.records_kept == 11);
+            REQUIRE(result.bytes_after < result.bytes_before);
+            REQUIRE(store.compactions() == 1);
+            REQUIRE(store.message_count() == 11);
+            REQUIRE(store.mapped_size() < grown);
+            REQUIRE_FALSE(store.retrieve(989).has_value());
+            REQUIRE(store.retrieve(990)->size() == payload.size());
+            REQUIRE(store.retrieve_range(1, 0).size() == 11);
+
+            // Appends continue in the new journal
+            REQUIRE(store.store(1001, as_span("after")));
+            REQUIRE_FALSE(store.compact().compacted);
+        }
+
+        MmapMessageStore reopened(config);
+        REQUIRE(reopened.is_open());
+        REQUIRE(reopened.message_count() == 12);
+        REQUIRE(as_view(*reopened.retrieve(1001)) == "after");
+        REQUIRE(reopened.get_next_sender_seq_num() == 1002);
+        REQUIRE_FALSE(std::filesystem::exists(journal.path + ".compact"));
+    }
+
+    SECTION("Retention window drops by SendingTime") {
+        config.retention = std::chrono::hours{24};
+        MmapMessageStore store(config);
+        const std::string old_msg = "8=FIX.4.4\x01" "35=D\x01" "52=20200101-00:00:00.000\x01";
+        const std::string new_msg = "8=FIX.4.4\x01" "35=D\x01" "52=22000101-00:00:00.000\x01";
+        for (uint32_t seq = 1; seq <= 5; ++seq) REQUIRE(store.store(seq, as_span(old_msg)));
+        for (uint32_t seq = 6; seq <= 8; ++seq) REQUIRE(store.store(seq, as_span(new_msg)));
+
+        auto result = store.compact();
+        REQUIRE(result.compacted);
+        REQUIRE(result.records_dropped == 5);
+        REQUIRE(store.message_count() == 3);
+        REQUIRE_FALSE(store.contains(5));
+        REQUIRE(store.contains(6));
+    }
+
+    SECTION("store() keeps running during background compaction") {
+        config.compact_threshold = 0;
+        MmapMessageStore store(config);
+        REQUIRE(store.start_compactor(std::chrono::milliseconds{1}));
+        REQUIRE_FALSE(store.start_compactor());
+
+        constexpr uint32_t TOTAL = 20000;
+        for (uint32_t seq = 1; seq <= TOTAL; ++seq) {
+            REQUIRE(store.store(seq, as_span(payload)));
+            if (seq % 100 == 0) store.set_acknowledged(seq - 50);
+        }
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (store.contains(TOTAL - 100) && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        store.stop_compactor();
+
+        REQUIRE(store.compactions() > 0);
+        REQUIRE_FALSE(store.contains(TOTAL - 100));
+        for (uint32_t seq = TOTAL - 50; seq <= TOTAL; ++seq) {
+            REQUIRE(store.retrieve(seq)->size() == payload.size());
+        }
+        // Disk stays bounded by what is retained
+        REQUIRE(store.mapped_size() <= 4 * config.initial_size);
+    }
+
+    SECTION("reset() during compaction wins") {
+        MmapMessageStore store(config);
+        for (uint32_t seq = 1; seq <= 100; ++seq) REQUIRE(store.store(seq, as_span(payload)));
+        store.set_acknowledged(50);
+        store.reset();
+        REQUIRE_FALSE(store.compact().compacted);
+        REQUIRE(store.message_count() == 0);
+    }
+}
+
+#endif // NFX_PLATFORM_POSIX
+
+// ============================================================================
+// MemoryMessageStore Tests
+// ============================================================================
+
+TEST_CASE("MemoryMessageStore ring log", "[store][memory][regression]") {
+    MemoryMessageStore store(MemoryMessageStore::Config{
+        .session_id = "SENDER-TARGET",
+        .max_messages = 4,
+        .pool_size_bytes = 64,
+    });
+
+    SECTION("Store and retrieve with gaps") {
+        REQUIRE(store.store(1, as_span("one")));
+        REQUIRE(store.store(3, as_span("three")));
+        REQUIRE(as_view(*store.retrieve(1)) == "one");
+        REQUIRE(as_view(*store.retrieve(3)) == "three");
+        REQUIRE_FALSE(store.retrieve(2).has_value());
+        REQUIRE_FALSE(store.retrieve(4).has_value());
+        REQUIRE(store.bytes_used() == 8);
+    }
+
+    SECTION("Duplicate and older seq nums are rejected") {
+        REQUIRE(store.store(5, as_span("five")));
+        REQUIRE_FALSE(store.store(5, as_span("again")));
+        REQUIRE(store.stats().store_failures == 0);
+        REQUIRE_FALSE(store.store(4, as_span("four")));
+        REQUIRE(store.stats().store_failures == 1);
+        REQUIRE(as_view(*store.retrieve(5)) == "five");
+    }
+
+    SECTION("Count limit evicts the oldest") {
+        for (uint32_t seq = 1; seq <= 6; ++seq) {
+            REQUIRE(store.store(seq, as_span("msg")));
+        }
+        REQUIRE(store.message_count() == 4);
+        REQUIRE_FALSE(store.contains(2));
+        REQUIRE(store.contains(3));
+        REQUIRE(store.retrieve_range(1, 0).size() == 4);
+    }
+
+    SECTION("Index window evicts across a seq gap") {
+        REQUIRE(store.store(1, as_span("one")));
+        REQUIRE(store.store(2, as_span("two")));
+        REQUIRE(store.store(6, as_span("six")));  // window [3, 6]
+        REQUIRE(store.message_count() == 1);
+        REQUIRE_FALSE(store.contains(2));
+        REQUIRE(as_view(*store.retrieve(6)) == "six");
+    }
+
+    SECTION("Wrapping the log keeps messages contiguous and bounded") {
+        const std::string msg(24, 'x');
+        for (uint32_t seq = 1; seq <= 10; ++seq) {
+            std::string body = msg;
+            body[0] = static_cast<char>('0' + seq % 10);
+            REQUIRE(store.store(seq, as_span(body)));
+            REQUIRE(as_view(*store.retrieve(seq)) == body);
+        }
+        // 64-byte log fits two 24-byte messages plus the wrap padding
+        REQUIRE(store.message_count() == 2);
+        REQUIRE(store.contains(9));
+        REQUIRE(store.pool_metrics().peak_usage <= 64);
+        REQUIRE_FALSE(store.store(11, as_span(std::string(65, 'y'))));
+    }
+
+    SECTION("Full store without eviction fails") {
+        MemoryMessageStore strict(MemoryMessageStore::Config{
+            .session_id = "STRICT",
+            .max_messages = 2,
+            .evict_oldest = false,
+        });
+        REQUIRE(strict.store(1, as_span("one")));
+        REQUIRE(strict.store(2, as_span("two")));
+        REQUIRE_FALSE(strict.store(3, as_span("three")));
+        REQUIRE(strict.stats().store_failures == 1);
+    }
+
+    SECTION("Byte log on huge pages") {
+        MemoryMessageStore huge(MemoryMessageStore::Config{
+            .session_id = "HUGE",
+            .pool_size_bytes = 1024 * 1024,
+            .huge_pages = true,
+        });
+        REQUIRE(huge.store(1, as_span("one")));
+        REQUIRE(as_view(*huge.retrieve(1)) == "one");
+        REQUIRE(huge.pool_metrics().pool_capacity == 1024 * 1024);
+    }
+
+    SECTION("Reset clears the index") {
+        for (uint32_t seq = 1; seq <= 4; ++seq) {
+            REQUIRE(store.store(seq, as_span("old")));
+        }
+        store.reset();
+        REQUIRE(store.message_count() == 0);
+        REQUIRE(store.store(1, as_span("new")));
+        REQUIRE(store.store(4, as_span("four")));
+        REQUIRE_FALSE(store.retrieve(3).has_value());
+        REQUIRE(as_view(*store.retrieve(1)) == "new");
+    }
+}
+
+// ============================================================================
+// SingleWriterMessageStore Tests
+// ============================================================================
+
+TEST_CASE("SingleWriterMessageStore store and retrieve", "[store][memory][regression]") {
+    SingleWriterMessageStore store(SingleWriterMessageStore::Config{
+        .session_id = "SENDER-TARGET",
+        .max_messages = 4,
+        .pool_size_bytes = 64,
+    });
+
+    REQUIRE(store.store(1, as_span("one")));
+    REQUIRE(store.store(3, as_span("three")));
+    REQUIRE_FALSE(store.store(3, as_span("again")));
+    REQUIRE_FALSE(store.store(2, as_span("two")));
+    REQUIRE(store.stats().store_failures == 1);
+    REQUIRE(as_view(*store.retrieve(3)) == "three");
+    REQUIRE_FALSE(store.retrieve(2).has_value());
+
+    for (uint32_t seq = 4; seq <= 12; ++seq) {
+        REQUIRE(store.store(seq, as_span(std::string(20, static_cast<char>('a' + seq)))));
+    }
+    REQUIRE(store.message_count() == 3);  // 64-byte log
+    REQUIRE_FALSE(store.contains(9));
+    REQUIRE(store.retrieve_range(1, 0).size() == 3);
+    REQUIRE(as_view(*store.retrieve(12)) == std::string(20, 'a' + 12));
+
+    store.reset();
+    REQUIRE(store.message_count() == 0);
+    REQUIRE_FALSE(store.retrieve(12).has_value());
+    REQUIRE(store.store(1, as_span("new")));
+    REQUIRE(as_view(*store.retrieve(1)) == "new");
+}
+
+TEST_CASE("SingleWriterMessageStore readers never see torn messages",
+          "[store][memory][threading]") {
+    // Small log so the writer is constantly overwriting what readers copy
+    SingleWriterMessageStore store(SingleWriterMessageStore::Config{
+        .session_id = "SENDER-TARGET",
+        .max_messages = 64,
+        .pool_size_bytes = 1024,
+    });
+
+    constexpr uint32_t COUNT = 200000;
+    std::atomic<uint32_t> published{0};
+    std::atomic<bool> torn{false};
+
+    std::thread reader([&] {
+        uint32_t hits = 0;
+        while (published.load(std::memory_order_acquire) < COUNT) {
+            uint32_t seq = published.load(std::memory_order_acquire);
+            if (auto msg = store.retrieve(seq)) {
+                // Every byte of message N is the same: 'A' + N % 26
+                const char expected = static_cast<char>('A' + seq % 26);
+                for (char c : *msg) {
+                    if (c != expected) torn.store(true);
+                }
+                ++hits;
+            }
+        }
+        (void)hits;
+    });
+
+    std::string msg;
+    for (uint32_t seq = 1; seq <= COUNT; ++seq) {
+        msg.assign(16 + seq % 48, static_cast<char>('A' + seq % 26));
+        REQUIRE(store.store(seq, as_span(msg)));
+        published.store(seq, std::memory_order_release);
+    }
+    reader.join();
+
+    REQUIRE_FALSE(torn.load());
+    REQUIRE(store.stats().messages_stored == COUNT);
+}
+
+// ============================================================================
+// AsyncMessageStore Tests
+// ============================================================================
+
+TEST_CASE("AsyncMessageStore writes behind to its backend", "[store][async][regression]") {
+    MemoryMessageStore backend("SENDER-TARGET");
+    AsyncMessageStore store(backend, AsyncStoreConfig{.slot_size = 64});
+
+    SECTION("Flush is a barrier") {
+        constexpr uint32_t COUNT = 2 * AsyncMessageStore::QUEUE_CAPACITY + 10;
+        for (uint32_t seq = 1; seq <= COUNT; ++seq) {
+            REQUIRE(store.store(seq, as_span("8=FIX.4.4\x01" "35=D\x01")));
+        }
+        store.flush();
+        REQUIRE(store.pending() == 0);
+        REQUIRE(backend.message_count() == COUNT);
+        REQUIRE(store.stats().messages_stored == COUNT);
+    }
+
+    SECTION("Reads see messages still in flight") {
+        REQUIRE(store.store(1, as_span("one")));
+        REQUIRE(store.store(2, as_span("two")));
+        REQUIRE(as_view(*store.retrieve(2)) == "two");
+        REQUIRE(store.visit_range(1, 0, [](uint32_t, std::span<const char>) {}) == 2);
+    }
+
+    SECTION("Oversize messages keep their order") {
+        const std::string big(100, 'B');
+        REQUIRE(store.store(1, as_span("small")));
+        REQUIRE(store.store(2, as_span(big)));
+        REQUIRE(store.store(3, as_span("after")));
+        REQUIRE(store.oversize_stores() == 1);
+        REQUIRE(store.retrieve_range(1, 3).size() == 3);
+        REQUIRE(as_view(*backend.retrieve(2)) == big);
+    }
+
+    SECTION("Sequence numbers and reset go to the backend") {
+        store.set_next_sender_seq_num(42);
+        REQUIRE(backend.get_next_sender_seq_num() == 42);
+        REQUIRE(store.store(1, as_span("one")));
+        store.reset();
+        REQUIRE(backend.message_count() == 0);
+        REQUIRE(store.get_next_sender_seq_num() == 1);
+    }
+}
+
+// ============================================================================
+// Zero-copy Range Visit Tests
+// ============================================================================
+
+TEST_CASE("MemoryMessageStore visit_range", "[store][memory][regression]") {
+    MemoryMessageStore store("SENDER-TARGET");
+    REQUIRE(store.store(1, as_span("one")));
+    REQUIRE(store.store(2, as_span("two")));
+    REQUIRE(store.store(4, as_span("four")));
+
+    SECTION("Visits in order with seq nums") {
+        std::vector<std::pair<uint32_t, std::string>> seen;
+        size_t n = store.visit_range(1, 0, [&](uint32_t seq, std::span<const char> msg) {
+            seen.emplace_back(seq, std::string(msg.data(), msg.size()));
+        });
+        REQUIRE(n == 3);
+        REQUIRE(seen[0] == std::pair<uint32_t, std::string>{1, "one"});
+        REQUIRE(seen[2] == std::pair<uint32_t, std::string>{4, "four"});
+    }
+
+    SECTION("Views point into store memory") {
+        const char* first = nullptr;
+        (void)store.visit_range(2, 2, [&](uint32_t, std::span<const char> msg) {
+            first = msg.data();
+        });
+        const char* second = nullptr;
+        (void)store.visit_range(2, 2, [&](uint32_t, std::span<const char> msg) {
+            second = msg.data();
+        });
+        REQUIRE(first != nullptr);
+        REQUIRE(first == second);
+    }
+
+    SECTION("Visitor can stop early") {
+        size_t n = store.visit_range(1, 0, [](uint32_t seq, std::span<const char>) {
+            return seq < 2;
+        });
+        REQUIRE(n == 2);
+    }
+
+    SECTION("Null store visits nothing") {
+        NullMessageStore null_store;
+        REQUIRE(null_store.visit_range(1, 0, [](uint32_t, std::span<const char>) {}) == 0);
+    }
+}
+
+#if NFX_PLATFORM_POSIX
+
+TEST_CASE("MmapMessageStore visit_range", "[store][mmap][regression]") {
+    TempJournal journal("visit");
+    MmapMessageStore store(small_config(journal));
+    REQUIRE(store.store(5, as_span("five")));
+    REQUIRE(store.store(6, as_span("six")));
+    REQUIRE(store.store(7, as_span("seven")));
+
+    std::vector<uint32_t> seqs;
+    size_t n = store.visit_range(6, 0, [&](uint32_t seq, std::span<const char>) {
+        seqs.push_back(seq);
+    });
+    REQUIRE(n == 2);
+    REQUIRE(seqs == std::vector<uint32_t>{6, 7});
+    REQUIRE(store.visit_range(1, 4, [](uint32_t, std::span<const char>) {}) == 0);
+}
+
+TEST_CASE("MemoryMessageStore elides session header fields", "[store][memory]") {
+    auto make = [](std::string_view type, int seq, std::string_view body) {
+        return "8=FIX.4.4\x01" "9=99\x01" "35=" + std::string(type) + "\x01" "49=SENDER\x01"
+               "56=TARGET\x01" "34=" + std::to_string(seq) + "\x01"
+               "52=20260101-00:00:00.000\x01" + std::string(body) + "10=000\x01";
+    };
+    const std::string order = make("D", 1, "11=ORD1\x01" "55=AAPL\x01");
+    const std::string heartbeat = make("0", 2, "");
+    // CompIDs swapped: stored whole
+    const std::string other = "8=FIX.4.4\x01" "9=60\x01" "35=D\x01" "49=TARGET\x01"
+                              "56=SENDER\x01" "34=3\x01" "11=X\x01" "10=000\x01";
+
+    MemoryMessageStore::Config config{.session_id = "SENDER-TARGET",
+                                      .elide_session_header = true};
+    MemoryMessageStore store(config);
+    REQUIRE(store.store(1, as_span(order)));
+    REQUIRE(store.store(2, as_span(heartbeat)));
+    REQUIRE(store.store(3, as_span(other)));
+
+    const size_t elided = std::string_view{"8=FIX.4.4\x01" "49=SENDER\x01" "56=TARGET\x01"}.size();
+    REQUIRE(store.pool_metrics().bytes_elided == 2 * elided);
+    REQUIRE(store.bytes_used() == order.size() + heartbeat.size() + other.size() - 2 * elided);
+
+    auto as_string = [](const std::vector<char>& v) { return std::string(v.begin(), v.end()); };
+    REQUIRE(as_string(*store.retrieve(1)) == order);
+    REQUIRE(as_string(*store.retrieve(2)) == heartbeat);
+    REQUIRE(as_string(*store.retrieve(3)) == other);
+
+    std::vector<std::string> visited;
+    (void)store.visit_range(1, 0, [&](uint32_t, std::span<const char> msg, const MessageMeta& meta) {
+        REQUIRE(meta.header_length == describe_message(msg).header_length);
+        visited.emplace_back(msg.begin(), msg.end());
+    });
+    REQUIRE(visited == std::vector<std::string>{order, heartbeat, other});
+
+    SECTION("reset relearns the template") {
+        store.reset();
+        REQUIRE(store.store(1, as_span(other)));
+        REQUIRE(store.store(2, as_span(order)));
+        REQUIRE(as_string(*store.retrieve(1)) == other);
+        REQUIRE(as_string(*store.retrieve(2)) == order);
+        // other's swapped pair is now the template; order is stored whole
+        REQUIRE(store.bytes_used() == order.size() + other.size() - elided);
+    }
+}
+
+TEST_CASE("MemoryMessageStore shrinks to its stored messages", "[store][memory]") {
+    auto make = [](int seq) {
+        return "8=FIX.4.4\x01" "9=40\x01" "35=D\x01" "34=" + std::to_string(seq) +
+               "\x01" "11=ORD" + std::to_string(seq) + "\x01" "10=000\x01";
+    };
+
+    MemoryMessageStore store(MemoryMessageStore::Config{
+        .session_id = "COMPACT", .max_messages = 1024, .pool_size_bytes = 64 * 1024});
+    const size_t full = store.memory_footprint();
+
+    // Ring wrapped once so live messages do not start at offset 0
+    std::vector<std::string> msgs;
+    for (int seq = 1; seq <= 1500; ++seq) {
+        msgs.push_back(make(seq));
+        REQUIRE(store.store(static_cast<uint32_t>(seq), as_span(msgs.back())));
+    }
+    const size_t count = store.message_count();
+    const size_t used = store.bytes_used();
+
+    const size_t released = store.shrink_to_fit();
+    REQUIRE(released > 0);
+    REQUIRE(store.shrunk());
+    REQUIRE(store.memory_footprint() == full - released);
+    REQUIRE(store.message_count() == count);
+    REQUIRE(store.bytes_used() == used);
+    REQUIRE(store.shrink_to_fit() == 0);
+
+    auto as_string = [](const std::vector<char>& v) { return std::string(v.begin(), v.end()); };
+    const uint32_t first = static_cast<uint32_t>(1501 - count);
+    REQUIRE(as_string(*store.retrieve(first)) == msgs[first - 1]);
+    REQUIRE(as_string(*store.retrieve(1500)) == msgs[1499]);
+    REQUIRE(store.retrieve_range(first, 1500).size() == count);
+
+    // The next store regrows to the configured sizes
+    msgs.push_back(make(1501));
+    REQUIRE(store.store(1501, as_span(msgs.back())));
+    REQUIRE_FALSE(store.shrunk());
+    REQUIRE(store.memory_footprint() == full);
+    REQUIRE(as_string(*store.retrieve(first + 1)) == msgs[first]);
+    REQUIRE(as_string(*store.retrieve(1501)) == msgs[1500]);
+
+    SECTION("Empty store") {
+        store.reset();
+        REQUIRE(store.shrink_to_fit() > 0);
+        REQUIRE(store.memory_footprint() < 128);
+        REQUIRE(store.store(1, as_span(msgs[0])));
+        REQUIRE(as_string(*store.retrieve(1)) == msgs[0]);
+    }
+}
+
+TEST_CASE("Stores keep MessageMeta next to each payload", "[store][meta]") {
+    const std::string order = "8=FIX.4.4\x01" "9=60\x01" "35=D\x01" "34=1\x01" "49=A\x01"
+                              "52=20260101-00:00:00.000\x01" "56=B\x01" "11=X\x01" "10=000\x01";
+    const std::string heartbeat = "8=FIX.4.4\x01" "9=50\x01" "35=0\x01" "34=2\x01" "43=N\x01"
+                                  "49=A\x01" "52=20260101-00:00:00.000\x01" "10=000\x01";
+    const std::string two_char = "8=FIXT.1.1\x01" "9=40\x01" "35=AE\x01" "34=3\x01"
+                                 "52=20260101-00:00:00.000\x01" "571=R\x01" "10=000\x01";
+
+    SECTION("describe_message summarises the header") {
+        const auto meta = describe_message(as_span(order));
+        REQUIRE(meta.valid());
+        REQUIRE(meta.type() == "D");
+        REQUIRE_FALSE(meta.is_admin());
+        REQUIRE(meta.sending_time_offset == order.find("52="));
+        REQUIRE(meta.header_length == order.find("11="));
+
+        const auto hb = describe_message(as_span(heartbeat));
+        REQUIRE(hb.is_admin());
+        REQUIRE(hb.gap_fill_on_resend());
+        REQUIRE((hb.flags & MessageMeta::HAS_POSS_DUP) != 0);
+        REQUIRE(hb.header_length == heartbeat.find("10="));
+
+        // "AE" shares its first char with Logon but is an application message
+        const auto ae = describe_message(as_span(two_char));
+        REQUIRE(ae.type() == "AE");
+        REQUIRE_FALSE(ae.is_admin());
+        REQUIRE(MessageMeta::unpack(ae.pack()).type() == "AE");
+
+        REQUIRE_FALSE(describe_message(as_span("35=D\x01" "8=FIX.4.4\x01")).valid());
+        REQUIRE_FALSE(describe_message(as_span("8=FIX.4.4\x01" "9=5")).valid());
+    }
+
+    auto check = [&](const IMessageStore& store) {
+        std::vector<std::string> types;
+        (void)store.visit_range(1, 0, [&](uint32_t, std::span<const char> msg, const MessageMeta& meta) {
+            REQUIRE(meta.header_length == describe_message(msg).header_length);
+            types.emplace_back(meta.type());
+        });
+        REQUIRE(types == std::vector<std::string>{"D", "0", "AE"});
+    };
+    auto fill = [&](IMessageStore& store) {
+        REQUIRE(store.store(1, as_span(order)));
+        REQUIRE(store.store(2, as_span(heartbeat)));
+        REQUIRE(store.store(3, as_span(two_char)));
+    };
+
+    SECTION("MemoryMessageStore") {
+        MemoryMessageStore store("SENDER-TARGET");
+        fill(store);
+        check(store);
+    }
+
+    SECTION("MemoryMessageStore checks the trailer during the copy") {
+        std::string good = order.substr(0, order.size() - 7);
+        good += "10=" + std::string(3, '0') + "\x01";
+        uint8_t cs = 0;
+        for (size_t i = 0; i + 7 < good.size(); ++i) cs += static_cast<uint8_t>(good[i]);
+        good[good.size() - 4] = static_cast<char>('0' + cs / 100);
+        good[good.size() - 3] = static_cast<char>('0' + (cs / 10) % 10);
+        good[good.size() - 2] = static_cast<char>('0' + cs % 10);
+
+        MemoryMessageStore store("SENDER-TARGET");
+        REQUIRE(store.store(1, as_span(good)));
+        REQUIRE(store.store(2, as_span(order)));   // "10=000" is wrong
+        std::vector<uint8_t> ok;
+        (void)store.visit_range(1, 0, [&](uint32_t, std::span<const char> msg, const MessageMeta& meta) {
+            REQUIRE(meta.header_length == describe_message(msg).header_length);
+            REQUIRE(meta.sending_time_offset == describe_message(msg).sending_time_offset);
+            ok.push_back((meta.flags & MessageMeta::CHECKSUM_OK) != 0);
+        });
+        REQUIRE(ok == std::vector<uint8_t>{1, 0});
+    }
+
+    SECTION("SingleWriterMessageStore") {
+        SingleWriterMessageStore store("SENDER-TARGET");
+        fill(store);
+        check(store);
+    }
+
+#if NFX_PLATFORM_POSIX
+    SECTION("MmapMessageStore, including after recovery") {
+        TempJournal journal("meta");
+        {
+            MmapMessageStore store(small_config(journal));
+            fill(store);
+            check(store);
+        }
+        MmapMessageStore reopened(small_config(journal));
+        check(reopened);
+    }
+#endif
+}
+
+TEST_CASE("MmapSequenceCheckpoint restores sequence numbers", "[store][mmap][regression]") {
+    TempJournal file("checkpoint");
+
+    {
+        MmapSequenceCheckpoint checkpoint(file.path);
+        REQUIRE(checkpoint.is_open());
+        REQUIRE_FALSE(checkpoint.recovery_info().recovered);
+
+        nfx::SequenceManager seq;
+        seq.attach_checkpoint(checkpoint.get());
+        REQUIRE(seq.current_outbound() == 1);
+
+        for (int i = 0; i < 41; ++i) (void)seq.next_outbound();
+        REQUIRE(seq.validate_inbound(1) == nfx::SequenceManager::SequenceResult::Ok);
+        seq.set_inbound(17);
+
+        REQUIRE(checkpoint.get()->outbound() == 42);
+        REQUIRE(checkpoint.get()->inbound() == 17);
+        REQUIRE(checkpoint.flush_async());
+        REQUIRE_FALSE(checkpoint.flush_async());  // Nothing changed since
+    }
+
+    SECTION("Reopen restores both directions") {
+        MmapSequenceCheckpoint checkpoint(file.path);
+        REQUIRE(checkpoint.recovery_info().recovered);
+        REQUIRE(checkpoint.recovery_info().next_outbound == 42);
+        REQUIRE(checkpoint.recovery_info().expected_inbound == 17);
+
+        nfx::SequenceManager seq;
+        seq.attach_checkpoint(checkpoint.get());
+        REQUIRE(seq.current_outbound() == 42);
+        REQUIRE(seq.expected_inbound() == 17);
+
+        seq.reset();
+        REQUIRE(checkpoint.get()->outbound() == 1);
+        REQUIRE(checkpoint.get()->inbound() == 1);
+    }
+
+    SECTION("Foreign file is left untouched") {
+        std::filesystem::remove(file.path);
+        {
+            std::FILE* f = std::fopen(file.path.c_str(), "wb");
+            REQUIRE(f != nullptr);
+            const char junk[128] = "not a checkpoint";
+            std::fwrite(junk, 1, sizeof(junk), f);
+            std::fclose(f);
+        }
+        MmapSequenceCheckpoint checkpoint(file.path);
+        REQUIRE_FALSE(checkpoint.is_open());
+        REQUIRE(std::filesystem::file_size(file.path) == 128);
+    }
+}
+
+#endif // NFX_PLATFORM_POSIX
@@ -0,0 +1,884 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/transport/io_uring_transport.hpp"
+#include "nexusfix/transport/standby_connections.hpp"
+#include "nexusfix/transport/tcp_transport.hpp"
+#include "nexusfix/transport/tls_record.hpp"
+#include "nexusfix/transport/ktls_transport.hpp"
+#include "nexusfix/transport/shm_transport.hpp"
+
+#if NFX_SHM_AVAILABLE
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#if defined(NFX_HAS_KTLS) && NFX_HAS_KTLS
+#include <cstdio>
+#include <filesystem>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+#endif
+
+using namespace nfx;
+
+namespace {
+
+std::span<const char> as_span(std::string_view sv) {
+    return std::span<const char>{sv.data(), sv.size()};
+}
+
+} // namespace
+
+// ============================================================================
+// TCP Tests
+// ============================================================================
+
+TEST_CASE("TcpAcceptor listeners share a port with SO_REUSEPORT", "[transport][acceptor]") {
+    TcpAcceptor first;
+    REQUIRE(first.listen(0, 16, true).has_value());
+    const uint16_t port = first.local_port();
+    REQUIRE(port != 0);
+
+    TcpAcceptor second;
+    REQUIRE(second.listen(port, 16, true).has_value());
+    REQUIRE(second.local_port() == port);
+
+    TcpAcceptor exclusive;
+    REQUIRE_FALSE(exclusive.listen(port, 16).has_value());
+}
+
+TEST_CASE("StandbyConnections keep a warm backup connection", "[transport][reconnect]") {
+    TcpAcceptor primary;
+    TcpAcceptor backup;
+    REQUIRE(primary.listen(0).has_value());
+    REQUIRE(backup.listen(0).has_value());
+
+    // A port with nothing listening: its standby connect is refused
+    uint16_t dead_port = 0;
+    {
+        TcpAcceptor closed;
+        REQUIRE(closed.listen(0).has_value());
+        dead_port = closed.local_port();
+    }
+
+    AddressCache cache;
+    auto first = cache.resolve("127.0.0.1", primary.local_port());
+    REQUIRE(first.has_value());
+    auto again = cache.resolve("127.0.0.1", primary.local_port());
+    REQUIRE(again.has_value());
+    REQUIRE(*again == *first);
+    REQUIRE(cache.misses() == 1);
+    REQUIRE(cache.hits() == 1);
+
+    StandbyConnections::Config config;
+    config.max_standby = 2;
+    config.retry_interval = std::chrono::milliseconds{0};
+    StandbyConnections standby{cache, config};
+    REQUIRE(standby.add_gateway("127.0.0.1", primary.local_port()) == 0u);
+    REQUIRE(standby.add_gateway("127.0.0.1", dead_port) == 1u);
+    REQUIRE(standby.add_gateway("127.0.0.1", backup.local_port()) == 2u);
+    standby.set_active(0);
+
+    auto settle = [&] {
+        for (int i = 0; i < 1000 && (standby.ready() == 0 || standby.connecting() > 0); ++i) {
+            standby.maintain();
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+    };
+
+    // Cold connect to the primary goes straight to the cached address
+    TcpSocket session;
+    REQUIRE(session.connect(standby.address(0)).has_value());
+    auto primary_peer = primary.accept();
+    REQUIRE(primary_peer.has_value());
+
+    settle();
+    REQUIRE(standby.ready() == 1);
+    REQUIRE(standby.stats().connects_failed >= 1);
+    auto warm_peer = backup.accept();
+    REQUIRE(warm_peer.has_value());
+
+    SECTION("a standby the gateway closes is replaced") {
+        close_socket(*warm_peer);
+        for (int i = 0; i < 1000 && standby.stats().dropped == 0; ++i) {
+            standby.maintain();
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        REQUIRE(standby.stats().dropped == 1);
+        settle();
+        REQUIRE(standby.ready() == 1);
+        warm_peer = backup.accept();
+        REQUIRE(warm_peer.has_value());
+    }
+
+    // Primary drops: fail over onto the warm connection
+    session.close();
+    auto taken = standby.take();
+    REQUIRE(taken.has_value());
+    REQUIRE(taken->gateway == 2);
+    REQUIRE(standby.ready() == 0);
+    REQUIRE(standby.stats().taken == 1);
+    standby.set_active(taken->gateway);
+
+    TcpTransport transport;
+    transport.adopt(taken->fd);
+    REQUIRE(transport.is_connected());
+    const std::string_view logon = "8=FIX.4.4\x01" "35=A\x01";
+    REQUIRE(transport.send({logon.data(), logon.size()}) == logon.size());
+    char buf[64];
+    REQUIRE(::recv(*warm_peer, buf, sizeof(buf), 0) == static_cast<IoSize>(logon.size()));
+
+    // The old primary is now a standby candidate
+    settle();
+    REQUIRE(standby.ready() == 1);
+
+    close_socket(*warm_peer);
+    close_socket(*primary_peer);
+}
+
+// ============================================================================
+// TLS Tests
+// ============================================================================
+
+#if NFX_PLATFORM_LINUX
+TEST_CASE("tls_record_action classifies kTLS control records", "[transport][tls]") {
+    alignas(cmsghdr) char control[TLS_RECORD_CONTROL_SIZE]{};
+    msghdr msg{};
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    auto with_type = [&](TlsRecordType type) -> const msghdr& {
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_TLS;
+        cmsg->cmsg_type = TLS_GET_RECORD_TYPE_OPT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(uint8_t));
+        *CMSG_DATA(cmsg) = static_cast<uint8_t>(type);
+        return msg;
+    };
+
+    const char ticket[] = {4, 0, 0, 8};
+    const char key_update[] = {24, 0, 0, 1, 0};
+    const char close_notify[] = {1, 0};
+    const char bad_mac[] = {2, 20};
+
+    msghdr none{};
+    REQUIRE(tls_record_action(none, as_span("8=FIX.4.4")) == TlsRecordAction::Deliver);
+    REQUIRE(tls_record_action(with_type(TlsRecordType::ApplicationData), as_span("x")) ==
+            TlsRecordAction::Deliver);
+    REQUIRE(tls_record_action(with_type(TlsRecordType::Handshake), ticket) == TlsRecordAction::Skip);
+    REQUIRE(tls_record_action(with_type(TlsRecordType::Handshake), key_update) ==
+            TlsRecordAction::Fail);
+    REQUIRE(tls_record_action(with_type(TlsRecordType::Alert), close_notify) ==
+            TlsRecordAction::Close);
+    REQUIRE(tls_record_action(with_type(TlsRecordType::Alert), bad_mac) == TlsRecordAction::Fail);
+}
+#endif
+
+#if defined(NFX_HAS_KTLS) && NFX_HAS_KTLS
+namespace {
+
+/// Self-signed P-256 certificate for "localhost", written as one PEM file
+std::string write_test_certificate() {
+    EVP_PKEY* key = EVP_EC_gen("P-256");
+    X509* cert = X509_new();
+    ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+    X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+    X509_gmtime_adj(X509_getm_notAfter(cert), 3600);
+    X509_set_pubkey(cert, key);
+    X509_NAME* name = X509_get_subject_name(cert);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                               reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+    X509_set_issuer_name(cert, name);
+    X509_sign(cert, key, EVP_sha256());
+
+    const auto path = (std::filesystem::temp_directory_path() /
+                       ("nfx-ktls-" + std::to_string(::getpid()) + ".pem")).string();
+    FILE* f = std::fopen(path.c_str(), "w");
+    PEM_write_X509(f, cert);
+    PEM_write_PrivateKey(f, key, nullptr, nullptr, 0, nullptr, nullptr);
+    std::fclose(f);
+    X509_free(cert);
+    EVP_PKEY_free(key);
+    return path;
+}
+
+} // namespace
+
+TEST_CASE("KtlsTransport carries FIX over TLS", "[transport][tls]") {
+    const std::string pem = write_test_certificate();
+    // The sandbox may lack the kernel tls module: allow OpenSSL to keep the
+    // record layer so the handshake and data path are still exercised
+    auto server_ctx = KtlsContext::create(TlsRole::Server,
+        {.cert_file = pem, .verify_peer = false, .allow_userspace_fallback = true});
+    auto client_ctx = KtlsContext::create(TlsRole::Client,
+        {.ca_file = pem, .allow_userspace_fallback = true});
+    REQUIRE(server_ctx.has_value());
+    REQUIRE(client_ctx.has_value());
+
+    TcpAcceptor acceptor;
+    REQUIRE(acceptor.listen(0).has_value());
+
+    constexpr std::string_view logon = "8=FIX.4.4|9=5|35=A|10=000|";
+    std::string echoed;
+    std::thread server([&] {
+        auto fd = acceptor.accept();
+        REQUIRE(fd.has_value());
+        KtlsTransport transport{*server_ctx};
+        REQUIRE(transport.accept(*fd).has_value());
+        std::array<char, 256> buf{};
+        size_t got = 0;
+        while (got < logon.size()) {
+            auto n = transport.receive(std::span<char>{buf}.subspan(got));
+            REQUIRE(n.has_value());
+            got += *n;
+        }
+        REQUIRE(transport.send({buf.data(), got}).has_value());
+        transport.disconnect();
+    });
+
+    KtlsTransport client{*client_ctx};
+    client.set_server_name("localhost");
+    REQUIRE(client.connect("127.0.0.1", acceptor.local_port()).has_value());
+    REQUIRE_FALSE(client.session().cipher().empty());
+
+    const std::array<std::span<const char>, 2> segments{as_span(logon.substr(0, 10)),
+                                                        as_span(logon.substr(10))};
+    REQUIRE(client.send_segments(segments).value() == logon.size());
+    std::array<char, 256> buf{};
+    while (echoed.size() < logon.size()) {
+        auto n = client.receive(buf);
+        REQUIRE(n.has_value());
+        echoed.append(buf.data(), *n);
+    }
+    server.join();
+    REQUIRE(echoed == logon);
+
+    // Server's close_notify ends the session cleanly
+    auto closed = client.receive(buf);
+    REQUIRE_FALSE(closed.has_value());
+    REQUIRE(closed.error().code == TransportErrorCode::ConnectionClosed);
+
+    SECTION("Untrusted certificate fails the handshake") {
+        auto strict = KtlsContext::create(TlsRole::Client, {.allow_userspace_fallback = true});
+        REQUIRE(strict.has_value());
+        std::thread reject([&] {
+            auto fd = acceptor.accept();
+            REQUIRE(fd.has_value());
+            KtlsTransport transport{*server_ctx};
+            (void)transport.accept(*fd);
+        });
+        KtlsTransport untrusting{*strict};
+        auto result = untrusting.connect("localhost", acceptor.local_port());
+        reject.join();
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(result.error().code == TransportErrorCode::TlsError);
+    }
+    std::filesystem::remove(pem);
+}
+#endif
+
+#if NFX_SHM_AVAILABLE
+// ============================================================================
+// Shared-memory Tests
+// ============================================================================
+
+TEST_CASE("ShmTransport carries FIX messages between processes", "[transport][shm]") {
+    const auto name = "oms." + std::to_string(::getpid());
+    ShmTransport engine{{.capacity = 1 << 16}};
+    REQUIRE(engine.listen(name).has_value());
+    REQUIRE_FALSE(engine.peer_attached());
+
+    SECTION("In-process pair, record larger than the receive buffer") {
+        ShmTransport strategy;
+        REQUIRE(strategy.connect(name, 0).has_value());
+        REQUIRE(strategy.is_connected());
+        REQUIRE(engine.peer_attached());
+
+        const std::string_view order = "8=FIX.4.4\x01" "9=5\x01" "35=D\x01" "10=000\x01";
+        REQUIRE(strategy.send(as_span(order)).value() == order.size());
+
+        std::array<char, 8> small{};
+        std::string received;
+        while (received.size() < order.size()) {
+            auto n = engine.receive(small);
+            REQUIRE(n.has_value());
+            received.append(small.data(), *n);
+        }
+        REQUIRE(received == order);
+
+        REQUIRE(engine.send(as_span(std::string_view{"35=8"})).value() == 4);
+        std::array<char, 64> buf{};
+        REQUIRE(strategy.receive(buf).value() == 4);
+
+        REQUIRE(engine.set_receive_timeout(1));
+        REQUIRE(engine.receive(buf).value() == 0);  // Timeout
+
+        strategy.disconnect();
+        auto closed = engine.receive(buf);
+        REQUIRE_FALSE(closed.has_value());
+        REQUIRE(closed.error().code == TransportErrorCode::ConnectionClosed);
+    }
+
+    SECTION("Forked strategy process echoes the engine's messages") {
+        const pid_t child = ::fork();
+        REQUIRE(child >= 0);
+        if (child == 0) {
+            ShmTransport strategy;
+            if (!strategy.connect(name, 0)) ::_exit(2);
+            std::array<char, 256> buf{};
+            for (int i = 0; i < 100; ++i) {
+                auto n = strategy.receive(buf);
+                if (!n || *n == 0) ::_exit(3);
+                if (!strategy.send({buf.data(), *n})) ::_exit(4);
+            }
+            ::_exit(0);
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!engine.peer_attached() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        REQUIRE(engine.peer_attached());
+
+        bool echoed = true;
+        std::array<char, 256> buf{};
+        for (int i = 0; i < 100; ++i) {
+            const std::string msg = "35=D\x01" "11=" + std::to_string(i) + "\x01";
+            echoed = echoed && engine.send(as_span(std::string_view{msg})).has_value();
+            auto n = engine.receive(buf);
+            echoed = echoed && n.has_value() && std::string_view{buf.data(), *n} == msg;
+        }
+
+        int status = 0;
+        REQUIRE(::waitpid(child, &status, 0) == child);
+        REQUIRE(WIFEXITED(status));
+        REQUIRE(WEXITSTATUS(status) == 0);
+        REQUIRE(echoed);
+    }
+}
+#endif
+
+#if NFX_IO_URING_AVAILABLE
+// ============================================================================
+// io_uring Tests
+// ============================================================================
+
+namespace {
+
+/// IoUringTransport connected to a plain socket on the loopback peer side
+struct UringLoopback {
+    IoUringContext ctx;
+    TcpAcceptor acceptor;
+    std::unique_ptr<IoUringTransport> transport;
+    SocketHandle peer{INVALID_SOCKET_HANDLE};
+
+    UringLoopback() = default;
+    UringLoopback(const UringLoopback&) = delete;
+    UringLoopback& operator=(const UringLoopback&) = delete;
+    ~UringLoopback() { close_socket(peer); }
+
+    /// Set up the ring and connect; false where the kernel refuses io_uring
+    [[nodiscard]] bool open(const IoUringTransportConfig& config = {}) {
+        return open(config, [](IoUringContext& ring) { return ring.init(); });
+    }
+
+    /// Same, with the ring set up by init (e.g. init_sqpoll)
+    template <typename Init>
+    [[nodiscard]] bool open(const IoUringTransportConfig& config, Init&& init) {
+        if (auto ring = init(ctx); !ring) {
+            WARN("io_uring unavailable: " << ring.error().message());
+            return false;
+        }
+        REQUIRE(acceptor.listen(0).has_value());
+        transport = std::make_unique<IoUringTransport>(ctx, config);
+        REQUIRE(transport->connect("127.0.0.1", acceptor.local_port()).has_value());
+        auto fd = acceptor.accept();
+        REQUIRE(fd.has_value());
+        peer = *fd;
+        timeval timeout{2, 0};
+        ::setsockopt(peer, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        return true;
+    }
+
+    /// Read n bytes on the peer side (fewer if the connection ends)
+    std::string read_peer(size_t n) {
+        std::string data(n, '\0');
+        size_t got = 0;
+        while (got < n) {
+            const IoSize r = ::recv(peer, data.data() + got, n - got, 0);
+            if (r <= 0) break;
+            got += static_cast<size_t>(r);
+        }
+        data.resize(got);
+        return data;
+    }
+
+    /// Reap completions until done() holds; false after two seconds
+    template <typename Done>
+    bool poll_until(Done&& done) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{2};
+        while (!done()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            transport->poll();
+            std::this_thread::yield();
+        }
+        return true;
+    }
+};
+
+} // namespace
+
+TEST_CASE("IoUringTransport send_async completes within its deadline", "[transport][io_uring]") {
+    IoUringTransportConfig config;
+    config.send_timeout_ms = 500;
+    UringLoopback loop;
+    if (!loop.open(config)) return;
+
+    const std::string logon = "8=FIX.4.4\x01" "9=5\x01" "35=A\x01" "10=000\x01";
+    const std::string heartbeat = "8=FIX.4.4\x01" "9=5\x01" "35=0\x01" "10=000\x01";
+    REQUIRE(loop.transport->send_async(as_span(logon)).value() == logon.size());
+    REQUIRE(loop.transport->send_async(as_span(heartbeat)).value() == heartbeat.size());
+    REQUIRE(loop.poll_until([&] { return loop.transport->async_pending() == 0; }));
+
+    REQUIRE(loop.read_peer(logon.size() + heartbeat.size()) == logon + heartbeat);
+    REQUIRE(loop.transport->send_timeouts() == 0);
+    REQUIRE(loop.transport->async_send_error() == TransportErrorCode::None);
+    REQUIRE(loop.transport->is_connected());
+
+    // Nothing queued: a synchronous send goes out under the same deadline
+    REQUIRE(loop.transport->send(as_span(logon)).value() == logon.size());
+    REQUIRE(loop.read_peer(logon.size()) == logon);
+}
+
+TEST_CASE("IoUringTransport send deadline gives up on a stalled peer", "[transport][io_uring]") {
+    IoUringTransportConfig config;
+    config.send_timeout_ms = 20;
+    config.send_timeout_retries = 1;
+    UringLoopback loop;
+    if (!loop.open(config)) return;
+    int small = 4096;
+    ::setsockopt(loop.peer, SOL_SOCKET, SO_RCVBUF, &small, sizeof(small));
+
+    // The peer never reads: once the socket buffers are full the send in
+    // flight blocks until its linked timeout cancels it, then the retry
+    // expires too and the transport closes the connection
+    const std::string chunk(16384, 'x');
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (loop.transport->async_send_error() == TransportErrorCode::None &&
+           std::chrono::steady_clock::now() < deadline) {
+        (void)loop.transport->send_async(as_span(chunk));   // NoBufferSpace while the queue is full
+        loop.transport->poll();
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    REQUIRE(loop.transport->async_send_error() == TransportErrorCode::Timeout);
+    REQUIRE(loop.transport->send_timeouts() == config.send_timeout_retries + 1);
+    REQUIRE_FALSE(loop.transport->is_connected());
+    REQUIRE(loop.transport->async_pending() == 0);
+
+    auto refused = loop.transport->send_async(as_span(chunk));
+    REQUIRE_FALSE(refused.has_value());
+    REQUIRE(refused.error().code == TransportErrorCode::Timeout);
+}
+
+TEST_CASE("IoUringTransport completion handlers fire once per operation", "[transport][io_uring]") {
+    IoUringTransportConfig config;
+    config.send_timeout_ms = 20;
+    config.send_timeout_retries = 0;
+    UringLoopback loop;
+    if (!loop.open(config)) return;
+
+    std::vector<std::pair<uint64_t, TransportResult<size_t>>> sends;
+    std::string received;
+    size_t receives = 0;
+    loop.transport->on_send_complete([&sends](uint64_t token, TransportResult<size_t> result) {
+        sends.emplace_back(token, result);
+    });
+    loop.transport->on_receive([&received, &receives](std::span<const char> data) {
+        received.append(data.data(), data.size());
+        ++receives;
+    });
+
+    const std::string logon = "8=FIX.4.4\x01" "9=5\x01" "35=A\x01" "10=000\x01";
+    const std::string heartbeat = "8=FIX.4.4\x01" "9=5\x01" "35=0\x01" "10=000\x01";
+    REQUIRE(loop.transport->async_send(as_span(logon), 1).has_value());
+    REQUIRE(loop.transport->async_send(as_span(heartbeat), 2).has_value());
+    REQUIRE(loop.poll_until([&] { return sends.size() == 2; }));
+    REQUIRE(sends[0].first == 1);
+    REQUIRE(sends[0].second.value() == logon.size());
+    REQUIRE(sends[1].first == 2);
+    REQUIRE(sends[1].second.value() == heartbeat.size());
+    REQUIRE(loop.read_peer(logon.size() + heartbeat.size()) == logon + heartbeat);
+
+    REQUIRE(::send(loop.peer, logon.data(), logon.size(), MSG_NOSIGNAL) ==
+            static_cast<IoSize>(logon.size()));
+    REQUIRE(loop.poll_until([&] { return received.size() == logon.size(); }));
+    REQUIRE(received == logon);
+    REQUIRE(receives == 1);
+
+    // Nothing fires twice
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    loop.transport->poll_completions();
+    REQUIRE(sends.size() == 2);
+    REQUIRE(receives == 1);
+
+    SECTION("Sends cancelled by their deadline fail their token") {
+        int small = 4096;
+        ::setsockopt(loop.peer, SOL_SOCKET, SO_RCVBUF, &small, sizeof(small));
+        const std::string chunk(16384, 'x');
+        uint64_t next_token = 3;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+        while (loop.transport->async_send_error() == TransportErrorCode::None &&
+               std::chrono::steady_clock::now() < deadline) {
+            if (loop.transport->async_send(as_span(chunk), next_token).has_value()) {
+                ++next_token;
+            }
+            loop.transport->poll_completions();
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        REQUIRE(loop.transport->async_send_error() == TransportErrorCode::Timeout);
+
+        // Every queued call reported exactly once, in order: sent, then cancelled
+        REQUIRE(sends.size() == next_token - 1);
+        bool failed = false;
+        for (size_t i = 2; i < sends.size(); ++i) {
+            REQUIRE(sends[i].first == i + 1);
+            if (sends[i].second) {
+                REQUIRE_FALSE(failed);
+                REQUIRE(*sends[i].second == chunk.size());
+            } else {
+                failed = true;
+                REQUIRE(sends[i].second.error().code == TransportErrorCode::Timeout);
+            }
+        }
+        REQUIRE(failed);
+    }
+
+    SECTION("A reset connection fails the send in flight") {
+        linger reset{1, 0};
+        ::setsockopt(loop.peer, SOL_SOCKET, SO_LINGER, &reset, sizeof(reset));
+        close_socket(loop.peer);
+        loop.peer = INVALID_SOCKET_HANDLE;
+
+        REQUIRE(loop.transport->async_send(as_span(logon), 3).has_value());
+        REQUIRE(loop.poll_until([&] { return sends.size() == 3; }));
+        REQUIRE(sends[2].first == 3);
+        REQUIRE_FALSE(sends[2].second.has_value());
+        REQUIRE(sends[2].second.error().code == TransportErrorCode::ConnectionReset);
+        REQUIRE(loop.transport->async_send_error() == TransportErrorCode::ConnectionReset);
+        REQUIRE_FALSE(loop.transport->is_connected());
+
+        loop.transport->poll_completions();
+        REQUIRE(sends.size() == 3);
+        REQUIRE(receives == 1);
+    }
+}
+
+TEST_CASE("IoUringContext fixed file table hands out and reuses slots", "[transport][io_uring]") {
+    IoUringTransportConfig config;
+    config.registered_file_slots = 4;
+    UringLoopback loop;
+    if (!loop.open(config)) return;
+    IoUringContext& ctx = loop.ctx;
+    if (!ctx.has_file_table()) {
+        WARN("fixed file table unavailable");
+        return;
+    }
+    REQUIRE(ctx.free_file_slots() == 3);
+
+    // Sends and receives name the socket by its slot (IOSQE_FIXED_FILE)
+    const std::string logon = "8=FIX.4.4\x01" "9=5\x01" "35=A\x01" "10=000\x01";
+    std::array<char, 64> buf{};
+    auto check_traffic = [&] {
+        REQUIRE(loop.transport->send(as_span(logon)).value() == logon.size());
+        REQUIRE(loop.read_peer(logon.size()) == logon);
+        REQUIRE(::send(loop.peer, logon.data(), logon.size(), MSG_NOSIGNAL) ==
+                static_cast<IoSize>(logon.size()));
+        auto n = loop.transport->receive(buf);
+        REQUIRE(n.has_value());
+        REQUIRE(std::string_view{buf.data(), *n} == logon);
+    };
+    check_traffic();
+
+    // Closing frees the slot; the reconnect takes it back
+    loop.transport->disconnect();
+    REQUIRE(ctx.free_file_slots() == 4);
+    REQUIRE(loop.transport->connect("127.0.0.1", loop.acceptor.local_port()).has_value());
+    REQUIRE(ctx.free_file_slots() == 3);
+    auto reconnected = loop.acceptor.accept();
+    REQUIRE(reconnected.has_value());
+    close_socket(loop.peer);
+    loop.peer = *reconnected;
+    check_traffic();
+
+    IoUringSocket first{ctx};
+    REQUIRE(first.create(true).has_value());
+    const int slot = first.fixed_file_slot();
+    REQUIRE(slot >= 0);
+    first.close_sync();
+    REQUIRE(first.fixed_file_slot() == -1);
+    IoUringSocket second{ctx};
+    REQUIRE(second.create(true).has_value());
+    REQUIRE(second.fixed_file_slot() == slot);     // LIFO: the slot just freed
+
+    SECTION("A full table leaves new sockets on their fd") {
+        std::vector<std::unique_ptr<IoUringSocket>> sockets;
+        while (ctx.free_file_slots() > 0) {
+            sockets.push_back(std::make_unique<IoUringSocket>(ctx));
+            REQUIRE(sockets.back()->create(true).has_value());
+            REQUIRE(sockets.back()->fixed_file_slot() >= 0);
+        }
+        IoUringSocket overflow{ctx};
+        REQUIRE(overflow.create(true).has_value());
+        REQUIRE(overflow.fd() >= 0);
+        REQUIRE(overflow.fixed_file_slot() == -1);
+        REQUIRE(ctx.acquire_file_slot(overflow.fd()) == -1);
+
+        sockets.pop_back();
+        REQUIRE(ctx.free_file_slots() == 1);
+        check_traffic();
+    }
+}
+
+TEST_CASE("IoUringContext busy-poll reaps completions without waiting", "[transport][io_uring]") {
+    IoUringContext ctx;
+    if (auto ring = ctx.init_busy_poll(); !ring) {
+        WARN("io_uring unavailable: " << ring.error().message());
+        return;
+    }
+    auto ignore = [](struct io_uring_cqe*) noexcept {};
+
+    // An empty CQ returns at once
+    REQUIRE(ctx.reap(ignore) == 0);
+    REQUIRE(ctx.poll_stats().polls == 1);
+    REQUIRE(ctx.poll_stats().empty_polls == 1);
+
+    // Completions posted during submit are reaped in batches of at most
+    // max, straight off the CQ ring with no further syscall
+    for (int i = 0; i < 8; ++i) {
+        auto* sqe = ctx.get_sqe();
+        REQUIRE(sqe != nullptr);
+        io_uring_prep_nop(sqe);
+        io_uring_sqe_set_data(sqe, nullptr);
+    }
+    REQUIRE(ctx.submit() == 8);
+    const uint64_t enters = ctx.poll_stats().enters;
+    REQUIRE(ctx.reap(ignore, 3) == 3);
+    REQUIRE(ctx.reap(ignore, 3) == 3);
+    REQUIRE(ctx.reap(ignore) == 2);
+    REQUIRE(ctx.reap(ignore) == 0);
+    REQUIRE(ctx.poll_stats().cqes == 8);
+    REQUIRE(ctx.poll_stats().enters == enters);
+
+    // busy_poll() submits the queued read itself and spins until it lands
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    IoUringSocket socket{ctx};
+    socket.adopt(fds[0]);
+    const std::string_view heartbeat = "8=FIX.4.4\x01" "9=5\x01" "35=0\x01" "10=000\x01";
+    REQUIRE(::send(fds[1], heartbeat.data(), heartbeat.size(), MSG_NOSIGNAL) ==
+            static_cast<IoSize>(heartbeat.size()));
+
+    std::array<char, 64> buf{};
+    int tag = 0;
+    int result = 0;
+    REQUIRE(socket.submit_read(buf, &tag).has_value());
+    const uint64_t handled = ctx.busy_poll(
+        [&](struct io_uring_cqe* cqe) noexcept {
+            if (io_uring_cqe_get_data(cqe) == &tag) result = cqe->res;
+        },
+        [&] { return result != 0 || ctx.poll_stats().polls > 100'000'000; });
+    REQUIRE(handled == 1);
+    REQUIRE(result == static_cast<int>(heartbeat.size()));
+    REQUIRE(std::string_view{buf.data(), heartbeat.size()} == heartbeat);
+
+    // With nothing in flight the stop predicate alone bounds the spin
+    const uint64_t polls = ctx.poll_stats().polls;
+    const uint64_t empty = ctx.poll_stats().empty_polls;
+    REQUIRE(ctx.busy_poll<memory::YieldingWait>(ignore,
+        [&] { return ctx.poll_stats().polls - polls >= 100; }) == 0);
+    REQUIRE(ctx.poll_stats().empty_polls - empty == 100);
+    close_socket(fds[1]);
+}
+
+TEST_CASE("ProvidedBufferGroup rings give back bundles and partly used buffers", "[transport][io_uring]") {
+    IoUringContext ctx;
+    if (auto ring = ctx.init(); !ring) {
+        WARN("io_uring unavailable: " << ring.error().message());
+        return;
+    }
+    int fds[2];
+    REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    IoUringSocket socket{ctx};
+    socket.adopt(fds[0]);
+    ProvidedBufferGroup group;
+
+    std::string sent;
+    std::string received;
+    size_t returned = 0;
+    size_t widest = 0;          // Most buffers one CQE gave back
+    bool refused = false;
+    int tag = 0;
+
+    // Write n more bytes on the peer side and consume CQEs until they are in
+    auto round = [&](size_t n) {
+        const size_t begin = sent.size();
+        for (size_t i = 0; i < n; ++i) {
+            sent.push_back(static_cast<char>('A' + (begin + i) % 26));
+        }
+        REQUIRE(::send(fds[1], sent.data() + begin, n, MSG_NOSIGNAL) == static_cast<IoSize>(n));
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{2};
+        while (received.size() < sent.size() && !refused &&
+               std::chrono::steady_clock::now() < deadline) {
+            (void)ctx.submit();
+            (void)ctx.reap([&](struct io_uring_cqe* cqe) noexcept {
+                if (io_uring_cqe_get_data(cqe) != &tag) return;
+                if (cqe->res == -EINVAL) refused = true;
+                const size_t given = group.consume(cqe->res, cqe->flags,
+                    [&](std::span<const char> data) { received.append(data.data(), data.size()); });
+                returned += given;
+                widest = std::max(widest, given);
+            });
+        }
+    };
+
+    SECTION("A bundle spans several buffers") {
+        if (!group.init_ring(ctx, 0, 64, 8)) {
+            WARN("buffer rings unavailable");
+            close_socket(fds[1]);
+            return;
+        }
+        REQUIRE(socket.submit_recv_multishot(group.group_id(), &tag, true).has_value());
+        round(200);
+        if (refused) {
+            WARN("kernel predates recv bundles");
+            close_socket(fds[1]);
+            return;
+        }
+        REQUIRE(received == sent);
+        REQUIRE(returned >= 4);     // 200 bytes in 64-byte buffers
+        REQUIRE(widest > 1);
+
+        // The ring holds 512 bytes: later rounds only fit if buffers came back
+        round(400);
+        round(400);
+        REQUIRE(received == sent);
+        REQUIRE(returned >= 4 + 7 + 7);
+    }
+
+    SECTION("Incremental buffers keep filling until full") {
+        if (!group.init_ring(ctx, 0, 256, 4, false, -1, true)) {
+            WARN("incremental buffer rings unavailable");
+            close_socket(fds[1]);
+            return;
+        }
+        REQUIRE(group.is_incremental());
+        REQUIRE(socket.submit_recv_multishot(group.group_id(), &tag).has_value());
+        round(100);
+        round(100);
+        REQUIRE(received == sent);
+        REQUIRE(returned == 0);     // Both receives packed into the head buffer
+
+        // 2 KB through a 1 KB ring: every buffer filled goes back
+        for (int i = 0; i < 18; ++i) round(100);
+        REQUIRE(received == sent);
+        REQUIRE(returned >= 7);
+    }
+    close_socket(fds[1]);
+}
+
+TEST_CASE("IoUringTransport zero-copy sends give every buffer back", "[transport][io_uring]") {
+    IoUringTransportConfig config;
+    config.use_zero_copy_send = true;
+    config.num_registered_buffers = 4;
+    config.registered_buffer_size = 8192;
+    config.zero_copy_min_bytes = 2048;
+    UringLoopback loop;
+    if (!loop.open(config)) return;
+    if (!loop.transport->uses_zero_copy_send()) {
+        WARN("SEND_ZC unavailable; checking the copying path only");
+    }
+
+    // Bursts of twice the pool: buffers run out while their notifications
+    // are pending, so sends retry after poll() or take the copying path
+    for (int round = 0; round < 8; ++round) {
+        std::string expected;
+        for (int i = 0; i < 8; ++i) {
+            const std::string msg(4096, static_cast<char>('a' + (round * 8 + i) % 26));
+            REQUIRE(loop.transport->send(as_span(msg)).value() == msg.size());
+            REQUIRE(loop.transport->zero_copy_in_flight() <= config.num_registered_buffers);
+            expected += msg;
+        }
+        REQUIRE(loop.read_peer(expected.size()) == expected);
+    }
+    REQUIRE(loop.poll_until([&] { return loop.transport->zero_copy_in_flight() == 0; }));
+
+    // Below the threshold nothing is left in flight
+    const std::string heartbeat = "8=FIX.4.4\x01" "9=5\x01" "35=0\x01" "10=000\x01";
+    REQUIRE(loop.transport->send(as_span(heartbeat)).value() == heartbeat.size());
+    REQUIRE(loop.transport->zero_copy_in_flight() == 0);
+    REQUIRE(loop.read_peer(heartbeat.size()) == heartbeat);
+}
+
+TEST_CASE("IoUringContext SQPOLL rings carry traffic or fall back to init()", "[transport][io_uring]") {
+    UringLoopback loop;
+    if (!loop.open({}, [](IoUringContext& ring) {
+            return ring.init_sqpoll({.sq_thread_idle_ms = 10});
+        })) {
+        return;
+    }
+
+    // is_sqpoll() reports the mode the kernel actually set up
+    const bool sqpoll = (loop.ctx.ring()->flags & IORING_SETUP_SQPOLL) != 0;
+    REQUIRE(loop.ctx.is_sqpoll() == sqpoll);
+    if (sqpoll) {
+        REQUIRE_FALSE(loop.ctx.is_optimized());
+    } else {
+        WARN("SQPOLL refused; running on the init() fallback");
+        REQUIRE(loop.ctx.sq_thread_cpu() == -1);
+        REQUIRE_FALSE(loop.ctx.sq_needs_wakeup());
+    }
+
+    const std::string order = "8=FIX.4.4\x01" "9=5\x01" "35=D\x01" "10=000\x01";
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(loop.transport->send(as_span(order)).value() == order.size());
+        REQUIRE(loop.read_peer(order.size()) == order);
+    }
+
+    // Once the SQ thread has gone idle, the next submit has to wake it
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    const bool asleep = loop.ctx.sq_needs_wakeup();
+    const uint64_t wakeups = loop.ctx.sq_wakeups();
+    REQUIRE(loop.transport->send(as_span(order)).value() == order.size());
+    REQUIRE(loop.read_peer(order.size()) == order);
+    if (asleep) {
+        REQUIRE(loop.ctx.sq_wakeups() > wakeups);
+    }
+    if (!sqpoll) {
+        REQUIRE(loop.ctx.sq_wakeups() == 0);
+    }
+
+    // Receives complete in either mode
+    REQUIRE(::send(loop.peer, order.data(), order.size(), MSG_NOSIGNAL) ==
+            static_cast<IoSize>(order.size()));
+    std::string received;
+    std::array<char, 256> buf{};
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{2};
+    while (received.size() < order.size() && std::chrono::steady_clock::now() < deadline) {
+        if (auto n = loop.transport->receive(buf); n) {
+            received.append(buf.data(), *n);
+        }
+    }
+    REQUIRE(received == order);
+}
+#endif
@@ -1,9 +1,15 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <array>
+#include <limits>
+#include <string>
+#include <string_view>
+
 #include "nexusfix/types/tag.hpp"
 #include "nexusfix/types/field_types.hpp"
 #include "nexusfix/types/error.hpp"
+#include "nexusfix/util/timestamp_parser.hpp"
 
 using namespace nfx;
 using namespace nfx::literals;
@@ -94,6 +100,21 @@ TEST_CASE("FixedPrice arithmetic", "[types][price][regression]") {
         REQUIRE(a > c);
         REQUIRE(c < a);
     }
+
+    SECTION("Exact text formatting") {
+        auto text = [](FixedPrice p) {
+            char buf[FixedPrice::MAX_CHARS];
+            return std::string(buf, p.to_chars(buf));
+        };
+
+        REQUIRE(text(FixedPrice::from_string("150.25")) == "150.25");
+        REQUIRE(text(FixedPrice::from_string("100")) == "100");
+        REQUIRE(text(FixedPrice::from_string("-50.25")) == "-50.25");
+        REQUIRE(text(FixedPrice::from_string("0.00000001")) == "0.00000001");
+        REQUIRE(text(FixedPrice::from_string("123456789.12345678")) == "123456789.12345678");
+        REQUIRE(text(FixedPrice{0}) == "0");
+        REQUIRE(text(FixedPrice{std::numeric_limits<int64_t>::min()}) == "-92233720368.54775808");
+    }
 }
 
 // ============================================================================
@@ -124,6 +145,120 @@ TEST_CASE("Qty operations", "[types][qty][regression]") {
         REQUIRE((a + b).whole() == 150);
         REQUIRE((a - b).whole() == 50);
     }
+
+    SECTION("Exact text formatting") {
+        auto text = [](Qty q) {
+            char buf[Qty::MAX_CHARS];
+            return std::string(buf, q.to_chars(buf));
+        };
+
+        REQUIRE(text(Qty::from_string("100")) == "100");
+        REQUIRE(text(Qty::from_string("100.25")) == "100.25");
+        REQUIRE(text(Qty::from_string("0.0001")) == "0.0001");
+        REQUIRE(text(Qty{-5000}) == "-0.5");
+        REQUIRE(text(Qty{std::numeric_limits<int64_t>::min()}) == "-922337203685477.5808");
+    }
+}
+
+// ============================================================================
+// SWAR Decimal Parsing Tests
+// ============================================================================
+
+TEST_CASE("SWAR decimal parsing matches scalar", "[types][price][qty][simd]") {
+    // Compile-time evaluation always takes the scalar loop, so it is the
+    // reference for the runtime SWAR path on the same text.
+    static constexpr std::array<std::string_view, 34> inputs{
+        "0", "7", "150.25", "-50.25", "0.00000001", "12345678", "12345678.9",
+        "12345678901.5", "9999999999.99999999", "1.123456789", ".5", "5.",
+        "-", "-.", ".", "", "12a3.5", "1.2.3", "1.2x", "--5", "00000000000042",
+        "3.14159265358979", "42.000", "00000000000000000042", "0000000000000001.5",
+        "0.1234", "99.99999999999", "1 2", "1e5", "+1",
+        "12345678.12345678", "00000000012345.67", "0000000000000042.", "0000000000000042"
+    };
+    static constexpr auto expected_price = [] {
+        std::array<int64_t, inputs.size()> out{};
+        for (size_t i = 0; i < inputs.size(); ++i) out[i] = FixedPrice::from_string(inputs[i]).raw;
+        return out;
+    }();
+    static constexpr auto expected_qty = [] {
+        std::array<int64_t, inputs.size()> out{};
+        for (size_t i = 0; i < inputs.size(); ++i) out[i] = Qty::from_string(inputs[i]).raw;
+        return out;
+    }();
+
+    SECTION("Fixed inputs") {
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            INFO("input: " << inputs[i]);
+            REQUIRE(FixedPrice::from_string(inputs[i]).raw == expected_price[i]);
+            REQUIRE(Qty::from_string(inputs[i]).raw == expected_qty[i]);
+        }
+    }
+
+    SECTION("Every integer and fraction length") {
+        const std::string digits = "987654321012345678901234";
+        for (size_t int_len = 0; int_len <= 10; ++int_len) {
+            for (size_t frac_len = 0; frac_len <= 10; ++frac_len) {
+                int64_t integer = 0;
+                for (size_t i = 0; i < int_len; ++i) integer = integer * 10 + (digits[i] - '0');
+                int64_t price_frac = 0;
+                int64_t qty_frac = 0;
+                for (size_t i = 0; i < 8; ++i) {
+                    const int64_t digit = i < frac_len ? digits[int_len + i] - '0' : 0;
+                    price_frac = price_frac * 10 + digit;
+                    if (i < 4) qty_frac = qty_frac * 10 + digit;
+                }
+
+                std::string text = digits.substr(0, int_len);
+                if (frac_len > 0) text += "." + digits.substr(int_len, frac_len);
+                INFO("text: " << text);
+                REQUIRE(FixedPrice::from_string(text).raw == integer * FixedPrice::SCALE + price_frac);
+                REQUIRE(Qty::from_string(text).raw == integer * Qty::SCALE + qty_frac);
+                REQUIRE(FixedPrice::from_string("-" + text).raw ==
+                        -(integer * FixedPrice::SCALE + price_frac));
+            }
+        }
+    }
+
+    SECTION("Does not read past the view") {
+        // Digits right after the view must not leak into the value
+        const std::string buffer = "12345.678999999999";
+        const std::string_view text{buffer};
+        REQUIRE(FixedPrice::from_string(text.substr(0, 9)).raw == 1234567800000LL);
+        REQUIRE(FixedPrice::from_string(text.substr(2, 8)).raw == 34567890000LL);
+        REQUIRE(Qty::from_string(text.substr(0, 9)).raw == 123456780LL);
+        REQUIRE(Qty::from_string(text.substr(0, 3)).raw == 1230000LL);
+    }
+}
+
+TEST_CASE("Fixed-width numeric parsing matches general parsing", "[types][price][qty][simd]") {
+    SECTION("Fixed decimals") {
+        static constexpr std::array<std::string_view, 16> inputs{
+            "150.2500", "-150.2500", "12345678.1234", "1.0001", "0.1234",
+            "99999999.9999", "123456789.1234", "150.25", "150.250000", "1502500",
+            "15.02.500", "150x2500", "1.2a45", "", "-", "12345.6789"
+        };
+        for (std::string_view text : inputs) {
+            INFO("text: " << text);
+            REQUIRE(FixedPrice::from_fixed_decimals<4>(text).raw == FixedPrice::from_string(text).raw);
+            REQUIRE(Qty::from_fixed_decimals<4>(text).raw == Qty::from_string(text).raw);
+            REQUIRE(FixedPrice::from_fixed_decimals<2>(text).raw == FixedPrice::from_string(text).raw);
+        }
+        REQUIRE(FixedPrice::from_fixed_decimals<8>("1.00000001").raw == 100000001);
+        REQUIRE(FixedPrice::from_fixed_decimals<4>("12345678.1234").raw == 1234567812340000LL);
+    }
+
+    SECTION("Fixed digits") {
+        const std::string buffer = "000012345678901234|9";
+        const std::string_view text{buffer};
+        uint64_t value = 0;
+        REQUIRE(detail::swar_parse_fixed<9>(text.data() + 9, value));
+        REQUIRE(value == 678901234);
+        REQUIRE(detail::swar_parse_fixed<16>(text.data() + 2, value));
+        REQUIRE(value == 12345678901234ULL);
+        REQUIRE(detail::swar_parse_fixed<1>(text.data() + 17, value));
+        REQUIRE(value == 4);
+        REQUIRE_FALSE(detail::swar_parse_fixed<3>(text.data() + 16, value));
+    }
 }
 
 // ============================================================================
@@ -229,3 +364,91 @@ TEST_CASE("Timestamp operations", "[types][timestamp][regression]") {
     REQUIRE(ts.as_millis() == 1000LL);
     REQUIRE(ts.as_seconds() == 1LL);
 }
+
+TEST_CASE("Timestamp UTC text conversion", "[types][timestamp][regression]") {
+    auto text = [](Timestamp ts) {
+        char buf[Timestamp::MAX_CHARS];
+        return std::string(buf, ts.to_utc_chars(buf));
+    };
+
+    SECTION("Shortest exact sub-second precision") {
+        REQUIRE(text(Timestamp{0}) == "19700101-00:00:00");
+        REQUIRE(text(Timestamp{1704164645123000000LL}) == "20240102-03:04:05.123");
+        REQUIRE(text(Timestamp{1704164645123456000LL}) == "20240102-03:04:05.123456");
+        REQUIRE(text(Timestamp{1704164645123456789LL}) == "20240102-03:04:05.123456789");
+        REQUIRE(text(Timestamp{951782400000000000LL}) == "20000229-00:00:00");
+        REQUIRE(text(Timestamp{-1000000LL}) == "19691231-23:59:59.999");
+    }
+
+    SECTION("Parse") {
+        REQUIRE(Timestamp::from_utc_string("20240102-03:04:05")->nanos == 1704164645000000000LL);
+        REQUIRE(Timestamp::from_utc_string("20240102-03:04:05.5")->nanos == 1704164645500000000LL);
+        REQUIRE(Timestamp::from_utc_string("20240102-03:04:05.123456789012")->nanos ==
+                1704164645123456789LL);
+        STATIC_REQUIRE(Timestamp::from_utc_string("19700101-00:00:01")->nanos == 1000000000LL);
+    }
+
+    SECTION("Round trip") {
+        for (int64_t ns : {1704164645123456789LL, 4102444799999000000LL, 86399000000000LL}) {
+            auto s = text(Timestamp{ns});
+            REQUIRE(Timestamp::from_utc_string(s)->nanos == ns);
+        }
+    }
+
+    SECTION("Malformed") {
+        REQUIRE_FALSE(Timestamp::from_utc_string("").has_value());
+        REQUIRE_FALSE(Timestamp::from_utc_string("2024010203:04:05").has_value());
+        REQUIRE_FALSE(Timestamp::from_utc_string("20241302-03:04:05").has_value());
+        REQUIRE_FALSE(Timestamp::from_utc_string("20240102-03:04:05.").has_value());
+        REQUIRE_FALSE(Timestamp::from_utc_string("20240102-03:04:05x1").has_value());
+        REQUIRE_FALSE(Timestamp::from_utc_string("2024O102-03:04:05").has_value());
+    }
+}
+
+TEST_CASE("Timestamp SWAR parsing matches scalar", "[types][timestamp][simd]") {
+    // Compile-time evaluation takes the scalar loop: the reference result
+    static constexpr std::array<std::string_view, 18> inputs{
+        "20240102-03:04:05", "20240102-03:04:05.5", "20240102-03:04:05.123",
+        "20240102-03:04:05.123456", "20240102-03:04:05.12345678",
+        "20240102-03:04:05.123456789", "20240102-03:04:05.1234567890",
+        "19700101-00:00:00", "20991231-23:59:60.999", "20240229-12:00:00.000001",
+        "20240102 03:04:05", "20240102-03-04-05", "20240102-24:00:00",
+        "20240102-03:60:00", "20240100-03:04:05", "20240102-03:04:05.12x",
+        "20240102-03:04:05.", "2024010203:04:05.123"
+    };
+    static constexpr auto expected = [] {
+        std::array<int64_t, inputs.size()> out{};
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            const auto ts = Timestamp::from_utc_string(inputs[i]);
+            out[i] = ts ? ts->nanos : -1;
+        }
+        return out;
+    }();
+
+    SECTION("Stateless parse") {
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            INFO("input: " << inputs[i]);
+            const auto ts = Timestamp::from_utc_string(inputs[i]);
+            REQUIRE((ts ? ts->nanos : -1) == expected[i]);
+        }
+    }
+
+    SECTION("Cached date parser") {
+        util::TimestampParser parser;
+        for (int pass = 0; pass < 2; ++pass) {
+            for (size_t i = 0; i < inputs.size(); ++i) {
+                INFO("input: " << inputs[i]);
+                const auto ts = parser.parse(inputs[i]);
+                REQUIRE((ts ? ts->nanos : -1) == expected[i]);
+            }
+        }
+    }
+
+    SECTION("Date change refreshes the cache") {
+        util::TimestampParser parser;
+        REQUIRE(parser.parse("20240102-23:59:59.999")->nanos == 1704239999999000000LL);
+        REQUIRE(parser.parse("20240103-00:00:00")->nanos == 1704240000000000000LL);
+        REQUIRE_FALSE(parser.parse("20241303-00:00:00").has_value());
+        REQUIRE(parser.parse("20240103-00:00:01")->nanos == 1704240001000000000LL);
+    }
+}
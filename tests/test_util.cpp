@@ -0,0 +1,604 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "nexusfix/util/binary_log.hpp"
+#include "nexusfix/util/cpu_topology.hpp"
+#include "nexusfix/util/event_trace.hpp"
+#include "nexusfix/util/latency_histogram.hpp"
+#include "nexusfix/util/perf_counters.hpp"
+#include "nexusfix/util/rdtsc_timestamp.hpp"
+#include "nexusfix/util/shm_metrics.hpp"
+
+#if NFX_PLATFORM_POSIX
+#include <unistd.h>
+#endif
+
+using namespace nfx;
+
+namespace {
+
+/// Unique temp path per run so parallel test runs do not collide
+std::filesystem::path temp_test_path(std::string_view base) {
+    const auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+    return std::filesystem::temp_directory_path() / (std::string{base} + "_" + std::to_string(stamp));
+}
+
+} // namespace
+
+#if NFX_PLATFORM_POSIX
+namespace {
+
+/// Per-process segment name so parallel test runs do not collide
+std::string shm_test_name(std::string_view base) {
+    return std::string{base} + "." + std::to_string(::getpid());
+}
+
+} // namespace
+#endif
+
+// ============================================================================
+// Latency Histogram Tests
+// ============================================================================
+
+TEST_CASE("Latency histograms", "[util][latency]") {
+    using nfx::util::HistogramLayout;
+    using nfx::util::LatencyProbe;
+    using nfx::util::LatencyRegistry;
+
+    SECTION("log-linear buckets bound the error") {
+        for (uint64_t v : {0ULL, 1ULL, 63ULL, 64ULL, 65ULL, 1000ULL, 123456789ULL, 1ULL << 39}) {
+            const size_t bucket = HistogramLayout::index(v);
+            REQUIRE(bucket < HistogramLayout::BUCKETS);
+            const uint64_t upper = HistogramLayout::upper_bound(bucket);
+            REQUIRE(upper >= v);
+            REQUIRE(upper - v <= v / HistogramLayout::SUB_BUCKETS);
+            if (bucket > 0) REQUIRE(HistogramLayout::upper_bound(bucket - 1) < v);
+        }
+        REQUIRE(HistogramLayout::index(~0ULL) == HistogramLayout::BUCKETS - 1);
+    }
+
+    SECTION("percentiles of a recorded distribution") {
+        nfx::util::LatencyRecorder recorder;
+        for (uint64_t v = 1; v <= 1000; ++v) {
+            recorder.record(LatencyProbe::BuildToSend, v);
+        }
+        auto snap = recorder.snapshot(LatencyProbe::BuildToSend);
+        REQUIRE(snap.count() == 1000);
+        REQUIRE(snap.data().min == 1);
+        REQUIRE(snap.data().max == 1000);
+        REQUIRE(snap.percentile_cycles(50) >= 500);
+        REQUIRE(snap.percentile_cycles(50) <= 516);
+        REQUIRE(snap.percentile_cycles(100) == 1000);
+        REQUIRE(snap.percentile_ns(99) > 0.0);
+        REQUIRE(recorder.snapshot(LatencyProbe::RecvToParse).empty());
+    }
+
+    SECTION("per-thread recorders, consistent cross-thread snapshots") {
+        auto* mine = LatencyRegistry::local();
+        REQUIRE(mine != nullptr);
+        REQUIRE(LatencyRegistry::local() == mine);
+
+        const uint64_t before = LatencyRegistry::aggregate(LatencyProbe::ParseToCallback).count();
+        constexpr uint64_t RECORDS = 100000;
+        std::atomic<bool> done{false};
+        nfx::util::LatencyRecorder* theirs = nullptr;
+
+        std::thread writer([&] {
+            theirs = LatencyRegistry::local();
+            for (uint64_t i = 0; i < RECORDS; ++i) {
+                theirs->record(LatencyProbe::ParseToCallback, 100 + (i & 1023));
+            }
+            done.store(true, std::memory_order_release);
+        });
+
+        // Every snapshot is internally consistent while the writer runs
+        while (!done.load(std::memory_order_acquire)) {
+            auto snap = LatencyRegistry::aggregate(LatencyProbe::ParseToCallback);
+            uint64_t total = 0;
+            for (uint64_t c : snap.data().counts) total += c;
+            REQUIRE(total == snap.count());
+        }
+        writer.join();
+
+        REQUIRE(theirs != mine);
+        REQUIRE(LatencyRegistry::aggregate(LatencyProbe::ParseToCallback).count() ==
+                before + RECORDS);
+    }
+}
+
+// ============================================================================
+// Binary Log Tests
+// ============================================================================
+
+TEST_CASE("Binary log", "[util][binlog]") {
+    using nfx::util::BinaryLogReader;
+    using nfx::util::BinaryLogRing;
+
+    SECTION("ring wraps with padding and drops when full") {
+        BinaryLogRing ring{0};
+        constexpr size_t RECORD = 4096;
+        size_t written = 0;
+        uint32_t next_site = 0;
+
+        auto fill = [&] {
+            while (char* p = ring.reserve(RECORD)) {
+                const BinaryLogRing::RecordHeader hdr{next_site++, RECORD, 0};
+                std::memcpy(p, &hdr, sizeof(hdr));
+                ring.commit(RECORD);
+                ++written;
+            }
+        };
+        uint32_t expected_site = 0;
+        auto drain = [&] {
+            return ring.drain([&](const BinaryLogRing::RecordHeader& hdr,
+                                  std::span<const char> payload) {
+                REQUIRE(hdr.site == expected_site++);
+                REQUIRE(payload.size() == RECORD - sizeof(hdr));
+            });
+        };
+
+        fill();
+        REQUIRE(written == BinaryLogRing::CAPACITY / RECORD);
+        REQUIRE(ring.dropped() == 1);
+        REQUIRE(drain() == written);
+
+        // Misalign the tail so later records straddle the end of the buffer
+        char* p = ring.reserve(16 * 3);
+        REQUIRE(p != nullptr);
+        const BinaryLogRing::RecordHeader small{next_site++, 16 * 3, 0};
+        std::memcpy(p, &small, sizeof(small));
+        ring.commit(16 * 3);
+        REQUIRE(ring.drain([](const auto&, std::span<const char>) {}) == 1);
+        ++expected_site;
+        for (int round = 0; round < 3; ++round) {
+            fill();
+            drain();
+        }
+        REQUIRE(expected_site == next_site);
+    }
+
+    SECTION("records round-trip through writer and reader") {
+        const std::string path = temp_test_path("nfx_test_binlog").string() + ".blog";
+        enum class Side : uint8_t { Buy = 1, Sell = 2 };
+        const std::string cl_ord_id = "ORD-42";
+        {
+            nfx::util::BinaryLogWriter writer{{.path = path}};
+            REQUIRE(writer.is_open());
+            nfx::util::BinaryLogWriter second{{.path = path + ".2"}};
+            REQUIRE_FALSE(second.is_open());
+
+            NFX_BLOG_INFO(Trade, "fill {} side={} qty={} px={:.2f} last={} {}",
+                          cl_ord_id, Side::Sell, -7, 101.256, true, 'X');
+            std::thread other([] {
+                NFX_BLOG_WARN(Ops, "{{literal}} {:>5}|{:#x}", "ab", 255u);
+            });
+            other.join();
+            nfx::util::BinaryLog::set_level(nfx::util::LogLevel::Warn);
+            NFX_BLOG_DEBUG(Ops, "filtered {}", 1);
+            nfx::util::BinaryLog::set_level(nfx::util::LogLevel::Debug);
+            NFX_BLOG_ERROR(Plugin, "no args");
+            writer.flush();
+            REQUIRE(writer.records() >= 3);
+        }
+
+        BinaryLogReader reader;
+        REQUIRE(reader.open(path));
+        std::vector<std::string> messages;
+        std::vector<std::string> json;
+        while (auto record = reader.next()) {
+            messages.push_back(BinaryLogReader::message(*record));
+            json.push_back(BinaryLogReader::format_json(*record));
+            REQUIRE(record->unix_ns > 0);
+            REQUIRE(BinaryLogReader::format_text(*record).find("test_util.cpp:") !=
+                    std::string::npos);
+        }
+        REQUIRE_FALSE(reader.truncated());
+        REQUIRE(reader.dropped() == 0);
+        // Threads drain in ring order, so only per-thread order is fixed
+        std::ranges::sort(messages);
+        std::ranges::sort(json);
+        REQUIRE(messages == std::vector<std::string>{
+            "fill ORD-42 side=2 qty=-7 px=101.26 last=true X",
+            "no args",
+            "{literal}    ab|0xff"});
+        const std::string all_json = json[0] + json[1] + json[2];
+        REQUIRE(all_json.find(R"("channel":"trade")") != std::string::npos);
+        REQUIRE(all_json.find(R"("args":["ORD-42",2,-7,101.256,true,"X"])") != std::string::npos);
+        REQUIRE(all_json.find(R"("level":"WRN")") != std::string::npos);
+
+        // A cut-off tail is reported, not misread
+        const auto size = std::filesystem::file_size(path);
+        std::filesystem::resize_file(path, size - 3);
+        BinaryLogReader cut;
+        REQUIRE(cut.open(path));
+        size_t count = 0;
+        while (cut.next()) ++count;
+        REQUIRE(count == 2);
+        REQUIRE(cut.truncated());
+
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + ".2");
+    }
+}
+
+// ============================================================================
+// CpuTopology Tests
+// ============================================================================
+
+TEST_CASE("CpuTopology plans thread placement", "[util][numa][topology]") {
+    using namespace nfx::util;
+
+    // 8 cores x 2 SMT threads (siblings n, n+8), two 4-core L3 domains,
+    // isolcpus=2-7,10-15
+    const auto root = temp_test_path("nfx_sysfs");
+    const auto cpu_dir = root / "devices/system/cpu";
+    auto write = [](const std::filesystem::path& path, std::string_view text) {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream{path} << text << '\n';
+    };
+    write(cpu_dir / "online", "0-15");
+    write(cpu_dir / "isolated", "2-7,10-15");
+    for (int cpu = 0; cpu < 16; ++cpu) {
+        const auto dir = cpu_dir / ("cpu" + std::to_string(cpu));
+        const int core = cpu % 8;
+        write(dir / "topology/thread_siblings_list",
+              std::to_string(core) + "," + std::to_string(core + 8));
+        write(dir / "cache/index0/level", "1");
+        write(dir / "cache/index1/level", "3");
+        write(dir / "cache/index1/shared_cpu_list", core < 4 ? "0-3,8-11" : "4-7,12-15");
+        std::filesystem::create_directories(dir / "node0");
+    }
+
+    const auto topo = CpuTopology::detect(root.string());
+    std::filesystem::remove_all(root);
+
+    SECTION("sysfs layout") {
+        REQUIRE(topo.cpus().size() == 16);
+        REQUIRE(topo.siblings(9) == std::vector<int>{1, 9});
+        REQUIRE(topo.find(12)->l3 == 4);
+        REQUIRE(topo.find(3)->l3 == 0);
+        REQUIRE(topo.find(5)->isolated);
+        REQUIRE_FALSE(topo.find(8)->isolated);
+        REQUIRE(topo.find(7)->node == 0);
+        REQUIRE(topo.find(16) == nullptr);
+    }
+
+    SECTION("critical threads get whole cores in one L3 domain") {
+        PlacementRequest request;
+        request.session_shards = 2;
+        request.nic.node = 0;
+        request.nic.irq_cores = {2};
+        request.exclude = {0};
+
+        const auto plan = plan_placement(topo, request);
+        REQUIRE(plan.complete(request));
+        REQUIRE(plan.node == 0);
+        REQUIRE(plan.io_core == 4);
+        REQUIRE(plan.shard_cores == std::vector<int>{5, 6});
+
+        // Noisy threads on the other L3 domain, never next to a critical thread
+        for (int noisy : {plan.logger_core, plan.flusher_core}) {
+            REQUIRE(noisy >= 0);
+            REQUIRE(topo.find(noisy)->l3 == 0);
+            for (int critical : {4, 5, 6}) {
+                REQUIRE(topo.find(noisy)->core != topo.find(critical)->core);
+            }
+        }
+        REQUIRE(plan.logger_core != plan.flusher_core);
+
+        const auto affinity = plan.shard_affinity();
+        REQUIRE(affinity.allowed_cores == std::vector<int>{5, 6});
+        REQUIRE(affinity.numa_node == 0);
+    }
+
+    SECTION("IRQ cores and excluded cores are used last or never") {
+        PlacementRequest request;
+        request.session_shards = 6;
+        request.logger = false;
+        request.flusher = false;
+        request.nic.irq_cores = {7};
+        request.exclude = {0, 8};
+
+        const auto plan = plan_placement(topo, request);
+        REQUIRE(plan.complete(request));
+        REQUIRE(plan.shard_cores.back() == 7);   // The IRQ core fills last
+        REQUIRE(std::find(plan.shard_cores.begin(), plan.shard_cores.end(), 0) ==
+                plan.shard_cores.end());
+
+        request.session_shards = 7;   // Only 7 usable physical cores
+        const auto full = plan_placement(topo, request);
+        REQUIRE_FALSE(full.complete(request));
+        REQUIRE(full.shard_cores.back() == -1);
+    }
+
+    SECTION("empty topology leaves threads unpinned") {
+        PlacementRequest request;
+        const auto plan = plan_placement(CpuTopology{}, request);
+        REQUIRE(plan.io_core == -1);
+        REQUIRE(plan.shard_cores == std::vector<int>{-1});
+        REQUIRE(plan.shard_affinity().allowed_cores.empty());
+    }
+}
+
+#if NFX_SHM_AVAILABLE
+// ============================================================================
+// Shared-memory Metrics Tests
+// ============================================================================
+
+TEST_CASE("ShmMetricsReader scrapes engine metrics without touching the engine", "[util][shm][metrics]") {
+    using namespace nfx::util;
+    const auto name = shm_test_name("metrics");
+    auto registry = ShmMetricsRegistry::create(name, {.max_metrics = 64, .max_slots = 256});
+    REQUIRE(registry.has_value());
+
+    SessionMetrics oms{*registry, "session=\"OMS1\""};
+    SessionMetrics md{*registry, "session=\"MD1\""};
+    ShmGauge depth = registry->gauge("nfx_queue_depth");
+
+    auto reader = ShmMetricsReader::attach(name);
+    REQUIRE(reader.has_value());
+    const uint64_t generation = reader->generation();
+    CHECK(reader->size() == registry->size());
+
+    nfx::SessionStats stats;
+    stats.messages_sent = 42;
+    stats.bytes_sent = 4200;
+    oms.publish(stats);
+    oms.record_latency(0);
+    oms.record_latency(700);
+    oms.record_latency(900);
+    depth.set(-3);
+
+    std::string text;
+    write_prometheus(*reader, text);
+    CHECK(text.find("nfx_session_messages_sent_total{session=\"OMS1\"} 42\n") != std::string::npos);
+    CHECK(text.find("nfx_session_messages_sent_total{session=\"MD1\"} 0\n") != std::string::npos);
+    CHECK(text.find("nfx_queue_depth -3\n") != std::string::npos);
+    CHECK(text.find("nfx_session_latency_ns_bucket{session=\"OMS1\",le=\"0\"} 1\n") != std::string::npos);
+    CHECK(text.find("nfx_session_latency_ns_bucket{session=\"OMS1\",le=\"1023\"} 3\n") != std::string::npos);
+    CHECK(text.find("nfx_session_latency_ns_sum{session=\"OMS1\"} 1600\n") != std::string::npos);
+    CHECK(text.find("nfx_session_latency_ns_count{session=\"OMS1\"} 3\n") != std::string::npos);
+
+    // One TYPE line per metric family, even with two sessions registered
+    size_t types = 0;
+    for (size_t pos = text.find("# TYPE nfx_session_messages_sent_total"); pos != std::string::npos;
+         pos = text.find("# TYPE nfx_session_messages_sent_total", pos + 1)) {
+        ++types;
+    }
+    CHECK(types == 1);
+
+    // Full segment: the handle still works but is not exported
+    ShmMetricsRegistry small = std::move(*ShmMetricsRegistry::create(name + "s", {.max_metrics = 1}));
+    ShmCounter kept = small.counter("kept_total");
+    ShmCounter dropped = small.counter("dropped_total");
+    dropped.add(5);
+    kept.add();
+    CHECK(small.size() == 1);
+    CHECK(kept.value() == 1);
+
+    (void)registry->counter("late_total");
+    CHECK(reader->generation() != generation);
+}
+#endif
+
+// ============================================================================
+// Event Trace Tests
+// ============================================================================
+
+TEST_CASE("Event trace", "[util][trace]") {
+    using nfx::util::TraceEvent;
+    using nfx::util::TracePhase;
+    using nfx::util::TraceRecord;
+    using nfx::util::TraceRegistry;
+    using nfx::util::TraceRing;
+
+    SECTION("ring keeps the newest records in order") {
+        auto ring = std::make_unique<TraceRing>();
+        const uint64_t total = TraceRing::CAPACITY + 100;
+        for (uint64_t i = 0; i < total; ++i) {
+            ring->record(1000 + i, TraceEvent::Send, TracePhase::Instant, 7,
+                         static_cast<uint32_t>(i));
+        }
+        std::vector<TraceRecord> records;
+        ring->snapshot(records);
+        REQUIRE(records.size() == TraceRing::CAPACITY);
+        REQUIRE(records.front().seq_num == 100);
+        REQUIRE(records.back().seq_num == total - 1);
+        REQUIRE(records.back().tsc == 1000 + total - 1);
+        REQUIRE(records.back().session == 7);
+        REQUIRE(records.back().event == TraceEvent::Send);
+        REQUIRE(records.back().phase == TracePhase::Instant);
+    }
+
+    SECTION("snapshots stay ordered while the owner writes") {
+        auto ring = std::make_unique<TraceRing>();
+        std::atomic<bool> done{false};
+        std::thread writer([&] {
+            for (uint32_t i = 0; i < 200000; ++i) {
+                ring->record(i, TraceEvent::Parse, TracePhase::Instant, 1, i);
+            }
+            done.store(true, std::memory_order_release);
+        });
+        std::vector<TraceRecord> records;
+        while (!done.load(std::memory_order_acquire)) {
+            records.clear();
+            ring->snapshot(records);
+            REQUIRE(records.size() <= TraceRing::CAPACITY);
+            for (size_t i = 1; i < records.size(); ++i) {
+                REQUIRE(records[i].seq_num == records[i - 1].seq_num + 1);
+                REQUIRE(records[i].tsc == records[i].seq_num);
+            }
+        }
+        writer.join();
+    }
+
+    SECTION("outlier trigger and Chrome trace dump") {
+        const uint16_t session = TraceRegistry::next_session();
+        const uint64_t t0 = nfx::util::detail::rdtscp();
+        nfx::util::trace_at(t0, TraceEvent::Recv, TracePhase::Instant, session, 42);
+        nfx::util::trace_at(t0 + 10, TraceEvent::Dispatch, TracePhase::Begin, session, 42);
+        nfx::util::trace_at(t0 + 20, TraceEvent::Dispatch, TracePhase::End, session, 42);
+
+        (void)TraceRegistry::take_outlier();
+        TraceRegistry::set_outlier_threshold_ns(1000);
+        const uint64_t threshold = TraceRegistry::outlier_threshold_cycles();
+        REQUIRE(threshold > 0);
+        TraceRegistry::check_outlier(t0, t0 + threshold / 2, session, 42);
+        REQUIRE_FALSE(TraceRegistry::take_outlier().has_value());
+        TraceRegistry::check_outlier(t0, t0 + threshold * 2, session, 42);
+        TraceRegistry::check_outlier(t0, t0 + threshold * 3, session, 43);
+        auto hit = TraceRegistry::take_outlier();
+        REQUIRE(hit.has_value());
+        REQUIRE(hit->session == session);
+        REQUIRE(hit->seq_num == 42);     // First trigger wins until taken
+        REQUIRE(hit->cycles == threshold * 2);
+        REQUIRE_FALSE(TraceRegistry::take_outlier().has_value());
+        TraceRegistry::set_outlier_threshold_ns(0);
+
+        std::string json;
+        TraceRegistry::write_chrome_trace(json);
+        REQUIRE(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+        REQUIRE(json.ends_with("]}\n"));
+        const std::string id = "\"trace_id\":\"" + std::to_string(session) + ":42\"";
+        REQUIRE(json.find("\"name\":\"dispatch\",\"cat\":\"nfx\",\"ph\":\"B\"") != std::string::npos);
+        REQUIRE(json.find("\"name\":\"outlier\"") != std::string::npos);
+        REQUIRE(json.find(id) != std::string::npos);
+        REQUIRE(std::count(json.begin(), json.end(), '{') ==
+                std::count(json.begin(), json.end(), '}'));
+    }
+}
+
+// ============================================================================
+// Perf Counter Tests
+// ============================================================================
+
+TEST_CASE("Perf counter scopes", "[util][perf]") {
+    using nfx::util::PerfCounterRegistry;
+    using nfx::util::PerfScope;
+    using nfx::util::PerfStage;
+    using nfx::util::PerfTotals;
+
+    SECTION("derived ratios") {
+        PerfTotals totals{.samples = 4, .cycles = 1000, .instructions = 2500,
+                          .cache_misses = 6, .branch_misses = 2};
+        REQUIRE(totals.ipc() == 2.5);
+        REQUIRE(totals.per_sample(totals.cache_misses) == 1.5);
+        totals.merge(totals);
+        REQUIRE(totals.samples == 8);
+        REQUIRE(totals.ipc() == 2.5);
+        REQUIRE(PerfTotals{}.ipc() == 0.0);
+        REQUIRE(PerfTotals{}.per_sample(5) == 0.0);
+    }
+
+    SECTION("every Nth scope samples its thread's group") {
+        const uint32_t every = PerfCounterRegistry::sample_every();
+        PerfCounterRegistry::set_sample_every(4);
+
+        bool opened = false;
+        size_t sampled = 0;
+        nfx::util::PerfThreadCounters* counters = nullptr;
+        std::thread worker([&] {
+            counters = PerfCounterRegistry::local();
+            for (int i = 0; i < 9; ++i) {
+                PerfScope scope{PerfStage::Parse};
+                sampled += scope.sampling();
+                volatile uint64_t sink = 0;
+                for (uint64_t n = 0; n < 1000; ++n) sink = sink + n;
+            }
+            opened = counters && counters->is_open();
+        });
+        worker.join();
+        PerfCounterRegistry::set_sample_every(every);
+        REQUIRE(counters != nullptr);
+
+        const PerfTotals parse = counters->totals(PerfStage::Parse);
+        REQUIRE(counters->totals(PerfStage::Send).samples == 0);
+        if (opened) {
+            // Scopes 1, 5 and 9
+            REQUIRE(sampled == 3);
+            REQUIRE(parse.samples == 3);
+            REQUIRE(parse.instructions >= 3000);
+            REQUIRE(parse.cycles > 0);
+        } else {
+            // perf_event_open refused here (paranoid level, container)
+            REQUIRE(sampled == 0);
+            REQUIRE(parse.samples == 0);
+            REQUIRE(PerfCounterRegistry::open_failures() > 0);
+        }
+        REQUIRE(PerfCounterRegistry::aggregate(PerfStage::Parse).samples >= parse.samples);
+    }
+}
+
+#if NFX_SHM_AVAILABLE
+TEST_CASE("PerfMetrics exports stage totals per stage", "[util][shm][metrics][perf]") {
+    using namespace nfx::util;
+    const auto name = shm_test_name("perf");
+    auto registry = ShmMetricsRegistry::create(name, {.max_metrics = 64, .max_slots = 256});
+    REQUIRE(registry.has_value());
+    PerfMetrics perf{*registry, "engine=\"oms\""};
+    perf.publish();
+
+    auto reader = ShmMetricsReader::attach(name);
+    REQUIRE(reader.has_value());
+    std::string text;
+    write_prometheus(*reader, text);
+    const std::string samples = "nfx_perf_samples_total{stage=\"dispatch\",engine=\"oms\"} " +
+        std::to_string(PerfCounterRegistry::aggregate(PerfStage::Dispatch).samples) + "\n";
+    CHECK(text.find(samples) != std::string::npos);
+    CHECK(text.find("nfx_perf_cycles_total{stage=\"send\",engine=\"oms\"}") != std::string::npos);
+    CHECK(text.find("nfx_perf_open_failures{engine=\"oms\"}") != std::string::npos);
+}
+#endif
+
+// ============================================================================
+// RdtscClock Tests
+// ============================================================================
+
+TEST_CASE("RdtscClock service publishes one calibration to every thread", "[util][clock]") {
+    using nfx::util::RdtscClock;
+
+    RdtscClock::initialize();
+    REQUIRE(RdtscClock::frequency_ghz() > 0.0);
+    REQUIRE(RdtscClock::calibration().mult > 0);
+
+    REQUIRE(RdtscClock::start_service(std::chrono::milliseconds{5}));
+    CHECK_FALSE(RdtscClock::start_service());
+    CHECK(RdtscClock::service_running());
+
+    std::atomic<bool> backwards{false};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&backwards] {
+            uint64_t last = RdtscClock::now_ns();
+            const auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds{50};
+            while (std::chrono::steady_clock::now() < until) {
+                const uint64_t now = RdtscClock::now_ns();
+                if (now < last) backwards.store(true);
+                last = now;
+            }
+        });
+    }
+    for (auto& reader : readers) reader.join();
+    CHECK_FALSE(backwards.load());
+
+    const auto sys_ns = static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    const auto tsc_ns = static_cast<int64_t>(RdtscClock::now_ns());
+    CHECK(std::abs(tsc_ns - sys_ns) < 50'000'000);
+
+    RdtscClock::stop_service();
+    CHECK_FALSE(RdtscClock::service_running());
+}
@@ -0,0 +1,77 @@
+// binlog_decode.cpp
+// Decode a NexusFIX binary log (util/binary_log.hpp) to text or JSON lines
+//
+// Usage: binlog_decode <file.blog> [--json] [--channel ops|trade|plugin]
+
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "nexusfix/util/binary_log.hpp"
+
+namespace {
+
+void usage(const char* argv0) {
+    std::fprintf(stderr, "usage: %s <file.blog> [--json] [--channel ops|trade|plugin]\n", argv0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using nfx::util::BinaryLogReader;
+    using nfx::util::LogChannel;
+
+    std::string path;
+    bool json = false;
+    std::optional<LogChannel> channel;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--json") {
+            json = true;
+        } else if (arg == "--channel" && i + 1 < argc) {
+            const std::string_view name = argv[++i];
+            for (LogChannel c : {LogChannel::Ops, LogChannel::Trade, LogChannel::Plugin}) {
+                if (nfx::util::log_channel_name(c) == name) channel = c;
+            }
+            if (!channel) {
+                usage(argv[0]);
+                return 2;
+            }
+        } else if (path.empty() && !arg.starts_with("--")) {
+            path = arg;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (path.empty()) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    BinaryLogReader reader;
+    if (!reader.open(path)) {
+        std::fprintf(stderr, "%s: not a readable binary log\n", path.c_str());
+        return 1;
+    }
+
+    while (auto record = reader.next()) {
+        if (channel && record->site->channel != *channel) continue;
+        const std::string line = json ? BinaryLogReader::format_json(*record)
+                                      : BinaryLogReader::format_text(*record);
+        std::fwrite(line.data(), 1, line.size(), stdout);
+        std::fputc('\n', stdout);
+    }
+
+    if (reader.dropped() > 0) {
+        std::fprintf(stderr, "%s: %llu records dropped by full rings\n", path.c_str(),
+                     static_cast<unsigned long long>(reader.dropped()));
+    }
+    if (reader.truncated()) {
+        std::fprintf(stderr, "%s: file ends inside an entry (truncated)\n", path.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,109 @@
+// metrics_exporter.cpp
+// Serve a NexusFIX metrics segment (util/shm_metrics.hpp) to Prometheus
+//
+// Usage: metrics_exporter <segment> [--port 9464] [--once]
+//
+// Attaches to the segment (it never writes to it) and answers every
+// HTTP request with the current values in text exposition format; --once
+// prints them to stdout and exits.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include "nexusfix/util/shm_metrics.hpp"
+
+namespace {
+
+void usage(const char* argv0) {
+    std::fprintf(stderr, "usage: %s <segment> [--port 9464] [--once]\n", argv0);
+}
+
+/// Write all of data (HTTP responses are small; a short write just retries)
+void write_all(int fd, std::string_view data) {
+    while (!data.empty()) {
+        const ssize_t n = ::send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+        if (n <= 0) return;
+        data.remove_prefix(static_cast<size_t>(n));
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using nfx::util::ShmMetricsReader;
+
+    std::string segment;
+    int port = 9464;
+    bool once = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--once") {
+            once = true;
+        } else if (arg == "--port" && i + 1 < argc) {
+            port = std::atoi(argv[++i]);
+        } else if (segment.empty() && !arg.starts_with("--")) {
+            segment = arg;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (segment.empty() || port <= 0 || port > 65535) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    auto reader = ShmMetricsReader::attach(segment);
+    if (!reader) {
+        std::fprintf(stderr, "%s: no metrics segment\n", segment.c_str());
+        return 1;
+    }
+
+    std::string body;
+    if (once) {
+        nfx::util::write_prometheus(*reader, body);
+        std::fwrite(body.data(), 1, body.size(), stdout);
+        return 0;
+    }
+
+    const int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    const int on = 1;
+    ::setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    if (listener < 0 ||
+        ::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listener, 16) != 0) {
+        std::perror("metrics_exporter: listen");
+        return 1;
+    }
+
+    for (;;) {
+        const int client = ::accept(listener, nullptr, nullptr);
+        if (client < 0) continue;
+
+        // Any request gets the metrics; the request itself is not parsed
+        char request[1024];
+        (void)::recv(client, request, sizeof(request), 0);
+
+        body.clear();
+        nfx::util::write_prometheus(*reader, body);
+        std::string response = "HTTP/1.1 200 OK\r\n"
+                               "Content-Type: text/plain; version=0.0.4\r\n"
+                               "Connection: close\r\n"
+                               "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n";
+        write_all(client, response);
+        write_all(client, body);
+        ::close(client);
+    }
+}